@@ -1459,7 +1459,8 @@ if(BUILD_CUDA_MODULE)
         # ship the CUDA toolkit with the wheel (e.g. PyTorch can make use of the
         # cudatoolkit conda package), or have a mechanism to locate the CUDA
         # toolkit from the system.
-        list(APPEND Open3D_3RDPARTY_PRIVATE_TARGETS CUDA::cusolver CUDA::cublas)
+        list(APPEND Open3D_3RDPARTY_PRIVATE_TARGETS CUDA::cusolver CUDA::cublas
+            CUDA::cusparse)
     else()
         # CMake docs   : https://cmake.org/cmake/help/latest/module/FindCUDAToolkit.html
         # cusolver 11.0: https://docs.nvidia.com/cuda/archive/11.0/cusolver/index.html#static-link-lapack
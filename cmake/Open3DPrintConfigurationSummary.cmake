@@ -21,6 +21,9 @@ function(open3d_print_configuration_summary)
     open3d_aligned_print("Intel RealSense Support" "${BUILD_LIBREALSENSE}")
     open3d_aligned_print("CUDA Support" "${BUILD_CUDA_MODULE}")
     open3d_aligned_print("ISPC Support" "${BUILD_ISPC_MODULE}")
+    if(BUILD_DISABLED_DTYPES)
+        open3d_aligned_print("Disabled Dtypes" "${BUILD_DISABLED_DTYPES}")
+    endif()
     open3d_aligned_print("Build GUI" "${BUILD_GUI}")
     open3d_aligned_print("Build WebRTC visualizer" "${BUILD_WEBRTC}")
     open3d_aligned_print("Build Shared Library" "${BUILD_SHARED_LIBS}")
@@ -69,6 +69,11 @@ function(open3d_set_global_properties target)
         target_link_libraries(${target} PRIVATE stdc++fs)
     endif()
 
+    # POSIX shared memory (shm_open) is in librt before glibc 2.34.
+    if(UNIX AND NOT APPLE AND NOT ANDROID)
+        target_link_libraries(${target} PRIVATE rt)
+    endif()
+
     # Colorize GCC/Clang terminal outputs
     if (CMAKE_CXX_COMPILER_ID STREQUAL "GNU")
         target_compile_options(${target} PRIVATE $<$<COMPILE_LANGUAGE:CXX>:-fdiagnostics-color=always>)
@@ -90,10 +95,20 @@ function(open3d_set_global_properties target)
         if (BUILD_CACHED_CUDA_MANAGER)
             target_compile_definitions(${target} PRIVATE BUILD_CACHED_CUDA_MANAGER)
         endif()
+        if (BUILD_ASYNC_CUDA_MANAGER)
+            target_compile_definitions(${target} PRIVATE BUILD_ASYNC_CUDA_MANAGER)
+        endif()
+    endif()
+    if (BUILD_CACHED_CPU_MANAGER)
+        target_compile_definitions(${target} PRIVATE BUILD_CACHED_CPU_MANAGER)
     endif()
     if (BUILD_ISPC_MODULE)
         target_compile_definitions(${target} PRIVATE BUILD_ISPC_MODULE)
     endif()
+    foreach(dtype IN LISTS BUILD_DISABLED_DTYPES)
+        string(TOUPPER ${dtype} DTYPE)
+        target_compile_definitions(${target} PRIVATE OPEN3D_DISABLE_DTYPE_${DTYPE})
+    endforeach()
     if (BUILD_GUI)
         target_compile_definitions(${target} PRIVATE BUILD_GUI)
     endif()
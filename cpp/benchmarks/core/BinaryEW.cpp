@@ -32,6 +32,7 @@
 #include "benchmarks/benchmark_utilities/Rand.h"
 #include "open3d/core/CUDAUtils.h"
 #include "open3d/core/Indexer.h"
+#include "open3d/core/LazyTensor.h"
 #include "open3d/core/ParallelFor.h"
 #include "open3d/core/Tensor.h"
 #include "open3d/utility/Logging.h"
@@ -207,5 +208,44 @@ ENUM_BM_TENSOR_WTIH_BOOL(BinaryEW, Le)
 ENUM_BM_TENSOR_WTIH_BOOL(BinaryEW, Eq)
 ENUM_BM_TENSOR_WTIH_BOOL(BinaryEW, Neq)
 
+// Evaluates (a - b) * c + d either eagerly or as one fused LazyTensor kernel.
+void BinaryEWChain(benchmark::State& state,
+                   int size,
+                   bool lazy,
+                   const Dtype& dtype,
+                   const Device& device) {
+    Tensor a = benchmarks::Rand({1, size}, 1, {1, 127}, dtype, device);
+    Tensor b = benchmarks::Rand({1, size}, 2, {1, 127}, dtype, device);
+    Tensor c = benchmarks::Rand({1, size}, 3, {1, 127}, dtype, device);
+    Tensor d = benchmarks::Rand({1, size}, 4, {1, 127}, dtype, device);
+    auto op = [&]() -> Tensor {
+        return lazy ? ((a.Lazy() - b) * c + d).Materialize()
+                    : (a - b) * c + d;
+    };
+
+    Tensor result = op();
+    benchmark::DoNotOptimize(result);
+
+    for (auto _ : state) {
+        Tensor result = op();
+        benchmark::DoNotOptimize(result);
+
+        cuda::Synchronize(device);
+    }
+}
+
+#define ENUM_BM_CHAIN(DEVICE, DEVICE_NAME)                                 \
+    BENCHMARK_CAPTURE(BinaryEWChain, Eager__##DEVICE_NAME##__100000000,    \
+                      100000000, false, Float32, DEVICE)                   \
+            ->Unit(benchmark::kMillisecond);                               \
+    BENCHMARK_CAPTURE(BinaryEWChain, Lazy__##DEVICE_NAME##__100000000,     \
+                      100000000, true, Float32, DEVICE)                    \
+            ->Unit(benchmark::kMillisecond);
+
+ENUM_BM_CHAIN(Device("CPU:0"), CPU)
+#ifdef BUILD_CUDA_MODULE
+ENUM_BM_CHAIN(Device("CUDA:0"), CUDA)
+#endif
+
 }  // namespace core
 }  // namespace open3d
@@ -527,11 +527,13 @@ void HashReserveInt3(benchmark::State& state,
 #ifdef BUILD_CUDA_MODULE
 #define ENUM_BM_BACKEND(FN)                                     \
     ENUM_BM_FACTOR(FN, Device("CPU:0"), HashBackendType::TBB)   \
+    ENUM_BM_FACTOR(FN, Device("CPU:0"), HashBackendType::Flat)  \
     ENUM_BM_FACTOR(FN, Device("CUDA:0"), HashBackendType::Slab) \
     ENUM_BM_FACTOR(FN, Device("CUDA:0"), HashBackendType::StdGPU)
 #else
-#define ENUM_BM_BACKEND(FN) \
-    ENUM_BM_FACTOR(FN, Device("CPU:0"), HashBackendType::TBB)
+#define ENUM_BM_BACKEND(FN)                                   \
+    ENUM_BM_FACTOR(FN, Device("CPU:0"), HashBackendType::TBB) \
+    ENUM_BM_FACTOR(FN, Device("CPU:0"), HashBackendType::Flat)
 #endif
 
 ENUM_BM_BACKEND(HashInsertInt)
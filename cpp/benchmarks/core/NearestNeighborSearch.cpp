@@ -0,0 +1,189 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/core/nns/NearestNeighborSearch.h"
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+
+#include "open3d/core/CUDAUtils.h"
+#include "open3d/data/Dataset.h"
+#include "open3d/t/io/PointCloudIO.h"
+
+namespace open3d {
+namespace core {
+namespace nns {
+
+enum class PointDistribution {
+    /// Uniform in the unit cube.
+    Uniform,
+    /// Gaussian clusters of varying density, as in multi-object scenes.
+    Clustered,
+    /// A real RGBD fragment, i.e. points near surfaces. The number of points
+    /// is given by the dataset.
+    Scan,
+};
+
+static Tensor CreatePoints(PointDistribution distribution, int64_t num_points) {
+    if (distribution == PointDistribution::Scan) {
+        data::PLYPointCloud pointcloud_ply;
+        t::geometry::PointCloud pcd;
+        t::io::ReadPointCloud(pointcloud_ply.GetPath(), pcd,
+                              {"auto", false, false, false});
+        return pcd.GetPointPositions().To(Float32).Contiguous();
+    }
+
+    std::mt19937 rng(0);
+    std::vector<float> values(num_points * 3);
+    if (distribution == PointDistribution::Uniform) {
+        std::uniform_real_distribution<float> uniform(0.f, 1.f);
+        std::generate(values.begin(), values.end(),
+                      [&]() { return uniform(rng); });
+    } else {
+        const int num_clusters = 32;
+        std::uniform_real_distribution<float> uniform(0.f, 1.f);
+        std::vector<float> centers(num_clusters * 3), sigmas(num_clusters);
+        std::generate(centers.begin(), centers.end(),
+                      [&]() { return uniform(rng); });
+        std::generate(sigmas.begin(), sigmas.end(),
+                      [&]() { return 0.005f + 0.05f * uniform(rng); });
+        std::normal_distribution<float> normal(0.f, 1.f);
+        std::uniform_int_distribution<int> cluster(0, num_clusters - 1);
+        for (int64_t i = 0; i < num_points; ++i) {
+            const int c = cluster(rng);
+            for (int j = 0; j < 3; ++j) {
+                values[i * 3 + j] =
+                        centers[c * 3 + j] + sigmas[c] * normal(rng);
+            }
+        }
+    }
+    return Tensor(values, {num_points, 3}, Float32);
+}
+
+/// Radius that holds about \p knn neighbors for the median point, so that
+/// radius searches return comparable results across distributions.
+static double EstimateRadius(const Tensor& points, int knn) {
+    const int64_t num_queries = std::min(points.GetLength(), int64_t(1000));
+    NearestNeighborSearch nns(points);
+    nns.KnnIndex();
+    Tensor distances = nns.KnnSearch(points.Slice(0, 0, num_queries), knn)
+                               .second.Slice(1, knn - 1, knn)
+                               .Contiguous();
+    std::vector<float> values = distances.ToFlatVector<float>();
+    std::nth_element(values.begin(), values.begin() + values.size() / 2,
+                     values.end());
+    return std::sqrt(values[values.size() / 2]);
+}
+
+static void KnnSearch(benchmark::State& state,
+                      const Device& device,
+                      PointDistribution distribution) {
+    const int knn = 16;
+    Tensor points = CreatePoints(distribution, state.range(0)).To(device);
+    NearestNeighborSearch nns(points);
+    nns.KnnIndex();
+
+    // Warm up.
+    nns.KnnSearch(points, knn);
+
+    for (auto _ : state) {
+        nns.KnnSearch(points, knn);
+        cuda::Synchronize(device);
+    }
+    state.SetItemsProcessed(state.iterations() * points.GetLength());
+}
+
+static void FixedRadiusSearch(benchmark::State& state,
+                              const Device& device,
+                              PointDistribution distribution) {
+    Tensor points = CreatePoints(distribution, state.range(0));
+    const double radius = EstimateRadius(points, 16);
+    points = points.To(device);
+    NearestNeighborSearch nns(points);
+    nns.FixedRadiusIndex(radius);
+
+    // Warm up.
+    nns.FixedRadiusSearch(points, radius);
+
+    for (auto _ : state) {
+        nns.FixedRadiusSearch(points, radius);
+        cuda::Synchronize(device);
+    }
+    state.SetItemsProcessed(state.iterations() * points.GetLength());
+}
+
+static void HybridSearch(benchmark::State& state,
+                         const Device& device,
+                         PointDistribution distribution) {
+    const int max_knn = 30;
+    Tensor points = CreatePoints(distribution, state.range(0));
+    const double radius = EstimateRadius(points, 16);
+    points = points.To(device);
+    NearestNeighborSearch nns(points);
+    nns.HybridIndex(radius);
+
+    // Warm up.
+    nns.HybridSearch(points, radius, max_knn);
+
+    for (auto _ : state) {
+        nns.HybridSearch(points, radius, max_knn);
+        cuda::Synchronize(device);
+    }
+    state.SetItemsProcessed(state.iterations() * points.GetLength());
+}
+
+#define ENUM_NNS_BENCHMARK(FN, DEVICE_NAME, DEVICE)                \
+    BENCHMARK_CAPTURE(FN, Uniform_##DEVICE_NAME, Device(DEVICE),   \
+                      PointDistribution::Uniform)                  \
+            ->Arg(100000)                                          \
+            ->Arg(1000000)                                         \
+            ->Unit(benchmark::kMillisecond);                       \
+    BENCHMARK_CAPTURE(FN, Clustered_##DEVICE_NAME, Device(DEVICE), \
+                      PointDistribution::Clustered)                \
+            ->Arg(100000)                                          \
+            ->Arg(1000000)                                         \
+            ->Unit(benchmark::kMillisecond);                       \
+    BENCHMARK_CAPTURE(FN, Scan_##DEVICE_NAME, Device(DEVICE),      \
+                      PointDistribution::Scan)                     \
+            ->Arg(0)                                               \
+            ->Unit(benchmark::kMillisecond);
+
+ENUM_NNS_BENCHMARK(KnnSearch, CPU, "CPU:0")
+ENUM_NNS_BENCHMARK(FixedRadiusSearch, CPU, "CPU:0")
+ENUM_NNS_BENCHMARK(HybridSearch, CPU, "CPU:0")
+#ifdef BUILD_CUDA_MODULE
+ENUM_NNS_BENCHMARK(KnnSearch, CUDA, "CUDA:0")
+ENUM_NNS_BENCHMARK(FixedRadiusSearch, CUDA, "CUDA:0")
+ENUM_NNS_BENCHMARK(HybridSearch, CUDA, "CUDA:0")
+#endif
+
+}  // namespace nns
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,108 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/geometry/PointCloud.h"
+
+#include <benchmark/benchmark.h>
+
+#include "open3d/data/Dataset.h"
+#include "open3d/geometry/KDTreeSearchParam.h"
+#include "open3d/io/PointCloudIO.h"
+
+namespace open3d {
+namespace benchmarks {
+
+// RGBD fragment of a living room, about 200k points with normals.
+class PointCloudFixture : public benchmark::Fixture {
+public:
+    void SetUp(const benchmark::State& state) {
+        data::PLYPointCloud pointcloud_ply;
+        pcd_ = io::CreatePointCloudFromFile(pointcloud_ply.GetPath());
+    }
+
+    void TearDown(const benchmark::State& state) {
+        // empty
+    }
+    std::shared_ptr<geometry::PointCloud> pcd_;
+};
+
+BENCHMARK_DEFINE_F(PointCloudFixture, EstimateNormalsKNN)
+(benchmark::State& state) {
+    geometry::PointCloud pcd = *pcd_;
+    for (auto _ : state) {
+        pcd.EstimateNormals(
+                geometry::KDTreeSearchParamKNN(int(state.range(0))));
+    }
+}
+
+BENCHMARK_REGISTER_F(PointCloudFixture, EstimateNormalsKNN)
+        ->Args({10})
+        ->Args({30})
+        ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_DEFINE_F(PointCloudFixture, EstimateNormalsHybrid)
+(benchmark::State& state) {
+    geometry::PointCloud pcd = *pcd_;
+    // Radius in mm.
+    const double radius = state.range(0) * 0.001;
+    for (auto _ : state) {
+        pcd.EstimateNormals(geometry::KDTreeSearchParamHybrid(radius, 30));
+    }
+}
+
+BENCHMARK_REGISTER_F(PointCloudFixture, EstimateNormalsHybrid)
+        ->Args({20})
+        ->Args({50})
+        ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_DEFINE_F(PointCloudFixture, ClusterDBSCAN)(benchmark::State& state) {
+    // Voxel size in mm, the density is typical for segmentation inputs.
+    auto pcd = pcd_->VoxelDownSample(state.range(0) * 0.001);
+    for (auto _ : state) {
+        pcd->ClusterDBSCAN(0.05, 10);
+    }
+}
+
+BENCHMARK_REGISTER_F(PointCloudFixture, ClusterDBSCAN)
+        ->Args({20})
+        ->Args({10})
+        ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_DEFINE_F(PointCloudFixture, SegmentPlane)(benchmark::State& state) {
+    for (auto _ : state) {
+        // Fixed seed for a reproducible amount of work.
+        pcd_->SegmentPlane(0.01, 3, int(state.range(0)), 0.99999999, 0);
+    }
+}
+
+BENCHMARK_REGISTER_F(PointCloudFixture, SegmentPlane)
+        ->Args({100})
+        ->Args({1000})
+        ->Unit(benchmark::kMillisecond);
+
+}  // namespace benchmarks
+}  // namespace open3d
@@ -28,8 +28,11 @@
 
 #include <benchmark/benchmark.h>
 
+#include <limits>
+
 #include "open3d/data/Dataset.h"
 #include "open3d/io/PointCloudIO.h"
+#include "open3d/io/TriangleMeshIO.h"
 
 namespace open3d {
 namespace pipelines {
@@ -73,6 +76,42 @@ BENCHMARK_CAPTURE(BenchmarkCreateFromPointCloudBallPivoting,
 
 // TODO: Add BENCHMARK for case `With Non Finite Points`.
 
+static void BenchmarkCreateFromPointCloudPoisson(benchmark::State& state,
+                                                 const size_t depth) {
+    // RGBD fragment with normals, about 200k points.
+    data::PLYPointCloud pointcloud_ply;
+    auto pcd = io::CreatePointCloudFromFile(pointcloud_ply.GetPath());
+
+    for (auto _ : state) {
+        geometry::TriangleMesh::CreateFromPointCloudPoisson(*pcd, depth);
+    }
+}
+
+BENCHMARK_CAPTURE(BenchmarkCreateFromPointCloudPoisson, Depth 8, 8)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BenchmarkCreateFromPointCloudPoisson, Depth 10, 10)
+        ->Unit(benchmark::kMillisecond);
+
+static void BenchmarkSimplifyQuadricDecimation(benchmark::State& state,
+                                               const double ratio) {
+    // About 350k triangles.
+    data::ArmadilloMesh armadillo_data;
+    auto mesh = io::CreateMeshFromFile(armadillo_data.GetPath());
+    const int target_number_of_triangles =
+            static_cast<int>(mesh->triangles_.size() * ratio);
+
+    for (auto _ : state) {
+        mesh->SimplifyQuadricDecimation(target_number_of_triangles,
+                                        std::numeric_limits<double>::infinity(),
+                                        1.0);
+    }
+}
+
+BENCHMARK_CAPTURE(BenchmarkSimplifyQuadricDecimation, Ratio 0.5, 0.5)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BenchmarkSimplifyQuadricDecimation, Ratio 0.1, 0.1)
+        ->Unit(benchmark::kMillisecond);
+
 }  // namespace registration
 }  // namespace pipelines
 }  // namespace open3d
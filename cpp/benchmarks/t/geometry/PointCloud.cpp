@@ -228,11 +228,13 @@ BENCHMARK_CAPTURE(ToLegacyPointCloud, CUDA, core::Device("CUDA:0"))
 #ifdef BUILD_CUDA_MODULE
 #define ENUM_VOXELDOWNSAMPLE_BACKEND()                                  \
     ENUM_VOXELSIZE(core::Device("CPU:0"), core::HashBackendType::TBB)   \
+    ENUM_VOXELSIZE(core::Device("CPU:0"), core::HashBackendType::Flat)  \
     ENUM_VOXELSIZE(core::Device("CUDA:0"), core::HashBackendType::Slab) \
     ENUM_VOXELSIZE(core::Device("CUDA:0"), core::HashBackendType::StdGPU)
 #else
-#define ENUM_VOXELDOWNSAMPLE_BACKEND() \
-    ENUM_VOXELSIZE(core::Device("CPU:0"), core::HashBackendType::TBB)
+#define ENUM_VOXELDOWNSAMPLE_BACKEND()                                \
+    ENUM_VOXELSIZE(core::Device("CPU:0"), core::HashBackendType::TBB) \
+    ENUM_VOXELSIZE(core::Device("CPU:0"), core::HashBackendType::Flat)
 #endif
 
 BENCHMARK_CAPTURE(LegacyVoxelDownSample, Legacy_0_01, 0.01)
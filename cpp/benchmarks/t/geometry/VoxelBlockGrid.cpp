@@ -0,0 +1,288 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/t/geometry/VoxelBlockGrid.h"
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+
+#include "open3d/camera/PinholeCameraIntrinsic.h"
+#include "open3d/core/CUDAUtils.h"
+#include "open3d/core/EigenConverter.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/data/Dataset.h"
+#include "open3d/io/PinholeCameraTrajectoryIO.h"
+#include "open3d/t/io/ImageIO.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+
+static const float depth_scale = 1000.0f;
+static const float depth_min = 0.1f;
+static const float depth_max = 3.0f;
+static const float trunc_multiplier = 4.0f;
+// Initial hash map capacity for 8^3 blocks, scaled for larger blocks.
+static const int64_t block_count_res8 = 10000;
+
+static core::Tensor CreateIntrinsicTensor() {
+    camera::PinholeCameraIntrinsic intrinsic = camera::PinholeCameraIntrinsic(
+            camera::PinholeCameraIntrinsicParameters::PrimeSenseDefault);
+    auto focal_length = intrinsic.GetFocalLength();
+    auto principal_point = intrinsic.GetPrincipalPoint();
+    return core::Tensor::Init<double>(
+            {{focal_length.first, 0, principal_point.first},
+             {0, focal_length.second, principal_point.second},
+             {0, 0, 1}});
+}
+
+/// The bundled Redwood RGB-D sequence, loaded once and kept on the host.
+struct RGBDSequence {
+    RGBDSequence() {
+        data::SampleRedwoodRGBDImages redwood_data;
+        auto trajectory = open3d::io::CreatePinholeCameraTrajectoryFromFile(
+                redwood_data.GetOdometryLogPath());
+        for (size_t i = 0; i < trajectory->parameters_.size(); ++i) {
+            extrinsics_.push_back(core::eigen_converter::EigenMatrixToTensor(
+                    trajectory->parameters_[i].extrinsic_));
+            depths_.push_back(*t::io::CreateImageFromFile(
+                    redwood_data.GetDepthPaths()[i]));
+            colors_.push_back(*t::io::CreateImageFromFile(
+                    redwood_data.GetColorPaths()[i]));
+        }
+        intrinsic_ = CreateIntrinsicTensor();
+    }
+
+    static const RGBDSequence& GetInstance() {
+        static RGBDSequence instance;
+        return instance;
+    }
+
+    core::Tensor intrinsic_;
+    std::vector<core::Tensor> extrinsics_;
+    std::vector<Image> depths_;
+    std::vector<Image> colors_;
+};
+
+static void ToDevice(const core::Device& device,
+                     std::vector<Image>& depths,
+                     std::vector<Image>& colors) {
+    const RGBDSequence& sequence = RGBDSequence::GetInstance();
+    depths.clear();
+    colors.clear();
+    for (size_t i = 0; i < sequence.depths_.size(); ++i) {
+        depths.push_back(sequence.depths_[i].To(device));
+        colors.push_back(sequence.colors_[i].To(device));
+    }
+}
+
+static VoxelBlockGrid CreateVoxelBlockGrid(const core::Device& device,
+                                           const core::HashBackendType& backend,
+                                           float voxel_size,
+                                           int block_resolution) {
+    const int64_t scale = block_resolution / 8;
+    const int64_t block_count =
+            std::max<int64_t>(block_count_res8 / (scale * scale * scale), 1);
+    return VoxelBlockGrid({"tsdf", "weight", "color"},
+                          {core::Float32, core::UInt16, core::UInt16},
+                          {{1}, {1}, {3}}, voxel_size, block_resolution,
+                          block_count, device, backend);
+}
+
+static void IntegrateSequence(VoxelBlockGrid& vbg,
+                              const std::vector<Image>& depths,
+                              const std::vector<Image>& colors) {
+    const RGBDSequence& sequence = RGBDSequence::GetInstance();
+    for (size_t i = 0; i < depths.size(); ++i) {
+        core::Tensor block_coords = vbg.GetUniqueBlockCoordinates(
+                depths[i], sequence.intrinsic_, sequence.extrinsics_[i],
+                depth_scale, depth_max, trunc_multiplier);
+        vbg.Integrate(block_coords, depths[i], colors[i], sequence.intrinsic_,
+                      sequence.extrinsics_[i], depth_scale, depth_max,
+                      trunc_multiplier);
+    }
+}
+
+void GetUniqueBlockCoordinates(benchmark::State& state,
+                               const core::Device& device,
+                               const core::HashBackendType& backend,
+                               float voxel_size,
+                               int block_resolution) {
+    const RGBDSequence& sequence = RGBDSequence::GetInstance();
+    std::vector<Image> depths, colors;
+    ToDevice(device, depths, colors);
+    VoxelBlockGrid vbg = CreateVoxelBlockGrid(device, backend, voxel_size,
+                                              block_resolution);
+
+    // Warm up.
+    vbg.GetUniqueBlockCoordinates(depths[0], sequence.intrinsic_,
+                                  sequence.extrinsics_[0], depth_scale,
+                                  depth_max, trunc_multiplier);
+
+    for (auto _ : state) {
+        for (size_t i = 0; i < depths.size(); ++i) {
+            core::Tensor block_coords = vbg.GetUniqueBlockCoordinates(
+                    depths[i], sequence.intrinsic_, sequence.extrinsics_[i],
+                    depth_scale, depth_max, trunc_multiplier);
+        }
+        core::cuda::Synchronize(device);
+    }
+    state.SetItemsProcessed(state.iterations() * depths.size());
+}
+
+void Integrate(benchmark::State& state,
+               const core::Device& device,
+               const core::HashBackendType& backend,
+               float voxel_size,
+               int block_resolution) {
+    std::vector<Image> depths, colors;
+    ToDevice(device, depths, colors);
+
+    // Warm up.
+    {
+        VoxelBlockGrid vbg = CreateVoxelBlockGrid(device, backend, voxel_size,
+                                                  block_resolution);
+        IntegrateSequence(vbg, depths, colors);
+    }
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        VoxelBlockGrid vbg = CreateVoxelBlockGrid(device, backend, voxel_size,
+                                                  block_resolution);
+        core::cuda::Synchronize(device);
+        state.ResumeTiming();
+
+        IntegrateSequence(vbg, depths, colors);
+        core::cuda::Synchronize(device);
+    }
+    state.SetItemsProcessed(state.iterations() * depths.size());
+}
+
+void RayCast(benchmark::State& state,
+             const core::Device& device,
+             const core::HashBackendType& backend,
+             float voxel_size,
+             int block_resolution) {
+    const RGBDSequence& sequence = RGBDSequence::GetInstance();
+    std::vector<Image> depths, colors;
+    ToDevice(device, depths, colors);
+    VoxelBlockGrid vbg = CreateVoxelBlockGrid(device, backend, voxel_size,
+                                              block_resolution);
+    IntegrateSequence(vbg, depths, colors);
+
+    const size_t i = depths.size() - 1;
+    core::Tensor block_coords = vbg.GetUniqueBlockCoordinates(
+            depths[i], sequence.intrinsic_, sequence.extrinsics_[i],
+            depth_scale, depth_max, trunc_multiplier);
+
+    // Warm up.
+    vbg.RayCast(block_coords, sequence.intrinsic_, sequence.extrinsics_[i],
+                depths[i].GetCols(), depths[i].GetRows(),
+                {"vertex", "normal", "depth", "color"}, depth_scale, depth_min,
+                depth_max, 1.0f, trunc_multiplier);
+
+    for (auto _ : state) {
+        TensorMap result = vbg.RayCast(
+                block_coords, sequence.intrinsic_, sequence.extrinsics_[i],
+                depths[i].GetCols(), depths[i].GetRows(),
+                {"vertex", "normal", "depth", "color"}, depth_scale, depth_min,
+                depth_max, 1.0f, trunc_multiplier);
+        core::cuda::Synchronize(device);
+    }
+}
+
+void ExtractPointCloud(benchmark::State& state,
+                       const core::Device& device,
+                       const core::HashBackendType& backend,
+                       float voxel_size,
+                       int block_resolution) {
+    std::vector<Image> depths, colors;
+    ToDevice(device, depths, colors);
+    VoxelBlockGrid vbg = CreateVoxelBlockGrid(device, backend, voxel_size,
+                                              block_resolution);
+    IntegrateSequence(vbg, depths, colors);
+
+    // Warm up.
+    vbg.ExtractPointCloud(1.0f);
+
+    for (auto _ : state) {
+        PointCloud pcd = vbg.ExtractPointCloud(1.0f);
+        core::cuda::Synchronize(device);
+    }
+}
+
+void ExtractTriangleMesh(benchmark::State& state,
+                         const core::Device& device,
+                         const core::HashBackendType& backend,
+                         float voxel_size,
+                         int block_resolution) {
+    std::vector<Image> depths, colors;
+    ToDevice(device, depths, colors);
+    VoxelBlockGrid vbg = CreateVoxelBlockGrid(device, backend, voxel_size,
+                                              block_resolution);
+    IntegrateSequence(vbg, depths, colors);
+
+    // Warm up.
+    vbg.ExtractTriangleMesh(1.0f);
+
+    for (auto _ : state) {
+        TriangleMesh mesh = vbg.ExtractTriangleMesh(1.0f);
+        core::cuda::Synchronize(device);
+    }
+}
+
+#define ENUM_VBG_RESOLUTION(FN, DEVICE, BACKEND, VOXEL_NAME, VOXEL_SIZE) \
+    BENCHMARK_CAPTURE(FN, BACKEND##_##VOXEL_NAME##_8, DEVICE,            \
+                      core::HashBackendType::BACKEND, VOXEL_SIZE, 8)     \
+            ->Unit(benchmark::kMillisecond);                             \
+    BENCHMARK_CAPTURE(FN, BACKEND##_##VOXEL_NAME##_16, DEVICE,           \
+                      core::HashBackendType::BACKEND, VOXEL_SIZE, 16)    \
+            ->Unit(benchmark::kMillisecond);
+
+#define ENUM_VBG_VOXEL_SIZE(FN, DEVICE, BACKEND)              \
+    ENUM_VBG_RESOLUTION(FN, DEVICE, BACKEND, 512, 3.0f / 512) \
+    ENUM_VBG_RESOLUTION(FN, DEVICE, BACKEND, 256, 3.0f / 256)
+
+#ifdef BUILD_CUDA_MODULE
+#define ENUM_VBG_BACKEND(FN)                              \
+    ENUM_VBG_VOXEL_SIZE(FN, core::Device("CPU:0"), TBB)   \
+    ENUM_VBG_VOXEL_SIZE(FN, core::Device("CUDA:0"), Slab) \
+    ENUM_VBG_VOXEL_SIZE(FN, core::Device("CUDA:0"), StdGPU)
+#else
+#define ENUM_VBG_BACKEND(FN) ENUM_VBG_VOXEL_SIZE(FN, core::Device("CPU:0"), TBB)
+#endif
+
+ENUM_VBG_BACKEND(GetUniqueBlockCoordinates)
+ENUM_VBG_BACKEND(Integrate)
+ENUM_VBG_BACKEND(RayCast)
+ENUM_VBG_BACKEND(ExtractPointCloud)
+ENUM_VBG_BACKEND(ExtractTriangleMesh)
+
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
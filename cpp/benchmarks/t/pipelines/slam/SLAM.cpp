@@ -0,0 +1,316 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/t/pipelines/slam/Model.h"
+
+#include <benchmark/benchmark.h>
+#include <json/json.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <map>
+#include <sstream>
+
+#include "open3d/camera/PinholeCameraIntrinsic.h"
+#include "open3d/core/CUDAUtils.h"
+#include "open3d/core/MemoryManagerStatistic.h"
+#include "open3d/data/Dataset.h"
+#include "open3d/io/IJsonConvertibleIO.h"
+#include "open3d/t/io/ImageIO.h"
+#include "open3d/utility/FileSystem.h"
+#include "open3d/utility/IJsonConvertible.h"
+#include "open3d/utility/Timer.h"
+
+// End-to-end dense SLAM benchmark: track, integrate and raycast over an RGBD
+// sequence. Reports per-stage latency percentiles, throughput and peak device
+// memory as counters.
+//
+// Environment variables:
+// - OPEN3D_BENCHMARK_SLAM_DATASET: folder with color/ and depth/ sub-folders
+//   and an optional intrinsic.json. Defaults to SampleRedwoodRGBDImages.
+// - OPEN3D_BENCHMARK_SLAM_OUTPUT: JSON file the metrics are written to, keyed
+//   by benchmark name. Existing entries of other benchmarks are kept.
+// - OPEN3D_BENCHMARK_SLAM_BASELINE: JSON file written by a previous run. A
+//   latency or memory metric above, or a throughput below, the baseline by
+//   more than OPEN3D_BENCHMARK_SLAM_TOLERANCE (relative, default 0.1) fails
+//   the benchmark.
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace slam {
+
+static std::string GetEnv(const char* name) {
+    const char* value = std::getenv(name);
+    return value == nullptr ? "" : value;
+}
+
+struct SLAMSequence {
+    std::vector<t::geometry::Image> colors_;
+    std::vector<t::geometry::Image> depths_;
+    core::Tensor intrinsic_;
+};
+
+static SLAMSequence LoadSequence() {
+    std::vector<std::string> color_filenames, depth_filenames;
+    camera::PinholeCameraIntrinsic intrinsic = camera::PinholeCameraIntrinsic(
+            camera::PinholeCameraIntrinsicParameters::PrimeSenseDefault);
+
+    const std::string dataset_path = GetEnv("OPEN3D_BENCHMARK_SLAM_DATASET");
+    if (dataset_path.empty()) {
+        data::SampleRedwoodRGBDImages redwood_data;
+        color_filenames = redwood_data.GetColorPaths();
+        depth_filenames = redwood_data.GetDepthPaths();
+    } else {
+        utility::filesystem::ListFilesInDirectory(dataset_path + "/color",
+                                                  color_filenames);
+        utility::filesystem::ListFilesInDirectory(dataset_path + "/depth",
+                                                  depth_filenames);
+        if (color_filenames.empty() ||
+            color_filenames.size() != depth_filenames.size()) {
+            utility::LogError(
+                    "Expected the same non-zero number of color and depth "
+                    "images in {}, but got {} and {}.",
+                    dataset_path, color_filenames.size(),
+                    depth_filenames.size());
+        }
+        std::sort(color_filenames.begin(), color_filenames.end());
+        std::sort(depth_filenames.begin(), depth_filenames.end());
+
+        const std::string intrinsic_path = dataset_path + "/intrinsic.json";
+        if (utility::filesystem::FileExists(intrinsic_path) &&
+            !open3d::io::ReadIJsonConvertible(intrinsic_path, intrinsic)) {
+            utility::LogError("Unable to read intrinsics from {}.",
+                              intrinsic_path);
+        }
+    }
+
+    SLAMSequence sequence;
+    for (size_t i = 0; i < color_filenames.size(); ++i) {
+        sequence.colors_.push_back(
+                *t::io::CreateImageFromFile(color_filenames[i]));
+        sequence.depths_.push_back(
+                *t::io::CreateImageFromFile(depth_filenames[i]));
+    }
+    auto focal_length = intrinsic.GetFocalLength();
+    auto principal_point = intrinsic.GetPrincipalPoint();
+    sequence.intrinsic_ = core::Tensor::Init<double>(
+            {{focal_length.first, 0, principal_point.first},
+             {0, focal_length.second, principal_point.second},
+             {0, 0, 1}});
+    return sequence;
+}
+
+/// Nearest-rank percentile, \p p in [0, 100].
+static double Percentile(std::vector<double> samples, double p) {
+    if (samples.empty()) {
+        return 0.0;
+    }
+    size_t rank = static_cast<size_t>(
+            std::ceil(p / 100.0 * static_cast<double>(samples.size())));
+    rank = std::min(std::max(rank, size_t(1)), samples.size());
+    std::nth_element(samples.begin(), samples.begin() + (rank - 1),
+                     samples.end());
+    return samples[rank - 1];
+}
+
+static Json::Value ReadJson(const std::string& filename) {
+    std::ifstream file(filename);
+    if (!file.is_open()) {
+        return Json::Value(Json::objectValue);
+    }
+    std::stringstream buffer;
+    buffer << file.rdbuf();
+    return utility::StringToJson(buffer.str());
+}
+
+/// Returns a description of the metrics that regressed against the baseline
+/// entry \p name, empty if none did.
+static std::string CompareWithBaseline(
+        const std::string& name, const std::map<std::string, double>& metrics) {
+    const std::string baseline_path = GetEnv("OPEN3D_BENCHMARK_SLAM_BASELINE");
+    if (baseline_path.empty()) {
+        return "";
+    }
+    const Json::Value baseline = ReadJson(baseline_path)[name];
+    if (!baseline.isObject()) {
+        utility::LogWarning("No baseline for {} in {}.", name, baseline_path);
+        return "";
+    }
+    const std::string tolerance_str =
+            GetEnv("OPEN3D_BENCHMARK_SLAM_TOLERANCE");
+    const double tolerance =
+            tolerance_str.empty() ? 0.1 : std::stod(tolerance_str);
+
+    std::string regressions;
+    for (const auto& metric : metrics) {
+        if (!baseline[metric.first].isNumeric()) {
+            continue;
+        }
+        const double reference = baseline[metric.first].asDouble();
+        // Throughput must not drop, all other metrics must not grow.
+        const bool higher_is_better = metric.first == "fps";
+        const bool regressed =
+                higher_is_better ? metric.second < reference * (1 - tolerance)
+                                 : metric.second > reference * (1 + tolerance);
+        if (regressed) {
+            regressions += fmt::format("{} {:.3f} vs baseline {:.3f}; ",
+                                       metric.first, metric.second, reference);
+        }
+    }
+    return regressions;
+}
+
+static void WriteMetrics(const std::string& name,
+                         const std::map<std::string, double>& metrics) {
+    const std::string output_path = GetEnv("OPEN3D_BENCHMARK_SLAM_OUTPUT");
+    if (output_path.empty()) {
+        return;
+    }
+    Json::Value root = ReadJson(output_path);
+    for (const auto& metric : metrics) {
+        root[name][metric.first] = metric.second;
+    }
+    std::ofstream file(output_path);
+    file << utility::JsonToString(root);
+}
+
+static void DenseSLAM(benchmark::State& state, const core::Device& device) {
+    const float voxel_size = 3.0f / 512.0f;
+    const float trunc_voxel_multiplier = 8.0f;
+    const int block_resolution = 16;
+    const int block_count = 40000;
+    const float depth_scale = 1000.0f;
+    const float depth_max = 3.0f;
+    const float depth_diff = 0.07f;
+    const std::string name = "DenseSLAM/" + device.ToString();
+
+    const SLAMSequence sequence = LoadSequence();
+    const int64_t rows = sequence.depths_[0].GetRows();
+    const int64_t cols = sequence.depths_[0].GetCols();
+
+    core::MemoryManagerStatistic& statistic =
+            core::MemoryManagerStatistic::GetInstance();
+    statistic.ResetPeakBytes();
+
+    std::vector<double> track_times, integrate_times, raycast_times;
+    double total_time = 0.0;
+    int64_t num_frames = 0;
+
+    // Synchronizes so that asynchronous CUDA work is accounted to its stage.
+    double stage_start = 0.0;
+    auto stage_time = [&]() {
+        core::cuda::Synchronize(device);
+        const double now = utility::Timer::GetSystemTimeInMilliseconds();
+        const double elapsed = now - stage_start;
+        stage_start = now;
+        return elapsed;
+    };
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        core::Tensor T_frame_to_model =
+                core::Tensor::Eye(4, core::Float64, core::Device("CPU:0"));
+        Model model(voxel_size, block_resolution, block_count,
+                    T_frame_to_model, device);
+        Frame input_frame(rows, cols, sequence.intrinsic_, device);
+        Frame raycast_frame(rows, cols, sequence.intrinsic_, device);
+        state.ResumeTiming();
+
+        for (size_t i = 0; i < sequence.depths_.size(); ++i) {
+            input_frame.SetDataFromImage("depth", sequence.depths_[i]);
+            input_frame.SetDataFromImage("color", sequence.colors_[i]);
+            stage_time();
+
+            if (i > 0) {
+                auto result = model.TrackFrameToModel(
+                        input_frame, raycast_frame, depth_scale, depth_max,
+                        depth_diff);
+                if (result.fitness_ >= 0.1) {
+                    T_frame_to_model =
+                            T_frame_to_model.Matmul(result.transformation_);
+                }
+                track_times.push_back(stage_time());
+            }
+
+            model.UpdateFramePose(static_cast<int>(i), T_frame_to_model);
+            model.Integrate(input_frame, depth_scale, depth_max,
+                            trunc_voxel_multiplier);
+            integrate_times.push_back(stage_time());
+
+            model.SynthesizeModelFrame(raycast_frame, depth_scale, 0.1,
+                                       depth_max, trunc_voxel_multiplier,
+                                       false);
+            raycast_times.push_back(stage_time());
+        }
+        num_frames += static_cast<int64_t>(sequence.depths_.size());
+    }
+
+    std::map<std::string, double> metrics;
+    const std::vector<std::pair<std::string, const std::vector<double>*>>
+            stages{{"track", &track_times},
+                   {"integrate", &integrate_times},
+                   {"raycast", &raycast_times}};
+    for (const auto& stage : stages) {
+        for (const double p : {50.0, 95.0, 99.0}) {
+            metrics[fmt::format("{}_p{}_ms", stage.first, int(p))] =
+                    Percentile(*stage.second, p);
+        }
+        for (const double time : *stage.second) {
+            total_time += time;
+        }
+    }
+    metrics["fps"] = total_time > 0 ? 1000.0 * num_frames / total_time : 0.0;
+    metrics["peak_memory_mb"] =
+            statistic.GetPeakBytes(device) / (1024.0 * 1024.0);
+
+    for (const auto& metric : metrics) {
+        state.counters[metric.first] = metric.second;
+    }
+    WriteMetrics(name, metrics);
+    const std::string regressions = CompareWithBaseline(name, metrics);
+    if (!regressions.empty()) {
+        utility::LogWarning("{} regressed: {}", name, regressions);
+        const std::string message =
+                "Regressed against baseline: " + regressions;
+        state.SkipWithError(message.c_str());
+    }
+}
+
+BENCHMARK_CAPTURE(DenseSLAM, CPU, core::Device("CPU:0"))
+        ->Unit(benchmark::kMillisecond);
+#ifdef BUILD_CUDA_MODULE
+BENCHMARK_CAPTURE(DenseSLAM, CUDA, core::Device("CUDA:0"))
+        ->Unit(benchmark::kMillisecond);
+#endif
+
+}  // namespace slam
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
@@ -46,9 +46,9 @@ bool PinholeCameraTrajectory::ConvertToJsonValue(Json::Value &value) const {
     for (const auto &parameter : parameters_) {
         Json::Value parameter_value;
         parameter.ConvertToJsonValue(parameter_value);
-        parameters_array.append(parameter_value);
+        parameters_array.append(std::move(parameter_value));
     }
-    value["parameters"] = parameters_array;
+    value["parameters"].swap(parameters_array);
 
     return true;
 }
@@ -69,7 +69,7 @@ bool PinholeCameraTrajectory::ConvertFromJsonValue(const Json::Value &value) {
         return false;
     }
 
-    const Json::Value parameter_array = value["parameters"];
+    const Json::Value &parameter_array = value["parameters"];
 
     if (parameter_array.size() == 0) {
         utility::LogWarning(
@@ -39,17 +39,23 @@ namespace cuda {
 
 int DeviceCount() {
 #ifdef BUILD_CUDA_MODULE
-    try {
-        int num_devices;
-        OPEN3D_CUDA_CHECK(cudaGetDeviceCount(&num_devices));
-        return num_devices;
-
-    }
-    // This function is also used to detect CUDA support in our Python code.
-    // Thus, catch any errors if no GPU is available.
-    catch (const std::runtime_error&) {
-        return 0;
-    }
+    // The device count cannot change within a process, so query the runtime
+    // only once.
+    static const int num_devices = []() {
+        try {
+            int count;
+            OPEN3D_CUDA_CHECK(cudaGetDeviceCount(&count));
+            utility::LogDebug("CUDA runtime initialized, {} device(s) found.",
+                              count);
+            return count;
+        }
+        // This function is also used to detect CUDA support in our Python
+        // code. Thus, catch any errors if no GPU is available.
+        catch (const std::runtime_error&) {
+            return 0;
+        }
+    }();
+    return num_devices;
 #else
     return 0;
 #endif
@@ -59,7 +65,9 @@ bool IsAvailable() { return cuda::DeviceCount() > 0; }
 
 void ReleaseCache() {
 #ifdef BUILD_CUDA_MODULE
-#ifdef BUILD_CACHED_CUDA_MANAGER
+#if defined(BUILD_ASYNC_CUDA_MANAGER)
+    CUDAAsyncMemoryManager::ReleaseCache();
+#elif defined(BUILD_CACHED_CUDA_MANAGER)
     // Release cache from all devices. Since only memory from CUDAMemoryManager
     // is cached at the moment, this works as expected. In the future, the logic
     // could become more fine-grained.
@@ -92,6 +100,21 @@ void Synchronize(const Device& device) {
 #endif
 }
 
+void SynchronizeStream() {
+#ifdef BUILD_CUDA_MODULE
+    OPEN3D_CUDA_CHECK(cudaStreamSynchronize(GetStream()));
+#endif
+}
+
+void SynchronizeStream(const Device& device) {
+#ifdef BUILD_CUDA_MODULE
+    if (device.GetType() == Device::DeviceType::CUDA) {
+        CUDAScopedDevice scoped_device(device);
+        OPEN3D_CUDA_CHECK(cudaStreamSynchronize(GetStream()));
+    }
+#endif
+}
+
 void AssertCUDADeviceAvailable(int device_id) {
 #ifdef BUILD_CUDA_MODULE
     int num_devices = cuda::DeviceCount();
@@ -140,12 +163,12 @@ static void SetDevice(int device_id) {
     OPEN3D_CUDA_CHECK(cudaSetDevice(device_id));
 }
 
-class CUDAStream {
+class CUDACurrentStream {
 public:
-    static CUDAStream& GetInstance() {
+    static CUDACurrentStream& GetInstance() {
         // The global stream state is given per thread like CUDA's internal
         // device state.
-        static thread_local CUDAStream instance;
+        static thread_local CUDACurrentStream instance;
         return instance;
     }
 
@@ -155,20 +178,33 @@ public:
     static cudaStream_t Default() { return static_cast<cudaStream_t>(0); }
 
 private:
-    CUDAStream() = default;
-    CUDAStream(const CUDAStream&) = delete;
-    CUDAStream& operator=(const CUDAStream&) = delete;
+    CUDACurrentStream() = default;
+    CUDACurrentStream(const CUDACurrentStream&) = delete;
+    CUDACurrentStream& operator=(const CUDACurrentStream&) = delete;
 
     cudaStream_t stream_ = Default();
 };
 
-cudaStream_t GetStream() { return CUDAStream::GetInstance().Get(); }
+cudaStream_t GetStream() { return CUDACurrentStream::GetInstance().Get(); }
 
 static void SetStream(cudaStream_t stream) {
-    CUDAStream::GetInstance().Set(stream);
+    CUDACurrentStream::GetInstance().Set(stream);
 }
 
-cudaStream_t GetDefaultStream() { return CUDAStream::Default(); }
+cudaStream_t GetDefaultStream() { return CUDACurrentStream::Default(); }
+
+void StreamWaitStream(cudaStream_t stream, cudaStream_t other_stream) {
+    if (stream == other_stream) {
+        return;
+    }
+    cudaEvent_t event;
+    OPEN3D_CUDA_CHECK(
+            cudaEventCreateWithFlags(&event, cudaEventDisableTiming));
+    OPEN3D_CUDA_CHECK(cudaEventRecord(event, other_stream));
+    OPEN3D_CUDA_CHECK(cudaStreamWaitEvent(stream, event, 0));
+    // The pending wait keeps the event alive until it completes.
+    OPEN3D_CUDA_CHECK(cudaEventDestroy(event));
+}
 
 #endif
 
@@ -178,7 +214,13 @@ cudaStream_t GetDefaultStream() { return CUDAStream::Default(); }
 
 CUDAScopedDevice::CUDAScopedDevice(int device_id)
     : prev_device_id_(cuda::GetDevice()) {
-    cuda::SetDevice(device_id);
+    // Since CUDA 12, setting a device creates its context. Skip redundant
+    // switches so that a scope does not touch devices other than its own.
+    if (device_id != prev_device_id_) {
+        cuda::SetDevice(device_id);
+    } else {
+        cuda::AssertCUDADeviceAvailable(device_id);
+    }
 }
 
 CUDAScopedDevice::CUDAScopedDevice(const Device& device)
@@ -186,7 +228,30 @@ CUDAScopedDevice::CUDAScopedDevice(const Device& device)
     cuda::AssertCUDADeviceAvailable(device);
 }
 
-CUDAScopedDevice::~CUDAScopedDevice() { cuda::SetDevice(prev_device_id_); }
+CUDAScopedDevice::~CUDAScopedDevice() {
+    if (cuda::GetDevice() != prev_device_id_) {
+        cuda::SetDevice(prev_device_id_);
+    }
+}
+
+CUDAStream::CUDAStream(const Device& device) : device_(device) {
+    if (device.GetType() != Device::DeviceType::CUDA) {
+        utility::LogError("CUDAStream requires a CUDA device, but got {}.",
+                          device.ToString());
+    }
+    CUDAScopedDevice scoped_device(device);
+    OPEN3D_CUDA_CHECK(cudaStreamCreate(&stream_));
+}
+
+CUDAStream::~CUDAStream() {
+    CUDAScopedDevice scoped_device(device_);
+    OPEN3D_CUDA_CHECK(cudaStreamDestroy(stream_));
+}
+
+void CUDAStream::Synchronize() const {
+    CUDAScopedDevice scoped_device(device_);
+    OPEN3D_CUDA_CHECK(cudaStreamSynchronize(stream_));
+}
 
 constexpr CUDAScopedStream::CreateNewStreamTag
         CUDAScopedStream::CreateNewStream;
@@ -204,6 +269,9 @@ CUDAScopedStream::CUDAScopedStream(cudaStream_t stream)
     cuda::SetStream(stream);
 }
 
+CUDAScopedStream::CUDAScopedStream(const CUDAStream& stream)
+    : CUDAScopedStream(stream.Get()) {}
+
 CUDAScopedStream::~CUDAScopedStream() {
     if (owns_new_stream_) {
         OPEN3D_CUDA_CHECK(cudaStreamDestroy(new_stream_));
@@ -219,71 +287,91 @@ CUDAState& CUDAState::GetInstance() {
 bool CUDAState::IsP2PEnabled(int src_id, int tar_id) const {
     cuda::AssertCUDADeviceAvailable(src_id);
     cuda::AssertCUDADeviceAvailable(tar_id);
-    return p2p_enabled_[src_id][tar_id];
+    std::lock_guard<std::mutex> lock(p2p_mutex_);
+    if (p2p_enabled_[src_id][tar_id] < 0) {
+        p2p_enabled_[src_id][tar_id] = EnableP2P(src_id, tar_id) ? 1 : 0;
+    }
+    return p2p_enabled_[src_id][tar_id] == 1;
 }
 
 bool CUDAState::IsP2PEnabled(const Device& src, const Device& tar) const {
     cuda::AssertCUDADeviceAvailable(src);
     cuda::AssertCUDADeviceAvailable(tar);
-    return p2p_enabled_[src.GetID()][tar.GetID()];
+    return IsP2PEnabled(src.GetID(), tar.GetID());
 }
 
 void CUDAState::ForceDisableP2PForTesting() {
+    std::lock_guard<std::mutex> lock(p2p_mutex_);
     for (int src_id = 0; src_id < cuda::DeviceCount(); ++src_id) {
         for (int tar_id = 0; tar_id < cuda::DeviceCount(); ++tar_id) {
-            if (src_id != tar_id && p2p_enabled_[src_id][tar_id]) {
-                p2p_enabled_[src_id][tar_id] = false;
+            if (src_id != tar_id) {
+                p2p_enabled_[src_id][tar_id] = 0;
             }
         }
     }
 }
 
 CUDAState::CUDAState() {
-    // Check and enable all possible peer to peer access.
-    p2p_enabled_ = std::vector<std::vector<bool>>(
-            cuda::DeviceCount(), std::vector<bool>(cuda::DeviceCount(), false));
+    // Peer access is checked and enabled on first use, see EnableP2P().
+    p2p_enabled_ = std::vector<std::vector<int>>(
+            cuda::DeviceCount(), std::vector<int>(cuda::DeviceCount(), -1));
+    for (int device_id = 0; device_id < cuda::DeviceCount(); ++device_id) {
+        p2p_enabled_[device_id][device_id] = 1;
+    }
+}
 
-    for (int src_id = 0; src_id < cuda::DeviceCount(); ++src_id) {
-        for (int tar_id = 0; tar_id < cuda::DeviceCount(); ++tar_id) {
-            if (src_id == tar_id) {
-                p2p_enabled_[src_id][tar_id] = true;
-            } else {
-                CUDAScopedDevice scoped_device(src_id);
-
-                // Check access.
-                int can_access = 0;
-                OPEN3D_CUDA_CHECK(
-                        cudaDeviceCanAccessPeer(&can_access, src_id, tar_id));
-                // Enable access.
-                if (can_access) {
-                    p2p_enabled_[src_id][tar_id] = true;
-                    cudaError_t err = cudaDeviceEnablePeerAccess(tar_id, 0);
-                    if (err == cudaErrorPeerAccessAlreadyEnabled) {
-                        // Ignore error since P2P is already enabled.
-                        cudaGetLastError();
-                    } else {
-                        OPEN3D_CUDA_CHECK(err);
-                    }
-                } else {
-                    p2p_enabled_[src_id][tar_id] = false;
-                }
-            }
-        }
+bool CUDAState::EnableP2P(int src_id, int tar_id) const {
+    CUDAScopedDevice scoped_device(src_id);
+
+    // Check access.
+    int can_access = 0;
+    OPEN3D_CUDA_CHECK(cudaDeviceCanAccessPeer(&can_access, src_id, tar_id));
+    if (!can_access) {
+        return false;
+    }
+
+    // Enable access.
+    cudaError_t err = cudaDeviceEnablePeerAccess(tar_id, 0);
+    if (err == cudaErrorPeerAccessAlreadyEnabled) {
+        // Ignore error since P2P is already enabled.
+        cudaGetLastError();
+    } else {
+        OPEN3D_CUDA_CHECK(err);
     }
+    utility::LogDebug("CUDA peer access enabled from CUDA:{} to CUDA:{}.",
+                      src_id, tar_id);
+    return true;
+}
+
+/// Device attributes queried by the kernels. They are fixed per device, so
+/// they are queried once and cached.
+struct CUDADeviceAttributes {
+    int warp_size_ = 0;
+    int texture_alignment_ = 0;
+};
+
+static const CUDADeviceAttributes& GetCUDADeviceAttributes(int device_id) {
+    static const std::vector<CUDADeviceAttributes> attributes = []() {
+        std::vector<CUDADeviceAttributes> attributes(cuda::DeviceCount());
+        for (int i = 0; i < cuda::DeviceCount(); ++i) {
+            OPEN3D_CUDA_CHECK(cudaDeviceGetAttribute(
+                    &attributes[i].warp_size_, cudaDevAttrWarpSize, i));
+            OPEN3D_CUDA_CHECK(cudaDeviceGetAttribute(
+                    &attributes[i].texture_alignment_,
+                    cudaDevAttrTextureAlignment, i));
+        }
+        return attributes;
+    }();
+    cuda::AssertCUDADeviceAvailable(device_id);
+    return attributes[device_id];
 }
 
 int GetCUDACurrentDeviceTextureAlignment() {
-    int value;
-    OPEN3D_CUDA_CHECK(cudaDeviceGetAttribute(
-            &value, cudaDevAttrTextureAlignment, cuda::GetDevice()));
-    return value;
+    return GetCUDADeviceAttributes(cuda::GetDevice()).texture_alignment_;
 }
 
 int GetCUDACurrentWarpSize() {
-    int value;
-    OPEN3D_CUDA_CHECK(cudaDeviceGetAttribute(&value, cudaDevAttrWarpSize,
-                                             cuda::GetDevice()));
-    return value;
+    return GetCUDADeviceAttributes(cuda::GetDevice()).warp_size_;
 }
 
 size_t GetCUDACurrentTotalMemSize() {
@@ -41,6 +41,7 @@
 #include <cuda_runtime.h>
 
 #include <memory>
+#include <mutex>
 #include <vector>
 
 #include "open3d/utility/Optional.h"
@@ -113,6 +114,47 @@ private:
     int prev_device_id_;
 };
 
+/// \class CUDAStream
+///
+/// Owning wrapper around a cudaStream_t created on a specific CUDA device. The
+/// stream is destroyed when the object goes out of scope. Use it together with
+/// CUDAScopedStream to run Open3D operations (ParallelFor kernels, memory
+/// copies, HashMap and VoxelBlockGrid operations, ...) on a non-default stream
+/// so that independent work can overlap.
+///
+/// Example:
+/// ```cpp
+/// CUDAStream stream(Device("CUDA:0"));
+/// {
+///     CUDAScopedStream scoped_stream(stream);
+///     // Operations issued here are enqueued on `stream`.
+/// }
+/// stream.Synchronize();
+/// ```
+class CUDAStream {
+public:
+    /// Creates a new stream on \p device, which must be a CUDA device.
+    explicit CUDAStream(const Device& device);
+
+    ~CUDAStream();
+
+    CUDAStream(const CUDAStream&) = delete;
+    CUDAStream& operator=(const CUDAStream&) = delete;
+
+    /// Returns the underlying CUDA stream handle.
+    cudaStream_t Get() const { return stream_; }
+
+    /// Returns the device the stream was created on.
+    Device GetDevice() const { return device_; }
+
+    /// Blocks until all work enqueued on the stream has completed.
+    void Synchronize() const;
+
+private:
+    Device device_;
+    cudaStream_t stream_;
+};
+
 /// \class CUDAScopedStream
 ///
 /// Switch CUDA stream in the current scope. The stream will be reset
@@ -168,6 +210,10 @@ public:
 
     explicit CUDAScopedStream(cudaStream_t stream);
 
+    /// Makes \p stream current. The device of \p stream is not switched, so
+    /// combine it with CUDAScopedDevice when targeting a different device.
+    explicit CUDAScopedStream(const CUDAStream& stream);
+
     ~CUDAScopedStream();
 
     CUDAScopedStream(const CUDAScopedStream&) = delete;
@@ -182,7 +228,9 @@ private:
 /// CUDAState is a lazy-evaluated singleton class that initializes and stores
 /// the states of CUDA devices.
 ///
-/// Currently it stores the peer-to-peer availability.
+/// Currently it stores the peer-to-peer availability. Peer access between two
+/// devices is only checked and enabled the first time it is queried, so that
+/// devices which are never used do not get a CUDA context.
 ///
 /// In the future, it can also be used to store
 /// - Device allocators
@@ -214,7 +262,13 @@ public:
 private:
     CUDAState();
 
-    std::vector<std::vector<bool>> p2p_enabled_;
+    /// Checks and enables peer access from \p src_id to \p tar_id.
+    bool EnableP2P(int src_id, int tar_id) const;
+
+    /// Peer-to-peer state per device pair: -1 if not queried yet, 0 if
+    /// disabled and 1 if enabled.
+    mutable std::vector<std::vector<int>> p2p_enabled_;
+    mutable std::mutex p2p_mutex_;
 };
 
 /// Returns the size of a warp for the current device.
@@ -231,6 +285,11 @@ namespace cuda {
 
 /// Returns the number of available CUDA devices. Returns 0 if Open3D is not
 /// compiled with CUDA support.
+///
+/// The count is queried once per process and cached. This first query loads
+/// the CUDA driver, while CUDA contexts are only created when a device is
+/// used. CPU-only code does not call into CUDA. Set the log verbosity to Debug
+/// to trace the CUDA initialization steps of a process.
 int DeviceCount();
 
 /// Returns true if Open3D is compiled with CUDA support and at least one
@@ -250,6 +309,18 @@ void Synchronize();
 /// \param device The device to be synchronized.
 void Synchronize(const Device& device);
 
+/// Calls cudaStreamSynchronize() for the current stream of the calling thread
+/// (see CUDAScopedStream). Unlike Synchronize(), work enqueued on other streams
+/// is not waited for. If Open3D is not compiled with CUDA this function has no
+/// effect.
+void SynchronizeStream();
+
+/// Calls cudaStreamSynchronize() for the current stream of the calling thread
+/// on the specified device. If Open3D is not compiled with CUDA or if \p device
+/// is not a CUDA device, this function has no effect.
+/// \param device The device the current stream is associated with.
+void SynchronizeStream(const Device& device);
+
 /// Checks if the CUDA device-ID is available and throws error if not. The CUDA
 /// device-ID must be between 0 to device count - 1.
 /// \param device_id The cuda device id to be checked.
@@ -266,6 +337,11 @@ int GetDevice();
 cudaStream_t GetStream();
 cudaStream_t GetDefaultStream();
 
+/// Makes \p stream wait for all work enqueued on \p other_stream so far by
+/// recording an event on \p other_stream. The calling host thread is not
+/// blocked. Has no effect if both streams are the same.
+void StreamWaitStream(cudaStream_t stream, cudaStream_t other_stream);
+
 #endif
 
 }  // namespace cuda
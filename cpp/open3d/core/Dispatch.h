@@ -29,6 +29,64 @@
 #include "open3d/core/Dtype.h"
 #include "open3d/utility/Logging.h"
 
+/// Optional dtypes can be compiled out of the dispatch macros below with the
+/// CMake option BUILD_DISABLED_DTYPES, which defines
+/// OPEN3D_DISABLE_DTYPE_<DTYPE> for Open3D targets. Kernels are then not
+/// instantiated for these dtypes, which shrinks the library and its load time.
+/// Calling a kernel with a disabled dtype raises "Unsupported data type.".
+/// Float32, Float64, Int32, Int64, UInt8 and Bool are used internally and are
+/// always dispatched.
+
+#ifdef OPEN3D_DISABLE_DTYPE_INT8
+#define OPEN3D_DISPATCH_CASE_INT8(DTYPE, ...)
+#else
+#define OPEN3D_DISPATCH_CASE_INT8(DTYPE, ...) \
+    else if (DTYPE == open3d::core::Int8) {   \
+        using scalar_t = int8_t;              \
+        return __VA_ARGS__();                 \
+    }
+#endif
+
+#ifdef OPEN3D_DISABLE_DTYPE_INT16
+#define OPEN3D_DISPATCH_CASE_INT16(DTYPE, ...)
+#else
+#define OPEN3D_DISPATCH_CASE_INT16(DTYPE, ...) \
+    else if (DTYPE == open3d::core::Int16) {   \
+        using scalar_t = int16_t;              \
+        return __VA_ARGS__();                  \
+    }
+#endif
+
+#ifdef OPEN3D_DISABLE_DTYPE_UINT16
+#define OPEN3D_DISPATCH_CASE_UINT16(DTYPE, ...)
+#else
+#define OPEN3D_DISPATCH_CASE_UINT16(DTYPE, ...) \
+    else if (DTYPE == open3d::core::UInt16) {   \
+        using scalar_t = uint16_t;              \
+        return __VA_ARGS__();                   \
+    }
+#endif
+
+#ifdef OPEN3D_DISABLE_DTYPE_UINT32
+#define OPEN3D_DISPATCH_CASE_UINT32(DTYPE, ...)
+#else
+#define OPEN3D_DISPATCH_CASE_UINT32(DTYPE, ...) \
+    else if (DTYPE == open3d::core::UInt32) {   \
+        using scalar_t = uint32_t;              \
+        return __VA_ARGS__();                   \
+    }
+#endif
+
+#ifdef OPEN3D_DISABLE_DTYPE_UINT64
+#define OPEN3D_DISPATCH_CASE_UINT64(DTYPE, ...)
+#else
+#define OPEN3D_DISPATCH_CASE_UINT64(DTYPE, ...) \
+    else if (DTYPE == open3d::core::UInt64) {   \
+        using scalar_t = uint64_t;              \
+        return __VA_ARGS__();                   \
+    }
+#endif
+
 /// Call a numerical templated function based on Dtype. Wrap the function to
 /// a lambda function to use DISPATCH_DTYPE_TO_TEMPLATE.
 ///
@@ -54,13 +112,10 @@
         } else if (DTYPE == open3d::core::Float64) {     \
             using scalar_t = double;                     \
             return __VA_ARGS__();                        \
-        } else if (DTYPE == open3d::core::Int8) {        \
-            using scalar_t = int8_t;                     \
-            return __VA_ARGS__();                        \
-        } else if (DTYPE == open3d::core::Int16) {       \
-            using scalar_t = int16_t;                    \
-            return __VA_ARGS__();                        \
-        } else if (DTYPE == open3d::core::Int32) {       \
+        }                                                \
+        OPEN3D_DISPATCH_CASE_INT8(DTYPE, __VA_ARGS__)    \
+        OPEN3D_DISPATCH_CASE_INT16(DTYPE, __VA_ARGS__)   \
+        else if (DTYPE == open3d::core::Int32) {         \
             using scalar_t = int32_t;                    \
             return __VA_ARGS__();                        \
         } else if (DTYPE == open3d::core::Int64) {       \
@@ -69,16 +124,11 @@
         } else if (DTYPE == open3d::core::UInt8) {       \
             using scalar_t = uint8_t;                    \
             return __VA_ARGS__();                        \
-        } else if (DTYPE == open3d::core::UInt16) {      \
-            using scalar_t = uint16_t;                   \
-            return __VA_ARGS__();                        \
-        } else if (DTYPE == open3d::core::UInt32) {      \
-            using scalar_t = uint32_t;                   \
-            return __VA_ARGS__();                        \
-        } else if (DTYPE == open3d::core::UInt64) {      \
-            using scalar_t = uint64_t;                   \
-            return __VA_ARGS__();                        \
-        } else {                                         \
+        }                                                \
+        OPEN3D_DISPATCH_CASE_UINT16(DTYPE, __VA_ARGS__)  \
+        OPEN3D_DISPATCH_CASE_UINT32(DTYPE, __VA_ARGS__)  \
+        OPEN3D_DISPATCH_CASE_UINT64(DTYPE, __VA_ARGS__)  \
+        else {                                           \
             utility::LogError("Unsupported data type."); \
         }                                                \
     }()
@@ -93,6 +143,33 @@
         }                                                   \
     }()
 
+/// Also dispatches Float16 and BFloat16 to core::float16_t and
+/// core::bfloat16_t. Only use it for kernels that move or convert values, e.g.
+/// copies and indexing. Arithmetic kernels compute half precision tensors in
+/// Float32 instead.
+#define DISPATCH_DTYPE_TO_TEMPLATE_WITH_HALF(DTYPE, ...)    \
+    [&] {                                                   \
+        if (DTYPE == open3d::core::Float16) {               \
+            using scalar_t = open3d::core::float16_t;       \
+            return __VA_ARGS__();                           \
+        } else if (DTYPE == open3d::core::BFloat16) {       \
+            using scalar_t = open3d::core::bfloat16_t;      \
+            return __VA_ARGS__();                           \
+        } else {                                            \
+            DISPATCH_DTYPE_TO_TEMPLATE(DTYPE, __VA_ARGS__); \
+        }                                                   \
+    }()
+
+#define DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_HALF(DTYPE, ...)         \
+    [&] {                                                             \
+        if (DTYPE == open3d::core::Bool) {                            \
+            using scalar_t = bool;                                    \
+            return __VA_ARGS__();                                     \
+        } else {                                                      \
+            DISPATCH_DTYPE_TO_TEMPLATE_WITH_HALF(DTYPE, __VA_ARGS__); \
+        }                                                             \
+    }()
+
 #define DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(DTYPE, ...)     \
     [&] {                                                \
         if (DTYPE == open3d::core::Float32) {            \
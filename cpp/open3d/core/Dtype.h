@@ -31,6 +31,7 @@
 
 #include "open3d/Macro.h"
 #include "open3d/core/Dispatch.h"
+#include "open3d/core/Half.h"
 #include "open3d/utility/Logging.h"
 
 namespace open3d {
@@ -41,6 +42,8 @@ public:
     static const Dtype Undefined;
     static const Dtype Float32;
     static const Dtype Float64;
+    static const Dtype Float16;
+    static const Dtype BFloat16;
     static const Dtype Int8;
     static const Dtype Int16;
     static const Dtype Int32;
@@ -80,6 +83,11 @@ public:
 
     bool IsObject() const { return dtype_code_ == DtypeCode::Object; }
 
+    /// True for the 16-bit floating point dtypes Float16 and BFloat16.
+    bool IsHalf() const {
+        return dtype_code_ == DtypeCode::Float && byte_size_ == 2;
+    }
+
     std::string ToString() const { return name_; }
 
     bool operator==(const Dtype &other) const;
@@ -96,6 +104,8 @@ private:
 OPEN3D_API extern const Dtype Undefined;
 OPEN3D_API extern const Dtype Float32;
 OPEN3D_API extern const Dtype Float64;
+OPEN3D_API extern const Dtype Float16;
+OPEN3D_API extern const Dtype BFloat16;
 OPEN3D_API extern const Dtype Int8;
 OPEN3D_API extern const Dtype Int16;
 OPEN3D_API extern const Dtype Int32;
@@ -116,6 +126,16 @@ inline const Dtype Dtype::FromType<double>() {
     return Dtype::Float64;
 }
 
+template <>
+inline const Dtype Dtype::FromType<float16_t>() {
+    return Dtype::Float16;
+}
+
+template <>
+inline const Dtype Dtype::FromType<bfloat16_t>() {
+    return Dtype::BFloat16;
+}
+
 template <>
 inline const Dtype Dtype::FromType<int8_t>() {
     return Dtype::Int8;
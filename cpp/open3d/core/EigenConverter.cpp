@@ -28,29 +28,13 @@
 
 #include <type_traits>
 
-#include "open3d/core/Indexer.h"
-#include "open3d/core/ParallelFor.h"
+#include "open3d/core/Blob.h"
 #include "open3d/core/TensorCheck.h"
 
 namespace open3d {
 namespace core {
 namespace eigen_converter {
 
-/// Fills tensor[:][i] with func(i).
-///
-/// \param indexer The input tensor and output tensor to the indexer are the
-/// same (as a hack), since the tensor are filled in-place.
-/// \param func A function that takes pointer location and
-/// workload index i, computes the value to fill, and fills the value at the
-/// pointer location.
-template <typename func_t>
-static void LaunchIndexFillKernel(const Indexer &indexer, const func_t &func) {
-    ParallelFor(Device("CPU:0"), indexer.NumWorkloads(),
-                [&indexer, &func](int64_t i) {
-                    func(indexer.GetInputPtr(0, i), i);
-                });
-}
-
 template <typename T>
 static Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>
 TensorToEigenMatrix(const core::Tensor &tensor) {
@@ -139,26 +123,38 @@ static core::Tensor EigenVectorNxVectorToTensor(
             (std::is_same<T, double>::value || std::is_same<T, int>::value) &&
                     N > 0,
             "Only supports double and int (VectorNd and VectorNi) with N>0.");
-    // Init CPU Tensor.
+    static_assert(sizeof(Eigen::Matrix<T, N, 1>) == sizeof(T) * N,
+                  "Eigen::Matrix<T, N, 1> must be tightly packed.");
+
+    // Wrap the std::vector storage without copying. The dtype conversion (if
+    // any) is then a single parallel kernel and the device transfer a single
+    // memcpy, instead of an element-wise fill.
     int64_t num_values = static_cast<int64_t>(values.size());
-    core::Tensor tensor_cpu =
-            core::Tensor::Empty({num_values, N}, dtype, Device("CPU:0"));
-
-    // Fill Tensor. This takes care of dtype conversion at the same time.
-    core::Indexer indexer({tensor_cpu}, tensor_cpu,
-                          core::DtypePolicy::ALL_SAME);
-    DISPATCH_DTYPE_TO_TEMPLATE(dtype, [&]() {
-        LaunchIndexFillKernel(indexer, [&](void *ptr, int64_t workload_idx) {
-            // Fills the flattened tensor tensor_cpu[:] with dtype
-            // casting. tensor_cpu[:][i] corresponds to the (i/N)-th
-            // element's (i%N)-th coordinate value.
-            *static_cast<scalar_t *>(ptr) = static_cast<scalar_t>(
-                    values[workload_idx / N](workload_idx % N));
-        });
-    });
-
-    // Copy Tensor to device if necessary.
-    return tensor_cpu.To(device);
+    const core::Tensor values_view(
+            const_cast<T *>(values.empty() ? nullptr : values.data()->data()),
+            core::Dtype::FromType<T>(), {num_values, N});
+    if (device.GetType() == core::Device::DeviceType::CPU) {
+        return values_view.To(dtype, /*copy=*/true);
+    }
+    // Convert on the host first, which is never more data to transfer.
+    return values_view.To(dtype).To(device);
+}
+
+template <typename T, int N>
+static core::Tensor EigenVectorNxVectorToTensor(
+        std::vector<Eigen::Matrix<T, N, 1>> &&values) {
+    static_assert(sizeof(Eigen::Matrix<T, N, 1>) == sizeof(T) * N,
+                  "Eigen::Matrix<T, N, 1> must be tightly packed.");
+    // The Blob deleter owns the moved vector, so the tensor keeps the storage
+    // alive for as long as it (or any view of it) exists.
+    auto holder = std::make_shared<std::vector<Eigen::Matrix<T, N, 1>>>(
+            std::move(values));
+    const int64_t num_values = static_cast<int64_t>(holder->size());
+    void *data_ptr = holder->empty() ? nullptr : holder->data()->data();
+    auto blob = std::make_shared<core::Blob>(
+            core::Device("CPU:0"), data_ptr, [holder](void *) {});
+    return core::Tensor({num_values, N}, {N, 1}, data_ptr,
+                        core::Dtype::FromType<T>(), blob);
 }
 
 std::vector<Eigen::Vector2d> TensorToEigenVector2dVector(
@@ -208,6 +204,21 @@ core::Tensor EigenVector2iVectorToTensor(
     return EigenVectorNxVectorToTensor(values, dtype, device);
 }
 
+core::Tensor EigenVector3dVectorToTensor(
+        std::vector<Eigen::Vector3d> &&values) {
+    return EigenVectorNxVectorToTensor(std::move(values));
+}
+
+core::Tensor EigenVector2dVectorToTensor(
+        std::vector<Eigen::Vector2d> &&values) {
+    return EigenVectorNxVectorToTensor(std::move(values));
+}
+
+core::Tensor EigenVector3iVectorToTensor(
+        std::vector<Eigen::Vector3i> &&values) {
+    return EigenVectorNxVectorToTensor(std::move(values));
+}
+
 }  // namespace eigen_converter
 }  // namespace core
 }  // namespace open3d
@@ -168,6 +168,30 @@ core::Tensor EigenVector3iVectorToTensor(
         core::Dtype dtype,
         const core::Device &device);
 
+/// \brief Converts a vector of Eigen::Vector3d to a (N, 3) Float64 CPU tensor
+/// without copying. The vector is moved into the tensor, which owns the storage
+/// through its Blob.
+///
+/// \param values A vector of Eigen::Vector3d values, moved from.
+/// \return A Float64 tensor of shape (N, 3) on CPU:0.
+core::Tensor EigenVector3dVectorToTensor(std::vector<Eigen::Vector3d> &&values);
+
+/// \brief Converts a vector of Eigen::Vector2d to a (N, 2) Float64 CPU tensor
+/// without copying. The vector is moved into the tensor, which owns the storage
+/// through its Blob.
+///
+/// \param values A vector of Eigen::Vector2d values, moved from.
+/// \return A Float64 tensor of shape (N, 2) on CPU:0.
+core::Tensor EigenVector2dVectorToTensor(std::vector<Eigen::Vector2d> &&values);
+
+/// \brief Converts a vector of Eigen::Vector3i to a (N, 3) Int32 CPU tensor
+/// without copying. The vector is moved into the tensor, which owns the storage
+/// through its Blob.
+///
+/// \param values A vector of Eigen::Vector3i values, moved from.
+/// \return An Int32 tensor of shape (N, 3) on CPU:0.
+core::Tensor EigenVector3iVectorToTensor(std::vector<Eigen::Vector3i> &&values);
+
 }  // namespace eigen_converter
 }  // namespace core
 }  // namespace open3d
@@ -0,0 +1,112 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/core/Future.h"
+
+#include "open3d/core/CUDAUtils.h"
+
+namespace open3d {
+namespace core {
+
+struct StreamEvent::Impl {
+#ifdef BUILD_CUDA_MODULE
+    explicit Impl(const Device& device) : device_(device) {
+        CUDAScopedDevice scoped_device(device);
+        OPEN3D_CUDA_CHECK(
+                cudaEventCreateWithFlags(&event_, cudaEventDisableTiming));
+        OPEN3D_CUDA_CHECK(cudaEventRecord(event_, cuda::GetStream()));
+    }
+
+    ~Impl() {
+        CUDAScopedDevice scoped_device(device_);
+        cudaEventDestroy(event_);
+    }
+
+    Impl(const Impl&) = delete;
+    Impl& operator=(const Impl&) = delete;
+
+    Device device_;
+    cudaEvent_t event_ = nullptr;
+#endif
+};
+
+StreamEvent StreamEvent::Record(const Device& device) {
+    StreamEvent event;
+#ifdef BUILD_CUDA_MODULE
+    if (device.GetType() == Device::DeviceType::CUDA) {
+        event.impl_ = std::make_shared<Impl>(device);
+    }
+#else
+    (void)device;
+#endif
+    return event;
+}
+
+bool StreamEvent::IsComplete() const {
+#ifdef BUILD_CUDA_MODULE
+    if (impl_ != nullptr) {
+        const cudaError_t err = cudaEventQuery(impl_->event_);
+        if (err == cudaErrorNotReady) {
+            // Clear the sticky last error set by the query.
+            cudaGetLastError();
+            return false;
+        }
+        OPEN3D_CUDA_CHECK(err);
+    }
+#endif
+    return true;
+}
+
+void StreamEvent::Synchronize() const {
+#ifdef BUILD_CUDA_MODULE
+    if (impl_ != nullptr) {
+        OPEN3D_CUDA_CHECK(cudaEventSynchronize(impl_->event_));
+    }
+#endif
+}
+
+void StreamEvent::StreamWait() const {
+#ifdef BUILD_CUDA_MODULE
+    if (impl_ != nullptr) {
+        // The current stream may belong to another device than the event.
+        OPEN3D_CUDA_CHECK(
+                cudaStreamWaitEvent(cuda::GetStream(), impl_->event_, 0));
+    }
+#endif
+}
+
+Device StreamEvent::GetDevice() const {
+#ifdef BUILD_CUDA_MODULE
+    if (impl_ != nullptr) {
+        return impl_->device_;
+    }
+#endif
+    return Device("CPU:0");
+}
+
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,144 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#pragma once
+
+#include <memory>
+#include <utility>
+
+#include "open3d/core/Device.h"
+#include "open3d/core/Tensor.h"
+
+namespace open3d {
+namespace core {
+
+/// \class StreamEvent
+///
+/// Marks the completion of the work enqueued so far on the current CUDA stream
+/// of a device, backed by a cudaEvent_t. Copies of a StreamEvent share the
+/// event.
+///
+/// An event recorded for a non-CUDA device, a default-constructed event and
+/// any event in a build without CUDA are complete from the start.
+class StreamEvent {
+public:
+    /// Constructs a complete event.
+    StreamEvent() {}
+
+    /// Records an event on the current stream of \p device, see
+    /// cuda::GetStream().
+    static StreamEvent Record(const Device& device);
+
+    /// Returns true if all work enqueued before the event has completed. Does
+    /// not block.
+    bool IsComplete() const;
+
+    /// Blocks the calling host thread until the event is complete.
+    void Synchronize() const;
+
+    /// Makes the current stream wait for the event without blocking the
+    /// calling host thread. Work enqueued on the current stream afterwards
+    /// runs after the event.
+    void StreamWait() const;
+
+    /// Returns the device the event was recorded for, or CPU:0 for a complete
+    /// event.
+    Device GetDevice() const;
+
+private:
+    struct Impl;
+    std::shared_ptr<Impl> impl_;
+};
+
+/// \class Future
+///
+/// A value, e.g. a Tensor, that is produced by work enqueued on a CUDA stream,
+/// together with the StreamEvent that marks its completion.
+///
+/// Example:
+/// ```cpp
+/// // Prefetch the next frame while processing the current one.
+/// TensorFuture next = frame_pinned.ToAsync(Device("CUDA:0"));
+/// Process(current);
+/// current = next.Wait();
+/// ```
+template <typename T>
+class Future {
+public:
+    /// Constructs a future with the \p value, which is complete once \p event
+    /// is complete.
+    Future(T value = T(), StreamEvent event = StreamEvent())
+        : value_(std::move(value)), event_(std::move(event)) {}
+
+    /// Returns true if the value is ready. Does not block.
+    bool IsReady() const { return event_.IsComplete(); }
+
+    /// Blocks until the value is ready and returns it. The value can then be
+    /// used on the host and on any stream.
+    const T& Wait() const {
+        event_.Synchronize();
+        return value_;
+    }
+
+    /// Makes the current stream wait for the value without blocking the
+    /// calling host thread and returns it. The value must then only be used by
+    /// work enqueued on the current stream.
+    const T& WaitOnStream() const {
+        event_.StreamWait();
+        return value_;
+    }
+
+    /// Chains \p fn after this future: the current stream waits for the value,
+    /// then \p fn is called with it on the calling host thread to enqueue more
+    /// work on the current stream. Returns the future of the result of \p fn,
+    /// which is complete once the work enqueued by \p fn on the device of this
+    /// future is complete.
+    template <typename Func>
+    auto Then(Func&& fn) const
+            -> Future<decltype(fn(std::declval<const T&>()))> {
+        using Result = decltype(fn(std::declval<const T&>()));
+        event_.StreamWait();
+        Result result = fn(value_);
+        return Future<Result>(std::move(result),
+                              StreamEvent::Record(event_.GetDevice()));
+    }
+
+    /// Returns the value without waiting.
+    const T& GetUnsafe() const { return value_; }
+
+    /// Returns the event that marks the completion of the value.
+    const StreamEvent& GetEvent() const { return event_; }
+
+private:
+    T value_;
+    StreamEvent event_;
+};
+
+using TensorFuture = Future<Tensor>;
+
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,183 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+/// \file Half.h
+/// \brief 16-bit floating point storage types for Float16 and BFloat16.
+///
+/// float16_t (IEEE 754 binary16) and bfloat16_t (the upper half of a binary32)
+/// only store values. They convert implicitly to and from float, so kernels
+/// compute in single precision and round to nearest even on store. Both types
+/// may be used in host and CUDA device code.
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+
+#ifdef __CUDACC__
+#define OPEN3D_HALF_FN inline __host__ __device__
+#else
+#define OPEN3D_HALF_FN inline
+#endif
+
+namespace open3d {
+namespace core {
+
+namespace half_util {
+
+OPEN3D_HALF_FN uint32_t FloatToBits(float value) {
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+OPEN3D_HALF_FN float BitsToFloat(uint32_t bits) {
+    float value;
+    memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+/// Round a float to the nearest binary16, ties to even.
+OPEN3D_HALF_FN uint16_t FloatToHalfBits(float value) {
+    const uint32_t bits = FloatToBits(value);
+    const uint32_t sign = (bits >> 16) & 0x8000;
+    const uint32_t abs_bits = bits & 0x7fffffff;
+    if (abs_bits > 0x7f800000) {
+        // NaN, keep it quiet.
+        return static_cast<uint16_t>(sign | 0x7e00);
+    }
+    if (abs_bits >= 0x47800000) {
+        // Inf, or finite but at least 2^16.
+        return static_cast<uint16_t>(sign | 0x7c00);
+    }
+    if (abs_bits < 0x38800000) {
+        // Below 2^-14, the result is subnormal or zero.
+        const uint32_t exponent = abs_bits >> 23;
+        if (exponent < 102) {
+            return static_cast<uint16_t>(sign);
+        }
+        const uint32_t mantissa = (abs_bits & 0x7fffff) | 0x800000;
+        const uint32_t shift = 126 - exponent;
+        uint32_t half = mantissa >> shift;
+        const uint32_t remainder = mantissa & ((1u << shift) - 1);
+        const uint32_t halfway = 1u << (shift - 1);
+        if (remainder > halfway || (remainder == halfway && (half & 1))) {
+            ++half;
+        }
+        return static_cast<uint16_t>(sign | half);
+    }
+    // Re-bias the exponent from 127 to 15. A carry out of the mantissa on
+    // rounding correctly increments the exponent, up to Inf.
+    const uint32_t rebiased = abs_bits - 0x38000000;
+    uint32_t half = rebiased >> 13;
+    const uint32_t remainder = rebiased & 0x1fff;
+    if (remainder > 0x1000 || (remainder == 0x1000 && (half & 1))) {
+        ++half;
+    }
+    return static_cast<uint16_t>(sign | half);
+}
+
+OPEN3D_HALF_FN float HalfBitsToFloat(uint16_t half) {
+    const uint32_t sign = static_cast<uint32_t>(half & 0x8000) << 16;
+    const uint32_t exponent = (half >> 10) & 0x1f;
+    const uint32_t mantissa = half & 0x3ff;
+    if (exponent == 0) {
+        // Zero or subnormal, mantissa * 2^-24 is exact in float.
+        const float magnitude = static_cast<float>(mantissa) * 5.9604645e-8f;
+        return sign ? -magnitude : magnitude;
+    }
+    if (exponent == 0x1f) {
+        return BitsToFloat(sign | 0x7f800000 | (mantissa << 13));
+    }
+    return BitsToFloat(sign | ((exponent + 112) << 23) | (mantissa << 13));
+}
+
+/// Round a float to the nearest bfloat16, ties to even.
+OPEN3D_HALF_FN uint16_t FloatToBFloat16Bits(float value) {
+    const uint32_t bits = FloatToBits(value);
+    if ((bits & 0x7fffffff) > 0x7f800000) {
+        return static_cast<uint16_t>((bits >> 16) | 0x40);
+    }
+    const uint32_t rounding = 0x7fff + ((bits >> 16) & 1);
+    return static_cast<uint16_t>((bits + rounding) >> 16);
+}
+
+OPEN3D_HALF_FN float BFloat16BitsToFloat(uint16_t bfloat16) {
+    return BitsToFloat(static_cast<uint32_t>(bfloat16) << 16);
+}
+
+}  // namespace half_util
+
+/// IEEE 754 half precision value, the C++ type of core::Float16.
+struct float16_t {
+    float16_t() = default;
+    OPEN3D_HALF_FN float16_t(float value)
+        : bits_(half_util::FloatToHalfBits(value)) {}
+    OPEN3D_HALF_FN operator float() const {
+        return half_util::HalfBitsToFloat(bits_);
+    }
+
+    /// Construct from the raw binary16 bits.
+    static OPEN3D_HALF_FN float16_t FromBits(uint16_t bits) {
+        float16_t value;
+        value.bits_ = bits;
+        return value;
+    }
+    OPEN3D_HALF_FN uint16_t GetBits() const { return bits_; }
+
+private:
+    uint16_t bits_;
+};
+
+/// Brain floating point value, the C++ type of core::BFloat16. It has the
+/// range of float with an 8-bit mantissa.
+struct bfloat16_t {
+    bfloat16_t() = default;
+    OPEN3D_HALF_FN bfloat16_t(float value)
+        : bits_(half_util::FloatToBFloat16Bits(value)) {}
+    OPEN3D_HALF_FN operator float() const {
+        return half_util::BFloat16BitsToFloat(bits_);
+    }
+
+    /// Construct from the raw bits, the upper 16 bits of a float.
+    static OPEN3D_HALF_FN bfloat16_t FromBits(uint16_t bits) {
+        bfloat16_t value;
+        value.bits_ = bits;
+        return value;
+    }
+    OPEN3D_HALF_FN uint16_t GetBits() const { return bits_; }
+
+private:
+    uint16_t bits_;
+};
+
+static_assert(sizeof(float16_t) == 2, "float16_t must be 2 bytes.");
+static_assert(sizeof(bfloat16_t) == 2, "bfloat16_t must be 2 bytes.");
+
+}  // namespace core
+}  // namespace open3d
+
+#undef OPEN3D_HALF_FN
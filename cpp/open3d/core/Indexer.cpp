@@ -591,6 +591,41 @@ void Indexer::UpdateContiguousFlags() {
     }
 }
 
+IndexerLayout Indexer::GetInputLayout(int64_t i) const {
+    return GetLayout(GetInput(i), inputs_contiguous_[i]);
+}
+
+IndexerLayout Indexer::GetOutputLayout(int64_t i) const {
+    return GetLayout(GetOutput(i), outputs_contiguous_[i]);
+}
+
+IndexerLayout Indexer::GetLayout(const TensorRef& tr,
+                                 bool tr_contiguous) const {
+    if (tr_contiguous) {
+        return IndexerLayout::Contiguous;
+    }
+    // Dimensions of size 1 do not contribute to the offsets.
+    bool outer_broadcast = true;
+    for (int64_t i = 0; i < ndims_ - 1; ++i) {
+        if (master_shape_[i] > 1 && tr.byte_strides_[i] != 0) {
+            outer_broadcast = false;
+            break;
+        }
+    }
+    if (!outer_broadcast || ndims_ == 0) {
+        return IndexerLayout::Strided;
+    }
+    const int64_t last_size = master_shape_[ndims_ - 1];
+    const int64_t last_stride = tr.byte_strides_[ndims_ - 1];
+    if (last_size <= 1 || last_stride == 0) {
+        return IndexerLayout::Scalar;
+    }
+    if (last_stride == tr.dtype_byte_size_) {
+        return IndexerLayout::InnerBroadcast;
+    }
+    return IndexerLayout::Strided;
+}
+
 void Indexer::BroadcastRestride(TensorRef& src,
                                 int64_t dst_ndims,
                                 const int64_t* dst_shape) {
@@ -270,6 +270,22 @@ protected:
     int64_t ndims_;
 };
 
+/// Memory layout of an Indexer operand relative to the Indexer's master shape.
+/// Elementwise kernels dispatch on these at compile time so that the common
+/// layouts skip the generic per-dimension offset computation.
+enum class IndexerLayout {
+    /// Arbitrary strides, offsets are computed per dimension.
+    Strided,
+    /// Same layout as the master shape, offset is workload_idx.
+    Contiguous,
+    /// A single element broadcast to all workloads, e.g. a 0-d RHS.
+    Scalar,
+    /// A contiguous vector along the innermost dimension broadcast over all
+    /// outer dimensions, e.g. the (3,) operand of a (N, 3) + (3,) op. Offset is
+    /// workload_idx % master_shape[-1].
+    InnerBroadcast,
+};
+
 /// Indexing engine for elementwise ops with broadcasting support.
 ///
 /// Fancy indexing is supported by restriding input tensor and treating the
@@ -416,6 +432,14 @@ public:
         return outputs_[0].byte_strides_[dim] == 0 && master_shape_[dim] > 1;
     }
 
+    /// Returns the memory layout of the \p i -th input. For Contiguous
+    /// inputs, GetInputPtr<T, IndexerLayout::Contiguous> is equivalent to, but
+    /// cheaper than GetInputPtr<T>.
+    IndexerLayout GetInputLayout(int64_t i) const;
+
+    /// Returns the memory layout of the \p i -th output.
+    IndexerLayout GetOutputLayout(int64_t i = 0) const;
+
     /// Get input Tensor data pointer based on \p workload_idx.
     ///
     /// \param input_idx Input tensor index.
@@ -496,6 +520,26 @@ public:
                                      workload_idx);
     }
 
+    /// Get input Tensor data pointer based on \p workload_idx, assuming that
+    /// GetInputLayout(input_idx) == layout. The layout is resolved at compile
+    /// time, thus no per-element index math is needed for non-Strided layouts.
+    /// The caller is responsible for checking the layout on the host.
+    template <typename T, IndexerLayout layout>
+    OPEN3D_HOST_DEVICE T* GetInputPtr(int64_t input_idx,
+                                      int64_t workload_idx) const {
+        return GetLayoutDataPtr<T, layout>(inputs_[input_idx],
+                                           inputs_contiguous_[input_idx],
+                                           workload_idx);
+    }
+
+    /// Get output Tensor data pointer based on \p workload_idx, assuming that
+    /// GetOutputLayout() == layout.
+    template <typename T, IndexerLayout layout>
+    OPEN3D_HOST_DEVICE T* GetOutputPtr(int64_t workload_idx) const {
+        return GetLayoutDataPtr<T, layout>(outputs_[0], outputs_contiguous_[0],
+                                           workload_idx);
+    }
+
 #ifdef BUILD_ISPC_MODULE
     /// Converts this object to an corresponding ISPC-compatible object.
     ispc::Indexer ToISPC() const;
@@ -554,6 +598,27 @@ protected:
                                   const int64_t* src_shape,
                                   const SizeVector& reduction_dims);
 
+    /// Byte offset of \p workload_idx in a non-contiguous TensorRef. 1-D and
+    /// 2-D layouts, e.g. column slices and transposed matrices, take a fast
+    /// path without the generic per-dimension division loop.
+    OPEN3D_HOST_DEVICE int64_t
+    GetWorkloadByteOffset(const TensorRef& tr, int64_t workload_idx) const {
+        if (ndims_ == 1) {
+            return workload_idx * tr.byte_strides_[0];
+        }
+        if (ndims_ == 2) {
+            const int64_t row = workload_idx / master_strides_[0];
+            const int64_t col = workload_idx - row * master_strides_[0];
+            return row * tr.byte_strides_[0] + col * tr.byte_strides_[1];
+        }
+        int64_t offset = 0;
+        for (int64_t i = 0; i < ndims_; ++i) {
+            offset += workload_idx / master_strides_[i] * tr.byte_strides_[i];
+            workload_idx = workload_idx % master_strides_[i];
+        }
+        return offset;
+    }
+
     /// Get data pointer from a TensorRef with \p workload_idx.
     /// Note: can be optimized by computing all input ptrs and output ptr
     /// together.
@@ -569,12 +634,7 @@ protected:
             return static_cast<char*>(tr.data_ptr_) +
                    workload_idx * tr.dtype_byte_size_;
         } else {
-            int64_t offset = 0;
-            for (int64_t i = 0; i < ndims_; ++i) {
-                offset +=
-                        workload_idx / master_strides_[i] * tr.byte_strides_[i];
-                workload_idx = workload_idx % master_strides_[i];
-            }
+            const int64_t offset = GetWorkloadByteOffset(tr, workload_idx);
             return static_cast<char*>(tr.data_ptr_) + offset;
         }
     }
@@ -597,17 +657,34 @@ protected:
         if (tr_contiguous) {
             return static_cast<T*>(tr.data_ptr_) + workload_idx;
         } else {
-            int64_t offset = 0;
-            for (int64_t i = 0; i < ndims_; ++i) {
-                offset +=
-                        workload_idx / master_strides_[i] * tr.byte_strides_[i];
-                workload_idx = workload_idx % master_strides_[i];
-            }
+            const int64_t offset = GetWorkloadByteOffset(tr, workload_idx);
             return static_cast<T*>(static_cast<void*>(
                     static_cast<char*>(tr.data_ptr_) + offset));
         }
     }
 
+    /// Get data pointer from a TensorRef with \p workload_idx, where the
+    /// TensorRef's layout is known at compile time.
+    template <typename T, IndexerLayout layout>
+    OPEN3D_HOST_DEVICE T* GetLayoutDataPtr(const TensorRef& tr,
+                                           bool tr_contiguous,
+                                           int64_t workload_idx) const {
+        T* data = static_cast<T*>(tr.data_ptr_);
+        switch (layout) {
+            case IndexerLayout::Contiguous:
+                return data + workload_idx;
+            case IndexerLayout::Scalar:
+                return data;
+            case IndexerLayout::InnerBroadcast:
+                return data + workload_idx % master_shape_[ndims_ - 1];
+            default:
+                return GetWorkloadDataPtr<T>(tr, tr_contiguous, workload_idx);
+        }
+    }
+
+    /// Returns the layout of \p tr relative to the master shape.
+    IndexerLayout GetLayout(const TensorRef& tr, bool tr_contiguous) const;
+
     /// Number of input and output Tensors.
     int64_t num_inputs_ = 0;
     int64_t num_outputs_ = 0;
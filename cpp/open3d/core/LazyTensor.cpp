@@ -0,0 +1,283 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/core/LazyTensor.h"
+
+#include <vector>
+
+#include "open3d/core/ShapeUtil.h"
+#include "open3d/core/TensorCheck.h"
+#include "open3d/core/kernel/FusedEW.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace core {
+
+using kernel::FusedEWOpCode;
+
+struct LazyTensor::Node {
+    FusedEWOpCode op_code_;
+    Tensor tensor_;
+    double scalar_ = 0.0;
+    std::shared_ptr<const Node> lhs_ = nullptr;
+    std::shared_ptr<const Node> rhs_ = nullptr;
+    SizeVector shape_;
+    Dtype dtype_ = core::Undefined;
+    Device device_;
+};
+
+using NodePtr = std::shared_ptr<const LazyTensor::Node>;
+
+static NodePtr MakeLeafNode(const Tensor& tensor) {
+    auto node = std::make_shared<LazyTensor::Node>();
+    node->op_code_ = FusedEWOpCode::Input;
+    node->tensor_ = tensor;
+    node->shape_ = tensor.GetShape();
+    node->dtype_ = tensor.GetDtype();
+    node->device_ = tensor.GetDevice();
+    return node;
+}
+
+static NodePtr MakeScalarNode(double value, const NodePtr& like) {
+    auto node = std::make_shared<LazyTensor::Node>();
+    node->op_code_ = FusedEWOpCode::Scalar;
+    node->scalar_ = value;
+    node->shape_ = {};
+    node->dtype_ = like->dtype_;
+    node->device_ = like->device_;
+    return node;
+}
+
+static NodePtr MakeUnaryNode(FusedEWOpCode op_code, const NodePtr& src) {
+    auto node = std::make_shared<LazyTensor::Node>();
+    node->op_code_ = op_code;
+    node->lhs_ = src;
+    node->shape_ = src->shape_;
+    node->dtype_ = src->dtype_;
+    node->device_ = src->device_;
+    return node;
+}
+
+static NodePtr MakeBinaryNode(FusedEWOpCode op_code,
+                              const NodePtr& lhs,
+                              const NodePtr& rhs) {
+    if (lhs->device_ != rhs->device_) {
+        utility::LogError("Device mismatch {} != {}.", lhs->device_.ToString(),
+                          rhs->device_.ToString());
+    }
+    if (lhs->dtype_ != rhs->dtype_) {
+        utility::LogError("Dtype mismatch {} != {}.", lhs->dtype_.ToString(),
+                          rhs->dtype_.ToString());
+    }
+    auto node = std::make_shared<LazyTensor::Node>();
+    node->op_code_ = op_code;
+    node->lhs_ = lhs;
+    node->rhs_ = rhs;
+    node->shape_ = shape_util::BroadcastedShape(lhs->shape_, rhs->shape_);
+    node->dtype_ = lhs->dtype_;
+    node->device_ = lhs->device_;
+    return node;
+}
+
+/// Evaluates the expression with the regular (unfused) tensor ops.
+static Tensor EvaluateEagerly(const NodePtr& node) {
+    switch (node->op_code_) {
+        case FusedEWOpCode::Input:
+            return node->tensor_;
+        case FusedEWOpCode::Scalar:
+            return Tensor::Full({}, node->scalar_, node->dtype_,
+                                node->device_);
+        case FusedEWOpCode::Add:
+            return EvaluateEagerly(node->lhs_) + EvaluateEagerly(node->rhs_);
+        case FusedEWOpCode::Sub:
+            return EvaluateEagerly(node->lhs_) - EvaluateEagerly(node->rhs_);
+        case FusedEWOpCode::Mul:
+            return EvaluateEagerly(node->lhs_) * EvaluateEagerly(node->rhs_);
+        case FusedEWOpCode::Div:
+            return EvaluateEagerly(node->lhs_) / EvaluateEagerly(node->rhs_);
+        case FusedEWOpCode::Neg:
+            return EvaluateEagerly(node->lhs_).Neg();
+        case FusedEWOpCode::Sqrt:
+            return EvaluateEagerly(node->lhs_).Sqrt();
+        case FusedEWOpCode::Exp:
+            return EvaluateEagerly(node->lhs_).Exp();
+        case FusedEWOpCode::Abs:
+            return EvaluateEagerly(node->lhs_).Abs();
+    }
+    utility::LogError("Unknown LazyTensor op code.");
+}
+
+/// Emits the postfix program of \p node. Returns false if the program does
+/// not fit into the limits of the fused kernel.
+static bool Compile(const NodePtr& node,
+                    std::vector<Tensor>& inputs,
+                    kernel::FusedEWProgram& program,
+                    int64_t& depth) {
+    if (program.num_instructions_ >= kernel::MAX_FUSED_EW_INSTRUCTIONS) {
+        return false;
+    }
+    if (node->lhs_ && !Compile(node->lhs_, inputs, program, depth)) {
+        return false;
+    }
+    if (node->rhs_ && !Compile(node->rhs_, inputs, program, depth)) {
+        return false;
+    }
+    if (program.num_instructions_ >= kernel::MAX_FUSED_EW_INSTRUCTIONS) {
+        return false;
+    }
+
+    kernel::FusedEWInstruction& inst =
+            program.instructions_[program.num_instructions_++];
+    inst.op_code_ = node->op_code_;
+    inst.input_idx_ = -1;
+    inst.scalar_ = node->scalar_;
+
+    if (node->op_code_ == FusedEWOpCode::Input) {
+        // The same tensor used multiple times is only read once.
+        int64_t input_idx = -1;
+        for (size_t i = 0; i < inputs.size(); ++i) {
+            if (inputs[i].IsSame(node->tensor_)) {
+                input_idx = static_cast<int64_t>(i);
+                break;
+            }
+        }
+        if (input_idx < 0) {
+            if (static_cast<int64_t>(inputs.size()) >= MAX_INPUTS) {
+                return false;
+            }
+            input_idx = static_cast<int64_t>(inputs.size());
+            inputs.push_back(node->tensor_);
+        }
+        inst.input_idx_ = static_cast<int32_t>(input_idx);
+    }
+
+    if (node->op_code_ == FusedEWOpCode::Input ||
+        node->op_code_ == FusedEWOpCode::Scalar) {
+        ++depth;
+    } else if (node->rhs_) {
+        --depth;
+    }
+    return depth <= kernel::MAX_FUSED_EW_STACK_SIZE;
+}
+
+static Tensor Evaluate(const NodePtr& node) {
+    if (node->op_code_ == FusedEWOpCode::Input) {
+        return node->tensor_;
+    }
+    if (node->dtype_ != core::Float32 && node->dtype_ != core::Float64) {
+        return EvaluateEagerly(node);
+    }
+
+    std::vector<Tensor> inputs;
+    kernel::FusedEWProgram program;
+    int64_t depth = 0;
+    if (!Compile(node, inputs, program, depth)) {
+        // Too large for a single kernel: fuse the sub-expressions first, then
+        // combine their results.
+        auto split_node = std::make_shared<LazyTensor::Node>(*node);
+        for (NodePtr* child : {&split_node->lhs_, &split_node->rhs_}) {
+            if (*child && (*child)->op_code_ != FusedEWOpCode::Input &&
+                (*child)->op_code_ != FusedEWOpCode::Scalar) {
+                *child = MakeLeafNode(Evaluate(*child));
+            }
+        }
+        return Evaluate(split_node);
+    }
+
+    Tensor dst(node->shape_, node->dtype_, node->device_);
+    kernel::FusedEW(inputs, program, dst);
+    return dst;
+}
+
+LazyTensor::LazyTensor(const Tensor& tensor) : node_(MakeLeafNode(tensor)) {}
+
+LazyTensor LazyTensor::Add(const LazyTensor& value) const {
+    return LazyTensor(MakeBinaryNode(FusedEWOpCode::Add, node_, value.node_));
+}
+
+LazyTensor LazyTensor::Add(Scalar value) const {
+    NodePtr scalar_node = MakeScalarNode(value.To<double>(), node_);
+    return LazyTensor(MakeBinaryNode(FusedEWOpCode::Add, node_, scalar_node));
+}
+
+LazyTensor LazyTensor::Sub(const LazyTensor& value) const {
+    return LazyTensor(MakeBinaryNode(FusedEWOpCode::Sub, node_, value.node_));
+}
+
+LazyTensor LazyTensor::Sub(Scalar value) const {
+    NodePtr scalar_node = MakeScalarNode(value.To<double>(), node_);
+    return LazyTensor(MakeBinaryNode(FusedEWOpCode::Sub, node_, scalar_node));
+}
+
+LazyTensor LazyTensor::Mul(const LazyTensor& value) const {
+    return LazyTensor(MakeBinaryNode(FusedEWOpCode::Mul, node_, value.node_));
+}
+
+LazyTensor LazyTensor::Mul(Scalar value) const {
+    NodePtr scalar_node = MakeScalarNode(value.To<double>(), node_);
+    return LazyTensor(MakeBinaryNode(FusedEWOpCode::Mul, node_, scalar_node));
+}
+
+LazyTensor LazyTensor::Div(const LazyTensor& value) const {
+    return LazyTensor(MakeBinaryNode(FusedEWOpCode::Div, node_, value.node_));
+}
+
+LazyTensor LazyTensor::Div(Scalar value) const {
+    NodePtr scalar_node = MakeScalarNode(value.To<double>(), node_);
+    return LazyTensor(MakeBinaryNode(FusedEWOpCode::Div, node_, scalar_node));
+}
+
+LazyTensor LazyTensor::Neg() const {
+    return LazyTensor(MakeUnaryNode(FusedEWOpCode::Neg, node_));
+}
+
+LazyTensor LazyTensor::Sqrt() const {
+    return LazyTensor(MakeUnaryNode(FusedEWOpCode::Sqrt, node_));
+}
+
+LazyTensor LazyTensor::Exp() const {
+    return LazyTensor(MakeUnaryNode(FusedEWOpCode::Exp, node_));
+}
+
+LazyTensor LazyTensor::Abs() const {
+    return LazyTensor(MakeUnaryNode(FusedEWOpCode::Abs, node_));
+}
+
+Tensor LazyTensor::Materialize() const { return Evaluate(node_); }
+
+SizeVector LazyTensor::GetShape() const { return node_->shape_; }
+
+Dtype LazyTensor::GetDtype() const { return node_->dtype_; }
+
+Device LazyTensor::GetDevice() const { return node_->device_; }
+
+bool LazyTensor::IsLeaf() const {
+    return node_->op_code_ == FusedEWOpCode::Input;
+}
+
+}  // namespace core
+}  // namespace open3d
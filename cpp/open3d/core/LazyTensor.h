@@ -0,0 +1,136 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#pragma once
+
+#include <memory>
+
+#include "open3d/core/Device.h"
+#include "open3d/core/Dtype.h"
+#include "open3d/core/Scalar.h"
+#include "open3d/core/SizeVector.h"
+#include "open3d/core/Tensor.h"
+
+namespace open3d {
+namespace core {
+
+/// A LazyTensor records a chain of element-wise operations instead of
+/// executing them one by one. When materialized, the whole expression is
+/// evaluated in a single fused kernel: every input element is read once and no
+/// temporaries are allocated for intermediate results.
+///
+/// Example:
+/// ```cpp
+/// // Eager: 3 kernel launches and 2 temporary tensors.
+/// core::Tensor eager = (a - b) * c + d;
+/// // Lazy: 1 kernel launch, no temporary tensors.
+/// core::Tensor fused = ((a.Lazy() - b) * c + d).Materialize();
+/// ```
+///
+/// Fusion is supported for Float32 and Float64 tensors. Expressions of other
+/// dtypes are evaluated eagerly on materialization with the same semantics.
+/// Expressions that exceed the fused kernel limits (number of distinct inputs,
+/// program length or stack depth) are split into several fused kernels.
+class LazyTensor {
+public:
+    /// Creates a leaf node referencing \p tensor. The tensor is not copied,
+    /// modifying it before materialization changes the result.
+    LazyTensor(const Tensor& tensor);
+
+    LazyTensor Add(const LazyTensor& value) const;
+    LazyTensor Add(Scalar value) const;
+    LazyTensor operator+(const LazyTensor& value) const { return Add(value); }
+    LazyTensor operator+(Scalar value) const { return Add(value); }
+    LazyTensor operator+(const Tensor& value) const {
+        return Add(LazyTensor(value));
+    }
+
+    LazyTensor Sub(const LazyTensor& value) const;
+    LazyTensor Sub(Scalar value) const;
+    LazyTensor operator-(const LazyTensor& value) const { return Sub(value); }
+    LazyTensor operator-(Scalar value) const { return Sub(value); }
+    LazyTensor operator-(const Tensor& value) const {
+        return Sub(LazyTensor(value));
+    }
+
+    LazyTensor Mul(const LazyTensor& value) const;
+    LazyTensor Mul(Scalar value) const;
+    LazyTensor operator*(const LazyTensor& value) const { return Mul(value); }
+    LazyTensor operator*(Scalar value) const { return Mul(value); }
+    LazyTensor operator*(const Tensor& value) const {
+        return Mul(LazyTensor(value));
+    }
+
+    LazyTensor Div(const LazyTensor& value) const;
+    LazyTensor Div(Scalar value) const;
+    LazyTensor operator/(const LazyTensor& value) const { return Div(value); }
+    LazyTensor operator/(Scalar value) const { return Div(value); }
+    LazyTensor operator/(const Tensor& value) const {
+        return Div(LazyTensor(value));
+    }
+
+    /// Element-wise negation.
+    LazyTensor Neg() const;
+    LazyTensor operator-() const { return Neg(); }
+
+    /// Element-wise square root.
+    LazyTensor Sqrt() const;
+
+    /// Element-wise exponential.
+    LazyTensor Exp() const;
+
+    /// Element-wise absolute value.
+    LazyTensor Abs() const;
+
+    /// Evaluates the recorded expression and returns the result as a new
+    /// tensor. Materializing a leaf returns the referenced tensor itself.
+    Tensor Materialize() const;
+
+    /// Broadcasted shape of the expression result.
+    SizeVector GetShape() const;
+
+    /// Dtype of the expression result.
+    Dtype GetDtype() const;
+
+    /// Device of the expression result.
+    Device GetDevice() const;
+
+    /// Returns true if this is a leaf node, i.e. it references a tensor.
+    bool IsLeaf() const;
+
+public:
+    struct Node;
+
+private:
+    explicit LazyTensor(const std::shared_ptr<const Node>& node)
+        : node_(node) {}
+
+    std::shared_ptr<const Node> node_;
+};
+
+}  // namespace core
+}  // namespace open3d
@@ -30,6 +30,7 @@
 #include <unordered_map>
 
 #include "open3d/core/Blob.h"
+#include "open3d/core/CUDAUtils.h"
 #include "open3d/core/Device.h"
 #include "open3d/core/MemoryManagerStatistic.h"
 #include "open3d/utility/Helper.h"
@@ -83,6 +84,29 @@ void MemoryManager::Memcpy(void* dst_ptr,
     device_mm->Memcpy(dst_ptr, dst_device, src_ptr, src_device, num_bytes);
 }
 
+void MemoryManager::MemcpyAsync(void* dst_ptr,
+                                const Device& dst_device,
+                                const void* src_ptr,
+                                const Device& src_device,
+                                size_t num_bytes) {
+#ifdef BUILD_CUDA_MODULE
+    // Host-to-device and device-to-device copies are already enqueued on the
+    // current stream by Memcpy. Only device-to-host copies synchronize.
+    if (num_bytes > 0 && dst_device.GetType() == Device::DeviceType::CPU &&
+        src_device.GetType() == Device::DeviceType::CUDA) {
+        if (src_ptr == nullptr || dst_ptr == nullptr) {
+            utility::LogError("src_ptr and dst_ptr cannot be nullptr.");
+        }
+        CUDAScopedDevice scoped_device(src_device);
+        OPEN3D_CUDA_CHECK(cudaMemcpyAsync(dst_ptr, src_ptr, num_bytes,
+                                          cudaMemcpyDeviceToHost,
+                                          cuda::GetStream()));
+        return;
+    }
+#endif
+    Memcpy(dst_ptr, dst_device, src_ptr, src_device, num_bytes);
+}
+
 void MemoryManager::MemcpyFromHost(void* dst_ptr,
                                    const Device& dst_device,
                                    const void* host_ptr,
@@ -105,10 +129,18 @@ std::shared_ptr<DeviceMemoryManager> MemoryManager::GetDeviceMemoryManager(
                               std::shared_ptr<DeviceMemoryManager>,
                               utility::hash_enum_class>
             map_device_type_to_memory_manager = {
+#ifdef BUILD_CACHED_CPU_MANAGER
+                    {Device::DeviceType::CPU,
+                     std::make_shared<CachedCPUMemoryManager>()},
+#else
                     {Device::DeviceType::CPU,
                      std::make_shared<CPUMemoryManager>()},
+#endif
 #ifdef BUILD_CUDA_MODULE
-#ifdef BUILD_CACHED_CUDA_MANAGER
+#if defined(BUILD_ASYNC_CUDA_MANAGER)
+                    {Device::DeviceType::CUDA,
+                     std::make_shared<CUDAAsyncMemoryManager>()},
+#elif defined(BUILD_CACHED_CUDA_MANAGER)
                     {Device::DeviceType::CUDA,
                      std::make_shared<CachedMemoryManager>(
                              std::make_shared<CUDAMemoryManager>())},
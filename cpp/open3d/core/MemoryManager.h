@@ -47,6 +47,7 @@ class DeviceMemoryManager;
 ///
 /// DeviceType = CPU : CPUMemoryManager
 /// DeviceType = CUDA :
+///   BUILD_ASYNC_CUDA_MANAGER = ON :  CUDAAsyncMemoryManager
 ///   BUILD_CACHED_CUDA_MANAGER = ON : CachedMemoryManager w/ CUDAMemoryManager
 ///   Otherwise :                      CUDAMemoryManager
 ///
@@ -67,6 +68,16 @@ public:
                        const Device& src_device,
                        size_t num_bytes);
 
+    /// Same as Memcpy, but copies from a CUDA device to the host do not wait
+    /// for the copy to complete. They only run asynchronously if \p dst_ptr
+    /// is pinned, see PinnedMemoryManager. The current stream must be
+    /// synchronized before the data is read on the host.
+    static void MemcpyAsync(void* dst_ptr,
+                            const Device& dst_device,
+                            const void* src_ptr,
+                            const Device& src_device,
+                            size_t num_bytes);
+
     /// Same as Memcpy, but with host (CPU:0) as default src_device.
     static void MemcpyFromHost(void* dst_ptr,
                                const Device& dst_device,
@@ -157,7 +168,123 @@ protected:
 
 /// Direct memory manager which performs allocations and deallocations on the
 /// CPU via \p std::malloc and \p std::free.
+///
+/// - On multi-socket machines, pages are placed on the NUMA node of the thread
+/// that first writes them. With the FirstTouch and Interleave policies, large
+/// allocations are mapped from fresh pages instead of reusing heap memory
+/// already placed by earlier allocations. FirstTouch writes the pages in
+/// parallel with the static partitioning of core::ParallelFor, so that they
+/// are local to the threads which later process them, and Interleave spreads
+/// them round-robin over the nodes allowed to the process. First-touch
+/// placement requires the OpenMP threads to be bound, e.g. with
+/// `OMP_PROC_BIND=spread OMP_PLACES=cores`.
+///
+/// - The default policy is read from the environment variable
+/// `OPEN3D_CPU_MEMORY_POLICY` (`default`, `first_touch` or `interleave`).
+///
+/// - Large copies between CPU buffers run in parallel with the same
+/// partitioning, so that copies such as Tensor::Clone() also place the pages
+/// of the destination next to their threads.
 class CPUMemoryManager : public DeviceMemoryManager {
+public:
+    enum class Policy {
+        Default,     ///< \p std::malloc for all allocations.
+        FirstTouch,  ///< Fresh pages, written in parallel on allocation.
+        Interleave,  ///< Fresh pages, interleaved over the NUMA nodes.
+    };
+
+    /// Sets the placement policy of subsequent allocations. Allocations of
+    /// less than 4 MiB always use \p std::malloc. Interleave only maps fresh
+    /// pages where NUMA is unavailable and is the same as Default outside of
+    /// Linux.
+    static void SetPolicy(Policy policy);
+
+    static Policy GetPolicy();
+
+    /// Allocates memory of \p byte_size bytes on device \p device and returns a
+    /// pointer to the beginning of the allocated memory block.
+    void* Malloc(size_t byte_size, const Device& device) override;
+
+    /// Frees previously allocated memory at address \p ptr on device \p device.
+    void Free(void* ptr, const Device& device) override;
+
+    /// Copies \p num_bytes bytes of memory at address \p src_ptr on device
+    /// \p src_device to address \p dst_ptr on device \p dst_device.
+    void Memcpy(void* dst_ptr,
+                const Device& dst_device,
+                const void* src_ptr,
+                const Device& src_device,
+                size_t num_bytes) override;
+};
+
+/// CPU memory manager which keeps freed blocks in size classes and reuses them
+/// for later allocations, saving the system allocator calls and the page
+/// faults of fresh memory for the many temporaries of CPU kernels.
+///
+/// - Sizes are rounded up to classes of four steps per power of two, with at
+/// most 25% internal fragmentation. Blocks of more than 256 MiB are not
+/// cached.
+///
+/// - Each thread keeps up to 16 MiB of blocks of at most 1 MiB in a local
+/// cache that is accessed without contention. Other blocks, and blocks
+/// exceeding the local cache, go to a process-wide cache of up to
+/// SetMaxCacheSize() bytes.
+///
+/// - Blocks of at least 2 MiB are advised to be backed by transparent huge
+/// pages on Linux.
+///
+/// - Direct allocations go through CPUMemoryManager and follow its placement
+/// policy. Call \p ReleaseCache to return all cached blocks to the system.
+/// A failing direct allocation releases the cache and tries again.
+///
+/// - Used for CPU devices if Open3D is built with BUILD_CACHED_CPU_MANAGER.
+class CachedCPUMemoryManager : public DeviceMemoryManager {
+public:
+    /// Allocates memory of \p byte_size bytes on device \p device and returns a
+    /// pointer to the beginning of the allocated memory block.
+    void* Malloc(size_t byte_size, const Device& device) override;
+
+    /// Frees previously allocated memory at address \p ptr on device \p device.
+    void Free(void* ptr, const Device& device) override;
+
+    /// Copies \p num_bytes bytes of memory at address \p src_ptr on device
+    /// \p src_device to address \p dst_ptr on device \p dst_device.
+    void Memcpy(void* dst_ptr,
+                const Device& dst_device,
+                const void* src_ptr,
+                const Device& src_device,
+                size_t num_bytes) override;
+
+public:
+    /// Frees all cached blocks of all threads.
+    static void ReleaseCache();
+
+    /// Limits the bytes kept in the process-wide cache. Blocks freed beyond
+    /// the limit are returned to the system. Defaults to 1 GiB.
+    static void SetMaxCacheSize(size_t byte_size);
+
+    /// Returns the total bytes of the blocks currently cached.
+    static size_t GetCacheSize();
+};
+
+/// Host memory manager which allocates page-locked (pinned) host memory via
+/// \p cudaHostAlloc. Copies between pinned host memory and CUDA devices can be
+/// performed by DMA without an intermediate staging buffer and run
+/// asynchronously on the current stream, see cuda::GetStream().
+///
+/// - Pinned memory is expensive to allocate, therefore freed blocks are kept in
+/// a process-wide pool and reused by allocations of the same (page-aligned)
+/// size. Call \p ReleaseCache to return the pooled memory to the system.
+///
+/// - A freed block is reused only after the work enqueued on the current
+/// stream at the time of the free has completed, so in-flight asynchronous
+/// copies from or to the block are never overwritten.
+///
+/// - Falls back to \p std::malloc and \p std::free if Open3D is not compiled
+/// with CUDA or no CUDA device is available.
+///
+/// The allocated memory belongs to the host device CPU:0.
+class PinnedMemoryManager : public DeviceMemoryManager {
 public:
     /// Allocates memory of \p byte_size bytes on device \p device and returns a
     /// pointer to the beginning of the allocated memory block.
@@ -173,6 +300,13 @@ public:
                 const void* src_ptr,
                 const Device& src_device,
                 size_t num_bytes) override;
+
+public:
+    /// Returns true if \p ptr points to page-locked host memory.
+    static bool IsPinned(const void* ptr);
+
+    /// Frees all pooled pinned memory blocks which are not in use.
+    static void ReleaseCache();
 };
 
 #ifdef BUILD_CUDA_MODULE
@@ -198,6 +332,44 @@ public:
 protected:
     bool IsCUDAPointer(const void* ptr, const Device& device);
 };
+
+/// Direct memory manager which performs stream-ordered allocations and
+/// deallocations on CUDA devices via \p cudaMallocFromPoolAsync and
+/// \p cudaFreeAsync on the current stream, see cuda::GetStream().
+///
+/// - Each device owns a memory pool which keeps freed memory for reuse instead
+/// of returning it to the system, therefore no additional caching layer (and
+/// no global lock) is required.
+///
+/// - Allocations and frees are ordered with the work on the current stream,
+/// so freeing memory never synchronizes the device. Memory freed on one stream
+/// is reused by another stream only after the freeing stream has progressed
+/// past the free.
+///
+/// - Falls back to \p cudaMalloc and \p cudaFree on devices or CUDA versions
+/// (< 11.2) without memory pool support.
+class CUDAAsyncMemoryManager : public CUDAMemoryManager {
+public:
+    /// Allocates memory of \p byte_size bytes on device \p device and returns a
+    /// pointer to the beginning of the allocated memory block. The memory is
+    /// usable by work enqueued on the current stream.
+    void* Malloc(size_t byte_size, const Device& device) override;
+
+    /// Frees previously allocated memory at address \p ptr on device \p device.
+    /// The memory is released once the current stream reaches this point.
+    void Free(void* ptr, const Device& device) override;
+
+public:
+    /// Returns true if stream-ordered memory pools are supported on \p device.
+    static bool IsSupported(const Device& device);
+
+    /// Returns the unused memory held by the memory pool of \p device to the
+    /// system. The device is synchronized before releasing.
+    static void ReleaseCache(const Device& device);
+
+    /// Returns the unused memory held by the memory pools of all devices.
+    static void ReleaseCache();
+};
 #endif
 
 }  // namespace core
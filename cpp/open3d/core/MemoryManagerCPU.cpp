@@ -24,15 +24,133 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
 #include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#ifdef __linux__
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
 
 #include "open3d/core/MemoryManager.h"
+#include "open3d/core/ParallelFor.h"
+#include "open3d/utility/Parallel.h"
 
 namespace open3d {
 namespace core {
 
+/// Allocations and copies of at least this size are placed by the policy and
+/// run in parallel.
+static constexpr size_t kLargeByteSize = size_t(4) << 20;
+static constexpr size_t kPageSize = 4096;
+static constexpr size_t kCopyChunkSize = 16 * kPageSize;
+
+static CPUMemoryManager::Policy ReadPolicyFromEnv() {
+    const char* value = std::getenv("OPEN3D_CPU_MEMORY_POLICY");
+    const std::string policy = value ? value : "";
+    if (policy == "first_touch") {
+        return CPUMemoryManager::Policy::FirstTouch;
+    } else if (policy == "interleave") {
+        return CPUMemoryManager::Policy::Interleave;
+    } else if (!policy.empty() && policy != "default") {
+        utility::LogWarning(
+                "Unknown OPEN3D_CPU_MEMORY_POLICY {}, using default.", policy);
+    }
+    return CPUMemoryManager::Policy::Default;
+}
+
+static std::atomic<CPUMemoryManager::Policy>& GlobalPolicy() {
+    static std::atomic<CPUMemoryManager::Policy> policy(ReadPolicyFromEnv());
+    return policy;
+}
+
+/// Writes one byte of each page in parallel, so that each page is placed on
+/// the node of the thread processing it in core::ParallelFor.
+static void TouchPages(void* ptr, size_t byte_size) {
+    char* bytes = static_cast<char*>(ptr);
+    const int64_t num_pages = (byte_size + kPageSize - 1) / kPageSize;
+    ParallelFor(Device("CPU:0"), num_pages,
+                [bytes](int64_t i) { bytes[i * kPageSize] = 0; });
+}
+
+#ifdef __linux__
+// Sizes of the allocations mapped with mmap. Never destroyed, so that static
+// tensors can be freed at exit.
+static std::mutex& MappedMutex() {
+    static std::mutex* mutex = new std::mutex();
+    return *mutex;
+}
+static std::unordered_map<void*, size_t>& MappedSizes() {
+    static std::unordered_map<void*, size_t>* sizes =
+            new std::unordered_map<void*, size_t>();
+    return *sizes;
+}
+static std::atomic<int64_t> g_num_mapped(0);
+
+/// Sets the NUMA policy of the pages to interleaving over the nodes allowed
+/// to the process. Does nothing without NUMA support.
+static void InterleavePages(void* ptr, size_t byte_size) {
+#if defined(SYS_mbind) && defined(SYS_get_mempolicy)
+    // From <linux/mempolicy.h>, which is not always installed.
+    constexpr int kMPolInterleave = 3;
+    constexpr int kMPolFMemsAllowed = 1 << 2;
+    constexpr unsigned long kMaxNodes = 1024;
+    unsigned long nodes[kMaxNodes / (8 * sizeof(unsigned long))] = {};
+    if (syscall(SYS_get_mempolicy, nullptr, nodes, kMaxNodes, nullptr,
+                kMPolFMemsAllowed) != 0 ||
+        syscall(SYS_mbind, ptr, byte_size, kMPolInterleave, nodes,
+                kMaxNodes + 1, 0) != 0) {
+        utility::LogDebug("Interleaving memory over NUMA nodes failed: {}.",
+                          std::strerror(errno));
+    }
+#endif
+}
+#endif
+
+void CPUMemoryManager::SetPolicy(Policy policy) { GlobalPolicy() = policy; }
+
+CPUMemoryManager::Policy CPUMemoryManager::GetPolicy() {
+    return GlobalPolicy();
+}
+
 void* CPUMemoryManager::Malloc(size_t byte_size, const Device& device) {
     void* ptr;
+    const Policy policy = GetPolicy();
+    if (policy != Policy::Default && byte_size >= kLargeByteSize) {
+#ifdef __linux__
+        // Fresh pages are not placed until they are written.
+        ptr = mmap(nullptr, byte_size, PROT_READ | PROT_WRITE,
+                   MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (ptr == MAP_FAILED) {
+            utility::LogError("CPU malloc failed");
+        }
+        {
+            std::lock_guard<std::mutex> lock(MappedMutex());
+            MappedSizes()[ptr] = byte_size;
+            ++g_num_mapped;
+        }
+        if (policy == Policy::Interleave) {
+            InterleavePages(ptr, byte_size);
+            return ptr;
+        }
+#else
+        ptr = std::malloc(byte_size);
+        if (!ptr) {
+            utility::LogError("CPU malloc failed");
+        }
+#endif
+        if (policy == Policy::FirstTouch) {
+            TouchPages(ptr, byte_size);
+        }
+        return ptr;
+    }
     ptr = std::malloc(byte_size);
     if (byte_size != 0 && !ptr) {
         utility::LogError("CPU malloc failed");
@@ -42,6 +160,24 @@ void* CPUMemoryManager::Malloc(size_t byte_size, const Device& device) {
 
 void CPUMemoryManager::Free(void* ptr, const Device& device) {
     if (ptr) {
+#ifdef __linux__
+        if (g_num_mapped.load() > 0) {
+            size_t byte_size = 0;
+            {
+                std::lock_guard<std::mutex> lock(MappedMutex());
+                auto it = MappedSizes().find(ptr);
+                if (it != MappedSizes().end()) {
+                    byte_size = it->second;
+                    MappedSizes().erase(it);
+                    --g_num_mapped;
+                }
+            }
+            if (byte_size > 0) {
+                munmap(ptr, byte_size);
+                return;
+            }
+        }
+#endif
         std::free(ptr);
     }
 }
@@ -51,7 +187,21 @@ void CPUMemoryManager::Memcpy(void* dst_ptr,
                               const void* src_ptr,
                               const Device& src_device,
                               size_t num_bytes) {
-    std::memcpy(dst_ptr, src_ptr, num_bytes);
+    if (num_bytes < kLargeByteSize || utility::EstimateMaxThreads() == 1) {
+        std::memcpy(dst_ptr, src_ptr, num_bytes);
+        return;
+    }
+    // Copies in parallel chunks, which also places the untouched pages of the
+    // destination next to the threads processing them.
+    char* dst = static_cast<char*>(dst_ptr);
+    const char* src = static_cast<const char*>(src_ptr);
+    const int64_t num_chunks =
+            (num_bytes + kCopyChunkSize - 1) / kCopyChunkSize;
+    ParallelFor(Device("CPU:0"), num_chunks, [=](int64_t i) {
+        const size_t offset = i * kCopyChunkSize;
+        std::memcpy(dst + offset, src + offset,
+                    std::min(kCopyChunkSize, num_bytes - offset));
+    });
 }
 
 }  // namespace core
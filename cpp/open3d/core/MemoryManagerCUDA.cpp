@@ -27,6 +27,11 @@
 #include <cuda.h>
 #include <cuda_runtime.h>
 
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
 #include "open3d/core/CUDAUtils.h"
 #include "open3d/core/MemoryManager.h"
 
@@ -89,6 +94,9 @@ void CUDAMemoryManager::Memcpy(void* dst_ptr,
         OPEN3D_CUDA_CHECK(cudaMemcpyAsync(dst_ptr, src_ptr, num_bytes,
                                           cudaMemcpyDeviceToHost,
                                           cuda::GetStream()));
+        // The copy only runs asynchronously for pinned host memory. Wait for
+        // it so that the data is always visible on the host after returning.
+        OPEN3D_CUDA_CHECK(cudaStreamSynchronize(cuda::GetStream()));
     } else if (dst_device.GetType() == Device::DeviceType::CUDA &&
                src_device.GetType() == Device::DeviceType::CUDA) {
         if (!IsCUDAPointer(dst_ptr, dst_device)) {
@@ -137,5 +145,126 @@ bool CUDAMemoryManager::IsCUDAPointer(const void* ptr, const Device& device) {
     return attributes.devicePointer != nullptr ? true : false;
 }
 
+#if CUDART_VERSION >= 11020
+/// Creates the memory pool of \p device_id. Pools never return freed memory
+/// to the system on their own. Returns nullptr if the device does not support
+/// memory pools.
+static cudaMemPool_t CreateMemPool(int device_id) {
+    int supported = 0;
+    OPEN3D_CUDA_CHECK(cudaDeviceGetAttribute(
+            &supported, cudaDevAttrMemoryPoolsSupported, device_id));
+    if (!supported) {
+        return nullptr;
+    }
+
+    cudaMemPool_t pool = nullptr;
+    cudaMemPoolProps props = {};
+    props.allocType = cudaMemAllocationTypePinned;
+    props.handleTypes = cudaMemHandleTypeNone;
+    props.location.type = cudaMemLocationTypeDevice;
+    props.location.id = device_id;
+    OPEN3D_CUDA_CHECK(cudaMemPoolCreate(&pool, &props));
+
+    uint64_t release_threshold = UINT64_MAX;
+    OPEN3D_CUDA_CHECK(cudaMemPoolSetAttribute(
+            pool, cudaMemPoolAttrReleaseThreshold, &release_threshold));
+    utility::LogDebug("CUDA memory pool created on CUDA:{}.", device_id);
+    return pool;
+}
+
+struct MemPoolSlot {
+    std::atomic<bool> initialized_{false};
+    cudaMemPool_t pool_ = nullptr;
+};
+
+/// Returns the memory pool of \p device or nullptr if not supported. Each pool
+/// is created when its device first allocates, so unused devices do not get a
+/// CUDA context. Once created, later calls do not lock. If \p create is false,
+/// nullptr is also returned for pools which have not been created yet.
+static cudaMemPool_t GetMemPool(const Device& device, bool create = true) {
+    static std::vector<MemPoolSlot> slots(cuda::DeviceCount());
+    static std::mutex mutex;
+    if (device.GetType() != Device::DeviceType::CUDA || device.GetID() < 0 ||
+        device.GetID() >= static_cast<int>(slots.size())) {
+        return nullptr;
+    }
+    MemPoolSlot& slot = slots[device.GetID()];
+    if (!slot.initialized_.load(std::memory_order_acquire)) {
+        if (!create) {
+            return nullptr;
+        }
+        std::lock_guard<std::mutex> lock(mutex);
+        if (!slot.initialized_.load(std::memory_order_relaxed)) {
+            slot.pool_ = CreateMemPool(device.GetID());
+            slot.initialized_.store(true, std::memory_order_release);
+        }
+    }
+    return slot.pool_;
+}
+#endif
+
+bool CUDAAsyncMemoryManager::IsSupported(const Device& device) {
+#if CUDART_VERSION >= 11020
+    return GetMemPool(device) != nullptr;
+#else
+    return false;
+#endif
+}
+
+void* CUDAAsyncMemoryManager::Malloc(size_t byte_size, const Device& device) {
+    if (device.GetType() != Device::DeviceType::CUDA) {
+        utility::LogError(
+                "CUDAAsyncMemoryManager::Malloc: Unimplemented device.");
+    }
+    CUDAScopedDevice scoped_device(device);
+
+    void* ptr;
+#if CUDART_VERSION >= 11020
+    if (cudaMemPool_t pool = GetMemPool(device)) {
+        OPEN3D_CUDA_CHECK(cudaMallocFromPoolAsync(static_cast<void**>(&ptr),
+                                                  byte_size, pool,
+                                                  cuda::GetStream()));
+        return ptr;
+    }
+#endif
+    OPEN3D_CUDA_CHECK(cudaMalloc(static_cast<void**>(&ptr), byte_size));
+    return ptr;
+}
+
+void CUDAAsyncMemoryManager::Free(void* ptr, const Device& device) {
+    if (device.GetType() != Device::DeviceType::CUDA) {
+        utility::LogError(
+                "CUDAAsyncMemoryManager::Free: Unimplemented device.");
+    }
+    if (ptr == nullptr) {
+        return;
+    }
+    CUDAScopedDevice scoped_device(device);
+
+#if CUDART_VERSION >= 11020
+    if (GetMemPool(device) != nullptr) {
+        OPEN3D_CUDA_CHECK(cudaFreeAsync(ptr, cuda::GetStream()));
+        return;
+    }
+#endif
+    OPEN3D_CUDA_CHECK(cudaFree(ptr));
+}
+
+void CUDAAsyncMemoryManager::ReleaseCache(const Device& device) {
+#if CUDART_VERSION >= 11020
+    if (cudaMemPool_t pool = GetMemPool(device, /*create=*/false)) {
+        CUDAScopedDevice scoped_device(device);
+        OPEN3D_CUDA_CHECK(cudaDeviceSynchronize());
+        OPEN3D_CUDA_CHECK(cudaMemPoolTrimTo(pool, 0));
+    }
+#endif
+}
+
+void CUDAAsyncMemoryManager::ReleaseCache() {
+    for (int i = 0; i < cuda::DeviceCount(); ++i) {
+        ReleaseCache(Device(Device::DeviceType::CUDA, i));
+    }
+}
+
 }  // namespace core
 }  // namespace open3d
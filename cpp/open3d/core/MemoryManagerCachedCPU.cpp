@@ -0,0 +1,412 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#ifdef __linux__
+#include <sys/mman.h>
+#endif
+
+#include "open3d/core/MemoryManager.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace core {
+
+/// The class of a block is stored in front of it, keeping the 16-byte
+/// alignment of std::malloc and the cache line alignment of mmap.
+struct CPUBlockHeader {
+    size_t byte_size_;
+    /// Size class, or -1 if the block is not cached.
+    int class_index_;
+};
+static constexpr size_t kHeaderSize = 64;
+static_assert(sizeof(CPUBlockHeader) <= kHeaderSize, "Header too large.");
+
+static constexpr size_t kMinClassSize = 64;
+static constexpr size_t kMaxCachedSize = size_t(256) << 20;
+static constexpr size_t kMaxLocalClassSize = size_t(1) << 20;
+static constexpr size_t kMaxLocalCacheSize = size_t(16) << 20;
+static constexpr size_t kHugePageSize = size_t(2) << 20;
+
+/// Index of the smallest class of four steps per power of two holding
+/// \p byte_size bytes.
+static int ClassIndex(size_t byte_size) {
+    if (byte_size <= kMinClassSize) {
+        return 0;
+    }
+    const size_t n = byte_size - 1;
+    int log2 = 0;
+    while ((n >> (log2 + 1)) != 0) {
+        ++log2;
+    }
+    const size_t step = n >> (log2 - 2);  // In [4, 7].
+    return (log2 - 6) * 4 + static_cast<int>(step - 4) + 1;
+}
+
+static size_t ClassSize(int class_index) {
+    if (class_index == 0) {
+        return kMinClassSize;
+    }
+    const int log2 = (class_index - 1) / 4 + 6;
+    const size_t step = (class_index - 1) % 4 + 4;
+    return (step + 1) << (log2 - 2);
+}
+
+static const int kNumClasses = ClassIndex(kMaxCachedSize) + 1;
+
+/// Free blocks sorted by class, each a stack so that the most recently used
+/// block, likely still in the CPU caches, is reused first.
+class CPUBlockLists {
+public:
+    CPUBlockLists() : lists_(kNumClasses) {}
+
+    void* Pop(int class_index) {
+        std::vector<void*>& list = lists_[class_index];
+        if (list.empty()) {
+            return nullptr;
+        }
+        void* base = list.back();
+        list.pop_back();
+        byte_size_ -= ClassSize(class_index);
+        return base;
+    }
+
+    bool Push(void* base, int class_index, size_t max_byte_size) {
+        const size_t class_size = ClassSize(class_index);
+        if (byte_size_ + class_size > max_byte_size) {
+            return false;
+        }
+        lists_[class_index].push_back(base);
+        byte_size_ += class_size;
+        return true;
+    }
+
+    /// Moves out all blocks.
+    std::vector<void*> TakeAll() {
+        std::vector<void*> bases;
+        for (std::vector<void*>& list : lists_) {
+            bases.insert(bases.end(), list.begin(), list.end());
+            list.clear();
+        }
+        byte_size_ = 0;
+        return bases;
+    }
+
+    size_t ByteSize() const { return byte_size_; }
+
+private:
+    std::vector<std::vector<void*>> lists_;
+    size_t byte_size_ = 0;
+};
+
+class CPUThreadCache;
+
+/// Process-wide cache and registry of the thread caches. Never destroyed, so
+/// that blocks can be freed by static tensors and exiting threads at any
+/// point of the program end.
+class CPUCacher {
+public:
+    static CPUCacher& GetInstance() {
+        static CPUCacher* instance = new CPUCacher();
+        return *instance;
+    }
+
+    CPUCacher(const CPUCacher&) = delete;
+    CPUCacher& operator=(const CPUCacher&) = delete;
+
+    void* Pop(int class_index) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        void* base = blocks_.Pop(class_index);
+        if (base) {
+            total_byte_size_ -= ClassSize(class_index);
+        }
+        return base;
+    }
+
+    bool Push(void* base, int class_index) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!blocks_.Push(base, class_index, max_byte_size_)) {
+            return false;
+        }
+        total_byte_size_ += ClassSize(class_index);
+        return true;
+    }
+
+    void* DirectMalloc(size_t byte_size) {
+        void* base = nullptr;
+        try {
+            base = direct_mm_.Malloc(byte_size, Device("CPU:0"));
+        } catch (const std::runtime_error&) {
+            // Free cached memory and try again, without catching the error
+            // if the allocation still fails.
+            Release();
+            base = direct_mm_.Malloc(byte_size, Device("CPU:0"));
+        }
+        AdviseHugePages(base, byte_size);
+        return base;
+    }
+
+    void DirectFree(void* base) { direct_mm_.Free(base, Device("CPU:0")); }
+
+    void DirectFree(const std::vector<void*>& bases) {
+        for (void* base : bases) {
+            DirectFree(base);
+        }
+    }
+
+    void Release();
+
+    void Register(CPUThreadCache* cache) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        thread_caches_.insert(cache);
+    }
+
+    void Unregister(CPUThreadCache* cache) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        thread_caches_.erase(cache);
+    }
+
+    void SetMaxByteSize(size_t byte_size) {
+        std::vector<void*> bases;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            max_byte_size_ = byte_size;
+            if (blocks_.ByteSize() > max_byte_size_) {
+                total_byte_size_ -= blocks_.ByteSize();
+                bases = blocks_.TakeAll();
+            }
+        }
+        DirectFree(bases);
+    }
+
+    /// Bytes in the process-wide and the thread caches.
+    std::atomic<size_t> total_byte_size_{0};
+
+private:
+    CPUCacher() = default;
+
+    /// Transparent huge pages only back 2 MiB aligned ranges, so the advice
+    /// covers the aligned interior of the block.
+    static void AdviseHugePages(void* base, size_t byte_size) {
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+        if (byte_size < kHugePageSize) {
+            return;
+        }
+        const uintptr_t begin =
+                (reinterpret_cast<uintptr_t>(base) + kHugePageSize - 1) /
+                kHugePageSize * kHugePageSize;
+        const uintptr_t end =
+                (reinterpret_cast<uintptr_t>(base) + byte_size) /
+                kHugePageSize * kHugePageSize;
+        if (end > begin) {
+            madvise(reinterpret_cast<void*>(begin), end - begin,
+                    MADV_HUGEPAGE);
+        }
+#endif
+    }
+
+    CPUMemoryManager direct_mm_;
+    std::mutex mutex_;
+    CPUBlockLists blocks_;
+    size_t max_byte_size_ = size_t(1) << 30;
+    std::unordered_set<CPUThreadCache*> thread_caches_;
+};
+
+/// Blocks of at most kMaxLocalClassSize freed by this thread. The mutex is
+/// only contended by CPUCacher::Release().
+class CPUThreadCache {
+public:
+    CPUThreadCache() { CPUCacher::GetInstance().Register(this); }
+
+    ~CPUThreadCache() {
+        CPUCacher& cacher = CPUCacher::GetInstance();
+        cacher.Unregister(this);
+        // Hands the blocks over to the process-wide cache, since tensors
+        // often outlive the threads that freed them.
+        std::vector<std::pair<void*, int>> blocks;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            for (int class_index = 0; class_index < kNumClasses;
+                 ++class_index) {
+                while (void* base = blocks_.Pop(class_index)) {
+                    blocks.emplace_back(base, class_index);
+                }
+            }
+        }
+        for (const auto& block : blocks) {
+            cacher.total_byte_size_ -= ClassSize(block.second);
+            if (!cacher.Push(block.first, block.second)) {
+                cacher.DirectFree(block.first);
+            }
+        }
+    }
+
+    void* Pop(int class_index) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        void* base = blocks_.Pop(class_index);
+        if (base) {
+            CPUCacher::GetInstance().total_byte_size_ -= ClassSize(class_index);
+        }
+        return base;
+    }
+
+    bool Push(void* base, int class_index) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!blocks_.Push(base, class_index, kMaxLocalCacheSize)) {
+            return false;
+        }
+        CPUCacher::GetInstance().total_byte_size_ += ClassSize(class_index);
+        return true;
+    }
+
+    /// Moves out all blocks.
+    std::vector<void*> TakeAll() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        CPUCacher::GetInstance().total_byte_size_ -= blocks_.ByteSize();
+        return blocks_.TakeAll();
+    }
+
+private:
+    std::mutex mutex_;
+    CPUBlockLists blocks_;
+};
+
+void CPUCacher::Release() {
+    std::vector<void*> bases;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        total_byte_size_ -= blocks_.ByteSize();
+        bases = blocks_.TakeAll();
+        for (CPUThreadCache* cache : thread_caches_) {
+            std::vector<void*> thread_bases = cache->TakeAll();
+            bases.insert(bases.end(), thread_bases.begin(),
+                         thread_bases.end());
+        }
+    }
+    DirectFree(bases);
+}
+
+/// Stays valid after the thread cache is destroyed, so that frees from later
+/// thread-local destructors bypass it.
+static thread_local bool g_thread_cache_destroyed = false;
+
+struct CPUThreadCacheHolder {
+    ~CPUThreadCacheHolder() { g_thread_cache_destroyed = true; }
+    CPUThreadCache cache_;
+};
+
+static CPUThreadCache* GetThreadCache() {
+    if (g_thread_cache_destroyed) {
+        return nullptr;
+    }
+    static thread_local CPUThreadCacheHolder holder;
+    return &holder.cache_;
+}
+
+void* CachedCPUMemoryManager::Malloc(size_t byte_size, const Device& device) {
+    if (byte_size == 0) {
+        return nullptr;
+    }
+
+    CPUCacher& cacher = CPUCacher::GetInstance();
+    void* base = nullptr;
+    int class_index = -1;
+    if (byte_size <= kMaxCachedSize) {
+        class_index = ClassIndex(byte_size);
+        byte_size = ClassSize(class_index);
+        if (byte_size <= kMaxLocalClassSize) {
+            if (CPUThreadCache* cache = GetThreadCache()) {
+                base = cache->Pop(class_index);
+            }
+        }
+        if (!base) {
+            base = cacher.Pop(class_index);
+        }
+    }
+    if (!base) {
+        base = cacher.DirectMalloc(kHeaderSize + byte_size);
+        CPUBlockHeader* header = static_cast<CPUBlockHeader*>(base);
+        header->byte_size_ = byte_size;
+        header->class_index_ = class_index;
+    }
+    return static_cast<char*>(base) + kHeaderSize;
+}
+
+void CachedCPUMemoryManager::Free(void* ptr, const Device& device) {
+    if (ptr == nullptr) {
+        return;
+    }
+
+    void* base = static_cast<char*>(ptr) - kHeaderSize;
+    const CPUBlockHeader* header = static_cast<const CPUBlockHeader*>(base);
+    const int class_index = header->class_index_;
+    CPUCacher& cacher = CPUCacher::GetInstance();
+    if (class_index >= 0) {
+        if (header->byte_size_ <= kMaxLocalClassSize) {
+            CPUThreadCache* cache = GetThreadCache();
+            if (cache && cache->Push(base, class_index)) {
+                return;
+            }
+        }
+        if (cacher.Push(base, class_index)) {
+            return;
+        }
+    }
+    cacher.DirectFree(base);
+}
+
+void CachedCPUMemoryManager::Memcpy(void* dst_ptr,
+                                    const Device& dst_device,
+                                    const void* src_ptr,
+                                    const Device& src_device,
+                                    size_t num_bytes) {
+    CPUMemoryManager().Memcpy(dst_ptr, dst_device, src_ptr, src_device,
+                              num_bytes);
+}
+
+void CachedCPUMemoryManager::ReleaseCache() {
+    CPUCacher::GetInstance().Release();
+}
+
+void CachedCPUMemoryManager::SetMaxCacheSize(size_t byte_size) {
+    CPUCacher::GetInstance().SetMaxByteSize(byte_size);
+}
+
+size_t CachedCPUMemoryManager::GetCacheSize() {
+    return CPUCacher::GetInstance().total_byte_size_;
+}
+
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,267 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+
+#include "open3d/core/MemoryManager.h"
+#include "open3d/utility/Logging.h"
+
+#ifdef BUILD_CUDA_MODULE
+#include <cuda_runtime.h>
+
+#include "open3d/core/CUDAUtils.h"
+#endif
+
+namespace open3d {
+namespace core {
+
+struct PinnedBlock {
+    size_t byte_size_ = 0;
+
+    /// False if the block fell back to pageable memory.
+    bool is_pinned_ = false;
+
+#ifdef BUILD_CUDA_MODULE
+    /// Recorded on the current stream when the block is freed. Reuse waits for
+    /// it so that pending asynchronous copies have finished.
+    cudaEvent_t event_ = nullptr;
+    int event_device_id_ = -1;
+#endif
+};
+
+/// Process-wide pool of host memory blocks sorted into exact-size buckets.
+/// Streaming workloads (e.g. RGB-D frames) allocate the same sizes over and
+/// over again, so a simple free list per size yields a high hit rate.
+class PinnedMemoryPool {
+public:
+    static PinnedMemoryPool& GetInstance() {
+        static PinnedMemoryPool instance;
+        return instance;
+    }
+
+    PinnedMemoryPool(const PinnedMemoryPool&) = delete;
+    PinnedMemoryPool& operator=(const PinnedMemoryPool&) = delete;
+
+    ~PinnedMemoryPool() {
+        // The CUDA runtime may already be shut down at program end, so errors
+        // are ignored here.
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (auto& kv : free_blocks_) {
+            DirectFree(kv.second.first, kv.second.second, /*check=*/false);
+        }
+        free_blocks_.clear();
+    }
+
+    void* Malloc(size_t byte_size) {
+        if (byte_size == 0) {
+            return nullptr;
+        }
+        byte_size = AlignByteSize(byte_size);
+
+        std::pair<void*, PinnedBlock> entry(nullptr, PinnedBlock());
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            auto it = free_blocks_.find(byte_size);
+            if (it != free_blocks_.end()) {
+                entry = it->second;
+                free_blocks_.erase(it);
+                allocated_blocks_.emplace(entry.first, entry.second);
+            }
+        }
+
+        if (entry.first != nullptr) {
+#ifdef BUILD_CUDA_MODULE
+            if (entry.second.event_ != nullptr) {
+                OPEN3D_CUDA_CHECK(cudaEventSynchronize(entry.second.event_));
+            }
+#endif
+            return entry.first;
+        }
+
+        PinnedBlock block;
+        block.byte_size_ = byte_size;
+        void* ptr = DirectMalloc(block);
+        std::lock_guard<std::mutex> lock(mutex_);
+        allocated_blocks_.emplace(ptr, block);
+        return ptr;
+    }
+
+    void Free(void* ptr) {
+        if (ptr == nullptr) {
+            return;
+        }
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = allocated_blocks_.find(ptr);
+        if (it == allocated_blocks_.end()) {
+            utility::LogError("Pointer {} was not allocated by the pinned "
+                              "memory manager.",
+                              fmt::ptr(ptr));
+        }
+        PinnedBlock block = it->second;
+        allocated_blocks_.erase(it);
+
+#ifdef BUILD_CUDA_MODULE
+        if (block.is_pinned_) {
+            // Events belong to a device, so re-create the event if the current
+            // device changed since the last free.
+            const int device_id = cuda::GetDevice();
+            if (block.event_ != nullptr &&
+                block.event_device_id_ != device_id) {
+                OPEN3D_CUDA_CHECK(cudaEventDestroy(block.event_));
+                block.event_ = nullptr;
+            }
+            if (block.event_ == nullptr) {
+                OPEN3D_CUDA_CHECK(cudaEventCreateWithFlags(
+                        &block.event_, cudaEventDisableTiming));
+                block.event_device_id_ = device_id;
+            }
+            OPEN3D_CUDA_CHECK(cudaEventRecord(block.event_, cuda::GetStream()));
+        }
+#endif
+        free_blocks_.emplace(block.byte_size_, std::make_pair(ptr, block));
+    }
+
+    void ReleaseCache() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (auto& kv : free_blocks_) {
+            DirectFree(kv.second.first, kv.second.second, /*check=*/true);
+        }
+        free_blocks_.clear();
+    }
+
+private:
+    PinnedMemoryPool() = default;
+
+    /// Pinned memory is page-locked, so round up to whole pages to improve the
+    /// hit rate of the size buckets.
+    static size_t AlignByteSize(size_t byte_size, size_t alignment = 4096) {
+        return ((byte_size + alignment - 1) / alignment) * alignment;
+    }
+
+    void* DirectMalloc(PinnedBlock& block) {
+        void* ptr = nullptr;
+#ifdef BUILD_CUDA_MODULE
+        if (cuda::IsAvailable()) {
+            cudaError_t err = cudaHostAlloc(&ptr, block.byte_size_,
+                                            cudaHostAllocPortable);
+            if (err == cudaErrorMemoryAllocation) {
+                // Clear the error and retry once with an empty pool.
+                cudaGetLastError();
+                ReleaseCache();
+                err = cudaHostAlloc(&ptr, block.byte_size_,
+                                    cudaHostAllocPortable);
+            }
+            OPEN3D_CUDA_CHECK(err);
+            block.is_pinned_ = true;
+            return ptr;
+        }
+#endif
+        ptr = std::malloc(block.byte_size_);
+        if (!ptr) {
+            utility::LogError("Pinned memory fallback malloc failed");
+        }
+        block.is_pinned_ = false;
+        return ptr;
+    }
+
+    static void DirectFree(void* ptr, const PinnedBlock& block, bool check) {
+#ifdef BUILD_CUDA_MODULE
+        if (block.is_pinned_) {
+            if (check) {
+                if (block.event_ != nullptr) {
+                    OPEN3D_CUDA_CHECK(cudaEventSynchronize(block.event_));
+                    OPEN3D_CUDA_CHECK(cudaEventDestroy(block.event_));
+                }
+                OPEN3D_CUDA_CHECK(cudaFreeHost(ptr));
+            } else {
+                if (block.event_ != nullptr) {
+                    cudaEventDestroy(block.event_);
+                }
+                cudaFreeHost(ptr);
+            }
+            return;
+        }
+#endif
+        std::free(ptr);
+    }
+
+    std::mutex mutex_;
+    std::unordered_map<void*, PinnedBlock> allocated_blocks_;
+    std::unordered_multimap<size_t, std::pair<void*, PinnedBlock>>
+            free_blocks_;
+};
+
+void* PinnedMemoryManager::Malloc(size_t byte_size, const Device& device) {
+    if (device.GetType() != Device::DeviceType::CPU) {
+        utility::LogError("PinnedMemoryManager::Malloc: Unimplemented device.");
+    }
+    return PinnedMemoryPool::GetInstance().Malloc(byte_size);
+}
+
+void PinnedMemoryManager::Free(void* ptr, const Device& device) {
+    if (device.GetType() != Device::DeviceType::CPU) {
+        utility::LogError("PinnedMemoryManager::Free: Unimplemented device.");
+    }
+    PinnedMemoryPool::GetInstance().Free(ptr);
+}
+
+void PinnedMemoryManager::Memcpy(void* dst_ptr,
+                                 const Device& dst_device,
+                                 const void* src_ptr,
+                                 const Device& src_device,
+                                 size_t num_bytes) {
+    std::memcpy(dst_ptr, src_ptr, num_bytes);
+}
+
+bool PinnedMemoryManager::IsPinned(const void* ptr) {
+#ifdef BUILD_CUDA_MODULE
+    if (ptr == nullptr || !cuda::IsAvailable()) {
+        return false;
+    }
+    cudaPointerAttributes attributes;
+    if (cudaPointerGetAttributes(&attributes, ptr) != cudaSuccess) {
+        // Older CUDA versions report an error for pageable host memory.
+        cudaGetLastError();
+        return false;
+    }
+    return attributes.type == cudaMemoryTypeHost;
+#else
+    return false;
+#endif
+}
+
+void PinnedMemoryManager::ReleaseCache() {
+    PinnedMemoryPool::GetInstance().ReleaseCache();
+}
+
+}  // namespace core
+}  // namespace open3d
@@ -29,12 +29,16 @@
 #include <algorithm>
 #include <cstdlib>
 #include <numeric>
+#include <vector>
 
 #include "open3d/utility/Logging.h"
 
 namespace open3d {
 namespace core {
 
+/// Tag paths of the calling thread, innermost last.
+static thread_local std::vector<std::string> tag_stack;
+
 MemoryManagerStatistic& MemoryManagerStatistic::GetInstance() {
     // Ensure the static Logger instance is instantiated before the
     // MemoryManagerStatistic instance.
@@ -120,6 +124,17 @@ void MemoryManagerStatistic::Print() const {
             utility::LogInfo("{}: {} {}", device.ToString(),
                              statistics.count_malloc_, statistics.count_free_);
         }
+        if (statistics.count_contiguous_copy_ > 0) {
+            utility::LogInfo("    {} implicit contiguous copies with {} bytes",
+                             statistics.count_contiguous_copy_,
+                             statistics.contiguous_copy_bytes_);
+        }
+        for (const auto& tag : statistics.tags_) {
+            utility::LogInfo(
+                    "    [{}] {} live, {} peak, {} at device peak bytes",
+                    tag.first, tag.second.live_bytes_, tag.second.peak_bytes_,
+                    tag.second.bytes_at_device_peak_);
+        }
     }
     utility::LogInfo("---------------------------------------------");
 
@@ -144,9 +159,28 @@ void MemoryManagerStatistic::CountMalloc(void* ptr,
         return;
     }
 
-    auto it = statistics_[device].active_allocations_.emplace(ptr, byte_size);
+    MemoryStatistics& statistics = statistics_[device];
+    auto it = statistics.active_allocations_.emplace(ptr, byte_size);
     if (it.second) {
-        statistics_[device].count_malloc_++;
+        statistics.count_malloc_++;
+        statistics.live_bytes_ += byte_size;
+
+        const std::string& tag = GetCurrentTag();
+        if (!tag.empty()) {
+            statistics.active_allocation_tags_.emplace(ptr, tag);
+            MemoryTagStatistic& tag_statistics = statistics.tags_[tag];
+            tag_statistics.count_malloc_++;
+            tag_statistics.live_bytes_ += byte_size;
+            tag_statistics.peak_bytes_ = std::max(tag_statistics.peak_bytes_,
+                                                  tag_statistics.live_bytes_);
+        }
+        if (statistics.live_bytes_ > statistics.peak_bytes_) {
+            statistics.peak_bytes_ = statistics.live_bytes_;
+            for (auto& tag_statistics : statistics.tags_) {
+                tag_statistics.second.bytes_at_device_peak_ =
+                        tag_statistics.second.live_bytes_;
+            }
+        }
         if (print_at_malloc_free_) {
             utility::LogInfo("[Malloc] {}: {} @ {} bytes",
                              fmt::sprintf("%6s", device.ToString()),
@@ -175,8 +209,21 @@ void MemoryManagerStatistic::CountFree(void* ptr, const Device& device) {
                              fmt::ptr(ptr),
                              statistics_[device].active_allocations_.at(ptr));
         }
-        statistics_[device].active_allocations_.erase(ptr);
-        statistics_[device].count_free_++;
+        MemoryStatistics& statistics = statistics_[device];
+        const size_t byte_size = statistics.active_allocations_.at(ptr);
+        statistics.live_bytes_ -= byte_size;
+
+        auto tag_it = statistics.active_allocation_tags_.find(ptr);
+        if (tag_it != statistics.active_allocation_tags_.end()) {
+            MemoryTagStatistic& tag_statistics =
+                    statistics.tags_.at(tag_it->second);
+            tag_statistics.count_free_++;
+            tag_statistics.live_bytes_ -= byte_size;
+            statistics.active_allocation_tags_.erase(tag_it);
+        }
+
+        statistics.active_allocations_.erase(ptr);
+        statistics.count_free_++;
     } else if (num_to_erase == 0) {
         // Either the statistics were reset before or the given pointer is
         // invalid. Do not increase any counts and ignore both cases.
@@ -188,11 +235,104 @@ void MemoryManagerStatistic::CountFree(void* ptr, const Device& device) {
     }
 }
 
+void MemoryManagerStatistic::CountContiguousCopy(size_t byte_size,
+                                                 const Device& device) {
+    std::lock_guard<std::mutex> lock(statistics_mutex_);
+    statistics_[device].count_contiguous_copy_++;
+    statistics_[device].contiguous_copy_bytes_ += byte_size;
+    if (print_at_malloc_free_) {
+        utility::LogInfo("[Contiguous] {}: {} bytes",
+                         fmt::sprintf("%6s", device.ToString()), byte_size);
+    }
+}
+
+int64_t MemoryManagerStatistic::GetContiguousCopyCount(
+        const Device& device) const {
+    std::lock_guard<std::mutex> lock(statistics_mutex_);
+    auto it = statistics_.find(device);
+    return it == statistics_.end() ? 0 : it->second.count_contiguous_copy_;
+}
+
+size_t MemoryManagerStatistic::GetContiguousCopyBytes(
+        const Device& device) const {
+    std::lock_guard<std::mutex> lock(statistics_mutex_);
+    auto it = statistics_.find(device);
+    return it == statistics_.end() ? 0 : it->second.contiguous_copy_bytes_;
+}
+
+int64_t MemoryManagerStatistic::GetMallocCount(const Device& device) const {
+    std::lock_guard<std::mutex> lock(statistics_mutex_);
+    auto it = statistics_.find(device);
+    return it == statistics_.end() ? 0 : it->second.count_malloc_;
+}
+
+size_t MemoryManagerStatistic::GetLiveBytes(const Device& device) const {
+    std::lock_guard<std::mutex> lock(statistics_mutex_);
+    auto it = statistics_.find(device);
+    return it == statistics_.end() ? 0 : it->second.live_bytes_;
+}
+
+size_t MemoryManagerStatistic::GetPeakBytes(const Device& device) const {
+    std::lock_guard<std::mutex> lock(statistics_mutex_);
+    auto it = statistics_.find(device);
+    return it == statistics_.end() ? 0 : it->second.peak_bytes_;
+}
+
+std::map<std::string, MemoryTagStatistic>
+MemoryManagerStatistic::GetTagStatistics(const Device& device) const {
+    std::lock_guard<std::mutex> lock(statistics_mutex_);
+    auto it = statistics_.find(device);
+    return it == statistics_.end() ? std::map<std::string, MemoryTagStatistic>()
+                                   : it->second.tags_;
+}
+
+void MemoryManagerStatistic::ResetPeakBytes() {
+    std::lock_guard<std::mutex> lock(statistics_mutex_);
+    for (auto& value_pair : statistics_) {
+        MemoryStatistics& statistics = value_pair.second;
+        statistics.peak_bytes_ = statistics.live_bytes_;
+        for (auto& tag_statistics : statistics.tags_) {
+            tag_statistics.second.peak_bytes_ =
+                    tag_statistics.second.live_bytes_;
+            tag_statistics.second.bytes_at_device_peak_ =
+                    tag_statistics.second.live_bytes_;
+        }
+    }
+}
+
 void MemoryManagerStatistic::Reset() {
     std::lock_guard<std::mutex> lock(statistics_mutex_);
     statistics_.clear();
 }
 
+void MemoryManagerStatistic::PushTag(const std::string& tag) {
+    if (tag.empty()) {
+        utility::LogError("Memory tag must not be empty.");
+    }
+    if (tag_stack.empty()) {
+        tag_stack.push_back(tag);
+        return;
+    }
+    // Re-entering the innermost tag, e.g. by recursion, keeps the path.
+    const std::string& parent = tag_stack.back();
+    const size_t pos = parent.rfind('/');
+    const std::string inner =
+            pos == std::string::npos ? parent : parent.substr(pos + 1);
+    tag_stack.push_back(inner == tag ? parent : parent + "/" + tag);
+}
+
+void MemoryManagerStatistic::PopTag() {
+    if (tag_stack.empty()) {
+        utility::LogError("No memory tag to pop.");
+    }
+    tag_stack.pop_back();
+}
+
+const std::string& MemoryManagerStatistic::GetCurrentTag() {
+    static const std::string untagged;
+    return tag_stack.empty() ? untagged : tag_stack.back();
+}
+
 bool MemoryManagerStatistic::MemoryStatistics::IsBalanced() const {
     return count_malloc_ == count_free_;
 }
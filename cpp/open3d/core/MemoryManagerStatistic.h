@@ -29,6 +29,7 @@
 #include <cstddef>
 #include <map>
 #include <mutex>
+#include <string>
 #include <unordered_map>
 
 #include "open3d/core/Device.h"
@@ -36,6 +37,18 @@
 namespace open3d {
 namespace core {
 
+/// Memory held by allocations of one tag on one device, see ScopedMemoryTag.
+struct MemoryTagStatistic {
+    /// Bytes currently allocated.
+    size_t live_bytes_ = 0;
+    /// Maximum of live_bytes_ since the last reset.
+    size_t peak_bytes_ = 0;
+    /// live_bytes_ at the time the device reached its peak.
+    size_t bytes_at_device_peak_ = 0;
+    int64_t count_malloc_ = 0;
+    int64_t count_free_ = 0;
+};
+
 class MemoryManagerStatistic {
 public:
     enum class PrintLevel {
@@ -81,9 +94,51 @@ public:
     /// consistency.
     void CountFree(void* ptr, const Device& device);
 
+    /// Adds an implicit copy of \p byte_size bytes by Tensor::Contiguous() to
+    /// the statistics. High counts point to kernels that copy strided inputs.
+    void CountContiguousCopy(size_t byte_size, const Device& device);
+
+    /// Returns the number of copies by Tensor::Contiguous() on \p device since
+    /// the last reset.
+    int64_t GetContiguousCopyCount(const Device& device) const;
+
+    /// Returns the total bytes copied by Tensor::Contiguous() on \p device
+    /// since the last reset.
+    size_t GetContiguousCopyBytes(const Device& device) const;
+
+    /// Returns the number of allocations on \p device since the last reset.
+    int64_t GetMallocCount(const Device& device) const;
+
+    /// Returns the bytes currently allocated on \p device.
+    size_t GetLiveBytes(const Device& device) const;
+
+    /// Returns the maximum of GetLiveBytes() on \p device since the last
+    /// reset.
+    size_t GetPeakBytes(const Device& device) const;
+
+    /// Returns the statistics of all tags that allocated on \p device, keyed
+    /// by the tag path of ScopedMemoryTag. Untagged allocations are not listed.
+    std::map<std::string, MemoryTagStatistic> GetTagStatistics(
+            const Device& device) const;
+
+    /// Restarts the peak tracking of all devices and tags at the current live
+    /// bytes.
+    void ResetPeakBytes();
+
     /// Resets the statistics.
     void Reset();
 
+    /// Enters the tag \p tag on the calling thread. Nested tags form a path,
+    /// e.g. "voxel_block_grid/hashmap", re-entering the innermost tag keeps
+    /// the path. Prefer ScopedMemoryTag.
+    static void PushTag(const std::string& tag);
+
+    /// Leaves the innermost tag of the calling thread.
+    static void PopTag();
+
+    /// Returns the tag path of the calling thread, empty if untagged.
+    static const std::string& GetCurrentTag();
+
 private:
     MemoryManagerStatistic() = default;
 
@@ -92,7 +147,14 @@ private:
 
         int64_t count_malloc_ = 0;
         int64_t count_free_ = 0;
+        int64_t count_contiguous_copy_ = 0;
+        size_t contiguous_copy_bytes_ = 0;
+        size_t live_bytes_ = 0;
+        size_t peak_bytes_ = 0;
         std::unordered_map<void*, size_t> active_allocations_;
+        /// Tag path of the active allocations made inside a tag scope.
+        std::unordered_map<void*, std::string> active_allocation_tags_;
+        std::map<std::string, MemoryTagStatistic> tags_;
     };
 
     /// Only print unbalanced statistics by default.
@@ -105,9 +167,26 @@ private:
     /// Print at each malloc and free, disabled by default.
     bool print_at_malloc_free_ = false;
 
-    std::mutex statistics_mutex_;
+    mutable std::mutex statistics_mutex_;
     std::map<Device, MemoryStatistics> statistics_;
 };
 
+/// \class ScopedMemoryTag
+///
+/// \brief Attributes the allocations of the calling thread within its scope to
+/// \p tag, e.g. "hashmap", "nns" or "voxel_block_grid". Nested tags form a
+/// path, so that the memory of a component can be broken down by its
+/// sub-components. Query the result with
+/// MemoryManagerStatistic::GetTagStatistics().
+class ScopedMemoryTag {
+public:
+    explicit ScopedMemoryTag(const std::string& tag) {
+        MemoryManagerStatistic::PushTag(tag);
+    }
+    ~ScopedMemoryTag() { MemoryManagerStatistic::PopTag(); }
+    ScopedMemoryTag(const ScopedMemoryTag&) = delete;
+    ScopedMemoryTag& operator=(const ScopedMemoryTag&) = delete;
+};
+
 }  // namespace core
 }  // namespace open3d
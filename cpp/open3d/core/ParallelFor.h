@@ -40,6 +40,11 @@
 #include <cuda_runtime.h>
 
 #include "open3d/core/CUDAUtils.h"
+#else
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+
+#include <algorithm>
 #endif
 
 namespace open3d {
@@ -104,6 +109,63 @@ void ParallelForCPU_(const Device& device, int64_t n, const func_t& func) {
     }
 }
 
+/// Run a function in parallel on CPU, compiled for each ISA of
+/// OPEN3D_TARGET_CLONES.
+template <typename func_t>
+OPEN3D_TARGET_CLONES void ParallelForMultiISACPU_(const Device& device,
+                                                  int64_t n,
+                                                  const func_t& func) {
+    if (device.GetType() != Device::DeviceType::CPU) {
+        utility::LogError("ParallelFor for CPU cannot run on device {}.",
+                          device.ToString());
+    }
+    if (n == 0) {
+        return;
+    }
+
+#pragma omp parallel for num_threads(utility::EstimateMaxThreads())
+    for (int64_t i = 0; i < n; ++i) {
+        func(i);
+    }
+}
+
+/// Run a function in parallel on CPU with work stealing. Chunks of at least
+/// \p grain_size consecutive work items are distributed dynamically, so idle
+/// threads take over work from busy ones.
+template <typename func_t>
+void ParallelForCPU_(const Device& device,
+                     int64_t n,
+                     int64_t grain_size,
+                     const func_t& func) {
+    if (device.GetType() != Device::DeviceType::CPU) {
+        utility::LogError("ParallelFor for CPU cannot run on device {}.",
+                          device.ToString());
+    }
+    if (n == 0) {
+        return;
+    }
+
+    // Nested calls, e.g. from an OpenMP region, run serially.
+    if (utility::InParallel()) {
+        for (int64_t i = 0; i < n; ++i) {
+            func(i);
+        }
+        return;
+    }
+
+    utility::ExecuteInArena([&]() {
+        tbb::parallel_for(
+                tbb::blocked_range<int64_t>(0, n,
+                                            std::max<int64_t>(grain_size, 1)),
+                [&](const tbb::blocked_range<int64_t>& range) {
+                    utility::ScopedParallelRegion region;
+                    for (int64_t i = range.begin(); i < range.end(); ++i) {
+                        func(i);
+                    }
+                });
+    });
+}
+
 #endif
 
 /// Run a function in parallel on CPU or CUDA.
@@ -114,7 +176,7 @@ void ParallelForCPU_(const Device& device, int64_t n, const func_t& func) {
 /// take an int64_t workload index and returns void, i.e., `void func(int64_t)`.
 ///
 /// \note This is optimized for uniform work items, i.e. where each call to \p
-/// func takes the same time.
+/// func takes the same time. Use the overload with grain size otherwise.
 /// \note If you use a lambda function, capture only the required variables
 /// instead of all to prevent accidental race conditions. If you want the
 /// kernel to be used on both CPU and CUDA, capture the variables by value.
@@ -127,6 +189,48 @@ void ParallelFor(const Device& device, int64_t n, const func_t& func) {
 #endif
 }
 
+/// Run a function with non-uniform work items in parallel on CPU or CUDA.
+///
+/// \param device The device for the parallel for loop to run on.
+/// \param n The number of workloads.
+/// \param grain_size The minimum number of consecutive workloads processed as
+/// one task on the CPU. Larger values reduce the scheduling overhead, smaller
+/// values improve the load balance. Ignored on CUDA.
+/// \param func The function to be executed in parallel. The function should
+/// take an int64_t workload index and returns void, i.e., `void func(int64_t)`.
+///
+/// \note Unlike ParallelFor without grain size, the CPU version uses a
+/// work-stealing scheduler and is suited for work items with very different
+/// costs, e.g. rays of different lengths.
+/// \note If you use a lambda function, capture only the required variables
+/// instead of all to prevent accidental race conditions. If you want the
+/// kernel to be used on both CPU and CUDA, capture the variables by value.
+template <typename func_t>
+void ParallelFor(const Device& device,
+                 int64_t n,
+                 int64_t grain_size,
+                 const func_t& func) {
+#ifdef __CUDACC__
+    ParallelForCUDA_(device, n, func);
+#else
+    ParallelForCPU_(device, n, grain_size, func);
+#endif
+}
+
+/// Run a function with uniform work items in parallel on CPU or CUDA, like
+/// ParallelFor, with the CPU loop compiled for AVX-512, AVX2 and the baseline
+/// ISA and the variant for the running CPU selected at runtime, see
+/// OPEN3D_TARGET_CLONES. Use this for compute-bound kernels that are not
+/// written in ISPC, since every use adds the code of three variants.
+template <typename func_t>
+void ParallelForMultiISA(const Device& device, int64_t n, const func_t& func) {
+#ifdef __CUDACC__
+    ParallelForCUDA_(device, n, func);
+#else
+    ParallelForMultiISACPU_(device, n, func);
+#endif
+}
+
 /// Run a potentially vectorized function in parallel on CPU or CUDA.
 ///
 /// \param device The device for the parallel for loop to run on.
@@ -173,7 +277,10 @@ void ParallelFor(const Device& device, int64_t n, const func_t& func) {
 ///                          float* uniform,
 ///                          uniform float)
 /// \endcode
-template <typename vec_func_t, typename func_t>
+template <typename vec_func_t,
+          typename func_t,
+          typename std::enable_if<!std::is_integral<func_t>::value,
+                                  int>::type = 0>
 void ParallelFor(const Device& device,
                  int64_t n,
                  const func_t& func,
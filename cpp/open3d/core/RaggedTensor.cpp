@@ -0,0 +1,189 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/core/RaggedTensor.h"
+
+#include "open3d/core/Dispatch.h"
+#include "open3d/core/TensorCheck.h"
+#include "open3d/core/TensorFunction.h"
+#include "open3d/core/kernel/Ragged.h"
+#include "open3d/core/kernel/Segment.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace core {
+
+/// Returns the row splits of rows with the Int64 \p row_lengths.
+static Tensor RowLengthsToRowSplits(const Tensor& row_lengths) {
+    const Tensor zero = Tensor::Zeros({1}, Int64, row_lengths.GetDevice());
+    if (row_lengths.GetLength() == 0) {
+        return zero;
+    }
+    return core::Concatenate({zero, row_lengths.InclusivePrefixSum()});
+}
+
+RaggedTensor::RaggedTensor()
+    : RaggedTensor(Tensor::Empty({0}, Float32), Tensor::Zeros({1}, Int64)) {}
+
+RaggedTensor::RaggedTensor(const Tensor& values, const Tensor& row_splits)
+    : values_(values), row_splits_(row_splits) {
+    if (values_.NumDims() == 0) {
+        utility::LogError("values must have at least 1 dimension.");
+    }
+    kernel::AssertRowSplits(row_splits_, values_.GetLength(),
+                            values_.GetDevice());
+}
+
+RaggedTensor RaggedTensor::FromRowLengths(const Tensor& values,
+                                          const Tensor& row_lengths) {
+    AssertTensorDtypes(row_lengths, {Int32, Int64});
+    AssertTensorDevice(row_lengths, values.GetDevice());
+    AssertTensorShape(row_lengths, {utility::nullopt});
+    if (row_lengths.GetLength() > 0 &&
+        row_lengths.Min({0}).To(Int64).Item<int64_t>() < 0) {
+        utility::LogError("row_lengths must be non-negative.");
+    }
+    return RaggedTensor(values, RowLengthsToRowSplits(row_lengths.To(Int64)));
+}
+
+RaggedTensor RaggedTensor::FromTensors(const std::vector<Tensor>& rows) {
+    if (rows.empty()) {
+        utility::LogError("Empty input tensors cannot initialize a ragged "
+                          "tensor.");
+    }
+    std::vector<int64_t> row_splits = {0};
+    for (const Tensor& row : rows) {
+        if (row.NumDims() == 0) {
+            utility::LogError("Rows must have at least 1 dimension.");
+        }
+        row_splits.push_back(row_splits.back() + row.GetLength());
+    }
+    const Tensor values =
+            rows.size() == 1 ? rows[0].Clone() : core::Concatenate(rows, 0);
+    return RaggedTensor(values, Tensor(row_splits, {int64_t(rows.size()) + 1},
+                                       Int64, values.GetDevice()));
+}
+
+RaggedTensor RaggedTensor::Concatenate(
+        const std::vector<RaggedTensor>& tensors) {
+    if (tensors.empty()) {
+        utility::LogError("Empty input ragged tensors cannot be "
+                          "concatenated.");
+    }
+    std::vector<Tensor> values, row_lengths;
+    for (const RaggedTensor& tensor : tensors) {
+        values.push_back(tensor.values_);
+        row_lengths.push_back(tensor.GetRowLengths());
+    }
+    // Concatenate splits a single tensor along its first dimension.
+    if (tensors.size() == 1) {
+        return RaggedTensor(values[0].Clone(), tensors[0].row_splits_.Clone());
+    }
+    return FromRowLengths(core::Concatenate(values, 0),
+                          core::Concatenate(row_lengths, 0));
+}
+
+Tensor RaggedTensor::GetRow(int64_t row) const {
+    row = shape_util::WrapDim(row, NumRows());
+    return values_.Slice(0, row_splits_[row].Item<int64_t>(),
+                         row_splits_[row + 1].Item<int64_t>());
+}
+
+RaggedTensor RaggedTensor::GatherRows(const Tensor& indices) const {
+    AssertTensorDtypes(indices, {Int32, Int64});
+    AssertTensorDevice(indices, GetDevice());
+    AssertTensorShape(indices, {utility::nullopt});
+    const Tensor indices_int64 = indices.To(Int64);
+    if (indices.GetLength() > 0 &&
+        (indices_int64.Min({0}).Item<int64_t>() < 0 ||
+         indices_int64.Max({0}).Item<int64_t>() >= NumRows())) {
+        utility::LogError("Row indices must be in [0, {}).", NumRows());
+    }
+
+    const Tensor dst_row_splits =
+            RowLengthsToRowSplits(GetRowLengths().IndexGet({indices_int64}));
+    SizeVector dst_shape = values_.GetShape();
+    dst_shape[0] = dst_row_splits[-1].Item<int64_t>();
+    Tensor dst_values(dst_shape, GetDtype(), GetDevice());
+    kernel::RaggedGather(values_, row_splits_, indices_int64, dst_row_splits,
+                         dst_values);
+    return RaggedTensor(dst_values, dst_row_splits);
+}
+
+Tensor RaggedTensor::Sum() const { return values_.SegmentSum(row_splits_); }
+
+Tensor RaggedTensor::Mean() const { return values_.SegmentMean(row_splits_); }
+
+Tensor RaggedTensor::Max() const { return values_.SegmentMax(row_splits_); }
+
+Tensor RaggedTensor::ArgMax() const {
+    return values_.SegmentArgMax(row_splits_);
+}
+
+Tensor RaggedTensor::ToDense(int64_t max_length, Scalar pad_value) const {
+    if (max_length < 0) {
+        max_length = NumRows() > 0
+                             ? GetRowLengths().Max({0}).Item<int64_t>()
+                             : 0;
+    }
+    const SizeVector element_shape = GetElementShape();
+    Tensor dst(shape_util::Concat({NumRows(), max_length}, element_shape),
+               GetDtype(), GetDevice());
+    Tensor default_value;
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(GetDtype(), [&]() {
+        default_value = Tensor::Full(element_shape, pad_value.To<scalar_t>(),
+                                     GetDtype(), GetDevice());
+    });
+    kernel::RaggedToDense(values_, row_splits_, default_value, dst);
+    return dst;
+}
+
+RaggedTensor RaggedTensor::To(const Device& device, bool copy) const {
+    return RaggedTensor(values_.To(device, copy), row_splits_.To(device, copy));
+}
+
+Tensor RaggedTensor::GetRowLengths() const {
+    const int64_t num_rows = NumRows();
+    return row_splits_.Slice(0, 1, num_rows + 1) -
+           row_splits_.Slice(0, 0, num_rows);
+}
+
+SizeVector RaggedTensor::GetElementShape() const {
+    const SizeVector shape = values_.GetShape();
+    return SizeVector(std::next(shape.begin()), shape.end());
+}
+
+std::string RaggedTensor::ToString() const {
+    return fmt::format(
+            "RaggedTensor[rows: {}, values: {}, element_shape: {}, dtype: {}, "
+            "device: {}]",
+            NumRows(), NumValues(), GetElementShape().ToString(),
+            GetDtype().ToString(), GetDevice().ToString());
+}
+
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,122 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "open3d/core/Device.h"
+#include "open3d/core/Dtype.h"
+#include "open3d/core/Scalar.h"
+#include "open3d/core/SizeVector.h"
+#include "open3d/core/Tensor.h"
+
+namespace open3d {
+namespace core {
+
+/// A batch of variable-length rows, e.g. the neighbors of each query point or
+/// the points of several clouds, stored as one values tensor and row splits.
+///
+/// Row r is values[row_splits[r]:row_splits[r + 1]].
+/// - values    : {N, ...}, any dtype
+/// - row_splits: {rows + 1}, Int64, non-decreasing from 0 to N
+///
+/// The reductions run over each row and return a {rows, ...} tensor.
+class RaggedTensor {
+public:
+    /// Constructs an empty Float32 ragged tensor with 0 rows on CPU.
+    RaggedTensor();
+
+    /// Constructs a ragged tensor from its buffers without a copy. The
+    /// row splits are checked.
+    RaggedTensor(const Tensor& values, const Tensor& row_splits);
+
+    /// Constructs a ragged tensor from \p values and the Int32 or Int64
+    /// \p row_lengths of its rows.
+    static RaggedTensor FromRowLengths(const Tensor& values,
+                                       const Tensor& row_lengths);
+
+    /// Constructs a ragged tensor with one row per tensor of \p rows. The rows
+    /// must have the same element shape, dtype and device. Values are copied.
+    static RaggedTensor FromTensors(const std::vector<Tensor>& rows);
+
+    /// Returns the rows of all \p tensors in order. The tensors must have the
+    /// same element shape, dtype and device.
+    static RaggedTensor Concatenate(const std::vector<RaggedTensor>& tensors);
+
+    /// Returns row \p row as a view of the values.
+    Tensor GetRow(int64_t row) const;
+
+    /// Returns the rows \p indices (Int32 or Int64, {M}) as a new ragged tensor
+    /// with M rows. Rows can be repeated.
+    RaggedTensor GatherRows(const Tensor& indices) const;
+
+    /// Returns the {rows, ...} sum of each row. Empty rows are 0.
+    Tensor Sum() const;
+
+    /// Returns the {rows, ...} mean of each row. Only Float32 and Float64 are
+    /// supported. Empty rows are 0.
+    Tensor Mean() const;
+
+    /// Returns the {rows, ...} max of each row. Empty rows are 0.
+    Tensor Max() const;
+
+    /// Returns the Int64 index into the values of the max of each row. Empty
+    /// rows are -1.
+    Tensor ArgMax() const;
+
+    /// Returns the {rows, max_length, ...} dense tensor, with the rows padded
+    /// with \p pad_value or truncated to \p max_length. A negative
+    /// \p max_length uses the length of the longest row.
+    Tensor ToDense(int64_t max_length = -1, Scalar pad_value = 0) const;
+
+    /// Returns the ragged tensor on \p device. The buffers are shared if it
+    /// is already on \p device and \p copy is false.
+    RaggedTensor To(const Device& device, bool copy = false) const;
+
+    /// Returns the Int64 {rows} length of each row.
+    Tensor GetRowLengths() const;
+
+    int64_t NumRows() const { return row_splits_.GetLength() - 1; }
+    int64_t NumValues() const { return values_.GetLength(); }
+    SizeVector GetElementShape() const;
+    Device GetDevice() const { return values_.GetDevice(); }
+    Dtype GetDtype() const { return values_.GetDtype(); }
+
+    Tensor GetValues() const { return values_; }
+    Tensor GetRowSplits() const { return row_splits_; }
+
+    std::string ToString() const;
+
+private:
+    Tensor values_;
+    Tensor row_splits_;
+};
+
+}  // namespace core
+}  // namespace open3d
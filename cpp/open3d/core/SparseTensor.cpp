@@ -0,0 +1,196 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/core/SparseTensor.h"
+
+#include "open3d/core/TensorCheck.h"
+#include "open3d/core/kernel/Sparse.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace core {
+
+/// Checks that \p indices is a {nnz} integer index into a dimension of
+/// \p size and returns it as Int64.
+static Tensor CheckIndices(const Tensor& indices,
+                           int64_t nnz,
+                           int64_t size,
+                           const Device& device,
+                           const std::string& name) {
+    AssertTensorDtypes(indices, {Int32, Int64});
+    AssertTensorDevice(indices, device);
+    AssertTensorShape(indices, {nnz});
+    Tensor indices_int64 = indices.To(Int64);
+    if (nnz > 0 && (indices_int64.Min({0}).Item<int64_t>() < 0 ||
+                    indices_int64.Max({0}).Item<int64_t>() >= size)) {
+        utility::LogError("{} must be in [0, {}).", name, size);
+    }
+    return indices_int64;
+}
+
+SparseTensor::SparseTensor()
+    : SparseTensor(Tensor::Zeros({1}, Int64),
+                   Tensor::Empty({0}, Int64),
+                   Tensor::Empty({0}, Float32),
+                   {0, 0}) {}
+
+SparseTensor::SparseTensor(const Tensor& row_splits,
+                           const Tensor& col_indices,
+                           const Tensor& values,
+                           const SizeVector& shape)
+    : row_splits_(row_splits),
+      col_indices_(col_indices),
+      values_(values),
+      shape_(shape) {
+    if (shape_.size() != 2) {
+        utility::LogError("SparseTensor must be 2D, but got shape {}.",
+                          shape_.ToString());
+    }
+    if (values_.NumDims() != 1) {
+        utility::LogError("values must be 1D, but got shape {}.",
+                          values_.GetShape().ToString());
+    }
+    if (values_.GetDtype() == Bool) {
+        utility::LogError("SparseTensor does not support Bool values.");
+    }
+    const Device device = values_.GetDevice();
+    AssertTensorDtype(row_splits_, Int64);
+    AssertTensorDevice(row_splits_, device);
+    AssertTensorShape(row_splits_, {shape_[0] + 1});
+    AssertTensorDtype(col_indices_, Int64);
+    AssertTensorDevice(col_indices_, device);
+    AssertTensorShape(col_indices_, {values_.GetLength()});
+}
+
+SparseTensor SparseTensor::FromCOO(const Tensor& row_indices,
+                                   const Tensor& col_indices,
+                                   const Tensor& values,
+                                   const SizeVector& shape) {
+    if (shape.size() != 2) {
+        utility::LogError("SparseTensor must be 2D, but got shape {}.",
+                          shape.ToString());
+    }
+    if (values.NumDims() != 1) {
+        utility::LogError("values must be 1D, but got shape {}.",
+                          values.GetShape().ToString());
+    }
+    const Device device = values.GetDevice();
+    const int64_t nnz = values.GetLength();
+    const Tensor rows =
+            CheckIndices(row_indices, nnz, shape[0], device, "row_indices");
+    const Tensor cols =
+            CheckIndices(col_indices, nnz, shape[1], device, "col_indices");
+    if (nnz == 0) {
+        return SparseTensor(Tensor::Zeros({shape[0] + 1}, Int64, device),
+                            Tensor::Empty({0}, Int64, device), values, shape);
+    }
+
+    // Sort the entries by their row-major linear index and sum duplicates.
+    const Tensor keys = rows.Mul(shape[1]).Add_(cols);
+    const Tensor order = keys.ArgSort();
+    const Tensor sorted_keys = keys.IndexGet({order});
+    Tensor unique_keys, inverse, counts;
+    std::tie(unique_keys, inverse, counts) =
+            sorted_keys.UniqueWithInverseAndCounts();
+    Tensor csr_values = values.IndexGet({order});
+    const int64_t num_unique = unique_keys.GetLength();
+    if (num_unique < nnz) {
+        Tensor splits = Tensor::Zeros({num_unique + 1}, Int64, device);
+        splits.Slice(0, 1, num_unique + 1) = counts.InclusivePrefixSum();
+        csr_values = csr_values.SegmentSum(splits);
+    }
+
+    const Tensor csr_rows = unique_keys.Div(shape[1]);
+    Tensor row_splits;
+    kernel::CSRRowSplits(csr_rows, shape[0], row_splits);
+    return SparseTensor(row_splits, unique_keys.Sub_(csr_rows.Mul(shape[1])),
+                        csr_values, shape);
+}
+
+SparseTensor SparseTensor::FromDense(const Tensor& dense) {
+    AssertTensorShape(dense, {utility::nullopt, utility::nullopt});
+    // NonZero() returns the indices in row-major order.
+    const Tensor indices = dense.NonZero();
+    const Tensor rows = indices[0];
+    const Tensor cols = indices[1];
+    Tensor row_splits;
+    kernel::CSRRowSplits(rows, dense.GetShape(0), row_splits);
+    return SparseTensor(row_splits, cols.Clone(), dense.IndexGet({rows, cols}),
+                        dense.GetShape());
+}
+
+std::tuple<Tensor, Tensor, Tensor> SparseTensor::ToCOO() const {
+    Tensor rows;
+    kernel::CSRRowIndices(row_splits_, NumNonZeros(), rows);
+    return std::make_tuple(rows, col_indices_, values_);
+}
+
+Tensor SparseTensor::ToDense() const {
+    Tensor dense = Tensor::Zeros(shape_, GetDtype(), GetDevice());
+    if (NumNonZeros() > 0) {
+        Tensor rows;
+        kernel::CSRRowIndices(row_splits_, NumNonZeros(), rows);
+        dense.IndexSet({rows, col_indices_}, values_);
+    }
+    return dense;
+}
+
+SparseTensor SparseTensor::To(const Device& device, bool copy) const {
+    return SparseTensor(row_splits_.To(device, copy),
+                        col_indices_.To(device, copy),
+                        values_.To(device, copy), shape_);
+}
+
+SparseTensor SparseTensor::T() const {
+    Tensor rows, cols, values;
+    std::tie(rows, cols, values) = ToCOO();
+    return FromCOO(cols, rows, values, {shape_[1], shape_[0]});
+}
+
+Tensor SparseTensor::SpMV(const Tensor& x) const {
+    AssertTensorShape(x, {shape_[1]});
+    Tensor y = Tensor::Empty({shape_[0]}, GetDtype(), GetDevice());
+    kernel::CSRMatmul(row_splits_, col_indices_, values_, x, y);
+    return y;
+}
+
+Tensor SparseTensor::SpMM(const Tensor& B) const {
+    AssertTensorShape(B, {shape_[1], utility::nullopt});
+    Tensor C = Tensor::Empty({shape_[0], B.GetShape(1)}, GetDtype(),
+                             GetDevice());
+    kernel::CSRMatmul(row_splits_, col_indices_, values_, B, C);
+    return C;
+}
+
+std::string SparseTensor::ToString() const {
+    return fmt::format("SparseTensor[shape={}, nnz={}, {}, {}]",
+                       shape_.ToString(), NumNonZeros(), GetDtype().ToString(),
+                       GetDevice().ToString());
+}
+
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,119 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#pragma once
+
+#include <string>
+#include <tuple>
+
+#include "open3d/core/Device.h"
+#include "open3d/core/Dtype.h"
+#include "open3d/core/SizeVector.h"
+#include "open3d/core/Tensor.h"
+
+namespace open3d {
+namespace core {
+
+/// A 2D sparse matrix in compressed sparse row (CSR) format.
+///
+/// The entries of row r are values[row_splits[r]:row_splits[r + 1]] at the
+/// columns col_indices[row_splits[r]:row_splits[r + 1]], sorted by column.
+/// - row_splits : {rows + 1}, Int64
+/// - col_indices: {nnz}, Int64
+/// - values     : {nnz}, any non-boolean dtype
+///
+/// SpMV and SpMM run on cuSPARSE for Float32 and Float64 CUDA matrices.
+class SparseTensor {
+public:
+    /// Constructs an empty 0 x 0 Float32 matrix on CPU.
+    SparseTensor();
+
+    /// Constructs a matrix from CSR buffers. The buffers are used without a
+    /// copy; their shapes and dtypes are checked, the column order is not.
+    SparseTensor(const Tensor& row_splits,
+                 const Tensor& col_indices,
+                 const Tensor& values,
+                 const SizeVector& shape);
+
+    /// Constructs a {rows, cols} matrix from coordinate (COO) triplets in any
+    /// order. Entries with the same row and column are summed.
+    ///
+    /// \param row_indices {nnz} Int32 or Int64 row index of each entry.
+    /// \param col_indices {nnz} Int32 or Int64 column index of each entry.
+    /// \param values {nnz} value of each entry.
+    /// \param shape {rows, cols} shape of the matrix.
+    static SparseTensor FromCOO(const Tensor& row_indices,
+                                const Tensor& col_indices,
+                                const Tensor& values,
+                                const SizeVector& shape);
+
+    /// Constructs a matrix from the non-zero entries of the 2D \p dense.
+    static SparseTensor FromDense(const Tensor& dense);
+
+    /// Returns the (row_indices, col_indices, values) COO triplets in row-major
+    /// order.
+    std::tuple<Tensor, Tensor, Tensor> ToCOO() const;
+
+    /// Returns the matrix as a dense {rows, cols} tensor.
+    Tensor ToDense() const;
+
+    /// Returns the matrix on \p device. The buffers are shared if the matrix
+    /// is already on \p device and \p copy is false.
+    SparseTensor To(const Device& device, bool copy = false) const;
+
+    /// Returns the transposed {cols, rows} matrix.
+    SparseTensor T() const;
+
+    /// Sparse matrix-vector product: returns the {rows} tensor A x for the
+    /// {cols} tensor \p x.
+    Tensor SpMV(const Tensor& x) const;
+
+    /// Sparse-dense matrix product: returns the {rows, k} tensor A B for the
+    /// {cols, k} tensor \p B.
+    Tensor SpMM(const Tensor& B) const;
+
+    SizeVector GetShape() const { return shape_; }
+    int64_t GetShape(int64_t dim) const { return shape_[dim]; }
+    int64_t NumNonZeros() const { return values_.GetLength(); }
+    Device GetDevice() const { return values_.GetDevice(); }
+    Dtype GetDtype() const { return values_.GetDtype(); }
+
+    Tensor GetRowSplits() const { return row_splits_; }
+    Tensor GetColIndices() const { return col_indices_; }
+    Tensor GetValues() const { return values_; }
+
+    std::string ToString() const;
+
+private:
+    Tensor row_splits_;
+    Tensor col_indices_;
+    Tensor values_;
+    SizeVector shape_;
+};
+
+}  // namespace core
+}  // namespace open3d
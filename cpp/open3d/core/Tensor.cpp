@@ -35,6 +35,10 @@
 #include "open3d/core/Device.h"
 #include "open3d/core/Dispatch.h"
 #include "open3d/core/Dtype.h"
+#include "open3d/core/Future.h"
+#include "open3d/core/LazyTensor.h"
+#include "open3d/core/MemoryManager.h"
+#include "open3d/core/MemoryManagerStatistic.h"
 #include "open3d/core/ShapeUtil.h"
 #include "open3d/core/SizeVector.h"
 #include "open3d/core/TensorCheck.h"
@@ -59,6 +63,8 @@ namespace core {
 static DLDataTypeCode DtypeToDLDataTypeCode(const Dtype& dtype) {
     if (dtype == core::Float32) return DLDataTypeCode::kDLFloat;
     if (dtype == core::Float64) return DLDataTypeCode::kDLFloat;
+    if (dtype == core::Float16) return DLDataTypeCode::kDLFloat;
+    if (dtype == core::BFloat16) return DLDataTypeCode::kDLBfloat;
     if (dtype == core::Int8) return DLDataTypeCode::kDLInt;
     if (dtype == core::Int16) return DLDataTypeCode::kDLInt;
     if (dtype == core::Int32) return DLDataTypeCode::kDLInt;
@@ -109,6 +115,8 @@ static Dtype DLDataTypeToDtype(const DLDataType& dltype) {
             break;
         case DLDataTypeCode::kDLFloat:
             switch (dltype.bits) {
+                case 16:
+                    return core::Float16;
                 case 32:
                     return core::Float32;
                 case 64:
@@ -118,6 +126,12 @@ static Dtype DLDataTypeToDtype(const DLDataType& dltype) {
                                       dltype.bits);
             }
             break;
+        case DLDataTypeCode::kDLBfloat:
+            if (dltype.bits == 16) {
+                return core::BFloat16;
+            }
+            utility::LogError("Unsupported kDLBfloat bits {}", dltype.bits);
+            break;
         default:
             utility::LogError("Unsupported dtype code {}", dltype.code);
     }
@@ -377,6 +391,16 @@ Tensor Tensor::Empty(const SizeVector& shape,
     return Tensor(shape, dtype, device);
 }
 
+Tensor Tensor::EmptyPinned(const SizeVector& shape, Dtype dtype) {
+    const Device host("CPU:0");
+    const size_t byte_size = shape.NumElements() * dtype.ByteSize();
+    void* ptr = PinnedMemoryManager().Malloc(byte_size, host);
+    auto blob = std::make_shared<Blob>(host, ptr, [ptr](void*) {
+        PinnedMemoryManager().Free(ptr, Device("CPU:0"));
+    });
+    return Tensor(shape, shape_util::DefaultStrides(shape), ptr, dtype, blob);
+}
+
 Tensor Tensor::Zeros(const SizeVector& shape,
                      Dtype dtype,
                      const Device& device) {
@@ -741,16 +765,65 @@ Tensor Tensor::To(const Device& device,
     return dst_tensor;
 }
 
+Future<Tensor> Tensor::ToAsync(const Device& device, bool copy) const {
+    if (!copy && GetDevice() == device) {
+        return Future<Tensor>(*this);
+    }
+    const Device& src_device = GetDevice();
+    if (src_device.GetType() != Device::DeviceType::CUDA &&
+        device.GetType() != Device::DeviceType::CUDA) {
+        return Future<Tensor>(To(device, /*copy=*/true));
+    }
+
+    const Tensor src = Contiguous();
+    Tensor dst = device.GetType() == Device::DeviceType::CPU
+                         ? EmptyPinned(shape_, dtype_)
+                         : Tensor(shape_, dtype_, device);
+    MemoryManager::MemcpyAsync(dst.GetDataPtr(), dst.GetDevice(),
+                               src.GetDataPtr(), src_device,
+                               NumElements() * dtype_.ByteSize());
+    // Copies from a CUDA device run on the stream of the source device.
+    return Future<Tensor>(
+            dst, StreamEvent::Record(
+                         src_device.GetType() == Device::DeviceType::CUDA
+                                 ? src_device
+                                 : device));
+}
+
 void Tensor::CopyFrom(const Tensor& other) { AsRvalue() = other; }
 
+Tensor Tensor::PinMemory() const {
+    AssertTensorDevice(*this, Device("CPU:0"));
+    if (IsPinned()) {
+        return *this;
+    }
+    Tensor dst = EmptyPinned(shape_, dtype_);
+    dst.CopyFrom(*this);
+    return dst;
+}
+
+bool Tensor::IsPinned() const {
+    return GetDevice().GetType() == Device::DeviceType::CPU &&
+           PinnedMemoryManager::IsPinned(data_ptr_);
+}
+
 Tensor Tensor::Contiguous() const {
     if (IsContiguous()) {
         return *this;
     } else {
+        MemoryManagerStatistic::GetInstance().CountContiguousCopy(
+                NumElements() * dtype_.ByteSize(), GetDevice());
         return To(GetDevice(), /*copy=*/true);
     }
 }
 
+Future<Tensor> Tensor::ContiguousAsync() const {
+    if (IsContiguous()) {
+        return Future<Tensor>(*this);
+    }
+    return Future<Tensor>(Contiguous(), StreamEvent::Record(GetDevice()));
+}
+
 std::string Tensor::ToString(bool with_suffix,
                              const std::string& indent) const {
     std::ostringstream rc;
@@ -802,6 +875,12 @@ std::string Tensor::ScalarPtrToString(const void* ptr) const {
         str = *static_cast<const unsigned char*>(ptr) ? "True" : "False";
     } else if (dtype_.IsObject()) {
         str = fmt::format("{}", fmt::ptr(ptr));
+    } else if (dtype_ == core::Float16) {
+        str = fmt::format("{}", static_cast<float>(
+                                        *static_cast<const float16_t*>(ptr)));
+    } else if (dtype_ == core::BFloat16) {
+        str = fmt::format("{}", static_cast<float>(
+                                        *static_cast<const bfloat16_t*>(ptr)));
     } else {
         DISPATCH_DTYPE_TO_TEMPLATE(dtype_, [&]() {
             str = fmt::format("{}", *static_cast<const scalar_t*>(ptr));
@@ -898,6 +977,25 @@ Tensor Tensor::IndexGet(const std::vector<Tensor>& index_tensors) const {
         }
     }
 
+    // A Bool mask over the leading dimensions selects rows of the flattened
+    // leading dimensions, compact them directly without computing NonZero.
+    if (index_tensors.size() == 1 &&
+        index_tensors[0].GetDtype() == core::Bool &&
+        index_tensors[0].GetDevice() == GetDevice() && IsContiguous()) {
+        const Tensor& mask = index_tensors[0];
+        const int64_t mask_dims = mask.NumDims();
+        if (mask_dims >= 1 && mask_dims <= NumDims() &&
+            SizeVector(shape_.begin(), shape_.begin() + mask_dims) ==
+                    mask.GetShape()) {
+            SizeVector row_shape(shape_.begin() + mask_dims, shape_.end());
+            SizeVector flat_shape = row_shape;
+            flat_shape.insert(flat_shape.begin(), mask.NumElements());
+            return kernel::MaskedIndexGet(
+                           {Reshape(flat_shape)},
+                           mask.Reshape({mask.NumElements()}))[0];
+        }
+    }
+
     AdvancedIndexPreprocessor aip(*this, index_tensors);
     Tensor dst = Tensor(aip.GetOutputShape(), dtype_, GetDevice());
 
@@ -948,9 +1046,9 @@ void Tensor::IndexSet(const std::vector<Tensor>& index_tensors,
                     src_tensor.NumElements());
         }
         if (index_tensors[0].IsNonZero()) {
-            DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(src_tensor.GetDtype(), [&]() {
-                AsRvalue() = src_tensor.Item<scalar_t>();
-            });
+            DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_HALF(
+                    src_tensor.GetDtype(),
+                    [&]() { AsRvalue() = src_tensor.Item<scalar_t>(); });
         }
         return;
     }
@@ -1043,7 +1141,7 @@ Tensor Tensor::Add(const Tensor& value) const {
 
 Tensor Tensor::Add(Scalar value) const {
     Tensor dst_tensor;
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dtype_, [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_HALF(dtype_, [&]() {
         dst_tensor = Add(
                 Tensor::Full({}, value.To<scalar_t>(), dtype_, GetDevice()));
     });
@@ -1059,7 +1157,7 @@ Tensor Tensor::Add_(const Tensor& value) {
 }
 
 Tensor Tensor::Add_(Scalar value) {
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dtype_, [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_HALF(dtype_, [&]() {
         Add_(Tensor::Full({}, value.To<scalar_t>(), dtype_, GetDevice()));
     });
     return *this;
@@ -1077,7 +1175,7 @@ Tensor Tensor::Sub(const Tensor& value) const {
 
 Tensor Tensor::Sub(Scalar value) const {
     Tensor dst_tensor;
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dtype_, [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_HALF(dtype_, [&]() {
         dst_tensor = Sub(
                 Tensor::Full({}, value.To<scalar_t>(), dtype_, GetDevice()));
     });
@@ -1093,7 +1191,7 @@ Tensor Tensor::Sub_(const Tensor& value) {
 }
 
 Tensor Tensor::Sub_(Scalar value) {
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dtype_, [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_HALF(dtype_, [&]() {
         Sub_(Tensor::Full({}, value.To<scalar_t>(), dtype_, GetDevice()));
     });
     return *this;
@@ -1111,7 +1209,7 @@ Tensor Tensor::Mul(const Tensor& value) const {
 
 Tensor Tensor::Mul(Scalar value) const {
     Tensor dst_tensor;
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dtype_, [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_HALF(dtype_, [&]() {
         dst_tensor = Mul(
                 Tensor::Full({}, value.To<scalar_t>(), dtype_, GetDevice()));
     });
@@ -1127,7 +1225,7 @@ Tensor Tensor::Mul_(const Tensor& value) {
 }
 
 Tensor Tensor::Mul_(Scalar value) {
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dtype_, [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_HALF(dtype_, [&]() {
         Mul_(Tensor::Full({}, value.To<scalar_t>(), dtype_, GetDevice()));
     });
     return *this;
@@ -1145,7 +1243,7 @@ Tensor Tensor::Div(const Tensor& value) const {
 
 Tensor Tensor::Div(Scalar value) const {
     Tensor dst_tensor;
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dtype_, [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_HALF(dtype_, [&]() {
         dst_tensor = Div(
                 Tensor::Full({}, value.To<scalar_t>(), dtype_, GetDevice()));
     });
@@ -1161,7 +1259,7 @@ Tensor Tensor::Div_(const Tensor& value) {
 }
 
 Tensor Tensor::Div_(Scalar value) {
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dtype_, [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_HALF(dtype_, [&]() {
         Div_(Tensor::Full({}, value.To<scalar_t>(), dtype_, GetDevice()));
     });
     return *this;
@@ -1223,6 +1321,148 @@ Tensor Tensor::ArgMax(const SizeVector& dims) const {
     return dst;
 }
 
+/// Output shape of a segment reduction of a tensor of \p shape.
+static SizeVector SegmentReductionShape(const SizeVector& shape,
+                                        const Tensor& row_splits) {
+    if (shape.size() == 0 || row_splits.NumDims() != 1 ||
+        row_splits.GetLength() == 0) {
+        utility::LogError(
+                "Segment reduction requires a tensor with at least 1 dimension "
+                "and row_splits of shape {{S + 1}}, but got {} and {}.",
+                shape.ToString(), row_splits.GetShape().ToString());
+    }
+    SizeVector dst_shape = shape;
+    dst_shape[0] = row_splits.GetLength() - 1;
+    return dst_shape;
+}
+
+Tensor Tensor::SegmentSum(const Tensor& row_splits) const {
+    Tensor dst(SegmentReductionShape(shape_, row_splits), dtype_, GetDevice());
+    kernel::SegmentReduction(*this, row_splits, dst,
+                             kernel::SegmentOpCode::Sum);
+    return dst;
+}
+
+Tensor Tensor::SegmentMean(const Tensor& row_splits) const {
+    AssertTensorDtypes(*this, {Float32, Float64});
+    Tensor dst(SegmentReductionShape(shape_, row_splits), dtype_, GetDevice());
+    kernel::SegmentReduction(*this, row_splits, dst,
+                             kernel::SegmentOpCode::Mean);
+    return dst;
+}
+
+Tensor Tensor::SegmentMax(const Tensor& row_splits) const {
+    Tensor dst(SegmentReductionShape(shape_, row_splits), dtype_, GetDevice());
+    kernel::SegmentReduction(*this, row_splits, dst,
+                             kernel::SegmentOpCode::Max);
+    return dst;
+}
+
+Tensor Tensor::SegmentArgMax(const Tensor& row_splits) const {
+    Tensor dst(SegmentReductionShape(shape_, row_splits), core::Int64,
+               GetDevice());
+    kernel::SegmentReduction(*this, row_splits, dst,
+                             kernel::SegmentOpCode::ArgMax);
+    return dst;
+}
+
+Tensor Tensor::Sort(bool descending) const {
+    Tensor sorted_keys(shape_, dtype_, GetDevice());
+    Tensor sorted_values(shape_, core::Int64, GetDevice());
+    kernel::SortPairs(*this, Tensor::Empty(shape_, core::Int64, GetDevice()),
+                      sorted_keys, sorted_values, descending);
+    return sorted_keys;
+}
+
+Tensor Tensor::ArgSort(bool descending) const {
+    Tensor sorted_keys(shape_, dtype_, GetDevice());
+    Tensor sorted_values(shape_, core::Int64, GetDevice());
+    kernel::SortPairs(*this,
+                      Tensor::Arange(0, GetLength(), 1, core::Int64,
+                                     GetDevice()),
+                      sorted_keys, sorted_values, descending);
+    return sorted_values;
+}
+
+Tensor Tensor::SegmentSort(const Tensor& row_splits, bool descending) const {
+    Tensor sorted_keys(shape_, dtype_, GetDevice());
+    Tensor sorted_values(shape_, core::Int64, GetDevice());
+    kernel::SegmentedSortPairs(
+            *this, Tensor::Empty(shape_, core::Int64, GetDevice()), row_splits,
+            sorted_keys, sorted_values, descending);
+    return sorted_keys;
+}
+
+Tensor Tensor::SegmentArgSort(const Tensor& row_splits,
+                              bool descending) const {
+    Tensor sorted_keys(shape_, dtype_, GetDevice());
+    Tensor sorted_values(shape_, core::Int64, GetDevice());
+    kernel::SegmentedSortPairs(
+            *this,
+            Tensor::Arange(0, GetLength(), 1, core::Int64, GetDevice()),
+            row_splits, sorted_keys, sorted_values, descending);
+    return sorted_values;
+}
+
+Tensor Tensor::Unique() const {
+    return std::get<0>(UniqueWithInverseAndCounts());
+}
+
+std::tuple<Tensor, Tensor, Tensor> Tensor::UniqueWithInverseAndCounts() const {
+    const Device device = GetDevice();
+    const int64_t n = GetLength();
+    Tensor sorted(shape_, dtype_, device);
+    Tensor order(shape_, core::Int64, device);
+    kernel::SortPairs(*this, Tensor::Arange(0, n, 1, core::Int64, device),
+                      sorted, order, /*descending=*/false);
+    if (n == 0) {
+        return std::make_tuple(sorted, order, order);
+    }
+
+    // Flag the first element of every run of equal elements.
+    Tensor is_first({n}, core::Bool, device);
+    is_first.Slice(0, 0, 1).Fill(true);
+    is_first.Slice(0, 1, n) =
+            sorted.Slice(0, 1, n).Ne(sorted.Slice(0, 0, n - 1));
+    const Tensor starts = is_first.NonZero()[0];
+    const int64_t num_unique = starts.GetLength();
+
+    Tensor inverse({n}, core::Int64, device);
+    inverse.IndexSet({order},
+                     is_first.To(core::Int64).InclusivePrefixSum() - 1);
+    const Tensor ends = Concatenate(
+            {starts.Slice(0, 1, num_unique),
+             Tensor::Init<int64_t>({n}, device)});
+    return std::make_tuple(sorted.IndexGet({starts}), inverse, ends - starts);
+}
+
+std::tuple<Tensor, Tensor> Tensor::TopK(int64_t k, bool largest) const {
+    if (k < 0 || k > GetLength()) {
+        utility::LogError("TopK: k must be in [0, {}], but got {}.",
+                          GetLength(), k);
+    }
+    Tensor sorted(shape_, dtype_, GetDevice());
+    Tensor order(shape_, core::Int64, GetDevice());
+    kernel::SortPairs(
+            *this, Tensor::Arange(0, GetLength(), 1, core::Int64, GetDevice()),
+            sorted, order, largest);
+    return std::make_tuple(sorted.Slice(0, 0, k), order.Slice(0, 0, k));
+}
+
+Tensor Tensor::InclusivePrefixSum() const {
+    Tensor dst(shape_, dtype_, GetDevice());
+    kernel::PrefixSum(*this, dst, /*exclusive=*/false);
+    return dst;
+}
+
+Tensor Tensor::ExclusivePrefixSum() const {
+    Tensor dst(shape_, dtype_, GetDevice());
+    kernel::PrefixSum(*this, dst, /*exclusive=*/true);
+    return dst;
+}
+
+LazyTensor Tensor::Lazy() const { return LazyTensor(*this); }
+
 Tensor Tensor::Sqrt() const {
     Tensor dst_tensor(shape_, dtype_, GetDevice());
     kernel::UnaryEW(*this, dst_tensor, kernel::UnaryEWOpCode::Sqrt);
@@ -1290,7 +1530,7 @@ Tensor Tensor::Abs_() {
 }
 
 Tensor Tensor::IsNan() const {
-    if (dtype_ == core::Float32 || dtype_ == core::Float64) {
+    if (dtype_.GetDtypeCode() == Dtype::DtypeCode::Float) {
         Tensor dst_tensor(shape_, core::Bool, GetDevice());
         kernel::UnaryEW(*this, dst_tensor, kernel::UnaryEWOpCode::IsNan);
         return dst_tensor;
@@ -1300,7 +1540,7 @@ Tensor Tensor::IsNan() const {
 }
 
 Tensor Tensor::IsInf() const {
-    if (dtype_ == core::Float32 || dtype_ == core::Float64) {
+    if (dtype_.GetDtypeCode() == Dtype::DtypeCode::Float) {
         Tensor dst_tensor(shape_, core::Bool, GetDevice());
         kernel::UnaryEW(*this, dst_tensor, kernel::UnaryEWOpCode::IsInf);
         return dst_tensor;
@@ -1310,7 +1550,7 @@ Tensor Tensor::IsInf() const {
 }
 
 Tensor Tensor::IsFinite() const {
-    if (dtype_ == core::Float32 || dtype_ == core::Float64) {
+    if (dtype_.GetDtypeCode() == Dtype::DtypeCode::Float) {
         Tensor dst_tensor(shape_, core::Bool, GetDevice());
         kernel::UnaryEW(*this, dst_tensor, kernel::UnaryEWOpCode::IsFinite);
         return dst_tensor;
@@ -1326,7 +1566,7 @@ Tensor Tensor::Clip(Scalar min_val, Scalar max_val) const {
 
 // TODO: Implement with kernel.
 Tensor Tensor::Clip_(Scalar min_val, Scalar max_val) {
-    DISPATCH_DTYPE_TO_TEMPLATE(dtype_, [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_HALF(dtype_, [&]() {
         scalar_t min_val_casted = min_val.To<scalar_t>();
         this->SetItem(TensorKey::IndexTensor(this->Lt(min_val_casted)),
                       Full({}, min_val_casted, dtype_, GetDevice()));
@@ -1392,7 +1632,7 @@ Tensor Tensor::LogicalAnd(const Tensor& value) const {
 
 Tensor Tensor::LogicalAnd(Scalar value) const {
     Tensor dst_tensor;
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dtype_, [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_HALF(dtype_, [&]() {
         dst_tensor = LogicalAnd(
                 Tensor::Full({}, value.To<scalar_t>(), dtype_, GetDevice()));
     });
@@ -1407,7 +1647,7 @@ Tensor Tensor::LogicalAnd_(const Tensor& value) {
 }
 
 Tensor Tensor::LogicalAnd_(Scalar value) {
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dtype_, [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_HALF(dtype_, [&]() {
         LogicalAnd_(
                 Tensor::Full({}, value.To<scalar_t>(), dtype_, GetDevice()));
     });
@@ -1426,7 +1666,7 @@ Tensor Tensor::LogicalOr(const Tensor& value) const {
 
 Tensor Tensor::LogicalOr(Scalar value) const {
     Tensor dst_tensor;
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dtype_, [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_HALF(dtype_, [&]() {
         dst_tensor = LogicalOr(
                 Tensor::Full({}, value.To<scalar_t>(), dtype_, GetDevice()));
     });
@@ -1441,7 +1681,7 @@ Tensor Tensor::LogicalOr_(const Tensor& value) {
 }
 
 Tensor Tensor::LogicalOr_(Scalar value) {
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dtype_, [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_HALF(dtype_, [&]() {
         LogicalOr_(Tensor::Full({}, value.To<scalar_t>(), dtype_, GetDevice()));
     });
     return *this;
@@ -1459,7 +1699,7 @@ Tensor Tensor::LogicalXor(const Tensor& value) const {
 
 Tensor Tensor::LogicalXor(Scalar value) const {
     Tensor dst_tensor;
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dtype_, [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_HALF(dtype_, [&]() {
         dst_tensor = LogicalXor(
                 Tensor::Full({}, value.To<scalar_t>(), dtype_, GetDevice()));
     });
@@ -1474,7 +1714,7 @@ Tensor Tensor::LogicalXor_(const Tensor& value) {
 }
 
 Tensor Tensor::LogicalXor_(Scalar value) {
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dtype_, [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_HALF(dtype_, [&]() {
         LogicalXor_(
                 Tensor::Full({}, value.To<scalar_t>(), dtype_, GetDevice()));
     });
@@ -1492,7 +1732,7 @@ Tensor Tensor::Gt(const Tensor& value) const {
 
 Tensor Tensor::Gt(Scalar value) const {
     Tensor dst_tensor;
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dtype_, [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_HALF(dtype_, [&]() {
         dst_tensor =
                 Gt(Tensor::Full({}, value.To<scalar_t>(), dtype_, GetDevice()));
     });
@@ -1507,7 +1747,7 @@ Tensor Tensor::Gt_(const Tensor& value) {
 }
 
 Tensor Tensor::Gt_(Scalar value) {
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dtype_, [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_HALF(dtype_, [&]() {
         Gt_(Tensor::Full({}, value.To<scalar_t>(), dtype_, GetDevice()));
     });
     return *this;
@@ -1524,7 +1764,7 @@ Tensor Tensor::Lt(const Tensor& value) const {
 
 Tensor Tensor::Lt(Scalar value) const {
     Tensor dst_tensor;
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dtype_, [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_HALF(dtype_, [&]() {
         dst_tensor =
                 Lt(Tensor::Full({}, value.To<scalar_t>(), dtype_, GetDevice()));
     });
@@ -1539,7 +1779,7 @@ Tensor Tensor::Lt_(const Tensor& value) {
 }
 
 Tensor Tensor::Lt_(Scalar value) {
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dtype_, [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_HALF(dtype_, [&]() {
         Lt_(Tensor::Full({}, value.To<scalar_t>(), dtype_, GetDevice()));
     });
     return *this;
@@ -1556,7 +1796,7 @@ Tensor Tensor::Ge(const Tensor& value) const {
 
 Tensor Tensor::Ge(Scalar value) const {
     Tensor dst_tensor;
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dtype_, [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_HALF(dtype_, [&]() {
         dst_tensor =
                 Ge(Tensor::Full({}, value.To<scalar_t>(), dtype_, GetDevice()));
     });
@@ -1571,7 +1811,7 @@ Tensor Tensor::Ge_(const Tensor& value) {
 }
 
 Tensor Tensor::Ge_(Scalar value) {
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dtype_, [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_HALF(dtype_, [&]() {
         Ge_(Tensor::Full({}, value.To<scalar_t>(), dtype_, GetDevice()));
     });
     return *this;
@@ -1588,7 +1828,7 @@ Tensor Tensor::Le(const Tensor& value) const {
 
 Tensor Tensor::Le(Scalar value) const {
     Tensor dst_tensor;
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dtype_, [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_HALF(dtype_, [&]() {
         dst_tensor =
                 Le(Tensor::Full({}, value.To<scalar_t>(), dtype_, GetDevice()));
     });
@@ -1603,7 +1843,7 @@ Tensor Tensor::Le_(const Tensor& value) {
 }
 
 Tensor Tensor::Le_(Scalar value) {
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dtype_, [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_HALF(dtype_, [&]() {
         Le_(Tensor::Full({}, value.To<scalar_t>(), dtype_, GetDevice()));
     });
     return *this;
@@ -1620,7 +1860,7 @@ Tensor Tensor::Eq(const Tensor& value) const {
 
 Tensor Tensor::Eq(Scalar value) const {
     Tensor dst_tensor;
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dtype_, [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_HALF(dtype_, [&]() {
         dst_tensor =
                 Eq(Tensor::Full({}, value.To<scalar_t>(), dtype_, GetDevice()));
     });
@@ -1635,7 +1875,7 @@ Tensor Tensor::Eq_(const Tensor& value) {
 }
 
 Tensor Tensor::Eq_(Scalar value) {
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dtype_, [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_HALF(dtype_, [&]() {
         Eq_(Tensor::Full({}, value.To<scalar_t>(), dtype_, GetDevice()));
     });
     return *this;
@@ -1652,7 +1892,7 @@ Tensor Tensor::Ne(const Tensor& value) const {
 
 Tensor Tensor::Ne(Scalar value) const {
     Tensor dst_tensor;
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dtype_, [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_HALF(dtype_, [&]() {
         dst_tensor =
                 Ne(Tensor::Full({}, value.To<scalar_t>(), dtype_, GetDevice()));
     });
@@ -1667,7 +1907,7 @@ Tensor Tensor::Ne_(const Tensor& value) {
 }
 
 Tensor Tensor::Ne_(Scalar value) {
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dtype_, [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_HALF(dtype_, [&]() {
         Ne_(Tensor::Full({}, value.To<scalar_t>(), dtype_, GetDevice()));
     });
     return *this;
@@ -1691,7 +1931,7 @@ bool Tensor::IsNonZero() const {
                 "boolean.");
     }
     bool rc = false;
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dtype_, [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_HALF(dtype_, [&]() {
         rc = Item<scalar_t>() != static_cast<scalar_t>(0);
     });
     return rc;
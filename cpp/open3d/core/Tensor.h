@@ -46,6 +46,10 @@
 namespace open3d {
 namespace core {
 
+class LazyTensor;
+template <typename T>
+class Future;
+
 /// A Tensor is a "view" of a data Blob with shape, stride, data_ptr.
 /// Tensor can also be used to perform numerical operations.
 class Tensor {
@@ -219,6 +223,13 @@ public:
                         Dtype dtype,
                         const Device& device = Device("CPU:0"));
 
+    /// Create a tensor with uninitialized values on CPU:0 backed by page-locked
+    /// (pinned) host memory. Copies of pinned tensors to and from CUDA devices
+    /// avoid a staging copy and run asynchronously on the current CUDA stream.
+    /// The memory is pooled, see PinnedMemoryManager. Falls back to regular
+    /// host memory if no CUDA device is available.
+    static Tensor EmptyPinned(const SizeVector& shape, Dtype dtype);
+
     /// Create a tensor with uninitialized values with the same Dtype and Device
     /// as the other tensor.
     static Tensor EmptyLike(const Tensor& other) {
@@ -478,6 +489,17 @@ public:
     /// Copy Tensor to the same device.
     Tensor Clone() const { return To(GetDevice(), /*copy=*/true); }
 
+    /// Returns a contiguous copy of this CPU tensor in pinned host memory, see
+    /// EmptyPinned(). Returns the tensor itself if it is already pinned.
+    ///
+    /// Since host-to-device copies from pinned memory are asynchronous, the
+    /// source must not be modified before the current stream is synchronized,
+    /// e.g. with cuda::SynchronizeStream().
+    Tensor PinMemory() const;
+
+    /// Returns true if the tensor resides in pinned host memory.
+    bool IsPinned() const;
+
     /// Copy Tensor values to current tensor from the source tensor.
     void CopyFrom(const Tensor& other);
 
@@ -493,6 +515,18 @@ public:
     /// is avoided when the original tensor is already on the targeted device.
     Tensor To(const Device& device, bool copy = false) const;
 
+    /// Asynchronous version of To(device, copy). The copy is enqueued on the
+    /// current CUDA stream without blocking the host, and the returned future
+    /// is ready once it has completed.
+    ///
+    /// - Copies to the host are written into pinned memory, see EmptyPinned().
+    /// - Copies from the host only overlap with host work if this tensor is
+    /// pinned, see PinMemory().
+    /// - Copies without a CUDA device are done before returning.
+    ///
+    /// Include "open3d/core/Future.h" to use the returned future.
+    Future<Tensor> ToAsync(const Device& device, bool copy = false) const;
+
     /// Returns a tensor with the specified \p device and \p dtype.
     /// \param device The targeted device to convert to.
     /// \param dtype The targeted dtype to convert to.
@@ -646,6 +680,11 @@ public:
     Tensor operator/=(const Tensor& value) { return Div_(value); }
     Tensor operator/=(Scalar value) { return Div_(value); }
 
+    /// Returns a LazyTensor referencing this tensor. Element-wise operations on
+    /// the LazyTensor are recorded and evaluated in a single fused kernel when
+    /// materialized, e.g. `((a.Lazy() - b) * c + d).Materialize()`.
+    LazyTensor Lazy() const;
+
     /// Returns the sum of the tensor along the given \p dims.
     /// \param dims A list of dimensions to be reduced.
     /// \param keepdim If true, the reduced dims will be retained as size 1.
@@ -691,6 +730,65 @@ public:
     /// is into the flattened tensor.
     Tensor ArgMax(const SizeVector& dims) const;
 
+    /// Returns the sum over ragged segments of the first dimension. Segment s
+    /// covers rows [row_splits[s], row_splits[s + 1]), and the result has
+    /// shape {S, ...} for an Int64 \p row_splits of shape {S + 1}. Empty
+    /// segments are 0.
+    Tensor SegmentSum(const Tensor& row_splits) const;
+
+    /// Returns the mean over ragged segments of the first dimension, see
+    /// SegmentSum(). Only Float32 and Float64 are supported. Empty segments
+    /// are 0.
+    Tensor SegmentMean(const Tensor& row_splits) const;
+
+    /// Returns the max over ragged segments of the first dimension, see
+    /// SegmentSum(). Empty segments are 0.
+    Tensor SegmentMax(const Tensor& row_splits) const;
+
+    /// Returns the row index of the max over ragged segments of the first
+    /// dimension, see SegmentSum(). The returned tensor has dtype Int64 and
+    /// indexes into the first dimension of this tensor. Empty segments are -1.
+    Tensor SegmentArgMax(const Tensor& row_splits) const;
+
+    /// Returns the 1-D tensor sorted in ascending or \p descending order.
+    /// Uses a radix sort on both CPU and CUDA.
+    Tensor Sort(bool descending = false) const;
+
+    /// Returns the Int64 indices that stably sort the 1-D tensor in ascending
+    /// or \p descending order. Equal elements keep their input order.
+    Tensor ArgSort(bool descending = false) const;
+
+    /// Returns the 1-D tensor with each segment [row_splits[s],
+    /// row_splits[s + 1]) sorted independently.
+    Tensor SegmentSort(const Tensor& row_splits,
+                       bool descending = false) const;
+
+    /// Returns the Int64 indices that stably sort each segment [row_splits[s],
+    /// row_splits[s + 1]) of the 1-D tensor. The indices are into the whole
+    /// tensor, so segment s is permuted within [row_splits[s],
+    /// row_splits[s + 1]).
+    Tensor SegmentArgSort(const Tensor& row_splits,
+                          bool descending = false) const;
+
+    /// Returns the sorted unique elements of the 1-D tensor.
+    Tensor Unique() const;
+
+    /// Returns the sorted unique elements of the 1-D tensor, the Int64 index
+    /// of each input element into the unique elements, and the Int64 number
+    /// of occurrences of each unique element.
+    std::tuple<Tensor, Tensor, Tensor> UniqueWithInverseAndCounts() const;
+
+    /// Returns the \p k largest (or smallest if \p largest is false)
+    /// elements of the 1-D tensor in sorted order, and their Int64 indices.
+    std::tuple<Tensor, Tensor> TopK(int64_t k, bool largest = true) const;
+
+    /// Returns the inclusive prefix sum along the first dimension.
+    Tensor InclusivePrefixSum() const;
+
+    /// Returns the exclusive prefix sum along the first dimension, i.e. the
+    /// first row is 0 and the last row of the input is not included.
+    Tensor ExclusivePrefixSum() const;
+
     /// Element-wise square root of a tensor, returns a new tensor.
     Tensor Sqrt() const;
 
@@ -1006,6 +1104,11 @@ public:
     /// used.
     Tensor Contiguous() const;
 
+    /// Asynchronous version of Contiguous(). For CUDA tensors, the copy is
+    /// enqueued on the current stream and the future is ready once it has
+    /// completed. See ToAsync().
+    Future<Tensor> ContiguousAsync() const;
+
     /// Computes matrix multiplication with *this and rhs and returns the
     /// result.
     Tensor Matmul(const Tensor& rhs) const;
@@ -1355,7 +1458,7 @@ inline bool Tensor::Item() const {
 
 template <typename S>
 inline void Tensor::Fill(S v) {
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(GetDtype(), [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_HALF(GetDtype(), [&]() {
         scalar_t casted_v = static_cast<scalar_t>(v);
         Tensor tmp(std::vector<scalar_t>({casted_v}), SizeVector({}),
                    GetDtype(), GetDevice());
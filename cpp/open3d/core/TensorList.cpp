@@ -137,9 +137,70 @@ void TensorList::Extend(const TensorList& other) {
             other.AsTensor().Slice(0, 0, other_size);
 }
 
+void TensorList::Extend(const Tensor& tensor) {
+    AssertIsResizable(*this, __FUNCTION__);
+
+    AssertTensorDevice(tensor, GetDevice());
+    AssertTensorDtype(tensor, GetDtype());
+    SizeVector shape = tensor.GetShape();
+    if (shape.size() == 0 ||
+        SizeVector(std::next(shape.begin()), shape.end()) != element_shape_) {
+        utility::LogError(
+                "Tensor of shape {} cannot extend a tensorlist of element "
+                "shape {}.",
+                tensor.GetShape(), element_shape_);
+    }
+
+    int64_t other_size = tensor.GetLength();
+    ResizeWithExpand(size_ + other_size);
+    internal_tensor_.Slice(0, size_ - other_size, size_) = tensor;
+}
+
+void TensorList::Reserve(int64_t reserved_size) {
+    AssertIsResizable(*this, __FUNCTION__);
+
+    if (reserved_size <= reserved_size_) {
+        return;
+    }
+    Tensor new_internal_tensor(
+            shape_util::Concat({reserved_size}, element_shape_), GetDtype(),
+            GetDevice());
+    new_internal_tensor.Slice(0, 0, size_) =
+            internal_tensor_.Slice(0, 0, size_);
+    internal_tensor_ = new_internal_tensor;
+    reserved_size_ = reserved_size;
+}
+
+Tensor TensorList::ReserveBack(int64_t max_size) {
+    AssertIsResizable(*this, __FUNCTION__);
+
+    if (max_size < 0) {
+        utility::LogError("Negative size {} is not supported.", max_size);
+    }
+    if (size_ + max_size > reserved_size_) {
+        Reserve(ComputeReserveSize(size_ + max_size));
+    }
+    return internal_tensor_.Slice(0, size_, size_ + max_size);
+}
+
+void TensorList::CommitBack(int64_t count) {
+    AssertIsResizable(*this, __FUNCTION__);
+
+    if (count < 0 || size_ + count > reserved_size_) {
+        utility::LogError(
+                "Cannot commit {} elements to a tensorlist of size {} and "
+                "reserved size {}.",
+                count, size_, reserved_size_);
+    }
+    size_ += count;
+}
+
 TensorList TensorList::Concatenate(const TensorList& a, const TensorList& b) {
-    // A full copy of a is required.
-    TensorList result = a.Clone();
+    // A full copy of a is required. Reserve for both, so that b is copied
+    // without growing the result again.
+    TensorList result(a.GetElementShape(), a.GetDtype(), a.GetDevice());
+    result.Reserve(ComputeReserveSize(a.GetSize() + b.GetSize()));
+    result.Extend(a);
     result.Extend(b);
     return result;
 }
@@ -230,6 +230,31 @@ public:
     /// resizable tensorlist.
     void Extend(const TensorList& other);
 
+    /// Extend the current tensorlist with the tensors stacked along the first
+    /// dimension of \p tensor, e.g. a (N, 3) tensor appends N points to a
+    /// tensorlist of element shape (3,). The data is copied in one operation.
+    /// The tensor must have the same element shape, dtype and device. This
+    /// operation is only valid for resizable tensorlist.
+    void Extend(const Tensor& tensor);
+
+    /// Expand the internal tensor to hold at least \p reserved_size elements
+    /// without changing the size, so that appending up to that many elements
+    /// does not reallocate. This operation is only valid for resizable
+    /// tensorlist.
+    void Reserve(int64_t reserved_size);
+
+    /// Return a view of the reserved storage for the next \p max_size
+    /// elements after the end, expanding the internal tensor if needed. The
+    /// size is not changed. A kernel can write new elements to the view in
+    /// place, and CommitBack(count) then appends the first count of them
+    /// without any copy. This operation is only valid for resizable
+    /// tensorlist.
+    Tensor ReserveBack(int64_t max_size);
+
+    /// Append the \p count elements written after the end, see ReserveBack.
+    /// \p count must not exceed the reserved size.
+    void CommitBack(int64_t count);
+
     /// Concatenate two tensorlists.
     /// Return a new tensorlists with data copied.
     /// Two tensorlists must have the same element_shape, type, and device.
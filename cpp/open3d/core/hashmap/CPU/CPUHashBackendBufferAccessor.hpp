@@ -40,7 +40,9 @@ namespace core {
 class CPUHashBackendBufferAccessor {
 public:
     /// Must initialize from a non-const buffer to grab the heap top.
-    CPUHashBackendBufferAccessor(HashBackendBuffer &hashmap_buffer)
+    /// Values at buffer indices >= \p value_reset_begin are zero-initialized.
+    CPUHashBackendBufferAccessor(HashBackendBuffer &hashmap_buffer,
+                                 int64_t value_reset_begin = 0)
         : capacity_(hashmap_buffer.GetCapacity()),
           key_dsize_(hashmap_buffer.GetKeyDsize()),
           value_dsizes_(hashmap_buffer.GetValueDsizes()),
@@ -49,7 +51,9 @@ public:
         std::vector<Tensor> value_buffers = hashmap_buffer.GetValueBuffers();
         for (size_t i = 0; i < value_buffers.size(); ++i) {
             void *value_buffer_ptr = value_buffers[i].GetDataPtr();
-            std::memset(value_buffer_ptr, 0, capacity_ * value_dsizes_[i]);
+            std::memset(static_cast<uint8_t *>(value_buffer_ptr) +
+                                value_reset_begin * value_dsizes_[i],
+                        0, (capacity_ - value_reset_begin) * value_dsizes_[i]);
             value_buffer_ptrs_.push_back(
                     static_cast<uint8_t *>(value_buffer_ptr));
         }
@@ -0,0 +1,490 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <atomic>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+#include "open3d/core/hashmap/CPU/CPUHashBackendBufferAccessor.hpp"
+#include "open3d/core/hashmap/DeviceHashBackend.h"
+#include "open3d/utility/Parallel.h"
+
+namespace open3d {
+namespace core {
+
+// Reserved buffer indices marking empty and erased buckets.
+static constexpr buf_index_t kFlatEmptyIndex = 0xFFFFFFFF;
+static constexpr buf_index_t kFlatErasedIndex = 0xFFFFFFFE;
+static constexpr uint64_t kFlatEmptyBucket = 0xFFFFFFFFFFFFFFFF;
+static constexpr uint64_t kFlatErasedBucket = 0xFFFFFFFFFFFFFFFE;
+
+// Max ratio of occupied buckets (including tombstones) before rehashing.
+static constexpr double kFlatMaxLoadFactor = 0.75;
+
+/// Flat open addressing hash map with linear probing.
+///
+/// Each bucket is a 64-bit word packing a 32-bit hash tag and a buffer index.
+/// Probing walks a contiguous array and compares tags, so the key buffer is
+/// only accessed on a tag match. Insertion is lock-free via compare-and-swap
+/// on empty buckets. Erased buckets become tombstones, which are dropped on
+/// the next rehash.
+template <typename Key, typename Hash, typename Eq>
+class FlatHashBackend : public DeviceHashBackend {
+public:
+    FlatHashBackend(int64_t init_capacity,
+                    int64_t key_dsize,
+                    const std::vector<int64_t>& value_dsizes,
+                    const Device& device);
+    ~FlatHashBackend();
+
+    void Reserve(int64_t capacity) override;
+
+    bool GrowInPlace(int64_t capacity) override;
+
+    void Insert(const void* input_keys,
+                const std::vector<const void*>& input_values_soa,
+                buf_index_t* output_buf_indices,
+                bool* output_masks,
+                int64_t count) override;
+
+    void Find(const void* input_keys,
+              buf_index_t* output_buf_indices,
+              bool* output_masks,
+              int64_t count) override;
+
+    void FindOrInsert(const void* input_keys,
+                      const std::vector<const void*>& input_values_soa,
+                      buf_index_t* output_buf_indices,
+                      bool* output_masks,
+                      int64_t count) override;
+
+    void Erase(const void* input_keys,
+               bool* output_masks,
+               int64_t count) override;
+
+    int64_t GetActiveIndices(buf_index_t* output_indices) override;
+
+    void Clear() override;
+
+    int64_t Size() const override;
+    int64_t GetBucketCount() const override;
+    std::vector<int64_t> BucketSizes() const override;
+    float LoadFactor() const override;
+
+    void Allocate(int64_t capacity) override;
+    void Free() override{};
+
+protected:
+    using bucket_t = uint64_t;
+
+    static bucket_t Pack(uint32_t tag, buf_index_t buf_index) {
+        return (static_cast<bucket_t>(tag) << 32) | buf_index;
+    }
+    static buf_index_t UnpackIndex(bucket_t bucket) {
+        return static_cast<buf_index_t>(bucket & 0xFFFFFFFF);
+    }
+    static uint32_t UnpackTag(bucket_t bucket) {
+        return static_cast<uint32_t>(bucket >> 32);
+    }
+
+    /// Hash with a 64-bit finalizer, since the probe start takes the low bits
+    /// and the tag takes the high bits.
+    static uint64_t ComputeHash(const Key& key) {
+        uint64_t hash = Hash()(key);
+        hash ^= hash >> 33;
+        hash *= UINT64_C(0xff51afd7ed558ccd);
+        hash ^= hash >> 33;
+        hash *= UINT64_C(0xc4ceb9fe1a85ec53);
+        hash ^= hash >> 33;
+        return hash;
+    }
+
+    /// Smallest power of 2 bucket count keeping the load factor of a full
+    /// buffer of size capacity at most 0.5.
+    static int64_t ComputeBucketCount(int64_t capacity);
+
+    const Key& GetKey(buf_index_t buf_index) const {
+        return *static_cast<const Key*>(buffer_accessor_->GetKeyPtr(buf_index));
+    }
+
+    /// Parallel insert. If output_found is true, existing keys output their
+    /// buffer indices like FindOrInsert.
+    void InsertImpl(const void* input_keys,
+                    const std::vector<const void*>& input_values_soa,
+                    buf_index_t* output_buf_indices,
+                    bool* output_masks,
+                    int64_t count,
+                    bool output_found);
+
+    /// Rebuild the buckets with a given bucket count and drop tombstones.
+    void Rehash(int64_t bucket_count);
+
+    std::unique_ptr<std::atomic<bucket_t>[]> buckets_;
+    int64_t bucket_count_ = 0;
+    uint64_t bucket_mask_ = 0;
+    int64_t erased_count_ = 0;
+
+    std::shared_ptr<CPUHashBackendBufferAccessor> buffer_accessor_;
+};
+
+template <typename Key, typename Hash, typename Eq>
+FlatHashBackend<Key, Hash, Eq>::FlatHashBackend(
+        int64_t init_capacity,
+        int64_t key_dsize,
+        const std::vector<int64_t>& value_dsizes,
+        const Device& device)
+    : DeviceHashBackend(init_capacity, key_dsize, value_dsizes, device) {
+    Allocate(init_capacity);
+}
+
+template <typename Key, typename Hash, typename Eq>
+FlatHashBackend<Key, Hash, Eq>::~FlatHashBackend() {}
+
+template <typename Key, typename Hash, typename Eq>
+int64_t FlatHashBackend<Key, Hash, Eq>::ComputeBucketCount(int64_t capacity) {
+    int64_t bucket_count = 16;
+    while (bucket_count < 2 * capacity) {
+        bucket_count *= 2;
+    }
+    return bucket_count;
+}
+
+template <typename Key, typename Hash, typename Eq>
+int64_t FlatHashBackend<Key, Hash, Eq>::Size() const {
+    return this->buffer_->GetHeapTopIndex();
+}
+
+template <typename Key, typename Hash, typename Eq>
+void FlatHashBackend<Key, Hash, Eq>::Find(const void* input_keys,
+                                          buf_index_t* output_buf_indices,
+                                          bool* output_masks,
+                                          int64_t count) {
+    const Key* input_keys_templated = static_cast<const Key*>(input_keys);
+
+#pragma omp parallel for num_threads(utility::EstimateMaxThreads())
+    for (int64_t i = 0; i < count; ++i) {
+        const Key& key = input_keys_templated[i];
+        const uint64_t hash = ComputeHash(key);
+        const uint32_t tag = static_cast<uint32_t>(hash >> 32);
+
+        output_buf_indices[i] = 0;
+        output_masks[i] = false;
+        for (uint64_t pos = hash & bucket_mask_;;
+             pos = (pos + 1) & bucket_mask_) {
+            bucket_t bucket = buckets_[pos].load(std::memory_order_acquire);
+            buf_index_t buf_index = UnpackIndex(bucket);
+            if (buf_index == kFlatEmptyIndex) {
+                break;
+            }
+            if (buf_index != kFlatErasedIndex && UnpackTag(bucket) == tag &&
+                Eq()(GetKey(buf_index), key)) {
+                output_buf_indices[i] = buf_index;
+                output_masks[i] = true;
+                break;
+            }
+        }
+    }
+}
+
+template <typename Key, typename Hash, typename Eq>
+void FlatHashBackend<Key, Hash, Eq>::Erase(const void* input_keys,
+                                           bool* output_masks,
+                                           int64_t count) {
+    const Key* input_keys_templated = static_cast<const Key*>(input_keys);
+    std::vector<buf_index_t> erased_buf_indices(count);
+
+#pragma omp parallel for num_threads(utility::EstimateMaxThreads())
+    for (int64_t i = 0; i < count; ++i) {
+        const Key& key = input_keys_templated[i];
+        const uint64_t hash = ComputeHash(key);
+        const uint32_t tag = static_cast<uint32_t>(hash >> 32);
+
+        output_masks[i] = false;
+        for (uint64_t pos = hash & bucket_mask_;;
+             pos = (pos + 1) & bucket_mask_) {
+            bucket_t bucket = buckets_[pos].load(std::memory_order_acquire);
+            buf_index_t buf_index = UnpackIndex(bucket);
+            if (buf_index == kFlatEmptyIndex) {
+                break;
+            }
+            if (buf_index != kFlatErasedIndex && UnpackTag(bucket) == tag &&
+                Eq()(GetKey(buf_index), key)) {
+                // Duplicate keys race here, and only one of them succeeds.
+                if (buckets_[pos].compare_exchange_strong(bucket,
+                                                          kFlatErasedBucket)) {
+                    erased_buf_indices[i] = buf_index;
+                    output_masks[i] = true;
+                }
+                break;
+            }
+        }
+    }
+
+    // The heap does not support concurrent free, so indices are returned
+    // after the parallel pass.
+    for (int64_t i = 0; i < count; ++i) {
+        if (output_masks[i]) {
+            buffer_accessor_->DeviceFree(erased_buf_indices[i]);
+            ++erased_count_;
+        }
+    }
+}
+
+template <typename Key, typename Hash, typename Eq>
+int64_t FlatHashBackend<Key, Hash, Eq>::GetActiveIndices(
+        buf_index_t* output_buf_indices) {
+    int64_t count = 0;
+    for (int64_t pos = 0; pos < bucket_count_; ++pos) {
+        buf_index_t buf_index =
+                UnpackIndex(buckets_[pos].load(std::memory_order_relaxed));
+        if (buf_index != kFlatEmptyIndex && buf_index != kFlatErasedIndex) {
+            output_buf_indices[count++] = buf_index;
+        }
+    }
+    return count;
+}
+
+template <typename Key, typename Hash, typename Eq>
+void FlatHashBackend<Key, Hash, Eq>::Clear() {
+#pragma omp parallel for num_threads(utility::EstimateMaxThreads())
+    for (int64_t pos = 0; pos < bucket_count_; ++pos) {
+        buckets_[pos].store(kFlatEmptyBucket, std::memory_order_relaxed);
+    }
+    erased_count_ = 0;
+    this->buffer_->ResetHeap();
+}
+
+template <typename Key, typename Hash, typename Eq>
+void FlatHashBackend<Key, Hash, Eq>::Reserve(int64_t capacity) {
+    int64_t bucket_count = ComputeBucketCount(capacity);
+    if (bucket_count > bucket_count_) {
+        Rehash(bucket_count);
+    }
+}
+
+template <typename Key, typename Hash, typename Eq>
+bool FlatHashBackend<Key, Hash, Eq>::GrowInPlace(int64_t capacity) {
+    // Buckets store buffer indices, which are preserved by the buffer growth.
+    int64_t old_capacity = this->capacity_;
+    this->buffer_->Grow(capacity);
+    this->capacity_ = capacity;
+    buffer_accessor_ = std::make_shared<CPUHashBackendBufferAccessor>(
+            *this->buffer_, old_capacity);
+    Rehash(ComputeBucketCount(capacity));
+    return true;
+}
+
+template <typename Key, typename Hash, typename Eq>
+int64_t FlatHashBackend<Key, Hash, Eq>::GetBucketCount() const {
+    return bucket_count_;
+}
+
+template <typename Key, typename Hash, typename Eq>
+std::vector<int64_t> FlatHashBackend<Key, Hash, Eq>::BucketSizes() const {
+    std::vector<int64_t> ret(bucket_count_);
+    for (int64_t pos = 0; pos < bucket_count_; ++pos) {
+        buf_index_t buf_index =
+                UnpackIndex(buckets_[pos].load(std::memory_order_relaxed));
+        ret[pos] = (buf_index != kFlatEmptyIndex &&
+                    buf_index != kFlatErasedIndex);
+    }
+    return ret;
+}
+
+template <typename Key, typename Hash, typename Eq>
+float FlatHashBackend<Key, Hash, Eq>::LoadFactor() const {
+    return float(Size()) / float(bucket_count_);
+}
+
+template <typename Key, typename Hash, typename Eq>
+void FlatHashBackend<Key, Hash, Eq>::Insert(
+        const void* input_keys,
+        const std::vector<const void*>& input_values_soa,
+        buf_index_t* output_buf_indices,
+        bool* output_masks,
+        int64_t count) {
+    InsertImpl(input_keys, input_values_soa, output_buf_indices, output_masks,
+               count, /* output_found */ false);
+}
+
+template <typename Key, typename Hash, typename Eq>
+void FlatHashBackend<Key, Hash, Eq>::FindOrInsert(
+        const void* input_keys,
+        const std::vector<const void*>& input_values_soa,
+        buf_index_t* output_buf_indices,
+        bool* output_masks,
+        int64_t count) {
+    InsertImpl(input_keys, input_values_soa, output_buf_indices, output_masks,
+               count, /* output_found */ true);
+}
+
+template <typename Key, typename Hash, typename Eq>
+void FlatHashBackend<Key, Hash, Eq>::InsertImpl(
+        const void* input_keys,
+        const std::vector<const void*>& input_values_soa,
+        buf_index_t* output_buf_indices,
+        bool* output_masks,
+        int64_t count,
+        bool output_found) {
+    // Tombstones are never reused by insertion, so they count towards the
+    // load. Keep the probe sequences short by dropping them when needed.
+    if (Size() + erased_count_ + count > kFlatMaxLoadFactor * bucket_count_) {
+        Rehash(std::max(bucket_count_, ComputeBucketCount(Size() + count)));
+    }
+
+    const Key* input_keys_templated = static_cast<const Key*>(input_keys);
+    size_t n_values = input_values_soa.size();
+
+    // Indices allocated by lanes that lost the race to a duplicate key.
+    std::vector<buf_index_t> unused_buf_indices(count, kFlatEmptyIndex);
+
+#pragma omp parallel for num_threads(utility::EstimateMaxThreads())
+    for (int64_t i = 0; i < count; ++i) {
+        const Key& key = input_keys_templated[i];
+        const uint64_t hash = ComputeHash(key);
+        const uint32_t tag = static_cast<uint32_t>(hash >> 32);
+
+        buf_index_t new_buf_index = kFlatEmptyIndex;
+        buf_index_t found_buf_index = kFlatEmptyIndex;
+        bool inserted = false;
+
+        uint64_t pos = hash & bucket_mask_;
+        while (true) {
+            bucket_t bucket = buckets_[pos].load(std::memory_order_acquire);
+            buf_index_t buf_index = UnpackIndex(bucket);
+
+            // Empty bucket: the key is absent, try to claim the bucket.
+            if (buf_index == kFlatEmptyIndex) {
+                // The key must be in the buffer before it is published.
+                if (new_buf_index == kFlatEmptyIndex) {
+                    new_buf_index = buffer_accessor_->DeviceAllocate();
+                    *static_cast<Key*>(
+                            buffer_accessor_->GetKeyPtr(new_buf_index)) = key;
+                }
+                if (buckets_[pos].compare_exchange_strong(
+                            bucket, Pack(tag, new_buf_index),
+                            std::memory_order_acq_rel)) {
+                    inserted = true;
+                    break;
+                }
+                // Lost the race, examine the same bucket again.
+                continue;
+            }
+
+            // Occupied bucket: compare keys only on tag match.
+            if (buf_index != kFlatErasedIndex && UnpackTag(bucket) == tag &&
+                Eq()(GetKey(buf_index), key)) {
+                found_buf_index = buf_index;
+                break;
+            }
+            pos = (pos + 1) & bucket_mask_;
+        }
+
+        if (inserted) {
+            for (size_t j = 0; j < n_values; ++j) {
+                uint8_t* dst_value = static_cast<uint8_t*>(
+                        buffer_accessor_->GetValuePtr(new_buf_index, j));
+                const uint8_t* src_value =
+                        static_cast<const uint8_t*>(input_values_soa[j]) +
+                        this->value_dsizes_[j] * i;
+                std::memcpy(dst_value, src_value, this->value_dsizes_[j]);
+            }
+            output_buf_indices[i] = new_buf_index;
+            output_masks[i] = true;
+        } else {
+            unused_buf_indices[i] = new_buf_index;
+            output_buf_indices[i] = output_found ? found_buf_index : 0;
+            output_masks[i] = false;
+        }
+    }
+
+    // The heap does not support concurrent allocation and free, so unused
+    // indices are returned after the parallel pass.
+    for (int64_t i = 0; i < count; ++i) {
+        if (unused_buf_indices[i] != kFlatEmptyIndex) {
+            buffer_accessor_->DeviceFree(unused_buf_indices[i]);
+        }
+    }
+}
+
+template <typename Key, typename Hash, typename Eq>
+void FlatHashBackend<Key, Hash, Eq>::Rehash(int64_t bucket_count) {
+    std::unique_ptr<std::atomic<bucket_t>[]> buckets(
+            new std::atomic<bucket_t>[bucket_count]);
+    const uint64_t bucket_mask = static_cast<uint64_t>(bucket_count - 1);
+
+#pragma omp parallel for num_threads(utility::EstimateMaxThreads())
+    for (int64_t pos = 0; pos < bucket_count; ++pos) {
+        buckets[pos].store(kFlatEmptyBucket, std::memory_order_relaxed);
+    }
+
+    // Keys are unique, so insertion only needs to claim an empty bucket.
+#pragma omp parallel for num_threads(utility::EstimateMaxThreads())
+    for (int64_t old_pos = 0; old_pos < bucket_count_; ++old_pos) {
+        bucket_t bucket = buckets_[old_pos].load(std::memory_order_relaxed);
+        buf_index_t buf_index = UnpackIndex(bucket);
+        if (buf_index == kFlatEmptyIndex || buf_index == kFlatErasedIndex) {
+            continue;
+        }
+
+        uint64_t hash = ComputeHash(GetKey(buf_index));
+        for (uint64_t pos = hash & bucket_mask;;
+             pos = (pos + 1) & bucket_mask) {
+            bucket_t expected = kFlatEmptyBucket;
+            if (buckets[pos].compare_exchange_strong(expected, bucket)) {
+                break;
+            }
+        }
+    }
+
+    buckets_ = std::move(buckets);
+    bucket_count_ = bucket_count;
+    bucket_mask_ = bucket_mask;
+    erased_count_ = 0;
+}
+
+template <typename Key, typename Hash, typename Eq>
+void FlatHashBackend<Key, Hash, Eq>::Allocate(int64_t capacity) {
+    this->capacity_ = capacity;
+
+    this->buffer_ = std::make_shared<HashBackendBuffer>(
+            this->capacity_, this->key_dsize_, this->value_dsizes_,
+            this->device_);
+
+    buffer_accessor_ =
+            std::make_shared<CPUHashBackendBufferAccessor>(*this->buffer_);
+
+    // Start from an empty table of the target size.
+    buckets_.reset();
+    bucket_count_ = 0;
+    Rehash(ComputeBucketCount(capacity));
+}
+
+}  // namespace core
+}  // namespace open3d
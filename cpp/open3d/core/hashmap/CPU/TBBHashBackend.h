@@ -48,6 +48,8 @@ public:
 
     void Reserve(int64_t capacity) override;
 
+    bool GrowInPlace(int64_t capacity) override;
+
     void Insert(const void* input_keys,
                 const std::vector<const void*>& input_values_soa,
                 buf_index_t* output_buf_indices,
@@ -59,6 +61,12 @@ public:
               bool* output_masks,
               int64_t count) override;
 
+    void FindOrInsert(const void* input_keys,
+                      const std::vector<const void*>& input_values_soa,
+                      buf_index_t* output_buf_indices,
+                      bool* output_masks,
+                      int64_t count) override;
+
     void Erase(const void* input_keys,
                bool* output_masks,
                int64_t count) override;
@@ -165,6 +173,18 @@ void TBBHashBackend<Key, Hash, Eq>::Reserve(int64_t capacity) {
     impl_->rehash(std::ceil(capacity / impl_->max_load_factor()));
 }
 
+template <typename Key, typename Hash, typename Eq>
+bool TBBHashBackend<Key, Hash, Eq>::GrowInPlace(int64_t capacity) {
+    // The map stores keys and buffer indices, so only the buffers need to grow.
+    int64_t old_capacity = this->capacity_;
+    this->buffer_->Grow(capacity);
+    this->capacity_ = capacity;
+    buffer_accessor_ = std::make_shared<CPUHashBackendBufferAccessor>(
+            *this->buffer_, old_capacity);
+    Reserve(capacity);
+    return true;
+}
+
 template <typename Key, typename Hash, typename Eq>
 int64_t TBBHashBackend<Key, Hash, Eq>::GetBucketCount() const {
     return impl_->unsafe_bucket_count();
@@ -235,6 +255,28 @@ void TBBHashBackend<Key, Hash, Eq>::Insert(
     }
 }
 
+template <typename Key, typename Hash, typename Eq>
+void TBBHashBackend<Key, Hash, Eq>::FindOrInsert(
+        const void* input_keys,
+        const std::vector<const void*>& input_values_soa,
+        buf_index_t* output_buf_indices,
+        bool* output_masks,
+        int64_t count) {
+    // Insert pass identical to Insert. Failed insertions may see the dummy
+    // index of a concurrent insertion, so they are resolved after the pass.
+    Insert(input_keys, input_values_soa, output_buf_indices, output_masks,
+           count);
+
+    const Key* input_keys_templated = static_cast<const Key*>(input_keys);
+#pragma omp parallel for num_threads(utility::EstimateMaxThreads())
+    for (int64_t i = 0; i < count; ++i) {
+        if (!output_masks[i]) {
+            auto iter = impl_->find(input_keys_templated[i]);
+            output_buf_indices[i] = iter->second;
+        }
+    }
+}
+
 template <typename Key, typename Hash, typename Eq>
 void TBBHashBackend<Key, Hash, Eq>::Allocate(int64_t capacity) {
     this->capacity_ = capacity;
@@ -42,7 +42,9 @@ namespace core {
 
 class CUDAHashBackendBufferAccessor {
 public:
-    __host__ void Setup(HashBackendBuffer &hashmap_buffer) {
+    /// Values at buffer indices >= \p value_reset_begin are zero-initialized.
+    __host__ void Setup(HashBackendBuffer &hashmap_buffer,
+                        int64_t value_reset_begin = 0) {
         Device device = hashmap_buffer.GetDevice();
 
         // Properties
@@ -77,7 +79,10 @@ public:
         std::vector<uint8_t *> value_ptrs(n_values_);
         for (size_t i = 0; i < n_values_; ++i) {
             value_ptrs[i] = value_buffers[i].GetDataPtr<uint8_t>();
-            cudaMemset(value_ptrs[i], 0, capacity_ * value_dsizes_host[i]);
+            cudaMemsetAsync(
+                    value_ptrs[i] + value_reset_begin * value_dsizes_host[i], 0,
+                    (capacity_ - value_reset_begin) * value_dsizes_host[i],
+                    core::cuda::GetStream());
         }
         values_ = static_cast<uint8_t **>(
                 MemoryManager::Malloc(n_values_ * sizeof(uint8_t *), device));
@@ -85,7 +90,7 @@ public:
                                       n_values_ * sizeof(uint8_t *));
 
         heap_top_ = hashmap_buffer.GetHeapTop().cuda.GetDataPtr<int>();
-        cuda::Synchronize();
+        cuda::SynchronizeStream();
         OPEN3D_CUDA_CHECK(cudaGetLastError());
     }
 
@@ -26,6 +26,10 @@
 
 #pragma once
 
+#include <thrust/execution_policy.h>
+#include <thrust/functional.h>
+#include <thrust/transform_reduce.h>
+
 #include <memory>
 
 #include "open3d/core/CUDAUtils.h"
@@ -47,6 +51,8 @@ public:
 
     void Reserve(int64_t capacity) override;
 
+    bool GrowInPlace(int64_t capacity) override;
+
     void Insert(const void* input_keys,
                 const std::vector<const void*>& input_values_soa,
                 buf_index_t* output_buf_indices,
@@ -58,6 +64,12 @@ public:
               bool* output_masks,
               int64_t count) override;
 
+    void FindOrInsert(const void* input_keys,
+                      const std::vector<const void*>& input_values_soa,
+                      buf_index_t* output_buf_indices,
+                      bool* output_masks,
+                      int64_t count) override;
+
     void Erase(const void* input_keys,
                bool* output_masks,
                int64_t count) override;
@@ -72,6 +84,16 @@ public:
 
     SlabHashBackendImpl<Key, Hash, Eq> GetImpl() { return impl_; }
 
+    /// Packs the entries of every bucket towards its head slab and returns the
+    /// slabs that become empty to the node manager. Erase calls this
+    /// automatically when SlabOccupancy() drops below
+    /// kSlabCompactionMinOccupancy.
+    void CompactSlabs();
+
+    /// Ratio of the number of slabs the entries need to the number of slabs
+    /// allocated from the node manager, 1 if no slab is allocated.
+    float SlabOccupancy() const;
+
     void Allocate(int64_t capacity) override;
     void Free() override;
 
@@ -84,6 +106,19 @@ protected:
     std::shared_ptr<SlabNodeManager> node_mgr_;
 
     int64_t bucket_count_;
+
+    /// Number of entries erased since the last occupancy check.
+    int64_t erased_since_compaction_check_ = 0;
+};
+
+/// Number of non-head slabs needed for a bucket with the given entry count.
+struct SlabsNeededForBucket {
+    __host__ __device__ int64_t operator()(int64_t bucket_elem_count) const {
+        const int64_t entries_per_slab = kWarpSize - 1;
+        return bucket_elem_count <= entries_per_slab
+                       ? 0
+                       : (bucket_elem_count - 1) / entries_per_slab;
+    }
 };
 
 template <typename Key, typename Hash, typename Eq>
@@ -104,6 +139,24 @@ SlabHashBackend<Key, Hash, Eq>::~SlabHashBackend() {
 template <typename Key, typename Hash, typename Eq>
 void SlabHashBackend<Key, Hash, Eq>::Reserve(int64_t capacity) {}
 
+template <typename Key, typename Hash, typename Eq>
+bool SlabHashBackend<Key, Hash, Eq>::GrowInPlace(int64_t capacity) {
+    // Buckets are not rehashed, so growing in place is only worthwhile while
+    // the expected chain length stays within the head slabs.
+    if (capacity > kGrowInPlaceMaxLoad * bucket_count_) {
+        return false;
+    }
+
+    // Slabs store buffer indices, which are preserved by the buffer growth.
+    int64_t old_capacity = this->capacity_;
+    this->buffer_->Grow(capacity);
+    this->capacity_ = capacity;
+    buffer_accessor_.Shutdown(this->device_);
+    buffer_accessor_.Setup(*this->buffer_, old_capacity);
+    impl_.Setup(this->bucket_count_, node_mgr_->impl_, buffer_accessor_);
+    return true;
+}
+
 template <typename Key, typename Hash, typename Eq>
 void SlabHashBackend<Key, Hash, Eq>::Find(const void* input_keys,
                                           buf_index_t* output_buf_indices,
@@ -111,15 +164,16 @@ void SlabHashBackend<Key, Hash, Eq>::Find(const void* input_keys,
                                           int64_t count) {
     if (count == 0) return;
 
-    OPEN3D_CUDA_CHECK(cudaMemset(output_masks, 0, sizeof(bool) * count));
-    cuda::Synchronize();
+    OPEN3D_CUDA_CHECK(cudaMemsetAsync(output_masks, 0, sizeof(bool) * count,
+                                      core::cuda::GetStream()));
+    cuda::SynchronizeStream();
     OPEN3D_CUDA_CHECK(cudaGetLastError());
 
     const int64_t num_blocks =
             (count + kThreadsPerBlock - 1) / kThreadsPerBlock;
     FindKernel<<<num_blocks, kThreadsPerBlock, 0, core::cuda::GetStream()>>>(
             impl_, input_keys, output_buf_indices, output_masks, count);
-    cuda::Synchronize();
+    cuda::SynchronizeStream();
     OPEN3D_CUDA_CHECK(cudaGetLastError());
 }
 
@@ -129,8 +183,9 @@ void SlabHashBackend<Key, Hash, Eq>::Erase(const void* input_keys,
                                            int64_t count) {
     if (count == 0) return;
 
-    OPEN3D_CUDA_CHECK(cudaMemset(output_masks, 0, sizeof(bool) * count));
-    cuda::Synchronize();
+    OPEN3D_CUDA_CHECK(cudaMemsetAsync(output_masks, 0, sizeof(bool) * count,
+                                      core::cuda::GetStream()));
+    cuda::SynchronizeStream();
     OPEN3D_CUDA_CHECK(cudaGetLastError());
     auto buf_indices = static_cast<buf_index_t*>(
             MemoryManager::Malloc(sizeof(buf_index_t) * count, this->device_));
@@ -143,10 +198,54 @@ void SlabHashBackend<Key, Hash, Eq>::Erase(const void* input_keys,
     EraseKernelPass1<<<num_blocks, kThreadsPerBlock, 0,
                        core::cuda::GetStream()>>>(impl_, buf_indices,
                                                   output_masks, count);
-    cuda::Synchronize();
+    cuda::SynchronizeStream();
     OPEN3D_CUDA_CHECK(cudaGetLastError());
 
     MemoryManager::Free(buf_indices, this->device_);
+
+    // Erased entries leave holes in the slab lists. Check from time to time
+    // whether enough slabs can be reclaimed to compact the buckets.
+    erased_since_compaction_check_ += count;
+    if (erased_since_compaction_check_ * kSlabCompactionPeriod >=
+        this->capacity_) {
+        erased_since_compaction_check_ = 0;
+        if (SlabOccupancy() < kSlabCompactionMinOccupancy) {
+            CompactSlabs();
+        }
+    }
+}
+
+template <typename Key, typename Hash, typename Eq>
+void SlabHashBackend<Key, Hash, Eq>::CompactSlabs() {
+    const int64_t num_blocks =
+            (impl_.bucket_count_ * kWarpSize + kThreadsPerBlock - 1) /
+            kThreadsPerBlock;
+    CompactSlabsKernel<<<num_blocks, kThreadsPerBlock, 0,
+                         core::cuda::GetStream()>>>(impl_);
+    cuda::SynchronizeStream();
+    OPEN3D_CUDA_CHECK(cudaGetLastError());
+}
+
+template <typename Key, typename Hash, typename Eq>
+float SlabHashBackend<Key, Hash, Eq>::SlabOccupancy() const {
+    const int64_t num_allocated_slabs = node_mgr_->CountSlabs();
+    if (num_allocated_slabs == 0) {
+        return 1.0f;
+    }
+
+    thrust::device_vector<int64_t> elems_per_bucket(impl_.bucket_count_);
+    const int64_t num_blocks =
+            (impl_.bucket_count_ * kWarpSize + kThreadsPerBlock - 1) /
+            kThreadsPerBlock;
+    CountElemsPerBucketKernel<<<num_blocks, kThreadsPerBlock, 0,
+                                core::cuda::GetStream()>>>(
+            impl_, thrust::raw_pointer_cast(elems_per_bucket.data()));
+    const int64_t num_needed_slabs = thrust::transform_reduce(
+            thrust::cuda::par.on(core::cuda::GetStream()),
+            elems_per_bucket.begin(), elems_per_bucket.end(),
+            SlabsNeededForBucket(), int64_t(0), thrust::plus<int64_t>());
+    OPEN3D_CUDA_CHECK(cudaGetLastError());
+    return float(num_needed_slabs) / float(num_allocated_slabs);
 }
 
 template <typename Key, typename Hash, typename Eq>
@@ -154,9 +253,10 @@ int64_t SlabHashBackend<Key, Hash, Eq>::GetActiveIndices(
         buf_index_t* output_buf_indices) {
     uint32_t* count = static_cast<uint32_t*>(
             MemoryManager::Malloc(sizeof(uint32_t), this->device_));
-    OPEN3D_CUDA_CHECK(cudaMemset(count, 0, sizeof(uint32_t)));
+    OPEN3D_CUDA_CHECK(cudaMemsetAsync(count, 0, sizeof(uint32_t),
+                                      core::cuda::GetStream()));
 
-    cuda::Synchronize();
+    cuda::SynchronizeStream();
     OPEN3D_CUDA_CHECK(cudaGetLastError());
 
     const int64_t num_blocks =
@@ -165,7 +265,7 @@ int64_t SlabHashBackend<Key, Hash, Eq>::GetActiveIndices(
     GetActiveIndicesKernel<<<num_blocks, kThreadsPerBlock, 0,
                              core::cuda::GetStream()>>>(
             impl_, output_buf_indices, count);
-    cuda::Synchronize();
+    cuda::SynchronizeStream();
     OPEN3D_CUDA_CHECK(cudaGetLastError());
 
     uint32_t ret;
@@ -181,13 +281,15 @@ void SlabHashBackend<Key, Hash, Eq>::Clear() {
     this->buffer_->ResetHeap();
 
     // Clear the linked list heads
-    OPEN3D_CUDA_CHECK(cudaMemset(impl_.bucket_list_head_, 0xFF,
-                                 sizeof(Slab) * this->bucket_count_));
-    cuda::Synchronize();
+    OPEN3D_CUDA_CHECK(cudaMemsetAsync(impl_.bucket_list_head_, 0xFF,
+                                      sizeof(Slab) * this->bucket_count_,
+                                      core::cuda::GetStream()));
+    cuda::SynchronizeStream();
     OPEN3D_CUDA_CHECK(cudaGetLastError());
 
     // Clear the linked list nodes
     node_mgr_->Reset();
+    erased_since_compaction_check_ = 0;
 }
 
 template <typename Key, typename Hash, typename Eq>
@@ -203,19 +305,21 @@ int64_t SlabHashBackend<Key, Hash, Eq>::GetBucketCount() const {
 template <typename Key, typename Hash, typename Eq>
 std::vector<int64_t> SlabHashBackend<Key, Hash, Eq>::BucketSizes() const {
     thrust::device_vector<int64_t> elems_per_bucket(impl_.bucket_count_);
-    thrust::fill(elems_per_bucket.begin(), elems_per_bucket.end(), 0);
+    thrust::fill(thrust::cuda::par.on(core::cuda::GetStream()),
+                 elems_per_bucket.begin(), elems_per_bucket.end(), 0);
 
     const int64_t num_blocks =
-            (impl_.buffer_accessor_.capacity_ + kThreadsPerBlock - 1) /
+            (impl_.bucket_count_ * kWarpSize + kThreadsPerBlock - 1) /
             kThreadsPerBlock;
     CountElemsPerBucketKernel<<<num_blocks, kThreadsPerBlock, 0,
                                 core::cuda::GetStream()>>>(
             impl_, thrust::raw_pointer_cast(elems_per_bucket.data()));
-    cuda::Synchronize();
+    cuda::SynchronizeStream();
     OPEN3D_CUDA_CHECK(cudaGetLastError());
 
     std::vector<int64_t> result(impl_.bucket_count_);
-    thrust::copy(elems_per_bucket.begin(), elems_per_bucket.end(),
+    thrust::copy(thrust::cuda::par.on(core::cuda::GetStream()),
+                 elems_per_bucket.begin(), elems_per_bucket.end(),
                  result.begin());
     return result;
 }
@@ -263,7 +367,56 @@ void SlabHashBackend<Key, Hash, Eq>::Insert(
                                 impl_, ptr_input_values_soa, output_buf_indices,
                                 output_masks, count, n_values);
             });
-    cuda::Synchronize();
+    cuda::SynchronizeStream();
+    OPEN3D_CUDA_CHECK(cudaGetLastError());
+}
+
+template <typename Key, typename Hash, typename Eq>
+void SlabHashBackend<Key, Hash, Eq>::FindOrInsert(
+        const void* input_keys,
+        const std::vector<const void*>& input_values_soa,
+        buf_index_t* output_buf_indices,
+        bool* output_masks,
+        int64_t count) {
+    if (count == 0) return;
+
+    /// Same pre-allocation as Insert. The pre-allocated indices are kept
+    /// separately, since output_buf_indices receive existing indices for
+    /// found keys, while the pre-allocated ones have to be freed.
+    int prev_heap_top = this->buffer_->GetHeapTopIndex();
+    *thrust::device_ptr<int>(impl_.buffer_accessor_.heap_top_) =
+            prev_heap_top + count;
+
+    thrust::device_vector<buf_index_t> prealloc_buf_indices_device(count);
+    buf_index_t* prealloc_buf_indices =
+            thrust::raw_pointer_cast(prealloc_buf_indices_device.data());
+
+    const int64_t num_blocks =
+            (count + kThreadsPerBlock - 1) / kThreadsPerBlock;
+    InsertKernelPass0<<<num_blocks, kThreadsPerBlock, 0,
+                        core::cuda::GetStream()>>>(
+            impl_, input_keys, prealloc_buf_indices, prev_heap_top, count);
+    FindOrInsertKernelPass1<<<num_blocks, kThreadsPerBlock, 0,
+                              core::cuda::GetStream()>>>(
+            impl_, input_keys, prealloc_buf_indices, output_buf_indices,
+            output_masks, count);
+
+    thrust::device_vector<const void*> input_values_soa_device(
+            input_values_soa.begin(), input_values_soa.end());
+
+    int64_t n_values = input_values_soa.size();
+    const void* const* ptr_input_values_soa =
+            thrust::raw_pointer_cast(input_values_soa_device.data());
+    DISPATCH_DIVISOR_SIZE_TO_BLOCK_T(
+            impl_.buffer_accessor_.common_block_size_, [&]() {
+                InsertKernelPass2<Key, Hash, Eq, block_t>
+                        <<<num_blocks, kThreadsPerBlock, 0,
+                           core::cuda::GetStream()>>>(
+                                impl_, ptr_input_values_soa,
+                                prealloc_buf_indices, output_masks, count,
+                                n_values);
+            });
+    cuda::SynchronizeStream();
     OPEN3D_CUDA_CHECK(cudaGetLastError());
 }
 
@@ -284,9 +437,10 @@ void SlabHashBackend<Key, Hash, Eq>::Allocate(int64_t capacity) {
     // Allocate linked list heads.
     impl_.bucket_list_head_ = static_cast<Slab*>(MemoryManager::Malloc(
             sizeof(Slab) * this->bucket_count_, this->device_));
-    OPEN3D_CUDA_CHECK(cudaMemset(impl_.bucket_list_head_, 0xFF,
-                                 sizeof(Slab) * this->bucket_count_));
-    cuda::Synchronize();
+    OPEN3D_CUDA_CHECK(cudaMemsetAsync(impl_.bucket_list_head_, 0xFF,
+                                      sizeof(Slab) * this->bucket_count_,
+                                      core::cuda::GetStream()));
+    cuda::SynchronizeStream();
     OPEN3D_CUDA_CHECK(cudaGetLastError());
 
     impl_.Setup(this->bucket_count_, node_mgr_->impl_, buffer_accessor_);
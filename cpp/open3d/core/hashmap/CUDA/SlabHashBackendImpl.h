@@ -70,11 +70,13 @@ public:
                         const CUDAHashBackendBufferAccessor& buffer_accessor);
 
     /// Warp-insert a pre-allocated buf_index at key.
-    __device__ bool Insert(bool lane_active,
-                           uint32_t lane_id,
-                           uint32_t bucket_id,
-                           const Key& key,
-                           buf_index_t buf_index);
+    /// Return the buf_index stored at key, and whether it is newly inserted.
+    /// If the key already exists, the returned buf_index is the existing one.
+    __device__ Pair<buf_index_t, bool> Insert(bool lane_active,
+                                              uint32_t lane_id,
+                                              uint32_t bucket_id,
+                                              const Key& key,
+                                              buf_index_t buf_index);
 
     /// Warp-find a buf_index and its mask at key.
     __device__ Pair<buf_index_t, bool> Find(bool lane_active,
@@ -99,6 +101,11 @@ public:
     /// Warp-find the first empty slot in a slab.
     __device__ int32_t WarpFindEmpty(uint32_t slab_entry);
 
+    /// Warp-compact the slab list of a bucket: entries are packed towards the
+    /// head slab and the trailing slabs that become empty are freed. Must not
+    /// run concurrently with other operations on the same map.
+    __device__ void WarpCompact(uint32_t lane_id, uint32_t bucket_id);
+
     // Hash function.
     __device__ int64_t ComputeBucket(const Key& key) const;
 
@@ -190,6 +197,9 @@ template <typename Key, typename Hash, typename Eq>
 __global__ void CountElemsPerBucketKernel(
         SlabHashBackendImpl<Key, Hash, Eq> impl, int64_t* bucket_elem_counts);
 
+template <typename Key, typename Hash, typename Eq>
+__global__ void CompactSlabsKernel(SlabHashBackendImpl<Key, Hash, Eq> impl);
+
 template <typename Key, typename Hash, typename Eq>
 SlabHashBackendImpl<Key, Hash, Eq>::SlabHashBackendImpl()
     : bucket_count_(0), bucket_list_head_(nullptr) {}
@@ -205,7 +215,7 @@ void SlabHashBackendImpl<Key, Hash, Eq>::Setup(
 }
 
 template <typename Key, typename Hash, typename Eq>
-__device__ bool SlabHashBackendImpl<Key, Hash, Eq>::Insert(
+__device__ Pair<buf_index_t, bool> SlabHashBackendImpl<Key, Hash, Eq>::Insert(
         bool lane_active,
         uint32_t lane_id,
         uint32_t bucket_id,
@@ -216,6 +226,7 @@ __device__ bool SlabHashBackendImpl<Key, Hash, Eq>::Insert(
     uint32_t slab_ptr = kHeadSlabAddr;
     Key src_key;
 
+    buf_index_t result_buf_index = kNullAddr;
     bool mask = false;
 
     // > Loop when we have active lanes
@@ -234,8 +245,12 @@ __device__ bool SlabHashBackendImpl<Key, Hash, Eq>::Insert(
 
         // Branch 1: key already existing, ABORT
         if (lane_found >= 0) {
+            // broadcast existing value
+            uint32_t found_buf_index = __shfl_sync(kSyncLanesMask, slab_entry,
+                                                   lane_found, kWarpSize);
             if (lane_id == src_lane) {
                 lane_active = false;
+                result_buf_index = found_buf_index;
             }
         }
 
@@ -255,6 +270,7 @@ __device__ bool SlabHashBackendImpl<Key, Hash, Eq>::Insert(
                 // Branch 2.1: SUCCEED
                 if (old_empty_entry_value == kEmptyNodeAddr) {
                     lane_active = false;
+                    result_buf_index = buf_index;
                     mask = true;
                 }
                 // Branch 2.2: failed: RESTART
@@ -306,7 +322,7 @@ __device__ bool SlabHashBackendImpl<Key, Hash, Eq>::Insert(
         prev_work_queue = work_queue;
     }
 
-    return mask;
+    return make_pair(result_buf_index, mask);
 }
 
 template <typename Key, typename Hash, typename Eq>
@@ -489,6 +505,82 @@ __device__ __forceinline__ void SlabHashBackendImpl<Key, Hash, Eq>::FreeSlab(
     node_mgr_impl_.FreeUntouched(slab_ptr);
 }
 
+template <typename Key, typename Hash, typename Eq>
+__device__ void SlabHashBackendImpl<Key, Hash, Eq>::WarpCompact(
+        uint32_t lane_id, uint32_t bucket_id) {
+    const uint32_t kEntriesPerSlab = kWarpSize - 1;
+
+    // Write cursor: entries are written in order to the slab write_slab_ptr,
+    // which already holds write_count entries, spilling over to its next slab.
+    // The cursor never passes the slab being read, so entries are only moved
+    // towards the head.
+    uint32_t write_slab_ptr = kHeadSlabAddr;
+    uint32_t write_count = 0;
+    uint32_t last_slab_ptr = kHeadSlabAddr;
+
+    uint32_t read_slab_ptr = kHeadSlabAddr;
+    while (read_slab_ptr != kEmptySlabAddr) {
+        uint32_t* read_entry_ptr =
+                SlabEntryPtr(bucket_id, lane_id, read_slab_ptr);
+        const uint32_t slab_entry = *read_entry_ptr;
+        const uint32_t next_slab_ptr = __shfl_sync(
+                kSyncLanesMask, slab_entry, kNextSlabPtrLaneId, kWarpSize);
+        const bool is_active =
+                lane_id != kNextSlabPtrLaneId && slab_entry != kEmptyNodeAddr;
+        const uint32_t active_mask = __ballot_sync(kSyncLanesMask, is_active);
+        const uint32_t num_active = __popc(active_mask);
+
+        // Next pointers are not modified until the end, so the spill-over slab
+        // can be read at any time.
+        const uint32_t write_next_slab_ptr =
+                *SlabEntryPtr(bucket_id, kNextSlabPtrLaneId, write_slab_ptr);
+
+        // Clear the read slab, then write its entries back at the cursor.
+        if (lane_id != kNextSlabPtrLaneId) {
+            *read_entry_ptr = kEmptyNodeAddr;
+        }
+        __syncwarp(kSyncLanesMask);
+        if (is_active) {
+            const uint32_t pos =
+                    write_count + __popc(active_mask & ((1u << lane_id) - 1));
+            const uint32_t dst_slab_ptr = (pos < kEntriesPerSlab)
+                                                  ? write_slab_ptr
+                                                  : write_next_slab_ptr;
+            *SlabEntryPtr(bucket_id, pos % kEntriesPerSlab, dst_slab_ptr) =
+                    slab_entry;
+        }
+        __syncwarp(kSyncLanesMask);
+
+        if (num_active > 0) {
+            last_slab_ptr = (write_count + num_active <= kEntriesPerSlab)
+                                    ? write_slab_ptr
+                                    : write_next_slab_ptr;
+            write_count += num_active;
+            if (write_count >= kEntriesPerSlab) {
+                write_count -= kEntriesPerSlab;
+                write_slab_ptr = write_next_slab_ptr;
+            }
+        }
+        read_slab_ptr = next_slab_ptr;
+    }
+
+    // Detach and free the slabs after the last one holding an entry.
+    uint32_t* last_next_ptr =
+            SlabEntryPtr(bucket_id, kNextSlabPtrLaneId, last_slab_ptr);
+    uint32_t slab_ptr = *last_next_ptr;
+    __syncwarp(kSyncLanesMask);
+    if (lane_id == 0) {
+        *last_next_ptr = kEmptySlabAddr;
+    }
+    while (slab_ptr != kEmptySlabAddr) {
+        const uint32_t next_slab_ptr =
+                *SlabEntryPtrFromNodes(slab_ptr, kNextSlabPtrLaneId);
+        __syncwarp(kSyncLanesMask);
+        node_mgr_impl_.WarpFree(slab_ptr, lane_id);
+        slab_ptr = next_slab_ptr;
+    }
+}
+
 template <typename Key, typename Hash, typename Eq>
 __global__ void InsertKernelPass0(SlabHashBackendImpl<Key, Hash, Eq> impl,
                                   const void* input_keys,
@@ -538,10 +630,50 @@ __global__ void InsertKernelPass1(SlabHashBackendImpl<Key, Hash, Eq> impl,
     }
 
     // Index out-of-bound threads still have to run for warp synchronization.
-    bool mask = impl.Insert(lane_active, lane_id, bucket_id, key, buf_index);
+    auto result = impl.Insert(lane_active, lane_id, bucket_id, key, buf_index);
+
+    if (tid < count) {
+        output_masks[tid] = result.second;
+    }
+}
+
+template <typename Key, typename Hash, typename Eq>
+__global__ void FindOrInsertKernelPass1(
+        SlabHashBackendImpl<Key, Hash, Eq> impl,
+        const void* input_keys,
+        const buf_index_t* prealloc_buf_indices,
+        buf_index_t* output_buf_indices,
+        bool* output_masks,
+        int64_t count) {
+    const Key* input_keys_templated = static_cast<const Key*>(input_keys);
+    uint32_t tid = threadIdx.x + blockIdx.x * blockDim.x;
+    uint32_t lane_id = tid & 0x1F;
+
+    if (tid - lane_id >= count) {
+        return;
+    }
+
+    impl.node_mgr_impl_.Init(tid, lane_id);
+
+    bool lane_active = false;
+    uint32_t bucket_id = 0;
+    buf_index_t buf_index = 0;
+
+    // Dummy for warp sync.
+    Key key;
+    if (tid < count) {
+        lane_active = true;
+        key = input_keys_templated[tid];
+        buf_index = prealloc_buf_indices[tid];
+        bucket_id = impl.ComputeBucket(key);
+    }
+
+    // Index out-of-bound threads still have to run for warp synchronization.
+    auto result = impl.Insert(lane_active, lane_id, bucket_id, key, buf_index);
 
     if (tid < count) {
-        output_masks[tid] = mask;
+        output_buf_indices[tid] = result.first;
+        output_masks[tid] = result.second;
     }
 }
 
@@ -740,5 +872,19 @@ __global__ void CountElemsPerBucketKernel(
     }
 }
 
+template <typename Key, typename Hash, typename Eq>
+__global__ void CompactSlabsKernel(SlabHashBackendImpl<Key, Hash, Eq> impl) {
+    uint32_t tid = threadIdx.x + blockIdx.x * blockDim.x;
+    uint32_t lane_id = threadIdx.x & 0x1F;
+
+    // Assigning a warp per bucket.
+    uint32_t bucket_id = tid >> 5;
+    if (bucket_id >= impl.bucket_count_) {
+        return;
+    }
+
+    impl.WarpCompact(lane_id, bucket_id);
+}
+
 }  // namespace core
 }  // namespace open3d
@@ -62,6 +62,15 @@ static constexpr uint32_t kSlabsPerBlock = 1024;
 static constexpr uint32_t kMaxKeyByteSize = 32;
 static constexpr uint32_t kThreadsPerBlock = 128;
 
+// Max average number of entries per bucket for growing without rehashing.
+static constexpr uint32_t kGrowInPlaceMaxLoad = 8;
+
+// Erase checks the slab occupancy after every capacity / kSlabCompactionPeriod
+// erased entries, and compacts the buckets when fewer than
+// kSlabCompactionMinOccupancy of the allocated slabs are needed.
+static constexpr uint32_t kSlabCompactionPeriod = 8;
+static constexpr float kSlabCompactionMinOccupancy = 0.5f;
+
 //////////////////////
 // Combination of tunable variables
 //////////////////////
@@ -47,13 +47,16 @@ __global__ void CountSlabsPerSuperblockKernel(SlabNodeManagerImpl impl,
                                               uint32_t* slabs_per_superblock) {
     uint32_t tid = threadIdx.x + blockIdx.x * blockDim.x;
 
-    int num_bitmaps = kBlocksPerSuperBlock * 32;
+    int num_bitmaps = kBlocksPerSuperBlock * kWarpSize;
     if (tid >= num_bitmaps) {
         return;
     }
 
+    // The bitmaps of a memory block are strided by kSlabsPerBlock, matching
+    // SlabNodeManagerImpl::Init.
+    uint32_t bitmap_idx = (tid / kWarpSize) * kSlabsPerBlock + tid % kWarpSize;
     for (uint32_t i = 0; i < kSuperBlocks; i++) {
-        uint32_t read_bitmap = *(impl.get_ptr_for_bitmap(i, tid));
+        uint32_t read_bitmap = *(impl.get_ptr_for_bitmap(i, bitmap_idx));
         atomicAdd(&slabs_per_superblock[i], __popc(read_bitmap));
     }
 }
@@ -41,8 +41,10 @@
 #pragma once
 
 #include <thrust/device_vector.h>
+#include <thrust/execution_policy.h>
 
 #include <memory>
+#include <numeric>
 #include <random>
 
 #include "open3d/core/CUDAUtils.h"
@@ -158,6 +160,17 @@ public:
                   ~(1 << (getMemUnitIndex(ptr) & 0x1F)));
     }
 
+    // This function frees a slab that may have been written to, by a full
+    // warp. The slab is reset to empty first, since WarpAllocate hands out
+    // slabs without clearing them.
+    __device__ void WarpFree(buf_index_t ptr, const uint32_t& lane_id) {
+        *get_unit_ptr_from_slab(ptr, lane_id) = kEmptySlabAddr;
+        __syncwarp(kSyncLanesMask);
+        if (lane_id == 0) {
+            FreeUntouched(ptr);
+        }
+    }
+
 private:
     __device__ __host__ __forceinline__ uint32_t
     getSuperBlockIndex(buf_index_t address) const {
@@ -253,17 +266,19 @@ public:
     ~SlabNodeManager() { MemoryManager::Free(impl_.super_blocks_, device_); }
 
     void Reset() {
-        OPEN3D_CUDA_CHECK(cudaMemset(
+        OPEN3D_CUDA_CHECK(cudaMemsetAsync(
                 impl_.super_blocks_, 0xFF,
-                kUIntsPerSuperBlock * kSuperBlocks * sizeof(uint32_t)));
+                kUIntsPerSuperBlock * kSuperBlocks * sizeof(uint32_t),
+                core::cuda::GetStream()));
 
         for (uint32_t i = 0; i < kSuperBlocks; i++) {
             // setting bitmaps into zeros:
-            OPEN3D_CUDA_CHECK(cudaMemset(
+            OPEN3D_CUDA_CHECK(cudaMemsetAsync(
                     impl_.super_blocks_ + i * kUIntsPerSuperBlock, 0x00,
-                    kBlocksPerSuperBlock * kSlabsPerBlock * sizeof(uint32_t)));
+                    kBlocksPerSuperBlock * kSlabsPerBlock * sizeof(uint32_t),
+                    core::cuda::GetStream()));
         }
-        cuda::Synchronize();
+        cuda::SynchronizeStream();
         OPEN3D_CUDA_CHECK(cudaGetLastError());
     }
 
@@ -271,26 +286,35 @@ public:
         const uint32_t num_super_blocks = kSuperBlocks;
 
         thrust::device_vector<uint32_t> slabs_per_superblock(kSuperBlocks);
-        thrust::fill(slabs_per_superblock.begin(), slabs_per_superblock.end(),
+        thrust::fill(thrust::cuda::par.on(core::cuda::GetStream()),
+                     slabs_per_superblock.begin(), slabs_per_superblock.end(),
                      0);
 
-        // Counting total number of allocated memory units.
-        int num_mem_units = kBlocksPerSuperBlock * 32;
+        // One thread per bitmap of a super block, each covering 32 slabs.
+        int num_bitmaps = kBlocksPerSuperBlock * kWarpSize;
         int num_cuda_blocks =
-                (num_mem_units + kThreadsPerBlock - 1) / kThreadsPerBlock;
+                (num_bitmaps + kThreadsPerBlock - 1) / kThreadsPerBlock;
         CountSlabsPerSuperblockKernel<<<num_cuda_blocks, kThreadsPerBlock, 0,
                                         core::cuda::GetStream()>>>(
                 impl_, thrust::raw_pointer_cast(slabs_per_superblock.data()));
-        cuda::Synchronize();
+        cuda::SynchronizeStream();
         OPEN3D_CUDA_CHECK(cudaGetLastError());
 
         std::vector<int> result(num_super_blocks);
-        thrust::copy(slabs_per_superblock.begin(), slabs_per_superblock.end(),
+        thrust::copy(thrust::cuda::par.on(core::cuda::GetStream()),
+                     slabs_per_superblock.begin(), slabs_per_superblock.end(),
                      result.begin());
 
         return result;
     }
 
+    /// Total number of slabs allocated from the super blocks.
+    int64_t CountSlabs() {
+        std::vector<int> slabs_per_superblock = CountSlabsPerSuperblock();
+        return std::accumulate(slabs_per_superblock.begin(),
+                               slabs_per_superblock.end(), int64_t(0));
+    }
+
 public:
     SlabNodeManagerImpl impl_;
     Device device_;
@@ -28,6 +28,7 @@
 
 #include <stdgpu/memory.h>
 #include <thrust/device_vector.h>
+#include <thrust/execution_policy.h>
 #include <thrust/transform.h>
 
 #include <stdgpu/unordered_map.cuh>
@@ -152,6 +153,12 @@ public:
               bool* output_masks,
               int64_t count) override;
 
+    void FindOrInsert(const void* input_keys,
+                      const std::vector<const void*>& input_values_soa,
+                      buf_index_t* output_buf_indices,
+                      bool* output_masks,
+                      int64_t count) override;
+
     void Erase(const void* input_keys,
                bool* output_masks,
                int64_t count) override;
@@ -228,7 +235,7 @@ void StdGPUHashBackend<Key, Hash, Eq>::Find(const void* input_keys,
     STDGPUFindKernel<<<blocks, threads, 0, core::cuda::GetStream()>>>(
             impl_, buffer_accessor_, static_cast<const Key*>(input_keys),
             output_buf_indices, output_masks, count);
-    cuda::Synchronize(this->device_);
+    cuda::SynchronizeStream(this->device_);
 }
 
 // Need an explicit kernel for non-const access to map
@@ -271,7 +278,7 @@ void StdGPUHashBackend<Key, Hash, Eq>::Erase(const void* input_keys,
     STDGPUEraseKernel<<<blocks, threads, 0, core::cuda::GetStream()>>>(
             impl_, buffer_accessor_, static_cast<const Key*>(input_keys),
             output_buf_indices, output_masks, count);
-    cuda::Synchronize(this->device_);
+    cuda::SynchronizeStream(this->device_);
 }
 
 template <typename Key>
@@ -287,7 +294,8 @@ int64_t StdGPUHashBackend<Key, Hash, Eq>::GetActiveIndices(
         buf_index_t* output_indices) {
     auto range = impl_.device_range();
 
-    thrust::transform(range.begin(), range.end(), output_indices,
+    thrust::transform(thrust::cuda::par.on(core::cuda::GetStream()),
+                      range.begin(), range.end(), output_indices,
                       ValueExtractor<Key>());
 
     return impl_.size();
@@ -397,7 +405,55 @@ void StdGPUHashBackend<Key, Hash, Eq>::Insert(
                                 ptr_input_values_soa, output_buf_indices,
                                 output_masks, count, n_values);
             });
-    cuda::Synchronize(this->device_);
+    cuda::SynchronizeStream(this->device_);
+}
+
+template <typename Key, typename Hash, typename Eq>
+__global__ void STDGPUFindMissingKernel(
+        InternalStdGPUHashBackend<Key, Hash, Eq> map,
+        const Key* input_keys,
+        buf_index_t* output_buf_indices,
+        const bool* output_masks,
+        int64_t count) {
+    uint32_t tid = threadIdx.x + blockIdx.x * blockDim.x;
+    if (tid >= count || output_masks[tid]) return;
+
+    auto iter = map.find(input_keys[tid]);
+    output_buf_indices[tid] = iter->second;
+}
+
+template <typename Key, typename Hash, typename Eq>
+void StdGPUHashBackend<Key, Hash, Eq>::FindOrInsert(
+        const void* input_keys,
+        const std::vector<const void*>& input_values_soa,
+        buf_index_t* output_buf_indices,
+        bool* output_masks,
+        int64_t count) {
+    uint32_t threads = 128;
+    uint32_t blocks = (count + threads - 1) / threads;
+
+    thrust::device_vector<const void*> input_values_soa_device(
+            input_values_soa.begin(), input_values_soa.end());
+
+    int64_t n_values = input_values_soa.size();
+    const void* const* ptr_input_values_soa =
+            thrust::raw_pointer_cast(input_values_soa_device.data());
+
+    // Failed insertions may see the dummy index of a concurrent insertion,
+    // so their indices are looked up in a second kernel on the same stream.
+    DISPATCH_DIVISOR_SIZE_TO_BLOCK_T(
+            buffer_accessor_.common_block_size_, [&]() {
+                STDGPUInsertKernel<Key, Hash, Eq, block_t>
+                        <<<blocks, threads, 0, core::cuda::GetStream()>>>(
+                                impl_, buffer_accessor_,
+                                static_cast<const Key*>(input_keys),
+                                ptr_input_values_soa, output_buf_indices,
+                                output_masks, count, n_values);
+            });
+    STDGPUFindMissingKernel<<<blocks, threads, 0, core::cuda::GetStream()>>>(
+            impl_, static_cast<const Key*>(input_keys), output_buf_indices,
+            output_masks, count);
+    cuda::SynchronizeStream(this->device_);
 }
 
 template <typename Key, typename Hash, typename Eq>
@@ -56,6 +56,11 @@ public:
     /// 4) deallocating old hash table
     virtual void Reserve(int64_t capacity) = 0;
 
+    /// Grow the capacity to \p capacity without rebuilding the hash map.
+    /// Stored entries keep their buffer indices. Return false if the backend
+    /// cannot grow in place, in which case a full rebuild is required.
+    virtual bool GrowInPlace(int64_t capacity) { return false; }
+
     /// Parallel insert contiguous arrays of keys and values.
     virtual void Insert(const void* input_keys,
                         const std::vector<const void*>& input_values,
@@ -69,6 +74,15 @@ public:
                       bool* output_masks,
                       int64_t count) = 0;
 
+    /// Parallel find a contiguous array of keys, and insert the keys that
+    /// are missing. Output buffer indices are valid for all the keys, and
+    /// output masks indicate whether a key is newly inserted.
+    virtual void FindOrInsert(const void* input_keys,
+                              const std::vector<const void*>& input_values,
+                              buf_index_t* output_buf_indices,
+                              bool* output_masks,
+                              int64_t count) = 0;
+
     /// Parallel erase a contiguous array of keys.
     virtual void Erase(const void* input_keys,
                        bool* output_masks,
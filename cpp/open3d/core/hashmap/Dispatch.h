@@ -61,6 +61,17 @@
                 DIM, __FILE__);                                          \
     }
 
+// Int16 keys can be compiled out with BUILD_DISABLED_DTYPES, see
+// core/Dispatch.h.
+#ifdef OPEN3D_DISABLE_DTYPE_INT16
+#define OPEN3D_DISPATCH_HASH_CASE_INT16(DTYPE, DIM, ...)
+#else
+#define OPEN3D_DISPATCH_HASH_CASE_INT16(DTYPE, DIM, ...) \
+    else if (DTYPE == open3d::core::Int16) {             \
+        DIM_SWITCHER(short, DIM, __VA_ARGS__)            \
+    }
+#endif
+
 // TODO: dispatch more combinations.
 #define DISPATCH_DTYPE_AND_DIM_TO_TEMPLATE(DTYPE, DIM, ...)                   \
     [&] {                                                                     \
@@ -68,9 +79,9 @@
             DIM_SWITCHER(int64_t, DIM, __VA_ARGS__)                           \
         } else if (DTYPE == open3d::core::Int32) {                            \
             DIM_SWITCHER(int, DIM, __VA_ARGS__)                               \
-        } else if (DTYPE == open3d::core::Int16) {                            \
-            DIM_SWITCHER(short, DIM, __VA_ARGS__)                             \
-        } else {                                                              \
+        }                                                                     \
+        OPEN3D_DISPATCH_HASH_CASE_INT16(DTYPE, DIM, __VA_ARGS__)              \
+        else {                                                                \
             utility::LogError(                                                \
                     "Unsupported dtype {}, please use integer types (Int64, " \
                     "Int32, Int16).",                                         \
@@ -141,5 +152,66 @@ public:
     }
 };
 
+/// Specialization for packed 3xInt32 voxel / block coordinates, the most
+/// common key type. The coordinates are combined in a single 64-bit word and
+/// mixed with a MurmurHash3 finalizer, so that neighboring coordinates spread
+/// over all bits instead of only the low ones.
+template <>
+struct MiniVecHash<int, 3> {
+public:
+    OPEN3D_HOST_DEVICE uint64_t operator()(const MiniVec<int, 3>& key) const {
+        uint64_t hash = static_cast<uint64_t>(static_cast<uint32_t>(key[0])) *
+                        UINT64_C(73856093);
+        hash ^= static_cast<uint64_t>(static_cast<uint32_t>(key[1])) *
+                UINT64_C(19349669);
+        hash ^= static_cast<uint64_t>(static_cast<uint32_t>(key[2])) *
+                UINT64_C(83492791);
+        hash ^= hash >> 33;
+        hash *= UINT64_C(0xff51afd7ed558ccd);
+        hash ^= hash >> 33;
+        hash *= UINT64_C(0xc4ceb9fe1a85ec53);
+        hash ^= hash >> 33;
+        return hash;
+    }
+};
+
+/// Branch-free comparison of 3xInt32 keys with a single final test.
+template <>
+struct MiniVecEq<int, 3> {
+public:
+    OPEN3D_HOST_DEVICE bool operator()(const MiniVec<int, 3>& lhs,
+                                       const MiniVec<int, 3>& rhs) const {
+        return ((lhs[0] ^ rhs[0]) | (lhs[1] ^ rhs[1]) | (lhs[2] ^ rhs[2])) ==
+               0;
+    }
+};
+
+/// Specialization for single-word Int64 keys, e.g. Morton codes. Their low
+/// bits are highly structured, so the word is mixed with the SplitMix64
+/// finalizer instead of a single FNV round.
+template <>
+struct MiniVecHash<int64_t, 1> {
+public:
+    OPEN3D_HOST_DEVICE uint64_t
+    operator()(const MiniVec<int64_t, 1>& key) const {
+        uint64_t hash = static_cast<uint64_t>(key[0]);
+        hash ^= hash >> 30;
+        hash *= UINT64_C(0xbf58476d1ce4e5b9);
+        hash ^= hash >> 27;
+        hash *= UINT64_C(0x94d049bb133111eb);
+        hash ^= hash >> 31;
+        return hash;
+    }
+};
+
+template <>
+struct MiniVecEq<int64_t, 1> {
+public:
+    OPEN3D_HOST_DEVICE bool operator()(const MiniVec<int64_t, 1>& lhs,
+                                       const MiniVec<int64_t, 1>& rhs) const {
+        return lhs[0] == rhs[0];
+    }
+};
+
 }  // namespace utility
 }  // namespace open3d
@@ -89,6 +89,36 @@ void HashBackendBuffer::ResetHeap() {
     }
 }
 
+void HashBackendBuffer::Grow(int64_t capacity) {
+    const int64_t old_capacity = GetCapacity();
+    if (capacity <= old_capacity) {
+        utility::LogError("New capacity {} must be larger than {}.", capacity,
+                          old_capacity);
+    }
+    Device device = GetDevice();
+
+    // Indices in [0, heap_top) are in use and the ones above are free, so the
+    // new indices can be appended to the tail of the heap.
+    Tensor heap({capacity}, core::UInt32, device);
+    heap.Slice(0, 0, old_capacity) = heap_;
+    heap.Slice(0, old_capacity, capacity) =
+            Tensor::Arange(old_capacity, capacity, 1, core::Int64, device)
+                    .To(core::UInt32);
+    heap_ = heap;
+
+    auto grow_buffer = [&](const Tensor &buffer) {
+        Tensor grown({capacity}, buffer.GetDtype(), device);
+        MemoryManager::Memcpy(grown.GetDataPtr(), device, buffer.GetDataPtr(),
+                              device,
+                              old_capacity * buffer.GetDtype().ByteSize());
+        return grown;
+    };
+    key_buffer_ = grow_buffer(key_buffer_);
+    for (auto &value_buffer : value_buffers_) {
+        value_buffer = grow_buffer(value_buffer);
+    }
+}
+
 Device HashBackendBuffer::GetDevice() const { return heap_.GetDevice(); }
 
 int64_t HashBackendBuffer::GetCapacity() const { return heap_.GetLength(); }
@@ -77,6 +77,11 @@ public:
     /// Reset the heap and heap top.
     void ResetHeap();
 
+    /// Grow the buffers to \p capacity in place. Stored keys and values keep
+    /// their buffer indices, and the new indices are appended to the free
+    /// part of the heap. Values of the new entries are not initialized.
+    void Grow(int64_t capacity);
+
     /// Return device of the buffer.
     Device GetDevice() const;
 
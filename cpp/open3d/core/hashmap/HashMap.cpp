@@ -26,11 +26,13 @@
 
 #include "open3d/core/hashmap/HashMap.h"
 
+#include "open3d/core/MemoryManagerStatistic.h"
 #include "open3d/core/Tensor.h"
 #include "open3d/core/hashmap/DeviceHashBackend.h"
 #include "open3d/t/io/HashMapIO.h"
 #include "open3d/utility/Helper.h"
 #include "open3d/utility/Logging.h"
+#include "open3d/utility/Tracing.h"
 
 namespace open3d {
 namespace core {
@@ -64,12 +66,18 @@ HashMap::HashMap(int64_t init_capacity,
 }
 
 void HashMap::Reserve(int64_t capacity) {
+    ScopedMemoryTag memory_tag("hashmap");
     int64_t count = Size();
     if (capacity <= count) {
         utility::LogDebug("Target capacity smaller then current size, abort.");
         return;
     }
 
+    // Amortized growth keeps buffer indices and avoids the rebuild below.
+    if (capacity > GetCapacity() && device_hashmap_->GrowInPlace(capacity)) {
+        return;
+    }
+
     Tensor active_keys;
     std::vector<Tensor> active_values;
 
@@ -115,6 +123,20 @@ std::pair<Tensor, Tensor> HashMap::Activate(const Tensor& input_keys) {
     return std::make_pair(output_buf_indices, output_masks);
 }
 
+std::pair<Tensor, Tensor> HashMap::FindOrInsert(const Tensor& input_keys) {
+    Tensor output_buf_indices, output_masks;
+    FindOrInsert(input_keys, output_buf_indices, output_masks);
+    return std::make_pair(output_buf_indices, output_masks);
+}
+
+std::pair<Tensor, Tensor> HashMap::FindOrInsert(
+        const Tensor& input_keys, const std::vector<Tensor>& input_values_soa) {
+    Tensor output_buf_indices, output_masks;
+    FindOrInsert(input_keys, input_values_soa, output_buf_indices,
+                 output_masks);
+    return std::make_pair(output_buf_indices, output_masks);
+}
+
 std::pair<Tensor, Tensor> HashMap::Find(const Tensor& input_keys) {
     Tensor output_buf_indices, output_masks;
     Find(input_keys, output_buf_indices, output_masks);
@@ -137,7 +159,10 @@ void HashMap::InsertImpl(const Tensor& input_keys,
                          const std::vector<Tensor>& input_values_soa,
                          Tensor& output_buf_indices,
                          Tensor& output_masks,
-                         bool is_activate_op) {
+                         bool is_activate_op,
+                         bool is_find_or_insert_op) {
+    OPEN3D_TRACE_ZONE("HashMap::Insert");
+    ScopedMemoryTag memory_tag("hashmap");
     CheckKeyCompatibility(input_keys);
     if (!is_activate_op) {
         CheckKeyValueLengthCompatibility(input_keys, input_values_soa);
@@ -153,10 +178,18 @@ void HashMap::InsertImpl(const Tensor& input_keys,
         input_values_ptrs.push_back(input_value.GetDataPtr());
     }
 
-    device_hashmap_->Insert(
-            input_keys.GetDataPtr(), input_values_ptrs,
-            static_cast<buf_index_t*>(output_buf_indices.GetDataPtr()),
-            output_masks.GetDataPtr<bool>(), length);
+    buf_index_t* output_buf_indices_ptr =
+            static_cast<buf_index_t*>(output_buf_indices.GetDataPtr());
+    if (is_find_or_insert_op) {
+        device_hashmap_->FindOrInsert(
+                input_keys.GetDataPtr(), input_values_ptrs,
+                output_buf_indices_ptr, output_masks.GetDataPtr<bool>(),
+                length);
+    } else {
+        device_hashmap_->Insert(input_keys.GetDataPtr(), input_values_ptrs,
+                                output_buf_indices_ptr,
+                                output_masks.GetDataPtr<bool>(), length);
+    }
 }
 
 void HashMap::Insert(const Tensor& input_keys,
@@ -197,9 +230,42 @@ void HashMap::Activate(const Tensor& input_keys,
                /* is_activate_op */ true);
 }
 
+void HashMap::FindOrInsert(const Tensor& input_keys,
+                           Tensor& output_buf_indices,
+                           Tensor& output_masks) {
+    int64_t length = input_keys.GetLength();
+    int64_t new_size = Size() + length;
+    int64_t capacity = GetCapacity();
+
+    if (new_size > capacity) {
+        Reserve(std::max(new_size, capacity * 2));
+    }
+
+    std::vector<Tensor> null_tensors_soa;
+    InsertImpl(input_keys, null_tensors_soa, output_buf_indices, output_masks,
+               /* is_activate_op */ true, /* is_find_or_insert_op */ true);
+}
+
+void HashMap::FindOrInsert(const Tensor& input_keys,
+                           const std::vector<Tensor>& input_values_soa,
+                           Tensor& output_buf_indices,
+                           Tensor& output_masks) {
+    int64_t length = input_keys.GetLength();
+    int64_t new_size = Size() + length;
+    int64_t capacity = GetCapacity();
+
+    if (new_size > capacity) {
+        Reserve(std::max(new_size, capacity * 2));
+    }
+    InsertImpl(input_keys, input_values_soa, output_buf_indices, output_masks,
+               /* is_activate_op */ false, /* is_find_or_insert_op */ true);
+}
+
 void HashMap::Find(const Tensor& input_keys,
                    Tensor& output_buf_indices,
                    Tensor& output_masks) {
+    OPEN3D_TRACE_ZONE("HashMap::Find");
+    ScopedMemoryTag memory_tag("hashmap");
     CheckKeyLength(input_keys);
     CheckKeyCompatibility(input_keys);
 
@@ -234,6 +300,28 @@ void HashMap::GetActiveIndices(Tensor& output_buf_indices) const {
 
 void HashMap::Clear() { device_hashmap_->Clear(); }
 
+std::pair<Tensor, Tensor> HashMap::Compact() {
+    Tensor old_buf_indices = GetActiveIndices();
+    if (old_buf_indices.GetLength() == 0) {
+        Clear();
+        return std::make_pair(old_buf_indices, old_buf_indices.Clone());
+    }
+
+    Tensor active_indices = old_buf_indices.To(core::Int64);
+    Tensor active_keys = GetKeyTensor().IndexGet({active_indices});
+    std::vector<Tensor> active_values;
+    for (auto& value_buffer : GetValueTensors()) {
+        active_values.emplace_back(value_buffer.IndexGet({active_indices}));
+    }
+
+    // Clear resets the heap to the identity, so reinsertion takes the buffer
+    // indices [0, Size()) without reallocating the buffers.
+    Clear();
+    Tensor new_buf_indices, masks;
+    InsertImpl(active_keys, active_values, new_buf_indices, masks);
+    return std::make_pair(old_buf_indices, new_buf_indices);
+}
+
 void HashMap::Save(const std::string& file_name) {
     t::io::WriteHashMap(file_name, *this);
 }
@@ -367,6 +455,7 @@ void HashMap::Init(int64_t init_capacity,
         }
     }
 
+    ScopedMemoryTag memory_tag("hashmap");
     device_hashmap_ = CreateDeviceHashBackend(
             init_capacity, key_dtype_, key_element_shape_, dtypes_value_,
             element_shapes_value_, device, backend);
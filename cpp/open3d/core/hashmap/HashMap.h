@@ -35,7 +35,9 @@ namespace core {
 
 class DeviceHashBackend;
 
-enum class HashBackendType { Slab, StdGPU, TBB, Default };
+/// Hash backends: Slab and StdGPU on CUDA; TBB and Flat (open addressing with
+/// linear probing) on CPU. Default resolves to StdGPU on CUDA and TBB on CPU.
+enum class HashBackendType { Slab, StdGPU, TBB, Flat, Default };
 
 class HashMap {
 public:
@@ -62,7 +64,10 @@ public:
     /// Default destructor.
     ~HashMap() = default;
 
-    /// Reserve the internal hash map with the given capacity by rehashing.
+    /// Reserve the internal hash map with the given capacity. Backends that
+    /// support in-place growth (TBB, Flat, Slab) keep the buffer indices of
+    /// stored entries; otherwise the hash map is rebuilt and the indices
+    /// change.
     void Reserve(int64_t capacity);
 
     /// Parallel insert arrays of keys and values in Tensors.
@@ -91,6 +96,21 @@ public:
     /// as in Insert.
     std::pair<Tensor, Tensor> Activate(const Tensor& input_keys);
 
+    /// Parallel find an array of keys in Tensor, and activate the keys that
+    /// are not found. Replaces Activate followed by Find with a single pass.
+    /// Return: output_buf_indices stores buffer indices of all the keys,
+    /// either found or newly activated.
+    /// Return: output_masks stores if the key is newly activated.
+    std::pair<Tensor, Tensor> FindOrInsert(const Tensor& input_keys);
+
+    /// Parallel find an array of keys in Tensor, and insert the keys that are
+    /// not found with the corresponding values in a structure of arrays.
+    /// Return: output_buf_indices and output_masks, their roles are the same
+    /// as in FindOrInsert with keys only.
+    std::pair<Tensor, Tensor> FindOrInsert(
+            const Tensor& input_keys,
+            const std::vector<Tensor>& input_values_soa);
+
     /// Parallel find an array of keys in Tensor.
     /// Return: output_buf_indices, its role is the same as in Insert.
     /// Return: output_masks stores if the finding is a success or failure (key
@@ -130,6 +150,21 @@ public:
                   Tensor& output_buf_indices,
                   Tensor& output_masks);
 
+    /// Same as FindOrInsert with keys only, but takes output_buf_indices
+    /// and output_masks as input. If their shapes and types match,
+    /// reallocation is not needed.
+    void FindOrInsert(const Tensor& input_keys,
+                      Tensor& output_buf_indices,
+                      Tensor& output_masks);
+
+    /// Same as FindOrInsert with a SoA of values, but takes output_buf_indices
+    /// and output_masks as input. If their shapes and types match,
+    /// reallocation is not needed.
+    void FindOrInsert(const Tensor& input_keys,
+                      const std::vector<Tensor>& input_values_soa,
+                      Tensor& output_buf_indices,
+                      Tensor& output_masks);
+
     /// Same as Find, but takes output_buf_indices
     /// and output_masks as input. If their shapes and types match, reallocation
     /// is not needed.
@@ -148,6 +183,12 @@ public:
     /// Clear stored map without reallocating the buffers.
     void Clear();
 
+    /// Defragment the buffers after erasure by moving the active entries to
+    /// buffer indices [0, Size()). The capacity is unchanged.
+    /// Return: old_buf_indices and new_buf_indices, where the i-th active
+    /// entry is moved from old_buf_indices[i] to new_buf_indices[i].
+    std::pair<Tensor, Tensor> Compact();
+
     /// Save active keys and values to a npz file at 'key' and 'value_{:03d}'.
     /// The number of values is stored in 'n_values'.
     /// The file name should end with 'npz', otherwise 'npz' will be added as an
@@ -211,7 +252,8 @@ protected:
                     const std::vector<Tensor>& input_values_soa,
                     Tensor& output_buf_indices,
                     Tensor& output_masks,
-                    bool is_activate_op = false);
+                    bool is_activate_op = false,
+                    bool is_find_or_insert_op = false);
 
     void CheckKeyLength(const Tensor& input_keys) const;
     void CheckKeyValueLengthCompatibility(
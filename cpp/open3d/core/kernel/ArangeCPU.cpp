@@ -29,24 +29,64 @@
 #include "open3d/core/Tensor.h"
 #include "open3d/core/kernel/Arange.h"
 
+#ifdef BUILD_ISPC_MODULE
+#include "ArangeCPU_ispc.h"
+#endif
+
 namespace open3d {
 namespace core {
 namespace kernel {
 
+template <typename scalar_t>
+static inline scalar_t ArangeElement(scalar_t start,
+                                     scalar_t step,
+                                     int64_t idx) {
+    return start + static_cast<scalar_t>(step * idx);
+}
+
+template <typename scalar_t>
+static void LaunchArangeKernel(scalar_t start,
+                               scalar_t step,
+                               scalar_t* dst,
+                               int64_t n) {
+    ParallelFor(Device("CPU:0"), n, [&](int64_t workload_idx) {
+        dst[workload_idx] = ArangeElement(start, step, workload_idx);
+    });
+}
+
+#ifdef BUILD_ISPC_MODULE
+#define OPEN3D_ARANGE_ISPC_(T)                                                \
+    static void LaunchArangeKernel(T start, T step, T* dst, int64_t n) {      \
+        ParallelFor(                                                          \
+                Device("CPU:0"), n,                                           \
+                [&](int64_t workload_idx) {                                   \
+                    dst[workload_idx] =                                       \
+                            ArangeElement(start, step, workload_idx);         \
+                },                                                            \
+                OPEN3D_VECTORIZED(CPUArangeKernel_##T, start, step, dst));    \
+    }
+
+OPEN3D_ARANGE_ISPC_(uint8_t)
+OPEN3D_ARANGE_ISPC_(int8_t)
+OPEN3D_ARANGE_ISPC_(uint16_t)
+OPEN3D_ARANGE_ISPC_(int16_t)
+OPEN3D_ARANGE_ISPC_(uint32_t)
+OPEN3D_ARANGE_ISPC_(int32_t)
+OPEN3D_ARANGE_ISPC_(uint64_t)
+OPEN3D_ARANGE_ISPC_(int64_t)
+OPEN3D_ARANGE_ISPC_(float)
+OPEN3D_ARANGE_ISPC_(double)
+#undef OPEN3D_ARANGE_ISPC_
+#endif
+
 void ArangeCPU(const Tensor& start,
                const Tensor& stop,
                const Tensor& step,
                Tensor& dst) {
     Dtype dtype = start.GetDtype();
     DISPATCH_DTYPE_TO_TEMPLATE(dtype, [&]() {
-        scalar_t sstart = start.Item<scalar_t>();
-        scalar_t sstep = step.Item<scalar_t>();
-        scalar_t* dst_ptr = dst.GetDataPtr<scalar_t>();
-        int64_t n = dst.GetLength();
-        ParallelFor(start.GetDevice(), n, [&](int64_t workload_idx) {
-            dst_ptr[workload_idx] =
-                    sstart + static_cast<scalar_t>(sstep * workload_idx);
-        });
+        LaunchArangeKernel(start.Item<scalar_t>(), step.Item<scalar_t>(),
+                           dst.GetDataPtr<scalar_t>(), dst.GetLength());
     });
 }
 
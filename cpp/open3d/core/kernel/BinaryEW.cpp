@@ -68,6 +68,21 @@ void BinaryEW(const Tensor& lhs,
                 broadcasted_input_shape, dst.GetShape());
     }
 
+    // Half precision tensors are computed in Float32 and rounded on store.
+    if (lhs.GetDtype().IsHalf() || rhs.GetDtype().IsHalf()) {
+        Tensor dst_float =
+                dst.GetDtype().IsHalf()
+                        ? Tensor::Empty(dst.GetShape(), core::Float32,
+                                        dst.GetDevice())
+                        : dst;
+        BinaryEW(lhs.To(core::Float32), rhs.To(core::Float32), dst_float,
+                 op_code);
+        if (dst_float.GetDtype() != dst.GetDtype()) {
+            dst.AsRvalue() = dst_float;
+        }
+        return;
+    }
+
     Device::DeviceType device_type = lhs.GetDevice().GetType();
     if (device_type == Device::DeviceType::CPU) {
         BinaryEWCPU(lhs, rhs, dst, op_code);
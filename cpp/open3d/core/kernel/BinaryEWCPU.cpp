@@ -42,9 +42,66 @@ namespace open3d {
 namespace core {
 namespace kernel {
 
+template <typename src_t,
+          typename dst_t,
+          IndexerLayout rhs_layout,
+          typename element_func_t>
+static void LaunchDenseBinaryEWKernel(const Indexer& indexer,
+                                      const element_func_t& element_func) {
+    ParallelFor(Device("CPU:0"), indexer.NumWorkloads(),
+                [&indexer, &element_func](int64_t i) {
+                    element_func(
+                            indexer.GetInputPtr<src_t,
+                                                IndexerLayout::Contiguous>(0,
+                                                                           i),
+                            indexer.GetInputPtr<src_t, rhs_layout>(1, i),
+                            indexer.GetOutputPtr<dst_t,
+                                                 IndexerLayout::Contiguous>(i));
+                });
+}
+
+/// Launches \p element_func with the operand layouts resolved at compile time
+/// if the LHS and the output are contiguous. Returns false if the layouts have
+/// no specialization, in which case the generic kernel shall be used.
+///
+/// \param specialize_contiguous If false, the all-contiguous case is left to
+/// the caller, e.g. for the ISPC kernels.
+template <typename src_t, typename dst_t, typename element_func_t>
+static bool LaunchDenseBinaryEWKernel(const Indexer& indexer,
+                                      const element_func_t& element_func,
+                                      bool specialize_contiguous) {
+    if (indexer.GetInputLayout(0) != IndexerLayout::Contiguous ||
+        indexer.GetOutputLayout() != IndexerLayout::Contiguous) {
+        return false;
+    }
+    switch (indexer.GetInputLayout(1)) {
+        case IndexerLayout::Contiguous:
+            if (!specialize_contiguous) {
+                return false;
+            }
+            LaunchDenseBinaryEWKernel<src_t, dst_t, IndexerLayout::Contiguous>(
+                    indexer, element_func);
+            return true;
+        case IndexerLayout::Scalar:
+            LaunchDenseBinaryEWKernel<src_t, dst_t, IndexerLayout::Scalar>(
+                    indexer, element_func);
+            return true;
+        case IndexerLayout::InnerBroadcast:
+            LaunchDenseBinaryEWKernel<src_t, dst_t,
+                                      IndexerLayout::InnerBroadcast>(
+                    indexer, element_func);
+            return true;
+        default:
+            return false;
+    }
+}
+
 template <typename src_t, typename dst_t, typename element_func_t>
 static void LaunchBinaryEWKernel(const Indexer& indexer,
                                  const element_func_t& element_func) {
+    if (LaunchDenseBinaryEWKernel<src_t, dst_t>(indexer, element_func, true)) {
+        return;
+    }
     ParallelFor(Device("CPU:0"), indexer.NumWorkloads(),
                 [&indexer, &element_func](int64_t i) {
                     element_func(indexer.GetInputPtr<src_t>(0, i),
@@ -60,6 +117,17 @@ template <typename src_t,
 static void LaunchBinaryEWKernel(const Indexer& indexer,
                                  const element_func_t& element_func,
                                  const vec_func_t& vec_func) {
+#ifdef BUILD_ISPC_MODULE
+    // The ISPC kernels vectorize the all-contiguous case, but compute the
+    // generic per-lane offsets for broadcast operands.
+    const bool specialize_contiguous = false;
+#else
+    const bool specialize_contiguous = true;
+#endif
+    if (LaunchDenseBinaryEWKernel<src_t, dst_t>(indexer, element_func,
+                                                specialize_contiguous)) {
+        return;
+    }
     ParallelFor(
             Device("CPU:0"), indexer.NumWorkloads(),
             [&indexer, &element_func](int64_t i) {
@@ -37,17 +37,52 @@ namespace kernel {
 
 // Cannot be a static function since on Windows a function enclosing
 // __host__ __device__ lambda function must have external linkage.
+template <typename src_t,
+          typename dst_t,
+          IndexerLayout rhs_layout,
+          typename func_t>
+void LaunchDenseBinaryEWKernel(const Device& device,
+                               const Indexer& indexer,
+                               const func_t& element_kernel) {
+    auto element_func = [=] OPEN3D_HOST_DEVICE(int64_t i) {
+        element_kernel(
+                indexer.GetInputPtr<src_t, IndexerLayout::Contiguous>(0, i),
+                indexer.GetInputPtr<src_t, rhs_layout>(1, i),
+                indexer.GetOutputPtr<dst_t, IndexerLayout::Contiguous>(i));
+    };
+    ParallelFor(device, indexer.NumWorkloads(), element_func);
+}
+
 template <typename src_t, typename dst_t, typename func_t>
 void LaunchBinaryEWKernel(const Device& device,
                           const Indexer& indexer,
                           const func_t& element_kernel) {
     OPEN3D_ASSERT_HOST_DEVICE_LAMBDA(func_t);
-    auto element_func = [=] OPEN3D_HOST_DEVICE(int64_t i) {
-        element_kernel(indexer.GetInputPtr<src_t>(0, i),
-                       indexer.GetInputPtr<src_t>(1, i),
-                       indexer.GetOutputPtr<dst_t>(i));
-    };
-    ParallelFor(device, indexer.NumWorkloads(), element_func);
+    // Resolve the common layouts at compile time to skip the per-element
+    // offset computation.
+    const IndexerLayout rhs_layout =
+            indexer.GetInputLayout(0) == IndexerLayout::Contiguous &&
+                            indexer.GetOutputLayout() ==
+                                    IndexerLayout::Contiguous
+                    ? indexer.GetInputLayout(1)
+                    : IndexerLayout::Strided;
+    if (rhs_layout == IndexerLayout::Contiguous) {
+        LaunchDenseBinaryEWKernel<src_t, dst_t, IndexerLayout::Contiguous>(
+                device, indexer, element_kernel);
+    } else if (rhs_layout == IndexerLayout::Scalar) {
+        LaunchDenseBinaryEWKernel<src_t, dst_t, IndexerLayout::Scalar>(
+                device, indexer, element_kernel);
+    } else if (rhs_layout == IndexerLayout::InnerBroadcast) {
+        LaunchDenseBinaryEWKernel<src_t, dst_t, IndexerLayout::InnerBroadcast>(
+                device, indexer, element_kernel);
+    } else {
+        auto element_func = [=] OPEN3D_HOST_DEVICE(int64_t i) {
+            element_kernel(indexer.GetInputPtr<src_t>(0, i),
+                           indexer.GetInputPtr<src_t>(1, i),
+                           indexer.GetOutputPtr<dst_t>(i));
+        };
+        ParallelFor(device, indexer.NumWorkloads(), element_func);
+    }
     OPEN3D_GET_LAST_CUDA_ERROR("LaunchBinaryEWKernel failed.");
 }
 
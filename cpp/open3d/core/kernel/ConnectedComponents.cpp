@@ -0,0 +1,77 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/core/kernel/ConnectedComponents.h"
+
+#include "open3d/core/Device.h"
+#include "open3d/core/TensorCheck.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+void ConnectedComponents(const Tensor& edges,
+                         int64_t num_nodes,
+                         Tensor& labels) {
+    AssertTensorDtype(edges, core::Int64);
+    AssertTensorShape(edges, {utility::nullopt, 2});
+    if (num_nodes < 0) {
+        utility::LogError("num_nodes must be non-negative, but got {}.",
+                          num_nodes);
+    }
+    if (edges.GetLength() > 0) {
+        const int64_t min_node = edges.Min({0, 1}).Item<int64_t>();
+        const int64_t max_node = edges.Max({0, 1}).Item<int64_t>();
+        if (min_node < 0 || max_node >= num_nodes) {
+            utility::LogError(
+                    "Edges reference nodes in [{}, {}], which is outside of "
+                    "[0, {}).",
+                    min_node, max_node, num_nodes);
+        }
+    }
+    labels = Tensor::Empty({num_nodes}, core::Int64, edges.GetDevice());
+    if (num_nodes == 0) {
+        return;
+    }
+    Device::DeviceType device_type = edges.GetDevice().GetType();
+    if (device_type == Device::DeviceType::CPU) {
+        ConnectedComponentsCPU(edges.Contiguous(), labels);
+    } else if (device_type == Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        ConnectedComponentsCUDA(edges.Contiguous(), labels);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("ConnectedComponents: Unimplemented device.");
+    }
+}
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,91 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#pragma once
+
+#include <atomic>
+#include <utility>
+
+#include "open3d/core/Tensor.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+/// Labels the connected components of the undirected graph with
+/// \p num_nodes nodes and the {E, 2} Int64 \p edges, with a parallel
+/// union-find. labels {num_nodes} Int64 [output] is the smallest node index
+/// in the component of each node, so the labels depend neither on the device
+/// nor on the order of the edges.
+void ConnectedComponents(const Tensor& edges,
+                         int64_t num_nodes,
+                         Tensor& labels);
+
+/// Root of \p x in a union-find forest whose roots are the smallest index of
+/// their component. Safe to call concurrently with UnionFindUnite.
+inline int64_t UnionFindRoot(std::atomic<int64_t>* parents, int64_t x) {
+    int64_t parent = parents[x].load(std::memory_order_relaxed);
+    while (parent != x) {
+        // Path halving. A lost race only skips a compression step.
+        const int64_t grandparent =
+                parents[parent].load(std::memory_order_relaxed);
+        parents[x].compare_exchange_weak(parent, grandparent,
+                                         std::memory_order_relaxed);
+        x = grandparent;
+        parent = parents[x].load(std::memory_order_relaxed);
+    }
+    return x;
+}
+
+/// Merges the components of \p a and \p b. Safe to call concurrently.
+inline void UnionFindUnite(std::atomic<int64_t>* parents,
+                           int64_t a,
+                           int64_t b) {
+    while (true) {
+        a = UnionFindRoot(parents, a);
+        b = UnionFindRoot(parents, b);
+        if (a == b) return;
+        if (a < b) std::swap(a, b);
+        // Link the larger root below the smaller one, unless another thread
+        // linked it in the meantime.
+        int64_t expected = a;
+        if (parents[a].compare_exchange_strong(expected, b,
+                                               std::memory_order_relaxed)) {
+            return;
+        }
+    }
+}
+
+void ConnectedComponentsCPU(const Tensor& edges, Tensor& labels);
+
+#ifdef BUILD_CUDA_MODULE
+void ConnectedComponentsCUDA(const Tensor& edges, Tensor& labels);
+#endif
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
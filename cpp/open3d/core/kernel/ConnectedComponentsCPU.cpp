@@ -0,0 +1,56 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/core/ParallelFor.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/core/kernel/ConnectedComponents.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+void ConnectedComponentsCPU(const Tensor& edges, Tensor& labels) {
+    static_assert(sizeof(std::atomic<int64_t>) == sizeof(int64_t),
+                  "std::atomic<int64_t> must have the size of int64_t.");
+    // The labels are the union-find forest, rooted at the component minima.
+    std::atomic<int64_t>* parents =
+            reinterpret_cast<std::atomic<int64_t>*>(labels.GetDataPtr());
+    const int64_t* edges_ptr = edges.GetDataPtr<int64_t>();
+    ParallelFor(Device("CPU:0"), labels.GetLength(), [&](int64_t i) {
+        parents[i].store(i, std::memory_order_relaxed);
+    });
+    ParallelFor(Device("CPU:0"), edges.GetLength(), [&](int64_t e) {
+        UnionFindUnite(parents, edges_ptr[2 * e], edges_ptr[2 * e + 1]);
+    });
+    ParallelFor(Device("CPU:0"), labels.GetLength(), [&](int64_t i) {
+        parents[i].store(UnionFindRoot(parents, i), std::memory_order_relaxed);
+    });
+}
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,93 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/core/CUDAUtils.h"
+#include "open3d/core/ParallelFor.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/core/kernel/ConnectedComponents.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+/// Device version of UnionFindRoot. The forest is read through a volatile
+/// pointer so that links made by other threads are observed when retrying.
+OPEN3D_DEVICE inline int64_t UnionFindRootCUDA(int64_t* parents, int64_t x) {
+    volatile int64_t* forest = parents;
+    int64_t parent = forest[x];
+    while (parent != x) {
+        // Path halving, every ancestor is a valid parent.
+        const int64_t grandparent = forest[parent];
+        forest[x] = grandparent;
+        x = grandparent;
+        parent = forest[x];
+    }
+    return x;
+}
+
+OPEN3D_DEVICE inline void UnionFindUniteCUDA(int64_t* parents,
+                                             int64_t a,
+                                             int64_t b) {
+    while (true) {
+        a = UnionFindRootCUDA(parents, a);
+        b = UnionFindRootCUDA(parents, b);
+        if (a == b) return;
+        if (a < b) {
+            const int64_t tmp = a;
+            a = b;
+            b = tmp;
+        }
+        const unsigned long long old =
+                atomicCAS(reinterpret_cast<unsigned long long*>(parents + a),
+                          static_cast<unsigned long long>(a),
+                          static_cast<unsigned long long>(b));
+        if (old == static_cast<unsigned long long>(a)) return;
+    }
+}
+
+void ConnectedComponentsCUDA(const Tensor& edges, Tensor& labels) {
+    CUDAScopedDevice scoped_device(labels.GetDevice());
+    int64_t* parents = labels.GetDataPtr<int64_t>();
+    const int64_t* edges_ptr = edges.GetDataPtr<int64_t>();
+    ParallelFor(labels.GetDevice(), labels.GetLength(),
+                [=] OPEN3D_DEVICE(int64_t i) { parents[i] = i; });
+    if (edges.GetLength() > 0) {
+        ParallelFor(labels.GetDevice(), edges.GetLength(),
+                    [=] OPEN3D_DEVICE(int64_t e) {
+                        UnionFindUniteCUDA(parents, edges_ptr[2 * e],
+                                           edges_ptr[2 * e + 1]);
+                    });
+    }
+    ParallelFor(labels.GetDevice(), labels.GetLength(),
+                [=] OPEN3D_DEVICE(int64_t i) {
+                    parents[i] = UnionFindRootCUDA(parents, i);
+                });
+}
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
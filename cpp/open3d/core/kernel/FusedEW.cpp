@@ -0,0 +1,125 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/core/kernel/FusedEW.h"
+
+#include "open3d/core/ShapeUtil.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+void FusedEW(const std::vector<Tensor>& inputs,
+             const FusedEWProgram& program,
+             Tensor& dst) {
+    if (inputs.empty() || static_cast<int64_t>(inputs.size()) > MAX_INPUTS) {
+        utility::LogError("FusedEW expects 1 to {} inputs, but got {}.",
+                          MAX_INPUTS, inputs.size());
+    }
+    if (program.num_instructions_ <= 0 ||
+        program.num_instructions_ > MAX_FUSED_EW_INSTRUCTIONS) {
+        utility::LogError("Invalid FusedEW program size {}.",
+                          program.num_instructions_);
+    }
+    if (dst.GetDtype() != core::Float32 && dst.GetDtype() != core::Float64) {
+        utility::LogError("FusedEW only supports Float32 and Float64, got {}.",
+                          dst.GetDtype().ToString());
+    }
+
+    // Validate the program, such that the kernel never over- or under-flows
+    // its stack.
+    int64_t depth = 0;
+    for (int64_t pc = 0; pc < program.num_instructions_; ++pc) {
+        const FusedEWInstruction& inst = program.instructions_[pc];
+        switch (inst.op_code_) {
+            case FusedEWOpCode::Input:
+                if (inst.input_idx_ < 0 ||
+                    inst.input_idx_ >= static_cast<int32_t>(inputs.size())) {
+                    utility::LogError("FusedEW input index {} out of range.",
+                                      inst.input_idx_);
+                }
+                ++depth;
+                break;
+            case FusedEWOpCode::Scalar:
+                ++depth;
+                break;
+            case FusedEWOpCode::Add:
+            case FusedEWOpCode::Sub:
+            case FusedEWOpCode::Mul:
+            case FusedEWOpCode::Div:
+                if (depth < 2) {
+                    utility::LogError("FusedEW program stack underflow.");
+                }
+                --depth;
+                break;
+            default:
+                if (depth < 1) {
+                    utility::LogError("FusedEW program stack underflow.");
+                }
+                break;
+        }
+        if (depth > MAX_FUSED_EW_STACK_SIZE) {
+            utility::LogError("FusedEW program exceeds the stack size {}.",
+                              MAX_FUSED_EW_STACK_SIZE);
+        }
+    }
+    if (depth != 1) {
+        utility::LogError("FusedEW program must leave exactly one value.");
+    }
+
+    for (const Tensor& input : inputs) {
+        if (input.GetDevice() != dst.GetDevice()) {
+            utility::LogError("Device mismatch {} != {}.",
+                              input.GetDevice().ToString(),
+                              dst.GetDevice().ToString());
+        }
+        if (!shape_util::CanBeBrocastedToShape(input.GetShape(),
+                                               dst.GetShape())) {
+            utility::LogError("Shape {} can not be broadcasted to {}.",
+                              input.GetShape(), dst.GetShape());
+        }
+    }
+
+    Device::DeviceType device_type = dst.GetDevice().GetType();
+    if (device_type == Device::DeviceType::CPU) {
+        FusedEWCPU(inputs, program, dst);
+    } else if (device_type == Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        FusedEWCUDA(inputs, program, dst);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("FusedEW: Unimplemented device");
+    }
+}
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
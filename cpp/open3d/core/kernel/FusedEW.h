@@ -0,0 +1,158 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#pragma once
+
+#include <cmath>
+#include <vector>
+
+#include "open3d/core/CUDAUtils.h"
+#include "open3d/core/Indexer.h"
+#include "open3d/core/Tensor.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+/// Op codes of the fused element-wise program. The program is evaluated in
+/// postfix order on a small per-element stack.
+enum class FusedEWOpCode : int32_t {
+    Input,   // Push the value of input tensor `input_idx_`.
+    Scalar,  // Push the immediate `scalar_`.
+    Add,
+    Sub,
+    Mul,
+    Div,
+    Neg,
+    Sqrt,
+    Exp,
+    Abs,
+};
+
+/// Maximum number of instructions of a fused program.
+static constexpr int64_t MAX_FUSED_EW_INSTRUCTIONS = 32;
+
+/// Maximum stack depth required to evaluate a fused program.
+static constexpr int64_t MAX_FUSED_EW_STACK_SIZE = 16;
+
+struct FusedEWInstruction {
+    FusedEWOpCode op_code_;
+    int32_t input_idx_;
+    double scalar_;
+};
+
+/// A fixed-size element-wise program. It is a POD type, such that it can be
+/// captured by value in CUDA kernels.
+struct FusedEWProgram {
+    int64_t num_instructions_ = 0;
+    FusedEWInstruction instructions_[MAX_FUSED_EW_INSTRUCTIONS];
+};
+
+/// Evaluates \p program on the element \p workload_idx of \p indexer.
+template <typename scalar_t>
+OPEN3D_HOST_DEVICE inline scalar_t EvaluateFusedEWProgram(
+        const FusedEWProgram& program,
+        const Indexer& indexer,
+        int64_t workload_idx) {
+    scalar_t stack[MAX_FUSED_EW_STACK_SIZE];
+    int64_t top = 0;
+    for (int64_t pc = 0; pc < program.num_instructions_; ++pc) {
+        const FusedEWInstruction& inst = program.instructions_[pc];
+        switch (inst.op_code_) {
+            case FusedEWOpCode::Input:
+                stack[top++] = *indexer.GetInputPtr<scalar_t>(inst.input_idx_,
+                                                              workload_idx);
+                break;
+            case FusedEWOpCode::Scalar:
+                stack[top++] = static_cast<scalar_t>(inst.scalar_);
+                break;
+            case FusedEWOpCode::Add:
+                --top;
+                stack[top - 1] = stack[top - 1] + stack[top];
+                break;
+            case FusedEWOpCode::Sub:
+                --top;
+                stack[top - 1] = stack[top - 1] - stack[top];
+                break;
+            case FusedEWOpCode::Mul:
+                --top;
+                stack[top - 1] = stack[top - 1] * stack[top];
+                break;
+            case FusedEWOpCode::Div:
+                --top;
+                stack[top - 1] = stack[top - 1] / stack[top];
+                break;
+            case FusedEWOpCode::Neg:
+                stack[top - 1] = -stack[top - 1];
+                break;
+            case FusedEWOpCode::Sqrt:
+#ifdef __CUDA_ARCH__
+                stack[top - 1] = sqrt(stack[top - 1]);
+#else
+                stack[top - 1] = std::sqrt(stack[top - 1]);
+#endif
+                break;
+            case FusedEWOpCode::Exp:
+#ifdef __CUDA_ARCH__
+                stack[top - 1] = exp(stack[top - 1]);
+#else
+                stack[top - 1] = std::exp(stack[top - 1]);
+#endif
+                break;
+            case FusedEWOpCode::Abs:
+                stack[top - 1] =
+                        stack[top - 1] < 0 ? -stack[top - 1] : stack[top - 1];
+                break;
+        }
+    }
+    return stack[0];
+}
+
+/// Evaluates \p program for every element of \p dst in a single pass.
+///
+/// \param inputs Input tensors referenced by FusedEWOpCode::Input. All inputs
+/// must have the same floating point dtype and device as \p dst, and must be
+/// broadcastable to the shape of \p dst.
+/// \param program The postfix program to evaluate.
+/// \param dst The output tensor.
+void FusedEW(const std::vector<Tensor>& inputs,
+             const FusedEWProgram& program,
+             Tensor& dst);
+
+void FusedEWCPU(const std::vector<Tensor>& inputs,
+                const FusedEWProgram& program,
+                Tensor& dst);
+
+#ifdef BUILD_CUDA_MODULE
+void FusedEWCUDA(const std::vector<Tensor>& inputs,
+                 const FusedEWProgram& program,
+                 Tensor& dst);
+#endif
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
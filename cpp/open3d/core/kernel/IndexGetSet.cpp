@@ -30,6 +30,7 @@
 #include "open3d/core/MemoryManager.h"
 #include "open3d/core/SizeVector.h"
 #include "open3d/core/Tensor.h"
+#include "open3d/core/TensorCheck.h"
 #include "open3d/core/kernel/UnaryEW.h"
 #include "open3d/utility/Logging.h"
 
@@ -63,6 +64,34 @@ void IndexGet(const Tensor& src,
     }
 }
 
+std::vector<Tensor> MaskedIndexGet(const std::vector<Tensor>& srcs,
+                                   const Tensor& mask) {
+    AssertTensorDtype(mask, core::Bool);
+    AssertTensorShape(mask, {utility::nullopt});
+    const Device device = mask.GetDevice();
+    std::vector<Tensor> srcs_contiguous;
+    for (const Tensor& src : srcs) {
+        AssertTensorDevice(src, device);
+        if (src.NumDims() == 0 || src.GetLength() != mask.GetLength()) {
+            utility::LogError(
+                    "Tensor of shape {} cannot be selected with a mask of "
+                    "length {}.",
+                    src.GetShape(), mask.GetLength());
+        }
+        srcs_contiguous.push_back(src.Contiguous());
+    }
+    const Tensor mask_contiguous = mask.Contiguous();
+
+    if (device.GetType() == Device::DeviceType::CPU) {
+        return MaskedIndexGetCPU(srcs_contiguous, mask_contiguous);
+    } else if (device.GetType() == Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        return MaskedIndexGetCUDA(srcs_contiguous, mask_contiguous);
+#endif
+    }
+    utility::LogError("MaskedIndexGet: Unimplemented device");
+}
+
 void IndexSet(const Tensor& src,
               Tensor& dst,
               const std::vector<Tensor>& index_tensors,
@@ -53,6 +53,21 @@ void IndexGetCUDA(const Tensor& src,
                   const SizeVector& indexed_strides);
 #endif
 
+/// Gathers the rows of each tensor of \p srcs where the 1-D Bool \p mask is
+/// true, i.e. srcs[i][mask] for all i. The mask is compacted once for all the
+/// tensors and no index tensor is materialized. All tensors must be on the
+/// device of the mask and have the mask's length as their outer dimension.
+std::vector<Tensor> MaskedIndexGet(const std::vector<Tensor>& srcs,
+                                   const Tensor& mask);
+
+std::vector<Tensor> MaskedIndexGetCPU(const std::vector<Tensor>& srcs,
+                                      const Tensor& mask);
+
+#ifdef BUILD_CUDA_MODULE
+std::vector<Tensor> MaskedIndexGetCUDA(const std::vector<Tensor>& srcs,
+                                       const Tensor& mask);
+#endif
+
 void IndexSet(const Tensor& src,
               Tensor& dst,
               const std::vector<Tensor>& index_tensors,
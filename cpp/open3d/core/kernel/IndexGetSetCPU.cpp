@@ -24,12 +24,21 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <algorithm>
+#include <cstring>
+#include <numeric>
+
 #include "open3d/core/AdvancedIndexing.h"
 #include "open3d/core/Dispatch.h"
 #include "open3d/core/ParallelFor.h"
 #include "open3d/core/Tensor.h"
 #include "open3d/core/kernel/IndexGetSet.h"
 #include "open3d/utility/Logging.h"
+#include "open3d/utility/Parallel.h"
+
+#ifdef BUILD_ISPC_MODULE
+#include "IndexGetSetCPU_ispc.h"
+#endif
 
 namespace open3d {
 namespace core {
@@ -57,12 +66,124 @@ static void CPUCopyObjectElementKernel(const void* src,
     memcpy(dst_bytes, src_bytes, object_byte_size);
 }
 
+/// Returns true if the preprocessed advanced indexing is a row gather or
+/// scatter along the outer dimension of a contiguous tensor, e.g. t[indices]
+/// with a 1-D index tensor. \p restrided is the preprocessed tensor being
+/// indexed and \p other is the tensor on the other side of the copy. Sets the
+/// number of elements per row.
+static bool IsOuterRowIndexing(const Tensor& restrided,
+                               const Tensor& other,
+                               const std::vector<Tensor>& index_tensors,
+                               const SizeVector& indexed_shape,
+                               const SizeVector& indexed_strides,
+                               int64_t& row_size) {
+    const int64_t num_dims = restrided.NumDims();
+    if (indexed_shape.size() != 1 || num_dims == 0 ||
+        static_cast<int64_t>(index_tensors.size()) != num_dims ||
+        restrided.GetStride(0) != 0 ||
+        other.GetDtype() != restrided.GetDtype() ||
+        other.GetShape() != restrided.GetShape() || !other.IsContiguous()) {
+        return false;
+    }
+    const Tensor& indices = index_tensors[0];
+    if (indices.NumDims() != num_dims || !indices.IsContiguous() ||
+        indices.NumElements() != restrided.GetShape(0)) {
+        return false;
+    }
+    for (int64_t dim = 1; dim < num_dims; ++dim) {
+        if (index_tensors[dim].NumDims() != 0) {
+            return false;
+        }
+    }
+    // The remaining dimensions must be laid out contiguously.
+    row_size = 1;
+    for (int64_t dim = num_dims - 1; dim >= 1; --dim) {
+        if (restrided.GetShape(dim) != 1 &&
+            restrided.GetStride(dim) != row_size) {
+            return false;
+        }
+        row_size *= restrided.GetShape(dim);
+    }
+    return row_size > 0 && indexed_strides[0] == row_size;
+}
+
+/// Copies rows of \p row_size elements from \p src to \p dst. With \p gather,
+/// the i-th row of dst is read from row indices[i] of src; otherwise the i-th
+/// row of src is written to row indices[i] of dst.
+static void LaunchRowIndexingKernel(const void* src,
+                                    void* dst,
+                                    const int64_t* indices,
+                                    int64_t num_indices,
+                                    int64_t num_indexed_rows,
+                                    int64_t row_size,
+                                    int64_t element_byte_size,
+                                    bool gather) {
+    const char* src_bytes = static_cast<const char*>(src);
+    char* dst_bytes = static_cast<char*>(dst);
+    const int64_t row_byte_size = row_size * element_byte_size;
+    auto func = [&](int64_t i) {
+        int64_t row = indices[i];
+        OPEN3D_ASSERT(row >= -num_indexed_rows && row < num_indexed_rows &&
+                      "Index out of bounds.");
+        row += num_indexed_rows * (row < 0);
+        if (gather) {
+            memcpy(dst_bytes + i * row_byte_size,
+                   src_bytes + row * row_byte_size, row_byte_size);
+        } else {
+            memcpy(dst_bytes + row * row_byte_size,
+                   src_bytes + i * row_byte_size, row_byte_size);
+        }
+    };
+
+#ifdef BUILD_ISPC_MODULE
+#define OPEN3D_LAUNCH_ISPC_ROW_KERNEL_(T)                                    \
+    if (gather) {                                                            \
+        ParallelFor(Device("CPU:0"), num_indices, func,                      \
+                    OPEN3D_VECTORIZED(CPUIndexGetRowsKernel_##T,             \
+                                      static_cast<const T*>(src), indices,   \
+                                      num_indexed_rows, row_size,            \
+                                      static_cast<T*>(dst)));                \
+    } else {                                                                 \
+        ParallelFor(Device("CPU:0"), num_indices, func,                      \
+                    OPEN3D_VECTORIZED(CPUIndexSetRowsKernel_##T,             \
+                                      static_cast<const T*>(src), indices,   \
+                                      num_indexed_rows, row_size,            \
+                                      static_cast<T*>(dst)));                \
+    }                                                                        \
+    return;
+
+    switch (element_byte_size) {
+        case 1:
+            OPEN3D_LAUNCH_ISPC_ROW_KERNEL_(uint8_t)
+        case 2:
+            OPEN3D_LAUNCH_ISPC_ROW_KERNEL_(uint16_t)
+        case 4:
+            OPEN3D_LAUNCH_ISPC_ROW_KERNEL_(uint32_t)
+        case 8:
+            OPEN3D_LAUNCH_ISPC_ROW_KERNEL_(uint64_t)
+        default:
+            break;
+    }
+#undef OPEN3D_LAUNCH_ISPC_ROW_KERNEL_
+#endif
+    ParallelFor(Device("CPU:0"), num_indices, func);
+}
+
 void IndexGetCPU(const Tensor& src,
                  Tensor& dst,
                  const std::vector<Tensor>& index_tensors,
                  const SizeVector& indexed_shape,
                  const SizeVector& indexed_strides) {
     Dtype dtype = src.GetDtype();
+    int64_t row_size = 0;
+    if (IsOuterRowIndexing(src, dst, index_tensors, indexed_shape,
+                           indexed_strides, row_size)) {
+        LaunchRowIndexingKernel(src.GetDataPtr(), dst.GetDataPtr(),
+                                index_tensors[0].GetDataPtr<int64_t>(),
+                                dst.GetShape(0), indexed_shape[0], row_size,
+                                dtype.ByteSize(), /*gather=*/true);
+        return;
+    }
     AdvancedIndexer ai(src, dst, index_tensors, indexed_shape, indexed_strides,
                        AdvancedIndexer::AdvancedIndexerMode::GET);
     if (dtype.IsObject()) {
@@ -71,18 +192,121 @@ void IndexGetCPU(const Tensor& src,
             CPUCopyObjectElementKernel(src, dst, object_byte_size);
         });
     } else {
-        DISPATCH_DTYPE_TO_TEMPLATE(dtype, [&]() {
+        DISPATCH_DTYPE_TO_TEMPLATE_WITH_HALF(dtype, [&]() {
             LaunchAdvancedIndexerKernel(ai, CPUCopyElementKernel<scalar_t>);
         });
     }
 }
 
+/// Copies the rows of \p src where \p mask is true in [start, end) to \p dst.
+/// The row size is a template argument for the common small rows.
+template <int64_t kRowByteSize>
+static void CompactRows(const char* src,
+                        const bool* mask,
+                        int64_t start,
+                        int64_t end,
+                        int64_t row_byte_size,
+                        char* dst) {
+    if (kRowByteSize > 0) {
+        row_byte_size = kRowByteSize;
+    }
+    for (int64_t i = start; i < end; ++i) {
+        if (mask[i]) {
+            memcpy(dst, src + i * row_byte_size, row_byte_size);
+            dst += row_byte_size;
+        }
+    }
+}
+
+std::vector<Tensor> MaskedIndexGetCPU(const std::vector<Tensor>& srcs,
+                                      const Tensor& mask) {
+    // Two-pass stream compaction as in NonZeroCPU: each chunk counts its true
+    // values, an exclusive scan of the counts gives the output row offsets,
+    // and each chunk then copies its rows of all the tensors in order.
+    const bool* mask_ptr = mask.GetDataPtr<bool>();
+    const int64_t num_rows = mask.GetLength();
+    const int64_t num_chunks = std::max<int64_t>(
+            1, std::min<int64_t>(utility::EstimateMaxThreads(), num_rows));
+    auto chunk_start = [&](int64_t chunk_idx) {
+        return num_rows * chunk_idx / num_chunks;
+    };
+    std::vector<int64_t> chunk_offsets(num_chunks + 1, 0);
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t chunk_idx = 0; chunk_idx < num_chunks; ++chunk_idx) {
+        int64_t count = 0;
+        for (int64_t i = chunk_start(chunk_idx);
+             i < chunk_start(chunk_idx + 1); ++i) {
+            count += mask_ptr[i];
+        }
+        chunk_offsets[chunk_idx + 1] = count;
+    }
+    std::partial_sum(chunk_offsets.begin(), chunk_offsets.end(),
+                     chunk_offsets.begin());
+
+    std::vector<Tensor> dsts;
+    std::vector<int64_t> row_byte_sizes;
+    for (const Tensor& src : srcs) {
+        SizeVector dst_shape = src.GetShape();
+        dst_shape[0] = chunk_offsets.back();
+        dsts.emplace_back(dst_shape, src.GetDtype(), src.GetDevice());
+        row_byte_sizes.push_back(
+                SizeVector(dst_shape.begin() + 1, dst_shape.end())
+                        .NumElements() *
+                src.GetDtype().ByteSize());
+    }
+
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t chunk_idx = 0; chunk_idx < num_chunks; ++chunk_idx) {
+        const int64_t start = chunk_start(chunk_idx);
+        const int64_t end = chunk_start(chunk_idx + 1);
+        for (size_t k = 0; k < srcs.size(); ++k) {
+            const int64_t row_byte_size = row_byte_sizes[k];
+            const char* src = static_cast<const char*>(srcs[k].GetDataPtr());
+            char* dst = static_cast<char*>(dsts[k].GetDataPtr()) +
+                        chunk_offsets[chunk_idx] * row_byte_size;
+            switch (row_byte_size) {
+                case 1:
+                    CompactRows<1>(src, mask_ptr, start, end, 1, dst);
+                    break;
+                case 4:
+                    CompactRows<4>(src, mask_ptr, start, end, 4, dst);
+                    break;
+                case 8:
+                    CompactRows<8>(src, mask_ptr, start, end, 8, dst);
+                    break;
+                case 12:
+                    CompactRows<12>(src, mask_ptr, start, end, 12, dst);
+                    break;
+                case 24:
+                    CompactRows<24>(src, mask_ptr, start, end, 24, dst);
+                    break;
+                default:
+                    CompactRows<0>(src, mask_ptr, start, end, row_byte_size,
+                                   dst);
+                    break;
+            }
+        }
+    }
+    return dsts;
+}
+
 void IndexSetCPU(const Tensor& src,
                  Tensor& dst,
                  const std::vector<Tensor>& index_tensors,
                  const SizeVector& indexed_shape,
                  const SizeVector& indexed_strides) {
     Dtype dtype = src.GetDtype();
+    int64_t row_size = 0;
+    if (IsOuterRowIndexing(dst, src, index_tensors, indexed_shape,
+                           indexed_strides, row_size)) {
+        LaunchRowIndexingKernel(src.GetDataPtr(), dst.GetDataPtr(),
+                                index_tensors[0].GetDataPtr<int64_t>(),
+                                src.GetShape(0), indexed_shape[0], row_size,
+                                dtype.ByteSize(), /*gather=*/false);
+        return;
+    }
     AdvancedIndexer ai(src, dst, index_tensors, indexed_shape, indexed_strides,
                        AdvancedIndexer::AdvancedIndexerMode::SET);
     if (dtype.IsObject()) {
@@ -91,7 +315,7 @@ void IndexSetCPU(const Tensor& src,
             CPUCopyObjectElementKernel(src, dst, object_byte_size);
         });
     } else {
-        DISPATCH_DTYPE_TO_TEMPLATE(dtype, [&]() {
+        DISPATCH_DTYPE_TO_TEMPLATE_WITH_HALF(dtype, [&]() {
             LaunchAdvancedIndexerKernel(ai, CPUCopyElementKernel<scalar_t>);
         });
     }
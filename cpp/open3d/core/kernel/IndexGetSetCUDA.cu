@@ -24,6 +24,11 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <thrust/device_ptr.h>
+#include <thrust/execution_policy.h>
+#include <thrust/functional.h>
+#include <thrust/transform_scan.h>
+
 #include "open3d/core/AdvancedIndexing.h"
 #include "open3d/core/CUDAUtils.h"
 #include "open3d/core/Dispatch.h"
@@ -80,7 +85,7 @@ void IndexGetCUDA(const Tensor& src,
                     CUDACopyObjectElementKernel(src, dst, object_byte_size);
                 });
     } else {
-        DISPATCH_DTYPE_TO_TEMPLATE(dtype, [&]() {
+        DISPATCH_DTYPE_TO_TEMPLATE_WITH_HALF(dtype, [&]() {
             LaunchAdvancedIndexerKernel(
                     src.GetDevice(), ai,
                     // Need to wrap as extended CUDA lambda function
@@ -91,6 +96,76 @@ void IndexGetCUDA(const Tensor& src,
     }
 }
 
+struct BoolToInt64Functor {
+    OPEN3D_HOST_DEVICE int64_t operator()(bool value) const {
+        return value ? 1 : 0;
+    }
+};
+
+std::vector<Tensor> MaskedIndexGetCUDA(const std::vector<Tensor>& srcs,
+                                       const Tensor& mask) {
+    CUDAScopedDevice scoped_device(mask.GetDevice());
+    const Device device = mask.GetDevice();
+    const int64_t num_rows = mask.GetLength();
+    // One scan of the mask gives the output row of every selected row, shared
+    // by all the tensors.
+    Tensor offsets({num_rows}, core::Int64, device);
+    int64_t num_selected = 0;
+    if (num_rows > 0) {
+        thrust::device_ptr<const bool> mask_first(mask.GetDataPtr<bool>());
+        thrust::device_ptr<int64_t> offsets_first(
+                offsets.GetDataPtr<int64_t>());
+        thrust::transform_exclusive_scan(
+                thrust::cuda::par.on(cuda::GetStream()), mask_first,
+                mask_first + num_rows, offsets_first, BoolToInt64Functor(),
+                int64_t(0), thrust::plus<int64_t>());
+        num_selected = offsets[num_rows - 1].Item<int64_t>() +
+                       mask[num_rows - 1].Item<bool>();
+    }
+
+    const bool* mask_ptr = mask.GetDataPtr<bool>();
+    const int64_t* offsets_ptr = offsets.GetDataPtr<int64_t>();
+    std::vector<Tensor> dsts;
+    for (const Tensor& src : srcs) {
+        SizeVector dst_shape = src.GetShape();
+        dst_shape[0] = num_selected;
+        Tensor dst(dst_shape, src.GetDtype(), device);
+        const int64_t row_byte_size =
+                SizeVector(dst_shape.begin() + 1, dst_shape.end())
+                        .NumElements() *
+                src.GetDtype().ByteSize();
+        const char* src_ptr = static_cast<const char*>(src.GetDataPtr());
+        char* dst_ptr = static_cast<char*>(dst.GetDataPtr());
+        if (row_byte_size % 4 == 0) {
+            // Most attribute rows are made of 4-byte words.
+            const int64_t row_words = row_byte_size / 4;
+            ParallelFor(device, num_rows, [=] OPEN3D_DEVICE(int64_t i) {
+                if (!mask_ptr[i]) return;
+                const uint32_t* src_row =
+                        reinterpret_cast<const uint32_t*>(src_ptr) +
+                        i * row_words;
+                uint32_t* dst_row = reinterpret_cast<uint32_t*>(dst_ptr) +
+                                    offsets_ptr[i] * row_words;
+                for (int64_t j = 0; j < row_words; ++j) {
+                    dst_row[j] = src_row[j];
+                }
+            });
+        } else {
+            ParallelFor(device, num_rows, [=] OPEN3D_DEVICE(int64_t i) {
+                if (!mask_ptr[i]) return;
+                const char* src_row = src_ptr + i * row_byte_size;
+                char* dst_row = dst_ptr + offsets_ptr[i] * row_byte_size;
+                for (int64_t j = 0; j < row_byte_size; ++j) {
+                    dst_row[j] = src_row[j];
+                }
+            });
+        }
+        dsts.push_back(dst);
+    }
+    OPEN3D_GET_LAST_CUDA_ERROR("MaskedIndexGetCUDA failed.");
+    return dsts;
+}
+
 void IndexSetCUDA(const Tensor& src,
                   Tensor& dst,
                   const std::vector<Tensor>& index_tensors,
@@ -108,7 +183,7 @@ void IndexSetCUDA(const Tensor& src,
                     CUDACopyObjectElementKernel(src, dst, object_byte_size);
                 });
     } else {
-        DISPATCH_DTYPE_TO_TEMPLATE(dtype, [&]() {
+        DISPATCH_DTYPE_TO_TEMPLATE_WITH_HALF(dtype, [&]() {
             LaunchAdvancedIndexerKernel(
                     src.GetDevice(), ai,
                     // Need to wrap as extended CUDA lambda function
@@ -30,6 +30,9 @@
 #include "open3d/core/kernel/IndexGetSet.h"
 #include "open3d/core/kernel/NonZero.h"
 #include "open3d/core/kernel/Reduction.h"
+#include "open3d/core/kernel/Segment.h"
+#include "open3d/core/kernel/Sort.h"
+#include "open3d/core/kernel/Sparse.h"
 #include "open3d/core/kernel/UnaryEW.h"
 
 namespace open3d {
@@ -26,53 +26,120 @@
 
 #include <numeric>
 
-#include "open3d/core/Indexer.h"
+#include "open3d/core/Dispatch.h"
+#include "open3d/core/Tensor.h"
 #include "open3d/core/kernel/NonZero.h"
 #include "open3d/utility/Logging.h"
 #include "open3d/utility/Parallel.h"
 
+#ifdef BUILD_ISPC_MODULE
+#include "NonZeroCPU_ispc.h"
+#endif
+
 namespace open3d {
 namespace core {
 namespace kernel {
 
+template <typename scalar_t>
+static int64_t CountNonZero(const scalar_t* src, int64_t start, int64_t end) {
+    int64_t count = 0;
+    for (int64_t i = start; i < end; ++i) {
+        count += src[i] != static_cast<scalar_t>(0);
+    }
+    return count;
+}
+
+template <typename scalar_t>
+static void CompactNonZero(const scalar_t* src,
+                           int64_t start,
+                           int64_t end,
+                           int64_t* dst) {
+    for (int64_t i = start; i < end; ++i) {
+        if (src[i] != static_cast<scalar_t>(0)) {
+            *dst++ = i;
+        }
+    }
+}
+
+#ifdef BUILD_ISPC_MODULE
+#define OPEN3D_NON_ZERO_ISPC_(T)                                              \
+    static int64_t CountNonZero(const T* src, int64_t start, int64_t end) {   \
+        return ispc::CPUNonZeroCountKernel_##T(src, start, end);              \
+    }                                                                         \
+                                                                              \
+    static void CompactNonZero(const T* src, int64_t start, int64_t end,      \
+                               int64_t* dst) {                                \
+        ispc::CPUNonZeroCompactKernel_##T(src, start, end, dst);              \
+    }
+
+OPEN3D_NON_ZERO_ISPC_(bool)
+OPEN3D_NON_ZERO_ISPC_(uint8_t)
+OPEN3D_NON_ZERO_ISPC_(int8_t)
+OPEN3D_NON_ZERO_ISPC_(uint16_t)
+OPEN3D_NON_ZERO_ISPC_(int16_t)
+OPEN3D_NON_ZERO_ISPC_(uint32_t)
+OPEN3D_NON_ZERO_ISPC_(int32_t)
+OPEN3D_NON_ZERO_ISPC_(uint64_t)
+OPEN3D_NON_ZERO_ISPC_(int64_t)
+OPEN3D_NON_ZERO_ISPC_(float)
+OPEN3D_NON_ZERO_ISPC_(double)
+#undef OPEN3D_NON_ZERO_ISPC_
+#endif
+
+/// Returns the flattened indices of the non-zero elements of \p src with a
+/// two-pass stream compaction: each chunk counts its non-zeros, an exclusive
+/// scan of the counts gives the output offsets, and each chunk then writes its
+/// indices in order.
+template <typename scalar_t>
+static std::vector<int64_t> FlatNonZeroIndices(const scalar_t* src,
+                                               int64_t num_elements) {
+    const int64_t num_chunks = std::max<int64_t>(
+            1, std::min<int64_t>(utility::EstimateMaxThreads(), num_elements));
+    auto chunk_start = [&](int64_t chunk_idx) {
+        return num_elements * chunk_idx / num_chunks;
+    };
+    std::vector<int64_t> chunk_offsets(num_chunks + 1, 0);
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t chunk_idx = 0; chunk_idx < num_chunks; ++chunk_idx) {
+        chunk_offsets[chunk_idx + 1] = CountNonZero(
+                src, chunk_start(chunk_idx), chunk_start(chunk_idx + 1));
+    }
+    std::partial_sum(chunk_offsets.begin(), chunk_offsets.end(),
+                     chunk_offsets.begin());
+
+    std::vector<int64_t> non_zero_indices(chunk_offsets.back());
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t chunk_idx = 0; chunk_idx < num_chunks; ++chunk_idx) {
+        CompactNonZero(src, chunk_start(chunk_idx), chunk_start(chunk_idx + 1),
+                       non_zero_indices.data() + chunk_offsets[chunk_idx]);
+    }
+    return non_zero_indices;
+}
+
 Tensor NonZeroCPU(const Tensor& src) {
     // Get flattened non-zero indices.
-    TensorIterator src_iter(src);
-    const int64_t num_elements = src.NumElements();
-    std::vector<int64_t> indices(static_cast<size_t>(num_elements));
-    std::iota(std::begin(indices), std::end(indices), 0);
-    std::vector<int64_t> non_zero_indices(num_elements);
+    const Tensor src_contiguous = src.Contiguous();
+    std::vector<int64_t> non_zero_indices;
     DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(src.GetDtype(), [&]() {
-        auto it = std::copy_if(
-                indices.begin(), indices.end(), non_zero_indices.begin(),
-                [&src_iter](int64_t index) {
-                    const void* src_ptr = src_iter.GetPtr(index);
-                    OPEN3D_ASSERT(src_ptr != nullptr && "Internal error.");
-                    return static_cast<float>(
-                                   *static_cast<const scalar_t*>(src_ptr)) != 0;
-                });
-        non_zero_indices.resize(std::distance(non_zero_indices.begin(), it));
+        non_zero_indices = FlatNonZeroIndices(
+                src_contiguous.GetDataPtr<scalar_t>(), src.NumElements());
     });
 
     // Transform flattened indices to indices in each dimension.
     SizeVector shape = src.GetShape();
     const int64_t num_dims = src.NumDims();
-    const size_t num_non_zeros = non_zero_indices.size();
-
-    SizeVector result_shape{num_dims, static_cast<int64_t>(num_non_zeros)};
-    Tensor result(result_shape, core::Int64, src.GetDevice());
-    TensorIterator result_iter(result);
+    const int64_t num_non_zeros = static_cast<int64_t>(non_zero_indices.size());
 
-    std::vector<std::vector<int64_t>> non_zero_indices_by_dimensions(
-            num_dims, std::vector<int64_t>(num_non_zeros, 0));
+    Tensor result({num_dims, num_non_zeros}, core::Int64, src.GetDevice());
+    int64_t* result_ptr = result.GetDataPtr<int64_t>();
 #pragma omp parallel for schedule(static) \
         num_threads(utility::EstimateMaxThreads())
-    for (int64_t i = 0; i < static_cast<int64_t>(num_non_zeros); i++) {
+    for (int64_t i = 0; i < num_non_zeros; i++) {
         int64_t non_zero_index = non_zero_indices[i];
         for (int64_t dim = num_dims - 1; dim >= 0; dim--) {
-            void* result_ptr = result_iter.GetPtr(dim * num_non_zeros + i);
-            OPEN3D_ASSERT(result_ptr != nullptr && "Internal error.");
-            *static_cast<int64_t*>(result_ptr) = non_zero_index % shape[dim];
+            result_ptr[dim * num_non_zeros + i] = non_zero_index % shape[dim];
             non_zero_index = non_zero_index / shape[dim];
         }
     }
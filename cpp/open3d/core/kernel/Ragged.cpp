@@ -0,0 +1,126 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/core/kernel/Ragged.h"
+
+#include "open3d/core/Device.h"
+#include "open3d/core/TensorCheck.h"
+#include "open3d/core/kernel/Segment.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+void RaggedGather(const Tensor& values,
+                  const Tensor& row_splits,
+                  const Tensor& indices,
+                  const Tensor& dst_row_splits,
+                  Tensor& dst_values) {
+    const Device device = values.GetDevice();
+    if (values.NumDims() == 0) {
+        utility::LogError("Ragged values require at least 1 dimension.");
+    }
+    AssertTensorDtype(row_splits, core::Int64);
+    AssertTensorDevice(row_splits, device);
+    AssertTensorDtype(indices, core::Int64);
+    AssertTensorDevice(indices, device);
+    AssertTensorShape(indices, {utility::nullopt});
+    AssertTensorDtype(dst_row_splits, core::Int64);
+    AssertTensorDevice(dst_row_splits, device);
+    AssertTensorShape(dst_row_splits, {indices.GetLength() + 1});
+    AssertTensorDtype(dst_values, values.GetDtype());
+    AssertTensorDevice(dst_values, device);
+    if (!dst_values.IsContiguous()) {
+        utility::LogError("dst_values must be contiguous.");
+    }
+
+    Device::DeviceType device_type = device.GetType();
+    if (device_type == Device::DeviceType::CPU) {
+        RaggedGatherCPU(values.Contiguous(), row_splits.Contiguous(),
+                        indices.Contiguous(), dst_row_splits.Contiguous(),
+                        dst_values);
+    } else if (device_type == Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        RaggedGatherCUDA(values.Contiguous(), row_splits.Contiguous(),
+                         indices.Contiguous(), dst_row_splits.Contiguous(),
+                         dst_values);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("RaggedGather: Unimplemented device");
+    }
+}
+
+void RaggedToDense(const Tensor& values,
+                   const Tensor& row_splits,
+                   const Tensor& default_value,
+                   Tensor& dst) {
+    const Device device = values.GetDevice();
+    if (values.NumDims() == 0) {
+        utility::LogError("Ragged values require at least 1 dimension.");
+    }
+    AssertRowSplits(row_splits, values.GetLength(), device);
+    const SizeVector values_shape = values.GetShape();
+    const SizeVector element_shape(std::next(values_shape.begin()),
+                                   values_shape.end());
+    AssertTensorDtype(default_value, values.GetDtype());
+    AssertTensorDevice(default_value, device);
+    AssertTensorShape(default_value, element_shape);
+    AssertTensorDtype(dst, values.GetDtype());
+    AssertTensorDevice(dst, device);
+    const SizeVector dst_shape = dst.GetShape();
+    if (dst_shape.size() < 2 || dst_shape[0] != row_splits.GetLength() - 1 ||
+        SizeVector(std::next(dst_shape.begin(), 2), dst_shape.end()) !=
+                element_shape) {
+        utility::LogError("dst must have shape {{{}, max_length, {}}}.",
+                          row_splits.GetLength() - 1, element_shape);
+    }
+    if (!dst.IsContiguous()) {
+        utility::LogError("dst must be contiguous.");
+    }
+
+    Device::DeviceType device_type = device.GetType();
+    if (device_type == Device::DeviceType::CPU) {
+        RaggedToDenseCPU(values.Contiguous(), row_splits.Contiguous(),
+                         default_value.Contiguous(), dst);
+    } else if (device_type == Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        RaggedToDenseCUDA(values.Contiguous(), row_splits.Contiguous(),
+                          default_value.Contiguous(), dst);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("RaggedToDense: Unimplemented device");
+    }
+}
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
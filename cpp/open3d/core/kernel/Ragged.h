@@ -0,0 +1,126 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#pragma once
+
+#include "open3d/core/CUDAUtils.h"
+#include "open3d/core/Tensor.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+/// Gather the rows \p indices of the ragged tensor (\p values, \p row_splits)
+/// into \p dst_values, laid out by \p dst_row_splits. Row r of the result is
+/// row indices[r] of the input.
+///
+/// \param values Tensor of shape {N, ...}.
+/// \param row_splits Int64 tensor of shape {R + 1}.
+/// \param indices Int64 tensor of shape {M}, in [0, R).
+/// \param dst_row_splits Int64 tensor of shape {M + 1}, the exclusive prefix
+/// sum of the lengths of the gathered rows.
+/// \param dst_values Tensor of shape {dst_row_splits[M], ...} and the dtype
+/// of \p values.
+void RaggedGather(const Tensor& values,
+                  const Tensor& row_splits,
+                  const Tensor& indices,
+                  const Tensor& dst_row_splits,
+                  Tensor& dst_values);
+
+void RaggedGatherCPU(const Tensor& values,
+                     const Tensor& row_splits,
+                     const Tensor& indices,
+                     const Tensor& dst_row_splits,
+                     Tensor& dst_values);
+
+#ifdef BUILD_CUDA_MODULE
+void RaggedGatherCUDA(const Tensor& values,
+                      const Tensor& row_splits,
+                      const Tensor& indices,
+                      const Tensor& dst_row_splits,
+                      Tensor& dst_values);
+#endif
+
+/// Copy the ragged tensor (\p values, \p row_splits) to the dense \p dst of
+/// shape {R, max_length, ...}. Rows longer than max_length are truncated and
+/// shorter rows are padded with \p default_value.
+///
+/// \param values Tensor of shape {N, ...}.
+/// \param row_splits Int64 tensor of shape {R + 1}.
+/// \param default_value Tensor with the element shape and dtype of
+/// \p values.
+/// \param dst Tensor of shape {R, max_length, ...}.
+void RaggedToDense(const Tensor& values,
+                   const Tensor& row_splits,
+                   const Tensor& default_value,
+                   Tensor& dst);
+
+void RaggedToDenseCPU(const Tensor& values,
+                      const Tensor& row_splits,
+                      const Tensor& default_value,
+                      Tensor& dst);
+
+#ifdef BUILD_CUDA_MODULE
+void RaggedToDenseCUDA(const Tensor& values,
+                       const Tensor& row_splits,
+                       const Tensor& default_value,
+                       Tensor& dst);
+#endif
+
+/// Copy value row \p workload_idx of the gathered ragged tensor, see
+/// RaggedGather(). Each value row has \p element_size bytes.
+OPEN3D_HOST_DEVICE inline void RaggedGatherElement(
+        const uint8_t* values,
+        const int64_t* row_splits,
+        const int64_t* indices,
+        const int64_t* dst_row_splits,
+        int64_t num_dst_rows,
+        int64_t element_size,
+        int64_t workload_idx,
+        uint8_t* dst_values) {
+    // Last row r with dst_row_splits[r] <= workload_idx.
+    int64_t lo = 0, hi = num_dst_rows;
+    while (hi - lo > 1) {
+        const int64_t mid = (lo + hi) / 2;
+        if (dst_row_splits[mid] <= workload_idx) {
+            lo = mid;
+        } else {
+            hi = mid;
+        }
+    }
+    const int64_t src_idx =
+            row_splits[indices[lo]] + workload_idx - dst_row_splits[lo];
+    const uint8_t* src = values + src_idx * element_size;
+    uint8_t* dst = dst_values + workload_idx * element_size;
+    for (int64_t k = 0; k < element_size; ++k) {
+        dst[k] = src[k];
+    }
+}
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
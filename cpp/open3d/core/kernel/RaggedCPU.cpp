@@ -0,0 +1,83 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/core/Dispatch.h"
+#include "open3d/core/ParallelFor.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/core/kernel/Ragged.h"
+#include "open3d/ml/impl/misc/RaggedToDense.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+void RaggedGatherCPU(const Tensor& values,
+                     const Tensor& row_splits,
+                     const Tensor& indices,
+                     const Tensor& dst_row_splits,
+                     Tensor& dst_values) {
+    const int64_t num_dst_rows = indices.GetLength();
+    const int64_t num_dst_values = dst_values.GetLength();
+    if (num_dst_values == 0 || dst_values.NumElements() == 0) {
+        return;
+    }
+    const int64_t element_size = dst_values.NumElements() / num_dst_values *
+                                 values.GetDtype().ByteSize();
+    const uint8_t* values_ptr =
+            static_cast<const uint8_t*>(values.GetDataPtr());
+    const int64_t* row_splits_ptr = row_splits.GetDataPtr<int64_t>();
+    const int64_t* indices_ptr = indices.GetDataPtr<int64_t>();
+    const int64_t* dst_row_splits_ptr = dst_row_splits.GetDataPtr<int64_t>();
+    uint8_t* dst_values_ptr = static_cast<uint8_t*>(dst_values.GetDataPtr());
+    ParallelFor(Device("CPU:0"), num_dst_values, [&](int64_t i) {
+        RaggedGatherElement(values_ptr, row_splits_ptr, indices_ptr,
+                            dst_row_splits_ptr, num_dst_rows, element_size, i,
+                            dst_values_ptr);
+    });
+}
+
+void RaggedToDenseCPU(const Tensor& values,
+                      const Tensor& row_splits,
+                      const Tensor& default_value,
+                      Tensor& dst) {
+    if (dst.NumElements() == 0) {
+        return;
+    }
+    const int64_t max_length = dst.GetShape(1);
+    const int64_t element_size = default_value.NumElements();
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(values.GetDtype(), [&]() {
+        ml::impl::RaggedToDenseCPU(
+                values.GetDataPtr<scalar_t>(),
+                row_splits.GetDataPtr<int64_t>(), row_splits.GetLength(),
+                max_length, default_value.GetDataPtr<scalar_t>(),
+                element_size, dst.GetDataPtr<scalar_t>());
+    });
+}
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
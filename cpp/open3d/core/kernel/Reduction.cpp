@@ -88,18 +88,31 @@ void Reduction(const Tensor& src,
                           dst.GetDevice().ToString());
     }
 
+    // Half precision tensors are reduced in Float32, so that sums accumulate
+    // in single precision, and the result is rounded once on store.
+    const bool is_half = src.GetDtype().IsHalf();
+    const Tensor src_compute = is_half ? src.To(core::Float32) : src;
+    Tensor dst_compute =
+            is_half && dst.GetDtype().IsHalf()
+                    ? Tensor::Empty(dst.GetShape(), core::Float32,
+                                    dst.GetDevice())
+                    : dst;
+
     Device::DeviceType device_type = src.GetDevice().GetType();
     if (device_type == Device::DeviceType::CPU) {
-        ReductionCPU(src, dst, dims, keepdim, op_code);
+        ReductionCPU(src_compute, dst_compute, dims, keepdim, op_code);
     } else if (device_type == Device::DeviceType::CUDA) {
 #ifdef BUILD_CUDA_MODULE
-        ReductionCUDA(src, dst, dims, keepdim, op_code);
+        ReductionCUDA(src_compute, dst_compute, dims, keepdim, op_code);
 #else
         utility::LogError("Not compiled with CUDA, but CUDA device is used.");
 #endif
     } else {
         utility::LogError("Unimplemented device.");
     }
+    if (dst_compute.GetDtype() != dst.GetDtype()) {
+        dst.AsRvalue() = dst_compute;
+    }
 
     if (!keepdim) {
         dst = dst.Reshape(non_keepdim_shape);
@@ -24,6 +24,7 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <algorithm>
 #include <limits>
 
 #include "open3d/core/Dispatch.h"
@@ -33,6 +34,10 @@
 #include "open3d/utility/Logging.h"
 #include "open3d/utility/Parallel.h"
 
+#ifdef BUILD_ISPC_MODULE
+#include "ReductionCPU_ispc.h"
+#endif
+
 namespace open3d {
 namespace core {
 namespace kernel {
@@ -235,26 +240,276 @@ private:
     Indexer indexer_;
 };
 
+/// Reduces the contiguous range [start, end) of \p src with the vectorized
+/// ISPC kernels. Returns false if no kernel is available for scalar_t.
+template <typename scalar_t>
+static inline bool ReduceRangeISPC(ReductionOpCode op_code,
+                                   const scalar_t* src,
+                                   int64_t start,
+                                   int64_t end,
+                                   scalar_t identity,
+                                   scalar_t* result) {
+    return false;
+}
+
+/// Arg-reduction counterpart of ReduceRangeISPC. The returned index is
+/// absolute, i.e. within [start, end).
+template <typename scalar_t>
+static inline bool ArgReduceRangeISPC(ReductionOpCode op_code,
+                                      const scalar_t* src,
+                                      int64_t start,
+                                      int64_t end,
+                                      scalar_t identity,
+                                      int64_t* result_idx,
+                                      scalar_t* result) {
+    return false;
+}
+
+#ifdef BUILD_ISPC_MODULE
+#define OPEN3D_REDUCE_RANGE_ISPC_(T)                                          \
+    static inline bool ReduceRangeISPC(ReductionOpCode op_code, const T* src, \
+                                       int64_t start, int64_t end,            \
+                                       T identity, T* result) {               \
+        switch (op_code) {                                                    \
+            case ReductionOpCode::Sum:                                        \
+                *result = ispc::CPUSumReductionKernel_##T(src, start, end,    \
+                                                          identity);          \
+                return true;                                                  \
+            case ReductionOpCode::Prod:                                       \
+                *result = ispc::CPUProdReductionKernel_##T(src, start, end,   \
+                                                           identity);         \
+                return true;                                                  \
+            case ReductionOpCode::Min:                                        \
+                *result = ispc::CPUMinReductionKernel_##T(src, start, end,    \
+                                                          identity);          \
+                return true;                                                  \
+            case ReductionOpCode::Max:                                        \
+                *result = ispc::CPUMaxReductionKernel_##T(src, start, end,    \
+                                                          identity);          \
+                return true;                                                  \
+            default:                                                          \
+                return false;                                                 \
+        }                                                                     \
+    }                                                                         \
+                                                                              \
+    static inline bool ArgReduceRangeISPC(                                    \
+            ReductionOpCode op_code, const T* src, int64_t start,             \
+            int64_t end, T identity, int64_t* result_idx, T* result) {        \
+        switch (op_code) {                                                    \
+            case ReductionOpCode::ArgMin:                                     \
+                *result_idx = ispc::CPUArgMinReductionKernel_##T(             \
+                        src, start, end, identity, result);                   \
+                return true;                                                  \
+            case ReductionOpCode::ArgMax:                                     \
+                *result_idx = ispc::CPUArgMaxReductionKernel_##T(             \
+                        src, start, end, identity, result);                   \
+                return true;                                                  \
+            default:                                                          \
+                return false;                                                 \
+        }                                                                     \
+    }
+
+OPEN3D_REDUCE_RANGE_ISPC_(uint32_t)
+OPEN3D_REDUCE_RANGE_ISPC_(int32_t)
+OPEN3D_REDUCE_RANGE_ISPC_(uint64_t)
+OPEN3D_REDUCE_RANGE_ISPC_(int64_t)
+OPEN3D_REDUCE_RANGE_ISPC_(float)
+OPEN3D_REDUCE_RANGE_ISPC_(double)
+#undef OPEN3D_REDUCE_RANGE_ISPC_
+#endif
+
+template <typename scalar_t, typename func_t>
+static scalar_t ReduceRange(ReductionOpCode op_code,
+                            const scalar_t* src,
+                            int64_t start,
+                            int64_t end,
+                            func_t reduce_func,
+                            scalar_t identity) {
+    scalar_t result = identity;
+    if (!ReduceRangeISPC(op_code, src, start, end, identity, &result)) {
+        for (int64_t i = start; i < end; ++i) {
+            result = reduce_func(src[i], result);
+        }
+    }
+    return result;
+}
+
+template <typename scalar_t, typename func_t>
+static std::pair<int64_t, scalar_t> ArgReduceRange(ReductionOpCode op_code,
+                                                   const scalar_t* src,
+                                                   int64_t start,
+                                                   int64_t end,
+                                                   func_t reduce_func,
+                                                   scalar_t identity) {
+    int64_t result_idx = start;
+    scalar_t result = identity;
+    if (!ArgReduceRangeISPC(op_code, src, start, end, identity, &result_idx,
+                            &result)) {
+        for (int64_t i = start; i < end; ++i) {
+            std::tie(result_idx, result) =
+                    reduce_func(i, src[i], result_idx, result);
+        }
+    }
+    return {result_idx, result};
+}
+
+/// Returns true if \p dims are the innermost dimensions of \p src and both
+/// tensors are contiguous, i.e. every output element reduces a contiguous
+/// block of the input. Sets the number of output elements and the block size.
+static bool IsContiguousInnerReduction(const Tensor& src,
+                                       const Tensor& dst,
+                                       const SizeVector& dims,
+                                       int64_t& num_outputs,
+                                       int64_t& block_size) {
+    if (!src.IsContiguous() || !dst.IsContiguous() ||
+        src.NumElements() == 0) {
+        return false;
+    }
+    const int64_t num_dims = src.NumDims();
+    std::vector<bool> is_reduced(num_dims, false);
+    for (int64_t dim : dims) {
+        is_reduced[dim < 0 ? dim + num_dims : dim] = true;
+    }
+    int64_t first_reduced = num_dims - static_cast<int64_t>(std::count(
+                                               is_reduced.begin(),
+                                               is_reduced.end(), true));
+    if (!std::all_of(is_reduced.begin() + first_reduced, is_reduced.end(),
+                     [](bool reduced) { return reduced; })) {
+        return false;
+    }
+    num_outputs = dst.NumElements();
+    block_size = src.NumElements() / num_outputs;
+    return true;
+}
+
+/// Returns the number of chunks each contiguous block is split into, so that
+/// all threads are busy even when there are fewer outputs than threads.
+static int64_t NumChunksPerBlock(int64_t num_outputs, int64_t block_size) {
+    // Chunks smaller than this are not worth the scheduling overhead.
+    constexpr int64_t kMinChunkSize = 4096;
+    const int64_t num_threads =
+            utility::InParallel() ? 1 : utility::EstimateMaxThreads();
+    if (num_outputs >= num_threads) {
+        return 1;
+    }
+    return std::max<int64_t>(1, std::min(num_threads / num_outputs,
+                                         block_size / kMinChunkSize));
+}
+
+/// Reduces each of the \p num_outputs contiguous blocks of \p src into \p dst.
+/// Large blocks are split into chunks that are reduced in parallel and then
+/// combined pairwise in a tree.
+template <typename scalar_t, typename func_t>
+static void LaunchContiguousReductionKernel(ReductionOpCode op_code,
+                                            const scalar_t* src,
+                                            scalar_t* dst,
+                                            int64_t num_outputs,
+                                            int64_t block_size,
+                                            func_t reduce_func,
+                                            scalar_t identity) {
+    const int64_t num_chunks = NumChunksPerBlock(num_outputs, block_size);
+    if (num_chunks == 1) {
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+        for (int64_t output_idx = 0; output_idx < num_outputs; ++output_idx) {
+            dst[output_idx] = ReduceRange(
+                    op_code, src, output_idx * block_size,
+                    (output_idx + 1) * block_size, reduce_func, identity);
+        }
+        return;
+    }
+
+    std::vector<scalar_t> partials(num_outputs * num_chunks, identity);
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t i = 0; i < num_outputs * num_chunks; ++i) {
+        const int64_t offset = (i / num_chunks) * block_size;
+        const int64_t chunk_idx = i % num_chunks;
+        partials[i] = ReduceRange(
+                op_code, src, offset + block_size * chunk_idx / num_chunks,
+                offset + block_size * (chunk_idx + 1) / num_chunks,
+                reduce_func, identity);
+    }
+    for (int64_t output_idx = 0; output_idx < num_outputs; ++output_idx) {
+        scalar_t* partial = partials.data() + output_idx * num_chunks;
+        for (int64_t stride = 1; stride < num_chunks; stride *= 2) {
+            for (int64_t c = 0; c + stride < num_chunks; c += 2 * stride) {
+                partial[c] = reduce_func(partial[c + stride], partial[c]);
+            }
+        }
+        dst[output_idx] = partial[0];
+    }
+}
+
+/// Arg-reduction counterpart of LaunchContiguousReductionKernel. The tree
+/// combine passes the right chunk first, so ties keep the first occurrence.
+template <typename scalar_t, typename func_t>
+static void LaunchContiguousArgReductionKernel(ReductionOpCode op_code,
+                                               const scalar_t* src,
+                                               int64_t* dst,
+                                               int64_t num_outputs,
+                                               int64_t block_size,
+                                               func_t reduce_func,
+                                               scalar_t identity) {
+    const int64_t num_chunks = NumChunksPerBlock(num_outputs, block_size);
+    std::vector<std::pair<int64_t, scalar_t>> partials(num_outputs *
+                                                       num_chunks);
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t i = 0; i < num_outputs * num_chunks; ++i) {
+        const int64_t offset = (i / num_chunks) * block_size;
+        const int64_t chunk_idx = i % num_chunks;
+        partials[i] = ArgReduceRange(
+                op_code, src, offset + block_size * chunk_idx / num_chunks,
+                offset + block_size * (chunk_idx + 1) / num_chunks,
+                reduce_func, identity);
+    }
+    for (int64_t output_idx = 0; output_idx < num_outputs; ++output_idx) {
+        auto* partial = partials.data() + output_idx * num_chunks;
+        for (int64_t stride = 1; stride < num_chunks; stride *= 2) {
+            for (int64_t c = 0; c + stride < num_chunks; c += 2 * stride) {
+                partial[c] = reduce_func(
+                        partial[c + stride].first, partial[c + stride].second,
+                        partial[c].first, partial[c].second);
+            }
+        }
+        dst[output_idx] = partial[0].first - output_idx * block_size;
+    }
+}
+
 void ReductionCPU(const Tensor& src,
                   Tensor& dst,
                   const SizeVector& dims,
                   bool keepdim,
                   ReductionOpCode op_code) {
+    int64_t num_outputs = 0;
+    int64_t block_size = 0;
+    const bool is_contiguous = IsContiguousInnerReduction(
+            src, dst, dims, num_outputs, block_size);
     if (s_regular_reduce_ops.find(op_code) != s_regular_reduce_ops.end()) {
         Indexer indexer({src}, dst, DtypePolicy::ALL_SAME, dims);
         CPUReductionEngine re(indexer);
         DISPATCH_DTYPE_TO_TEMPLATE(src.GetDtype(), [&]() {
+            auto run = [&](auto reduce_func, scalar_t identity) {
+                if (is_contiguous) {
+                    LaunchContiguousReductionKernel(
+                            op_code, src.GetDataPtr<scalar_t>(),
+                            dst.GetDataPtr<scalar_t>(), num_outputs,
+                            block_size, reduce_func, identity);
+                } else {
+                    dst.Fill(identity);
+                    re.Run(reduce_func, identity);
+                }
+            };
             scalar_t identity;
             switch (op_code) {
                 case ReductionOpCode::Sum:
                     identity = 0;
-                    dst.Fill(identity);
-                    re.Run(CPUSumReductionKernel<scalar_t>, identity);
+                    run(CPUSumReductionKernel<scalar_t>, identity);
                     break;
                 case ReductionOpCode::Prod:
                     identity = 1;
-                    dst.Fill(identity);
-                    re.Run(CPUProdReductionKernel<scalar_t>, identity);
+                    run(CPUProdReductionKernel<scalar_t>, identity);
                     break;
                 case ReductionOpCode::Min:
                     if (indexer.NumWorkloads() == 0) {
@@ -262,8 +517,7 @@ void ReductionCPU(const Tensor& src,
                                 "Zero-size Tensor does not support Min.");
                     } else {
                         identity = std::numeric_limits<scalar_t>::max();
-                        dst.Fill(identity);
-                        re.Run(CPUMinReductionKernel<scalar_t>, identity);
+                        run(CPUMinReductionKernel<scalar_t>, identity);
                     }
                     break;
                 case ReductionOpCode::Max:
@@ -272,8 +526,7 @@ void ReductionCPU(const Tensor& src,
                                 "Zero-size Tensor does not support Max.");
                     } else {
                         identity = std::numeric_limits<scalar_t>::lowest();
-                        dst.Fill(identity);
-                        re.Run(CPUMaxReductionKernel<scalar_t>, identity);
+                        run(CPUMaxReductionKernel<scalar_t>, identity);
                     }
                     break;
                 default:
@@ -291,6 +544,17 @@ void ReductionCPU(const Tensor& src,
         Indexer indexer({src}, {dst, dst_acc}, DtypePolicy::INPUT_SAME, dims);
         CPUArgReductionEngine re(indexer);
         DISPATCH_DTYPE_TO_TEMPLATE(src.GetDtype(), [&]() {
+            auto run = [&](auto reduce_func, scalar_t identity) {
+                if (is_contiguous) {
+                    LaunchContiguousArgReductionKernel(
+                            op_code, src.GetDataPtr<scalar_t>(),
+                            dst.GetDataPtr<int64_t>(), num_outputs,
+                            block_size, reduce_func, identity);
+                } else {
+                    dst_acc.Fill(identity);
+                    re.Run(reduce_func, identity);
+                }
+            };
             scalar_t identity;
             switch (op_code) {
                 case ReductionOpCode::ArgMin:
@@ -299,8 +563,7 @@ void ReductionCPU(const Tensor& src,
                                 "Zero-size Tensor does not support ArgMin.");
                     } else {
                         identity = std::numeric_limits<scalar_t>::max();
-                        dst_acc.Fill(identity);
-                        re.Run(CPUArgMinReductionKernel<scalar_t>, identity);
+                        run(CPUArgMinReductionKernel<scalar_t>, identity);
                     }
                     break;
                 case ReductionOpCode::ArgMax:
@@ -309,8 +572,7 @@ void ReductionCPU(const Tensor& src,
                                 "Zero-size Tensor does not support ArgMax.");
                     } else {
                         identity = std::numeric_limits<scalar_t>::lowest();
-                        dst_acc.Fill(identity);
-                        re.Run(CPUArgMaxReductionKernel<scalar_t>, identity);
+                        run(CPUArgMaxReductionKernel<scalar_t>, identity);
                     }
                     break;
                 default:
@@ -330,16 +592,25 @@ void ReductionCPU(const Tensor& src,
         }
         Indexer indexer({src}, dst, DtypePolicy::ALL_SAME, dims);
         CPUReductionEngine re(indexer);
+        auto run = [&](auto reduce_func, uint8_t identity) {
+            if (is_contiguous) {
+                LaunchContiguousReductionKernel(
+                        op_code, static_cast<const uint8_t*>(src.GetDataPtr()),
+                        static_cast<uint8_t*>(dst.GetDataPtr()), num_outputs,
+                        block_size, reduce_func, identity);
+            } else {
+                dst.Fill(static_cast<bool>(identity));
+                re.Run(reduce_func, identity);
+            }
+        };
         switch (op_code) {
             case ReductionOpCode::All:
                 // Identity == true. 0-sized tensor, returns true.
-                dst.Fill(true);
-                re.Run(CPUAllReductionKernel, static_cast<uint8_t>(true));
+                run(CPUAllReductionKernel, static_cast<uint8_t>(true));
                 break;
             case ReductionOpCode::Any:
                 // Identity == false. 0-sized tensor, returns false.
-                dst.Fill(false);
-                re.Run(CPUAnyReductionKernel, static_cast<uint8_t>(false));
+                run(CPUAnyReductionKernel, static_cast<uint8_t>(false));
                 break;
             default:
                 utility::LogError("Unsupported op code.");
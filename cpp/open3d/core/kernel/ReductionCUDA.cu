@@ -979,7 +979,8 @@ private:
             buffer = buffer_blob->GetDataPtr();
             semaphores = semaphores_blob->GetDataPtr();
             OPEN3D_CUDA_CHECK(
-                    cudaMemset(semaphores, 0, config.SemaphoreSize()));
+                    cudaMemsetAsync(semaphores, 0, config.SemaphoreSize(),
+                                    cuda::GetStream()));
         }
 
         OPEN3D_ASSERT(can_use_32bit_indexing);
@@ -999,7 +1000,7 @@ private:
         ReduceKernel<ReduceConfig::MAX_NUM_THREADS>
                 <<<config.GridDim(), config.BlockDim(), shared_memory,
                    core::cuda::GetStream()>>>(reduce_op);
-        cuda::Synchronize();
+        cuda::SynchronizeStream();
         OPEN3D_CUDA_CHECK(cudaGetLastError());
     }
 
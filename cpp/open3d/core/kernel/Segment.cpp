@@ -0,0 +1,120 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+#include "open3d/core/kernel/Segment.h"
+
+#include "open3d/core/Device.h"
+#include "open3d/core/TensorCheck.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+void AssertRowSplits(const Tensor& row_splits,
+                     int64_t num_rows,
+                     const Device& device) {
+    AssertTensorDtype(row_splits, core::Int64);
+    AssertTensorDevice(row_splits, device);
+    if (row_splits.NumDims() != 1 || row_splits.GetLength() == 0) {
+        utility::LogError("row_splits must have shape {{S + 1}}, but got {}.",
+                          row_splits.GetShape().ToString());
+    }
+    const int64_t num_segments = row_splits.GetLength() - 1;
+    if (row_splits[0].Item<int64_t>() != 0 ||
+        row_splits[num_segments].Item<int64_t>() != num_rows) {
+        utility::LogError(
+                "row_splits must start with 0 and end with the length of the "
+                "input {}.",
+                num_rows);
+    }
+    if (num_segments > 0 &&
+        !row_splits.Slice(0, 1, num_segments + 1)
+                 .Ge(row_splits.Slice(0, 0, num_segments))
+                 .All()) {
+        utility::LogError("row_splits must be non-decreasing.");
+    }
+}
+
+void SegmentReduction(const Tensor& src,
+                      const Tensor& row_splits,
+                      Tensor& dst,
+                      SegmentOpCode op_code) {
+    AssertTensorDevice(dst, src.GetDevice());
+    if (src.NumDims() == 0) {
+        utility::LogError("Segment reduction requires at least 1 dimension.");
+    }
+    AssertRowSplits(row_splits, src.GetLength(), src.GetDevice());
+    const int64_t num_segments = row_splits.GetLength() - 1;
+    SizeVector dst_shape = src.GetShape();
+    dst_shape[0] = num_segments;
+    AssertTensorShape(dst, dst_shape);
+    AssertTensorDtype(dst, op_code == SegmentOpCode::ArgMax ? core::Int64
+                                                            : src.GetDtype());
+
+    Device::DeviceType device_type = src.GetDevice().GetType();
+    if (device_type == Device::DeviceType::CPU) {
+        SegmentReductionCPU(src.Contiguous(), row_splits.Contiguous(), dst,
+                            op_code);
+    } else if (device_type == Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        SegmentReductionCUDA(src.Contiguous(), row_splits.Contiguous(), dst,
+                             op_code);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("SegmentReduction: Unimplemented device");
+    }
+}
+
+void PrefixSum(const Tensor& src, Tensor& dst, bool exclusive) {
+    AssertTensorDevice(dst, src.GetDevice());
+    AssertTensorDtype(dst, src.GetDtype());
+    AssertTensorShape(dst, src.GetShape());
+    if (src.NumDims() == 0) {
+        utility::LogError("Prefix sum requires at least 1 dimension.");
+    }
+    if (src.GetDtype() == core::Bool) {
+        utility::LogError("Prefix sum does not support Bool tensors.");
+    }
+
+    Device::DeviceType device_type = src.GetDevice().GetType();
+    if (device_type == Device::DeviceType::CPU) {
+        PrefixSumCPU(src.Contiguous(), dst, exclusive);
+    } else if (device_type == Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        PrefixSumCUDA(src.Contiguous(), dst, exclusive);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("PrefixSum: Unimplemented device");
+    }
+}
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,135 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+#pragma once
+
+#include "open3d/core/CUDAUtils.h"
+#include "open3d/core/Tensor.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+enum class SegmentOpCode {
+    Sum,
+    Mean,
+    Max,
+    ArgMax,
+};
+
+/// Check that \p row_splits is an Int64 tensor of shape {S + 1} on \p device,
+/// non-decreasing, starting with 0 and ending with \p num_rows.
+void AssertRowSplits(const Tensor& row_splits,
+                     int64_t num_rows,
+                     const Device& device);
+
+/// Reduce the rows of \p src over the ragged segments given by \p row_splits.
+/// Segment s covers rows [row_splits[s], row_splits[s + 1]) of \p src, and
+/// the result for segment s is written to row s of \p dst. Empty segments
+/// produce 0, or -1 for ArgMax.
+///
+/// \param src Tensor of shape {N, ...}.
+/// \param row_splits Int64 tensor of shape {S + 1}, non-decreasing, starting
+/// with 0 and ending with N.
+/// \param dst Tensor of shape {S, ...}. Int64 for ArgMax, otherwise the dtype
+/// of \p src.
+void SegmentReduction(const Tensor& src,
+                      const Tensor& row_splits,
+                      Tensor& dst,
+                      SegmentOpCode op_code);
+
+void SegmentReductionCPU(const Tensor& src,
+                         const Tensor& row_splits,
+                         Tensor& dst,
+                         SegmentOpCode op_code);
+
+#ifdef BUILD_CUDA_MODULE
+void SegmentReductionCUDA(const Tensor& src,
+                          const Tensor& row_splits,
+                          Tensor& dst,
+                          SegmentOpCode op_code);
+#endif
+
+/// Prefix sum of \p src along dimension 0, written to \p dst of the same shape
+/// and dtype. The exclusive scan starts with 0 and omits the last row.
+void PrefixSum(const Tensor& src, Tensor& dst, bool exclusive);
+
+void PrefixSumCPU(const Tensor& src, Tensor& dst, bool exclusive);
+
+#ifdef BUILD_CUDA_MODULE
+void PrefixSumCUDA(const Tensor& src, Tensor& dst, bool exclusive);
+#endif
+
+/// Reduce column `workload_idx % num_columns` of segment
+/// `workload_idx / num_columns` of the contiguous {N, num_columns} \p src.
+template <typename scalar_t>
+OPEN3D_HOST_DEVICE inline void SegmentReduceElement(SegmentOpCode op_code,
+                                                    const scalar_t* src,
+                                                    const int64_t* row_splits,
+                                                    int64_t num_columns,
+                                                    int64_t workload_idx,
+                                                    void* dst) {
+    const int64_t segment = workload_idx / num_columns;
+    const int64_t begin = row_splits[segment];
+    const int64_t end = row_splits[segment + 1];
+    const scalar_t* column = src + workload_idx % num_columns;
+
+    switch (op_code) {
+        case SegmentOpCode::Sum:
+        case SegmentOpCode::Mean: {
+            scalar_t sum = 0;
+            for (int64_t i = begin; i < end; ++i) {
+                sum += column[i * num_columns];
+            }
+            if (op_code == SegmentOpCode::Mean && end > begin) {
+                sum /= static_cast<scalar_t>(end - begin);
+            }
+            static_cast<scalar_t*>(dst)[workload_idx] = sum;
+            break;
+        }
+        case SegmentOpCode::Max:
+        case SegmentOpCode::ArgMax: {
+            int64_t arg = -1;
+            scalar_t best = 0;
+            for (int64_t i = begin; i < end; ++i) {
+                const scalar_t value = column[i * num_columns];
+                if (arg < 0 || value > best) {
+                    best = value;
+                    arg = i;
+                }
+            }
+            if (op_code == SegmentOpCode::Max) {
+                static_cast<scalar_t*>(dst)[workload_idx] = best;
+            } else {
+                static_cast<int64_t*>(dst)[workload_idx] = arg;
+            }
+            break;
+        }
+    }
+}
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
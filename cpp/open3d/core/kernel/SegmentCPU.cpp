@@ -0,0 +1,90 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+#include "open3d/core/Dispatch.h"
+#include "open3d/core/ParallelFor.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/core/kernel/Segment.h"
+#include "open3d/utility/ParallelScan.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+void SegmentReductionCPU(const Tensor& src,
+                         const Tensor& row_splits,
+                         Tensor& dst,
+                         SegmentOpCode op_code) {
+    if (dst.NumElements() == 0) {
+        return;
+    }
+    const int64_t num_columns = dst.NumElements() / dst.GetLength();
+    const int64_t* row_splits_ptr = row_splits.GetDataPtr<int64_t>();
+    void* dst_ptr = dst.GetDataPtr();
+    DISPATCH_DTYPE_TO_TEMPLATE(src.GetDtype(), [&]() {
+        const scalar_t* src_ptr = src.GetDataPtr<scalar_t>();
+        // Segment sizes vary, so let idle threads steal work.
+        ParallelFor(Device("CPU:0"), dst.NumElements(), 64, [&](int64_t i) {
+            SegmentReduceElement(op_code, src_ptr, row_splits_ptr,
+                                 num_columns, i, dst_ptr);
+        });
+    });
+}
+
+void PrefixSumCPU(const Tensor& src, Tensor& dst, bool exclusive) {
+    const int64_t length = src.GetLength();
+    if (length == 0 || src.NumElements() == 0) {
+        return;
+    }
+    const int64_t num_columns = src.NumElements() / length;
+    DISPATCH_DTYPE_TO_TEMPLATE(src.GetDtype(), [&]() {
+        const scalar_t* src_ptr = src.GetDataPtr<scalar_t>();
+        scalar_t* dst_ptr = dst.GetDataPtr<scalar_t>();
+        if (num_columns == 1) {
+            if (exclusive) {
+                dst_ptr[0] = 0;
+                utility::InclusivePrefixSum(src_ptr, src_ptr + length - 1,
+                                            dst_ptr + 1);
+            } else {
+                utility::InclusivePrefixSum(src_ptr, src_ptr + length,
+                                            dst_ptr);
+            }
+            return;
+        }
+        ParallelFor(Device("CPU:0"), num_columns, [&](int64_t c) {
+            scalar_t sum = 0;
+            for (int64_t i = 0; i < length; ++i) {
+                const scalar_t value = src_ptr[i * num_columns + c];
+                if (!exclusive) sum += value;
+                dst_ptr[i * num_columns + c] = sum;
+                if (exclusive) sum += value;
+            }
+        });
+    });
+}
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
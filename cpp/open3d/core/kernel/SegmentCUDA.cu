@@ -0,0 +1,120 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+#include <thrust/execution_policy.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/permutation_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/scan.h>
+
+#include "open3d/core/CUDAUtils.h"
+#include "open3d/core/Dispatch.h"
+#include "open3d/core/ParallelFor.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/core/kernel/Segment.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+/// Maps the k-th element of the column-major order to its column.
+struct ColumnOfFunctor {
+    int64_t length_;
+    __host__ __device__ int64_t operator()(int64_t k) const {
+        return k / length_;
+    }
+};
+
+/// Maps the k-th element of the column-major order to its row-major offset.
+struct RowMajorOffsetFunctor {
+    int64_t length_;
+    int64_t num_columns_;
+    __host__ __device__ int64_t operator()(int64_t k) const {
+        return (k % length_) * num_columns_ + k / length_;
+    }
+};
+
+void SegmentReductionCUDA(const Tensor& src,
+                          const Tensor& row_splits,
+                          Tensor& dst,
+                          SegmentOpCode op_code) {
+    CUDAScopedDevice scoped_device(src.GetDevice());
+    if (dst.NumElements() == 0) {
+        return;
+    }
+    const int64_t num_columns = dst.NumElements() / dst.GetLength();
+    const int64_t* row_splits_ptr = row_splits.GetDataPtr<int64_t>();
+    void* dst_ptr = dst.GetDataPtr();
+    DISPATCH_DTYPE_TO_TEMPLATE(src.GetDtype(), [&]() {
+        const scalar_t* src_ptr = src.GetDataPtr<scalar_t>();
+        // One thread per output element; neighbouring threads read
+        // neighbouring columns of the same row.
+        ParallelFor(src.GetDevice(), dst.NumElements(),
+                    [=] OPEN3D_DEVICE(int64_t i) {
+                        SegmentReduceElement(op_code, src_ptr, row_splits_ptr,
+                                             num_columns, i, dst_ptr);
+                    });
+    });
+    OPEN3D_GET_LAST_CUDA_ERROR("SegmentReductionCUDA failed.");
+}
+
+void PrefixSumCUDA(const Tensor& src, Tensor& dst, bool exclusive) {
+    CUDAScopedDevice scoped_device(src.GetDevice());
+    const int64_t length = src.GetLength();
+    const int64_t num_elements = src.NumElements();
+    if (length == 0 || num_elements == 0) {
+        return;
+    }
+    const int64_t num_columns = num_elements / length;
+
+    // Scan all columns in one pass, using the column as the key.
+    thrust::counting_iterator<int64_t> index_first(0);
+    auto keys = thrust::make_transform_iterator(index_first,
+                                                ColumnOfFunctor{length});
+    auto offsets = thrust::make_transform_iterator(
+            index_first, RowMajorOffsetFunctor{length, num_columns});
+    DISPATCH_DTYPE_TO_TEMPLATE(src.GetDtype(), [&]() {
+        auto src_iter = thrust::make_permutation_iterator(
+                thrust::device_pointer_cast(src.GetDataPtr<scalar_t>()),
+                offsets);
+        auto dst_iter = thrust::make_permutation_iterator(
+                thrust::device_pointer_cast(dst.GetDataPtr<scalar_t>()),
+                offsets);
+        if (exclusive) {
+            thrust::exclusive_scan_by_key(
+                    thrust::cuda::par.on(cuda::GetStream()), keys,
+                    keys + num_elements, src_iter, dst_iter, scalar_t(0));
+        } else {
+            thrust::inclusive_scan_by_key(
+                    thrust::cuda::par.on(cuda::GetStream()), keys,
+                    keys + num_elements, src_iter, dst_iter);
+        }
+    });
+    OPEN3D_GET_LAST_CUDA_ERROR("PrefixSumCUDA failed.");
+}
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
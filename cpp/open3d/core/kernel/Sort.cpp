@@ -0,0 +1,112 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+#include "open3d/core/kernel/Sort.h"
+
+#include "open3d/core/Device.h"
+#include "open3d/core/TensorCheck.h"
+#include "open3d/core/kernel/Segment.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+static void AssertSortPairs(const Tensor& keys,
+                            const Tensor& values,
+                            const Tensor& sorted_keys,
+                            const Tensor& sorted_values) {
+    if (keys.NumDims() != 1) {
+        utility::LogError("Sort only supports 1-D tensors, but got shape {}.",
+                          keys.GetShape().ToString());
+    }
+    if (keys.GetDtype() == core::Bool) {
+        utility::LogError("Sort does not support Bool tensors.");
+    }
+    const Device device = keys.GetDevice();
+    AssertTensorDtype(values, core::Int64);
+    AssertTensorShape(values, keys.GetShape());
+    AssertTensorDevice(values, device);
+    AssertTensorDtype(sorted_keys, keys.GetDtype());
+    AssertTensorShape(sorted_keys, keys.GetShape());
+    AssertTensorDevice(sorted_keys, device);
+    AssertTensorDtype(sorted_values, core::Int64);
+    AssertTensorShape(sorted_values, keys.GetShape());
+    AssertTensorDevice(sorted_values, device);
+}
+
+void SortPairs(const Tensor& keys,
+               const Tensor& values,
+               Tensor& sorted_keys,
+               Tensor& sorted_values,
+               bool descending) {
+    AssertSortPairs(keys, values, sorted_keys, sorted_values);
+
+    Device::DeviceType device_type = keys.GetDevice().GetType();
+    if (device_type == Device::DeviceType::CPU) {
+        SortPairsCPU(keys.Contiguous(), values.Contiguous(), sorted_keys,
+                     sorted_values, descending);
+    } else if (device_type == Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        SortPairsCUDA(keys.Contiguous(), values.Contiguous(), sorted_keys,
+                      sorted_values, descending);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("SortPairs: Unimplemented device");
+    }
+}
+
+void SegmentedSortPairs(const Tensor& keys,
+                        const Tensor& values,
+                        const Tensor& row_splits,
+                        Tensor& sorted_keys,
+                        Tensor& sorted_values,
+                        bool descending) {
+    AssertSortPairs(keys, values, sorted_keys, sorted_values);
+    AssertRowSplits(row_splits, keys.GetLength(), keys.GetDevice());
+
+    Device::DeviceType device_type = keys.GetDevice().GetType();
+    if (device_type == Device::DeviceType::CPU) {
+        SegmentedSortPairsCPU(keys.Contiguous(), values.Contiguous(),
+                              row_splits.Contiguous(), sorted_keys,
+                              sorted_values, descending);
+    } else if (device_type == Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        SegmentedSortPairsCUDA(keys.Contiguous(), values.Contiguous(),
+                               row_splits.Contiguous(), sorted_keys,
+                               sorted_values, descending);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("SegmentedSortPairs: Unimplemented device");
+    }
+}
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,86 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+#pragma once
+
+#include "open3d/core/Tensor.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+/// Stable sort of the 1-D \p keys, permuting the Int64 \p values along. Equal
+/// keys keep their input order, also when sorting in descending order.
+///
+/// \param keys 1-D tensor of any non-boolean dtype.
+/// \param values Int64 tensor with the same length as \p keys.
+/// \param sorted_keys Output with the shape and dtype of \p keys.
+/// \param sorted_values Output with the shape and dtype of \p values.
+void SortPairs(const Tensor& keys,
+               const Tensor& values,
+               Tensor& sorted_keys,
+               Tensor& sorted_values,
+               bool descending);
+
+/// Segmented version of SortPairs(). Each segment [row_splits[s],
+/// row_splits[s + 1]) is sorted independently and stays in place.
+void SegmentedSortPairs(const Tensor& keys,
+                        const Tensor& values,
+                        const Tensor& row_splits,
+                        Tensor& sorted_keys,
+                        Tensor& sorted_values,
+                        bool descending);
+
+void SortPairsCPU(const Tensor& keys,
+                  const Tensor& values,
+                  Tensor& sorted_keys,
+                  Tensor& sorted_values,
+                  bool descending);
+
+void SegmentedSortPairsCPU(const Tensor& keys,
+                           const Tensor& values,
+                           const Tensor& row_splits,
+                           Tensor& sorted_keys,
+                           Tensor& sorted_values,
+                           bool descending);
+
+#ifdef BUILD_CUDA_MODULE
+void SortPairsCUDA(const Tensor& keys,
+                   const Tensor& values,
+                   Tensor& sorted_keys,
+                   Tensor& sorted_values,
+                   bool descending);
+
+void SegmentedSortPairsCUDA(const Tensor& keys,
+                            const Tensor& values,
+                            const Tensor& row_splits,
+                            Tensor& sorted_keys,
+                            Tensor& sorted_values,
+                            bool descending);
+#endif
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
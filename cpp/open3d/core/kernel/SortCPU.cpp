@@ -0,0 +1,211 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+#include <algorithm>
+#include <cstring>
+#include <numeric>
+#include <type_traits>
+#include <vector>
+
+#include "open3d/core/Dispatch.h"
+#include "open3d/core/ParallelFor.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/core/kernel/Sort.h"
+#include "open3d/utility/Parallel.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+namespace {
+
+template <int num_bytes>
+struct RadixBits;
+template <>
+struct RadixBits<1> {
+    using type = uint8_t;
+};
+template <>
+struct RadixBits<2> {
+    using type = uint16_t;
+};
+template <>
+struct RadixBits<4> {
+    using type = uint32_t;
+};
+template <>
+struct RadixBits<8> {
+    using type = uint64_t;
+};
+
+/// Map \p value to an unsigned integer with the same ordering.
+template <typename scalar_t,
+          typename bits_t = typename RadixBits<sizeof(scalar_t)>::type>
+bits_t ToRadixKey(scalar_t value, bool descending) {
+    constexpr bits_t sign_bit = bits_t(1) << (8 * sizeof(bits_t) - 1);
+    bits_t bits;
+    std::memcpy(&bits, &value, sizeof(bits_t));
+    if (std::is_floating_point<scalar_t>::value) {
+        bits = (bits & sign_bit) ? static_cast<bits_t>(~bits)
+                                 : static_cast<bits_t>(bits | sign_bit);
+    } else if (std::is_signed<scalar_t>::value) {
+        bits = static_cast<bits_t>(bits ^ sign_bit);
+    }
+    return descending ? static_cast<bits_t>(~bits) : bits;
+}
+
+/// Stable LSD radix sort of (keys, indices) with 8-bit digits. Each pass
+/// builds per-chunk digit histograms in parallel and scatters every chunk to
+/// its own offsets, so the sort stays stable. Passes where all keys share
+/// the same digit are skipped.
+template <typename bits_t>
+void RadixSortPairs(std::vector<bits_t>& keys, std::vector<int64_t>& indices) {
+    constexpr int64_t kNumBuckets = 256;
+    constexpr int64_t kMinChunkSize = 1 << 16;
+    const int64_t n = static_cast<int64_t>(keys.size());
+    const int64_t num_chunks = std::max<int64_t>(
+            1, std::min<int64_t>(utility::EstimateMaxThreads(),
+                                 n / kMinChunkSize));
+    const int64_t chunk_size = (n + num_chunks - 1) / num_chunks;
+
+    std::vector<bits_t> keys_out(n);
+    std::vector<int64_t> indices_out(n);
+    std::vector<int64_t> offsets(num_chunks * kNumBuckets);
+    for (size_t shift = 0; shift < 8 * sizeof(bits_t); shift += 8) {
+        std::fill(offsets.begin(), offsets.end(), 0);
+        ParallelFor(Device("CPU:0"), num_chunks, [&](int64_t chunk) {
+            int64_t* histogram = offsets.data() + chunk * kNumBuckets;
+            const int64_t end = std::min(n, (chunk + 1) * chunk_size);
+            for (int64_t i = chunk * chunk_size; i < end; ++i) {
+                ++histogram[(keys[i] >> shift) & 0xff];
+            }
+        });
+
+        // Exclusive scan in (digit, chunk) order.
+        int64_t offset = 0;
+        bool skip = false;
+        for (int64_t digit = 0; digit < kNumBuckets && !skip; ++digit) {
+            int64_t digit_count = 0;
+            for (int64_t chunk = 0; chunk < num_chunks; ++chunk) {
+                int64_t& count = offsets[chunk * kNumBuckets + digit];
+                digit_count += count;
+                const int64_t chunk_offset = offset;
+                offset += count;
+                count = chunk_offset;
+            }
+            skip = digit_count == n;
+        }
+        if (skip) {
+            continue;
+        }
+
+        ParallelFor(Device("CPU:0"), num_chunks, [&](int64_t chunk) {
+            int64_t* chunk_offsets = offsets.data() + chunk * kNumBuckets;
+            const int64_t end = std::min(n, (chunk + 1) * chunk_size);
+            for (int64_t i = chunk * chunk_size; i < end; ++i) {
+                const int64_t dst = chunk_offsets[(keys[i] >> shift) & 0xff]++;
+                keys_out[dst] = keys[i];
+                indices_out[dst] = indices[i];
+            }
+        });
+        keys.swap(keys_out);
+        indices.swap(indices_out);
+    }
+}
+
+/// Gather the keys and values of the sorted \p order.
+template <typename scalar_t>
+void GatherSorted(const Tensor& keys,
+                  const Tensor& values,
+                  const std::vector<int64_t>& order,
+                  Tensor& sorted_keys,
+                  Tensor& sorted_values) {
+    const scalar_t* keys_ptr = keys.GetDataPtr<scalar_t>();
+    const int64_t* values_ptr = values.GetDataPtr<int64_t>();
+    scalar_t* sorted_keys_ptr = sorted_keys.GetDataPtr<scalar_t>();
+    int64_t* sorted_values_ptr = sorted_values.GetDataPtr<int64_t>();
+    ParallelFor(Device("CPU:0"), keys.GetLength(), [&](int64_t i) {
+        sorted_keys_ptr[i] = keys_ptr[order[i]];
+        sorted_values_ptr[i] = values_ptr[order[i]];
+    });
+}
+
+}  // namespace
+
+void SortPairsCPU(const Tensor& keys,
+                  const Tensor& values,
+                  Tensor& sorted_keys,
+                  Tensor& sorted_values,
+                  bool descending) {
+    const int64_t n = keys.GetLength();
+    DISPATCH_DTYPE_TO_TEMPLATE(keys.GetDtype(), [&]() {
+        using bits_t = typename RadixBits<sizeof(scalar_t)>::type;
+        const scalar_t* keys_ptr = keys.GetDataPtr<scalar_t>();
+        std::vector<bits_t> radix_keys(n);
+        ParallelFor(Device("CPU:0"), n, [&](int64_t i) {
+            radix_keys[i] = ToRadixKey(keys_ptr[i], descending);
+        });
+        std::vector<int64_t> order(n);
+        std::iota(order.begin(), order.end(), 0);
+        RadixSortPairs(radix_keys, order);
+        GatherSorted<scalar_t>(keys, values, order, sorted_keys,
+                               sorted_values);
+    });
+}
+
+void SegmentedSortPairsCPU(const Tensor& keys,
+                           const Tensor& values,
+                           const Tensor& row_splits,
+                           Tensor& sorted_keys,
+                           Tensor& sorted_values,
+                           bool descending) {
+    const int64_t n = keys.GetLength();
+    const int64_t num_segments = row_splits.GetLength() - 1;
+    const int64_t* row_splits_ptr = row_splits.GetDataPtr<int64_t>();
+    DISPATCH_DTYPE_TO_TEMPLATE(keys.GetDtype(), [&]() {
+        using bits_t = typename RadixBits<sizeof(scalar_t)>::type;
+        const scalar_t* keys_ptr = keys.GetDataPtr<scalar_t>();
+        std::vector<bits_t> radix_keys(n);
+        ParallelFor(Device("CPU:0"), n, [&](int64_t i) {
+            radix_keys[i] = ToRadixKey(keys_ptr[i], descending);
+        });
+        std::vector<int64_t> order(n);
+        std::iota(order.begin(), order.end(), 0);
+        // Segment sizes vary, so let idle threads steal work.
+        ParallelFor(Device("CPU:0"), num_segments, 1, [&](int64_t s) {
+            std::stable_sort(order.begin() + row_splits_ptr[s],
+                             order.begin() + row_splits_ptr[s + 1],
+                             [&](int64_t a, int64_t b) {
+                                 return radix_keys[a] < radix_keys[b];
+                             });
+        });
+        GatherSorted<scalar_t>(keys, values, order, sorted_keys,
+                               sorted_values);
+    });
+}
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,132 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+#include <cub/cub.cuh>
+#include <limits>
+
+#include "open3d/core/CUDAUtils.h"
+#include "open3d/core/Dispatch.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/core/kernel/Sort.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+static void AssertCUBSize(int64_t num_items) {
+    if (num_items > std::numeric_limits<int>::max()) {
+        utility::LogError("CUDA sort supports at most {} elements, but got {}.",
+                          std::numeric_limits<int>::max(), num_items);
+    }
+}
+
+void SortPairsCUDA(const Tensor& keys,
+                   const Tensor& values,
+                   Tensor& sorted_keys,
+                   Tensor& sorted_values,
+                   bool descending) {
+    CUDAScopedDevice scoped_device(keys.GetDevice());
+    const int64_t n = keys.GetLength();
+    AssertCUBSize(n);
+    if (n == 0) {
+        return;
+    }
+    DISPATCH_DTYPE_TO_TEMPLATE(keys.GetDtype(), [&]() {
+        const scalar_t* keys_ptr = keys.GetDataPtr<scalar_t>();
+        const int64_t* values_ptr = values.GetDataPtr<int64_t>();
+        scalar_t* sorted_keys_ptr = sorted_keys.GetDataPtr<scalar_t>();
+        int64_t* sorted_values_ptr = sorted_values.GetDataPtr<int64_t>();
+        auto sort = [&](void* temp, size_t& temp_bytes) {
+            if (descending) {
+                OPEN3D_CUDA_CHECK(cub::DeviceRadixSort::SortPairsDescending(
+                        temp, temp_bytes, keys_ptr, sorted_keys_ptr,
+                        values_ptr, sorted_values_ptr, static_cast<int>(n), 0,
+                        8 * sizeof(scalar_t), cuda::GetStream()));
+            } else {
+                OPEN3D_CUDA_CHECK(cub::DeviceRadixSort::SortPairs(
+                        temp, temp_bytes, keys_ptr, sorted_keys_ptr,
+                        values_ptr, sorted_values_ptr, static_cast<int>(n), 0,
+                        8 * sizeof(scalar_t), cuda::GetStream()));
+            }
+        };
+        size_t temp_bytes = 0;
+        sort(nullptr, temp_bytes);
+        Tensor temp({static_cast<int64_t>(temp_bytes)}, core::UInt8,
+                    keys.GetDevice());
+        sort(temp.GetDataPtr(), temp_bytes);
+    });
+}
+
+void SegmentedSortPairsCUDA(const Tensor& keys,
+                            const Tensor& values,
+                            const Tensor& row_splits,
+                            Tensor& sorted_keys,
+                            Tensor& sorted_values,
+                            bool descending) {
+    CUDAScopedDevice scoped_device(keys.GetDevice());
+    const int64_t n = keys.GetLength();
+    const int64_t num_segments = row_splits.GetLength() - 1;
+    AssertCUBSize(n);
+    AssertCUBSize(num_segments);
+    if (n == 0) {
+        return;
+    }
+    const int64_t* row_splits_ptr = row_splits.GetDataPtr<int64_t>();
+    DISPATCH_DTYPE_TO_TEMPLATE(keys.GetDtype(), [&]() {
+        const scalar_t* keys_ptr = keys.GetDataPtr<scalar_t>();
+        const int64_t* values_ptr = values.GetDataPtr<int64_t>();
+        scalar_t* sorted_keys_ptr = sorted_keys.GetDataPtr<scalar_t>();
+        int64_t* sorted_values_ptr = sorted_values.GetDataPtr<int64_t>();
+        auto sort = [&](void* temp, size_t& temp_bytes) {
+            if (descending) {
+                OPEN3D_CUDA_CHECK(
+                        cub::DeviceSegmentedRadixSort::SortPairsDescending(
+                                temp, temp_bytes, keys_ptr, sorted_keys_ptr,
+                                values_ptr, sorted_values_ptr,
+                                static_cast<int>(n),
+                                static_cast<int>(num_segments), row_splits_ptr,
+                                row_splits_ptr + 1, 0, 8 * sizeof(scalar_t),
+                                cuda::GetStream()));
+            } else {
+                OPEN3D_CUDA_CHECK(cub::DeviceSegmentedRadixSort::SortPairs(
+                        temp, temp_bytes, keys_ptr, sorted_keys_ptr,
+                        values_ptr, sorted_values_ptr, static_cast<int>(n),
+                        static_cast<int>(num_segments), row_splits_ptr,
+                        row_splits_ptr + 1, 0, 8 * sizeof(scalar_t),
+                        cuda::GetStream()));
+            }
+        };
+        size_t temp_bytes = 0;
+        sort(nullptr, temp_bytes);
+        Tensor temp({static_cast<int64_t>(temp_bytes)}, core::UInt8,
+                    keys.GetDevice());
+        sort(temp.GetDataPtr(), temp_bytes);
+    });
+}
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
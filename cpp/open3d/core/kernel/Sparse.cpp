@@ -0,0 +1,104 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/core/kernel/Sparse.h"
+
+#include "open3d/core/Device.h"
+#include "open3d/core/TensorCheck.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+void CSRRowSplits(const Tensor& sorted_rows,
+                  int64_t num_rows,
+                  Tensor& row_splits) {
+    AssertTensorDtype(sorted_rows, core::Int64);
+    row_splits =
+            Tensor::Empty({num_rows + 1}, core::Int64, sorted_rows.GetDevice());
+    Device::DeviceType device_type = sorted_rows.GetDevice().GetType();
+    if (device_type == Device::DeviceType::CPU) {
+        CSRRowSplitsCPU(sorted_rows.Contiguous(), row_splits);
+    } else if (device_type == Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        CSRRowSplitsCUDA(sorted_rows.Contiguous(), row_splits);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("CSRRowSplits: Unimplemented device.");
+    }
+}
+
+void CSRRowIndices(const Tensor& row_splits, int64_t nnz, Tensor& rows) {
+    AssertTensorDtype(row_splits, core::Int64);
+    rows = Tensor::Empty({nnz}, core::Int64, row_splits.GetDevice());
+    Device::DeviceType device_type = row_splits.GetDevice().GetType();
+    if (device_type == Device::DeviceType::CPU) {
+        CSRRowIndicesCPU(row_splits.Contiguous(), rows);
+    } else if (device_type == Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        CSRRowIndicesCUDA(row_splits.Contiguous(), rows);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("CSRRowIndices: Unimplemented device.");
+    }
+}
+
+void CSRMatmul(const Tensor& row_splits,
+               const Tensor& col_indices,
+               const Tensor& values,
+               const Tensor& B,
+               Tensor& C) {
+    const Device device = values.GetDevice();
+    AssertTensorDevice(B, device);
+    AssertTensorDtype(B, values.GetDtype());
+    AssertTensorDevice(C, device);
+    AssertTensorDtype(C, values.GetDtype());
+
+    Device::DeviceType device_type = device.GetType();
+    if (device_type == Device::DeviceType::CPU) {
+        CSRMatmulCPU(row_splits.Contiguous(), col_indices.Contiguous(),
+                     values.Contiguous(), B.Contiguous(), C);
+    } else if (device_type == Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        CSRMatmulCUDA(row_splits.Contiguous(), col_indices.Contiguous(),
+                      values.Contiguous(), B.Contiguous(), C);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("CSRMatmul: Unimplemented device.");
+    }
+}
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
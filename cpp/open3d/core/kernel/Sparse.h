@@ -0,0 +1,113 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#pragma once
+
+#include "open3d/core/CUDAUtils.h"
+#include "open3d/core/Tensor.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+/// Computes the {num_rows + 1} CSR \p row_splits of the sorted Int64 row
+/// indices \p sorted_rows.
+void CSRRowSplits(const Tensor& sorted_rows,
+                  int64_t num_rows,
+                  Tensor& row_splits);
+
+/// Expands the CSR \p row_splits to the {nnz} Int64 row index of every entry.
+void CSRRowIndices(const Tensor& row_splits, int64_t nnz, Tensor& rows);
+
+/// C = A B for the CSR matrix A given by \p row_splits, \p col_indices and
+/// \p values. B is {cols} or {cols, k} and C is {rows} or {rows, k}.
+void CSRMatmul(const Tensor& row_splits,
+               const Tensor& col_indices,
+               const Tensor& values,
+               const Tensor& B,
+               Tensor& C);
+
+/// Index of the first entry of the sorted \p rows of length \p nnz that is not
+/// less than \p row.
+OPEN3D_HOST_DEVICE inline int64_t CSRLowerBound(const int64_t* rows,
+                                                int64_t nnz,
+                                                int64_t row) {
+    int64_t begin = 0, end = nnz;
+    while (begin < end) {
+        const int64_t mid = begin + (end - begin) / 2;
+        if (rows[mid] < row) {
+            begin = mid + 1;
+        } else {
+            end = mid;
+        }
+    }
+    return begin;
+}
+
+/// Computes element \p idx of the row-major {rows, k} output of CSRMatmul().
+template <typename scalar_t>
+OPEN3D_HOST_DEVICE inline void CSRMatmulElement(const int64_t* row_splits,
+                                                const int64_t* col_indices,
+                                                const scalar_t* values,
+                                                const scalar_t* B,
+                                                int64_t k,
+                                                int64_t idx,
+                                                scalar_t* C) {
+    const int64_t row = idx / k;
+    const int64_t col = idx - row * k;
+    scalar_t sum = 0;
+    for (int64_t i = row_splits[row]; i < row_splits[row + 1]; ++i) {
+        sum += values[i] * B[col_indices[i] * k + col];
+    }
+    C[idx] = sum;
+}
+
+void CSRRowSplitsCPU(const Tensor& sorted_rows, Tensor& row_splits);
+
+void CSRRowIndicesCPU(const Tensor& row_splits, Tensor& rows);
+
+void CSRMatmulCPU(const Tensor& row_splits,
+                  const Tensor& col_indices,
+                  const Tensor& values,
+                  const Tensor& B,
+                  Tensor& C);
+
+#ifdef BUILD_CUDA_MODULE
+void CSRRowSplitsCUDA(const Tensor& sorted_rows, Tensor& row_splits);
+
+void CSRRowIndicesCUDA(const Tensor& row_splits, Tensor& rows);
+
+void CSRMatmulCUDA(const Tensor& row_splits,
+                   const Tensor& col_indices,
+                   const Tensor& values,
+                   const Tensor& B,
+                   Tensor& C);
+#endif
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,81 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/core/Dispatch.h"
+#include "open3d/core/ParallelFor.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/core/kernel/Sparse.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+void CSRRowSplitsCPU(const Tensor& sorted_rows, Tensor& row_splits) {
+    const int64_t* rows_ptr = sorted_rows.GetDataPtr<int64_t>();
+    const int64_t nnz = sorted_rows.GetLength();
+    int64_t* row_splits_ptr = row_splits.GetDataPtr<int64_t>();
+    ParallelFor(Device("CPU:0"), row_splits.GetLength(), [&](int64_t r) {
+        row_splits_ptr[r] = CSRLowerBound(rows_ptr, nnz, r);
+    });
+}
+
+void CSRRowIndicesCPU(const Tensor& row_splits, Tensor& rows) {
+    const int64_t* row_splits_ptr = row_splits.GetDataPtr<int64_t>();
+    int64_t* rows_ptr = rows.GetDataPtr<int64_t>();
+    ParallelFor(Device("CPU:0"), row_splits.GetLength() - 1, [&](int64_t r) {
+        for (int64_t i = row_splits_ptr[r]; i < row_splits_ptr[r + 1]; ++i) {
+            rows_ptr[i] = r;
+        }
+    });
+}
+
+void CSRMatmulCPU(const Tensor& row_splits,
+                  const Tensor& col_indices,
+                  const Tensor& values,
+                  const Tensor& B,
+                  Tensor& C) {
+    if (C.NumElements() == 0) {
+        return;
+    }
+    const int64_t k = C.NumDims() == 2 ? C.GetShape(1) : 1;
+    const int64_t* row_splits_ptr = row_splits.GetDataPtr<int64_t>();
+    const int64_t* col_indices_ptr = col_indices.GetDataPtr<int64_t>();
+    DISPATCH_DTYPE_TO_TEMPLATE(values.GetDtype(), [&]() {
+        const scalar_t* values_ptr = values.GetDataPtr<scalar_t>();
+        const scalar_t* B_ptr = B.GetDataPtr<scalar_t>();
+        scalar_t* C_ptr = C.GetDataPtr<scalar_t>();
+        // Row lengths vary, so let idle threads steal work.
+        ParallelFor(Device("CPU:0"), C.NumElements(), 64, [&](int64_t i) {
+            CSRMatmulElement(row_splits_ptr, col_indices_ptr, values_ptr,
+                             B_ptr, k, i, C_ptr);
+        });
+    });
+}
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,190 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/core/CUDAUtils.h"
+#include "open3d/core/Dispatch.h"
+#include "open3d/core/ParallelFor.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/core/kernel/Sparse.h"
+#include "open3d/core/linalg/LinalgUtils.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+void CSRRowSplitsCUDA(const Tensor& sorted_rows, Tensor& row_splits) {
+    CUDAScopedDevice scoped_device(sorted_rows.GetDevice());
+    const int64_t* rows_ptr = sorted_rows.GetDataPtr<int64_t>();
+    const int64_t nnz = sorted_rows.GetLength();
+    int64_t* row_splits_ptr = row_splits.GetDataPtr<int64_t>();
+    ParallelFor(sorted_rows.GetDevice(), row_splits.GetLength(),
+                [=] OPEN3D_DEVICE(int64_t r) {
+                    row_splits_ptr[r] = CSRLowerBound(rows_ptr, nnz, r);
+                });
+}
+
+void CSRRowIndicesCUDA(const Tensor& row_splits, Tensor& rows) {
+    CUDAScopedDevice scoped_device(row_splits.GetDevice());
+    const int64_t* row_splits_ptr = row_splits.GetDataPtr<int64_t>();
+    int64_t* rows_ptr = rows.GetDataPtr<int64_t>();
+    // One workload per entry keeps long rows from serializing a thread.
+    const int64_t num_rows = row_splits.GetLength() - 1;
+    ParallelFor(row_splits.GetDevice(), rows.GetLength(),
+                [=] OPEN3D_DEVICE(int64_t i) {
+                    rows_ptr[i] =
+                            CSRLowerBound(row_splits_ptr, num_rows + 1, i + 1) -
+                            1;
+                });
+}
+
+#if CUDART_VERSION >= 11020
+/// cuSPARSE generic SpMV / SpMM for Float32 and Float64 values.
+static void CSRMatmulCuSparse(const Tensor& row_splits,
+                              const Tensor& col_indices,
+                              const Tensor& values,
+                              const Tensor& B,
+                              Tensor& C) {
+    const Device device = values.GetDevice();
+    const int64_t num_rows = row_splits.GetLength() - 1;
+    const int64_t num_cols = B.GetLength();
+    const cudaDataType data_type =
+            values.GetDtype() == core::Float32 ? CUDA_R_32F : CUDA_R_64F;
+    cusparseHandle_t handle = CuSparseContext::GetInstance()->GetHandle();
+    OPEN3D_CUSPARSE_CHECK(cusparseSetStream(handle, cuda::GetStream()),
+                          "cusparseSetStream failed");
+
+    cusparseSpMatDescr_t A_desc;
+    OPEN3D_CUSPARSE_CHECK(
+            cusparseCreateCsr(&A_desc, num_rows, num_cols, values.GetLength(),
+                              const_cast<void*>(row_splits.GetDataPtr()),
+                              const_cast<void*>(col_indices.GetDataPtr()),
+                              const_cast<void*>(values.GetDataPtr()),
+                              CUSPARSE_INDEX_64I, CUSPARSE_INDEX_64I,
+                              CUSPARSE_INDEX_BASE_ZERO, data_type),
+            "cusparseCreateCsr failed");
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(values.GetDtype(), [&]() {
+        const scalar_t alpha = 1, beta = 0;
+        size_t buffer_size = 0;
+        if (C.NumDims() == 1) {
+            cusparseDnVecDescr_t B_desc, C_desc;
+            OPEN3D_CUSPARSE_CHECK(
+                    cusparseCreateDnVec(&B_desc, num_cols,
+                                        const_cast<void*>(B.GetDataPtr()),
+                                        data_type),
+                    "cusparseCreateDnVec failed");
+            OPEN3D_CUSPARSE_CHECK(cusparseCreateDnVec(&C_desc, num_rows,
+                                                      C.GetDataPtr(),
+                                                      data_type),
+                                  "cusparseCreateDnVec failed");
+            OPEN3D_CUSPARSE_CHECK(
+                    cusparseSpMV_bufferSize(
+                            handle, CUSPARSE_OPERATION_NON_TRANSPOSE, &alpha,
+                            A_desc, B_desc, &beta, C_desc, data_type,
+                            CUSPARSE_SPMV_ALG_DEFAULT, &buffer_size),
+                    "cusparseSpMV_bufferSize failed");
+            Tensor buffer = Tensor::Empty({static_cast<int64_t>(buffer_size)},
+                                          core::UInt8, device);
+            OPEN3D_CUSPARSE_CHECK(
+                    cusparseSpMV(handle, CUSPARSE_OPERATION_NON_TRANSPOSE,
+                                 &alpha, A_desc, B_desc, &beta, C_desc,
+                                 data_type, CUSPARSE_SPMV_ALG_DEFAULT,
+                                 buffer.GetDataPtr()),
+                    "cusparseSpMV failed");
+            cusparseDestroyDnVec(B_desc);
+            cusparseDestroyDnVec(C_desc);
+        } else {
+            const int64_t k = C.GetShape(1);
+            cusparseDnMatDescr_t B_desc, C_desc;
+            OPEN3D_CUSPARSE_CHECK(
+                    cusparseCreateDnMat(&B_desc, num_cols, k, k,
+                                        const_cast<void*>(B.GetDataPtr()),
+                                        data_type, CUSPARSE_ORDER_ROW),
+                    "cusparseCreateDnMat failed");
+            OPEN3D_CUSPARSE_CHECK(
+                    cusparseCreateDnMat(&C_desc, num_rows, k, k,
+                                        C.GetDataPtr(), data_type,
+                                        CUSPARSE_ORDER_ROW),
+                    "cusparseCreateDnMat failed");
+            OPEN3D_CUSPARSE_CHECK(
+                    cusparseSpMM_bufferSize(
+                            handle, CUSPARSE_OPERATION_NON_TRANSPOSE,
+                            CUSPARSE_OPERATION_NON_TRANSPOSE, &alpha, A_desc,
+                            B_desc, &beta, C_desc, data_type,
+                            CUSPARSE_SPMM_ALG_DEFAULT, &buffer_size),
+                    "cusparseSpMM_bufferSize failed");
+            Tensor buffer = Tensor::Empty({static_cast<int64_t>(buffer_size)},
+                                          core::UInt8, device);
+            OPEN3D_CUSPARSE_CHECK(
+                    cusparseSpMM(handle, CUSPARSE_OPERATION_NON_TRANSPOSE,
+                                 CUSPARSE_OPERATION_NON_TRANSPOSE, &alpha,
+                                 A_desc, B_desc, &beta, C_desc, data_type,
+                                 CUSPARSE_SPMM_ALG_DEFAULT,
+                                 buffer.GetDataPtr()),
+                    "cusparseSpMM failed");
+            cusparseDestroyDnMat(B_desc);
+            cusparseDestroyDnMat(C_desc);
+        }
+    });
+    cusparseDestroySpMat(A_desc);
+}
+#endif
+
+void CSRMatmulCUDA(const Tensor& row_splits,
+                   const Tensor& col_indices,
+                   const Tensor& values,
+                   const Tensor& B,
+                   Tensor& C) {
+    CUDAScopedDevice scoped_device(values.GetDevice());
+    if (C.NumElements() == 0) {
+        return;
+    }
+    const Dtype dtype = values.GetDtype();
+#if CUDART_VERSION >= 11020
+    if ((dtype == core::Float32 || dtype == core::Float64) &&
+        values.GetLength() > 0) {
+        CSRMatmulCuSparse(row_splits, col_indices, values, B, C);
+        return;
+    }
+#endif
+    const int64_t k = C.NumDims() == 2 ? C.GetShape(1) : 1;
+    const int64_t* row_splits_ptr = row_splits.GetDataPtr<int64_t>();
+    const int64_t* col_indices_ptr = col_indices.GetDataPtr<int64_t>();
+    DISPATCH_DTYPE_TO_TEMPLATE(dtype, [&]() {
+        const scalar_t* values_ptr = values.GetDataPtr<scalar_t>();
+        const scalar_t* B_ptr = B.GetDataPtr<scalar_t>();
+        scalar_t* C_ptr = C.GetDataPtr<scalar_t>();
+        ParallelFor(values.GetDevice(), C.NumElements(),
+                    [=] OPEN3D_DEVICE(int64_t i) {
+                        CSRMatmulElement(row_splits_ptr, col_indices_ptr,
+                                         values_ptr, B_ptr, k, i, C_ptr);
+                    });
+    });
+}
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
@@ -49,6 +49,20 @@ void UnaryEW(const Tensor& src, Tensor& dst, UnaryEWOpCode op_code) {
                           src_device.ToString(), dst_device.ToString());
     }
 
+    // Half precision tensors are computed in Float32 and rounded on store.
+    if (src.GetDtype().IsHalf()) {
+        Tensor dst_float =
+                dst.GetDtype().IsHalf()
+                        ? Tensor::Empty(dst.GetShape(), core::Float32,
+                                        dst_device)
+                        : dst;
+        UnaryEW(src.To(core::Float32), dst_float, op_code);
+        if (dst_float.GetDtype() != dst.GetDtype()) {
+            dst.AsRvalue() = dst_float;
+        }
+        return;
+    }
+
     if (src_device.GetType() == Device::DeviceType::CPU) {
         UnaryEWCPU(src, dst, op_code);
     } else if (src_device.GetType() == Device::DeviceType::CUDA) {
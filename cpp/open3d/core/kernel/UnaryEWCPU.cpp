@@ -55,9 +55,62 @@ static void LaunchUnaryEWKernel(const Indexer& indexer,
                 });
 }
 
+template <typename src_t,
+          typename dst_t,
+          IndexerLayout src_layout,
+          typename element_func_t>
+static void LaunchDenseUnaryEWKernel(const Indexer& indexer,
+                                     const element_func_t& element_func) {
+    ParallelFor(Device("CPU:0"), indexer.NumWorkloads(),
+                [&indexer, &element_func](int64_t i) {
+                    element_func(
+                            indexer.GetInputPtr<src_t, src_layout>(0, i),
+                            indexer.GetOutputPtr<dst_t,
+                                                 IndexerLayout::Contiguous>(i));
+                });
+}
+
+/// Launches \p element_func with the operand layouts resolved at compile time
+/// if the output is contiguous. Returns false if the layouts have no
+/// specialization, in which case the generic kernel shall be used.
+///
+/// \param specialize_contiguous If false, the all-contiguous case is left to
+/// the caller, e.g. for the ISPC kernels.
+template <typename src_t, typename dst_t, typename element_func_t>
+static bool LaunchDenseUnaryEWKernel(const Indexer& indexer,
+                                     const element_func_t& element_func,
+                                     bool specialize_contiguous) {
+    if (indexer.GetOutputLayout() != IndexerLayout::Contiguous) {
+        return false;
+    }
+    switch (indexer.GetInputLayout(0)) {
+        case IndexerLayout::Contiguous:
+            if (!specialize_contiguous) {
+                return false;
+            }
+            LaunchDenseUnaryEWKernel<src_t, dst_t, IndexerLayout::Contiguous>(
+                    indexer, element_func);
+            return true;
+        case IndexerLayout::Scalar:
+            LaunchDenseUnaryEWKernel<src_t, dst_t, IndexerLayout::Scalar>(
+                    indexer, element_func);
+            return true;
+        case IndexerLayout::InnerBroadcast:
+            LaunchDenseUnaryEWKernel<src_t, dst_t,
+                                     IndexerLayout::InnerBroadcast>(
+                    indexer, element_func);
+            return true;
+        default:
+            return false;
+    }
+}
+
 template <typename src_t, typename dst_t, typename element_func_t>
 static void LaunchUnaryEWKernel(const Indexer& indexer,
                                 const element_func_t& element_func) {
+    if (LaunchDenseUnaryEWKernel<src_t, dst_t>(indexer, element_func, true)) {
+        return;
+    }
     ParallelFor(Device("CPU:0"), indexer.NumWorkloads(),
                 [&indexer, &element_func](int64_t i) {
                     element_func(indexer.GetInputPtr<src_t>(0, i),
@@ -72,6 +125,17 @@ template <typename src_t,
 static void LaunchUnaryEWKernel(const Indexer& indexer,
                                 const element_func_t& element_func,
                                 const vec_func_t& vec_func) {
+#ifdef BUILD_ISPC_MODULE
+    // The ISPC kernels vectorize the all-contiguous case, but compute the
+    // generic per-lane offsets for broadcast operands.
+    const bool specialize_contiguous = false;
+#else
+    const bool specialize_contiguous = true;
+#endif
+    if (LaunchDenseUnaryEWKernel<src_t, dst_t>(indexer, element_func,
+                                               specialize_contiguous)) {
+        return;
+    }
     ParallelFor(
             Device("CPU:0"), indexer.NumWorkloads(),
             [&indexer, &element_func](int64_t i) {
@@ -193,7 +257,7 @@ void CopyCPU(const Tensor& src, Tensor& dst) {
                src.NumElements() == 1 && !src_dtype.IsObject()) {
         int64_t num_elements = dst.NumElements();
 
-        DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dst_dtype, [&]() {
+        DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_HALF(dst_dtype, [&]() {
             scalar_t scalar_element = src.To(dst_dtype).Item<scalar_t>();
             scalar_t* dst_ptr = static_cast<scalar_t*>(dst.GetDataPtr());
             ParallelFor(Device("CPU:0"), num_elements,
@@ -210,9 +274,9 @@ void CopyCPU(const Tensor& src, Tensor& dst) {
             });
 
         } else {
-            DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(src_dtype, [&]() {
+            DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_HALF(src_dtype, [&]() {
                 using src_t = scalar_t;
-                DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dst_dtype, [&]() {
+                DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_HALF(dst_dtype, [&]() {
                     using dst_t = scalar_t;
                     LaunchUnaryEWKernel<src_t, dst_t>(
                             indexer, CPUCopyElementKernel<src_t, dst_t>);
@@ -49,16 +49,48 @@ void LaunchUnaryEWKernel(const Device& device,
     OPEN3D_GET_LAST_CUDA_ERROR("LaunchUnaryEWKernel failed.");
 }
 
+template <typename src_t,
+          typename dst_t,
+          IndexerLayout src_layout,
+          typename func_t>
+void LaunchDenseUnaryEWKernel(const Device& device,
+                              const Indexer& indexer,
+                              const func_t& element_kernel) {
+    auto element_func = [=] OPEN3D_HOST_DEVICE(int64_t i) {
+        element_kernel(
+                indexer.GetInputPtr<src_t, src_layout>(0, i),
+                indexer.GetOutputPtr<dst_t, IndexerLayout::Contiguous>(i));
+    };
+    core::ParallelFor(device, indexer.NumWorkloads(), element_func);
+}
+
 template <typename src_t, typename dst_t, typename func_t>
 void LaunchUnaryEWKernel(const Device& device,
                          const Indexer& indexer,
                          const func_t& element_kernel) {
     OPEN3D_ASSERT_HOST_DEVICE_LAMBDA(func_t);
-    auto element_func = [=] OPEN3D_HOST_DEVICE(int64_t i) {
-        element_kernel(indexer.GetInputPtr<src_t>(0, i),
-                       indexer.GetOutputPtr<dst_t>(i));
-    };
-    core::ParallelFor(device, indexer.NumWorkloads(), element_func);
+    // Resolve the common layouts at compile time to skip the per-element
+    // offset computation.
+    const IndexerLayout src_layout =
+            indexer.GetOutputLayout() == IndexerLayout::Contiguous
+                    ? indexer.GetInputLayout(0)
+                    : IndexerLayout::Strided;
+    if (src_layout == IndexerLayout::Contiguous) {
+        LaunchDenseUnaryEWKernel<src_t, dst_t, IndexerLayout::Contiguous>(
+                device, indexer, element_kernel);
+    } else if (src_layout == IndexerLayout::Scalar) {
+        LaunchDenseUnaryEWKernel<src_t, dst_t, IndexerLayout::Scalar>(
+                device, indexer, element_kernel);
+    } else if (src_layout == IndexerLayout::InnerBroadcast) {
+        LaunchDenseUnaryEWKernel<src_t, dst_t, IndexerLayout::InnerBroadcast>(
+                device, indexer, element_kernel);
+    } else {
+        auto element_func = [=] OPEN3D_HOST_DEVICE(int64_t i) {
+            element_kernel(indexer.GetInputPtr<src_t>(0, i),
+                           indexer.GetOutputPtr<dst_t>(i));
+        };
+        core::ParallelFor(device, indexer.NumWorkloads(), element_func);
+    }
     OPEN3D_GET_LAST_CUDA_ERROR("LaunchUnaryEWKernel failed.");
 }
 
@@ -198,7 +230,7 @@ void CopyCUDA(const Tensor& src, Tensor& dst) {
                    src.NumElements() == 1 && !src_dtype.IsObject()) {
             int64_t num_elements = dst.NumElements();
 
-            DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dst_dtype, [&]() {
+            DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_HALF(dst_dtype, [&]() {
                 scalar_t scalar_element = src.To(dst_dtype).Item<scalar_t>();
                 scalar_t* dst_ptr = static_cast<scalar_t*>(dst.GetDataPtr());
                 ParallelFor(src_device, num_elements,
@@ -221,9 +253,9 @@ void CopyCUDA(const Tensor& src, Tensor& dst) {
                         });
 
             } else {
-                DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(src_dtype, [&]() {
+                DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_HALF(src_dtype, [&]() {
                     using src_t = scalar_t;
-                    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dst_dtype, [&]() {
+                    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_HALF(dst_dtype, [&]() {
                         using dst_t = scalar_t;
                         LaunchUnaryEWKernel<src_t, dst_t>(
                                 src_device, indexer,
@@ -0,0 +1,207 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/core/linalg/BatchedLinalg.h"
+
+#include "open3d/core/linalg/Det.h"
+#include "open3d/core/linalg/SVD.h"
+#include "open3d/core/linalg/Solve.h"
+
+namespace open3d {
+namespace core {
+
+/// Checks that A is a non-empty {batch, n, n} float tensor and returns n.
+static int64_t AssertBatchedSquare(const Tensor& A) {
+    AssertTensorDtypes(A, {Float32, Float64});
+    const SizeVector A_shape = A.GetShape();
+    if (A_shape.size() != 3) {
+        utility::LogError("Tensor A must be 3D {{batch, n, n}}, but got {}D.",
+                          A_shape.size());
+    }
+    if (A_shape[1] != A_shape[2]) {
+        utility::LogError("Tensor A must be batched square, but got {} x {}.",
+                          A_shape[1], A_shape[2]);
+    }
+    if (A_shape[1] == 0) {
+        utility::LogError(
+                "Tensor shapes should not contain dimensions with zero.");
+    }
+    return A_shape[1];
+}
+
+static void BatchedSolveInPlace(const Tensor& A, Tensor& X) {
+    const Device device = A.GetDevice();
+    Tensor singular = Tensor::Empty({A.GetLength()}, Bool, device);
+    if (device.GetType() == Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        BatchedSolveCUDA(A.Contiguous(), X, singular);
+#else
+        utility::LogError("Unimplemented device.");
+#endif
+    } else {
+        BatchedSolveCPU(A.Contiguous(), X, singular);
+    }
+    if (singular.Any()) {
+        utility::LogError("{} of {} matrices in the batch are singular.",
+                          singular.To(Int64).Sum({0}).Item<int64_t>(),
+                          A.GetLength());
+    }
+}
+
+void BatchedSolve(const Tensor& A, const Tensor& B, Tensor& X) {
+    const int64_t n = AssertBatchedSquare(A);
+    AssertTensorDtype(B, A.GetDtype());
+    AssertTensorDevice(B, A.GetDevice());
+
+    const SizeVector B_shape = B.GetShape();
+    if (B_shape.size() != 2 && B_shape.size() != 3) {
+        utility::LogError(
+                "Tensor B must be 2D {{batch, n}} or 3D {{batch, n, k}}, but "
+                "got {}D.",
+                B_shape.size());
+    }
+    if (B_shape[0] != A.GetLength() || B_shape[1] != n) {
+        utility::LogError("Tensor A {} and B {} shapes mismatch.",
+                          A.GetShape(), B_shape);
+    }
+    const int64_t batch = A.GetLength();
+    const int64_t k = B_shape.size() == 3 ? B_shape[2] : 1;
+    if (k == 0) {
+        utility::LogError(
+                "Tensor shapes should not contain dimensions with zero.");
+    }
+    if (batch == 0) {
+        X = Tensor::Empty(B_shape, B.GetDtype(), B.GetDevice());
+        return;
+    }
+
+    if (n > kBatchedLinalgMaxDim) {
+        X = Tensor::Empty(B_shape, B.GetDtype(), B.GetDevice());
+        for (int64_t i = 0; i < batch; ++i) {
+            Tensor X_i;
+            Solve(A[i], B[i], X_i);
+            X[i] = X_i;
+        }
+        return;
+    }
+    X = B.Reshape({batch, n, k}).Clone();
+    BatchedSolveInPlace(A, X);
+    X = X.Reshape(B_shape);
+}
+
+void BatchedInverse(const Tensor& A, Tensor& output) {
+    const int64_t n = AssertBatchedSquare(A);
+    const int64_t batch = A.GetLength();
+    const Tensor eye = Tensor::Eye(n, A.GetDtype(), A.GetDevice());
+    if (batch == 0 || n > kBatchedLinalgMaxDim) {
+        output = Tensor::Empty(A.GetShape(), A.GetDtype(), A.GetDevice());
+        for (int64_t i = 0; i < batch; ++i) {
+            Tensor output_i;
+            Solve(A[i], eye, output_i);
+            output[i] = output_i;
+        }
+        return;
+    }
+    output = eye.Expand({batch, n, n}).Clone();
+    BatchedSolveInPlace(A, output);
+}
+
+Tensor BatchedDet(const Tensor& A) {
+    const int64_t n = AssertBatchedSquare(A);
+    const int64_t batch = A.GetLength();
+    const Device device = A.GetDevice();
+    if (batch == 0 || n > kBatchedLinalgMaxDim) {
+        Tensor det = Tensor::Empty({batch}, Float64, Device("CPU:0"));
+        double* det_ptr = det.GetDataPtr<double>();
+        for (int64_t i = 0; i < batch; ++i) {
+            det_ptr[i] = Det(A[i]);
+        }
+        return det.To(A.GetDtype()).To(device);
+    }
+    Tensor det = Tensor::Empty({batch}, A.GetDtype(), device);
+    if (device.GetType() == Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        BatchedDetCUDA(A.Contiguous(), det);
+#else
+        utility::LogError("Unimplemented device.");
+#endif
+    } else {
+        BatchedDetCPU(A.Contiguous(), det);
+    }
+    return det;
+}
+
+void BatchedSVD(const Tensor& A, Tensor& U, Tensor& S, Tensor& VT) {
+    AssertTensorDtypes(A, {Float32, Float64});
+    const Device device = A.GetDevice();
+    const Dtype dtype = A.GetDtype();
+    const SizeVector A_shape = A.GetShape();
+    if (A_shape.size() != 3) {
+        utility::LogError("Tensor A must be 3D {{batch, m, n}}, but got {}D.",
+                          A_shape.size());
+    }
+    const int64_t batch = A_shape[0], m = A_shape[1], n = A_shape[2];
+    if (m == 0 || n == 0) {
+        utility::LogError(
+                "Tensor shapes should not contain dimensions with zero.");
+    }
+    if (m < n) {
+        utility::LogError("Only support m >= n, but got {} and {} matrix", m,
+                          n);
+    }
+
+    U = Tensor::Empty({batch, m, m}, dtype, device);
+    S = Tensor::Empty({batch, n}, dtype, device);
+    VT = Tensor::Empty({batch, n, n}, dtype, device);
+    if (batch == 0) {
+        return;
+    }
+    // The double specialization of svd3x3 is not usable, Float64 matrices
+    // take the per-matrix path.
+    if (m == 3 && n == 3 && dtype == Float32) {
+        if (device.GetType() == Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+            BatchedSVD3x3CUDA(A.Contiguous(), U, S, VT);
+#else
+            utility::LogError("Unimplemented device.");
+#endif
+        } else {
+            BatchedSVD3x3CPU(A.Contiguous(), U, S, VT);
+        }
+        return;
+    }
+    for (int64_t i = 0; i < batch; ++i) {
+        Tensor U_i, S_i, VT_i;
+        SVD(A[i], U_i, S_i, VT_i);
+        U[i] = U_i;
+        S[i] = S_i;
+        VT[i] = VT_i;
+    }
+}
+
+}  // namespace core
+}  // namespace open3d
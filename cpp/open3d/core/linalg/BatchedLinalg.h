@@ -0,0 +1,75 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#pragma once
+
+#include "open3d/core/Tensor.h"
+
+namespace open3d {
+namespace core {
+
+/// Largest matrix size handled by the batched register-resident kernels.
+/// Larger matrices fall back to one LAPACK / cuSOLVER call per matrix.
+constexpr int64_t kBatchedLinalgMaxDim = 8;
+
+/// Solve A[i] X[i] = B[i] with LU decomposition for every matrix of the batch.
+/// A is {batch, n, n} and B is {batch, n} or {batch, n, k}. X has the shape of
+/// B. Throws if any A[i] is singular.
+void BatchedSolve(const Tensor& A, const Tensor& B, Tensor& X);
+
+/// Computes the inverse of every {n, n} matrix of the {batch, n, n} tensor A.
+/// Throws if any A[i] is singular.
+void BatchedInverse(const Tensor& A, Tensor& output);
+
+/// Returns the {batch} determinants of the {batch, n, n} tensor A.
+Tensor BatchedDet(const Tensor& A);
+
+/// Computes A[i] = U[i] S[i] VT[i] for every {m, n} matrix of the {batch, m, n}
+/// tensor A, with m >= n. Float32 3x3 matrices use the closed-form kernel of
+/// linalg/kernel/SVD3x3.h.
+void BatchedSVD(const Tensor& A, Tensor& U, Tensor& S, Tensor& VT);
+
+/// A is a contiguous {batch, n, n} tensor, X is a contiguous {batch, n, k}
+/// tensor holding B that is overwritten with the solution. singular is a
+/// {batch} Bool tensor.
+void BatchedSolveCPU(const Tensor& A, Tensor& X, Tensor& singular);
+
+void BatchedDetCPU(const Tensor& A, Tensor& det);
+
+/// A, U, S and VT are contiguous Float32 tensors.
+void BatchedSVD3x3CPU(const Tensor& A, Tensor& U, Tensor& S, Tensor& VT);
+
+#ifdef BUILD_CUDA_MODULE
+void BatchedSolveCUDA(const Tensor& A, Tensor& X, Tensor& singular);
+
+void BatchedDetCUDA(const Tensor& A, Tensor& det);
+
+void BatchedSVD3x3CUDA(const Tensor& A, Tensor& U, Tensor& S, Tensor& VT);
+#endif
+
+}  // namespace core
+}  // namespace open3d
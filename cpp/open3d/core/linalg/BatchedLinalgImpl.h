@@ -0,0 +1,226 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+// Batched small-matrix kernels shared by BatchedLinalgCPU.cpp and
+// BatchedLinalgCUDA.cu. Every workload owns one matrix and keeps it in a local
+// array whose size is a compile-time constant, so the loops are unrolled and
+// the matrix stays in registers.
+
+#include "open3d/core/CUDAUtils.h"
+#include "open3d/core/Dispatch.h"
+#include "open3d/core/ParallelFor.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/core/linalg/BatchedLinalg.h"
+#include "open3d/core/linalg/kernel/SVD3x3.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace core {
+namespace linalg {
+namespace kernel {
+
+/// Calls FUNC<scalar_t, N>(...) with the runtime matrix size \p N as a
+/// compile-time constant in [1, kBatchedLinalgMaxDim].
+#define DISPATCH_BATCHED_DIM(N, FUNC, ...)                               \
+    [&] {                                                                \
+        switch (N) {                                                     \
+            case 1: return FUNC<scalar_t, 1>(__VA_ARGS__);               \
+            case 2: return FUNC<scalar_t, 2>(__VA_ARGS__);               \
+            case 3: return FUNC<scalar_t, 3>(__VA_ARGS__);               \
+            case 4: return FUNC<scalar_t, 4>(__VA_ARGS__);               \
+            case 5: return FUNC<scalar_t, 5>(__VA_ARGS__);               \
+            case 6: return FUNC<scalar_t, 6>(__VA_ARGS__);               \
+            case 7: return FUNC<scalar_t, 7>(__VA_ARGS__);               \
+            case 8: return FUNC<scalar_t, 8>(__VA_ARGS__);               \
+            default:                                                     \
+                utility::LogError("Unsupported batched matrix size {}.", \
+                                  N);                                    \
+        }                                                                \
+    }()
+
+/// In-place LU factorization with partial pivoting of the row-major N x N
+/// matrix \p A. The row operations are applied to the row-major N x k matrix
+/// \p B as well. Returns the determinant of A, which is 0 if A is singular.
+template <typename scalar_t, int64_t N>
+OPEN3D_HOST_DEVICE OPEN3D_FORCE_INLINE scalar_t LUEliminate(scalar_t* A,
+                                                            scalar_t* B,
+                                                            int64_t k) {
+    scalar_t det = 1;
+    for (int64_t c = 0; c < N; ++c) {
+        int64_t pivot = c;
+        scalar_t pivot_abs = A[c * N + c] < 0 ? -A[c * N + c] : A[c * N + c];
+        for (int64_t r = c + 1; r < N; ++r) {
+            const scalar_t v = A[r * N + c] < 0 ? -A[r * N + c] : A[r * N + c];
+            if (v > pivot_abs) {
+                pivot = r;
+                pivot_abs = v;
+            }
+        }
+        if (pivot_abs == 0) {
+            return 0;
+        }
+        if (pivot != c) {
+            for (int64_t j = 0; j < N; ++j) {
+                const scalar_t tmp = A[c * N + j];
+                A[c * N + j] = A[pivot * N + j];
+                A[pivot * N + j] = tmp;
+            }
+            for (int64_t j = 0; j < k; ++j) {
+                const scalar_t tmp = B[c * k + j];
+                B[c * k + j] = B[pivot * k + j];
+                B[pivot * k + j] = tmp;
+            }
+            det = -det;
+        }
+        det *= A[c * N + c];
+        const scalar_t inv_diag = 1 / A[c * N + c];
+        for (int64_t r = c + 1; r < N; ++r) {
+            const scalar_t factor = A[r * N + c] * inv_diag;
+            for (int64_t j = c + 1; j < N; ++j) {
+                A[r * N + j] -= factor * A[c * N + j];
+            }
+            for (int64_t j = 0; j < k; ++j) {
+                B[r * k + j] -= factor * B[c * k + j];
+            }
+        }
+    }
+    return det;
+}
+
+/// Solves U X = B in place for the upper triangle U of the LU output \p A.
+template <typename scalar_t, int64_t N>
+OPEN3D_HOST_DEVICE OPEN3D_FORCE_INLINE void LUBackSubstitute(const scalar_t* A,
+                                                             scalar_t* B,
+                                                             int64_t k) {
+    for (int64_t r = N - 1; r >= 0; --r) {
+        const scalar_t inv_diag = 1 / A[r * N + r];
+        for (int64_t j = 0; j < k; ++j) {
+            scalar_t sum = B[r * k + j];
+            for (int64_t c = r + 1; c < N; ++c) {
+                sum -= A[r * N + c] * B[c * k + j];
+            }
+            B[r * k + j] = sum * inv_diag;
+        }
+    }
+}
+
+template <typename scalar_t, int64_t N>
+void BatchedSolveN(const Tensor& A, Tensor& X, Tensor& singular) {
+    const scalar_t* A_ptr = A.GetDataPtr<scalar_t>();
+    scalar_t* X_ptr = X.GetDataPtr<scalar_t>();
+    bool* singular_ptr = singular.GetDataPtr<bool>();
+    const int64_t k = X.GetShape(2);
+    core::ParallelFor(
+            A.GetDevice(), A.GetLength(),
+            [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                scalar_t A_local[N * N];
+                for (int64_t i = 0; i < N * N; ++i) {
+                    A_local[i] = A_ptr[workload_idx * N * N + i];
+                }
+                scalar_t* X_i = X_ptr + workload_idx * N * k;
+                const scalar_t det =
+                        LUEliminate<scalar_t, N>(A_local, X_i, k);
+                singular_ptr[workload_idx] = det == 0;
+                if (det != 0) {
+                    LUBackSubstitute<scalar_t, N>(A_local, X_i, k);
+                }
+            });
+}
+
+template <typename scalar_t, int64_t N>
+void BatchedDetN(const Tensor& A, Tensor& det) {
+    const scalar_t* A_ptr = A.GetDataPtr<scalar_t>();
+    scalar_t* det_ptr = det.GetDataPtr<scalar_t>();
+    core::ParallelFor(A.GetDevice(), A.GetLength(),
+                      [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                          scalar_t A_local[N * N];
+                          for (int64_t i = 0; i < N * N; ++i) {
+                              A_local[i] = A_ptr[workload_idx * N * N + i];
+                          }
+                          det_ptr[workload_idx] =
+                                  LUEliminate<scalar_t, N>(A_local, nullptr, 0);
+                      });
+}
+
+}  // namespace kernel
+}  // namespace linalg
+
+#if defined(__CUDACC__)
+void BatchedSolveCUDA
+#else
+void BatchedSolveCPU
+#endif
+        (const Tensor& A, Tensor& X, Tensor& singular) {
+    const int64_t n = A.GetShape(1);
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(A.GetDtype(), [&]() {
+        DISPATCH_BATCHED_DIM(n, linalg::kernel::BatchedSolveN, A, X, singular);
+    });
+}
+
+#if defined(__CUDACC__)
+void BatchedDetCUDA
+#else
+void BatchedDetCPU
+#endif
+        (const Tensor& A, Tensor& det) {
+    const int64_t n = A.GetShape(1);
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(A.GetDtype(), [&]() {
+        DISPATCH_BATCHED_DIM(n, linalg::kernel::BatchedDetN, A, det);
+    });
+}
+
+#if defined(__CUDACC__)
+void BatchedSVD3x3CUDA
+#else
+void BatchedSVD3x3CPU
+#endif
+        (const Tensor& A, Tensor& U, Tensor& S, Tensor& VT) {
+    const float* A_ptr = A.GetDataPtr<float>();
+    float* U_ptr = U.GetDataPtr<float>();
+    float* S_ptr = S.GetDataPtr<float>();
+    float* VT_ptr = VT.GetDataPtr<float>();
+    core::ParallelFor(
+            A.GetDevice(), A.GetLength(),
+            [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                float* U_i = U_ptr + workload_idx * 9;
+                float* S_i = S_ptr + workload_idx * 3;
+                float* VT_i = VT_ptr + workload_idx * 9;
+                linalg::kernel::svd3x3(A_ptr + workload_idx * 9, U_i, S_i,
+                                       VT_i);
+                linalg::kernel::transpose3x3_(VT_i);
+                // svd3x3 returns rotations with a signed last singular value.
+                if (S_i[2] < 0) {
+                    S_i[2] = -S_i[2];
+                    U_i[2] = -U_i[2];
+                    U_i[5] = -U_i[5];
+                    U_i[8] = -U_i[8];
+                }
+            });
+}
+
+}  // namespace core
+}  // namespace open3d
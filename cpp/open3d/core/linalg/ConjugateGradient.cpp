@@ -0,0 +1,230 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/core/linalg/ConjugateGradient.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "open3d/core/TensorCheck.h"
+#include "open3d/core/linalg/BatchedLinalg.h"
+#include "open3d/core/linalg/Matmul.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace core {
+
+static double Dot(const Tensor& a, const Tensor& b) {
+    return (a * b).Sum({0}).To(Float64).Item<double>();
+}
+
+/// Returns the preconditioner for the {n} diagonal \p diag.
+static LinearOperator JacobiPreconditioner(const Tensor& diag) {
+    if (diag.Eq(0).Any()) {
+        utility::LogError(
+                "Jacobi preconditioner requires a non-zero diagonal.");
+    }
+    const Tensor inv_diag =
+            Tensor::Ones(diag.GetShape(), diag.GetDtype(), diag.GetDevice())
+                    .Div(diag);
+    return [inv_diag](const Tensor& r) { return r * inv_diag; };
+}
+
+/// Returns the preconditioner for the {n / block_size, block_size,
+/// block_size} diagonal \p blocks.
+static LinearOperator BlockJacobiPreconditioner(const Tensor& blocks) {
+    Tensor inv_blocks;
+    BatchedInverse(blocks, inv_blocks);
+    const int64_t num_blocks = blocks.GetLength();
+    const int64_t block_size = blocks.GetShape(1);
+    return [inv_blocks, num_blocks, block_size](const Tensor& r) {
+        return (inv_blocks * r.Reshape({num_blocks, 1, block_size}))
+                .Sum({2})
+                .Reshape({num_blocks * block_size});
+    };
+}
+
+static void CheckBlockSize(int64_t n, int64_t block_size) {
+    if (block_size <= 0 || n % block_size != 0) {
+        utility::LogError(
+                "Block size {} must be positive and divide the matrix size {}.",
+                block_size, n);
+    }
+}
+
+ConjugateGradientResult ConjugateGradient(
+        const LinearOperator& A,
+        const Tensor& b,
+        Tensor& x,
+        const LinearOperator& preconditioner,
+        const ConjugateGradientOption& option) {
+    AssertTensorDtypes(b, {Float32, Float64});
+    if (b.NumDims() != 1) {
+        utility::LogError("b must be 1D, but got shape {}.",
+                          b.GetShape().ToString());
+    }
+    if (x.GetShape() != b.GetShape() || x.GetDtype() != b.GetDtype() ||
+        x.GetDevice() != b.GetDevice()) {
+        x = Tensor::Zeros(b.GetShape(), b.GetDtype(), b.GetDevice());
+    }
+
+    ConjugateGradientResult result;
+    const double tolerance = std::max(option.relative_tolerance_ *
+                                              std::sqrt(Dot(b, b)),
+                                      option.absolute_tolerance_);
+    Tensor r = b - A(x);
+    result.residual_norm_ = std::sqrt(Dot(r, r));
+    if (result.residual_norm_ <= tolerance) {
+        result.converged_ = true;
+        return result;
+    }
+    Tensor z = preconditioner ? preconditioner(r) : r;
+    Tensor p = z.Clone();
+    double rz = Dot(r, z);
+
+    for (int i = 0; i < option.max_iteration_; ++i) {
+        const Tensor Ap = A(p);
+        const double pAp = Dot(p, Ap);
+        if (pAp <= 0) {
+            utility::LogWarning(
+                    "ConjugateGradient: the operator is not positive "
+                    "definite, p^T A p = {}.",
+                    pAp);
+            break;
+        }
+        const double alpha = rz / pAp;
+        x.Add_(p * alpha);
+        r.Sub_(Ap * alpha);
+        result.iterations_ = i + 1;
+        result.residual_norm_ = std::sqrt(Dot(r, r));
+        if (result.residual_norm_ <= tolerance) {
+            result.converged_ = true;
+            break;
+        }
+        z = preconditioner ? preconditioner(r) : r;
+        const double rz_next = Dot(r, z);
+        p = z + p * (rz_next / rz);
+        rz = rz_next;
+    }
+    return result;
+}
+
+ConjugateGradientResult PCG(const Tensor& A,
+                            const Tensor& b,
+                            Tensor& x,
+                            PreconditionerType preconditioner,
+                            int64_t block_size,
+                            const ConjugateGradientOption& option) {
+    AssertTensorDtype(A, b.GetDtype());
+    AssertTensorDevice(A, b.GetDevice());
+    const int64_t n = b.GetLength();
+    AssertTensorShape(A, {n, n});
+
+    const LinearOperator matvec = [&A](const Tensor& v) {
+        Tensor Av;
+        Matmul(A, v, Av);
+        return Av;
+    };
+    const Tensor arange = Tensor::Arange(0, n, 1, Int64, A.GetDevice());
+    switch (preconditioner) {
+        case PreconditionerType::Jacobi:
+            return ConjugateGradient(
+                    matvec, b, x,
+                    JacobiPreconditioner(A.IndexGet({arange, arange})),
+                    option);
+        case PreconditionerType::BlockJacobi: {
+            CheckBlockSize(n, block_size);
+            const int64_t num_blocks = n / block_size;
+            // A[k * block_size + i, k * block_size + j] is block k at (i, j).
+            const SizeVector blocks_shape = {num_blocks, block_size,
+                                             block_size};
+            const Tensor rows = arange.Reshape({num_blocks, block_size, 1})
+                                        .Expand(blocks_shape);
+            const Tensor cols = arange.Slice(0, 0, n, block_size)
+                                        .Reshape({num_blocks, 1, 1})
+                                        .Add(arange.Slice(0, 0, block_size)
+                                                     .Reshape({1, 1,
+                                                               block_size}))
+                                        .Expand(blocks_shape);
+            return ConjugateGradient(
+                    matvec, b, x,
+                    BlockJacobiPreconditioner(A.IndexGet({rows, cols})),
+                    option);
+        }
+        default:
+            return ConjugateGradient(matvec, b, x, LinearOperator(), option);
+    }
+}
+
+ConjugateGradientResult PCG(const SparseTensor& A,
+                            const Tensor& b,
+                            Tensor& x,
+                            PreconditionerType preconditioner,
+                            int64_t block_size,
+                            const ConjugateGradientOption& option) {
+    AssertTensorDtype(A.GetValues(), b.GetDtype());
+    AssertTensorDevice(A.GetValues(), b.GetDevice());
+    const int64_t n = b.GetLength();
+    if (A.GetShape() != SizeVector({n, n})) {
+        utility::LogError("A must have shape {}, but got {}.",
+                          SizeVector({n, n}).ToString(),
+                          A.GetShape().ToString());
+    }
+
+    const LinearOperator matvec = [&A](const Tensor& v) { return A.SpMV(v); };
+    if (preconditioner == PreconditionerType::None) {
+        return ConjugateGradient(matvec, b, x, LinearOperator(), option);
+    }
+    if (preconditioner == PreconditionerType::BlockJacobi) {
+        CheckBlockSize(n, block_size);
+    } else {
+        block_size = 1;
+    }
+    // Scatter the entries inside the diagonal blocks.
+    Tensor rows, cols, values;
+    std::tie(rows, cols, values) = A.ToCOO();
+    const Tensor block_rows = rows.Div(block_size);
+    const Tensor mask = block_rows.Eq(cols.Div(block_size));
+    const Tensor block_index = block_rows.IndexGet({mask});
+    const int64_t num_blocks = n / block_size;
+    Tensor blocks = Tensor::Zeros({num_blocks, block_size, block_size},
+                                  b.GetDtype(), b.GetDevice());
+    blocks.IndexSet({block_index,
+                     rows.IndexGet({mask}).Sub(block_index.Mul(block_size)),
+                     cols.IndexGet({mask}).Sub(block_index.Mul(block_size))},
+                    values.IndexGet({mask}));
+    if (preconditioner == PreconditionerType::Jacobi) {
+        return ConjugateGradient(matvec, b, x,
+                                 JacobiPreconditioner(blocks.Reshape({n})),
+                                 option);
+    }
+    return ConjugateGradient(matvec, b, x, BlockJacobiPreconditioner(blocks),
+                             option);
+}
+
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,104 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#pragma once
+
+#include <functional>
+
+#include "open3d/core/SparseTensor.h"
+#include "open3d/core/Tensor.h"
+
+namespace open3d {
+namespace core {
+
+/// Linear operator y = f(x) on {n} tensors, e.g. a matrix-free matvec.
+using LinearOperator = std::function<Tensor(const Tensor&)>;
+
+/// Preconditioners built from the matrix diagonal by PCG().
+enum class PreconditionerType {
+    None,
+    /// Inverse of the diagonal.
+    Jacobi,
+    /// Inverse of the {block_size, block_size} diagonal blocks.
+    BlockJacobi,
+};
+
+/// Convergence criteria of the conjugate gradient solvers. The iteration stops
+/// when ||b - A x|| <= max(relative_tolerance_ * ||b||, absolute_tolerance_)
+/// or after max_iteration_ iterations.
+struct ConjugateGradientOption {
+    int max_iteration_ = 1000;
+    double relative_tolerance_ = 1e-6;
+    double absolute_tolerance_ = 0.0;
+};
+
+struct ConjugateGradientResult {
+    /// Number of iterations run.
+    int iterations_ = 0;
+    /// ||b - A x|| of the returned x.
+    double residual_norm_ = 0.0;
+    /// True if the tolerance was reached within max_iteration_.
+    bool converged_ = false;
+};
+
+/// Solves A x = b for a symmetric positive definite operator \p A with the
+/// (preconditioned) conjugate gradient method on the device of \p b.
+///
+/// \param A Linear operator computing A x.
+/// \param b {n} Float32 or Float64 right-hand side.
+/// \param x Initial guess on input if it has the shape, dtype and device of
+/// \p b, otherwise zeros are used. Holds the solution on output.
+/// \param preconditioner Operator computing M^-1 r, or empty for plain CG.
+/// \param option Convergence criteria.
+ConjugateGradientResult ConjugateGradient(
+        const LinearOperator& A,
+        const Tensor& b,
+        Tensor& x,
+        const LinearOperator& preconditioner = LinearOperator(),
+        const ConjugateGradientOption& option = ConjugateGradientOption());
+
+/// Preconditioned conjugate gradient for a dense {n, n} matrix \p A. For
+/// BlockJacobi, n must be divisible by \p block_size.
+ConjugateGradientResult PCG(
+        const Tensor& A,
+        const Tensor& b,
+        Tensor& x,
+        PreconditionerType preconditioner = PreconditionerType::Jacobi,
+        int64_t block_size = 1,
+        const ConjugateGradientOption& option = ConjugateGradientOption());
+
+/// Preconditioned conjugate gradient for a sparse {n, n} matrix \p A.
+ConjugateGradientResult PCG(
+        const SparseTensor& A,
+        const Tensor& b,
+        Tensor& x,
+        PreconditionerType preconditioner = PreconditionerType::Jacobi,
+        int64_t block_size = 1,
+        const ConjugateGradientOption& option = ConjugateGradientOption());
+
+}  // namespace core
+}  // namespace open3d
@@ -35,4 +35,5 @@
 #include <cublas_v2.h>
 #include <cusolverDn.h>
 #include <cusolver_common.h>
+#include <cusparse.h>
 #endif
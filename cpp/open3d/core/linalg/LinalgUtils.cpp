@@ -65,5 +65,21 @@ CuBLASContext::~CuBLASContext() { cublasDestroy(handle_); }
 
 std::shared_ptr<CuBLASContext> CuBLASContext::instance_ = nullptr;
 
+std::shared_ptr<CuSparseContext> CuSparseContext::GetInstance() {
+    if (instance_ == nullptr) {
+        instance_ = std::make_shared<CuSparseContext>();
+    }
+    return instance_;
+};
+
+CuSparseContext::CuSparseContext() {
+    if (cusparseCreate(&handle_) != CUSPARSE_STATUS_SUCCESS) {
+        utility::LogError("Unable to create cuSPARSE handle");
+    }
+}
+CuSparseContext::~CuSparseContext() { cusparseDestroy(handle_); }
+
+std::shared_ptr<CuSparseContext> CuSparseContext::instance_ = nullptr;
+
 }  // namespace core
 }  // namespace open3d
@@ -67,6 +67,13 @@ inline void OPEN3D_CUBLAS_CHECK(cublasStatus_t status, const std::string& msg) {
     }
 }
 
+inline void OPEN3D_CUSPARSE_CHECK(cusparseStatus_t status,
+                                  const std::string& msg) {
+    if (CUSPARSE_STATUS_SUCCESS != status) {
+        utility::LogError("{}: {}", msg, cusparseGetErrorString(status));
+    }
+}
+
 inline void OPEN3D_CUSOLVER_CHECK(cusolverStatus_t status,
                                   const std::string& msg) {
     if (CUSOLVER_STATUS_SUCCESS != status) {
@@ -119,6 +126,21 @@ private:
 
     static std::shared_ptr<CuBLASContext> instance_;
 };
+
+class CuSparseContext {
+public:
+    static std::shared_ptr<CuSparseContext> GetInstance();
+
+    CuSparseContext();
+    ~CuSparseContext();
+
+    cusparseHandle_t& GetHandle() { return handle_; }
+
+private:
+    cusparseHandle_t handle_;
+
+    static std::shared_ptr<CuSparseContext> instance_;
+};
 #endif
 }  // namespace core
 }  // namespace open3d
@@ -1081,8 +1081,10 @@ void HybridSearchCUDA(const cudaStream_t stream,
         const size_t num_queries_i =
                 queries_row_splits[i + 1] - queries_row_splits[i];
 
+        // Counts are indexed by the query index local to the batch item.
         WriteNeighborsHybrid(
-                stream, indices_ptr, distances_ptr, counts_ptr, query_offset,
+                stream, indices_ptr, distances_ptr,
+                counts_ptr + queries_row_splits[i], query_offset,
                 hash_table_index, hash_table_cell_splits + first_cell_idx,
                 hash_table_size + 1, queries_i, num_queries_i, points,
                 inv_voxel_size, radius, max_knn, metric, true);
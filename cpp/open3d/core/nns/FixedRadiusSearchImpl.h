@@ -28,6 +28,8 @@
 
 #include <tbb/parallel_for.h>
 
+#include <algorithm>
+#include <cmath>
 #include <set>
 
 #include "open3d/core/Atomic.h"
@@ -465,6 +467,160 @@ void _FixedRadiusSearchCPU(int64_t* query_neighbors_row_splits,
 #undef VECSIZE
 }
 
+/// Implementation of HybridSearchCPU with template params for metrics.
+template <class T, class TIndex, class OUTPUT_ALLOCATOR, int METRIC>
+void _HybridSearchCPU(size_t num_points,
+                      const T* const points,
+                      size_t num_queries,
+                      const T* const queries,
+                      const T radius,
+                      const int max_knn,
+                      const size_t points_row_splits_size,
+                      const int64_t* const points_row_splits,
+                      const size_t queries_row_splits_size,
+                      const int64_t* const queries_row_splits,
+                      const uint32_t* const hash_table_splits,
+                      const size_t hash_table_cell_splits_size,
+                      const uint32_t* const hash_table_cell_splits,
+                      const uint32_t* const hash_table_index,
+                      OUTPUT_ALLOCATOR& output_allocator) {
+    using namespace open3d::utility;
+    typedef MiniVec<T, 3> Vec3_t;
+
+    // return empty output arrays if there are no points
+    if (num_points == 0 || num_queries == 0) {
+        TIndex* indices_ptr;
+        output_allocator.AllocIndices(&indices_ptr, 0);
+
+        T* distances_ptr;
+        output_allocator.AllocDistances(&distances_ptr, 0);
+
+        TIndex* counts_ptr;
+        output_allocator.AllocCounts(&counts_ptr, 0);
+        return;
+    }
+
+    const int batch_size = points_row_splits_size - 1;
+
+    // use squared radius for L2 to avoid sqrt
+    const T threshold = (METRIC == L2 ? radius * radius : radius);
+
+    const T voxel_size = 2 * radius;
+    const T inv_voxel_size = 1 / voxel_size;
+
+    // Allocate output pointers.
+    const size_t num_indices = num_queries * max_knn;
+
+    TIndex* indices_ptr;
+    output_allocator.AllocIndices(&indices_ptr, num_indices, -1);
+
+    T* distances_ptr;
+    output_allocator.AllocDistances(&distances_ptr, num_indices, 0);
+
+    TIndex* counts_ptr;
+    output_allocator.AllocCounts(&counts_ptr, num_queries, 0);
+
+    for (int i = 0; i < batch_size; ++i) {
+        const size_t hash_table_size =
+                hash_table_splits[i + 1] - hash_table_splits[i];
+        const size_t first_cell_idx = hash_table_splits[i];
+        tbb::parallel_for(
+                tbb::blocked_range<size_t>(queries_row_splits[i],
+                                           queries_row_splits[i + 1]),
+                [&](const tbb::blocked_range<size_t>& r) {
+                    for (size_t i = r.begin(); i != r.end(); ++i) {
+                        TIndex* const indices = indices_ptr + max_knn * i;
+                        T* const distances = distances_ptr + max_knn * i;
+
+                        Vec3_t pos(queries + i * 3);
+
+                        std::set<size_t> bins_to_visit;
+
+                        auto voxel_index =
+                                ComputeVoxelIndex(pos, inv_voxel_size);
+                        size_t hash =
+                                SpatialHash(voxel_index) % hash_table_size;
+
+                        bins_to_visit.insert(first_cell_idx + hash);
+
+                        for (int dz = -1; dz <= 1; dz += 2)
+                            for (int dy = -1; dy <= 1; dy += 2)
+                                for (int dx = -1; dx <= 1; dx += 2) {
+                                    Vec3_t p =
+                                            pos + radius * Vec3_t(T(dx), T(dy),
+                                                                  T(dz));
+                                    voxel_index = ComputeVoxelIndex(
+                                            p, inv_voxel_size);
+                                    hash = SpatialHash(voxel_index) %
+                                           hash_table_size;
+                                    bins_to_visit.insert(first_cell_idx + hash);
+                                }
+
+                        // Keep the max_knn closest neighbors, replacing the
+                        // farthest one once the list is full.
+                        int count = 0;
+                        int max_index = 0;
+                        T max_value = 0;
+                        for (size_t bin : bins_to_visit) {
+                            size_t begin_idx = hash_table_cell_splits[bin];
+                            size_t end_idx = hash_table_cell_splits[bin + 1];
+
+                            for (size_t j = begin_idx; j < end_idx; ++j) {
+                                uint32_t idx = hash_table_index[j];
+                                Vec3_t d = Vec3_t(points + idx * 3) - pos;
+                                T dist;
+                                if (METRIC == Linf) {
+                                    dist = std::max(std::abs(d[0]),
+                                                    std::max(std::abs(d[1]),
+                                                             std::abs(d[2])));
+                                } else if (METRIC == L1) {
+                                    dist = std::abs(d[0]) + std::abs(d[1]) +
+                                           std::abs(d[2]);
+                                } else {
+                                    dist = d.dot(d);
+                                }
+                                if (dist > threshold) continue;
+
+                                if (count < max_knn) {
+                                    indices[count] = idx;
+                                    distances[count] = dist;
+                                    if (count == 0 || max_value < dist) {
+                                        max_index = count;
+                                        max_value = dist;
+                                    }
+                                    ++count;
+                                } else if (max_value > dist) {
+                                    indices[max_index] = idx;
+                                    distances[max_index] = dist;
+                                    max_value = dist;
+                                    for (int k = 0; k < max_knn; ++k) {
+                                        if (distances[k] > max_value) {
+                                            max_index = k;
+                                            max_value = distances[k];
+                                        }
+                                    }
+                                }
+                            }
+                        }
+                        counts_ptr[i] = count;
+
+                        // insertion sort by distance, max_knn is small
+                        for (int k = 1; k < count; ++k) {
+                            const T dist = distances[k];
+                            const TIndex idx = indices[k];
+                            int m = k - 1;
+                            for (; m >= 0 && distances[m] > dist; --m) {
+                                distances[m + 1] = distances[m];
+                                indices[m + 1] = indices[m];
+                            }
+                            distances[m + 1] = dist;
+                            indices[m + 1] = idx;
+                        }
+                    }
+                });
+    }
+}
+
 }  // namespace
 
 /// Fixed radius search. This function computes a list of neighbor indices
@@ -599,6 +755,52 @@ void FixedRadiusSearchCPU(int64_t* query_neighbors_row_splits,
 #undef FN_PARAMETERS
 }
 
+/// Hybrid search. This function computes up to \p max_knn neighbors within
+/// \p radius for each query point. The neighbors of the i-th query are
+/// stored sorted by distance at [i * max_knn, i * max_knn + count), where
+/// count is the i-th entry of the counts output. Unused entries have index
+/// -1 and distance 0.
+/// The parameters are the same as for FixedRadiusSearchCPU. The output
+/// allocator must additionally implement AllocCounts(TIndex** ptr, size_t
+/// size, TIndex value).
+/// Note that for the L2 metric the squared distances will be returned!!
+///
+template <class T, class TIndex, class OUTPUT_ALLOCATOR>
+void HybridSearchCPU(const size_t num_points,
+                     const T* const points,
+                     const size_t num_queries,
+                     const T* const queries,
+                     const T radius,
+                     const int max_knn,
+                     const size_t points_row_splits_size,
+                     const int64_t* const points_row_splits,
+                     const size_t queries_row_splits_size,
+                     const int64_t* const queries_row_splits,
+                     const uint32_t* const hash_table_splits,
+                     const size_t hash_table_cell_splits_size,
+                     const uint32_t* const hash_table_cell_splits,
+                     const uint32_t* const hash_table_index,
+                     const Metric metric,
+                     OUTPUT_ALLOCATOR& output_allocator) {
+#define FN_PARAMETERS                                                     \
+    num_points, points, num_queries, queries, radius, max_knn,            \
+            points_row_splits_size, points_row_splits,                    \
+            queries_row_splits_size, queries_row_splits, hash_table_splits, \
+            hash_table_cell_splits_size, hash_table_cell_splits,          \
+            hash_table_index, output_allocator
+
+#define CALL_TEMPLATE(METRIC)                                             \
+    if (METRIC == metric)                                                 \
+        _HybridSearchCPU<T, TIndex, OUTPUT_ALLOCATOR, METRIC>(FN_PARAMETERS);
+
+    CALL_TEMPLATE(L1)
+    CALL_TEMPLATE(L2)
+    CALL_TEMPLATE(Linf)
+
+#undef CALL_TEMPLATE
+#undef FN_PARAMETERS
+}
+
 }  // namespace impl
 }  // namespace nns
 }  // namespace core
@@ -103,7 +103,24 @@ void HybridSearchCPU(const Tensor& points,
                      Tensor& neighbors_index,
                      Tensor& neighbors_count,
                      Tensor& neighbors_distance) {
-    utility::LogError("Not implemented.");
+    Device device = points.GetDevice();
+    NeighborSearchAllocator<T, TIndex> output_allocator(device);
+
+    impl::HybridSearchCPU<T, TIndex>(
+            points.GetShape()[0], points.GetDataPtr<T>(), queries.GetShape()[0],
+            queries.GetDataPtr<T>(), T(radius), max_knn,
+            points_row_splits.GetShape()[0],
+            points_row_splits.GetDataPtr<int64_t>(),
+            queries_row_splits.GetShape()[0],
+            queries_row_splits.GetDataPtr<int64_t>(),
+            hash_table_splits.GetDataPtr<uint32_t>(),
+            hash_table_cell_splits.GetShape()[0],
+            hash_table_cell_splits.GetDataPtr<uint32_t>(),
+            hash_table_index.GetDataPtr<uint32_t>(), metric, output_allocator);
+
+    neighbors_index = output_allocator.NeighborsIndex();
+    neighbors_distance = output_allocator.NeighborsDistance();
+    neighbors_count = output_allocator.NeighborsCount();
 }
 
 #define INSTANTIATE_BUILD(T)                                                  \
@@ -0,0 +1,343 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/core/nns/IncrementalNeighborGraph.h"
+
+#include <algorithm>
+#include <cmath>
+#include <unordered_set>
+
+#include "open3d/core/MemoryManagerStatistic.h"
+#include "open3d/core/TensorCheck.h"
+#include "open3d/utility/Logging.h"
+#include "open3d/utility/Parallel.h"
+
+namespace open3d {
+namespace core {
+namespace nns {
+
+IncrementalNeighborGraph::IncrementalNeighborGraph(double radius,
+                                                   int max_knn,
+                                                   const Dtype &dtype,
+                                                   const Device &device)
+    : radius_(radius), max_knn_(max_knn), dtype_(dtype), device_(device) {
+    if (radius <= 0) {
+        utility::LogError("radius must be positive, but got {}.", radius);
+    }
+    if (max_knn <= 0) {
+        utility::LogError("max_knn must be positive, but got {}.", max_knn);
+    }
+    if (dtype != core::Float32 && dtype != core::Float64) {
+        utility::LogError("dtype must be Float32 or Float64, but got {}.",
+                          dtype.ToString());
+    }
+}
+
+IncrementalNeighborGraph::Cell IncrementalNeighborGraph::GetCell(
+        int64_t id) const {
+    const double *p = points_.data() + 3 * id;
+    return Cell(static_cast<int>(std::floor(p[0] / radius_)),
+                static_cast<int>(std::floor(p[1] / radius_)),
+                static_cast<int>(std::floor(p[2] / radius_)));
+}
+
+double IncrementalNeighborGraph::SquaredDistance(int64_t a, int64_t b) const {
+    const double *p = points_.data() + 3 * a;
+    const double *q = points_.data() + 3 * b;
+    const double dx = p[0] - q[0], dy = p[1] - q[1], dz = p[2] - q[2];
+    return dx * dx + dy * dy + dz * dz;
+}
+
+template <typename Func>
+void IncrementalNeighborGraph::ForEachNearbyPoint(const Grid &grid,
+                                                  const Cell &cell,
+                                                  Func func) const {
+    for (int dx = -1; dx <= 1; ++dx) {
+        for (int dy = -1; dy <= 1; ++dy) {
+            for (int dz = -1; dz <= 1; ++dz) {
+                auto it = grid.find(cell + Cell(dx, dy, dz));
+                if (it == grid.end()) continue;
+                for (int64_t other : it->second) func(other);
+            }
+        }
+    }
+}
+
+void IncrementalNeighborGraph::SetNeighbors(
+        int64_t id, std::vector<std::pair<double, int64_t>> &candidates) {
+    const int64_t count =
+            std::min(static_cast<int64_t>(candidates.size()),
+                     static_cast<int64_t>(max_knn_));
+    std::partial_sort(candidates.begin(), candidates.begin() + count,
+                      candidates.end());
+    for (int64_t k = 0; k < count; ++k) {
+        distances_[max_knn_ * id + k] = candidates[k].first;
+        neighbors_[max_knn_ * id + k] = candidates[k].second;
+    }
+    counts_[id] = static_cast<int32_t>(count);
+}
+
+void IncrementalNeighborGraph::Search(int64_t id) {
+    const double radius2 = radius_ * radius_;
+    std::vector<std::pair<double, int64_t>> candidates;
+    ForEachNearbyPoint(grid_, GetCell(id), [&](int64_t other) {
+        const double dist = SquaredDistance(id, other);
+        if (dist < radius2) candidates.emplace_back(dist, other);
+    });
+    SetNeighbors(id, candidates);
+}
+
+bool IncrementalNeighborGraph::Merge(int64_t id, const Grid &added) {
+    const double radius2 = radius_ * radius_;
+    std::vector<std::pair<double, int64_t>> candidates;
+    ForEachNearbyPoint(added, GetCell(id), [&](int64_t other) {
+        const double dist = SquaredDistance(id, other);
+        if (dist < radius2) candidates.emplace_back(dist, other);
+    });
+    if (candidates.empty()) return false;
+    // The new top max_knn_ neighbors are among the old list and the added
+    // points within the radius.
+    for (int32_t k = 0; k < counts_[id]; ++k) {
+        candidates.emplace_back(distances_[max_knn_ * id + k],
+                                neighbors_[max_knn_ * id + k]);
+    }
+    SetNeighbors(id, candidates);
+    return true;
+}
+
+std::vector<int64_t> IncrementalNeighborGraph::CollectNearbyPoints(
+        const Grid &batch) const {
+    std::unordered_set<Cell, utility::hash_eigen<Cell>> cells;
+    for (const auto &it : batch) {
+        for (int dx = -1; dx <= 1; ++dx) {
+            for (int dy = -1; dy <= 1; ++dy) {
+                for (int dz = -1; dz <= 1; ++dz) {
+                    cells.insert(it.first + Cell(dx, dy, dz));
+                }
+            }
+        }
+    }
+    // Every point lives in exactly one cell, so no point is collected twice.
+    std::vector<int64_t> nearby;
+    for (const Cell &cell : cells) {
+        auto it = grid_.find(cell);
+        if (it == grid_.end()) continue;
+        for (int64_t id : it->second) {
+            if (!marks_[id]) nearby.push_back(id);
+        }
+    }
+    return nearby;
+}
+
+Tensor IncrementalNeighborGraph::Insert(const Tensor &points) {
+    ScopedMemoryTag memory_tag("nns");
+    AssertTensorShape(points, {utility::nullopt, 3});
+    AssertTensorDtype(points, dtype_);
+    AssertTensorDevice(points, device_);
+
+    const Tensor points_host =
+            points.To(Device("CPU:0"), core::Float64).Contiguous();
+    const double *src = points_host.GetDataPtr<double>();
+    const int64_t num_points = points_host.GetLength();
+
+    std::vector<int64_t> ids(num_points);
+    for (int64_t i = 0; i < num_points; ++i) {
+        if (!free_ids_.empty()) {
+            ids[i] = free_ids_.back();
+            free_ids_.pop_back();
+        } else {
+            ids[i] = static_cast<int64_t>(active_.size());
+            points_.resize(points_.size() + 3);
+            active_.push_back(0);
+            marks_.push_back(0);
+            neighbors_.resize(neighbors_.size() + max_knn_);
+            distances_.resize(distances_.size() + max_knn_);
+            counts_.push_back(0);
+        }
+    }
+
+    Grid batch;
+    for (int64_t i = 0; i < num_points; ++i) {
+        const int64_t id = ids[i];
+        std::copy(src + 3 * i, src + 3 * i + 3, points_.begin() + 3 * id);
+        active_[id] = 1;
+        marks_[id] = 1;
+        const Cell cell = GetCell(id);
+        grid_[cell].push_back(id);
+        batch[cell].push_back(id);
+    }
+    size_ += num_points;
+
+    // The new points need a full search, the existing points around them
+    // only need the new points merged into their lists.
+    const std::vector<int64_t> nearby = CollectNearbyPoints(batch);
+    int64_t num_merged = 0;
+#pragma omp parallel for schedule(dynamic, 64) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t i = 0; i < num_points; ++i) {
+        Search(ids[i]);
+    }
+#pragma omp parallel for schedule(dynamic, 64) reduction(+ : num_merged) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t i = 0; i < static_cast<int64_t>(nearby.size()); ++i) {
+        if (Merge(nearby[i], batch)) ++num_merged;
+    }
+    num_updated_lists_ = num_points + num_merged;
+
+    for (int64_t id : ids) marks_[id] = 0;
+    return Tensor(ids, {num_points}, core::Int64).To(device_);
+}
+
+void IncrementalNeighborGraph::Remove(const Tensor &ids) {
+    AssertTensorDtype(ids, core::Int64);
+    AssertTensorDevice(ids, device_);
+
+    const Tensor ids_host = ids.To(Device("CPU:0")).Contiguous();
+    const int64_t *ids_ptr = ids_host.GetDataPtr<int64_t>();
+    const int64_t num_ids = ids_host.NumElements();
+
+    // Validate all ids before changing anything.
+    std::vector<int64_t> removed;
+    removed.reserve(num_ids);
+    for (int64_t i = 0; i < num_ids; ++i) {
+        const int64_t id = ids_ptr[i];
+        const bool valid = id >= 0 &&
+                           id < static_cast<int64_t>(active_.size()) &&
+                           active_[id];
+        if (!valid || marks_[id]) {
+            for (int64_t marked : removed) marks_[marked] = 0;
+            if (!valid) {
+                utility::LogError("Point {} is not in the graph.", id);
+            }
+            utility::LogError("Point {} is removed more than once.", id);
+        }
+        marks_[id] = 1;
+        removed.push_back(id);
+    }
+
+    Grid batch;
+    for (int64_t id : removed) {
+        const Cell cell = GetCell(id);
+        auto it = grid_.find(cell);
+        std::vector<int64_t> &bucket = it->second;
+        bucket.erase(std::find(bucket.begin(), bucket.end(), id));
+        if (bucket.empty()) grid_.erase(it);
+        batch[cell].push_back(id);
+        active_[id] = 0;
+        counts_[id] = 0;
+    }
+    size_ -= num_ids;
+
+    // A list that was not full held every point within the radius, so the
+    // removed points can simply be dropped. A full list may have points in
+    // range beyond its last entry and is searched again.
+    const std::vector<int64_t> nearby = CollectNearbyPoints(batch);
+    int64_t num_changed = 0;
+#pragma omp parallel for schedule(dynamic, 64) reduction(+ : num_changed) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t i = 0; i < static_cast<int64_t>(nearby.size()); ++i) {
+        const int64_t id = nearby[i];
+        int64_t *neighbors = neighbors_.data() + max_knn_ * id;
+        double *distances = distances_.data() + max_knn_ * id;
+        const int32_t count = counts_[id];
+        if (std::none_of(neighbors, neighbors + count,
+                         [&](int64_t other) { return marks_[other] != 0; })) {
+            continue;
+        }
+        ++num_changed;
+        if (count == max_knn_) {
+            Search(id);
+            continue;
+        }
+        int32_t kept = 0;
+        for (int32_t k = 0; k < count; ++k) {
+            if (marks_[neighbors[k]]) continue;
+            neighbors[kept] = neighbors[k];
+            distances[kept] = distances[k];
+            ++kept;
+        }
+        counts_[id] = kept;
+    }
+    num_updated_lists_ = num_changed;
+
+    for (int64_t id : removed) marks_[id] = 0;
+    // Reuse the smallest ids first.
+    free_ids_.insert(free_ids_.end(), removed.begin(), removed.end());
+    std::sort(free_ids_.begin(), free_ids_.end(), std::greater<int64_t>());
+}
+
+Tensor IncrementalNeighborGraph::GetIds() const {
+    std::vector<int64_t> ids;
+    ids.reserve(size_);
+    for (int64_t id = 0; id < static_cast<int64_t>(active_.size()); ++id) {
+        if (active_[id]) ids.push_back(id);
+    }
+    return Tensor(ids, {size_}, core::Int64).To(device_);
+}
+
+Tensor IncrementalNeighborGraph::GetPoints() const {
+    std::vector<double> points;
+    points.reserve(3 * size_);
+    for (int64_t id = 0; id < static_cast<int64_t>(active_.size()); ++id) {
+        if (!active_[id]) continue;
+        points.insert(points.end(), points_.begin() + 3 * id,
+                      points_.begin() + 3 * id + 3);
+    }
+    return Tensor(points, {size_, 3}, core::Float64).To(device_, dtype_);
+}
+
+std::tuple<Tensor, Tensor, Tensor> IncrementalNeighborGraph::GetNeighbors()
+        const {
+    std::vector<int32_t> rows(active_.size(), -1);
+    int32_t num_rows = 0;
+    for (int64_t id = 0; id < static_cast<int64_t>(active_.size()); ++id) {
+        if (active_[id]) rows[id] = num_rows++;
+    }
+
+    std::vector<int32_t> indices(size_ * max_knn_, -1);
+    std::vector<double> distances(size_ * max_knn_, 0);
+    std::vector<int32_t> counts(size_, 0);
+    for (int64_t id = 0; id < static_cast<int64_t>(active_.size()); ++id) {
+        if (!active_[id]) continue;
+        const int64_t row = rows[id];
+        counts[row] = counts_[id];
+        for (int32_t k = 0; k < counts_[id]; ++k) {
+            indices[max_knn_ * row + k] = rows[neighbors_[max_knn_ * id + k]];
+            distances[max_knn_ * row + k] = distances_[max_knn_ * id + k];
+        }
+    }
+
+    const SizeVector shape{size_, max_knn_};
+    return std::make_tuple(
+            Tensor(indices, shape, core::Int32).To(device_),
+            Tensor(distances, shape, core::Float64).To(device_, dtype_),
+            Tensor(counts, {size_}, core::Int32).To(device_));
+}
+
+}  // namespace nns
+}  // namespace core
+}  // namespace open3d
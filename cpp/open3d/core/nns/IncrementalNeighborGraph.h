@@ -0,0 +1,162 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#pragma once
+
+#include <Eigen/Core>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/utility/Helper.h"
+
+namespace open3d {
+namespace core {
+namespace nns {
+
+/// \class IncrementalNeighborGraph
+///
+/// \brief Hybrid search neighbor lists, i.e. the \p max_knn nearest neighbors
+/// within a radius, of a set of 3D points that changes in batches, e.g. a
+/// sliding window of LiDAR scans.
+///
+/// The points are bucketed in a hash grid with the radius as cell size.
+/// Inserting a batch searches the neighbors of the new points and merges the
+/// new points into the lists of the existing points within the radius.
+/// Removing a batch drops the removed points from the lists that contain
+/// them and only searches again the lists that were full. All other lists
+/// are kept, so the cost of an update is proportional to the number of
+/// points near the batch. The lists are the same as those of
+/// NearestNeighborSearch::HybridSearch over the current points, up to the
+/// order of neighbors at equal distance.
+///
+/// The graph is maintained on the CPU. Inputs on other devices are copied to
+/// the host and the results are returned on the device of the graph.
+class IncrementalNeighborGraph {
+public:
+    /// \param radius Radius of the neighborhoods, also the grid cell size.
+    /// \param max_knn Maximum number of neighbors per point, including the
+    /// point itself.
+    /// \param dtype Float32 or Float64 dtype of the points and distances.
+    /// \param device Device of the inputs and results.
+    IncrementalNeighborGraph(double radius,
+                             int max_knn,
+                             const Dtype &dtype = core::Float32,
+                             const Device &device = Device("CPU:0"));
+
+    /// Inserts the {n, 3} \p points and updates the affected neighbor lists.
+    ///
+    /// \return The {n} Int64 ids of the new points. The ids of removed points
+    /// are reused.
+    Tensor Insert(const Tensor &points);
+
+    /// Removes the points with the Int64 \p ids and updates the affected
+    /// neighbor lists.
+    void Remove(const Tensor &ids);
+
+    /// Returns the number of points.
+    int64_t Size() const { return size_; }
+
+    /// Returns the {Size()} Int64 ids of the points in increasing order. Row i
+    /// of GetPoints() and GetNeighbors() belongs to the point with id
+    /// GetIds()[i].
+    Tensor GetIds() const;
+
+    /// Returns the {Size(), 3} points.
+    Tensor GetPoints() const;
+
+    /// Returns the neighbor lists in the layout of
+    /// NearestNeighborSearch::HybridSearch, with the rows of GetIds():
+    /// - indices: {Size(), max_knn} Int32 rows of the neighbors sorted by
+    /// distance, padded with -1.
+    /// - distances: {Size(), max_knn} squared distances, padded with 0.
+    /// - counts: {Size()} Int32 number of neighbors.
+    std::tuple<Tensor, Tensor, Tensor> GetNeighbors() const;
+
+    /// Returns the number of neighbor lists that were searched or changed by
+    /// the last Insert() or Remove().
+    int64_t GetNumUpdatedLists() const { return num_updated_lists_; }
+
+private:
+    using Cell = Eigen::Vector3i;
+    using Grid =
+            std::unordered_map<Cell, std::vector<int64_t>,
+                               utility::hash_eigen<Cell>>;
+
+    Cell GetCell(int64_t id) const;
+    double SquaredDistance(int64_t a, int64_t b) const;
+
+    /// Ids of the points in \p grid within the 27 cells around \p cell.
+    template <typename Func>
+    void ForEachNearbyPoint(const Grid &grid,
+                            const Cell &cell,
+                            Func func) const;
+
+    /// Recomputes the neighbor list of \p id from the grid.
+    void Search(int64_t id);
+
+    /// Merges the points of \p added within the radius into the neighbor
+    /// list of \p id. Returns true if the list changed.
+    bool Merge(int64_t id, const Grid &added);
+
+    /// Sorts \p candidates by distance and id and stores the first max_knn_
+    /// as the neighbor list of \p id.
+    void SetNeighbors(int64_t id,
+                      std::vector<std::pair<double, int64_t>> &candidates);
+
+    /// Active points that are not marked, in the cells around the cells of
+    /// \p batch.
+    std::vector<int64_t> CollectNearbyPoints(const Grid &batch) const;
+
+    double radius_;
+    int max_knn_;
+    Dtype dtype_;
+    Device device_;
+
+    int64_t size_ = 0;
+    /// Position of point id is points_[3 * id], ..., points_[3 * id + 2].
+    std::vector<double> points_;
+    std::vector<uint8_t> active_;
+    /// Scratch marks of the points of the current batch, cleared after each
+    /// update.
+    std::vector<uint8_t> marks_;
+    std::vector<int64_t> free_ids_;
+    Grid grid_;
+
+    /// Neighbor list of point id, sorted by distance:
+    /// neighbors_[max_knn_ * id], ..., for counts_[id] neighbors.
+    std::vector<int64_t> neighbors_;
+    std::vector<double> distances_;
+    std::vector<int32_t> counts_;
+
+    int64_t num_updated_lists_ = 0;
+};
+
+}  // namespace nns
+}  // namespace core
+}  // namespace open3d
@@ -81,6 +81,16 @@ bool KnnIndex::SetTensorData(const Tensor& dataset_points,
         dataset_points_ = dataset_points.Contiguous();
         points_row_splits_ = points_row_splits.Contiguous();
         index_dtype_ = index_dtype;
+        // Unbatched 3D data gets a uniform grid so that queries visit only
+        // the cells around them instead of every dataset point.
+        grid_ = KnnGrid();
+        if (dataset_points_.GetShape(1) == 3 &&
+            points_row_splits_.GetShape(0) == 2) {
+            const Dtype dtype = dataset_points_.GetDtype();
+            DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(dtype, [&]() {
+                BuildKnnGridCUDA<scalar_t>(dataset_points_, grid_);
+            });
+        }
         return true;
 #else
         utility::LogError(
@@ -138,9 +148,17 @@ std::pair<Tensor, Tensor> KnnIndex::SearchKnn(const Tensor& query_points,
     if (device.GetType() == Device::DeviceType::CUDA) {
 #ifdef BUILD_CUDA_MODULE
         const Dtype index_dtype = GetIndexDtype();
-        DISPATCH_FLOAT_INT_DTYPE_TO_TEMPLATE(dtype, index_dtype, [&]() {
-            KnnSearchCUDA<scalar_t, int_t>(KNN_PARAMETERS);
-        });
+        if (grid_.IsBuilt() && queries_row_splits_.GetShape(0) == 2) {
+            DISPATCH_FLOAT_INT_DTYPE_TO_TEMPLATE(dtype, index_dtype, [&]() {
+                KnnSearchGridCUDA<scalar_t, int_t>(
+                        grid_, query_points_, knn, neighbors_index,
+                        neighbors_row_splits, neighbors_distance);
+            });
+        } else {
+            DISPATCH_FLOAT_INT_DTYPE_TO_TEMPLATE(dtype, index_dtype, [&]() {
+                KnnSearchCUDA<scalar_t, int_t>(KNN_PARAMETERS);
+            });
+        }
 #else
         utility::LogError(
                 "-DBUILD_CUDA_MODULE=OFF. Please compile Open3d with "
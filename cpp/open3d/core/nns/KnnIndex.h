@@ -36,7 +36,39 @@ namespace open3d {
 namespace core {
 namespace nns {
 
+/// Uniform grid over 3D dataset points, built once in
+/// KnnIndex::SetTensorData and reused by every SearchKnn call. Points are
+/// sorted by their linear cell index, so the points in cell c are
+/// sorted_points[cell_starts[c]:cell_starts[c + 1]].
+struct KnnGrid {
+    /// Dataset points reordered by cell, {n, 3}.
+    Tensor sorted_points;
+    /// Original index of each sorted point, Int64 {n}.
+    Tensor sorted_indices;
+    /// Start offset of each cell in sorted_points, Int64 {num_cells + 1}.
+    Tensor cell_starts;
+    /// Minimum corner of the grid.
+    double origin[3] = {0, 0, 0};
+    /// Edge length of a cubic cell.
+    double cell_size = 0;
+    /// Number of cells along each axis.
+    int64_t resolution[3] = {0, 0, 0};
+
+    bool IsBuilt() const { return cell_starts.NumElements() > 0; }
+};
+
 #ifdef BUILD_CUDA_MODULE
+template <class T>
+void BuildKnnGridCUDA(const Tensor& points, KnnGrid& grid);
+
+template <class T, class TIndex>
+void KnnSearchGridCUDA(const KnnGrid& grid,
+                       const Tensor& queries,
+                       int knn,
+                       Tensor& neighbors_index,
+                       Tensor& neighbors_row_splits,
+                       Tensor& neighbors_distance);
+
 template <class T, class TIndex>
 void KnnSearchCUDA(const Tensor& points,
                    const Tensor& points_row_splits,
@@ -103,6 +135,8 @@ public:
 
 protected:
     Tensor points_row_splits_;
+    /// Spatial index for unbatched 3D data; empty otherwise.
+    KnnGrid grid_;
 };
 
 }  // namespace nns
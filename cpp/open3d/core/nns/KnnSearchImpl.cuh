@@ -29,6 +29,7 @@
 #include "cub/cub.cuh"
 #include "open3d/core/CUDAUtils.h"
 #include "open3d/core/nns/NeighborSearchCommon.h"
+#include "open3d/core/nns/kernel/Limits.cuh"
 #include "open3d/utility/Helper.h"
 #include "open3d/utility/MiniVec.h"
 
@@ -134,6 +135,137 @@ __global__ void KnnQueryKernel(TIndex *__restrict__ indices_ptr,
         distances_ptr[i + knn * query_idx] = best_dist[i];
     }
 }
+
+template <class T>
+__global__ void ComputeGridCellKernel(int64_t *__restrict__ cell_ids,
+                                      size_t num_points,
+                                      const T *__restrict__ points,
+                                      utility::MiniVec<T, 3> origin,
+                                      T cell_size,
+                                      utility::MiniVec<int, 3> resolution) {
+    int64_t idx = int64_t(blockIdx.x) * blockDim.x + threadIdx.x;
+    if (idx >= num_points) return;
+
+    int64_t cell_id = 0;
+    for (int d = 0; d < 3; ++d) {
+        T c = (points[3 * idx + d] - origin[d]) / cell_size;
+        c = c < 0 ? 0 : (c >= resolution[d] ? resolution[d] - 1 : c);
+        cell_id = cell_id * resolution[d] + int(c);
+    }
+    cell_ids[idx] = cell_id;
+}
+
+template <class T>
+__global__ void GatherGridPointsKernel(T *__restrict__ sorted_points,
+                                       size_t num_points,
+                                       const T *__restrict__ points,
+                                       const int64_t *__restrict__ indices) {
+    int64_t idx = int64_t(blockIdx.x) * blockDim.x + threadIdx.x;
+    if (idx >= num_points) return;
+
+    const int64_t src = indices[idx];
+    for (int d = 0; d < 3; ++d) {
+        sorted_points[3 * idx + d] = points[3 * src + d];
+    }
+}
+
+/// One thread per query. The k best candidates are kept in a max-heap inside
+/// the query's output row, so k is not bounded by registers or shared memory.
+/// Cells are visited in rings of growing Chebyshev distance around the query
+/// cell until the heap is full and no unvisited cell can be closer than the
+/// current k-th neighbor.
+template <class T, class TIndex>
+__global__ void KnnGridQueryKernel(TIndex *__restrict__ indices_ptr,
+                                   T *__restrict__ distances_ptr,
+                                   const T *__restrict__ sorted_points,
+                                   const int64_t *__restrict__ sorted_indices,
+                                   const int64_t *__restrict__ cell_starts,
+                                   utility::MiniVec<T, 3> origin,
+                                   T cell_size,
+                                   utility::MiniVec<int, 3> resolution,
+                                   size_t num_queries,
+                                   const T *__restrict__ queries,
+                                   int knn) {
+    int64_t query_idx = int64_t(blockIdx.x) * blockDim.x + threadIdx.x;
+    if (query_idx >= num_queries) return;
+
+    typedef utility::MiniVec<T, 3> Vec_t;
+    Vec_t query_pos(queries + 3 * query_idx);
+
+    T *best_dist = distances_ptr + int64_t(knn) * query_idx;
+    TIndex *best_idx = indices_ptr + int64_t(knn) * query_idx;
+    for (int i = 0; i < knn; ++i) {
+        best_dist[i] = Limits<T>::getMax();
+        best_idx[i] = -1;
+    }
+
+    int center[3];
+    for (int d = 0; d < 3; ++d) {
+        T c = (query_pos[d] - origin[d]) / cell_size;
+        c = c < 0 ? 0 : (c >= resolution[d] ? resolution[d] - 1 : c);
+        center[d] = int(c);
+    }
+
+    auto visit_cell = [&](int x, int y, int z) {
+        const int64_t cell_id =
+                (int64_t(x) * resolution[1] + y) * resolution[2] + z;
+        const int64_t end = cell_starts[cell_id + 1];
+        for (int64_t j = cell_starts[cell_id]; j < end; ++j) {
+            Vec_t dataset_pos(sorted_points + 3 * j);
+            T dist = NeighborsDist<L2>(query_pos, dataset_pos);
+            if (dist < best_dist[0]) {
+                best_dist[0] = dist;
+                best_idx[0] = TIndex(sorted_indices[j]);
+                Heapify(best_dist, best_idx, 0, knn);
+            }
+        }
+    };
+
+    for (int r = 0;; ++r) {
+        const int x0 = max(center[0] - r, 0);
+        const int x1 = min(center[0] + r, resolution[0] - 1);
+        const int y0 = max(center[1] - r, 0);
+        const int y1 = min(center[1] + r, resolution[1] - 1);
+        const int z0 = center[2] - r;
+        const int z1 = center[2] + r;
+        for (int x = x0; x <= x1; ++x) {
+            for (int y = y0; y <= y1; ++y) {
+                if (abs(x - center[0]) == r || abs(y - center[1]) == r) {
+                    for (int z = max(z0, 0); z <= min(z1, resolution[2] - 1);
+                         ++z) {
+                        visit_cell(x, y, z);
+                    }
+                } else {
+                    if (z0 >= 0) visit_cell(x, y, z0);
+                    if (z1 < resolution[2]) visit_cell(x, y, z1);
+                }
+            }
+        }
+
+        // Lower bound of the distance from the query to any point outside
+        // the visited block. Faces on the grid boundary have no points
+        // beyond them.
+        bool covers_grid = true;
+        T bound = Limits<T>::getMax();
+        for (int d = 0; d < 3; ++d) {
+            if (center[d] - r > 0) {
+                covers_grid = false;
+                T face = origin[d] + (center[d] - r) * cell_size;
+                bound = min(bound, query_pos[d] - face);
+            }
+            if (center[d] + r < resolution[d] - 1) {
+                covers_grid = false;
+                T face = origin[d] + (center[d] + r + 1) * cell_size;
+                bound = min(bound, face - query_pos[d]);
+            }
+        }
+        if (covers_grid ||
+            (best_idx[0] >= 0 && best_dist[0] <= bound * bound)) {
+            break;
+        }
+    }
+    HeapSort(best_dist, best_idx, knn);
+}
 }  // namespace
 
 template <class T, class TIndex, int NDIM>
@@ -158,6 +290,70 @@ void KnnQuery(const cudaStream_t &stream,
     }
 }
 
+template <class T>
+void ComputeGridCells(const cudaStream_t &stream,
+                      int64_t *cell_ids,
+                      size_t num_points,
+                      const T *const points,
+                      const T *origin,
+                      T cell_size,
+                      const int *resolution) {
+    const int BLOCKSIZE = 256;
+    dim3 block(BLOCKSIZE, 1, 1);
+    dim3 grid(0, 1, 1);
+    grid.x = utility::DivUp(num_points, block.x);
+
+    if (grid.x) {
+        ComputeGridCellKernel<T><<<grid, block, 0, stream>>>(
+                cell_ids, num_points, points, utility::MiniVec<T, 3>(origin),
+                cell_size, utility::MiniVec<int, 3>(resolution));
+    }
+}
+
+template <class T>
+void GatherGridPoints(const cudaStream_t &stream,
+                      T *sorted_points,
+                      size_t num_points,
+                      const T *const points,
+                      const int64_t *const indices) {
+    const int BLOCKSIZE = 256;
+    dim3 block(BLOCKSIZE, 1, 1);
+    dim3 grid(0, 1, 1);
+    grid.x = utility::DivUp(num_points, block.x);
+
+    if (grid.x) {
+        GatherGridPointsKernel<T><<<grid, block, 0, stream>>>(
+                sorted_points, num_points, points, indices);
+    }
+}
+
+template <class T, class TIndex>
+void KnnGridQuery(const cudaStream_t &stream,
+                  TIndex *indices_ptr,
+                  T *distances_ptr,
+                  const T *const sorted_points,
+                  const int64_t *const sorted_indices,
+                  const int64_t *const cell_starts,
+                  const T *origin,
+                  T cell_size,
+                  const int *resolution,
+                  size_t num_queries,
+                  const T *const queries,
+                  int knn) {
+    const int BLOCKSIZE = 128;
+    dim3 block(BLOCKSIZE, 1, 1);
+    dim3 grid(0, 1, 1);
+    grid.x = utility::DivUp(num_queries, block.x);
+
+    if (grid.x) {
+        KnnGridQueryKernel<T, TIndex><<<grid, block, 0, stream>>>(
+                indices_ptr, distances_ptr, sorted_points, sorted_indices,
+                cell_starts, utility::MiniVec<T, 3>(origin), cell_size,
+                utility::MiniVec<int, 3>(resolution), num_queries, queries,
+                knn);
+    }
+}
+
 }  // namespace impl
 }  // namespace nns
 }  // namespace core
@@ -24,6 +24,14 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <thrust/binary_search.h>
+#include <thrust/execution_policy.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/sort.h>
+
+#include <algorithm>
+#include <cmath>
+
 #include "open3d/core/CUDAUtils.h"
 #include "open3d/core/MemoryManager.h"
 #include "open3d/core/Tensor.h"
@@ -324,11 +332,133 @@ void KnnSearchCUDA(const Tensor& points,
     neighbors_distance = output_allocator.NeighborsDistance();
 }
 
+/// Average number of dataset points per grid cell for volumetric data.
+static constexpr double kKnnGridPointsPerCell = 4.0;
+/// Upper bound of the number of grid cells per dataset point.
+static constexpr int64_t kKnnGridMaxCellsPerPoint = 4;
+
+template <class T>
+void BuildKnnGridCUDA(const Tensor& points, KnnGrid& grid) {
+    const cudaStream_t stream = cuda::GetStream();
+    const Device device = points.GetDevice();
+    const int64_t num_points = points.GetShape(0);
+
+    const Tensor min_bound = points.Min({0}).To(Device("CPU:0"), Float64);
+    const Tensor max_bound = points.Max({0}).To(Device("CPU:0"), Float64);
+    const double* min_ptr = min_bound.GetDataPtr<double>();
+    const double* max_ptr = max_bound.GetDataPtr<double>();
+
+    double extent[3];
+    double max_extent = 0;
+    for (int d = 0; d < 3; ++d) {
+        grid.origin[d] = min_ptr[d];
+        extent[d] = max_ptr[d] - min_ptr[d];
+        max_extent = std::max(max_extent, extent[d]);
+    }
+
+    // Planar or linear clouds have no volume, so clamp each extent from
+    // below to keep the cell size proportional to the cloud.
+    double volume = 1;
+    for (int d = 0; d < 3; ++d) {
+        volume *= std::max(extent[d], max_extent * 1e-3);
+    }
+    double cell_size =
+            max_extent > 0
+                    ? std::cbrt(volume * kKnnGridPointsPerCell / num_points)
+                    : 1.0;
+    auto count_cells = [&](double size) {
+        int64_t num_cells = 1;
+        for (int d = 0; d < 3; ++d) {
+            num_cells *= int64_t(extent[d] / size) + 1;
+        }
+        return num_cells;
+    };
+    while (count_cells(cell_size) > kKnnGridMaxCellsPerPoint * num_points) {
+        cell_size *= 2;
+    }
+
+    T origin[3];
+    int resolution[3];
+    int64_t num_cells = 1;
+    for (int d = 0; d < 3; ++d) {
+        origin[d] = T(grid.origin[d]);
+        resolution[d] = int(extent[d] / cell_size) + 1;
+        grid.resolution[d] = resolution[d];
+        num_cells *= resolution[d];
+    }
+    grid.cell_size = cell_size;
+
+    Tensor cell_ids = Tensor::Empty({num_points}, Int64, device);
+    int64_t* cell_ids_ptr = cell_ids.GetDataPtr<int64_t>();
+    impl::ComputeGridCells<T>(stream, cell_ids_ptr, num_points,
+                              points.GetDataPtr<T>(), origin, T(cell_size),
+                              resolution);
+
+    grid.sorted_indices = Tensor::Arange(0, num_points, 1, Int64, device);
+    thrust::sort_by_key(
+            thrust::cuda::par.on(stream), cell_ids_ptr,
+            cell_ids_ptr + num_points,
+            grid.sorted_indices.GetDataPtr<int64_t>());
+
+    grid.sorted_points = Tensor::Empty({num_points, 3}, points.GetDtype(),
+                                       device);
+    impl::GatherGridPoints<T>(stream, grid.sorted_points.GetDataPtr<T>(),
+                              num_points, points.GetDataPtr<T>(),
+                              grid.sorted_indices.GetDataPtr<int64_t>());
+
+    grid.cell_starts = Tensor::Empty({num_cells + 1}, Int64, device);
+    thrust::counting_iterator<int64_t> cell_first(0);
+    thrust::lower_bound(thrust::cuda::par.on(stream), cell_ids_ptr,
+                        cell_ids_ptr + num_points, cell_first,
+                        cell_first + num_cells + 1,
+                        grid.cell_starts.GetDataPtr<int64_t>());
+}
+
+template <class T, class TIndex>
+void KnnSearchGridCUDA(const KnnGrid& grid,
+                       const Tensor& queries,
+                       int knn,
+                       Tensor& neighbors_index,
+                       Tensor& neighbors_row_splits,
+                       Tensor& neighbors_distance) {
+    const cudaStream_t stream = cuda::GetStream();
+    const Device device = queries.GetDevice();
+    const int64_t num_points = grid.sorted_points.GetShape(0);
+    const int64_t num_queries = queries.GetShape(0);
+
+    knn = num_points > knn ? knn : num_points;
+
+    neighbors_index = Tensor::Empty({num_queries, knn},
+                                    Dtype::FromType<TIndex>(), device);
+    neighbors_distance =
+            Tensor::Empty({num_queries, knn}, Dtype::FromType<T>(), device);
+    neighbors_row_splits.AsRvalue() =
+            Tensor::Arange(0, (num_queries + 1) * knn, knn);
+
+    T origin[3];
+    int resolution[3];
+    for (int d = 0; d < 3; ++d) {
+        origin[d] = T(grid.origin[d]);
+        resolution[d] = int(grid.resolution[d]);
+    }
+    impl::KnnGridQuery<T, TIndex>(
+            stream, neighbors_index.GetDataPtr<TIndex>(),
+            neighbors_distance.GetDataPtr<T>(),
+            grid.sorted_points.GetDataPtr<T>(),
+            grid.sorted_indices.GetDataPtr<int64_t>(),
+            grid.cell_starts.GetDataPtr<int64_t>(), origin, T(grid.cell_size),
+            resolution, num_queries, queries.GetDataPtr<T>(), knn);
+}
+
 #define INSTANTIATE(T, TIndex)                                                \
     template void KnnSearchCUDA<T, TIndex>(                                   \
             const Tensor& points, const Tensor& points_row_splits,            \
             const Tensor& queries, const Tensor& queries_row_splits, int knn, \
             Tensor& neighbors_index, Tensor& neighbors_row_splits,            \
+            Tensor& neighbors_distance);                                      \
+    template void KnnSearchGridCUDA<T, TIndex>(                               \
+            const KnnGrid& grid, const Tensor& queries, int knn,              \
+            Tensor& neighbors_index, Tensor& neighbors_row_splits,            \
             Tensor& neighbors_distance);
 
 INSTANTIATE(float, int32_t)
@@ -336,6 +466,9 @@ INSTANTIATE(float, int64_t)
 INSTANTIATE(double, int32_t)
 INSTANTIATE(double, int64_t)
 
+template void BuildKnnGridCUDA<float>(const Tensor& points, KnnGrid& grid);
+template void BuildKnnGridCUDA<double>(const Tensor& points, KnnGrid& grid);
+
 }  // namespace nns
 }  // namespace core
 }  // namespace open3d
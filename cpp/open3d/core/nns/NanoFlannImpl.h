@@ -26,14 +26,18 @@
 #pragma once
 
 #include <tbb/parallel_for.h>
+#include <tbb/parallel_invoke.h>
 
 #include <algorithm>
+#include <limits>
 #include <mutex>
 #include <nanoflann.hpp>
+#include <numeric>
 
 #include "open3d/core/Atomic.h"
 #include "open3d/core/nns/NeighborSearchCommon.h"
 #include "open3d/utility/Helper.h"
+#include "open3d/utility/Parallel.h"
 #include "open3d/utility/ParallelScan.h"
 
 namespace open3d {
@@ -41,6 +45,13 @@ namespace core {
 namespace nns {
 
 /// NanoFlann Index Holder.
+///
+/// The index is a forest of KD-trees. Large point sets are split along the
+/// median of their widest axis for the top levels, and the resulting
+/// spatially disjoint sub-trees are built in parallel. Points added later
+/// with AddPoints form new trees that are merged log-structured: a new tree
+/// absorbs every existing tree that is not larger than itself, so there are
+/// O(log n) trees and each point is rebuilt O(log n) times.
 template <int METRIC, class TReal, class TIndex>
 struct NanoFlannIndexHolder : NanoFlannIndexHolderBase {
     /// This class is the Adaptor for connecting Open3D Tensor and NanoFlann.
@@ -90,16 +101,300 @@ struct NanoFlannIndexHolder : NanoFlannIndexHolderBase {
             TIndex>
             KDTree_t;
 
+    /// Forwards the results of one sub-tree to a nanoflann result set after
+    /// mapping the sub-tree's local indices to dataset indices.
+    template <class RESULTSET>
+    struct SubTreeResultSet {
+        SubTreeResultSet(RESULTSET &result, const TIndex *indices)
+            : result_(result), indices_(indices) {}
+
+        inline bool addPoint(TReal dist, TIndex index) {
+            result_.addPoint(dist, indices_ ? indices_[index] : index);
+            return true;
+        }
+
+        inline TReal worstDist() const { return result_.worstDist(); }
+
+        inline bool full() const { return result_.full(); }
+
+        RESULTSET &result_;
+        const TIndex *indices_;
+    };
+
+    /// KD-tree over a subset of the dataset.
+    struct SubTree {
+        /// Builds a tree that references the dataset without copying it.
+        SubTree(size_t num_points, int dimension, const TReal *data_ptr)
+            : dimension_(dimension) {
+            ComputeBoundingBox(num_points, data_ptr);
+            adaptor_.reset(new DataAdaptor(num_points, dimension, data_ptr));
+            index_.reset(new KDTree_t(dimension, *adaptor_.get()));
+            index_->buildIndex();
+        }
+
+        /// Builds a tree over a copy of the dataset points in \p indices.
+        SubTree(const TIndex *indices_begin,
+                const TIndex *indices_end,
+                int dimension,
+                const TReal *data_ptr)
+            : indices_(indices_begin, indices_end), dimension_(dimension) {
+            const size_t num_points = indices_.size();
+            points_.resize(num_points * dimension);
+            for (size_t i = 0; i < num_points; ++i) {
+                const TReal *point =
+                        data_ptr + static_cast<size_t>(indices_[i]) * dimension;
+                std::copy(point, point + dimension,
+                          points_.data() + i * dimension);
+            }
+            ComputeBoundingBox(num_points, points_.data());
+            adaptor_.reset(
+                    new DataAdaptor(num_points, dimension, points_.data()));
+            index_.reset(new KDTree_t(dimension, *adaptor_.get()));
+            index_->buildIndex();
+        }
+
+        size_t Size() const { return adaptor_->dataset_size_; }
+
+        /// Appends the dataset indices of the points in this tree.
+        void CollectIndices(std::vector<TIndex> &indices) const {
+            if (indices_.empty()) {
+                for (size_t i = 0; i < Size(); ++i) {
+                    indices.push_back(static_cast<TIndex>(i));
+                }
+            } else {
+                indices.insert(indices.end(), indices_.begin(), indices_.end());
+            }
+        }
+
+        /// Lower bound of the distance from \p query to the points in this
+        /// tree, in the same units as the nanoflann distances.
+        TReal BoxDistance(const TReal *query) const {
+            TReal dist = 0;
+            for (int d = 0; d < dimension_; ++d) {
+                TReal diff = 0;
+                if (query[d] < min_bound_[d]) {
+                    diff = min_bound_[d] - query[d];
+                } else if (query[d] > max_bound_[d]) {
+                    diff = query[d] - max_bound_[d];
+                }
+                dist += METRIC == L2 ? diff * diff : diff;
+            }
+            return dist;
+        }
+
+        template <class RESULTSET>
+        void FindNeighbors(RESULTSET &result,
+                           const TReal *query,
+                           float eps) const {
+            SubTreeResultSet<RESULTSET> sub_result(
+                    result, indices_.empty() ? nullptr : indices_.data());
+            index_->findNeighbors(sub_result, query,
+                                  nanoflann::SearchParams(32, eps));
+        }
+
+        void ComputeBoundingBox(size_t num_points, const TReal *data_ptr) {
+            min_bound_.assign(dimension_, std::numeric_limits<TReal>::max());
+            max_bound_.assign(dimension_,
+                              std::numeric_limits<TReal>::lowest());
+            for (size_t i = 0; i < num_points; ++i) {
+                for (int d = 0; d < dimension_; ++d) {
+                    const TReal v = data_ptr[i * dimension_ + d];
+                    min_bound_[d] = std::min(min_bound_[d], v);
+                    max_bound_[d] = std::max(max_bound_[d], v);
+                }
+            }
+        }
+
+        /// Dataset indices of the tree points; empty if the tree references
+        /// the dataset directly.
+        std::vector<TIndex> indices_;
+        /// Copy of the tree points; empty if indices_ is empty.
+        std::vector<TReal> points_;
+        int dimension_ = 0;
+        std::vector<TReal> min_bound_;
+        std::vector<TReal> max_bound_;
+        std::unique_ptr<DataAdaptor> adaptor_;
+        std::unique_ptr<KDTree_t> index_;
+    };
+
+    /// Sub-trees built from the same batch of points.
+    struct Tree {
+        size_t size_ = 0;
+        std::vector<std::unique_ptr<SubTree>> sub_trees_;
+    };
+
+    /// Points per sub-tree below which the build is not split further.
+    static constexpr size_t kMinSubTreeSize = 1 << 16;
+
     NanoFlannIndexHolder(size_t dataset_size,
                          int dimension,
-                         const TReal *data_ptr) {
-        adaptor_.reset(new DataAdaptor(dataset_size, dimension, data_ptr));
-        index_.reset(new KDTree_t(dimension, *adaptor_.get()));
-        index_->buildIndex();
+                         const TReal *data_ptr)
+        : dimension_(dimension) {
+        if (dataset_size < 2 * kMinSubTreeSize ||
+            utility::EstimateMaxThreads() <= 1) {
+            Tree tree;
+            tree.size_ = dataset_size;
+            tree.sub_trees_.emplace_back(
+                    new SubTree(dataset_size, dimension, data_ptr));
+            trees_.push_back(std::move(tree));
+            num_sub_trees_ = 1;
+        } else {
+            std::vector<TIndex> indices(dataset_size);
+            std::iota(indices.begin(), indices.end(), 0);
+            trees_.push_back(BuildTree(indices, data_ptr));
+        }
     }
 
-    std::unique_ptr<KDTree_t> index_;
-    std::unique_ptr<DataAdaptor> adaptor_;
+    /// Adds the last \p num_new_points points of \p data_ptr, which holds
+    /// \p dataset_size points in total, new and old. Only the new points
+    /// are read unless trees are merged.
+    void AddPoints(size_t dataset_size,
+                   size_t num_new_points,
+                   const TReal *data_ptr) {
+        if (num_new_points == 0) return;
+        std::vector<TIndex> indices(num_new_points);
+        std::iota(indices.begin(), indices.end(),
+                  static_cast<TIndex>(dataset_size - num_new_points));
+        while (!trees_.empty() && trees_.back().size_ <= indices.size()) {
+            for (const auto &sub_tree : trees_.back().sub_trees_) {
+                sub_tree->CollectIndices(indices);
+            }
+            num_sub_trees_ -= trees_.back().sub_trees_.size();
+            trees_.pop_back();
+        }
+        trees_.push_back(BuildTree(indices, data_ptr));
+    }
+
+    /// Search all sub-trees with a nanoflann result set. Sub-trees are
+    /// visited in the order of their bounding box distance and skipped when
+    /// they cannot contain a closer point than the current worst result.
+    /// With \p eps > 0 a sub-tree or node is only visited if it can improve
+    /// the worst result by more than a factor of (1 + eps), as in nanoflann.
+    template <class RESULTSET>
+    void FindNeighbors(RESULTSET &result,
+                       const TReal *query,
+                       float eps = 0) const {
+        if (num_sub_trees_ == 1) {
+            trees_[0].sub_trees_[0]->FindNeighbors(result, query, eps);
+            return;
+        }
+        std::vector<std::pair<TReal, const SubTree *>> order;
+        order.reserve(num_sub_trees_);
+        for (const auto &tree : trees_) {
+            for (const auto &sub_tree : tree.sub_trees_) {
+                order.emplace_back(sub_tree->BoxDistance(query),
+                                   sub_tree.get());
+            }
+        }
+        std::sort(order.begin(), order.end(),
+                  [](const std::pair<TReal, const SubTree *> &a,
+                     const std::pair<TReal, const SubTree *> &b) {
+                      return a.first < b.first;
+                  });
+        for (const auto &dist_sub_tree : order) {
+            if (dist_sub_tree.first * (1 + eps) > result.worstDist()) break;
+            dist_sub_tree.second->FindNeighbors(result, query, eps);
+        }
+    }
+
+    /// Same interface as nanoflann::KDTreeSingleIndexAdaptor::knnSearch,
+    /// with the approximation error \p eps of nanoflann::SearchParams.
+    size_t knnSearch(const TReal *query,
+                     size_t num_closest,
+                     TIndex *out_indices,
+                     TReal *out_distances,
+                     float eps = 0) const {
+        nanoflann::KNNResultSet<TReal, TIndex> result(num_closest);
+        result.init(out_indices, out_distances);
+        FindNeighbors(result, query, eps);
+        return result.size();
+    }
+
+    /// Same interface as nanoflann::KDTreeSingleIndexAdaptor::radiusSearch.
+    size_t radiusSearch(const TReal *query,
+                        TReal radius,
+                        std::vector<std::pair<TIndex, TReal>> &matches,
+                        const nanoflann::SearchParams &params) const {
+        nanoflann::RadiusResultSet<TReal, TIndex> result(radius, matches);
+        FindNeighbors(result, query);
+        if (params.sorted) {
+            std::sort(matches.begin(), matches.end(),
+                      nanoflann::IndexDist_Sorter());
+        }
+        return matches.size();
+    }
+
+    /// Builds the sub-trees over the dataset points in \p indices.
+    Tree BuildTree(std::vector<TIndex> &indices, const TReal *data_ptr) {
+        int depth = 0;
+        const int max_threads = utility::EstimateMaxThreads();
+        while ((1 << depth) < max_threads &&
+               (indices.size() >> (depth + 1)) >= kMinSubTreeSize) {
+            ++depth;
+        }
+        Tree tree;
+        tree.size_ = indices.size();
+        tree.sub_trees_ = BuildSubTrees(indices.data(),
+                                        indices.data() + indices.size(),
+                                        data_ptr, depth);
+        num_sub_trees_ += tree.sub_trees_.size();
+        return tree;
+    }
+
+    /// Splits [begin, end) at the median of the widest axis for \p depth
+    /// levels, building both halves in parallel.
+    std::vector<std::unique_ptr<SubTree>> BuildSubTrees(TIndex *begin,
+                                                        TIndex *end,
+                                                        const TReal *data_ptr,
+                                                        int depth) const {
+        std::vector<std::unique_ptr<SubTree>> sub_trees;
+        if (depth == 0) {
+            sub_trees.emplace_back(
+                    new SubTree(begin, end, dimension_, data_ptr));
+            return sub_trees;
+        }
+
+        int axis = 0;
+        TReal max_extent = -1;
+        for (int d = 0; d < dimension_; ++d) {
+            TReal min_v = std::numeric_limits<TReal>::max();
+            TReal max_v = std::numeric_limits<TReal>::lowest();
+            for (TIndex *it = begin; it != end; ++it) {
+                const TReal v =
+                        data_ptr[static_cast<size_t>(*it) * dimension_ + d];
+                min_v = std::min(min_v, v);
+                max_v = std::max(max_v, v);
+            }
+            if (max_v - min_v > max_extent) {
+                max_extent = max_v - min_v;
+                axis = d;
+            }
+        }
+        TIndex *mid = begin + (end - begin) / 2;
+        std::nth_element(begin, mid, end, [&](TIndex a, TIndex b) {
+            return data_ptr[static_cast<size_t>(a) * dimension_ + axis] <
+                   data_ptr[static_cast<size_t>(b) * dimension_ + axis];
+        });
+
+        std::vector<std::unique_ptr<SubTree>> right;
+        tbb::parallel_invoke(
+                [&]() {
+                    sub_trees =
+                            BuildSubTrees(begin, mid, data_ptr, depth - 1);
+                },
+                [&]() {
+                    right = BuildSubTrees(mid, end, data_ptr, depth - 1);
+                });
+        for (auto &sub_tree : right) {
+            sub_trees.push_back(std::move(sub_tree));
+        }
+        return sub_trees;
+    }
+
+    int dimension_ = 0;
+    /// Trees in decreasing order of size.
+    std::vector<Tree> trees_;
+    size_t num_sub_trees_ = 0;
 };
 namespace impl {
 
@@ -113,6 +408,15 @@ void _BuildKdTree(size_t num_points,
                                                           points);
 }
 
+template <class T, class TIndex, int METRIC>
+void _AddPointsToKdTree(NanoFlannIndexHolderBase *holder,
+                        size_t num_points,
+                        size_t num_new_points,
+                        const T *const points) {
+    static_cast<NanoFlannIndexHolder<METRIC, T, TIndex> *>(holder)->AddPoints(
+            num_points, num_new_points, points);
+}
+
 template <class T, class TIndex, class OUTPUT_ALLOCATOR, int METRIC>
 void _KnnSearchCPU(NanoFlannIndexHolderBase *holder,
                    int64_t *query_neighbors_row_splits,
@@ -124,7 +428,8 @@ void _KnnSearchCPU(NanoFlannIndexHolderBase *holder,
                    int knn,
                    bool ignore_query_point,
                    bool return_distances,
-                   OUTPUT_ALLOCATOR &output_allocator) {
+                   OUTPUT_ALLOCATOR &output_allocator,
+                   double eps) {
     // return empty indices array if there are no points
     if (num_queries == 0 || num_points == 0 || holder == nullptr) {
         std::fill(query_neighbors_row_splits,
@@ -158,9 +463,9 @@ void _KnnSearchCPU(NanoFlannIndexHolderBase *holder,
                 std::vector<TIndex> result_indices(knn);
                 std::vector<T> result_distances(knn);
                 for (size_t i = r.begin(); i != r.end(); ++i) {
-                    size_t num_valid = holder_->index_->knnSearch(
+                    size_t num_valid = holder_->knnSearch(
                             &queries[i * dimension], knn, result_indices.data(),
-                            result_distances.data());
+                            result_distances.data(), float(eps));
 
                     int num_neighbors = 0;
                     for (size_t valid_i = 0; valid_i < num_valid; ++valid_i) {
@@ -267,7 +572,7 @@ void _RadiusSearchCPU(NanoFlannIndexHolderBase *holder,
                         radius = radius * radius;
                     }
 
-                    holder_->index_->radiusSearch(&queries[i * dimension],
+                    holder_->radiusSearch(&queries[i * dimension],
                                                   radius, search_result,
                                                   params);
 
@@ -375,7 +680,7 @@ void _HybridSearchCPU(NanoFlannIndexHolderBase *holder,
             [&](const tbb::blocked_range<size_t> &r) {
                 std::vector<std::pair<TIndex, T>> ret_matches;
                 for (size_t i = r.begin(); i != r.end(); ++i) {
-                    size_t num_results = holder_->index_->radiusSearch(
+                    size_t num_results = holder_->radiusSearch(
                             &queries[i * dimension], radius_squared,
                             ret_matches, params);
                     ret_matches.resize(num_results);
@@ -443,6 +748,50 @@ std::unique_ptr<NanoFlannIndexHolderBase> BuildKdTree(size_t num_points,
     return std::unique_ptr<NanoFlannIndexHolderBase>(holder);
 }
 
+/// Add points to a KD Tree built with BuildKdTree. The indices of the new
+/// points continue after the existing ones.
+///
+/// \tparam T   Floating-point data type for the point positions.
+///
+///
+/// \param holder   The pointer that point to NanFlannIndexHolder that is built
+///        with BuildKdTree function.
+///
+/// \param num_points   The number of points, including the new points.
+///
+/// \param num_new_points   The number of new points at the end of \p points.
+///
+/// \param points   Array with the positions of all points, old and new. It
+///        is only read during the call; the points that are BuildKdTree
+///        input must stay valid as before.
+///
+/// \param metric   Onf of L1, L2. Must be the metric used by BuildKdTree.
+///
+template <class T, class TIndex>
+void AddPointsToKdTree(NanoFlannIndexHolderBase *holder,
+                       size_t num_points,
+                       size_t num_new_points,
+                       const T *const points,
+                       const Metric metric) {
+#define FN_PARAMETERS holder, num_points, num_new_points, points
+
+#define CALL_TEMPLATE(METRIC)                                 \
+    if (METRIC == metric) {                                   \
+        _AddPointsToKdTree<T, TIndex, METRIC>(FN_PARAMETERS); \
+    }
+
+#define CALL_TEMPLATE2 \
+    CALL_TEMPLATE(L1)  \
+    CALL_TEMPLATE(L2)
+
+    CALL_TEMPLATE2
+
+#undef CALL_TEMPLATE
+#undef CALL_TEMPLATE2
+
+#undef FN_PARAMETERS
+}
+
 /// KNN search. This function computes a list of neighbor indices
 /// for each query point. The lists are stored linearly and an exclusive prefix
 /// sum defines the start and end of each list in the array.
@@ -495,6 +844,11 @@ std::unique_ptr<NanoFlannIndexHolderBase> BuildKdTree(size_t num_points,
 ///         elements. Both functions must accept the argument size==0.
 ///         In this case ptr does not need to be set.
 ///
+/// \param eps    Approximation error. For eps > 0 the search is approximate
+///        and each returned distance is within a factor of (1 + eps) of the
+///        true distance of the neighbor with the same rank. Note that for the
+///        L2 metric this bounds the squared distances.
+///
 template <class T, class TIndex, class OUTPUT_ALLOCATOR>
 void KnnSearchCPU(NanoFlannIndexHolderBase *holder,
                   int64_t *query_neighbors_row_splits,
@@ -507,11 +861,12 @@ void KnnSearchCPU(NanoFlannIndexHolderBase *holder,
                   const Metric metric,
                   bool ignore_query_point,
                   bool return_distances,
-                  OUTPUT_ALLOCATOR &output_allocator) {
+                  OUTPUT_ALLOCATOR &output_allocator,
+                  double eps = 0) {
 #define FN_PARAMETERS                                                      \
     holder, query_neighbors_row_splits, num_points, points, num_queries,   \
             queries, dimension, knn, ignore_query_point, return_distances, \
-            output_allocator
+            output_allocator, eps
 
 #define CALL_TEMPLATE(METRIC)                                              \
     if (METRIC == metric) {                                                \
@@ -26,6 +26,8 @@
 
 #include "open3d/core/nns/NanoFlannIndex.h"
 
+#include <limits>
+
 #include "open3d/core/Dispatch.h"
 #include "open3d/core/TensorCheck.h"
 #include "open3d/core/nns/NanoFlannImpl.h"
@@ -63,6 +65,7 @@ bool NanoFlannIndex::SetTensorData(const Tensor &dataset_points,
     }
 
     dataset_points_ = dataset_points.Contiguous();
+    base_points_ = dataset_points_;
     index_dtype_ = index_dtype;
     DISPATCH_FLOAT_INT_DTYPE_TO_TEMPLATE(GetDtype(), GetIndexDtype(), [&]() {
         holder_ = impl::BuildKdTree<scalar_t, int_t>(
@@ -73,8 +76,42 @@ bool NanoFlannIndex::SetTensorData(const Tensor &dataset_points,
     return true;
 };
 
+bool NanoFlannIndex::AddPoints(const Tensor &points) {
+    if (!holder_) {
+        utility::LogError("SetTensorData must be called before AddPoints.");
+    }
+    AssertTensorDevice(points, GetDevice());
+    AssertTensorDtype(points, GetDtype());
+    AssertTensorShape(points, {utility::nullopt, GetDimension()});
+
+    const int64_t num_new_points = points.GetShape(0);
+    if (num_new_points == 0) {
+        return true;
+    }
+    if (GetIndexDtype() == Int32 &&
+        dataset_points_.GetShape(0) + num_new_points >
+                std::numeric_limits<int32_t>::max()) {
+        utility::LogError(
+                "Too many points for Int32 indices, use Int64 instead.");
+    }
+
+    dataset_points_ = dataset_points_.Append(points, 0);
+    DISPATCH_FLOAT_INT_DTYPE_TO_TEMPLATE(GetDtype(), GetIndexDtype(), [&]() {
+        impl::AddPointsToKdTree<scalar_t, int_t>(
+                holder_.get(), dataset_points_.GetShape(0), num_new_points,
+                dataset_points_.GetDataPtr<scalar_t>(), /* metric */ L2);
+    });
+    return true;
+};
+
 std::pair<Tensor, Tensor> NanoFlannIndex::SearchKnn(const Tensor &query_points,
                                                     int knn) const {
+    return SearchKnn(query_points, knn, 0.0);
+};
+
+std::pair<Tensor, Tensor> NanoFlannIndex::SearchKnn(const Tensor &query_points,
+                                                    int knn,
+                                                    double eps) const {
     const Dtype dtype = GetDtype();
     const Device device = GetDevice();
     const Dtype index_dtype = GetIndexDtype();
@@ -86,6 +123,9 @@ std::pair<Tensor, Tensor> NanoFlannIndex::SearchKnn(const Tensor &query_points,
     if (knn <= 0) {
         utility::LogError("knn should be larger than 0.");
     }
+    if (eps < 0) {
+        utility::LogError("eps should not be negative.");
+    }
 
     const int64_t num_neighbors = std::min(
             static_cast<int64_t>(GetDatasetSize()), static_cast<int64_t>(knn));
@@ -105,7 +145,7 @@ std::pair<Tensor, Tensor> NanoFlannIndex::SearchKnn(const Tensor &query_points,
                 query_contiguous.GetDataPtr<scalar_t>(),
                 query_contiguous.GetShape(1), num_neighbors, /* metric */ L2,
                 /* ignore_query_point */ false,
-                /* return_distances */ true, output_allocator);
+                /* return_distances */ true, output_allocator, eps);
         indices = output_allocator.NeighborsIndex();
         distances = output_allocator.NeighborsDistance();
         indices = indices.View({num_query_points, num_neighbors});
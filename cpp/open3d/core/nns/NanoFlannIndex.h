@@ -66,6 +66,14 @@ public:
                 "NanoFlannIndex::SetTensorData with radius not implemented.");
     }
 
+    /// Add points to the index without rebuilding the KD-tree of the points
+    /// that are already indexed. The new points take the indices after the
+    /// existing dataset points.
+    ///
+    /// \param points Points to add. Must be 2D, with shape {n, d}, same dtype
+    /// and device with dataset_points.
+    bool AddPoints(const Tensor &points);
+
     /// Perform K nearest neighbor search.
     ///
     /// \param query_points Query points. Must be 2D, with shape {n, d}, same
@@ -77,6 +85,21 @@ public:
     std::pair<Tensor, Tensor> SearchKnn(const Tensor &query_points,
                                         int knn) const override;
 
+    /// Perform approximate K nearest neighbor search.
+    ///
+    /// \param query_points Query points. Must be 2D, with shape {n, d}, same
+    /// dtype with dataset_points.
+    /// \param knn Number of nearest neighbor to search.
+    /// \param eps Approximation error. The search is exact for eps = 0.
+    /// Otherwise, each returned squared distance is within a factor of
+    /// (1 + eps) of the exact squared distance of the same rank, and larger
+    /// eps visits fewer tree nodes.
+    /// \return Pair of Tensors: (indices, distances), same as the exact
+    /// search.
+    std::pair<Tensor, Tensor> SearchKnn(const Tensor &query_points,
+                                        int knn,
+                                        double eps) const;
+
     /// Perform radius search with multiple radii.
     ///
     /// \param query_points Query points. Must be 2D, with shape {n, d}, same
@@ -125,6 +148,9 @@ public:
 protected:
     // Tensor dataset_points_;
     std::unique_ptr<NanoFlannIndexHolderBase> holder_;
+    /// Dataset points given to SetTensorData, referenced by the KD-tree after
+    /// AddPoints reallocates dataset_points_.
+    Tensor base_points_;
 };
 }  // namespace nns
 }  // namespace core
@@ -26,6 +26,9 @@
 
 #include "open3d/core/nns/NearestNeighborSearch.h"
 
+#include <algorithm>
+
+#include "open3d/core/MemoryManagerStatistic.h"
 #include "open3d/utility/Logging.h"
 
 namespace open3d {
@@ -35,11 +38,13 @@ namespace nns {
 NearestNeighborSearch::~NearestNeighborSearch(){};
 
 bool NearestNeighborSearch::SetIndex() {
+    ScopedMemoryTag memory_tag("nns");
     nanoflann_index_.reset(new NanoFlannIndex());
     return nanoflann_index_->SetTensorData(dataset_points_, index_dtype_);
 };
 
 bool NearestNeighborSearch::KnnIndex() {
+    ScopedMemoryTag memory_tag("nns");
     if (dataset_points_.GetDevice().GetType() == Device::DeviceType::CUDA) {
 #ifdef BUILD_CUDA_MODULE
         knn_index_.reset(new nns::KnnIndex());
@@ -57,6 +62,7 @@ bool NearestNeighborSearch::KnnIndex() {
 bool NearestNeighborSearch::MultiRadiusIndex() { return SetIndex(); };
 
 bool NearestNeighborSearch::FixedRadiusIndex(utility::optional<double> radius) {
+    ScopedMemoryTag memory_tag("nns");
     if (dataset_points_.GetDevice().GetType() == Device::DeviceType::CUDA) {
         if (!radius.has_value())
             utility::LogError("radius is required for GPU FixedRadiusIndex.");
@@ -77,6 +83,7 @@ bool NearestNeighborSearch::FixedRadiusIndex(utility::optional<double> radius) {
 }
 
 bool NearestNeighborSearch::HybridIndex(utility::optional<double> radius) {
+    ScopedMemoryTag memory_tag("nns");
     if (dataset_points_.GetDevice().GetType() == Device::DeviceType::CUDA) {
         if (!radius.has_value())
             utility::LogError("radius is required for GPU HybridIndex.");
@@ -96,7 +103,8 @@ bool NearestNeighborSearch::HybridIndex(utility::optional<double> radius) {
 };
 
 std::pair<Tensor, Tensor> NearestNeighborSearch::KnnSearch(
-        const Tensor& query_points, int knn) {
+        const Tensor& query_points, int knn, double eps) {
+    ScopedMemoryTag memory_tag("nns");
     AssertTensorDevice(query_points, dataset_points_.GetDevice());
 
     if (dataset_points_.GetDevice().GetType() == Device::DeviceType::CUDA) {
@@ -107,7 +115,7 @@ std::pair<Tensor, Tensor> NearestNeighborSearch::KnnSearch(
         }
     } else {
         if (nanoflann_index_) {
-            return nanoflann_index_->SearchKnn(query_points, knn);
+            return nanoflann_index_->SearchKnn(query_points, knn, eps);
         } else {
             utility::LogError("Index is not set.");
         }
@@ -116,6 +124,7 @@ std::pair<Tensor, Tensor> NearestNeighborSearch::KnnSearch(
 
 std::tuple<Tensor, Tensor, Tensor> NearestNeighborSearch::FixedRadiusSearch(
         const Tensor& query_points, double radius, bool sort) {
+    ScopedMemoryTag memory_tag("nns");
     AssertTensorDevice(query_points, dataset_points_.GetDevice());
 
     if (dataset_points_.GetDevice().GetType() == Device::DeviceType::CUDA) {
@@ -134,8 +143,29 @@ std::tuple<Tensor, Tensor, Tensor> NearestNeighborSearch::FixedRadiusSearch(
     }
 }
 
+void NearestNeighborSearch::FixedRadiusSearchTiled(
+        const Tensor& query_points,
+        double radius,
+        int64_t tile_size,
+        const TileCallback& callback,
+        bool sort) {
+    ScopedMemoryTag memory_tag("nns");
+    if (tile_size <= 0) {
+        utility::LogError("tile_size should be larger than 0.");
+    }
+    const int64_t num_query_points = query_points.GetLength();
+    for (int64_t begin = 0; begin < num_query_points; begin += tile_size) {
+        const int64_t end = std::min(begin + tile_size, num_query_points);
+        Tensor indices, distances, row_splits;
+        std::tie(indices, distances, row_splits) = FixedRadiusSearch(
+                query_points.Slice(0, begin, end), radius, sort);
+        callback(begin, indices, distances, row_splits);
+    }
+}
+
 std::tuple<Tensor, Tensor, Tensor> NearestNeighborSearch::MultiRadiusSearch(
         const Tensor& query_points, const Tensor& radii) {
+    ScopedMemoryTag memory_tag("nns");
     AssertNotCUDA(query_points);
     AssertTensorDtype(query_points, dataset_points_.GetDtype());
     AssertTensorDtype(radii, dataset_points_.GetDtype());
@@ -150,6 +180,7 @@ std::tuple<Tensor, Tensor, Tensor> NearestNeighborSearch::HybridSearch(
         const Tensor& query_points,
         const double radius,
         const int max_knn) const {
+    ScopedMemoryTag memory_tag("nns");
     AssertTensorDevice(query_points, dataset_points_.GetDevice());
 
     if (dataset_points_.GetDevice().GetType() == Device::DeviceType::CUDA) {
@@ -169,6 +200,26 @@ std::tuple<Tensor, Tensor, Tensor> NearestNeighborSearch::HybridSearch(
     }
 }
 
+void NearestNeighborSearch::HybridSearchTiled(
+        const Tensor& query_points,
+        const double radius,
+        const int max_knn,
+        int64_t tile_size,
+        const TileCallback& callback) const {
+    ScopedMemoryTag memory_tag("nns");
+    if (tile_size <= 0) {
+        utility::LogError("tile_size should be larger than 0.");
+    }
+    const int64_t num_query_points = query_points.GetLength();
+    for (int64_t begin = 0; begin < num_query_points; begin += tile_size) {
+        const int64_t end = std::min(begin + tile_size, num_query_points);
+        Tensor indices, distances, counts;
+        std::tie(indices, distances, counts) = HybridSearch(
+                query_points.Slice(0, begin, end), radius, max_knn);
+        callback(begin, indices, distances, counts);
+    }
+}
+
 void NearestNeighborSearch::AssertNotCUDA(const Tensor& t) const {
     if (t.GetDevice().GetType() == Device::DeviceType::CUDA) {
         utility::LogError(
@@ -26,6 +26,7 @@
 
 #pragma once
 
+#include <functional>
 #include <vector>
 
 #include "open3d/core/Tensor.h"
@@ -43,6 +44,14 @@ namespace nns {
 /// \brief A Class for nearest neighbor search.
 class NearestNeighborSearch {
 public:
+    /// Callback of the tiled searches, called once per tile of queries with
+    /// the index of the first query in the tile and the search result of the
+    /// tile, laid out as the result of the untiled search.
+    using TileCallback = std::function<void(int64_t query_offset,
+                                            const Tensor &indices,
+                                            const Tensor &distances,
+                                            const Tensor &splits_or_counts)>;
+
     /// Constructor.
     ///
     /// \param dataset_points Dataset points for constructing search index. Must
@@ -82,11 +91,16 @@ public:
     ///
     /// \param query_points Query points. Must be 2D, with shape {n, d}.
     /// \param knn Number of neighbors to search per query point.
+    /// \param eps Approximation error for CPU search. For eps > 0 each returned
+    /// squared distance is within a factor of (1 + eps) of the exact one of
+    /// the same rank, trading recall for speed. CUDA search is always exact.
     /// \return Pair of Tensors, (indices, distances):
     /// - indices: Tensor of shape {n, knn}, with dtype Int32.
     /// - distances: Tensor of shape {n, knn}, same dtype with query_points.
     ///              The distances are squared L2 distances.
-    std::pair<Tensor, Tensor> KnnSearch(const Tensor &query_points, int knn);
+    std::pair<Tensor, Tensor> KnnSearch(const Tensor &query_points,
+                                        int knn,
+                                        double eps = 0.0);
 
     /// Perform fixed radius search. All query points share the same radius.
     ///
@@ -102,6 +116,23 @@ public:
     std::tuple<Tensor, Tensor, Tensor> FixedRadiusSearch(
             const Tensor &query_points, double radius, bool sort = true);
 
+    /// Perform fixed radius search in tiles of at most \p tile_size queries,
+    /// so that only the neighbors of one tile are held in memory at a time.
+    ///
+    /// \param query_points Data points for querying. Must be 2D, with shape
+    /// {n, d}.
+    /// \param radius Radius.
+    /// \param tile_size Maximum number of queries per tile.
+    /// \param callback Called per tile with (query_offset, indices,
+    /// distances, row_splits) where row_splits has shape {tile_length + 1}
+    /// and starts at 0.
+    /// \param sort Sort the neighbors of each query by distance.
+    void FixedRadiusSearchTiled(const Tensor &query_points,
+                                double radius,
+                                int64_t tile_size,
+                                const TileCallback &callback,
+                                bool sort = true);
+
     /// Perform multi-radius search. Each query point has an independent radius.
     ///
     /// \param query_points Query points. Must be 2D, with shape {n, d}.
@@ -132,6 +163,23 @@ public:
                                                     const double radius,
                                                     const int max_knn) const;
 
+    /// Perform hybrid search in tiles of at most \p tile_size queries, so
+    /// that only the neighbors of one tile are held in memory at a time.
+    ///
+    /// \param query_points Data points for querying. Must be 2D, with shape
+    /// {n, d}.
+    /// \param radius Radius.
+    /// \param max_knn Maximum number of neighbor to search per query.
+    /// \param tile_size Maximum number of queries per tile.
+    /// \param callback Called per tile with (query_offset, indices,
+    /// distances, counts) where indices and distances have shape
+    /// {tile_length, max_knn} and counts has shape {tile_length}.
+    void HybridSearchTiled(const Tensor &query_points,
+                           const double radius,
+                           const int max_knn,
+                           int64_t tile_size,
+                           const TileCallback &callback) const;
+
 private:
     bool SetIndex();
 
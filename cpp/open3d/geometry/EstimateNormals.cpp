@@ -24,8 +24,12 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <tbb/parallel_sort.h>
+
 #include <Eigen/Eigenvalues>
-#include <queue>
+#include <algorithm>
+#include <atomic>
+#include <numeric>
 #include <tuple>
 
 #include "open3d/geometry/KDTreeFlann.h"
@@ -280,22 +284,66 @@ struct WeightedEdge {
     double weight_;
 };
 
-// Minimum Spanning Tree algorithm (Kruskal's algorithm)
-std::vector<WeightedEdge> Kruskal(std::vector<WeightedEdge> &edges,
+// Minimum Spanning Forest algorithm (Boruvka's algorithm). In each round
+// every component selects its lightest outgoing edge in parallel, ties are
+// broken by the edge index so the selected edges never form a cycle, and the
+// components are merged along the selected edges.
+std::vector<WeightedEdge> Boruvka(const std::vector<WeightedEdge> &edges,
                                   size_t n_vertices) {
-    std::sort(edges.begin(), edges.end(),
-              [](WeightedEdge &e0, WeightedEdge &e1) {
-                  return e0.weight_ < e1.weight_;
-              });
+    auto IsLighter = [&](int64_t e0, int64_t e1) {
+        return edges[e0].weight_ < edges[e1].weight_ ||
+               (edges[e0].weight_ == edges[e1].weight_ && e0 < e1);
+    };
     DisjointSet disjoint_set(n_vertices);
+    std::vector<size_t> components(n_vertices);
+    std::iota(components.begin(), components.end(), 0);
+    std::vector<std::atomic<int64_t>> lightest_edges(n_vertices);
+    std::vector<int64_t> active_edges(edges.size());
+    std::iota(active_edges.begin(), active_edges.end(), 0);
     std::vector<WeightedEdge> mst;
-    for (size_t eidx = 0; eidx < edges.size(); ++eidx) {
-        size_t set0 = disjoint_set.Find(edges[eidx].v0_);
-        size_t set1 = disjoint_set.Find(edges[eidx].v1_);
-        if (set0 != set1) {
-            mst.push_back(edges[eidx]);
-            disjoint_set.Union(set0, set1);
+    while (!active_edges.empty()) {
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+        for (int64_t v = 0; v < int64_t(n_vertices); ++v) {
+            lightest_edges[v].store(-1, std::memory_order_relaxed);
         }
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+        for (int64_t i = 0; i < int64_t(active_edges.size()); ++i) {
+            const int64_t eidx = active_edges[i];
+            for (size_t component : {components[edges[eidx].v0_],
+                                     components[edges[eidx].v1_]}) {
+                std::atomic<int64_t> &lightest = lightest_edges[component];
+                int64_t current = lightest.load(std::memory_order_relaxed);
+                while ((current < 0 || IsLighter(eidx, current)) &&
+                       !lightest.compare_exchange_weak(current, eidx)) {
+                }
+            }
+        }
+
+        // Two components may select the same edge, hence the cycle check.
+        for (size_t v = 0; v < n_vertices; ++v) {
+            const int64_t eidx = lightest_edges[v].load();
+            if (eidx < 0) {
+                continue;
+            }
+            size_t set0 = disjoint_set.Find(edges[eidx].v0_);
+            size_t set1 = disjoint_set.Find(edges[eidx].v1_);
+            if (set0 != set1) {
+                mst.push_back(edges[eidx]);
+                disjoint_set.Union(set0, set1);
+            }
+        }
+        for (size_t v = 0; v < n_vertices; ++v) {
+            components[v] = disjoint_set.Find(v);
+        }
+        active_edges.erase(
+                std::remove_if(active_edges.begin(), active_edges.end(),
+                               [&](int64_t eidx) {
+                                   return components[edges[eidx].v0_] ==
+                                          components[edges[eidx].v1_];
+                               }),
+                active_edges.end());
     }
     return mst;
 }
@@ -383,82 +431,123 @@ void PointCloud::OrientNormalsConsistentTangentPlane(size_t k) {
         utility::LogError(
                 "No normals in the PointCloud. Call EstimateNormals() first.");
     }
+    const size_t n_points = points_.size();
+    if (n_points == 0) {
+        return;
+    }
 
     // Create Riemannian graph (Euclidean MST + kNN)
     // Euclidean MST is subgraph of Delaunay triangulation
     std::shared_ptr<TetraMesh> delaunay_mesh;
     std::vector<size_t> pt_map;
     std::tie(delaunay_mesh, pt_map) = TetraMesh::CreateFromPointCloud(*this);
-    std::vector<WeightedEdge> delaunay_graph;
-    std::unordered_set<size_t> graph_edges;
     auto EdgeIndex = [&](size_t v0, size_t v1) -> size_t {
-        return std::min(v0, v1) * points_.size() + std::max(v0, v1);
+        return std::min(v0, v1) * n_points + std::max(v0, v1);
     };
-    auto AddEdgeToDelaunayGraph = [&](size_t v0, size_t v1) {
-        v0 = pt_map[v0];
-        v1 = pt_map[v1];
-        size_t edge = EdgeIndex(v0, v1);
-        if (graph_edges.count(edge) == 0) {
-            double dist = (points_[v0] - points_[v1]).squaredNorm();
-            delaunay_graph.push_back(WeightedEdge(v0, v1, dist));
-            graph_edges.insert(edge);
+    const int64_t n_tetras = int64_t(delaunay_mesh->tetras_.size());
+    std::vector<size_t> delaunay_edges(6 * n_tetras);
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t tidx = 0; tidx < n_tetras; ++tidx) {
+        const Eigen::Vector4i &tetra = delaunay_mesh->tetras_[tidx];
+        size_t *edges = delaunay_edges.data() + 6 * tidx;
+        int eidx = 0;
+        for (int i = 0; i < 4; ++i) {
+            for (int j = i + 1; j < 4; ++j) {
+                edges[eidx++] = EdgeIndex(pt_map[tetra[i]], pt_map[tetra[j]]);
+            }
         }
-    };
-    for (const Eigen::Vector4i &tetra : delaunay_mesh->tetras_) {
-        AddEdgeToDelaunayGraph(tetra[0], tetra[1]);
-        AddEdgeToDelaunayGraph(tetra[0], tetra[2]);
-        AddEdgeToDelaunayGraph(tetra[0], tetra[3]);
-        AddEdgeToDelaunayGraph(tetra[1], tetra[2]);
-        AddEdgeToDelaunayGraph(tetra[1], tetra[3]);
-        AddEdgeToDelaunayGraph(tetra[2], tetra[3]);
+    }
+    tbb::parallel_sort(delaunay_edges.begin(), delaunay_edges.end());
+    delaunay_edges.erase(
+            std::unique(delaunay_edges.begin(), delaunay_edges.end()),
+            delaunay_edges.end());
+
+    std::vector<WeightedEdge> delaunay_graph(delaunay_edges.size(),
+                                             WeightedEdge(0, 0, 0));
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t eidx = 0; eidx < int64_t(delaunay_edges.size()); ++eidx) {
+        const size_t v0 = delaunay_edges[eidx] / n_points;
+        const size_t v1 = delaunay_edges[eidx] % n_points;
+        delaunay_graph[eidx] = WeightedEdge(
+                v0, v1, (points_[v0] - points_[v1]).squaredNorm());
     }
 
-    std::vector<WeightedEdge> mst = Kruskal(delaunay_graph, points_.size());
+    std::vector<WeightedEdge> mst = Boruvka(delaunay_graph, n_points);
 
     auto NormalWeight = [&](size_t v0, size_t v1) -> double {
         return 1.0 - std::abs(normals_[v0].dot(normals_[v1]));
     };
-    for (auto &edge : mst) {
-        edge.weight_ = NormalWeight(edge.v0_, edge.v1_);
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t eidx = 0; eidx < int64_t(mst.size()); ++eidx) {
+        mst[eidx].weight_ = NormalWeight(mst[eidx].v0_, mst[eidx].v1_);
     }
 
     // Add k nearest neighbors to Riemannian graph
     KDTreeFlann kdtree(*this);
-    for (size_t v0 = 0; v0 < points_.size(); ++v0) {
+    std::vector<std::vector<size_t>> knn_edges(n_points);
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t v0 = 0; v0 < int64_t(n_points); ++v0) {
         std::vector<int> neighbors;
         std::vector<double> dists2;
         kdtree.SearchKNN(points_[v0], int(k), neighbors, dists2);
-        for (size_t vidx1 = 0; vidx1 < neighbors.size(); ++vidx1) {
-            size_t v1 = size_t(neighbors[vidx1]);
-            if (v0 == v1) {
+        for (int neighbor : neighbors) {
+            const size_t v1 = size_t(neighbor);
+            if (size_t(v0) == v1) {
                 continue;
             }
-            size_t edge = EdgeIndex(v0, v1);
-            if (graph_edges.count(edge) == 0) {
-                double weight = NormalWeight(v0, v1);
-                mst.push_back(WeightedEdge(v0, v1, weight));
-                graph_edges.insert(edge);
+            const size_t edge = EdgeIndex(v0, v1);
+            if (!std::binary_search(delaunay_edges.begin(),
+                                    delaunay_edges.end(), edge)) {
+                knn_edges[v0].push_back(edge);
             }
         }
     }
+    std::vector<size_t> knn_graph_edges;
+    for (const auto &edges : knn_edges) {
+        knn_graph_edges.insert(knn_graph_edges.end(), edges.begin(),
+                               edges.end());
+    }
+    tbb::parallel_sort(knn_graph_edges.begin(), knn_graph_edges.end());
+    knn_graph_edges.erase(
+            std::unique(knn_graph_edges.begin(), knn_graph_edges.end()),
+            knn_graph_edges.end());
+    const size_t n_mst_edges = mst.size();
+    mst.resize(n_mst_edges + knn_graph_edges.size(), WeightedEdge(0, 0, 0));
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t eidx = 0; eidx < int64_t(knn_graph_edges.size()); ++eidx) {
+        const size_t v0 = knn_graph_edges[eidx] / n_points;
+        const size_t v1 = knn_graph_edges[eidx] % n_points;
+        mst[n_mst_edges + eidx] = WeightedEdge(v0, v1, NormalWeight(v0, v1));
+    }
 
     // extract MST from Riemannian graph
-    mst = Kruskal(mst, points_.size());
+    mst = Boruvka(mst, n_points);
 
-    // convert list of edges to graph
-    std::vector<std::unordered_set<size_t>> mst_graph(points_.size());
+    // convert list of edges to graph in compressed sparse row format
+    std::vector<size_t> mst_offsets(n_points + 1, 0);
+    for (const auto &edge : mst) {
+        ++mst_offsets[edge.v0_ + 1];
+        ++mst_offsets[edge.v1_ + 1];
+    }
+    std::partial_sum(mst_offsets.begin(), mst_offsets.end(),
+                     mst_offsets.begin());
+    std::vector<size_t> mst_neighbors(mst_offsets.back());
+    std::vector<size_t> fill(mst_offsets.begin(), mst_offsets.end() - 1);
     for (const auto &edge : mst) {
-        size_t v0 = edge.v0_;
-        size_t v1 = edge.v1_;
-        mst_graph[v0].insert(v1);
-        mst_graph[v1].insert(v0);
+        mst_neighbors[fill[edge.v0_]++] = edge.v1_;
+        mst_neighbors[fill[edge.v1_]++] = edge.v0_;
     }
 
     // find start node for tree traversal
     // init with node that maximizes z
     double max_z = std::numeric_limits<double>::lowest();
     size_t v0 = 0;
-    for (size_t vidx = 0; vidx < points_.size(); ++vidx) {
+    for (size_t vidx = 0; vidx < n_points; ++vidx) {
         const Eigen::Vector3d &v = points_[vidx];
         if (v(2) > max_z) {
             max_z = v(2);
@@ -466,10 +555,9 @@ void PointCloud::OrientNormalsConsistentTangentPlane(size_t k) {
         }
     }
 
-    // traverse MST and orient normals consistently
-    std::queue<size_t> traversal_queue;
-    std::vector<bool> visited(points_.size(), false);
-    traversal_queue.push(v0);
+    // traverse MST level by level and orient normals consistently. Every
+    // node of the tree is reached from its parent only, so the nodes of one
+    // frontier are processed in parallel.
     auto TestAndOrientNormal = [&](const Eigen::Vector3d &n0,
                                    Eigen::Vector3d &n1) {
         if (n0.dot(n1) < 0) {
@@ -477,16 +565,32 @@ void PointCloud::OrientNormalsConsistentTangentPlane(size_t k) {
         }
     };
     TestAndOrientNormal(Eigen::Vector3d(0, 0, 1), normals_[v0]);
-    while (!traversal_queue.empty()) {
-        v0 = traversal_queue.front();
-        traversal_queue.pop();
-        visited[v0] = true;
-        for (size_t v1 : mst_graph[v0]) {
-            if (!visited[v1]) {
-                traversal_queue.push(v1);
-                TestAndOrientNormal(normals_[v0], normals_[v1]);
+    std::vector<uint8_t> visited(n_points, 0);
+    visited[v0] = 1;
+    std::vector<size_t> frontier = {v0};
+    while (!frontier.empty()) {
+        std::vector<size_t> next_frontier;
+#pragma omp parallel num_threads(utility::EstimateMaxThreads())
+        {
+            std::vector<size_t> local_frontier;
+#pragma omp for schedule(static) nowait
+            for (int64_t fidx = 0; fidx < int64_t(frontier.size()); ++fidx) {
+                const size_t v = frontier[fidx];
+                for (size_t nidx = mst_offsets[v]; nidx < mst_offsets[v + 1];
+                     ++nidx) {
+                    const size_t v1 = mst_neighbors[nidx];
+                    if (!visited[v1]) {
+                        visited[v1] = 1;
+                        TestAndOrientNormal(normals_[v], normals_[v1]);
+                        local_frontier.push_back(v1);
+                    }
+                }
             }
+#pragma omp critical(OrientNormalsConsistentTangentPlane)
+            next_frontier.insert(next_frontier.end(), local_frontier.begin(),
+                                 local_frontier.end());
         }
+        frontier = std::move(next_frontier);
     }
 }
 
@@ -30,6 +30,7 @@
 #include <numeric>
 
 #include "open3d/utility/Logging.h"
+#include "open3d/utility/Parallel.h"
 
 namespace open3d {
 namespace geometry {
@@ -95,22 +96,23 @@ void Geometry3D::ResizeAndPaintUniformColor(
 
 void Geometry3D::TransformPoints(const Eigen::Matrix4d& transformation,
                                  std::vector<Eigen::Vector3d>& points) const {
-    for (auto& point : points) {
-        Eigen::Vector4d new_point =
-                transformation *
-                Eigen::Vector4d(point(0), point(1), point(2), 1.0);
-        point = new_point.head<3>() / new_point(3);
+    // Apply the 3x4 part and the projective row separately, which avoids
+    // building homogeneous vectors per point.
+    const Eigen::Matrix3d R = transformation.block<3, 3>(0, 0);
+    const Eigen::Vector3d t = transformation.block<3, 1>(0, 3);
+    const Eigen::Vector3d p = transformation.block<1, 3>(3, 0).transpose();
+    const double w = transformation(3, 3);
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t i = 0; i < int64_t(points.size()); ++i) {
+        Eigen::Vector3d& point = points[i];
+        point = (R * point + t) / (p.dot(point) + w);
     }
 }
 
 void Geometry3D::TransformNormals(const Eigen::Matrix4d& transformation,
                                   std::vector<Eigen::Vector3d>& normals) const {
-    for (auto& normal : normals) {
-        Eigen::Vector4d new_normal =
-                transformation *
-                Eigen::Vector4d(normal(0), normal(1), normal(2), 0.0);
-        normal = new_normal.head<3>();
-    }
+    RotateNormals(transformation.block<3, 3>(0, 0), normals);
 }
 
 void Geometry3D::TransformCovariances(
@@ -126,31 +128,39 @@ void Geometry3D::TranslatePoints(const Eigen::Vector3d& translation,
     if (!relative) {
         transform -= ComputeCenter(points);
     }
-    for (auto& point : points) {
-        point += transform;
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t i = 0; i < int64_t(points.size()); ++i) {
+        points[i] += transform;
     }
 }
 
 void Geometry3D::ScalePoints(const double scale,
                              std::vector<Eigen::Vector3d>& points,
                              const Eigen::Vector3d& center) const {
-    for (auto& point : points) {
-        point = (point - center) * scale + center;
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t i = 0; i < int64_t(points.size()); ++i) {
+        points[i] = (points[i] - center) * scale + center;
     }
 }
 
 void Geometry3D::RotatePoints(const Eigen::Matrix3d& R,
                               std::vector<Eigen::Vector3d>& points,
                               const Eigen::Vector3d& center) const {
-    for (auto& point : points) {
-        point = R * (point - center) + center;
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t i = 0; i < int64_t(points.size()); ++i) {
+        points[i] = R * (points[i] - center) + center;
     }
 }
 
 void Geometry3D::RotateNormals(const Eigen::Matrix3d& R,
                                std::vector<Eigen::Vector3d>& normals) const {
-    for (auto& normal : normals) {
-        normal = R * normal;
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t i = 0; i < int64_t(normals.size()); ++i) {
+        normals[i] = R * normals[i];
     }
 }
 
@@ -160,8 +170,10 @@ void Geometry3D::RotateNormals(const Eigen::Matrix3d& R,
 void Geometry3D::RotateCovariances(
         const Eigen::Matrix3d& R,
         std::vector<Eigen::Matrix3d>& covariances) const {
-    for (auto& covariance : covariances) {
-        covariance = R * covariance * R.transpose();
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t i = 0; i < int64_t(covariances.size()); ++i) {
+        covariances[i] = R * covariances[i] * R.transpose();
     }
 }
 
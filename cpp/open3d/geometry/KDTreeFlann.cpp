@@ -112,7 +112,8 @@ template <typename T>
 int KDTreeFlann::SearchKNN(const T &query,
                            int knn,
                            std::vector<int> &indices,
-                           std::vector<double> &distance2) const {
+                           std::vector<double> &distance2,
+                           double eps) const {
     // This is optimized code for heavily repeated search.
     // Other flann::Index::knnSearch() implementations lose performance due to
     // memory allocation/deallocation.
@@ -123,8 +124,11 @@ int KDTreeFlann::SearchKNN(const T &query,
     indices.resize(knn);
     distance2.resize(knn);
     std::vector<Eigen::Index> indices_eigen(knn);
-    int k = nanoflann_index_->index->knnSearch(
-            query.data(), knn, indices_eigen.data(), distance2.data());
+    nanoflann::KNNResultSet<double, Eigen::Index> result(knn);
+    result.init(indices_eigen.data(), distance2.data());
+    nanoflann_index_->index->findNeighbors(
+            result, query.data(), nanoflann::SearchParams(32, float(eps)));
+    int k = static_cast<int>(result.size());
     indices.resize(k);
     distance2.resize(k);
     std::copy_n(indices_eigen.begin(), k, indices.begin());
@@ -210,7 +214,8 @@ template int KDTreeFlann::SearchKNN<Eigen::Vector3d>(
         const Eigen::Vector3d &query,
         int knn,
         std::vector<int> &indices,
-        std::vector<double> &distance2) const;
+        std::vector<double> &distance2,
+        double eps) const;
 template int KDTreeFlann::SearchRadius<Eigen::Vector3d>(
         const Eigen::Vector3d &query,
         double radius,
@@ -232,7 +237,8 @@ template int KDTreeFlann::SearchKNN<Eigen::VectorXd>(
         const Eigen::VectorXd &query,
         int knn,
         std::vector<int> &indices,
-        std::vector<double> &distance2) const;
+        std::vector<double> &distance2,
+        double eps) const;
 template int KDTreeFlann::SearchRadius<Eigen::VectorXd>(
         const Eigen::VectorXd &query,
         double radius,
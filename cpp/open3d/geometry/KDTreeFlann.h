@@ -89,11 +89,15 @@ public:
                std::vector<int> &indices,
                std::vector<double> &distance2) const;
 
+    /// Search the knn nearest neighbors of query. With eps > 0 the search is
+    /// approximate: each returned squared distance is within a factor of
+    /// (1 + eps) of the exact one of the same rank.
     template <typename T>
     int SearchKNN(const T &query,
                   int knn,
                   std::vector<int> &indices,
-                  std::vector<double> &distance2) const;
+                  std::vector<double> &distance2,
+                  double eps = 0.0) const;
 
     template <typename T>
     int SearchRadius(const T &query,
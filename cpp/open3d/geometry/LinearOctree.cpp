@@ -0,0 +1,359 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/geometry/LinearOctree.h"
+
+#include <tbb/parallel_sort.h>
+
+#include <algorithm>
+#include <limits>
+#include <utility>
+
+#include "open3d/geometry/PointCloud.h"
+#include "open3d/utility/Logging.h"
+#include "open3d/utility/Parallel.h"
+#include "open3d/utility/ParallelScan.h"
+
+namespace open3d {
+namespace geometry {
+
+namespace {
+
+constexpr size_t kMaxLinearOctreeDepth = 21;
+constexpr uint64_t kInvalidCode = std::numeric_limits<uint64_t>::max();
+
+/// Descends from the root to the leaf containing \p point with the same
+/// comparisons as Octree::InsertPoint. Returns kInvalidCode if the point is
+/// outside of the bounds.
+uint64_t ComputeLeafCode(const Eigen::Vector3d& point,
+                         Eigen::Vector3d origin,
+                         double size,
+                         size_t max_depth) {
+    if (!Octree::IsPointInBound(point, origin, size)) {
+        return kInvalidCode;
+    }
+    uint64_t code = 0;
+    for (size_t depth = 0; depth < max_depth; ++depth) {
+        const double child_size = size / 2.0;
+        const size_t x_index = point(0) < origin(0) + child_size ? 0 : 1;
+        const size_t y_index = point(1) < origin(1) + child_size ? 0 : 1;
+        const size_t z_index = point(2) < origin(2) + child_size ? 0 : 1;
+        origin += Eigen::Vector3d(x_index * child_size, y_index * child_size,
+                                  z_index * child_size);
+        size = child_size;
+        if (!Octree::IsPointInBound(point, origin, size)) {
+            return kInvalidCode;
+        }
+        code = (code << 3) | (x_index + y_index * 2 + z_index * 4);
+    }
+    return code;
+}
+
+/// Groups the sorted \p keys by key >> \p shift. Writes the distinct shifted
+/// keys to \p unique_keys and the start of each group to \p offsets, followed
+/// by keys.size().
+void GroupSortedKeys(const std::vector<uint64_t>& keys,
+                     int shift,
+                     std::vector<uint64_t>& unique_keys,
+                     std::vector<int64_t>& offsets) {
+    const int64_t n = int64_t(keys.size());
+    std::vector<int64_t> is_first(n);
+#pragma omp parallel for schedule(static) num_threads(utility::EstimateMaxThreads())
+    for (int64_t i = 0; i < n; ++i) {
+        is_first[i] = i == 0 || (keys[i] >> shift) != (keys[i - 1] >> shift);
+    }
+    std::vector<int64_t> group_ids(n);
+    utility::InclusivePrefixSum(is_first.data(), is_first.data() + n,
+                                group_ids.data());
+    const int64_t num_groups = n > 0 ? group_ids[n - 1] : 0;
+    unique_keys.resize(num_groups);
+    offsets.resize(num_groups + 1);
+    offsets[num_groups] = n;
+#pragma omp parallel for schedule(static) num_threads(utility::EstimateMaxThreads())
+    for (int64_t i = 0; i < n; ++i) {
+        if (is_first[i]) {
+            unique_keys[group_ids[i] - 1] = keys[i] >> shift;
+            offsets[group_ids[i] - 1] = i;
+        }
+    }
+}
+
+}  // namespace
+
+LinearOctree::LinearOctree(size_t max_depth)
+    : LinearOctree(max_depth, Eigen::Vector3d::Zero(), 0) {}
+
+LinearOctree::LinearOctree(size_t max_depth,
+                           const Eigen::Vector3d& origin,
+                           double size)
+    : origin_(origin), size_(size), max_depth_(max_depth) {
+    if (max_depth > kMaxLinearOctreeDepth) {
+        utility::LogError("max_depth must be at most {}, but got {}.",
+                          kMaxLinearOctreeDepth, max_depth);
+    }
+}
+
+LinearOctree& LinearOctree::Clear() {
+    codes_.clear();
+    point_offsets_.clear();
+    child_offsets_.clear();
+    point_indices_.clear();
+    leaf_colors_.clear();
+    return *this;
+}
+
+size_t LinearOctree::GetNumNodes() const {
+    size_t num_nodes = 0;
+    for (const auto& codes : codes_) {
+        num_nodes += codes.size();
+    }
+    return num_nodes;
+}
+
+size_t LinearOctree::GetNumNodes(size_t depth) const {
+    return depth < codes_.size() ? codes_[depth].size() : 0;
+}
+
+void LinearOctree::ConvertFromPointCloud(
+        const geometry::PointCloud& point_cloud, double size_expand) {
+    if (size_expand > 1 || size_expand < 0) {
+        utility::LogError("size_expand shall be between 0 and 1");
+    }
+
+    // Set bounds as in Octree::ConvertFromPointCloud.
+    Clear();
+    Eigen::Array3d min_bound = point_cloud.GetMinBound();
+    Eigen::Array3d max_bound = point_cloud.GetMaxBound();
+    Eigen::Array3d center = (min_bound + max_bound) / 2;
+    Eigen::Array3d half_sizes = center - min_bound;
+    double max_half_size = half_sizes.maxCoeff();
+    origin_ = min_bound.min(center - max_half_size);
+    if (max_half_size == 0) {
+        size_ = size_expand;
+    } else {
+        size_ = max_half_size * 2 * (1 + size_expand);
+    }
+
+    Build(point_cloud.points_, point_cloud.HasColors()
+                                       ? point_cloud.colors_
+                                       : std::vector<Eigen::Vector3d>());
+}
+
+void LinearOctree::Build(const std::vector<Eigen::Vector3d>& points,
+                         const std::vector<Eigen::Vector3d>& colors) {
+    if (!colors.empty() && colors.size() != points.size()) {
+        utility::LogError("{} colors are given for {} points.", colors.size(),
+                          points.size());
+    }
+    Clear();
+    const int64_t num_points = int64_t(points.size());
+    if (num_points == 0) return;
+
+    // Sort the points by leaf code and index, so that the points of every
+    // subtree form a range and are in insertion order within each leaf.
+    std::vector<std::pair<uint64_t, size_t>> code_indices(num_points);
+#pragma omp parallel for schedule(static) num_threads(utility::EstimateMaxThreads())
+    for (int64_t i = 0; i < num_points; ++i) {
+        code_indices[i] = std::make_pair(
+                ComputeLeafCode(points[i], origin_, size_, max_depth_),
+                size_t(i));
+    }
+    utility::ExecuteInArena([&]() {
+        tbb::parallel_sort(code_indices.begin(), code_indices.end());
+    });
+    while (!code_indices.empty() &&
+           code_indices.back().first == kInvalidCode) {
+        code_indices.pop_back();
+    }
+    if (code_indices.empty()) return;
+
+    const int64_t num_valid = int64_t(code_indices.size());
+    std::vector<uint64_t> point_codes(num_valid);
+    point_indices_.resize(num_valid);
+#pragma omp parallel for schedule(static) num_threads(utility::EstimateMaxThreads())
+    for (int64_t i = 0; i < num_valid; ++i) {
+        point_codes[i] = code_indices[i].first;
+        point_indices_[i] = code_indices[i].second;
+    }
+
+    // Build the levels bottom-up. The parents of a level are the groups of
+    // nodes sharing all but the lowest 3 code bits.
+    codes_.resize(max_depth_ + 1);
+    point_offsets_.resize(max_depth_ + 1);
+    child_offsets_.resize(max_depth_ + 1);
+    GroupSortedKeys(point_codes, 0, codes_[max_depth_],
+                    point_offsets_[max_depth_]);
+    for (size_t depth = max_depth_; depth-- > 0;) {
+        GroupSortedKeys(codes_[depth + 1], 3, codes_[depth],
+                        child_offsets_[depth]);
+        const std::vector<int64_t>& child_offsets = child_offsets_[depth];
+        const std::vector<int64_t>& child_point_offsets =
+                point_offsets_[depth + 1];
+        std::vector<int64_t>& point_offsets = point_offsets_[depth];
+        point_offsets.resize(child_offsets.size());
+        for (size_t i = 0; i < child_offsets.size(); ++i) {
+            point_offsets[i] = child_point_offsets[child_offsets[i]];
+        }
+    }
+
+    // A leaf has the color of its last inserted point.
+    const int64_t num_leaves = int64_t(codes_[max_depth_].size());
+    const std::vector<int64_t>& leaf_point_offsets = point_offsets_[max_depth_];
+    leaf_colors_.resize(num_leaves, Eigen::Vector3d::Zero());
+    if (!colors.empty()) {
+#pragma omp parallel for schedule(static) num_threads(utility::EstimateMaxThreads())
+        for (int64_t i = 0; i < num_leaves; ++i) {
+            leaf_colors_[i] =
+                    colors[point_indices_[leaf_point_offsets[i + 1] - 1]];
+        }
+    }
+}
+
+void LinearOctree::Traverse(
+        const std::function<bool(const LinearOctreeNode&,
+                                 const OctreeNodeInfo&)>& f) const {
+    if (IsEmpty()) return;
+    // The root's child index is 0, though it isn't a child node.
+    TraverseRecurse(LinearOctreeNode(0, 0),
+                    OctreeNodeInfo(origin_, size_, 0, 0), f);
+}
+
+void LinearOctree::TraverseRecurse(
+        const LinearOctreeNode& node,
+        const OctreeNodeInfo& node_info,
+        const std::function<bool(const LinearOctreeNode&,
+                                 const OctreeNodeInfo&)>& f) const {
+    if (f(node, node_info) || IsLeafNode(node)) return;
+
+    const double child_size = node_info.size_ / 2.0;
+    const std::vector<int64_t>& child_offsets = child_offsets_[node.depth_];
+    const std::vector<uint64_t>& child_codes = codes_[node.depth_ + 1];
+    for (int64_t child = child_offsets[node.index_];
+         child < child_offsets[node.index_ + 1]; ++child) {
+        const size_t child_index = child_codes[child] & 7;
+        const size_t x_index = child_index % 2;
+        const size_t y_index = (child_index / 2) % 2;
+        const size_t z_index = (child_index / 4) % 2;
+        const Eigen::Vector3d child_origin =
+                node_info.origin_ + Eigen::Vector3d(double(x_index),
+                                                    double(y_index),
+                                                    double(z_index)) *
+                                            child_size;
+        TraverseRecurse(LinearOctreeNode(node.depth_ + 1, child),
+                        OctreeNodeInfo(child_origin, child_size,
+                                       node_info.depth_ + 1, child_index),
+                        f);
+    }
+}
+
+std::pair<LinearOctreeNode, OctreeNodeInfo> LinearOctree::LocateLeafNode(
+        const Eigen::Vector3d& point) const {
+    const uint64_t code = ComputeLeafCode(point, origin_, size_, max_depth_);
+    if (IsEmpty() || code == kInvalidCode) {
+        return std::make_pair(LinearOctreeNode(), OctreeNodeInfo());
+    }
+    const std::vector<uint64_t>& leaf_codes = codes_[max_depth_];
+    auto it = std::lower_bound(leaf_codes.begin(), leaf_codes.end(), code);
+    if (it == leaf_codes.end() || *it != code) {
+        return std::make_pair(LinearOctreeNode(), OctreeNodeInfo());
+    }
+
+    // Recover the leaf bounds from its code.
+    Eigen::Vector3d origin = origin_;
+    double size = size_;
+    for (size_t depth = 0; depth < max_depth_; ++depth) {
+        const size_t child_index = (code >> (3 * (max_depth_ - 1 - depth))) & 7;
+        size /= 2.0;
+        origin += Eigen::Vector3d(double(child_index % 2),
+                                  double((child_index / 2) % 2),
+                                  double((child_index / 4) % 2)) *
+                  size;
+    }
+    return std::make_pair(
+            LinearOctreeNode(max_depth_, it - leaf_codes.begin()),
+            OctreeNodeInfo(origin, size, max_depth_,
+                           size_t(code & 7)));
+}
+
+void LinearOctree::CheckNode(const LinearOctreeNode& node) const {
+    if (!node.IsValid() || node.depth_ >= codes_.size() ||
+        size_t(node.index_) >= codes_[node.depth_].size()) {
+        utility::LogError("Invalid node at depth {} with index {}.",
+                          node.depth_, node.index_);
+    }
+}
+
+std::vector<size_t> LinearOctree::GetPointIndices(
+        const LinearOctreeNode& node) const {
+    CheckNode(node);
+    const std::vector<int64_t>& point_offsets = point_offsets_[node.depth_];
+    std::vector<size_t> indices(
+            point_indices_.begin() + point_offsets[node.index_],
+            point_indices_.begin() + point_offsets[node.index_ + 1]);
+    if (!IsLeafNode(node)) {
+        std::sort(indices.begin(), indices.end());
+    }
+    return indices;
+}
+
+Eigen::Vector3d LinearOctree::GetColor(const LinearOctreeNode& node) const {
+    CheckNode(node);
+    if (!IsLeafNode(node)) {
+        utility::LogError("Only leaf nodes have a color.");
+    }
+    return leaf_colors_[node.index_];
+}
+
+std::shared_ptr<Octree> LinearOctree::ToOctree() const {
+    auto octree = std::make_shared<Octree>(max_depth_, origin_, size_);
+    if (!IsEmpty()) {
+        octree->root_node_ = ToOctreeNode(LinearOctreeNode(0, 0));
+    }
+    return octree;
+}
+
+std::shared_ptr<OctreeNode> LinearOctree::ToOctreeNode(
+        const LinearOctreeNode& node) const {
+    if (IsLeafNode(node)) {
+        auto leaf_node = std::make_shared<OctreePointColorLeafNode>();
+        leaf_node->color_ = leaf_colors_[node.index_];
+        leaf_node->indices_ = GetPointIndices(node);
+        return leaf_node;
+    }
+    auto internal_node = std::make_shared<OctreeInternalPointNode>();
+    internal_node->indices_ = GetPointIndices(node);
+    const std::vector<int64_t>& child_offsets = child_offsets_[node.depth_];
+    for (int64_t child = child_offsets[node.index_];
+         child < child_offsets[node.index_ + 1]; ++child) {
+        internal_node->children_[codes_[node.depth_ + 1][child] & 7] =
+                ToOctreeNode(LinearOctreeNode(node.depth_ + 1, child));
+    }
+    return internal_node;
+}
+
+}  // namespace geometry
+}  // namespace open3d
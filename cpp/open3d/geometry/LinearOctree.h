@@ -0,0 +1,191 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#pragma once
+
+#include <Eigen/Core>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "open3d/geometry/Octree.h"
+
+namespace open3d {
+namespace geometry {
+
+class PointCloud;
+
+/// \class LinearOctreeNode
+///
+/// \brief Handle of a node in a LinearOctree, given by its depth and its index
+/// among the nodes of the same depth.
+class LinearOctreeNode {
+public:
+    LinearOctreeNode() : depth_(0), index_(-1) {}
+    LinearOctreeNode(size_t depth, int64_t index)
+        : depth_(depth), index_(index) {}
+
+    /// Returns false if the handle does not refer to a node.
+    bool IsValid() const { return index_ >= 0; }
+
+public:
+    /// Depth of the node, the root has depth 0.
+    size_t depth_;
+    /// Index of the node among the nodes with the same depth, in Morton order.
+    int64_t index_;
+};
+
+/// \class LinearOctree
+///
+/// \brief Pointerless octree of a point cloud.
+///
+/// The nodes are stored level by level in flat arrays, sorted by the Morton
+/// code of their position in the level. The children of a node and the points
+/// of a subtree are contiguous ranges of the next level and of the sorted point
+/// indices, so the tree is built bottom-up with parallel sorts and scans
+/// instead of inserting points one by one.
+///
+/// The tree has the same structure as an Octree built with
+/// Octree::ConvertFromPointCloud: the leaves are at max_depth_, a leaf has the
+/// color of the last point inserted into it and every node knows the indices
+/// of the points in its subtree. Traverse() and LocateLeafNode() follow the
+/// semantics of their Octree counterparts.
+class LinearOctree {
+public:
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param max_depth Sets the value of the max depth of the octree. At most
+    /// 21, since the node codes are stored in 64 bits.
+    LinearOctree(size_t max_depth = 0);
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param max_depth Sets the value of the max depth of the octree.
+    /// \param origin Sets the global min bound of the octree.
+    /// \param size Sets the outer bounding box edge size for the whole octree.
+    LinearOctree(size_t max_depth,
+                 const Eigen::Vector3d& origin,
+                 double size);
+
+public:
+    /// Removes all nodes. The bounds and max depth are kept.
+    LinearOctree& Clear();
+    /// Returns true if the octree has no nodes.
+    bool IsEmpty() const { return GetNumNodes() == 0; }
+    /// Returns the number of nodes of all depths.
+    size_t GetNumNodes() const;
+    /// Returns the number of nodes at \p depth.
+    size_t GetNumNodes(size_t depth) const;
+
+    /// \brief Builds the octree from a point cloud. The bounds are computed as
+    /// in Octree::ConvertFromPointCloud.
+    ///
+    /// \param point_cloud Input point cloud.
+    /// \param size_expand A small expansion size such that the octree is
+    /// slightly bigger than the original point cloud bounds to accommodate all
+    /// points.
+    void ConvertFromPointCloud(const geometry::PointCloud& point_cloud,
+                               double size_expand = 0.01);
+
+    /// \brief Builds the octree from points within the current bounds. Points
+    /// outside of the bounds are ignored.
+    ///
+    /// \param points Coordinates of the points.
+    /// \param colors Optional colors of the points.
+    void Build(const std::vector<Eigen::Vector3d>& points,
+               const std::vector<Eigen::Vector3d>& colors = {});
+
+    /// \brief DFS traversal of the octree from the root, with callback function
+    /// called for each node in the same order as Octree::Traverse.
+    ///
+    /// \param f Callback which fires with each traversed internal/leaf node.
+    /// If f returns true, children of this node will not be traversed.
+    void Traverse(const std::function<bool(const LinearOctreeNode&,
+                                           const OctreeNodeInfo&)>& f) const;
+
+    /// \brief Returns the leaf node and its OctreeNodeInfo where the query
+    /// point should reside. The node is invalid if there is no such leaf.
+    ///
+    /// \param point Coordinates of the point.
+    std::pair<LinearOctreeNode, OctreeNodeInfo> LocateLeafNode(
+            const Eigen::Vector3d& point) const;
+
+    /// Returns true if \p node is a leaf node.
+    bool IsLeafNode(const LinearOctreeNode& node) const {
+        return node.depth_ == max_depth_;
+    }
+
+    /// Returns the ascending indices of the points in the subtree of \p node.
+    std::vector<size_t> GetPointIndices(const LinearOctreeNode& node) const;
+
+    /// Returns the color of the leaf node \p node.
+    Eigen::Vector3d GetColor(const LinearOctreeNode& node) const;
+
+    /// Converts to an Octree with OctreeInternalPointNode internal nodes and
+    /// OctreePointColorLeafNode leaf nodes.
+    std::shared_ptr<Octree> ToOctree() const;
+
+public:
+    /// Global min bound (include). A point is within bound iff
+    /// origin_ <= point < origin_ + size_.
+    Eigen::Vector3d origin_;
+
+    /// Outer bounding box edge size for the whole octree.
+    double size_;
+
+    /// Max depth of octree. A tree with only the root node has depth 0.
+    size_t max_depth_;
+
+private:
+    void CheckNode(const LinearOctreeNode& node) const;
+
+    void TraverseRecurse(
+            const LinearOctreeNode& node,
+            const OctreeNodeInfo& node_info,
+            const std::function<bool(const LinearOctreeNode&,
+                                     const OctreeNodeInfo&)>& f) const;
+
+    std::shared_ptr<OctreeNode> ToOctreeNode(
+            const LinearOctreeNode& node) const;
+
+    /// Morton code of each node, per depth. The code of a node at depth d has
+    /// 3 * d bits, the lowest 3 bits are the child index in its parent.
+    std::vector<std::vector<uint64_t>> codes_;
+    /// Per depth, node i covers the sorted points
+    /// [point_offsets_[d][i], point_offsets_[d][i + 1]).
+    std::vector<std::vector<int64_t>> point_offsets_;
+    /// Per depth, the children of node i are the nodes
+    /// [child_offsets_[d][i], child_offsets_[d][i + 1]) at depth d + 1.
+    std::vector<std::vector<int64_t>> child_offsets_;
+    /// Point indices sorted by leaf, ascending within each leaf.
+    std::vector<size_t> point_indices_;
+    /// Color of each leaf node.
+    std::vector<Eigen::Vector3d> leaf_colors_;
+};
+
+}  // namespace geometry
+}  // namespace open3d
@@ -75,6 +75,12 @@ public:
     /// \param Smoothed adds a rotation smoothing term to the rotations.
     enum class DeformAsRigidAsPossibleEnergy { Spokes, Smoothed };
 
+    /// Solver of the linear system of the DeformAsRigidAsPossible method.
+    /// \param SparseLDLT is a sparse Cholesky factorization on the CPU.
+    /// \param ConjugateGradient is a Jacobi preconditioned conjugate gradient
+    /// solver on a CPU or CUDA device, started from the previous positions.
+    enum class DeformAsRigidAsPossibleSolver { SparseLDLT, ConjugateGradient };
+
     /// \brief Default Constructor.
     MeshBase() : Geometry3D(Geometry::GeometryType::MeshBase) {}
     ~MeshBase() override {}
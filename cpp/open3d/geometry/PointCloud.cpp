@@ -38,6 +38,7 @@
 #include "open3d/utility/Eigen.h"
 #include "open3d/utility/Logging.h"
 #include "open3d/utility/Parallel.h"
+#include "open3d/utility/ParallelScan.h"
 #include "open3d/utility/ProgressBar.h"
 
 namespace open3d {
@@ -190,31 +191,50 @@ PointCloud &PointCloud::RemoveNonFinitePoints(bool remove_nan,
     return *this;
 }
 
-std::shared_ptr<PointCloud> PointCloud::SelectByIndex(
-        const std::vector<size_t> &indices, bool invert /* = false */) const {
+namespace {
+/// Copies the points at the increasing, unique \p indices and their
+/// attributes into a pre-sized point cloud, in parallel.
+std::shared_ptr<PointCloud> GatherPoints(const PointCloud &cloud,
+                                         const std::vector<size_t> &indices) {
     auto output = std::make_shared<PointCloud>();
-    bool has_normals = HasNormals();
-    bool has_colors = HasColors();
-    bool has_covariance = HasCovariances();
-
-    std::vector<bool> mask = std::vector<bool>(points_.size(), invert);
-    for (size_t i : indices) {
-        mask[i] = !invert;
-    }
-
-    for (size_t i = 0; i < points_.size(); i++) {
-        if (mask[i]) {
-            output->points_.push_back(points_[i]);
-            if (has_normals) output->normals_.push_back(normals_[i]);
-            if (has_colors) output->colors_.push_back(colors_[i]);
-            if (has_covariance) output->covariances_.push_back(covariances_[i]);
-        }
+    const bool has_normals = cloud.HasNormals();
+    const bool has_colors = cloud.HasColors();
+    const bool has_covariance = cloud.HasCovariances();
+
+    const int64_t num_selected = int64_t(indices.size());
+    output->points_.resize(num_selected);
+    if (has_normals) output->normals_.resize(num_selected);
+    if (has_colors) output->colors_.resize(num_selected);
+    if (has_covariance) output->covariances_.resize(num_selected);
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t k = 0; k < num_selected; ++k) {
+        const size_t i = indices[k];
+        output->points_[k] = cloud.points_[i];
+        if (has_normals) output->normals_[k] = cloud.normals_[i];
+        if (has_colors) output->colors_[k] = cloud.colors_[i];
+        if (has_covariance) output->covariances_[k] = cloud.covariances_[i];
     }
     utility::LogDebug(
             "Pointcloud down sampled from {:d} points to {:d} points.",
-            (int)points_.size(), (int)output->points_.size());
+            (int)cloud.points_.size(), (int)output->points_.size());
     return output;
 }
+}  // namespace
+
+std::shared_ptr<PointCloud> PointCloud::SelectByIndex(
+        const std::vector<size_t> &indices, bool invert /* = false */) const {
+    // A byte mask, unlike std::vector<bool>, can be read concurrently without
+    // unpacking bits. It also removes duplicate indices.
+    std::vector<uint8_t> mask(points_.size(), invert ? 1 : 0);
+    for (size_t i : indices) {
+        mask[i] = invert ? 0 : 1;
+    }
+    return GatherPoints(
+            *this, utility::ParallelSelectIndices<size_t>(
+                           int64_t(points_.size()),
+                           [&mask](int64_t i) { return mask[i] != 0; }));
+}
 
 // helper classes for VoxelDownSample and VoxelDownSampleAndTrace
 namespace {
@@ -520,7 +540,8 @@ std::shared_ptr<PointCloud> PointCloud::Crop(
                 "AxisAlignedBoundingBox either has zeros size, or has wrong "
                 "bounds.");
     }
-    return SelectByIndex(bbox.GetPointIndicesWithinBoundingBox(points_));
+    // The indices are increasing and unique, so no mask is needed.
+    return GatherPoints(*this, bbox.GetPointIndicesWithinBoundingBox(points_));
 }
 std::shared_ptr<PointCloud> PointCloud::Crop(
         const OrientedBoundingBox &bbox) const {
@@ -529,7 +550,7 @@ std::shared_ptr<PointCloud> PointCloud::Crop(
                 "AxisAlignedBoundingBox either has zeros size, or has wrong "
                 "bounds.");
     }
-    return SelectByIndex(bbox.GetPointIndicesWithinBoundingBox(points_));
+    return GatherPoints(*this, bbox.GetPointIndicesWithinBoundingBox(points_));
 }
 
 std::tuple<std::shared_ptr<PointCloud>, std::vector<size_t>>
@@ -41,33 +41,32 @@ namespace geometry {
 std::tuple<std::shared_ptr<TriangleMesh>, std::vector<size_t>>
 Qhull::ComputeConvexHull(const std::vector<Eigen::Vector3d>& points,
                          bool joggle_inputs) {
+    // Eigen::Vector3d is stored as three packed doubles, so the vector already
+    // has the layout qhull expects.
+    static_assert(sizeof(Eigen::Vector3d) == 3 * sizeof(double),
+                  "Eigen::Vector3d is expected to be densely packed.");
+    return ComputeConvexHull(points.empty() ? nullptr : points[0].data(),
+                             points.size(), joggle_inputs);
+}
+
+std::tuple<std::shared_ptr<TriangleMesh>, std::vector<size_t>>
+Qhull::ComputeConvexHull(const double* points,
+                         size_t num_points,
+                         bool joggle_inputs) {
     auto convex_hull = std::make_shared<TriangleMesh>();
     std::vector<size_t> pt_map;
 
-    std::vector<double> qhull_points_data(points.size() * 3);
-    for (size_t pidx = 0; pidx < points.size(); ++pidx) {
-        const auto& pt = points[pidx];
-        qhull_points_data[pidx * 3 + 0] = pt(0);
-        qhull_points_data[pidx * 3 + 1] = pt(1);
-        qhull_points_data[pidx * 3 + 2] = pt(2);
-    }
-
-    orgQhull::PointCoordinates qhull_points(3, "");
-    qhull_points.append(qhull_points_data);
-
     orgQhull::Qhull qhull;
     std::string options = "Qt";
     if (joggle_inputs) {
         options += " QJ";
     }
-    qhull.runQhull(qhull_points.comment().c_str(), qhull_points.dimension(),
-                   qhull_points.count(), qhull_points.coordinates(),
+    qhull.runQhull("", 3, static_cast<int>(num_points), points,
                    options.c_str());
 
     orgQhull::QhullFacetList facets = qhull.facetList();
     convex_hull->triangles_.resize(facets.count());
-    std::unordered_map<int, int> vert_map;
-    std::unordered_set<int> inserted_vertices;
+    std::vector<int> vert_map(num_points, -1);
     int tidx = 0;
     for (orgQhull::QhullFacetList::iterator it = facets.begin();
          it != facets.end(); ++it) {
@@ -85,8 +84,7 @@ Qhull::ComputeConvexHull(const std::vector<Eigen::Vector3d>& points,
             convex_hull->triangles_[tidx](triangle_subscript) = vidx;
             triangle_subscript++;
 
-            if (inserted_vertices.count(vidx) == 0) {
-                inserted_vertices.insert(vidx);
+            if (vert_map[vidx] < 0) {
                 vert_map[vidx] = int(convex_hull->vertices_.size());
                 double* coords = p.coordinates();
                 convex_hull->vertices_.push_back(
@@ -97,6 +95,7 @@ Qhull::ComputeConvexHull(const std::vector<Eigen::Vector3d>& points,
 
         tidx++;
     }
+    convex_hull->triangles_.resize(tidx);
 
     auto center = convex_hull->GetCenter();
     for (Eigen::Vector3i& triangle : convex_hull->triangles_) {
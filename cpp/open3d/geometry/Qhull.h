@@ -49,6 +49,20 @@ public:
     ComputeConvexHull(const std::vector<Eigen::Vector3d>& points,
                       bool joggle_inputs = false);
 
+    /// Computes the convex hull of points stored as consecutive xyz triplets.
+    /// The buffer is handed to qhull directly, without being copied.
+    /// \param points Pointer to 3 * \p num_points coordinates.
+    /// \param num_points Number of input points.
+    /// \param joggle_inputs If true allows the algorithm to add random noise
+    ///        to the points to work around degenerate inputs. This adds the
+    ///        'QJ' option to the qhull command.
+    /// \returns The triangle mesh of the convex hull and the list of point
+    ///          indices that are part of the convex hull.
+    static std::tuple<std::shared_ptr<TriangleMesh>, std::vector<size_t>>
+    ComputeConvexHull(const double* points,
+                      size_t num_points,
+                      bool joggle_inputs = false);
+
     static std::tuple<std::shared_ptr<TetraMesh>, std::vector<size_t>>
     ComputeDelaunayTetrahedralization(
             const std::vector<Eigen::Vector3d>& points);
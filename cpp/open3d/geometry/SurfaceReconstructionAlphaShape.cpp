@@ -24,66 +24,55 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <tbb/parallel_sort.h>
+
 #include <Eigen/Dense>
-#include <iostream>
-#include <list>
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <tuple>
 
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/geometry/Qhull.h"
 #include "open3d/geometry/TetraMesh.h"
 #include "open3d/geometry/TriangleMesh.h"
 #include "open3d/utility/Logging.h"
+#include "open3d/utility/Parallel.h"
 
 namespace open3d {
 namespace geometry {
 
-std::shared_ptr<TriangleMesh> TriangleMesh::CreateFromPointCloudAlphaShape(
-        const PointCloud& pcd,
-        double alpha,
-        std::shared_ptr<TetraMesh> tetra_mesh,
-        std::vector<size_t>* pt_map) {
-    std::vector<size_t> pt_map_computed;
-    if (tetra_mesh == nullptr) {
-        utility::LogDebug(
-                "[CreateFromPointCloudAlphaShape] "
-                "ComputeDelaunayTetrahedralization");
-        std::tie(tetra_mesh, pt_map_computed) =
-                Qhull::ComputeDelaunayTetrahedralization(pcd.points_);
-        pt_map = &pt_map_computed;
-        utility::LogDebug(
-                "[CreateFromPointCloudAlphaShape] done "
-                "ComputeDelaunayTetrahedralization");
-    }
+namespace {
 
-    utility::LogDebug("[CreateFromPointCloudAlphaShape] init triangle mesh");
-    auto mesh = std::make_shared<TriangleMesh>();
-    mesh->vertices_ = tetra_mesh->vertices_;
-    if (pcd.HasNormals()) {
-        mesh->vertex_normals_.resize(mesh->vertices_.size());
-        for (size_t idx = 0; idx < (*pt_map).size(); ++idx) {
-            mesh->vertex_normals_[idx] = pcd.normals_[(*pt_map)[idx]];
-        }
-    }
-    if (pcd.HasColors()) {
-        mesh->vertex_colors_.resize(mesh->vertices_.size());
-        for (size_t idx = 0; idx < (*pt_map).size(); ++idx) {
-            mesh->vertex_colors_[idx] = pcd.colors_[(*pt_map)[idx]];
-        }
-    }
-    utility::LogDebug(
-            "[CreateFromPointCloudAlphaShape] done init triangle mesh");
+/// Per tetra data that does not depend on alpha, so that alpha sweeps only
+/// filter the tetras.
+struct AlphaShapeTetras {
+    /// Circumradius of each tetra, infinity for degenerate tetras.
+    std::vector<double> radii_;
+    /// Ordered triangles of each tetra, 4 per tetra.
+    std::vector<Eigen::Vector3i> faces_;
+    /// Face indices sorted by face and the offsets of the groups of equal
+    /// faces in it.
+    std::vector<int64_t> sorted_faces_;
+    std::vector<int64_t> group_offsets_;
+};
 
-    std::vector<double> vsqn(tetra_mesh->vertices_.size());
+AlphaShapeTetras ComputeAlphaShapeTetras(const TetraMesh& tetra_mesh) {
+    AlphaShapeTetras data;
+    const auto& verts = tetra_mesh.vertices_;
+    const int64_t n_tetras = int64_t(tetra_mesh.tetras_.size());
+    std::vector<double> vsqn(verts.size());
     for (size_t vidx = 0; vidx < vsqn.size(); ++vidx) {
-        vsqn[vidx] = tetra_mesh->vertices_[vidx].squaredNorm();
+        vsqn[vidx] = verts[vidx].squaredNorm();
     }
 
-    utility::LogDebug(
-            "[CreateFromPointCloudAlphaShape] add triangles from tetras that "
-            "satisfy constraint");
-    const auto& verts = tetra_mesh->vertices_;
-    for (size_t tidx = 0; tidx < tetra_mesh->tetras_.size(); ++tidx) {
-        const auto& tetra = tetra_mesh->tetras_[tidx];
+    data.radii_.resize(n_tetras);
+    data.faces_.resize(4 * n_tetras);
+    int64_t n_invalid = 0;
+#pragma omp parallel for schedule(static) reduction(+ : n_invalid) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t tidx = 0; tidx < n_tetras; ++tidx) {
+        const auto& tetra = tetra_mesh.tetras_[tidx];
         // clang-format off
         Eigen::Matrix4d tmp;
         tmp << verts[tetra(0)](0), verts[tetra(0)](1), verts[tetra(0)](2), 1,
@@ -113,67 +102,145 @@ std::shared_ptr<TriangleMesh> TriangleMesh::CreateFromPointCloudAlphaShape(
         double dz = tmp.determinant();
         // clang-format on
         if (a == 0) {
-            utility::LogWarning(
-                    "[CreateFromPointCloudAlphaShape] invalid tetra in "
-                    "TetraMesh");
+            data.radii_[tidx] = std::numeric_limits<double>::infinity();
+            n_invalid++;
         } else {
-            double r = std::sqrt(dx * dx + dy * dy + dz * dz - 4 * a * c) /
-                       (2 * std::abs(a));
-
-            if (r <= alpha) {
-                mesh->triangles_.push_back(TriangleMesh::GetOrderedTriangle(
-                        tetra(0), tetra(1), tetra(2)));
-                mesh->triangles_.push_back(TriangleMesh::GetOrderedTriangle(
-                        tetra(0), tetra(1), tetra(3)));
-                mesh->triangles_.push_back(TriangleMesh::GetOrderedTriangle(
-                        tetra(0), tetra(2), tetra(3)));
-                mesh->triangles_.push_back(TriangleMesh::GetOrderedTriangle(
-                        tetra(1), tetra(2), tetra(3)));
+            data.radii_[tidx] =
+                    std::sqrt(dx * dx + dy * dy + dz * dz - 4 * a * c) /
+                    (2 * std::abs(a));
+        }
+        data.faces_[4 * tidx + 0] = TriangleMesh::GetOrderedTriangle(
+                tetra(0), tetra(1), tetra(2));
+        data.faces_[4 * tidx + 1] = TriangleMesh::GetOrderedTriangle(
+                tetra(0), tetra(1), tetra(3));
+        data.faces_[4 * tidx + 2] = TriangleMesh::GetOrderedTriangle(
+                tetra(0), tetra(2), tetra(3));
+        data.faces_[4 * tidx + 3] = TriangleMesh::GetOrderedTriangle(
+                tetra(1), tetra(2), tetra(3));
+    }
+    if (n_invalid > 0) {
+        utility::LogWarning(
+                "[CreateFromPointCloudAlphaShape] {} invalid tetras in "
+                "TetraMesh",
+                n_invalid);
+    }
+
+    const auto& faces = data.faces_;
+    auto FaceLess = [&](int64_t f0, int64_t f1) {
+        return std::tie(faces[f0](0), faces[f0](1), faces[f0](2), f0) <
+               std::tie(faces[f1](0), faces[f1](1), faces[f1](2), f1);
+    };
+    data.sorted_faces_.resize(faces.size());
+    std::iota(data.sorted_faces_.begin(), data.sorted_faces_.end(), 0);
+    tbb::parallel_sort(data.sorted_faces_.begin(), data.sorted_faces_.end(),
+                       FaceLess);
+    for (size_t idx = 0; idx < data.sorted_faces_.size(); ++idx) {
+        if (idx == 0 || faces[data.sorted_faces_[idx]] !=
+                                faces[data.sorted_faces_[idx - 1]]) {
+            data.group_offsets_.push_back(int64_t(idx));
+        }
+    }
+    data.group_offsets_.push_back(int64_t(data.sorted_faces_.size()));
+    return data;
+}
+
+/// Keeps the tetras with a circumradius of at most \p alpha and adds their
+/// faces that are not shared with another kept tetra to a copy of \p base.
+std::shared_ptr<TriangleMesh> ExtractAlphaShape(const TriangleMesh& base,
+                                                const AlphaShapeTetras& data,
+                                                double alpha) {
+    const int64_t n_faces = int64_t(data.faces_.size());
+    const int64_t n_groups = int64_t(data.group_offsets_.size()) - 1;
+    std::vector<uint8_t> is_boundary(n_faces, 0);
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t gidx = 0; gidx < n_groups; ++gidx) {
+        int64_t n_kept = 0;
+        int64_t kept_face = -1;
+        for (int64_t idx = data.group_offsets_[gidx];
+             idx < data.group_offsets_[gidx + 1]; ++idx) {
+            const int64_t fidx = data.sorted_faces_[idx];
+            if (data.radii_[fidx / 4] <= alpha) {
+                n_kept++;
+                kept_face = fidx;
             }
         }
+        if (n_kept == 1) {
+            is_boundary[kept_face] = 1;
+        }
     }
-    utility::LogDebug(
-            "[CreateFromPointCloudAlphaShape] done add triangles from tetras "
-            "that satisfy constraint");
 
-    utility::LogDebug(
-            "[CreateFromPointCloudAlphaShape] remove triangles within "
-            "the mesh");
-    std::unordered_map<Eigen::Vector3i, int,
-                       utility::hash_eigen<Eigen::Vector3i>>
-            triangle_count;
-    for (size_t tidx = 0; tidx < mesh->triangles_.size(); ++tidx) {
-        Eigen::Vector3i triangle = mesh->triangles_[tidx];
-        if (triangle_count.count(triangle) == 0) {
-            triangle_count[triangle] = 1;
-        } else {
-            triangle_count[triangle] += 1;
+    auto mesh = std::make_shared<TriangleMesh>(base);
+    for (int64_t fidx = 0; fidx < n_faces; ++fidx) {
+        if (is_boundary[fidx]) {
+            mesh->triangles_.push_back(data.faces_[fidx]);
         }
     }
+    mesh->RemoveUnreferencedVertices();
+    return mesh;
+}
+
+}  // namespace
+
+std::vector<std::shared_ptr<TriangleMesh>>
+TriangleMesh::CreateFromPointCloudAlphaShapes(
+        const PointCloud& pcd,
+        const std::vector<double>& alphas,
+        std::shared_ptr<TetraMesh> tetra_mesh,
+        std::vector<size_t>* pt_map) {
+    std::vector<size_t> pt_map_computed;
+    if (tetra_mesh == nullptr) {
+        utility::LogDebug(
+                "[CreateFromPointCloudAlphaShape] "
+                "ComputeDelaunayTetrahedralization");
+        std::tie(tetra_mesh, pt_map_computed) =
+                Qhull::ComputeDelaunayTetrahedralization(pcd.points_);
+        pt_map = &pt_map_computed;
+        utility::LogDebug(
+                "[CreateFromPointCloudAlphaShape] done "
+                "ComputeDelaunayTetrahedralization");
+    }
 
-    size_t to_idx = 0;
-    for (size_t tidx = 0; tidx < mesh->triangles_.size(); ++tidx) {
-        Eigen::Vector3i triangle = mesh->triangles_[tidx];
-        if (triangle_count[triangle] == 1) {
-            mesh->triangles_[to_idx] = triangle;
-            to_idx++;
+    utility::LogDebug("[CreateFromPointCloudAlphaShape] init triangle mesh");
+    TriangleMesh base;
+    base.vertices_ = tetra_mesh->vertices_;
+    if (pcd.HasNormals()) {
+        base.vertex_normals_.resize(base.vertices_.size());
+        for (size_t idx = 0; idx < (*pt_map).size(); ++idx) {
+            base.vertex_normals_[idx] = pcd.normals_[(*pt_map)[idx]];
+        }
+    }
+    if (pcd.HasColors()) {
+        base.vertex_colors_.resize(base.vertices_.size());
+        for (size_t idx = 0; idx < (*pt_map).size(); ++idx) {
+            base.vertex_colors_[idx] = pcd.colors_[(*pt_map)[idx]];
         }
     }
-    mesh->triangles_.resize(to_idx);
     utility::LogDebug(
-            "[CreateFromPointCloudAlphaShape] done remove triangles within "
-            "the mesh");
+            "[CreateFromPointCloudAlphaShape] done init triangle mesh");
 
     utility::LogDebug(
-            "[CreateFromPointCloudAlphaShape] remove duplicate triangles and "
-            "unreferenced vertices");
-    mesh->RemoveDuplicatedTriangles();
-    mesh->RemoveUnreferencedVertices();
+            "[CreateFromPointCloudAlphaShape] compute tetra circumradii and "
+            "faces");
+    const AlphaShapeTetras data = ComputeAlphaShapeTetras(*tetra_mesh);
     utility::LogDebug(
-            "[CreateFromPointCloudAlphaShape] done remove duplicate triangles "
-            "and unreferenced vertices");
+            "[CreateFromPointCloudAlphaShape] done compute tetra circumradii "
+            "and faces");
 
-    return mesh;
+    std::vector<std::shared_ptr<TriangleMesh>> meshes;
+    for (double alpha : alphas) {
+        meshes.push_back(ExtractAlphaShape(base, data, alpha));
+    }
+    return meshes;
+}
+
+std::shared_ptr<TriangleMesh> TriangleMesh::CreateFromPointCloudAlphaShape(
+        const PointCloud& pcd,
+        double alpha,
+        std::shared_ptr<TetraMesh> tetra_mesh,
+        std::vector<size_t>* pt_map) {
+    return CreateFromPointCloudAlphaShapes(pcd, {alpha}, tetra_mesh, pt_map)
+            .front();
 }
 
 }  // namespace geometry
@@ -25,6 +25,7 @@
 // ----------------------------------------------------------------------------
 
 #include <Eigen/Dense>
+#include <algorithm>
 #include <iostream>
 #include <list>
 
@@ -33,6 +34,7 @@
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/geometry/TriangleMesh.h"
 #include "open3d/utility/Logging.h"
+#include "open3d/utility/Parallel.h"
 
 namespace open3d {
 namespace geometry {
@@ -159,6 +161,24 @@ BallPivotingVertexPtr BallPivotingEdge::GetOppositeVertex() {
     }
 }
 
+/// State of one advancing front. A front with a non-negative region only
+/// creates triangles between vertices owned by that region, so fronts of
+/// different regions can be expanded concurrently. Work that would cross into
+/// another region is deferred and resumed by the serial front (region -1).
+struct BallPivotingFront {
+    explicit BallPivotingFront(int region = -1) : region_(region) {}
+
+    int region_;
+    std::list<BallPivotingEdgePtr> edge_front_;
+    std::list<BallPivotingEdgePtr> border_edges_;
+    /// Front edges whose best pivot candidate is owned by another region.
+    std::vector<BallPivotingEdgePtr> deferred_edges_;
+    /// Seed vertices whose neighborhood reaches into another region.
+    std::vector<int> deferred_seeds_;
+    std::vector<Eigen::Vector3i> triangles_;
+    std::vector<Eigen::Vector3d> triangle_normals_;
+};
+
 class BallPivoting {
 public:
     BallPivoting(const PointCloud& pcd)
@@ -246,7 +266,13 @@ public:
         return nullptr;
     }
 
-    void CreateTriangle(const BallPivotingVertexPtr& v0,
+    bool IsOwned(const BallPivotingFront& front,
+                 const BallPivotingVertexPtr& v) const {
+        return front.region_ < 0 || region_[v->idx_] == front.region_;
+    }
+
+    void CreateTriangle(BallPivotingFront& front,
+                        const BallPivotingVertexPtr& v0,
                         const BallPivotingVertexPtr& v1,
                         const BallPivotingVertexPtr& v2,
                         const Eigen::Vector3d& center) {
@@ -287,13 +313,13 @@ public:
         Eigen::Vector3d face_normal =
                 ComputeFaceNormal(v0->point_, v1->point_, v2->point_);
         if (face_normal.dot(v0->normal_) > -1e-16) {
-            mesh_->triangles_.emplace_back(
+            front.triangles_.emplace_back(
                     Eigen::Vector3i(v0->idx_, v1->idx_, v2->idx_));
         } else {
-            mesh_->triangles_.emplace_back(
+            front.triangles_.emplace_back(
                     Eigen::Vector3i(v0->idx_, v2->idx_, v1->idx_));
         }
-        mesh_->triangle_normals_.push_back(face_normal);
+        front.triangle_normals_.push_back(face_normal);
     }
 
     Eigen::Vector3d ComputeFaceNormal(const Eigen::Vector3d& v0,
@@ -324,10 +350,14 @@ public:
         return ret;
     }
 
+    /// Returns the vertex the ball hits first when pivoting around \p edge.
+    /// \p deferred is set if that vertex is not owned by \p front.
     BallPivotingVertexPtr FindCandidateVertex(
+            const BallPivotingFront& front,
             const BallPivotingEdgePtr& edge,
             double radius,
-            Eigen::Vector3d& candidate_center) {
+            Eigen::Vector3d& candidate_center,
+            bool& deferred) {
         utility::LogDebug("[FindCandidateVertex] edge=({}, {}), radius={}",
                           edge->source_->idx_, edge->target_->idx_, radius);
         BallPivotingVertexPtr src = edge->source_;
@@ -468,6 +498,7 @@ public:
             }
         }
 
+        deferred = min_candidate != nullptr && !IsOwned(front, min_candidate);
         if (min_candidate == nullptr) {
             utility::LogDebug("[FindCandidateVertex] returns nullptr");
         } else {
@@ -477,23 +508,28 @@ public:
         return min_candidate;
     }
 
-    void ExpandTriangulation(double radius) {
+    void ExpandTriangulation(BallPivotingFront& front, double radius) {
         utility::LogDebug("[ExpandTriangulation] radius={}", radius);
-        while (!edge_front_.empty()) {
-            BallPivotingEdgePtr edge = edge_front_.front();
-            edge_front_.pop_front();
+        while (!front.edge_front_.empty()) {
+            BallPivotingEdgePtr edge = front.edge_front_.front();
+            front.edge_front_.pop_front();
             if (edge->type_ != BallPivotingEdge::Front) {
                 continue;
             }
 
             Eigen::Vector3d center;
+            bool deferred = false;
             BallPivotingVertexPtr candidate =
-                    FindCandidateVertex(edge, radius, center);
+                    FindCandidateVertex(front, edge, radius, center, deferred);
+            if (deferred) {
+                front.deferred_edges_.push_back(edge);
+                continue;
+            }
             if (candidate == nullptr ||
                 candidate->type_ == BallPivotingVertex::Type::Inner ||
                 !IsCompatible(candidate, edge->source_, edge->target_)) {
                 edge->type_ = BallPivotingEdge::Type::Border;
-                border_edges_.push_back(edge);
+                front.border_edges_.push_back(edge);
                 continue;
             }
 
@@ -502,19 +538,20 @@ public:
             if ((e0 != nullptr && e0->type_ != BallPivotingEdge::Type::Front) ||
                 (e1 != nullptr && e1->type_ != BallPivotingEdge::Type::Front)) {
                 edge->type_ = BallPivotingEdge::Type::Border;
-                border_edges_.push_back(edge);
+                front.border_edges_.push_back(edge);
                 continue;
             }
 
-            CreateTriangle(edge->source_, edge->target_, candidate, center);
+            CreateTriangle(front, edge->source_, edge->target_, candidate,
+                           center);
 
             e0 = GetLinkingEdge(candidate, edge->source_);
             e1 = GetLinkingEdge(candidate, edge->target_);
             if (e0->type_ == BallPivotingEdge::Type::Front) {
-                edge_front_.push_front(e0);
+                front.edge_front_.push_front(e0);
             }
             if (e1->type_ == BallPivotingEdge::Type::Front) {
-                edge_front_.push_front(e1);
+                front.edge_front_.push_front(e1);
             }
         }
     }
@@ -577,7 +614,9 @@ public:
         return true;
     }
 
-    bool TrySeed(BallPivotingVertexPtr& v, double radius) {
+    bool TrySeed(BallPivotingFront& front,
+                 BallPivotingVertexPtr& v,
+                 double radius) {
         utility::LogDebug("[TrySeed] with v.idx={}, radius={}", v->idx_,
                           radius);
         std::vector<int> indices;
@@ -586,6 +625,12 @@ public:
         if (indices.size() < 3u) {
             return false;
         }
+        for (int nbidx : indices) {
+            if (!IsOwned(front, vertices[nbidx])) {
+                front.deferred_seeds_.push_back(v->idx_);
+                return false;
+            }
+        }
 
         for (size_t nbidx0 = 0; nbidx0 < indices.size(); ++nbidx0) {
             const BallPivotingVertexPtr& nb0 = vertices[indices[nbidx0]];
@@ -632,22 +677,22 @@ public:
                     continue;
                 }
 
-                CreateTriangle(v, nb0, nb1, center);
+                CreateTriangle(front, v, nb0, nb1, center);
 
                 e0 = GetLinkingEdge(v, nb1);
                 e1 = GetLinkingEdge(nb0, nb1);
                 e2 = GetLinkingEdge(v, nb0);
                 if (e0->type_ == BallPivotingEdge::Type::Front) {
-                    edge_front_.push_front(e0);
+                    front.edge_front_.push_front(e0);
                 }
                 if (e1->type_ == BallPivotingEdge::Type::Front) {
-                    edge_front_.push_front(e1);
+                    front.edge_front_.push_front(e1);
                 }
                 if (e2->type_ == BallPivotingEdge::Type::Front) {
-                    edge_front_.push_front(e2);
+                    front.edge_front_.push_front(e2);
                 }
 
-                if (edge_front_.size() > 0) {
+                if (front.edge_front_.size() > 0) {
                     utility::LogDebug(
                             "[TrySeed] edge_front_.size() > 0 => return "
                             "true");
@@ -660,96 +705,207 @@ public:
         return false;
     }
 
-    void FindSeedTriangle(double radius) {
-        for (size_t vidx = 0; vidx < vertices.size(); ++vidx) {
+    void FindSeedTriangle(BallPivotingFront& front, double radius) {
+        for (int vidx : region_vertices_[front.region_]) {
             utility::LogDebug("[FindSeedTriangle] with radius={}, vidx={}",
                               radius, vidx);
             if (vertices[vidx]->type_ == BallPivotingVertex::Type::Orphan) {
-                if (TrySeed(vertices[vidx], radius)) {
-                    ExpandTriangulation(radius);
+                if (TrySeed(front, vertices[vidx], radius)) {
+                    ExpandTriangulation(front, radius);
+                }
+            }
+        }
+    }
+
+    /// Moves the border edges of \p front whose triangle admits an empty
+    /// ball of the new \p radius back to the edge front.
+    void UpdateBorderEdges(BallPivotingFront& front, double radius) {
+        auto& border_edges = front.border_edges_;
+        for (auto it = border_edges.begin(); it != border_edges.end();) {
+            BallPivotingEdgePtr edge = *it;
+            BallPivotingTrianglePtr triangle = edge->triangle0_;
+            utility::LogDebug(
+                    "[Run] try edge {:d}-{:d} of triangle {:d}-{:d}-{:d}",
+                    edge->source_->idx_, edge->target_->idx_,
+                    triangle->vert0_->idx_, triangle->vert1_->idx_,
+                    triangle->vert2_->idx_);
+
+            Eigen::Vector3d center;
+            if (ComputeBallCenter(triangle->vert0_->idx_,
+                                  triangle->vert1_->idx_,
+                                  triangle->vert2_->idx_, radius, center)) {
+                utility::LogDebug("[Run]   yes, we can work on this");
+                std::vector<int> indices;
+                std::vector<double> dists2;
+                kdtree_.SearchRadius(center, radius, indices, dists2);
+                bool empty_ball = true;
+                for (auto idx : indices) {
+                    if (idx != triangle->vert0_->idx_ &&
+                        idx != triangle->vert1_->idx_ &&
+                        idx != triangle->vert2_->idx_) {
+                        utility::LogDebug(
+                                "[Run]   but no, the ball is not empty");
+                        empty_ball = false;
+                        break;
+                    }
                 }
+
+                if (empty_ball) {
+                    utility::LogDebug(
+                            "[Run]   yeah, add edge to edge_front_: {:d}",
+                            front.edge_front_.size());
+                    edge->type_ = BallPivotingEdge::Type::Front;
+                    front.edge_front_.push_back(edge);
+                    it = border_edges.erase(it);
+                    continue;
+                }
+            }
+            ++it;
+        }
+    }
+
+    /// Splits the vertices into slabs of equal point count along the longest
+    /// axis of the bounding box, one per thread. Slabs are only created if
+    /// they hold enough points and are wide compared to the largest ball, as
+    /// otherwise most of the work ends up on the serial region boundaries.
+    void PartitionRegions(const std::vector<double>& radii) {
+        const int kMinPointsPerRegion = 50000;
+        const double kMinRegionWidth = 16.0;
+
+        const int num_points = static_cast<int>(vertices.size());
+        int num_regions = std::min(utility::EstimateMaxThreads(),
+                                   num_points / kMinPointsPerRegion);
+        int axis = 0;
+        if (num_regions > 1 && !radii.empty()) {
+            const Eigen::Vector3d extent =
+                    mesh_->GetMaxBound() - mesh_->GetMinBound();
+            extent.maxCoeff(&axis);
+            const double max_radius =
+                    *std::max_element(radii.begin(), radii.end());
+            num_regions = std::min(
+                    num_regions,
+                    static_cast<int>(extent(axis) /
+                                     (kMinRegionWidth * max_radius)));
+        }
+        num_regions = std::max(num_regions, 1);
+
+        region_.assign(num_points, 0);
+        if (num_regions > 1) {
+            std::vector<double> coords(num_points);
+            for (int vidx = 0; vidx < num_points; ++vidx) {
+                coords[vidx] = vertices[vidx]->point_(axis);
+            }
+            std::vector<double> sorted_coords = coords;
+            std::sort(sorted_coords.begin(), sorted_coords.end());
+            std::vector<double> splits(num_regions - 1);
+            for (int ridx = 1; ridx < num_regions; ++ridx) {
+                splits[ridx - 1] = sorted_coords[static_cast<size_t>(ridx) *
+                                                 num_points / num_regions];
+            }
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+            for (int vidx = 0; vidx < num_points; ++vidx) {
+                region_[vidx] = static_cast<int>(
+                        std::upper_bound(splits.begin(), splits.end(),
+                                         coords[vidx]) -
+                        splits.begin());
             }
         }
+
+        region_vertices_.assign(num_regions, std::vector<int>());
+        for (int vidx = 0; vidx < num_points; ++vidx) {
+            region_vertices_[region_[vidx]].push_back(vidx);
+        }
+        utility::LogDebug("[Run] reconstructing in {:d} regions", num_regions);
     }
 
     std::shared_ptr<TriangleMesh> Run(const std::vector<double>& radii) {
         if (!has_normals_) {
             utility::LogError("ReconstructBallPivoting requires normals");
         }
-
-        mesh_->triangles_.clear();
-
         for (double radius : radii) {
-            utility::LogDebug("[Run] ################################");
-            utility::LogDebug("[Run] change to radius {:.4f}", radius);
             if (radius <= 0) {
                 utility::LogError(
                         "got an invalid, negative radius as parameter");
             }
+        }
 
-            // update radius => update border edges
-            for (auto it = border_edges_.begin(); it != border_edges_.end();) {
-                BallPivotingEdgePtr edge = *it;
-                BallPivotingTrianglePtr triangle = edge->triangle0_;
-                utility::LogDebug(
-                        "[Run] try edge {:d}-{:d} of triangle {:d}-{:d}-{:d}",
-                        edge->source_->idx_, edge->target_->idx_,
-                        triangle->vert0_->idx_, triangle->vert1_->idx_,
-                        triangle->vert2_->idx_);
-
-                Eigen::Vector3d center;
-                if (ComputeBallCenter(triangle->vert0_->idx_,
-                                      triangle->vert1_->idx_,
-                                      triangle->vert2_->idx_, radius, center)) {
-                    utility::LogDebug("[Run]   yes, we can work on this");
-                    std::vector<int> indices;
-                    std::vector<double> dists2;
-                    kdtree_.SearchRadius(center, radius, indices, dists2);
-                    bool empty_ball = true;
-                    for (auto idx : indices) {
-                        if (idx != triangle->vert0_->idx_ &&
-                            idx != triangle->vert1_->idx_ &&
-                            idx != triangle->vert2_->idx_) {
-                            utility::LogDebug(
-                                    "[Run]   but no, the ball is not empty");
-                            empty_ball = false;
-                            break;
-                        }
-                    }
+        mesh_->triangles_.clear();
+        PartitionRegions(radii);
+
+        // Every region owns a front that only touches its own vertices, so the
+        // regions are reconstructed in parallel. Edges and seeds that reach
+        // across a region boundary are then finished by a serial front.
+        const int num_regions = static_cast<int>(region_vertices_.size());
+        std::vector<BallPivotingFront> fronts;
+        for (int ridx = 0; ridx < num_regions; ++ridx) {
+            fronts.emplace_back(ridx);
+        }
+        BallPivotingFront boundary_front;
 
-                    if (empty_ball) {
-                        utility::LogDebug(
-                                "[Run]   yeah, add edge to edge_front_: {:d}",
-                                edge_front_.size());
-                        edge->type_ = BallPivotingEdge::Type::Front;
-                        edge_front_.push_back(edge);
-                        it = border_edges_.erase(it);
-                        continue;
-                    }
+        for (double radius : radii) {
+            utility::LogDebug("[Run] ################################");
+            utility::LogDebug("[Run] change to radius {:.4f}", radius);
+
+#pragma omp parallel for schedule(dynamic) \
+        num_threads(utility::EstimateMaxThreads())
+            for (int ridx = 0; ridx < num_regions; ++ridx) {
+                BallPivotingFront& front = fronts[ridx];
+                // update radius => update border edges
+                UpdateBorderEdges(front, radius);
+                // do the reconstruction
+                if (front.edge_front_.empty()) {
+                    FindSeedTriangle(front, radius);
+                } else {
+                    ExpandTriangulation(front, radius);
                 }
-                ++it;
             }
 
-            // do the reconstruction
-            if (edge_front_.empty()) {
-                FindSeedTriangle(radius);
-            } else {
-                ExpandTriangulation(radius);
+            // Merge the regions along their boundaries.
+            UpdateBorderEdges(boundary_front, radius);
+            std::vector<int> seeds;
+            for (BallPivotingFront& front : fronts) {
+                auto& edge_front = boundary_front.edge_front_;
+                edge_front.insert(edge_front.end(),
+                                  front.deferred_edges_.begin(),
+                                  front.deferred_edges_.end());
+                seeds.insert(seeds.end(), front.deferred_seeds_.begin(),
+                             front.deferred_seeds_.end());
+                front.deferred_edges_.clear();
+                front.deferred_seeds_.clear();
+            }
+            ExpandTriangulation(boundary_front, radius);
+            std::sort(seeds.begin(), seeds.end());
+            for (int vidx : seeds) {
+                if (vertices[vidx]->type_ == BallPivotingVertex::Type::Orphan &&
+                    TrySeed(boundary_front, vertices[vidx], radius)) {
+                    ExpandTriangulation(boundary_front, radius);
+                }
             }
-
-            utility::LogDebug("[Run] mesh_ has {:d} triangles",
-                              mesh_->triangles_.size());
             utility::LogDebug("[Run] ################################");
         }
+
+        fronts.push_back(std::move(boundary_front));
+        for (const BallPivotingFront& front : fronts) {
+            mesh_->triangles_.insert(mesh_->triangles_.end(),
+                                     front.triangles_.begin(),
+                                     front.triangles_.end());
+            mesh_->triangle_normals_.insert(mesh_->triangle_normals_.end(),
+                                            front.triangle_normals_.begin(),
+                                            front.triangle_normals_.end());
+        }
+        utility::LogDebug("[Run] mesh_ has {:d} triangles",
+                          mesh_->triangles_.size());
         return mesh_;
     }
 
 private:
     bool has_normals_;
     KDTreeFlann kdtree_;
-    std::list<BallPivotingEdgePtr> edge_front_;
-    std::list<BallPivotingEdgePtr> border_edges_;
     std::vector<BallPivotingVertexPtr> vertices;
+    /// Region owning each vertex and the vertices of each region.
+    std::vector<int> region_;
+    std::vector<std::vector<int>> region_vertices_;
     std::shared_ptr<TriangleMesh> mesh_;
 };
 
@@ -34,6 +34,7 @@
 
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/geometry/TriangleMesh.h"
+#include "open3d/utility/Cancellation.h"
 #include "open3d/utility/Logging.h"
 
 // clang-format off
@@ -386,8 +387,14 @@ void ExtractMesh(
     }
 
     mesh->resetIterator();
+    const size_t n_vertices = mesh->outOfCorePointCount();
+    out_mesh->vertices_.reserve(n_vertices);
+    out_mesh->vertex_normals_.reserve(n_vertices);
+    out_mesh->vertex_colors_.reserve(n_vertices);
+    out_mesh->triangles_.reserve(mesh->polygonCount());
     out_densities.clear();
-    for (size_t vidx = 0; vidx < mesh->outOfCorePointCount(); ++vidx) {
+    out_densities.reserve(n_vertices);
+    for (size_t vidx = 0; vidx < n_vertices; ++vidx) {
         Vertex v;
         mesh->nextOutOfCorePoint(v);
         v.point = iXForm * v.point;
@@ -411,14 +418,22 @@ void ExtractMesh(
     delete mesh;
 }
 
+/// Returns false without extracting a mesh if solving the system would exceed
+/// \p memory_budget_mb. \p depth is set to the depth actually used.
 template <class Real, typename... SampleData, unsigned int... FEMSigs>
-void Execute(const open3d::geometry::PointCloud& pcd,
+bool Execute(const open3d::geometry::PointCloud& pcd,
              std::shared_ptr<open3d::geometry::TriangleMesh>& out_mesh,
              std::vector<double>& out_densities,
-             int depth,
+             int& depth,
              float width,
              float scale,
              bool linear_fit,
+             int full_depth,
+             int iters,
+             float samples_per_node,
+             float point_weight,
+             float cg_solver_accuracy,
+             double memory_budget_mb,
              UIntPack<FEMSigs...>) {
     static const int Dim = sizeof...(FEMSigs);
     typedef UIntPack<FEMSigs...> Sigs;
@@ -440,12 +455,7 @@ void Execute(const open3d::geometry::PointCloud& pcd,
     int base_depth = 0;
     int base_v_cycles = 1;
     float confidence = 0.f;
-    float point_weight = 2.f * DEFAULT_FEM_DEGREE;
     float confidence_bias = 0.f;
-    float samples_per_node = 1.5f;
-    float cg_solver_accuracy = 1e-3f;
-    int full_depth = 5;
-    int iters = 8;
     bool exact_interpolation = false;
 
     double startTime = Time();
@@ -461,8 +471,22 @@ void Execute(const open3d::geometry::PointCloud& pcd,
     std::vector<Open3DData> sampleData;
     DensityEstimator* density = NULL;
     SparseNodeData<Point<Real, Dim>, NormalSigs>* normalInfo = NULL;
+    InterpolationInfo* iInfo = NULL;
     Real targetValue = (Real)0.5;
 
+    // Reports the progress after each stage and stops if cancelled.
+    const utility::OperationContext context =
+            utility::OperationContext::Current();
+    auto checkpoint = [&](double percent) {
+        if (context.IsCancelled()) {
+            delete iInfo, iInfo = NULL;
+            delete normalInfo, normalInfo = NULL;
+            delete density, density = NULL;
+            context.ThrowIfCancelled("CreateFromPointCloudPoisson");
+        }
+        context.ReportProgress(percent);
+    };
+
     // Read in the samples (and color data)
     {
         Open3DPointStream<Real> pointStream(&pcd);
@@ -513,16 +537,19 @@ void Execute(const open3d::geometry::PointCloud& pcd,
         utility::LogDebug("Input Points / Samples: {} / {}", pointCount,
                           samples.size());
     }
+    checkpoint(5.0);
 
     int kernelDepth = depth - 2;
     if (kernelDepth < 0) {
         utility::LogError("depth (={}) has to be >= 2", depth);
     }
+    if (full_depth > depth) {
+        full_depth = depth;
+    }
 
     DenseNodeData<Real, Sigs> solution;
     {
         DenseNodeData<Real, Sigs> constraints;
-        InterpolationInfo* iInfo = NULL;
         int solveDepth = depth;
 
         tree.resetNodeIndices();
@@ -534,6 +561,7 @@ void Execute(const open3d::geometry::PointCloud& pcd,
                     samples, kernelDepth, samples_per_node, 1);
             profiler.dumpOutput("#   Got kernel density:");
         }
+        checkpoint(10.0);
 
         // Transform the Hermite samples into a vector field
         {
@@ -587,6 +615,7 @@ void Execute(const open3d::geometry::PointCloud& pcd,
             utility::LogDebug("Point weight / Estimated Area: {:e} / {:e}",
                               pointWeightSum, pointCount * pointWeightSum);
         }
+        checkpoint(20.0);
 
         // Trim the tree and prepare for multigrid
         {
@@ -601,6 +630,25 @@ void Execute(const open3d::geometry::PointCloud& pcd,
                     normalInfo, density);
             profiler.dumpOutput("#       Finalized tree:");
         }
+        checkpoint(30.0);
+
+        // The constraints, the solution and the solver residuals are dense
+        // over the nodes of the finalized tree, so the memory needed by the
+        // solve is known before allocating it.
+        if (memory_budget_mb > 0) {
+            const double required_mb =
+                    (double(MemoryInfo::Usage()) +
+                     3.0 * double(tree.nodes()) * sizeof(Real)) /
+                    (1 << 20);
+            if (required_mb > memory_budget_mb) {
+                utility::LogDebug(
+                        "Depth {} needs about {:.1f} MB, budget is {:.1f} MB.",
+                        depth, required_mb, memory_budget_mb);
+                delete normalInfo, normalInfo = NULL;
+                delete density, density = NULL;
+                return false;
+            }
+        }
 
         // Add the FEM constraints
         {
@@ -629,6 +677,7 @@ void Execute(const open3d::geometry::PointCloud& pcd,
 
         // Free up the normal info
         delete normalInfo, normalInfo = NULL;
+        checkpoint(40.0);
 
         // Add the interpolation constraints
         if (point_weight > 0) {
@@ -658,6 +707,7 @@ void Execute(const open3d::geometry::PointCloud& pcd,
             tree.addInterpolationConstraints(constraints, solveDepth, *iInfo);
             profiler.dumpOutput("#Set point constraints:");
         }
+        checkpoint(50.0);
 
         utility::LogDebug(
                 "Leaf Nodes / Active Nodes / Ghost Nodes: {} / {} / {}",
@@ -687,6 +737,7 @@ void Execute(const open3d::geometry::PointCloud& pcd,
             if (iInfo) delete iInfo, iInfo = NULL;
         }
     }
+    checkpoint(80.0);
 
     {
         profiler.start();
@@ -714,6 +765,7 @@ void Execute(const open3d::geometry::PointCloud& pcd,
         utility::LogDebug("Iso-Value: {:e} = {:e} / {:e}", isoValue, valueSum,
                           weightSum);
     }
+    checkpoint(85.0);
 
     auto SetVertex = [](Open3DVertex<Real>& v, Point<Real, Dim> p, Real w,
                         Open3DData d) {
@@ -728,8 +780,10 @@ void Execute(const open3d::geometry::PointCloud& pcd,
             &sampleData, density, SetVertex, iXForm, out_mesh, out_densities);
 
     if (density) delete density, density = NULL;
+    context.ReportProgress(100.0);
     utility::LogDebug("#          Total Solve: {:9.1f} (s), {:9.1f} (MB)",
                       Time() - startTime, FEMTree<Dim, Real>::MaxMemoryUsage());
+    return true;
 }
 
 }  // namespace poisson
@@ -740,7 +794,13 @@ TriangleMesh::CreateFromPointCloudPoisson(const PointCloud& pcd,
                                           float width,
                                           float scale,
                                           bool linear_fit,
-                                          int n_threads) {
+                                          int n_threads,
+                                          size_t full_depth,
+                                          size_t iterations,
+                                          float samples_per_node,
+                                          float point_weight,
+                                          float cg_accuracy,
+                                          double memory_budget_mb) {
     static const BoundaryType BType = poisson::DEFAULT_FEM_BOUNDARY;
     typedef IsotropicUIntPack<
             poisson::DIMENSION,
@@ -765,12 +825,39 @@ TriangleMesh::CreateFromPointCloudPoisson(const PointCloud& pcd,
 
     auto mesh = std::make_shared<TriangleMesh>();
     std::vector<double> densities;
-    poisson::Execute<float>(pcd, mesh, densities, static_cast<int>(depth),
-                            width, scale, linear_fit, FEMSigs());
+    int solve_depth = static_cast<int>(depth);
+    auto execute = [&]() {
+        try {
+            return poisson::Execute<float>(
+                    pcd, mesh, densities, solve_depth, width, scale,
+                    linear_fit, static_cast<int>(full_depth),
+                    static_cast<int>(iterations), samples_per_node,
+                    point_weight, cg_accuracy, memory_budget_mb, FEMSigs());
+        } catch (const utility::CancelledError&) {
+            ThreadPool::Terminate();
+            throw;
+        }
+    };
+    while (!execute()) {
+        if (solve_depth <= 2) {
+            ThreadPool::Terminate();
+            utility::LogError(
+                    "Poisson reconstruction does not fit into the memory "
+                    "budget of {} MB.",
+                    memory_budget_mb);
+        }
+        utility::LogWarning(
+                "Poisson reconstruction at depth {} exceeds the memory budget "
+                "of {} MB, retrying at depth {}.",
+                solve_depth, memory_budget_mb, solve_depth - 1);
+        // The depth is given explicitly from now on.
+        solve_depth--;
+        width = 0.0f;
+    }
 
     ThreadPool::Terminate();
 
-    return std::make_tuple(mesh, densities);
+    return std::make_tuple(std::move(mesh), std::move(densities));
 }
 
 }  // namespace geometry
@@ -159,15 +159,17 @@ TriangleMesh &TriangleMesh::ComputeVertexNormals(bool normalized /* = true*/) {
 }
 
 TriangleMesh &TriangleMesh::ComputeAdjacencyList() {
+    const auto edge_index = GetEdgeIndex();
+    const auto &offsets = edge_index->vertex_offsets_;
+    const auto &neighbors = edge_index->vertex_neighbors_;
     adjacency_list_.clear();
     adjacency_list_.resize(vertices_.size());
-    for (const auto &triangle : triangles_) {
-        adjacency_list_[triangle(0)].insert(triangle(1));
-        adjacency_list_[triangle(0)].insert(triangle(2));
-        adjacency_list_[triangle(1)].insert(triangle(0));
-        adjacency_list_[triangle(1)].insert(triangle(2));
-        adjacency_list_[triangle(2)].insert(triangle(0));
-        adjacency_list_[triangle(2)].insert(triangle(1));
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int vidx = 0; vidx < int(vertices_.size()); ++vidx) {
+        adjacency_list_[vidx].reserve(offsets[vidx + 1] - offsets[vidx]);
+        adjacency_list_[vidx].insert(neighbors.begin() + offsets[vidx],
+                                     neighbors.begin() + offsets[vidx + 1]);
     }
     return *this;
 }
@@ -867,10 +869,14 @@ TriangleMesh &TriangleMesh::RemoveNonManifoldEdges() {
     bool mesh_is_edge_manifold = false;
     while (!mesh_is_edge_manifold) {
         mesh_is_edge_manifold = true;
-        auto edges_to_triangles = GetEdgeToTrianglesMap();
-
-        for (auto &kv : edges_to_triangles) {
-            size_t n_edge_triangle_refs = kv.second.size();
+        const auto edge_index = GetEdgeIndex();
+
+        for (size_t eidx = 0; eidx < edge_index->NumEdges(); ++eidx) {
+            const auto begin = edge_index->edge_triangles_.begin() +
+                               edge_index->edge_offsets_[eidx];
+            const auto end = edge_index->edge_triangles_.begin() +
+                             edge_index->edge_offsets_[eidx + 1];
+            size_t n_edge_triangle_refs = end - begin;
             // check if the given edge is manifold
             // (has exactly 1, or 2 adjacent triangles)
             if (n_edge_triangle_refs == 1u || n_edge_triangle_refs == 2u) {
@@ -887,8 +893,8 @@ TriangleMesh &TriangleMesh::RemoveNonManifoldEdges() {
             // is <= 2.
             // 1) count triangles that are not marked deleted
             int n_triangles = 0;
-            for (int tidx : kv.second) {
-                if (triangle_areas[tidx] > 0) {
+            for (auto it = begin; it != end; ++it) {
+                if (triangle_areas[*it] > 0) {
                     n_triangles++;
                 }
             }
@@ -899,7 +905,8 @@ TriangleMesh &TriangleMesh::RemoveNonManifoldEdges() {
                 // find triangle with smallest area
                 int min_tidx = -1;
                 double min_area = std::numeric_limits<double>::max();
-                for (int tidx : kv.second) {
+                for (auto it = begin; it != end; ++it) {
+                    const int tidx = *it;
                     double area = triangle_areas[tidx];
                     if (area > 0 && area < min_area) {
                         min_tidx = tidx;
@@ -1139,17 +1146,17 @@ std::unordered_map<Eigen::Vector2i,
                    std::vector<int>,
                    utility::hash_eigen<Eigen::Vector2i>>
 TriangleMesh::GetEdgeToTrianglesMap() const {
+    const auto edge_index = GetEdgeIndex();
     std::unordered_map<Eigen::Vector2i, std::vector<int>,
                        utility::hash_eigen<Eigen::Vector2i>>
-            trias_per_edge;
-    auto AddEdge = [&](int vidx0, int vidx1, int tidx) {
-        trias_per_edge[GetOrderedEdge(vidx0, vidx1)].push_back(tidx);
-    };
-    for (size_t tidx = 0; tidx < triangles_.size(); ++tidx) {
-        const auto &triangle = triangles_[tidx];
-        AddEdge(triangle(0), triangle(1), int(tidx));
-        AddEdge(triangle(1), triangle(2), int(tidx));
-        AddEdge(triangle(2), triangle(0), int(tidx));
+            trias_per_edge(edge_index->NumEdges());
+    for (size_t eidx = 0; eidx < edge_index->NumEdges(); ++eidx) {
+        trias_per_edge.emplace(
+                edge_index->edges_[eidx],
+                std::vector<int>(edge_index->edge_triangles_.begin() +
+                                         edge_index->edge_offsets_[eidx],
+                                 edge_index->edge_triangles_.begin() +
+                                         edge_index->edge_offsets_[eidx + 1]));
     }
     return trias_per_edge;
 }
@@ -1158,19 +1165,24 @@ std::unordered_map<Eigen::Vector2i,
                    std::vector<int>,
                    utility::hash_eigen<Eigen::Vector2i>>
 TriangleMesh::GetEdgeToVerticesMap() const {
+    const auto edge_index = GetEdgeIndex();
+    const auto &opposite = edge_index->edge_opposite_vertices_;
     std::unordered_map<Eigen::Vector2i, std::vector<int>,
                        utility::hash_eigen<Eigen::Vector2i>>
-            trias_per_edge;
-    auto AddEdge = [&](int vidx0, int vidx1, int vidx2) {
-        trias_per_edge[GetOrderedEdge(vidx0, vidx1)].push_back(vidx2);
-    };
-    for (size_t tidx = 0; tidx < triangles_.size(); ++tidx) {
-        const auto &triangle = triangles_[tidx];
-        AddEdge(triangle(0), triangle(1), triangle(2));
-        AddEdge(triangle(1), triangle(2), triangle(0));
-        AddEdge(triangle(2), triangle(0), triangle(1));
-    }
-    return trias_per_edge;
+            verts_per_edge(edge_index->NumEdges());
+    const auto &offsets = edge_index->edge_offsets_;
+    for (size_t eidx = 0; eidx < edge_index->NumEdges(); ++eidx) {
+        verts_per_edge.emplace(
+                edge_index->edges_[eidx],
+                std::vector<int>(opposite.begin() + offsets[eidx],
+                                 opposite.begin() + offsets[eidx + 1]));
+    }
+    return verts_per_edge;
+}
+
+std::shared_ptr<const TriangleMeshEdgeIndex> TriangleMesh::GetEdgeIndex()
+        const {
+    return edge_index_cache_.Get(triangles_, vertices_.size());
 }
 
 double TriangleMesh::ComputeTriangleArea(const Eigen::Vector3d &p0,
@@ -1268,15 +1280,7 @@ Eigen::Vector4d TriangleMesh::GetTrianglePlane(size_t triangle_idx) const {
 }
 
 int TriangleMesh::EulerPoincareCharacteristic() const {
-    std::unordered_set<Eigen::Vector2i, utility::hash_eigen<Eigen::Vector2i>>
-            edges;
-    for (auto triangle : triangles_) {
-        edges.emplace(GetOrderedEdge(triangle(0), triangle(1)));
-        edges.emplace(GetOrderedEdge(triangle(0), triangle(2)));
-        edges.emplace(GetOrderedEdge(triangle(1), triangle(2)));
-    }
-
-    int E = int(edges.size());
+    int E = int(GetEdgeIndex()->NumEdges());
     int V = int(vertices_.size());
     int F = int(triangles_.size());
     return V + F - E;
@@ -1284,13 +1288,13 @@ int TriangleMesh::EulerPoincareCharacteristic() const {
 
 std::vector<Eigen::Vector2i> TriangleMesh::GetNonManifoldEdges(
         bool allow_boundary_edges /* = true */) const {
-    auto edges = GetEdgeToTrianglesMap();
+    const auto edge_index = GetEdgeIndex();
     std::vector<Eigen::Vector2i> non_manifold_edges;
-    for (auto &kv : edges) {
-        if ((allow_boundary_edges &&
-             (kv.second.size() < 1 || kv.second.size() > 2)) ||
-            (!allow_boundary_edges && kv.second.size() != 2)) {
-            non_manifold_edges.push_back(kv.first);
+    for (size_t eidx = 0; eidx < edge_index->NumEdges(); ++eidx) {
+        const int n_triangles = edge_index->NumEdgeTriangles(int(eidx));
+        if ((allow_boundary_edges && (n_triangles < 1 || n_triangles > 2)) ||
+            (!allow_boundary_edges && n_triangles != 2)) {
+            non_manifold_edges.push_back(edge_index->edges_[eidx]);
         }
     }
     return non_manifold_edges;
@@ -1298,11 +1302,11 @@ std::vector<Eigen::Vector2i> TriangleMesh::GetNonManifoldEdges(
 
 bool TriangleMesh::IsEdgeManifold(
         bool allow_boundary_edges /* = true */) const {
-    auto edges = GetEdgeToTrianglesMap();
-    for (auto &kv : edges) {
-        if ((allow_boundary_edges &&
-             (kv.second.size() < 1 || kv.second.size() > 2)) ||
-            (!allow_boundary_edges && kv.second.size() != 2)) {
+    const auto edge_index = GetEdgeIndex();
+    for (size_t eidx = 0; eidx < edge_index->NumEdges(); ++eidx) {
+        const int n_triangles = edge_index->NumEdgeTriangles(int(eidx));
+        if ((allow_boundary_edges && (n_triangles < 1 || n_triangles > 2)) ||
+            (!allow_boundary_edges && n_triangles != 2)) {
             return false;
         }
     }
@@ -1369,110 +1373,19 @@ bool TriangleMesh::IsVertexManifold() const {
     return GetNonManifoldVertices().empty();
 }
 
-std::vector<Eigen::Vector2i> TriangleMesh::GetSelfIntersectingTriangles()
-        const {
-    std::vector<Eigen::Vector2i> self_intersecting_triangles;
-    for (size_t tidx0 = 0; tidx0 < triangles_.size() - 1; ++tidx0) {
-        const Eigen::Vector3i &tria_p = triangles_[tidx0];
-        const Eigen::Vector3d &p0 = vertices_[tria_p(0)];
-        const Eigen::Vector3d &p1 = vertices_[tria_p(1)];
-        const Eigen::Vector3d &p2 = vertices_[tria_p(2)];
-
-        const Eigen::Vector3d bb_min1 =
-                p0.array().min(p1.array().min(p2.array()));
-        const Eigen::Vector3d bb_max1 =
-                p0.array().max(p1.array().max(p2.array()));
-
-        for (size_t tidx1 = tidx0 + 1; tidx1 < triangles_.size(); ++tidx1) {
-            const Eigen::Vector3i &tria_q = triangles_[tidx1];
-            // check if neighbour triangle
-            if (tria_p(0) == tria_q(0) || tria_p(0) == tria_q(1) ||
-                tria_p(0) == tria_q(2) || tria_p(1) == tria_q(0) ||
-                tria_p(1) == tria_q(1) || tria_p(1) == tria_q(2) ||
-                tria_p(2) == tria_q(0) || tria_p(2) == tria_q(1) ||
-                tria_p(2) == tria_q(2)) {
-                continue;
-            }
-
-            // check for intersection
-            const Eigen::Vector3d &q0 = vertices_[tria_q(0)];
-            const Eigen::Vector3d &q1 = vertices_[tria_q(1)];
-            const Eigen::Vector3d &q2 = vertices_[tria_q(2)];
-
-            const Eigen::Vector3d bb_min2 =
-                    q0.array().min(q1.array().min(q2.array()));
-            const Eigen::Vector3d bb_max2 =
-                    q0.array().max(q1.array().max(q2.array()));
-            if (IntersectionTest::AABBAABB(bb_min1, bb_max1, bb_min2,
-                                           bb_max2) &&
-                IntersectionTest::TriangleTriangle3d(p0, p1, p2, q0, q1, q2)) {
-                self_intersecting_triangles.push_back(
-                        Eigen::Vector2i(tidx0, tidx1));
-            }
-        }
-    }
-    return self_intersecting_triangles;
-}
-
-bool TriangleMesh::IsSelfIntersecting() const {
-    return !GetSelfIntersectingTriangles().empty();
-}
-
 bool TriangleMesh::IsBoundingBoxIntersecting(const TriangleMesh &other) const {
     return IntersectionTest::AABBAABB(GetMinBound(), GetMaxBound(),
                                       other.GetMinBound(), other.GetMaxBound());
 }
 
-bool TriangleMesh::IsIntersecting(const TriangleMesh &other) const {
-    if (!IsBoundingBoxIntersecting(other)) {
-        return false;
-    }
-    for (size_t tidx0 = 0; tidx0 < triangles_.size(); ++tidx0) {
-        const Eigen::Vector3i &tria_p = triangles_[tidx0];
-        const Eigen::Vector3d &p0 = vertices_[tria_p(0)];
-        const Eigen::Vector3d &p1 = vertices_[tria_p(1)];
-        const Eigen::Vector3d &p2 = vertices_[tria_p(2)];
-        for (size_t tidx1 = 0; tidx1 < other.triangles_.size(); ++tidx1) {
-            const Eigen::Vector3i &tria_q = other.triangles_[tidx1];
-            const Eigen::Vector3d &q0 = other.vertices_[tria_q(0)];
-            const Eigen::Vector3d &q1 = other.vertices_[tria_q(1)];
-            const Eigen::Vector3d &q2 = other.vertices_[tria_q(2)];
-            if (IntersectionTest::TriangleTriangle3d(p0, p1, p2, q0, q1, q2)) {
-                return true;
-            }
-        }
-    }
-    return false;
-}
-
 std::tuple<std::vector<int>, std::vector<size_t>, std::vector<double>>
 TriangleMesh::ClusterConnectedTriangles() const {
     std::vector<int> triangle_clusters(triangles_.size(), -1);
     std::vector<size_t> num_triangles;
     std::vector<double> areas;
 
-    utility::LogDebug("[ClusterConnectedTriangles] Compute triangle adjacency");
-    auto edges_to_triangles = GetEdgeToTrianglesMap();
-    std::vector<std::unordered_set<int>> adjacency_list(triangles_.size());
-#pragma omp parallel for schedule(static) \
-        num_threads(utility::EstimateMaxThreads())
-    for (int tidx = 0; tidx < int(triangles_.size()); ++tidx) {
-        const auto &triangle = triangles_[tidx];
-        for (auto tnb :
-             edges_to_triangles[GetOrderedEdge(triangle(0), triangle(1))]) {
-            adjacency_list[tidx].insert(tnb);
-        }
-        for (auto tnb :
-             edges_to_triangles[GetOrderedEdge(triangle(0), triangle(2))]) {
-            adjacency_list[tidx].insert(tnb);
-        }
-        for (auto tnb :
-             edges_to_triangles[GetOrderedEdge(triangle(1), triangle(2))]) {
-            adjacency_list[tidx].insert(tnb);
-        }
-    }
-    utility::LogDebug(
-            "[ClusterConnectedTriangles] Done computing triangle adjacency");
+    // Triangles sharing an edge are read from the edge index.
+    const auto edge_index = GetEdgeIndex();
 
     int cluster_idx = 0;
     for (int tidx = 0; tidx < int(triangles_.size()); ++tidx) {
@@ -1493,10 +1406,15 @@ TriangleMesh::ClusterConnectedTriangles() const {
             cluster_n_triangles++;
             cluster_area += GetTriangleArea(cluster_tidx);
 
-            for (auto tnb : adjacency_list[cluster_tidx]) {
-                if (triangle_clusters[tnb] == -1) {
-                    triangle_queue.push(tnb);
-                    triangle_clusters[tnb] = cluster_idx;
+            for (int k = 0; k < 3; ++k) {
+                const int eidx = edge_index->triangle_edges_[cluster_tidx](k);
+                for (int i = edge_index->edge_offsets_[eidx];
+                     i < edge_index->edge_offsets_[eidx + 1]; ++i) {
+                    const int tnb = edge_index->edge_triangles_[i];
+                    if (triangle_clusters[tnb] == -1) {
+                        triangle_queue.push(tnb);
+                        triangle_clusters[tnb] = cluster_idx;
+                    }
                 }
             }
         }
@@ -1738,5 +1656,29 @@ TriangleMesh::ComputeEdgeWeightsCot(
     return weights;
 }
 
+std::vector<double> TriangleMesh::ComputeEdgeWeightsCot(
+        const TriangleMeshEdgeIndex &edge_index, double min_weight) const {
+    std::vector<double> weights(edge_index.NumEdges());
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int eidx = 0; eidx < int(edge_index.NumEdges()); ++eidx) {
+        const Eigen::Vector2i &edge = edge_index.edges_[eidx];
+        double weight_sum = 0;
+        int N = 0;
+        for (int i = edge_index.edge_offsets_[eidx];
+             i < edge_index.edge_offsets_[eidx + 1]; ++i) {
+            const int v2 = edge_index.edge_opposite_vertices_[i];
+            Eigen::Vector3d a = vertices_[edge(0)] - vertices_[v2];
+            Eigen::Vector3d b = vertices_[edge(1)] - vertices_[v2];
+            double weight = a.dot(b) / (a.cross(b)).norm();
+            weight_sum += weight;
+            N++;
+        }
+        double weight = N > 0 ? weight_sum / N : 0;
+        weights[eidx] = std::max(weight, min_weight);
+    }
+    return weights;
+}
+
 }  // namespace geometry
 }  // namespace open3d
@@ -35,7 +35,10 @@
 #include <vector>
 
 #include "open3d/geometry/Image.h"
+#include "open3d/core/Device.h"
 #include "open3d/geometry/MeshBase.h"
+#include "open3d/geometry/TriangleMeshDeformationCache.h"
+#include "open3d/geometry/TriangleMeshEdgeIndex.h"
 #include "open3d/utility/Helper.h"
 
 namespace open3d {
@@ -254,11 +257,13 @@ public:
     bool IsVertexManifold() const;
 
     /// Function that returns a list of triangles that are intersecting the
-    /// mesh.
+    /// mesh. Candidate pairs are found with a bounding volume hierarchy over
+    /// the triangles and tested in parallel. Triangles that share a vertex
+    /// are not tested. The pairs are sorted.
     std::vector<Eigen::Vector2i> GetSelfIntersectingTriangles() const;
 
-    /// Function that tests if the triangle mesh is self-intersecting.
-    /// Tests each triangle pair for intersection.
+    /// Function that tests if the triangle mesh is self-intersecting, see
+    /// GetSelfIntersectingTriangles. Stops at the first intersection.
     bool IsSelfIntersecting() const;
 
     /// Function that tests if the bounding boxes of the triangle meshes are
@@ -266,7 +271,8 @@ public:
     bool IsBoundingBoxIntersecting(const TriangleMesh &other) const;
 
     /// Function that tests if the triangle mesh intersects another triangle
-    /// mesh. Tests each triangle against each other triangle.
+    /// mesh. Tests each triangle against the triangles of \p other with an
+    /// overlapping bounding box, found with a bounding volume hierarchy.
     bool IsIntersecting(const TriangleMesh &other) const;
 
     /// Function that tests if the given triangle mesh is orientable, i.e.
@@ -298,6 +304,11 @@ public:
                        utility::hash_eigen<Eigen::Vector2i>>
     GetEdgeToVerticesMap() const;
 
+    /// Function that returns the edge and adjacency index of the triangles.
+    /// The index is built on first use and shared by later calls until the
+    /// triangles or the number of vertices change.
+    std::shared_ptr<const TriangleMeshEdgeIndex> GetEdgeIndex() const;
+
     /// Function that computes the area of a mesh triangle
     static double ComputeTriangleArea(const Eigen::Vector3d &p0,
                                       const Eigen::Vector3d &p1,
@@ -513,6 +524,11 @@ public:
     /// functional.
     /// \param energy energy model that should be optimized
     /// \param smoothed_alpha alpha parameter of the smoothed ARAP model
+    /// \param solver Solver of the linear system of the vertex positions.
+    /// The factorization or the device matrix is kept for the next call with
+    /// the same mesh, constraint vertex indices, solver and device, e.g.
+    /// while dragging the constraint vertices.
+    /// \param device Device of the ConjugateGradient solver.
     /// \return The deformed TriangleMesh
     std::shared_ptr<TriangleMesh> DeformAsRigidAsPossible(
             const std::vector<int> &constraint_vertex_indices,
@@ -520,7 +536,10 @@ public:
             size_t max_iter,
             DeformAsRigidAsPossibleEnergy energy =
                     DeformAsRigidAsPossibleEnergy::Spokes,
-            double smoothed_alpha = 0.01) const;
+            double smoothed_alpha = 0.01,
+            DeformAsRigidAsPossibleSolver solver =
+                    DeformAsRigidAsPossibleSolver::SparseLDLT,
+            const core::Device &device = core::Device("CPU:0")) const;
 
     /// \brief Alpha shapes are a generalization of the convex hull. With
     /// decreasing alpha value the shape schrinks and creates cavities.
@@ -539,6 +558,24 @@ public:
             std::shared_ptr<TetraMesh> tetra_mesh = nullptr,
             std::vector<size_t> *pt_map = nullptr);
 
+    /// \brief Computes the alpha shapes of \p pcd for several values of
+    /// alpha. The Delaunay tetrahedralization and the circumradii of its
+    /// tetras are computed once and shared by all alpha values.
+    /// \param pcd PointCloud for what the alpha shapes should be computed.
+    /// \param alphas parameters to control the shapes, see
+    /// CreateFromPointCloudAlphaShape.
+    /// \param tetra_mesh If not a nullptr, then uses this to construct the
+    /// alpha shapes. Otherwise, ComputeDelaunayTetrahedralization is called.
+    /// \param pt_map Optional map from tetra_mesh vertex indices to pcd
+    /// points.
+    /// \return One TriangleMesh per value in \p alphas.
+    static std::vector<std::shared_ptr<TriangleMesh>>
+    CreateFromPointCloudAlphaShapes(
+            const PointCloud &pcd,
+            const std::vector<double> &alphas,
+            std::shared_ptr<TetraMesh> tetra_mesh = nullptr,
+            std::vector<size_t> *pt_map = nullptr);
+
     /// Function that computes a triangle mesh from an oriented PointCloud \p
     /// pcd. This implements the Ball Pivoting algorithm proposed in F.
     /// Bernardini et al., "The ball-pivoting algorithm for surface
@@ -547,7 +584,8 @@ public:
     /// Parallel Ball Pivoting Algorithm", 2014. The surface reconstruction is
     /// done by rolling a ball with a given radius (cf. \p radii) over the
     /// point cloud, whenever the ball touches three points a triangle is
-    /// created.
+    /// created. Large point clouds are split into slabs that are reconstructed
+    /// in parallel, the slab boundaries are stitched afterwards.
     /// \param pcd defines the PointCloud from which the TriangleMesh surface is
     /// reconstructed. Has to contain normals.
     /// \param radii defines the radii of
@@ -561,6 +599,10 @@ public:
     /// Reconstruction", 2013. This function uses the original implementation by
     /// Kazhdan. See https://github.com/mkazhdan/PoissonRecon
     ///
+    /// The reconstruction reports its progress and can be cancelled between
+    /// its stages with utility::ScopedOperationContext, it throws
+    /// utility::CancelledError when cancelled.
+    ///
     /// \param pcd PointCloud with normals and optionally colors.
     /// \param depth Maximum depth of the tree that will be used for surface
     /// reconstruction. Running at depth d corresponds to solving on a grid
@@ -575,6 +617,19 @@ public:
     /// estimate the positions of iso-vertices.
     /// \param n_threads Number of threads used for reconstruction. Set to -1 to
     /// automatically determine it.
+    /// \param full_depth Depth up to which the octree is complete. Coarser
+    /// levels are solved on a dense grid.
+    /// \param iterations Number of Gauss-Seidel relaxations per level of the
+    /// cascadic multigrid solver.
+    /// \param samples_per_node Minimum number of points that fall into an
+    /// octree node. Use larger values for noisy data.
+    /// \param point_weight Importance of interpolating the points relative to
+    /// the gradient fit (screening weight).
+    /// \param cg_accuracy Accuracy of the conjugate gradient solver on the
+    /// coarsest level.
+    /// \param memory_budget_mb If positive, the approximate peak memory in MB
+    /// the reconstruction may use. If solving at \p depth would exceed it, the
+    /// depth is reduced until it fits, with a warning.
     /// \return The estimated TriangleMesh, and per vertex density values that
     /// can be used to to trim the mesh.
     static std::tuple<std::shared_ptr<TriangleMesh>, std::vector<double>>
@@ -583,7 +638,13 @@ public:
                                 float width = 0.0f,
                                 float scale = 1.1f,
                                 bool linear_fit = false,
-                                int n_threads = -1);
+                                int n_threads = -1,
+                                size_t full_depth = 5,
+                                size_t iterations = 8,
+                                float samples_per_node = 1.5f,
+                                float point_weight = 2.0f,
+                                float cg_accuracy = 1e-3f,
+                                double memory_budget_mb = 0.0);
 
     /// Factory function to create a tetrahedron mesh (trianglemeshfactory.cpp).
     /// the mesh centroid will be at (0,0,0) and \p radius defines the
@@ -784,6 +845,22 @@ protected:
                     &edges_to_vertices,
             double min_weight = std::numeric_limits<double>::lowest()) const;
 
+    /// \brief Function that computes the cot weight of every edge of
+    /// \p edge_index.
+    ///
+    /// \param edge_index Edge index of the triangle mesh.
+    /// \param min_weight minimum weight returned. Weights smaller than this
+    /// get clamped.
+    /// \return cot weight per edge, in the order of edge_index.edges_.
+    std::vector<double> ComputeEdgeWeightsCot(
+            const TriangleMeshEdgeIndex &edge_index,
+            double min_weight = std::numeric_limits<double>::lowest()) const;
+
+    /// Lazily built edge index returned by GetEdgeIndex().
+    mutable TriangleMeshEdgeIndexCache edge_index_cache_;
+    /// System of the last DeformAsRigidAsPossible call.
+    mutable TriangleMeshDeformationCache deformation_cache_;
+
 public:
     /// List of triangles denoted by the index of points forming the triangle.
     std::vector<Eigen::Vector3i> triangles_;
@@ -27,7 +27,12 @@
 #include <Eigen/Dense>
 #include <Eigen/Sparse>
 #include <algorithm>
+#include <atomic>
+#include <cstring>
 
+#include "open3d/core/SparseTensor.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/core/linalg/ConjugateGradient.h"
 #include "open3d/geometry/TriangleMesh.h"
 #include "open3d/utility/Logging.h"
 #include "open3d/utility/Parallel.h"
@@ -35,23 +40,57 @@
 namespace open3d {
 namespace geometry {
 
+struct TriangleMeshDeformationCache::System {
+    /// Rest vertices, triangles, sorted constraint vertex indices, solver and
+    /// device the system was built for.
+    std::vector<Eigen::Vector3d> vertices_;
+    std::vector<Eigen::Vector3i> triangles_;
+    std::vector<int> constraint_indices_;
+    MeshBase::DeformAsRigidAsPossibleSolver solver_;
+    core::Device device_;
+
+    std::shared_ptr<const TriangleMeshEdgeIndex> edge_index_;
+    std::vector<double> edge_weights_;
+    /// Index of the constraint of each vertex, or -1.
+    std::vector<int> constraint_slots_;
+
+    /// Factorization of the SparseLDLT solver.
+    Eigen::SimplicialLDLT<Eigen::SparseMatrix<double>> ldlt_;
+    /// Float64 matrix of the ConjugateGradient solver on device_.
+    core::SparseTensor matrix_;
+
+    bool Matches(const std::vector<Eigen::Vector3d> &vertices,
+                 const std::vector<Eigen::Vector3i> &triangles,
+                 const std::vector<int> &constraint_indices,
+                 MeshBase::DeformAsRigidAsPossibleSolver solver,
+                 const core::Device &device) const {
+        return solver_ == solver && device_ == device &&
+               constraint_indices_ == constraint_indices &&
+               vertices_.size() == vertices.size() &&
+               triangles_.size() == triangles.size() &&
+               (vertices.empty() ||
+                std::memcmp(vertices_.data(), vertices.data(),
+                            vertices.size() * sizeof(Eigen::Vector3d)) == 0) &&
+               (triangles.empty() ||
+                std::memcmp(triangles_.data(), triangles.data(),
+                            triangles.size() * sizeof(Eigen::Vector3i)) == 0);
+    }
+};
+
 std::shared_ptr<TriangleMesh> TriangleMesh::DeformAsRigidAsPossible(
         const std::vector<int> &constraint_vertex_indices,
         const std::vector<Eigen::Vector3d> &constraint_vertex_positions,
         size_t max_iter,
         DeformAsRigidAsPossibleEnergy energy_model,
-        double smoothed_alpha) const {
+        double smoothed_alpha,
+        DeformAsRigidAsPossibleSolver solver_type,
+        const core::Device &device) const {
     auto prime = std::make_shared<TriangleMesh>();
     prime->vertices_ = this->vertices_;
     prime->triangles_ = this->triangles_;
+    const int num_vertices = int(vertices_.size());
 
-    utility::LogDebug("[DeformAsRigidAsPossible] setting up S'");
-    prime->ComputeAdjacencyList();
-    auto edges_to_vertices = prime->GetEdgeToVerticesMap();
-    auto edge_weights =
-            prime->ComputeEdgeWeightsCot(edges_to_vertices, /*min_weight=*/0);
-    utility::LogDebug("[DeformAsRigidAsPossible] done setting up S'");
-
+    // The last position given for a vertex is its constraint.
     std::unordered_map<int, Eigen::Vector3d> constraints;
     for (size_t idx = 0; idx < constraint_vertex_indices.size() &&
                          idx < constraint_vertex_positions.size();
@@ -59,10 +98,110 @@ std::shared_ptr<TriangleMesh> TriangleMesh::DeformAsRigidAsPossible(
         constraints[constraint_vertex_indices[idx]] =
                 constraint_vertex_positions[idx];
     }
+    std::vector<int> constraint_indices;
+    std::vector<Eigen::Vector3d> constraint_positions;
+    for (const auto &kv : constraints) {
+        constraint_indices.push_back(kv.first);
+    }
+    std::sort(constraint_indices.begin(), constraint_indices.end());
+    for (int i : constraint_indices) {
+        constraint_positions.push_back(constraints[i]);
+    }
+
+    std::shared_ptr<const TriangleMeshDeformationCache::System> system =
+            deformation_cache_.Get();
+    if (system && system->Matches(vertices_, triangles_, constraint_indices,
+                                  solver_type, device)) {
+        utility::LogDebug("[DeformAsRigidAsPossible] reusing system matrix L");
+    } else {
+        utility::LogDebug("[DeformAsRigidAsPossible] setting up S'");
+        auto new_system =
+                std::make_shared<TriangleMeshDeformationCache::System>();
+        new_system->vertices_ = vertices_;
+        new_system->triangles_ = triangles_;
+        new_system->constraint_indices_ = constraint_indices;
+        new_system->solver_ = solver_type;
+        new_system->device_ = device;
+        // The neighbors of vertex i and the weights of the edges to them are
+        // read from the CSR arrays of the edge index.
+        new_system->edge_index_ = GetEdgeIndex();
+        new_system->edge_weights_ = ComputeEdgeWeightsCot(
+                *new_system->edge_index_, /*min_weight=*/0);
+        new_system->constraint_slots_.assign(num_vertices, -1);
+        for (size_t c = 0; c < constraint_indices.size(); ++c) {
+            new_system->constraint_slots_[constraint_indices[c]] = int(c);
+        }
+        utility::LogDebug("[DeformAsRigidAsPossible] done setting up S'");
+
+        // Build system matrix L. The columns of the constraint vertices are
+        // moved to the right-hand side, so that L stays symmetric positive
+        // definite and can be solved by Cholesky or conjugate gradient.
+        utility::LogDebug(
+                "[DeformAsRigidAsPossible] setting up system matrix L");
+        const auto &nb_offsets = new_system->edge_index_->vertex_offsets_;
+        const auto &nb_vertices = new_system->edge_index_->vertex_neighbors_;
+        const auto &nb_edges = new_system->edge_index_->vertex_edges_;
+        const auto &slots = new_system->constraint_slots_;
+        std::vector<Eigen::Triplet<double>> triplets;
+        for (int i = 0; i < num_vertices; ++i) {
+            if (slots[i] >= 0) {
+                triplets.push_back(Eigen::Triplet<double>(i, i, 1));
+            } else {
+                double W = 0;
+                for (int k = nb_offsets[i]; k < nb_offsets[i + 1]; ++k) {
+                    const int j = nb_vertices[k];
+                    double w = new_system->edge_weights_[nb_edges[k]];
+                    if (slots[j] < 0) {
+                        triplets.push_back(Eigen::Triplet<double>(i, j, -w));
+                    }
+                    W += w;
+                }
+                if (W > 0) {
+                    triplets.push_back(Eigen::Triplet<double>(i, i, W));
+                }
+            }
+        }
+        utility::LogDebug(
+                "[DeformAsRigidAsPossible] done setting up system matrix L");
+
+        utility::LogDebug("[DeformAsRigidAsPossible] setting up sparse solver");
+        if (solver_type == DeformAsRigidAsPossibleSolver::SparseLDLT) {
+            Eigen::SparseMatrix<double> L(num_vertices, num_vertices);
+            L.setFromTriplets(triplets.begin(), triplets.end());
+            new_system->ldlt_.compute(L);
+            if (new_system->ldlt_.info() != Eigen::Success) {
+                utility::LogError("Failed to build solver (factorize)");
+            }
+        } else {
+            std::vector<int64_t> rows, cols;
+            std::vector<double> values;
+            for (const auto &triplet : triplets) {
+                rows.push_back(triplet.row());
+                cols.push_back(triplet.col());
+                values.push_back(triplet.value());
+            }
+            const int64_t nnz = int64_t(triplets.size());
+            new_system->matrix_ =
+                    core::SparseTensor::FromCOO(
+                            core::Tensor(rows, {nnz}, core::Int64),
+                            core::Tensor(cols, {nnz}, core::Int64),
+                            core::Tensor(values, {nnz}, core::Float64),
+                            {num_vertices, num_vertices})
+                            .To(device);
+        }
+        utility::LogDebug(
+                "[DeformAsRigidAsPossible] done setting up sparse solver");
+        system = new_system;
+        deformation_cache_.Set(system);
+    }
+
+    const auto &nb_offsets = system->edge_index_->vertex_offsets_;
+    const auto &nb_vertices = system->edge_index_->vertex_neighbors_;
+    const auto &nb_edges = system->edge_index_->vertex_edges_;
+    const auto &edge_weights = system->edge_weights_;
+    const auto &slots = system->constraint_slots_;
 
     double surface_area = -1;
-    // std::vector<Eigen::Matrix3d> Rs(vertices_.size(),
-    // Eigen::Matrix3d::Identity());
     std::vector<Eigen::Matrix3d> Rs(vertices_.size());
     std::vector<Eigen::Matrix3d> Rs_old;
     if (energy_model == DeformAsRigidAsPossibleEnergy::Smoothed) {
@@ -70,59 +209,35 @@ std::shared_ptr<TriangleMesh> TriangleMesh::DeformAsRigidAsPossible(
         Rs_old.resize(vertices_.size());
     }
 
-    // Build system matrix L and its solver
-    utility::LogDebug("[DeformAsRigidAsPossible] setting up system matrix L");
-    std::vector<Eigen::Triplet<double>> triplets;
-    for (int i = 0; i < int(vertices_.size()); ++i) {
-        if (constraints.count(i) > 0) {
-            triplets.push_back(Eigen::Triplet<double>(i, i, 1));
-        } else {
-            double W = 0;
-            for (int j : prime->adjacency_list_[i]) {
-                double w = edge_weights[GetOrderedEdge(i, j)];
-                triplets.push_back(Eigen::Triplet<double>(i, j, -w));
-                W += w;
-            }
-            if (W > 0) {
-                triplets.push_back(Eigen::Triplet<double>(i, i, W));
-            }
-        }
+    // Right-hand sides of the x, y and z coordinates, stored as the columns
+    // of a column-major matrix.
+    Eigen::MatrixXd b(num_vertices, 3);
+    core::Tensor x_device;
+    if (solver_type == DeformAsRigidAsPossibleSolver::ConjugateGradient) {
+        x_device = core::Tensor(prime->vertices_.data()->data(),
+                                {num_vertices, 3}, core::Float64)
+                           .T()
+                           .Contiguous()
+                           .To(device);
     }
-    Eigen::SparseMatrix<double> L(vertices_.size(), vertices_.size());
-    L.setFromTriplets(triplets.begin(), triplets.end());
-    utility::LogDebug(
-            "[DeformAsRigidAsPossible] done setting up system matrix L");
-
-    utility::LogDebug("[DeformAsRigidAsPossible] setting up sparse solver");
-    Eigen::SparseLU<Eigen::SparseMatrix<double>> solver;
-    solver.analyzePattern(L);
-    solver.factorize(L);
-    if (solver.info() != Eigen::Success) {
-        utility::LogError("Failed to build solver (factorize)");
-    } else {
-        utility::LogDebug(
-                "[DeformAsRigidAsPossible] done setting up sparse solver");
-    }
-
-    std::vector<Eigen::VectorXd> b = {Eigen::VectorXd(vertices_.size()),
-                                      Eigen::VectorXd(vertices_.size()),
-                                      Eigen::VectorXd(vertices_.size())};
     for (size_t iter = 0; iter < max_iter; ++iter) {
         if (energy_model == DeformAsRigidAsPossibleEnergy::Smoothed) {
             std::swap(Rs, Rs_old);
         }
 
+        std::atomic<bool> rotation_failed(false);
 #pragma omp parallel for schedule(static) \
         num_threads(utility::EstimateMaxThreads())
-        for (int i = 0; i < int(vertices_.size()); ++i) {
+        for (int i = 0; i < num_vertices; ++i) {
             // Update rotations
             Eigen::Matrix3d S = Eigen::Matrix3d::Zero();
             Eigen::Matrix3d R = Eigen::Matrix3d::Zero();
             int n_nbs = 0;
-            for (int j : prime->adjacency_list_[i]) {
+            for (int k = nb_offsets[i]; k < nb_offsets[i + 1]; ++k) {
+                const int j = nb_vertices[k];
                 Eigen::Vector3d e0 = vertices_[i] - vertices_[j];
                 Eigen::Vector3d e1 = prime->vertices_[i] - prime->vertices_[j];
-                double w = edge_weights[GetOrderedEdge(i, j)];
+                double w = edge_weights[nb_edges[k]];
                 S += w * (e0 * e1.transpose());
                 if (energy_model == DeformAsRigidAsPossibleEnergy::Smoothed) {
                     R += Rs_old[j];
@@ -143,48 +258,87 @@ std::shared_ptr<TriangleMesh> TriangleMesh::DeformAsRigidAsPossible(
             // http://graphics.stanford.edu/~smr/ICP/comparison/eggert_comparison_mva97.pdf
             Rs[i] = V * D.asDiagonal() * U.transpose();
             if (Rs[i].determinant() <= 0) {
-                utility::LogError(
-                        "something went wrong with "
-                        "updating R");
+                rotation_failed = true;
             }
         }
+        // Exceptions must not leave the OpenMP region.
+        if (rotation_failed) {
+            utility::LogError("something went wrong with updating R");
+        }
 
 #pragma omp parallel for schedule(static) \
         num_threads(utility::EstimateMaxThreads())
-        for (int i = 0; i < int(vertices_.size()); ++i) {
+        for (int i = 0; i < num_vertices; ++i) {
             // Update Positions
             Eigen::Vector3d bi(0, 0, 0);
-            if (constraints.count(i) > 0) {
-                bi = constraints[i];
+            if (slots[i] >= 0) {
+                bi = constraint_positions[slots[i]];
             } else {
-                for (int j : prime->adjacency_list_[i]) {
-                    double w = edge_weights[GetOrderedEdge(i, j)];
+                for (int k = nb_offsets[i]; k < nb_offsets[i + 1]; ++k) {
+                    const int j = nb_vertices[k];
+                    double w = edge_weights[nb_edges[k]];
                     bi += w / 2 *
                           ((Rs[i] + Rs[j]) * (vertices_[i] - vertices_[j]));
+                    if (slots[j] >= 0) {
+                        bi += w * constraint_positions[slots[j]];
+                    }
                 }
             }
-            b[0](i) = bi(0);
-            b[1](i) = bi(1);
-            b[2](i) = bi(2);
+            b.row(i) = bi.transpose();
         }
+
+        if (solver_type == DeformAsRigidAsPossibleSolver::SparseLDLT) {
+            const Eigen::MatrixXd p_prime = system->ldlt_.solve(b);
+            if (system->ldlt_.info() != Eigen::Success) {
+                utility::LogError("Cholesky solve failed");
+            }
 #pragma omp parallel for schedule(static) \
         num_threads(utility::EstimateMaxThreads())
-        for (int comp = 0; comp < 3; ++comp) {
-            Eigen::VectorXd p_prime = solver.solve(b[comp]);
-            if (solver.info() != Eigen::Success) {
-                utility::LogError("Cholesky solve failed");
+            for (int i = 0; i < num_vertices; ++i) {
+                prime->vertices_[i] = p_prime.row(i).transpose();
             }
-            for (int i = 0; i < int(vertices_.size()); ++i) {
-                prime->vertices_[i](comp) = p_prime(i);
+        } else {
+            // The (3, n) solution of the previous iteration is the initial
+            // guess of each coordinate.
+            const core::Tensor b_device =
+                    core::Tensor(b.data(), {3, num_vertices}, core::Float64)
+                            .To(device);
+            for (int comp = 0; comp < 3; ++comp) {
+                core::Tensor x = x_device[comp].Clone();
+                core::ConjugateGradientOption option;
+                option.max_iteration_ = 10 * num_vertices;
+                option.relative_tolerance_ = 1e-10;
+                const core::ConjugateGradientResult result = core::PCG(
+                        system->matrix_, b_device[comp], x,
+                        core::PreconditionerType::Jacobi, 1, option);
+                if (!result.converged_) {
+                    utility::LogWarning(
+                            "[DeformAsRigidAsPossible] conjugate gradient did "
+                            "not converge, residual {:e}",
+                            result.residual_norm_);
+                }
+                x_device[comp].AsRvalue() = x;
             }
+            const core::Tensor p_prime =
+                    x_device.T().Contiguous().To(core::Device("CPU:0"));
+            std::memcpy(prime->vertices_.data()->data(),
+                        p_prime.GetDataPtr<double>(),
+                        sizeof(double) * 3 * num_vertices);
         }
 
         // Compute energy and log
+        if (utility::Logger::GetInstance().GetVerbosityLevel() <
+            utility::VerbosityLevel::Debug) {
+            continue;
+        }
         double energy = 0;
         double reg = 0;
-        for (int i = 0; i < int(vertices_.size()); ++i) {
-            for (int j : prime->adjacency_list_[i]) {
-                double w = edge_weights[GetOrderedEdge(i, j)];
+#pragma omp parallel for schedule(static) reduction(+ : energy, reg) \
+        num_threads(utility::EstimateMaxThreads())
+        for (int i = 0; i < num_vertices; ++i) {
+            for (int k = nb_offsets[i]; k < nb_offsets[i + 1]; ++k) {
+                const int j = nb_vertices[k];
+                double w = edge_weights[nb_edges[k]];
                 Eigen::Vector3d e0 = vertices_[i] - vertices_[j];
                 Eigen::Vector3d e1 = prime->vertices_[i] - prime->vertices_[j];
                 Eigen::Vector3d diff = e1 - Rs[i] * e0;
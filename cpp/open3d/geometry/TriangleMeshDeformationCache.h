@@ -0,0 +1,77 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <memory>
+#include <mutex>
+
+namespace open3d {
+namespace geometry {
+
+/// \class TriangleMeshDeformationCache
+///
+/// \brief Linear system of the last TriangleMesh::DeformAsRigidAsPossible
+/// call, with its factorization or device matrix, so that calls with the same
+/// mesh, constraint vertices and solver only update the right-hand sides.
+///
+/// Like TriangleMeshEdgeIndexCache, the cache is not copied with its mesh.
+class TriangleMeshDeformationCache {
+public:
+    /// The system and the mesh, constraint vertices and solver it was built
+    /// for. Defined in TriangleMeshDeformation.cpp.
+    struct System;
+
+    TriangleMeshDeformationCache() {}
+    TriangleMeshDeformationCache(const TriangleMeshDeformationCache &) {}
+    TriangleMeshDeformationCache &operator=(
+            const TriangleMeshDeformationCache &) {
+        Clear();
+        return *this;
+    }
+
+    /// Returns the cached system, or nullptr.
+    std::shared_ptr<const System> Get() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return system_;
+    }
+
+    /// Replaces the cached system.
+    void Set(const std::shared_ptr<const System> &system) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        system_ = system;
+    }
+
+    /// Releases the cached system.
+    void Clear() { Set(nullptr); }
+
+private:
+    mutable std::mutex mutex_;
+    std::shared_ptr<const System> system_;
+};
+
+}  // namespace geometry
+}  // namespace open3d
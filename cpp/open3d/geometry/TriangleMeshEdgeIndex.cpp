@@ -0,0 +1,182 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/geometry/TriangleMeshEdgeIndex.h"
+
+#include <algorithm>
+#include <cstring>
+#include <numeric>
+
+#include "open3d/utility/Parallel.h"
+
+namespace open3d {
+namespace geometry {
+
+TriangleMeshEdgeIndex::TriangleMeshEdgeIndex(
+        const std::vector<Eigen::Vector3i> &triangles, size_t num_vertices) {
+    const int n_slots = int(triangles.size()) * 3;
+    int n_vertices = int(num_vertices);
+    for (const auto &triangle : triangles) {
+        n_vertices = std::max(n_vertices, triangle.maxCoeff() + 1);
+    }
+    auto SlotVertex = [&](int slot, int k) {
+        return triangles[slot / 3]((slot + k) % 3);
+    };
+    auto SlotEdge = [&](int slot) {
+        const int vidx0 = SlotVertex(slot, 0);
+        const int vidx1 = SlotVertex(slot, 1);
+        return Eigen::Vector2i(std::min(vidx0, vidx1), std::max(vidx0, vidx1));
+    };
+
+    // Group the triangle edges by their first vertex and sort every group by
+    // (second vertex, slot), so that equal edges are adjacent and their
+    // triangles are in increasing order.
+    std::vector<int> slot_offsets(n_vertices + 1, 0);
+    for (int slot = 0; slot < n_slots; ++slot) {
+        slot_offsets[SlotEdge(slot)(0) + 1]++;
+    }
+    std::partial_sum(slot_offsets.begin(), slot_offsets.end(),
+                     slot_offsets.begin());
+    std::vector<int> slots(n_slots);
+    std::vector<int> cursor(slot_offsets.begin(), slot_offsets.end() - 1);
+    for (int slot = 0; slot < n_slots; ++slot) {
+        slots[cursor[SlotEdge(slot)(0)]++] = slot;
+    }
+    std::vector<int> edge_counts(n_vertices + 1, 0);
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int vidx = 0; vidx < n_vertices; ++vidx) {
+        auto begin = slots.begin() + slot_offsets[vidx];
+        auto end = slots.begin() + slot_offsets[vidx + 1];
+        std::sort(begin, end, [&](int slot0, int slot1) {
+            const int vidx0 = SlotEdge(slot0)(1);
+            const int vidx1 = SlotEdge(slot1)(1);
+            return vidx0 < vidx1 || (vidx0 == vidx1 && slot0 < slot1);
+        });
+        for (auto it = begin; it != end; ++it) {
+            if (it == begin || SlotEdge(*it)(1) != SlotEdge(*(it - 1))(1)) {
+                edge_counts[vidx + 1]++;
+            }
+        }
+    }
+    std::partial_sum(edge_counts.begin(), edge_counts.end(),
+                     edge_counts.begin());
+
+    const int n_edges = edge_counts.back();
+    edges_.resize(n_edges);
+    edge_offsets_.resize(n_edges + 1);
+    edge_offsets_[n_edges] = n_slots;
+    edge_triangles_.resize(n_slots);
+    edge_opposite_vertices_.resize(n_slots);
+    triangle_edges_.resize(triangles.size());
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int vidx = 0; vidx < n_vertices; ++vidx) {
+        int eidx = edge_counts[vidx] - 1;
+        for (int i = slot_offsets[vidx]; i < slot_offsets[vidx + 1]; ++i) {
+            const int slot = slots[i];
+            const Eigen::Vector2i edge = SlotEdge(slot);
+            if (i == slot_offsets[vidx] || edge(1) != edges_[eidx](1)) {
+                ++eidx;
+                edges_[eidx] = edge;
+                edge_offsets_[eidx] = i;
+            }
+            edge_triangles_[i] = slot / 3;
+            edge_opposite_vertices_[i] = SlotVertex(slot, 2);
+            triangle_edges_[slot / 3](slot % 3) = eidx;
+        }
+    }
+
+    // Vertex neighbors in increasing order, with the edges to them.
+    vertex_offsets_.assign(n_vertices + 1, 0);
+    for (const auto &edge : edges_) {
+        vertex_offsets_[edge(0) + 1]++;
+        if (edge(0) != edge(1)) {
+            vertex_offsets_[edge(1) + 1]++;
+        }
+    }
+    std::partial_sum(vertex_offsets_.begin(), vertex_offsets_.end(),
+                     vertex_offsets_.begin());
+    vertex_neighbors_.resize(vertex_offsets_.back());
+    vertex_edges_.resize(vertex_offsets_.back());
+    cursor.assign(vertex_offsets_.begin(), vertex_offsets_.end() - 1);
+    // Edges are sorted, so the neighbors with a smaller index are added in
+    // increasing order before the ones with a larger index.
+    for (int eidx = 0; eidx < n_edges; ++eidx) {
+        const int vidx1 = edges_[eidx](1);
+        vertex_neighbors_[cursor[vidx1]] = edges_[eidx](0);
+        vertex_edges_[cursor[vidx1]++] = eidx;
+    }
+    for (int eidx = 0; eidx < n_edges; ++eidx) {
+        const int vidx0 = edges_[eidx](0);
+        if (vidx0 == edges_[eidx](1)) continue;
+        vertex_neighbors_[cursor[vidx0]] = edges_[eidx](1);
+        vertex_edges_[cursor[vidx0]++] = eidx;
+    }
+}
+
+int TriangleMeshEdgeIndex::FindEdge(int vidx0, int vidx1) const {
+    if (vidx0 < 0 || vidx1 < 0 || vidx0 + 1 >= int(vertex_offsets_.size()) ||
+        vidx1 + 1 >= int(vertex_offsets_.size())) {
+        return -1;
+    }
+    auto begin = vertex_neighbors_.begin() + vertex_offsets_[vidx0];
+    auto end = vertex_neighbors_.begin() + vertex_offsets_[vidx0 + 1];
+    auto it = std::lower_bound(begin, end, vidx1);
+    if (it == end || *it != vidx1) {
+        return -1;
+    }
+    return vertex_edges_[it - vertex_neighbors_.begin()];
+}
+
+std::shared_ptr<const TriangleMeshEdgeIndex> TriangleMeshEdgeIndexCache::Get(
+        const std::vector<Eigen::Vector3i> &triangles, size_t num_vertices) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    const bool up_to_date =
+            index_ && num_vertices_ == num_vertices &&
+            triangles_.size() == triangles.size() &&
+            (triangles.empty() ||
+             std::memcmp(triangles_.data(), triangles.data(),
+                         triangles.size() * sizeof(Eigen::Vector3i)) == 0);
+    if (!up_to_date) {
+        index_ = std::make_shared<const TriangleMeshEdgeIndex>(triangles,
+                                                               num_vertices);
+        triangles_ = triangles;
+        num_vertices_ = num_vertices;
+    }
+    return index_;
+}
+
+void TriangleMeshEdgeIndexCache::Clear() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    index_.reset();
+    triangles_.clear();
+    triangles_.shrink_to_fit();
+    num_vertices_ = 0;
+}
+
+}  // namespace geometry
+}  // namespace open3d
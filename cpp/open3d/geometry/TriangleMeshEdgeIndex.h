@@ -0,0 +1,122 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <Eigen/Core>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace open3d {
+namespace geometry {
+
+/// \class TriangleMeshEdgeIndex
+///
+/// \brief Compact edge and adjacency index of a triangle mesh.
+///
+/// Every edge is stored once as an ordered vertex pair. The triangles around
+/// each edge and the edges around each vertex are stored in compressed sparse
+/// row (CSR) arrays, so that adjacency queries are array accesses instead of
+/// hash map lookups.
+class TriangleMeshEdgeIndex {
+public:
+    /// \brief Builds the index of \p triangles.
+    ///
+    /// \param triangles Triangles of the mesh.
+    /// \param num_vertices Number of vertices of the mesh.
+    TriangleMeshEdgeIndex(const std::vector<Eigen::Vector3i> &triangles,
+                          size_t num_vertices);
+
+    /// Number of unique edges.
+    size_t NumEdges() const { return edges_.size(); }
+
+    /// Number of triangles the edge \p eidx belongs to.
+    int NumEdgeTriangles(int eidx) const {
+        return edge_offsets_[eidx + 1] - edge_offsets_[eidx];
+    }
+
+    /// Returns the index of the edge between \p vidx0 and \p vidx1, or -1 if
+    /// there is no such edge.
+    int FindEdge(int vidx0, int vidx1) const;
+
+public:
+    /// Unique edges (vertex0, vertex1) with vertex0 <= vertex1, sorted
+    /// lexicographically.
+    std::vector<Eigen::Vector2i> edges_;
+    /// The triangles edge e belongs to are edge_triangles_[edge_offsets_[e]]
+    /// to edge_triangles_[edge_offsets_[e + 1] - 1], in increasing order.
+    std::vector<int> edge_offsets_;
+    std::vector<int> edge_triangles_;
+    /// The vertex of triangle edge_triangles_[i] that is opposite to the edge.
+    std::vector<int> edge_opposite_vertices_;
+    /// triangle_edges_[t](k) is the edge between the vertices k and (k + 1) % 3
+    /// of triangle t.
+    std::vector<Eigen::Vector3i> triangle_edges_;
+    /// The adjacent vertices of vertex v are
+    /// vertex_neighbors_[vertex_offsets_[v]] to
+    /// vertex_neighbors_[vertex_offsets_[v + 1] - 1], in increasing order.
+    /// vertex_edges_ holds the edges to these neighbors.
+    std::vector<int> vertex_offsets_;
+    std::vector<int> vertex_neighbors_;
+    std::vector<int> vertex_edges_;
+};
+
+/// \class TriangleMeshEdgeIndexCache
+///
+/// \brief Lazily built TriangleMeshEdgeIndex of a triangle mesh.
+///
+/// The index is rebuilt whenever the triangles or the number of vertices
+/// differ from the ones it was built from. The cache is not copied with its
+/// mesh.
+class TriangleMeshEdgeIndexCache {
+public:
+    TriangleMeshEdgeIndexCache() {}
+    TriangleMeshEdgeIndexCache(const TriangleMeshEdgeIndexCache &) {}
+    TriangleMeshEdgeIndexCache &operator=(const TriangleMeshEdgeIndexCache &) {
+        Clear();
+        return *this;
+    }
+
+    /// Returns the index of \p triangles, building it if the cached one is
+    /// out of date.
+    std::shared_ptr<const TriangleMeshEdgeIndex> Get(
+            const std::vector<Eigen::Vector3i> &triangles,
+            size_t num_vertices);
+
+    /// Releases the cached index.
+    void Clear();
+
+private:
+    std::mutex mutex_;
+    std::shared_ptr<const TriangleMeshEdgeIndex> index_;
+    /// Triangles and number of vertices the index was built from.
+    std::vector<Eigen::Vector3i> triangles_;
+    size_t num_vertices_ = 0;
+};
+
+}  // namespace geometry
+}  // namespace open3d
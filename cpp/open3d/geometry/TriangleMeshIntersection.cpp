@@ -0,0 +1,314 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <tbb/parallel_sort.h>
+
+#include <Eigen/Dense>
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include "open3d/geometry/IntersectionTest.h"
+#include "open3d/geometry/TriangleMesh.h"
+#include "open3d/utility/Parallel.h"
+
+namespace open3d {
+namespace geometry {
+
+namespace {
+
+/// Bounding volume hierarchy over the triangles of a mesh, for the broad
+/// phase of the intersection tests. The triangles are sorted by the Morton
+/// code of their centroids and the tree splits the sorted range in halves,
+/// so nearby triangles share subtrees.
+class TriangleBVH {
+public:
+    TriangleBVH(const std::vector<Eigen::Vector3d> &vertices,
+                const std::vector<Eigen::Vector3i> &triangles) {
+        const int64_t n_triangles = int64_t(triangles.size());
+        triangle_min_.resize(n_triangles);
+        triangle_max_.resize(n_triangles);
+        Eigen::Vector3d min_centroid = Eigen::Vector3d::Constant(
+                std::numeric_limits<double>::infinity());
+        Eigen::Vector3d max_centroid = -min_centroid;
+        for (int64_t tidx = 0; tidx < n_triangles; ++tidx) {
+            const Eigen::Vector3d &p0 = vertices[triangles[tidx](0)];
+            const Eigen::Vector3d &p1 = vertices[triangles[tidx](1)];
+            const Eigen::Vector3d &p2 = vertices[triangles[tidx](2)];
+            triangle_min_[tidx] = p0.cwiseMin(p1).cwiseMin(p2);
+            triangle_max_[tidx] = p0.cwiseMax(p1).cwiseMax(p2);
+            const Eigen::Vector3d centroid =
+                    0.5 * (triangle_min_[tidx] + triangle_max_[tidx]);
+            min_centroid = min_centroid.cwiseMin(centroid);
+            max_centroid = max_centroid.cwiseMax(centroid);
+        }
+
+        const double extent = (max_centroid - min_centroid).maxCoeff();
+        const double scale = extent > 0 ? double(kMortonCells - 1) / extent : 0;
+        std::vector<std::pair<uint64_t, int>> codes(n_triangles);
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+        for (int64_t tidx = 0; tidx < n_triangles; ++tidx) {
+            const Eigen::Vector3d cell =
+                    (0.5 * (triangle_min_[tidx] + triangle_max_[tidx]) -
+                     min_centroid) *
+                    scale;
+            uint64_t code = 0;
+            for (int i = 0; i < 3; ++i) {
+                code |= SpreadBits3(uint64_t(cell(i))) << i;
+            }
+            codes[tidx] = std::make_pair(code, int(tidx));
+        }
+        tbb::parallel_sort(codes.begin(), codes.end());
+        order_.resize(n_triangles);
+        for (int64_t idx = 0; idx < n_triangles; ++idx) {
+            order_[idx] = codes[idx].second;
+        }
+
+        if (n_triangles > 0) {
+            nodes_.reserve(2 * n_triangles / kLeafSize + 1);
+            nodes_.push_back(Node{});
+            Build(0, 0, int(n_triangles));
+        }
+    }
+
+    /// Calls \p func(tidx) for every triangle whose bounding box overlaps the
+    /// box from \p min_bound to \p max_bound. Stops when func returns false.
+    template <typename Func>
+    void Query(const Eigen::Vector3d &min_bound,
+               const Eigen::Vector3d &max_bound,
+               Func func) const {
+        if (nodes_.empty()) {
+            return;
+        }
+        int stack[64];
+        int stack_size = 0;
+        stack[stack_size++] = 0;
+        while (stack_size > 0) {
+            const Node &node = nodes_[stack[--stack_size]];
+            if (!IntersectionTest::AABBAABB(min_bound, max_bound,
+                                            node.min_bound_,
+                                            node.max_bound_)) {
+                continue;
+            }
+            if (node.left_ < 0) {
+                for (int idx = node.begin_; idx < node.end_; ++idx) {
+                    const int tidx = order_[idx];
+                    if (IntersectionTest::AABBAABB(
+                                min_bound, max_bound, triangle_min_[tidx],
+                                triangle_max_[tidx]) &&
+                        !func(tidx)) {
+                        return;
+                    }
+                }
+            } else {
+                stack[stack_size++] = node.left_;
+                stack[stack_size++] = node.left_ + 1;
+            }
+        }
+    }
+
+    const Eigen::Vector3d &GetTriangleMinBound(int tidx) const {
+        return triangle_min_[tidx];
+    }
+    const Eigen::Vector3d &GetTriangleMaxBound(int tidx) const {
+        return triangle_max_[tidx];
+    }
+
+private:
+    struct Node {
+        Eigen::Vector3d min_bound_;
+        Eigen::Vector3d max_bound_;
+        /// Range of order_ covered by the node.
+        int begin_;
+        int end_;
+        /// Index of the left child, the right child follows it. -1 for
+        /// leaves.
+        int left_;
+    };
+
+    static constexpr int kLeafSize = 4;
+    static constexpr uint64_t kMortonCells = 1 << 21;
+
+    static uint64_t SpreadBits3(uint64_t v) {
+        v &= 0x1fffff;
+        v = (v | v << 32) & 0x1f00000000ffff;
+        v = (v | v << 16) & 0x1f0000ff0000ff;
+        v = (v | v << 8) & 0x100f00f00f00f00f;
+        v = (v | v << 4) & 0x10c30c30c30c30c3;
+        v = (v | v << 2) & 0x1249249249249249;
+        return v;
+    }
+
+    /// Fills in node \p nidx for order_[begin, end) and adds its subtree.
+    /// The depth is logarithmic, as the ranges are split in halves.
+    void Build(int nidx, int begin, int end) {
+        Node &node = nodes_[nidx];
+        node.begin_ = begin;
+        node.end_ = end;
+        node.left_ = -1;
+        if (end - begin <= kLeafSize) {
+            node.min_bound_ = triangle_min_[order_[begin]];
+            node.max_bound_ = triangle_max_[order_[begin]];
+            for (int idx = begin + 1; idx < end; ++idx) {
+                node.min_bound_ =
+                        node.min_bound_.cwiseMin(triangle_min_[order_[idx]]);
+                node.max_bound_ =
+                        node.max_bound_.cwiseMax(triangle_max_[order_[idx]]);
+            }
+            return;
+        }
+        // The children are stored next to each other.
+        const int left = int(nodes_.size());
+        nodes_[nidx].left_ = left;
+        nodes_.resize(nodes_.size() + 2);
+        const int mid = begin + (end - begin) / 2;
+        Build(left, begin, mid);
+        Build(left + 1, mid, end);
+        nodes_[nidx].min_bound_ =
+                nodes_[left].min_bound_.cwiseMin(nodes_[left + 1].min_bound_);
+        nodes_[nidx].max_bound_ =
+                nodes_[left].max_bound_.cwiseMax(nodes_[left + 1].max_bound_);
+    }
+
+    std::vector<Eigen::Vector3d> triangle_min_;
+    std::vector<Eigen::Vector3d> triangle_max_;
+    std::vector<int> order_;
+    std::vector<Node> nodes_;
+};
+
+bool SharesVertex(const Eigen::Vector3i &tria_p,
+                  const Eigen::Vector3i &tria_q) {
+    for (int i = 0; i < 3; ++i) {
+        for (int j = 0; j < 3; ++j) {
+            if (tria_p(i) == tria_q(j)) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+/// Calls \p func(tidx0, tidx1) in parallel for every pair of triangles
+/// tidx0 < tidx1 of \p mesh that intersect and do not share a vertex. Stops
+/// early when func returns false.
+template <typename Func>
+void ForEachSelfIntersection(const TriangleMesh &mesh, Func func) {
+    const auto &vertices = mesh.vertices_;
+    const auto &triangles = mesh.triangles_;
+    const TriangleBVH bvh(vertices, triangles);
+    std::atomic<bool> stop(false);
+#pragma omp parallel for schedule(dynamic, 256) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int tidx0 = 0; tidx0 < int(triangles.size()); ++tidx0) {
+        if (stop.load(std::memory_order_relaxed)) {
+            continue;
+        }
+        const Eigen::Vector3i &tria_p = triangles[tidx0];
+        const Eigen::Vector3d &p0 = vertices[tria_p(0)];
+        const Eigen::Vector3d &p1 = vertices[tria_p(1)];
+        const Eigen::Vector3d &p2 = vertices[tria_p(2)];
+        bvh.Query(bvh.GetTriangleMinBound(tidx0),
+                  bvh.GetTriangleMaxBound(tidx0), [&](int tidx1) {
+                      const Eigen::Vector3i &tria_q = triangles[tidx1];
+                      if (tidx1 <= tidx0 || SharesVertex(tria_p, tria_q) ||
+                          !IntersectionTest::TriangleTriangle3d(
+                                  p0, p1, p2, vertices[tria_q(0)],
+                                  vertices[tria_q(1)], vertices[tria_q(2)])) {
+                          return true;
+                      }
+                      if (!func(tidx0, tidx1)) {
+                          stop = true;
+                      }
+                      return !stop.load(std::memory_order_relaxed);
+                  });
+    }
+}
+
+}  // namespace
+
+std::vector<Eigen::Vector2i> TriangleMesh::GetSelfIntersectingTriangles()
+        const {
+    std::vector<Eigen::Vector2i> self_intersecting_triangles;
+    ForEachSelfIntersection(*this, [&](int tidx0, int tidx1) {
+#pragma omp critical(GetSelfIntersectingTriangles)
+        self_intersecting_triangles.push_back(Eigen::Vector2i(tidx0, tidx1));
+        return true;
+    });
+    // The pairs are found in parallel, they are returned in the order of the
+    // serial loop over all pairs.
+    tbb::parallel_sort(self_intersecting_triangles.begin(),
+                       self_intersecting_triangles.end(),
+                       [](const Eigen::Vector2i &a, const Eigen::Vector2i &b) {
+                           return a(0) < b(0) || (a(0) == b(0) && a(1) < b(1));
+                       });
+    return self_intersecting_triangles;
+}
+
+bool TriangleMesh::IsSelfIntersecting() const {
+    std::atomic<bool> is_self_intersecting(false);
+    ForEachSelfIntersection(*this, [&](int, int) {
+        is_self_intersecting = true;
+        return false;
+    });
+    return is_self_intersecting;
+}
+
+bool TriangleMesh::IsIntersecting(const TriangleMesh &other) const {
+    if (!IsBoundingBoxIntersecting(other)) {
+        return false;
+    }
+    const TriangleBVH bvh(other.vertices_, other.triangles_);
+    std::atomic<bool> is_intersecting(false);
+#pragma omp parallel for schedule(dynamic, 256) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int tidx0 = 0; tidx0 < int(triangles_.size()); ++tidx0) {
+        if (is_intersecting.load(std::memory_order_relaxed)) {
+            continue;
+        }
+        const Eigen::Vector3i &tria_p = triangles_[tidx0];
+        const Eigen::Vector3d &p0 = vertices_[tria_p(0)];
+        const Eigen::Vector3d &p1 = vertices_[tria_p(1)];
+        const Eigen::Vector3d &p2 = vertices_[tria_p(2)];
+        bvh.Query(p0.cwiseMin(p1).cwiseMin(p2), p0.cwiseMax(p1).cwiseMax(p2),
+                  [&](int tidx1) {
+                      const Eigen::Vector3i &tria_q = other.triangles_[tidx1];
+                      if (IntersectionTest::TriangleTriangle3d(
+                                  p0, p1, p2, other.vertices_[tria_q(0)],
+                                  other.vertices_[tria_q(1)],
+                                  other.vertices_[tria_q(2)])) {
+                          is_intersecting = true;
+                      }
+                      return !is_intersecting.load(std::memory_order_relaxed);
+                  });
+    }
+    return is_intersecting;
+}
+
+}  // namespace geometry
+}  // namespace open3d
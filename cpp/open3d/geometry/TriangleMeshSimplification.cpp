@@ -304,13 +304,10 @@ std::shared_ptr<TriangleMesh> TriangleMesh::SimplifyQuadricDecimation(
     }
 
     // For boundary edges add perpendicular plane quadric
-    auto edge_triangle_count = GetEdgeToTrianglesMap();
-    auto AddPerpPlaneQuadric = [&](int vidx0, int vidx1, int vidx2,
+    const auto edge_index = GetEdgeIndex();
+    auto AddPerpPlaneQuadric = [&](int eidx, int vidx0, int vidx1, int vidx2,
                                    double area) {
-        int min = std::min(vidx0, vidx1);
-        int max = std::max(vidx0, vidx1);
-        Eigen::Vector2i edge(min, max);
-        if (edge_triangle_count[edge].size() != 1) {
+        if (edge_index->NumEdgeTriangles(eidx) != 1) {
             return;
         }
         const auto& vert0 = mesh->vertices_[vidx0];
@@ -324,10 +321,11 @@ std::shared_ptr<TriangleMesh> TriangleMesh::SimplifyQuadricDecimation(
     };
     for (size_t tidx = 0; tidx < triangles_.size(); ++tidx) {
         const auto& tria = triangles_[tidx];
+        const auto& edges = edge_index->triangle_edges_[tidx];
         double area = triangle_areas[tidx];
-        AddPerpPlaneQuadric(tria(0), tria(1), tria(2), area);
-        AddPerpPlaneQuadric(tria(1), tria(2), tria(0), area);
-        AddPerpPlaneQuadric(tria(2), tria(0), tria(1), area);
+        AddPerpPlaneQuadric(edges(0), tria(0), tria(1), tria(2), area);
+        AddPerpPlaneQuadric(edges(1), tria(1), tria(2), tria(0), area);
+        AddPerpPlaneQuadric(edges(2), tria(2), tria(0), tria(1), area);
     }
 
     // Get valid edges and compute cost
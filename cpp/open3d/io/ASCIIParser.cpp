@@ -0,0 +1,274 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/io/ASCIIParser.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+
+namespace open3d {
+namespace io {
+
+namespace {
+
+// Powers of ten that are exactly representable as double.
+constexpr double kExactPowersOf10[] = {
+        1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+        1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+
+inline bool IsDigit(char c) { return c >= '0' && c <= '9'; }
+
+// Whitespace that separates the numbers of a line.
+inline bool IsBlank(char c) {
+    return c == ' ' || c == '\t' || c == '\r' || c == '\v' || c == '\f';
+}
+
+const char *ParseDoubleWithStrtod(const char *begin,
+                                  const char *end,
+                                  double &value) {
+    char buffer[128];
+    const char *token_end = begin;
+    while (token_end < end && token_end - begin < 127 && *token_end != '\n' &&
+           !IsBlank(*token_end)) {
+        ++token_end;
+    }
+    const size_t length = token_end - begin;
+    std::memcpy(buffer, begin, length);
+    buffer[length] = '\0';
+    char *parsed_end = nullptr;
+    value = std::strtod(buffer, &parsed_end);
+    return begin + (parsed_end - buffer);
+}
+
+// Parses the first num_values numbers of the line [begin, end) into values.
+bool ParseLine(const char *begin,
+               const char *end,
+               int num_values,
+               double *values) {
+    const char *ptr = begin;
+    for (int i = 0; i < num_values; ++i) {
+        while (ptr < end && IsBlank(*ptr)) {
+            ++ptr;
+        }
+        const char *number_end = ParseDouble(ptr, end, values[i]);
+        if (number_end == ptr) {
+            return false;
+        }
+        ptr = number_end;
+    }
+    return true;
+}
+
+}  // namespace
+
+const char *ParseDouble(const char *begin, const char *end, double &value) {
+    const char *ptr = begin;
+    bool negative = false;
+    if (ptr < end && (*ptr == '-' || *ptr == '+')) {
+        negative = *ptr == '-';
+        ++ptr;
+    }
+
+    // Accumulate up to 19 significant digits, which cannot overflow uint64.
+    uint64_t mantissa = 0;
+    int num_significant = 0;
+    int exponent = 0;
+    bool has_digits = false;
+    while (ptr < end && IsDigit(*ptr)) {
+        if (mantissa != 0 || *ptr != '0') {
+            ++num_significant;
+        }
+        if (num_significant <= 19) {
+            mantissa = mantissa * 10 + (*ptr - '0');
+        } else {
+            ++exponent;
+        }
+        has_digits = true;
+        ++ptr;
+    }
+    if (ptr < end && *ptr == '.') {
+        ++ptr;
+        while (ptr < end && IsDigit(*ptr)) {
+            if (mantissa != 0 || *ptr != '0') {
+                ++num_significant;
+            }
+            if (num_significant <= 19) {
+                mantissa = mantissa * 10 + (*ptr - '0');
+                --exponent;
+            }
+            has_digits = true;
+            ++ptr;
+        }
+    }
+    if (!has_digits) {
+        // "inf", "nan", or not a number at all.
+        return ParseDoubleWithStrtod(begin, end, value);
+    }
+    if (ptr < end && (*ptr == 'e' || *ptr == 'E')) {
+        const char *exponent_ptr = ptr + 1;
+        bool negative_exponent = false;
+        if (exponent_ptr < end &&
+            (*exponent_ptr == '-' || *exponent_ptr == '+')) {
+            negative_exponent = *exponent_ptr == '-';
+            ++exponent_ptr;
+        }
+        if (exponent_ptr == end || !IsDigit(*exponent_ptr)) {
+            return ParseDoubleWithStrtod(begin, end, value);
+        }
+        int explicit_exponent = 0;
+        while (exponent_ptr < end && IsDigit(*exponent_ptr)) {
+            if (explicit_exponent < 100000) {
+                explicit_exponent = explicit_exponent * 10 +
+                                    (*exponent_ptr - '0');
+            }
+            ++exponent_ptr;
+        }
+        exponent += negative_exponent ? -explicit_exponent : explicit_exponent;
+        ptr = exponent_ptr;
+    }
+
+    // A single multiplication or division of two exact doubles is correctly
+    // rounded, anything else, e.g. hex floats, is left to strtod.
+    const bool is_delimited = ptr == end || *ptr == '\n' || IsBlank(*ptr);
+    if (!is_delimited || num_significant > 15 || exponent < -22 ||
+        exponent > 22) {
+        if (mantissa == 0 && is_delimited) {
+            value = negative ? -0.0 : 0.0;
+            return ptr;
+        }
+        return ParseDoubleWithStrtod(begin, end, value);
+    }
+    value = static_cast<double>(mantissa);
+    if (exponent < 0) {
+        value /= kExactPowersOf10[-exponent];
+    } else {
+        value *= kExactPowersOf10[exponent];
+    }
+    if (negative) {
+        value = -value;
+    }
+    return ptr;
+}
+
+ASCIIRows ParseASCIIRows(
+        const char *begin,
+        const char *end,
+        int num_values,
+        int64_t max_rows,
+        bool skip_invalid_lines,
+        const std::function<void(int64_t, int64_t)> &update_progress) {
+    struct Chunk {
+        std::vector<double> values_;
+        const char *invalid_line_ = nullptr;
+    };
+
+    ASCIIRows rows(num_values);
+    rows.end_ = begin;
+    const int num_threads = utility::EstimateMaxThreads();
+    const int64_t chunk_size = std::max<int64_t>(
+            1 << 16, std::min<int64_t>(1 << 22, (end - begin) / num_threads));
+
+    const char *batch_begin = begin;
+    bool done = max_rows == 0;
+    while (batch_begin < end && !done) {
+        // Split the next batch into one chunk per thread, at line breaks.
+        std::vector<const char *> bounds = {batch_begin};
+        while (static_cast<int>(bounds.size()) <= num_threads &&
+               bounds.back() < end) {
+            const char *chunk_end =
+                    bounds.back() + std::min<int64_t>(chunk_size,
+                                                      end - bounds.back());
+            chunk_end = std::find(chunk_end - 1, end, '\n');
+            bounds.push_back(chunk_end == end ? end : chunk_end + 1);
+        }
+
+        const int num_chunks = static_cast<int>(bounds.size()) - 1;
+        std::vector<Chunk> chunks(num_chunks);
+#pragma omp parallel for schedule(static) num_threads(num_threads)
+        for (int chunk = 0; chunk < num_chunks; ++chunk) {
+            std::vector<double> &values = chunks[chunk].values_;
+            values.reserve((bounds[chunk + 1] - bounds[chunk]) / 8);
+            std::vector<double> line_values(num_values);
+            const char *line = bounds[chunk];
+            while (line < bounds[chunk + 1]) {
+                const char *line_end = std::find(line, bounds[chunk + 1], '\n');
+                if (ParseLine(line, line_end, num_values, line_values.data())) {
+                    values.insert(values.end(), line_values.begin(),
+                                  line_values.end());
+                } else if (!skip_invalid_lines) {
+                    chunks[chunk].invalid_line_ = line;
+                    break;
+                }
+                line = line_end + 1;
+            }
+        }
+
+        for (int chunk = 0; chunk < num_chunks; ++chunk) {
+            const int64_t num_chunk_rows =
+                    static_cast<int64_t>(chunks[chunk].values_.size()) /
+                    num_values;
+            rows.num_rows_ += num_chunk_rows;
+            rows.chunk_offsets_.push_back(rows.num_rows_);
+            rows.chunks_.push_back(std::move(chunks[chunk].values_));
+            rows.end_ = bounds[chunk + 1];
+            if (max_rows >= 0 && rows.num_rows_ >= max_rows) {
+                // Find the end of the last row that is kept.
+                int64_t num_kept = max_rows - (rows.num_rows_ - num_chunk_rows);
+                std::vector<double> line_values(num_values);
+                const char *line = bounds[chunk];
+                while (num_kept > 0) {
+                    const char *line_end =
+                            std::find(line, bounds[chunk + 1], '\n');
+                    if (ParseLine(line, line_end, num_values,
+                                  line_values.data())) {
+                        --num_kept;
+                    }
+                    line = line_end == end ? end : line_end + 1;
+                }
+                rows.end_ = line;
+                rows.num_rows_ = max_rows;
+                done = true;
+                break;
+            }
+            if (chunks[chunk].invalid_line_) {
+                rows.invalid_line_ = chunks[chunk].invalid_line_;
+                rows.end_ = rows.invalid_line_;
+                done = true;
+                break;
+            }
+        }
+        batch_begin = bounds.back();
+        if (update_progress) {
+            update_progress(batch_begin - begin, rows.num_rows_);
+        }
+    }
+    return rows;
+}
+
+}  // namespace io
+}  // namespace open3d
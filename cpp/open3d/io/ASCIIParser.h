@@ -0,0 +1,136 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+#include "open3d/utility/Parallel.h"
+
+namespace open3d {
+namespace io {
+
+/// \class ASCIIRows
+///
+/// \brief Rows of numbers parsed from a text file by ParseASCIIRows().
+///
+/// The rows are kept in the per-thread chunks they were parsed into, so that
+/// readers can scatter them into their outputs in parallel without another
+/// intermediate copy.
+class ASCIIRows {
+public:
+    explicit ASCIIRows(int num_values) : num_values_(num_values) {}
+
+    /// Returns the number of rows.
+    int64_t NumRows() const { return num_rows_; }
+
+    /// Returns the number of values per row.
+    int NumValues() const { return num_values_; }
+
+    /// Returns the start of the first line that could not be parsed, or
+    /// nullptr. Only set if invalid lines are not skipped.
+    const char *GetInvalidLine() const { return invalid_line_; }
+
+    /// Returns where parsing stopped: the start of the line after the last
+    /// row, the invalid line, or the end of the text. Parsing the rest of a
+    /// text in pieces can continue from here.
+    const char *GetEnd() const { return end_; }
+
+    /// Calls \p func(row_index, values) for every row in parallel, where
+    /// values points to the NumValues() numbers of the row.
+    template <typename Func>
+    void ForEachRow(Func func) const {
+        const int64_t num_chunks = static_cast<int64_t>(chunks_.size());
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+        for (int64_t chunk = 0; chunk < num_chunks; ++chunk) {
+            const int64_t end = std::min(
+                    chunk_offsets_[chunk + 1], num_rows_);
+            const double *values = chunks_[chunk].data();
+            for (int64_t row = chunk_offsets_[chunk]; row < end; ++row) {
+                func(row, values);
+                values += num_values_;
+            }
+        }
+    }
+
+private:
+    friend ASCIIRows ParseASCIIRows(
+            const char *begin,
+            const char *end,
+            int num_values,
+            int64_t max_rows,
+            bool skip_invalid_lines,
+            const std::function<void(int64_t, int64_t)> &update_progress);
+
+    int num_values_;
+    int64_t num_rows_ = 0;
+    const char *invalid_line_ = nullptr;
+    const char *end_ = nullptr;
+    std::vector<std::vector<double>> chunks_;
+    std::vector<int64_t> chunk_offsets_ = {0};
+};
+
+/// \brief Parses rows of whitespace separated numbers from a text buffer in
+/// parallel.
+///
+/// The buffer is split at line breaks into chunks that are parsed by
+/// different threads. A line is parsed like sscanf with "%lf %lf ..." and
+/// \p num_values conversions: it yields a row if it starts with \p num_values
+/// numbers, any further content of the line is ignored. Numbers are converted
+/// with the same rounding as strtod.
+///
+/// \param begin Start of the text, e.g. a memory-mapped file. The text does
+/// not need to be null-terminated.
+/// \param end End of the text.
+/// \param num_values Number of values per row.
+/// \param max_rows Stop after this many rows, -1 to parse the whole text.
+/// \param skip_invalid_lines If true, lines without \p num_values numbers are
+/// skipped. Otherwise parsing stops at the first such line, see
+/// ASCIIRows::GetInvalidLine().
+/// \param update_progress Called with the number of bytes and rows parsed so
+/// far after every batch of chunks.
+ASCIIRows ParseASCIIRows(
+        const char *begin,
+        const char *end,
+        int num_values,
+        int64_t max_rows = -1,
+        bool skip_invalid_lines = true,
+        const std::function<void(int64_t, int64_t)> &update_progress = {});
+
+/// \brief Parses a floating point number from [\p begin, \p end).
+///
+/// Uses an exact fast path for numbers with up to 15 significant digits and
+/// falls back to strtod otherwise, so the result always matches strtod.
+/// \return The end of the number, or \p begin if there is no number.
+const char *ParseDouble(const char *begin, const char *end, double &value);
+
+}  // namespace io
+}  // namespace open3d
@@ -0,0 +1,166 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/io/LZFCompression.h"
+
+#include <liblzf/lzf.h>
+
+#include <algorithm>
+#include <cstring>
+
+#include "open3d/utility/Parallel.h"
+
+namespace open3d {
+namespace io {
+
+namespace {
+
+// Size of the independently compressed chunks. DecompressLZF() looks for
+// chunk boundaries at multiples of this size, so changing it only disables
+// parallel decoding of files written before the change.
+constexpr uint32_t kLZFChunkSize = 1 << 20;
+
+struct LZFSegment {
+    uint32_t in_begin_;
+    uint32_t out_begin_;
+};
+
+/// Scans the LZF instructions of \p in and returns the segments starting at
+/// every multiple of kLZFChunkSize in the output, if no back reference
+/// crosses a segment start. Returns an empty list otherwise, i.e. for
+/// streams that were not compressed in chunks, or corrupt streams.
+std::vector<LZFSegment> FindLZFSegments(const uint8_t *in,
+                                        uint32_t in_len,
+                                        uint32_t out_len) {
+    std::vector<LZFSegment> segments = {{0, 0}};
+    uint32_t ip = 0;
+    uint64_t op = 0;
+    uint64_t next_segment = kLZFChunkSize;
+    while (ip < in_len) {
+        if (op == next_segment) {
+            segments.push_back({ip, static_cast<uint32_t>(op)});
+            next_segment += kLZFChunkSize;
+        } else if (op > next_segment) {
+            return {};
+        }
+        const uint32_t ctrl = in[ip++];
+        if (ctrl < (1 << 5)) {
+            // Literal run of ctrl + 1 bytes.
+            ip += ctrl + 1;
+            op += ctrl + 1;
+        } else {
+            // Back reference of len + 2 bytes.
+            uint32_t len = ctrl >> 5;
+            if (len == 7) {
+                if (ip >= in_len) return {};
+                len += in[ip++];
+            }
+            if (ip >= in_len) return {};
+            const uint64_t offset = ((ctrl & 0x1f) << 8) + in[ip++] + 1;
+            if (op < segments.back().out_begin_ + offset) return {};
+            op += len + 2;
+        }
+    }
+    if (ip != in_len || op != out_len) return {};
+    return segments;
+}
+
+}  // namespace
+
+bool CompressLZF(const void *data,
+                 uint32_t size,
+                 std::vector<char> &compressed) {
+    const char *input = static_cast<const char *>(data);
+    const int64_t num_chunks = (int64_t(size) + kLZFChunkSize - 1) /
+                               kLZFChunkSize;
+    std::vector<std::vector<char>> chunks(num_chunks);
+#pragma omp parallel for schedule(dynamic) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t chunk = 0; chunk < num_chunks; ++chunk) {
+        const uint32_t begin = static_cast<uint32_t>(chunk * kLZFChunkSize);
+        const uint32_t chunk_size = std::min(kLZFChunkSize, size - begin);
+        // LZF output is less than 104% of the input.
+        chunks[chunk].resize(chunk_size + chunk_size / 16 + 16);
+        chunks[chunk].resize(lzf_compress(input + begin, chunk_size,
+                                          chunks[chunk].data(),
+                                          static_cast<unsigned int>(
+                                                  chunks[chunk].size())));
+    }
+
+    uint64_t compressed_size = 0;
+    for (const std::vector<char> &chunk : chunks) {
+        if (chunk.empty()) {
+            return false;
+        }
+        compressed_size += chunk.size();
+    }
+    if (compressed_size > UINT32_MAX) {
+        return false;
+    }
+    compressed.clear();
+    compressed.reserve(compressed_size);
+    for (const std::vector<char> &chunk : chunks) {
+        compressed.insert(compressed.end(), chunk.begin(), chunk.end());
+    }
+    return true;
+}
+
+bool DecompressLZF(const void *compressed,
+                   uint32_t compressed_size,
+                   void *data,
+                   uint32_t size) {
+    const uint8_t *input = static_cast<const uint8_t *>(compressed);
+    uint8_t *output = static_cast<uint8_t *>(data);
+    std::vector<LZFSegment> segments;
+    if (size > kLZFChunkSize) {
+        segments = FindLZFSegments(input, compressed_size, size);
+    }
+    if (segments.size() <= 1) {
+        return lzf_decompress(input, compressed_size, output, size) == size;
+    }
+
+    segments.push_back({compressed_size, size});
+    const int64_t num_segments = static_cast<int64_t>(segments.size()) - 1;
+    bool success = true;
+#pragma omp parallel for schedule(dynamic) reduction(&& : success) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t i = 0; i < num_segments; ++i) {
+        const uint32_t in_len =
+                segments[i + 1].in_begin_ - segments[i].in_begin_;
+        const uint32_t out_len =
+                segments[i + 1].out_begin_ - segments[i].out_begin_;
+        if (lzf_decompress(input + segments[i].in_begin_, in_len,
+                           output + segments[i].out_begin_,
+                           out_len) != out_len) {
+            success = false;
+        }
+    }
+    return success;
+}
+
+}  // namespace io
+}  // namespace open3d
@@ -0,0 +1,62 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+namespace open3d {
+namespace io {
+
+/// \brief Compresses \p size bytes at \p data with LZF.
+///
+/// The input is split into fixed-size chunks that are compressed in
+/// parallel. The concatenated chunks still form a single valid LZF stream
+/// that any LZF decoder can read, while DecompressLZF() can decode the
+/// chunks in parallel again.
+///
+/// \param compressed Receives the compressed stream.
+/// \return false if the data could not be compressed.
+bool CompressLZF(const void *data,
+                 uint32_t size,
+                 std::vector<char> &compressed);
+
+/// \brief Decompresses an LZF stream into \p size bytes at \p data.
+///
+/// Streams written by CompressLZF() are decoded in parallel, other streams
+/// are decoded serially.
+///
+/// \return false if the stream is corrupt or does not decompress into
+/// exactly \p size bytes.
+bool DecompressLZF(const void *compressed,
+                   uint32_t compressed_size,
+                   void *data,
+                   uint32_t size);
+
+}  // namespace io
+}  // namespace open3d
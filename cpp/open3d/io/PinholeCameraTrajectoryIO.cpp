@@ -57,6 +57,7 @@ static const std::unordered_map<
                 {"log", ReadPinholeCameraTrajectoryFromLOG},
                 {"json", ReadPinholeCameraTrajectoryFromJSON},
                 {"txt", ReadPinholeCameraTrajectoryFromTUM},
+                {"bin", ReadPinholeCameraTrajectoryFromBIN},
         };
 
 static const std::unordered_map<
@@ -67,6 +68,7 @@ static const std::unordered_map<
                 {"log", WritePinholeCameraTrajectoryToLOG},
                 {"json", WritePinholeCameraTrajectoryToJSON},
                 {"txt", WritePinholeCameraTrajectoryToTUM},
+                {"bin", WritePinholeCameraTrajectoryToBIN},
         };
 
 }  // unnamed namespace
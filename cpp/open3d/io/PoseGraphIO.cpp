@@ -26,11 +26,14 @@
 
 #include "open3d/io/PoseGraphIO.h"
 
+#include <cmath>
+#include <cstdio>
 #include <unordered_map>
 
 #include "open3d/io/IJsonConvertibleIO.h"
 #include "open3d/utility/FileSystem.h"
 #include "open3d/utility/Logging.h"
+#include "open3d/utility/Parallel.h"
 
 namespace open3d {
 
@@ -42,10 +45,102 @@ bool ReadPoseGraphFromJSON(const std::string &filename,
     return ReadIJsonConvertible(filename, pose_graph);
 }
 
+/// Appends a double with enough digits to round-trip. Non-finite values are
+/// written the same way as jsoncpp's default writer.
+void AppendJsonNumber(std::string &out, double v) {
+    if (std::isnan(v)) {
+        out += "null";
+    } else if (std::isinf(v)) {
+        out += v < 0 ? "-1e+9999" : "1e+9999";
+    } else {
+        out += fmt::format("{:.17g}", v);
+    }
+}
+
+void AppendJsonArray(std::string &out, const double *data, int size) {
+    out += '[';
+    for (int i = 0; i < size; i++) {
+        if (i > 0) out += ", ";
+        AppendJsonNumber(out, data[i]);
+    }
+    out += ']';
+}
+
+std::string PoseGraphNodeToJsonString(
+        const pipelines::registration::PoseGraphNode &node) {
+    std::string out =
+            "\t\t{\"class_name\": \"PoseGraphNode\", \"version_major\": 1, "
+            "\"version_minor\": 0, \"pose\": ";
+    AppendJsonArray(out, node.pose_.data(), 16);
+    out += '}';
+    return out;
+}
+
+std::string PoseGraphEdgeToJsonString(
+        const pipelines::registration::PoseGraphEdge &edge) {
+    std::string out = fmt::format(
+            "\t\t{{\"class_name\": \"PoseGraphEdge\", \"version_major\": 1, "
+            "\"version_minor\": 0, \"source_node_id\": {}, "
+            "\"target_node_id\": {}, \"uncertain\": {}, \"confidence\": ",
+            edge.source_node_id_, edge.target_node_id_,
+            edge.uncertain_ ? "true" : "false");
+    AppendJsonNumber(out, edge.confidence_);
+    out += ", \"transformation\": ";
+    AppendJsonArray(out, edge.transformation_.data(), 16);
+    out += ", \"information\": ";
+    AppendJsonArray(out, edge.information_.data(), 36);
+    out += '}';
+    return out;
+}
+
+/// Streams the PoseGraph JSON document directly to disk instead of building a
+/// Json::Value tree first. Nodes and edges are formatted in parallel; the
+/// output is readable by ReadPoseGraphFromJSON and any other JSON parser.
 bool WritePoseGraphToJSON(
         const std::string &filename,
         const pipelines::registration::PoseGraph &pose_graph) {
-    return WriteIJsonConvertibleToJSON(filename, pose_graph);
+    const auto &nodes = pose_graph.nodes_;
+    const auto &edges = pose_graph.edges_;
+    std::vector<std::string> node_strings(nodes.size());
+    std::vector<std::string> edge_strings(edges.size());
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t i = 0; i < int64_t(nodes.size()); i++) {
+        node_strings[i] = PoseGraphNodeToJsonString(nodes[i]);
+    }
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t i = 0; i < int64_t(edges.size()); i++) {
+        edge_strings[i] = PoseGraphEdgeToJsonString(edges[i]);
+    }
+
+    FILE *file = utility::filesystem::FOpen(filename, "w");
+    if (file == NULL) {
+        utility::LogWarning("Write JSON failed: unable to open file: {}",
+                            filename);
+        return false;
+    }
+    auto write_array = [file](const std::vector<std::string> &strings) {
+        bool success = fputs("[\n", file) >= 0;
+        for (size_t i = 0; i < strings.size() && success; i++) {
+            success = fputs(strings[i].c_str(), file) >= 0 &&
+                      fputs(i + 1 < strings.size() ? ",\n" : "\n", file) >= 0;
+        }
+        return success && fputs("\t]", file) >= 0;
+    };
+    bool success = fputs("{\n\t\"class_name\": \"PoseGraph\",\n\t\"edges\": ",
+                         file) >= 0 &&
+                   write_array(edge_strings) &&
+                   fputs(",\n\t\"nodes\": ", file) >= 0 &&
+                   write_array(node_strings) &&
+                   fputs(",\n\t\"version_major\": 1,\n\t\"version_minor\": "
+                         "0\n}\n",
+                         file) >= 0;
+    fclose(file);
+    if (!success) {
+        utility::LogWarning("Write JSON failed: unexpected error.");
+    }
+    return success;
 }
 
 static const std::unordered_map<
@@ -54,6 +149,7 @@ static const std::unordered_map<
                            pipelines::registration::PoseGraph &)>>
         file_extension_to_pose_graph_read_function{
                 {"json", ReadPoseGraphFromJSON},
+                {"bin", ReadPoseGraphFromBIN},
         };
 
 static const std::unordered_map<
@@ -62,6 +158,7 @@ static const std::unordered_map<
                            const pipelines::registration::PoseGraph &)>>
         file_extension_to_pose_graph_write_function{
                 {"json", WritePoseGraphToJSON},
+                {"bin", WritePoseGraphToBIN},
         };
 
 }  // unnamed namespace
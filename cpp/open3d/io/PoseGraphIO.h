@@ -51,5 +51,13 @@ bool ReadPoseGraph(const std::string &filename,
 bool WritePoseGraph(const std::string &filename,
                     const pipelines::registration::PoseGraph &pose_graph);
 
+/// Compact binary format: fixed-size records for every node and edge, written
+/// and read without an intermediate JSON document (file_format/FileBIN.cpp).
+bool ReadPoseGraphFromBIN(const std::string &filename,
+                          pipelines::registration::PoseGraph &pose_graph);
+
+bool WritePoseGraphToBIN(const std::string &filename,
+                         const pipelines::registration::PoseGraph &pose_graph);
+
 }  // namespace io
 }  // namespace open3d
@@ -25,9 +25,12 @@
 // ----------------------------------------------------------------------------
 
 #include <cstdio>
+#include <cstring>
 #include <memory>
 
 #include "open3d/io/FeatureIO.h"
+#include "open3d/io/PinholeCameraTrajectoryIO.h"
+#include "open3d/io/PoseGraphIO.h"
 #include "open3d/utility/FileSystem.h"
 #include "open3d/utility/Logging.h"
 
@@ -46,8 +49,9 @@ bool ReadMatrixXdFromBINFile(FILE *file, Eigen::MatrixXd &mat) {
         utility::LogWarning("Read BIN failed: unexpected EOF.");
         return false;
     }
+    const size_t size = size_t(rows) * size_t(cols);
     mat.resize(rows, cols);
-    if (fread(mat.data(), sizeof(double), rows * cols, file) < rows * cols) {
+    if (fread(mat.data(), sizeof(double), size, file) < size) {
         utility::LogWarning("Read BIN failed: unexpected EOF.");
         return false;
     }
@@ -65,13 +69,89 @@ bool WriteMatrixXdToBINFile(FILE *file, const Eigen::MatrixXd &mat) {
         utility::LogWarning("Write BIN failed: unexpected error.");
         return false;
     }
-    if (fwrite(mat.data(), sizeof(double), rows * cols, file) < rows * cols) {
+    const size_t size = size_t(rows) * size_t(cols);
+    if (fwrite(mat.data(), sizeof(double), size, file) < size) {
         utility::LogWarning("Write BIN failed: unexpected error.");
         return false;
     }
     return true;
 }
 
+// PoseGraph and PinholeCameraTrajectory BIN files start with an 8-byte magic
+// string, a uint32 version and the uint64 element counts, followed by
+// fixed-size little-endian records (matrices are stored column-major):
+//   PoseGraph node:   pose (16 doubles)
+//   PoseGraph edge:   source, target, uncertain (3 x int32), confidence,
+//                     transformation (16 doubles), information (36 doubles)
+//   Trajectory entry: width, height (2 x int32), intrinsic matrix (9 doubles),
+//                     extrinsic (16 doubles)
+const char kPoseGraphBINMagic[8] = {'O', '3', 'D', 'P', 'G', 'R', 'P', 'H'};
+const char kTrajectoryBINMagic[8] = {'O', '3', 'D', 'T', 'R', 'A', 'J', 'S'};
+const uint32_t kBINVersion = 1;
+const size_t kPoseGraphNodeBINSize = 16 * sizeof(double);
+const size_t kPoseGraphEdgeBINSize =
+        3 * sizeof(int32_t) + (1 + 16 + 36) * sizeof(double);
+const size_t kTrajectoryBINSize =
+        2 * sizeof(int32_t) + (9 + 16) * sizeof(double);
+
+template <typename T>
+bool WriteBINValues(FILE *file, const T *data, size_t count) {
+    return fwrite(data, sizeof(T), count, file) == count;
+}
+
+template <typename T>
+bool ReadBINValues(FILE *file, T *data, size_t count) {
+    return fread(data, sizeof(T), count, file) == count;
+}
+
+bool WriteBINHeader(FILE *file,
+                    const char magic[8],
+                    const std::vector<uint64_t> &counts) {
+    return WriteBINValues(file, magic, 8) &&
+           WriteBINValues(file, &kBINVersion, 1) &&
+           WriteBINValues(file, counts.data(), counts.size());
+}
+
+/// Reads and validates the header, and checks that the remaining file size
+/// matches the element counts before anything is allocated.
+bool ReadBINHeader(FILE *file,
+                   const char magic[8],
+                   const std::vector<size_t> &record_sizes,
+                   std::vector<uint64_t> &counts) {
+    char file_magic[8];
+    uint32_t version;
+    counts.resize(record_sizes.size());
+    if (!ReadBINValues(file, file_magic, 8) ||
+        !ReadBINValues(file, &version, 1) ||
+        !ReadBINValues(file, counts.data(), counts.size())) {
+        utility::LogWarning("Read BIN failed: unexpected EOF.");
+        return false;
+    }
+    if (std::memcmp(file_magic, magic, 8) != 0 || version != kBINVersion) {
+        utility::LogWarning("Read BIN failed: unsupported file format.");
+        return false;
+    }
+    const long header_end = ftell(file);
+    if (header_end < 0 || fseek(file, 0, SEEK_END) != 0) {
+        utility::LogWarning("Read BIN failed: unable to seek.");
+        return false;
+    }
+    const uint64_t remaining = uint64_t(ftell(file) - header_end);
+    uint64_t expected = 0;
+    for (size_t i = 0; i < counts.size(); i++) {
+        if (counts[i] > remaining / record_sizes[i]) {
+            utility::LogWarning("Read BIN failed: unexpected EOF.");
+            return false;
+        }
+        expected += counts[i] * record_sizes[i];
+    }
+    if (expected != remaining || fseek(file, header_end, SEEK_SET) != 0) {
+        utility::LogWarning("Read BIN failed: unexpected file size.");
+        return false;
+    }
+    return true;
+}
+
 }  // unnamed namespace
 
 namespace io {
@@ -102,5 +182,134 @@ bool WriteFeatureToBIN(const std::string &filename,
     return success;
 }
 
+bool ReadPoseGraphFromBIN(const std::string &filename,
+                          pipelines::registration::PoseGraph &pose_graph) {
+    FILE *fid = utility::filesystem::FOpen(filename, "rb");
+    if (fid == NULL) {
+        utility::LogWarning("Read BIN failed: unable to open file: {}",
+                            filename);
+        return false;
+    }
+    std::vector<uint64_t> counts;
+    if (!ReadBINHeader(fid, kPoseGraphBINMagic,
+                       {kPoseGraphNodeBINSize, kPoseGraphEdgeBINSize},
+                       counts)) {
+        fclose(fid);
+        return false;
+    }
+    pose_graph.nodes_.resize(counts[0]);
+    pose_graph.edges_.resize(counts[1]);
+    bool success = true;
+    for (auto &node : pose_graph.nodes_) {
+        success = success && ReadBINValues(fid, node.pose_.data(), 16);
+    }
+    for (auto &edge : pose_graph.edges_) {
+        int32_t ids[3];
+        success = success && ReadBINValues(fid, ids, 3) &&
+                  ReadBINValues(fid, &edge.confidence_, 1) &&
+                  ReadBINValues(fid, edge.transformation_.data(), 16) &&
+                  ReadBINValues(fid, edge.information_.data(), 36);
+        edge.source_node_id_ = ids[0];
+        edge.target_node_id_ = ids[1];
+        edge.uncertain_ = ids[2] != 0;
+    }
+    fclose(fid);
+    if (!success) {
+        utility::LogWarning("Read BIN failed: unexpected EOF.");
+    }
+    return success;
+}
+
+bool WritePoseGraphToBIN(const std::string &filename,
+                         const pipelines::registration::PoseGraph &pose_graph) {
+    FILE *fid = utility::filesystem::FOpen(filename, "wb");
+    if (fid == NULL) {
+        utility::LogWarning("Write BIN failed: unable to open file: {}",
+                            filename);
+        return false;
+    }
+    bool success = WriteBINHeader(fid, kPoseGraphBINMagic,
+                                  {uint64_t(pose_graph.nodes_.size()),
+                                   uint64_t(pose_graph.edges_.size())});
+    for (const auto &node : pose_graph.nodes_) {
+        success = success && WriteBINValues(fid, node.pose_.data(), 16);
+    }
+    for (const auto &edge : pose_graph.edges_) {
+        const int32_t ids[3] = {int32_t(edge.source_node_id_),
+                                int32_t(edge.target_node_id_),
+                                int32_t(edge.uncertain_ ? 1 : 0)};
+        success = success && WriteBINValues(fid, ids, 3) &&
+                  WriteBINValues(fid, &edge.confidence_, 1) &&
+                  WriteBINValues(fid, edge.transformation_.data(), 16) &&
+                  WriteBINValues(fid, edge.information_.data(), 36);
+    }
+    fclose(fid);
+    if (!success) {
+        utility::LogWarning("Write BIN failed: unexpected error.");
+    }
+    return success;
+}
+
+bool ReadPinholeCameraTrajectoryFromBIN(
+        const std::string &filename,
+        camera::PinholeCameraTrajectory &trajectory) {
+    FILE *fid = utility::filesystem::FOpen(filename, "rb");
+    if (fid == NULL) {
+        utility::LogWarning("Read BIN failed: unable to open file: {}",
+                            filename);
+        return false;
+    }
+    std::vector<uint64_t> counts;
+    if (!ReadBINHeader(fid, kTrajectoryBINMagic, {kTrajectoryBINSize},
+                       counts)) {
+        fclose(fid);
+        return false;
+    }
+    trajectory.parameters_.resize(counts[0]);
+    bool success = true;
+    for (auto &parameter : trajectory.parameters_) {
+        int32_t size[2];
+        success = success && ReadBINValues(fid, size, 2) &&
+                  ReadBINValues(
+                          fid, parameter.intrinsic_.intrinsic_matrix_.data(),
+                          9) &&
+                  ReadBINValues(fid, parameter.extrinsic_.data(), 16);
+        parameter.intrinsic_.width_ = size[0];
+        parameter.intrinsic_.height_ = size[1];
+    }
+    fclose(fid);
+    if (!success) {
+        utility::LogWarning("Read BIN failed: unexpected EOF.");
+    }
+    return success;
+}
+
+bool WritePinholeCameraTrajectoryToBIN(
+        const std::string &filename,
+        const camera::PinholeCameraTrajectory &trajectory) {
+    FILE *fid = utility::filesystem::FOpen(filename, "wb");
+    if (fid == NULL) {
+        utility::LogWarning("Write BIN failed: unable to open file: {}",
+                            filename);
+        return false;
+    }
+    bool success = WriteBINHeader(fid, kTrajectoryBINMagic,
+                                  {uint64_t(trajectory.parameters_.size())});
+    for (const auto &parameter : trajectory.parameters_) {
+        const int32_t size[2] = {int32_t(parameter.intrinsic_.width_),
+                                 int32_t(parameter.intrinsic_.height_)};
+        success = success && WriteBINValues(fid, size, 2) &&
+                  WriteBINValues(
+                          fid, parameter.intrinsic_.intrinsic_matrix_.data(),
+                          9) &&
+                  WriteBINValues(fid, parameter.extrinsic_.data(), 16);
+    }
+    fclose(fid);
+    if (!success) {
+        utility::LogWarning("Write BIN failed: unexpected error.");
+    }
+    return success;
+}
+
 }  // namespace io
 }  // namespace open3d
@@ -24,17 +24,17 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
-#include <liblzf/lzf.h>
-
 #include <cstdint>
 #include <cstdio>
 #include <sstream>
 
 #include "open3d/io/FileFormatIO.h"
+#include "open3d/io/LZFCompression.h"
 #include "open3d/io/PointCloudIO.h"
 #include "open3d/utility/FileSystem.h"
 #include "open3d/utility/Helper.h"
 #include "open3d/utility/Logging.h"
+#include "open3d/utility/Parallel.h"
 #include "open3d/utility/ProgressReporters.h"
 
 // References for PCD file IO
@@ -476,61 +476,44 @@ bool ReadPCDData(FILE *file,
         }
         std::unique_ptr<char[]> buffer(new char[uncompressed_size]);
         reporter.Update(int(reporter_total * .2));
-        if (lzf_decompress(buffer_compressed.get(),
-                           (unsigned int)compressed_size, buffer.get(),
-                           (unsigned int)uncompressed_size) !=
-            uncompressed_size) {
+        if (!DecompressLZF(buffer_compressed.get(), compressed_size,
+                           buffer.get(), uncompressed_size)) {
             utility::LogWarning("[ReadPCDData] Uncompression failed.");
             pointcloud.Clear();
             return false;
         }
         for (const auto &field : header.fields) {
             const char *base_ptr = buffer.get() + field.offset * header.points;
+            const int stride = field.size * field.count;
             double progress =
                     double(base_ptr - buffer.get()) / uncompressed_size;
             reporter.Update(int(reporter_total * (progress + .2)));
-            if (field.name == "x") {
-                for (int i = 0; i < header.points; i++) {
-                    pointcloud.points_[i](0) = UnpackBinaryPCDElement(
-                            base_ptr + i * field.size * field.count, field.type,
-                            field.size);
-                }
-            } else if (field.name == "y") {
-                for (int i = 0; i < header.points; i++) {
-                    pointcloud.points_[i](1) = UnpackBinaryPCDElement(
-                            base_ptr + i * field.size * field.count, field.type,
-                            field.size);
-                }
-            } else if (field.name == "z") {
-                for (int i = 0; i < header.points; i++) {
-                    pointcloud.points_[i](2) = UnpackBinaryPCDElement(
-                            base_ptr + i * field.size * field.count, field.type,
-                            field.size);
-                }
-            } else if (field.name == "normal_x") {
-                for (int i = 0; i < header.points; i++) {
-                    pointcloud.normals_[i](0) = UnpackBinaryPCDElement(
-                            base_ptr + i * field.size * field.count, field.type,
-                            field.size);
-                }
-            } else if (field.name == "normal_y") {
-                for (int i = 0; i < header.points; i++) {
-                    pointcloud.normals_[i](1) = UnpackBinaryPCDElement(
-                            base_ptr + i * field.size * field.count, field.type,
-                            field.size);
-                }
-            } else if (field.name == "normal_z") {
-                for (int i = 0; i < header.points; i++) {
-                    pointcloud.normals_[i](2) = UnpackBinaryPCDElement(
-                            base_ptr + i * field.size * field.count, field.type,
-                            field.size);
-                }
-            } else if (field.name == "rgb" || field.name == "rgba") {
+            if (field.name == "rgb" || field.name == "rgba") {
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
                 for (int i = 0; i < header.points; i++) {
                     pointcloud.colors_[i] = UnpackBinaryPCDColor(
-                            base_ptr + i * field.size * field.count, field.type,
-                            field.size);
+                            base_ptr + i * stride, field.type, field.size);
                 }
+                continue;
+            }
+            std::vector<Eigen::Vector3d> *target = nullptr;
+            int component = 0;
+            if (field.name == "x" || field.name == "y" || field.name == "z") {
+                target = &pointcloud.points_;
+                component = field.name[0] - 'x';
+            } else if (field.name == "normal_x" || field.name == "normal_y" ||
+                       field.name == "normal_z") {
+                target = &pointcloud.normals_;
+                component = field.name[7] - 'x';
+            } else {
+                continue;
+            }
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+            for (int i = 0; i < header.points; i++) {
+                (*target)[i](component) = UnpackBinaryPCDElement(
+                        base_ptr + i * stride, field.type, field.size);
             }
         }
     }
@@ -702,8 +685,9 @@ bool WritePCDData(FILE *file,
         std::uint32_t buffer_size =
                 (std::uint32_t)(header.elementnum * header.points);
         std::unique_ptr<float[]> buffer(new float[buffer_size]);
-        std::unique_ptr<float[]> buffer_compressed(new float[buffer_size * 2]);
-        for (size_t i = 0; i < pointcloud.points_.size(); i++) {
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+        for (int i = 0; i < strip_size; i++) {
             const auto &point = pointcloud.points_[i];
             buffer[0 * strip_size + i] = (float)point(0);
             buffer[1 * strip_size + i] = (float)point(1);
@@ -720,25 +704,24 @@ bool WritePCDData(FILE *file,
                 const auto &color = pointcloud.colors_[i];
                 buffer[idx * strip_size + i] = ConvertRGBToFloat(color);
             }
-            if (i % 1000 == 0) {
-                reporter.Update(i);
-            }
         }
+        reporter.Update(int(report_total * 0.5));
         std::uint32_t buffer_size_in_bytes = buffer_size * sizeof(float);
-        std::uint32_t size_compressed =
-                lzf_compress(buffer.get(), buffer_size_in_bytes,
-                             buffer_compressed.get(), buffer_size_in_bytes * 2);
-        if (size_compressed == 0) {
+        std::vector<char> buffer_compressed;
+        if (!CompressLZF(buffer.get(), buffer_size_in_bytes,
+                         buffer_compressed)) {
             utility::LogWarning("[WritePCDData] Failed to compress data.");
             return false;
         }
+        std::uint32_t size_compressed =
+                static_cast<std::uint32_t>(buffer_compressed.size());
         utility::LogDebug(
                 "[WritePCDData] {:d} bytes data compressed into {:d} bytes.",
                 buffer_size_in_bytes, size_compressed);
         reporter.Update(int(report_total * 0.75));
         fwrite(&size_compressed, sizeof(size_compressed), 1, file);
         fwrite(&buffer_size_in_bytes, sizeof(buffer_size_in_bytes), 1, file);
-        fwrite(buffer_compressed.get(), 1, size_compressed, file);
+        fwrite(buffer_compressed.data(), 1, size_compressed, file);
     }
     reporter.Finish();
     return true;
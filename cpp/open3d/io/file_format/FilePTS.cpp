@@ -24,8 +24,10 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <algorithm>
 #include <cstdio>
 
+#include "open3d/io/ASCIIParser.h"
 #include "open3d/io/FileFormatIO.h"
 #include "open3d/io/PointCloudIO.h"
 #include "open3d/utility/FileSystem.h"
@@ -44,18 +46,23 @@ bool ReadPointCloudFromPTS(const std::string &filename,
                            geometry::PointCloud &pointcloud,
                            const ReadPointCloudOption &params) {
     try {
-        utility::filesystem::CFile file;
-        if (!file.Open(filename, "r")) {
+        utility::filesystem::MappedFile file;
+        if (!file.Open(filename)) {
             utility::LogWarning("Read PTS failed: unable to open file: {}",
                                 filename);
             return false;
         }
+        const char *data = reinterpret_cast<const char *>(file.GetData());
+        const char *data_end = data + file.GetSize();
+        auto next_line = [&](const char *line) {
+            const char *line_end = std::find(line, data_end, '\n');
+            return line_end == data_end ? data_end : line_end + 1;
+        };
+
         size_t num_of_pts = 0;
         size_t num_of_fields = 0;
-        const char *line_buffer;
-        if ((line_buffer = file.ReadLine())) {
-            sscanf(line_buffer, "%zu", &num_of_pts);
-        }
+        const char *start_pos = next_line(data);
+        sscanf(std::string(data, start_pos).c_str(), "%zu", &num_of_pts);
         if (num_of_pts <= 0) {
             utility::LogWarning("Read PTS failed: unable to read header.");
             return false;
@@ -65,10 +72,8 @@ bool ReadPointCloudFromPTS(const std::string &filename,
 
         pointcloud.Clear();
 
-        // Store data start position.
-        int64_t start_pos = ftell(file.GetFILE());
-
-        if ((line_buffer = file.ReadLine())) {
+        if (start_pos < data_end) {
+            const std::string line_buffer(start_pos, next_line(start_pos));
             num_of_fields = utility::SplitString(line_buffer, " ").size();
 
             if (num_of_fields == 7 || num_of_fields == 4) {
@@ -77,62 +82,46 @@ bool ReadPointCloudFromPTS(const std::string &filename,
                         "supported.");
             }
 
-            // X Y Z I R G B or X Y Z R G B.
-            if (num_of_fields == 7 || num_of_fields == 6) {
-                pointcloud.points_.resize(num_of_pts);
-                pointcloud.colors_.resize(num_of_pts);
-            }
-            // X Y Z I or X Y Z.
-            else if (num_of_fields == 4 || num_of_fields == 3) {
-                pointcloud.points_.resize(num_of_pts);
-            } else {
+            if (num_of_fields != 7 && num_of_fields != 6 &&
+                num_of_fields != 4 && num_of_fields != 3) {
                 utility::LogWarning("Read PTS failed: unknown pts format: {}",
                                     line_buffer);
                 return false;
             }
         }
 
-        // Go to data start position.
-        fseek(file.GetFILE(), start_pos, 0);
-
-        size_t idx = 0;
-        while (idx < num_of_pts && (line_buffer = file.ReadLine())) {
-            double x, y, z, i;
-            int r, g, b;
-            // X Y Z I R G B
-            if (num_of_fields == 7 &&
-                sscanf(line_buffer, "%lf %lf %lf %lf %d %d %d", &x, &y, &z, &i,
-                       &r, &g, &b) == 7) {
-                pointcloud.points_[idx] = Eigen::Vector3d(x, y, z);
-                pointcloud.colors_[idx] = utility::ColorToDouble(r, g, b);
-            }
-            // X Y Z R G B
-            else if (num_of_fields == 6 &&
-                     sscanf(line_buffer, "%lf %lf %lf %d %d %d", &x, &y, &z, &r,
-                            &g, &b) == 6) {
-                pointcloud.points_[idx] = Eigen::Vector3d(x, y, z);
-                pointcloud.colors_[idx] = utility::ColorToDouble(r, g, b);
-            }
-            // X Y Z I
-            else if (num_of_fields == 4 &&
-                     sscanf(line_buffer, "%lf %lf %lf %lf", &x, &y, &z, &i) ==
-                             4) {
-                pointcloud.points_[idx] = Eigen::Vector3d(x, y, z);
-            }
-            // X Y Z
-            else if (num_of_fields == 3 &&
-                     sscanf(line_buffer, "%lf %lf %lf", &x, &y, &z) == 3) {
-                pointcloud.points_[idx] = Eigen::Vector3d(x, y, z);
-            } else {
-                utility::LogWarning("Read PTS failed at line: {}. ",
-                                    line_buffer);
+        if (num_of_fields > 0) {
+            const ASCIIRows rows = ParseASCIIRows(
+                    start_pos, data_end, static_cast<int>(num_of_fields),
+                    static_cast<int64_t>(num_of_pts), false,
+                    [&](int64_t, int64_t num_rows) {
+                        reporter.Update(num_rows);
+                    });
+            if (rows.GetInvalidLine()) {
+                utility::LogWarning(
+                        "Read PTS failed at line: {}. ",
+                        std::string(rows.GetInvalidLine(),
+                                    next_line(rows.GetInvalidLine())));
                 return false;
             }
 
-            idx++;
-            if (idx % 1000 == 0) {
-                reporter.Update(idx);
+            // X Y Z I R G B or X Y Z R G B.
+            const bool has_colors = num_of_fields == 7 || num_of_fields == 6;
+            const int color_offset = num_of_fields == 7 ? 4 : 3;
+            pointcloud.points_.resize(rows.NumRows());
+            if (has_colors) {
+                pointcloud.colors_.resize(rows.NumRows());
             }
+            rows.ForEachRow([&](int64_t idx, const double *values) {
+                pointcloud.points_[idx] =
+                        Eigen::Vector3d(values[0], values[1], values[2]);
+                if (has_colors) {
+                    pointcloud.colors_[idx] = utility::ColorToDouble(
+                            static_cast<int>(values[color_offset]),
+                            static_cast<int>(values[color_offset + 1]),
+                            static_cast<int>(values[color_offset + 2]));
+                }
+            });
         }
 
         reporter.Finish();
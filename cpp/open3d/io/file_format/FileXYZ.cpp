@@ -26,6 +26,7 @@
 
 #include <cstdio>
 
+#include "open3d/io/ASCIIParser.h"
 #include "open3d/io/FileFormatIO.h"
 #include "open3d/io/PointCloudIO.h"
 #include "open3d/utility/FileSystem.h"
@@ -43,27 +44,28 @@ bool ReadPointCloudFromXYZ(const std::string &filename,
                            geometry::PointCloud &pointcloud,
                            const ReadPointCloudOption &params) {
     try {
-        utility::filesystem::CFile file;
-        if (!file.Open(filename, "r")) {
+        utility::filesystem::MappedFile file;
+        if (!file.Open(filename)) {
             utility::LogWarning("Read XYZ failed: unable to open file: {}",
                                 filename);
             return false;
         }
         utility::CountingProgressReporter reporter(params.update_progress);
-        reporter.SetTotal(file.GetFileSize());
+        reporter.SetTotal(file.GetSize());
+
+        const char *data = reinterpret_cast<const char *>(file.GetData());
+        const ASCIIRows rows = ParseASCIIRows(
+                data, data + file.GetSize(), 3, -1, true,
+                [&](int64_t num_bytes, int64_t) {
+                    reporter.Update(num_bytes);
+                });
 
         pointcloud.Clear();
-        int i = 0;
-        double x, y, z;
-        const char *line_buffer;
-        while ((line_buffer = file.ReadLine())) {
-            if (sscanf(line_buffer, "%lf %lf %lf", &x, &y, &z) == 3) {
-                pointcloud.points_.push_back(Eigen::Vector3d(x, y, z));
-            }
-            if (++i % 1000 == 0) {
-                reporter.Update(file.CurPos());
-            }
-        }
+        pointcloud.points_.resize(rows.NumRows());
+        rows.ForEachRow([&](int64_t idx, const double *values) {
+            pointcloud.points_[idx] =
+                    Eigen::Vector3d(values[0], values[1], values[2]);
+        });
         reporter.Finish();
 
         return true;
@@ -0,0 +1,279 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/io/rpc/AsyncConnection.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <future>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <zmq.hpp>
+
+#include "open3d/io/rpc/Connection.h"
+#include "open3d/io/rpc/ZMQContext.h"
+#include "open3d/utility/Logging.h"
+
+using namespace open3d::utility;
+
+namespace open3d {
+namespace io {
+namespace rpc {
+
+namespace {
+
+/// A queued or sent message and the callbacks waiting for its reply.
+struct PendingMessage {
+    std::string key;
+    std::vector<zmq::message_t> frames;
+    std::vector<AsyncConnection::ReplyCallback> callbacks;
+    std::chrono::steady_clock::time_point send_time;
+
+    void Reply(std::shared_ptr<zmq::message_t> reply) {
+        for (auto& callback : callbacks) {
+            if (callback) callback(reply);
+        }
+    }
+};
+
+}  // namespace
+
+struct AsyncConnection::Impl {
+    std::shared_ptr<zmq::context_t> context_;
+    std::string address_;
+    int connect_timeout_;
+    int timeout_;
+    size_t max_in_flight_;
+
+    std::thread thread_;
+    std::mutex mutex_;
+    /// Signals new messages in the queue and the end of the connection.
+    std::condition_variable queue_cv_;
+    /// Signals that the queue is empty and no message is in flight.
+    std::condition_variable idle_cv_;
+    bool keep_running_ = true;
+    std::deque<std::shared_ptr<PendingMessage>> queue_;
+    /// Queued messages with a key, for replacing them with newer messages.
+    std::map<std::string, std::shared_ptr<PendingMessage>> queued_keys_;
+    size_t num_in_flight_ = 0;
+
+    std::unique_ptr<zmq::socket_t> CreateSocket() {
+        // A DEALER socket can send several requests to a REP socket without
+        // waiting for the replies, unlike a REQ socket.
+        std::unique_ptr<zmq::socket_t> socket(
+                new zmq::socket_t(*context_, ZMQ_DEALER));
+        socket->set(zmq::sockopt::linger, timeout_);
+        socket->set(zmq::sockopt::connect_timeout, connect_timeout_);
+        socket->set(zmq::sockopt::sndtimeo, timeout_);
+        socket->connect(address_.c_str());
+        return socket;
+    }
+
+    bool SendMessage(zmq::socket_t& socket, PendingMessage& msg) {
+        // REP sockets expect an empty delimiter frame before the message.
+        zmq::message_t delimiter;
+        if (!socket.send(delimiter, zmq::send_flags::sndmore)) return false;
+        for (size_t i = 0; i < msg.frames.size(); ++i) {
+            const auto flags = i + 1 < msg.frames.size()
+                                       ? zmq::send_flags::sndmore
+                                       : zmq::send_flags::none;
+            if (!socket.send(msg.frames[i], flags)) return false;
+        }
+        return true;
+    }
+
+    /// Receives a reply if one is available. Returns nullptr otherwise.
+    std::shared_ptr<zmq::message_t> ReceiveReply(zmq::socket_t& socket) {
+        zmq::message_t delimiter;
+        if (!socket.recv(delimiter, zmq::recv_flags::dontwait)) {
+            return nullptr;
+        }
+        auto reply = std::make_shared<zmq::message_t>();
+        if (!socket.recv(*reply)) {
+            return nullptr;
+        }
+        return reply;
+    }
+
+    void Mainloop() {
+        auto socket = CreateSocket();
+        std::deque<std::shared_ptr<PendingMessage>> in_flight;
+        while (true) {
+            std::vector<std::shared_ptr<PendingMessage>> to_send;
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                if (in_flight.empty()) {
+                    num_in_flight_ = 0;
+                    if (queue_.empty()) idle_cv_.notify_all();
+                    queue_cv_.wait(lock, [this]() {
+                        return !keep_running_ || !queue_.empty();
+                    });
+                    if (queue_.empty()) break;
+                }
+                while (in_flight.size() + to_send.size() < max_in_flight_ &&
+                       !queue_.empty()) {
+                    auto msg = queue_.front();
+                    queue_.pop_front();
+                    if (!msg->key.empty()) queued_keys_.erase(msg->key);
+                    to_send.push_back(msg);
+                }
+                num_in_flight_ = in_flight.size() + to_send.size();
+            }
+
+            for (auto& msg : to_send) {
+                if (SendMessage(*socket, *msg)) {
+                    msg->send_time = std::chrono::steady_clock::now();
+                    in_flight.push_back(msg);
+                } else {
+                    LogInfo("AsyncConnection: send failed");
+                    msg->Reply(nullptr);
+                }
+            }
+            if (in_flight.empty()) continue;
+
+            // Wait briefly for replies so that new messages are picked up
+            // while the window is not full.
+            zmq::pollitem_t items[] = {{socket->handle(), 0, ZMQ_POLLIN, 0}};
+            zmq::poll(items, 1, std::chrono::milliseconds(10));
+            if (items[0].revents & ZMQ_POLLIN) {
+                while (!in_flight.empty()) {
+                    auto reply = ReceiveReply(*socket);
+                    if (!reply) break;
+                    auto msg = in_flight.front();
+                    in_flight.pop_front();
+                    msg->Reply(reply);
+                }
+            } else if (std::chrono::steady_clock::now() -
+                               in_flight.front()->send_time >
+                       std::chrono::milliseconds(timeout_)) {
+                // The replies of the remaining messages can no longer be
+                // matched if one is lost, so start over with a new socket.
+                LogInfo("AsyncConnection: no reply within {} ms, dropping {} "
+                        "messages",
+                        timeout_, in_flight.size());
+                for (auto& msg : in_flight) {
+                    msg->Reply(nullptr);
+                }
+                in_flight.clear();
+                socket->close();
+                socket = CreateSocket();
+            }
+        }
+        socket->close();
+    }
+};
+
+AsyncConnection::AsyncConnection()
+    : AsyncConnection(Connection::DefaultAddress(), 5000, 10000) {}
+
+AsyncConnection::AsyncConnection(const std::string& address,
+                                 int connect_timeout,
+                                 int timeout,
+                                 int max_in_flight)
+    : impl_(new AsyncConnection::Impl()) {
+    if (max_in_flight < 1) {
+        LogError("AsyncConnection: max_in_flight must be at least 1 but is {}",
+                 max_in_flight);
+    }
+    impl_->context_ = GetZMQContext();
+    impl_->address_ = address;
+    impl_->connect_timeout_ = connect_timeout;
+    impl_->timeout_ = timeout;
+    impl_->max_in_flight_ = size_t(max_in_flight);
+    impl_->thread_ = std::thread(&AsyncConnection::Impl::Mainloop, impl_.get());
+}
+
+AsyncConnection::~AsyncConnection() {
+    {
+        std::lock_guard<std::mutex> lock(impl_->mutex_);
+        impl_->keep_running_ = false;
+    }
+    impl_->queue_cv_.notify_all();
+    impl_->thread_.join();
+}
+
+void AsyncConnection::SendAsync(std::vector<zmq::message_t>& frames,
+                                const std::string& key,
+                                ReplyCallback on_reply) {
+    {
+        std::lock_guard<std::mutex> lock(impl_->mutex_);
+        auto it = key.empty() ? impl_->queued_keys_.end()
+                              : impl_->queued_keys_.find(key);
+        if (it != impl_->queued_keys_.end()) {
+            it->second->frames = std::move(frames);
+            it->second->callbacks.push_back(on_reply);
+        } else {
+            auto msg = std::make_shared<PendingMessage>();
+            msg->key = key;
+            msg->frames = std::move(frames);
+            msg->callbacks.push_back(on_reply);
+            impl_->queue_.push_back(msg);
+            if (!key.empty()) impl_->queued_keys_[key] = msg;
+        }
+    }
+    frames.clear();
+    impl_->queue_cv_.notify_one();
+}
+
+void AsyncConnection::Flush() {
+    std::unique_lock<std::mutex> lock(impl_->mutex_);
+    impl_->idle_cv_.wait(lock, [this]() {
+        return impl_->queue_.empty() && impl_->num_in_flight_ == 0;
+    });
+}
+
+std::shared_ptr<zmq::message_t> AsyncConnection::SendMultipart(
+        std::vector<zmq::message_t>& frames) {
+    using ReplyPromise = std::promise<std::shared_ptr<zmq::message_t>>;
+    auto reply = std::make_shared<ReplyPromise>();
+    auto future = reply->get_future();
+    SendAsync(frames, "", [reply](std::shared_ptr<zmq::message_t> msg) {
+        reply->set_value(msg);
+    });
+    auto msg = future.get();
+    // Return an empty message on failure like Connection does.
+    return msg ? msg : std::make_shared<zmq::message_t>();
+}
+
+std::shared_ptr<zmq::message_t> AsyncConnection::Send(
+        zmq::message_t& send_msg) {
+    std::vector<zmq::message_t> frames;
+    frames.push_back(std::move(send_msg));
+    return SendMultipart(frames);
+}
+
+std::shared_ptr<zmq::message_t> AsyncConnection::Send(const void* data,
+                                                      size_t size) {
+    zmq::message_t send_msg(data, size);
+    return Send(send_msg);
+}
+
+}  // namespace rpc
+}  // namespace io
+}  // namespace open3d
@@ -0,0 +1,124 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "open3d/io/rpc/ConnectionBase.h"
+
+namespace open3d {
+namespace io {
+namespace rpc {
+
+/// Connection that sends messages from a background thread without waiting for
+/// the reply of the previous message. Up to max_in_flight messages are sent
+/// before waiting for replies, which hides the latency of slow links. Queued
+/// messages that have not been sent yet are replaced by newer messages with
+/// the same key, e.g., updates of the same path in the scene tree, so that a
+/// slow receiver always gets the latest state instead of falling behind.
+///
+/// The receiver must be a REP socket, e.g., ZMQReceiver, which answers the
+/// messages in order.
+class AsyncConnection : public ConnectionBase {
+public:
+    using ReplyCallback = std::function<void(std::shared_ptr<zmq::message_t>)>;
+
+    /// Creates a connection with the default parameters
+    AsyncConnection();
+
+    /// Creates an AsyncConnection object used for sending data.
+    /// \param address          The address of the receiving end.
+    ///
+    /// \param connect_timeout  The timeout for the connect operation of the
+    /// socket.
+    ///
+    /// \param timeout          The timeout for sending data and receiving the
+    /// reply. All messages in flight fail after a timeout.
+    ///
+    /// \param max_in_flight    The maximum number of messages sent without
+    /// having received a reply.
+    ///
+    AsyncConnection(const std::string& address,
+                    int connect_timeout,
+                    int timeout,
+                    int max_in_flight = 4);
+
+    /// Sends all queued messages before returning.
+    ~AsyncConnection();
+
+    /// Queues the multipart message \p frames for sending. \p on_reply is
+    /// called from the sending thread with the reply or with a null pointer if
+    /// the message could not be sent or timed out.
+    ///
+    /// \param key  If not empty a queued message with the same key is replaced
+    /// by this message. The callbacks of the replaced message are called with
+    /// the reply of this message.
+    void SendAsync(std::vector<zmq::message_t>& frames,
+                   const std::string& key,
+                   ReplyCallback on_reply);
+
+    /// Blocks until all queued messages have been sent and replied to.
+    void Flush();
+
+    /// Function for sending data wrapped in a zmq message object. Blocks until
+    /// the reply has been received and must not be called from a reply
+    /// callback.
+    std::shared_ptr<zmq::message_t> Send(zmq::message_t& send_msg);
+
+    /// Function for sending raw data. Meant for testing purposes
+    std::shared_ptr<zmq::message_t> Send(const void* data, size_t size);
+
+    /// Function for sending a multipart message. Blocks until the reply has
+    /// been received.
+    std::shared_ptr<zmq::message_t> SendMultipart(
+            std::vector<zmq::message_t>& frames);
+
+    /// \see Connection::SetMultipartArrays
+    void SetMultipartArrays(size_t threshold, bool compress = false) {
+        multipart_array_threshold_ = threshold;
+        multipart_array_compression_ = compress;
+    }
+    size_t MultipartArrayThreshold() const {
+        return multipart_array_threshold_;
+    }
+    bool MultipartArrayCompression() const {
+        return multipart_array_compression_;
+    }
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> impl_;
+    size_t multipart_array_threshold_ = 0;
+    bool multipart_array_compression_ = false;
+};
+}  // namespace rpc
+}  // namespace io
+}  // namespace open3d
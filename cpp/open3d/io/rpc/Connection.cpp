@@ -75,7 +75,27 @@ std::shared_ptr<zmq::message_t> Connection::Send(zmq::message_t& send_msg) {
             LogInfo("Connection::send() send failed with: {}", err.what());
         }
     }
+    return Receive();
+}
+
+std::shared_ptr<zmq::message_t> Connection::SendMultipart(
+        std::vector<zmq::message_t>& frames) {
+    for (size_t i = 0; i < frames.size(); ++i) {
+        const auto flags = i + 1 < frames.size() ? zmq::send_flags::sndmore
+                                                 : zmq::send_flags::none;
+        if (!socket_->send(frames[i], flags)) {
+            zmq::error_t err;
+            if (err.num()) {
+                LogInfo("Connection::SendMultipart() send failed with: {}",
+                        err.what());
+            }
+            break;
+        }
+    }
+    return Receive();
+}
 
+std::shared_ptr<zmq::message_t> Connection::Receive() {
     std::shared_ptr<zmq::message_t> msg(new zmq::message_t());
     if (socket_->recv(*msg)) {
         LogDebug("Connection::send() received answer with {} bytes",
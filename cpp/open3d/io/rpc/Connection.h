@@ -28,6 +28,7 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "open3d/io/rpc/ConnectionBase.h"
 #include "open3d/io/rpc/ZMQContext.h"
@@ -60,6 +61,32 @@ public:
     /// Function for sending raw data. Meant for testing purposes
     std::shared_ptr<zmq::message_t> Send(const void* data, size_t size);
 
+    /// Function for sending a multipart message.
+    std::shared_ptr<zmq::message_t> SendMultipart(
+            std::vector<zmq::message_t>& frames);
+
+    /// Sends arrays of mesh data with at least \p threshold bytes as separate
+    /// frames of a multipart message. Tensor data is sent without copying it
+    /// into the message, which is much faster for large geometries. Requires a
+    /// receiver that supports multipart messages.
+    ///
+    /// \param threshold  Minimum array size in bytes. 0 disables multipart
+    /// messages (default).
+    ///
+    /// \param compress   Compress the array frames with LZF. This helps for
+    /// slow networks but costs time on fast local connections.
+    ///
+    void SetMultipartArrays(size_t threshold, bool compress = false) {
+        multipart_array_threshold_ = threshold;
+        multipart_array_compression_ = compress;
+    }
+    size_t MultipartArrayThreshold() const {
+        return multipart_array_threshold_;
+    }
+    bool MultipartArrayCompression() const {
+        return multipart_array_compression_;
+    }
+
     static std::string DefaultAddress();
 
 private:
@@ -68,6 +95,11 @@ private:
     const std::string address_;
     const int connect_timeout_;
     const int timeout_;
+    size_t multipart_array_threshold_ = 0;
+    bool multipart_array_compression_ = false;
+
+    /// Receives the reply for the last sent message.
+    std::shared_ptr<zmq::message_t> Receive();
 };
 }  // namespace rpc
 }  // namespace io
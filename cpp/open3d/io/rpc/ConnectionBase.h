@@ -27,6 +27,7 @@
 #pragma once
 
 #include <memory>
+#include <vector>
 
 namespace zmq {
 class message_t;
@@ -47,6 +48,22 @@ public:
     virtual std::shared_ptr<zmq::message_t> Send(zmq::message_t& send_msg) = 0;
     virtual std::shared_ptr<zmq::message_t> Send(const void* data,
                                                  size_t size) = 0;
+
+    /// Function for sending a multipart message. The first frame stores the
+    /// serialized messages and the others large arrays, see
+    /// messages::Array::frame. Only called if MultipartArrayThreshold() is
+    /// not 0.
+    virtual std::shared_ptr<zmq::message_t> SendMultipart(
+            std::vector<zmq::message_t>& frames) {
+        return nullptr;
+    }
+
+    /// Arrays with at least this many bytes are sent in separate frames of a
+    /// multipart message. 0 means that multipart messages are not supported.
+    virtual size_t MultipartArrayThreshold() const { return 0; }
+
+    /// Returns true if the separate array frames should be compressed.
+    virtual bool MultipartArrayCompression() const { return false; }
 };
 }  // namespace rpc
 }  // namespace io
@@ -28,6 +28,8 @@
 
 #include <zmq.hpp>
 
+#include "open3d/core/ShapeUtil.h"
+#include "open3d/io/LZFCompression.h"
 #include "open3d/io/rpc/Messages.h"
 #include "open3d/utility/Logging.h"
 #include "open3d/visualization/rendering/Material.h"
@@ -109,35 +111,41 @@ std::shared_ptr<zmq::message_t> CreateStatusOKMsg() {
             new zmq::message_t(sbuf.data(), sbuf.size()));
 }
 
+/// Converts a type string of an Array, e.g. "<f4", to a Dtype.
+static core::Dtype TypeStrToDtype(const std::string& ts) {
+    if ("<f4" == ts) {
+        return core::Float32;
+    } else if ("<f8" == ts) {
+        return core::Float64;
+    } else if ("|i1" == ts) {
+        return core::Int8;
+    } else if ("<i2" == ts) {
+        return core::Int16;
+    } else if ("<i4" == ts) {
+        return core::Int32;
+    } else if ("<i8" == ts) {
+        return core::Int64;
+    } else if ("|u1" == ts) {
+        return core::UInt8;
+    } else if ("<u2" == ts) {
+        return core::UInt16;
+    } else if ("<u4" == ts) {
+        return core::UInt32;
+    } else if ("<u8" == ts) {
+        return core::UInt64;
+    }
+    LogError("Unsupported type {}. Cannot convert to Tensor.", ts);
+    return core::Undefined;
+}
+
 /// Creates a Tensor from an Array. This function also returns a contiguous CPU
 /// Tensor. Note that the msgpack object backing the memory for \p array must be
 /// alive for calling this function.
 static core::Tensor ArrayToTensor(const messages::Array& array) {
-    auto TypeStrToDtype = [](const std::string& ts) {
-        if ("<f4" == ts) {
-            return core::Float32;
-        } else if ("<f8" == ts) {
-            return core::Float64;
-        } else if ("|i1" == ts) {
-            return core::Int8;
-        } else if ("<i2" == ts) {
-            return core::Int16;
-        } else if ("<i4" == ts) {
-            return core::Int32;
-        } else if ("<i8" == ts) {
-            return core::Int64;
-        } else if ("|u1" == ts) {
-            return core::UInt8;
-        } else if ("<u2" == ts) {
-            return core::UInt16;
-        } else if ("<u4" == ts) {
-            return core::UInt32;
-        } else if ("<u8" == ts) {
-            return core::UInt64;
-        }
-        LogError("Unsupported type {}. Cannot convert to Tensor.", ts);
-        return core::Undefined;
-    };
+    // Arrays resolved from separate frames already own a Tensor.
+    if (array.tensor_.GetBlob()) {
+        return array.tensor_;
+    }
 
     core::Tensor result(array.shape, TypeStrToDtype(array.type));
     memcpy(result.GetDataPtr(), array.data.ptr, array.data.size);
@@ -355,6 +363,152 @@ messages::MeshData GeometryToMeshData(const t::geometry::LineSet& ls) {
     return mesh_data;
 }
 
+/// Calls \p func for every Array in \p mesh_data.
+template <class TFunc>
+static void ForEachArray(messages::MeshData& mesh_data, TFunc func) {
+    func(mesh_data.vertices);
+    func(mesh_data.faces);
+    func(mesh_data.lines);
+    for (auto* arrays :
+         {&mesh_data.vertex_attributes, &mesh_data.face_attributes,
+          &mesh_data.line_attributes, &mesh_data.texture_maps}) {
+        for (auto& item : *arrays) {
+            func(item.second);
+        }
+    }
+}
+
+static void DeleteTensor(void* data, void* hint) {
+    delete static_cast<core::Tensor*>(hint);
+}
+
+static void DeleteBuffer(void* data, void* hint) {
+    delete static_cast<std::vector<char>*>(hint);
+}
+
+void MoveArraysToFrames(messages::MeshData& mesh_data,
+                        size_t min_bytes,
+                        bool compress,
+                        std::vector<zmq::message_t>& frames) {
+    ForEachArray(mesh_data, [&](messages::Array& array) {
+        const uint32_t size = array.data.size;
+        if (size == 0 || size < min_bytes) return;
+        array.frame = int32_t(frames.size());
+
+        std::unique_ptr<std::vector<char>> compressed;
+        if (compress) {
+            compressed.reset(new std::vector<char>());
+            if (io::CompressLZF(array.data.ptr, size, *compressed) &&
+                compressed->size() < size) {
+                array.compression = "lzf";
+            } else {
+                compressed.reset();
+            }
+        }
+
+        if (compressed) {
+            std::vector<char>* buffer = compressed.release();
+            frames.emplace_back(buffer->data(), buffer->size(), DeleteBuffer,
+                                buffer);
+        } else if (array.tensor_.GetBlob()) {
+            // ZMQ may still send the frame after the call returned, so the
+            // frame keeps a reference to the tensor.
+            frames.emplace_back(const_cast<char*>(array.data.ptr), size,
+                                DeleteTensor, new core::Tensor(array.tensor_));
+        } else {
+            // The memory is owned by the caller, copy it.
+            frames.emplace_back(array.data.ptr, size);
+        }
+        array.data = msgpack::type::raw_ref();
+    });
+}
+
+void ResolveArrayFrames(
+        messages::MeshData& mesh_data,
+        const std::vector<std::shared_ptr<zmq::message_t>>& frames) {
+    ForEachArray(mesh_data, [&](messages::Array& array) {
+        if (array.frame < 0) return;
+        if (size_t(array.frame) >= frames.size()) {
+            LogError("ResolveArrayFrames: array refers to frame {} but the "
+                     "message has {} frames",
+                     array.frame, frames.size());
+        }
+        std::shared_ptr<zmq::message_t> frame = frames[array.frame];
+        const core::SizeVector shape(array.shape);
+        const core::Dtype dtype = TypeStrToDtype(array.type);
+        const int64_t size = shape.NumElements() * dtype.ByteSize();
+        if (size > int64_t(UINT32_MAX)) {
+            LogError("ResolveArrayFrames: array with {} bytes is too large",
+                     size);
+        }
+
+        if (array.compression == "lzf") {
+            core::Tensor tensor(shape, dtype);
+            if (!io::DecompressLZF(frame->data(), uint32_t(frame->size()),
+                                   tensor.GetDataPtr(), uint32_t(size))) {
+                LogError("ResolveArrayFrames: failed to decompress frame {}",
+                         array.frame);
+            }
+            array.tensor_ = tensor;
+        } else if (array.compression.empty()) {
+            if (int64_t(frame->size()) != size) {
+                LogError("ResolveArrayFrames: expected {} bytes in frame {} "
+                         "but got {}",
+                         size, array.frame, frame->size());
+            }
+            // The tensor uses the frame memory and keeps the frame alive.
+            auto blob = std::make_shared<core::Blob>(
+                    core::Device("CPU:0"), frame->data(),
+                    [frame](void*) {});
+            array.tensor_ =
+                    core::Tensor(shape, core::shape_util::DefaultStrides(shape),
+                                 frame->data(), dtype, blob);
+        } else {
+            LogError("ResolveArrayFrames: unsupported compression '{}'",
+                     array.compression);
+        }
+        array.data = msgpack::type::raw_ref(
+                static_cast<const char*>(array.tensor_.GetDataPtr()),
+                uint32_t(size));
+    });
+}
+
+void ResolveSharedMemoryArrays(messages::MeshData& mesh_data) {
+    ForEachArray(mesh_data, [&](messages::Array& array) {
+        if (array.shared_memory.name.empty()) return;
+        const core::SizeVector shape(array.shape);
+        const core::Dtype dtype = TypeStrToDtype(array.type);
+        array.tensor_ = MapSharedTensor(array.shared_memory, shape, dtype);
+        if (array.tensor_.GetDevice().GetType() ==
+            core::Device::DeviceType::CPU) {
+            const int64_t size = shape.NumElements() * dtype.ByteSize();
+            if (size > int64_t(UINT32_MAX)) {
+                LogError("ResolveSharedMemoryArrays: array with {} bytes is "
+                         "too large",
+                         size);
+            }
+            array.data = msgpack::type::raw_ref(
+                    static_cast<const char*>(array.tensor_.GetDataPtr()),
+                    uint32_t(size));
+        }
+    });
+}
+
+void MoveArraysToCPU(messages::MeshData& mesh_data) {
+    ForEachArray(mesh_data, [&](messages::Array& array) {
+        if (!array.tensor_.GetBlob() || array.tensor_.GetDevice().GetType() ==
+                                                core::Device::DeviceType::CPU) {
+            return;
+        }
+        const core::Tensor tensor =
+                array.tensor_.To(core::Device("CPU:0")).Contiguous();
+        array.tensor_ = tensor;
+        array.data = msgpack::type::raw_ref(
+                static_cast<const char*>(tensor.GetDataPtr()),
+                uint32_t(tensor.NumElements() * tensor.GetDtype().ByteSize()));
+    });
+}
+
 std::tuple<std::string, double, std::shared_ptr<t::geometry::Geometry>>
 DataBufferToMetaGeometry(std::string& data) {
     const char* buffer = data.data();
@@ -382,6 +536,7 @@ DataBufferToMetaGeometry(std::string& data) {
             auto mesh_obj = oh.get();
             messages::SetMeshData msg;
             msg = mesh_obj.as<messages::SetMeshData>();
+            ResolveSharedMemoryArrays(msg.data);
             auto result = MeshDataToGeometry(msg.data);
             double time = msg.time;
             return std::tie(msg.path, time, result);
@@ -27,7 +27,9 @@
 #pragma once
 
 #include <map>
+#include <memory>
 #include <tuple>
+#include <vector>
 
 #include "open3d/core/Tensor.h"
 #include "open3d/t/geometry/LineSet.h"
@@ -103,6 +105,40 @@ messages::MeshData GeometryToMeshData(const t::geometry::PointCloud& pcd);
 /// object for serialization.
 messages::MeshData GeometryToMeshData(const t::geometry::LineSet& ls);
 
+/// Moves the data of all arrays in \p mesh_data with at least \p min_bytes
+/// bytes out of the msgpack message into separate frames of a multipart ZMQ
+/// message, see messages::Array::frame. Arrays created from a Tensor are sent
+/// without a copy. \p frames must already contain the first frame of the
+/// multipart message, which will store the serialized message itself. The
+/// new frames are appended.
+///
+/// \param compress  Compress the frames with LZF if this makes them smaller.
+void MoveArraysToFrames(messages::MeshData& mesh_data,
+                        size_t min_bytes,
+                        bool compress,
+                        std::vector<zmq::message_t>& frames);
+
+/// Points the arrays in \p mesh_data that are stored in separate frames to the
+/// data of the multipart message \p frames and decompresses them if needed.
+/// Uncompressed arrays reference the frames without a copy, which are kept
+/// alive by the Array::tensor_ members. Throws if the frames do not match the
+/// arrays.
+void ResolveArrayFrames(
+        messages::MeshData& mesh_data,
+        const std::vector<std::shared_ptr<zmq::message_t>>& frames);
+
+/// Maps the arrays in \p mesh_data that reference shared memory, see
+/// CreateSharedTensor() and MapSharedTensor(). The mapped tensors are stored in
+/// the Array::tensor_ members. CPU arrays also point their data to the mapped
+/// memory, while the data of CUDA arrays is only accessible through the
+/// tensors. Throws if the shared memory cannot be mapped.
+void ResolveSharedMemoryArrays(messages::MeshData& mesh_data);
+
+/// Copies arrays in \p mesh_data which are only stored in CUDA tensors, e.g.
+/// after ResolveSharedMemoryArrays(), to the CPU so that their data can be
+/// accessed with messages::Array::Ptr().
+void MoveArraysToCPU(messages::MeshData& mesh_data);
+
 /// This function returns the geometry, the path and the time stored in a
 /// SetMeshData message. \p data must contain the Request header message
 /// followed by the SetMeshData message. The function returns a null pointer for
@@ -34,6 +34,7 @@
 #include <vector>
 
 #include "open3d/core/Tensor.h"
+#include "open3d/io/rpc/SharedMemory.h"
 
 namespace open3d {
 namespace io {
@@ -140,8 +141,19 @@ struct Array {
 
     /// Creates an Array from a Tensor. This will copy the tensor to
     /// contiguous CPU memory if necessary and the returned array will keep
-    /// a reference.
+    /// a reference. Tensors in shared memory (see CreateSharedTensor()) are
+    /// not copied and the array only stores a reference to the memory.
     static Array FromTensor(const core::Tensor& tensor) {
+        SharedMemoryRef shared_memory;
+        if (GetSharedMemoryRef(tensor, shared_memory)) {
+            Array arr;
+            arr.type = DISPATCH_DTYPE_TO_TEMPLATE(
+                    tensor.GetDtype(), [&]() { return TypeStr<scalar_t>(); });
+            arr.shape = static_cast<std::vector<int64_t>>(tensor.GetShape());
+            arr.shared_memory = shared_memory;
+            arr.tensor_ = tensor;
+            return arr;
+        }
         // We require the tensor to be contiguous and to use the CPU.
         auto t = tensor.To(core::Device("CPU:0")).Contiguous();
         auto a = DISPATCH_DTYPE_TO_TEMPLATE(t.GetDtype(), [&]() {
@@ -161,6 +173,16 @@ struct Array {
     std::vector<int64_t> shape;
     msgpack::type::raw_ref data;
 
+    /// Index of the frame of a multipart ZMQ message that stores the array
+    /// data or -1 if the data is stored in \p data. Storing large arrays in
+    /// separate frames avoids copying them into and out of the msgpack buffer.
+    int32_t frame = -1;
+    /// Compression of the data in the frame. Either "" or "lzf".
+    std::string compression;
+    /// Reference to the data in shared memory if \p shared_memory.name is not
+    /// empty. The data is then neither stored in \p data nor in a frame.
+    SharedMemoryRef shared_memory;
+
     template <class T>
     const T* Ptr() const {
         return (T*)data.ptr;
@@ -267,7 +289,7 @@ struct Array {
     }
 
     // macro for creating the serialization/deserialization code
-    MSGPACK_DEFINE_MAP(type, shape, data);
+    MSGPACK_DEFINE_MAP(type, shape, data, frame, compression, shared_memory);
 };
 
 /// struct for storing MeshData, e.g., PointClouds, TriangleMesh, ..
@@ -27,9 +27,13 @@
 #include "open3d/io/rpc/RemoteFunctions.h"
 
 #include <Eigen/Geometry>
+#include <future>
+#include <mutex>
+#include <vector>
 #include <zmq.hpp>
 
 #include "open3d/core/Dispatch.h"
+#include "open3d/io/rpc/AsyncConnection.h"
 #include "open3d/io/rpc/Connection.h"
 #include "open3d/io/rpc/MessageUtils.h"
 #include "open3d/io/rpc/Messages.h"
@@ -41,18 +45,88 @@ namespace open3d {
 namespace io {
 namespace rpc {
 
-bool SetPointCloud(const geometry::PointCloud& pcd,
-                   const std::string& path,
-                   int time,
-                   const std::string& layer,
-                   std::shared_ptr<ConnectionBase> connection) {
+/// Serializes \p msg into the frames of a ZMQ message. Large arrays are moved
+/// to separate frames of a multipart message if \p connection supports it.
+static std::vector<zmq::message_t> PackSetMeshData(
+        messages::SetMeshData& msg, const ConnectionBase& connection) {
+    const size_t threshold = connection.MultipartArrayThreshold();
+    std::vector<zmq::message_t> frames(1);
+    if (threshold > 0) {
+        MoveArraysToFrames(msg.data, threshold,
+                           connection.MultipartArrayCompression(), frames);
+    }
+
+    msgpack::sbuffer sbuf;
+    messages::Request request{msg.MsgId()};
+    msgpack::pack(sbuf, request);
+    msgpack::pack(sbuf, msg);
+
+    frames[0] = zmq::message_t(sbuf.data(), sbuf.size());
+    return frames;
+}
+
+/// Sends \p msg and returns true if the receiver replied with OK.
+static bool SendSetMeshData(messages::SetMeshData& msg,
+                            std::shared_ptr<ConnectionBase> connection) {
+    if (!connection) {
+        connection = std::shared_ptr<Connection>(new Connection());
+    }
+    auto frames = PackSetMeshData(msg, *connection);
+    auto reply = frames.size() > 1 ? connection->SendMultipart(frames)
+                                   : connection->Send(frames[0]);
+    return ReplyIsOKStatus(*reply);
+}
+
+/// Returns the connection used by the asynchronous functions if no connection
+/// is specified. It is shared so that the calls are pipelined.
+static std::shared_ptr<AsyncConnection> GetDefaultAsyncConnection() {
+    static std::mutex mutex;
+    static std::shared_ptr<AsyncConnection> connection;
+    std::lock_guard<std::mutex> lock(mutex);
+    if (!connection) {
+        connection = std::make_shared<AsyncConnection>();
+    }
+    return connection;
+}
+
+/// Queues \p msg for sending. Queued updates of the same path and layer are
+/// replaced by \p msg.
+static std::future<bool> SendSetMeshDataAsync(
+        messages::SetMeshData& msg,
+        std::shared_ptr<AsyncConnection> connection) {
+    if (!connection) {
+        connection = GetDefaultAsyncConnection();
+    }
+    auto frames = PackSetMeshData(msg, *connection);
+    auto result = std::make_shared<std::promise<bool>>();
+    auto future = result->get_future();
+    connection->SendAsync(
+            frames, msg.MsgId() + '\n' + msg.layer + '\n' + msg.path,
+            [result](std::shared_ptr<zmq::message_t> reply) {
+                result->set_value(reply && ReplyIsOKStatus(*reply));
+            });
+    return future;
+}
+
+/// Returns a future that is ready with \p value.
+static std::future<bool> MakeReadyFuture(bool value) {
+    std::promise<bool> result;
+    result.set_value(value);
+    return result.get_future();
+}
+
+/// Creates the SetMeshData message \p msg. Returns false if \p pcd is empty.
+static bool CreateSetMeshData(const geometry::PointCloud& pcd,
+                              const std::string& path,
+                              int time,
+                              const std::string& layer,
+                              messages::SetMeshData& msg) {
     // TODO use SetMeshData here after switching to the new PointCloud class.
     if (!pcd.HasPoints()) {
         LogInfo("SetMeshData: point cloud is empty");
         return false;
     }
 
-    messages::SetMeshData msg;
     msg.path = path;
     msg.time = time;
     msg.layer = layer;
@@ -68,32 +142,21 @@ bool SetPointCloud(const geometry::PointCloud& pcd,
         msg.data.vertex_attributes["colors"] = messages::Array::FromPtr(
                 (double*)pcd.colors_.data(), {int64_t(pcd.colors_.size()), 3});
     }
-
-    msgpack::sbuffer sbuf;
-    messages::Request request{msg.MsgId()};
-    msgpack::pack(sbuf, request);
-    msgpack::pack(sbuf, msg);
-
-    zmq::message_t send_msg(sbuf.data(), sbuf.size());
-    if (!connection) {
-        connection = std::shared_ptr<Connection>(new Connection());
-    }
-    auto reply = connection->Send(send_msg);
-    return ReplyIsOKStatus(*reply);
+    return true;
 }
 
-bool SetTriangleMesh(const geometry::TriangleMesh& mesh,
-                     const std::string& path,
-                     int time,
-                     const std::string& layer,
-                     std::shared_ptr<ConnectionBase> connection) {
+/// Creates the SetMeshData message \p msg. Returns false if \p mesh is empty.
+static bool CreateSetMeshData(const geometry::TriangleMesh& mesh,
+                              const std::string& path,
+                              int time,
+                              const std::string& layer,
+                              messages::SetMeshData& msg) {
     // TODO use SetMeshData here after switching to the new TriangleMesh class.
     if (!mesh.HasTriangles()) {
         LogInfo("SetMeshData: triangle mesh is empty");
         return false;
     }
 
-    messages::SetMeshData msg;
     msg.path = path;
     msg.time = time;
     msg.layer = layer;
@@ -146,36 +209,26 @@ bool SetTriangleMesh(const geometry::TriangleMesh& mesh,
             ++tex_id;
         }
     }
-
-    msgpack::sbuffer sbuf;
-    messages::Request request{msg.MsgId()};
-    msgpack::pack(sbuf, request);
-    msgpack::pack(sbuf, msg);
-
-    zmq::message_t send_msg(sbuf.data(), sbuf.size());
-    if (!connection) {
-        connection = std::shared_ptr<Connection>(new Connection());
-    }
-    auto reply = connection->Send(send_msg);
-    return ReplyIsOKStatus(*reply);
+    return true;
 }
 
-bool SetMeshData(const std::string& path,
-                 int time,
-                 const std::string& layer,
-                 const core::Tensor& vertices,
-                 const std::map<std::string, core::Tensor>& vertex_attributes,
-                 const core::Tensor& faces,
-                 const std::map<std::string, core::Tensor>& face_attributes,
-                 const core::Tensor& lines,
-                 const std::map<std::string, core::Tensor>& line_attributes,
-                 const std::string& material,
-                 const std::map<std::string, float>& material_scalar_attributes,
-                 const std::map<std::string, std::array<float, 4>>&
-                         material_vector_attributes,
-                 const std::map<std::string, t::geometry::Image>& texture_maps,
-                 const std::string& o3d_type,
-                 std::shared_ptr<ConnectionBase> connection) {
+/// Creates the SetMeshData message for the SetMeshData functions.
+static messages::SetMeshData CreateSetMeshData(
+        const std::string& path,
+        int time,
+        const std::string& layer,
+        const core::Tensor& vertices,
+        const std::map<std::string, core::Tensor>& vertex_attributes,
+        const core::Tensor& faces,
+        const std::map<std::string, core::Tensor>& face_attributes,
+        const core::Tensor& lines,
+        const std::map<std::string, core::Tensor>& line_attributes,
+        const std::string& material,
+        const std::map<std::string, float>& material_scalar_attributes,
+        const std::map<std::string, std::array<float, 4>>&
+                material_vector_attributes,
+        const std::map<std::string, t::geometry::Image>& texture_maps,
+        const std::string& o3d_type) {
     messages::SetMeshData msg;
     msg.path = path;
     msg.time = time;
@@ -297,18 +350,102 @@ bool SetMeshData(const std::string& path,
             LogError("SetMeshData: {}", errstr);
         }
     }
+    return msg;
+}
 
-    msgpack::sbuffer sbuf;
-    messages::Request request{msg.MsgId()};
-    msgpack::pack(sbuf, request);
-    msgpack::pack(sbuf, msg);
+bool SetPointCloud(const geometry::PointCloud& pcd,
+                   const std::string& path,
+                   int time,
+                   const std::string& layer,
+                   std::shared_ptr<ConnectionBase> connection) {
+    messages::SetMeshData msg;
+    return CreateSetMeshData(pcd, path, time, layer, msg) &&
+           SendSetMeshData(msg, connection);
+}
 
-    zmq::message_t send_msg(sbuf.data(), sbuf.size());
-    if (!connection) {
-        connection = std::shared_ptr<Connection>(new Connection());
+std::future<bool> SetPointCloudAsync(
+        const geometry::PointCloud& pcd,
+        const std::string& path,
+        int time,
+        const std::string& layer,
+        std::shared_ptr<AsyncConnection> connection) {
+    messages::SetMeshData msg;
+    if (!CreateSetMeshData(pcd, path, time, layer, msg)) {
+        return MakeReadyFuture(false);
     }
-    auto reply = connection->Send(send_msg);
-    return ReplyIsOKStatus(*reply);
+    return SendSetMeshDataAsync(msg, connection);
+}
+
+bool SetTriangleMesh(const geometry::TriangleMesh& mesh,
+                     const std::string& path,
+                     int time,
+                     const std::string& layer,
+                     std::shared_ptr<ConnectionBase> connection) {
+    messages::SetMeshData msg;
+    return CreateSetMeshData(mesh, path, time, layer, msg) &&
+           SendSetMeshData(msg, connection);
+}
+
+std::future<bool> SetTriangleMeshAsync(
+        const geometry::TriangleMesh& mesh,
+        const std::string& path,
+        int time,
+        const std::string& layer,
+        std::shared_ptr<AsyncConnection> connection) {
+    messages::SetMeshData msg;
+    if (!CreateSetMeshData(mesh, path, time, layer, msg)) {
+        return MakeReadyFuture(false);
+    }
+    return SendSetMeshDataAsync(msg, connection);
+}
+
+bool SetMeshData(const std::string& path,
+                 int time,
+                 const std::string& layer,
+                 const core::Tensor& vertices,
+                 const std::map<std::string, core::Tensor>& vertex_attributes,
+                 const core::Tensor& faces,
+                 const std::map<std::string, core::Tensor>& face_attributes,
+                 const core::Tensor& lines,
+                 const std::map<std::string, core::Tensor>& line_attributes,
+                 const std::string& material,
+                 const std::map<std::string, float>& material_scalar_attributes,
+                 const std::map<std::string, std::array<float, 4>>&
+                         material_vector_attributes,
+                 const std::map<std::string, t::geometry::Image>& texture_maps,
+                 const std::string& o3d_type,
+                 std::shared_ptr<ConnectionBase> connection) {
+    auto msg = CreateSetMeshData(path, time, layer, vertices, vertex_attributes,
+                                 faces, face_attributes, lines, line_attributes,
+                                 material, material_scalar_attributes,
+                                 material_vector_attributes, texture_maps,
+                                 o3d_type);
+    return SendSetMeshData(msg, connection);
+}
+
+std::future<bool> SetMeshDataAsync(
+        const std::string& path,
+        int time,
+        const std::string& layer,
+        const core::Tensor& vertices,
+        const std::map<std::string, core::Tensor>& vertex_attributes,
+        const core::Tensor& faces,
+        const std::map<std::string, core::Tensor>& face_attributes,
+        const core::Tensor& lines,
+        const std::map<std::string, core::Tensor>& line_attributes,
+        const std::string& material,
+        const std::map<std::string, float>& material_scalar_attributes,
+        const std::map<std::string, std::array<float, 4>>&
+                material_vector_attributes,
+        const std::map<std::string, t::geometry::Image>& texture_maps,
+        const std::string& o3d_type,
+        std::shared_ptr<AsyncConnection> connection) {
+    auto msg = CreateSetMeshData(path, time, layer, vertices, vertex_attributes,
+                                 faces, face_attributes, lines, line_attributes,
+                                 material, material_scalar_attributes,
+                                 material_vector_attributes, texture_maps,
+                                 o3d_type);
+    return SendSetMeshDataAsync(msg, connection);
 }
 
 bool SetLegacyCamera(const camera::PinholeCameraParameters& camera,
@@ -27,12 +27,14 @@
 #pragma once
 
 #include <array>
+#include <future>
 #include <map>
 
 #include "open3d/camera/PinholeCameraParameters.h"
 #include "open3d/core/Tensor.h"
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/geometry/TriangleMesh.h"
+#include "open3d/io/rpc/AsyncConnection.h"
 #include "open3d/io/rpc/ConnectionBase.h"
 #include "open3d/t/geometry/Image.h"
 
@@ -166,6 +168,60 @@ bool SetMeshData(
         std::shared_ptr<ConnectionBase> connection =
                 std::shared_ptr<ConnectionBase>());
 
+/// Asynchronous version of SetPointCloud(). The function returns after
+/// serializing the point cloud and the returned future becomes true once the
+/// receiver replied with OK. Queued updates of the same path and layer that
+/// have not been sent yet are replaced by this update and share its result.
+///
+/// \param connection  The connection object used for sending the data.
+///                    If nullptr a shared default connection object will be
+///                    used.
+///
+std::future<bool> SetPointCloudAsync(
+        const geometry::PointCloud& pcd,
+        const std::string& path = "",
+        int time = 0,
+        const std::string& layer = "",
+        std::shared_ptr<AsyncConnection> connection =
+                std::shared_ptr<AsyncConnection>());
+
+/// Asynchronous version of SetTriangleMesh(). \see SetPointCloudAsync
+std::future<bool> SetTriangleMeshAsync(
+        const geometry::TriangleMesh& mesh,
+        const std::string& path = "",
+        int time = 0,
+        const std::string& layer = "",
+        std::shared_ptr<AsyncConnection> connection =
+                std::shared_ptr<AsyncConnection>());
+
+/// Asynchronous version of SetMeshData(). Tensors are referenced, not copied,
+/// when the connection sends multipart messages and must not be modified
+/// before the returned future is ready. \see SetPointCloudAsync
+std::future<bool> SetMeshDataAsync(
+        const std::string& path = "",
+        int time = 0,
+        const std::string& layer = "",
+        const core::Tensor& vertices = core::Tensor({0}, core::Float32),
+        const std::map<std::string, core::Tensor>& vertex_attributes =
+                std::map<std::string, core::Tensor>(),
+        const core::Tensor& faces = core::Tensor({0}, core::Int32),
+        const std::map<std::string, core::Tensor>& face_attributes =
+                std::map<std::string, core::Tensor>(),
+        const core::Tensor& lines = core::Tensor({0}, core::Int32),
+        const std::map<std::string, core::Tensor>& line_attributes =
+                std::map<std::string, core::Tensor>(),
+        const std::string& material = "",
+        const std::map<std::string, float>& material_scalar_attributes =
+                std::map<std::string, float>(),
+        const std::map<std::string, std::array<float, 4>>&
+                material_vector_attributes =
+                        std::map<std::string, std::array<float, 4>>(),
+        const std::map<std::string, t::geometry::Image>& texture_maps =
+                std::map<std::string, t::geometry::Image>(),
+        const std::string& o3d_type = "",
+        std::shared_ptr<AsyncConnection> connection =
+                std::shared_ptr<AsyncConnection>());
+
 /// Function for sending Camera data.
 /// \param camera      The PinholeCameraParameters object.
 ///
@@ -0,0 +1,315 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/io/rpc/SharedMemory.h"
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <atomic>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <mutex>
+
+#include "open3d/core/CUDAUtils.h"
+#include "open3d/core/ShapeUtil.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace io {
+namespace rpc {
+
+namespace {
+
+/// A shared allocation created by this process.
+struct SharedSegment {
+    std::string name;
+    core::Device device;
+    int64_t byte_size = 0;
+    std::vector<uint8_t> cuda_ipc_handle;
+    std::weak_ptr<core::Blob> blob;
+};
+
+/// Registry of the shared allocations of this process, keyed by their data
+/// pointer. It is used to recognize shared tensors when they are sent.
+class SharedSegmentRegistry {
+public:
+    static SharedSegmentRegistry& GetInstance() {
+        static SharedSegmentRegistry instance;
+        return instance;
+    }
+
+    void Add(const char* ptr, const SharedSegment& segment) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        segments_[ptr] = segment;
+    }
+
+    void Remove(const char* ptr) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        segments_.erase(ptr);
+    }
+
+    /// Finds the segment containing [ptr, ptr + byte_size) on \p device.
+    bool Find(const char* ptr,
+              int64_t byte_size,
+              const core::Device& device,
+              const char*& segment_ptr,
+              SharedSegment& segment) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = segments_.upper_bound(ptr);
+        if (it == segments_.begin()) {
+            return false;
+        }
+        --it;
+        if (it->second.device != device ||
+            ptr + byte_size > it->first + it->second.byte_size) {
+            return false;
+        }
+        segment_ptr = it->first;
+        segment = it->second;
+        return true;
+    }
+
+    /// Returns the blob of the segment with \p name or nullptr if it does not
+    /// exist or has been released.
+    std::shared_ptr<core::Blob> FindBlob(const std::string& name) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (const auto& item : segments_) {
+            if (item.second.name == name) {
+                return item.second.blob.lock();
+            }
+        }
+        return nullptr;
+    }
+
+private:
+    SharedSegmentRegistry() = default;
+
+    std::map<const char*, SharedSegment> segments_;
+    std::mutex mutex_;
+};
+
+std::string CreateSegmentName() {
+    static std::atomic<uint64_t> counter(0);
+#ifdef _WIN32
+    const int pid = 0;
+#else
+    const int pid = int(getpid());
+#endif
+    return fmt::format("/open3d_{}_{}", pid, counter++);
+}
+
+}  // namespace
+
+core::Tensor CreateSharedTensor(const core::SizeVector& shape,
+                                core::Dtype dtype,
+                                const core::Device& device) {
+    // Allocate at least one byte, empty mappings are not allowed.
+    const int64_t byte_size =
+            std::max<int64_t>(shape.NumElements() * dtype.ByteSize(), 1);
+    SharedSegment segment;
+    segment.name = CreateSegmentName();
+    segment.device = device;
+    segment.byte_size = byte_size;
+
+    void* ptr = nullptr;
+    std::function<void(void*)> deleter;
+    if (device.GetType() == core::Device::DeviceType::CPU) {
+#ifdef _WIN32
+        utility::LogError(
+                "Shared memory tensors are not supported on Windows.");
+#else
+        const std::string name = segment.name;
+        int fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+        if (fd < 0) {
+            utility::LogError("Failed to create shared memory {}: {}", name,
+                              std::strerror(errno));
+        }
+        if (ftruncate(fd, byte_size) != 0) {
+            const int err = errno;
+            close(fd);
+            shm_unlink(name.c_str());
+            utility::LogError("Failed to resize shared memory {}: {}", name,
+                              std::strerror(err));
+        }
+        ptr = mmap(nullptr, byte_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd,
+                   0);
+        close(fd);
+        if (ptr == MAP_FAILED) {
+            shm_unlink(name.c_str());
+            utility::LogError("Failed to map shared memory {}: {}", name,
+                              std::strerror(errno));
+        }
+        deleter = [ptr, byte_size, name](void*) {
+            SharedSegmentRegistry::GetInstance().Remove(
+                    static_cast<const char*>(ptr));
+            munmap(ptr, byte_size);
+            shm_unlink(name.c_str());
+        };
+#endif
+    } else if (device.GetType() == core::Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        // A dedicated allocation, since IPC handles refer to whole
+        // allocations and cannot be created for memory from pools.
+        core::CUDAScopedDevice scoped_device(device);
+        OPEN3D_CUDA_CHECK(cudaMalloc(&ptr, byte_size));
+        cudaIpcMemHandle_t handle;
+        OPEN3D_CUDA_CHECK(cudaIpcGetMemHandle(&handle, ptr));
+        segment.cuda_ipc_handle.resize(sizeof(handle));
+        std::memcpy(segment.cuda_ipc_handle.data(), &handle, sizeof(handle));
+        deleter = [ptr, device](void*) {
+            SharedSegmentRegistry::GetInstance().Remove(
+                    static_cast<const char*>(ptr));
+            core::CUDAScopedDevice scoped_device(device);
+            OPEN3D_CUDA_CHECK(cudaFree(ptr));
+        };
+#else
+        utility::LogError(
+                "-DBUILD_CUDA_MODULE=OFF. Please build with "
+                "-DBUILD_CUDA_MODULE=ON to use CUDA device.");
+#endif
+    } else {
+        utility::LogError("Unimplemented device {}.", device.ToString());
+    }
+
+    auto blob = std::make_shared<core::Blob>(device, ptr, deleter);
+    segment.blob = blob;
+    SharedSegmentRegistry::GetInstance().Add(static_cast<const char*>(ptr),
+                                             segment);
+    return core::Tensor(shape, core::shape_util::DefaultStrides(shape), ptr,
+                        dtype, blob);
+}
+
+bool GetSharedMemoryRef(const core::Tensor& tensor,
+                        messages::SharedMemoryRef& ref) {
+    if (!tensor.GetBlob() || !tensor.IsContiguous()) {
+        return false;
+    }
+    const char* ptr = static_cast<const char*>(tensor.GetDataPtr());
+    const char* segment_ptr = nullptr;
+    SharedSegment segment;
+    if (!SharedSegmentRegistry::GetInstance().Find(
+                ptr, tensor.NumElements() * tensor.GetDtype().ByteSize(),
+                tensor.GetDevice(), segment_ptr, segment)) {
+        return false;
+    }
+    ref.name = segment.name;
+    ref.device = segment.device.ToString();
+    ref.offset = int64_t(ptr - segment_ptr);
+    ref.byte_size = segment.byte_size;
+    ref.cuda_ipc_handle = segment.cuda_ipc_handle;
+    return true;
+}
+
+core::Tensor MapSharedTensor(const messages::SharedMemoryRef& ref,
+                             const core::SizeVector& shape,
+                             core::Dtype dtype) {
+    const core::Device device(ref.device);
+    const int64_t num_bytes = shape.NumElements() * dtype.ByteSize();
+    if (ref.offset < 0 || ref.offset + num_bytes > ref.byte_size) {
+        utility::LogError(
+                "Shared memory {} with {} bytes cannot store {} bytes at "
+                "offset {}.",
+                ref.name, ref.byte_size, num_bytes, ref.offset);
+    }
+
+    // Memory of this process is not mapped again. CUDA IPC handles cannot be
+    // opened by the process that created them.
+    std::shared_ptr<core::Blob> blob =
+            SharedSegmentRegistry::GetInstance().FindBlob(ref.name);
+    if (blob) {
+        char* ptr = static_cast<char*>(blob->GetDataPtr()) + ref.offset;
+        return core::Tensor(shape, core::shape_util::DefaultStrides(shape),
+                            ptr, dtype, blob);
+    }
+
+    void* base_ptr = nullptr;
+    std::function<void(void*)> deleter;
+    if (device.GetType() == core::Device::DeviceType::CPU) {
+#ifdef _WIN32
+        utility::LogError(
+                "Shared memory tensors are not supported on Windows.");
+#else
+        int fd = shm_open(ref.name.c_str(), O_RDWR, 0600);
+        if (fd < 0) {
+            utility::LogError("Failed to open shared memory {}: {}", ref.name,
+                              std::strerror(errno));
+        }
+        struct stat info;
+        if (fstat(fd, &info) != 0 || int64_t(info.st_size) < ref.byte_size) {
+            close(fd);
+            utility::LogError("Shared memory {} is smaller than {} bytes.",
+                              ref.name, ref.byte_size);
+        }
+        const int64_t byte_size = ref.byte_size;
+        base_ptr = mmap(nullptr, byte_size, PROT_READ | PROT_WRITE, MAP_SHARED,
+                        fd, 0);
+        close(fd);
+        if (base_ptr == MAP_FAILED) {
+            utility::LogError("Failed to map shared memory {}: {}", ref.name,
+                              std::strerror(errno));
+        }
+        deleter = [base_ptr, byte_size](void*) { munmap(base_ptr, byte_size); };
+#endif
+    } else if (device.GetType() == core::Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        cudaIpcMemHandle_t handle;
+        if (ref.cuda_ipc_handle.size() != sizeof(handle)) {
+            utility::LogError("Invalid CUDA IPC handle for shared memory {}.",
+                              ref.name);
+        }
+        std::memcpy(&handle, ref.cuda_ipc_handle.data(), sizeof(handle));
+        core::CUDAScopedDevice scoped_device(device);
+        OPEN3D_CUDA_CHECK(cudaIpcOpenMemHandle(
+                &base_ptr, handle, cudaIpcMemLazyEnablePeerAccess));
+        deleter = [base_ptr, device](void*) {
+            core::CUDAScopedDevice scoped_device(device);
+            OPEN3D_CUDA_CHECK(cudaIpcCloseMemHandle(base_ptr));
+        };
+#else
+        utility::LogError(
+                "-DBUILD_CUDA_MODULE=OFF. Please build with "
+                "-DBUILD_CUDA_MODULE=ON to use CUDA device.");
+#endif
+    } else {
+        utility::LogError("Unimplemented device {}.", device.ToString());
+    }
+
+    blob = std::make_shared<core::Blob>(device, base_ptr, deleter);
+    char* ptr = static_cast<char*>(base_ptr) + ref.offset;
+    return core::Tensor(shape, core::shape_util::DefaultStrides(shape), ptr,
+                        dtype, blob);
+}
+
+}  // namespace rpc
+}  // namespace io
+}  // namespace open3d
@@ -0,0 +1,93 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#pragma once
+
+#include <msgpack.hpp>
+#include <string>
+#include <vector>
+
+#include "open3d/core/Tensor.h"
+
+namespace open3d {
+namespace io {
+namespace rpc {
+
+namespace messages {
+
+/// Reference to array data in shared memory, see CreateSharedTensor(). Arrays
+/// with an empty name store their data in the message.
+struct SharedMemoryRef {
+    /// Name of the POSIX shared memory object for CPU data. Also identifies
+    /// CUDA allocations.
+    std::string name;
+    /// Device of the data, e.g. "CPU:0" or "CUDA:0".
+    std::string device;
+    /// Byte offset of the array data in the shared allocation.
+    int64_t offset = 0;
+    /// Size of the shared allocation in bytes.
+    int64_t byte_size = 0;
+    /// The cudaIpcMemHandle_t of the allocation if the device is a CUDA
+    /// device.
+    std::vector<uint8_t> cuda_ipc_handle;
+
+    MSGPACK_DEFINE_MAP(name, device, offset, byte_size, cuda_ipc_handle);
+};
+
+}  // namespace messages
+
+/// Creates a tensor in memory that other processes can map without copies.
+/// CPU tensors are allocated in POSIX shared memory, CUDA tensors are shared
+/// with CUDA IPC handles.
+///
+/// Arrays created from the tensor, or from a contiguous slice of it, are sent
+/// as a messages::SharedMemoryRef instead of their data, e.g. with
+/// SetMeshData(). Receivers map the data with MapSharedTensor(). The memory is
+/// released with the last reference in the creating process, so the creator
+/// must keep the tensor alive until all receivers have mapped it. Shared
+/// memory is not supported on Windows.
+core::Tensor CreateSharedTensor(
+        const core::SizeVector& shape,
+        core::Dtype dtype,
+        const core::Device& device = core::Device("CPU:0"));
+
+/// Returns true and sets \p ref if \p tensor is contiguous and stored in
+/// memory created with CreateSharedTensor().
+bool GetSharedMemoryRef(const core::Tensor& tensor,
+                        messages::SharedMemoryRef& ref);
+
+/// Maps the data referenced by \p ref as a contiguous tensor. The mapping is
+/// released with the returned tensor. Tensors created in the same process are
+/// returned as views of the original tensor. Throws if the data cannot be
+/// mapped, e.g. because the creating process has already released it.
+core::Tensor MapSharedTensor(const messages::SharedMemoryRef& ref,
+                             const core::SizeVector& shape,
+                             core::Dtype dtype);
+
+}  // namespace rpc
+}  // namespace io
+}  // namespace open3d
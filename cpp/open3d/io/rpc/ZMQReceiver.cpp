@@ -26,9 +26,11 @@
 
 #include "open3d/io/rpc/ZMQReceiver.h"
 
+#include <vector>
 #include <zmq.hpp>
 
 #include "open3d/io/rpc/MessageProcessorBase.h"
+#include "open3d/io/rpc/MessageUtils.h"
 #include "open3d/io/rpc/Messages.h"
 #include "open3d/io/rpc/ZMQContext.h"
 
@@ -46,6 +48,22 @@ std::shared_ptr<zmq::message_t> CreateStatusMessage(
 
     return msg;
 }
+
+/// Resolves arrays stored in separate frames of a multipart message or in
+/// shared memory. Only SetMeshData messages contain such arrays.
+template <class T>
+void ResolveFrames(
+        T& msg,
+        const std::vector<std::shared_ptr<zmq::message_t>>& frames) {}
+
+void ResolveFrames(
+        open3d::io::rpc::messages::SetMeshData& msg,
+        const std::vector<std::shared_ptr<zmq::message_t>>& frames) {
+    if (frames.size() > 1) {
+        open3d::io::rpc::ResolveArrayFrames(msg.data, frames);
+    }
+    open3d::io::rpc::ResolveSharedMemoryArrays(msg.data);
+}
 }  // namespace
 
 namespace open3d {
@@ -144,13 +162,22 @@ void ZMQReceiver::Mainloop() {
             if (!keep_running_) break;
         }
         try {
-            zmq::message_t message;
-            if (!socket_->recv(message)) {
+            auto message = std::make_shared<zmq::message_t>();
+            if (!socket_->recv(*message)) {
                 continue;
             }
+            // Receive the remaining frames of multipart messages. These store
+            // large arrays referenced by the messages in the first frame.
+            std::vector<std::shared_ptr<zmq::message_t>> frames{message};
+            while (socket_->get(zmq::sockopt::rcvmore)) {
+                frames.push_back(std::make_shared<zmq::message_t>());
+                if (!socket_->recv(*frames.back())) {
+                    break;
+                }
+            }
 
-            const char* buffer = (char*)message.data();
-            size_t buffer_size = message.size();
+            const char* buffer = (char*)message->data();
+            size_t buffer_size = message->size();
 
             std::vector<std::shared_ptr<zmq::message_t>> replies;
 
@@ -176,6 +203,7 @@ void ZMQReceiver::Mainloop() {
         auto obj = oh.get();                                            \
         MSGTYPE msg;                                                    \
         msg = obj.as<MSGTYPE>();                                        \
+        ResolveFrames(msg, frames);                                     \
         auto reply = processor_->ProcessMessage(req, msg, oh);          \
         if (reply) {                                                    \
             replies.push_back(reply);                                   \
@@ -49,10 +49,13 @@ namespace open3d {
 namespace io {
 
 AzureKinectRecorder::AzureKinectRecorder(
-        const AzureKinectSensorConfig& sensor_config, size_t sensor_index)
+        const AzureKinectSensorConfig& sensor_config,
+        size_t sensor_index,
+        size_t write_queue_size)
     : RGBDRecorder(),
       sensor_(AzureKinectSensor(sensor_config)),
-      device_index_(sensor_index) {}
+      device_index_(sensor_index),
+      write_queue_size_(write_queue_size) {}
 
 AzureKinectRecorder::~AzureKinectRecorder() { CloseRecord(); }
 
@@ -77,13 +80,52 @@ bool AzureKinectRecorder::OpenRecord(const std::string& filename) {
         utility::LogInfo("Writing to header");
 
         is_record_created_ = true;
+        stop_writing_ = false;
+        write_failed_ = false;
+        num_dropped_frames_ = 0;
+        write_thread_ = std::thread(&AzureKinectRecorder::WriteLoop, this);
     }
     return true;
 }
 
+void AzureKinectRecorder::WriteLoop() {
+    while (true) {
+        k4a_capture_t capture;
+        {
+            std::unique_lock<std::mutex> lock(write_mutex_);
+            write_cv_.wait(lock, [this]() {
+                return stop_writing_ || !write_queue_.empty();
+            });
+            // Write the remaining captures before stopping.
+            if (write_queue_.empty()) return;
+            capture = write_queue_.front();
+            write_queue_.pop_front();
+        }
+        if (!write_failed_ &&
+            K4A_FAILED(k4a_plugin::k4a_record_write_capture(recording_,
+                                                            capture))) {
+            utility::LogWarning("Unable to write to capture");
+            write_failed_ = true;
+        }
+        k4a_plugin::k4a_capture_release(capture);
+    }
+}
+
 bool AzureKinectRecorder::CloseRecord() {
     if (is_record_created_) {
         utility::LogInfo("Saving recording...");
+        {
+            std::lock_guard<std::mutex> lock(write_mutex_);
+            stop_writing_ = true;
+        }
+        write_cv_.notify_one();
+        write_thread_.join();
+        if (num_dropped_frames_ > 0) {
+            utility::LogWarning(
+                    "{} frames were not recorded because the write queue was "
+                    "full.",
+                    num_dropped_frames_);
+        }
         if (K4A_FAILED(k4a_plugin::k4a_record_flush(recording_))) {
             utility::LogWarning("Unable to flush record file");
             return false;
@@ -102,21 +144,31 @@ std::shared_ptr<geometry::RGBDImage> AzureKinectRecorder::RecordFrame(
     if (!capture) return nullptr;
 
     if (capture != nullptr && is_record_created_ && write) {
-        if (K4A_FAILED(k4a_plugin::k4a_record_write_capture(recording_,
-                                                            capture))) {
+        if (write_failed_) {
+            k4a_plugin::k4a_capture_release(capture);
             utility::LogError("Unable to write to capture");
         }
+        std::unique_lock<std::mutex> lock(write_mutex_);
+        if (write_queue_.size() < write_queue_size_) {
+            // The writer thread releases its own reference.
+            k4a_plugin::k4a_capture_reference(capture);
+            write_queue_.push_back(capture);
+            lock.unlock();
+            write_cv_.notify_one();
+        } else {
+            ++num_dropped_frames_;
+        }
     }
 
     auto im_rgbd = AzureKinectSensor::DecompressCapture(
             capture, enable_align_depth_to_color
                              ? sensor_.transform_depth_to_color_
                              : nullptr);
+    k4a_plugin::k4a_capture_release(capture);
     if (im_rgbd == nullptr) {
         utility::LogDebug("Invalid capture, skipping this frame");
         return nullptr;
     }
-    k4a_plugin::k4a_capture_release(capture);
     return im_rgbd;
 }
 }  // namespace io
@@ -27,14 +27,19 @@
 #pragma once
 
 #include <atomic>
+#include <condition_variable>
+#include <deque>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
 
 #include "open3d/io/sensor/RGBDRecorder.h"
 #include "open3d/io/sensor/azure_kinect/AzureKinectSensor.h"
 #include "open3d/io/sensor/azure_kinect/AzureKinectSensorConfig.h"
 
-struct _k4a_record_t;  // typedef _k4a_record_t* k4a_record_t;
+struct _k4a_capture_t;  // typedef _k4a_capture_t* k4a_capture_t;
+struct _k4a_record_t;   // typedef _k4a_record_t* k4a_record_t;
 
 namespace open3d {
 
@@ -48,10 +53,16 @@ namespace io {
 /// \class AzureKinectRecorder
 ///
 /// AzureKinect recorder.
+///
+/// Captures are written to the mkv file by a background thread, so that
+/// slow disk writes do not stall the capture. If more than
+/// \p write_queue_size captures are waiting to be written, new captures are
+/// not recorded and counted in GetNumDroppedFrames().
 class AzureKinectRecorder : public RGBDRecorder {
 public:
     AzureKinectRecorder(const AzureKinectSensorConfig& sensor_config,
-                        size_t sensor_index);
+                        size_t sensor_index,
+                        size_t write_queue_size = 30);
     ~AzureKinectRecorder() override;
 
     /// Initialize sensor.
@@ -73,12 +84,26 @@ public:
     /// Check if the mkv file is created.
     bool IsRecordCreated() { return is_record_created_; }
 
+    /// The number of frames not recorded because the write queue was full.
+    size_t GetNumDroppedFrames() const { return num_dropped_frames_; }
+
 protected:
+    void WriteLoop();
+
     AzureKinectSensor sensor_;
     _k4a_record_t* recording_;
     size_t device_index_;
 
     bool is_record_created_ = false;
+
+    size_t write_queue_size_;
+    std::deque<_k4a_capture_t*> write_queue_;
+    std::mutex write_mutex_;
+    std::condition_variable write_cv_;
+    std::thread write_thread_;
+    bool stop_writing_ = false;
+    std::atomic<bool> write_failed_{false};
+    std::atomic<size_t> num_dropped_frames_{0};
 };
 
 }  // namespace io
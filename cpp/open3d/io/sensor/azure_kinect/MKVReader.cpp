@@ -40,7 +40,12 @@
 namespace open3d {
 namespace io {
 
-MKVReader::MKVReader() : handle_(nullptr), transformation_(nullptr) {}
+MKVReader::MKVReader(size_t prefetch_size)
+    : handle_(nullptr),
+      transformation_(nullptr),
+      prefetch_size_(prefetch_size) {}
+
+MKVReader::~MKVReader() { StopPrefetch(); }
 
 bool MKVReader::IsOpened() { return handle_ != nullptr; }
 
@@ -72,11 +77,67 @@ bool MKVReader::Open(const std::string &filename) {
 
     metadata_.ConvertFromJsonValue(GetMetadataJson());
     is_eof_ = false;
+    StartPrefetch();
 
     return true;
 }
 
-void MKVReader::Close() { k4a_plugin::k4a_playback_close(handle_); }
+void MKVReader::Close() {
+    StopPrefetch();
+    k4a_plugin::k4a_playback_close(handle_);
+}
+
+void MKVReader::StartPrefetch() {
+    if (prefetch_size_ == 0) return;
+    prefetch_queue_.clear();
+    prefetch_stop_ = false;
+    prefetch_done_ = false;
+    prefetch_error_ = nullptr;
+    prefetch_thread_ = std::thread(&MKVReader::PrefetchFrames, this);
+}
+
+void MKVReader::StopPrefetch() {
+    if (!prefetch_thread_.joinable()) return;
+    {
+        std::lock_guard<std::mutex> lock(prefetch_mutex_);
+        prefetch_stop_ = true;
+    }
+    prefetch_cv_.notify_all();
+    prefetch_thread_.join();
+    prefetch_queue_.clear();
+}
+
+void MKVReader::PrefetchFrames() {
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(prefetch_mutex_);
+            prefetch_cv_.wait(lock, [this] {
+                return prefetch_stop_ ||
+                       prefetch_queue_.size() < prefetch_size_;
+            });
+            if (prefetch_stop_) return;
+        }
+        bool eof = false;
+        std::shared_ptr<geometry::RGBDImage> rgbd;
+        std::exception_ptr error;
+        try {
+            rgbd = ReadNextFrame(eof);
+        } catch (...) {
+            error = std::current_exception();
+        }
+        {
+            std::lock_guard<std::mutex> lock(prefetch_mutex_);
+            if (eof || error) {
+                prefetch_error_ = error;
+                prefetch_done_ = true;
+            } else {
+                prefetch_queue_.push_back(rgbd);
+            }
+        }
+        prefetch_cv_.notify_all();
+        if (eof || error) return;
+    }
+}
 
 Json::Value MKVReader::GetMetadataJson() {
     static const std::unordered_map<std::string, std::pair<int, int>>
@@ -146,13 +207,18 @@ bool MKVReader::SeekTimestamp(size_t timestamp) {
         return false;
     }
 
-    if (K4A_RESULT_SUCCEEDED !=
-        k4a_plugin::k4a_playback_seek_timestamp(handle_, timestamp,
-                                                K4A_PLAYBACK_SEEK_BEGIN)) {
+    // Frames read ahead from the old position are discarded.
+    StopPrefetch();
+    bool success = K4A_RESULT_SUCCEEDED ==
+                   k4a_plugin::k4a_playback_seek_timestamp(
+                           handle_, timestamp, K4A_PLAYBACK_SEEK_BEGIN);
+    if (success) {
+        is_eof_ = false;
+    } else {
         utility::LogWarning("Unable to go to timestamp {}", timestamp);
-        return false;
     }
-    return true;
+    StartPrefetch();
+    return success;
 }
 
 std::shared_ptr<geometry::RGBDImage> MKVReader::NextFrame() {
@@ -160,12 +226,40 @@ std::shared_ptr<geometry::RGBDImage> MKVReader::NextFrame() {
         utility::LogError("Null file handler. Please call Open().");
     }
 
+    bool eof = false;
+    std::shared_ptr<geometry::RGBDImage> rgbd;
+    if (prefetch_thread_.joinable()) {
+        std::unique_lock<std::mutex> lock(prefetch_mutex_);
+        prefetch_cv_.wait(lock, [this] {
+            return !prefetch_queue_.empty() || prefetch_done_;
+        });
+        if (!prefetch_queue_.empty()) {
+            rgbd = prefetch_queue_.front();
+            prefetch_queue_.pop_front();
+            lock.unlock();
+            prefetch_cv_.notify_all();
+        } else if (prefetch_error_) {
+            std::rethrow_exception(prefetch_error_);
+        } else {
+            eof = true;
+        }
+    } else {
+        rgbd = ReadNextFrame(eof);
+    }
+
+    if (eof) {
+        utility::LogInfo("EOF reached");
+        is_eof_ = true;
+    }
+    return rgbd;
+}
+
+std::shared_ptr<geometry::RGBDImage> MKVReader::ReadNextFrame(bool &eof) {
     k4a_capture_t k4a_capture;
     k4a_stream_result_t res =
             k4a_plugin::k4a_playback_get_next_capture(handle_, &k4a_capture);
     if (K4A_STREAM_RESULT_EOF == res) {
-        utility::LogInfo("EOF reached");
-        is_eof_ = true;
+        eof = true;
         return nullptr;
     } else if (K4A_STREAM_RESULT_FAILED == res) {
         utility::LogInfo("Empty frame encountered, skip");
@@ -26,6 +26,12 @@
 
 #pragma once
 
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <thread>
+
 #include "open3d/geometry/RGBDImage.h"
 #include "open3d/io/sensor/azure_kinect/MKVMetadata.h"
 #include "open3d/utility/IJsonConvertible.h"
@@ -41,11 +47,20 @@ namespace io {
 /// \class MKVReader
 ///
 /// AzureKinect mkv file reader.
+///
+/// When constructed with a non-zero \p prefetch_size, captures are read and
+/// decompressed by a background thread into a bounded queue, so that decoding
+/// of the next frames overlaps with the processing of the current one.
 class MKVReader {
 public:
     /// \brief Default Constructor.
-    MKVReader();
-    virtual ~MKVReader() {}
+    ///
+    /// \param prefetch_size Max number of decoded frames to read ahead in a
+    /// background thread. 0 (default) decodes synchronously in NextFrame().
+    explicit MKVReader(size_t prefetch_size = 0);
+    MKVReader(const MKVReader &) = delete;
+    MKVReader &operator=(const MKVReader &) = delete;
+    virtual ~MKVReader();
 
     /// Check If the mkv file is opened.
     bool IsOpened();
@@ -66,12 +81,34 @@ public:
     /// Get next frame from the mkv playback and returns the RGBD object.
     std::shared_ptr<geometry::RGBDImage> NextFrame();
 
+private:
+    /// Read and decompress the next capture on the calling thread. Sets \p eof
+    /// when the end of the playback is reached.
+    std::shared_ptr<geometry::RGBDImage> ReadNextFrame(bool &eof);
+
+    /// Launch / join the background frame reader. The playback handle is only
+    /// touched by the reader thread while it is running.
+    void StartPrefetch();
+    void StopPrefetch();
+    void PrefetchFrames();
+
 private:
     _k4a_playback_t *handle_;
     _k4a_transformation_t *transformation_;
     MKVMetadata metadata_;
     bool is_eof_ = false;
 
+    size_t prefetch_size_;
+    std::thread prefetch_thread_;
+    std::mutex prefetch_mutex_;
+    std::condition_variable prefetch_cv_;
+    /// Decoded frames, nullptr entries are kept for failed captures so that
+    /// NextFrame() behaves the same with and without prefetching.
+    std::deque<std::shared_ptr<geometry::RGBDImage>> prefetch_queue_;
+    bool prefetch_stop_ = false;
+    bool prefetch_done_ = false;
+    std::exception_ptr prefetch_error_;
+
     Json::Value GetMetadataJson();
     std::string GetTagInMetadata(const std::string &tag_name);
 };
@@ -0,0 +1,476 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+// Sort based grid subsampling. The points are sorted by (batch, voxel) with a
+// stable sort, which groups the points of each voxel in input order. Each voxel
+// is then reduced by a single thread, so the sums are computed in the same
+// order as in the CPU version.
+
+#include <thrust/binary_search.h>
+#include <thrust/execution_policy.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/constant_iterator.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/discard_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/reduce.h>
+#include <thrust/scan.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+#include <thrust/tuple.h>
+
+#include "open3d/core/CUDAUtils.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/core/TensorCheck.h"
+#include "open3d/ml/contrib/GridSubsampling.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace ml {
+namespace contrib {
+
+namespace {
+
+constexpr int kBlockSize = 256;
+
+typedef thrust::tuple<float, float, float> Float3;
+
+struct ReadPoint {
+    const float* points;
+    __host__ __device__ Float3 operator()(int64_t i) const {
+        return thrust::make_tuple(points[3 * i], points[3 * i + 1],
+                                  points[3 * i + 2]);
+    }
+};
+
+struct MinFloat3 {
+    __host__ __device__ Float3 operator()(const Float3& a,
+                                          const Float3& b) const {
+        return thrust::make_tuple(fminf(thrust::get<0>(a), thrust::get<0>(b)),
+                                  fminf(thrust::get<1>(a), thrust::get<1>(b)),
+                                  fminf(thrust::get<2>(a), thrust::get<2>(b)));
+    }
+};
+
+/// Computes the origin of the grid of each batch item from the minimum of its
+/// points, in the same way as grid_subsampling().
+__global__ void ComputeOriginsKernel(float* __restrict__ origins,
+                                     const int64_t* const __restrict__ batches,
+                                     const float* const __restrict__ min_x,
+                                     const float* const __restrict__ min_y,
+                                     const float* const __restrict__ min_z,
+                                     int64_t num_nonempty_batches,
+                                     float sampleDl) {
+    const int64_t i = int64_t(blockDim.x) * blockIdx.x + threadIdx.x;
+    if (i >= num_nonempty_batches) return;
+    const int64_t b = batches[i];
+    origins[3 * b + 0] = floorf(min_x[i] * (1 / sampleDl)) * sampleDl;
+    origins[3 * b + 1] = floorf(min_y[i] * (1 / sampleDl)) * sampleDl;
+    origins[3 * b + 2] = floorf(min_z[i] * (1 / sampleDl)) * sampleDl;
+}
+
+__global__ void ComputeVoxelKeysKernel(int* __restrict__ voxel_x,
+                                       int* __restrict__ voxel_y,
+                                       int* __restrict__ voxel_z,
+                                       const float* const __restrict__ points,
+                                       const int64_t* const __restrict__ batch,
+                                       const float* const __restrict__ origins,
+                                       int64_t num_points,
+                                       float sampleDl) {
+    const int64_t i = int64_t(blockDim.x) * blockIdx.x + threadIdx.x;
+    if (i >= num_points) return;
+    const float* origin = origins + 3 * batch[i];
+    voxel_x[i] = int(floorf((points[3 * i + 0] - origin[0]) / sampleDl));
+    voxel_y[i] = int(floorf((points[3 * i + 1] - origin[1]) / sampleDl));
+    voxel_z[i] = int(floorf((points[3 * i + 2] - origin[2]) / sampleDl));
+}
+
+/// Writes the number of kept voxels of each batch item to
+/// out_row_splits[1:]. The inclusive prefix sum turns this into row splits.
+__global__ void CountOutputVoxelsKernel(
+        int64_t* __restrict__ out_row_splits,
+        const int64_t* const __restrict__ batch_voxel_starts,
+        int64_t num_batches,
+        int64_t max_p) {
+    const int64_t b = int64_t(blockDim.x) * blockIdx.x + threadIdx.x;
+    if (b == 0) out_row_splits[0] = 0;
+    if (b >= num_batches) return;
+    const int64_t count = batch_voxel_starts[b + 1] - batch_voxel_starts[b];
+    out_row_splits[b + 1] = count < max_p ? count : max_p;
+}
+
+/// Returns the output index of voxel \p v or -1 if the voxel is dropped
+/// because its batch item already has max_p voxels.
+__device__ int64_t OutputIndex(int64_t v,
+                               const int64_t* const voxel_batch,
+                               const int64_t* const batch_voxel_starts,
+                               const int64_t* const out_row_splits,
+                               int64_t max_p) {
+    const int64_t b = voxel_batch[v];
+    const int64_t rank = v - batch_voxel_starts[b];
+    return rank < max_p ? out_row_splits[b] + rank : -1;
+}
+
+__global__ void ReduceVoxelsKernel(
+        float* __restrict__ out_points,
+        float* __restrict__ out_features,
+        int64_t* __restrict__ point_voxel,
+        const float* const __restrict__ points,
+        const float* const __restrict__ features,
+        int64_t feature_dim,
+        const int64_t* const __restrict__ sorted_indices,
+        const int64_t* const __restrict__ voxel_starts,
+        const int64_t* const __restrict__ voxel_batch,
+        const int64_t* const __restrict__ batch_voxel_starts,
+        const int64_t* const __restrict__ out_row_splits,
+        int64_t num_voxels,
+        int64_t num_points,
+        int64_t max_p) {
+    const int64_t v = int64_t(blockDim.x) * blockIdx.x + threadIdx.x;
+    if (v >= num_voxels) return;
+    const int64_t begin = voxel_starts[v];
+    const int64_t end = v + 1 < num_voxels ? voxel_starts[v + 1] : num_points;
+    for (int64_t j = begin; j < end; ++j) {
+        point_voxel[j] = v;
+    }
+
+    const int64_t out_idx = OutputIndex(v, voxel_batch, batch_voxel_starts,
+                                        out_row_splits, max_p);
+    if (out_idx < 0) return;
+    const float count = float(end - begin);
+
+    float sum[3] = {0, 0, 0};
+    for (int64_t j = begin; j < end; ++j) {
+        const int64_t i = sorted_indices[j];
+        for (int d = 0; d < 3; ++d) {
+            sum[d] += points[3 * i + d];
+        }
+    }
+    for (int d = 0; d < 3; ++d) {
+        out_points[3 * out_idx + d] = sum[d] * (1.0f / count);
+    }
+
+    for (int64_t k = 0; k < feature_dim; ++k) {
+        float feature_sum = 0;
+        for (int64_t j = begin; j < end; ++j) {
+            feature_sum += features[feature_dim * sorted_indices[j] + k];
+        }
+        out_features[feature_dim * out_idx + k] = feature_sum / count;
+    }
+}
+
+__global__ void GatherLabelsKernel(int* __restrict__ labels,
+                                   const int* const __restrict__ classes,
+                                   const int64_t* const __restrict__ indices,
+                                   int64_t num_points,
+                                   int64_t label_dim,
+                                   int64_t label_idx) {
+    const int64_t j = int64_t(blockDim.x) * blockIdx.x + threadIdx.x;
+    if (j >= num_points) return;
+    labels[j] = classes[label_dim * indices[j] + label_idx];
+}
+
+/// Finds the most frequent label of each voxel. The labels of a voxel are
+/// sorted, so this is the longest run. Ties are resolved to the smaller label.
+__global__ void VoxelModeKernel(int* __restrict__ out_classes,
+                                const int* const __restrict__ sorted_labels,
+                                const int64_t* const __restrict__ voxel_starts,
+                                const int64_t* const __restrict__ voxel_batch,
+                                const int64_t* const __restrict__
+                                        batch_voxel_starts,
+                                const int64_t* const __restrict__
+                                        out_row_splits,
+                                int64_t num_voxels,
+                                int64_t num_points,
+                                int64_t max_p,
+                                int64_t label_dim,
+                                int64_t label_idx) {
+    const int64_t v = int64_t(blockDim.x) * blockIdx.x + threadIdx.x;
+    if (v >= num_voxels) return;
+    const int64_t out_idx = OutputIndex(v, voxel_batch, batch_voxel_starts,
+                                        out_row_splits, max_p);
+    if (out_idx < 0) return;
+    const int64_t begin = voxel_starts[v];
+    const int64_t end = v + 1 < num_voxels ? voxel_starts[v + 1] : num_points;
+
+    int best_label = sorted_labels[begin];
+    int64_t best_count = 0;
+    int64_t run_begin = begin;
+    for (int64_t j = begin + 1; j <= end; ++j) {
+        if (j == end || sorted_labels[j] != sorted_labels[run_begin]) {
+            if (j - run_begin > best_count) {
+                best_count = j - run_begin;
+                best_label = sorted_labels[run_begin];
+            }
+            run_begin = j;
+        }
+    }
+    out_classes[label_dim * out_idx + label_idx] = best_label;
+}
+
+int64_t NumBlocks(int64_t n) { return (n + kBlockSize - 1) / kBlockSize; }
+
+}  // namespace
+
+void BatchGridSubsamplingCUDA(const core::Tensor& points,
+                              const core::Tensor& row_splits,
+                              const core::Tensor& features,
+                              const core::Tensor& classes,
+                              float sampleDl,
+                              int max_p,
+                              core::Tensor& subsampled_points,
+                              core::Tensor& subsampled_row_splits,
+                              core::Tensor& subsampled_features,
+                              core::Tensor& subsampled_classes) {
+    const core::Device device = points.GetDevice();
+    if (device.GetType() != core::Device::DeviceType::CUDA) {
+        utility::LogError("points must be a CUDA tensor, but got {}.",
+                          device.ToString());
+    }
+    if (sampleDl <= 0) {
+        utility::LogError("sampleDl must be positive, but got {}.", sampleDl);
+    }
+    core::AssertTensorDtype(points, core::Float32);
+    core::AssertTensorShape(points, {utility::nullopt, 3});
+    core::AssertTensorDtype(row_splits, core::Int64);
+    core::AssertTensorDevice(row_splits, device);
+    if (row_splits.NumDims() != 1 || row_splits.GetLength() < 1) {
+        utility::LogError("row_splits must have shape (B+1,), but got {}.",
+                          row_splits.GetShape().ToString());
+    }
+    const int64_t num_points = points.GetLength();
+    const int64_t num_batches = row_splits.GetLength() - 1;
+    if (row_splits[0].Item<int64_t>() != 0 ||
+        row_splits[num_batches].Item<int64_t>() != num_points) {
+        utility::LogError(
+                "row_splits must start with 0 and end with the number of "
+                "points {}.",
+                num_points);
+    }
+
+    const bool use_features = features.NumElements() > 0;
+    const bool use_classes = classes.NumElements() > 0;
+    int64_t feature_dim = 0;
+    if (use_features) {
+        core::AssertTensorDtype(features, core::Float32);
+        core::AssertTensorDevice(features, device);
+        if (features.NumDims() != 2 || features.GetLength() != num_points) {
+            utility::LogError("features must have shape ({}, d), but got {}.",
+                              num_points, features.GetShape().ToString());
+        }
+        feature_dim = features.GetShape(1);
+    }
+    int64_t label_dim = 0;
+    if (use_classes) {
+        core::AssertTensorDtype(classes, core::Int32);
+        core::AssertTensorDevice(classes, device);
+        if (classes.NumDims() < 1 || classes.NumDims() > 2 ||
+            classes.GetLength() != num_points) {
+            utility::LogError(
+                    "classes must have shape ({},) or ({}, l), but got {}.",
+                    num_points, num_points, classes.GetShape().ToString());
+        }
+        label_dim = classes.NumDims() == 2 ? classes.GetShape(1) : 1;
+    }
+    const int64_t max_points_per_batch = max_p < 1 ? num_points : max_p;
+
+    const core::Tensor points_c = points.Contiguous();
+    const core::Tensor row_splits_c = row_splits.Contiguous();
+    const core::Tensor features_c = features.Contiguous();
+    const core::Tensor classes_c = classes.Contiguous();
+
+    core::CUDAScopedDevice scoped_device(device);
+    cudaStream_t stream = core::cuda::GetStream();
+    auto policy = thrust::cuda::par.on(stream);
+    const float* points_ptr = points_c.GetDataPtr<float>();
+    const int64_t* row_splits_ptr = row_splits_c.GetDataPtr<int64_t>();
+
+    // Batch item of each point.
+    core::Tensor batch = core::Tensor::Empty({num_points}, core::Int64, device);
+    int64_t* batch_ptr = batch.GetDataPtr<int64_t>();
+    thrust::counting_iterator<int64_t> point_first(0);
+    thrust::upper_bound(policy, row_splits_ptr + 1,
+                        row_splits_ptr + num_batches + 1, point_first,
+                        point_first + num_points, batch_ptr);
+
+    // Grid origins from the minimum of each non-empty batch item.
+    core::Tensor origins =
+            core::Tensor::Zeros({num_batches, 3}, core::Float32, device);
+    {
+        core::Tensor nonempty_batches =
+                core::Tensor::Empty({num_batches}, core::Int64, device);
+        core::Tensor min_x =
+                core::Tensor::Empty({num_batches}, core::Float32, device);
+        core::Tensor min_y = core::Tensor::EmptyLike(min_x);
+        core::Tensor min_z = core::Tensor::EmptyLike(min_x);
+        auto points_iter = thrust::make_transform_iterator(
+                point_first, ReadPoint{points_ptr});
+        auto result = thrust::reduce_by_key(
+                policy, batch_ptr, batch_ptr + num_points, points_iter,
+                nonempty_batches.GetDataPtr<int64_t>(),
+                thrust::make_zip_iterator(thrust::make_tuple(
+                        min_x.GetDataPtr<float>(), min_y.GetDataPtr<float>(),
+                        min_z.GetDataPtr<float>())),
+                thrust::equal_to<int64_t>(), MinFloat3());
+        const int64_t num_nonempty_batches =
+                result.first - nonempty_batches.GetDataPtr<int64_t>();
+        if (num_nonempty_batches) {
+            ComputeOriginsKernel<<<NumBlocks(num_nonempty_batches), kBlockSize,
+                                   0, stream>>>(
+                    origins.GetDataPtr<float>(),
+                    nonempty_batches.GetDataPtr<int64_t>(),
+                    min_x.GetDataPtr<float>(), min_y.GetDataPtr<float>(),
+                    min_z.GetDataPtr<float>(), num_nonempty_batches, sampleDl);
+        }
+    }
+
+    // Sort the points by (batch, voxel). The sort is stable to keep the input
+    // order of the points within each voxel.
+    core::Tensor voxel_keys =
+            core::Tensor::Empty({3, num_points}, core::Int32, device);
+    int* voxel_x = voxel_keys.GetDataPtr<int>();
+    int* voxel_y = voxel_x + num_points;
+    int* voxel_z = voxel_y + num_points;
+    if (num_points) {
+        ComputeVoxelKeysKernel<<<NumBlocks(num_points), kBlockSize, 0,
+                                 stream>>>(voxel_x, voxel_y, voxel_z,
+                                           points_ptr, batch_ptr,
+                                           origins.GetDataPtr<float>(),
+                                           num_points, sampleDl);
+    }
+    core::Tensor sorted_indices =
+            core::Tensor::Empty({num_points}, core::Int64, device);
+    int64_t* sorted_indices_ptr = sorted_indices.GetDataPtr<int64_t>();
+    thrust::sequence(policy, sorted_indices_ptr,
+                     sorted_indices_ptr + num_points);
+    auto keys_first = thrust::make_zip_iterator(
+            thrust::make_tuple(batch_ptr, voxel_x, voxel_y, voxel_z));
+    thrust::stable_sort_by_key(policy, keys_first, keys_first + num_points,
+                               sorted_indices_ptr);
+
+    // Start of each voxel in the sorted points and the batch of each voxel.
+    core::Tensor voxel_batch =
+            core::Tensor::Empty({num_points}, core::Int64, device);
+    core::Tensor voxel_counts =
+            core::Tensor::Empty({num_points}, core::Int64, device);
+    int64_t* voxel_batch_ptr = voxel_batch.GetDataPtr<int64_t>();
+    int64_t* voxel_counts_ptr = voxel_counts.GetDataPtr<int64_t>();
+    auto voxels_end = thrust::reduce_by_key(
+            policy, keys_first, keys_first + num_points,
+            thrust::constant_iterator<int64_t>(1),
+            thrust::make_zip_iterator(thrust::make_tuple(
+                    voxel_batch_ptr, thrust::make_discard_iterator(),
+                    thrust::make_discard_iterator(),
+                    thrust::make_discard_iterator())),
+            voxel_counts_ptr);
+    const int64_t num_voxels = voxels_end.second - voxel_counts_ptr;
+    core::Tensor voxel_starts = voxel_counts;
+    int64_t* voxel_starts_ptr = voxel_starts.GetDataPtr<int64_t>();
+    thrust::exclusive_scan(policy, voxel_counts_ptr,
+                           voxel_counts_ptr + num_voxels, voxel_starts_ptr);
+
+    // Number of kept voxels of each batch item.
+    core::Tensor batch_voxel_starts =
+            core::Tensor::Empty({num_batches + 1}, core::Int64, device);
+    int64_t* batch_voxel_starts_ptr = batch_voxel_starts.GetDataPtr<int64_t>();
+    thrust::counting_iterator<int64_t> batch_first(0);
+    thrust::lower_bound(policy, voxel_batch_ptr, voxel_batch_ptr + num_voxels,
+                        batch_first, batch_first + num_batches + 1,
+                        batch_voxel_starts_ptr);
+    subsampled_row_splits =
+            core::Tensor::Empty({num_batches + 1}, core::Int64, device);
+    int64_t* out_row_splits_ptr = subsampled_row_splits.GetDataPtr<int64_t>();
+    CountOutputVoxelsKernel<<<NumBlocks(num_batches + 1), kBlockSize, 0,
+                              stream>>>(out_row_splits_ptr,
+                                        batch_voxel_starts_ptr, num_batches,
+                                        max_points_per_batch);
+    thrust::inclusive_scan(policy, out_row_splits_ptr + 1,
+                           out_row_splits_ptr + num_batches + 1,
+                           out_row_splits_ptr + 1);
+    const int64_t num_out =
+            subsampled_row_splits[num_batches].Item<int64_t>();
+
+    subsampled_points =
+            core::Tensor::Empty({num_out, 3}, core::Float32, device);
+    subsampled_features = core::Tensor::Empty({num_out, feature_dim},
+                                              core::Float32, device);
+    core::Tensor point_voxel =
+            core::Tensor::Empty({num_points}, core::Int64, device);
+    if (num_voxels) {
+        ReduceVoxelsKernel<<<NumBlocks(num_voxels), kBlockSize, 0, stream>>>(
+                subsampled_points.GetDataPtr<float>(),
+                use_features ? subsampled_features.GetDataPtr<float>()
+                             : nullptr,
+                point_voxel.GetDataPtr<int64_t>(), points_ptr,
+                use_features ? features_c.GetDataPtr<float>() : nullptr,
+                feature_dim, sorted_indices_ptr, voxel_starts_ptr,
+                voxel_batch_ptr, batch_voxel_starts_ptr, out_row_splits_ptr,
+                num_voxels, num_points, max_points_per_batch);
+    }
+    if (!use_features) {
+        subsampled_features = core::Tensor();
+    }
+
+    subsampled_classes = core::Tensor();
+    if (use_classes) {
+        subsampled_classes = classes.NumDims() == 2
+                                     ? core::Tensor::Empty({num_out, label_dim},
+                                                           core::Int32, device)
+                                     : core::Tensor::Empty({num_out},
+                                                           core::Int32, device);
+        core::Tensor labels =
+                core::Tensor::Empty({num_points}, core::Int32, device);
+        core::Tensor labels_voxel = core::Tensor::EmptyLike(point_voxel);
+        int* labels_ptr = labels.GetDataPtr<int>();
+        int64_t* labels_voxel_ptr = labels_voxel.GetDataPtr<int64_t>();
+        for (int64_t l = 0; l < label_dim && num_voxels; ++l) {
+            GatherLabelsKernel<<<NumBlocks(num_points), kBlockSize, 0,
+                                 stream>>>(labels_ptr,
+                                           classes_c.GetDataPtr<int>(),
+                                           sorted_indices_ptr, num_points,
+                                           label_dim, l);
+            // Sort by (voxel, label) with two stable radix sorts.
+            labels_voxel.CopyFrom(point_voxel);
+            thrust::stable_sort_by_key(policy, labels_ptr,
+                                       labels_ptr + num_points,
+                                       labels_voxel_ptr);
+            thrust::stable_sort_by_key(policy, labels_voxel_ptr,
+                                       labels_voxel_ptr + num_points,
+                                       labels_ptr);
+            VoxelModeKernel<<<NumBlocks(num_voxels), kBlockSize, 0, stream>>>(
+                    subsampled_classes.GetDataPtr<int>(), labels_ptr,
+                    voxel_starts_ptr, voxel_batch_ptr, batch_voxel_starts_ptr,
+                    out_row_splits_ptr, num_voxels, num_points,
+                    max_points_per_batch, label_dim, l);
+        }
+    }
+    OPEN3D_CUDA_CHECK(cudaGetLastError());
+}
+
+}  // namespace contrib
+}  // namespace ml
+}  // namespace open3d
@@ -53,6 +53,10 @@
 #include "open3d/ml/contrib/Cloud.h"
 
 namespace open3d {
+namespace core {
+class Tensor;
+}
+
 namespace ml {
 namespace contrib {
 
@@ -147,6 +151,39 @@ void batch_grid_subsampling(std::vector<PointXYZ>& original_points,
                             float sampleDl,
                             int max_p);
 
+#ifdef BUILD_CUDA_MODULE
+/// Batched grid subsampling on a CUDA device. The points of each batch item
+/// are grouped into voxels of size \p sampleDl like in
+/// batch_grid_subsampling() and each voxel is replaced by the barycenter of
+/// its points, the mean of their features and the most frequent class.
+/// Within each batch item the subsampled points are ordered by voxel.
+///
+/// \param points (N, 3) Float32 tensor on a CUDA device.
+/// \param row_splits (B+1,) Int64 tensor with the start and end of each
+///        batch item in \p points.
+/// \param features (N, d) Float32 tensor or an empty tensor.
+/// \param classes (N,) or (N, l) Int32 tensor or an empty tensor.
+/// \param sampleDl The voxel size.
+/// \param max_p The maximum number of subsampled points per batch item.
+///        Values smaller than 1 disable the limit.
+/// \param subsampled_points (M, 3) output tensor.
+/// \param subsampled_row_splits (B+1,) output tensor.
+/// \param subsampled_features (M, d) output tensor. Empty if \p features is
+///        empty.
+/// \param subsampled_classes (M,) or (M, l) output tensor. Empty if
+///        \p classes is empty.
+void BatchGridSubsamplingCUDA(const core::Tensor& points,
+                              const core::Tensor& row_splits,
+                              const core::Tensor& features,
+                              const core::Tensor& classes,
+                              float sampleDl,
+                              int max_p,
+                              core::Tensor& subsampled_points,
+                              core::Tensor& subsampled_row_splits,
+                              core::Tensor& subsampled_features,
+                              core::Tensor& subsampled_classes);
+#endif
+
 }  // namespace contrib
 }  // namespace ml
 }  // namespace open3d
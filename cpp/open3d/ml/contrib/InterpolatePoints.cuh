@@ -38,24 +38,73 @@ __global__ void three_nn_kernel(int b,
                                 float *__restrict__ dist2,
                                 int *__restrict__ idx);
 
+/// Interpolates the features of the 3 nearest neighbors. The features may be
+/// float, half or bfloat16 and are accumulated in float.
+template <typename scalar_t>
 __global__ void three_interpolate_kernel(int b,
                                          int c,
                                          int m,
                                          int n,
-                                         const float *__restrict__ points,
+                                         const scalar_t *__restrict__ points,
                                          const int *__restrict__ idx,
                                          const float *__restrict__ weight,
-                                         float *__restrict__ out);
+                                         scalar_t *__restrict__ out) {
+    // points: (B, C, M)
+    // idx: (B, N, 3)
+    // weight: (B, N, 3)
+    // output:
+    //      out: (B, C, N)
 
+    int bs_idx = blockIdx.z;
+    int c_idx = blockIdx.y;
+    int pt_idx = blockIdx.x * blockDim.x + threadIdx.x;
+
+    if (bs_idx >= b || c_idx >= c || pt_idx >= n) return;
+
+    weight += bs_idx * n * 3 + pt_idx * 3;
+    points += bs_idx * c * m + c_idx * m;
+    idx += bs_idx * n * 3 + pt_idx * 3;
+    out += bs_idx * c * n + c_idx * n;
+
+    out[pt_idx] = static_cast<scalar_t>(
+            weight[0] * static_cast<float>(points[idx[0]]) +
+            weight[1] * static_cast<float>(points[idx[1]]) +
+            weight[2] * static_cast<float>(points[idx[2]]));
+}
+
+/// Gradient of three_interpolate_kernel. The gradient is accumulated in a
+/// float buffer independent of the type of \p grad_out.
+template <typename scalar_t>
 __global__ void three_interpolate_grad_kernel(
         int b,
         int c,
         int n,
         int m,
-        const float *__restrict__ grad_out,
+        const scalar_t *__restrict__ grad_out,
         const int *__restrict__ idx,
         const float *__restrict__ weight,
-        float *__restrict__ grad_points);
+        float *__restrict__ grad_points) {
+    // grad_out: (B, C, N)
+    // weight: (B, N, 3)
+    // output:
+    //      grad_points: (B, C, M)
+
+    int bs_idx = blockIdx.z;
+    int c_idx = blockIdx.y;
+    int pt_idx = blockIdx.x * blockDim.x + threadIdx.x;
+
+    if (bs_idx >= b || c_idx >= c || pt_idx >= n) return;
+
+    grad_out += bs_idx * c * n + c_idx * n + pt_idx;
+    weight += bs_idx * n * 3 + pt_idx * 3;
+    grad_points += bs_idx * c * m + c_idx * m;
+    idx += bs_idx * n * 3 + pt_idx * 3;
+
+    const float grad = static_cast<float>(grad_out[0]);
+    atomicAdd(grad_points + idx[0], grad * weight[0]);
+    atomicAdd(grad_points + idx[1], grad * weight[1]);
+    atomicAdd(grad_points + idx[2], grad * weight[2]);
+}
 
 }  // namespace contrib
 }  // namespace ml
@@ -37,6 +37,7 @@
 
 #include <tbb/parallel_for.h>
 
+#include <algorithm>
 #include <iostream>
 #include <numeric>
 
@@ -136,12 +137,12 @@ static void AllPairsSortedIoU(const float *boxes,
             });
 }
 
-std::vector<int64_t> NmsCPUKernel(const float *boxes,
-                                  const float *scores,
-                                  int n,
-                                  double nms_overlap_thresh) {
-    std::vector<int64_t> sort_indices = SortIndexes(scores, n, true);
-
+/// Runs the NMS on the n boxes referenced by \p sort_indices, which are
+/// sorted by decreasing score.
+static std::vector<int64_t> NmsSorted(const float *boxes,
+                                      const int64_t *sort_indices,
+                                      int n,
+                                      double nms_overlap_thresh) {
     const int num_block_cols = utility::DivUp(n, NMS_BLOCK_SIZE);
 
     // Call kernel. Results will be saved in masks.
@@ -149,7 +150,7 @@ std::vector<int64_t> NmsCPUKernel(const float *boxes,
     // mask:  (n, n/BS)
     std::vector<uint64_t> mask_vec(n * num_block_cols);
     uint64_t *mask = mask_vec.data();
-    AllPairsSortedIoU(boxes, scores, sort_indices.data(), mask, n,
+    AllPairsSortedIoU(boxes, nullptr, sort_indices, mask, n,
                       nms_overlap_thresh);
 
     // Write to keep. remv_cpu has n bits in total. If the bit is 1, the
@@ -178,6 +179,73 @@ std::vector<int64_t> NmsCPUKernel(const float *boxes,
     return keep_indices;
 }
 
+std::vector<int64_t> NmsCPUKernel(const float *boxes,
+                                  const float *scores,
+                                  int n,
+                                  double nms_overlap_thresh) {
+    std::vector<int64_t> sort_indices = SortIndexes(scores, n, true);
+    return NmsSorted(boxes, sort_indices.data(), n, nms_overlap_thresh);
+}
+
+std::vector<int64_t> BatchedNmsCPUKernel(const float *boxes,
+                                         const float *scores,
+                                         const int64_t *labels,
+                                         const int64_t *row_splits,
+                                         int64_t num_batches,
+                                         int n,
+                                         double nms_overlap_thresh,
+                                         int pre_nms_top_k) {
+    if (n == 0) {
+        return {};
+    }
+
+    // The group key of a box has the batch index in the upper and the label
+    // in the lower 32 bits.
+    std::vector<int64_t> keys(n, 0);
+    for (int64_t b = 0; b < num_batches; ++b) {
+        for (int64_t i = row_splits[b]; i < row_splits[b + 1]; ++i) {
+            keys[i] = (b << 32) | (labels[i] & 0xffffffff);
+        }
+    }
+
+    // Sort by group and then by decreasing score.
+    std::vector<int64_t> sort_indices = SortIndexes(scores, n, true);
+    std::stable_sort(
+            sort_indices.begin(), sort_indices.end(),
+            [&keys](int64_t i, int64_t j) { return keys[i] < keys[j]; });
+
+    std::vector<int64_t> group_splits = {0};
+    for (int i = 1; i < n; ++i) {
+        if (keys[sort_indices[i]] != keys[sort_indices[i - 1]]) {
+            group_splits.push_back(i);
+        }
+    }
+    group_splits.push_back(n);
+    const int64_t num_groups = group_splits.size() - 1;
+
+    std::vector<std::vector<int64_t>> group_keep_indices(num_groups);
+    tbb::parallel_for(
+            tbb::blocked_range<int64_t>(0, num_groups),
+            [&](const tbb::blocked_range<int64_t> &r) {
+                for (int64_t g = r.begin(); g != r.end(); ++g) {
+                    int num = group_splits[g + 1] - group_splits[g];
+                    if (pre_nms_top_k > 0) {
+                        num = std::min(num, pre_nms_top_k);
+                    }
+                    group_keep_indices[g] =
+                            NmsSorted(boxes,
+                                      sort_indices.data() + group_splits[g],
+                                      num, nms_overlap_thresh);
+                }
+            });
+
+    std::vector<int64_t> keep_indices;
+    for (const auto &group : group_keep_indices) {
+        keep_indices.insert(keep_indices.end(), group.begin(), group.end());
+    }
+    return keep_indices;
+}
+
 }  // namespace contrib
 }  // namespace ml
 }  // namespace open3d
@@ -33,10 +33,16 @@
 // Written by Shaoshuai Shi
 // All Rights Reserved 2019-2020.
 
+#include <thrust/binary_search.h>
+#include <thrust/copy.h>
 #include <thrust/device_vector.h>
+#include <thrust/execution_policy.h>
+#include <thrust/functional.h>
 #include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
 #include <thrust/sequence.h>
 #include <thrust/sort.h>
+#include <thrust/transform.h>
 
 #include "open3d/ml/Helper.h"
 #include "open3d/ml/contrib/IoUImpl.h"
@@ -210,6 +216,205 @@ std::vector<int64_t> NmsCUDAKernel(const float *boxes,
     return keep_indices;
 }
 
+/// Computes the group key of a box with the batch index in the upper and the
+/// label in the lower 32 bits.
+struct GroupKey {
+    const int64_t *batch_indices;
+    const int64_t *labels;
+    __host__ __device__ int64_t operator()(int64_t i) const {
+        return (batch_indices[i] << 32) | (labels[i] & 0xffffffff);
+    }
+};
+
+/// True for the first pre_nms_top_k boxes of each group.
+struct WithinTopK {
+    const int64_t *group_starts;
+    int pre_nms_top_k;
+    __host__ __device__ bool operator()(int64_t i) const {
+        return i - group_starts[i] < pre_nms_top_k;
+    }
+};
+
+// Same as NmsKernel but boxes are only compared within the same group.
+// Blocks below the diagonal are never read by NmsSuppressKernel and are
+// skipped. Since the boxes are sorted by group, a block whose row boxes all
+// belong to earlier groups than its column boxes has no overlaps.
+__global__ void BatchedNmsKernel(const float *boxes,
+                                 const int64_t *sort_indices,
+                                 const int64_t *group_keys,
+                                 uint64_t *mask,
+                                 const int n,
+                                 const double nms_overlap_thresh,
+                                 const int num_block_cols) {
+    const int block_row_idx = blockIdx.y;
+    const int block_col_idx = blockIdx.x;
+    if (block_col_idx < block_row_idx) {
+        return;
+    }
+
+    const int row_start = NMS_BLOCK_SIZE * block_row_idx;
+    const int col_start = NMS_BLOCK_SIZE * block_col_idx;
+    const int row_size = fminf(n - row_start, NMS_BLOCK_SIZE);
+    const int col_size = fminf(n - col_start, NMS_BLOCK_SIZE);
+
+    if (group_keys[row_start + row_size - 1] < group_keys[col_start]) {
+        if (threadIdx.x < row_size) {
+            mask[(row_start + threadIdx.x) * num_block_cols + block_col_idx] =
+                    0;
+        }
+        return;
+    }
+
+    __shared__ float block_boxes[NMS_BLOCK_SIZE * 5];
+    __shared__ int64_t block_keys[NMS_BLOCK_SIZE];
+    if (threadIdx.x < col_size) {
+        float *dst = block_boxes + threadIdx.x * 5;
+        const int src_idx = col_start + threadIdx.x;
+        const float *src = boxes + sort_indices[src_idx] * 5;
+        dst[0] = src[0];
+        dst[1] = src[1];
+        dst[2] = src[2];
+        dst[3] = src[3];
+        dst[4] = src[4];
+        block_keys[threadIdx.x] = group_keys[src_idx];
+    }
+    __syncthreads();
+
+    if (threadIdx.x < row_size) {
+        const int src_idx = row_start + threadIdx.x;
+        const int64_t src_key = group_keys[src_idx];
+        const float *src_box = boxes + sort_indices[src_idx] * 5;
+        int dst_idx = block_row_idx == block_col_idx ? threadIdx.x + 1 : 0;
+
+        uint64_t t = 0;
+        for (; dst_idx < col_size; ++dst_idx) {
+            if (block_keys[dst_idx] == src_key &&
+                IoUBev2DWithMinAndMax(src_box, block_boxes + dst_idx * 5) >
+                        nms_overlap_thresh) {
+                t |= 1ULL << dst_idx;
+            }
+        }
+        mask[src_idx * num_block_cols + block_col_idx] = t;
+    }
+}
+
+// Computes the keep flags from the overlap mask with a single thread block.
+// The boxes are visited in order and the threads of the block share the
+// update of the removed bitmap, which has one bit per box.
+__global__ void NmsSuppressKernel(const uint64_t *mask,
+                                  uint64_t *removed,
+                                  uint8_t *keep,
+                                  const int n,
+                                  const int num_block_cols) {
+    for (int block_idx = 0; block_idx < num_block_cols; ++block_idx) {
+        uint64_t removed_val = removed[block_idx];
+        __syncthreads();
+        const int offset = block_idx * NMS_BLOCK_SIZE;
+        for (int inner_idx = 0;
+             inner_idx < NMS_BLOCK_SIZE && offset + inner_idx < n;
+             ++inner_idx) {
+            if (!(removed_val & (1ULL << inner_idx))) {
+                const int i = offset + inner_idx;
+                if (threadIdx.x == 0) {
+                    keep[i] = 1;
+                }
+                const uint64_t *p = mask + i * num_block_cols;
+                for (int j = block_idx + threadIdx.x; j < num_block_cols;
+                     j += blockDim.x) {
+                    removed[j] |= p[j];
+                }
+                __syncthreads();
+                removed_val = removed[block_idx];
+                __syncthreads();
+            }
+        }
+    }
+}
+
+std::vector<int64_t> BatchedNmsCUDAKernel(const float *boxes,
+                                          const float *scores,
+                                          const int64_t *labels,
+                                          const int64_t *row_splits,
+                                          int64_t num_batches,
+                                          int n,
+                                          double nms_overlap_thresh,
+                                          int pre_nms_top_k) {
+    if (n == 0) {
+        return {};
+    }
+
+    // Batch index of every box.
+    thrust::device_vector<int64_t> batch_indices(n);
+    thrust::upper_bound(thrust::device, row_splits + 1,
+                        row_splits + num_batches + 1,
+                        thrust::counting_iterator<int64_t>(0),
+                        thrust::counting_iterator<int64_t>(n),
+                        batch_indices.begin());
+
+    // Sort by decreasing score and then stable sort by group.
+    thrust::device_vector<float> sorted_scores(
+            thrust::device_pointer_cast(scores),
+            thrust::device_pointer_cast(scores) + n);
+    thrust::device_vector<int64_t> sort_indices(n);
+    SortIndices(thrust::raw_pointer_cast(sorted_scores.data()),
+                thrust::raw_pointer_cast(sort_indices.data()), n, true);
+    thrust::device_vector<int64_t> group_keys(n);
+    thrust::transform(
+            sort_indices.begin(), sort_indices.end(), group_keys.begin(),
+            GroupKey{thrust::raw_pointer_cast(batch_indices.data()), labels});
+    thrust::stable_sort_by_key(group_keys.begin(), group_keys.end(),
+                               sort_indices.begin());
+
+    // Drop all but the pre_nms_top_k highest scoring boxes of each group.
+    if (pre_nms_top_k > 0) {
+        thrust::device_vector<int64_t> group_starts(n);
+        thrust::lower_bound(group_keys.begin(), group_keys.end(),
+                            group_keys.begin(), group_keys.end(),
+                            group_starts.begin());
+        thrust::device_vector<int64_t> top_k_indices(n);
+        thrust::device_vector<int64_t> top_k_keys(n);
+        auto first = thrust::make_zip_iterator(
+                thrust::make_tuple(sort_indices.begin(), group_keys.begin()));
+        auto result = thrust::make_zip_iterator(
+                thrust::make_tuple(top_k_indices.begin(), top_k_keys.begin()));
+        auto last = thrust::copy_if(
+                first, first + n, thrust::counting_iterator<int64_t>(0),
+                result,
+                WithinTopK{thrust::raw_pointer_cast(group_starts.data()),
+                           pre_nms_top_k});
+        n = last - result;
+        sort_indices.swap(top_k_indices);
+        group_keys.swap(top_k_keys);
+    }
+
+    const int num_block_cols = utility::DivUp(n, NMS_BLOCK_SIZE);
+    thrust::device_vector<uint64_t> mask(int64_t(n) * num_block_cols);
+    dim3 blocks(num_block_cols, num_block_cols);
+    dim3 threads(NMS_BLOCK_SIZE);
+    BatchedNmsKernel<<<blocks, threads>>>(
+            boxes, thrust::raw_pointer_cast(sort_indices.data()),
+            thrust::raw_pointer_cast(group_keys.data()),
+            thrust::raw_pointer_cast(mask.data()), n, nms_overlap_thresh,
+            num_block_cols);
+    OPEN3D_CUDA_CHECK(cudaGetLastError());
+
+    thrust::device_vector<uint64_t> removed(num_block_cols, 0);
+    thrust::device_vector<uint8_t> keep(n, 0);
+    NmsSuppressKernel<<<1, 256>>>(thrust::raw_pointer_cast(mask.data()),
+                                  thrust::raw_pointer_cast(removed.data()),
+                                  thrust::raw_pointer_cast(keep.data()), n,
+                                  num_block_cols);
+    OPEN3D_CUDA_CHECK(cudaGetLastError());
+
+    thrust::device_vector<int64_t> keep_indices(n);
+    auto keep_end = thrust::copy_if(
+            sort_indices.begin(), sort_indices.begin() + n, keep.begin(),
+            keep_indices.begin(), thrust::identity<uint8_t>());
+    std::vector<int64_t> keep_indices_cpu(keep_end - keep_indices.begin());
+    thrust::copy(keep_indices.begin(), keep_end, keep_indices_cpu.begin());
+    return keep_indices_cpu;
+}
+
 }  // namespace contrib
 }  // namespace ml
 }  // namespace open3d
@@ -54,6 +54,33 @@ std::vector<int64_t> NmsCUDAKernel(const float *boxes,
                                    const float *scores,
                                    int n,
                                    double nms_overlap_thresh);
+
+/// Class-aware non-maximum suppression for a batch of box sets. Boxes only
+/// suppress boxes of the same batch item and the same label. The overlaps are
+/// computed in 64x64 bitmask blocks and the suppression pass runs on the GPU
+/// as well; blocks that cannot contain boxes of a shared group are skipped.
+///
+/// \param boxes (n, 5) float32 device memory.
+/// \param scores (n,) float32 device memory.
+/// \param labels (n,) int64 device memory with non-negative class labels.
+/// \param row_splits (num_batches + 1,) int64 device memory. Defines the
+/// start and end of each batch item in \p boxes.
+/// \param num_batches Number of batch items.
+/// \param n Number of boxes.
+/// \param nms_overlap_thresh When a high-score box is selected, other remaining
+/// boxes of the same group with IoU > nms_overlap_thresh will be discarded.
+/// \param pre_nms_top_k If positive, only the pre_nms_top_k highest scoring
+/// boxes of each (batch item, label) group take part in the suppression.
+/// \return Selected box indices to keep, ordered by batch item, label and
+/// decreasing score.
+std::vector<int64_t> BatchedNmsCUDAKernel(const float *boxes,
+                                          const float *scores,
+                                          const int64_t *labels,
+                                          const int64_t *row_splits,
+                                          int64_t num_batches,
+                                          int n,
+                                          double nms_overlap_thresh,
+                                          int pre_nms_top_k);
 #endif
 
 /// \param boxes (n, 5) float32.
@@ -67,6 +94,32 @@ std::vector<int64_t> NmsCPUKernel(const float *boxes,
                                   int n,
                                   double nms_overlap_thresh);
 
+/// Class-aware non-maximum suppression for a batch of box sets. Boxes only
+/// suppress boxes of the same batch item and the same label, and the groups are
+/// processed in parallel.
+///
+/// \param boxes (n, 5) float32.
+/// \param scores (n,) float32.
+/// \param labels (n,) int64 with non-negative class labels.
+/// \param row_splits (num_batches + 1,) int64. Defines the start and end of
+/// each batch item in \p boxes.
+/// \param num_batches Number of batch items.
+/// \param n Number of boxes.
+/// \param nms_overlap_thresh When a high-score box is selected, other remaining
+/// boxes of the same group with IoU > nms_overlap_thresh will be discarded.
+/// \param pre_nms_top_k If positive, only the pre_nms_top_k highest scoring
+/// boxes of each (batch item, label) group take part in the suppression.
+/// \return Selected box indices to keep, ordered by batch item, label and
+/// decreasing score.
+std::vector<int64_t> BatchedNmsCPUKernel(const float *boxes,
+                                         const float *scores,
+                                         const int64_t *labels,
+                                         const int64_t *row_splits,
+                                         int64_t num_batches,
+                                         int n,
+                                         double nms_overlap_thresh,
+                                         int pre_nms_top_k);
+
 }  // namespace contrib
 }  // namespace ml
 }  // namespace open3d
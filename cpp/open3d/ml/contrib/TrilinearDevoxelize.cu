@@ -48,7 +48,14 @@
 // SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <thrust/binary_search.h>
+#include <thrust/execution_policy.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+
 #include "open3d/ml/contrib/TrilinearDevoxelize.cuh"
+#include "open3d/ml/contrib/cuda_utils.h"
 
 namespace open3d {
 namespace ml {
@@ -66,9 +73,9 @@ __global__ void TrilinearDevoxelizeKernel(int b,
                                           int *__restrict__ inds,
                                           float *__restrict__ wgts,
                                           float *__restrict__ outs) {
-    int batch_index = blockIdx.x;
-    int stride = blockDim.x;
-    int index = threadIdx.x;
+    int batch_index = blockIdx.y;
+    int stride = blockDim.x * gridDim.x;
+    int index = blockIdx.x * blockDim.x + threadIdx.x;
     coords += batch_index * n * 3;
     inds += batch_index * n * 8;
     wgts += batch_index * n * 8;
@@ -145,53 +152,85 @@ __global__ void TrilinearDevoxelizeKernel(int b,
     }
 }
 
-__global__ void TrilinearDevoxelizeGradKernel(int b,
-                                              int c,
-                                              int n,
-                                              int r3,
-                                              const int *__restrict__ inds,
-                                              const float *__restrict__ wgts,
-                                              const float *__restrict__ grad_y,
-                                              float *__restrict__ grad_x) {
-    int batch_index = blockIdx.x;
-    int stride = blockDim.x;
-    int index = threadIdx.x;
-    inds += batch_index * n * 8;
-    wgts += batch_index * n * 8;
-    grad_x += batch_index * c * r3;
-    grad_y += batch_index * c * n;
+// Writes the key of every (point, corner) entry. Keys of different batch items
+// do not overlap so that all entries can be sorted at once.
+__global__ void TrilinearDevoxelizeGradKeysKernel(
+        int b,
+        int n,
+        int r3,
+        const int *__restrict__ inds,
+        int *__restrict__ voxel_keys) {
+    const int num_entries = b * 8 * n;
+    for (int e = blockIdx.x * blockDim.x + threadIdx.x; e < num_entries;
+         e += blockDim.x * gridDim.x) {
+        voxel_keys[e] = (e / (8 * n)) * r3 + inds[e];
+    }
+}
 
-    for (int i = index; i < n; i += stride) {
-        int idx000 = inds[i];
-        int idx001 = inds[i + n];
-        int idx010 = inds[i + n * 2];
-        int idx011 = inds[i + n * 3];
-        int idx100 = inds[i + n * 4];
-        int idx101 = inds[i + n * 5];
-        int idx110 = inds[i + n * 6];
-        int idx111 = inds[i + n * 7];
-        float wgt000 = wgts[i];
-        float wgt001 = wgts[i + n];
-        float wgt010 = wgts[i + n * 2];
-        float wgt011 = wgts[i + n * 3];
-        float wgt100 = wgts[i + n * 4];
-        float wgt101 = wgts[i + n * 5];
-        float wgt110 = wgts[i + n * 6];
-        float wgt111 = wgts[i + n * 7];
+__global__ void TrilinearDevoxelizeGradKernel(
+        int b,
+        int c,
+        int n,
+        int r3,
+        const int *__restrict__ voxel_offsets,
+        const int *__restrict__ sorted_entries,
+        const float *__restrict__ wgts,
+        const float *__restrict__ grad_y,
+        float *__restrict__ grad_x) {
+    const int batch_index = blockIdx.z;
+    const int j = blockIdx.y;
+    const int voxel = blockIdx.x * blockDim.x + threadIdx.x;
+    if (voxel >= r3) {
+        return;
+    }
+    const int key = batch_index * r3 + voxel;
+    grad_y += (batch_index * c + j) * n;
 
-        for (int j = 0; j < c; j++) {
-            int jr3 = j * r3;
-            float g = grad_y[j * n + i];
-            atomicAdd(grad_x + jr3 + idx000, wgt000 * g);
-            atomicAdd(grad_x + jr3 + idx001, wgt001 * g);
-            atomicAdd(grad_x + jr3 + idx010, wgt010 * g);
-            atomicAdd(grad_x + jr3 + idx011, wgt011 * g);
-            atomicAdd(grad_x + jr3 + idx100, wgt100 * g);
-            atomicAdd(grad_x + jr3 + idx101, wgt101 * g);
-            atomicAdd(grad_x + jr3 + idx110, wgt110 * g);
-            atomicAdd(grad_x + jr3 + idx111, wgt111 * g);
-        }
+    // Within a voxel the entries are in increasing order of
+    // e = (batch_index * 8 + k) * n + i with the corner k and the point i.
+    float sum = 0;
+    for (int s = voxel_offsets[key]; s < voxel_offsets[key + 1]; ++s) {
+        const int e = sorted_entries[s];
+        sum += wgts[e] * grad_y[e % n];
     }
+    grad_x[(batch_index * c + j) * r3 + voxel] = sum;
+}
+
+void TrilinearDevoxelizeGradCUDA(cudaStream_t stream,
+                                 int b,
+                                 int c,
+                                 int n,
+                                 int r3,
+                                 const int *inds,
+                                 const float *wgts,
+                                 const float *grad_y,
+                                 float *grad_x,
+                                 int *voxel_keys,
+                                 int *sorted_entries,
+                                 int *voxel_offsets) {
+    const int num_entries = b * 8 * n;
+    if (num_entries == 0) {
+        cudaMemsetAsync(grad_x, 0, sizeof(float) * b * c * r3, stream);
+        return;
+    }
+    auto policy = thrust::cuda::par.on(stream);
+
+    TrilinearDevoxelizeGradKeysKernel<<<DIVUP(num_entries, THREADS_PER_BLOCK),
+                                        THREADS_PER_BLOCK, 0, stream>>>(
+            b, n, r3, inds, voxel_keys);
+    thrust::sequence(policy, sorted_entries, sorted_entries + num_entries);
+    // The stable sort keeps the entries of each voxel in increasing order,
+    // which fixes the summation order.
+    thrust::stable_sort_by_key(policy, voxel_keys, voxel_keys + num_entries,
+                               sorted_entries);
+    thrust::lower_bound(policy, voxel_keys, voxel_keys + num_entries,
+                        thrust::counting_iterator<int>(0),
+                        thrust::counting_iterator<int>(b * r3 + 1),
+                        voxel_offsets);
+
+    dim3 blocks(DIVUP(r3, THREADS_PER_BLOCK), c, b);
+    TrilinearDevoxelizeGradKernel<<<blocks, THREADS_PER_BLOCK, 0, stream>>>(
+            b, c, n, r3, voxel_offsets, sorted_entries, wgts, grad_y, grad_x);
 }
 
 }  // namespace contrib
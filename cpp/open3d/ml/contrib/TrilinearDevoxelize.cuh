@@ -67,14 +67,44 @@ __global__ void TrilinearDevoxelizeKernel(int b,
                                           float *__restrict__ wgts,
                                           float *__restrict__ outs);
 
-__global__ void TrilinearDevoxelizeGradKernel(int b,
-                                              int c,
-                                              int n,
-                                              int r3,
-                                              const int *__restrict__ inds,
-                                              const float *__restrict__ wgts,
-                                              const float *__restrict__ grad_y,
-                                              float *__restrict__ grad_x);
+/// Gathers the gradient for the voxel grid. Every thread computes one entry of
+/// grad_x by summing the sorted (point, corner) entries of its voxel in a
+/// fixed order, so no atomics are needed and the result is deterministic.
+__global__ void TrilinearDevoxelizeGradKernel(
+        int b,
+        int c,
+        int n,
+        int r3,
+        const int *__restrict__ voxel_offsets,
+        const int *__restrict__ sorted_entries,
+        const float *__restrict__ wgts,
+        const float *__restrict__ grad_y,
+        float *__restrict__ grad_x);
+
+/// Computes the gradient for the voxel grid of the trilinear devoxelization.
+/// The 8 * n (point, corner) entries of each batch item are sorted by voxel and
+/// reduced per voxel with TrilinearDevoxelizeGradKernel.
+///
+/// \param stream    The CUDA stream for all launches.
+/// \param inds    The voxel coordinates of point cube [b, 8, n]
+/// \param wgts    weight for trilinear interpolation [b, 8, n]
+/// \param grad_y    The gradient passed from top [b, c, n].
+/// \param grad_x    The computed gradient for voxelgrid [b, c, r3].
+/// \param voxel_keys    Temporary memory with b * 8 * n elements.
+/// \param sorted_entries    Temporary memory with b * 8 * n elements.
+/// \param voxel_offsets    Temporary memory with b * r3 + 1 elements.
+void TrilinearDevoxelizeGradCUDA(cudaStream_t stream,
+                                 int b,
+                                 int c,
+                                 int n,
+                                 int r3,
+                                 const int *inds,
+                                 const float *wgts,
+                                 const float *grad_y,
+                                 float *grad_x,
+                                 int *voxel_keys,
+                                 int *sorted_entries,
+                                 int *voxel_offsets);
 
 }  // namespace contrib
 }  // namespace ml
@@ -91,9 +91,35 @@ void _CConvComputeFeaturesCPU(TOut* out_features,
                         in_channels * spatial_filter_size, range_length);
                 B.setZero();
 
-                typedef Eigen::Array<TFeat, VECSIZE, Eigen::Dynamic> Matrix;
+                // The gathered features are stored row major so that the
+                // channels of each neighbor are contiguous and the weighted
+                // scatter into B vectorizes.
+                typedef Eigen::Array<TFeat, VECSIZE, Eigen::Dynamic,
+                                     Eigen::RowMajor>
+                        Matrix;
+                typedef Eigen::Array<TFeat, 1, Eigen::Dynamic> FeatRow_t;
                 Matrix infeat(VECSIZE, in_channels);
 
+                // Accumulates the interpolated features of the first
+                // \p count neighbors in infeat to column \p out_col of B.
+                auto ScatterToColumn =
+                        [&](const typename InterpolationVec_t::Weight_t&
+                                    weights,
+                            const typename InterpolationVec_t::Idx_t& indices,
+                            int count, int out_col) {
+                            for (int k = 0; k < count; ++k) {
+                                for (int j = 0; j < InterpolationVec_t::Size();
+                                     ++j) {
+                                    B.col(out_col)
+                                            .segment(indices(j, k),
+                                                     in_channels)
+                                            .array() +=
+                                            TFeat(weights(j, k)) *
+                                            infeat.row(k).transpose();
+                                }
+                            }
+                        };
+
                 Eigen::Array<TReal, 3, 1> offsets_(offsets[0], offsets[1],
                                                    offsets[2]);
 
@@ -151,9 +177,9 @@ void _CConvComputeFeaturesCPU(TOut* out_features,
                                                       : TFeat(1));
                         normalizers(out_col) += TOut(n_importance);
 
-                        for (int ic = 0; ic < in_channels; ++ic)
-                            infeat(i, ic) =
-                                    inp_features[inp_idx * in_channels + ic];
+                        infeat.row(i) = Eigen::Map<const FeatRow_t>(
+                                inp_features + inp_idx * in_channels,
+                                in_channels);
 
                         TFeat importance(1.0);
                         if (POINT_IMPORTANCE)
@@ -161,8 +187,7 @@ void _CConvComputeFeaturesCPU(TOut* out_features,
                         if (NEIGHBORS_IMPORTANCE) importance *= n_importance;
 
                         if (POINT_IMPORTANCE || NEIGHBORS_IMPORTANCE) {
-                            for (int ic = 0; ic < in_channels; ++ic)
-                                infeat(i, ic) *= importance;
+                            infeat.row(i) *= importance;
                         }
 
                         ++vec_valid_count;
@@ -173,14 +198,8 @@ void _CConvComputeFeaturesCPU(TOut* out_features,
                             interpolation.Interpolate(
                                     interp_weights, interp_indices, x, y, z,
                                     filter_size_xyz, in_channels);
-                            for (int k = 0; k < VECSIZE; ++k)
-                                for (int j = 0; j < InterpolationVec_t::Size();
-                                     ++j) {
-                                    for (int ic = 0; ic < in_channels; ++ic)
-                                        B(interp_indices(j, k) + ic, out_col) +=
-                                                TFeat(interp_weights(j, k)) *
-                                                infeat(k, ic);
-                                }
+                            ScatterToColumn(interp_weights, interp_indices,
+                                            VECSIZE, out_col);
                             vec_valid_count = 0;
                         }
                     }
@@ -191,14 +210,8 @@ void _CConvComputeFeaturesCPU(TOut* out_features,
                         interpolation.Interpolate(interp_weights,
                                                   interp_indices, x, y, z,
                                                   filter_size_xyz, in_channels);
-                        for (int k = 0; k < vec_valid_count; ++k)
-                            for (int j = 0; j < InterpolationVec_t::Size();
-                                 ++j) {
-                                for (int ic = 0; ic < in_channels; ++ic)
-                                    B(interp_indices(j, k) + ic, out_col) +=
-                                            TFeat(interp_weights(j, k)) *
-                                            infeat(k, ic);
-                            }
+                        ScatterToColumn(interp_weights, interp_indices,
+                                        vec_valid_count, out_col);
                     }
 
                 }  // out_idx
@@ -96,7 +96,8 @@ __global__ void FillNeighborsIndexAndAttributesCUDAKernel(
         const int64_t* const __restrict__ inp_neighbors_row_splits,
         size_t inp_num_queries,
         const int64_t* const __restrict__ out_neighbors_row_splits,
-        size_t out_num_queries) {
+        size_t out_num_queries,
+        TAttr* __restrict__ out_attributes_sum) {
     const int i = blockDim.x * blockIdx.x + threadIdx.x;
     if (i >= inp_num_queries) return;
 
@@ -105,6 +106,14 @@ __global__ void FillNeighborsIndexAndAttributesCUDAKernel(
     size_t begin_idx = inp_neighbors_row_splits[i];
     size_t end_idx = inp_neighbors_row_splits[i + 1];
 
+    TAttr* sum_ptr = nullptr;
+    if (FILL_ATTRIBUTES && out_attributes_sum) {
+        sum_ptr = out_attributes_sum + num_attributes_per_neighbor * i;
+        for (int attr_i = 0; attr_i < num_attributes_per_neighbor; ++attr_i) {
+            sum_ptr[attr_i] = TAttr(0);
+        }
+    }
+
     for (size_t j = begin_idx; j < end_idx; ++j) {
         TIndex neighbor_idx = inp_neighbors_index[j];
 
@@ -123,6 +132,12 @@ __global__ void FillNeighborsIndexAndAttributesCUDAKernel(
                                                          j +
                                                  attr_i];
             }
+            if (sum_ptr) {
+                for (int attr_i = 0; attr_i < num_attributes_per_neighbor;
+                     ++attr_i) {
+                    sum_ptr[attr_i] += attr_ptr[attr_i];
+                }
+            }
         }
     }
 }
@@ -150,7 +165,8 @@ void FillNeighborsIndexAndAttributesCUDA(
         const int64_t* const __restrict__ inp_neighbors_row_splits,
         size_t inp_num_queries,
         const int64_t* const __restrict__ out_neighbors_row_splits,
-        size_t out_num_queries) {
+        size_t out_num_queries,
+        TAttr* __restrict__ out_attributes_sum) {
     using namespace open3d::utility;
 
     cudaMemsetAsync(count, 0, sizeof(uint32_t) * count_size, stream);
@@ -169,7 +185,8 @@ void FillNeighborsIndexAndAttributesCUDA(
                             inp_neighbors_attributes,
                             num_attributes_per_neighbor, index_size,
                             inp_neighbors_row_splits, inp_num_queries,
-                            out_neighbors_row_splits, out_num_queries);
+                            out_neighbors_row_splits, out_num_queries,
+                            out_attributes_sum);
         } else {
             FillNeighborsIndexAndAttributesCUDAKernel<TIndex, TAttr, false>
                     <<<grid, block, 0, stream>>>(
@@ -178,7 +195,8 @@ void FillNeighborsIndexAndAttributesCUDA(
                             inp_neighbors_attributes,
                             num_attributes_per_neighbor, index_size,
                             inp_neighbors_row_splits, inp_num_queries,
-                            out_neighbors_row_splits, out_num_queries);
+                            out_neighbors_row_splits, out_num_queries,
+                            out_attributes_sum);
         }
     }
 }
@@ -248,6 +266,13 @@ void FillNeighborsIndexAndAttributesCUDA(
 /// \param out_num_queries    The number of queries with respect to the
 ///        inverted neighbors list.
 ///
+/// \param out_attributes_sum    Optional output array with the sum of the
+///        attributes of each sublist of \p inp_neighbors_index, i.e. the
+///        result of ReduceSubarraysSum for \p inp_neighbors_attributes. The
+///        shape is [inp_num_queries, num_attributes_per_neighbor]. Computing
+///        the sums here avoids a second pass over the attributes. This is
+///        optional and can be set to null.
+///
 template <class TIndex, class TAttr>
 void InvertNeighborsListCUDA(const cudaStream_t& stream,
                              void* temp,
@@ -262,7 +287,8 @@ void InvertNeighborsListCUDA(const cudaStream_t& stream,
                              TAttr* out_neighbors_attributes,
                              const size_t index_size,
                              int64_t* out_neighbors_row_splits,
-                             const size_t out_num_queries) {
+                             const size_t out_num_queries,
+                             TAttr* out_attributes_sum = nullptr) {
     using namespace open3d::utility;
 
     const bool get_temp_size = !temp;
@@ -322,7 +348,8 @@ void InvertNeighborsListCUDA(const cudaStream_t& stream,
                 inp_neighbors_index, inp_neighbors_attributes,
                 num_attributes_per_neighbor, index_size,
                 inp_neighbors_row_splits, inp_num_queries,
-                out_neighbors_row_splits, out_num_queries);
+                out_neighbors_row_splits, out_num_queries,
+                out_attributes_sum);
     }
 }
 
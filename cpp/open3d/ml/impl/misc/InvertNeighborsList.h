@@ -28,6 +28,8 @@
 
 #include <tbb/parallel_for.h>
 
+#include <algorithm>
+
 #include "open3d/core/Atomic.h"
 #include "open3d/utility/ParallelScan.h"
 
@@ -86,6 +88,13 @@ namespace impl {
 /// \param out_num_queries    The number of queries with respect to the
 ///        inverted neighbors list.
 ///
+/// \param out_attributes_sum    Optional output array with the sum of the
+///        attributes of each sublist of \p inp_neighbors_index, i.e. the
+///        result of ReduceSubarraysSum for \p inp_neighbors_attributes. The
+///        shape is [inp_num_queries, num_attributes_per_neighbor]. Computing
+///        the sums here avoids a second pass over the attributes. This is
+///        optional and can be set to null.
+///
 template <class TIndex, class TAttr>
 void InvertNeighborsListCPU(const TIndex* const inp_neighbors_index,
                             const TAttr* const inp_neighbors_attributes,
@@ -96,7 +105,8 @@ void InvertNeighborsListCPU(const TIndex* const inp_neighbors_index,
                             TAttr* out_neighbors_attributes,
                             const size_t index_size,
                             int64_t* out_neighbors_row_splits,
-                            const size_t out_num_queries) {
+                            const size_t out_num_queries,
+                            TAttr* out_attributes_sum = nullptr) {
     using namespace open3d::utility;
 
     std::vector<uint32_t> tmp_neighbors_count(out_num_queries + 1, 0);
@@ -127,6 +137,14 @@ void InvertNeighborsListCPU(const TIndex* const inp_neighbors_index,
 
                     size_t begin_idx = inp_neighbors_row_splits[i];
                     size_t end_idx = inp_neighbors_row_splits[i + 1];
+                    TAttr* sum_ptr = nullptr;
+                    if (inp_neighbors_attributes && out_attributes_sum) {
+                        sum_ptr = out_attributes_sum +
+                                  num_attributes_per_neighbor * i;
+                        std::fill(sum_ptr,
+                                  sum_ptr + num_attributes_per_neighbor,
+                                  TAttr(0));
+                    }
                     for (size_t j = begin_idx; j < end_idx; ++j) {
                         TIndex neighbor_idx = inp_neighbors_index[j];
 
@@ -149,6 +167,13 @@ void InvertNeighborsListCPU(const TIndex* const inp_neighbors_index,
                                         [num_attributes_per_neighbor * j +
                                          attr_i];
                             }
+                            if (sum_ptr) {
+                                for (int attr_i = 0;
+                                     attr_i < num_attributes_per_neighbor;
+                                     ++attr_i) {
+                                    sum_ptr[attr_i] += attr_ptr[attr_i];
+                                }
+                            }
                         }
                     }
                 }
@@ -76,7 +76,7 @@ void RaggedToDenseCPU(const T* const values,
     tbb::parallel_for(
             tbb::blocked_range<size_t>(0, row_splits_size - 1),
             [&](const tbb::blocked_range<size_t>& r) {
-                for (int64_t i = r.begin(); i != r.end(); ++i) {
+                for (size_t i = r.begin(); i != r.end(); ++i) {
                     const int64_t start = row_splits[i];
                     const int64_t end = std::min(int64_t(out_col_size) + start,
                                                  row_splits[i + 1]);
@@ -89,7 +89,7 @@ void RaggedToDenseCPU(const T* const values,
 
                     // fill remaining columns with the default value
                     out_ptr = out_ptr + (end - start) * default_value_size;
-                    for (int64_t j = end - start; j < out_col_size;
+                    for (int64_t j = end - start; j < int64_t(out_col_size);
                          ++j, out_ptr += default_value_size) {
                         std::copy(default_value,
                                   default_value + default_value_size, out_ptr);
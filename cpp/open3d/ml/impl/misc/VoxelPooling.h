@@ -26,12 +26,18 @@
 
 #pragma once
 
+#include <tbb/parallel_for.h>
+#include <tbb/parallel_sort.h>
 #include <tbb/task_group.h>
 
 #include <Eigen/Core>
+#include <array>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include "open3d/utility/Helper.h"
+#include "open3d/utility/ParallelScan.h"
 
 namespace open3d {
 namespace ml {
@@ -294,48 +300,90 @@ void _VoxelPooling(size_t num_inp,
 
     typedef Eigen::Array<TReal, 3, 1> Vec3_t;
     typedef Eigen::Array<TFeat, Eigen::Dynamic, 1> FeatureVec_t;
+    typedef std::pair<std::array<int, 3>, size_t> VoxelPoint_t;
 
-    std::unordered_map<Eigen::Vector3i, ACCUMULATOR,
-                       open3d::utility::hash_eigen<Eigen::Vector3i>>
-            voxelindex_to_accpoint;
-
-    Vec3_t voxel_center;
-    Eigen::Vector3i voxel_index;
+    // Group the points by voxel with a parallel sort. The points of each voxel
+    // stay in ascending index order, which makes the accumulation
+    // deterministic.
     TReal inv_voxel_size = 1 / voxel_size;
     TReal half_voxel_size = 0.5 * voxel_size;
-    for (size_t i = 0; i < num_inp; ++i) {
-        Eigen::Map<const Vec3_t> pos(inp_positions + i * 3);
-
-        voxel_index = ComputeVoxelIndex(pos, inv_voxel_size);
-
-        voxel_center << voxel_index(0) * voxel_size + half_voxel_size,
-                voxel_index(1) * voxel_size + half_voxel_size,
-                voxel_index(2) * voxel_size + half_voxel_size;
-
-        Eigen::Map<const FeatureVec_t> feat(inp_features + in_channels * i,
-                                            in_channels);
-        voxelindex_to_accpoint[voxel_index].AddPoint(
-                pos.matrix(), voxel_center.matrix(), feat);
-    }
-
-    const size_t num_out = voxelindex_to_accpoint.size();
+    std::vector<VoxelPoint_t> voxel_points(num_inp);
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, num_inp),
+                      [&](const tbb::blocked_range<size_t>& r) {
+                          for (size_t i = r.begin(); i != r.end(); ++i) {
+                              Eigen::Map<const Vec3_t> pos(inp_positions +
+                                                           i * 3);
+                              Eigen::Vector3i voxel_index =
+                                      ComputeVoxelIndex(pos, inv_voxel_size);
+                              voxel_points[i] = VoxelPoint_t(
+                                      {voxel_index(0), voxel_index(1),
+                                       voxel_index(2)},
+                                      i);
+                          }
+                      });
+    tbb::parallel_sort(voxel_points.begin(), voxel_points.end());
+
+    // voxel_ids[i] is the number of voxels up to and including the voxel of
+    // voxel_points[i].
+    std::vector<size_t> voxel_ids(num_inp);
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, num_inp),
+                      [&](const tbb::blocked_range<size_t>& r) {
+                          for (size_t i = r.begin(); i != r.end(); ++i) {
+                              voxel_ids[i] = i == 0 ||
+                                             voxel_points[i].first !=
+                                                     voxel_points[i - 1].first;
+                          }
+                      });
+    open3d::utility::InclusivePrefixSum(
+            voxel_ids.data(), voxel_ids.data() + num_inp, voxel_ids.data());
+    const size_t num_out = voxel_ids.back();
+
+    std::vector<size_t> voxel_begin(num_out + 1, num_inp);
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, num_inp),
+                      [&](const tbb::blocked_range<size_t>& r) {
+                          for (size_t i = r.begin(); i != r.end(); ++i) {
+                              if (i == 0 || voxel_ids[i] != voxel_ids[i - 1]) {
+                                  voxel_begin[voxel_ids[i] - 1] = i;
+                              }
+                          }
+                      });
 
     TReal* out_pos_ptr;
     TFeat* out_feat_ptr;
     output_allocator.AllocPooledPositions(&out_pos_ptr, num_out);
     output_allocator.AllocPooledFeatures(&out_feat_ptr, num_out, in_channels);
 
-    size_t i = 0;
-    for (const auto point : voxelindex_to_accpoint) {
-        Vec3_t pos = point.second.Position();
-        Eigen::Map<Vec3_t> out_pos(out_pos_ptr + i * 3);
-        out_pos = pos;
-
-        Eigen::Map<FeatureVec_t> out_feat(out_feat_ptr + i * in_channels,
-                                          in_channels);
-        out_feat = point.second.Features();
-        ++i;
-    }
+    tbb::parallel_for(
+            tbb::blocked_range<size_t>(0, num_out),
+            [&](const tbb::blocked_range<size_t>& r) {
+                for (size_t voxel_i = r.begin(); voxel_i != r.end();
+                     ++voxel_i) {
+                    const std::array<int, 3>& voxel_index =
+                            voxel_points[voxel_begin[voxel_i]].first;
+                    Vec3_t voxel_center;
+                    voxel_center << voxel_index[0] * voxel_size +
+                                            half_voxel_size,
+                            voxel_index[1] * voxel_size + half_voxel_size,
+                            voxel_index[2] * voxel_size + half_voxel_size;
+
+                    ACCUMULATOR accumulator;
+                    for (size_t j = voxel_begin[voxel_i];
+                         j < voxel_begin[voxel_i + 1]; ++j) {
+                        const size_t i = voxel_points[j].second;
+                        Eigen::Map<const Vec3_t> pos(inp_positions + i * 3);
+                        Eigen::Map<const FeatureVec_t> feat(
+                                inp_features + in_channels * i, in_channels);
+                        accumulator.AddPoint(pos.matrix(),
+                                             voxel_center.matrix(), feat);
+                    }
+
+                    Eigen::Map<Vec3_t> out_pos(out_pos_ptr + voxel_i * 3);
+                    out_pos = accumulator.Position();
+                    Eigen::Map<FeatureVec_t> out_feat(
+                            out_feat_ptr + voxel_i * in_channels, in_channels);
+                    out_feat = accumulator.Features();
+                }
+            });
 }
 
 // implementation for VoxelPoolingBackprop with template parameter for the
@@ -457,7 +505,8 @@ void _VoxelPoolingBackprop(TFeat* features_backprop,
 }
 
 /// Pooling operation for point clouds. Aggregates points that are inside the
-/// same voxel.
+/// same voxel. The pooled points are ordered by their integer voxel
+/// coordinates.
 ///
 /// \tparam TReal    Scalar type for point positions.
 ///
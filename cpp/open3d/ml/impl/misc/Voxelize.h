@@ -29,6 +29,7 @@
 #include <tbb/parallel_for.h>
 #include <tbb/parallel_sort.h>
 
+#include <algorithm>
 #include <vector>
 
 #include "open3d/core/Atomic.h"
@@ -210,52 +211,102 @@ void VoxelizeCPU(const size_t num_points,
     output_allocator.AllocVoxelPointRowSplits(&out_voxel_row_splits,
                                               total_voxels + 1);
 
-    std::vector<int64_t> tmp_point_indices;
-    {
-        int64_t hash_i = 0;  // index into the vector hashes_indices
-        for (int64_t voxel_i = 0; voxel_i < total_voxels; ++voxel_i) {
-            // compute voxel coord and the prefix sum value
-            auto coord = CoordFn(
-                    Vec_t(points + hashes_indices[hash_i].second * NDIM));
-            for (int d = 0; d < NDIM; ++d) {
-                out_voxel_coords[voxel_i * NDIM + d] = coord[d];
-            }
-            out_voxel_row_splits[voxel_i] = tmp_point_indices.size();
+    // Find the first entry of each voxel in the sorted list. Entries with the
+    // invalid hash are at the end of the list.
+    const int64_t num_valid =
+            std::partition_point(hashes_indices.begin(), hashes_indices.end(),
+                                 [&](const std::pair<int64_t, int64_t>& x) {
+                                     return x.first < invalid_hash;
+                                 }) -
+            hashes_indices.begin();
+    std::vector<int64_t> voxel_ids(num_valid);
+    tbb::parallel_for(tbb::blocked_range<int64_t>(0, num_valid),
+                      [&](const tbb::blocked_range<int64_t>& r) {
+                          for (int64_t i = r.begin(); i != r.end(); ++i) {
+                              voxel_ids[i] =
+                                      (i == 0 || hashes_indices[i].first !=
+                                                         hashes_indices[i - 1]
+                                                                 .first);
+                          }
+                      });
+    InclusivePrefixSum(voxel_ids.data(), voxel_ids.data() + num_valid,
+                       voxel_ids.data());
+    const int64_t num_unique_voxels = num_valid ? voxel_ids.back() : 0;
 
-            // add up to max_points_per_voxel indices for this voxel
-            int64_t points_per_voxel = 0;
-            const int64_t current_hash = hashes_indices[hash_i].first;
-            int64_t batch_id = current_hash / batch_hash;
-            num_voxels[batch_id]--;
-            for (; hash_i < hashes_indices.size(); ++hash_i) {
-                if (current_hash != hashes_indices[hash_i].first) {
-                    // new voxel starts -> break
-                    break;
-                }
-                if (points_per_voxel < max_points_per_voxel) {
-                    tmp_point_indices.push_back(hashes_indices[hash_i].second);
-                    ++points_per_voxel;
+    // Start of each unique voxel and the first unique voxel of each batch.
+    std::vector<int64_t> voxel_begin(num_unique_voxels + 1, num_valid);
+    std::vector<int64_t> batch_first_voxel(batch_size, 0);
+    tbb::parallel_for(
+            tbb::blocked_range<int64_t>(0, num_valid),
+            [&](const tbb::blocked_range<int64_t>& r) {
+                for (int64_t i = r.begin(); i != r.end(); ++i) {
+                    const int64_t voxel_id = voxel_ids[i] - 1;
+                    if (i != 0 && voxel_ids[i - 1] == voxel_ids[i]) continue;
+                    voxel_begin[voxel_id] = i;
+                    const int64_t batch_id =
+                            hashes_indices[i].first / batch_hash;
+                    if (i == 0 ||
+                        hashes_indices[i - 1].first / batch_hash != batch_id) {
+                        batch_first_voxel[batch_id] = voxel_id;
+                    }
                 }
-            }
+            });
 
-            // skip voxels exceeding max_voxel
-            if (num_voxels[batch_id] == 0) {
-                for (; hash_i < hashes_indices.size(); ++hash_i) {
-                    if ((int64_t)(hashes_indices[hash_i].first / batch_hash) !=
-                        batch_id) {
-                        break;
-                    }
+    // Maps the unique voxels to the output voxels. Each batch keeps its first
+    // max_voxels voxels.
+    auto OutputVoxelIdx = [&](int64_t voxel_id) {
+        const int64_t batch_id =
+                hashes_indices[voxel_begin[voxel_id]].first / batch_hash;
+        const int64_t rank = voxel_id - batch_first_voxel[batch_id];
+        return rank < int64_t(num_voxels[batch_id])
+                       ? out_batch_splits[batch_id] + rank
+                       : int64_t(-1);
+    };
+
+    // Number of point indices recorded for each output voxel.
+    out_voxel_row_splits[0] = 0;
+    tbb::parallel_for(
+            tbb::blocked_range<int64_t>(0, num_unique_voxels),
+            [&](const tbb::blocked_range<int64_t>& r) {
+                for (int64_t voxel_id = r.begin(); voxel_id != r.end();
+                     ++voxel_id) {
+                    const int64_t voxel_i = OutputVoxelIdx(voxel_id);
+                    if (voxel_i < 0) continue;
+                    out_voxel_row_splits[voxel_i + 1] = std::min(
+                            voxel_begin[voxel_id + 1] - voxel_begin[voxel_id],
+                            max_points_per_voxel);
                 }
-            }
-        }
-        out_voxel_row_splits[total_voxels] = tmp_point_indices.size();
-    }
+            });
+    InclusivePrefixSum(out_voxel_row_splits + 1,
+                       out_voxel_row_splits + total_voxels + 1,
+                       out_voxel_row_splits + 1);
 
     int64_t* out_point_indices = nullptr;
-    output_allocator.AllocVoxelPointIndices(&out_point_indices,
-                                            tmp_point_indices.size());
-    memcpy(out_point_indices, tmp_point_indices.data(),
-           tmp_point_indices.size() * sizeof(int64_t));
+    output_allocator.AllocVoxelPointIndices(
+            &out_point_indices, out_voxel_row_splits[total_voxels]);
+
+    tbb::parallel_for(
+            tbb::blocked_range<int64_t>(0, num_unique_voxels),
+            [&](const tbb::blocked_range<int64_t>& r) {
+                for (int64_t voxel_id = r.begin(); voxel_id != r.end();
+                     ++voxel_id) {
+                    const int64_t voxel_i = OutputVoxelIdx(voxel_id);
+                    if (voxel_i < 0) continue;
+                    const int64_t begin = voxel_begin[voxel_id];
+                    const int64_t first_point = hashes_indices[begin].second;
+                    auto coord = CoordFn(Vec_t(points + first_point * NDIM));
+                    for (int d = 0; d < NDIM; ++d) {
+                        out_voxel_coords[voxel_i * NDIM + d] = coord[d];
+                    }
+                    int64_t* out = out_point_indices +
+                                   out_voxel_row_splits[voxel_i];
+                    const int64_t count = out_voxel_row_splits[voxel_i + 1] -
+                                          out_voxel_row_splits[voxel_i];
+                    for (int64_t j = 0; j < count; ++j) {
+                        out[j] = hashes_indices[begin + j].second;
+                    }
+                }
+            });
 }
 
 }  // namespace impl
@@ -25,9 +25,13 @@
 // ----------------------------------------------------------------------------
 
 #pragma once
+#include <c10/core/impl/VirtualGuardImpl.h>
 #include <torch/script.h>
 
+#include <map>
+#include <mutex>
 #include <sstream>
+#include <tuple>
 #include <type_traits>
 
 #include "open3d/ml/ShapeChecking.h"
@@ -103,6 +107,14 @@ template <>
 inline TorchDtype_t ToTorchDtype<double>() {
     return torch::kFloat64;
 }
+template <>
+inline TorchDtype_t ToTorchDtype<at::Half>() {
+    return torch::kFloat16;
+}
+template <>
+inline TorchDtype_t ToTorchDtype<at::BFloat16>() {
+    return torch::kBFloat16;
+}
 
 // convenience function for comparing standard types with torch types
 template <class T, class TDtype>
@@ -147,12 +159,60 @@ inline std::string TensorInfoStr(std::initializer_list<torch::Tensor> tensors) {
     return sstr.str();
 }
 
+/// Persistent workspace for the temporary memory of the ops. There is one
+/// buffer for each device and stream, which is handed out again by later calls
+/// on the same stream once the previous user has released it. Work on a stream
+/// is ordered, so reusing the buffer does not need a synchronization. The
+/// buffer only grows and is rounded up to multiples of 1 MiB to avoid
+/// reallocating for small changes of the requested size.
+class TempMemoryArena {
+public:
+    /// Buffers above this size are not cached and are allocated per call.
+    static constexpr int64_t kMaxCachedSize = int64_t(256) << 20;
+
+    static torch::Tensor Get(const int64_t size, const torch::Device& device) {
+        const int64_t rounded_size =
+                (size + kGranularity - 1) / kGranularity * kGranularity;
+        if (rounded_size > kMaxCachedSize) {
+            return Allocate(size, device);
+        }
+        c10::impl::VirtualGuardImpl guard(device.type());
+        const c10::Stream stream = guard.getStream(device);
+        const Key key(int(device.type()), device.index(), stream.id());
+
+        // Intentionally leaked to not free device memory after the framework
+        // allocators have been destroyed at exit.
+        static std::mutex mutex;
+        static auto* buffers = new std::map<Key, torch::Tensor>();
+        std::lock_guard<std::mutex> lock(mutex);
+        torch::Tensor& buffer = (*buffers)[key];
+        if (buffer.defined() && buffer.use_count() > 1) {
+            // The buffer is still in use, e.g. by an enclosing op.
+            return Allocate(size, device);
+        }
+        if (!buffer.defined() || buffer.size(0) < size) {
+            buffer = torch::Tensor();
+            buffer = Allocate(rounded_size, device);
+        }
+        return buffer;
+    }
+
+private:
+    static constexpr int64_t kGranularity = int64_t(1) << 20;
+    typedef std::tuple<int, int, int64_t> Key;
+
+    static torch::Tensor Allocate(const int64_t size,
+                                  const torch::Device& device) {
+        return torch::empty(
+                {size}, torch::dtype(ToTorchDtype<uint8_t>()).device(device));
+    }
+};
+
 // convenience function for creating a tensor for temp memory
 inline torch::Tensor CreateTempTensor(const int64_t size,
                                       const torch::Device& device,
                                       void** ptr = nullptr) {
-    torch::Tensor tensor = torch::empty(
-            {size}, torch::dtype(ToTorchDtype<uint8_t>()).device(device));
+    torch::Tensor tensor = TempMemoryArena::Get(size, device);
     if (ptr) {
         *ptr = tensor.data_ptr<uint8_t>();
     }
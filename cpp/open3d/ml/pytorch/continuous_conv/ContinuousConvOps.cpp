@@ -33,7 +33,6 @@
 #include "open3d/ml/pytorch/continuous_conv/ContinuousConvOpKernel.h"
 #include "open3d/ml/pytorch/continuous_conv/ContinuousConvTransposeOpKernel.h"
 #include "open3d/ml/pytorch/misc/InvertNeighborsListOps.h"
-#include "open3d/ml/pytorch/misc/ReduceSubarraysSumOps.h"
 #include "torch/script.h"
 
 using namespace open3d::ml::impl;
@@ -224,14 +223,12 @@ public:
                 normalize, interpolation, max_temp_mem_MB, filters_backprop);  \
                                                                                \
         torch::Tensor inv_neighbors_index, inv_neighbors_row_splits,           \
-                inv_neighbors_importance;                                      \
+                inv_neighbors_importance, neighbors_importance_sum;            \
         std::tie(inv_neighbors_index, inv_neighbors_row_splits,                \
-                 inv_neighbors_importance) =                                   \
-                InvertNeighborsList(inp_positions.size(0), neighbors_index,    \
-                                    neighbors_row_splits,                      \
-                                    neighbors_importance);                     \
-        auto neighbors_importance_sum = ReduceSubarraysSum(                    \
-                neighbors_importance, neighbors_row_splits);                   \
+                 inv_neighbors_importance, neighbors_importance_sum) =         \
+                InvertNeighborsListAndReduceAttributes(                        \
+                        inp_positions.size(0), neighbors_index,                \
+                        neighbors_row_splits, neighbors_importance);           \
         inp_features_backprop =                                                \
                 torch::ones(inp_features.sizes(),                              \
                             torch::dtype(real_dtype).device(device));          \
@@ -27,16 +27,19 @@
 
 #include "open3d/ml/pytorch/misc/InvertNeighborsListOpKernel.h"
 
+#include <vector>
+
 #include "open3d/ml/impl/misc/InvertNeighborsList.h"
 #include "open3d/ml/pytorch/TorchHelper.h"
 #include "torch/script.h"
 
 template <class TIndex, class TAttr>
-std::tuple<torch::Tensor, torch::Tensor, torch::Tensor> InvertNeighborsListCPU(
-        int64_t num_points,
-        const torch::Tensor& inp_neighbors_index,
-        const torch::Tensor& inp_neighbors_row_splits,
-        const torch::Tensor& inp_neighbors_attributes) {
+std::tuple<torch::Tensor, torch::Tensor, torch::Tensor, torch::Tensor>
+InvertNeighborsListCPU(int64_t num_points,
+                       const torch::Tensor& inp_neighbors_index,
+                       const torch::Tensor& inp_neighbors_row_splits,
+                       const torch::Tensor& inp_neighbors_attributes,
+                       bool reduce_attributes) {
     torch::Tensor neighbors_index = torch::empty(
             inp_neighbors_index.sizes(), torch::dtype(ToTorchDtype<TIndex>()));
     torch::Tensor neighbors_row_splits =
@@ -53,6 +56,19 @@ std::tuple<torch::Tensor, torch::Tensor, torch::Tensor> InvertNeighborsListCPU(
             num_attributes *= inp_neighbors_attributes.size(i);
     }
 
+    torch::Tensor attributes_sum;
+    if (reduce_attributes && num_attributes) {
+        std::vector<int64_t> sum_shape = inp_neighbors_attributes.sizes().vec();
+        sum_shape[0] = inp_neighbors_row_splits.size(0) - 1;
+        attributes_sum = torch::empty(sum_shape,
+                                      inp_neighbors_attributes.options());
+    } else {
+        attributes_sum = torch::empty_like(inp_neighbors_attributes);
+    }
+    TAttr* attributes_sum_ptr = reduce_attributes && num_attributes
+                                        ? attributes_sum.data_ptr<TAttr>()
+                                        : nullptr;
+
     open3d::ml::impl::InvertNeighborsListCPU(
             inp_neighbors_index.data_ptr<TIndex>(),
             num_attributes ? inp_neighbors_attributes.data_ptr<TAttr>()
@@ -62,16 +78,17 @@ std::tuple<torch::Tensor, torch::Tensor, torch::Tensor> InvertNeighborsListCPU(
             neighbors_index.data_ptr<TIndex>(),
             num_attributes ? neighbors_attributes.data_ptr<TAttr>() : nullptr,
             neighbors_index.size(0), neighbors_row_splits.data_ptr<int64_t>(),
-            neighbors_row_splits.size(0) - 1);
+            neighbors_row_splits.size(0) - 1, attributes_sum_ptr);
 
     return std::make_tuple(neighbors_index, neighbors_row_splits,
-                           neighbors_attributes);
+                           neighbors_attributes, attributes_sum);
 }
 #define INSTANTIATE(TIndex, TAttr)                                       \
-    template std::tuple<torch::Tensor, torch::Tensor, torch::Tensor>     \
+    template std::tuple<torch::Tensor, torch::Tensor, torch::Tensor,     \
+                        torch::Tensor>                                   \
     InvertNeighborsListCPU<TIndex, TAttr>(int64_t, const torch::Tensor&, \
                                           const torch::Tensor&,          \
-                                          const torch::Tensor&);
+                                          const torch::Tensor&, bool);
 
 INSTANTIATE(int32_t, uint8_t)
 INSTANTIATE(int32_t, int8_t)
@@ -25,6 +25,8 @@
 // ----------------------------------------------------------------------------
 //
 
+#include <vector>
+
 #include "ATen/cuda/CUDAContext.h"
 #include "open3d/ml/impl/misc/InvertNeighborsList.cuh"
 #include "open3d/ml/pytorch/TorchHelper.h"
@@ -32,11 +34,12 @@
 #include "torch/script.h"
 
 template <class TIndex, class TAttr>
-std::tuple<torch::Tensor, torch::Tensor, torch::Tensor> InvertNeighborsListCUDA(
-        int64_t num_points,
-        const torch::Tensor& inp_neighbors_index,
-        const torch::Tensor& inp_neighbors_row_splits,
-        const torch::Tensor& inp_neighbors_attributes) {
+std::tuple<torch::Tensor, torch::Tensor, torch::Tensor, torch::Tensor>
+InvertNeighborsListCUDA(int64_t num_points,
+                        const torch::Tensor& inp_neighbors_index,
+                        const torch::Tensor& inp_neighbors_row_splits,
+                        const torch::Tensor& inp_neighbors_attributes,
+                        bool reduce_attributes) {
     auto device = inp_neighbors_index.device();
     torch::Tensor neighbors_index =
             torch::empty(inp_neighbors_index.sizes(),
@@ -59,6 +62,19 @@ std::tuple<torch::Tensor, torch::Tensor, torch::Tensor> InvertNeighborsListCUDA(
             num_attributes *= inp_neighbors_attributes.size(i);
     }
 
+    torch::Tensor attributes_sum;
+    if (reduce_attributes && num_attributes) {
+        std::vector<int64_t> sum_shape = inp_neighbors_attributes.sizes().vec();
+        sum_shape[0] = inp_neighbors_row_splits.size(0) - 1;
+        attributes_sum = torch::empty(sum_shape,
+                                      inp_neighbors_attributes.options());
+    } else {
+        attributes_sum = torch::empty_like(inp_neighbors_attributes);
+    }
+    TAttr* attributes_sum_ptr = reduce_attributes && num_attributes
+                                        ? attributes_sum.data_ptr<TAttr>()
+                                        : nullptr;
+
     void* temp_ptr = nullptr;
     size_t temp_size = 0;
 
@@ -75,7 +91,7 @@ std::tuple<torch::Tensor, torch::Tensor, torch::Tensor> InvertNeighborsListCUDA(
             num_attributes ? neighbors_attributes.data_ptr<TAttr>() : nullptr,
             neighbors_index.size(0),
             (int64_t*)neighbors_row_splits.data_ptr<int64_t>(),
-            neighbors_row_splits.size(0) - 1);
+            neighbors_row_splits.size(0) - 1, attributes_sum_ptr);
 
     auto temp_tensor = CreateTempTensor(temp_size, device, &temp_ptr);
 
@@ -92,16 +108,17 @@ std::tuple<torch::Tensor, torch::Tensor, torch::Tensor> InvertNeighborsListCUDA(
             num_attributes ? neighbors_attributes.data_ptr<TAttr>() : nullptr,
             neighbors_index.size(0),
             (int64_t*)neighbors_row_splits.data_ptr<int64_t>(),
-            neighbors_row_splits.size(0) - 1);
+            neighbors_row_splits.size(0) - 1, attributes_sum_ptr);
 
     return std::make_tuple(neighbors_index, neighbors_row_splits,
-                           neighbors_attributes);
+                           neighbors_attributes, attributes_sum);
 }
 #define INSTANTIATE(TIndex, TAttr)                                        \
-    template std::tuple<torch::Tensor, torch::Tensor, torch::Tensor>      \
+    template std::tuple<torch::Tensor, torch::Tensor, torch::Tensor,      \
+                        torch::Tensor>                                    \
     InvertNeighborsListCUDA<TIndex, TAttr>(int64_t, const torch::Tensor&, \
                                            const torch::Tensor&,          \
-                                           const torch::Tensor&);
+                                           const torch::Tensor&, bool);
 
 INSTANTIATE(int32_t, uint8_t)
 INSTANTIATE(int32_t, int8_t)
@@ -28,18 +28,24 @@
 
 #include "torch/script.h"
 
+/// Returns the inverted (neighbors_index, neighbors_row_splits,
+/// neighbors_attributes) and, if \p reduce_attributes is true, the sums of
+/// the attributes over each input sublist. The sums are computed in the same
+/// pass and are an empty tensor if \p reduce_attributes is false.
 template <class TIndex, class TAttr>
-std::tuple<torch::Tensor, torch::Tensor, torch::Tensor> InvertNeighborsListCPU(
-        int64_t num_points,
-        const torch::Tensor& inp_neighbors_index,
-        const torch::Tensor& inp_neighbors_row_splits,
-        const torch::Tensor& inp_neighbors_attributes);
+std::tuple<torch::Tensor, torch::Tensor, torch::Tensor, torch::Tensor>
+InvertNeighborsListCPU(int64_t num_points,
+                       const torch::Tensor& inp_neighbors_index,
+                       const torch::Tensor& inp_neighbors_row_splits,
+                       const torch::Tensor& inp_neighbors_attributes,
+                       bool reduce_attributes);
 
 #ifdef BUILD_CUDA_MODULE
 template <class TIndex, class TAttr>
-std::tuple<torch::Tensor, torch::Tensor, torch::Tensor> InvertNeighborsListCUDA(
-        int64_t num_points,
-        const torch::Tensor& inp_neighbors_index,
-        const torch::Tensor& inp_neighbors_row_splits,
-        const torch::Tensor& inp_neighbors_attributes);
+std::tuple<torch::Tensor, torch::Tensor, torch::Tensor, torch::Tensor>
+InvertNeighborsListCUDA(int64_t num_points,
+                        const torch::Tensor& inp_neighbors_index,
+                        const torch::Tensor& inp_neighbors_row_splits,
+                        const torch::Tensor& inp_neighbors_attributes,
+                        bool reduce_attributes);
 #endif
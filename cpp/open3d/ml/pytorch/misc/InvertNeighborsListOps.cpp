@@ -33,11 +33,14 @@
 #include "open3d/ml/pytorch/misc/InvertNeighborsListOpKernel.h"
 #include "torch/script.h"
 
-std::tuple<torch::Tensor, torch::Tensor, torch::Tensor> InvertNeighborsList(
-        int64_t num_points,
-        torch::Tensor inp_neighbors_index,
-        torch::Tensor inp_neighbors_row_splits,
-        torch::Tensor inp_neighbors_attributes) {
+namespace {
+
+std::tuple<torch::Tensor, torch::Tensor, torch::Tensor, torch::Tensor>
+InvertNeighborsListDispatch(int64_t num_points,
+                            torch::Tensor inp_neighbors_index,
+                            torch::Tensor inp_neighbors_row_splits,
+                            torch::Tensor inp_neighbors_attributes,
+                            bool reduce_attributes) {
     inp_neighbors_index = inp_neighbors_index.contiguous();
     inp_neighbors_row_splits = inp_neighbors_row_splits.contiguous();
     inp_neighbors_attributes = inp_neighbors_attributes.contiguous();
@@ -59,7 +62,7 @@ std::tuple<torch::Tensor, torch::Tensor, torch::Tensor> InvertNeighborsList(
 
 #define FN_PARAMETERS                                          \
     num_points, inp_neighbors_index, inp_neighbors_row_splits, \
-            inp_neighbors_attributes
+            inp_neighbors_attributes, reduce_attributes
 
 #define CALL(idx_t, attr_t, fn)                  \
     if (CompareTorchDtype<idx_t>(index_type) &&  \
@@ -98,7 +101,36 @@ std::tuple<torch::Tensor, torch::Tensor, torch::Tensor> InvertNeighborsList(
                                " as input for inp_neighbors_index and " +
                                inp_neighbors_attributes.toString() +
                                " as input for inp_neighbors_attributes")
-    return std::tuple<torch::Tensor, torch::Tensor, torch::Tensor>();
+    return std::tuple<torch::Tensor, torch::Tensor, torch::Tensor,
+                      torch::Tensor>();
+}
+
+}  // namespace
+
+std::tuple<torch::Tensor, torch::Tensor, torch::Tensor> InvertNeighborsList(
+        int64_t num_points,
+        torch::Tensor inp_neighbors_index,
+        torch::Tensor inp_neighbors_row_splits,
+        torch::Tensor inp_neighbors_attributes) {
+    torch::Tensor neighbors_index, neighbors_row_splits, neighbors_attributes,
+            attributes_sum;
+    std::tie(neighbors_index, neighbors_row_splits, neighbors_attributes,
+             attributes_sum) =
+            InvertNeighborsListDispatch(num_points, inp_neighbors_index,
+                                        inp_neighbors_row_splits,
+                                        inp_neighbors_attributes, false);
+    return std::make_tuple(neighbors_index, neighbors_row_splits,
+                           neighbors_attributes);
+}
+
+std::tuple<torch::Tensor, torch::Tensor, torch::Tensor, torch::Tensor>
+InvertNeighborsListAndReduceAttributes(int64_t num_points,
+                                       torch::Tensor inp_neighbors_index,
+                                       torch::Tensor inp_neighbors_row_splits,
+                                       torch::Tensor inp_neighbors_attributes) {
+    return InvertNeighborsListDispatch(num_points, inp_neighbors_index,
+                                       inp_neighbors_row_splits,
+                                       inp_neighbors_attributes, true);
 }
 
 static auto registry = torch::RegisterOperators(
@@ -33,3 +33,14 @@ std::tuple<torch::Tensor, torch::Tensor, torch::Tensor> InvertNeighborsList(
         torch::Tensor inp_neighbors_index,
         torch::Tensor inp_neighbors_row_splits,
         torch::Tensor inp_neighbors_attributes);
+
+/// Inverts the neighbors list like InvertNeighborsList and additionally
+/// returns the sums of \p inp_neighbors_attributes over each sublist, which is
+/// equal to ReduceSubarraysSum(inp_neighbors_attributes,
+/// inp_neighbors_row_splits). The sums are computed in the same pass over the
+/// attributes. This is used by the backward passes which need both.
+std::tuple<torch::Tensor, torch::Tensor, torch::Tensor, torch::Tensor>
+InvertNeighborsListAndReduceAttributes(int64_t num_points,
+                                       torch::Tensor inp_neighbors_index,
+                                       torch::Tensor inp_neighbors_row_splits,
+                                       torch::Tensor inp_neighbors_attributes);
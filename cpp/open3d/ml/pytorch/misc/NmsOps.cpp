@@ -61,8 +61,72 @@ torch::Tensor Nms(torch::Tensor boxes,
     }
 }
 
+torch::Tensor BatchedNms(torch::Tensor boxes,
+                         torch::Tensor scores,
+                         torch::Tensor labels,
+                         torch::Tensor row_splits,
+                         double nms_overlap_thresh,
+                         int64_t pre_nms_top_k) {
+    boxes = boxes.contiguous();
+    scores = scores.contiguous();
+    labels = labels.contiguous();
+    CHECK_TYPE(boxes, kFloat);
+    CHECK_TYPE(scores, kFloat);
+    CHECK_TYPE(labels, kInt64);
+    CHECK_TYPE(row_splits, kInt64);
+    CHECK_SAME_DEVICE_TYPE(boxes, scores, labels);
+
+    // check input shapes
+    {
+        using namespace open3d::ml::op_util;
+        Dim num_boxes("num_boxes");
+        Dim batch_size("batch_size");
+        CHECK_SHAPE(boxes, num_boxes, 5);
+        CHECK_SHAPE(scores, num_boxes);
+        CHECK_SHAPE(labels, num_boxes);
+        CHECK_SHAPE(row_splits, batch_size + 1);
+    }
+    const int64_t num_batches = row_splits.size(0) - 1;
+    torch::Tensor row_splits_cpu = row_splits.to(torch::kCPU).contiguous();
+    TORCH_CHECK(row_splits_cpu.data_ptr<int64_t>()[0] == 0 &&
+                        row_splits_cpu.data_ptr<int64_t>()[num_batches] ==
+                                boxes.size(0),
+                "row_splits must start with 0 and end with the number of "
+                "boxes")
+
+    std::vector<int64_t> keep_indices;
+    if (boxes.is_cuda()) {
+#ifdef BUILD_CUDA_MODULE
+        torch::Tensor row_splits_device =
+                row_splits_cpu.to(boxes.device()).contiguous();
+        keep_indices = open3d::ml::contrib::BatchedNmsCUDAKernel(
+                boxes.data_ptr<float>(), scores.data_ptr<float>(),
+                labels.data_ptr<int64_t>(),
+                row_splits_device.data_ptr<int64_t>(), num_batches,
+                boxes.size(0), nms_overlap_thresh, pre_nms_top_k);
+#else
+        TORCH_CHECK(false, "BatchedNms was not compiled with CUDA support")
+#endif
+    } else {
+        keep_indices = open3d::ml::contrib::BatchedNmsCPUKernel(
+                boxes.data_ptr<float>(), scores.data_ptr<float>(),
+                labels.data_ptr<int64_t>(), row_splits_cpu.data_ptr<int64_t>(),
+                num_batches, boxes.size(0), nms_overlap_thresh, pre_nms_top_k);
+    }
+    return torch::from_blob(keep_indices.data(),
+                            {static_cast<int64_t>(keep_indices.size())},
+                            torch::TensorOptions().dtype(torch::kLong))
+            .to(boxes.device(), /*non_blocking=*/false, /*copy=*/true);
+}
+
 static auto registry = torch::RegisterOperators(
         "open3d::nms(Tensor boxes, Tensor scores, float "
         "nms_overlap_thresh) -> "
         "Tensor keep_indices",
         &Nms);
+
+static auto registry_batched = torch::RegisterOperators(
+        "open3d::batched_nms(Tensor boxes, Tensor scores, Tensor labels, "
+        "Tensor row_splits, float nms_overlap_thresh, int pre_nms_top_k=-1) "
+        "-> Tensor keep_indices",
+        &BatchedNms);
@@ -70,6 +70,9 @@ torch::Tensor ball_query(torch::Tensor xyz,
             torch::zeros({batch_size, ball_num, nsample},
                          torch::dtype(ToTorchDtype<int>()).device(device));
 
+    // Half precision coordinates are converted to float for the search.
+    center = center.to(torch::kFloat32).contiguous();
+    xyz = xyz.to(torch::kFloat32).contiguous();
     const float *center_data = center.data_ptr<float>();
     const float *xyz_data = xyz.data_ptr<float>();
     int *idx = out.data_ptr<int>();
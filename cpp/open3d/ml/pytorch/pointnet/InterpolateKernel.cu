@@ -94,14 +94,15 @@ void three_nn_launcher(int b,
     }
 }
 
+template <typename scalar_t>
 void three_interpolate_launcher(int b,
                                 int c,
                                 int m,
                                 int n,
-                                const float *points,
+                                const scalar_t *points,
                                 const int *idx,
                                 const float *weight,
-                                float *out) {
+                                scalar_t *out) {
     // points: (B, C, M)
     // idx: (B, N, 3)
     // weight: (B, N, 3)
@@ -125,11 +126,12 @@ void three_interpolate_launcher(int b,
     }
 }
 
+template <typename scalar_t>
 void three_interpolate_grad_launcher(int b,
                                      int c,
                                      int n,
                                      int m,
-                                     const float *grad_out,
+                                     const scalar_t *grad_out,
                                      const int *idx,
                                      const float *weight,
                                      float *grad_points) {
@@ -154,3 +156,15 @@ void three_interpolate_grad_launcher(int b,
         exit(-1);
     }
 }
+
+#define INSTANTIATE(scalar_t)                                                 \
+    template void three_interpolate_launcher<scalar_t>(                       \
+            int, int, int, int, const scalar_t *, const int *, const float *, \
+            scalar_t *);                                                      \
+    template void three_interpolate_grad_launcher<scalar_t>(                  \
+            int, int, int, int, const scalar_t *, const int *, const float *, \
+            float *);
+
+INSTANTIATE(float)
+INSTANTIATE(at::Half)
+INSTANTIATE(at::BFloat16)
@@ -60,20 +60,26 @@ void three_nn_launcher(int b,
                        float *dist2,
                        int *idx);
 
+/// \tparam scalar_t The feature type. This is float, at::Half or
+/// at::BFloat16.
+template <typename scalar_t>
 void three_interpolate_launcher(int b,
                                 int c,
                                 int m,
                                 int n,
-                                const float *points,
+                                const scalar_t *points,
                                 const int *idx,
                                 const float *weight,
-                                float *out);
+                                scalar_t *out);
 
+/// \tparam scalar_t The type of \p grad_out. The gradient \p grad_points is
+/// always float.
+template <typename scalar_t>
 void three_interpolate_grad_launcher(int b,
                                      int c,
                                      int n,
                                      int m,
-                                     const float *grad_out,
+                                     const scalar_t *grad_out,
                                      const int *idx,
                                      const float *weight,
                                      float *grad_points);
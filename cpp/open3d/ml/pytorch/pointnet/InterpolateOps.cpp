@@ -77,6 +77,9 @@ std::tuple<torch::Tensor, torch::Tensor> three_nn(torch::Tensor query_pts,
             torch::zeros({batch_size, pts_num_out, 3},
                          torch::dtype(ToTorchDtype<float>()).device(device));
 
+    // Half precision coordinates are converted to float for the search.
+    query_pts = query_pts.to(torch::kFloat32).contiguous();
+    data_pts = data_pts.to(torch::kFloat32).contiguous();
     const float *pts_out = query_pts.data_ptr<float>();
     const float *pts_in = data_pts.data_ptr<float>();
     float *dist2 = out_dist2.data_ptr<float>();
@@ -96,19 +99,32 @@ torch::Tensor three_interpolate(torch::Tensor points,
     int M = points.size(2);
     int N = idx.size(1);
 
+    points = points.contiguous();
+    weights = weights.to(torch::kFloat32).contiguous();
+    const auto &dtype = points.dtype();
+
     auto device = points.device();
-    torch::Tensor out =
-            torch::zeros({batch_size, C, N},
-                         torch::dtype(ToTorchDtype<float>()).device(device));
+    torch::Tensor out = torch::zeros({batch_size, C, N},
+                                     torch::dtype(dtype).device(device));
 
-    const float *points_data = points.data_ptr<float>();
     const float *weights_data = weights.data_ptr<float>();
     const int *idx_data = idx.data_ptr<int>();
-    float *out_data = out.data_ptr<float>();
-
-    three_interpolate_launcher(batch_size, C, M, N, points_data, idx_data,
-                               weights_data, out_data);
 
+#define CALL(scalar_t)                                                       \
+    if (CompareTorchDtype<scalar_t>(dtype)) {                                \
+        three_interpolate_launcher(batch_size, C, M, N,                      \
+                                   points.data_ptr<scalar_t>(), idx_data,    \
+                                   weights_data, out.data_ptr<scalar_t>()); \
+        return out;                                                          \
+    }
+
+    CALL(float)
+    CALL(at::Half)
+    CALL(at::BFloat16)
+#undef CALL
+
+    TORCH_CHECK(false, "three_interpolate does not support " +
+                               points.toString() + " as input for points")
     return out;
 }
 
@@ -120,20 +136,37 @@ torch::Tensor three_interpolate_grad(torch::Tensor grad_out,
     int C = grad_out.size(1);
     int N = grad_out.size(2);
 
+    grad_out = grad_out.contiguous();
+    weights = weights.to(torch::kFloat32).contiguous();
+    const auto &dtype = grad_out.dtype();
+
+    // The gradient is accumulated in float and converted to the type of
+    // grad_out at the end.
     auto device = grad_out.device();
     torch::Tensor out =
             torch::zeros({batch_size, C, M},
                          torch::dtype(ToTorchDtype<float>()).device(device));
 
-    const float *grad_out_data = grad_out.data_ptr<float>();
     const float *weights_data = weights.data_ptr<float>();
     const int *idx_data = idx.data_ptr<int>();
 
     float *out_data = out.data_ptr<float>();
 
-    three_interpolate_grad_launcher(batch_size, C, N, M, grad_out_data,
-                                    idx_data, weights_data, out_data);
-
+#define CALL(scalar_t)                                                       \
+    if (CompareTorchDtype<scalar_t>(dtype)) {                                \
+        three_interpolate_grad_launcher(batch_size, C, N, M,                 \
+                                        grad_out.data_ptr<scalar_t>(),       \
+                                        idx_data, weights_data, out_data);   \
+        return out.to(grad_out.scalar_type());                               \
+    }
+
+    CALL(float)
+    CALL(at::Half)
+    CALL(at::BFloat16)
+#undef CALL
+
+    TORCH_CHECK(false, "three_interpolate_grad does not support " +
+                               grad_out.toString() + " as input for grad_out")
     return out;
 }
 
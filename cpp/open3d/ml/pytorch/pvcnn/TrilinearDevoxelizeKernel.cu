@@ -52,6 +52,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 
+#include "ATen/ATen.h"
 #include "ATen/cuda/CUDAContext.h"
 #include "open3d/ml/contrib/TrilinearDevoxelize.cuh"
 #include "open3d/ml/contrib/cuda_utils.h"
@@ -75,7 +76,9 @@ void TrilinearDevoxelize(int b,
 
     auto stream = at::cuda::getCurrentCUDAStream();
 
-    TrilinearDevoxelizeKernel<<<b, OptNumThreads(n), 0, stream>>>(
+    const int num_threads = OptNumThreads(n);
+    dim3 blocks(DIVUP(n, num_threads), b);
+    TrilinearDevoxelizeKernel<<<blocks, num_threads, 0, stream>>>(
             b, c, n, r, r2, r3, training, coords, feat, inds, wgts, outs);
 
     err = cudaGetLastError();
@@ -97,8 +100,15 @@ void TrilinearDevoxelizeGrad(int b,
 
     auto stream = at::cuda::getCurrentCUDAStream();
 
-    TrilinearDevoxelizeGradKernel<<<b, OptNumThreads(n), 0, stream>>>(
-            b, c, n, r3, inds, wgts, grad_y, grad_x);
+    // Temporary memory for sorting the (point, corner) entries by voxel.
+    auto options = at::device(at::kCUDA).dtype(at::ScalarType::Int);
+    at::Tensor voxel_keys = at::empty({b * 8 * n}, options);
+    at::Tensor sorted_entries = at::empty({b * 8 * n}, options);
+    at::Tensor voxel_offsets = at::empty({b * r3 + 1}, options);
+    TrilinearDevoxelizeGradCUDA(stream, b, c, n, r3, inds, wgts, grad_y,
+                                grad_x, voxel_keys.data_ptr<int>(),
+                                sorted_entries.data_ptr<int>(),
+                                voxel_offsets.data_ptr<int>());
 
     err = cudaGetLastError();
     if (cudaSuccess != err) {
@@ -83,7 +83,8 @@ void TrilinearDevoxelize(int b,
                          float *outs);
 
 /// This function computes gradient for trilinear devoxelization op.
-/// It computes gradient for the input voxelgrid.
+/// It computes gradient for the input voxelgrid. The result is deterministic
+/// since the gradient is gathered per voxel without atomics.
 ///
 /// \param b    The batch size.
 /// \param c    Feature dimension of voxel grid.
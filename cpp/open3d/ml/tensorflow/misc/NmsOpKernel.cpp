@@ -58,3 +58,38 @@ public:
             NmsOpKernelCPU);
 REG_KB(float)
 #undef REG_KB
+
+class BatchedNmsOpKernelCPU : public BatchedNmsOpKernel {
+public:
+    explicit BatchedNmsOpKernelCPU(OpKernelConstruction* construction)
+        : BatchedNmsOpKernel(construction) {}
+
+    void Kernel(tensorflow::OpKernelContext* context,
+                const tensorflow::Tensor& boxes,
+                const tensorflow::Tensor& scores,
+                const tensorflow::Tensor& labels,
+                const tensorflow::Tensor& row_splits) {
+        std::vector<int64_t> keep_indices =
+                open3d::ml::contrib::BatchedNmsCPUKernel(
+                        boxes.flat<float>().data(), scores.flat<float>().data(),
+                        (const int64_t*)labels.flat<int64>().data(),
+                        (const int64_t*)row_splits.flat<int64>().data(),
+                        row_splits.dim_size(0) - 1, boxes.dim_size(0),
+                        this->nms_overlap_thresh, this->pre_nms_top_k);
+
+        OutputAllocator output_allocator(context);
+        int64_t* ret_keep_indices = nullptr;
+        output_allocator.AllocKeepIndices(&ret_keep_indices,
+                                          keep_indices.size());
+        memcpy(ret_keep_indices, keep_indices.data(),
+               keep_indices.size() * sizeof(int64_t));
+    }
+};
+
+#define REG_KB(type)                                            \
+    REGISTER_KERNEL_BUILDER(Name("Open3DBatchedNms")            \
+                                    .Device(DEVICE_CPU)         \
+                                    .TypeConstraint<type>("T"), \
+                            BatchedNmsOpKernelCPU);
+REG_KB(float)
+#undef REG_KB
@@ -59,3 +59,52 @@ public:
             NmsOpKernelCUDA);
 REG_KB(float)
 #undef REG_KB
+
+class BatchedNmsOpKernelCUDA : public BatchedNmsOpKernel {
+public:
+    explicit BatchedNmsOpKernelCUDA(OpKernelConstruction* construction)
+        : BatchedNmsOpKernel(construction) {}
+
+    void Kernel(tensorflow::OpKernelContext* context,
+                const tensorflow::Tensor& boxes,
+                const tensorflow::Tensor& scores,
+                const tensorflow::Tensor& labels,
+                const tensorflow::Tensor& row_splits) {
+        // row_splits is in host memory and the kernel expects it on the
+        // device.
+        Tensor row_splits_device;
+        OP_REQUIRES_OK(context,
+                       context->allocate_temp(DT_INT64, row_splits.shape(),
+                                              &row_splits_device));
+        OPEN3D_CUDA_CHECK(cudaMemcpy(
+                row_splits_device.flat<int64>().data(),
+                row_splits.flat<int64>().data(),
+                row_splits.NumElements() * sizeof(int64_t),
+                cudaMemcpyHostToDevice));
+
+        std::vector<int64_t> keep_indices =
+                open3d::ml::contrib::BatchedNmsCUDAKernel(
+                        boxes.flat<float>().data(), scores.flat<float>().data(),
+                        (const int64_t*)labels.flat<int64>().data(),
+                        (const int64_t*)row_splits_device.flat<int64>().data(),
+                        row_splits.dim_size(0) - 1, boxes.dim_size(0),
+                        this->nms_overlap_thresh, this->pre_nms_top_k);
+
+        OutputAllocator output_allocator(context);
+        int64_t* ret_keep_indices = nullptr;
+        output_allocator.AllocKeepIndices(&ret_keep_indices,
+                                          keep_indices.size());
+        OPEN3D_CUDA_CHECK(cudaMemcpy(ret_keep_indices, keep_indices.data(),
+                                     keep_indices.size() * sizeof(int64_t),
+                                     cudaMemcpyHostToDevice));
+    }
+};
+
+#define REG_KB(type)                                           \
+    REGISTER_KERNEL_BUILDER(Name("Open3DBatchedNms")           \
+                                    .Device(DEVICE_GPU)        \
+                                    .TypeConstraint<type>("T") \
+                                    .HostMemory("row_splits"), \
+                            BatchedNmsOpKernelCUDA);
+REG_KB(float)
+#undef REG_KB
@@ -89,5 +89,58 @@ protected:
     float nms_overlap_thresh;
 };
 
+// Base class with common code for the BatchedNms OpKernel implementations
+class BatchedNmsOpKernel : public tensorflow::OpKernel {
+public:
+    explicit BatchedNmsOpKernel(tensorflow::OpKernelConstruction* construction)
+        : OpKernel(construction) {
+        OP_REQUIRES_OK(construction,
+                       construction->GetAttr("nms_overlap_thresh",
+                                             &nms_overlap_thresh));
+        OP_REQUIRES_OK(construction, construction->GetAttr("pre_nms_top_k",
+                                                           &pre_nms_top_k));
+    }
+
+    void Compute(tensorflow::OpKernelContext* context) override {
+        using namespace tensorflow;
+        const Tensor& boxes = context->input(0);
+        const Tensor& scores = context->input(1);
+        const Tensor& labels = context->input(2);
+        const Tensor& row_splits = context->input(3);
+
+        {
+            using namespace open3d::ml::op_util;
+            Dim num_boxes("num_boxes");
+            Dim batch_size("batch_size");
+            Dim five(5, "five");
+            CHECK_SHAPE(context, boxes, num_boxes, five);
+            CHECK_SHAPE(context, scores, num_boxes);
+            CHECK_SHAPE(context, labels, num_boxes);
+            CHECK_SHAPE(context, row_splits, batch_size + 1);
+        }
+        const auto row_splits_flat = row_splits.flat<int64>();
+        OP_REQUIRES(context,
+                    row_splits_flat(0) == 0 &&
+                            row_splits_flat(row_splits.dim_size(0) - 1) ==
+                                    boxes.dim_size(0),
+                    errors::InvalidArgument(
+                            "row_splits must start with 0 and end with the "
+                            "number of boxes"));
+
+        Kernel(context, boxes, scores, labels, row_splits);
+    }
+
+    // Function with the device specific code
+    virtual void Kernel(tensorflow::OpKernelContext* context,
+                        const tensorflow::Tensor& boxes,
+                        const tensorflow::Tensor& scores,
+                        const tensorflow::Tensor& labels,
+                        const tensorflow::Tensor& row_splits) = 0;
+
+protected:
+    float nms_overlap_thresh;
+    int pre_nms_top_k;
+};
+
 }  // namespace nms_opkernel
 /// @endcond
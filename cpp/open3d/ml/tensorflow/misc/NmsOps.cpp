@@ -104,3 +104,89 @@ nms_overlap_thresh: float value between 0 and 1. When a high-score box is
 
 keep_indices: (M,) int64 tensor. The selected box indices.
 )doc");
+
+REGISTER_OP("Open3DBatchedNms")
+        .Attr("T: {float}")  // type for boxes and scores
+        .Attr("nms_overlap_thresh: float")
+        .Attr("pre_nms_top_k: int = -1")
+        .Input("boxes: T")
+        .Input("scores: T")
+        .Input("labels: int64")
+        .Input("row_splits: int64")
+        .Output("keep_indices: int64")
+        .SetShapeFn([](::tensorflow::shape_inference::InferenceContext* c) {
+            using namespace ::tensorflow::shape_inference;
+            using namespace open3d::ml::op_util;
+            ShapeHandle boxes, scores, labels, row_splits, keep_indices;
+
+            TF_RETURN_IF_ERROR(c->WithRank(c->input(0), 2, &boxes));
+            TF_RETURN_IF_ERROR(c->WithRank(c->input(1), 1, &scores));
+            TF_RETURN_IF_ERROR(c->WithRank(c->input(2), 1, &labels));
+            TF_RETURN_IF_ERROR(c->WithRank(c->input(3), 1, &row_splits));
+
+            Dim num_boxes("num_boxes");
+            Dim five(5, "five");
+            CHECK_SHAPE_HANDLE(c, boxes, num_boxes, five);
+            CHECK_SHAPE_HANDLE(c, scores, num_boxes);
+            CHECK_SHAPE_HANDLE(c, labels, num_boxes);
+
+            keep_indices = c->MakeShape({c->UnknownDim()});
+            c->set_output(0, keep_indices);
+            return Status::OK();
+        })
+        .Doc(R"doc(
+Performs class-aware non-maximum suppression for a batch of box sets.
+
+This function performs non-maximum suppression like :func:`nms` for all batch
+items and classes in one call. A box only suppresses boxes of the same batch
+item and with the same label.
+
+Minimal example::
+
+  import open3d.ml.tf as ml3d
+  import numpy as np
+
+  boxes = np.array([[15.0811, -7.9803, 15.6721, -6.8714, 0.5152],
+                    [15.1166, -7.9261, 15.7060, -6.8137, 0.6501],
+                    [15.1304, -7.8129, 15.7069, -6.8903, 0.7296],
+                    [15.2050, -7.8447, 15.8311, -6.7437, 1.0506],
+                    [15.1343, -7.8136, 15.7121, -6.8479, 1.0352],
+                    [15.0931, -7.9552, 15.6675, -7.0056, 0.5979]],
+                   dtype=np.float32)
+  scores = np.array([3, 1.1, 5, 2, 1, 0], dtype=np.float32)
+  labels = np.array([0, 0, 0, 1, 1, 0], dtype=np.int64)
+  row_splits = np.array([0, 4, 6], dtype=np.int64)
+  keep_indices = ml3d.ops.batched_nms(boxes, scores, labels, row_splits,
+                                      nms_overlap_thresh=0.7)
+  print(keep_indices)
+
+  # PyTorch example.
+  import torch
+  import open3d.ml.torch as ml3d
+
+  keep_indices = ml3d.ops.batched_nms(torch.from_numpy(boxes),
+                                      torch.from_numpy(scores),
+                                      torch.from_numpy(labels),
+                                      torch.from_numpy(row_splits),
+                                      nms_overlap_thresh=0.7)
+  print(keep_indices)
+
+nms_overlap_thresh: float value between 0 and 1. When a high-score box is
+  selected, other remaining boxes of the same batch item and label with
+  IoU > nms_overlap_thresh will be discarded.
+
+pre_nms_top_k: If positive, only the pre_nms_top_k highest scoring boxes of
+  each batch item and label are considered.
+
+boxes: (N, 5) float32 tensor. Bounding boxes are represented as (x0, y0, x1, y1, rotate).
+
+scores: (N,) float32 tensor. A higher score means a more confident bounding box.
+
+labels: (N,) int64 tensor with the non-negative class label of each box.
+
+row_splits: (B+1,) int64 tensor. Defines the start and end of each batch item
+  in boxes.
+
+keep_indices: (M,) int64 tensor. The selected box indices, ordered by batch
+  item, label and decreasing score.
+)doc");
@@ -58,7 +58,9 @@ public:
 
         cudaError_t err;
 
-        TrilinearDevoxelizeKernel<<<b, OptNumThreads(n), 0, stream>>>(
+        const int num_threads = OptNumThreads(n);
+        dim3 blocks(DIVUP(n, num_threads), b);
+        TrilinearDevoxelizeKernel<<<blocks, num_threads, 0, stream>>>(
                 b, c, n, r, r2, r3, training, coords, feat, inds, wgts, outs);
 
         err = cudaGetLastError();
@@ -92,8 +94,21 @@ public:
 
         cudaError_t err;
 
-        TrilinearDevoxelizeGradKernel<<<b, OptNumThreads(n), 0, stream>>>(
-                b, c, n, r3, inds, wgts, grad_y, grad_x);
+        // Temporary memory for sorting the (point, corner) entries by voxel.
+        Tensor voxel_keys, sorted_entries, voxel_offsets;
+        OP_REQUIRES_OK(context, context->allocate_temp(DT_INT32,
+                                                       TensorShape{b * 8 * n},
+                                                       &voxel_keys));
+        OP_REQUIRES_OK(context, context->allocate_temp(DT_INT32,
+                                                       TensorShape{b * 8 * n},
+                                                       &sorted_entries));
+        OP_REQUIRES_OK(context, context->allocate_temp(DT_INT32,
+                                                       TensorShape{b * r3 + 1},
+                                                       &voxel_offsets));
+        TrilinearDevoxelizeGradCUDA(stream, b, c, n, r3, inds, wgts, grad_y,
+                                    grad_x, voxel_keys.flat<int>().data(),
+                                    sorted_entries.flat<int>().data(),
+                                    voxel_offsets.flat<int>().data());
 
         err = cudaGetLastError();
         if (cudaSuccess != err) {
@@ -184,8 +184,13 @@ CreateVertexAndImageVisibility(
                 continue;
             }
             visibility_image_to_vertex[camera_id].push_back(vertex_id);
-#pragma omp critical(CreateVertexAndImageVisibility)
-            { visibility_vertex_to_image[vertex_id].push_back(camera_id); }
+        }
+    }
+    // Transposed serially, so the cameras of a vertex are in increasing order
+    // and the parallel loop above needs no critical section.
+    for (int camera_id = 0; camera_id < int(n_camera); camera_id++) {
+        for (int vertex_id : visibility_image_to_vertex[camera_id]) {
+            visibility_vertex_to_image[vertex_id].push_back(camera_id);
         }
     }
 
@@ -258,6 +263,7 @@ void SetGeometryColorAverage(
     mesh.vertex_colors_.resize(n_vertex);
     std::vector<size_t> valid_vertices;
     std::vector<size_t> invalid_vertices;
+    std::vector<uint8_t> is_valid_vertex(n_vertex, 0);
 #pragma omp parallel for schedule(static) \
         num_threads(utility::EstimateMaxThreads())
     for (int i = 0; i < (int)n_vertex; i++) {
@@ -291,14 +297,16 @@ void SetGeometryColorAverage(
                 sum += 1.0;
             }
         }
-#pragma omp critical(SetGeometryColorAverage)
-        {
-            if (sum > 0.0) {
-                mesh.vertex_colors_[i] /= sum;
-                valid_vertices.push_back(i);
-            } else {
-                invalid_vertices.push_back(i);
-            }
+        if (sum > 0.0) {
+            mesh.vertex_colors_[i] /= sum;
+            is_valid_vertex[i] = 1;
+        }
+    }
+    for (size_t i = 0; i < n_vertex; i++) {
+        if (is_valid_vertex[i]) {
+            valid_vertices.push_back(i);
+        } else {
+            invalid_vertices.push_back(i);
         }
     }
     if (invisible_vertex_color_knn > 0) {
@@ -32,6 +32,7 @@
 #include "open3d/pipelines/integration/MarchingCubesConst.h"
 #include "open3d/pipelines/integration/UniformTSDFVolume.h"
 #include "open3d/utility/Logging.h"
+#include "open3d/utility/Parallel.h"
 
 namespace open3d {
 namespace pipelines {
@@ -93,6 +94,7 @@ void ScalableTSDFVolume::Integrate(
             depth_sampling_stride_);
     std::unordered_set<Eigen::Vector3i, utility::hash_eigen<Eigen::Vector3i>>
             touched_volume_units_;
+    std::vector<std::shared_ptr<UniformTSDFVolume>> touched_volumes;
     for (const auto &point : pointcloud->points_) {
         auto min_bound = LocateVolumeUnit(
                 point - Eigen::Vector3d(sdf_trunc_, sdf_trunc_, sdf_trunc_));
@@ -105,35 +107,46 @@ void ScalableTSDFVolume::Integrate(
                     if (touched_volume_units_.find(loc) ==
                         touched_volume_units_.end()) {
                         touched_volume_units_.insert(loc);
-                        auto volume = OpenVolumeUnit(Eigen::Vector3i(x, y, z));
-                        volume->IntegrateWithDepthToCameraDistanceMultiplier(
-                                image, intrinsic, extrinsic,
-                                *depth2cameradistance);
+                        touched_volumes.push_back(OpenVolumeUnit(loc));
                     }
                 }
             }
         }
     }
+
+    // Volume units are independent, so they are integrated in parallel. The
+    // parallel loops within each unit run serially inside this region.
+#pragma omp parallel for schedule(dynamic) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int i = 0; i < int(touched_volumes.size()); i++) {
+        touched_volumes[i]->IntegrateWithDepthToCameraDistanceMultiplier(
+                image, intrinsic, extrinsic, *depth2cameradistance);
+    }
 }
 
 std::shared_ptr<geometry::PointCloud> ScalableTSDFVolume::ExtractPointCloud() {
-    auto pointcloud = std::make_shared<geometry::PointCloud>();
+    std::vector<const VolumeUnit *> units = GetVolumeUnits();
     double half_voxel_length = voxel_length_ * 0.5;
-    float w0, w1, f0, f1;
-    Eigen::Vector3f c0, c1;
-    for (const auto &unit : volume_units_) {
-        if (unit.second.volume_) {
-            const auto &volume0 = *unit.second.volume_;
-            const auto &index0 = unit.second.index_;
+    // Points of each volume unit, concatenated in order at the end.
+    std::vector<geometry::PointCloud> unit_pointclouds(units.size());
+#pragma omp parallel for schedule(dynamic) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int u = 0; u < int(units.size()); u++) {
+        geometry::PointCloud &unit_pointcloud = unit_pointclouds[u];
+        float w0, w1, f0, f1;
+        Eigen::Vector3f c0, c1;
+        if (units[u]->volume_) {
+            const auto &volume0 = *units[u]->volume_;
+            const auto &index0 = units[u]->index_;
             for (int x = 0; x < volume0.resolution_; x++) {
                 for (int y = 0; y < volume0.resolution_; y++) {
                     for (int z = 0; z < volume0.resolution_; z++) {
                         Eigen::Vector3i idx0(x, y, z);
-                        w0 = volume0.voxels_[volume0.IndexOf(idx0)].weight_;
-                        f0 = volume0.voxels_[volume0.IndexOf(idx0)].tsdf_;
+                        w0 = volume0.weight_[volume0.IndexOf(idx0)];
+                        f0 = volume0.tsdf_[volume0.IndexOf(idx0)];
                         if (color_type_ != TSDFVolumeColorType::NoColor)
-                            c0 = volume0.voxels_[volume0.IndexOf(idx0)]
-                                         .color_.cast<float>();
+                            c0 = volume0.GetVoxelColor(volume0.IndexOf(idx0))
+                                         .cast<float>();
                         if (w0 != 0.0f && f0 < 0.98f && f0 >= -0.98f) {
                             Eigen::Vector3d p0 =
                                     Eigen::Vector3d(half_voxel_length +
@@ -150,15 +163,14 @@ std::shared_ptr<geometry::PointCloud> ScalableTSDFVolume::ExtractPointCloud() {
                                 p1(i) += voxel_length_;
                                 idx1(i) += 1;
                                 if (idx1(i) < volume0.resolution_) {
-                                    w1 = volume0.voxels_[volume0.IndexOf(idx1)]
-                                                 .weight_;
-                                    f1 = volume0.voxels_[volume0.IndexOf(idx1)]
-                                                 .tsdf_;
+                                    w1 = volume0.weight_[volume0.IndexOf(idx1)];
+                                    f1 = volume0.tsdf_[volume0.IndexOf(idx1)];
                                     if (color_type_ !=
                                         TSDFVolumeColorType::NoColor)
-                                        c1 = volume0.voxels_[volume0.IndexOf(
-                                                                     idx1)]
-                                                     .color_.cast<float>();
+                                        c1 = volume0.GetVoxelColor(
+                                                            volume0.IndexOf(
+                                                                    idx1))
+                                                     .cast<float>();
                                 } else {
                                     idx1(i) -= volume0.resolution_;
                                     index1(i) += 1;
@@ -169,18 +181,16 @@ std::shared_ptr<geometry::PointCloud> ScalableTSDFVolume::ExtractPointCloud() {
                                     } else {
                                         const auto &volume1 =
                                                 *unit_itr->second.volume_;
-                                        w1 = volume1.voxels_[volume1.IndexOf(
-                                                                     idx1)]
-                                                     .weight_;
-                                        f1 = volume1.voxels_[volume1.IndexOf(
-                                                                     idx1)]
-                                                     .tsdf_;
+                                        w1 = volume1.weight_[volume1.IndexOf(
+                                                idx1)];
+                                        f1 = volume1.tsdf_[volume1.IndexOf(
+                                                idx1)];
                                         if (color_type_ !=
                                             TSDFVolumeColorType::NoColor)
-                                            c1 = volume1.voxels_
-                                                         [volume1.IndexOf(idx1)]
-                                                                 .color_
-                                                                 .cast<float>();
+                                            c1 = volume1.GetVoxelColor(
+                                                                volume1.IndexOf(
+                                                                        idx1))
+                                                         .cast<float>();
                                     }
                                 }
                                 if (w1 != 0.0f && f1 < 0.98f && f1 >= -0.98f &&
@@ -190,22 +200,22 @@ std::shared_ptr<geometry::PointCloud> ScalableTSDFVolume::ExtractPointCloud() {
                                     Eigen::Vector3d p = p0;
                                     p(i) = (p0(i) * r1 + p1(i) * r0) /
                                            (r0 + r1);
-                                    pointcloud->points_.push_back(p);
+                                    unit_pointcloud.points_.push_back(p);
                                     if (color_type_ ==
                                         TSDFVolumeColorType::RGB8) {
-                                        pointcloud->colors_.push_back(
+                                        unit_pointcloud.colors_.push_back(
                                                 ((c0 * r1 + c1 * r0) /
                                                  (r0 + r1) / 255.0f)
                                                         .cast<double>());
                                     } else if (color_type_ ==
                                                TSDFVolumeColorType::Gray32) {
-                                        pointcloud->colors_.push_back(
+                                        unit_pointcloud.colors_.push_back(
                                                 ((c0 * r1 + c1 * r0) /
                                                  (r0 + r1))
                                                         .cast<double>());
                                     }
                                     // has_normal
-                                    pointcloud->normals_.push_back(
+                                    unit_pointcloud.normals_.push_back(
                                             GetNormalAt(p));
                                 }
                             }
@@ -215,6 +225,11 @@ std::shared_ptr<geometry::PointCloud> ScalableTSDFVolume::ExtractPointCloud() {
             }
         }
     }
+
+    auto pointcloud = std::make_shared<geometry::PointCloud>();
+    for (const auto &unit_pointcloud : unit_pointclouds) {
+        *pointcloud += unit_pointcloud;
+    }
     return pointcloud;
 }
 
@@ -222,18 +237,28 @@ std::shared_ptr<geometry::TriangleMesh>
 ScalableTSDFVolume::ExtractTriangleMesh() {
     // implementation of marching cubes, based on
     // http://paulbourke.net/geometry/polygonise/
-    auto mesh = std::make_shared<geometry::TriangleMesh>();
-    double half_voxel_length = voxel_length_ * 0.5;
-    std::unordered_map<
+    using EdgeIndexToVertexIndex = std::unordered_map<
             Eigen::Vector4i, int, utility::hash_eigen<Eigen::Vector4i>,
             std::equal_to<Eigen::Vector4i>,
-            Eigen::aligned_allocator<std::pair<const Eigen::Vector4i, int>>>
-            edgeindex_to_vertexindex;
-    int edge_to_index[12];
-    for (const auto &unit : volume_units_) {
-        if (unit.second.volume_) {
-            const auto &volume0 = *unit.second.volume_;
-            const auto &index0 = unit.second.index_;
+            Eigen::aligned_allocator<std::pair<const Eigen::Vector4i, int>>>;
+    std::vector<const VolumeUnit *> units = GetVolumeUnits();
+    double half_voxel_length = voxel_length_ * 0.5;
+    // Meshes of each volume unit, with the edges of their vertices. They are
+    // merged in order at the end, where the vertices on the boundaries of the
+    // volume units are shared.
+    std::vector<geometry::TriangleMesh> unit_meshes(units.size());
+    std::vector<std::vector<Eigen::Vector4i,
+                            Eigen::aligned_allocator<Eigen::Vector4i>>>
+            unit_edge_indices(units.size());
+#pragma omp parallel for schedule(dynamic) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int u = 0; u < int(units.size()); u++) {
+        geometry::TriangleMesh &unit_mesh = unit_meshes[u];
+        EdgeIndexToVertexIndex edgeindex_to_vertexindex;
+        int edge_to_index[12];
+        if (units[u]->volume_) {
+            const auto &volume0 = *units[u]->volume_;
+            const auto &index0 = units[u]->index_;
             for (int x = 0; x < volume0.resolution_; x++) {
                 for (int y = 0; y < volume0.resolution_; y++) {
                     for (int z = 0; z < volume0.resolution_; z++) {
@@ -248,20 +273,16 @@ ScalableTSDFVolume::ExtractTriangleMesh() {
                             if (idx1(0) < volume_unit_resolution_ &&
                                 idx1(1) < volume_unit_resolution_ &&
                                 idx1(2) < volume_unit_resolution_) {
-                                w[i] = volume0.voxels_[volume0.IndexOf(idx1)]
-                                               .weight_;
-                                f[i] = volume0.voxels_[volume0.IndexOf(idx1)]
-                                               .tsdf_;
+                                w[i] = volume0.weight_[volume0.IndexOf(idx1)];
+                                f[i] = volume0.tsdf_[volume0.IndexOf(idx1)];
                                 if (color_type_ == TSDFVolumeColorType::RGB8)
-                                    c[i] = volume0.voxels_[volume0.IndexOf(
-                                                                   idx1)]
-                                                   .color_.cast<double>() /
+                                    c[i] = volume0.GetVoxelColor(
+                                                   volume0.IndexOf(idx1)) /
                                            255.0;
                                 else if (color_type_ ==
                                          TSDFVolumeColorType::Gray32)
-                                    c[i] = volume0.voxels_[volume0.IndexOf(
-                                                                   idx1)]
-                                                   .color_.cast<double>();
+                                    c[i] = volume0.GetVoxelColor(
+                                            volume0.IndexOf(idx1));
                             } else {
                                 for (int j = 0; j < 3; j++) {
                                     if (idx1(j) >= volume_unit_resolution_) {
@@ -276,23 +297,19 @@ ScalableTSDFVolume::ExtractTriangleMesh() {
                                 } else {
                                     const auto &volume1 =
                                             *unit_itr1->second.volume_;
-                                    w[i] = volume1.voxels_[volume1.IndexOf(
-                                                                   idx1)]
-                                                   .weight_;
-                                    f[i] = volume1.voxels_[volume1.IndexOf(
-                                                                   idx1)]
-                                                   .tsdf_;
+                                    w[i] = volume1.weight_[volume1.IndexOf(
+                                            idx1)];
+                                    f[i] = volume1.tsdf_[volume1.IndexOf(
+                                            idx1)];
                                     if (color_type_ ==
                                         TSDFVolumeColorType::RGB8)
-                                        c[i] = volume1.voxels_[volume1.IndexOf(
-                                                                       idx1)]
-                                                       .color_.cast<double>() /
+                                        c[i] = volume1.GetVoxelColor(
+                                                       volume1.IndexOf(idx1)) /
                                                255.0;
                                     else if (color_type_ ==
                                              TSDFVolumeColorType::Gray32)
-                                        c[i] = volume1.voxels_[volume1.IndexOf(
-                                                                       idx1)]
-                                                       .color_.cast<double>();
+                                        c[i] = volume1.GetVoxelColor(
+                                                volume1.IndexOf(idx1));
                                 }
                             }
                             if (w[i] == 0.0f) {
@@ -318,9 +335,9 @@ ScalableTSDFVolume::ExtractTriangleMesh() {
                                 if (edgeindex_to_vertexindex.find(edge_index) ==
                                     edgeindex_to_vertexindex.end()) {
                                     edge_to_index[i] =
-                                            (int)mesh->vertices_.size();
+                                            (int)unit_mesh.vertices_.size();
                                     edgeindex_to_vertexindex[edge_index] =
-                                            (int)mesh->vertices_.size();
+                                            (int)unit_mesh.vertices_.size();
                                     Eigen::Vector3d pt(
                                             half_voxel_length +
                                                     voxel_length_ *
@@ -337,12 +354,14 @@ ScalableTSDFVolume::ExtractTriangleMesh() {
                                             (double)f[edge_to_vert[i][1]]);
                                     pt(edge_index(3)) +=
                                             f0 * voxel_length_ / (f0 + f1);
-                                    mesh->vertices_.push_back(pt);
+                                    unit_mesh.vertices_.push_back(pt);
+                                    unit_edge_indices[u].push_back(
+                                            edge_index);
                                     if (color_type_ !=
                                         TSDFVolumeColorType::NoColor) {
                                         const auto &c0 = c[edge_to_vert[i][0]];
                                         const auto &c1 = c[edge_to_vert[i][1]];
-                                        mesh->vertex_colors_.push_back(
+                                        unit_mesh.vertex_colors_.push_back(
                                                 (f1 * c0 + f0 * c1) /
                                                 (f0 + f1));
                                     }
@@ -354,7 +373,7 @@ ScalableTSDFVolume::ExtractTriangleMesh() {
                         }
                         for (int i = 0; tri_table[cube_index][i] != -1;
                              i += 3) {
-                            mesh->triangles_.push_back(Eigen::Vector3i(
+                            unit_mesh.triangles_.push_back(Eigen::Vector3i(
                                     edge_to_index[tri_table[cube_index][i]],
                                     edge_to_index[tri_table[cube_index][i + 2]],
                                     edge_to_index[tri_table[cube_index]
@@ -365,6 +384,34 @@ ScalableTSDFVolume::ExtractTriangleMesh() {
             }
         }
     }
+
+    auto mesh = std::make_shared<geometry::TriangleMesh>();
+    EdgeIndexToVertexIndex edgeindex_to_vertexindex;
+    std::vector<int> vertex_map;
+    for (size_t u = 0; u < units.size(); u++) {
+        const auto &unit_mesh = unit_meshes[u];
+        vertex_map.resize(unit_mesh.vertices_.size());
+        for (size_t i = 0; i < unit_mesh.vertices_.size(); i++) {
+            const Eigen::Vector4i &edge_index = unit_edge_indices[u][i];
+            auto itr = edgeindex_to_vertexindex.find(edge_index);
+            if (itr != edgeindex_to_vertexindex.end()) {
+                vertex_map[i] = itr->second;
+                continue;
+            }
+            vertex_map[i] = (int)mesh->vertices_.size();
+            edgeindex_to_vertexindex[edge_index] = vertex_map[i];
+            mesh->vertices_.push_back(unit_mesh.vertices_[i]);
+            if (color_type_ != TSDFVolumeColorType::NoColor) {
+                mesh->vertex_colors_.push_back(unit_mesh.vertex_colors_[i]);
+            }
+        }
+        for (const auto &triangle : unit_mesh.triangles_) {
+            mesh->triangles_.push_back(
+                    Eigen::Vector3i(vertex_map[triangle(0)],
+                                    vertex_map[triangle(1)],
+                                    vertex_map[triangle(2)]));
+        }
+    }
     return mesh;
 }
 
@@ -380,6 +427,16 @@ ScalableTSDFVolume::ExtractVoxelPointCloud() {
     return voxel;
 }
 
+std::vector<const ScalableTSDFVolume::VolumeUnit *>
+ScalableTSDFVolume::GetVolumeUnits() const {
+    std::vector<const VolumeUnit *> units;
+    units.reserve(volume_units_.size());
+    for (const auto &unit : volume_units_) {
+        units.push_back(&unit.second);
+    }
+    return units;
+}
+
 std::shared_ptr<UniformTSDFVolume> ScalableTSDFVolume::OpenVolumeUnit(
         const Eigen::Vector3i &index) {
     auto &unit = volume_units_[index];
@@ -432,7 +489,7 @@ double ScalableTSDFVolume::GetTSDFAt(const Eigen::Vector3d &p) {
         if (idx1(0) < volume_unit_resolution_ &&
             idx1(1) < volume_unit_resolution_ &&
             idx1(2) < volume_unit_resolution_) {
-            f[i] = volume0.voxels_[volume0.IndexOf(idx1)].tsdf_;
+            f[i] = volume0.tsdf_[volume0.IndexOf(idx1)];
         } else {
             for (int j = 0; j < 3; j++) {
                 if (idx1(j) >= volume_unit_resolution_) {
@@ -445,7 +502,7 @@ double ScalableTSDFVolume::GetTSDFAt(const Eigen::Vector3d &p) {
                 f[i] = 0.0f;
             } else {
                 const auto &volume1 = *unit_itr1->second.volume_;
-                f[i] = volume1.voxels_[volume1.IndexOf(idx1)].tsdf_;
+                f[i] = volume1.tsdf_[volume1.IndexOf(idx1)];
             }
         }
     }
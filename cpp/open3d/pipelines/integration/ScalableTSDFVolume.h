@@ -28,6 +28,7 @@
 
 #include <memory>
 #include <unordered_map>
+#include <vector>
 
 #include "open3d/pipelines/integration/TSDFVolume.h"
 #include "open3d/utility/Helper.h"
@@ -108,6 +109,9 @@ private:
     std::shared_ptr<UniformTSDFVolume> OpenVolumeUnit(
             const Eigen::Vector3i &index);
 
+    /// Volume units as a vector for parallel loops.
+    std::vector<const VolumeUnit *> GetVolumeUnits() const;
+
     Eigen::Vector3d GetNormalAt(const Eigen::Vector3d &p);
 
     double GetTSDFAt(const Eigen::Vector3d &p);
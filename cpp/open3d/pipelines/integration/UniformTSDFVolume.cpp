@@ -26,6 +26,7 @@
 
 #include "open3d/pipelines/integration/UniformTSDFVolume.h"
 
+#include <algorithm>
 #include <iostream>
 #include <thread>
 #include <unordered_map>
@@ -50,12 +51,37 @@ UniformTSDFVolume::UniformTSDFVolume(
       length_(length),
       resolution_(resolution),
       voxel_num_(resolution * resolution * resolution) {
-    voxels_.resize(voxel_num_);
+    tsdf_.resize(voxel_num_, 0.0f);
+    weight_.resize(voxel_num_, 0.0f);
+    if (color_type_ == TSDFVolumeColorType::RGB8) {
+        color_rgb_.resize(size_t(voxel_num_) * 3, 0);
+    } else if (color_type_ == TSDFVolumeColorType::Gray32) {
+        color_gray_.resize(voxel_num_, 0.0f);
+    }
 }
 
 UniformTSDFVolume::~UniformTSDFVolume() {}
 
-void UniformTSDFVolume::Reset() { voxels_.clear(); }
+constexpr double UniformTSDFVolume::kColorRGBScale;
+
+void UniformTSDFVolume::Reset() {
+    std::fill(tsdf_.begin(), tsdf_.end(), 0.0f);
+    std::fill(weight_.begin(), weight_.end(), 0.0f);
+    std::fill(color_rgb_.begin(), color_rgb_.end(), 0);
+    std::fill(color_gray_.begin(), color_gray_.end(), 0.0f);
+}
+
+void UniformTSDFVolume::SetVoxelColor(int index, const Eigen::Vector3d &color) {
+    if (color_type_ == TSDFVolumeColorType::RGB8) {
+        uint16_t *c = &color_rgb_[size_t(index) * 3];
+        for (int i = 0; i < 3; i++) {
+            c[i] = uint16_t(std::round(
+                    std::min(std::max(color(i), 0.0), 255.0) * kColorRGBScale));
+        }
+    } else if (color_type_ == TSDFVolumeColorType::Gray32) {
+        color_gray_[index] = float(color(0));
+    }
+}
 
 void UniformTSDFVolume::Integrate(
         const geometry::RGBDImage &image,
@@ -108,9 +134,9 @@ std::shared_ptr<geometry::PointCloud> UniformTSDFVolume::ExtractPointCloud() {
         for (int y = 1; y < resolution_ - 1; y++) {
             for (int z = 1; z < resolution_ - 1; z++) {
                 Eigen::Vector3i idx0(x, y, z);
-                float w0 = voxels_[IndexOf(idx0)].weight_;
-                float f0 = voxels_[IndexOf(idx0)].tsdf_;
-                const Eigen::Vector3d &c0 = voxels_[IndexOf(idx0)].color_;
+                float w0 = weight_[IndexOf(idx0)];
+                float f0 = tsdf_[IndexOf(idx0)];
+                const Eigen::Vector3d c0 = GetVoxelColor(IndexOf(idx0));
 
                 if (!(w0 != 0.0f && f0 < 0.98f && f0 >= -0.98f)) {
                     continue;
@@ -124,10 +150,9 @@ std::shared_ptr<geometry::PointCloud> UniformTSDFVolume::ExtractPointCloud() {
                     Eigen::Vector3i idx1 = idx0;
                     idx1(i) += 1;
                     if (idx1(i) < resolution_ - 1) {
-                        float w1 = voxels_[IndexOf(idx1)].weight_;
-                        float f1 = voxels_[IndexOf(idx1)].tsdf_;
-                        const Eigen::Vector3d &c1 =
-                                voxels_[IndexOf(idx1)].color_;
+                        float w1 = weight_[IndexOf(idx1)];
+                        float f1 = tsdf_[IndexOf(idx1)];
+                        const Eigen::Vector3d c1 = GetVoxelColor(IndexOf(idx1));
                         if (w1 != 0.0f && f1 < 0.98f && f1 >= -0.98f &&
                             f0 * f1 < 0) {
                             float r0 = std::fabs(f0);
@@ -179,19 +204,18 @@ UniformTSDFVolume::ExtractTriangleMesh() {
                 for (int i = 0; i < 8; i++) {
                     Eigen::Vector3i idx = Eigen::Vector3i(x, y, z) + shift[i];
 
-                    if (voxels_[IndexOf(idx)].weight_ == 0.0f) {
+                    if (weight_[IndexOf(idx)] == 0.0f) {
                         cube_index = 0;
                         break;
                     } else {
-                        f[i] = voxels_[IndexOf(idx)].tsdf_;
+                        f[i] = tsdf_[IndexOf(idx)];
                         if (f[i] < 0.0f) {
                             cube_index |= (1 << i);
                         }
                         if (color_type_ == TSDFVolumeColorType::RGB8) {
-                            c[i] = voxels_[IndexOf(idx)].color_.cast<double>() /
-                                   255.0;
+                            c[i] = GetVoxelColor(IndexOf(idx)) / 255.0;
                         } else if (color_type_ == TSDFVolumeColorType::Gray32) {
-                            c[i] = voxels_[IndexOf(idx)].color_.cast<double>();
+                            c[i] = GetVoxelColor(IndexOf(idx));
                         }
                     }
                 }
@@ -257,11 +281,10 @@ UniformTSDFVolume::ExtractVoxelPointCloud() const {
                                    half_voxel_length + voxel_length_ * y,
                                    half_voxel_length + voxel_length_ * z);
                 int ind = IndexOf(x, y, z);
-                if (voxels_[ind].weight_ != 0.0f &&
-                    voxels_[ind].tsdf_ < 0.98f &&
-                    voxels_[ind].tsdf_ >= -0.98f) {
+                if (weight_[ind] != 0.0f && tsdf_[ind] < 0.98f &&
+                    tsdf_[ind] >= -0.98f) {
                     voxel->points_.push_back(pt + origin_);
-                    double c = (voxels_[ind].tsdf_ + 1.0) * 0.5;
+                    double c = (tsdf_[ind] + 1.0) * 0.5;
                     voxel->colors_.push_back(Eigen::Vector3d(c, c, c));
                 }
             }
@@ -287,8 +310,8 @@ std::shared_ptr<geometry::VoxelGrid> UniformTSDFVolume::ExtractVoxelGrid()
         for (int y = 0; y < resolution_; y++) {
             for (int z = 0; z < resolution_; z++) {
                 const int ind = IndexOf(x, y, z);
-                const float w = voxels_[ind].weight_;
-                const float f = voxels_[ind].tsdf_;
+                const float w = weight_[ind];
+                const float f = tsdf_[ind];
                 if (w != 0.0f && f < 0.98f && f >= -0.98f) {
                     double c = (f + 1.0) * 0.5;
                     Eigen::Vector3d color = Eigen::Vector3d(c, c, c);
@@ -316,8 +339,8 @@ std::vector<Eigen::Vector2d> UniformTSDFVolume::ExtractVolumeTSDF() const {
         for (int y = 0; y < resolution_; y++) {
             for (int z = 0; z < resolution_; z++) {
                 const int ind = IndexOf(x, y, z);
-                const float f = voxels_[ind].tsdf_;
-                const float w = voxels_[ind].weight_;
+                const float f = tsdf_[ind];
+                const float w = weight_[ind];
                 sharedvoxels_[ind] = Eigen::Vector2d(f, w);
             }
         }
@@ -340,7 +363,7 @@ std::vector<Eigen::Vector3d> UniformTSDFVolume::ExtractVolumeColor() const {
         for (int y = 0; y < resolution_; y++) {
             for (int z = 0; z < resolution_; z++) {
                 const int ind = IndexOf(x, y, z);
-                sharedcolors_[ind] = voxels_[ind].color_;
+                sharedcolors_[ind] = GetVoxelColor(ind);
             }
         }
     }
@@ -360,8 +383,8 @@ void UniformTSDFVolume::InjectVolumeTSDF(
         for (int y = 0; y < resolution_; y++) {
             for (int z = 0; z < resolution_; z++) {
                 const int ind = IndexOf(x, y, z);
-                voxels_[ind].tsdf_ = sharedvoxels[ind](0);
-                voxels_[ind].weight_ = sharedvoxels[ind](1);
+                tsdf_[ind] = sharedvoxels[ind](0);
+                weight_[ind] = sharedvoxels[ind](1);
             }
         }
     }
@@ -380,7 +403,7 @@ void UniformTSDFVolume::InjectVolumeColor(
         for (int y = 0; y < resolution_; y++) {
             for (int z = 0; z < resolution_; z++) {
                 const int ind = IndexOf(x, y, z);
-                voxels_[ind].color_ = sharedcolors[ind];
+                SetVoxelColor(ind, sharedcolors[ind]);
             }
         }
     }
@@ -451,29 +474,26 @@ void UniformTSDFVolume::IntegrateWithDepthToCameraDistanceMultiplier(
                 if (sdf > -sdf_trunc_f) {
                     // integrate
                     float tsdf = std::min(1.0f, sdf * sdf_trunc_inv_f);
-                    voxels_[v_ind].tsdf_ =
-                            (voxels_[v_ind].tsdf_ * voxels_[v_ind].weight_ +
-                             tsdf) /
-                            (voxels_[v_ind].weight_ + 1.0f);
+                    const float w = weight_[v_ind];
+                    tsdf_[v_ind] = (tsdf_[v_ind] * w + tsdf) / (w + 1.0f);
                     if (color_type_ == TSDFVolumeColorType::RGB8) {
                         const uint8_t *rgb =
                                 image.color_.PointerAt<uint8_t>(u, v, 0);
-                        Eigen::Vector3d rgb_f(rgb[0], rgb[1], rgb[2]);
-                        voxels_[v_ind].color_ =
-                                (voxels_[v_ind].color_ *
-                                         voxels_[v_ind].weight_ +
-                                 rgb_f) /
-                                (voxels_[v_ind].weight_ + 1.0f);
+                        uint16_t *c = &color_rgb_[size_t(v_ind) * 3];
+                        for (int i = 0; i < 3; i++) {
+                            c[i] = uint16_t(
+                                    (c[i] * w + rgb[i] * kColorRGBScale) /
+                                            (w + 1.0f) +
+                                    0.5);
+                        }
                     } else if (color_type_ == TSDFVolumeColorType::Gray32) {
                         const float *intensity =
                                 image.color_.PointerAt<float>(u, v, 0);
-                        voxels_[v_ind].color_ =
-                                (voxels_[v_ind].color_.array() *
-                                         voxels_[v_ind].weight_ +
-                                 (*intensity)) /
-                                (voxels_[v_ind].weight_ + 1.0f);
+                        color_gray_[v_ind] =
+                                (color_gray_[v_ind] * w + (*intensity)) /
+                                (w + 1.0f);
                     }
-                    voxels_[v_ind].weight_ += 1.0f;
+                    weight_[v_ind] += 1.0f;
                 }
             }
         }
@@ -503,21 +523,21 @@ double UniformTSDFVolume::GetTSDFAt(const Eigen::Vector3d &p) {
 
     double tsdf = 0;
     tsdf += (1 - r(0)) * (1 - r(1)) * (1 - r(2)) *
-            voxels_[IndexOf(idx + Eigen::Vector3i(0, 0, 0))].tsdf_;
+            tsdf_[IndexOf(idx + Eigen::Vector3i(0, 0, 0))];
     tsdf += (1 - r(0)) * (1 - r(1)) * r(2) *
-            voxels_[IndexOf(idx + Eigen::Vector3i(0, 0, 1))].tsdf_;
+            tsdf_[IndexOf(idx + Eigen::Vector3i(0, 0, 1))];
     tsdf += (1 - r(0)) * r(1) * (1 - r(2)) *
-            voxels_[IndexOf(idx + Eigen::Vector3i(0, 1, 0))].tsdf_;
+            tsdf_[IndexOf(idx + Eigen::Vector3i(0, 1, 0))];
     tsdf += (1 - r(0)) * r(1) * r(2) *
-            voxels_[IndexOf(idx + Eigen::Vector3i(0, 1, 1))].tsdf_;
+            tsdf_[IndexOf(idx + Eigen::Vector3i(0, 1, 1))];
     tsdf += r(0) * (1 - r(1)) * (1 - r(2)) *
-            voxels_[IndexOf(idx + Eigen::Vector3i(1, 0, 0))].tsdf_;
+            tsdf_[IndexOf(idx + Eigen::Vector3i(1, 0, 0))];
     tsdf += r(0) * (1 - r(1)) * r(2) *
-            voxels_[IndexOf(idx + Eigen::Vector3i(1, 0, 1))].tsdf_;
+            tsdf_[IndexOf(idx + Eigen::Vector3i(1, 0, 1))];
     tsdf += r(0) * r(1) * (1 - r(2)) *
-            voxels_[IndexOf(idx + Eigen::Vector3i(1, 1, 0))].tsdf_;
+            tsdf_[IndexOf(idx + Eigen::Vector3i(1, 1, 0))];
     tsdf += r(0) * r(1) * r(2) *
-            voxels_[IndexOf(idx + Eigen::Vector3i(1, 1, 1))].tsdf_;
+            tsdf_[IndexOf(idx + Eigen::Vector3i(1, 1, 1))];
     return tsdf;
 }
 
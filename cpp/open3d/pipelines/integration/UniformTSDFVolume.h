@@ -55,6 +55,11 @@ namespace integration {
 ///
 /// \brief UniformTSDFVolume implements the classic TSDF volume with uniform
 /// voxel grid (Curless and Levoy 1996).
+///
+/// Voxels are stored as structure-of-arrays indexed by IndexOf(): a float TSDF
+/// value and weight per voxel, plus 3 x uint16 (8.8 fixed point) for RGB8 or
+/// one float for Gray32. This takes 8, 14 or 12 bytes per voxel for NoColor,
+/// RGB8 and Gray32 volumes respectively.
 class UniformTSDFVolume : public TSDFVolume {
 public:
     UniformTSDFVolume(double length,
@@ -101,8 +106,35 @@ public:
         return IndexOf(xyz(0), xyz(1), xyz(2));
     }
 
+    /// Color of voxel \p index in [0, 255] for RGB8 and as (intensity,
+    /// intensity, intensity) for Gray32. Returns zero for NoColor volumes.
+    inline Eigen::Vector3d GetVoxelColor(int index) const {
+        if (color_type_ == TSDFVolumeColorType::RGB8) {
+            const uint16_t *c = &color_rgb_[size_t(index) * 3];
+            return Eigen::Vector3d(c[0], c[1], c[2]) / kColorRGBScale;
+        } else if (color_type_ == TSDFVolumeColorType::Gray32) {
+            return Eigen::Vector3d::Constant(color_gray_[index]);
+        }
+        return Eigen::Vector3d::Zero();
+    }
+
+    /// Sets the color of voxel \p index, see GetVoxelColor(). RGB8 colors are
+    /// clamped to [0, 255] and Gray32 uses the first channel.
+    void SetVoxelColor(int index, const Eigen::Vector3d &color);
+
 public:
-    std::vector<geometry::TSDFVoxel> voxels_;
+    /// Fixed point scale of color_rgb_.
+    static constexpr double kColorRGBScale = 256.0;
+
+    /// TSDF value of each voxel.
+    std::vector<float> tsdf_;
+    /// Integration weight of each voxel, zero for unobserved voxels.
+    std::vector<float> weight_;
+    /// RGB color of each voxel in 8.8 fixed point, three values per voxel.
+    /// Only allocated for TSDFVolumeColorType::RGB8.
+    std::vector<uint16_t> color_rgb_;
+    /// Intensity of each voxel. Only allocated for TSDFVolumeColorType::Gray32.
+    std::vector<float> color_gray_;
     Eigen::Vector3d origin_;
     /// Total length, where voxel_length = length / resolution.
     double length_;
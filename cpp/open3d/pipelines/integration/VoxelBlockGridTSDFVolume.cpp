@@ -0,0 +1,164 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/pipelines/integration/VoxelBlockGridTSDFVolume.h"
+
+#include "open3d/core/CUDAUtils.h"
+#include "open3d/core/EigenConverter.h"
+#include "open3d/core/TensorFunction.h"
+#include "open3d/t/geometry/Image.h"
+#include "open3d/t/geometry/PointCloud.h"
+#include "open3d/t/geometry/TriangleMesh.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace pipelines {
+namespace integration {
+
+VoxelBlockGridTSDFVolume::VoxelBlockGridTSDFVolume(
+        double voxel_length,
+        double sdf_trunc,
+        TSDFVolumeColorType color_type,
+        const core::Device &device,
+        int block_resolution /* = 16*/,
+        int block_count /* = 10000*/,
+        double depth_max /* = 1000.0*/)
+    : TSDFVolume(voxel_length, sdf_trunc, color_type),
+      device_(device),
+      block_resolution_(block_resolution),
+      block_count_(block_count),
+      depth_max_(depth_max) {
+    if (voxel_length <= 0.0 || sdf_trunc <= 0.0) {
+        utility::LogError(
+                "Voxel length ({}) and SDF truncation ({}) must be positive.",
+                voxel_length, sdf_trunc);
+    }
+    Reset();
+}
+
+core::Device VoxelBlockGridTSDFVolume::GetDefaultDevice() {
+    return core::cuda::IsAvailable() ? core::Device("CUDA:0")
+                                     : core::Device("CPU:0");
+}
+
+void VoxelBlockGridTSDFVolume::Reset() {
+    if (color_type_ == TSDFVolumeColorType::NoColor) {
+        voxel_grid_ = t::geometry::VoxelBlockGrid(
+                {"tsdf", "weight"}, {core::Float32, core::Float32}, {{1}, {1}},
+                float(voxel_length_), block_resolution_, block_count_, device_);
+    } else {
+        voxel_grid_ = t::geometry::VoxelBlockGrid(
+                {"tsdf", "weight", "color"},
+                {core::Float32, core::Float32, core::Float32},
+                {{1}, {1}, {3}}, float(voxel_length_), block_resolution_,
+                block_count_, device_);
+    }
+}
+
+void VoxelBlockGridTSDFVolume::Integrate(
+        const geometry::RGBDImage &image,
+        const camera::PinholeCameraIntrinsic &intrinsic,
+        const Eigen::Matrix4d &extrinsic) {
+    if ((image.depth_.num_of_channels_ != 1) ||
+        (image.depth_.bytes_per_channel_ != 4) ||
+        (color_type_ == TSDFVolumeColorType::RGB8 &&
+         image.color_.num_of_channels_ != 3) ||
+        (color_type_ == TSDFVolumeColorType::RGB8 &&
+         image.color_.bytes_per_channel_ != 1) ||
+        (color_type_ == TSDFVolumeColorType::Gray32 &&
+         image.color_.num_of_channels_ != 1) ||
+        (color_type_ == TSDFVolumeColorType::Gray32 &&
+         image.color_.bytes_per_channel_ != 4)) {
+        utility::LogError("Unsupported image format.");
+    }
+    if ((image.depth_.width_ != intrinsic.width_) ||
+        (image.depth_.height_ != intrinsic.height_)) {
+        utility::LogError(
+                "Depth image size is ({} x {}), but got ({} x {}) from "
+                "intrinsic.",
+                image.depth_.width_, image.depth_.height_, intrinsic.width_,
+                intrinsic.height_);
+    }
+    if (color_type_ != TSDFVolumeColorType::NoColor &&
+        (image.color_.width_ != intrinsic.width_ ||
+         image.color_.height_ != intrinsic.height_)) {
+        utility::LogError(
+                "Color image size is ({} x {}), but got ({} x {}) from "
+                "intrinsic.",
+                image.color_.width_, image.color_.height_, intrinsic.width_,
+                intrinsic.height_);
+    }
+
+    // Legacy depth images are Float32 in meters.
+    const float depth_scale = 1.0f;
+    const float trunc_voxel_multiplier = float(sdf_trunc_ / voxel_length_);
+    const core::Tensor intrinsic_t =
+            core::eigen_converter::EigenMatrixToTensor(
+                    intrinsic.intrinsic_matrix_);
+    const core::Tensor extrinsic_t =
+            core::eigen_converter::EigenMatrixToTensor(extrinsic);
+    const t::geometry::Image depth =
+            t::geometry::Image::FromLegacy(image.depth_, device_);
+
+    const core::Tensor block_coords = voxel_grid_.GetUniqueBlockCoordinates(
+            depth, intrinsic_t, extrinsic_t, depth_scale, float(depth_max_),
+            trunc_voxel_multiplier);
+    if (color_type_ == TSDFVolumeColorType::NoColor) {
+        voxel_grid_.Integrate(block_coords, depth, intrinsic_t, extrinsic_t,
+                              depth_scale, float(depth_max_),
+                              trunc_voxel_multiplier);
+        return;
+    }
+
+    t::geometry::Image color =
+            t::geometry::Image::FromLegacy(image.color_, device_);
+    // The built-in kernels expect Float32 color in [0, 1] with Float32 depth.
+    if (color_type_ == TSDFVolumeColorType::Gray32) {
+        const core::Tensor gray = color.AsTensor();
+        color = t::geometry::Image(core::Concatenate({gray, gray, gray}, 2));
+    } else {
+        color = color.To(core::Float32, false, 1.0 / 255.0);
+    }
+    voxel_grid_.Integrate(block_coords, depth, color, intrinsic_t, extrinsic_t,
+                          depth_scale, float(depth_max_),
+                          trunc_voxel_multiplier);
+}
+
+std::shared_ptr<geometry::PointCloud>
+VoxelBlockGridTSDFVolume::ExtractPointCloud() {
+    return std::make_shared<geometry::PointCloud>(
+            voxel_grid_.ExtractPointCloud(weight_threshold_).ToLegacy());
+}
+
+std::shared_ptr<geometry::TriangleMesh>
+VoxelBlockGridTSDFVolume::ExtractTriangleMesh() {
+    return std::make_shared<geometry::TriangleMesh>(
+            voxel_grid_.ExtractTriangleMesh(weight_threshold_).ToLegacy());
+}
+
+}  // namespace integration
+}  // namespace pipelines
+}  // namespace open3d
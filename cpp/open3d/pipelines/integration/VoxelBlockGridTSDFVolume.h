@@ -0,0 +1,104 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <memory>
+
+#include "open3d/core/Device.h"
+#include "open3d/pipelines/integration/TSDFVolume.h"
+#include "open3d/t/geometry/VoxelBlockGrid.h"
+
+namespace open3d {
+namespace pipelines {
+namespace integration {
+
+/// \class VoxelBlockGridTSDFVolume
+///
+/// \brief Legacy TSDFVolume interface backed by a t::geometry::VoxelBlockGrid.
+///
+/// A drop-in replacement for ScalableTSDFVolume that keeps the legacy
+/// Integrate, ExtractPointCloud and ExtractTriangleMesh calls, while the voxel
+/// blocks live in a device hash map, so that integration and extraction run
+/// on the GPU when the volume is created on a CUDA device. RGB-D images and
+/// camera parameters are converted at each call, and the extracted geometry is
+/// copied back into legacy geometry.
+///
+/// Voxels are stored with Float32 tsdf, weight and color attributes. Gray32
+/// color is integrated as an RGB color with three equal channels.
+class VoxelBlockGridTSDFVolume : public TSDFVolume {
+public:
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param voxel_length Length of the voxel in meters.
+    /// \param sdf_trunc Truncation value for signed distance function (SDF).
+    /// \param color_type Color type of the TSDF volume.
+    /// \param device Device holding the voxel blocks.
+    /// \param block_resolution Number of voxels along each side of a block.
+    /// \param block_count Initial capacity of the block hash map, which grows
+    /// on demand.
+    /// \param depth_max Depth beyond which pixels are ignored, in meters.
+    /// Legacy RGB-D images are already truncated when they are created.
+    VoxelBlockGridTSDFVolume(double voxel_length,
+                             double sdf_trunc,
+                             TSDFVolumeColorType color_type,
+                             const core::Device &device = GetDefaultDevice(),
+                             int block_resolution = 16,
+                             int block_count = 10000,
+                             double depth_max = 1000.0);
+    ~VoxelBlockGridTSDFVolume() override {}
+
+public:
+    void Reset() override;
+    void Integrate(const geometry::RGBDImage &image,
+                   const camera::PinholeCameraIntrinsic &intrinsic,
+                   const Eigen::Matrix4d &extrinsic) override;
+    std::shared_ptr<geometry::PointCloud> ExtractPointCloud() override;
+    std::shared_ptr<geometry::TriangleMesh> ExtractTriangleMesh() override;
+
+    /// Returns the underlying voxel block grid.
+    t::geometry::VoxelBlockGrid &GetVoxelBlockGrid() { return voxel_grid_; }
+
+    /// Returns CUDA:0 when it is available, and CPU:0 otherwise.
+    static core::Device GetDefaultDevice();
+
+public:
+    core::Device device_;
+    int block_resolution_;
+    int block_count_;
+    double depth_max_;
+    /// Voxels with a weight at or below this threshold are not extracted. The
+    /// default of 0 matches the legacy volumes, which extract every observed
+    /// voxel.
+    float weight_threshold_ = 0.0f;
+
+private:
+    t::geometry::VoxelBlockGrid voxel_grid_;
+};
+
+}  // namespace integration
+}  // namespace pipelines
+}  // namespace open3d
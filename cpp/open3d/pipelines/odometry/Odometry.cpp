@@ -28,11 +28,13 @@
 
 #include <Eigen/Dense>
 #include <memory>
+#include <tuple>
 
 #include "open3d/geometry/Image.h"
 #include "open3d/geometry/RGBDImage.h"
 #include "open3d/pipelines/odometry/RGBDOdometryJacobian.h"
 #include "open3d/utility/Eigen.h"
+#include "open3d/utility/Parallel.h"
 #include "open3d/utility/Timer.h"
 
 namespace open3d {
@@ -284,9 +286,11 @@ static Eigen::Matrix6d CreateInformationMatrix(
     return GTG;
 }
 
-static void NormalizeIntensity(
-        geometry::Image &image_s,
-        geometry::Image &image_t,
+/// Returns the scales that normalize the mean intensity of the
+/// corresponding pixels of \p image_s and \p image_t to 0.5.
+static std::tuple<double, double> ComputeIntensityScales(
+        const geometry::Image &image_s,
+        const geometry::Image &image_t,
         const CorrespondenceSetPixelWise &correspondence) {
     if (image_s.width_ != image_t.width_ ||
         image_s.height_ != image_t.height_) {
@@ -303,8 +307,18 @@ static void NormalizeIntensity(
     }
     mean_s /= (double)correspondence.size();
     mean_t /= (double)correspondence.size();
-    image_s.LinearTransform(0.5 / mean_s, 0.0);
-    image_t.LinearTransform(0.5 / mean_t, 0.0);
+    return std::make_tuple(0.5 / mean_s, 0.5 / mean_t);
+}
+
+static void NormalizeIntensity(
+        geometry::Image &image_s,
+        geometry::Image &image_t,
+        const CorrespondenceSetPixelWise &correspondence) {
+    double scale_s, scale_t;
+    std::tie(scale_s, scale_t) =
+            ComputeIntensityScales(image_s, image_t, correspondence);
+    image_s.LinearTransform(scale_s, 0.0);
+    image_t.LinearTransform(scale_t, 0.0);
 }
 
 static inline std::shared_ptr<geometry::RGBDImage> PackRGBDImage(
@@ -373,6 +387,22 @@ static inline bool CheckRGBDImagePair(const geometry::RGBDImage &source,
     return false;
 }
 
+/// Returns the smoothed float intensity and the smoothed depth in the valid
+/// range of \p image, before the intensity normalization.
+static std::shared_ptr<geometry::RGBDImage> PreprocessRGBDImage(
+        const geometry::RGBDImage &image, const OdometryOption &option) {
+    std::shared_ptr<geometry::Image> color;
+    if (IsColorImageRGB(image.color_)) {
+        color = image.color_.CreateFloatImage();
+    } else {
+        color = std::make_shared<geometry::Image>(image.color_);
+    }
+    auto gray = color->Filter(geometry::Image::FilterType::Gaussian3);
+    auto depth = PreprocessDepth(image.depth_, option)
+                         ->Filter(geometry::Image::FilterType::Gaussian3);
+    return PackRGBDImage(*gray, *depth);
+}
+
 static std::tuple<std::shared_ptr<geometry::RGBDImage>,
                   std::shared_ptr<geometry::RGBDImage>>
 InitializeRGBDOdometry(
@@ -381,36 +411,62 @@ InitializeRGBDOdometry(
         const camera::PinholeCameraIntrinsic &pinhole_camera_intrinsic,
         const Eigen::Matrix4d &odo_init,
         const OdometryOption &option) {
-    std::shared_ptr<geometry::Image> source_color, target_color;
-    if (IsColorImageRGB(source.color_) && IsColorImageRGB(target.color_)) {
-        source_color = source.color_.CreateFloatImage();
-        target_color = target.color_.CreateFloatImage();
-    } else {
-        source_color = std::make_shared<geometry::Image>(source.color_);
-        target_color = std::make_shared<geometry::Image>(target.color_);
-    }
-
-    auto source_gray =
-            source_color->Filter(geometry::Image::FilterType::Gaussian3);
-    auto target_gray =
-            target_color->Filter(geometry::Image::FilterType::Gaussian3);
-    auto source_depth_preprocessed = PreprocessDepth(source.depth_, option);
-    auto target_depth_preprocessed = PreprocessDepth(target.depth_, option);
-    auto source_depth = source_depth_preprocessed->Filter(
-            geometry::Image::FilterType::Gaussian3);
-    auto target_depth = target_depth_preprocessed->Filter(
-            geometry::Image::FilterType::Gaussian3);
+    auto source_out = PreprocessRGBDImage(source, option);
+    auto target_out = PreprocessRGBDImage(target, option);
 
     CorrespondenceSetPixelWise correspondence = ComputeCorrespondence(
-            pinhole_camera_intrinsic.intrinsic_matrix_, odo_init, *source_depth,
-            *target_depth, option);
-    NormalizeIntensity(*source_gray, *target_gray, correspondence);
-
-    auto source_out = PackRGBDImage(*source_gray, *source_depth);
-    auto target_out = PackRGBDImage(*target_gray, *target_depth);
+            pinhole_camera_intrinsic.intrinsic_matrix_, odo_init,
+            source_out->depth_, target_out->depth_, option);
+    NormalizeIntensity(source_out->color_, target_out->color_, correspondence);
     return std::make_tuple(source_out, target_out);
 }
 
+/// The images of one frame at every pyramid level.
+struct OdometryPyramid {
+    geometry::RGBDImagePyramid rgbd_;
+    /// Sobel filtered images, for frames used as target.
+    geometry::RGBDImagePyramid rgbd_dx_;
+    geometry::RGBDImagePyramid rgbd_dy_;
+    /// Points of the depth images, for frames used as source.
+    std::vector<std::shared_ptr<geometry::Image>> xyz_;
+};
+
+static OdometryPyramid CreateOdometryPyramid(
+        const geometry::RGBDImage &image,
+        const std::vector<Eigen::Matrix3d> &pyramid_camera_matrix,
+        bool is_source,
+        bool is_target) {
+    const int num_levels = int(pyramid_camera_matrix.size());
+    OdometryPyramid pyramid;
+    pyramid.rgbd_ = image.CreatePyramid(num_levels);
+    if (is_target) {
+        pyramid.rgbd_dx_ = geometry::RGBDImage::FilterPyramid(
+                pyramid.rgbd_, geometry::Image::FilterType::Sobel3Dx);
+        pyramid.rgbd_dy_ = geometry::RGBDImage::FilterPyramid(
+                pyramid.rgbd_, geometry::Image::FilterType::Sobel3Dy);
+    }
+    if (is_source) {
+        for (int level = 0; level < num_levels; level++) {
+            pyramid.xyz_.push_back(ConvertDepthImageToXYZImage(
+                    pyramid.rgbd_[level]->depth_,
+                    pyramid_camera_matrix[level]));
+        }
+    }
+    return pyramid;
+}
+
+/// Returns a copy of \p pyramid with the intensities multiplied by \p scale.
+static geometry::RGBDImagePyramid ScaleIntensityPyramid(
+        const geometry::RGBDImagePyramid &pyramid, double scale) {
+    geometry::RGBDImagePyramid scaled;
+    for (const auto &level : pyramid) {
+        auto scaled_level = std::make_shared<geometry::RGBDImage>(*level);
+        scaled_level->color_.LinearTransform(scale, 0.0);
+        scaled.push_back(scaled_level);
+    }
+    return scaled;
+}
+
 static std::tuple<bool, Eigen::Matrix4d> DoSingleIteration(
         int iter,
         int level,
@@ -457,52 +513,31 @@ static std::tuple<bool, Eigen::Matrix4d> DoSingleIteration(
 }
 
 static std::tuple<bool, Eigen::Matrix4d> ComputeMultiscale(
-        const geometry::RGBDImage &source,
-        const geometry::RGBDImage &target,
-        const camera::PinholeCameraIntrinsic &pinhole_camera_intrinsic,
+        const OdometryPyramid &source,
+        const OdometryPyramid &target,
+        const std::vector<Eigen::Matrix3d> &pyramid_camera_matrix,
         const Eigen::Matrix4d &extrinsic_initial,
         const RGBDOdometryJacobian &jacobian_method,
         const OdometryOption &option) {
     std::vector<int> iter_counts = option.iteration_number_per_pyramid_level_;
     int num_levels = (int)iter_counts.size();
 
-    auto source_pyramid = source.CreatePyramid(num_levels);
-    auto target_pyramid = target.CreatePyramid(num_levels);
-    auto target_pyramid_dx = geometry::RGBDImage::FilterPyramid(
-            target_pyramid, geometry::Image::FilterType::Sobel3Dx);
-    auto target_pyramid_dy = geometry::RGBDImage::FilterPyramid(
-            target_pyramid, geometry::Image::FilterType::Sobel3Dy);
-
     Eigen::Matrix4d result_odo = extrinsic_initial.isZero()
                                          ? Eigen::Matrix4d::Identity()
                                          : extrinsic_initial;
 
-    std::vector<Eigen::Matrix3d> pyramid_camera_matrix =
-            CreateCameraMatrixPyramid(pinhole_camera_intrinsic,
-                                      (int)iter_counts.size());
-
     for (int level = num_levels - 1; level >= 0; level--) {
         const Eigen::Matrix3d level_camera_matrix =
                 pyramid_camera_matrix[level];
 
-        auto source_xyz_level = ConvertDepthImageToXYZImage(
-                source_pyramid[level]->depth_, level_camera_matrix);
-        auto source_level = PackRGBDImage(source_pyramid[level]->color_,
-                                          source_pyramid[level]->depth_);
-        auto target_level = PackRGBDImage(target_pyramid[level]->color_,
-                                          target_pyramid[level]->depth_);
-        auto target_dx_level = PackRGBDImage(target_pyramid_dx[level]->color_,
-                                             target_pyramid_dx[level]->depth_);
-        auto target_dy_level = PackRGBDImage(target_pyramid_dy[level]->color_,
-                                             target_pyramid_dy[level]->depth_);
-
         for (int iter = 0; iter < iter_counts[num_levels - level - 1]; iter++) {
             Eigen::Matrix4d curr_odo;
             bool is_success;
             std::tie(is_success, curr_odo) = DoSingleIteration(
-                    iter, level, *source_level, *target_level,
-                    *source_xyz_level, *target_dx_level, *target_dy_level,
-                    level_camera_matrix, result_odo, jacobian_method, option);
+                    iter, level, *source.rgbd_[level], *target.rgbd_[level],
+                    *source.xyz_[level], *target.rgbd_dx_[level],
+                    *target.rgbd_dy_[level], level_camera_matrix, result_odo,
+                    jacobian_method, option);
             result_odo = curr_odo * result_odo;
 
             if (!is_success) {
@@ -534,11 +569,21 @@ std::tuple<bool, Eigen::Matrix4d, Eigen::Matrix6d> ComputeRGBDOdometry(
     std::tie(source_processed, target_processed) = InitializeRGBDOdometry(
             source, target, pinhole_camera_intrinsic, odo_init, option);
 
+    const std::vector<Eigen::Matrix3d> pyramid_camera_matrix =
+            CreateCameraMatrixPyramid(
+                    pinhole_camera_intrinsic,
+                    (int)option.iteration_number_per_pyramid_level_.size());
+    const OdometryPyramid source_pyramid = CreateOdometryPyramid(
+            *source_processed, pyramid_camera_matrix, true, false);
+    const OdometryPyramid target_pyramid = CreateOdometryPyramid(
+            *target_processed, pyramid_camera_matrix, false, true);
+
     Eigen::Matrix4d extrinsic;
     bool is_success;
-    std::tie(is_success, extrinsic) = ComputeMultiscale(
-            *source_processed, *target_processed, pinhole_camera_intrinsic,
-            odo_init, jacobian_method, option);
+    std::tie(is_success, extrinsic) =
+            ComputeMultiscale(source_pyramid, target_pyramid,
+                              pyramid_camera_matrix, odo_init,
+                              jacobian_method, option);
 
     if (is_success) {
         Eigen::Matrix4d trans_output = extrinsic;
@@ -552,6 +597,119 @@ std::tuple<bool, Eigen::Matrix4d, Eigen::Matrix6d> ComputeRGBDOdometry(
     }
 }
 
+std::tuple<std::vector<bool>,
+           std::vector<Eigen::Matrix4d, utility::Matrix4d_allocator>,
+           std::vector<Eigen::Matrix6d, utility::Matrix6d_allocator>>
+ComputeRGBDOdometryForPairs(
+        const std::vector<geometry::RGBDImage> &images,
+        const std::vector<std::pair<int, int>> &pairs,
+        const std::vector<Eigen::Matrix4d, utility::Matrix4d_allocator>
+                &odo_inits,
+        const camera::PinholeCameraIntrinsic &pinhole_camera_intrinsic,
+        const RGBDOdometryJacobian &jacobian_method,
+        const OdometryOption &option) {
+    if (!odo_inits.empty() && odo_inits.size() != pairs.size()) {
+        utility::LogError(
+                "[ComputeRGBDOdometryForPairs] {} initial motions for {} "
+                "pairs.",
+                odo_inits.size(), pairs.size());
+    }
+    const int num_images = int(images.size());
+    std::vector<bool> is_source(num_images, false);
+    std::vector<bool> is_target(num_images, false);
+    for (const auto &pair : pairs) {
+        if (pair.first < 0 || pair.first >= num_images || pair.second < 0 ||
+            pair.second >= num_images) {
+            utility::LogError(
+                    "[ComputeRGBDOdometryForPairs] Pair ({}, {}) is out of "
+                    "range for {} images.",
+                    pair.first, pair.second, num_images);
+        }
+        is_source[pair.first] = true;
+        is_target[pair.second] = true;
+    }
+
+    // The preprocessed images and their pyramids are shared by all pairs.
+    // Only the intensity normalization depends on the pair, and it is a scale
+    // that commutes with the pyramid and gradient filters.
+    const std::vector<Eigen::Matrix3d> pyramid_camera_matrix =
+            CreateCameraMatrixPyramid(
+                    pinhole_camera_intrinsic,
+                    (int)option.iteration_number_per_pyramid_level_.size());
+    std::vector<std::shared_ptr<geometry::RGBDImage>> processed(num_images);
+    std::vector<OdometryPyramid> pyramids(num_images);
+#pragma omp parallel for schedule(dynamic) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int idx = 0; idx < num_images; idx++) {
+        if (is_source[idx] || is_target[idx]) {
+            processed[idx] = PreprocessRGBDImage(images[idx], option);
+            pyramids[idx] = CreateOdometryPyramid(
+                    *processed[idx], pyramid_camera_matrix, is_source[idx],
+                    is_target[idx]);
+        }
+    }
+
+    const int num_pairs = int(pairs.size());
+    // std::vector<bool> is not safe for concurrent writes.
+    std::vector<uint8_t> pair_success(num_pairs, 0);
+    std::vector<Eigen::Matrix4d, utility::Matrix4d_allocator> transformations(
+            num_pairs, Eigen::Matrix4d::Identity());
+    std::vector<Eigen::Matrix6d, utility::Matrix6d_allocator> informations(
+            num_pairs, Eigen::Matrix6d::Zero());
+#pragma omp parallel for schedule(dynamic) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int pidx = 0; pidx < num_pairs; pidx++) {
+        const int sidx = pairs[pidx].first;
+        const int tidx = pairs[pidx].second;
+        if (!CheckRGBDImagePair(images[sidx], images[tidx])) {
+            utility::LogWarning(
+                    "[RGBDOdometry] Two RGBD pairs should be same in size.");
+            continue;
+        }
+        const Eigen::Matrix4d odo_init =
+                odo_inits.empty() ? Eigen::Matrix4d::Identity()
+                                  : odo_inits[pidx];
+        const geometry::RGBDImage &source = *processed[sidx];
+        const geometry::RGBDImage &target = *processed[tidx];
+
+        CorrespondenceSetPixelWise correspondence = ComputeCorrespondence(
+                pinhole_camera_intrinsic.intrinsic_matrix_, odo_init,
+                source.depth_, target.depth_, option);
+        double scale_s, scale_t;
+        std::tie(scale_s, scale_t) = ComputeIntensityScales(
+                source.color_, target.color_, correspondence);
+        OdometryPyramid source_pyramid;
+        source_pyramid.rgbd_ =
+                ScaleIntensityPyramid(pyramids[sidx].rgbd_, scale_s);
+        source_pyramid.xyz_ = pyramids[sidx].xyz_;
+        OdometryPyramid target_pyramid;
+        target_pyramid.rgbd_ =
+                ScaleIntensityPyramid(pyramids[tidx].rgbd_, scale_t);
+        target_pyramid.rgbd_dx_ =
+                ScaleIntensityPyramid(pyramids[tidx].rgbd_dx_, scale_t);
+        target_pyramid.rgbd_dy_ =
+                ScaleIntensityPyramid(pyramids[tidx].rgbd_dy_, scale_t);
+
+        bool is_success;
+        Eigen::Matrix4d extrinsic;
+        std::tie(is_success, extrinsic) =
+                ComputeMultiscale(source_pyramid, target_pyramid,
+                                  pyramid_camera_matrix, odo_init,
+                                  jacobian_method, option);
+        if (is_success) {
+            pair_success[pidx] = 1;
+            transformations[pidx] = extrinsic;
+            informations[pidx] = CreateInformationMatrix(
+                    extrinsic, pinhole_camera_intrinsic, source.depth_,
+                    target.depth_, option);
+        } else {
+            informations[pidx] = Eigen::Matrix6d::Identity();
+        }
+    }
+    std::vector<bool> success(pair_success.begin(), pair_success.end());
+    return std::make_tuple(success, transformations, informations);
+}
+
 }  // namespace odometry
 }  // namespace pipelines
 }  // namespace open3d
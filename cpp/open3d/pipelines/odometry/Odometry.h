@@ -29,6 +29,7 @@
 #include <Eigen/Core>
 #include <iostream>
 #include <tuple>
+#include <utility>
 #include <vector>
 
 #include "open3d/camera/PinholeCameraIntrinsic.h"
@@ -65,6 +66,35 @@ std::tuple<bool, Eigen::Matrix4d, Eigen::Matrix6d> ComputeRGBDOdometry(
                 RGBDOdometryJacobianFromHybridTerm(),
         const OdometryOption &option = OdometryOption());
 
+/// \brief Function to estimate 6D rigid motions for many pairs of frames.
+///
+/// Gives the same results as calling ComputeRGBDOdometry() on every pair,
+/// but the image pyramids of each frame are built once and shared by all the
+/// pairs it takes part in, and the pairs are solved in parallel.
+///
+/// \param images RGBD images of the frames.
+/// \param pairs (source, target) indices into \p images.
+/// \param odo_inits Initial 4x4 motion matrix estimation for each pair. If
+/// empty, identity is used for all pairs.
+/// \param pinhole_camera_intrinsic Camera intrinsic parameters.
+/// \param jacobian_method The odometry Jacobian method to use.
+/// \param option Odometry hyper parameters.
+/// \return is_success, 4x4 motion matrix, 6x6 information matrix for each
+/// pair.
+std::tuple<std::vector<bool>,
+           std::vector<Eigen::Matrix4d, utility::Matrix4d_allocator>,
+           std::vector<Eigen::Matrix6d, utility::Matrix6d_allocator>>
+ComputeRGBDOdometryForPairs(
+        const std::vector<geometry::RGBDImage> &images,
+        const std::vector<std::pair<int, int>> &pairs,
+        const std::vector<Eigen::Matrix4d, utility::Matrix4d_allocator>
+                &odo_inits = {},
+        const camera::PinholeCameraIntrinsic &pinhole_camera_intrinsic =
+                camera::PinholeCameraIntrinsic(),
+        const RGBDOdometryJacobian &jacobian_method =
+                RGBDOdometryJacobianFromHybridTerm(),
+        const OdometryOption &option = OdometryOption());
+
 }  // namespace odometry
 }  // namespace pipelines
 }  // namespace open3d
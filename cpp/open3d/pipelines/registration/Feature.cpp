@@ -30,6 +30,7 @@
 
 #include "open3d/geometry/KDTreeFlann.h"
 #include "open3d/geometry/PointCloud.h"
+#include "open3d/utility/Cancellation.h"
 #include "open3d/utility/Logging.h"
 #include "open3d/utility/Parallel.h"
 
@@ -77,9 +78,12 @@ static std::shared_ptr<Feature> ComputeSPFHFeature(
         const geometry::KDTreeSearchParam &search_param) {
     auto feature = std::make_shared<Feature>();
     feature->Resize(33, (int)input.points_.size());
+    const utility::OperationContext context =
+            utility::OperationContext::Current();
 #pragma omp parallel for schedule(static) \
         num_threads(utility::EstimateMaxThreads())
     for (int i = 0; i < (int)input.points_.size(); i++) {
+        if (context.IsCancelled()) continue;
         const auto &point = input.points_[i];
         const auto &normal = input.normals_[i];
         std::vector<int> indices;
@@ -119,14 +123,19 @@ std::shared_ptr<Feature> ComputeFPFHFeature(
     if (!input.HasNormals()) {
         utility::LogError("Failed because input point cloud has no normal.");
     }
+    const utility::OperationContext context =
+            utility::OperationContext::Current();
     geometry::KDTreeFlann kdtree(input);
     auto spfh = ComputeSPFHFeature(input, kdtree, search_param);
     if (spfh == nullptr) {
         utility::LogError("Internal error: SPFH feature is nullptr.");
     }
+    context.ThrowIfCancelled("ComputeFPFHFeature");
+    context.ReportProgress(50.0);
 #pragma omp parallel for schedule(static) \
         num_threads(utility::EstimateMaxThreads())
     for (int i = 0; i < (int)input.points_.size(); i++) {
+        if (context.IsCancelled()) continue;
         const auto &point = input.points_[i];
         std::vector<int> indices;
         std::vector<double> distance2;
@@ -155,6 +164,8 @@ std::shared_ptr<Feature> ComputeFPFHFeature(
             }
         }
     }
+    context.ThrowIfCancelled("ComputeFPFHFeature");
+    context.ReportProgress(100.0);
     return feature;
 }
 
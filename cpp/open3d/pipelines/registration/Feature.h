@@ -66,6 +66,9 @@ public:
 
 /// Function to compute FPFH feature for a point cloud.
 ///
+/// Cancellable with utility::ScopedOperationContext, throws
+/// utility::CancelledError when cancelled.
+///
 /// \param input The Input point cloud.
 /// \param search_param KDTree KNN search parameter.
 std::shared_ptr<Feature> ComputeFPFHFeature(
@@ -28,12 +28,14 @@
 
 #include <Eigen/Dense>
 #include <Eigen/Sparse>
+#include <algorithm>
 #include <tuple>
 #include <vector>
 
 #include "open3d/pipelines/registration/GlobalOptimizationConvergenceCriteria.h"
 #include "open3d/pipelines/registration/GlobalOptimizationMethod.h"
 #include "open3d/pipelines/registration/PoseGraph.h"
+#include "open3d/utility/Cancellation.h"
 #include "open3d/utility/Eigen.h"
 #include "open3d/utility/Logging.h"
 #include "open3d/utility/Timer.h"
@@ -206,15 +208,35 @@ static Eigen::VectorXd ComputeZeta(const PoseGraph &pose_graph) {
 ///
 /// This function focuses the case that every edge has two nodes (not hyper
 /// graph) so we have two Jacobian matrices from one constraint.
-static std::tuple<Eigen::MatrixXd, Eigen::VectorXd> ComputeLinearSystem(
-        const PoseGraph &pose_graph, const Eigen::VectorXd &zeta) {
-    int n_nodes = (int)pose_graph.nodes_.size();
+///
+/// H is assembled from the 6x6 blocks of the edges as a sparse matrix, so
+/// memory grows with the number of edges instead of the squared number of
+/// nodes.
+///
+/// Only the first n_free_nodes nodes are variables of the linear system. The
+/// remaining nodes are held fixed, and the blocks of their poses are dropped.
+static std::tuple<Eigen::SparseMatrix<double>, Eigen::VectorXd>
+ComputeLinearSystem(const PoseGraph &pose_graph,
+                    const Eigen::VectorXd &zeta,
+                    int n_free_nodes) {
     int n_edges = (int)pose_graph.edges_.size();
-    Eigen::MatrixXd H(n_nodes * 6, n_nodes * 6);
-    Eigen::VectorXd b(n_nodes * 6);
-    H.setZero();
+    Eigen::SparseMatrix<double> H(n_free_nodes * 6, n_free_nodes * 6);
+    Eigen::VectorXd b(n_free_nodes * 6);
     b.setZero();
 
+    std::vector<Eigen::Triplet<double>> triplets;
+    triplets.reserve(n_edges * 4 * 36);
+    int n_free_rows = n_free_nodes * 6;
+    auto add_block = [&triplets, n_free_rows](int row, int col,
+                                              const Eigen::Matrix6d &block) {
+        if (row >= n_free_rows || col >= n_free_rows) return;
+        for (int c = 0; c < 6; c++) {
+            for (int r = 0; r < 6; r++) {
+                triplets.emplace_back(row + r, col + c, block(r, c));
+            }
+        }
+    };
+
     for (int iter_edge = 0; iter_edge < n_edges; iter_edge++) {
         const PoseGraphEdge &t = pose_graph.edges_[iter_edge];
         Eigen::Vector6d e = zeta.block<6, 1>(iter_edge * 6, 0);
@@ -231,22 +253,45 @@ static std::tuple<Eigen::MatrixXd, Eigen::VectorXd> ComputeLinearSystem(
 
         int id_i = t.source_node_id_ * 6;
         int id_j = t.target_node_id_ * 6;
-        H.block<6, 6>(id_i, id_i).noalias() +=
-                line_process_iter * JsT_Info * Js;
-        H.block<6, 6>(id_i, id_j).noalias() +=
-                line_process_iter * JsT_Info * Jt;
-        H.block<6, 6>(id_j, id_i).noalias() +=
-                line_process_iter * JtT_Info * Js;
-        H.block<6, 6>(id_j, id_j).noalias() +=
-                line_process_iter * JtT_Info * Jt;
-        b.block<6, 1>(id_i, 0).noalias() -=
-                line_process_iter * eT_Info.transpose() * Js;
-        b.block<6, 1>(id_j, 0).noalias() -=
-                line_process_iter * eT_Info.transpose() * Jt;
+        add_block(id_i, id_i, line_process_iter * JsT_Info * Js);
+        add_block(id_i, id_j, line_process_iter * JsT_Info * Jt);
+        add_block(id_j, id_i, line_process_iter * JtT_Info * Js);
+        add_block(id_j, id_j, line_process_iter * JtT_Info * Jt);
+        if (id_i < n_free_rows) {
+            b.block<6, 1>(id_i, 0).noalias() -=
+                    line_process_iter * eT_Info.transpose() * Js;
+        }
+        if (id_j < n_free_rows) {
+            b.block<6, 1>(id_j, 0).noalias() -=
+                    line_process_iter * eT_Info.transpose() * Jt;
+        }
     }
+    // Duplicated entries of the blocks sharing a node are summed up.
+    H.setFromTriplets(triplets.begin(), triplets.end());
     return std::make_tuple(std::move(H), std::move(b));
 }
 
+/// Solves H @ delta == b with a sparse Cholesky factorization, and falls back
+/// to the Jacobi preconditioned conjugate gradient method if H cannot be
+/// factorized.
+static Eigen::VectorXd SolveSparseLinearSystem(
+        const Eigen::SparseMatrix<double> &H, const Eigen::VectorXd &b) {
+    Eigen::SimplicialLDLT<Eigen::SparseMatrix<double>> H_ldlt(H);
+    if (H_ldlt.info() == Eigen::Success) {
+        Eigen::VectorXd delta = H_ldlt.solve(b);
+        if (H_ldlt.info() == Eigen::Success) {
+            return delta;
+        }
+    }
+    utility::LogWarning(
+            "Cholesky factorization failed, switched to conjugate gradient "
+            "solver");
+    Eigen::ConjugateGradient<Eigen::SparseMatrix<double>,
+                             Eigen::Lower | Eigen::Upper>
+            H_cg(H);
+    return H_cg.solve(b);
+}
+
 static Eigen::VectorXd UpdatePoseVector(const PoseGraph &pose_graph) {
     int n_nodes = (int)pose_graph.nodes_.size();
     Eigen::VectorXd output(n_nodes * 6);
@@ -258,12 +303,14 @@ static Eigen::VectorXd UpdatePoseVector(const PoseGraph &pose_graph) {
     return output;
 }
 
+/// Updates the poses of the nodes having an increment in delta. Nodes beyond
+/// the length of delta are held fixed.
 static std::shared_ptr<PoseGraph> UpdatePoseGraph(const PoseGraph &pose_graph,
                                                   const Eigen::VectorXd delta) {
     std::shared_ptr<PoseGraph> pose_graph_updated =
             std::make_shared<PoseGraph>();
     *pose_graph_updated = pose_graph;
-    int n_nodes = (int)pose_graph.nodes_.size();
+    int n_nodes = (int)delta.size() / 6;
     for (int iter_node = 0; iter_node < n_nodes; iter_node++) {
         Eigen::Vector6d delta_iter = delta.block<6, 1>(iter_node * 6, 0);
         pose_graph_updated->nodes_[iter_node].pose_ =
@@ -388,39 +435,43 @@ static bool ValidatePoseGraphConnectivity(const PoseGraph &pose_graph,
     size_t n_nodes = pose_graph.nodes_.size();
     size_t n_edges = pose_graph.edges_.size();
 
+    std::vector<std::vector<int>> adjacent_nodes(n_nodes);
+    for (size_t j = 0; j < n_edges; j++) {
+        const PoseGraphEdge &t = pose_graph.edges_[j];
+        if (ignore_uncertain_edges && t.uncertain_) {
+            continue;
+        }
+        // Edges referencing invalid nodes are reported by ValidatePoseGraph.
+        if (t.source_node_id_ < 0 || t.source_node_id_ >= (int)n_nodes ||
+            t.target_node_id_ < 0 || t.target_node_id_ >= (int)n_nodes) {
+            continue;
+        }
+        adjacent_nodes[t.source_node_id_].push_back(t.target_node_id_);
+        adjacent_nodes[t.target_node_id_].push_back(t.source_node_id_);
+    }
+
     // Test if the connected component containing the first node is the entire
     // graph
     std::vector<int> nodes_to_explore{};
-    std::vector<int> component{};
+    std::vector<bool> in_component(n_nodes, false);
+    size_t component_size = 0;
     if (n_nodes > 0) {
         nodes_to_explore.push_back(0);
-        component.push_back(0);
+        in_component[0] = true;
+        component_size++;
     }
     while (!nodes_to_explore.empty()) {
         int i = nodes_to_explore.back();
         nodes_to_explore.pop_back();
-        for (size_t j = 0; j < n_edges; j++) {
-            const PoseGraphEdge &t = pose_graph.edges_[j];
-            if (ignore_uncertain_edges && t.uncertain_) {
-                continue;
-            }
-            int adjacent_node{-1};
-            if (t.source_node_id_ == i) {
-                adjacent_node = t.target_node_id_;
-            } else if (t.target_node_id_ == i) {
-                adjacent_node = t.source_node_id_;
-            }
-            if (adjacent_node != -1) {
-                auto find_result = std::find(component.begin(), component.end(),
-                                             adjacent_node);
-                if (find_result == component.end()) {
-                    nodes_to_explore.push_back(adjacent_node);
-                    component.push_back(adjacent_node);
-                }
+        for (int adjacent_node : adjacent_nodes[i]) {
+            if (!in_component[adjacent_node]) {
+                nodes_to_explore.push_back(adjacent_node);
+                in_component[adjacent_node] = true;
+                component_size++;
             }
         }
     }
-    return component.size() == n_nodes;
+    return component_size == n_nodes;
 }
 
 static bool ValidatePoseGraph(const PoseGraph &pose_graph) {
@@ -511,31 +562,29 @@ void GlobalOptimizationGaussNewton::OptimizePoseGraph(
     valid_edges_num =
             UpdateConfidence(pose_graph, zeta, line_process_weight, option);
 
-    Eigen::MatrixXd H;
+    Eigen::SparseMatrix<double> H;
     Eigen::VectorXd b;
     Eigen::VectorXd x = UpdatePoseVector(pose_graph);
 
-    std::tie(H, b) = ComputeLinearSystem(pose_graph, zeta);
+    std::tie(H, b) = ComputeLinearSystem(pose_graph, zeta, n_nodes);
 
     utility::LogDebug("[Initial     ] residual : {:e}", current_residual);
 
     bool stop = false;
     if (CheckRightTerm(b, criteria)) return;
 
+    const utility::OperationContext context =
+            utility::OperationContext::Current();
     utility::Timer timer_overall;
     timer_overall.Start();
     int iter;
     for (iter = 0; !stop; iter++) {
+        context.ThrowIfCancelled("GlobalOptimization");
         utility::Timer timer_iter;
         timer_iter.Start();
 
-        Eigen::VectorXd delta(H.cols());
-        bool solver_success = false;
-
-        // Solve H_LM @ delta == b using a sparse solver
-        std::tie(solver_success, delta) = utility::SolveLinearSystemPSD(
-                H, b, /*prefer_sparse=*/true, /*check_symmetric=*/false,
-                /*check_det=*/false, /*check_psd=*/false);
+        // Solve H @ delta == b using a sparse solver
+        Eigen::VectorXd delta = SolveSparseLinearSystem(H, b);
 
         stop = stop || CheckRelativeIncrement(delta, x, criteria);
         if (stop) {
@@ -558,7 +607,7 @@ void GlobalOptimizationGaussNewton::OptimizePoseGraph(
             x = UpdatePoseVector(pose_graph);
             valid_edges_num = UpdateConfidence(pose_graph, zeta,
                                                line_process_weight, option);
-            std::tie(H, b) = ComputeLinearSystem(pose_graph, zeta);
+            std::tie(H, b) = ComputeLinearSystem(pose_graph, zeta, n_nodes);
 
             stop = stop || CheckRightTerm(b, criteria);
             if (stop) break;
@@ -579,18 +628,21 @@ void GlobalOptimizationGaussNewton::OptimizePoseGraph(
             timer_overall.GetDuration() / 1000.0);
 }
 
-void GlobalOptimizationLevenbergMarquardt::OptimizePoseGraph(
+/// Levenberg-Marquardt optimization of the poses of the first n_free_nodes
+/// nodes of the pose graph. The remaining nodes are held fixed.
+static void OptimizePoseGraphLevenbergMarquardt(
         PoseGraph &pose_graph,
         const GlobalOptimizationConvergenceCriteria &criteria,
-        const GlobalOptimizationOption &option) const {
+        const GlobalOptimizationOption &option,
+        double line_process_weight,
+        int n_free_nodes) {
     int n_nodes = (int)pose_graph.nodes_.size();
     int n_edges = (int)pose_graph.edges_.size();
-    double line_process_weight = ComputeLineProcessWeight(pose_graph, option);
 
     utility::LogDebug(
-            "[GlobalOptimizationLM] Optimizing PoseGraph having {:d} nodes and "
-            "{:d} edges.",
-            n_nodes, n_edges);
+            "[GlobalOptimizationLM] Optimizing PoseGraph having {:d} nodes "
+            "({:d} fixed) and {:d} edges.",
+            n_nodes, n_nodes - n_free_nodes, n_edges);
     utility::LogDebug("Line process weight : {:f}", line_process_weight);
 
     Eigen::VectorXd zeta = ComputeZeta(pose_graph);
@@ -602,12 +654,13 @@ void GlobalOptimizationLevenbergMarquardt::OptimizePoseGraph(
     int valid_edges_num =
             UpdateConfidence(pose_graph, zeta, line_process_weight, option);
 
-    Eigen::MatrixXd H_I = Eigen::MatrixXd::Identity(n_nodes * 6, n_nodes * 6);
-    Eigen::MatrixXd H;
+    Eigen::SparseMatrix<double> H_I(n_free_nodes * 6, n_free_nodes * 6);
+    H_I.setIdentity();
+    Eigen::SparseMatrix<double> H;
     Eigen::VectorXd b;
     Eigen::VectorXd x = UpdatePoseVector(pose_graph);
 
-    std::tie(H, b) = ComputeLinearSystem(pose_graph, zeta);
+    std::tie(H, b) = ComputeLinearSystem(pose_graph, zeta, n_free_nodes);
 
     Eigen::VectorXd H_diag = H.diagonal();
     double tau = 1e-5;
@@ -622,6 +675,8 @@ void GlobalOptimizationLevenbergMarquardt::OptimizePoseGraph(
     stop = stop || CheckRightTerm(b, criteria);
     if (stop) return;
 
+    const utility::OperationContext context =
+            utility::OperationContext::Current();
     utility::Timer timer_overall;
     timer_overall.Start();
     for (int iter = 0; !stop; iter++) {
@@ -629,14 +684,11 @@ void GlobalOptimizationLevenbergMarquardt::OptimizePoseGraph(
         timer_iter.Start();
         int lm_count = 0;
         do {
-            Eigen::MatrixXd H_LM = H + current_lambda * H_I;
-            Eigen::VectorXd delta(H_LM.cols());
-            bool solver_success = false;
+            context.ThrowIfCancelled("GlobalOptimization");
+            Eigen::SparseMatrix<double> H_LM = H + current_lambda * H_I;
 
             // Solve H_LM @ delta == b using a sparse solver
-            std::tie(solver_success, delta) = utility::SolveLinearSystemPSD(
-                    H_LM, b, /*prefer_sparse=*/true, /*check_symmetric=*/false,
-                    /*check_det=*/false, /*check_psd=*/false);
+            Eigen::VectorXd delta = SolveSparseLinearSystem(H_LM, b);
 
             stop = stop || CheckRelativeIncrement(delta, x, criteria);
             if (!stop) {
@@ -667,7 +719,8 @@ void GlobalOptimizationLevenbergMarquardt::OptimizePoseGraph(
                     x = UpdatePoseVector(pose_graph);
                     valid_edges_num = UpdateConfidence(
                             pose_graph, zeta, line_process_weight, option);
-                    std::tie(H, b) = ComputeLinearSystem(pose_graph, zeta);
+                    std::tie(H, b) = ComputeLinearSystem(pose_graph, zeta,
+                                                         n_free_nodes);
 
                     stop = stop || CheckRightTerm(b, criteria);
                     if (stop) break;
@@ -696,6 +749,16 @@ void GlobalOptimizationLevenbergMarquardt::OptimizePoseGraph(
                       timer_overall.GetDuration() / 1000.0);
 }
 
+void GlobalOptimizationLevenbergMarquardt::OptimizePoseGraph(
+        PoseGraph &pose_graph,
+        const GlobalOptimizationConvergenceCriteria &criteria,
+        const GlobalOptimizationOption &option) const {
+    OptimizePoseGraphLevenbergMarquardt(
+            pose_graph, criteria, option,
+            ComputeLineProcessWeight(pose_graph, option),
+            (int)pose_graph.nodes_.size());
+}
+
 void GlobalOptimization(PoseGraph &pose_graph,
                         const GlobalOptimizationMethod &method
                         /* = GlobalOptimizationLevenbergMarquardt() */,
@@ -704,12 +767,19 @@ void GlobalOptimization(PoseGraph &pose_graph,
                         const GlobalOptimizationOption &option
                         /* = GlobalOptimizationOption() */) {
     if (!ValidatePoseGraph(pose_graph)) return;
+    // The optimization works on copies, a cancellation leaves pose_graph
+    // unchanged.
+    const utility::OperationContext context =
+            utility::OperationContext::Current();
     std::shared_ptr<PoseGraph> pose_graph_pre = std::make_shared<PoseGraph>();
     *pose_graph_pre = pose_graph;
     method.OptimizePoseGraph(*pose_graph_pre, criteria, option);
+    context.ReportProgress(50.0);
     auto pose_graph_pre_pruned =
             CreatePoseGraphWithoutInvalidEdges(*pose_graph_pre, option);
     method.OptimizePoseGraph(*pose_graph_pre_pruned, criteria, option);
+    context.ThrowIfCancelled("GlobalOptimization");
+    context.ReportProgress(100.0);
     auto pose_graph_pre_pruned_2 =
             CreatePoseGraphWithoutInvalidEdges(*pose_graph_pre_pruned, option);
     CompensateReferencePoseGraphNode(*pose_graph_pre_pruned_2, pose_graph,
@@ -717,6 +787,156 @@ void GlobalOptimization(PoseGraph &pose_graph,
     pose_graph = *pose_graph_pre_pruned_2;
 }
 
+void IncrementalGlobalOptimization(
+        PoseGraph &pose_graph,
+        int first_new_edge,
+        int window_size /* = 10 */,
+        const GlobalOptimizationConvergenceCriteria &criteria
+        /* = GlobalOptimizationConvergenceCriteria() */,
+        const GlobalOptimizationOption &option
+        /* = GlobalOptimizationOption() */) {
+    int n_nodes = (int)pose_graph.nodes_.size();
+    int n_edges = (int)pose_graph.edges_.size();
+    if (first_new_edge < 0 || first_new_edge > n_edges) {
+        utility::LogError(
+                "first_new_edge {} is out of range, the pose graph has {} "
+                "edges.",
+                first_new_edge, n_edges);
+    }
+    if (window_size < 0) {
+        utility::LogError("window_size {} must be non-negative.", window_size);
+    }
+    if (first_new_edge == n_edges) return;
+    if (!ValidatePoseGraph(pose_graph)) return;
+
+    std::vector<std::vector<int>> adjacent_edges(n_nodes);
+    for (int iter_edge = 0; iter_edge < n_edges; iter_edge++) {
+        const PoseGraphEdge &t = pose_graph.edges_[iter_edge];
+        adjacent_edges[t.source_node_id_].push_back(iter_edge);
+        adjacent_edges[t.target_node_id_].push_back(iter_edge);
+    }
+
+    // Breadth-first search from the nodes of the new edges. Nodes within
+    // window_size hops are re-optimized, and their neighbors outside of the
+    // window are held fixed.
+    const int kNotInWindow = -1;
+    std::vector<int> hops(n_nodes, kNotInWindow);
+    std::vector<int> active_nodes;
+    for (int iter_edge = first_new_edge; iter_edge < n_edges; iter_edge++) {
+        const PoseGraphEdge &t = pose_graph.edges_[iter_edge];
+        for (int node_id : {t.source_node_id_, t.target_node_id_}) {
+            if (hops[node_id] == kNotInWindow) {
+                hops[node_id] = 0;
+                active_nodes.push_back(node_id);
+            }
+        }
+    }
+    for (size_t i = 0; i < active_nodes.size(); i++) {
+        int node_id = active_nodes[i];
+        if (hops[node_id] == window_size) continue;
+        for (int edge_id : adjacent_edges[node_id]) {
+            const PoseGraphEdge &t = pose_graph.edges_[edge_id];
+            int adjacent_node = t.source_node_id_ == node_id
+                                        ? t.target_node_id_
+                                        : t.source_node_id_;
+            if (hops[adjacent_node] == kNotInWindow) {
+                hops[adjacent_node] = hops[node_id] + 1;
+                active_nodes.push_back(adjacent_node);
+            }
+        }
+    }
+    // The reference node keeps its pose.
+    if (option.reference_node_ >= 0 && option.reference_node_ < n_nodes &&
+        hops[option.reference_node_] != kNotInWindow) {
+        active_nodes.erase(std::find(active_nodes.begin(), active_nodes.end(),
+                                     option.reference_node_));
+    }
+    if (active_nodes.empty()) return;
+
+    // Local pose graph whose first nodes are the active nodes, followed by the
+    // fixed nodes adjacent to them.
+    std::vector<int> local_node_ids(n_nodes, -1);
+    std::vector<int> global_node_ids;
+    for (int node_id : active_nodes) {
+        local_node_ids[node_id] = (int)global_node_ids.size();
+        global_node_ids.push_back(node_id);
+    }
+    int n_free_nodes = (int)global_node_ids.size();
+
+    PoseGraph local_graph;
+    std::vector<int> global_edge_ids;
+    std::vector<bool> in_window(n_edges, false);
+    for (int node_id : active_nodes) {
+        for (int edge_id : adjacent_edges[node_id]) {
+            if (in_window[edge_id]) continue;
+            in_window[edge_id] = true;
+            PoseGraphEdge t = pose_graph.edges_[edge_id];
+            for (int *id : {&t.source_node_id_, &t.target_node_id_}) {
+                if (local_node_ids[*id] == -1) {
+                    local_node_ids[*id] = (int)global_node_ids.size();
+                    global_node_ids.push_back(*id);
+                }
+                *id = local_node_ids[*id];
+            }
+            local_graph.edges_.push_back(t);
+            global_edge_ids.push_back(edge_id);
+        }
+    }
+    for (int node_id : global_node_ids) {
+        local_graph.nodes_.push_back(pose_graph.nodes_[node_id]);
+    }
+
+    utility::LogDebug(
+            "[IncrementalGlobalOptimization] Window has {:d} of {:d} nodes and "
+            "{:d} of {:d} edges.",
+            n_free_nodes, n_nodes, (int)local_graph.edges_.size(), n_edges);
+
+    // The line process weight is computed over the entire pose graph to match
+    // GlobalOptimization.
+    double line_process_weight = ComputeLineProcessWeight(pose_graph, option);
+    auto prune_local_graph = [&]() {
+        size_t n_kept = 0;
+        for (size_t i = 0; i < local_graph.edges_.size(); i++) {
+            const PoseGraphEdge &t = local_graph.edges_[i];
+            if (t.uncertain_ && t.confidence_ <= option.edge_prune_threshold_) {
+                continue;
+            }
+            local_graph.edges_[n_kept] = t;
+            global_edge_ids[n_kept] = global_edge_ids[i];
+            n_kept++;
+        }
+        local_graph.edges_.resize(n_kept);
+        global_edge_ids.resize(n_kept);
+    };
+    OptimizePoseGraphLevenbergMarquardt(local_graph, criteria, option,
+                                        line_process_weight, n_free_nodes);
+    prune_local_graph();
+    OptimizePoseGraphLevenbergMarquardt(local_graph, criteria, option,
+                                        line_process_weight, n_free_nodes);
+    prune_local_graph();
+
+    // Write back the poses of the window and drop its pruned edges.
+    for (int i = 0; i < n_free_nodes; i++) {
+        pose_graph.nodes_[global_node_ids[i]].pose_ =
+                local_graph.nodes_[i].pose_;
+    }
+    std::vector<bool> keep_edge(n_edges, true);
+    for (int edge_id = 0; edge_id < n_edges; edge_id++) {
+        if (in_window[edge_id]) keep_edge[edge_id] = false;
+    }
+    for (size_t i = 0; i < global_edge_ids.size(); i++) {
+        keep_edge[global_edge_ids[i]] = true;
+        pose_graph.edges_[global_edge_ids[i]].confidence_ =
+                local_graph.edges_[i].confidence_;
+    }
+    int n_kept = 0;
+    for (int edge_id = 0; edge_id < n_edges; edge_id++) {
+        if (!keep_edge[edge_id]) continue;
+        pose_graph.edges_[n_kept++] = pose_graph.edges_[edge_id];
+    }
+    pose_graph.edges_.resize(n_kept);
+}
+
 }  // namespace registration
 }  // namespace pipelines
 }  // namespace open3d
@@ -49,6 +49,9 @@ class PoseGraph;
 ///    M. Lourakis,
 ///    SBA: A Software Package for Generic Sparse Bundle Adjustment,
 ///    Transactions on Mathematical Software, 2009
+///
+/// Cancellable with utility::ScopedOperationContext, throws
+/// utility::CancelledError and leaves \p pose_graph unchanged when cancelled.
 void GlobalOptimization(
         PoseGraph &pose_graph,
         const GlobalOptimizationMethod &method =
@@ -57,6 +60,31 @@ void GlobalOptimization(
                 GlobalOptimizationConvergenceCriteria(),
         const GlobalOptimizationOption &option = GlobalOptimizationOption());
 
+/// \brief Function to incrementally optimize a PoseGraph after new edges are
+/// appended, e.g. loop closures found online.
+///
+/// Only the nodes within \p window_size hops of the nodes of the new edges
+/// are re-optimized with Levenberg-Marquardt, while their neighbors outside
+/// of the window and the reference node are held fixed. The cost depends on
+/// the size of the window instead of the size of the pose graph. Uncertain
+/// edges of the window with confidence_ < .edge_prune_threshold_ are removed,
+/// which shifts the indices of the following edges.
+///
+/// \param pose_graph The pose graph to be optimized (in-place).
+/// \param first_new_edge Index of the first edge appended since the last
+/// optimization. Edges from this index on are the new edges.
+/// \param window_size Number of hops from the new edges within which the
+/// nodes are re-optimized.
+/// \param criteria Convergence criteria.
+/// \param option Global optimization option.
+void IncrementalGlobalOptimization(
+        PoseGraph &pose_graph,
+        int first_new_edge,
+        int window_size = 10,
+        const GlobalOptimizationConvergenceCriteria &criteria =
+                GlobalOptimizationConvergenceCriteria(),
+        const GlobalOptimizationOption &option = GlobalOptimizationOption());
+
 /// Function to prune out uncertain edges having
 /// confidence_ < .edge_prune_threshold_
 std::shared_ptr<PoseGraph> CreatePoseGraphWithoutInvalidEdges(
@@ -138,9 +138,9 @@ bool PoseGraph::ConvertToJsonValue(Json::Value &value) const {
         if (!node.ConvertToJsonValue(node_object)) {
             return false;
         }
-        node_array.append(node_object);
+        node_array.append(std::move(node_object));
     }
-    value["nodes"] = node_array;
+    value["nodes"].swap(node_array);
 
     Json::Value edge_array;
     for (const auto &edge : edges_) {
@@ -148,9 +148,9 @@ bool PoseGraph::ConvertToJsonValue(Json::Value &value) const {
         if (!edge.ConvertToJsonValue(edge_object)) {
             return false;
         }
-        edge_array.append(edge_object);
+        edge_array.append(std::move(edge_object));
     }
-    value["edges"] = edge_array;
+    value["edges"].swap(edge_array);
     return true;
 }
 
@@ -174,13 +174,14 @@ bool PoseGraph::ConvertFromJsonValue(const Json::Value &value) {
         return false;
     }
     nodes_.clear();
+    nodes_.reserve(node_array.size());
     for (int i = 0; i < (int)node_array.size(); i++) {
         const Json::Value &node_object = node_array[i];
         PoseGraphNode new_node;
         if (!new_node.ConvertFromJsonValue(node_object)) {
             return false;
         }
-        nodes_.push_back(new_node);
+        nodes_.push_back(std::move(new_node));
     }
 
     const Json::Value &edge_array = value["edges"];
@@ -189,13 +190,14 @@ bool PoseGraph::ConvertFromJsonValue(const Json::Value &value) {
         return false;
     }
     edges_.clear();
+    edges_.reserve(edge_array.size());
     for (int i = 0; i < (int)edge_array.size(); i++) {
         const Json::Value &edge_object = edge_array[i];
         PoseGraphEdge new_edge;
         if (!new_edge.ConvertFromJsonValue(edge_object)) {
             return false;
         }
-        edges_.push_back(new_edge);
+        edges_.push_back(std::move(new_edge));
     }
     return true;
 }
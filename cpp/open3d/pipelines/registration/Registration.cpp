@@ -108,6 +108,139 @@ static double EvaluateInlierCorrespondenceRatio(
     return double(inlier_corres) / double(corres.size());
 }
 
+static int CountInlierCorrespondences(const geometry::PointCloud &source,
+                                      const geometry::PointCloud &target,
+                                      const CorrespondenceSet &corres,
+                                      double max_correspondence_distance,
+                                      const Eigen::Matrix4d &transformation) {
+    const Eigen::Matrix3d rotation = transformation.block<3, 3>(0, 0);
+    const Eigen::Vector3d translation = transformation.block<3, 1>(0, 3);
+    const double max_dis2 =
+            max_correspondence_distance * max_correspondence_distance;
+
+    int inlier_corres = 0;
+    for (const auto &c : corres) {
+        const Eigen::Vector3d diff =
+                rotation * source.points_[c[0]] + translation -
+                target.points_[c[1]];
+        inlier_corres += diff.squaredNorm() < max_dis2 ? 1 : 0;
+    }
+    return inlier_corres;
+}
+
+/// Batched RANSAC. Each batch draws its samples from a single random sequence,
+/// so the result only depends on the seed and not on the number of threads.
+/// Hypotheses are checked and scored by their inlier correspondence count in
+/// parallel, and only the best ones of a batch are validated with the KDTree.
+static RegistrationResult RegistrationRANSACBasedOnCorrespondenceBatched(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        const CorrespondenceSet &corres,
+        double max_correspondence_distance,
+        const TransformationEstimation &estimation,
+        int ransac_n,
+        const std::vector<std::reference_wrapper<const CorrespondenceChecker>>
+                &checkers,
+        const RANSACConvergenceCriteria &criteria,
+        utility::optional<unsigned int> seed) {
+    RegistrationResult best_result;
+    geometry::KDTreeFlann kdtree(target);
+    unsigned int seed_val =
+            seed.has_value() ? seed.value() : std::random_device{}();
+    utility::UniformRandIntGenerator rand_gen(0, corres.size() - 1, seed_val);
+
+    const int batch_size = criteria.batch_size_;
+    std::vector<int> samples;
+    std::vector<Eigen::Matrix4d> transformations(batch_size);
+    std::vector<int> inlier_corres(batch_size);
+
+    int est_k = criteria.max_iteration_;
+    int num_hypotheses = 0;
+    int best_inlier_corres = 0;
+    int total_validation = 0;
+    while (num_hypotheses < est_k) {
+        const int num_batch = std::min(batch_size, est_k - num_hypotheses);
+        samples.resize(num_batch * ransac_n);
+        for (auto &sample : samples) {
+            sample = rand_gen();
+        }
+
+        // Hypothesis generation, checking and scoring: inexpensive
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+        for (int i = 0; i < num_batch; i++) {
+            CorrespondenceSet ransac_corres(ransac_n);
+            for (int j = 0; j < ransac_n; j++) {
+                ransac_corres[j] = corres[samples[i * ransac_n + j]];
+            }
+            inlier_corres[i] = -1;
+            transformations[i] = estimation.ComputeTransformation(
+                    source, target, ransac_corres);
+
+            bool check = true;
+            for (const auto &checker : checkers) {
+                if (!checker.get().Check(source, target, ransac_corres,
+                                         transformations[i])) {
+                    check = false;
+                    break;
+                }
+            }
+            if (!check) continue;
+
+            inlier_corres[i] = CountInlierCorrespondences(
+                    source, target, corres, max_correspondence_distance,
+                    transformations[i]);
+        }
+        num_hypotheses += num_batch;
+
+        const int batch_best_inlier_corres = *std::max_element(
+                inlier_corres.begin(), inlier_corres.begin() + num_batch);
+        if (batch_best_inlier_corres <= 0 ||
+            batch_best_inlier_corres < best_inlier_corres) {
+            continue;
+        }
+
+        // Expensive validation, only for the best hypotheses of the batch.
+        for (int i = 0; i < num_batch; i++) {
+            if (inlier_corres[i] != batch_best_inlier_corres) continue;
+            geometry::PointCloud pcd = source;
+            pcd.Transform(transformations[i]);
+            auto result = GetRegistrationResultAndCorrespondences(
+                    pcd, target, kdtree, max_correspondence_distance,
+                    transformations[i]);
+            total_validation += 1;
+            if (result.IsBetterRANSACThan(best_result)) {
+                best_result = result;
+            }
+        }
+        best_inlier_corres = batch_best_inlier_corres;
+
+        // Update exit condition if necessary.
+        // If confidence is 1.0, then it is safely inf, we always consume all
+        // the iterations.
+        double corres_inlier_ratio =
+                double(best_inlier_corres) / double(corres.size());
+        double est_k_d =
+                std::log(1.0 - criteria.confidence_) /
+                std::log(1.0 - std::pow(corres_inlier_ratio, ransac_n));
+        if (est_k_d < est_k) {
+            est_k = std::max(static_cast<int>(std::ceil(est_k_d)),
+                             num_hypotheses);
+        }
+        utility::LogDebug(
+                "Hypothesis {:06d}: registration fitness={:.3f}, "
+                "corres inlier ratio={:.3f}, Est. max k = {}",
+                num_hypotheses, best_result.fitness_, corres_inlier_ratio,
+                est_k_d);
+    }
+    utility::LogDebug(
+            "RANSAC exits after {:d} hypotheses and {:d} validations. Best "
+            "inlier ratio {:e}, RMSE {:e}",
+            num_hypotheses, total_validation, best_result.fitness_,
+            best_result.inlier_rmse_);
+    return best_result;
+}
+
 RegistrationResult EvaluateRegistration(
         const geometry::PointCloud &source,
         const geometry::PointCloud &target,
@@ -203,6 +336,11 @@ RegistrationResult RegistrationRANSACBasedOnCorrespondence(
         max_correspondence_distance <= 0.0) {
         return RegistrationResult();
     }
+    if (criteria.batch_size_ > 0) {
+        return RegistrationRANSACBasedOnCorrespondenceBatched(
+                source, target, corres, max_correspondence_distance,
+                estimation, ransac_n, checkers, criteria, seed);
+    }
 
     RegistrationResult best_result;
     geometry::KDTreeFlann kdtree(target);
@@ -313,7 +451,8 @@ RegistrationResult RegistrationRANSACBasedOnFeatureMatching(
                 &checkers /* = {}*/,
         const RANSACConvergenceCriteria &criteria,
         /* = RANSACConvergenceCriteria()*/
-        utility::optional<unsigned int> seed /* = utility::nullopt*/) {
+        utility::optional<unsigned int> seed /* = utility::nullopt*/,
+        double feature_search_eps /* = 0.0*/) {
     if (ransac_n < 3 || max_correspondence_distance <= 0.0) {
         return RegistrationResult();
     }
@@ -330,7 +469,7 @@ RegistrationResult RegistrationRANSACBasedOnFeatureMatching(
         std::vector<double> dist_tmp(1);
 
         kdtree_target.SearchKNN(Eigen::VectorXd(source_feature.data_.col(i)), 1,
-                                corres_tmp, dist_tmp);
+                                corres_tmp, dist_tmp, feature_search_eps);
         int j = corres_tmp[0];
         corres_ij[i] = Eigen::Vector2i(i, j);
     }
@@ -346,7 +485,7 @@ RegistrationResult RegistrationRANSACBasedOnFeatureMatching(
             std::vector<double> dist_tmp(1);
             kdtree_source.SearchKNN(
                     Eigen::VectorXd(target_feature.data_.col(j)), 1, corres_tmp,
-                    dist_tmp);
+                    dist_tmp, feature_search_eps);
             int i = corres_tmp[0];
             corres_ji[j] = Eigen::Vector2i(i, j);
         }
@@ -90,6 +90,12 @@ public:
 /// the number of iteration reaches k = log(1 - confidence)/log(1 -
 /// fitness^{ransac_n}), where ransac_n is the number of points used during a
 /// ransac iteration. Use confidence=1.0 to avoid early termination.
+///
+/// If batch_size_ is positive, hypotheses are generated in batches of
+/// batch_size_ from a single random sequence and checked and scored in
+/// parallel against the input correspondences. Only the hypotheses that
+/// explain the most correspondences go through the expensive validation, and
+/// the early termination bound is shared by all hypotheses of a batch.
 class RANSACConvergenceCriteria {
 public:
     /// \brief Parameterized Constructor.
@@ -97,10 +103,14 @@ public:
     /// \param max_iteration Maximum iteration before iteration stops.
     /// \param confidence Desired probability of success. Used for estimating
     /// early termination.
+    /// \param batch_size Number of hypotheses generated and scored together.
+    /// Use 0 for the per-thread iteration without batching.
     RANSACConvergenceCriteria(int max_iteration = 100000,
-                              double confidence = 0.999)
+                              double confidence = 0.999,
+                              int batch_size = 0)
         : max_iteration_(max_iteration),
-          confidence_(std::max(std::min(confidence, 1.0), 0.0)) {}
+          confidence_(std::max(std::min(confidence, 1.0), 0.0)),
+          batch_size_(std::max(batch_size, 0)) {}
 
     ~RANSACConvergenceCriteria() {}
 
@@ -109,6 +119,9 @@ public:
     int max_iteration_;
     /// Desired probability of success.
     double confidence_;
+    /// Number of hypotheses generated and scored together. 0 disables
+    /// batching.
+    int batch_size_;
 };
 
 /// \class RegistrationResult
@@ -215,6 +228,9 @@ RegistrationResult RegistrationRANSACBasedOnCorrespondence(
 /// \param checkers Correspondence checker.
 /// \param criteria Convergence criteria.
 /// \param seed Random seed.
+/// \param feature_search_eps Approximation error of the nearest neighbor
+/// search in feature space. 0 is exact; larger values trade correspondence
+/// recall for speed.
 RegistrationResult RegistrationRANSACBasedOnFeatureMatching(
         const geometry::PointCloud &source,
         const geometry::PointCloud &target,
@@ -228,7 +244,8 @@ RegistrationResult RegistrationRANSACBasedOnFeatureMatching(
         const std::vector<std::reference_wrapper<const CorrespondenceChecker>>
                 &checkers = {},
         const RANSACConvergenceCriteria &criteria = RANSACConvergenceCriteria(),
-        utility::optional<unsigned int> seed = utility::nullopt);
+        utility::optional<unsigned int> seed = utility::nullopt,
+        double feature_search_eps = 0.0);
 
 /// \param source The source point cloud.
 /// \param target The target point cloud.
@@ -0,0 +1,311 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/t/geometry/DistributedVoxelBlockGrid.h"
+
+#include <exception>
+#include <thread>
+#include <unordered_set>
+
+#include "open3d/core/CUDAUtils.h"
+#include "open3d/core/TensorFunction.h"
+#include "open3d/t/geometry/Utility.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+
+DistributedVoxelBlockGrid::DistributedVoxelBlockGrid(
+        const std::vector<std::string> &attr_names,
+        const std::vector<core::Dtype> &attr_dtypes,
+        const std::vector<core::SizeVector> &attr_channels,
+        const std::vector<core::Device> &devices,
+        float voxel_size,
+        int64_t block_resolution,
+        int64_t block_count,
+        int64_t partition_resolution,
+        const core::HashBackendType &backend)
+    : partition_resolution_(partition_resolution), devices_(devices) {
+    if (devices.empty()) {
+        utility::LogError("At least one device is required.");
+    }
+    if (partition_resolution <= 0) {
+        utility::LogError("partition resolution must be positive, but got {}",
+                          partition_resolution);
+    }
+    for (const core::Device &device : devices) {
+        partitions_.emplace_back(attr_names, attr_dtypes, attr_channels,
+                                 voxel_size, block_resolution, block_count,
+                                 device, backend);
+    }
+}
+
+VoxelBlockGrid &DistributedVoxelBlockGrid::GetPartition(int64_t i) {
+    AssertInitialized();
+    if (i < 0 || i >= GetPartitionCount()) {
+        utility::LogError("Partition index {} out of range [0, {}).", i,
+                          GetPartitionCount());
+    }
+    return partitions_[i];
+}
+
+core::Device DistributedVoxelBlockGrid::GetPartitionDevice(int64_t i) const {
+    AssertInitialized();
+    if (i < 0 || i >= GetPartitionCount()) {
+        utility::LogError("Partition index {} out of range [0, {}).", i,
+                          GetPartitionCount());
+    }
+    return devices_[i];
+}
+
+int64_t DistributedVoxelBlockGrid::GetBlockCount() {
+    AssertInitialized();
+    int64_t block_count = 0;
+    for (VoxelBlockGrid &partition : partitions_) {
+        block_count += partition.GetHashMap().Size();
+    }
+    return block_count;
+}
+
+core::Tensor DistributedVoxelBlockGrid::GetPartitionIndices(
+        const core::Tensor &block_coords) const {
+    AssertInitialized();
+    CheckBlockCoorinates(block_coords);
+    const int64_t n = block_coords.GetLength();
+    if (n == 0) {
+        return core::Tensor({0}, core::Int64, block_coords.GetDevice());
+    }
+    core::AssertTensorShape(block_coords, {n, 3});
+
+    // Shift the coordinates to be non-negative so that the integer division
+    // rounds down to the chunk coordinates.
+    const int64_t kOffset = partition_resolution_ << 24;
+    core::Tensor chunk_coords =
+            (block_coords.To(core::Int64) + kOffset) / partition_resolution_;
+    core::Tensor hash = chunk_coords.Slice(1, 0, 1) * 73856093 +
+                        chunk_coords.Slice(1, 1, 2) * 19349669 +
+                        chunk_coords.Slice(1, 2, 3) * 83492791;
+    hash = hash.Reshape({n});
+
+    const int64_t n_partitions = GetPartitionCount();
+    return hash - (hash / n_partitions) * n_partitions;
+}
+
+core::Tensor DistributedVoxelBlockGrid::SelectPartitionBlockCoordinates(
+        const core::Tensor &block_coords, int64_t i) const {
+    core::Tensor coords = block_coords.To(GetPartitionDevice(i));
+    if (coords.GetLength() == 0) {
+        return coords;
+    }
+    return coords.IndexGet({GetPartitionIndices(coords).Eq(i)});
+}
+
+void DistributedVoxelBlockGrid::Integrate(const Image &depth,
+                                          const Image &color,
+                                          const core::Tensor &intrinsic,
+                                          const core::Tensor &extrinsic,
+                                          float depth_scale,
+                                          float depth_max,
+                                          float trunc_voxel_multiplier) {
+    AssertInitialized();
+    const bool integrate_color = color.AsTensor().NumElements() > 0;
+    ForEachPartition([&](int64_t i) {
+        const core::Device &device = devices_[i];
+        Image depth_i = depth.To(device);
+        core::Tensor block_coords = SelectPartitionBlockCoordinates(
+                partitions_[i].GetUniqueBlockCoordinates(
+                        depth_i, intrinsic, extrinsic, depth_scale, depth_max,
+                        trunc_voxel_multiplier),
+                i);
+        if (block_coords.GetLength() == 0) {
+            return;
+        }
+        if (integrate_color) {
+            partitions_[i].Integrate(block_coords, depth_i, color.To(device),
+                                     intrinsic, extrinsic, depth_scale,
+                                     depth_max, trunc_voxel_multiplier);
+        } else {
+            partitions_[i].Integrate(block_coords, depth_i, intrinsic,
+                                     extrinsic, depth_scale, depth_max,
+                                     trunc_voxel_multiplier);
+        }
+    });
+}
+
+void DistributedVoxelBlockGrid::Integrate(const Image &depth,
+                                          const core::Tensor &intrinsic,
+                                          const core::Tensor &extrinsic,
+                                          float depth_scale,
+                                          float depth_max,
+                                          float trunc_voxel_multiplier) {
+    Integrate(depth, Image(), intrinsic, extrinsic, depth_scale, depth_max,
+              trunc_voxel_multiplier);
+}
+
+TensorMap DistributedVoxelBlockGrid::RayCast(
+        const core::Tensor &block_coords,
+        const core::Tensor &intrinsic,
+        const core::Tensor &extrinsic,
+        int width,
+        int height,
+        const std::vector<std::string> attrs,
+        float depth_scale,
+        float depth_min,
+        float depth_max,
+        float weight_threshold,
+        float trunc_voxel_multiplier,
+        int range_map_down_factor) {
+    AssertInitialized();
+    static const std::unordered_set<std::string> kMergeableAttrs = {
+            "vertex", "normal", "depth", "color"};
+    // Depth selects the nearest surface among the partitions.
+    std::vector<std::string> partition_attrs = {"depth"};
+    for (const std::string &attr : attrs) {
+        if (kMergeableAttrs.count(attr) == 0) {
+            utility::LogError(
+                    "Unsupported attribute {} for distributed ray casting.",
+                    attr);
+        }
+        if (attr != "depth") {
+            partition_attrs.push_back(attr);
+        }
+    }
+
+    const int64_t n_partitions = GetPartitionCount();
+    std::vector<TensorMap> renderings(n_partitions, TensorMap("range"));
+    ForEachPartition([&](int64_t i) {
+        renderings[i] = partitions_[i].RayCast(
+                SelectPartitionBlockCoordinates(block_coords, i), intrinsic,
+                extrinsic, width, height, partition_attrs, depth_scale,
+                depth_min, depth_max, weight_threshold, trunc_voxel_multiplier,
+                range_map_down_factor);
+    });
+
+    const core::Device &device = devices_[0];
+    TensorMap renderings_map = renderings[0];
+    for (int64_t i = 1; i < n_partitions; ++i) {
+        core::Tensor depth = renderings_map["depth"].Reshape({height, width});
+        core::Tensor depth_i =
+                renderings[i]["depth"].To(device).Reshape({height, width});
+        core::Tensor mask = depth_i.Gt(0).LogicalAnd(
+                depth.Eq(0).LogicalOr(depth_i.Lt(depth)));
+        for (const std::string &attr : partition_attrs) {
+            renderings_map[attr].IndexSet(
+                    {mask}, renderings[i][attr].To(device).IndexGet({mask}));
+        }
+
+        // Merge the (min, max) depth ranges.
+        core::Tensor range = renderings_map["range"];
+        core::Tensor range_i = renderings[i]["range"].To(device);
+        core::Tensor range_min = range.Slice(2, 0, 1).Contiguous();
+        core::Tensor range_min_i = range_i.Slice(2, 0, 1).Contiguous();
+        core::Tensor range_max = range.Slice(2, 1, 2).Contiguous();
+        core::Tensor range_max_i = range_i.Slice(2, 1, 2).Contiguous();
+        core::Tensor min_mask = range_min_i.Lt(range_min);
+        core::Tensor max_mask = range_max_i.Gt(range_max);
+        range_min.IndexSet({min_mask}, range_min_i.IndexGet({min_mask}));
+        range_max.IndexSet({max_mask}, range_max_i.IndexGet({max_mask}));
+        renderings_map["range"] = core::Concatenate({range_min, range_max}, 2);
+    }
+
+    bool keep_depth = false;
+    for (const std::string &attr : attrs) {
+        keep_depth = keep_depth || attr == "depth";
+    }
+    if (!keep_depth) {
+        renderings_map.Erase("depth");
+    }
+    return renderings_map;
+}
+
+PointCloud DistributedVoxelBlockGrid::ExtractPointCloud(
+        float weight_threshold, int estimated_point_number) {
+    AssertInitialized();
+    const int64_t n_partitions = GetPartitionCount();
+    std::vector<PointCloud> pcds(n_partitions);
+    ForEachPartition([&](int64_t i) {
+        pcds[i] = partitions_[i].ExtractPointCloud(weight_threshold,
+                                                   estimated_point_number);
+    });
+
+    PointCloud pcd = pcds[0];
+    for (int64_t i = 1; i < n_partitions; ++i) {
+        if (pcds[i].IsEmpty()) {
+            continue;
+        }
+        pcd = pcd.IsEmpty() ? pcds[i].To(devices_[0])
+                            : pcd.Append(pcds[i].To(devices_[0]));
+    }
+    return pcd;
+}
+
+void DistributedVoxelBlockGrid::AssertInitialized() const {
+    if (partitions_.empty()) {
+        utility::LogError("DistributedVoxelBlockGrid not initialized.");
+    }
+}
+
+void DistributedVoxelBlockGrid::ForEachPartition(
+        const std::function<void(int64_t)> &func) {
+    const int64_t n_partitions = GetPartitionCount();
+    if (n_partitions == 1) {
+        func(0);
+        return;
+    }
+
+    std::vector<std::exception_ptr> errors(n_partitions);
+    std::vector<std::thread> threads;
+    for (int64_t i = 0; i < n_partitions; ++i) {
+        threads.emplace_back([&, i]() {
+            try {
+#ifdef BUILD_CUDA_MODULE
+                if (devices_[i].GetType() == core::Device::DeviceType::CUDA) {
+                    core::CUDAScopedDevice scoped_device(devices_[i]);
+                    func(i);
+                    return;
+                }
+#endif
+                func(i);
+            } catch (...) {
+                errors[i] = std::current_exception();
+            }
+        });
+    }
+    for (std::thread &thread : threads) {
+        thread.join();
+    }
+    for (const std::exception_ptr &error : errors) {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+}
+
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,169 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#pragma once
+
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/core/hashmap/HashMap.h"
+#include "open3d/t/geometry/Image.h"
+#include "open3d/t/geometry/PointCloud.h"
+#include "open3d/t/geometry/TensorMap.h"
+#include "open3d/t/geometry/VoxelBlockGrid.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+
+/// A voxel block grid distributed over several devices.
+/// The block coordinates are grouped into cubic chunks of
+/// partition_resolution^3 blocks, and each chunk is owned by the partition
+/// selected by the spatial hash of its coordinate. Every partition is a
+/// VoxelBlockGrid on its own device, so that the map size and the
+/// integration throughput scale with the number of devices. Integrate and
+/// RayCast run on all the partitions concurrently, each restricted to the
+/// blocks it owns, and their results are merged on the first device.
+/// Several partitions may share a device.
+/// Surfaces crossing a chunk boundary are split between partitions; ray
+/// casting and extraction do not interpolate across the boundary, which may
+/// leave one voxel wide seams. Larger chunks make seams rarer.
+class DistributedVoxelBlockGrid {
+public:
+    DistributedVoxelBlockGrid() = default;
+
+    /// \brief Constructor.
+    /// Example:
+    /// DistributedVoxelBlockGrid({"tsdf", "weight", "color"},
+    ///                           {core::Float32, core::UInt16, core::UInt16},
+    ///                           {{1}, {1}, {3}},
+    ///                           {core::Device("CUDA:0"),
+    ///                            core::Device("CUDA:1")},
+    ///                           0.005,
+    ///                           16,
+    ///                           10000);
+    /// \param devices Device of each partition.
+    /// \param block_count Initial number of blocks of each partition.
+    /// \param partition_resolution Number of blocks along each axis of a
+    /// chunk assigned to a single partition.
+    DistributedVoxelBlockGrid(
+            const std::vector<std::string> &attr_names,
+            const std::vector<core::Dtype> &attr_dtypes,
+            const std::vector<core::SizeVector> &attr_channels,
+            const std::vector<core::Device> &devices,
+            float voxel_size = 0.0058,
+            int64_t block_resolution = 16,
+            int64_t block_count = 10000,
+            int64_t partition_resolution = 8,
+            const core::HashBackendType &backend =
+                    core::HashBackendType::Default);
+
+    /// Number of partitions.
+    int64_t GetPartitionCount() const {
+        return static_cast<int64_t>(partitions_.size());
+    }
+
+    /// Get the voxel block grid of the i-th partition.
+    VoxelBlockGrid &GetPartition(int64_t i);
+
+    /// Get the device of the i-th partition.
+    core::Device GetPartitionDevice(int64_t i) const;
+
+    /// Total number of active blocks over all the partitions.
+    int64_t GetBlockCount();
+
+    /// Get the (N,) Int64 index of the partition owning each of the (N, 3)
+    /// Int32 block coordinates, on the device of \p block_coords.
+    core::Tensor GetPartitionIndices(const core::Tensor &block_coords) const;
+
+    /// Select the block coordinates owned by the i-th partition, on its
+    /// device.
+    core::Tensor SelectPartitionBlockCoordinates(
+            const core::Tensor &block_coords, int64_t i) const;
+
+    /// Specific operation for TSDF volumes.
+    /// Integrate an RGB-D frame into the partitions owning the blocks in its
+    /// frustum. Depth and color may be on any device. See
+    /// VoxelBlockGrid::Integrate.
+    void Integrate(const Image &depth,
+                   const Image &color,
+                   const core::Tensor &intrinsic,
+                   const core::Tensor &extrinsic,
+                   float depth_scale = 1000.0f,
+                   float depth_max = 3.0f,
+                   float trunc_voxel_multiplier = 8.0f);
+
+    /// Specific operation for TSDF volumes.
+    /// Similar to RGB-D integration, but only applied to depth.
+    void Integrate(const Image &depth,
+                   const core::Tensor &intrinsic,
+                   const core::Tensor &extrinsic,
+                   float depth_scale = 1000.0f,
+                   float depth_max = 3.0f,
+                   float trunc_voxel_multiplier = 8.0f);
+
+    /// Specific operation for TSDF volumes.
+    /// Perform volumetric ray casting in the selected block coordinates on
+    /// every partition, and keep the nearest surface of each pixel. Supports
+    /// the conventional rendering attributes vertex, depth, color and normal.
+    /// Results are on the device of the first partition. See
+    /// VoxelBlockGrid::RayCast.
+    TensorMap RayCast(const core::Tensor &block_coords,
+                      const core::Tensor &intrinsic,
+                      const core::Tensor &extrinsic,
+                      int width,
+                      int height,
+                      const std::vector<std::string> attrs = {"depth", "color"},
+                      float depth_scale = 1000.0f,
+                      float depth_min = 0.1f,
+                      float depth_max = 3.0f,
+                      float weight_threshold = 3.0f,
+                      float trunc_voxel_multiplier = 8.0f,
+                      int range_map_down_factor = 8);
+
+    /// Specific operation for TSDF volumes.
+    /// Extract the point cloud of every partition and concatenate them on the
+    /// device of the first partition.
+    PointCloud ExtractPointCloud(float weight_threshold = 3.0f,
+                                 int estimated_point_number = -1);
+
+private:
+    void AssertInitialized() const;
+
+    /// Runs func(i) for every partition, with one thread per partition.
+    void ForEachPartition(const std::function<void(int64_t)> &func);
+
+    int64_t partition_resolution_ = -1;
+    std::vector<VoxelBlockGrid> partitions_;
+    std::vector<core::Device> devices_;
+};
+
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
@@ -26,7 +26,11 @@
 
 #include "open3d/t/geometry/Image.h"
 
+#include <cmath>
+#include <map>
+#include <mutex>
 #include <string>
+#include <tuple>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -35,6 +39,7 @@
 #include "open3d/core/Dtype.h"
 #include "open3d/core/ShapeUtil.h"
 #include "open3d/core/Tensor.h"
+#include "open3d/core/TensorCheck.h"
 #include "open3d/t/geometry/kernel/IPPImage.h"
 #include "open3d/t/geometry/kernel/Image.h"
 #include "open3d/t/geometry/kernel/NPPImage.h"
@@ -314,6 +319,8 @@ Image Image::Filter(const core::Tensor &kernel) const {
                std::count(ipp_supported.begin(), ipp_supported.end(),
                           std::make_pair(GetDtype(), GetChannels())) > 0) {
         IPP_CALL(ipp::Filter, data_, dst_im.data_, kernel);
+    } else if (GetDtype() != core::Bool) {
+        kernel::image::Filter(data_, dst_im.data_, kernel);
     } else {
         utility::LogError(
                 "Filter with data type {} on device {} is not "
@@ -351,6 +358,19 @@ Image Image::FilterGaussian(int kernel_size, float sigma) const {
                std::count(ipp_supported.begin(), ipp_supported.end(),
                           std::make_pair(GetDtype(), GetChannels())) > 0) {
         IPP_CALL(ipp::FilterGaussian, data_, dst_im.data_, kernel_size, sigma);
+    } else if (GetDtype() != core::Bool) {
+        std::vector<float> weights(kernel_size);
+        float sum = 0;
+        for (int i = 0; i < kernel_size; ++i) {
+            const float d = static_cast<float>(i - kernel_size / 2);
+            weights[i] = std::exp(-0.5f * d * d / (sigma * sigma));
+            sum += weights[i];
+        }
+        for (float &w : weights) {
+            w /= sum;
+        }
+        const core::Tensor kernel(weights, {kernel_size}, core::Float32);
+        kernel::image::FilterSeparable(data_, dst_im.data_, kernel, kernel);
     } else {
         utility::LogError(
                 "FilterGaussian with data type {} on device {} is not "
@@ -402,6 +422,21 @@ std::pair<Image, Image> Image::FilterSobel(int kernel_size) const {
                           std::make_pair(GetDtype(), GetChannels())) > 0) {
         IPP_CALL(ipp::FilterSobel, data_, dst_im_dx.data_, dst_im_dy.data_,
                  kernel_size);
+    } else if (dtype == core::Float32 || dtype == core::UInt8) {
+        // The Sobel kernels are the outer products of a smoothing and a
+        // central difference kernel.
+        const std::vector<float> smooth =
+                kernel_size == 3 ? std::vector<float>{1, 2, 1}
+                                 : std::vector<float>{1, 4, 6, 4, 1};
+        const std::vector<float> diff =
+                kernel_size == 3 ? std::vector<float>{-1, 0, 1}
+                                 : std::vector<float>{-1, -2, 0, 2, 1};
+        const core::Tensor kernel_smooth(smooth, {kernel_size}, core::Float32);
+        const core::Tensor kernel_diff(diff, {kernel_size}, core::Float32);
+        kernel::image::FilterSeparable(data_, dst_im_dx.data_, kernel_diff,
+                                       kernel_smooth);
+        kernel::image::FilterSeparable(data_, dst_im_dy.data_, kernel_smooth,
+                                       kernel_diff);
     } else {
         utility::LogError(
                 "FilterSobel with data type {} on device {} is not "
@@ -411,9 +446,103 @@ std::pair<Image, Image> Image::FilterSobel(int kernel_size) const {
     return std::make_pair(dst_im_dx, dst_im_dy);
 }
 
+Image Image::Remap(const core::Tensor &map_x,
+                   const core::Tensor &map_y,
+                   InterpType interp_type,
+                   float fill) const {
+    core::AssertTensorShape(map_x, {utility::nullopt, utility::nullopt});
+    Image dst_im;
+    dst_im.data_ = core::Tensor::Empty(
+            {map_x.GetShape(0), map_x.GetShape(1), GetChannels()}, GetDtype(),
+            GetDevice());
+    kernel::image::Remap(data_, dst_im.data_, map_x, map_y, interp_type, fill);
+    return dst_im;
+}
+
+namespace {
+/// Undistortion lookup tables, keyed by the camera parameters, image size
+/// and device. Cameras rarely change within a process, so the cache is
+/// simply cleared when it grows past a few entries.
+class UndistortionMapCache {
+public:
+    std::pair<core::Tensor, core::Tensor> Get(const core::Tensor &intrinsics,
+                                              const core::Tensor &distortion,
+                                              int64_t rows,
+                                              int64_t cols,
+                                              const core::Device &device) {
+        static const core::Device host("CPU:0");
+        const core::Tensor intrinsics_d =
+                intrinsics.To(host, core::Float64).Contiguous();
+        const core::Tensor distortion_d =
+                distortion.To(host, core::Float64).Contiguous();
+        Key key{intrinsics_d.ToFlatVector<double>(),
+                distortion_d.ToFlatVector<double>(), rows, cols,
+                device.ToString()};
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = maps_.find(key);
+        if (it != maps_.end()) {
+            return it->second;
+        }
+        core::Tensor map_x =
+                core::Tensor::Empty({rows, cols}, core::Float32, device);
+        core::Tensor map_y =
+                core::Tensor::Empty({rows, cols}, core::Float32, device);
+        kernel::image::CreateUndistortionMaps(intrinsics_d, distortion_d,
+                                              map_x, map_y);
+        if (maps_.size() >= kMaxEntries) {
+            maps_.clear();
+        }
+        maps_.emplace(key, std::make_pair(map_x, map_y));
+        return std::make_pair(map_x, map_y);
+    }
+
+private:
+    using Key = std::tuple<std::vector<double>,
+                           std::vector<double>,
+                           int64_t,
+                           int64_t,
+                           std::string>;
+    static constexpr size_t kMaxEntries = 8;
+    std::mutex mutex_;
+    std::map<Key, std::pair<core::Tensor, core::Tensor>> maps_;
+};
+}  // namespace
+
+Image Image::Undistort(const core::Tensor &intrinsics,
+                       const core::Tensor &distortion,
+                       InterpType interp_type) const {
+    static UndistortionMapCache cache;
+    core::Tensor map_x, map_y;
+    std::tie(map_x, map_y) = cache.Get(intrinsics, distortion, GetRows(),
+                                       GetCols(), GetDevice());
+    return Remap(map_x, map_y, interp_type);
+}
+
 Image Image::PyrDown() const {
-    Image blur = FilterGaussian(5, 1.0f);
-    return blur.Resize(0.5, InterpType::Nearest);
+    // Intersection of the FilterGaussian and Resize engine support.
+    static const dtype_channels_pairs engine_supported{
+            {core::UInt8, 1}, {core::UInt16, 1}, {core::Float32, 1},
+            {core::UInt8, 3}, {core::UInt16, 3}, {core::Float32, 3},
+            {core::UInt8, 4}, {core::UInt16, 4}, {core::Float32, 4},
+    };
+    const bool has_engine =
+            data_.GetDevice().GetType() == core::Device::DeviceType::CUDA ||
+            (HAVE_IPPICV &&
+             data_.GetDevice().GetType() == core::Device::DeviceType::CPU);
+    if (has_engine &&
+        std::count(engine_supported.begin(), engine_supported.end(),
+                   std::make_pair(GetDtype(), GetChannels())) > 0) {
+        Image blur = FilterGaussian(5, 1.0f);
+        return blur.Resize(0.5, InterpType::Nearest);
+    }
+
+    Image dst_im;
+    dst_im.data_ = core::Tensor::Empty(
+            {GetRows() / 2, GetCols() / 2, GetChannels()}, GetDtype(),
+            GetDevice());
+    kernel::image::PyrDown(data_, dst_im.data_);
+    return dst_im;
 }
 
 Image Image::PyrDownDepth(float diff_threshold, float invalid_fill) const {
@@ -521,6 +650,62 @@ Image Image::ColorizeDepth(float scale, float min_value, float max_value) {
     return dst_im;
 }
 
+core::Tensor Image::PyrDownBatch(const core::Tensor &images) {
+    core::AssertTensorShape(images, {utility::nullopt, utility::nullopt,
+                                     utility::nullopt, utility::nullopt});
+    core::Tensor dst = core::Tensor::Empty(
+            {images.GetShape(0), images.GetShape(1) / 2, images.GetShape(2) / 2,
+             images.GetShape(3)},
+            images.GetDtype(), images.GetDevice());
+    kernel::image::PyrDown(images.Contiguous(), dst);
+    return dst;
+}
+
+core::Tensor Image::PyrDownDepthBatch(const core::Tensor &depths,
+                                      float diff_threshold,
+                                      float invalid_fill) {
+    core::AssertTensorShape(depths, {utility::nullopt, utility::nullopt,
+                                     utility::nullopt, 1});
+    core::AssertTensorDtype(depths, core::Float32);
+    core::Tensor dst = core::Tensor::Empty(
+            {depths.GetShape(0), depths.GetShape(1) / 2, depths.GetShape(2) / 2,
+             1},
+            core::Float32, depths.GetDevice());
+    kernel::image::PyrDownDepth(depths.Contiguous(), dst, diff_threshold,
+                                invalid_fill);
+    return dst;
+}
+
+core::Tensor Image::CreateVertexMapBatch(const core::Tensor &depths,
+                                         const core::Tensor &intrinsics,
+                                         float invalid_fill) {
+    core::AssertTensorShape(depths, {utility::nullopt, utility::nullopt,
+                                     utility::nullopt, 1});
+    core::AssertTensorDtype(depths, core::Float32);
+    if (intrinsics.NumDims() == 3) {
+        core::AssertTensorShape(intrinsics, {depths.GetShape(0), 3, 3});
+    } else {
+        core::AssertTensorShape(intrinsics, {3, 3});
+    }
+    core::Tensor dst = core::Tensor::Empty(
+            {depths.GetShape(0), depths.GetShape(1), depths.GetShape(2), 3},
+            core::Float32, depths.GetDevice());
+    kernel::image::CreateVertexMap(depths.Contiguous(), dst, intrinsics,
+                                   invalid_fill);
+    return dst;
+}
+
+core::Tensor Image::CreateNormalMapBatch(const core::Tensor &vertex_maps,
+                                         float invalid_fill) {
+    core::AssertTensorShape(vertex_maps, {utility::nullopt, utility::nullopt,
+                                          utility::nullopt, 3});
+    core::AssertTensorDtype(vertex_maps, core::Float32);
+    core::Tensor dst = core::Tensor::EmptyLike(vertex_maps);
+    kernel::image::CreateNormalMap(vertex_maps.Contiguous(), dst,
+                                   invalid_fill);
+    return dst;
+}
+
 Image Image::FromLegacy(const open3d::geometry::Image &image_legacy,
                         const core::Device &device) {
     static const std::unordered_map<int, core::Dtype> kBytesToDtypeMap = {
@@ -32,6 +32,7 @@
 #include <vector>
 
 #include "open3d/core/Dtype.h"
+#include "open3d/core/Future.h"
 #include "open3d/core/Tensor.h"
 #include "open3d/core/kernel/UnaryEW.h"
 #include "open3d/geometry/Image.h"
@@ -149,12 +150,32 @@ public:
     /// copy is avoided when the original image is already on the targeted
     /// device.
     Image To(const core::Device &device, bool copy = false) const {
+        if (device.GetType() == core::Device::DeviceType::CUDA) {
+            return ToAsync(device, copy).WaitOnStream();
+        }
         return Image(data_.To(device, copy));
     }
 
+    /// \brief Asynchronous version of To(device, copy), see
+    /// core::Tensor::ToAsync(). With a pinned image (see PinMemory()), the
+    /// upload to a CUDA device overlaps with host work until the returned
+    /// future is waited on.
+    core::Future<Image> ToAsync(const core::Device &device,
+                                bool copy = false) const {
+        const core::TensorFuture data = data_.ToAsync(device, copy);
+        return core::Future<Image>(Image(data.GetUnsafe()), data.GetEvent());
+    }
+
     /// \brief Returns copy of the image on the same device.
     Image Clone() const { return To(GetDevice(), /*copy=*/true); }
 
+    /// \brief Returns the image in pinned host memory, so that To() a CUDA
+    /// device is faster and asynchronous. The image must be on the CPU.
+    Image PinMemory() const { return Image(data_.PinMemory()); }
+
+    /// \brief Returns true if the image resides in pinned host memory.
+    bool IsPinned() const { return data_.IsPinned(); }
+
     /// \brief Returns an Image with the specified \p dtype.
     ///
     /// \param dtype The targeted dtype to convert to.
@@ -213,6 +234,9 @@ public:
     Image Dilate(int kernel_size = 3) const;
 
     /// \brief Return a new image after filtering with the given kernel.
+    ///
+    /// Without IPP (CPU) or NPP (CUDA) support for the dtype, a generic kernel
+    /// is used, which applies rank-1 kernels as two 1D passes.
     Image Filter(const core::Tensor &kernel) const;
 
     /// \brief Return a new image after bilateral filtering.
@@ -241,10 +265,44 @@ public:
     /// \param kernel_size: Sobel filter kernel size, either 3 or 5.
     std::pair<Image, Image> FilterSobel(int kernel_size = 3) const;
 
+    /// \brief Return a new image sampled from this image at the given
+    /// coordinates.
+    ///
+    /// The output pixel (r, c) reads this image at column map_x(r, c) and row
+    /// map_y(r, c). All dtypes except Bool and any number of channels are
+    /// supported on CPU and CUDA.
+    ///
+    /// \param map_x Column coordinates of shape (rows_out, cols_out).
+    /// \param map_y Row coordinates of the same shape as \p map_x.
+    /// \param interp_type InterpType::Nearest or InterpType::Linear.
+    /// \param fill Value read for samples outside of the image.
+    Image Remap(const core::Tensor &map_x,
+                const core::Tensor &map_y,
+                InterpType interp_type = InterpType::Linear,
+                float fill = 0.0f) const;
+
+    /// \brief Return a new image with lens distortion removed.
+    ///
+    /// Uses the Brown-Conrady model with the OpenCV coefficient order
+    /// (k1, k2, p1, p2[, k3]). The undistorted image has the same size and
+    /// intrinsic matrix as this image. The lookup tables are computed once
+    /// per (intrinsics, distortion, image size, device) and cached, so
+    /// undistorting a stream of frames from the same camera only costs a
+    /// Remap per frame.
+    ///
+    /// \param intrinsics Pinhole camera matrix of shape (3, 3).
+    /// \param distortion Distortion coefficients of shape (4,) or (5,).
+    /// \param interp_type InterpType::Nearest or InterpType::Linear.
+    Image Undistort(const core::Tensor &intrinsics,
+                    const core::Tensor &distortion,
+                    InterpType interp_type = InterpType::Linear) const;
+
     /// \brief Return a new downsampled image with pyramid downsampling.
     ///
     /// The returned image is formed by a chained Gaussian filter (kernel_size =
-    /// 5, sigma = 1.0) and a resize (ratio = 0.5) operation.
+    /// 5, sigma = 1.0) and a resize (ratio = 0.5) operation. Without IPP (CPU)
+    /// or NPP (CUDA) support for the dtype, the generic PyrDownBatch kernel is
+    /// used.
     ///
     /// \returns Half sized downsampled depth image.
     Image PyrDown() const;
@@ -322,6 +380,43 @@ public:
     /// Dtype UInt8.
     Image ColorizeDepth(float scale, float min_value, float max_value);
 
+    /// \brief Batched PyrDown on a stack of images.
+    ///
+    /// All images are downsampled in a single kernel launch, which avoids the
+    /// per-image launch overhead for multi-camera or multi-frame inputs.
+    ///
+    /// \param images Tensor of shape (batch, rows, cols, channels). All
+    /// dtypes except Bool are supported.
+    ///
+    /// \returns Tensor of shape (batch, rows / 2, cols / 2, channels).
+    static core::Tensor PyrDownBatch(const core::Tensor &images);
+
+    /// \brief Batched PyrDownDepth on a stack of Float32 depth images of
+    /// shape (batch, rows, cols, 1).
+    ///
+    /// \returns Tensor of shape (batch, rows / 2, cols / 2, 1).
+    static core::Tensor PyrDownDepthBatch(const core::Tensor &depths,
+                                          float diff_threshold,
+                                          float invalid_fill = 0.f);
+
+    /// \brief Batched CreateVertexMap on a stack of Float32 depth images of
+    /// shape (batch, rows, cols, 1).
+    ///
+    /// \param intrinsics Pinhole camera model of shape (3, 3), shared by all
+    /// images, or (batch, 3, 3) with one camera per image.
+    ///
+    /// \returns Vertex maps of shape (batch, rows, cols, 3) and Dtype Float32.
+    static core::Tensor CreateVertexMapBatch(const core::Tensor &depths,
+                                             const core::Tensor &intrinsics,
+                                             float invalid_fill = 0.0f);
+
+    /// \brief Batched CreateNormalMap on a stack of Float32 vertex maps of
+    /// shape (batch, rows, cols, 3).
+    ///
+    /// \returns Normal maps of shape (batch, rows, cols, 3) and Dtype Float32.
+    static core::Tensor CreateNormalMapBatch(const core::Tensor &vertex_maps,
+                                             float invalid_fill = 0.0f);
+
     /// \brief Compute min 2D coordinates for the data (always {0, 0}).
     core::Tensor GetMinBound() const {
         return core::Tensor::Zeros({2}, core::Int64);
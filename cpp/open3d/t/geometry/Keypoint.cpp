@@ -0,0 +1,125 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/t/geometry/Keypoint.h"
+
+#include <cmath>
+
+#include "open3d/core/CUDAUtils.h"
+#include "open3d/core/TensorCheck.h"
+#include "open3d/core/nns/NearestNeighborSearch.h"
+#include "open3d/t/geometry/kernel/PointCloud.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+namespace keypoint {
+
+namespace {
+
+/// Mean distance of the points to their nearest neighbor.
+double ComputeModelResolution(const core::Tensor &points) {
+    core::nns::NearestNeighborSearch tree(points);
+    if (!tree.KnnIndex()) {
+        utility::LogError("Building KnnIndex failed.");
+    }
+    core::Tensor indices, distances2;
+    std::tie(indices, distances2) = tree.KnnSearch(points, 2);
+    return distances2.Slice(1, 1, 2)
+            .To(core::Float64)
+            .Sqrt()
+            .Mean({0, 1})
+            .Item<double>();
+}
+
+}  // namespace
+
+PointCloud ComputeISSKeypoints(const PointCloud &input,
+                               double salient_radius,
+                               double non_max_radius,
+                               double gamma_21,
+                               double gamma_32,
+                               int min_neighbors,
+                               int max_nn) {
+    if (!input.HasPointPositions() ||
+        input.GetPointPositions().GetLength() == 0) {
+        utility::LogWarning("[ComputeISSKeypoints] Input PointCloud is empty!");
+        return PointCloud(input.GetDevice());
+    }
+    if (max_nn <= 0) {
+        utility::LogError("max_nn must be positive, but got {}.", max_nn);
+    }
+    core::AssertTensorDtypes(input.GetPointPositions(),
+                             {core::Float32, core::Float64});
+    const core::Tensor points = input.GetPointPositions().Contiguous();
+    const core::Device device = points.GetDevice();
+    const int64_t num_points = points.GetLength();
+
+    if (salient_radius == 0.0 || non_max_radius == 0.0) {
+        if (num_points < 2) {
+            return input.SelectPoints(
+                    core::Tensor::Zeros({num_points}, core::Bool, device));
+        }
+        const double resolution = ComputeModelResolution(points);
+        salient_radius = 6 * resolution;
+        non_max_radius = 4 * resolution;
+        utility::LogDebug(
+                "[ComputeISSKeypoints] Computed salient_radius = {}, "
+                "non_max_radius = {} from input model",
+                salient_radius, non_max_radius);
+    }
+
+    core::Tensor saliency =
+            core::Tensor::Empty({num_points}, points.GetDtype(), device);
+    core::Tensor mask = core::Tensor::Empty({num_points}, core::Bool, device);
+    if (device.GetType() == core::Device::DeviceType::CPU) {
+        kernel::pointcloud::ComputeISSSaliencyCPU(points, saliency,
+                                                  salient_radius, max_nn,
+                                                  gamma_21, gamma_32,
+                                                  min_neighbors);
+        kernel::pointcloud::ISSNonMaxSuppressionCPU(
+                points, saliency, mask, non_max_radius, max_nn, min_neighbors);
+    } else if (device.GetType() == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(kernel::pointcloud::ComputeISSSaliencyCUDA, points, saliency,
+                  salient_radius, max_nn, gamma_21, gamma_32, min_neighbors);
+        CUDA_CALL(kernel::pointcloud::ISSNonMaxSuppressionCUDA, points,
+                  saliency, mask, non_max_radius, max_nn, min_neighbors);
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+
+    PointCloud keypoints = input.SelectPoints(mask);
+    utility::LogDebug("[ComputeISSKeypoints] Extracted {} keypoints",
+                      keypoints.GetPointPositions().GetLength());
+    return keypoints;
+}
+
+}  // namespace keypoint
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
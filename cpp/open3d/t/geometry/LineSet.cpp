@@ -32,7 +32,9 @@
 #include "open3d/core/ShapeUtil.h"
 #include "open3d/core/Tensor.h"
 #include "open3d/core/TensorCheck.h"
+#include "open3d/core/TensorFunction.h"
 #include "open3d/core/linalg/Matmul.h"
+#include "open3d/t/geometry/PointCloud.h"
 #include "open3d/t/geometry/TensorMap.h"
 #include "open3d/t/geometry/kernel/Transform.h"
 
@@ -204,6 +206,165 @@ open3d::geometry::LineSet LineSet::ToLegacy() const {
     return lineset_legacy;
 }
 
+LineSet LineSet::CreateFromPointCloudCorrespondences(
+        const PointCloud &source,
+        const PointCloud &target,
+        const core::Tensor &correspondences) {
+    const core::Device device = source.GetDevice();
+    const core::Tensor &source_points = source.GetPointPositions();
+    const core::Tensor &target_points = target.GetPointPositions();
+    core::AssertTensorDevice(target_points, device);
+    core::AssertTensorDtype(target_points, source_points.GetDtype());
+    core::AssertTensorDevice(correspondences, device);
+    core::AssertTensorDtype(correspondences, core::Int64);
+
+    core::Tensor source_indices, target_indices;
+    const int64_t ndims = correspondences.NumDims();
+    if (ndims == 2 && correspondences.GetShape(1) == 2) {
+        source_indices = correspondences.Slice(1, 0, 1).Flatten();
+        target_indices = correspondences.Slice(1, 1, 2).Flatten();
+    } else if (ndims == 1 ||
+               (ndims == 2 && correspondences.GetShape(1) == 1)) {
+        // Target index per source point, with -1 for no correspondence.
+        const core::Tensor target_map = correspondences.Flatten();
+        const core::Tensor valid = target_map.Ne(-1);
+        source_indices = valid.NonZero().Flatten();
+        target_indices = target_map.IndexGet({valid});
+        if (target_map.GetLength() > source_points.GetLength()) {
+            utility::LogError(
+                    "Got {} correspondences for a source with {} points.",
+                    target_map.GetLength(), source_points.GetLength());
+        }
+    } else {
+        utility::LogError(
+                "Correspondences must be of shape {{N, 2}}, {{S}} or {{S, 1}}, "
+                "but got {}.",
+                correspondences.GetShape());
+    }
+
+    const int64_t n = source_indices.GetLength();
+    if (n > 0 &&
+        (source_indices.Min({0}).Item<int64_t>() < 0 ||
+         source_indices.Max({0}).Item<int64_t>() >=
+                 source_points.GetLength() ||
+         target_indices.Min({0}).Item<int64_t>() < 0 ||
+         target_indices.Max({0}).Item<int64_t>() >=
+                 target_points.GetLength())) {
+        utility::LogError("Correspondence indices are out of range.");
+    }
+
+    const core::Tensor line_starts =
+            core::Tensor::Arange(0, n, 1, core::Int64, device).Reshape({n, 1});
+    return LineSet(
+            core::Concatenate({source_points.IndexGet({source_indices}),
+                               target_points.IndexGet({target_indices})},
+                              0),
+            core::Concatenate({line_starts, line_starts + n}, 1));
+}
+
+/// Lines joining the 8 corners of each box, for corners of shape {N, 8, 3} in
+/// the order of open3d::geometry::OrientedBoundingBox::GetBoxPoints.
+static LineSet CreateFromBoxCorners(const core::Tensor &corners,
+                                    const core::Tensor &colors) {
+    const core::Device device = corners.GetDevice();
+    const int64_t n = corners.GetLength();
+    const core::Tensor box_lines =
+            core::Tensor::Init<int64_t>({{0, 1},
+                                         {1, 7},
+                                         {7, 2},
+                                         {2, 0},
+                                         {3, 6},
+                                         {6, 4},
+                                         {4, 5},
+                                         {5, 3},
+                                         {0, 3},
+                                         {1, 6},
+                                         {7, 4},
+                                         {2, 5}},
+                                        device);
+    const core::Tensor box_offsets =
+            core::Tensor::Arange(0, n * 8, 8, core::Int64, device)
+                    .Reshape({n, 1, 1});
+    LineSet lineset(corners.Reshape({n * 8, 3}),
+                    (box_lines.Reshape({1, 12, 2}) + box_offsets)
+                            .Reshape({n * 12, 2}));
+    if (colors.NumElements() > 0) {
+        core::AssertTensorShape(colors, {n, 3});
+        core::AssertTensorDevice(colors, device);
+        lineset.SetLineColors(colors.Reshape({n, 1, 3})
+                                      .Expand({n, 12, 3})
+                                      .Contiguous()
+                                      .Reshape({n * 12, 3}));
+    }
+    return lineset;
+}
+
+/// Signs of the box axes for the 8 corners of
+/// open3d::geometry::OrientedBoundingBox::GetBoxPoints.
+static core::Tensor BoxCornerSigns(core::Dtype dtype,
+                                   const core::Device &device) {
+    return core::Tensor::Init<double>({{-1, -1, -1},
+                                       {1, -1, -1},
+                                       {-1, 1, -1},
+                                       {-1, -1, 1},
+                                       {1, 1, 1},
+                                       {-1, 1, 1},
+                                       {1, -1, 1},
+                                       {1, 1, -1}},
+                                      device)
+            .To(dtype);
+}
+
+LineSet LineSet::CreateFromOrientedBoundingBoxes(
+        const core::Tensor &centers,
+        const core::Tensor &extents,
+        const core::Tensor &rotations,
+        const core::Tensor &colors) {
+    core::AssertTensorShape(centers, {utility::nullopt, 3});
+    core::AssertTensorDtypes(centers, {core::Float32, core::Float64});
+    const int64_t n = centers.GetLength();
+    const core::Device device = centers.GetDevice();
+    const core::Dtype dtype = centers.GetDtype();
+    core::AssertTensorShape(extents, {n, 3});
+    core::AssertTensorShape(rotations, {n, 3, 3});
+    core::AssertTensorDevice(extents, device);
+    core::AssertTensorDevice(rotations, device);
+    core::AssertTensorDtype(extents, dtype);
+    core::AssertTensorDtype(rotations, dtype);
+
+    // corners[i, j] = centers[i] + rotations[i] @ (signs[j] * extents[i] / 2)
+    const core::Tensor signs = BoxCornerSigns(dtype, device);
+    const core::Tensor local =
+            signs.Reshape({1, 8, 3}) * (extents * 0.5).Reshape({n, 1, 3});
+    const core::Tensor corners =
+            (local.Reshape({n, 8, 1, 3}) * rotations.Reshape({n, 1, 3, 3}))
+                    .Sum({3}) +
+            centers.Reshape({n, 1, 3});
+    return CreateFromBoxCorners(corners, colors);
+}
+
+LineSet LineSet::CreateFromAxisAlignedBoundingBoxes(
+        const core::Tensor &min_bounds,
+        const core::Tensor &max_bounds,
+        const core::Tensor &colors) {
+    core::AssertTensorShape(min_bounds, {utility::nullopt, 3});
+    core::AssertTensorDtypes(min_bounds, {core::Float32, core::Float64});
+    const int64_t n = min_bounds.GetLength();
+    core::AssertTensorShape(max_bounds, {n, 3});
+    core::AssertTensorDevice(max_bounds, min_bounds.GetDevice());
+    core::AssertTensorDtype(max_bounds, min_bounds.GetDtype());
+
+    // Weights of 0 select the minimum bound and weights of 1 the maximum
+    // bound, exactly.
+    const core::Tensor signs =
+            BoxCornerSigns(min_bounds.GetDtype(), min_bounds.GetDevice());
+    const core::Tensor max_weights = ((signs + 1) * 0.5).Reshape({1, 8, 3});
+    const core::Tensor corners =
+            min_bounds.Reshape({n, 1, 3}) * (1 - max_weights) +
+            max_bounds.Reshape({n, 1, 3}) * max_weights;
+    return CreateFromBoxCorners(corners, colors);
+}
+
 }  // namespace geometry
 }  // namespace t
 }  // namespace open3d
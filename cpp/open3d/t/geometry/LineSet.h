@@ -40,6 +40,8 @@ namespace open3d {
 namespace t {
 namespace geometry {
 
+class PointCloud;
+
 /// \class LineSet
 /// \brief A LineSet contains points and lines joining them and optionally
 /// attributes on the points and lines.
@@ -366,6 +368,55 @@ public:
     /// Convert to a legacy Open3D LineSet.
     open3d::geometry::LineSet ToLegacy() const;
 
+    /// \brief Create a LineSet joining corresponding points of two point
+    /// clouds, e.g. to visualize ICP correspondences.
+    ///
+    /// Only the points referenced by the correspondences are copied: line i
+    /// joins point i, taken from \p source, to point i + N, taken from \p
+    /// target, for N correspondences. All the work is done on the device of
+    /// the point clouds.
+    ///
+    /// \param source The source point cloud.
+    /// \param target The target point cloud.
+    /// \param correspondences Int64 tensor on the device of the point clouds,
+    /// either of shape {N, 2} with (source, target) index pairs, or of shape
+    /// {S} or {S, 1} with the target index of each source point and -1 for
+    /// none, as in t::pipelines::registration::RegistrationResult.
+    static LineSet CreateFromPointCloudCorrespondences(
+            const PointCloud &source,
+            const PointCloud &target,
+            const core::Tensor &correspondences);
+
+    /// \brief Create a LineSet with the 12 edges of each of N oriented boxes.
+    ///
+    /// Box i has the points 8i to 8i + 7, in the order of
+    /// open3d::geometry::OrientedBoundingBox::GetBoxPoints, and the lines 12i
+    /// to 12i + 11.
+    ///
+    /// \param centers Box centers of shape {N, 3}, Float32 or Float64.
+    /// \param extents Box side lengths of shape {N, 3} along the box axes.
+    /// \param rotations Rotations of shape {N, 3, 3}, whose columns are the
+    /// box axes.
+    /// \param colors Optional box colors of shape {N, 3}, assigned to the
+    /// lines of each box.
+    static LineSet CreateFromOrientedBoundingBoxes(
+            const core::Tensor &centers,
+            const core::Tensor &extents,
+            const core::Tensor &rotations,
+            const core::Tensor &colors = core::Tensor());
+
+    /// \brief Create a LineSet with the 12 edges of each of N axis-aligned
+    /// boxes, with the layout of CreateFromOrientedBoundingBoxes.
+    ///
+    /// \param min_bounds Minimum bounds of shape {N, 3}, Float32 or Float64.
+    /// \param max_bounds Maximum bounds of shape {N, 3}.
+    /// \param colors Optional box colors of shape {N, 3}, assigned to the
+    /// lines of each box.
+    static LineSet CreateFromAxisAlignedBoundingBoxes(
+            const core::Tensor &min_bounds,
+            const core::Tensor &max_bounds,
+            const core::Tensor &colors = core::Tensor());
+
 protected:
     core::Device device_ = core::Device("CPU:0");
     TensorMap point_attr_;
@@ -27,7 +27,11 @@
 #include "open3d/t/geometry/PointCloud.h"
 
 #include <Eigen/Core>
+#include <algorithm>
+#include <atomic>
+#include <functional>
 #include <limits>
+#include <random>
 #include <string>
 #include <unordered_map>
 
@@ -36,14 +40,21 @@
 #include "open3d/core/ShapeUtil.h"
 #include "open3d/core/Tensor.h"
 #include "open3d/core/TensorCheck.h"
+#include "open3d/core/TensorFunction.h"
 #include "open3d/core/hashmap/HashSet.h"
+#include "open3d/core/kernel/ConnectedComponents.h"
+#include "open3d/core/kernel/Sparse.h"
 #include "open3d/core/linalg/Matmul.h"
 #include "open3d/core/nns/NearestNeighborSearch.h"
+#include "open3d/geometry/Qhull.h"
 #include "open3d/t/geometry/TensorMap.h"
+#include "open3d/t/geometry/TriangleMesh.h"
 #include "open3d/t/geometry/kernel/GeometryMacros.h"
 #include "open3d/t/geometry/kernel/PointCloud.h"
 #include "open3d/t/geometry/kernel/Transform.h"
 #include "open3d/t/pipelines/registration/Registration.h"
+#include "open3d/utility/Parallel.h"
+#include "open3d/utility/ProgressBar.h"
 
 namespace open3d {
 namespace t {
@@ -107,10 +118,131 @@ core::Tensor PointCloud::GetCenter() const {
     return GetPointPositions().Mean({0});
 }
 
+namespace {
+
+/// Points grouped by cluster, for the segment reductions.
+struct ClusterSegments {
+    /// Float64 positions of the labeled points, sorted by label.
+    core::Tensor points_;
+    /// Labels that have points, and the index of each sorted point into them.
+    core::Tensor labels_;
+    core::Tensor inverse_;
+    /// Int64 row splits of the sorted points, one segment per label in
+    /// labels_.
+    core::Tensor row_splits_;
+    /// Largest label + 1.
+    int64_t num_clusters_ = 0;
+};
+
+ClusterSegments GroupPointsByCluster(const core::Tensor &positions,
+                                     const core::Tensor &labels) {
+    core::AssertTensorShape(labels, {positions.GetLength()});
+    core::AssertTensorDtypes(labels, {core::Int32, core::Int64});
+    core::AssertTensorDevice(labels, positions.GetDevice());
+
+    ClusterSegments segments;
+    const core::Tensor valid = labels.Ge(0).NonZero().Flatten();
+    if (valid.GetLength() == 0) {
+        return segments;
+    }
+    const core::Tensor valid_labels = labels.IndexGet({valid}).To(core::Int64);
+    const core::Tensor order = valid_labels.ArgSort();
+    const core::Tensor sorted_labels = valid_labels.IndexGet({order});
+    segments.points_ =
+            positions.IndexGet({valid.IndexGet({order})}).To(core::Float64);
+    core::Tensor counts;
+    std::tie(segments.labels_, segments.inverse_, counts) =
+            sorted_labels.UniqueWithInverseAndCounts();
+    segments.row_splits_ = core::Concatenate(
+            {core::Tensor::Zeros({1}, core::Int64, positions.GetDevice()),
+             counts.InclusivePrefixSum()});
+    segments.num_clusters_ =
+            sorted_labels[sorted_labels.GetLength() - 1].Item<int64_t>() + 1;
+    return segments;
+}
+
+}  // namespace
+
+std::tuple<core::Tensor, core::Tensor>
+PointCloud::GetClusterAxisAlignedBoundingBoxes(
+        const core::Tensor &labels) const {
+    const core::Tensor &positions = GetPointPositions();
+    const ClusterSegments segments = GroupPointsByCluster(positions, labels);
+    const int64_t num_clusters = segments.num_clusters_;
+    core::Tensor min_bounds = core::Tensor::Zeros(
+            {num_clusters, 3}, positions.GetDtype(), GetDevice());
+    core::Tensor max_bounds = min_bounds.Clone();
+    if (num_clusters == 0) {
+        return std::make_tuple(min_bounds, max_bounds);
+    }
+
+    const core::Tensor &row_splits = segments.row_splits_;
+    min_bounds.IndexSet(
+            {segments.labels_},
+            segments.points_.Neg().SegmentMax(row_splits).Neg().To(
+                    positions.GetDtype()));
+    max_bounds.IndexSet(
+            {segments.labels_},
+            segments.points_.SegmentMax(row_splits).To(positions.GetDtype()));
+    return std::make_tuple(min_bounds, max_bounds);
+}
+
+std::tuple<core::Tensor, core::Tensor, core::Tensor>
+PointCloud::GetClusterOrientedBoundingBoxes(const core::Tensor &labels) const {
+    const core::Tensor &positions = GetPointPositions();
+    const ClusterSegments segments = GroupPointsByCluster(positions, labels);
+    const int64_t num_clusters = segments.num_clusters_;
+    const core::Dtype dtype = positions.GetDtype();
+    core::Tensor centers =
+            core::Tensor::Zeros({num_clusters, 3}, dtype, GetDevice());
+    core::Tensor rotations = core::Tensor::Eye(3, dtype, GetDevice())
+                                     .Reshape({1, 3, 3})
+                                     .Expand({num_clusters, 3, 3})
+                                     .Contiguous();
+    core::Tensor extents = centers.Clone();
+    if (num_clusters == 0) {
+        return std::make_tuple(centers, rotations, extents);
+    }
+
+    // The covariance of each cluster, and the principal axes from it.
+    const core::Tensor &row_splits = segments.row_splits_;
+    const int64_t num_points = segments.points_.GetLength();
+    const core::Tensor means = segments.points_.SegmentMean(row_splits);
+    const core::Tensor centered =
+            segments.points_ - means.IndexGet({segments.inverse_});
+    const core::Tensor covariances =
+            (centered.Reshape({num_points, 3, 1}) *
+             centered.Reshape({num_points, 1, 3}))
+                    .Reshape({num_points, 9})
+                    .SegmentMean(row_splits)
+                    .Reshape({-1, 3, 3});
+    const core::Tensor axes =
+            kernel::pointcloud::ComputePrincipalAxes(covariances);
+
+    // The bounds of the points in the frame of the axes, R^T (p - mean).
+    const core::Tensor local = (axes.IndexGet({segments.inverse_}) *
+                                centered.Reshape({num_points, 3, 1}))
+                                       .Sum({1});
+    const core::Tensor local_max = local.SegmentMax(row_splits);
+    const core::Tensor local_min = local.Neg().SegmentMax(row_splits).Neg();
+    const core::Tensor local_center = (local_max + local_min) * 0.5;
+    const core::Tensor box_centers =
+            (axes * local_center.Reshape({-1, 1, 3})).Sum({2}) + means;
+
+    centers.IndexSet({segments.labels_}, box_centers.To(dtype));
+    rotations.IndexSet({segments.labels_}, axes.To(dtype));
+    extents.IndexSet({segments.labels_}, (local_max - local_min).To(dtype));
+    return std::make_tuple(centers, rotations, extents);
+}
+
 PointCloud PointCloud::To(const core::Device &device, bool copy) const {
     if (!copy && GetDevice() == device) {
         return *this;
     }
+    // Uploads are ordered on the current stream and need no host wait.
+    if (device.GetType() == core::Device::DeviceType::CUDA) {
+        return ToAsync(device, copy).WaitOnStream();
+    }
     PointCloud pcd(device);
     for (auto &kv : point_attr_) {
         pcd.SetPointAttr(kv.first, kv.second.To(device, /*copy=*/true));
@@ -118,6 +250,24 @@ PointCloud PointCloud::To(const core::Device &device, bool copy) const {
     return pcd;
 }
 
+core::Future<PointCloud> PointCloud::ToAsync(const core::Device &device,
+                                             bool copy) const {
+    if (!copy && GetDevice() == device) {
+        return core::Future<PointCloud>(*this);
+    }
+    PointCloud pcd(device);
+    core::StreamEvent event;
+    for (auto &kv : point_attr_) {
+        const core::TensorFuture attr =
+                kv.second.ToAsync(device, /*copy=*/true);
+        pcd.SetPointAttr(kv.first, attr.GetUnsafe());
+        // All copies are enqueued on the same stream, so the event of the
+        // last one marks the completion of all of them.
+        event = attr.GetEvent();
+    }
+    return core::Future<PointCloud>(pcd, event);
+}
+
 PointCloud PointCloud::Clone() const { return To(GetDevice(), /*copy=*/true); }
 
 PointCloud PointCloud::Append(const PointCloud &other) const {
@@ -154,7 +304,7 @@ PointCloud PointCloud::Append(const PointCloud &other) const {
                     core::TensorKey::Slice(length, combined_length, 1),
                     other_attr);
 
-            pcd.SetPointAttr(kv.first, combined_attr.Clone());
+            pcd.SetPointAttr(kv.first, combined_attr);
         } else {
             utility::LogError(
                     "The pointcloud is missing attribute {}. The pointcloud "
@@ -173,6 +323,10 @@ PointCloud &PointCloud::Transform(const core::Tensor &transformation) {
     if (HasPointNormals()) {
         kernel::transform::TransformNormals(transformation, GetPointNormals());
     }
+    if (HasPointAttr("covariances")) {
+        kernel::transform::TransformCovariances(transformation,
+                                                GetPointAttr("covariances"));
+    }
 
     return *this;
 }
@@ -211,6 +365,9 @@ PointCloud &PointCloud::Rotate(const core::Tensor &R,
     if (HasPointNormals()) {
         kernel::transform::RotateNormals(R, GetPointNormals());
     }
+    if (HasPointAttr("covariances")) {
+        kernel::transform::RotateCovariances(R, GetPointAttr("covariances"));
+    }
     return *this;
 }
 
@@ -221,28 +378,18 @@ PointCloud PointCloud::SelectPoints(const core::Tensor &boolean_mask,
     core::AssertTensorShape(boolean_mask, {length});
     core::AssertTensorDevice(boolean_mask, GetDevice());
 
-    core::Tensor indices_local;
-    if (invert) {
-        indices_local = boolean_mask.LogicalNot();
-    } else {
-        indices_local = boolean_mask;
-    }
-
     PointCloud pcd(GetDevice());
-    for (auto &kv : GetPointAttr()) {
-        if (HasPointAttr(kv.first)) {
-            pcd.SetPointAttr(kv.first,
-                             kv.second.IndexGet({indices_local}).Clone());
-        }
-    }
+    pcd.point_attr_ = point_attr_.IndexGet(
+            invert ? boolean_mask.LogicalNot() : boolean_mask);
 
     utility::LogDebug("Pointcloud down sampled from {} points to {} points.",
                       length, pcd.GetPointPositions().GetLength());
     return pcd;
 }
 
-PointCloud PointCloud::VoxelDownSample(
-        double voxel_size, const core::HashBackendType &backend) const {
+PointCloud PointCloud::VoxelDownSample(double voxel_size,
+                                       const core::HashBackendType &backend,
+                                       bool sort_by_morton_code) const {
     if (voxel_size <= 0) {
         utility::LogError("voxel_size must be positive.");
     }
@@ -256,18 +403,42 @@ PointCloud PointCloud::VoxelDownSample(
     points_voxeli_hashset.Insert(points_voxeli, buf_indices, masks);
 
     PointCloud pcd_down(GetPointPositions().GetDevice());
-    for (auto &kv : point_attr_) {
-        if (kv.first == "positions") {
-            pcd_down.SetPointAttr(kv.first,
-                                  points_voxeli.IndexGet({masks}).To(
-                                          GetPointPositions().GetDtype()) *
-                                          voxel_size);
-        } else {
-            pcd_down.SetPointAttr(kv.first, kv.second.IndexGet({masks}));
-        }
+    TensorMap attrs = point_attr_;
+    attrs["positions"] = points_voxeli;
+    pcd_down.point_attr_ = attrs.IndexGet(masks);
+    pcd_down.SetPointPositions(
+            pcd_down.GetPointPositions().To(GetPointPositions().GetDtype()) *
+            voxel_size);
+
+    return sort_by_morton_code ? pcd_down.SortByMortonCode() : pcd_down;
+}
+
+PointCloud PointCloud::SortByMortonCode() const {
+    if (!HasPointPositions()) {
+        return *this;
     }
+    const core::Tensor indices =
+            kernel::pointcloud::ComputeMortonCodes(GetPointPositions())
+                    .ArgSort();
+    PointCloud pcd(GetDevice());
+    pcd.point_attr_ = point_attr_.IndexGet(indices);
+    return pcd;
+}
 
-    return pcd_down;
+PointCloud PointCloud::FarthestPointDownSample(size_t num_samples) const {
+    const int64_t length = GetPointPositions().GetLength();
+    if (static_cast<int64_t>(num_samples) > length) {
+        utility::LogError(
+                "Illegal number of samples: {}, must <= point size: {}",
+                num_samples, length);
+    }
+
+    const core::Tensor indices = kernel::pointcloud::FarthestPointDownSample(
+            GetPointPositions(), static_cast<int64_t>(num_samples));
+
+    PointCloud pcd(GetDevice());
+    pcd.point_attr_ = point_attr_.IndexGet(indices);
+    return pcd;
 }
 
 std::tuple<PointCloud, core::Tensor> PointCloud::RemoveRadiusOutliers(
@@ -284,22 +455,620 @@ std::tuple<PointCloud, core::Tensor> PointCloud::RemoveRadiusOutliers(
         utility::LogError("Fixed radius search index is not set.");
     }
 
-    core::Tensor indices, distance, row_splits;
-    std::tie(indices, distance, row_splits) = target_nns.FixedRadiusSearch(
-            GetPointPositions(), search_radius, false);
-    row_splits = row_splits.To(GetDevice());
-
-    const int64_t size = row_splits.GetLength();
-    const core::Tensor num_neighbors =
-            row_splits.Slice(0, 1, size) - row_splits.Slice(0, 0, size - 1);
-
-    const core::Tensor valid =
-            num_neighbors.Ge(static_cast<int64_t>(nb_points));
+    // Search in tiles of queries so that the neighbors of all points are
+    // never held in memory at the same time.
+    constexpr int64_t kTileSize = 1 << 18;
+    core::Tensor valid =
+            core::Tensor::Empty({GetPointPositions().GetLength()},
+                                core::Bool, GetDevice());
+    target_nns.FixedRadiusSearchTiled(
+            GetPointPositions(), search_radius, kTileSize,
+            [&](int64_t query_offset, const core::Tensor& /*indices*/,
+                const core::Tensor& /*distances*/, const core::Tensor& splits) {
+                const core::Tensor row_splits = splits.To(GetDevice());
+                const int64_t size = row_splits.GetLength();
+                const core::Tensor num_neighbors =
+                        row_splits.Slice(0, 1, size) -
+                        row_splits.Slice(0, 0, size - 1);
+                valid.Slice(0, query_offset, query_offset + size - 1) =
+                        num_neighbors.Ge(static_cast<int64_t>(nb_points));
+            },
+            false);
     const PointCloud pcd = SelectPoints(valid);
 
     return std::make_tuple(pcd, valid);
 }
 
+/// Calls \p callback with the distances from tiles of \p query to their
+/// nearest neighbors in \p dataset, so that the reductions never hold the
+/// distances of all points in memory.
+static void NearestNeighborDistancesTiled(
+        const core::Tensor &query,
+        const core::Tensor &dataset,
+        const std::function<void(int64_t, const core::Tensor &)> &callback) {
+    core::AssertTensorDevice(query, dataset.GetDevice());
+    core::AssertTensorDtype(query, dataset.GetDtype());
+    if (dataset.GetLength() == 0) {
+        utility::LogError("Target point cloud is empty.");
+    }
+    core::nns::NearestNeighborSearch nns(dataset);
+    if (!nns.KnnIndex()) {
+        utility::LogError("Knn search index is not set.");
+    }
+    constexpr int64_t kTileSize = 1 << 18;
+    const int64_t n = query.GetLength();
+    for (int64_t begin = 0; begin < n; begin += kTileSize) {
+        const int64_t end = std::min(begin + kTileSize, n);
+        core::Tensor distances = nns.KnnSearch(query.Slice(0, begin, end), 1)
+                                         .second.Reshape({end - begin})
+                                         .Sqrt_();
+        callback(begin, distances);
+    }
+}
+
+core::Tensor PointCloud::ComputeDistance(const PointCloud &target) const {
+    core::Tensor distances = core::Tensor::Empty(
+            {GetPointPositions().GetLength()}, GetPointPositions().GetDtype(),
+            GetDevice());
+    NearestNeighborDistancesTiled(
+            GetPointPositions(), target.GetPointPositions(),
+            [&](int64_t offset, const core::Tensor &tile) {
+                distances.Slice(0, offset, offset + tile.GetLength()) = tile;
+            });
+    return distances;
+}
+
+double PointCloud::ComputeChamferDistance(const PointCloud &target,
+                                          bool symmetric) const {
+    auto MeanDistance = [](const core::Tensor &query,
+                           const core::Tensor &dataset) {
+        if (query.GetLength() == 0) {
+            utility::LogError("Point cloud is empty.");
+        }
+        double sum = 0;
+        NearestNeighborDistancesTiled(
+                query, dataset, [&](int64_t, const core::Tensor &tile) {
+                    sum += tile.To(core::Float64).Sum({0}).Item<double>();
+                });
+        return sum / double(query.GetLength());
+    };
+    double chamfer =
+            MeanDistance(GetPointPositions(), target.GetPointPositions());
+    if (symmetric) {
+        chamfer +=
+                MeanDistance(target.GetPointPositions(), GetPointPositions());
+    }
+    return chamfer;
+}
+
+double PointCloud::ComputeHausdorffDistance(const PointCloud &target,
+                                            bool symmetric) const {
+    auto MaxDistance = [](const core::Tensor &query,
+                          const core::Tensor &dataset) {
+        if (query.GetLength() == 0) {
+            utility::LogError("Point cloud is empty.");
+        }
+        double max_distance = 0;
+        NearestNeighborDistancesTiled(
+                query, dataset, [&](int64_t, const core::Tensor &tile) {
+                    max_distance = std::max(
+                            max_distance,
+                            tile.Max({0}).To(core::Float64).Item<double>());
+                });
+        return max_distance;
+    };
+    double hausdorff =
+            MaxDistance(GetPointPositions(), target.GetPointPositions());
+    if (symmetric) {
+        hausdorff = std::max(hausdorff, MaxDistance(target.GetPointPositions(),
+                                                    GetPointPositions()));
+    }
+    return hausdorff;
+}
+
+core::Tensor PointCloud::ClusterDBSCAN(double eps,
+                                       size_t min_points,
+                                       bool print_progress) const {
+    if (eps <= 0) {
+        utility::LogError("eps must be positive, but got {}.", eps);
+    }
+    const core::Device host("CPU:0");
+    const int64_t n = GetPointPositions().GetLength();
+    if (n == 0) {
+        return core::Tensor::Empty({0}, core::Int32, GetDevice());
+    }
+    core::nns::NearestNeighborSearch nns(GetPointPositions());
+    if (!nns.FixedRadiusIndex(eps)) {
+        utility::LogError("Fixed radius search index is not set.");
+    }
+    constexpr int64_t kTileSize = 1 << 18;
+    const int64_t n_tiles = (n + kTileSize - 1) / kTileSize;
+
+    // Core points have at least min_points neighbors, including themselves.
+    utility::ProgressBar progress_bar(2 * n_tiles, "Clustering",
+                                      print_progress);
+    std::vector<uint8_t> is_core(n);
+    nns.FixedRadiusSearchTiled(
+            GetPointPositions(), eps, kTileSize,
+            [&](int64_t query_offset, const core::Tensor & /*indices*/,
+                const core::Tensor & /*distances*/,
+                const core::Tensor &splits) {
+                const core::Tensor row_splits =
+                        splits.To(host).To(core::Int64).Contiguous();
+                const int64_t *row_splits_ptr =
+                        row_splits.GetDataPtr<int64_t>();
+                const int64_t size = row_splits.GetLength() - 1;
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+                for (int64_t i = 0; i < size; ++i) {
+                    is_core[query_offset + i] =
+                            row_splits_ptr[i + 1] - row_splits_ptr[i] >=
+                            int64_t(min_points);
+                }
+                ++progress_bar;
+            },
+            false);
+
+    // Merge the core points within eps of each other, and remember the core
+    // neighbor with the smallest index of each border point.
+    std::vector<std::atomic<int64_t>> parents(n);
+    std::atomic<int64_t> *forest = parents.data();
+    std::vector<int64_t> border_anchors(n, -1);
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t i = 0; i < n; ++i) {
+        parents[i].store(i, std::memory_order_relaxed);
+    }
+    nns.FixedRadiusSearchTiled(
+            GetPointPositions(), eps, kTileSize,
+            [&](int64_t query_offset, const core::Tensor &indices,
+                const core::Tensor & /*distances*/,
+                const core::Tensor &splits) {
+                const core::Tensor neighbors =
+                        indices.To(host).To(core::Int32).Contiguous();
+                const core::Tensor row_splits =
+                        splits.To(host).To(core::Int64).Contiguous();
+                const int32_t *neighbors_ptr = neighbors.GetDataPtr<int32_t>();
+                const int64_t *row_splits_ptr =
+                        row_splits.GetDataPtr<int64_t>();
+                const int64_t size = row_splits.GetLength() - 1;
+#pragma omp parallel for schedule(dynamic, 1024) \
+        num_threads(utility::EstimateMaxThreads())
+                for (int64_t i = 0; i < size; ++i) {
+                    const int64_t query = query_offset + i;
+                    for (int64_t k = row_splits_ptr[i];
+                         k < row_splits_ptr[i + 1]; ++k) {
+                        const int64_t neighbor = neighbors_ptr[k];
+                        if (!is_core[neighbor]) continue;
+                        if (is_core[query]) {
+                            if (neighbor < query) {
+                                core::kernel::UnionFindUnite(forest, query,
+                                                             neighbor);
+                            }
+                        } else if (border_anchors[query] < 0 ||
+                                   neighbor < border_anchors[query]) {
+                            border_anchors[query] = neighbor;
+                        }
+                    }
+                }
+                ++progress_bar;
+            },
+            false);
+
+    // Roots are the first core point of their cluster, so numbering them in
+    // index order matches the cluster order of a sequential DBSCAN sweep.
+    std::vector<int32_t> labels(n, -1);
+    int32_t n_clusters = 0;
+    for (int64_t i = 0; i < n; ++i) {
+        if (is_core[i] && core::kernel::UnionFindRoot(forest, i) == i) {
+            labels[i] = n_clusters++;
+        }
+    }
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t i = 0; i < n; ++i) {
+        if (!is_core[i]) continue;
+        const int64_t root = core::kernel::UnionFindRoot(forest, i);
+        if (root != i) labels[i] = labels[root];
+    }
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t i = 0; i < n; ++i) {
+        if (!is_core[i] && border_anchors[i] >= 0) {
+            labels[i] = labels[border_anchors[i]];
+        }
+    }
+    utility::LogDebug("Done Compute Clusters: {:d}", n_clusters);
+
+    return core::Tensor(labels, {n}, core::Int32, GetDevice());
+}
+
+core::Tensor PointCloud::ClusterConnectedComponents(double radius) const {
+    if (radius <= 0) {
+        utility::LogError("radius must be positive, but got {}.", radius);
+    }
+    const int64_t n = GetPointPositions().GetLength();
+    if (n == 0) {
+        return core::Tensor::Empty({0}, core::Int64, GetDevice());
+    }
+    core::nns::NearestNeighborSearch nns(GetPointPositions());
+    if (!nns.FixedRadiusIndex(radius)) {
+        utility::LogError("Fixed radius search index is not set.");
+    }
+
+    // Each pair of neighbors is found twice, only keep the edge from the
+    // larger to the smaller index.
+    constexpr int64_t kTileSize = 1 << 18;
+    std::vector<core::Tensor> edges;
+    nns.FixedRadiusSearchTiled(
+            GetPointPositions(), radius, kTileSize,
+            [&](int64_t query_offset, const core::Tensor &indices,
+                const core::Tensor & /*distances*/,
+                const core::Tensor &splits) {
+                const core::Tensor neighbors = indices.To(core::Int64);
+                core::Tensor queries;
+                core::kernel::CSRRowIndices(splits.To(core::Int64),
+                                            neighbors.GetLength(), queries);
+                queries += query_offset;
+                const core::Tensor mask = neighbors.Lt(queries);
+                edges.push_back(core::Concatenate(
+                        {queries.IndexGet({mask}).Reshape({-1, 1}),
+                         neighbors.IndexGet({mask}).Reshape({-1, 1})},
+                        1));
+            },
+            false);
+
+    core::Tensor roots;
+    core::kernel::ConnectedComponents(
+            edges.size() == 1 ? edges[0] : core::Concatenate(edges), n, roots);
+    // The roots are the smallest point of each component.
+    core::Tensor labels;
+    std::tie(std::ignore, labels, std::ignore) =
+            roots.UniqueWithInverseAndCounts();
+    return labels;
+}
+
+/// Plane minimizing the summed squared distances to points with the given
+/// centroid and covariance sums. Returns zero if the points span no plane.
+static Eigen::Vector4d PlaneFromCovariance(const Eigen::Vector3d &centroid,
+                                           const Eigen::Matrix3d &cov) {
+    const double xx = cov(0, 0), xy = cov(0, 1), xz = cov(0, 2);
+    const double yy = cov(1, 1), yz = cov(1, 2), zz = cov(2, 2);
+    const double det_x = yy * zz - yz * yz;
+    const double det_y = xx * zz - xz * xz;
+    const double det_z = xx * yy - xy * xy;
+    Eigen::Vector3d abc;
+    if (det_x > det_y && det_x > det_z) {
+        abc = Eigen::Vector3d(det_x, xz * yz - xy * zz, xy * yz - xz * yy);
+    } else if (det_y > det_z) {
+        abc = Eigen::Vector3d(xz * yz - xy * zz, det_y, xy * xz - yz * xx);
+    } else {
+        abc = Eigen::Vector3d(xy * yz - xz * yy, xy * xz - yz * xx, det_z);
+    }
+    const double norm = abc.norm();
+    if (norm == 0) {
+        return Eigen::Vector4d::Zero();
+    }
+    abc /= norm;
+    return Eigen::Vector4d(abc(0), abc(1), abc(2), -abc.dot(centroid));
+}
+
+/// Least squares plane through \p points of shape {n, 3}.
+static Eigen::Vector4d PlaneFromPoints(const core::Tensor &points) {
+    const core::Tensor points_d = points.To(core::Float64);
+    const core::Tensor centroid = points_d.Mean({0});
+    const core::Tensor centered = points_d - centroid;
+    const core::Tensor cov = centered.T().Matmul(centered);
+    const Eigen::Vector3d centroid_e =
+            core::eigen_converter::TensorToEigenMatrixXd(
+                    centroid.Reshape({3, 1}));
+    const Eigen::Matrix3d cov_e =
+            core::eigen_converter::TensorToEigenMatrixXd(cov);
+    return PlaneFromCovariance(centroid_e, cov_e);
+}
+
+/// RANSAC plane fit of \p points. Hypotheses are fitted on the host and
+/// scored in batches against all points on the device.
+static std::tuple<Eigen::Vector4d, core::Tensor> SegmentPlaneRANSAC(
+        const core::Tensor &points,
+        double distance_threshold,
+        int ransac_n,
+        int num_iterations,
+        double probability,
+        std::mt19937 &rng) {
+    if (probability <= 0 || probability > 1) {
+        utility::LogError("Probability must be > 0 or <= 1.0");
+    }
+    if (ransac_n < 3) {
+        utility::LogError(
+                "ransac_n should be set to higher than or equal to 3.");
+    }
+    const int64_t num_points = points.GetLength();
+    if (num_points < ransac_n) {
+        utility::LogError("There must be at least 'ransac_n' points.");
+    }
+    const core::Device device = points.GetDevice();
+    const core::Dtype dtype = points.GetDtype();
+
+    // Bound the {num_points, batch} distance matrix of a batch.
+    constexpr int64_t kMaxBatchElements = 1 << 24;
+    const int64_t batch_size = std::max<int64_t>(
+            1, std::min<int64_t>(num_iterations,
+                                 kMaxBatchElements / num_points));
+
+    Eigen::Vector4d best_plane = Eigen::Vector4d::Zero();
+    int64_t best_num_inliers = 0;
+    double best_error = 0;
+    double break_iteration = num_iterations;
+    int64_t iteration_count = 0;
+    std::uniform_int_distribution<int64_t> dist(0, num_points - 1);
+    while (iteration_count < break_iteration) {
+        const int64_t n_hypotheses =
+                std::min<int64_t>(batch_size, num_iterations - iteration_count);
+        iteration_count += n_hypotheses;
+
+        // Sample distinct point indices per hypothesis.
+        std::vector<int64_t> sample_indices;
+        sample_indices.reserve(n_hypotheses * ransac_n);
+        for (int64_t h = 0; h < n_hypotheses; ++h) {
+            const size_t begin = sample_indices.size();
+            while (int64_t(sample_indices.size() - begin) < ransac_n) {
+                const int64_t idx = dist(rng);
+                if (std::find(sample_indices.begin() + begin,
+                              sample_indices.end(),
+                              idx) == sample_indices.end()) {
+                    sample_indices.push_back(idx);
+                }
+            }
+        }
+        const core::Tensor samples =
+                points.IndexGet({core::Tensor(sample_indices,
+                                              {n_hypotheses * ransac_n},
+                                              core::Int64, device)})
+                        .To(core::Device("CPU:0"), core::Float64)
+                        .Contiguous();
+        const double *samples_ptr = samples.GetDataPtr<double>();
+
+        std::vector<double> planes;
+        planes.reserve(n_hypotheses * 4);
+        for (int64_t h = 0; h < n_hypotheses; ++h) {
+            Eigen::Map<const Eigen::Matrix<double, 3, Eigen::Dynamic>> sample(
+                    samples_ptr + h * ransac_n * 3, 3, ransac_n);
+            const Eigen::Vector3d centroid = sample.rowwise().mean();
+            const Eigen::Matrix3Xd centered = sample.colwise() - centroid;
+            const Eigen::Vector4d plane = PlaneFromCovariance(
+                    centroid, centered * centered.transpose());
+            if (plane.isZero(0)) continue;
+            planes.insert(planes.end(), plane.data(), plane.data() + 4);
+        }
+        const int64_t n_planes = int64_t(planes.size()) / 4;
+        if (n_planes == 0) continue;
+        const core::Tensor planes_t =
+                core::Tensor(planes, {n_planes, 4}, core::Float64, device)
+                        .To(dtype);
+
+        // Distances of all points to all planes of the batch.
+        const core::Tensor distances =
+                (points.Matmul(planes_t.Slice(1, 0, 3).T()) +
+                 planes_t.Slice(1, 3, 4).Reshape({1, n_planes}))
+                        .Abs_();
+        const core::Tensor inliers =
+                distances.Lt(distance_threshold).To(dtype);
+        const core::Tensor num_inliers = inliers.Sum({0})
+                                                 .To(core::Device("CPU:0"),
+                                                     core::Int64)
+                                                 .Contiguous();
+        const core::Tensor errors = (distances * inliers)
+                                            .Sum({0})
+                                            .To(core::Device("CPU:0"),
+                                                core::Float64)
+                                            .Contiguous();
+        const int64_t *num_inliers_ptr = num_inliers.GetDataPtr<int64_t>();
+        const double *errors_ptr = errors.GetDataPtr<double>();
+        for (int64_t h = 0; h < n_planes; ++h) {
+            if (num_inliers_ptr[h] > best_num_inliers ||
+                (num_inliers_ptr[h] == best_num_inliers &&
+                 errors_ptr[h] < best_error)) {
+                best_num_inliers = num_inliers_ptr[h];
+                best_error = errors_ptr[h];
+                best_plane = Eigen::Map<const Eigen::Vector4d>(&planes[h * 4]);
+            }
+        }
+        const double fitness = double(best_num_inliers) / double(num_points);
+        if (fitness >= 1.0) break;
+        if (fitness > 0) {
+            break_iteration = std::min(
+                    std::log(1 - probability) /
+                            std::log(1 - std::pow(fitness, ransac_n)),
+                    double(num_iterations));
+        }
+    }
+
+    if (best_plane.isZero(0)) {
+        return std::make_tuple(best_plane,
+                               core::Tensor::Empty({0}, core::Int64, device));
+    }
+
+    // Refine the best plane on its inliers.
+    const core::Tensor plane_t =
+            core::eigen_converter::EigenMatrixToTensor(best_plane)
+                    .To(device, dtype);
+    core::Tensor inliers =
+            (points.Matmul(plane_t.Slice(0, 0, 3).Reshape({3, 1})) +
+             plane_t.Slice(0, 3, 4))
+                    .Abs_()
+                    .Reshape({num_points})
+                    .Lt(distance_threshold)
+                    .NonZero()
+                    .Reshape({-1});
+    const Eigen::Vector4d plane = PlaneFromPoints(points.IndexGet({inliers}));
+    utility::LogDebug("RANSAC | Inliers: {:d}, Iteration: {:d}",
+                      inliers.GetLength(), iteration_count);
+    return std::make_tuple(plane, inliers);
+}
+
+static std::mt19937 CreateRandomGenerator(utility::optional<int> seed) {
+    if (!seed.has_value()) {
+        std::random_device rd;
+        seed = rd();
+    }
+    return std::mt19937(seed.value());
+}
+
+std::tuple<core::Tensor, core::Tensor> PointCloud::SegmentPlane(
+        const double distance_threshold,
+        const int ransac_n,
+        const int num_iterations,
+        const double probability,
+        utility::optional<int> seed) const {
+    std::mt19937 rng = CreateRandomGenerator(seed);
+    Eigen::Vector4d plane;
+    core::Tensor inliers;
+    std::tie(plane, inliers) = SegmentPlaneRANSAC(
+            GetPointPositions(), distance_threshold, ransac_n, num_iterations,
+            probability, rng);
+    return std::make_tuple(
+            core::eigen_converter::EigenMatrixToTensor(plane).Reshape({4}),
+            inliers);
+}
+
+std::tuple<core::Tensor, core::Tensor> PointCloud::SegmentPlanes(
+        const double distance_threshold,
+        const int max_planes,
+        const int64_t min_num_inliers,
+        const int ransac_n,
+        const int num_iterations,
+        const double probability,
+        utility::optional<int> seed) const {
+    std::mt19937 rng = CreateRandomGenerator(seed);
+    const int64_t num_points = GetPointPositions().GetLength();
+    core::Tensor labels =
+            core::Tensor::Full({num_points}, -1, core::Int32, GetDevice());
+    // Original indices of the points not assigned to a plane yet.
+    core::Tensor remaining =
+            core::Tensor::Arange(0, num_points, 1, core::Int64, GetDevice());
+    std::vector<double> planes;
+    for (int k = 0; k < max_planes && remaining.GetLength() >= ransac_n; ++k) {
+        Eigen::Vector4d plane;
+        core::Tensor inliers;
+        std::tie(plane, inliers) = SegmentPlaneRANSAC(
+                GetPointPositions().IndexGet({remaining}), distance_threshold,
+                ransac_n, num_iterations, probability, rng);
+        if (inliers.GetLength() == 0 ||
+            inliers.GetLength() < min_num_inliers) {
+            break;
+        }
+        planes.insert(planes.end(), plane.data(), plane.data() + 4);
+        labels.IndexSet({remaining.IndexGet({inliers})},
+                        core::Tensor::Full({inliers.GetLength()}, k,
+                                           core::Int32, GetDevice()));
+        remaining = labels.Eq(-1).NonZero().Reshape({-1});
+    }
+    const int64_t n_planes = int64_t(planes.size()) / 4;
+    return std::make_tuple(
+            core::Tensor(planes, {n_planes, 4}, core::Float64,
+                         core::Device("CPU:0")),
+            labels);
+}
+
+/// Builds the tensor mesh of a qhull result whose vertices are the points of
+/// \p positions listed in \p point_indices. Also returns those indices as an
+/// Int64 tensor on the device of \p positions.
+static std::tuple<TriangleMesh, core::Tensor> CreateMeshFromHull(
+        const core::Tensor &positions,
+        const std::vector<int64_t> &point_indices,
+        const std::vector<int64_t> &triangles) {
+    const core::Device device = positions.GetDevice();
+    const int64_t num_vertices = static_cast<int64_t>(point_indices.size());
+    const int64_t num_triangles = static_cast<int64_t>(triangles.size()) / 3;
+    const core::Tensor indices =
+            core::Tensor(point_indices, {num_vertices}, core::Int64)
+                    .To(device);
+    TriangleMesh mesh(positions.IndexGet({indices}),
+                      core::Tensor(triangles, {num_triangles, 3}, core::Int64)
+                              .To(device));
+    return std::make_tuple(mesh, indices);
+}
+
+TriangleMesh PointCloud::ComputeConvexHull(bool joggle_inputs) const {
+    const core::Tensor points =
+            GetPointPositions()
+                    .To(core::Device("CPU:0"), core::Float64)
+                    .Contiguous();
+
+    std::shared_ptr<open3d::geometry::TriangleMesh> hull;
+    std::vector<size_t> pt_map;
+    std::tie(hull, pt_map) = open3d::geometry::Qhull::ComputeConvexHull(
+            points.GetDataPtr<double>(), points.GetLength(), joggle_inputs);
+
+    std::vector<int64_t> point_indices(pt_map.begin(), pt_map.end());
+    std::vector<int64_t> triangles;
+    triangles.reserve(hull->triangles_.size() * 3);
+    for (const Eigen::Vector3i &triangle : hull->triangles_) {
+        triangles.insert(triangles.end(), {triangle(0), triangle(1),
+                                           triangle(2)});
+    }
+    TriangleMesh convex_hull;
+    core::Tensor indices;
+    std::tie(convex_hull, indices) =
+            CreateMeshFromHull(GetPointPositions(), point_indices, triangles);
+    convex_hull.SetVertexAttr("point_indices", indices);
+    return convex_hull;
+}
+
+std::tuple<TriangleMesh, core::Tensor> PointCloud::HiddenPointRemoval(
+        const core::Tensor &camera_location, double radius) const {
+    if (radius <= 0) {
+        utility::LogError("radius must be larger than zero.");
+    }
+    core::AssertTensorShape(camera_location, {3});
+    core::AssertTensorDtypes(camera_location, {core::Float32, core::Float64});
+    const int64_t num_points = GetPointPositions().GetLength();
+
+    // Spherical flipping p + 2 * (radius - |p|) * p / |p| is evaluated on
+    // the device of the point cloud, with the camera at the origin.
+    const core::Tensor points =
+            GetPointPositions().To(core::Float64) -
+            camera_location.To(GetDevice(), core::Float64).Reshape({1, 3});
+    const core::Tensor norms = (points * points).Sum({1}, true).Sqrt();
+    const core::Tensor projected =
+            points * ((norms.Neg() + radius) * 2 / norms + 1);
+
+    // The origin is appended as the last point. It is always on the hull
+    // and only used to close it, so its faces are dropped below.
+    const core::Tensor projected_with_origin =
+            projected.To(core::Device("CPU:0"))
+                    .Append(core::Tensor::Zeros({1, 3}, core::Float64), 0)
+                    .Contiguous();
+
+    std::shared_ptr<open3d::geometry::TriangleMesh> hull;
+    std::vector<size_t> pt_map;
+    std::tie(hull, pt_map) = open3d::geometry::Qhull::ComputeConvexHull(
+            projected_with_origin.GetDataPtr<double>(), num_points + 1);
+
+    std::vector<int64_t> point_indices;
+    std::vector<int64_t> vertex_map(pt_map.size(), -1);
+    point_indices.reserve(pt_map.size());
+    for (size_t vidx = 0; vidx < pt_map.size(); ++vidx) {
+        if (static_cast<int64_t>(pt_map[vidx]) != num_points) {
+            vertex_map[vidx] = static_cast<int64_t>(point_indices.size());
+            point_indices.push_back(static_cast<int64_t>(pt_map[vidx]));
+        }
+    }
+    std::vector<int64_t> triangles;
+    triangles.reserve(hull->triangles_.size() * 3);
+    for (const Eigen::Vector3i &triangle : hull->triangles_) {
+        const int64_t v0 = vertex_map[triangle(0)];
+        const int64_t v1 = vertex_map[triangle(1)];
+        const int64_t v2 = vertex_map[triangle(2)];
+        if (v0 >= 0 && v1 >= 0 && v2 >= 0) {
+            triangles.insert(triangles.end(), {v0, v1, v2});
+        }
+    }
+
+    return CreateMeshFromHull(GetPointPositions(), point_indices, triangles);
+}
+
 void PointCloud::EstimateNormals(
         const int max_knn /* = 30*/,
         const utility::optional<double> radius /*= utility::nullopt*/) {
@@ -320,60 +1089,141 @@ void PointCloud::EstimateNormals(
         this->SetPointNormals(GetPointNormals().Contiguous());
     }
 
-    this->SetPointAttr(
-            "covariances",
-            core::Tensor::Empty({GetPointPositions().GetLength(), 3, 3}, dtype,
-                                device));
-
+    // Covariances are computed and consumed per point inside the kernel, so
+    // no intermediate covariance tensor is allocated.
     if (radius.has_value()) {
-        utility::LogDebug("Using Hybrid Search for computing covariances");
-        // Computes and sets `covariances` attribute using Hybrid Search
-        // method.
+        utility::LogDebug("Using Hybrid Search for computing normals");
         if (device_type == core::Device::DeviceType::CPU) {
-            kernel::pointcloud::EstimateCovariancesUsingHybridSearchCPU(
+            kernel::pointcloud::EstimateNormalsUsingHybridSearchCPU(
                     this->GetPointPositions().Contiguous(),
-                    this->GetPointAttr("covariances"), radius.value(), max_knn);
+                    this->GetPointNormals(), radius.value(), max_knn,
+                    has_normals);
         } else if (device_type == core::Device::DeviceType::CUDA) {
-            CUDA_CALL(kernel::pointcloud::
-                              EstimateCovariancesUsingHybridSearchCUDA,
+            CUDA_CALL(kernel::pointcloud::EstimateNormalsUsingHybridSearchCUDA,
                       this->GetPointPositions().Contiguous(),
-                      this->GetPointAttr("covariances"), radius.value(),
-                      max_knn);
+                      this->GetPointNormals(), radius.value(), max_knn,
+                      has_normals);
         } else {
             utility::LogError("Unimplemented device");
         }
     } else {
-        utility::LogDebug("Using KNN Search for computing covariances");
-        // Computes and sets `covariances` attribute using KNN Search method.
+        utility::LogDebug("Using KNN Search for computing normals");
         if (device_type == core::Device::DeviceType::CPU) {
-            kernel::pointcloud::EstimateCovariancesUsingKNNSearchCPU(
+            kernel::pointcloud::EstimateNormalsUsingKNNSearchCPU(
                     this->GetPointPositions().Contiguous(),
-                    this->GetPointAttr("covariances"), max_knn);
+                    this->GetPointNormals(), max_knn, has_normals);
         } else if (device_type == core::Device::DeviceType::CUDA) {
-            CUDA_CALL(kernel::pointcloud::EstimateCovariancesUsingKNNSearchCUDA,
+            CUDA_CALL(kernel::pointcloud::EstimateNormalsUsingKNNSearchCUDA,
                       this->GetPointPositions().Contiguous(),
-                      this->GetPointAttr("covariances"), max_knn);
+                      this->GetPointNormals(), max_knn, has_normals);
         } else {
             utility::LogError("Unimplemented device");
         }
     }
+}
+
+void PointCloud::EstimateNormalsFromNeighbors(
+        const core::Tensor &neighbor_indices,
+        const core::Tensor &neighbor_counts) {
+    core::AssertTensorDtypes(this->GetPointPositions(),
+                             {core::Float32, core::Float64});
+    const int64_t num_points = GetPointPositions().GetLength();
+    core::AssertTensorShape(neighbor_indices, {num_points, utility::nullopt});
+    core::AssertTensorShape(neighbor_counts, {num_points});
+    core::AssertTensorDtype(neighbor_indices, core::Int32);
+    core::AssertTensorDtype(neighbor_counts, core::Int32);
+    core::AssertTensorDevice(neighbor_indices, GetDevice());
+    core::AssertTensorDevice(neighbor_counts, GetDevice());
+
+    const core::Dtype dtype = this->GetPointPositions().GetDtype();
+    const core::Device::DeviceType device_type = GetDevice().GetType();
+    const bool has_normals = HasPointNormals();
+
+    if (!has_normals) {
+        this->SetPointNormals(
+                core::Tensor::Empty({num_points, 3}, dtype, GetDevice()));
+    } else {
+        core::AssertTensorDtype(this->GetPointNormals(), dtype);
+
+        this->SetPointNormals(GetPointNormals().Contiguous());
+    }
 
-    // Estimate `normal` of each point using its `covariance` matrix.
     if (device_type == core::Device::DeviceType::CPU) {
-        kernel::pointcloud::EstimateNormalsFromCovariancesCPU(
-                this->GetPointAttr("covariances"), this->GetPointNormals(),
-                has_normals);
+        kernel::pointcloud::EstimateNormalsFromNeighborsCPU(
+                this->GetPointPositions().Contiguous(),
+                neighbor_indices.Contiguous(), neighbor_counts.Contiguous(),
+                this->GetPointNormals(), has_normals);
     } else if (device_type == core::Device::DeviceType::CUDA) {
-        CUDA_CALL(kernel::pointcloud::EstimateNormalsFromCovariancesCUDA,
-                  this->GetPointAttr("covariances"), this->GetPointNormals(),
-                  has_normals);
+        CUDA_CALL(kernel::pointcloud::EstimateNormalsFromNeighborsCUDA,
+                  this->GetPointPositions().Contiguous(),
+                  neighbor_indices.Contiguous(), neighbor_counts.Contiguous(),
+                  this->GetPointNormals(), has_normals);
     } else {
         utility::LogError("Unimplemented device");
     }
+}
+
+void PointCloud::OrientNormalsConsistentTangentPlane(size_t k) {
+    if (!HasPointNormals()) {
+        utility::LogError(
+                "No normals in the PointCloud. Call EstimateNormals() first.");
+    }
+    core::AssertTensorDtypes(GetPointPositions(),
+                             {core::Float32, core::Float64});
 
-    // TODO (@rishabh): Don't remove covariances attribute, when
-    // EstimateCovariance functionality is exposed.
-    RemovePointAttr("covariances");
+    open3d::geometry::PointCloud pcd_legacy;
+    pcd_legacy.points_ = core::eigen_converter::TensorToEigenVector3dVector(
+            GetPointPositions());
+    pcd_legacy.normals_ = core::eigen_converter::TensorToEigenVector3dVector(
+            GetPointNormals());
+    pcd_legacy.OrientNormalsConsistentTangentPlane(k);
+    SetPointNormals(core::eigen_converter::EigenVector3dVectorToTensor(
+            pcd_legacy.normals_, GetPointNormals().GetDtype(), GetDevice()));
+}
+
+void PointCloud::EstimateCovariances(
+        const int max_knn /* = 20*/,
+        const utility::optional<double> radius /*= utility::nullopt*/) {
+    core::AssertTensorDtypes(this->GetPointPositions(),
+                             {core::Float32, core::Float64});
+
+    const core::Dtype dtype = this->GetPointPositions().GetDtype();
+    const core::Device device = GetDevice();
+    const core::Device::DeviceType device_type = device.GetType();
+
+    core::Tensor covariances = core::Tensor::Empty(
+            {GetPointPositions().GetLength(), 3, 3}, dtype, device);
+
+    if (radius.has_value()) {
+        utility::LogDebug("Using Hybrid Search for computing covariances");
+        if (device_type == core::Device::DeviceType::CPU) {
+            kernel::pointcloud::EstimateCovariancesUsingHybridSearchCPU(
+                    this->GetPointPositions().Contiguous(), covariances,
+                    radius.value(), max_knn);
+        } else if (device_type == core::Device::DeviceType::CUDA) {
+            CUDA_CALL(kernel::pointcloud::
+                              EstimateCovariancesUsingHybridSearchCUDA,
+                      this->GetPointPositions().Contiguous(), covariances,
+                      radius.value(), max_knn);
+        } else {
+            utility::LogError("Unimplemented device");
+        }
+    } else {
+        utility::LogDebug("Using KNN Search for computing covariances");
+        if (device_type == core::Device::DeviceType::CPU) {
+            kernel::pointcloud::EstimateCovariancesUsingKNNSearchCPU(
+                    this->GetPointPositions().Contiguous(), covariances,
+                    max_knn);
+        } else if (device_type == core::Device::DeviceType::CUDA) {
+            CUDA_CALL(kernel::pointcloud::EstimateCovariancesUsingKNNSearchCUDA,
+                      this->GetPointPositions().Contiguous(), covariances,
+                      max_knn);
+        } else {
+            utility::LogError("Unimplemented device");
+        }
+    }
+
+    SetPointAttr("covariances", covariances);
 }
 
 void PointCloud::EstimateColorGradients(
@@ -591,6 +1441,41 @@ PointCloud PointCloud::CreateFromRGBDImage(const RGBDImage &rgbd_image,
     }
 }
 
+PointCloud PointCloud::CreateFromRGBDImageFiltered(
+        const RGBDImage &rgbd_image,
+        const core::Tensor &intrinsics,
+        const core::Tensor &extrinsics,
+        float depth_scale,
+        float depth_min,
+        float depth_max,
+        int stride,
+        float depth_diff_max,
+        int min_neighbors,
+        double voxel_size) {
+    core::AssertTensorDtypes(rgbd_image.depth_.AsTensor(),
+                             {core::UInt16, core::Float32});
+    core::AssertTensorShape(intrinsics, {3, 3});
+    core::AssertTensorShape(extrinsics, {4, 4});
+
+    Image image_colors = rgbd_image.color_.To(core::Float32, /*copy=*/false);
+    core::Tensor points, colors, image_colors_t = image_colors.AsTensor();
+    kernel::pointcloud::UnprojectFiltered(
+            rgbd_image.depth_.AsTensor(), image_colors_t, points, colors,
+            intrinsics, extrinsics, depth_scale, depth_min, depth_max, stride,
+            depth_diff_max, min_neighbors);
+    if (voxel_size > 0 && points.GetLength() > 0) {
+        const core::Tensor voxels =
+                (points / voxel_size).Floor().To(core::Int64);
+        core::HashSet voxel_hashset(voxels.GetLength(), core::Int64, {3},
+                                    points.GetDevice());
+        core::Tensor buf_indices, masks;
+        voxel_hashset.Insert(voxels, buf_indices, masks);
+        points = points.IndexGet({masks});
+        colors = colors.IndexGet({masks});
+    }
+    return PointCloud({{"positions", points}, {"colors", colors}});
+}
+
 geometry::Image PointCloud::ProjectToDepthImage(int width,
                                                 int height,
                                                 const core::Tensor &intrinsics,
@@ -640,6 +1525,56 @@ geometry::RGBDImage PointCloud::ProjectToRGBDImage(
     return geometry::RGBDImage(color, depth);
 }
 
+core::Tensor PointCloud::ProjectToDepthImages(int width,
+                                              int height,
+                                              const core::Tensor &intrinsics,
+                                              const core::Tensor &extrinsics,
+                                              float depth_scale,
+                                              float depth_max) const {
+    core::AssertTensorShape(extrinsics, {utility::nullopt, 4, 4});
+
+    core::Tensor depth =
+            core::Tensor::Zeros({extrinsics.GetLength(), height, width, 1},
+                                core::Float32, device_);
+    kernel::pointcloud::ProjectMultiView(
+            depth, utility::nullopt,
+            GetPointPositions().To(core::Float32).Contiguous(),
+            utility::nullopt, intrinsics, extrinsics, depth_scale, depth_max);
+    return depth;
+}
+
+std::tuple<core::Tensor, core::Tensor> PointCloud::ProjectToRGBDImages(
+        int width,
+        int height,
+        const core::Tensor &intrinsics,
+        const core::Tensor &extrinsics,
+        float depth_scale,
+        float depth_max) const {
+    if (!HasPointColors()) {
+        utility::LogError(
+                "Unable to project to RGBD without the Color attribute in the "
+                "point cloud.");
+    }
+    core::AssertTensorShape(extrinsics, {utility::nullopt, 4, 4});
+
+    const int64_t num_views = extrinsics.GetLength();
+    core::Tensor depth = core::Tensor::Zeros({num_views, height, width, 1},
+                                             core::Float32, device_);
+    core::Tensor color = core::Tensor::Zeros({num_views, height, width, 3},
+                                             core::Float32, device_);
+
+    core::Tensor point_colors = GetPointColors();
+    if (point_colors.GetDtype() == core::Dtype::UInt8) {
+        point_colors = point_colors.To(core::Dtype::Float32) / 255.0;
+    }
+    point_colors = point_colors.To(core::Float32).Contiguous();
+    kernel::pointcloud::ProjectMultiView(
+            depth, color, GetPointPositions().To(core::Float32).Contiguous(),
+            point_colors, intrinsics, extrinsics, depth_scale, depth_max);
+
+    return std::make_tuple(color, depth);
+}
+
 PointCloud PointCloud::FromLegacy(
         const open3d::geometry::PointCloud &pcd_legacy,
         core::Dtype dtype,
@@ -663,6 +1598,35 @@ PointCloud PointCloud::FromLegacy(
     return pcd;
 }
 
+PointCloud PointCloud::FromLegacy(open3d::geometry::PointCloud &&pcd_legacy,
+                                  core::Dtype dtype,
+                                  const core::Device &device) {
+    if (dtype != core::Float64 || device != core::Device("CPU:0")) {
+        return FromLegacy(pcd_legacy, dtype, device);
+    }
+    // HasColors() and HasNormals() compare sizes with points_, so query them
+    // before the points are moved out.
+    const bool has_colors = pcd_legacy.HasColors();
+    const bool has_normals = pcd_legacy.HasNormals();
+    geometry::PointCloud pcd(device);
+    if (pcd_legacy.HasPoints()) {
+        pcd.SetPointPositions(
+                core::eigen_converter::EigenVector3dVectorToTensor(
+                        std::move(pcd_legacy.points_)));
+    } else {
+        utility::LogWarning("Creating from an empty legacy PointCloud.");
+    }
+    if (has_colors) {
+        pcd.SetPointColors(core::eigen_converter::EigenVector3dVectorToTensor(
+                std::move(pcd_legacy.colors_)));
+    }
+    if (has_normals) {
+        pcd.SetPointNormals(core::eigen_converter::EigenVector3dVectorToTensor(
+                std::move(pcd_legacy.normals_)));
+    }
+    return pcd;
+}
+
 open3d::geometry::PointCloud PointCloud::ToLegacy() const {
     open3d::geometry::PointCloud pcd_legacy;
     if (HasPointPositions()) {
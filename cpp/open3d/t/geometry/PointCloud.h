@@ -30,6 +30,7 @@
 #include <unordered_map>
 #include <unordered_set>
 
+#include "open3d/core/Future.h"
 #include "open3d/core/Tensor.h"
 #include "open3d/core/TensorCheck.h"
 #include "open3d/core/hashmap/HashMap.h"
@@ -45,6 +46,8 @@ namespace open3d {
 namespace t {
 namespace geometry {
 
+class TriangleMesh;
+
 /// \class PointCloud
 /// \brief A point cloud contains a list of 3D points.
 ///
@@ -233,6 +236,12 @@ public:
     /// device.
     PointCloud To(const core::Device &device, bool copy = false) const;
 
+    /// Asynchronous version of To(device, copy), see core::Tensor::ToAsync().
+    /// The copies of all attributes are enqueued on the current stream before
+    /// the host waits, so that they overlap.
+    core::Future<PointCloud> ToAsync(const core::Device &device,
+                                     bool copy = false) const;
+
     /// Returns copy of the point cloud on the same device.
     PointCloud Clone() const;
 
@@ -254,6 +263,35 @@ public:
     /// Returns the center for point coordinates.
     core::Tensor GetCenter() const;
 
+    /// \brief Computes the axis aligned bounding box of every cluster in one
+    /// pass on the device of the point cloud.
+    ///
+    /// \param labels Int32 or Int64 tensor of shape {N,} with the cluster
+    /// label of each point, e.g. from ClusterDBSCAN. Points with negative
+    /// labels are ignored.
+    /// \return The min bounds and max bounds of shape {C, 3}, where C is the
+    /// largest label + 1, with the dtype of the point positions. Clusters
+    /// without points have zero bounds.
+    std::tuple<core::Tensor, core::Tensor> GetClusterAxisAlignedBoundingBoxes(
+            const core::Tensor &labels) const;
+
+    /// \brief Computes the oriented bounding box of every cluster in one pass
+    /// on the device of the point cloud.
+    ///
+    /// The axes of a box are the principal axes of the points of its cluster.
+    /// Unlike the legacy OrientedBoundingBox::CreateFromPoints, the
+    /// covariance is computed from all points instead of their convex hull.
+    ///
+    /// \param labels Int32 or Int64 tensor of shape {N,} with the cluster
+    /// label of each point, e.g. from ClusterDBSCAN. Points with negative
+    /// labels are ignored.
+    /// \return The centers {C, 3}, rotations {C, 3, 3} and extents {C, 3} of
+    /// the boxes, where C is the largest label + 1, with the dtype of the
+    /// point positions. Clusters without points have a zero center and extent
+    /// and an identity rotation.
+    std::tuple<core::Tensor, core::Tensor, core::Tensor>
+    GetClusterOrientedBoundingBoxes(const core::Tensor &labels) const;
+
     /// Append a point cloud and returns the resulting point cloud.
     ///
     /// The point cloud being appended, must have all the attributes
@@ -267,8 +305,8 @@ public:
         return Append(other);
     }
 
-    /// \brief Transforms the PointPositions and PointNormals (if exist)
-    /// of the PointCloud.
+    /// \brief Transforms the PointPositions, PointNormals and the
+    /// "covariances" attribute (if exist) of the PointCloud.
     ///
     /// Transformation matrix is a 4x4 matrix.
     ///  T (4x4) =   [[ R(3x3)  t(3x1) ],
@@ -284,6 +322,8 @@ public:
     ///
     ///   [x, y, z] = [x', y', z'] / w'
     ///
+    ///  Covariances C are rotated as R @ C @ R^T.
+    ///
     /// \param transformation Transformation [Tensor of dim {4,4}].
     /// \return Transformed point cloud
     PointCloud &Transform(const core::Tensor &transformation);
@@ -303,7 +343,8 @@ public:
     /// \return Scaled point cloud
     PointCloud &Scale(double scale, const core::Tensor &center);
 
-    /// \brief Rotates the PointPositions and PointNormals (if exists).
+    /// \brief Rotates the PointPositions, PointNormals and the "covariances"
+    /// attribute (if exist).
     /// \param R Rotation [Tensor of dim {3,3}].
     /// Should be on the same device as the PointCloud
     /// \param center Center [Tensor of dim {3}] about which the PointCloud is
@@ -322,9 +363,30 @@ public:
 
     /// \brief Downsamples a point cloud with a specified voxel size.
     /// \param voxel_size Voxel size. A positive number.
+    /// \param backend Hash backend used to find the occupied voxels.
+    /// \param sort_by_morton_code If true, the output points are in Morton
+    /// order, see SortByMortonCode(). Otherwise the order is unspecified.
     PointCloud VoxelDownSample(double voxel_size,
                                const core::HashBackendType &backend =
-                                       core::HashBackendType::Default) const;
+                                       core::HashBackendType::Default,
+                               bool sort_by_morton_code = false) const;
+
+    /// \brief Returns the point cloud with all point attributes reordered
+    /// along a Morton (Z-order) space-filling curve over its bounding box.
+    ///
+    /// Points that are close in space are then mostly close in memory, which
+    /// improves the cache behavior of neighbor searches and voxel kernels on
+    /// unordered inputs. The sort is stable.
+    PointCloud SortByMortonCode() const;
+
+    /// \brief Downsamples a point cloud to \p num_samples points by farthest
+    /// point sampling, starting from the first point.
+    ///
+    /// \param num_samples Number of points to select, at most the number of
+    /// points in the point cloud.
+    /// \return Point cloud with all attributes of the selected points, in
+    /// selection order.
+    PointCloud FarthestPointDownSample(size_t num_samples) const;
 
     /// \brief Remove points that have less than \p nb_points neighbors in a
     /// sphere of a given radius.
@@ -336,6 +398,137 @@ public:
     std::tuple<PointCloud, core::Tensor> RemoveRadiusOutliers(
             size_t nb_points, double search_radius) const;
 
+    /// \brief Computes the distance from each point to its nearest neighbor
+    /// in \p target.
+    ///
+    /// \param target The point cloud to compute the distances to. Must have
+    /// the same device and position dtype.
+    /// \return Tensor of shape {N,} with the dtype of the positions.
+    core::Tensor ComputeDistance(const PointCloud &target) const;
+
+    /// \brief Computes the Chamfer distance, the mean distance from the points
+    /// to their nearest neighbors in \p target.
+    ///
+    /// \param target The point cloud to compare to.
+    /// \param symmetric If true, the mean distance from \p target to this
+    /// point cloud is added.
+    double ComputeChamferDistance(const PointCloud &target,
+                                  bool symmetric = true) const;
+
+    /// \brief Computes the Hausdorff distance, the maximum distance from the
+    /// points to their nearest neighbors in \p target.
+    ///
+    /// \param target The point cloud to compare to.
+    /// \param symmetric If true, the maximum is also taken over the distances
+    /// from \p target to this point cloud.
+    double ComputeHausdorffDistance(const PointCloud &target,
+                                    bool symmetric = true) const;
+
+    /// \brief Cluster PointCloud using the DBSCAN algorithm.
+    /// Ester et al., "A Density-Based Algorithm for Discovering Clusters
+    /// in Large Spatial Databases with Noise", 1996.
+    ///
+    /// The radius search runs on the device of the point cloud, one tile of
+    /// points at a time, and the clusters are merged with a parallel
+    /// union-find. Border points are assigned to the cluster of their core
+    /// neighbor with the smallest index.
+    ///
+    /// \param eps Density parameter that is used to find neighbouring points.
+    /// \param min_points Minimum number of points to form a cluster.
+    /// \param print_progress If true the progress is visualized in the
+    /// console.
+    /// \return Int32 tensor of shape {N,} with a cluster label per point,
+    /// numbered in the order of their first core point, and -1 for noise.
+    core::Tensor ClusterDBSCAN(double eps,
+                               size_t min_points,
+                               bool print_progress = false) const;
+
+    /// \brief Clusters the connected components of the graph connecting the
+    /// points within \p radius of each other, e.g. to remove small floaters.
+    ///
+    /// Unlike ClusterDBSCAN there is no density threshold, so every point
+    /// belongs to a cluster. The radius search runs on the device of the point
+    /// cloud, one tile of points at a time, and the components are merged
+    /// with a parallel union-find on the same device.
+    ///
+    /// \param radius Radius within which points are connected.
+    /// \return Int64 tensor of shape {N,} with a cluster label per point,
+    /// numbered in the order of their first point.
+    core::Tensor ClusterConnectedComponents(double radius) const;
+
+    /// \brief Segment PointCloud plane using the RANSAC algorithm.
+    ///
+    /// Plane hypotheses are scored in batches: the distances of all points to
+    /// a batch of planes are computed with one matrix multiplication on the
+    /// device of the point cloud.
+    ///
+    /// \param distance_threshold Max distance a point can be from the plane
+    /// model, and still be considered an inlier.
+    /// \param ransac_n Number of initial points to be considered inliers in
+    /// each iteration.
+    /// \param num_iterations Maximum number of iterations.
+    /// \param probability Expected probability of finding the optimal plane.
+    /// \param seed Sets the seed value used in the random generator, set to
+    /// nullopt to use a random seed value with each function call.
+    /// \return Returns the plane model ax + by + cz + d = 0 as a Float64
+    /// tensor of shape {4,} and the Int64 indices of the plane inliers.
+    std::tuple<core::Tensor, core::Tensor> SegmentPlane(
+            const double distance_threshold = 0.01,
+            const int ransac_n = 3,
+            const int num_iterations = 100,
+            const double probability = 0.99999999,
+            utility::optional<int> seed = utility::nullopt) const;
+
+    /// \brief Segment multiple planes, largest first, by repeating
+    /// SegmentPlane on the points that are not inliers of a previous plane.
+    ///
+    /// \param distance_threshold Max distance a point can be from the plane
+    /// model, and still be considered an inlier.
+    /// \param max_planes Maximum number of planes to extract.
+    /// \param min_num_inliers Extraction stops at the first plane with fewer
+    /// inliers.
+    /// \param ransac_n Number of initial points to be considered inliers in
+    /// each iteration.
+    /// \param num_iterations Maximum number of iterations per plane.
+    /// \param probability Expected probability of finding the optimal plane.
+    /// \param seed Sets the seed value used in the random generator, set to
+    /// nullopt to use a random seed value with each function call.
+    /// \return Returns the Float64 plane models of shape {K, 4} and Int32
+    /// labels of shape {N,} with the plane index of each point, or -1.
+    std::tuple<core::Tensor, core::Tensor> SegmentPlanes(
+            const double distance_threshold,
+            const int max_planes,
+            const int64_t min_num_inliers,
+            const int ransac_n = 3,
+            const int num_iterations = 100,
+            const double probability = 0.99999999,
+            utility::optional<int> seed = utility::nullopt) const;
+
+    /// \brief Computes the convex hull of the point cloud.
+    ///
+    /// The positions are passed to qhull without a copy when they are already
+    /// a contiguous Float64 tensor on the CPU.
+    ///
+    /// \param joggle_inputs If true allows the algorithm to add random noise
+    /// to the points to work around degenerate inputs. This adds the 'QJ'
+    /// option to the qhull command.
+    /// \return TriangleMesh of the convex hull, on the device of the point
+    /// cloud. The extra Int64 vertex attribute "point_indices" holds the index
+    /// of each vertex in the point cloud.
+    TriangleMesh ComputeConvexHull(bool joggle_inputs = false) const;
+
+    /// \brief Removes hidden points from the point cloud and returns a mesh
+    /// of the remaining points. Based on Katz et al. 'Direct Visibility of
+    /// Point Sets', 2007.
+    ///
+    /// \param camera_location Float tensor of shape {3} with the location of
+    /// the camera. All points are visible from this location.
+    /// \param radius The radius of the spherical projection.
+    /// \return Tuple of the visible mesh and the Int64 indices of the visible
+    /// points, both on the device of the point cloud.
+    std::tuple<TriangleMesh, core::Tensor> HiddenPointRemoval(
+            const core::Tensor &camera_location, double radius) const;
+
     /// \brief Returns the device attribute of this PointCloud.
     core::Device GetDevice() const { return device_; }
 
@@ -351,6 +544,39 @@ public:
             const int max_nn = 30,
             const utility::optional<double> radius = utility::nullopt);
 
+    /// \brief Function to estimate point normals from precomputed neighbor
+    /// lists, e.g. those of core::nns::IncrementalNeighborGraph maintained
+    /// over a streaming point cloud. If the point cloud normals exist, the
+    /// estimated normals are oriented with respect to the same. The normals
+    /// are the same as those of EstimateNormals() with the same neighbors.
+    /// \param neighbor_indices {N, max_nn} Int32 neighbor rows of each point,
+    /// as returned by HybridSearch. Entries past the count are ignored.
+    /// \param neighbor_counts {N} Int32 number of neighbors of each point.
+    /// Radius outliers can be filtered with neighbor_counts.Ge(nb_points)
+    /// without another search.
+    void EstimateNormalsFromNeighbors(const core::Tensor &neighbor_indices,
+                                      const core::Tensor &neighbor_counts);
+
+    /// \brief Function to consistently orient the normals of the point cloud
+    /// based on consistent tangent planes as described in Hoppe et al.,
+    /// "Surface Reconstruction from Unorganized Points", 1992. The Riemannian
+    /// graph and its minimum spanning tree are built on the CPU, and the
+    /// oriented normals keep their dtype and device.
+    /// \param k k nearest neighbour for graph reconstruction for normal
+    /// propagation.
+    void OrientNormalsConsistentTangentPlane(size_t k);
+
+    /// \brief Function to compute the covariance matrix of the neighborhood
+    /// of each point, stored as the {N, 3, 3} "covariances" attribute. It uses
+    /// KNN search if only max_nn parameter is provided, and HybridSearch if
+    /// radius parameter is also provided.
+    /// \param max_nn Neighbor search max neighbors parameter [Default = 20].
+    /// \param radius [optional] Neighbor search radius parameter to use
+    /// HybridSearch. [Recommended ~1.4x voxel size].
+    void EstimateCovariances(
+            const int max_nn = 20,
+            const utility::optional<double> radius = utility::nullopt);
+
     /// \brief Function to compute point color gradients. If radius is provided,
     /// then HybridSearch is used, otherwise KNN-Search is used.
     /// Reference: Park, Q.-Y. Zhou, and V. Koltun,
@@ -432,12 +658,59 @@ public:
             int stride = 1,
             bool with_normals = false);
 
+    /// \brief Factory function to create a filtered and downsampled point
+    /// cloud from an RGB-D image in a fused pass.
+    ///
+    /// Equivalent to CreateFromRGBDImage followed by a depth range check, a
+    /// flying pixel filter and VoxelDownSample, but only the kept points are
+    /// unprojected, so the full resolution point cloud is never allocated.
+    /// The points are in pixel order before the voxel deduplication.
+    ///
+    /// \param rgbd_image The input RGBD image should have a uint16_t or float
+    /// depth image and RGB image with any DType and the same size.
+    /// \param intrinsics Intrinsic parameters of the camera.
+    /// \param extrinsics Extrinsic parameters of the camera.
+    /// \param depth_scale The depth is scaled by 1 / \p depth_scale.
+    /// \param depth_min Pixels with a depth up to \p depth_min are dropped.
+    /// \param depth_max Pixels with a depth from \p depth_max are dropped.
+    /// \param stride Sampling factor to support coarse point cloud extraction.
+    /// \param depth_diff_max A neighbor pixel is consistent if its depth
+    /// differs by less than \p depth_diff_max.
+    /// \param min_neighbors Pixels with fewer consistent pixels among their 8
+    /// full resolution neighbors are dropped. 0 disables the filter.
+    /// \param voxel_size If positive, only one point is kept per voxel of
+    /// this size. The positions are not snapped to the voxel grid.
+    ///
+    /// \return Created point cloud with the 'points' and 'colors' properties
+    /// set.
+    static PointCloud CreateFromRGBDImageFiltered(
+            const RGBDImage &rgbd_image,
+            const core::Tensor &intrinsics,
+            const core::Tensor &extrinsics =
+                    core::Tensor::Eye(4, core::Float32, core::Device("CPU:0")),
+            float depth_scale = 1000.0f,
+            float depth_min = 0.0f,
+            float depth_max = 3.0f,
+            int stride = 1,
+            float depth_diff_max = 0.05f,
+            int min_neighbors = 0,
+            double voxel_size = 0.0);
+
     /// Create a PointCloud from a legacy Open3D PointCloud.
     static PointCloud FromLegacy(
             const open3d::geometry::PointCloud &pcd_legacy,
             core::Dtype dtype = core::Float32,
             const core::Device &device = core::Device("CPU:0"));
 
+    /// Create a PointCloud from a legacy Open3D PointCloud, moving its
+    /// attributes. With \p dtype Float64 on CPU:0 the tensors take over the
+    /// legacy storage without copying, and \p pcd_legacy is left empty.
+    /// Otherwise this is the same as the copying overload.
+    static PointCloud FromLegacy(
+            open3d::geometry::PointCloud &&pcd_legacy,
+            core::Dtype dtype = core::Float32,
+            const core::Device &device = core::Device("CPU:0"));
+
     /// Convert to a legacy Open3D PointCloud.
     open3d::geometry::PointCloud ToLegacy() const;
 
@@ -461,6 +734,39 @@ public:
             float depth_scale = 1000.0f,
             float depth_max = 3.0f);
 
+    /// \brief Project a point cloud to the depth images of many cameras in
+    /// one pass. Each pixel takes the nearest point, as in
+    /// ProjectToDepthImage.
+    /// \param width Width of the images.
+    /// \param height Height of the images.
+    /// \param intrinsics (3, 3) intrinsics shared by all the views, or
+    /// (V, 3, 3) intrinsics of each view.
+    /// \param extrinsics (V, 4, 4) extrinsics of each view.
+    /// \param depth_scale The depth is scaled by \p depth_scale.
+    /// \param depth_max Points farther than \p depth_max are not projected.
+    /// \return (V, height, width, 1) Float32 depth images, 0 where no point
+    /// projects.
+    core::Tensor ProjectToDepthImages(int width,
+                                      int height,
+                                      const core::Tensor &intrinsics,
+                                      const core::Tensor &extrinsics,
+                                      float depth_scale = 1000.0f,
+                                      float depth_max = 3.0f) const;
+
+    /// \brief Project a colored point cloud to the RGBD images of many
+    /// cameras in one pass. The parameters are the same as for
+    /// ProjectToDepthImages. The color of each pixel is the one of the point
+    /// that gives its depth.
+    /// \return Tuple of the (V, height, width, 3) Float32 color and
+    /// (V, height, width, 1) Float32 depth images.
+    std::tuple<core::Tensor, core::Tensor> ProjectToRGBDImages(
+            int width,
+            int height,
+            const core::Tensor &intrinsics,
+            const core::Tensor &extrinsics,
+            float depth_scale = 1000.0f,
+            float depth_max = 3.0f) const;
+
 protected:
     core::Device device_ = core::Device("CPU:0");
     TensorMap point_attr_;
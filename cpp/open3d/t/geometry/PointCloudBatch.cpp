@@ -0,0 +1,371 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/t/geometry/PointCloudBatch.h"
+
+#include <algorithm>
+
+#include "open3d/core/CUDAUtils.h"
+#include "open3d/core/TensorCheck.h"
+#include "open3d/core/TensorFunction.h"
+#include "open3d/core/hashmap/HashSet.h"
+#include "open3d/core/nns/FixedRadiusIndex.h"
+#include "open3d/t/geometry/kernel/PointCloud.h"
+#include "open3d/t/geometry/kernel/Transform.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+
+namespace {
+
+// Queries are searched in tiles so that the neighbors of all points are never
+// held in memory at the same time.
+constexpr int64_t kTileSize = 1 << 18;
+
+// Returns the row splits of the points [begin, end) of a batch with
+// row_splits, relative to begin.
+core::Tensor TileRowSplits(const core::Tensor &row_splits,
+                           int64_t begin,
+                           int64_t end) {
+    const int64_t size = row_splits.GetLength();
+    const int64_t *splits_ptr = row_splits.GetDataPtr<int64_t>();
+    core::Tensor tile_row_splits({size}, core::Int64);
+    int64_t *tile_splits_ptr = tile_row_splits.GetDataPtr<int64_t>();
+    for (int64_t i = 0; i < size; ++i) {
+        tile_splits_ptr[i] = std::min(std::max(splits_ptr[i], begin), end) -
+                             begin;
+    }
+    return tile_row_splits;
+}
+
+}  // namespace
+
+PointCloudBatch::PointCloudBatch(const core::Device &device)
+    : point_cloud_(device),
+      row_splits_(core::Tensor::Zeros({1}, core::Int64)) {
+    point_cloud_.SetPointPositions(
+            core::Tensor::Empty({0, 3}, core::Float32, device));
+}
+
+PointCloudBatch::PointCloudBatch(const PointCloud &point_cloud,
+                                 const core::Tensor &row_splits)
+    : point_cloud_(point_cloud),
+      row_splits_(row_splits.To(core::Device("CPU:0")).Contiguous()) {
+    core::AssertTensorDtype(row_splits_, core::Int64);
+    core::AssertTensorShape(row_splits_, {utility::nullopt});
+    if (!point_cloud_.HasPointPositions()) {
+        utility::LogError("The point cloud has no positions.");
+    }
+    const int64_t size = row_splits_.GetLength();
+    const int64_t *splits_ptr = row_splits_.GetDataPtr<int64_t>();
+    if (size < 1 || splits_ptr[0] != 0 ||
+        splits_ptr[size - 1] !=
+                point_cloud_.GetPointPositions().GetLength()) {
+        utility::LogError(
+                "row_splits must start at 0 and end at the number of points "
+                "{}.",
+                point_cloud_.GetPointPositions().GetLength());
+    }
+    if (!std::is_sorted(splits_ptr, splits_ptr + size)) {
+        utility::LogError("row_splits must be non-decreasing.");
+    }
+}
+
+PointCloudBatch PointCloudBatch::FromPointClouds(
+        const std::vector<PointCloud> &point_clouds) {
+    if (point_clouds.empty()) {
+        return PointCloudBatch();
+    }
+
+    std::vector<int64_t> row_splits(point_clouds.size() + 1, 0);
+    for (size_t i = 0; i < point_clouds.size(); ++i) {
+        if (point_clouds[i].GetPointAttr().size() !=
+            point_clouds[0].GetPointAttr().size()) {
+            utility::LogError(
+                    "All point clouds of a batch must have the same "
+                    "attributes.");
+        }
+        row_splits[i + 1] = row_splits[i] +
+                            point_clouds[i].GetPointPositions().GetLength();
+    }
+
+    PointCloud point_cloud(point_clouds[0].GetDevice());
+    for (const auto &kv : point_clouds[0].GetPointAttr()) {
+        std::vector<core::Tensor> attrs;
+        attrs.reserve(point_clouds.size());
+        for (const PointCloud &pcd : point_clouds) {
+            if (!pcd.GetPointAttr().Contains(kv.first)) {
+                utility::LogError(
+                        "All point clouds of a batch must have the same "
+                        "attributes, but one has no {}.",
+                        kv.first);
+            }
+            attrs.push_back(pcd.GetPointAttr(kv.first));
+        }
+        point_cloud.SetPointAttr(kv.first, core::Concatenate(attrs, 0));
+    }
+    return PointCloudBatch(
+            point_cloud,
+            core::Tensor(row_splits, {static_cast<int64_t>(row_splits.size())},
+                         core::Int64));
+}
+
+std::vector<PointCloud> PointCloudBatch::ToPointClouds() const {
+    std::vector<PointCloud> point_clouds;
+    point_clouds.reserve(GetBatchSize());
+    for (int64_t i = 0; i < GetBatchSize(); ++i) {
+        point_clouds.push_back(GetPointCloud(i));
+    }
+    return point_clouds;
+}
+
+PointCloud PointCloudBatch::GetPointCloud(int64_t index) const {
+    if (index < 0 || index >= GetBatchSize()) {
+        utility::LogError("Index {} is out of range for a batch of size {}.",
+                          index, GetBatchSize());
+    }
+    const int64_t *splits_ptr = row_splits_.GetDataPtr<int64_t>();
+    PointCloud pcd(GetDevice());
+    for (const auto &kv : point_cloud_.GetPointAttr()) {
+        pcd.SetPointAttr(kv.first, kv.second.Slice(0, splits_ptr[index],
+                                                   splits_ptr[index + 1]));
+    }
+    return pcd;
+}
+
+core::Tensor PointCloudBatch::GetBatchIndices() const {
+    // The index steps up at the first point of every non-empty cloud. The
+    // steps are scattered into zeros and summed up, so that only the
+    // non-empty clouds are visited on the host.
+    const int64_t *splits_ptr = row_splits_.GetDataPtr<int64_t>();
+    std::vector<int64_t> step_points;
+    std::vector<int64_t> steps;
+    int64_t prev_index = 0;
+    for (int64_t i = 0; i < GetBatchSize(); ++i) {
+        if (splits_ptr[i + 1] > splits_ptr[i]) {
+            step_points.push_back(splits_ptr[i]);
+            steps.push_back(i - prev_index);
+            prev_index = i;
+        }
+    }
+
+    core::Tensor batch_indices =
+            core::Tensor::Zeros({GetNumPoints()}, core::Int64, GetDevice());
+    if (!steps.empty()) {
+        const int64_t num_steps = static_cast<int64_t>(steps.size());
+        batch_indices.IndexSet(
+                {core::Tensor(step_points, {num_steps}, core::Int64,
+                              GetDevice())},
+                core::Tensor(steps, {num_steps}, core::Int64, GetDevice()));
+    }
+    return batch_indices.InclusivePrefixSum();
+}
+
+PointCloudBatch PointCloudBatch::To(const core::Device &device,
+                                    bool copy) const {
+    return PointCloudBatch(point_cloud_.To(device, copy),
+                           copy ? row_splits_.Clone() : row_splits_);
+}
+
+std::string PointCloudBatch::ToString() const {
+    return fmt::format("PointCloudBatch of {} point clouds: {}",
+                       GetBatchSize(), point_cloud_.ToString());
+}
+
+PointCloudBatch &PointCloudBatch::Transform(
+        const core::Tensor &transformations) {
+    core::AssertTensorShape(transformations, {GetBatchSize(), 4, 4});
+
+    const core::Tensor batch_indices = GetBatchIndices();
+    kernel::transform::TransformPointsBatched(
+            transformations, batch_indices, point_cloud_.GetPointPositions());
+    if (point_cloud_.HasPointNormals()) {
+        kernel::transform::TransformNormalsBatched(
+                transformations, batch_indices, point_cloud_.GetPointNormals());
+    }
+    if (point_cloud_.HasPointAttr("covariances")) {
+        kernel::transform::TransformCovariancesBatched(
+                transformations, batch_indices,
+                point_cloud_.GetPointAttr("covariances"));
+    }
+    return *this;
+}
+
+PointCloudBatch PointCloudBatch::VoxelDownSample(
+        double voxel_size, const core::HashBackendType &backend) const {
+    if (voxel_size <= 0) {
+        utility::LogError("voxel_size must be positive.");
+    }
+    const int64_t num_points = GetNumPoints();
+    if (num_points == 0) {
+        return To(GetDevice(), /*copy=*/true);
+    }
+
+    // The voxels are keyed by (cloud, x, y, z), so that a single hash set
+    // downsamples all clouds without merging points of different clouds.
+    const core::Tensor &positions = point_cloud_.GetPointPositions();
+    const core::Tensor points_voxeli =
+            (positions / voxel_size).Floor().To(core::Int64);
+    const core::Tensor keys = core::Concatenate(
+            {GetBatchIndices().Reshape({num_points, 1}), points_voxeli}, 1);
+
+    core::HashSet voxels_hashset(num_points, core::Int64, {4}, GetDevice(),
+                                 backend);
+    core::Tensor buf_indices, masks;
+    voxels_hashset.Insert(keys, buf_indices, masks);
+
+    PointCloud pcd_down(GetDevice());
+    for (const auto &kv : point_cloud_.GetPointAttr()) {
+        if (kv.first == "positions") {
+            pcd_down.SetPointAttr(
+                    kv.first,
+                    points_voxeli.IndexGet({masks}).To(positions.GetDtype()) *
+                            voxel_size);
+        } else {
+            pcd_down.SetPointAttr(kv.first, kv.second.IndexGet({masks}));
+        }
+    }
+    return PointCloudBatch(pcd_down, SelectRowSplits(masks));
+}
+
+void PointCloudBatch::EstimateNormals(int max_nn,
+                                      utility::optional<double> radius) {
+    core::AssertTensorDtypes(point_cloud_.GetPointPositions(),
+                             {core::Float32, core::Float64});
+
+    const core::Dtype dtype = point_cloud_.GetPointPositions().GetDtype();
+    const core::Device::DeviceType device_type = GetDevice().GetType();
+    const bool has_normals = point_cloud_.HasPointNormals();
+    if (!has_normals) {
+        point_cloud_.SetPointNormals(
+                core::Tensor::Empty({GetNumPoints(), 3}, dtype, GetDevice()));
+    } else {
+        core::AssertTensorDtype(point_cloud_.GetPointNormals(), dtype);
+        point_cloud_.SetPointNormals(
+                point_cloud_.GetPointNormals().Contiguous());
+    }
+    const core::Tensor positions =
+            point_cloud_.GetPointPositions().Contiguous();
+    core::Tensor &normals = point_cloud_.GetPointNormals();
+
+    if (radius.has_value()) {
+        if (GetNumPoints() == 0) {
+            return;
+        }
+        if (device_type == core::Device::DeviceType::CPU) {
+            kernel::pointcloud::EstimateNormalsUsingBatchedHybridSearchCPU(
+                    positions, row_splits_, normals, radius.value(), max_nn,
+                    has_normals);
+        } else if (device_type == core::Device::DeviceType::CUDA) {
+            CUDA_CALL(kernel::pointcloud::
+                              EstimateNormalsUsingBatchedHybridSearchCUDA,
+                      positions, row_splits_, normals, radius.value(), max_nn,
+                      has_normals);
+        } else {
+            utility::LogError("Unimplemented device");
+        }
+        return;
+    }
+
+    // The kernels write into the slices, which are views of the normals.
+    const int64_t *splits_ptr = row_splits_.GetDataPtr<int64_t>();
+    for (int64_t i = 0; i < GetBatchSize(); ++i) {
+        if (splits_ptr[i + 1] == splits_ptr[i]) {
+            continue;
+        }
+        const core::Tensor positions_i =
+                positions.Slice(0, splits_ptr[i], splits_ptr[i + 1]);
+        core::Tensor normals_i =
+                normals.Slice(0, splits_ptr[i], splits_ptr[i + 1]);
+        if (device_type == core::Device::DeviceType::CPU) {
+            kernel::pointcloud::EstimateNormalsUsingKNNSearchCPU(
+                    positions_i, normals_i, max_nn, has_normals);
+        } else if (device_type == core::Device::DeviceType::CUDA) {
+            CUDA_CALL(kernel::pointcloud::EstimateNormalsUsingKNNSearchCUDA,
+                      positions_i, normals_i, max_nn, has_normals);
+        } else {
+            utility::LogError("Unimplemented device");
+        }
+    }
+}
+
+std::tuple<PointCloudBatch, core::Tensor>
+PointCloudBatch::RemoveRadiusOutliers(size_t nb_points,
+                                      double search_radius) const {
+    if (nb_points < 1 || search_radius <= 0) {
+        utility::LogError(
+                "Illegal input parameters, number of points and radius must be "
+                "positive");
+    }
+    const int64_t num_points = GetNumPoints();
+    core::Tensor valid =
+            core::Tensor::Empty({num_points}, core::Bool, GetDevice());
+    if (num_points > 0) {
+        const core::Tensor positions =
+                point_cloud_.GetPointPositions().Contiguous();
+        core::nns::FixedRadiusIndex index;
+        if (!index.SetTensorData(positions, row_splits_, search_radius,
+                                 core::Int32)) {
+            utility::LogError("Fixed radius search index is not set.");
+        }
+
+        // A hybrid search with nb_points neighbors bounds the output size,
+        // and a point is kept iff its count reaches nb_points.
+        for (int64_t begin = 0; begin < num_points; begin += kTileSize) {
+            const int64_t end = std::min(begin + kTileSize, num_points);
+            core::Tensor indices, distances, counts;
+            std::tie(indices, distances, counts) = index.SearchHybrid(
+                    positions.Slice(0, begin, end),
+                    TileRowSplits(row_splits_, begin, end), search_radius,
+                    static_cast<int>(nb_points));
+            valid.Slice(0, begin, end) =
+                    counts.Ge(static_cast<int64_t>(nb_points));
+        }
+    }
+
+    PointCloud pcd(GetDevice());
+    for (const auto &kv : point_cloud_.GetPointAttr()) {
+        pcd.SetPointAttr(kv.first, kv.second.IndexGet({valid}));
+    }
+    return std::make_tuple(PointCloudBatch(pcd, SelectRowSplits(valid)),
+                           valid);
+}
+
+core::Tensor PointCloudBatch::SelectRowSplits(const core::Tensor &mask) const {
+    const core::Tensor counts =
+            mask.To(core::Int64)
+                    .SegmentSum(row_splits_.To(GetDevice()))
+                    .To(core::Device("CPU:0"));
+    return core::Concatenate({core::Tensor::Zeros({1}, core::Int64),
+                              counts.InclusivePrefixSum()},
+                             0);
+}
+
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,138 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#pragma once
+
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/core/hashmap/HashMap.h"
+#include "open3d/t/geometry/PointCloud.h"
+#include "open3d/utility/Optional.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+
+/// \class PointCloudBatch
+/// \brief A batch of point clouds processed with one kernel launch per
+/// operation instead of one per cloud.
+///
+/// The clouds are stored one after the other in a single PointCloud, and cloud
+/// b holds points [row_splits[b], row_splits[b + 1]). All clouds have the same
+/// point attributes. The row splits are an Int64 tensor on CPU, since they are
+/// needed on the host to size the outputs and to set up the batched neighbor
+/// search.
+///
+/// The operations match the PointCloud operations of the same name applied to
+/// every cloud, except that the neighbor search of the batch uses a spatial
+/// hash grid (FixedRadiusIndex) on all devices.
+class PointCloudBatch {
+public:
+    /// Constructs an empty batch with 0 clouds on \p device.
+    PointCloudBatch(const core::Device &device = core::Device("CPU:0"));
+
+    /// Constructs a batch from the concatenated \p point_cloud and the
+    /// {B + 1} Int64 \p row_splits of its clouds. No data is copied.
+    PointCloudBatch(const PointCloud &point_cloud,
+                    const core::Tensor &row_splits);
+
+    /// Constructs a batch by concatenating \p point_clouds. The clouds must
+    /// have the same attributes, device and dtypes.
+    static PointCloudBatch FromPointClouds(
+            const std::vector<PointCloud> &point_clouds);
+
+    /// Returns the clouds of the batch. The attributes are views of the
+    /// concatenated attributes.
+    std::vector<PointCloud> ToPointClouds() const;
+
+    /// Returns cloud \p index of the batch as a view.
+    PointCloud GetPointCloud(int64_t index) const;
+
+    /// Returns the concatenated clouds.
+    const PointCloud &GetPoints() const { return point_cloud_; }
+
+    /// Returns the {B + 1} Int64 CPU row splits of the clouds.
+    core::Tensor GetRowSplits() const { return row_splits_; }
+
+    /// Returns the Int64 {N} index of the cloud of each point, on the device
+    /// of the batch.
+    core::Tensor GetBatchIndices() const;
+
+    int64_t GetBatchSize() const { return row_splits_.GetLength() - 1; }
+    int64_t GetNumPoints() const { return row_splits_[-1].Item<int64_t>(); }
+    core::Device GetDevice() const { return point_cloud_.GetDevice(); }
+
+    /// Returns the batch on \p device. The buffers are shared if the batch is
+    /// already on \p device and \p copy is false.
+    PointCloudBatch To(const core::Device &device, bool copy = false) const;
+
+    std::string ToString() const;
+
+    /// \brief Transforms every cloud with its own transformation.
+    /// \param transformations {B, 4, 4} transformations, one per cloud.
+    PointCloudBatch &Transform(const core::Tensor &transformations);
+
+    /// \brief Downsamples every cloud with one hash set over all clouds, see
+    /// PointCloud::VoxelDownSample(). The voxels of different clouds are
+    /// kept apart.
+    /// \param voxel_size Voxel size. A positive number.
+    /// \param backend Hash backend used to find the occupied voxels.
+    PointCloudBatch VoxelDownSample(
+            double voxel_size,
+            const core::HashBackendType &backend =
+                    core::HashBackendType::Default) const;
+
+    /// \brief Estimates the normals of every cloud, see
+    /// PointCloud::EstimateNormals(). With a \p radius, the neighbors of all
+    /// clouds are found with one batched hybrid search. Without one, the KNN
+    /// search runs cloud by cloud, since the KNN index has no batch support.
+    void EstimateNormals(
+            int max_nn = 30,
+            utility::optional<double> radius = utility::nullopt);
+
+    /// \brief Removes the points of every cloud that have less than
+    /// \p nb_points neighbors in the same cloud within \p search_radius, see
+    /// PointCloud::RemoveRadiusOutliers().
+    /// \return Tuple of the filtered batch and the boolean mask of the kept
+    /// points of the input batch.
+    std::tuple<PointCloudBatch, core::Tensor> RemoveRadiusOutliers(
+            size_t nb_points, double search_radius) const;
+
+private:
+    /// Returns the row splits of the points of the boolean \p mask.
+    core::Tensor SelectRowSplits(const core::Tensor &mask) const;
+
+    PointCloud point_cloud_;
+    core::Tensor row_splits_;
+};
+
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
@@ -36,12 +36,15 @@
 #include <tutorials/common/math/closest_point.h>
 
 #include <Eigen/Core>
+#include <memory>
 #include <tuple>
+#include <unordered_map>
 #include <vector>
 
 #include "open3d/core/TensorCheck.h"
 #include "open3d/utility/Helper.h"
 #include "open3d/utility/Logging.h"
+#include "open3d/utility/Parallel.h"
 
 namespace {
 
@@ -190,6 +193,85 @@ bool ClosestPointFunc(RTCPointQueryFunctionArguments* args) {
     return false;
 }
 
+// Maps a packet width to the Embree SoA ray packet types and functions.
+template <int K>
+struct RayPacket;
+
+template <>
+struct RayPacket<4> {
+    typedef RTCRay4 Ray;
+    typedef RTCRayHit4 RayHit;
+    static void Intersect(const int* valid,
+                          RTCScene scene,
+                          RTCIntersectContext* context,
+                          RayHit* rayhit) {
+        rtcIntersect4(valid, scene, context, rayhit);
+    }
+    static void Occluded(const int* valid,
+                         RTCScene scene,
+                         RTCIntersectContext* context,
+                         Ray* ray) {
+        rtcOccluded4(valid, scene, context, ray);
+    }
+};
+
+template <>
+struct RayPacket<8> {
+    typedef RTCRay8 Ray;
+    typedef RTCRayHit8 RayHit;
+    static void Intersect(const int* valid,
+                          RTCScene scene,
+                          RTCIntersectContext* context,
+                          RayHit* rayhit) {
+        rtcIntersect8(valid, scene, context, rayhit);
+    }
+    static void Occluded(const int* valid,
+                         RTCScene scene,
+                         RTCIntersectContext* context,
+                         Ray* ray) {
+        rtcOccluded8(valid, scene, context, ray);
+    }
+};
+
+template <>
+struct RayPacket<16> {
+    typedef RTCRay16 Ray;
+    typedef RTCRayHit16 RayHit;
+    static void Intersect(const int* valid,
+                          RTCScene scene,
+                          RTCIntersectContext* context,
+                          RayHit* rayhit) {
+        rtcIntersect16(valid, scene, context, rayhit);
+    }
+    static void Occluded(const int* valid,
+                         RTCScene scene,
+                         RTCIntersectContext* context,
+                         Ray* ray) {
+        rtcOccluded16(valid, scene, context, ray);
+    }
+};
+
+// Fills lane i of the SoA ray packet with the ray r.
+template <class RAY>
+void SetPacketRay(RAY& ray,
+                  int i,
+                  const float* const r,
+                  const float tnear,
+                  const float tfar) {
+    ray.org_x[i] = r[0];
+    ray.org_y[i] = r[1];
+    ray.org_z[i] = r[2];
+    ray.dir_x[i] = r[3];
+    ray.dir_y[i] = r[4];
+    ray.dir_z[i] = r[5];
+    ray.tnear[i] = tnear;
+    ray.tfar[i] = tfar;
+    ray.time[i] = 0.f;
+    ray.mask[i] = 0;
+    ray.id[i] = i;
+    ray.flags[i] = 0;
+}
+
 }  // namespace
 
 namespace open3d {
@@ -205,8 +287,123 @@ struct RaycastingScene::Impl {
     // Vector for storing some information about the added geometry.
     std::vector<std::tuple<RTCGeometryType, const void*, const void*>>
             geometry_ptrs_;
+    // The number of vertices of each geometry.
+    std::vector<size_t> geometry_num_vertices_;
+    // Local vertex positions and transformation for geometries with a
+    // transform set by SetGeometryTransform.
+    struct TransformedGeometry {
+        core::Tensor local_positions;
+        core::Tensor transformation;
+    };
+    std::unordered_map<uint32_t, TransformedGeometry> transformed_geometries_;
+    // Sparse grid of signed distance samples created by
+    // CreateSignedDistanceCache.
+    struct SignedDistanceCache {
+        static const int BRICK_SIZE = 8;
+        // The number of samples per brick along each axis. Neighboring bricks
+        // share the samples on their common faces.
+        static const int BRICK_SAMPLES = BRICK_SIZE + 1;
+        float voxel_size;
+        Eigen::Vector3f origin;
+        Eigen::Vector3i num_bricks;
+        // The index into values for each brick or -1 if the brick is empty.
+        std::vector<int64_t> brick_indices;
+        std::vector<float> values;
+    };
+    std::unique_ptr<SignedDistanceCache> sdf_cache_;
     core::Device tensor_device_;  // cpu
 
+    void AssertValidGeometryID(uint32_t geom_id) const {
+        if (geom_id >= geometry_ptrs_.size()) {
+            utility::LogError("Invalid geometry ID {}, the scene has {} "
+                              "geometries.",
+                              geom_id, geometry_ptrs_.size());
+        }
+    }
+
+    // Writes the vertex positions of a geometry, optionally transformed with
+    // the row major 4x4 matrix T, and marks the geometry for refitting.
+    void WriteVertexPositions(uint32_t geom_id,
+                              const float* const positions,
+                              const float* const T) {
+        float* vertex_buffer = static_cast<float*>(
+                const_cast<void*>(std::get<1>(geometry_ptrs_[geom_id])));
+        const size_t num_vertices = geometry_num_vertices_[geom_id];
+        if (T) {
+            utility::ExecuteInArena([&]() {
+                tbb::parallel_for(
+                        tbb::blocked_range<size_t>(0, num_vertices, BATCH_SIZE),
+                        [&](const tbb::blocked_range<size_t>& range) {
+                            for (size_t i = range.begin(); i < range.end();
+                                 ++i) {
+                                const float* p = &positions[3 * i];
+                                float* v = &vertex_buffer[3 * i];
+                                for (int r = 0; r < 3; ++r) {
+                                    v[r] = T[4 * r + 0] * p[0] +
+                                           T[4 * r + 1] * p[1] +
+                                           T[4 * r + 2] * p[2] + T[4 * r + 3];
+                                }
+                            }
+                        });
+            });
+        } else {
+            memcpy(vertex_buffer, positions, sizeof(float) * 3 * num_vertices);
+        }
+
+        // Refitting keeps the topology of the BVH of this geometry and only
+        // updates the bounds, which is much faster than a rebuild.
+        RTCGeometry geom = rtcGetGeometry(scene_, geom_id);
+        rtcSetGeometryBuildQuality(geom, RTC_BUILD_QUALITY_REFIT);
+        rtcUpdateGeometryBuffer(geom, RTC_BUFFER_TYPE_VERTEX, 0);
+        rtcCommitGeometry(geom);
+        scene_committed_ = false;
+        sdf_cache_.reset();
+    }
+
+    // Interpolates the signed distance at p from the cache. Returns false if
+    // p is not inside a brick of the cache.
+    bool InterpolateSignedDistance(const float* const p, float* sdf) const {
+        const SignedDistanceCache& cache = *sdf_cache_;
+        const int B = SignedDistanceCache::BRICK_SIZE;
+        const int S = SignedDistanceCache::BRICK_SAMPLES;
+        int brick[3];
+        int voxel[3];
+        float frac[3];
+        for (int d = 0; d < 3; ++d) {
+            const float g = (p[d] - cache.origin[d]) / cache.voxel_size;
+            // Also rejects NaN.
+            if (!(g >= 0 && g <= float(cache.num_bricks[d] * B))) {
+                return false;
+            }
+            brick[d] = std::min(int(g) / B, cache.num_bricks[d] - 1);
+            const float local = g - float(brick[d] * B);
+            voxel[d] = std::min(int(local), B - 1);
+            frac[d] = local - float(voxel[d]);
+        }
+        const int64_t brick_idx =
+                cache.brick_indices[(int64_t(brick[2]) * cache.num_bricks[1] +
+                                     brick[1]) *
+                                            cache.num_bricks[0] +
+                                    brick[0]];
+        if (brick_idx < 0) return false;
+
+        const float* values =
+                &cache.values[brick_idx * S * S * S +
+                              (voxel[2] * S + voxel[1]) * S + voxel[0]];
+        float result = 0;
+        for (int corner = 0; corner < 8; ++corner) {
+            const int dx = corner & 1;
+            const int dy = (corner >> 1) & 1;
+            const int dz = (corner >> 2) & 1;
+            const float w = (dx ? frac[0] : 1 - frac[0]) *
+                            (dy ? frac[1] : 1 - frac[1]) *
+                            (dz ? frac[2] : 1 - frac[2]);
+            result += w * values[(dz * S + dy) * S + dx];
+        }
+        *sdf = result;
+        return true;
+    }
+
     template <bool LINE_INTERSECTION>
     void CastRays(const float* const rays,
                   const size_t num_rays,
@@ -293,10 +490,184 @@ struct RaycastingScene::Impl {
                         LoopFn);
             });
         } else {
-            tbb::parallel_for(
-                    tbb::blocked_range<size_t>(0, num_rays, BATCH_SIZE),
-                    LoopFn);
+            utility::ExecuteInArena([&]() {
+                tbb::parallel_for(
+                        tbb::blocked_range<size_t>(0, num_rays, BATCH_SIZE),
+                        LoopFn);
+            });
+        }
+    }
+
+    // The number of rays per packet for the coherent ray mode. This is the
+    // widest packet size natively supported by the CPU.
+    int packet_size_;
+
+    // Calls fn with std::integral_constant<int, packet_size_>.
+    template <class FUNC>
+    void DispatchPacketSize(FUNC fn) {
+        if (packet_size_ == 16) {
+            fn(std::integral_constant<int, 16>());
+        } else if (packet_size_ == 8) {
+            fn(std::integral_constant<int, 8>());
+        } else {
+            fn(std::integral_constant<int, 4>());
+        }
+    }
+
+    // Calls fn(indices) for packets of K rays. Rays of an image with shape
+    // {.., height, width} are grouped in screen space tiles, e.g. 4x4 tiles
+    // for K=16, so that the rays of a packet are coherent. Unused lanes of
+    // the last packets in a row or column are marked with -1.
+    template <int K, class FUNC>
+    void ForEachPacket(const size_t num_rays,
+                       const size_t height,
+                       const size_t width,
+                       const int nthreads,
+                       FUNC fn) {
+        if (num_rays == 0) return;
+        const size_t tile_w = height > 1 ? (K == 4 ? 2 : 4) : K;
+        const size_t tile_h = K / tile_w;
+        const size_t tiles_x = (width + tile_w - 1) / tile_w;
+        const size_t tiles_y = (height + tile_h - 1) / tile_h;
+        const size_t num_tiles = (num_rays / (height * width)) * tiles_y *
+                                 tiles_x;
+
+        auto LoopFn = [&](const tbb::blocked_range<size_t>& range) {
+            int64_t indices[K];
+            for (size_t tile = range.begin(); tile < range.end(); ++tile) {
+                const size_t image = tile / (tiles_y * tiles_x);
+                const size_t ty = (tile / tiles_x) % tiles_y;
+                const size_t tx = tile % tiles_x;
+                for (int i = 0; i < K; ++i) {
+                    const size_t y = ty * tile_h + i / tile_w;
+                    const size_t x = tx * tile_w + i % tile_w;
+                    indices[i] = (y < height && x < width)
+                                         ? int64_t((image * height + y) *
+                                                           width +
+                                                   x)
+                                         : -1;
+                }
+                fn(indices);
+            }
+        };
+
+        const size_t grain_size = std::max<size_t>(1, BATCH_SIZE / K);
+        if (nthreads > 0) {
+            tbb::task_arena arena(nthreads);
+            arena.execute([&]() {
+                tbb::parallel_for(
+                        tbb::blocked_range<size_t>(0, num_tiles, grain_size),
+                        LoopFn);
+            });
+        } else {
+            utility::ExecuteInArena([&]() {
+                tbb::parallel_for(
+                        tbb::blocked_range<size_t>(0, num_tiles, grain_size),
+                        LoopFn);
+            });
+        }
+    }
+
+    template <int K>
+    void CastRaysCoherent(const float* const rays,
+                          const size_t num_rays,
+                          const size_t height,
+                          const size_t width,
+                          float* t_hit,
+                          unsigned int* geometry_ids,
+                          unsigned int* primitive_ids,
+                          float* primitive_uvs,
+                          float* primitive_normals,
+                          const int nthreads) {
+        if (!scene_committed_) {
+            rtcCommitScene(scene_);
+            scene_committed_ = true;
+        }
+
+        struct RTCIntersectContext context;
+        rtcInitIntersectContext(&context);
+        context.flags = RTC_INTERSECT_CONTEXT_FLAG_COHERENT;
+
+        ForEachPacket<K>(num_rays, height, width, nthreads,
+                         [&](const int64_t* indices) {
+            typename RayPacket<K>::RayHit rh;
+            int valid[K];
+            for (int i = 0; i < K; ++i) {
+                valid[i] = indices[i] < 0 ? 0 : -1;
+                if (!valid[i]) continue;
+                SetPacketRay(rh.ray, i, &rays[indices[i] * 6], 0.f,
+                             std::numeric_limits<float>::infinity());
+                rh.hit.geomID[i] = RTC_INVALID_GEOMETRY_ID;
+                rh.hit.instID[0][i] = RTC_INVALID_GEOMETRY_ID;
+            }
+
+            RayPacket<K>::Intersect(valid, scene_, &context, &rh);
+
+            for (int i = 0; i < K; ++i) {
+                if (!valid[i]) continue;
+                const int64_t idx = indices[i];
+                t_hit[idx] = rh.ray.tfar[i];
+                if (rh.hit.geomID[i] != RTC_INVALID_GEOMETRY_ID) {
+                    geometry_ids[idx] = rh.hit.geomID[i];
+                    primitive_ids[idx] = rh.hit.primID[i];
+                    primitive_uvs[idx * 2 + 0] = rh.hit.u[i];
+                    primitive_uvs[idx * 2 + 1] = rh.hit.v[i];
+                    float inv_norm =
+                            1.f / std::sqrt(rh.hit.Ng_x[i] * rh.hit.Ng_x[i] +
+                                            rh.hit.Ng_y[i] * rh.hit.Ng_y[i] +
+                                            rh.hit.Ng_z[i] * rh.hit.Ng_z[i]);
+                    primitive_normals[idx * 3 + 0] = rh.hit.Ng_x[i] * inv_norm;
+                    primitive_normals[idx * 3 + 1] = rh.hit.Ng_y[i] * inv_norm;
+                    primitive_normals[idx * 3 + 2] = rh.hit.Ng_z[i] * inv_norm;
+                } else {
+                    geometry_ids[idx] = RTC_INVALID_GEOMETRY_ID;
+                    primitive_ids[idx] = RTC_INVALID_GEOMETRY_ID;
+                    primitive_uvs[idx * 2 + 0] = 0;
+                    primitive_uvs[idx * 2 + 1] = 0;
+                    primitive_normals[idx * 3 + 0] = 0;
+                    primitive_normals[idx * 3 + 1] = 0;
+                    primitive_normals[idx * 3 + 2] = 0;
+                }
+            }
+        });
+    }
+
+    template <int K>
+    void TestOcclusionsCoherent(const float* const rays,
+                                const size_t num_rays,
+                                const size_t height,
+                                const size_t width,
+                                const float tnear,
+                                const float tfar,
+                                int8_t* occluded,
+                                const int nthreads) {
+        if (!scene_committed_) {
+            rtcCommitScene(scene_);
+            scene_committed_ = true;
         }
+
+        struct RTCIntersectContext context;
+        rtcInitIntersectContext(&context);
+        context.flags = RTC_INTERSECT_CONTEXT_FLAG_COHERENT;
+
+        ForEachPacket<K>(num_rays, height, width, nthreads,
+                         [&](const int64_t* indices) {
+            typename RayPacket<K>::Ray ray;
+            int valid[K];
+            for (int i = 0; i < K; ++i) {
+                valid[i] = indices[i] < 0 ? 0 : -1;
+                if (!valid[i]) continue;
+                SetPacketRay(ray, i, &rays[indices[i] * 6], tnear, tfar);
+            }
+
+            RayPacket<K>::Occluded(valid, scene_, &context, &ray);
+
+            for (int i = 0; i < K; ++i) {
+                if (!valid[i]) continue;
+                occluded[indices[i]] = int8_t(
+                        -std::numeric_limits<float>::infinity() == ray.tfar[i]);
+            }
+        });
     }
 
     void TestOcclusions(const float* const rays,
@@ -350,9 +721,11 @@ struct RaycastingScene::Impl {
                         LoopFn);
             });
         } else {
-            tbb::parallel_for(
-                    tbb::blocked_range<size_t>(0, num_rays, BATCH_SIZE),
-                    LoopFn);
+            utility::ExecuteInArena([&]() {
+                tbb::parallel_for(
+                        tbb::blocked_range<size_t>(0, num_rays, BATCH_SIZE),
+                        LoopFn);
+            });
         }
     }
 
@@ -412,9 +785,11 @@ struct RaycastingScene::Impl {
                         LoopFn);
             });
         } else {
-            tbb::parallel_for(
-                    tbb::blocked_range<size_t>(0, num_rays, BATCH_SIZE),
-                    LoopFn);
+            utility::ExecuteInArena([&]() {
+                tbb::parallel_for(
+                        tbb::blocked_range<size_t>(0, num_rays, BATCH_SIZE),
+                        LoopFn);
+            });
         }
     }
 
@@ -462,9 +837,11 @@ struct RaycastingScene::Impl {
                                   LoopFn);
             });
         } else {
-            tbb::parallel_for(
-                    tbb::blocked_range<size_t>(0, num_query_points, BATCH_SIZE),
-                    LoopFn);
+            utility::ExecuteInArena([&]() {
+                tbb::parallel_for(tbb::blocked_range<size_t>(
+                                          0, num_query_points, BATCH_SIZE),
+                                  LoopFn);
+            });
         }
     }
 };
@@ -480,6 +857,17 @@ RaycastingScene::RaycastingScene() : impl_(new RaycastingScene::Impl()) {
             RTC_SCENE_FLAG_ROBUST | RTC_SCENE_FLAG_CONTEXT_FILTER_FUNCTION);
 
     impl_->scene_committed_ = false;
+
+    if (rtcGetDeviceProperty(impl_->device_,
+                             RTC_DEVICE_PROPERTY_NATIVE_RAY16_SUPPORTED)) {
+        impl_->packet_size_ = 16;
+    } else if (rtcGetDeviceProperty(
+                       impl_->device_,
+                       RTC_DEVICE_PROPERTY_NATIVE_RAY8_SUPPORTED)) {
+        impl_->packet_size_ = 8;
+    } else {
+        impl_->packet_size_ = 4;
+    }
 }
 
 RaycastingScene::~RaycastingScene() {
@@ -501,6 +889,7 @@ uint32_t RaycastingScene::AddTriangles(const core::Tensor& vertex_positions,
 
     // scene needs to be recommitted
     impl_->scene_committed_ = false;
+    impl_->sdf_cache_.reset();
     RTCGeometry geom =
             rtcNewGeometry(impl_->device_, RTC_GEOMETRY_TYPE_TRIANGLE);
 
@@ -531,9 +920,59 @@ uint32_t RaycastingScene::AddTriangles(const core::Tensor& vertex_positions,
     impl_->geometry_ptrs_.push_back(std::make_tuple(RTC_GEOMETRY_TYPE_TRIANGLE,
                                                     (const void*)vertex_buffer,
                                                     (const void*)index_buffer));
+    impl_->geometry_num_vertices_.push_back(num_vertices);
     return geom_id;
 }
 
+void RaycastingScene::UpdateTriangles(uint32_t geom_id,
+                                      const core::Tensor& vertex_positions) {
+    impl_->AssertValidGeometryID(geom_id);
+    core::AssertTensorDevice(vertex_positions, impl_->tensor_device_);
+    core::AssertTensorShape(
+            vertex_positions,
+            {int64_t(impl_->geometry_num_vertices_[geom_id]), 3});
+    core::AssertTensorDtype(vertex_positions, core::Float32);
+
+    auto it = impl_->transformed_geometries_.find(geom_id);
+    if (it != impl_->transformed_geometries_.end()) {
+        it->second.local_positions = vertex_positions.Contiguous().Clone();
+        impl_->WriteVertexPositions(
+                geom_id, it->second.local_positions.GetDataPtr<float>(),
+                it->second.transformation.GetDataPtr<float>());
+    } else {
+        auto data = vertex_positions.Contiguous();
+        impl_->WriteVertexPositions(geom_id, data.GetDataPtr<float>(),
+                                    nullptr);
+    }
+}
+
+void RaycastingScene::SetGeometryTransform(uint32_t geom_id,
+                                           const core::Tensor& transformation) {
+    impl_->AssertValidGeometryID(geom_id);
+    core::AssertTensorDevice(transformation, impl_->tensor_device_);
+    core::AssertTensorShape(transformation, {4, 4});
+
+    auto it = impl_->transformed_geometries_.find(geom_id);
+    if (it == impl_->transformed_geometries_.end()) {
+        // Keep the current positions as the local frame of the geometry.
+        const int64_t num_vertices =
+                int64_t(impl_->geometry_num_vertices_[geom_id]);
+        core::Tensor local_positions({num_vertices, 3}, core::Float32);
+        memcpy(local_positions.GetDataPtr<float>(),
+               std::get<1>(impl_->geometry_ptrs_[geom_id]),
+               sizeof(float) * 3 * num_vertices);
+        it = impl_->transformed_geometries_
+                     .emplace(geom_id, Impl::TransformedGeometry{
+                                               local_positions, core::Tensor()})
+                     .first;
+    }
+    it->second.transformation =
+            transformation.To(core::Float32).Contiguous().Clone();
+    impl_->WriteVertexPositions(geom_id,
+                                it->second.local_positions.GetDataPtr<float>(),
+                                it->second.transformation.GetDataPtr<float>());
+}
+
 uint32_t RaycastingScene::AddTriangles(const TriangleMesh& mesh) {
     size_t num_verts = mesh.GetVertexPositions().GetLength();
     if (num_verts > std::numeric_limits<uint32_t>::max()) {
@@ -546,7 +985,7 @@ uint32_t RaycastingScene::AddTriangles(const TriangleMesh& mesh) {
 }
 
 std::unordered_map<std::string, core::Tensor> RaycastingScene::CastRays(
-        const core::Tensor& rays, const int nthreads) {
+        const core::Tensor& rays, const int nthreads, const bool coherent) {
     AssertTensorDtypeLastDimDeviceMinNDim<float>(rays, "rays", 6,
                                                  impl_->tensor_device_);
     auto shape = rays.GetShape();
@@ -564,6 +1003,22 @@ std::unordered_map<std::string, core::Tensor> RaycastingScene::CastRays(
     result["primitive_normals"] = core::Tensor(shape, core::Float32);
 
     auto data = rays.Contiguous();
+    if (coherent) {
+        // Rays with shape {.., height, width, 6} are traced in image tiles.
+        const size_t height = rays.NumDims() > 2 ? rays.GetShape(-3) : 1;
+        const size_t width =
+                rays.NumDims() > 2 ? rays.GetShape(-2) : num_rays;
+        impl_->DispatchPacketSize([&](auto packet_size) {
+            impl_->CastRaysCoherent<decltype(packet_size)::value>(
+                    data.GetDataPtr<float>(), num_rays, height, width,
+                    result["t_hit"].GetDataPtr<float>(),
+                    result["geometry_ids"].GetDataPtr<uint32_t>(),
+                    result["primitive_ids"].GetDataPtr<uint32_t>(),
+                    result["primitive_uvs"].GetDataPtr<float>(),
+                    result["primitive_normals"].GetDataPtr<float>(), nthreads);
+        });
+        return result;
+    }
     impl_->CastRays<false>(data.GetDataPtr<float>(), num_rays,
                            result["t_hit"].GetDataPtr<float>(),
                            result["geometry_ids"].GetDataPtr<uint32_t>(),
@@ -578,7 +1033,8 @@ std::unordered_map<std::string, core::Tensor> RaycastingScene::CastRays(
 core::Tensor RaycastingScene::TestOcclusions(const core::Tensor& rays,
                                              const float tnear,
                                              const float tfar,
-                                             const int nthreads) {
+                                             const int nthreads,
+                                             const bool coherent) {
     AssertTensorDtypeLastDimDeviceMinNDim<float>(rays, "rays", 6,
                                                  impl_->tensor_device_);
     auto shape = rays.GetShape();
@@ -589,6 +1045,18 @@ core::Tensor RaycastingScene::TestOcclusions(const core::Tensor& rays,
     core::Tensor result(shape, core::Bool);
 
     auto data = rays.Contiguous();
+    if (coherent) {
+        const size_t height = rays.NumDims() > 2 ? rays.GetShape(-3) : 1;
+        const size_t width =
+                rays.NumDims() > 2 ? rays.GetShape(-2) : num_rays;
+        impl_->DispatchPacketSize([&](auto packet_size) {
+            impl_->TestOcclusionsCoherent<decltype(packet_size)::value>(
+                    data.GetDataPtr<float>(), num_rays, height, width, tnear,
+                    tfar, reinterpret_cast<int8_t*>(result.GetDataPtr<bool>()),
+                    nthreads);
+        });
+        return result;
+    }
     impl_->TestOcclusions(data.GetDataPtr<float>(), num_rays, tnear, tfar,
                           reinterpret_cast<int8_t*>(result.GetDataPtr<bool>()),
                           nthreads);
@@ -665,7 +1133,9 @@ core::Tensor RaycastingScene::ComputeDistance(const core::Tensor& query_points,
 }
 
 core::Tensor RaycastingScene::ComputeSignedDistance(
-        const core::Tensor& query_points, const int nthreads) {
+        const core::Tensor& query_points,
+        const int nthreads,
+        const bool use_cache) {
     AssertTensorDtypeLastDimDeviceMinNDim<float>(query_points, "query_points",
                                                  3, impl_->tensor_device_);
     auto shape = query_points.GetShape();
@@ -674,6 +1144,59 @@ core::Tensor RaycastingScene::ComputeSignedDistance(
     size_t num_query_points = shape.NumElements();
 
     auto data = query_points.Contiguous();
+    if (use_cache) {
+        if (!impl_->sdf_cache_) {
+            utility::LogError(
+                    "No signed distance cache. Call "
+                    "CreateSignedDistanceCache() first.");
+        }
+        core::Tensor distance(shape, core::Float32);
+        const float* points_ptr = data.GetDataPtr<float>();
+        float* distance_ptr = distance.GetDataPtr<float>();
+        std::vector<int8_t> cached(num_query_points);
+        auto LoopFn = [&](const tbb::blocked_range<size_t>& range) {
+            for (size_t i = range.begin(); i < range.end(); ++i) {
+                cached[i] = impl_->InterpolateSignedDistance(
+                        &points_ptr[3 * i], &distance_ptr[i]);
+            }
+        };
+        if (nthreads > 0) {
+            tbb::task_arena arena(nthreads);
+            arena.execute([&]() {
+                tbb::parallel_for(tbb::blocked_range<size_t>(
+                                          0, num_query_points, 1024),
+                                  LoopFn);
+            });
+        } else {
+            utility::ExecuteInArena([&]() {
+                tbb::parallel_for(tbb::blocked_range<size_t>(
+                                          0, num_query_points, 1024),
+                                  LoopFn);
+            });
+        }
+
+        // Compute the points outside of the cache exactly.
+        std::vector<int64_t> misses;
+        for (size_t i = 0; i < num_query_points; ++i) {
+            if (!cached[i]) misses.push_back(i);
+        }
+        if (!misses.empty()) {
+            core::Tensor miss_points({int64_t(misses.size()), 3},
+                                     core::Float32);
+            float* miss_points_ptr = miss_points.GetDataPtr<float>();
+            for (size_t i = 0; i < misses.size(); ++i) {
+                memcpy(&miss_points_ptr[3 * i], &points_ptr[3 * misses[i]],
+                       3 * sizeof(float));
+            }
+            core::Tensor miss_distance =
+                    ComputeSignedDistance(miss_points, nthreads);
+            const float* miss_distance_ptr = miss_distance.GetDataPtr<float>();
+            for (size_t i = 0; i < misses.size(); ++i) {
+                distance_ptr[misses[i]] = miss_distance_ptr[i];
+            }
+        }
+        return distance;
+    }
     auto distance = ComputeDistance(data, nthreads);
     core::Tensor rays({int64_t(num_query_points), 6}, core::Float32);
     rays.SetItem({core::TensorKey::Slice(0, num_query_points, 1),
@@ -695,6 +1218,133 @@ core::Tensor RaycastingScene::ComputeSignedDistance(
     return distance;
 }
 
+int64_t RaycastingScene::CreateSignedDistanceCache(const float voxel_size,
+                                                   const float truncation,
+                                                   const int nthreads) {
+    using Cache = Impl::SignedDistanceCache;
+    if (!(voxel_size > 0)) {
+        utility::LogError("voxel_size must be positive but is {}", voxel_size);
+    }
+    if (!(truncation >= 0)) {
+        utility::LogError("truncation must not be negative but is {}",
+                          truncation);
+    }
+    if (impl_->geometry_ptrs_.empty()) {
+        utility::LogError("Cannot create a cache for an empty scene.");
+    }
+
+    // Bounds of all vertices, enlarged by the truncation distance.
+    Eigen::Vector3f min_bound = Eigen::Vector3f::Constant(
+            std::numeric_limits<float>::infinity());
+    Eigen::Vector3f max_bound = -min_bound;
+    for (size_t geom_id = 0; geom_id < impl_->geometry_ptrs_.size();
+         ++geom_id) {
+        Eigen::Map<const Eigen::Matrix3Xf> vertices(
+                static_cast<const float*>(
+                        std::get<1>(impl_->geometry_ptrs_[geom_id])),
+                3, impl_->geometry_num_vertices_[geom_id]);
+        if (vertices.cols() == 0) continue;
+        min_bound = min_bound.cwiseMin(vertices.rowwise().minCoeff());
+        max_bound = max_bound.cwiseMax(vertices.rowwise().maxCoeff());
+    }
+    if (!(min_bound.array() <= max_bound.array()).all()) {
+        utility::LogError(
+                "Cannot create a cache for a scene without vertices.");
+    }
+
+    std::unique_ptr<Cache> cache(new Cache());
+    cache->voxel_size = voxel_size;
+    cache->origin = min_bound.array() - truncation;
+    const float brick_extent = Cache::BRICK_SIZE * voxel_size;
+    int64_t num_bricks = 1;
+    for (int d = 0; d < 3; ++d) {
+        const double extent = max_bound[d] + truncation - cache->origin[d];
+        cache->num_bricks[d] =
+                std::max(1, int(std::ceil(extent / brick_extent)));
+        num_bricks *= cache->num_bricks[d];
+    }
+    const int64_t max_bricks = int64_t(1) << 30;
+    if (num_bricks > max_bricks) {
+        utility::LogError(
+                "The cache would need {} bricks. Use a larger voxel_size.",
+                num_bricks);
+    }
+
+    // Keep the bricks that may contain points within truncation of the
+    // surface.
+    core::Tensor brick_centers({num_bricks, 3}, core::Float32);
+    {
+        Eigen::Map<Eigen::Matrix3Xf> centers(
+                brick_centers.GetDataPtr<float>(), 3, num_bricks);
+        int64_t i = 0;
+        for (int z = 0; z < cache->num_bricks[2]; ++z) {
+            for (int y = 0; y < cache->num_bricks[1]; ++y) {
+                for (int x = 0; x < cache->num_bricks[0]; ++x, ++i) {
+                    centers.col(i) = cache->origin +
+                                     (Eigen::Vector3f(x, y, z).array() + 0.5f)
+                                                     .matrix() *
+                                             brick_extent;
+                }
+            }
+        }
+    }
+    const core::Tensor center_distance =
+            ComputeDistance(brick_centers, nthreads);
+    const float* center_distance_ptr = center_distance.GetDataPtr<float>();
+    const float max_center_distance =
+            0.5f * std::sqrt(3.f) * brick_extent + truncation;
+    cache->brick_indices.resize(num_bricks, -1);
+    std::vector<int64_t> bricks;
+    for (int64_t i = 0; i < num_bricks; ++i) {
+        if (center_distance_ptr[i] <= max_center_distance) {
+            cache->brick_indices[i] = bricks.size();
+            bricks.push_back(i);
+        }
+    }
+
+    // Sample the signed distance of the kept bricks in chunks to bound the
+    // temporary memory.
+    const int64_t S = Cache::BRICK_SAMPLES;
+    const int64_t samples_per_brick = S * S * S;
+    const int64_t chunk_size = 4096;
+    cache->values.resize(bricks.size() * samples_per_brick);
+    for (size_t begin = 0; begin < bricks.size(); begin += chunk_size) {
+        const int64_t end = std::min(bricks.size(), begin + chunk_size);
+        core::Tensor samples({(end - int64_t(begin)) * samples_per_brick, 3},
+                             core::Float32);
+        Eigen::Map<Eigen::Matrix3Xf> samples_map(samples.GetDataPtr<float>(),
+                                                 3, samples.GetLength());
+        int64_t i = 0;
+        for (int64_t b = begin; b < end; ++b) {
+            const int64_t brick = bricks[b];
+            const Eigen::Vector3f brick_origin =
+                    cache->origin +
+                    Eigen::Vector3f(
+                            brick % cache->num_bricks[0],
+                            (brick / cache->num_bricks[0]) %
+                                    cache->num_bricks[1],
+                            brick / (int64_t(cache->num_bricks[0]) *
+                                     cache->num_bricks[1])) *
+                            brick_extent;
+            for (int z = 0; z < S; ++z) {
+                for (int y = 0; y < S; ++y) {
+                    for (int x = 0; x < S; ++x, ++i) {
+                        samples_map.col(i) = brick_origin +
+                                             Eigen::Vector3f(x, y, z) *
+                                                     voxel_size;
+                    }
+                }
+            }
+        }
+        const core::Tensor sdf = ComputeSignedDistance(samples, nthreads);
+        memcpy(&cache->values[begin * samples_per_brick],
+               sdf.GetDataPtr<float>(), sizeof(float) * sdf.NumElements());
+    }
+
+    impl_->sdf_cache_ = std::move(cache);
+    return bricks.size();
+}
+
 core::Tensor RaycastingScene::ComputeOccupancy(const core::Tensor& query_points,
                                                const int nthreads) {
     AssertTensorDtypeLastDimDeviceMinNDim<float>(query_points, "query_points",
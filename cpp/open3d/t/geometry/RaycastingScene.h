@@ -65,6 +65,31 @@ public:
     /// \return The geometry ID of the added mesh.
     uint32_t AddTriangles(const TriangleMesh &mesh);
 
+    /// \brief Replaces the vertex positions of a mesh in the scene.
+    ///
+    /// The triangles are kept and the acceleration structure of the mesh is
+    /// refitted on the next query instead of being rebuilt. This is intended
+    /// for deforming meshes that keep their topology.
+    /// \param geom_id The geometry ID returned by AddTriangles.
+    /// \param vertex_positions Vertices as Tensor of dim {N,3} and dtype
+    /// float. N must match the number of vertices of the mesh. If a transform
+    /// was set with SetGeometryTransform, the positions are in the local
+    /// coordinate frame of the mesh and the transform is applied to them.
+    void UpdateTriangles(uint32_t geom_id,
+                         const core::Tensor &vertex_positions);
+
+    /// \brief Sets a rigid transformation for a mesh in the scene.
+    ///
+    /// The transformation is applied to the vertex positions as they were
+    /// when it was first set, so repeated calls do not accumulate errors.
+    /// Like UpdateTriangles, this refits the acceleration structure of the
+    /// mesh instead of rebuilding the scene.
+    /// \param geom_id The geometry ID returned by AddTriangles.
+    /// \param transformation A Tensor of dim {4,4} with the transformation
+    /// from the local frame of the mesh to the scene frame.
+    void SetGeometryTransform(uint32_t geom_id,
+                              const core::Tensor &transformation);
+
     /// \brief Computes the first intersection of the rays with the scene.
     /// \param rays A tensor with >=2 dims, shape {.., 6}, and Dtype Float32
     /// describing the rays.
@@ -75,6 +100,10 @@ public:
     /// necessary to normalize the direction but the returned hit distance uses
     /// the length of the direction vector as unit.
     /// \param nthreads The number of threads to use. Set to 0 for automatic.
+    /// \param coherent If true, the rays are traced in SIMD packets. Rays with
+    /// shape {.., height, width, 6} are grouped in small screen space tiles.
+    /// This is faster for coherent rays, e.g., camera rays generated with
+    /// CreateRaysPinhole, and slower for random rays.
     /// \return The returned dictionary contains:
     ///         - \b t_hit A tensor with the distance to the first hit. The
     ///           shape is {..}. If there is no intersection the hit distance
@@ -89,7 +118,9 @@ public:
     ///         - \b primitive_normals A tensor with the normals of the hit
     ///           triangles. The shape is {.., 3}.
     std::unordered_map<std::string, core::Tensor> CastRays(
-            const core::Tensor &rays, const int nthreads = 0);
+            const core::Tensor &rays,
+            const int nthreads = 0,
+            const bool coherent = false);
 
     /// \brief Checks if the rays have any intersection with the scene.
     /// \param rays A tensor with >=2 dims, shape {.., 6}, and Dtype Float32
@@ -102,13 +133,16 @@ public:
     /// \param tnear The tnear offset for the rays. The default is 0.
     /// \param tfar The tfar value for the ray. The default is infinity.
     /// \param nthreads The number of threads to use. Set to 0 for automatic.
+    /// \param coherent If true, the rays are traced in SIMD packets as in
+    /// CastRays.
     /// \return A boolean tensor which indicates if the ray is occluded by the
     /// scene (true) or not (false).
     core::Tensor TestOcclusions(
             const core::Tensor &rays,
             const float tnear = 0.f,
             const float tfar = std::numeric_limits<float>::infinity(),
-            const int nthreads = 0);
+            const int nthreads = 0,
+            const bool coherent = false);
 
     /// \brief Computes the number of intersection of the rays with the scene.
     /// \param rays A tensor with >=2 dims, shape {.., 6}, and Dtype Float32
@@ -166,11 +200,33 @@ public:
     /// shape can be {depth, height, width, 3}. The last dimension must be 3 and
     /// has the format [x, y, z].
     /// \param nthreads The number of threads to use. Set to 0 for automatic.
+    /// \param use_cache If true, the distances of query points inside the
+    /// cache created with CreateSignedDistanceCache are interpolated from the
+    /// cache. All other points are computed exactly.
     /// \return A tensor with the signed distances to
     /// the surface. The shape is
     /// {..}. Negative distances mean a point is inside a closed surface.
     core::Tensor ComputeSignedDistance(const core::Tensor &query_points,
-                                       const int nthreads = 0);
+                                       const int nthreads = 0,
+                                       const bool use_cache = false);
+
+    /// \brief Precomputes signed distances near the surface for fast queries.
+    ///
+    /// The signed distance is sampled on a sparse grid of bricks with 8x8x8
+    /// voxels. Only bricks within \p truncation of the surface are stored.
+    /// ComputeSignedDistance with use_cache=true then interpolates the
+    /// distances of points inside these bricks trilinearly, which is much
+    /// faster than the exact computation for large numbers of queries.
+    /// The cache is discarded when the geometry of the scene changes.
+    ///
+    /// \param voxel_size The distance between the samples of the cache.
+    /// \param truncation The distance to the surface up to which the cache
+    /// covers the query points.
+    /// \param nthreads The number of threads to use. Set to 0 for automatic.
+    /// \return The number of bricks in the cache.
+    int64_t CreateSignedDistanceCache(const float voxel_size,
+                                      const float truncation,
+                                      const int nthreads = 0);
 
     /// \brief Computes the occupancy at the query point positions.
     ///
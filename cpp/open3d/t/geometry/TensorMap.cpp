@@ -31,7 +31,10 @@
 #include <sstream>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
+#include "open3d/core/TensorCheck.h"
+#include "open3d/core/kernel/IndexGetSet.h"
 #include "open3d/utility/Logging.h"
 
 namespace open3d {
@@ -90,6 +93,41 @@ TensorMap TensorMap::Contiguous() const {
     return tensor_map_contiguous;
 }
 
+TensorMap TensorMap::Slice(int64_t start, int64_t stop, int64_t step) const {
+    TensorMap tensor_map_slice(GetPrimaryKey());
+    for (const auto& kv : *this) {
+        tensor_map_slice[kv.first] = kv.second.Slice(0, start, stop, step);
+    }
+    return tensor_map_slice;
+}
+
+TensorMap TensorMap::IndexGet(const core::Tensor& indices) const {
+    TensorMap tensor_map_selected(GetPrimaryKey());
+    if (indices.GetDtype() == core::Bool) {
+        if (Contains(primary_key_)) {
+            core::AssertTensorShape(indices, {GetPrimarySize()});
+        }
+        // All the tensors are compacted with one pass over the mask.
+        std::vector<std::string> keys;
+        std::vector<core::Tensor> tensors;
+        for (const auto& kv : *this) {
+            keys.push_back(kv.first);
+            tensors.push_back(kv.second);
+        }
+        std::vector<core::Tensor> selected =
+                core::kernel::MaskedIndexGet(tensors, indices);
+        for (size_t i = 0; i < keys.size(); ++i) {
+            tensor_map_selected[keys[i]] = selected[i];
+        }
+        return tensor_map_selected;
+    }
+    core::AssertTensorDtype(indices, core::Int64);
+    for (const auto& kv : *this) {
+        tensor_map_selected[kv.first] = kv.second.IndexGet({indices});
+    }
+    return tensor_map_selected;
+}
+
 }  // namespace geometry
 }  // namespace t
 }  // namespace open3d
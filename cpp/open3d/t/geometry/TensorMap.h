@@ -129,6 +129,17 @@ public:
     /// memory will be used.
     TensorMap Contiguous() const;
 
+    /// Returns a TensorMap of views of the rows [start, stop) with \p step of
+    /// all the tensors. No memory is copied, the views share the memory of
+    /// this TensorMap.
+    TensorMap Slice(int64_t start, int64_t stop, int64_t step = 1) const;
+
+    /// Returns a TensorMap with the rows of all the tensors selected by
+    /// \p indices, an Int64 tensor of row indices or a Bool mask of the
+    /// primary size. With a mask all the tensors are compacted in one pass
+    /// over the mask, without materializing row indices.
+    TensorMap IndexGet(const core::Tensor& indices) const;
+
     /// Returns true if the key exists in the map.
     /// Same as C++20's std::unordered_map::contains().
     bool Contains(const std::string& key) const { return count(key) != 0; }
@@ -220,6 +220,76 @@ geometry::TriangleMesh TriangleMesh::FromLegacy(
     return mesh;
 }
 
+geometry::TriangleMesh TriangleMesh::FromLegacy(
+        open3d::geometry::TriangleMesh &&mesh_legacy,
+        core::Dtype float_dtype,
+        core::Dtype int_dtype,
+        const core::Device &device) {
+    if (float_dtype != core::Float32 && float_dtype != core::Float64) {
+        utility::LogError("float_dtype must be Float32 or Float64, but got {}.",
+                          float_dtype.ToString());
+    }
+    if (int_dtype != core::Int32 && int_dtype != core::Int64) {
+        utility::LogError("int_dtype must be Int32 or Int64, but got {}.",
+                          int_dtype.ToString());
+    }
+
+    // Attributes whose dtype matches the legacy storage are moved, the others
+    // are converted.
+    const bool on_host = device == core::Device("CPU:0");
+    const bool move_float = on_host && float_dtype == core::Float64;
+    const bool move_int = on_host && int_dtype == core::Int32;
+    auto float_tensor = [&](std::vector<Eigen::Vector3d> &values) {
+        return move_float ? core::eigen_converter::EigenVector3dVectorToTensor(
+                                    std::move(values))
+                          : core::eigen_converter::EigenVector3dVectorToTensor(
+                                    values, float_dtype, device);
+    };
+
+    // Has*() compare sizes with vertices_ and triangles_, so query them
+    // before anything is moved out.
+    const bool has_vertices = mesh_legacy.HasVertices();
+    const bool has_vertex_colors = mesh_legacy.HasVertexColors();
+    const bool has_vertex_normals = mesh_legacy.HasVertexNormals();
+    const bool has_triangles = mesh_legacy.HasTriangles();
+    const bool has_triangle_normals = mesh_legacy.HasTriangleNormals();
+    const bool has_triangle_uvs = mesh_legacy.HasTriangleUvs();
+
+    TriangleMesh mesh(device);
+    if (has_vertices) {
+        mesh.SetVertexPositions(float_tensor(mesh_legacy.vertices_));
+    } else {
+        utility::LogWarning("Creating from empty legacy TriangleMesh.");
+    }
+    if (has_vertex_colors) {
+        mesh.SetVertexColors(float_tensor(mesh_legacy.vertex_colors_));
+    }
+    if (has_vertex_normals) {
+        mesh.SetVertexNormals(float_tensor(mesh_legacy.vertex_normals_));
+    }
+    if (has_triangles) {
+        mesh.SetTriangleIndices(
+                move_int ? core::eigen_converter::EigenVector3iVectorToTensor(
+                                   std::move(mesh_legacy.triangles_))
+                         : core::eigen_converter::EigenVector3iVectorToTensor(
+                                   mesh_legacy.triangles_, int_dtype, device));
+    }
+    if (has_triangle_normals) {
+        mesh.SetTriangleNormals(float_tensor(mesh_legacy.triangle_normals_));
+    }
+    if (has_triangle_uvs) {
+        core::Tensor uvs =
+                move_float
+                        ? core::eigen_converter::EigenVector2dVectorToTensor(
+                                  std::move(mesh_legacy.triangle_uvs_))
+                        : core::eigen_converter::EigenVector2dVectorToTensor(
+                                  mesh_legacy.triangle_uvs_, float_dtype,
+                                  device);
+        mesh.SetTriangleAttr("texture_uvs", uvs.Reshape({-1, 3, 2}));
+    }
+    return mesh;
+}
+
 open3d::geometry::TriangleMesh TriangleMesh::ToLegacy() const {
     open3d::geometry::TriangleMesh mesh_legacy;
     if (HasVertexPositions()) {
@@ -26,6 +26,11 @@
 
 #pragma once
 
+#include <string>
+#include <tuple>
+#include <unordered_map>
+#include <unordered_set>
+
 #include "open3d/core/Tensor.h"
 #include "open3d/core/TensorCheck.h"
 #include "open3d/geometry/TriangleMesh.h"
@@ -37,6 +42,8 @@ namespace open3d {
 namespace t {
 namespace geometry {
 
+class PointCloud;
+
 /// \class TriangleMesh
 /// \brief A triangle mesh contains vertices and triangles.
 ///
@@ -440,6 +447,240 @@ public:
     TriangleMesh ClipPlane(const core::Tensor &point,
                            const core::Tensor &normal) const;
 
+    /// \brief Function to simplify mesh using Quadric Error Metric Decimation
+    /// by Garland and Heckbert.
+    ///
+    /// Edges are collapsed in rounds of independent collapses: every vertex
+    /// picks its cheapest valid edge, and a set of the cheaper edges whose
+    /// 1-rings do not overlap is collapsed in parallel.
+    /// Collapses that would flip a triangle or change the topology of the
+    /// mesh are skipped. Float vertex attributes are averaged on collapse,
+    /// triangle attributes are kept for the surviving triangles and triangle
+    /// normals are recomputed. The computation runs on the CPU, meshes on
+    /// other devices are copied to host and back.
+    ///
+    /// \param target_number_of_triangles The number of triangles that the
+    /// simplified mesh should have. It is not guaranteed that this number will
+    /// be reached.
+    /// \param maximum_error The maximum error where a vertex is allowed to be
+    /// merged.
+    /// \param boundary_weight A weight applied to edge vertices used to
+    /// preserve boundaries.
+    /// \return Simplified triangle mesh.
+    TriangleMesh SimplifyQuadricDecimation(
+            int64_t target_number_of_triangles,
+            double maximum_error = std::numeric_limits<double>::infinity(),
+            double boundary_weight = 1.0) const;
+
+    /// \brief Function to smooth triangle mesh using Laplacian.
+    ///
+    /// \f$v_o = v_i + \lambda (\sum_{n \in N} w_n v_n - v_i)\f$,
+    /// with \f$v_i\f$ being the input value, \f$v_o\f$ the output value,
+    /// \f$N\f$ is the set of adjacent neighbours, \f$w_n\f$ is the weighting of
+    /// the neighbour based on the inverse distance (closer neighbours have
+    /// higher weight). All float vertex attributes are filtered and triangle
+    /// normals are recomputed. The vertex adjacency is built once in
+    /// compressed sparse row form and vertices are filtered in parallel on the
+    /// CPU, meshes on other devices are copied to host and back.
+    ///
+    /// \param number_of_iterations defines the number of repetitions
+    /// of this operation.
+    /// \param lambda_filter is the smoothing parameter.
+    TriangleMesh FilterSmoothLaplacian(int number_of_iterations = 1,
+                                       double lambda_filter = 0.5) const;
+
+    /// \brief Function to smooth triangle mesh using method of Taubin,
+    /// "Curve and Surface Smoothing Without Shrinkage", 1995.
+    /// Applies in each iteration two times FilterSmoothLaplacian, first
+    /// with lambda_filter and second with mu as smoothing parameter.
+    /// This method avoids shrinkage of the triangle mesh.
+    ///
+    /// \param number_of_iterations defines the number of repetitions
+    /// of this operation.
+    /// \param lambda_filter is the filter parameter
+    /// \param mu is the filter parameter
+    TriangleMesh FilterSmoothTaubin(int number_of_iterations = 1,
+                                    double lambda_filter = 0.5,
+                                    double mu = -0.53) const;
+
+    /// \brief Function to subdivide triangle mesh using the simple midpoint
+    /// algorithm. Each triangle is subdivided into four triangles per
+    /// iteration and the new vertices lie on the midpoint of the triangle
+    /// edges.
+    ///
+    /// Float vertex attributes are interpolated, other vertex attributes and
+    /// triangle uvs are dropped. The new triangles take the attributes of
+    /// the triangle they are split from, except triangle normals which are
+    /// recomputed. The computation runs in parallel on the CPU, meshes on
+    /// other devices are copied to host and back.
+    ///
+    /// \param number_of_iterations defines a single iteration splits each
+    /// triangle into four triangles that cover the same surface.
+    TriangleMesh SubdivideMidpoint(int number_of_iterations) const;
+
+    /// \brief Function to subdivide triangle mesh using Loop's scheme.
+    /// Cf. Charles T. Loop, "Smooth subdivision surfaces based on triangles",
+    /// 1987. Each triangle is subdivided into four triangles per iteration.
+    ///
+    /// Attributes are handled as in SubdivideMidpoint.
+    ///
+    /// \param number_of_iterations defines a single iteration splits each
+    /// triangle into four triangles that cover the same surface.
+    TriangleMesh SubdivideLoop(int number_of_iterations) const;
+
+    /// \brief Computes the twin of every half-edge, on the device of the mesh.
+    ///
+    /// Half-edge 3 * t + k goes from vertex k to vertex (k + 1) % 3 of
+    /// triangle t. The half-edges are matched by sorting the keys of their
+    /// undirected edges instead of inserting them into a map.
+    ///
+    /// \return The {3 * num_triangles} Int64 twin of each half-edge. It is -1
+    /// for boundary half-edges, for half-edges of non-manifold or degenerate
+    /// edges, and when the two triangles of the edge are inconsistently
+    /// oriented.
+    core::Tensor ComputeHalfEdgeTwins() const;
+
+    /// Function that returns the {E, 2} Int64 boundary edges, i.e. the edges
+    /// bounding a single triangle, oriented as in their triangle. Computed on
+    /// the device of the mesh, see ComputeHalfEdgeTwins.
+    core::Tensor GetBoundaryEdges() const;
+
+    /// Function that returns the {E, 2} Int64 non-manifold edges, i.e. the
+    /// edges bounding more than two triangles, with sorted end points.
+    /// If \p allow_boundary_edges is set to false, then also boundary edges
+    /// are returned.
+    core::Tensor GetNonManifoldEdges(bool allow_boundary_edges = true) const;
+
+    /// Function that checks if the triangle mesh is edge-manifold, i.e. each
+    /// edge is bounding either one or two triangles. If
+    /// \p allow_boundary_edges is set to false, then this function returns
+    /// false if there exists boundary edges.
+    bool IsEdgeManifold(bool allow_boundary_edges = true) const;
+
+    /// \brief Function that clusters connected triangles, i.e., triangles
+    /// that are connected via edges are assigned the same cluster index.
+    ///
+    /// The triangles sharing an edge are found with the half-edge matching of
+    /// ComputeHalfEdgeTwins and merged with a parallel union-find, on the
+    /// device of the mesh. Small floating clusters can then be removed by
+    /// selecting the triangles by their cluster size or area.
+    ///
+    /// \return A tuple of the {num_triangles} Int64 cluster index of each
+    /// triangle, numbered in the order of their first triangle, the
+    /// {num_clusters} Int64 number of triangles of each cluster, and the
+    /// {num_clusters} Float64 surface area of each cluster.
+    std::tuple<core::Tensor, core::Tensor, core::Tensor>
+    ClusterConnectedTriangles() const;
+
+    /// \brief Merges vertices with identical positions into their first
+    /// occurrence, keeping its attributes, and removes the merged vertices.
+    ///
+    /// Equal positions are grouped by a stable lexicographic sort on the
+    /// device of the mesh instead of a hash map of the positions.
+    TriangleMesh &RemoveDuplicatedVertices();
+
+    /// Removes the triangles that reference a vertex more than once, with
+    /// their attributes.
+    TriangleMesh &RemoveDegenerateTriangles();
+
+    /// Removes all but the first of the triangles that reference the same
+    /// three vertices, independent of their order and orientation.
+    TriangleMesh &RemoveDuplicatedTriangles();
+
+    /// Removes the vertices that are not referenced by any triangle, with
+    /// their attributes.
+    TriangleMesh &RemoveUnreferencedVertices();
+
+    /// \brief Runs the selected cleaning steps in a single pass, e.g. on the
+    /// raw output of marching cubes.
+    ///
+    /// Duplicated vertices are merged first, so that triangles collapsed or
+    /// made identical by the merge are removed as degenerate or duplicated
+    /// triangles. The vertex and triangle attributes are compacted once at the
+    /// end, and the kept vertices and triangles stay in their input order.
+    /// Runs on the device of the mesh.
+    TriangleMesh &CleanMesh(bool remove_duplicated_vertices = true,
+                            bool remove_degenerate_triangles = true,
+                            bool remove_duplicated_triangles = true,
+                            bool remove_unreferenced_vertices = true);
+
+    /// \brief Computes a UV atlas and stores it in the "texture_uvs" triangle
+    /// attribute as a {num_triangles, 3, 2} Float32 tensor.
+    ///
+    /// The triangles are segmented into charts of edge-connected triangles
+    /// whose normals share the same dominant axis direction. Each chart is
+    /// projected orthogonally along its axis, so charts are not mirrored and
+    /// the stretch is bounded, but a chart can overlap itself if the surface
+    /// folds back within it. The charts are shelf packed with a common scale,
+    /// chosen by bisection as the largest that fits a \p size x \p size
+    /// texture with \p gutter empty texels around every chart. v = 0 is the
+    /// bottom row of the texture. The computation runs in parallel on the CPU,
+    /// meshes on other devices are copied to host and back.
+    ///
+    /// \param size The texture size in texels the atlas is packed for.
+    /// \param gutter The number of empty texels around each chart.
+    /// \return The number of charts.
+    int64_t ComputeUVAtlas(int64_t size = 512, int64_t gutter = 2);
+
+    /// \brief Bakes vertex attributes into textures with the "texture_uvs"
+    /// triangle attribute, e.g. after ComputeUVAtlas.
+    ///
+    /// Every texel is assigned to the triangle with the smallest index that
+    /// covers its center and the vertex attributes are interpolated with the
+    /// barycentric coordinates of the texel center. Empty texels up to
+    /// \p margin texels away from a chart are dilated from the chart, so that
+    /// filtered lookups at the chart borders do not blend in \p fill. The
+    /// rasterization runs on the device of the mesh.
+    ///
+    /// \param size The size of the square textures in texels.
+    /// \param vertex_attr The Float32 or Float64 vertex attributes to bake.
+    /// If empty, all of them except "positions" are baked.
+    /// \param margin The number of texels the charts are dilated by.
+    /// \param fill The value of the texels outside of all charts.
+    /// \return The {size, size, channels} Float32 texture of each attribute.
+    std::unordered_map<std::string, core::Tensor> BakeVertexAttrTextures(
+            int64_t size,
+            const std::unordered_set<std::string> &vertex_attr = {},
+            int64_t margin = 2,
+            double fill = 0.0) const;
+
+    /// \brief Function to uniformly sample points from the mesh.
+    ///
+    /// The samples are stratified by triangle area with a prefix sum, so
+    /// every triangle receives its share of the points up to rounding, and
+    /// the Float32 and Float64 vertex attributes are interpolated at the
+    /// samples. The sampling runs on the device of the mesh.
+    ///
+    /// \param number_of_points Number of points that should be sampled.
+    /// \param use_triangle_normal If true, assigns the triangle normals
+    /// instead of the interpolated vertex normals to the points. The triangle
+    /// normals are computed if the mesh has none.
+    /// \param seed Seed value used in the random generator, set to -1 to use
+    /// a random seed value with each function call.
+    PointCloud SamplePointsUniformly(int64_t number_of_points,
+                                     bool use_triangle_normal = false,
+                                     int seed = -1) const;
+
+    /// \brief Function to sample points from the mesh with Poisson disk,
+    /// based on the method presented in Yuksel, "Sample Elimination for
+    /// Generating Poisson Disk Sample Sets", EUROGRAPHICS, 2015.
+    ///
+    /// init_factor * number_of_points points are sampled uniformly and
+    /// eliminated in parallel rounds, using a hash grid for the neighbor
+    /// search, on the device of the mesh.
+    ///
+    /// \param number_of_points Number of points that should be sampled.
+    /// \param init_factor Factor for the initial uniformly sampled point
+    /// cloud.
+    /// \param use_triangle_normal If true, assigns the triangle normals
+    /// instead of the interpolated vertex normals to the points.
+    /// \param seed Seed value used in the random generator, set to -1 to use
+    /// a random seed value with each function call.
+    PointCloud SamplePointsPoissonDisk(int64_t number_of_points,
+                                       double init_factor = 5,
+                                       bool use_triangle_normal = false,
+                                       int seed = -1) const;
+
     core::Device GetDevice() const { return device_; }
 
     /// Create a TriangleMesh from a legacy Open3D TriangleMesh.
@@ -455,6 +696,17 @@ public:
             core::Dtype int_dtype = core::Int64,
             const core::Device &device = core::Device("CPU:0"));
 
+    /// Create a TriangleMesh from a legacy Open3D TriangleMesh, moving its
+    /// attributes. On CPU:0, attributes whose dtype matches the legacy storage
+    /// (Float64 for \p float_dtype, Int32 for \p int_dtype) take over the
+    /// legacy storage without copying and are left empty in \p mesh_legacy.
+    /// The other attributes are converted as in the copying overload.
+    static geometry::TriangleMesh FromLegacy(
+            open3d::geometry::TriangleMesh &&mesh_legacy,
+            core::Dtype float_dtype = core::Float32,
+            core::Dtype int_dtype = core::Int64,
+            const core::Device &device = core::Device("CPU:0"));
+
     /// Convert to a legacy Open3D TriangleMesh.
     open3d::geometry::TriangleMesh ToLegacy() const;
 
@@ -0,0 +1,222 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/Tensor.h"
+#include "open3d/core/TensorFunction.h"
+#include "open3d/t/geometry/TriangleMesh.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+
+namespace {
+
+/// Returns for each row of the {N, C} \p rows the {N} Int64 index of the first
+/// row equal to it. The rows are grouped by stable lexicographic sorting, one
+/// column at a time, so it only uses tensor operations and runs on any device.
+core::Tensor FirstEqualRows(const core::Tensor& rows) {
+    const int64_t n = rows.GetLength();
+    const int64_t num_cols = rows.GetShape(1);
+    const core::Device device = rows.GetDevice();
+    if (n == 0) {
+        return core::Tensor::Empty({0}, core::Int64, device);
+    }
+    core::Tensor order = core::Tensor::Arange(0, n, 1, core::Int64, device);
+    for (int64_t c = num_cols - 1; c >= 0; --c) {
+        order = order.IndexGet(
+                {rows.Slice(1, c, c + 1).Reshape({n}).IndexGet({order})
+                         .ArgSort()});
+    }
+
+    // A sorted row starts a group if it differs from its predecessor. Equal
+    // rows keep their input order, so each group starts with its first row.
+    const core::Tensor sorted = rows.IndexGet({order});
+    core::Tensor differs = core::Tensor::Zeros({n - 1}, core::Bool, device);
+    for (int64_t c = 0; c < num_cols; ++c) {
+        differs = differs.LogicalOr(
+                sorted.Slice(0, 1, n).Slice(1, c, c + 1).Reshape({n - 1}).Ne(
+                        sorted.Slice(0, 0, n - 1)
+                                .Slice(1, c, c + 1)
+                                .Reshape({n - 1})));
+    }
+    const core::Tensor starts = core::Concatenate(
+            {core::Tensor::Ones({1}, core::Bool, device), differs});
+    const core::Tensor groups =
+            starts.To(core::Int64).InclusivePrefixSum() - 1;
+    const core::Tensor firsts = order.IndexGet({starts}).IndexGet({groups});
+
+    core::Tensor first_rows = core::Tensor::Empty({n}, core::Int64, device);
+    first_rows.IndexSet({order}, firsts);
+    return first_rows;
+}
+
+/// Returns the {N} Bool mask of the triangles whose three vertex indices are
+/// distinct.
+core::Tensor NonDegenerateTriangles(const core::Tensor& triangles) {
+    const core::Tensor v0 = triangles.Slice(1, 0, 1);
+    const core::Tensor v1 = triangles.Slice(1, 1, 2);
+    const core::Tensor v2 = triangles.Slice(1, 2, 3);
+    return v0.Ne(v1).LogicalAnd(v1.Ne(v2)).LogicalAnd(v2.Ne(v0)).Reshape(
+            {triangles.GetLength()});
+}
+
+/// Returns the {N} Bool mask of the first triangle of each set of vertex
+/// indices, independent of the order and orientation of the vertices.
+core::Tensor FirstUniqueTriangles(const core::Tensor& triangles) {
+    const int64_t n = triangles.GetLength();
+    const core::Tensor lo = triangles.Min({1}, /*keepdim=*/true);
+    const core::Tensor hi = triangles.Max({1}, /*keepdim=*/true);
+    const core::Tensor mid = triangles.Sum({1}, /*keepdim=*/true) - lo - hi;
+    return FirstEqualRows(core::Concatenate({lo, mid, hi}, 1))
+            .Eq(core::Tensor::Arange(0, n, 1, core::Int64,
+                                     triangles.GetDevice()));
+}
+
+}  // namespace
+
+TriangleMesh &TriangleMesh::RemoveDuplicatedVertices() {
+    return CleanMesh(/*remove_duplicated_vertices=*/true,
+                     /*remove_degenerate_triangles=*/false,
+                     /*remove_duplicated_triangles=*/false,
+                     /*remove_unreferenced_vertices=*/false);
+}
+
+TriangleMesh &TriangleMesh::RemoveDegenerateTriangles() {
+    return CleanMesh(/*remove_duplicated_vertices=*/false,
+                     /*remove_degenerate_triangles=*/true,
+                     /*remove_duplicated_triangles=*/false,
+                     /*remove_unreferenced_vertices=*/false);
+}
+
+TriangleMesh &TriangleMesh::RemoveDuplicatedTriangles() {
+    return CleanMesh(/*remove_duplicated_vertices=*/false,
+                     /*remove_degenerate_triangles=*/false,
+                     /*remove_duplicated_triangles=*/true,
+                     /*remove_unreferenced_vertices=*/false);
+}
+
+TriangleMesh &TriangleMesh::RemoveUnreferencedVertices() {
+    return CleanMesh(/*remove_duplicated_vertices=*/false,
+                     /*remove_degenerate_triangles=*/false,
+                     /*remove_duplicated_triangles=*/false,
+                     /*remove_unreferenced_vertices=*/true);
+}
+
+TriangleMesh &TriangleMesh::CleanMesh(bool remove_duplicated_vertices,
+                                      bool remove_degenerate_triangles,
+                                      bool remove_duplicated_triangles,
+                                      bool remove_unreferenced_vertices) {
+    if (!HasVertexPositions()) {
+        utility::LogWarning("TriangleMesh has no vertices.");
+        return *this;
+    }
+    const core::Device device = GetDevice();
+    const int64_t num_vertices = GetVertexPositions().GetLength();
+    const bool has_triangles = HasTriangleIndices();
+    const core::Dtype index_dtype =
+            has_triangles ? GetTriangleIndices().GetDtype() : core::Int64;
+    core::Tensor triangles =
+            has_triangles ? GetTriangleIndices().To(core::Int64)
+                          : core::Tensor::Empty({0, 3}, core::Int64, device);
+    const int64_t num_triangles = triangles.GetLength();
+
+    // Vertex v is replaced by vertex vertex_map[v]. Only the vertices mapped
+    // to themselves are kept.
+    core::Tensor vertex_map =
+            core::Tensor::Arange(0, num_vertices, 1, core::Int64, device);
+    if (remove_duplicated_vertices) {
+        vertex_map = FirstEqualRows(GetVertexPositions());
+        if (num_triangles > 0) {
+            triangles = vertex_map.IndexGet({triangles});
+        }
+    }
+
+    // Degenerate triangles are detected after merging vertices, so that
+    // triangles collapsed by the merge are removed in the same pass.
+    core::Tensor triangle_mask =
+            core::Tensor::Ones({num_triangles}, core::Bool, device);
+    if (remove_degenerate_triangles && num_triangles > 0) {
+        triangle_mask = NonDegenerateTriangles(triangles);
+    }
+    if (remove_duplicated_triangles && num_triangles > 0) {
+        triangle_mask =
+                triangle_mask.LogicalAnd(FirstUniqueTriangles(triangles));
+    }
+    const bool triangles_removed =
+            triangle_mask.GetLength() > 0 && !triangle_mask.All();
+    if (triangles_removed) {
+        triangles = triangles.IndexGet({triangle_mask});
+    }
+
+    core::Tensor vertex_mask = vertex_map.Eq(
+            core::Tensor::Arange(0, num_vertices, 1, core::Int64, device));
+    if (remove_unreferenced_vertices) {
+        core::Tensor referenced =
+                core::Tensor::Zeros({num_vertices}, core::Bool, device);
+        if (triangles.GetLength() > 0) {
+            const int64_t num_corners = triangles.GetLength() * 3;
+            referenced.IndexSet(
+                    {triangles.Reshape({num_corners})},
+                    core::Tensor::Ones({num_corners}, core::Bool, device));
+        }
+        vertex_mask = vertex_mask.LogicalAnd(referenced);
+    }
+
+    const int64_t num_kept_vertices =
+            vertex_mask.To(core::Int64).Sum({0}).Item<int64_t>();
+    if (num_kept_vertices < num_vertices) {
+        // Renumber the kept vertices in their input order.
+        const core::Tensor new_indices =
+                vertex_mask.To(core::Int64).ExclusivePrefixSum();
+        if (triangles.GetLength() > 0) {
+            triangles = new_indices.IndexGet({triangles});
+        }
+        for (auto &kv : vertex_attr_) {
+            kv.second = kv.second.IndexGet({vertex_mask});
+        }
+    }
+    if (triangles_removed) {
+        for (auto &kv : triangle_attr_) {
+            if (kv.first != "indices") {
+                kv.second = kv.second.IndexGet({triangle_mask});
+            }
+        }
+    }
+    if (has_triangles) {
+        SetTriangleIndices(triangles.To(index_dtype));
+    }
+
+    utility::LogDebug(
+            "[CleanMesh] {:d} vertices and {:d} triangles have been removed.",
+            num_vertices - num_kept_vertices,
+            num_triangles - triangles.GetLength());
+    return *this;
+}
+
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
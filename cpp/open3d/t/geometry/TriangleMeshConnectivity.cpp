@@ -0,0 +1,228 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <tuple>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/core/TensorFunction.h"
+#include "open3d/core/kernel/ConnectedComponents.h"
+#include "open3d/t/geometry/TriangleMesh.h"
+#include "open3d/t/geometry/Utility.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+
+namespace {
+
+/// Half-edges of a triangle mesh grouped by undirected edge. Half-edge
+/// 3 * t + k goes from vertex k to vertex (k + 1) % 3 of triangle t. All
+/// tensors are Int64 and on the device of the mesh.
+struct HalfEdges {
+    /// {3 * M} start and end vertex of each half-edge.
+    core::Tensor src_;
+    core::Tensor dst_;
+    /// {3 * M} smaller and larger vertex of each half-edge.
+    core::Tensor lo_;
+    core::Tensor hi_;
+    /// {3 * M} undirected edge of each half-edge, in [0, E).
+    core::Tensor edges_;
+    /// {3 * M} half-edges sorted by undirected edge, stable within an edge.
+    core::Tensor order_;
+    /// {E} position in order_ of the first half-edge of each edge.
+    core::Tensor starts_;
+    /// {E} number of half-edges of each edge.
+    core::Tensor counts_;
+
+    int64_t Count() const { return src_.GetLength(); }
+};
+
+/// Matches the half-edges by sorting the keys min * N + max of their
+/// undirected edges, so it only uses tensor operations and runs on any device.
+HalfEdges ComputeHalfEdges(const TriangleMesh& mesh) {
+    const core::Device device = mesh.GetDevice();
+    HalfEdges half_edges;
+    if (!mesh.HasTriangleIndices() ||
+        mesh.GetTriangleIndices().GetLength() == 0) {
+        half_edges.src_ = core::Tensor::Empty({0}, core::Int64, device);
+        half_edges.dst_ = half_edges.src_;
+        half_edges.lo_ = half_edges.src_;
+        half_edges.hi_ = half_edges.src_;
+        half_edges.edges_ = half_edges.src_;
+        half_edges.order_ = half_edges.src_;
+        half_edges.starts_ = half_edges.src_;
+        half_edges.counts_ = half_edges.src_;
+        return half_edges;
+    }
+    const core::Tensor triangles = mesh.GetTriangleIndices().To(core::Int64);
+    if (triangles.NumDims() != 2 || triangles.GetShape(1) != 3) {
+        utility::LogError("Triangle indices must have shape {{M, 3}}, got {}.",
+                          triangles.GetShape().ToString());
+    }
+    const int64_t num_half_edges = triangles.GetLength() * 3;
+    half_edges.src_ = triangles.Contiguous().Reshape({num_half_edges});
+    half_edges.dst_ = core::Concatenate({triangles.Slice(1, 1, 3),
+                                         triangles.Slice(1, 0, 1)},
+                                        1)
+                              .Reshape({num_half_edges});
+
+    const int64_t num_vertices =
+            mesh.HasVertexPositions()
+                    ? mesh.GetVertexPositions().GetLength()
+                    : triangles.Max({0, 1}).Item<int64_t>() + 1;
+    const core::Tensor swap = half_edges.dst_.Lt(half_edges.src_).To(
+            core::Int64);
+    half_edges.lo_ =
+            half_edges.src_ + (half_edges.dst_ - half_edges.src_) * swap;
+    half_edges.hi_ = half_edges.src_ + half_edges.dst_ - half_edges.lo_;
+    const core::Tensor keys = half_edges.lo_ * num_vertices + half_edges.hi_;
+
+    half_edges.order_ = keys.ArgSort();
+    std::tie(std::ignore, half_edges.edges_, half_edges.counts_) =
+            keys.UniqueWithInverseAndCounts();
+    half_edges.starts_ = half_edges.counts_.ExclusivePrefixSum();
+    return half_edges;
+}
+
+/// Returns the {K, 2} Int64 end points of the half-edges \p ids.
+core::Tensor EdgeVertices(const core::Tensor& src,
+                          const core::Tensor& dst,
+                          const core::Tensor& ids) {
+    return core::Concatenate({src.IndexGet({ids}).Reshape({-1, 1}),
+                              dst.IndexGet({ids}).Reshape({-1, 1})},
+                             1);
+}
+
+}  // namespace
+
+core::Tensor TriangleMesh::ComputeHalfEdgeTwins() const {
+    const HalfEdges half_edges = ComputeHalfEdges(*this);
+    core::Tensor twins = core::Tensor::Full({half_edges.Count()}, -1,
+                                            core::Int64, GetDevice());
+    if (half_edges.Count() == 0) {
+        return twins;
+    }
+
+    // Only edges with exactly two half-edges in opposite directions have twins.
+    const core::Tensor pair_starts =
+            half_edges.starts_.IndexGet({half_edges.counts_.Eq(2)});
+    const core::Tensor first = half_edges.order_.IndexGet({pair_starts});
+    const core::Tensor second = half_edges.order_.IndexGet({pair_starts + 1});
+    const core::Tensor opposite =
+            half_edges.src_.IndexGet({first})
+                    .Eq(half_edges.dst_.IndexGet({second}))
+                    .LogicalAnd(half_edges.src_.IndexGet({first})
+                                        .Ne(half_edges.dst_.IndexGet({first})));
+    const core::Tensor twin_first = first.IndexGet({opposite});
+    const core::Tensor twin_second = second.IndexGet({opposite});
+    twins.IndexSet({twin_first}, twin_second);
+    twins.IndexSet({twin_second}, twin_first);
+    return twins;
+}
+
+core::Tensor TriangleMesh::GetBoundaryEdges() const {
+    const HalfEdges half_edges = ComputeHalfEdges(*this);
+    if (half_edges.Count() == 0) {
+        return core::Tensor::Empty({0, 2}, core::Int64, GetDevice());
+    }
+    const core::Tensor boundary = half_edges.order_.IndexGet(
+            {half_edges.starts_.IndexGet({half_edges.counts_.Eq(1)})});
+    return EdgeVertices(half_edges.src_, half_edges.dst_, boundary);
+}
+
+core::Tensor TriangleMesh::GetNonManifoldEdges(
+        bool allow_boundary_edges) const {
+    const HalfEdges half_edges = ComputeHalfEdges(*this);
+    if (half_edges.Count() == 0) {
+        return core::Tensor::Empty({0, 2}, core::Int64, GetDevice());
+    }
+    core::Tensor mask = half_edges.counts_.Gt(2);
+    if (!allow_boundary_edges) {
+        mask = mask.LogicalOr(half_edges.counts_.Eq(1));
+    }
+    // Report the end points sorted, independent of the triangle the edge was
+    // first found in.
+    return EdgeVertices(
+            half_edges.lo_, half_edges.hi_,
+            half_edges.order_.IndexGet({half_edges.starts_.IndexGet({mask})}));
+}
+
+bool TriangleMesh::IsEdgeManifold(bool allow_boundary_edges) const {
+    const HalfEdges half_edges = ComputeHalfEdges(*this);
+    if (half_edges.Count() == 0) {
+        return true;
+    }
+    if (allow_boundary_edges) {
+        return !half_edges.counts_.Gt(2).Any();
+    }
+    return half_edges.counts_.Eq(2).All();
+}
+
+std::tuple<core::Tensor, core::Tensor, core::Tensor>
+TriangleMesh::ClusterConnectedTriangles() const {
+    const HalfEdges half_edges = ComputeHalfEdges(*this);
+    const int64_t num_triangles = half_edges.Count() / 3;
+    if (num_triangles == 0) {
+        const core::Tensor empty =
+                core::Tensor::Empty({0}, core::Int64, GetDevice());
+        return std::make_tuple(empty, empty,
+                               core::Tensor::Empty({0}, core::Float64,
+                                                   GetDevice()));
+    }
+
+    // Consecutive half-edges of the same edge in sorted order connect their
+    // triangles, which links all triangles around non-manifold edges too.
+    const int64_t n = half_edges.Count();
+    const core::Tensor current = half_edges.order_.Slice(0, 0, n - 1);
+    const core::Tensor next = half_edges.order_.Slice(0, 1, n);
+    const core::Tensor shared = half_edges.edges_.IndexGet({current}).Eq(
+            half_edges.edges_.IndexGet({next}));
+    const core::Tensor adjacency = core::Concatenate(
+            {current.IndexGet({shared}).Reshape({-1, 1}),
+             next.IndexGet({shared}).Reshape({-1, 1})},
+            1);
+    core::Tensor roots;
+    core::kernel::ConnectedComponents(adjacency.Div(3), num_triangles, roots);
+
+    // The roots are the smallest triangle of each cluster, so the unique
+    // roots number the clusters in the order of their first triangle.
+    core::Tensor cluster_ids, cluster_counts;
+    std::tie(std::ignore, cluster_ids, cluster_counts) =
+            roots.UniqueWithInverseAndCounts();
+    const core::Tensor cross = ComputeTriangleCrossProducts(*this);
+    const core::Tensor areas = (cross * cross).Sum({1}).Sqrt() * 0.5;
+    const core::Tensor row_splits = core::Concatenate(
+            {core::Tensor::Zeros({1}, core::Int64, GetDevice()),
+             cluster_counts.InclusivePrefixSum()});
+    const core::Tensor cluster_areas =
+            areas.IndexGet({cluster_ids.ArgSort()}).SegmentSum(row_splits);
+    return std::make_tuple(cluster_ids, cluster_counts, cluster_areas);
+}
+
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
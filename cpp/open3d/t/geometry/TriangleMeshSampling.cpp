@@ -0,0 +1,219 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include <cmath>
+#include <random>
+#include <string>
+#include <tuple>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/t/geometry/PointCloud.h"
+#include "open3d/t/geometry/TriangleMesh.h"
+#include "open3d/t/geometry/Utility.h"
+#include "open3d/t/geometry/kernel/TriangleMesh.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+
+namespace {
+
+/// Returns the normalized inclusive prefix sum of the triangle areas and the
+/// surface area.
+std::tuple<core::Tensor, double> ComputeAreaCDF(const core::Tensor &norms) {
+    const double surface_area = norms.Sum({0}).Item<double>() / 2;
+    if (!(surface_area > 0)) {
+        utility::LogError("Invalid surface area {}, it must be > 0.",
+                          surface_area);
+    }
+    return std::make_tuple(norms.InclusivePrefixSum() / (2 * surface_area),
+                           surface_area);
+}
+
+uint32_t GetSamplingSeed(int seed) {
+    if (seed == -1) {
+        std::random_device rd;
+        return rd();
+    }
+    return uint32_t(seed);
+}
+
+/// Interpolates the Float32 and Float64 vertex attributes at the samples.
+/// Triangle normals are taken from the "normals" triangle attribute if it
+/// exists and are the normalized \p cross products otherwise.
+PointCloud InterpolateSamples(const TriangleMesh &mesh,
+                              const core::Tensor &triangle_ids,
+                              const core::Tensor &barycentrics,
+                              const core::Tensor &cross,
+                              bool use_triangle_normal) {
+    const int64_t n_samples = triangle_ids.GetLength();
+    const int64_t n_vertices = mesh.GetVertexPositions().GetLength();
+    const core::Tensor corners =
+            mesh.GetTriangleIndices().To(core::Int64).IndexGet({triangle_ids});
+    PointCloud pcd(mesh.GetDevice());
+    for (const auto &kv : mesh.GetVertexAttr()) {
+        const core::Dtype dtype = kv.second.GetDtype();
+        if (dtype != core::Float32 && dtype != core::Float64) {
+            continue;
+        }
+        if (use_triangle_normal && kv.first == "normals") {
+            continue;
+        }
+        const core::Tensor values = kv.second.Reshape({n_vertices, -1});
+        const core::Tensor weights = barycentrics.To(dtype);
+        core::Tensor sampled = core::Tensor::Zeros(
+                {n_samples, values.GetShape(1)}, dtype, mesh.GetDevice());
+        for (int64_t k = 0; k < 3; ++k) {
+            sampled += values.IndexGet({corners.Slice(1, k, k + 1).Flatten()}) *
+                       weights.Slice(1, k, k + 1);
+        }
+        core::SizeVector shape = kv.second.GetShape();
+        shape[0] = n_samples;
+        pcd.SetPointAttr(kv.first, sampled.Reshape(shape));
+    }
+    if (use_triangle_normal) {
+        const core::Dtype dtype = mesh.GetVertexPositions().GetDtype();
+        if (mesh.HasTriangleNormals()) {
+            pcd.SetPointNormals(
+                    mesh.GetTriangleNormals().IndexGet({triangle_ids}).To(
+                            dtype));
+        } else {
+            // Only triangles with a positive area are sampled.
+            const core::Tensor sampled_cross = cross.IndexGet({triangle_ids});
+            const core::Tensor norms =
+                    (sampled_cross * sampled_cross).Sum({1}, true).Sqrt();
+            pcd.SetPointNormals((sampled_cross / norms).To(dtype));
+        }
+    }
+    return pcd;
+}
+
+}  // namespace
+
+core::Tensor ComputeTriangleCrossProducts(const TriangleMesh &mesh) {
+    const core::Tensor vertices = mesh.GetVertexPositions().To(core::Float64);
+    const core::Tensor triangles = mesh.GetTriangleIndices().To(core::Int64);
+    const core::Tensor v0 =
+            vertices.IndexGet({triangles.Slice(1, 0, 1).Flatten()});
+    const core::Tensor e1 =
+            vertices.IndexGet({triangles.Slice(1, 1, 2).Flatten()}) - v0;
+    const core::Tensor e2 =
+            vertices.IndexGet({triangles.Slice(1, 2, 3).Flatten()}) - v0;
+    core::Tensor cross = core::Tensor::Empty(e1.GetShape(), core::Float64,
+                                             mesh.GetDevice());
+    for (int64_t i = 0; i < 3; ++i) {
+        const int64_t j = (i + 1) % 3;
+        const int64_t k = (i + 2) % 3;
+        cross.Slice(1, i, i + 1) =
+                e1.Slice(1, j, j + 1) * e2.Slice(1, k, k + 1) -
+                e1.Slice(1, k, k + 1) * e2.Slice(1, j, j + 1);
+    }
+    return cross;
+}
+
+PointCloud TriangleMesh::SamplePointsUniformly(
+        int64_t number_of_points,
+        bool use_triangle_normal /* = false */,
+        int seed /* = -1 */) const {
+    if (number_of_points <= 0) {
+        utility::LogError("number_of_points <= 0");
+    }
+    if (!HasTriangleIndices()) {
+        utility::LogError("Input mesh has no triangles.");
+    }
+
+    const core::Tensor cross = ComputeTriangleCrossProducts(*this);
+    core::Tensor area_cdf;
+    std::tie(area_cdf, std::ignore) =
+            ComputeAreaCDF((cross * cross).Sum({1}).Sqrt());
+    core::Tensor triangle_ids, barycentrics;
+    kernel::trianglemesh::SampleTriangles(area_cdf, number_of_points,
+                                          GetSamplingSeed(seed), triangle_ids,
+                                          barycentrics);
+    return InterpolateSamples(*this, triangle_ids, barycentrics, cross,
+                              use_triangle_normal);
+}
+
+PointCloud TriangleMesh::SamplePointsPoissonDisk(
+        int64_t number_of_points,
+        double init_factor /* = 5 */,
+        bool use_triangle_normal /* = false */,
+        int seed /* = -1 */) const {
+    if (number_of_points <= 0) {
+        utility::LogError("number_of_points <= 0");
+    }
+    if (!HasTriangleIndices()) {
+        utility::LogError("Input mesh has no triangles.");
+    }
+    if (init_factor < 1) {
+        utility::LogError("init_factor must be >= 1, but got {}.",
+                          init_factor);
+    }
+
+    // Compute init points using uniform sampling
+    const core::Tensor cross = ComputeTriangleCrossProducts(*this);
+    core::Tensor area_cdf;
+    double surface_area;
+    std::tie(area_cdf, surface_area) =
+            ComputeAreaCDF((cross * cross).Sum({1}).Sqrt());
+    const int64_t n_init = int64_t(init_factor * number_of_points);
+    core::Tensor triangle_ids, barycentrics;
+    kernel::trianglemesh::SampleTriangles(area_cdf, n_init,
+                                          GetSamplingSeed(seed), triangle_ids,
+                                          barycentrics);
+    const core::Tensor vertices = GetVertexPositions().To(core::Float64);
+    const core::Tensor corners =
+            GetTriangleIndices().To(core::Int64).IndexGet({triangle_ids});
+    core::Tensor points =
+            core::Tensor::Zeros({n_init, 3}, core::Float64, GetDevice());
+    for (int64_t k = 0; k < 3; ++k) {
+        points += vertices.IndexGet({corners.Slice(1, k, k + 1).Flatten()}) *
+                  barycentrics.Slice(1, k, k + 1);
+    }
+
+    // Set-up sample elimination
+    const double alpha = 8;    // constant defined in paper
+    const double beta = 0.5;   // constant defined in paper
+    const double gamma = 1.5;  // constant defined in paper
+    const double ratio = double(number_of_points) / double(n_init);
+    const double r_max = 2 * std::sqrt((surface_area / number_of_points) /
+                                       (2 * std::sqrt(3.)));
+    const double r_min = r_max * beta * (1 - std::pow(ratio, gamma));
+    core::Tensor mask;
+    kernel::trianglemesh::EliminateSamples(points, number_of_points, r_max,
+                                           r_min, alpha, mask);
+
+    const core::Tensor kept = mask.NonZero().Flatten();
+    return InterpolateSamples(*this, triangle_ids.IndexGet({kept}),
+                              barycentrics.IndexGet({kept}), cross,
+                              use_triangle_normal);
+}
+
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
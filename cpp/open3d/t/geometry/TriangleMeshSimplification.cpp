@@ -0,0 +1,768 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <Eigen/Dense>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/core/TensorCheck.h"
+#include "open3d/t/geometry/TriangleMesh.h"
+#include "open3d/utility/Logging.h"
+#include "open3d/utility/Parallel.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+
+namespace {
+
+using Triangle = std::array<int64_t, 3>;
+/// Neighbor vertex index and number of triangles shared with it.
+using Neighbor = std::pair<int64_t, int>;
+
+/// Error quadric that is used to minimize the squared distance of a point to
+/// its neigbhouring triangle planes.
+/// Cf. "Simplifying Surfaces with Color and Texture using Quadric Error
+/// Metrics" by Garland and Heckbert.
+class Quadric {
+public:
+    Quadric() : A_(Eigen::Matrix3d::Zero()), b_(Eigen::Vector3d::Zero()) {}
+
+    Quadric(const Eigen::Vector3d& normal, double d, double weight)
+        : A_(weight * normal * normal.transpose()),
+          b_(weight * d * normal),
+          c_(weight * d * d) {}
+
+    Quadric& operator+=(const Quadric& other) {
+        A_ += other.A_;
+        b_ += other.b_;
+        c_ += other.c_;
+        return *this;
+    }
+
+    Quadric operator+(const Quadric& other) const {
+        Quadric res(*this);
+        res += other;
+        return res;
+    }
+
+    double Eval(const Eigen::Vector3d& v) const {
+        return v.dot(A_ * v) + 2 * b_.dot(v) + c_;
+    }
+
+    bool IsInvertible() const { return std::fabs(A_.determinant()) > 1e-4; }
+
+    Eigen::Vector3d Minimum() const { return -A_.ldlt().solve(b_); }
+
+public:
+    Eigen::Matrix3d A_;
+    Eigen::Vector3d b_;
+    double c_ = 0;
+};
+
+/// Candidate collapse of edge (v0_, v1_), v0_ < v1_, into vbar_. Candidates
+/// are totally ordered by (cost, v0, v1) so that the selection of independent
+/// collapses does not depend on the thread schedule.
+struct Collapse {
+    double cost_ = std::numeric_limits<double>::infinity();
+    int64_t v0_ = -1;
+    int64_t v1_ = -1;
+    Eigen::Vector3d vbar_ = Eigen::Vector3d::Zero();
+
+    bool IsValid() const { return v0_ >= 0; }
+
+    bool operator<(const Collapse& other) const {
+        return std::tie(cost_, v0_, v1_) <
+               std::tie(other.cost_, other.v0_, other.v1_);
+    }
+};
+
+/// State of the mesh during decimation. Triangles keep their indices, so
+/// triangle attributes can be gathered from the surviving triangles.
+struct DecimationState {
+    std::vector<Eigen::Vector3d> positions_;
+    std::vector<Quadric> quadrics_;
+    std::vector<uint8_t> vertex_alive_;
+    std::vector<Triangle> triangles_;
+    std::vector<uint8_t> triangle_alive_;
+    /// Alive triangles incident to vertex v are
+    /// incident_[offsets_[v]] ... incident_[offsets_[v + 1] - 1], sorted.
+    std::vector<int64_t> offsets_;
+    std::vector<int64_t> incident_;
+    /// Sorted neighbors of vertex v are the first neighbor_counts_[v] entries
+    /// from neighbors_[2 * offsets_[v]].
+    std::vector<Neighbor> neighbors_;
+    std::vector<int64_t> neighbor_counts_;
+    /// Float vertex attributes averaged on collapse, as (N, channels).
+    std::vector<std::vector<double>> attrs_;
+    std::vector<int64_t> attr_channels_;
+};
+
+static int64_t TriangleCount(const DecimationState& state, int64_t v) {
+    return state.offsets_[v + 1] - state.offsets_[v];
+}
+
+static void BuildVertexToTriangles(DecimationState& state) {
+    const int64_t n_vertices = int64_t(state.positions_.size());
+    const int64_t n_triangles = int64_t(state.triangles_.size());
+    state.offsets_.assign(n_vertices + 1, 0);
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t t = 0; t < n_triangles; ++t) {
+        if (!state.triangle_alive_[t]) continue;
+        for (int k = 0; k < 3; ++k) {
+#pragma omp atomic
+            state.offsets_[state.triangles_[t][k] + 1]++;
+        }
+    }
+    std::partial_sum(state.offsets_.begin(), state.offsets_.end(),
+                     state.offsets_.begin());
+
+    std::vector<int64_t> cursor(state.offsets_.begin(),
+                                state.offsets_.end() - 1);
+    state.incident_.resize(state.offsets_.back());
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t t = 0; t < n_triangles; ++t) {
+        if (!state.triangle_alive_[t]) continue;
+        for (int k = 0; k < 3; ++k) {
+            int64_t slot;
+#pragma omp atomic capture
+            slot = cursor[state.triangles_[t][k]]++;
+            state.incident_[slot] = t;
+        }
+    }
+
+    // Sorting makes the per-vertex order, and thus the floating point sums
+    // over incident triangles, deterministic.
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t v = 0; v < n_vertices; ++v) {
+        std::sort(state.incident_.begin() + state.offsets_[v],
+                  state.incident_.begin() + state.offsets_[v + 1]);
+    }
+
+    // Each incident triangle contributes at most two neighbors.
+    state.neighbors_.resize(2 * state.incident_.size());
+    state.neighbor_counts_.assign(n_vertices, 0);
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t v = 0; v < n_vertices; ++v) {
+        Neighbor* neighbors = state.neighbors_.data() + 2 * state.offsets_[v];
+        int64_t n_neighbors = 0;
+        for (int64_t i = state.offsets_[v]; i < state.offsets_[v + 1]; ++i) {
+            for (int64_t u : state.triangles_[state.incident_[i]]) {
+                if (u != v) neighbors[n_neighbors++] = Neighbor(u, 1);
+            }
+        }
+        std::sort(neighbors, neighbors + n_neighbors);
+        int64_t n_unique = 0;
+        for (int64_t i = 0; i < n_neighbors; ++i) {
+            if (n_unique > 0 &&
+                neighbors[n_unique - 1].first == neighbors[i].first) {
+                neighbors[n_unique - 1].second++;
+            } else {
+                neighbors[n_unique++] = neighbors[i];
+            }
+        }
+        state.neighbor_counts_[v] = n_unique;
+    }
+}
+
+/// Contiguous range of the neighbors of a vertex.
+struct NeighborRange {
+    const Neighbor* begin_;
+    const Neighbor* end_;
+
+    const Neighbor* begin() const { return begin_; }
+    const Neighbor* end() const { return end_; }
+};
+
+/// Neighbors of \p v, sorted by index, with the number of alive triangles
+/// shared with each of them.
+static NeighborRange GetNeighbors(const DecimationState& state, int64_t v) {
+    const Neighbor* begin = state.neighbors_.data() + 2 * state.offsets_[v];
+    return {begin, begin + state.neighbor_counts_[v]};
+}
+
+static bool TrianglePlane(const Eigen::Vector3d& p0,
+                          const Eigen::Vector3d& p1,
+                          const Eigen::Vector3d& p2,
+                          Eigen::Vector3d& normal,
+                          double& d,
+                          double& area) {
+    normal = (p1 - p0).cross(p2 - p0);
+    const double norm = normal.norm();
+    if (norm == 0) return false;
+    area = 0.5 * norm;
+    normal /= norm;
+    d = -normal.dot(p0);
+    return true;
+}
+
+/// Initial quadrics from the incident triangle planes, plus planes
+/// perpendicular to boundary edges weighted by \p boundary_weight.
+static void ComputeVertexQuadrics(DecimationState& state,
+                                  double boundary_weight) {
+    const int64_t n_vertices = int64_t(state.positions_.size());
+    state.quadrics_.assign(n_vertices, Quadric());
+#pragma omp parallel for schedule(dynamic, 1024) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t v = 0; v < n_vertices; ++v) {
+        Quadric& q = state.quadrics_[v];
+        Eigen::Vector3d normal;
+        double d, area;
+        for (int64_t i = state.offsets_[v]; i < state.offsets_[v + 1]; ++i) {
+            const Triangle& tria = state.triangles_[state.incident_[i]];
+            if (TrianglePlane(state.positions_[tria[0]],
+                              state.positions_[tria[1]],
+                              state.positions_[tria[2]], normal, d, area)) {
+                q += Quadric(normal, d, area);
+            }
+        }
+        if (boundary_weight == 0) continue;
+
+        const NeighborRange neighbors = GetNeighbors(state, v);
+        for (const Neighbor& neighbor : neighbors) {
+            if (neighbor.second != 1) continue;
+            // The only triangle containing the boundary edge.
+            for (int64_t i = state.offsets_[v]; i < state.offsets_[v + 1];
+                 ++i) {
+                const Triangle& tria = state.triangles_[state.incident_[i]];
+                if (tria[0] != neighbor.first && tria[1] != neighbor.first &&
+                    tria[2] != neighbor.first) {
+                    continue;
+                }
+                if (!TrianglePlane(state.positions_[tria[0]],
+                                   state.positions_[tria[1]],
+                                   state.positions_[tria[2]], normal, d,
+                                   area)) {
+                    break;
+                }
+                const Eigen::Vector3d& p0 = state.positions_[v];
+                const Eigen::Vector3d& p1 = state.positions_[neighbor.first];
+                Eigen::Vector3d perp = (p1 - p0).cross(normal);
+                const double perp_norm = perp.norm();
+                if (perp_norm > 0) {
+                    perp /= perp_norm;
+                    q += Quadric(perp, -perp.dot(p0), area * boundary_weight);
+                }
+                break;
+            }
+        }
+    }
+}
+
+static bool Contains(const Triangle& tria, int64_t v) {
+    return tria[0] == v || tria[1] == v || tria[2] == v;
+}
+
+/// Returns false if replacing \p v by \p vbar flips or degenerates one of the
+/// triangles of \p v not containing \p other. Degenerate triangles are
+/// rejected as well, since they could be flipped unnoticed later on.
+static bool PreservesOrientation(const DecimationState& state,
+                                 int64_t v,
+                                 int64_t other,
+                                 const Eigen::Vector3d& vbar) {
+    for (int64_t i = state.offsets_[v]; i < state.offsets_[v + 1]; ++i) {
+        const Triangle& tria = state.triangles_[state.incident_[i]];
+        if (Contains(tria, other)) continue;
+        Eigen::Vector3d p[3] = {state.positions_[tria[0]],
+                                state.positions_[tria[1]],
+                                state.positions_[tria[2]]};
+        const Eigen::Vector3d normal_before =
+                (p[1] - p[0]).cross(p[2] - p[0]);
+        for (int k = 0; k < 3; ++k) {
+            if (tria[k] == v) p[k] = vbar;
+        }
+        const Eigen::Vector3d normal_after = (p[1] - p[0]).cross(p[2] - p[0]);
+        if (!(normal_before.dot(normal_after) > 0)) return false;
+    }
+    return true;
+}
+
+/// Evaluates the collapse of edge (v0, v1), v0 < v1, given the sorted
+/// neighbors of both vertices. The collapse is rejected if it exceeds
+/// \p maximum_error, changes the topology (link condition) or flips a
+/// triangle.
+static Collapse EvaluateCollapse(const DecimationState& state,
+                                 int64_t v0,
+                                 int64_t v1,
+                                 const NeighborRange& neighbors0,
+                                 const NeighborRange& neighbors1,
+                                 double maximum_error) {
+    Collapse collapse;
+    const Quadric qbar = state.quadrics_[v0] + state.quadrics_[v1];
+    if (qbar.IsInvertible()) {
+        collapse.vbar_ = qbar.Minimum();
+        collapse.cost_ = qbar.Eval(collapse.vbar_);
+    } else {
+        const Eigen::Vector3d& p0 = state.positions_[v0];
+        const Eigen::Vector3d& p1 = state.positions_[v1];
+        const Eigen::Vector3d pmid = (p0 + p1) / 2;
+        const double cost0 = qbar.Eval(p0);
+        const double cost1 = qbar.Eval(p1);
+        const double costmid = qbar.Eval(pmid);
+        collapse.cost_ = std::min(cost0, std::min(cost1, costmid));
+        if (collapse.cost_ == costmid) {
+            collapse.vbar_ = pmid;
+        } else if (collapse.cost_ == cost0) {
+            collapse.vbar_ = p0;
+        } else {
+            collapse.vbar_ = p1;
+        }
+    }
+    if (!(collapse.cost_ <= maximum_error)) return Collapse();
+
+    // Link condition: the common neighbors of v0 and v1 must be exactly the
+    // vertices opposite to the edge.
+    int shared_triangles = 0;
+    size_t n_common = 0;
+    auto it0 = neighbors0.begin(), it1 = neighbors1.begin();
+    while (it0 != neighbors0.end() && it1 != neighbors1.end()) {
+        if (it0->first < it1->first) {
+            ++it0;
+        } else if (it1->first < it0->first) {
+            ++it1;
+        } else {
+            ++n_common;
+            ++it0;
+            ++it1;
+        }
+    }
+    for (const Neighbor& neighbor : neighbors0) {
+        if (neighbor.first == v1) shared_triangles = neighbor.second;
+    }
+    if (shared_triangles == 0 || size_t(shared_triangles) != n_common) {
+        return Collapse();
+    }
+
+    if (!PreservesOrientation(state, v0, v1, collapse.vbar_) ||
+        !PreservesOrientation(state, v1, v0, collapse.vbar_)) {
+        return Collapse();
+    }
+    collapse.v0_ = v0;
+    collapse.v1_ = v1;
+    return collapse;
+}
+
+/// One round of parallel edge collapses. Every vertex proposes its cheapest
+/// valid edge and an independent set of the cheaper proposals is collapsed
+/// simultaneously. Returns the number of removed triangles.
+static int64_t CollapseIndependentEdges(DecimationState& state,
+                                        int64_t max_removed_triangles,
+                                        double maximum_error) {
+    const int64_t n_vertices = int64_t(state.positions_.size());
+    std::vector<Collapse> best(n_vertices);
+#pragma omp parallel num_threads(utility::EstimateMaxThreads())
+    {
+        std::vector<Collapse> candidates;
+#pragma omp for schedule(dynamic, 256)
+        for (int64_t v = 0; v < n_vertices; ++v) {
+            if (!state.vertex_alive_[v] || TriangleCount(state, v) == 0) {
+                continue;
+            }
+            const NeighborRange neighbors = GetNeighbors(state, v);
+
+            // Rank the edges by cost first and only validate them in order.
+            candidates.clear();
+            for (const Neighbor& neighbor : neighbors) {
+                const int64_t v0 = std::min(v, neighbor.first);
+                const int64_t v1 = std::max(v, neighbor.first);
+                const Quadric qbar = state.quadrics_[v0] + state.quadrics_[v1];
+                Collapse candidate;
+                candidate.v0_ = v0;
+                candidate.v1_ = v1;
+                candidate.cost_ =
+                        qbar.IsInvertible()
+                                ? qbar.Eval(qbar.Minimum())
+                                : std::min({qbar.Eval(state.positions_[v0]),
+                                            qbar.Eval(state.positions_[v1]),
+                                            qbar.Eval((state.positions_[v0] +
+                                                       state.positions_[v1]) /
+                                                      2)});
+                candidates.push_back(candidate);
+            }
+            std::sort(candidates.begin(), candidates.end());
+            for (const Collapse& candidate : candidates) {
+                if (!(candidate.cost_ <= maximum_error)) break;
+                const int64_t other =
+                        candidate.v0_ == v ? candidate.v1_ : candidate.v0_;
+                const NeighborRange other_neighbors =
+                        GetNeighbors(state, other);
+                const Collapse collapse =
+                        candidate.v0_ == v
+                                ? EvaluateCollapse(state, v, other, neighbors,
+                                                   other_neighbors,
+                                                   maximum_error)
+                                : EvaluateCollapse(state, other, v,
+                                                   other_neighbors, neighbors,
+                                                   maximum_error);
+                if (collapse.IsValid()) {
+                    best[v] = collapse;
+                    break;
+                }
+            }
+        }
+    }
+
+    // Only the cheapest proposals compete in this round, so that collapses
+    // roughly follow the cost order of the serial algorithm.
+    std::vector<double> costs;
+    for (int64_t v = 0; v < n_vertices; ++v) {
+        if (best[v].IsValid()) costs.push_back(best[v].cost_);
+    }
+    if (costs.empty()) return 0;
+    const size_t n_eligible = size_t(std::max<int64_t>(
+            1, std::min<int64_t>(int64_t(costs.size()) / 2,
+                                 (max_removed_triangles + 1) / 2)));
+    std::nth_element(costs.begin(), costs.begin() + n_eligible - 1,
+                     costs.end());
+    const double max_cost = costs[n_eligible - 1];
+
+    // Eligible proposals claim the closed 1-rings of both edge vertices with
+    // a pseudo-random priority, and a proposal is accepted if it holds the
+    // claims on its own two vertices. No vertex of an accepted edge is then
+    // in the closed 1-ring of another accepted edge, so the collapses neither
+    // share triangles nor move vertices seen by each other's validity tests.
+    // The random priorities avoid the long dependency chains of a
+    // cost-ordered selection.
+    auto Priority = [&](int64_t v) -> uint64_t {
+        uint64_t h = (uint64_t(best[v].v0_) << 32) ^ uint64_t(best[v].v1_);
+        h += 0x9e3779b97f4a7c15ULL;
+        h = (h ^ (h >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        h = (h ^ (h >> 27)) * 0x94d049bb133111ebULL;
+        h ^= h >> 31;
+        return (h & 0xffffffff00000000ULL) | (1ULL << 63) | uint64_t(v);
+    };
+    auto IsEligible = [&](int64_t v) {
+        return best[v].IsValid() && best[v].cost_ <= max_cost;
+    };
+    // Proposals accepted in earlier passes claim with the highest priority,
+    // so that later passes only add collapses that do not conflict with them.
+    std::vector<std::atomic<uint64_t>> claims(n_vertices);
+    std::vector<uint8_t> accepted(n_vertices, 0);
+    const int kNumPasses = 3;
+    for (int pass = 0; pass < kNumPasses; ++pass) {
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+        for (int64_t v = 0; v < n_vertices; ++v) {
+            claims[v].store(std::numeric_limits<uint64_t>::max(),
+                            std::memory_order_relaxed);
+        }
+#pragma omp parallel for schedule(dynamic, 256) \
+        num_threads(utility::EstimateMaxThreads())
+        for (int64_t v = 0; v < n_vertices; ++v) {
+            if (!IsEligible(v)) continue;
+            const uint64_t priority = accepted[v] ? uint64_t(v) : Priority(v);
+            auto Claim = [&](int64_t u) {
+                uint64_t claim = claims[u].load(std::memory_order_relaxed);
+                while (priority < claim &&
+                       !claims[u].compare_exchange_weak(
+                               claim, priority, std::memory_order_relaxed)) {
+                }
+            };
+            for (int64_t w : {best[v].v0_, best[v].v1_}) {
+                Claim(w);
+                const NeighborRange neighbors = GetNeighbors(state, w);
+                for (const Neighbor& neighbor : neighbors) {
+                    Claim(neighbor.first);
+                }
+            }
+        }
+
+        int64_t n_new = 0;
+#pragma omp parallel for schedule(static) reduction(+ : n_new) \
+        num_threads(utility::EstimateMaxThreads())
+        for (int64_t v = 0; v < n_vertices; ++v) {
+            if (!IsEligible(v) || accepted[v]) continue;
+            const uint64_t priority = Priority(v);
+            const uint64_t claim0 =
+                    claims[best[v].v0_].load(std::memory_order_relaxed);
+            const uint64_t claim1 =
+                    claims[best[v].v1_].load(std::memory_order_relaxed);
+            if (claim0 == priority && claim1 == priority) {
+                accepted[v] = 1;
+                ++n_new;
+            }
+        }
+        if (n_new == 0) break;
+    }
+
+    // Each collapse removes the triangles shared by the edge. Apply the
+    // cheapest ones first if this round would overshoot the target.
+    std::vector<int64_t> collapses;
+    for (int64_t v = 0; v < n_vertices; ++v) {
+        if (accepted[v]) collapses.push_back(v);
+    }
+    std::sort(collapses.begin(), collapses.end(),
+              [&](int64_t a, int64_t b) { return best[a] < best[b]; });
+    int64_t n_removed = 0;
+    size_t n_collapses = 0;
+    for (; n_collapses < collapses.size(); ++n_collapses) {
+        if (n_removed >= max_removed_triangles) break;
+        const Collapse& collapse = best[collapses[n_collapses]];
+        for (int64_t i = state.offsets_[collapse.v1_];
+             i < state.offsets_[collapse.v1_ + 1]; ++i) {
+            if (Contains(state.triangles_[state.incident_[i]], collapse.v0_)) {
+                ++n_removed;
+            }
+        }
+    }
+
+    const int64_t n_apply = int64_t(n_collapses);
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t c = 0; c < n_apply; ++c) {
+        const Collapse& collapse = best[collapses[c]];
+        const int64_t v0 = collapse.v0_, v1 = collapse.v1_;
+        state.positions_[v0] = collapse.vbar_;
+        state.quadrics_[v0] += state.quadrics_[v1];
+        for (size_t a = 0; a < state.attrs_.size(); ++a) {
+            const int64_t channels = state.attr_channels_[a];
+            double* attr = state.attrs_[a].data();
+            for (int64_t ch = 0; ch < channels; ++ch) {
+                attr[v0 * channels + ch] = 0.5 * (attr[v0 * channels + ch] +
+                                                  attr[v1 * channels + ch]);
+            }
+        }
+        state.vertex_alive_[v1] = 0;
+        for (int64_t i = state.offsets_[v1]; i < state.offsets_[v1 + 1];
+             ++i) {
+            const int64_t t = state.incident_[i];
+            Triangle& tria = state.triangles_[t];
+            if (Contains(tria, v0)) {
+                state.triangle_alive_[t] = 0;
+                continue;
+            }
+            for (int k = 0; k < 3; ++k) {
+                if (tria[k] == v1) tria[k] = v0;
+            }
+        }
+    }
+    return n_removed;
+}
+
+}  // namespace
+
+TriangleMesh TriangleMesh::SimplifyQuadricDecimation(
+        int64_t target_number_of_triangles,
+        double maximum_error,
+        double boundary_weight) const {
+    if (target_number_of_triangles < 0) {
+        utility::LogError(
+                "target_number_of_triangles must be >= 0, but got {}.",
+                target_number_of_triangles);
+    }
+    if (!HasVertexPositions() || !HasTriangleIndices()) {
+        utility::LogWarning(
+                "[SimplifyQuadricDecimation] Mesh has no vertices or "
+                "triangles.");
+        return Clone();
+    }
+    core::AssertTensorDtypes(GetVertexPositions(),
+                             {core::Float32, core::Float64});
+    core::AssertTensorDtypes(GetTriangleIndices(), {core::Int32, core::Int64});
+
+    const core::Device host("CPU:0");
+    const int64_t n_vertices = GetVertexPositions().GetLength();
+    const int64_t n_triangles = GetTriangleIndices().GetLength();
+    if (n_triangles <= target_number_of_triangles) {
+        return Clone();
+    }
+
+    DecimationState state;
+    const core::Tensor positions =
+            GetVertexPositions().To(host, core::Float64).Contiguous();
+    const double* positions_ptr = positions.GetDataPtr<double>();
+    state.positions_.resize(n_vertices);
+    for (int64_t v = 0; v < n_vertices; ++v) {
+        state.positions_[v] = Eigen::Vector3d(positions_ptr[3 * v],
+                                              positions_ptr[3 * v + 1],
+                                              positions_ptr[3 * v + 2]);
+    }
+    state.vertex_alive_.assign(n_vertices, 1);
+
+    const core::Tensor indices =
+            GetTriangleIndices().To(host, core::Int64).Contiguous();
+    const int64_t* indices_ptr = indices.GetDataPtr<int64_t>();
+    state.triangles_.resize(n_triangles);
+    state.triangle_alive_.assign(n_triangles, 1);
+    int64_t n_alive_triangles = n_triangles;
+    for (int64_t t = 0; t < n_triangles; ++t) {
+        Triangle& tria = state.triangles_[t];
+        for (int k = 0; k < 3; ++k) {
+            tria[k] = indices_ptr[3 * t + k];
+            if (tria[k] < 0 || tria[k] >= n_vertices) {
+                utility::LogError("Triangle {} has invalid vertex index {}.",
+                                  t, tria[k]);
+            }
+        }
+        // Degenerate triangles are discarded up front.
+        if (tria[0] == tria[1] || tria[1] == tria[2] || tria[2] == tria[0]) {
+            state.triangle_alive_[t] = 0;
+            --n_alive_triangles;
+        }
+    }
+
+    // Float vertex attributes are averaged on collapse; the others keep the
+    // value of the surviving vertex.
+    std::vector<std::string> averaged_keys;
+    for (const auto& kv : GetVertexAttr()) {
+        if (kv.first == "positions" || !HasVertexAttr(kv.first) ||
+            (kv.second.GetDtype() != core::Float32 &&
+             kv.second.GetDtype() != core::Float64)) {
+            continue;
+        }
+        const core::Tensor attr =
+                kv.second.To(host, core::Float64).Contiguous();
+        const int64_t channels = attr.NumElements() / n_vertices;
+        const double* attr_ptr = attr.GetDataPtr<double>();
+        averaged_keys.push_back(kv.first);
+        state.attrs_.emplace_back(attr_ptr, attr_ptr + n_vertices * channels);
+        state.attr_channels_.push_back(channels);
+    }
+
+    BuildVertexToTriangles(state);
+    ComputeVertexQuadrics(state, boundary_weight);
+    while (n_alive_triangles > target_number_of_triangles) {
+        const int64_t n_removed = CollapseIndependentEdges(
+                state, n_alive_triangles - target_number_of_triangles,
+                maximum_error);
+        if (n_removed == 0) break;
+        n_alive_triangles -= n_removed;
+        BuildVertexToTriangles(state);
+        utility::LogDebug(
+                "[SimplifyQuadricDecimation] Removed {} triangles, {} left.",
+                n_removed, n_alive_triangles);
+    }
+
+    // Compact vertices and triangles.
+    std::vector<int64_t> vertex_remap(n_vertices, -1);
+    std::vector<int64_t> kept_vertices;
+    for (int64_t v = 0; v < n_vertices; ++v) {
+        if (state.vertex_alive_[v]) {
+            vertex_remap[v] = int64_t(kept_vertices.size());
+            kept_vertices.push_back(v);
+        }
+    }
+    const int64_t n_kept_vertices = int64_t(kept_vertices.size());
+    std::vector<int64_t> kept_triangles;
+    std::vector<int64_t> new_indices;
+    for (int64_t t = 0; t < n_triangles; ++t) {
+        if (!state.triangle_alive_[t]) continue;
+        kept_triangles.push_back(t);
+        for (int k = 0; k < 3; ++k) {
+            new_indices.push_back(vertex_remap[state.triangles_[t][k]]);
+        }
+    }
+    const int64_t n_kept_triangles = int64_t(kept_triangles.size());
+
+    std::vector<double> new_positions(n_kept_vertices * 3);
+    for (int64_t i = 0; i < n_kept_vertices; ++i) {
+        for (int k = 0; k < 3; ++k) {
+            new_positions[3 * i + k] = state.positions_[kept_vertices[i]](k);
+        }
+    }
+
+    TriangleMesh mesh(device_);
+    mesh.SetVertexPositions(
+            core::Tensor(new_positions, {n_kept_vertices, 3}, core::Float64,
+                         host)
+                    .To(device_, GetVertexPositions().GetDtype()));
+    mesh.SetTriangleIndices(
+            core::Tensor(new_indices, {n_kept_triangles, 3}, core::Int64, host)
+                    .To(device_, GetTriangleIndices().GetDtype()));
+
+    const core::Tensor kept_vertices_t =
+            core::Tensor(kept_vertices, {n_kept_vertices}, core::Int64, host)
+                    .To(device_);
+    for (const auto& kv : GetVertexAttr()) {
+        if (kv.first == "positions" || !HasVertexAttr(kv.first)) continue;
+        auto it = std::find(averaged_keys.begin(), averaged_keys.end(),
+                            kv.first);
+        if (it == averaged_keys.end()) {
+            mesh.SetVertexAttr(kv.first, kv.second.IndexGet({kept_vertices_t}));
+            continue;
+        }
+        const size_t a = size_t(it - averaged_keys.begin());
+        const int64_t channels = state.attr_channels_[a];
+        std::vector<double> values(n_kept_vertices * channels);
+        for (int64_t i = 0; i < n_kept_vertices; ++i) {
+            std::copy_n(state.attrs_[a].begin() + kept_vertices[i] * channels,
+                        channels, values.begin() + i * channels);
+        }
+        core::SizeVector shape = kv.second.GetShape();
+        shape[0] = n_kept_vertices;
+        mesh.SetVertexAttr(kv.first,
+                           core::Tensor(values, shape, core::Float64, host)
+                                   .To(device_, kv.second.GetDtype()));
+    }
+
+    // Surviving triangles keep their attributes, except normals which are
+    // recomputed from the new geometry.
+    const core::Tensor kept_triangles_t =
+            core::Tensor(kept_triangles, {n_kept_triangles}, core::Int64, host)
+                    .To(device_);
+    for (const auto& kv : GetTriangleAttr()) {
+        if (kv.first == "indices" || !HasTriangleAttr(kv.first)) continue;
+        if (kv.first == "normals") {
+            std::vector<double> normals(n_kept_triangles * 3);
+            for (int64_t i = 0; i < n_kept_triangles; ++i) {
+                const Triangle& tria = state.triangles_[kept_triangles[i]];
+                Eigen::Vector3d normal =
+                        (state.positions_[tria[1]] - state.positions_[tria[0]])
+                                .cross(state.positions_[tria[2]] -
+                                       state.positions_[tria[0]]);
+                if (normal.norm() > 0) normal.normalize();
+                for (int k = 0; k < 3; ++k) {
+                    normals[3 * i + k] = normal(k);
+                }
+            }
+            mesh.SetTriangleNormals(
+                    core::Tensor(normals, {n_kept_triangles, 3}, core::Float64,
+                                 host)
+                            .To(device_, kv.second.GetDtype()));
+        } else {
+            mesh.SetTriangleAttr(kv.first,
+                                 kv.second.IndexGet({kept_triangles_t}));
+        }
+    }
+    return mesh;
+}
+
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,634 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <Eigen/Core>
+#include <algorithm>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/core/TensorCheck.h"
+#include "open3d/t/geometry/TriangleMesh.h"
+#include "open3d/utility/Logging.h"
+#include "open3d/utility/Parallel.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+
+namespace {
+
+/// Host copy of a triangle mesh. Float vertex attributes are stored in double
+/// precision as (N, channels), with the positions first.
+struct HostMesh {
+    int64_t n_vertices_ = 0;
+    /// Vertex indices of triangle t are triangles_[3 * t + k], k = 0, 1, 2.
+    std::vector<int64_t> triangles_;
+    std::vector<std::string> keys_;
+    std::vector<std::vector<double>> attrs_;
+    std::vector<int64_t> channels_;
+};
+
+/// Compressed sparse row list: the entries of row r are
+/// values_[offsets_[r]] ... values_[offsets_[r + 1] - 1].
+struct CSR {
+    std::vector<int64_t> offsets_;
+    std::vector<int64_t> values_;
+};
+
+/// Unique edges of a triangle mesh.
+struct Edges {
+    /// End points of edge e are vertices_[2 * e] < vertices_[2 * e + 1].
+    std::vector<int64_t> vertices_;
+    /// Vertices opposite to edge e in its adjacent triangles, so the size of
+    /// row e is the number of triangles sharing the edge.
+    CSR opposite_;
+    /// Edge between vertices k and (k + 1) % 3 of triangle t is
+    /// triangle_edges_[3 * t + k].
+    std::vector<int64_t> triangle_edges_;
+    /// Edges incident to each vertex.
+    CSR vertex_edges_;
+
+    int64_t Count() const { return int64_t(vertices_.size()) / 2; }
+};
+
+static bool IsFloat(const core::Tensor& tensor) {
+    return tensor.GetDtype() == core::Float32 ||
+           tensor.GetDtype() == core::Float64;
+}
+
+static HostMesh ToHostMesh(const TriangleMesh& mesh) {
+    const core::Device host("CPU:0");
+    HostMesh host_mesh;
+    host_mesh.n_vertices_ = mesh.GetVertexPositions().GetLength();
+
+    const core::Tensor indices =
+            mesh.GetTriangleIndices().To(host, core::Int64).Contiguous();
+    const int64_t* indices_ptr = indices.GetDataPtr<int64_t>();
+    host_mesh.triangles_.assign(indices_ptr,
+                                indices_ptr + indices.NumElements());
+    for (size_t i = 0; i < host_mesh.triangles_.size(); ++i) {
+        if (host_mesh.triangles_[i] < 0 ||
+            host_mesh.triangles_[i] >= host_mesh.n_vertices_) {
+            utility::LogError("Triangle {} has invalid vertex index {}.",
+                              i / 3, host_mesh.triangles_[i]);
+        }
+    }
+
+    auto AddAttr = [&](const std::string& key, const core::Tensor& value) {
+        const core::Tensor attr = value.To(host, core::Float64).Contiguous();
+        const double* attr_ptr = attr.GetDataPtr<double>();
+        host_mesh.keys_.push_back(key);
+        host_mesh.attrs_.emplace_back(attr_ptr,
+                                      attr_ptr + attr.NumElements());
+        host_mesh.channels_.push_back(
+                host_mesh.n_vertices_ > 0
+                        ? attr.NumElements() / host_mesh.n_vertices_
+                        : 0);
+    };
+    AddAttr("positions", mesh.GetVertexPositions());
+    for (const auto& kv : mesh.GetVertexAttr()) {
+        if (kv.first != "positions" && mesh.HasVertexAttr(kv.first) &&
+            IsFloat(kv.second)) {
+            AddAttr(kv.first, kv.second);
+        }
+    }
+    return host_mesh;
+}
+
+/// Sorts every row of \p csr in parallel and removes duplicate entries.
+static void SortUniqueRows(CSR& csr) {
+    const int64_t n_rows = int64_t(csr.offsets_.size()) - 1;
+    std::vector<int64_t> counts(n_rows + 1, 0);
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t r = 0; r < n_rows; ++r) {
+        auto begin = csr.values_.begin() + csr.offsets_[r];
+        auto end = csr.values_.begin() + csr.offsets_[r + 1];
+        std::sort(begin, end);
+        counts[r + 1] = std::unique(begin, end) - begin;
+    }
+    std::partial_sum(counts.begin(), counts.end(), counts.begin());
+
+    std::vector<int64_t> values(counts.back());
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t r = 0; r < n_rows; ++r) {
+        std::copy_n(csr.values_.begin() + csr.offsets_[r],
+                    counts[r + 1] - counts[r], values.begin() + counts[r]);
+    }
+    csr.offsets_ = std::move(counts);
+    csr.values_ = std::move(values);
+}
+
+/// Fills \p csr with \p n_rows rows from \p n_items items, where
+/// Emit(i, Add) calls Add(row, value) for every entry of item i.
+template <typename EmitFunc>
+static void BuildCSR(int64_t n_rows,
+                     int64_t n_items,
+                     EmitFunc Emit,
+                     CSR& csr) {
+    csr.offsets_.assign(n_rows + 1, 0);
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t i = 0; i < n_items; ++i) {
+        Emit(i, [&](int64_t row, int64_t) {
+#pragma omp atomic
+            csr.offsets_[row + 1]++;
+        });
+    }
+    std::partial_sum(csr.offsets_.begin(), csr.offsets_.end(),
+                     csr.offsets_.begin());
+
+    std::vector<int64_t> cursor(csr.offsets_.begin(), csr.offsets_.end() - 1);
+    csr.values_.resize(csr.offsets_.back());
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t i = 0; i < n_items; ++i) {
+        Emit(i, [&](int64_t row, int64_t value) {
+            int64_t slot;
+#pragma omp atomic capture
+            slot = cursor[row]++;
+            csr.values_[slot] = value;
+        });
+    }
+}
+
+/// Builds the sorted vertex adjacency of the mesh.
+static CSR ComputeAdjacency(const HostMesh& mesh) {
+    CSR adjacency;
+    BuildCSR(
+            mesh.n_vertices_, int64_t(mesh.triangles_.size()),
+            [&](int64_t i, auto Add) {
+                const int64_t t = i / 3;
+                const int64_t v0 = mesh.triangles_[i];
+                const int64_t v1 = mesh.triangles_[3 * t + (i + 1) % 3];
+                if (v0 != v1) {
+                    Add(v0, v1);
+                    Add(v1, v0);
+                }
+            },
+            adjacency);
+    SortUniqueRows(adjacency);
+    return adjacency;
+}
+
+/// Enumerates the unique edges of the mesh, ordered by their end points.
+static Edges ComputeEdges(const HostMesh& mesh) {
+    const int64_t n_slots = int64_t(mesh.triangles_.size());
+    auto Endpoints = [&](int64_t slot) {
+        const int64_t v0 = mesh.triangles_[slot];
+        const int64_t v1 = mesh.triangles_[slot - slot % 3 + (slot + 1) % 3];
+        return std::make_pair(std::min(v0, v1), std::max(v0, v1));
+    };
+
+    // Triangle edge slots grouped by their smaller end point and sorted by
+    // the larger one, so that equal edges are adjacent.
+    CSR slots;
+    BuildCSR(
+            mesh.n_vertices_, n_slots,
+            [&](int64_t slot, auto Add) { Add(Endpoints(slot).first, slot); },
+            slots);
+    std::vector<int64_t> edge_offsets(mesh.n_vertices_ + 1, 0);
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t v = 0; v < mesh.n_vertices_; ++v) {
+        auto begin = slots.values_.begin() + slots.offsets_[v];
+        auto end = slots.values_.begin() + slots.offsets_[v + 1];
+        std::sort(begin, end, [&](int64_t a, int64_t b) {
+            return std::make_pair(Endpoints(a).second, a) <
+                   std::make_pair(Endpoints(b).second, b);
+        });
+        int64_t n_edges = 0;
+        for (auto it = begin; it != end; ++it) {
+            if (it == begin ||
+                Endpoints(*it).second != Endpoints(*(it - 1)).second) {
+                ++n_edges;
+            }
+        }
+        edge_offsets[v + 1] = n_edges;
+    }
+    std::partial_sum(edge_offsets.begin(), edge_offsets.end(),
+                     edge_offsets.begin());
+
+    Edges edges;
+    const int64_t n_edges = edge_offsets.back();
+    edges.vertices_.resize(2 * n_edges);
+    edges.opposite_.offsets_.resize(n_edges + 1);
+    edges.opposite_.offsets_[n_edges] = n_slots;
+    edges.opposite_.values_.resize(n_slots);
+    edges.triangle_edges_.resize(n_slots);
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t v = 0; v < mesh.n_vertices_; ++v) {
+        int64_t e = edge_offsets[v] - 1;
+        for (int64_t i = slots.offsets_[v]; i < slots.offsets_[v + 1]; ++i) {
+            const int64_t slot = slots.values_[i];
+            const int64_t v1 = Endpoints(slot).second;
+            if (i == slots.offsets_[v] ||
+                v1 != Endpoints(slots.values_[i - 1]).second) {
+                ++e;
+                edges.vertices_[2 * e] = v;
+                edges.vertices_[2 * e + 1] = v1;
+                edges.opposite_.offsets_[e] = i;
+            }
+            edges.opposite_.values_[i] =
+                    mesh.triangles_[slot - slot % 3 + (slot + 2) % 3];
+            edges.triangle_edges_[slot] = e;
+        }
+    }
+    BuildCSR(
+            mesh.n_vertices_, n_edges,
+            [&](int64_t e, auto Add) {
+                Add(edges.vertices_[2 * e], e);
+                Add(edges.vertices_[2 * e + 1], e);
+            },
+            edges.vertex_edges_);
+    return edges;
+}
+
+/// Splits every triangle into four, with the new vertex of edge e at index
+/// n_vertices_ + e.
+static std::vector<int64_t> SplitTriangles(const HostMesh& mesh,
+                                           const Edges& edges) {
+    const int64_t n_triangles = int64_t(mesh.triangles_.size()) / 3;
+    std::vector<int64_t> triangles(12 * n_triangles);
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t t = 0; t < n_triangles; ++t) {
+        const int64_t v0 = mesh.triangles_[3 * t];
+        const int64_t v1 = mesh.triangles_[3 * t + 1];
+        const int64_t v2 = mesh.triangles_[3 * t + 2];
+        const int64_t v01 = mesh.n_vertices_ + edges.triangle_edges_[3 * t];
+        const int64_t v12 =
+                mesh.n_vertices_ + edges.triangle_edges_[3 * t + 1];
+        const int64_t v20 =
+                mesh.n_vertices_ + edges.triangle_edges_[3 * t + 2];
+        const int64_t children[12] = {v0,  v01, v20, v01, v1,  v12,
+                                      v12, v2,  v20, v01, v12, v20};
+        std::copy_n(children, 12, triangles.begin() + 12 * t);
+    }
+    return triangles;
+}
+
+static std::vector<double> ComputeTriangleNormals(const HostMesh& mesh) {
+    const int64_t n_triangles = int64_t(mesh.triangles_.size()) / 3;
+    const std::vector<double>& positions = mesh.attrs_[0];
+    std::vector<double> normals(3 * n_triangles);
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t t = 0; t < n_triangles; ++t) {
+        const Eigen::Map<const Eigen::Vector3d> p0(
+                positions.data() + 3 * mesh.triangles_[3 * t]);
+        const Eigen::Map<const Eigen::Vector3d> p1(
+                positions.data() + 3 * mesh.triangles_[3 * t + 1]);
+        const Eigen::Map<const Eigen::Vector3d> p2(
+                positions.data() + 3 * mesh.triangles_[3 * t + 2]);
+        Eigen::Vector3d normal = (p1 - p0).cross(p2 - p0);
+        if (normal.norm() > 0) normal.normalize();
+        Eigen::Map<Eigen::Vector3d>(normals.data() + 3 * t) = normal;
+    }
+    return normals;
+}
+
+/// Creates the output mesh on the device of \p input. Float vertex
+/// attributes and triangle normals come from \p host_mesh. If
+/// \p keep_topology is true the other attributes are copied from \p input.
+/// Otherwise they are dropped, except that triangle t of the output takes
+/// the triangle attributes of input triangle parents[t].
+static TriangleMesh FromHostMesh(const TriangleMesh& input,
+                                 const HostMesh& host_mesh,
+                                 const std::vector<int64_t>& parents,
+                                 bool keep_topology,
+                                 const std::string& function_name) {
+    const core::Device host("CPU:0");
+    const core::Device device = input.GetDevice();
+    const int64_t n_vertices = host_mesh.n_vertices_;
+    const int64_t n_triangles = int64_t(host_mesh.triangles_.size()) / 3;
+
+    TriangleMesh mesh(device);
+    mesh.SetTriangleIndices(
+            core::Tensor(host_mesh.triangles_, {n_triangles, 3}, core::Int64,
+                         host)
+                    .To(device, input.GetTriangleIndices().GetDtype()));
+    for (size_t a = 0; a < host_mesh.keys_.size(); ++a) {
+        const core::Tensor& value = input.GetVertexAttr(host_mesh.keys_[a]);
+        core::SizeVector shape = value.GetShape();
+        shape[0] = n_vertices;
+        mesh.SetVertexAttr(host_mesh.keys_[a],
+                           core::Tensor(host_mesh.attrs_[a], shape,
+                                        core::Float64, host)
+                                   .To(device, value.GetDtype()));
+    }
+    for (const auto& kv : input.GetVertexAttr()) {
+        if (!input.HasVertexAttr(kv.first) || mesh.HasVertexAttr(kv.first)) {
+            continue;
+        }
+        if (keep_topology) {
+            mesh.SetVertexAttr(kv.first, kv.second);
+        } else {
+            utility::LogWarning(
+                    "[{}] Vertex attribute {} is not a float attribute and "
+                    "cannot be interpolated, it is dropped.",
+                    function_name, kv.first);
+        }
+    }
+
+    const core::Tensor parents_t =
+            keep_topology ? core::Tensor()
+                          : core::Tensor(parents, {n_triangles}, core::Int64,
+                                         host)
+                                    .To(device);
+    for (const auto& kv : input.GetTriangleAttr()) {
+        if (kv.first == "indices" || !input.HasTriangleAttr(kv.first)) {
+            continue;
+        }
+        if (kv.first == "normals") {
+            mesh.SetTriangleNormals(
+                    core::Tensor(ComputeTriangleNormals(host_mesh),
+                                 {n_triangles, 3}, core::Float64, host)
+                            .To(device, kv.second.GetDtype()));
+        } else if (kv.first == "texture_uvs" && !keep_topology) {
+            utility::LogWarning(
+                    "[{}] This mesh contains triangle uvs that are not "
+                    "handled in this function, they are dropped.",
+                    function_name);
+        } else if (keep_topology) {
+            mesh.SetTriangleAttr(kv.first, kv.second);
+        } else {
+            mesh.SetTriangleAttr(kv.first, kv.second.IndexGet({parents_t}));
+        }
+    }
+    return mesh;
+}
+
+/// Checks the input of the smoothing and subdivision functions. Returns
+/// false if the mesh has nothing to process.
+static bool CheckInput(const TriangleMesh& mesh,
+                       int number_of_iterations,
+                       const std::string& function_name) {
+    if (number_of_iterations < 0) {
+        utility::LogError("number_of_iterations must be >= 0, but got {}.",
+                          number_of_iterations);
+    }
+    if (!mesh.HasVertexPositions() || !mesh.HasTriangleIndices()) {
+        utility::LogWarning("[{}] Mesh has no vertices or triangles.",
+                            function_name);
+        return false;
+    }
+    core::AssertTensorDtypes(mesh.GetVertexPositions(),
+                             {core::Float32, core::Float64});
+    core::AssertTensorDtypes(mesh.GetTriangleIndices(),
+                             {core::Int32, core::Int64});
+    return number_of_iterations > 0;
+}
+
+/// Applies the Laplacian filter with each of \p lambdas in turn, for
+/// \p number_of_iterations rounds. All float vertex attributes are filtered
+/// with the inverse distance weights of the current positions.
+static TriangleMesh FilterSmoothLaplacianImpl(
+        const TriangleMesh& input,
+        int number_of_iterations,
+        const std::vector<double>& lambdas,
+        const std::string& function_name) {
+    if (!CheckInput(input, number_of_iterations, function_name)) {
+        return input.Clone();
+    }
+    HostMesh mesh = ToHostMesh(input);
+    const CSR adjacency = ComputeAdjacency(mesh);
+    const int64_t n_vertices = mesh.n_vertices_;
+    const size_t n_attrs = mesh.attrs_.size();
+
+    std::vector<std::vector<double>> prev_attrs(n_attrs);
+    std::vector<double> weights(adjacency.values_.size());
+    for (int iter = 0; iter < number_of_iterations; ++iter) {
+        for (const double lambda : lambdas) {
+            std::swap(mesh.attrs_, prev_attrs);
+            mesh.attrs_.resize(n_attrs);
+            for (size_t a = 0; a < n_attrs; ++a) {
+                mesh.attrs_[a].resize(prev_attrs[a].size());
+            }
+            const std::vector<double>& positions = prev_attrs[0];
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+            for (int64_t v = 0; v < n_vertices; ++v) {
+                const int64_t begin = adjacency.offsets_[v];
+                const int64_t end = adjacency.offsets_[v + 1];
+                const Eigen::Map<const Eigen::Vector3d> p(positions.data() +
+                                                          3 * v);
+                double total_weight = 0;
+                for (int64_t i = begin; i < end; ++i) {
+                    const Eigen::Map<const Eigen::Vector3d> q(
+                            positions.data() + 3 * adjacency.values_[i]);
+                    weights[i] = 1. / ((p - q).norm() + 1e-12);
+                    total_weight += weights[i];
+                }
+                for (size_t a = 0; a < n_attrs; ++a) {
+                    const int64_t channels = mesh.channels_[a];
+                    const double* prev = prev_attrs[a].data();
+                    double* out = mesh.attrs_[a].data() + channels * v;
+                    for (int64_t c = 0; c < channels; ++c) {
+                        out[c] = prev[channels * v + c];
+                    }
+                    // Isolated vertices are kept in place.
+                    if (begin == end) continue;
+                    for (int64_t c = 0; c < channels; ++c) {
+                        double sum = 0;
+                        for (int64_t i = begin; i < end; ++i) {
+                            sum += weights[i] *
+                                   prev[channels * adjacency.values_[i] + c];
+                        }
+                        out[c] += lambda * (sum / total_weight - out[c]);
+                    }
+                }
+            }
+        }
+    }
+    return FromHostMesh(input, mesh, {}, true, function_name);
+}
+
+/// Splits every triangle into four. Vertex attributes of the new edge
+/// vertices and the updated values of the old vertices are computed from the
+/// current values by \p UpdateAttr(attr, channels, edges, new_attr).
+template <typename UpdateFunc>
+static TriangleMesh SubdivideImpl(const TriangleMesh& input,
+                                  int number_of_iterations,
+                                  UpdateFunc UpdateAttr,
+                                  const std::string& function_name) {
+    if (!CheckInput(input, number_of_iterations, function_name)) {
+        return input.Clone();
+    }
+    HostMesh mesh = ToHostMesh(input);
+    std::vector<int64_t> parents(mesh.triangles_.size() / 3);
+    std::iota(parents.begin(), parents.end(), 0);
+    for (int iter = 0; iter < number_of_iterations; ++iter) {
+        const Edges edges = ComputeEdges(mesh);
+        for (size_t a = 0; a < mesh.attrs_.size(); ++a) {
+            std::vector<double> attr(
+                    (mesh.n_vertices_ + edges.Count()) * mesh.channels_[a]);
+            UpdateAttr(mesh, mesh.attrs_[a], mesh.channels_[a], edges, attr);
+            mesh.attrs_[a] = std::move(attr);
+        }
+        mesh.triangles_ = SplitTriangles(mesh, edges);
+        mesh.n_vertices_ += edges.Count();
+
+        std::vector<int64_t> new_parents(4 * parents.size());
+        for (size_t t = 0; t < new_parents.size(); ++t) {
+            new_parents[t] = parents[t / 4];
+        }
+        parents = std::move(new_parents);
+    }
+    return FromHostMesh(input, mesh, parents, false, function_name);
+}
+
+}  // namespace
+
+TriangleMesh TriangleMesh::FilterSmoothLaplacian(int number_of_iterations,
+                                                 double lambda_filter) const {
+    return FilterSmoothLaplacianImpl(*this, number_of_iterations,
+                                     {lambda_filter}, "FilterSmoothLaplacian");
+}
+
+TriangleMesh TriangleMesh::FilterSmoothTaubin(int number_of_iterations,
+                                              double lambda_filter,
+                                              double mu) const {
+    return FilterSmoothLaplacianImpl(*this, number_of_iterations,
+                                     {lambda_filter, mu}, "FilterSmoothTaubin");
+}
+
+TriangleMesh TriangleMesh::SubdivideMidpoint(int number_of_iterations) const {
+    auto Midpoint = [](const HostMesh& mesh, const std::vector<double>& attr,
+                       int64_t channels, const Edges& edges,
+                       std::vector<double>& new_attr) {
+        std::copy(attr.begin(), attr.end(), new_attr.begin());
+        const int64_t n_edges = edges.Count();
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+        for (int64_t e = 0; e < n_edges; ++e) {
+            const int64_t v0 = edges.vertices_[2 * e];
+            const int64_t v1 = edges.vertices_[2 * e + 1];
+            for (int64_t c = 0; c < channels; ++c) {
+                new_attr[channels * (mesh.n_vertices_ + e) + c] =
+                        0.5 * (attr[channels * v0 + c] +
+                               attr[channels * v1 + c]);
+            }
+        }
+    };
+    return SubdivideImpl(*this, number_of_iterations, Midpoint,
+                         "SubdivideMidpoint");
+}
+
+TriangleMesh TriangleMesh::SubdivideLoop(int number_of_iterations) const {
+    auto Loop = [](const HostMesh& mesh, const std::vector<double>& attr,
+                   int64_t channels, const Edges& edges,
+                   std::vector<double>& new_attr) {
+        const int64_t n_edges = edges.Count();
+        const CSR& opposite = edges.opposite_;
+        // Edge vertices: the mid point on boundary edges, otherwise 3/8 of
+        // the end points and 1/8 of the opposite vertices on a manifold edge.
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+        for (int64_t e = 0; e < n_edges; ++e) {
+            const int64_t v0 = edges.vertices_[2 * e];
+            const int64_t v1 = edges.vertices_[2 * e + 1];
+            const int64_t n_adjacent =
+                    opposite.offsets_[e + 1] - opposite.offsets_[e];
+            double* out = new_attr.data() + channels * (mesh.n_vertices_ + e);
+            for (int64_t c = 0; c < channels; ++c) {
+                const double sum =
+                        attr[channels * v0 + c] + attr[channels * v1 + c];
+                if (n_adjacent < 2) {
+                    out[c] = 0.5 * sum;
+                    continue;
+                }
+                out[c] = 3. / 8. * sum;
+                const double scale = 1. / (4. * n_adjacent);
+                for (int64_t i = opposite.offsets_[e];
+                     i < opposite.offsets_[e + 1]; ++i) {
+                    out[c] += scale * attr[channels * opposite.values_[i] + c];
+                }
+            }
+        }
+
+        // Old vertices are moved towards their neighbors, or only towards
+        // their boundary neighbors if they are on the boundary.
+        const CSR& vertex_edges = edges.vertex_edges_;
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+        for (int64_t v = 0; v < mesh.n_vertices_; ++v) {
+            const int64_t begin = vertex_edges.offsets_[v];
+            const int64_t end = vertex_edges.offsets_[v + 1];
+            const int64_t n_neighbors = end - begin;
+            int64_t n_boundary = 0;
+            for (int64_t i = begin; i < end; ++i) {
+                const int64_t e = vertex_edges.values_[i];
+                if (opposite.offsets_[e + 1] - opposite.offsets_[e] == 1) {
+                    ++n_boundary;
+                }
+            }
+            const bool on_boundary = n_boundary >= 2;
+            double beta;
+            if (on_boundary) {
+                beta = 1. / 8.;
+            } else if (n_neighbors == 3) {
+                beta = 3. / 16.;
+            } else {
+                beta = 3. / (8. * n_neighbors);
+            }
+            const double alpha =
+                    1. - (on_boundary ? n_boundary : n_neighbors) * beta;
+
+            double* out = new_attr.data() + channels * v;
+            for (int64_t c = 0; c < channels; ++c) {
+                out[c] = attr[channels * v + c];
+            }
+            // Isolated vertices are kept in place.
+            if (n_neighbors == 0) continue;
+            for (int64_t c = 0; c < channels; ++c) {
+                out[c] *= alpha;
+            }
+            for (int64_t i = begin; i < end; ++i) {
+                const int64_t e = vertex_edges.values_[i];
+                if (on_boundary &&
+                    opposite.offsets_[e + 1] - opposite.offsets_[e] != 1) {
+                    continue;
+                }
+                const int64_t nb = edges.vertices_[2 * e] == v
+                                           ? edges.vertices_[2 * e + 1]
+                                           : edges.vertices_[2 * e];
+                for (int64_t c = 0; c < channels; ++c) {
+                    out[c] += beta * attr[channels * nb + c];
+                }
+            }
+        }
+    };
+    return SubdivideImpl(*this, number_of_iterations, Loop, "SubdivideLoop");
+}
+
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
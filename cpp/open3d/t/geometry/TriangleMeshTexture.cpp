@@ -0,0 +1,308 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include <Eigen/Core>
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/t/geometry/TriangleMesh.h"
+#include "open3d/t/geometry/kernel/TriangleMesh.h"
+#include "open3d/utility/Logging.h"
+#include "open3d/utility/Parallel.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+
+namespace {
+
+int64_t FindRoot(std::vector<int64_t> &parents, int64_t x) {
+    while (parents[x] != x) {
+        parents[x] = parents[parents[x]];
+        x = parents[x];
+    }
+    return x;
+}
+
+/// Shelf packs the charts, taken in \p order, at \p scale texels per unit.
+/// \p offsets are the texel positions of the chart minima. Returns false if
+/// the charts do not fit into the \p size x \p size texture.
+bool PackCharts(const std::vector<Eigen::Vector2d> &extents,
+                const std::vector<int64_t> &order,
+                double scale,
+                int64_t size,
+                int64_t gutter,
+                std::vector<Eigen::Vector2d> &offsets) {
+    offsets.resize(extents.size());
+    double x = 0, y = 0, shelf_height = 0;
+    for (const int64_t c : order) {
+        // One extra texel, so the texel centers of the chart stay inside.
+        const double w = extents[c](0) * scale + 2 * gutter + 1;
+        const double h = extents[c](1) * scale + 2 * gutter + 1;
+        if (x + w > size) {
+            x = 0;
+            y += shelf_height;
+            shelf_height = 0;
+        }
+        if (x + w > size || y + h > size) {
+            return false;
+        }
+        offsets[c] = Eigen::Vector2d(x + gutter, y + gutter);
+        x += w;
+        shelf_height = std::max(shelf_height, h);
+    }
+    return true;
+}
+
+}  // namespace
+
+int64_t TriangleMesh::ComputeUVAtlas(int64_t size, int64_t gutter) {
+    if (size <= 0 || gutter < 0 || 2 * gutter + 1 > size) {
+        utility::LogError("Invalid texture size {} or gutter {}.", size,
+                          gutter);
+    }
+    if (!HasTriangleIndices() || GetTriangleIndices().GetLength() == 0) {
+        utility::LogWarning("TriangleMesh has no triangles.");
+        return 0;
+    }
+
+    const core::Device host("CPU:0");
+    const core::Tensor positions =
+            GetVertexPositions().To(host, core::Float64).Contiguous();
+    const core::Tensor triangles =
+            GetTriangleIndices().To(host, core::Int64).Contiguous();
+    const double *positions_ptr = positions.GetDataPtr<double>();
+    const int64_t *triangles_ptr = triangles.GetDataPtr<int64_t>();
+    const int64_t n_triangles = triangles.GetLength();
+
+    // The label of a triangle is 2 * axis + (1 if the normal points along the
+    // negative axis), for the axis of the largest normal component. The
+    // corners are projected onto the plane of that axis.
+    const int kProjection[3][2] = {{1, 2}, {2, 0}, {0, 1}};
+    std::vector<int> labels(n_triangles);
+    std::vector<Eigen::Vector2d> projected(3 * n_triangles);
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t t = 0; t < n_triangles; ++t) {
+        Eigen::Vector3d p[3];
+        for (int k = 0; k < 3; ++k) {
+            p[k] = Eigen::Map<const Eigen::Vector3d>(
+                    positions_ptr + 3 * triangles_ptr[3 * t + k]);
+        }
+        const Eigen::Vector3d normal = (p[1] - p[0]).cross(p[2] - p[0]);
+        int axis;
+        normal.cwiseAbs().maxCoeff(&axis);
+        const bool negative = normal(axis) < 0;
+        labels[t] = 2 * axis + (negative ? 1 : 0);
+        for (int k = 0; k < 3; ++k) {
+            const double u = p[k](kProjection[axis][0]);
+            projected[3 * t + k] = Eigen::Vector2d(
+                    negative ? -u : u, p[k](kProjection[axis][1]));
+        }
+    }
+
+    // Triangles that share an edge and a label belong to the same chart.
+    std::vector<std::tuple<int64_t, int64_t, int64_t>> edges(3 * n_triangles);
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t t = 0; t < n_triangles; ++t) {
+        for (int k = 0; k < 3; ++k) {
+            const int64_t a = triangles_ptr[3 * t + k];
+            const int64_t b = triangles_ptr[3 * t + (k + 1) % 3];
+            edges[3 * t + k] = std::make_tuple(std::min(a, b), std::max(a, b),
+                                               t);
+        }
+    }
+    std::sort(edges.begin(), edges.end());
+    std::vector<int64_t> parents(n_triangles);
+    std::iota(parents.begin(), parents.end(), 0);
+    for (size_t i = 1; i < edges.size(); ++i) {
+        if (std::get<0>(edges[i]) != std::get<0>(edges[i - 1]) ||
+            std::get<1>(edges[i]) != std::get<1>(edges[i - 1])) {
+            continue;
+        }
+        const int64_t t0 = std::get<2>(edges[i - 1]);
+        const int64_t t1 = std::get<2>(edges[i]);
+        if (labels[t0] == labels[t1]) {
+            parents[FindRoot(parents, t0)] = FindRoot(parents, t1);
+        }
+    }
+
+    // Chart ids in the order of their first triangle, and their bounds.
+    std::vector<int64_t> charts(n_triangles);
+    std::unordered_map<int64_t, int64_t> root_to_chart;
+    std::vector<Eigen::Vector2d> min_bounds, max_bounds;
+    for (int64_t t = 0; t < n_triangles; ++t) {
+        const int64_t root = FindRoot(parents, t);
+        auto it = root_to_chart.find(root);
+        if (it == root_to_chart.end()) {
+            it = root_to_chart.emplace(root, min_bounds.size()).first;
+            min_bounds.push_back(projected[3 * t]);
+            max_bounds.push_back(projected[3 * t]);
+        }
+        const int64_t c = it->second;
+        charts[t] = c;
+        for (int k = 0; k < 3; ++k) {
+            min_bounds[c] = min_bounds[c].cwiseMin(projected[3 * t + k]);
+            max_bounds[c] = max_bounds[c].cwiseMax(projected[3 * t + k]);
+        }
+    }
+    const int64_t n_charts = min_bounds.size();
+
+    // Largest common scale at which the charts, by decreasing height, fit.
+    std::vector<Eigen::Vector2d> extents(n_charts);
+    double max_extent = 0;
+    for (int64_t c = 0; c < n_charts; ++c) {
+        extents[c] = max_bounds[c] - min_bounds[c];
+        max_extent = std::max(max_extent, extents[c].maxCoeff());
+    }
+    std::vector<int64_t> order(n_charts);
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&](int64_t a, int64_t b) {
+        return extents[a](1) > extents[b](1);
+    });
+    std::vector<Eigen::Vector2d> offsets;
+    double lo = 0;
+    double hi = max_extent > 0 ? (size - 2 * gutter - 1) / max_extent : 1;
+    if (!PackCharts(extents, order, lo, size, gutter, offsets)) {
+        utility::LogError(
+                "{} charts with a gutter of {} texels do not fit into a "
+                "texture of size {}.",
+                n_charts, gutter, size);
+    }
+    if (PackCharts(extents, order, hi, size, gutter, offsets)) {
+        lo = hi;
+    } else {
+        for (int i = 0; i < 40; ++i) {
+            const double mid = (lo + hi) / 2;
+            if (PackCharts(extents, order, mid, size, gutter, offsets)) {
+                lo = mid;
+            } else {
+                hi = mid;
+            }
+        }
+    }
+    const double scale = lo;
+    PackCharts(extents, order, scale, size, gutter, offsets);
+    utility::LogDebug("UV atlas: {} charts at {} texels per unit.", n_charts,
+                      scale);
+
+    core::Tensor texture_uvs =
+            core::Tensor::Empty({n_triangles, 3, 2}, core::Float32, host);
+    float *uvs_ptr = texture_uvs.GetDataPtr<float>();
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t t = 0; t < n_triangles; ++t) {
+        const int64_t c = charts[t];
+        for (int k = 0; k < 3; ++k) {
+            // Texel centers are at integer coordinates plus 0.5.
+            const Eigen::Vector2d texel =
+                    offsets[c] + (projected[3 * t + k] - min_bounds[c]) * scale;
+            uvs_ptr[6 * t + 2 * k] = float((texel(0) + 0.5) / size);
+            uvs_ptr[6 * t + 2 * k + 1] = float(1 - (texel(1) + 0.5) / size);
+        }
+    }
+    SetTriangleAttr("texture_uvs", texture_uvs.To(GetDevice()));
+    return n_charts;
+}
+
+std::unordered_map<std::string, core::Tensor>
+TriangleMesh::BakeVertexAttrTextures(
+        int64_t size,
+        const std::unordered_set<std::string> &vertex_attr,
+        int64_t margin,
+        double fill) const {
+    if (!HasTriangleAttr("texture_uvs")) {
+        utility::LogError(
+                "TriangleMesh has no texture_uvs, call ComputeUVAtlas "
+                "first.");
+    }
+    std::vector<std::string> keys;
+    if (vertex_attr.empty()) {
+        for (const auto &kv : GetVertexAttr()) {
+            const core::Dtype dtype = kv.second.GetDtype();
+            if (kv.first != "positions" &&
+                (dtype == core::Float32 || dtype == core::Float64)) {
+                keys.push_back(kv.first);
+            }
+        }
+    } else {
+        keys.assign(vertex_attr.begin(), vertex_attr.end());
+    }
+    std::sort(keys.begin(), keys.end());
+
+    core::Tensor triangle_ids, barycentrics;
+    kernel::trianglemesh::RasterizeTextureUVs(
+            GetTriangleAttr("texture_uvs").To(core::Float32).Contiguous(),
+            size, margin, triangle_ids, barycentrics);
+    const core::Tensor mask = triangle_ids.Ge(0);
+    const core::Tensor ids = triangle_ids.IndexGet({mask});
+    const core::Tensor corners =
+            GetTriangleIndices().To(core::Int64).IndexGet({ids});
+    const core::Tensor weights = barycentrics.IndexGet({mask});
+
+    std::unordered_map<std::string, core::Tensor> textures;
+    const int64_t n_vertices = GetVertexPositions().GetLength();
+    for (const std::string &key : keys) {
+        if (!HasVertexAttr(key)) {
+            utility::LogError("TriangleMesh has no vertex attribute {}.", key);
+        }
+        const core::Tensor &attr = GetVertexAttr(key);
+        if (attr.GetDtype() != core::Float32 &&
+            attr.GetDtype() != core::Float64) {
+            utility::LogError(
+                    "Vertex attribute {} must be Float32 or Float64, but got "
+                    "{}.",
+                    key, attr.GetDtype().ToString());
+        }
+        const core::Tensor values =
+                attr.To(core::Float32).Reshape({n_vertices, -1});
+        core::Tensor baked = core::Tensor::Zeros(
+                {weights.GetLength(), values.GetShape(1)}, core::Float32,
+                GetDevice());
+        for (int64_t k = 0; k < 3; ++k) {
+            baked += values.IndexGet({corners.Slice(1, k, k + 1).Flatten()}) *
+                     weights.Slice(1, k, k + 1);
+        }
+        core::Tensor texture =
+                core::Tensor::Full({size, size, values.GetShape(1)}, fill,
+                                   core::Float32, GetDevice());
+        texture.IndexSet({mask}, baked);
+        textures[key] = texture;
+    }
+    return textures;
+}
+
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
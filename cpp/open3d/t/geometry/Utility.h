@@ -33,6 +33,13 @@ namespace open3d {
 namespace t {
 namespace geometry {
 
+class TriangleMesh;
+
+/// Returns the {num_triangles, 3} Float64 cross products of the triangle
+/// edges, whose norms are twice the triangle areas. Computed on the device of
+/// the mesh.
+core::Tensor ComputeTriangleCrossProducts(const TriangleMesh& mesh);
+
 inline void CheckDepthTensor(const core::Tensor& depth) {
     if (depth.NumElements() == 0) {
         utility::LogError("Input depth is empty.");
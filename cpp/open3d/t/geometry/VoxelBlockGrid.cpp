@@ -26,13 +26,22 @@
 
 #include "open3d/t/geometry/VoxelBlockGrid.h"
 
+#include <Eigen/Dense>
+#include <algorithm>
+#include <cmath>
+#include <mutex>
+
+#include "open3d/core/EigenConverter.h"
+#include "open3d/core/MemoryManagerStatistic.h"
 #include "open3d/core/Tensor.h"
 #include "open3d/t/geometry/Geometry.h"
 #include "open3d/t/geometry/PointCloud.h"
 #include "open3d/t/geometry/Utility.h"
 #include "open3d/t/geometry/kernel/VoxelBlockGrid.h"
+#include "open3d/t/io/HashMapIO.h"
 #include "open3d/t/io/NumpyIO.h"
 #include "open3d/utility/FileSystem.h"
+#include "open3d/utility/Tracing.h"
 
 namespace open3d {
 namespace t {
@@ -69,6 +78,40 @@ static std::pair<core::Tensor, core::Tensor> BufferRadiusNeighbors(
                           masks_nb.View({27, n, 1}));
 }
 
+// Sets UInt8 flags at the buffer indices of the active blocks at block_coords offset
+// by {0, sign}^3.
+static void FlagOffsetBlocks(std::shared_ptr<core::HashMap> &hashmap,
+                             const core::Tensor &block_coords,
+                             int sign,
+                             core::Tensor &flags) {
+    core::Device device = hashmap->GetDevice();
+    core::Tensor buf_indices, masks;
+    for (int nb = 0; nb < 8; ++nb) {
+        core::Tensor dt = core::Tensor(
+                std::vector<int>{sign * (nb & 1), sign * ((nb >> 1) & 1),
+                                 sign * ((nb >> 2) & 1)},
+                {1, 3}, core::Int32, device);
+        hashmap->Find(block_coords + dt, buf_indices, masks);
+        core::Tensor found = buf_indices.IndexGet({masks}).To(core::Int64);
+        flags.IndexSet({found}, core::Tensor::Ones({found.GetLength()},
+                                                   core::UInt8, device));
+    }
+}
+
+// Removes duplicates from a (N, 3) Int32 block coordinate tensor.
+static core::Tensor UniqueBlockCoordinates(const core::Tensor &block_coords) {
+    if (block_coords.GetLength() == 0) {
+        return block_coords;
+    }
+    core::HashMap unique_hashmap(block_coords.GetLength(), core::Int32,
+                                 core::SizeVector{3}, core::Int32,
+                                 core::SizeVector{1},
+                                 block_coords.GetDevice());
+    core::Tensor buf_indices, masks;
+    unique_hashmap.Activate(block_coords, buf_indices, masks);
+    return block_coords.IndexGet({masks});
+}
+
 static TensorMap ConstructTensorMap(
         const core::HashMap &block_hashmap,
         std::unordered_map<std::string, int> name_attr_map) {
@@ -91,6 +134,7 @@ VoxelBlockGrid::VoxelBlockGrid(
         const core::Device &device,
         const core::HashBackendType &backend)
     : voxel_size_(voxel_size), block_resolution_(block_resolution) {
+    core::ScopedMemoryTag memory_tag("voxel_block_grid");
     // Sanity check
     if (voxel_size <= 0) {
         utility::LogError("voxel size must be positive, but got {}",
@@ -235,6 +279,7 @@ core::Tensor VoxelBlockGrid::GetUniqueBlockCoordinates(
         float depth_scale,
         float depth_max,
         float trunc_voxel_multiplier) {
+    core::ScopedMemoryTag memory_tag("voxel_block_grid");
     AssertInitialized();
     CheckDepthTensor(depth.AsTensor());
     CheckIntrinsicTensor(intrinsic);
@@ -265,6 +310,7 @@ core::Tensor VoxelBlockGrid::GetUniqueBlockCoordinates(
 
 core::Tensor VoxelBlockGrid::GetUniqueBlockCoordinates(
         const PointCloud &pcd, float trunc_voxel_multiplier) {
+    core::ScopedMemoryTag memory_tag("voxel_block_grid");
     AssertInitialized();
     core::Tensor positions = pcd.GetPointPositions();
 
@@ -285,6 +331,43 @@ core::Tensor VoxelBlockGrid::GetUniqueBlockCoordinates(
     return block_coords;
 }
 
+core::Tensor VoxelBlockGrid::GetUniqueBlockCoordinatesAlongRays(
+        const Image &depth,
+        const core::Tensor &intrinsic,
+        const core::Tensor &extrinsic,
+        float depth_scale,
+        float depth_max,
+        float trunc_voxel_multiplier,
+        int stride) {
+    core::ScopedMemoryTag memory_tag("voxel_block_grid");
+    AssertInitialized();
+    CheckDepthTensor(depth.AsTensor());
+    CheckIntrinsicTensor(intrinsic);
+    CheckExtrinsicTensor(extrinsic);
+    if (stride <= 0) {
+        utility::LogError("stride must be positive, but got {}", stride);
+    }
+
+    const int64_t est_sample_multiplier = 4;
+    if (frustum_hashmap_ == nullptr) {
+        int64_t capacity = (depth.GetCols() / stride) *
+                           (depth.GetRows() / stride) * est_sample_multiplier;
+        frustum_hashmap_ = std::make_shared<core::HashMap>(
+                capacity, core::Int32, core::SizeVector{3}, core::Int32,
+                core::SizeVector{1}, block_hashmap_->GetDevice());
+    } else {
+        frustum_hashmap_->Clear();
+    }
+
+    core::Tensor block_coords;
+    kernel::voxel_grid::DepthRayTouch(frustum_hashmap_, depth.AsTensor(),
+                                      intrinsic, extrinsic, block_coords,
+                                      block_resolution_, voxel_size_,
+                                      voxel_size_ * trunc_voxel_multiplier,
+                                      depth_scale, depth_max, stride);
+    return block_coords;
+}
+
 void VoxelBlockGrid::Integrate(const core::Tensor &block_coords,
                                const Image &depth,
                                const core::Tensor &intrinsic,
@@ -317,31 +400,99 @@ void VoxelBlockGrid::Integrate(const core::Tensor &block_coords,
                                float depth_scale,
                                float depth_max,
                                float trunc_voxel_multiplier) {
+    Integrate(block_coords, depth, color, Image(), depth_intrinsic,
+              color_intrinsic, extrinsic, depth_scale, depth_max,
+              trunc_voxel_multiplier);
+}
+
+void VoxelBlockGrid::Integrate(const core::Tensor &block_coords,
+                               const Image &depth,
+                               const Image &color,
+                               const Image &label,
+                               const core::Tensor &depth_intrinsic,
+                               const core::Tensor &color_intrinsic,
+                               const core::Tensor &extrinsic,
+                               float depth_scale,
+                               float depth_max,
+                               float trunc_voxel_multiplier) {
+    OPEN3D_TRACE_ZONE("VoxelBlockGrid::Integrate");
+    core::ScopedMemoryTag memory_tag("voxel_block_grid");
     AssertInitialized();
     bool integrate_color = color.AsTensor().NumElements() > 0;
+    bool integrate_label = label.AsTensor().NumElements() > 0;
 
     CheckBlockCoorinates(block_coords);
     CheckDepthTensor(depth.AsTensor());
     if (integrate_color) {
         CheckColorTensor(color.AsTensor());
     }
+    if (integrate_label) {
+        core::AssertTensorDevice(label.AsTensor(), depth.GetDevice());
+        if (name_attr_map_.count("label_count") > 0) {
+            core::AssertTensorDtype(GetAttribute("label_count"),
+                                    core::UInt16);
+            core::AssertTensorDtypes(label.AsTensor(),
+                                     {core::UInt16, core::Int32});
+            if (label.GetChannels() != 1) {
+                utility::LogError(
+                        "Expected a label id image with 1 channel, but got "
+                        "{}.",
+                        label.GetChannels());
+            }
+        } else if (name_attr_map_.count("label_probability") > 0) {
+            core::Tensor label_probability = GetAttribute("label_probability");
+            core::AssertTensorDtype(label_probability, core::Float32);
+            core::AssertTensorDtype(label.AsTensor(), core::Float32);
+            if (label.GetChannels() != label_probability.GetShape().back()) {
+                utility::LogError(
+                        "Expected a probability image with {} channels, but "
+                        "got {}.",
+                        label_probability.GetShape().back(),
+                        label.GetChannels());
+            }
+        } else {
+            utility::LogError(
+                    "Neither label_count nor label_probability allocated in "
+                    "blocks.");
+        }
+    }
     CheckIntrinsicTensor(depth_intrinsic);
     CheckIntrinsicTensor(color_intrinsic);
     CheckExtrinsicTensor(extrinsic);
 
+    std::unique_lock<std::shared_timed_mutex> lock(block_access_->mutex_);
+    ++block_access_->epoch_;
+
+    // Page in revisited blocks before activating new ones.
+    const bool frustum_cache_valid =
+            frustum_cache_block_count_ == block_hashmap_->Size();
+    const int64_t n_restored = PageInBlocks(block_coords);
+
     core::Tensor buf_indices, masks;
-    block_hashmap_->Activate(block_coords, buf_indices, masks);
-    block_hashmap_->Find(block_coords, buf_indices, masks);
+    block_hashmap_->FindOrInsert(block_coords, buf_indices, masks);
+    MarkBlocksDirty(block_coords);
+
+    // Newly activated blocks are visible from the current camera, so they
+    // are added to the cached visible set instead of invalidating it.
+    if (frustum_cache_valid && n_restored == 0) {
+        core::Tensor new_block_coords = block_coords.IndexGet({masks});
+        if (new_block_coords.GetLength() > 0) {
+            frustum_cache_block_coords_ = frustum_cache_block_coords_.Append(
+                    new_block_coords, 0);
+        }
+        frustum_cache_block_count_ = block_hashmap_->Size();
+    }
 
     core::Tensor block_keys = block_hashmap_->GetKeyTensor();
     TensorMap block_value_map =
             ConstructTensorMap(*block_hashmap_, name_attr_map_);
 
     kernel::voxel_grid::Integrate(
-            depth.AsTensor(), color.AsTensor(), buf_indices, block_keys,
-            block_value_map, depth_intrinsic, color_intrinsic, extrinsic,
-            block_resolution_, voxel_size_,
-            voxel_size_ * trunc_voxel_multiplier, depth_scale, depth_max);
+            depth.AsTensor(), color.AsTensor(), label.AsTensor(), buf_indices,
+            block_keys, block_value_map, depth_intrinsic, color_intrinsic,
+            extrinsic, block_resolution_, voxel_size_,
+            voxel_size_ * trunc_voxel_multiplier, depth_scale, depth_max,
+            log_odds_hit_, log_odds_miss_, log_odds_min_, log_odds_max_);
 }
 
 TensorMap VoxelBlockGrid::RayCast(const core::Tensor &block_coords,
@@ -356,11 +507,15 @@ TensorMap VoxelBlockGrid::RayCast(const core::Tensor &block_coords,
                                   float weight_threshold,
                                   float trunc_voxel_multiplier,
                                   int range_map_down_factor) {
+    OPEN3D_TRACE_ZONE("VoxelBlockGrid::RayCast");
+    core::ScopedMemoryTag memory_tag("voxel_block_grid");
     AssertInitialized();
     CheckBlockCoorinates(block_coords);
     CheckIntrinsicTensor(intrinsic);
     CheckExtrinsicTensor(extrinsic);
 
+    RestoreBlocks(block_coords);
+
     // Extrinsic: world to camera -> pose: camera to world
     core::Device device = block_hashmap_->GetDevice();
 
@@ -405,8 +560,16 @@ TensorMap VoxelBlockGrid::RayCast(const core::Tensor &block_coords,
         }
         int channel = kAttrChannelMap.at(attr);
         core::Dtype dtype = get_dtype(attr);
-        renderings_map[attr] =
-                core::Tensor({height, width, channel}, dtype, device);
+        // The kernel writes all pixels, so the buffer of the last call can be
+        // reused if only raycast_buffers_ (and the GetBlob() copy) refer to it.
+        core::SizeVector shape{height, width, channel};
+        auto it = raycast_buffers_.find(attr);
+        if (it == raycast_buffers_.end() || it->second.GetShape() != shape ||
+            it->second.GetDtype() != dtype ||
+            it->second.GetBlob().use_count() > 2) {
+            raycast_buffers_[attr] = core::Tensor(shape, dtype, device);
+        }
+        renderings_map[attr] = raycast_buffers_[attr];
     }
 
     TensorMap block_value_map =
@@ -420,8 +583,158 @@ TensorMap VoxelBlockGrid::RayCast(const core::Tensor &block_coords,
     return renderings_map;
 }
 
+TensorMap VoxelBlockGrid::RayCast(const core::Tensor &intrinsic,
+                                  const core::Tensor &extrinsic,
+                                  int width,
+                                  int height,
+                                  const std::vector<std::string> attrs,
+                                  float depth_scale,
+                                  float depth_min,
+                                  float depth_max,
+                                  float weight_threshold,
+                                  float trunc_voxel_multiplier,
+                                  int range_map_down_factor) {
+    core::ScopedMemoryTag memory_tag("voxel_block_grid");
+    AssertInitialized();
+    CheckIntrinsicTensor(intrinsic);
+    CheckExtrinsicTensor(extrinsic);
+
+    core::Tensor intrinsic_host =
+            intrinsic.To(core::Device("CPU:0"), core::Float64).Contiguous();
+    core::Tensor extrinsic_host =
+            extrinsic.To(core::Device("CPU:0"), core::Float64).Contiguous();
+
+    // Farthest distance of a point in the frustum from the camera center.
+    const double fx = intrinsic_host[0][0].Item<double>();
+    const double fy = intrinsic_host[1][1].Item<double>();
+    const double cx = intrinsic_host[0][2].Item<double>();
+    const double cy = intrinsic_host[1][2].Item<double>();
+    const double tan_x = std::max(cx, width - cx) / fx;
+    const double tan_y = std::max(cy, height - cy) / fy;
+    const double max_distance =
+            depth_max * std::sqrt(1.0 + tan_x * tan_x + tan_y * tan_y);
+
+    bool reuse = frustum_cache_block_count_ == block_hashmap_->Size() &&
+                 frustum_cache_width_ == width &&
+                 frustum_cache_height_ == height &&
+                 frustum_cache_depth_min_ == depth_min &&
+                 frustum_cache_depth_max_ == depth_max &&
+                 frustum_cache_intrinsic_.AllClose(intrinsic_host);
+    if (reuse) {
+        // Camera motion since the visible blocks were computed.
+        Eigen::Matrix4d T_rel =
+                core::eigen_converter::TensorToEigenMatrixXd(extrinsic_host) *
+                core::eigen_converter::TensorToEigenMatrixXd(
+                        frustum_cache_extrinsic_)
+                        .inverse();
+        const double cos_angle = std::min(
+                1.0, std::max(-1.0, (T_rel.block<3, 3>(0, 0).trace() - 1) / 2));
+        reuse = T_rel.block<3, 1>(0, 3).norm() <= frustum_cache_translation_ &&
+                std::acos(cos_angle) <= frustum_cache_rotation_;
+    }
+
+    if (!reuse) {
+        // Enlarge the frustum so that it covers all the poses within the
+        // tolerance.
+        const float margin = frustum_cache_translation_ +
+                             frustum_cache_rotation_ * float(max_distance);
+        frustum_cache_block_coords_ = GetFrustumBlockCoordinates(
+                intrinsic_host, extrinsic_host, width, height, depth_min,
+                depth_max, margin);
+        frustum_cache_intrinsic_ = intrinsic_host;
+        frustum_cache_extrinsic_ = extrinsic_host;
+        frustum_cache_width_ = width;
+        frustum_cache_height_ = height;
+        frustum_cache_depth_min_ = depth_min;
+        frustum_cache_depth_max_ = depth_max;
+        frustum_cache_block_count_ = block_hashmap_->Size();
+    }
+
+    return RayCast(frustum_cache_block_coords_, intrinsic, extrinsic, width,
+                   height, attrs, depth_scale, depth_min, depth_max,
+                   weight_threshold, trunc_voxel_multiplier,
+                   range_map_down_factor);
+}
+
+core::Tensor VoxelBlockGrid::GetFrustumBlockCoordinates(
+        const core::Tensor &intrinsic,
+        const core::Tensor &extrinsic,
+        int width,
+        int height,
+        float depth_min,
+        float depth_max,
+        float margin) {
+    OPEN3D_TRACE_ZONE("VoxelBlockGrid::GetFrustumBlockCoordinates");
+    core::ScopedMemoryTag memory_tag("voxel_block_grid");
+    AssertInitialized();
+    CheckIntrinsicTensor(intrinsic);
+    CheckExtrinsicTensor(extrinsic);
+
+    core::Device device = block_hashmap_->GetDevice();
+    core::Tensor active_buf_indices =
+            block_hashmap_->GetActiveIndices().To(core::Int64);
+    core::Tensor active_keys =
+            block_hashmap_->GetKeyTensor().IndexGet({active_buf_indices});
+    const int64_t n = active_keys.GetLength();
+    if (n == 0) {
+        return active_keys;
+    }
+
+    // Block centers in the camera coordinate system.
+    const float block_size = voxel_size_ * block_resolution_;
+    core::Tensor extrinsic_t = extrinsic.To(device, core::Float32);
+    core::Tensor R = extrinsic_t.Slice(0, 0, 3).Slice(1, 0, 3);
+    core::Tensor t = extrinsic_t.Slice(0, 0, 3).Slice(1, 3, 4);
+    core::Tensor centers =
+            ((active_keys.To(core::Float32) + 0.5f) * block_size)
+                    .Matmul(R.T().Contiguous()) +
+            t.T();
+    core::Tensor x = centers.Slice(1, 0, 1);
+    core::Tensor y = centers.Slice(1, 1, 2);
+    core::Tensor z = centers.Slice(1, 2, 3);
+
+    // Test the bounding spheres against the near, far and side planes.
+    const float radius = 0.5f * std::sqrt(3.0f) * block_size + margin;
+    core::Tensor intrinsic_host =
+            intrinsic.To(core::Device("CPU:0"), core::Float64).Contiguous();
+    const double fx = intrinsic_host[0][0].Item<double>();
+    const double fy = intrinsic_host[1][1].Item<double>();
+    const double cx = intrinsic_host[0][2].Item<double>();
+    const double cy = intrinsic_host[1][2].Item<double>();
+    auto in_half_space = [&](const core::Tensor &a, double slope, float sign) {
+        // Signed distance of the centers to the plane a = slope * z through
+        // the camera center, positive inside the frustum.
+        const float norm = float(std::sqrt(1.0 + slope * slope));
+        return ((z * float(slope) - a) * (sign / norm)).Ge(-radius);
+    };
+    core::Tensor masks = z.Ge(depth_min - radius)
+                                 .LogicalAnd(z.Le(depth_max + radius))
+                                 .LogicalAnd(in_half_space(x, -cx / fx, -1))
+                                 .LogicalAnd(in_half_space(
+                                         x, (width - cx) / fx, 1))
+                                 .LogicalAnd(in_half_space(y, -cy / fy, -1))
+                                 .LogicalAnd(in_half_space(
+                                         y, (height - cy) / fy, 1));
+    return active_keys.IndexGet({masks.Reshape({n})});
+}
+
+void VoxelBlockGrid::SetFrustumCacheTolerance(float translation,
+                                              float rotation) {
+    if (translation < 0 || rotation < 0) {
+        utility::LogError(
+                "Frustum cache tolerances must be non-negative, but got {} "
+                "and {}.",
+                translation, rotation);
+    }
+    frustum_cache_translation_ = translation;
+    frustum_cache_rotation_ = rotation;
+    // Invalidate the cache computed with the previous tolerance.
+    frustum_cache_block_count_ = -1;
+}
+
 PointCloud VoxelBlockGrid::ExtractPointCloud(float weight_threshold,
                                              int estimated_point_number) {
+    core::ScopedMemoryTag memory_tag("voxel_block_grid");
     AssertInitialized();
     core::Tensor active_buf_indices;
     block_hashmap_->GetActiveIndices(active_buf_indices);
@@ -454,6 +767,7 @@ PointCloud VoxelBlockGrid::ExtractPointCloud(float weight_threshold,
 
 TriangleMesh VoxelBlockGrid::ExtractTriangleMesh(float weight_threshold,
                                                  int estimated_vertex_number) {
+    core::ScopedMemoryTag memory_tag("voxel_block_grid");
     AssertInitialized();
     core::Tensor active_buf_indices_i32 = block_hashmap_->GetActiveIndices();
     core::Tensor active_nb_buf_indices, active_nb_masks;
@@ -471,14 +785,16 @@ TriangleMesh VoxelBlockGrid::ExtractTriangleMesh(float weight_threshold,
                                iota_map);
 
     core::Tensor vertices, triangles, vertex_normals, vertex_colors;
+    core::Tensor triangle_block_indices;
 
     core::Tensor block_keys = block_hashmap_->GetKeyTensor();
     TensorMap block_value_map =
             ConstructTensorMap(*block_hashmap_, name_attr_map_);
     kernel::voxel_grid::ExtractTriangleMesh(
             active_buf_indices_i32, inverse_index_map, active_nb_buf_indices,
-            active_nb_masks, block_keys, block_value_map, vertices, triangles,
-            vertex_normals, vertex_colors, block_resolution_, voxel_size_,
+            active_nb_masks, core::Tensor(), block_keys, block_value_map,
+            vertices, triangles, vertex_normals, vertex_colors,
+            triangle_block_indices, block_resolution_, voxel_size_,
             weight_threshold, estimated_vertex_number);
 
     TriangleMesh mesh(vertices, triangles);
@@ -490,6 +806,253 @@ TriangleMesh VoxelBlockGrid::ExtractTriangleMesh(float weight_threshold,
     return mesh;
 }
 
+std::pair<core::Tensor, std::vector<TriangleMesh>>
+VoxelBlockGrid::ExtractDirtyTriangleMeshChunks(float weight_threshold) {
+    AssertInitialized();
+    core::Device device = block_hashmap_->GetDevice();
+    core::Tensor dirty_coords = GetDirtyBlockCoordinates();
+    dirty_block_coords_ = core::Tensor();
+
+    std::vector<TriangleMesh> chunks;
+    if (dirty_coords.GetLength() == 0) {
+        return std::make_pair(core::Tensor({0, 3}, core::Int32, device),
+                              chunks);
+    }
+
+    // The cubes of a block reach into its neighbors at +1 offsets, so the
+    // changed blocks and their active neighbors at -1 offsets own the cubes
+    // to re-mesh. Their neighbors at +1 offsets provide the boundary
+    // vertices.
+    const int64_t capacity = block_hashmap_->GetCapacity();
+    core::Tensor owned_flags = core::Tensor::Zeros({capacity}, core::UInt8,
+                                                   device);
+    FlagOffsetBlocks(block_hashmap_, dirty_coords, -1, owned_flags);
+    core::Tensor owned_buf_indices = owned_flags.NonZero()[0];
+    core::Tensor block_keys = block_hashmap_->GetKeyTensor();
+    core::Tensor owned_keys = block_keys.IndexGet({owned_buf_indices});
+
+    // Changed blocks that are no longer active, e.g. evicted, have empty
+    // chunks.
+    core::Tensor buf_indices, masks;
+    block_hashmap_->Find(dirty_coords, buf_indices, masks);
+    core::Tensor inactive_keys = dirty_coords.IndexGet({masks.LogicalNot()});
+    const int64_t n_owned = owned_buf_indices.GetLength();
+    if (n_owned == 0) {
+        chunks.resize(inactive_keys.GetLength(), TriangleMesh(device));
+        return std::make_pair(inactive_keys, chunks);
+    }
+
+    core::Tensor boundary_flags = core::Tensor::Zeros(
+            {capacity}, core::UInt8, device);
+    FlagOffsetBlocks(block_hashmap_, owned_keys, 1, boundary_flags);
+    core::Tensor boundary_buf_indices =
+            boundary_flags.Gt(owned_flags).NonZero()[0];
+
+    const int64_t n_boundary = boundary_buf_indices.GetLength();
+    core::Tensor buf_indices_i32 =
+            owned_buf_indices.Append(boundary_buf_indices, 0).To(core::Int32);
+    core::Tensor owned_block_masks =
+            core::Tensor::Ones({n_owned}, core::Bool, device)
+                    .Append(core::Tensor::Zeros({n_boundary}, core::Bool,
+                                                device),
+                            0);
+
+    core::Tensor nb_buf_indices, nb_masks;
+    std::tie(nb_buf_indices, nb_masks) =
+            BufferRadiusNeighbors(block_hashmap_, buf_indices_i32);
+    core::Tensor inverse_index_map({capacity}, core::Int32, device);
+    inverse_index_map.IndexSet(
+            {buf_indices_i32.To(core::Int64)},
+            core::Tensor::Arange(0, n_owned + n_boundary, 1, core::Int32,
+                                 device));
+
+    core::Tensor vertices, triangles, vertex_normals, vertex_colors;
+    core::Tensor triangle_block_indices;
+    TensorMap block_value_map =
+            ConstructTensorMap(*block_hashmap_, name_attr_map_);
+    int vertex_count = -1;
+    kernel::voxel_grid::ExtractTriangleMesh(
+            buf_indices_i32, inverse_index_map, nb_buf_indices, nb_masks,
+            owned_block_masks, block_keys, block_value_map, vertices,
+            triangles, vertex_normals, vertex_colors, triangle_block_indices,
+            block_resolution_, voxel_size_, weight_threshold, vertex_count);
+
+    // Split the triangles by owner block on the host, and gather the
+    // vertices referenced by each chunk.
+    core::Device host("CPU:0");
+    const bool has_colors = vertex_colors.GetLength() == vertices.GetLength();
+    vertices = vertices.To(host);
+    vertex_normals = vertex_normals.To(host);
+    if (has_colors) {
+        vertex_colors = vertex_colors.To(host);
+    }
+    triangles = triangles.To(host).Contiguous();
+    triangle_block_indices = triangle_block_indices.To(host).Contiguous();
+    const int *triangle_ptr = triangles.GetDataPtr<int>();
+    const int *triangle_block_ptr = triangle_block_indices.GetDataPtr<int>();
+    const int64_t n_triangles = triangles.GetLength();
+
+    std::vector<int64_t> offsets(n_owned + 1, 0);
+    for (int64_t i = 0; i < n_triangles; ++i) {
+        ++offsets[triangle_block_ptr[i] + 1];
+    }
+    for (int64_t c = 0; c < n_owned; ++c) {
+        offsets[c + 1] += offsets[c];
+    }
+    std::vector<int64_t> sorted_triangles(n_triangles);
+    std::vector<int64_t> cursors(offsets.begin(), offsets.end() - 1);
+    for (int64_t i = 0; i < n_triangles; ++i) {
+        sorted_triangles[cursors[triangle_block_ptr[i]]++] = i;
+    }
+
+    std::vector<int64_t> vertex_chunks(vertices.GetLength(), -1);
+    std::vector<int> vertex_local_indices(vertices.GetLength(), -1);
+    for (int64_t c = 0; c < n_owned; ++c) {
+        std::vector<int64_t> chunk_vertices;
+        std::vector<int> chunk_triangles;
+        for (int64_t k = offsets[c]; k < offsets[c + 1]; ++k) {
+            const int *triangle = triangle_ptr + 3 * sorted_triangles[k];
+            for (int j = 0; j < 3; ++j) {
+                const int v = triangle[j];
+                if (vertex_chunks[v] != c) {
+                    vertex_chunks[v] = c;
+                    vertex_local_indices[v] = int(chunk_vertices.size());
+                    chunk_vertices.push_back(v);
+                }
+                chunk_triangles.push_back(vertex_local_indices[v]);
+            }
+        }
+        if (chunk_triangles.empty()) {
+            chunks.emplace_back(device);
+            continue;
+        }
+
+        core::Tensor vertex_indices(
+                chunk_vertices, {int64_t(chunk_vertices.size())}, core::Int64,
+                host);
+        TriangleMesh chunk(
+                vertices.IndexGet({vertex_indices}),
+                core::Tensor(chunk_triangles,
+                             {int64_t(chunk_triangles.size() / 3), 3},
+                             core::Int32, host));
+        chunk.SetVertexNormals(vertex_normals.IndexGet({vertex_indices}));
+        if (has_colors) {
+            chunk.SetVertexColors(vertex_colors.IndexGet({vertex_indices}));
+        }
+        chunks.push_back(chunk.To(device));
+    }
+    for (int64_t i = 0; i < inactive_keys.GetLength(); ++i) {
+        chunks.emplace_back(device);
+    }
+    return std::make_pair(owned_keys.Append(inactive_keys, 0), chunks);
+}
+
+core::Tensor VoxelBlockGrid::GetDirtyBlockCoordinates() {
+    AssertInitialized();
+    if (dirty_block_coords_.GetLength() == 0) {
+        return core::Tensor({0, 3}, core::Int32, block_hashmap_->GetDevice());
+    }
+    dirty_block_coords_ = UniqueBlockCoordinates(dirty_block_coords_);
+    return dirty_block_coords_;
+}
+
+void VoxelBlockGrid::SetOccupancyParameters(float log_odds_hit,
+                                            float log_odds_miss,
+                                            float log_odds_min,
+                                            float log_odds_max) {
+    if (log_odds_hit <= 0 || log_odds_miss >= 0) {
+        utility::LogError(
+                "Expected positive hit and negative miss log-odds, but got {} "
+                "and {}.",
+                log_odds_hit, log_odds_miss);
+    }
+    if (log_odds_min >= 0 || log_odds_max <= 0) {
+        utility::LogError(
+                "Expected a clamping range around 0, but got [{}, {}].",
+                log_odds_min, log_odds_max);
+    }
+    log_odds_hit_ = log_odds_hit;
+    log_odds_miss_ = log_odds_miss;
+    log_odds_min_ = log_odds_min;
+    log_odds_max_ = log_odds_max;
+}
+
+core::Tensor VoxelBlockGrid::QueryOccupancy(const core::Tensor &points) {
+    AssertInitialized();
+    if (name_attr_map_.count("log_odds") == 0) {
+        utility::LogError("Attribute log_odds not allocated in blocks.");
+    }
+
+    core::Tensor flattened_indices, masks;
+    FindVoxels(points, flattened_indices, masks);
+
+    core::Tensor log_odds = core::Tensor::Zeros(
+            {points.GetLength()}, core::Float32, block_hashmap_->GetDevice());
+    core::Tensor voxel_log_odds = GetAttribute("log_odds").Reshape({-1});
+    log_odds.IndexSet({masks}, voxel_log_odds.IndexGet(
+                                       {flattened_indices.IndexGet({masks})}));
+    return log_odds;
+}
+
+core::Tensor VoxelBlockGrid::QueryLabels(const core::Tensor &points) {
+    AssertInitialized();
+    std::string attr_name;
+    if (name_attr_map_.count("label_count") > 0) {
+        attr_name = "label_count";
+    } else if (name_attr_map_.count("label_probability") > 0) {
+        attr_name = "label_probability";
+    } else {
+        utility::LogError(
+                "Neither label_count nor label_probability allocated in "
+                "blocks.");
+    }
+
+    core::Tensor flattened_indices, masks;
+    FindVoxels(points, flattened_indices, masks);
+
+    core::Tensor attr = GetAttribute(attr_name);
+    int64_t num_labels = attr.GetShape().back();
+    core::Tensor scores =
+            attr.Reshape({-1, num_labels})
+                    .IndexGet({flattened_indices.IndexGet({masks})})
+                    .To(core::Float32);
+
+    core::Tensor labels = core::Tensor::Full(
+            {points.GetLength()}, -1, core::Int32, block_hashmap_->GetDevice());
+    if (scores.GetLength() == 0) {
+        return labels;
+    }
+
+    // Voxels without observations have all-zero scores.
+    core::Tensor observed = scores.Max({1}).Gt(0);
+    core::Tensor found_labels = core::Tensor::Full(
+            {scores.GetLength()}, -1, core::Int32, scores.GetDevice());
+    found_labels.IndexSet(
+            {observed},
+            scores.IndexGet({observed}).ArgMax({1}).To(core::Int32));
+    labels.IndexSet({masks}, found_labels);
+    return labels;
+}
+
+PointCloud VoxelBlockGrid::ExtractOccupiedVoxels(float log_odds_threshold) {
+    AssertInitialized();
+    if (name_attr_map_.count("log_odds") == 0) {
+        utility::LogError("Attribute log_odds not allocated in blocks.");
+    }
+
+    core::Tensor voxel_coords, flattened_indices;
+    std::tie(voxel_coords, flattened_indices) =
+            GetVoxelCoordinatesAndFlattenedIndices();
+    core::Tensor log_odds = GetAttribute("log_odds")
+                                    .Reshape({-1})
+                                    .IndexGet({flattened_indices});
+    core::Tensor masks = log_odds.Gt(log_odds_threshold);
+
+    PointCloud pcd(voxel_coords.IndexGet({masks}));
+    pcd.SetPointAttr("log_odds", log_odds.IndexGet({masks}).Reshape({-1, 1}));
+    return pcd;
+}
+
 void VoxelBlockGrid::Save(const std::string &file_name) const {
     AssertInitialized();
     // TODO(wei): provide 'GetActiveKeyValues' functionality.
@@ -609,6 +1172,249 @@ VoxelBlockGrid VoxelBlockGrid::Load(const std::string &file_name) {
     return vbg;
 }
 
+VoxelBlockGrid VoxelBlockGrid::Snapshot() const {
+    core::ScopedMemoryTag memory_tag("voxel_block_grid");
+    AssertInitialized();
+    VoxelBlockGrid snapshot;
+    snapshot.voxel_size_ = voxel_size_;
+    snapshot.block_resolution_ = block_resolution_;
+    snapshot.name_attr_map_ = name_attr_map_;
+    snapshot.log_odds_hit_ = log_odds_hit_;
+    snapshot.log_odds_miss_ = log_odds_miss_;
+    snapshot.log_odds_min_ = log_odds_min_;
+    snapshot.log_odds_max_ = log_odds_max_;
+
+    std::shared_lock<std::shared_timed_mutex> lock(block_access_->mutex_);
+    snapshot.block_hashmap_ =
+            std::make_shared<core::HashMap>(block_hashmap_->Clone());
+    snapshot.block_access_->epoch_ = block_access_->epoch_;
+    return snapshot;
+}
+
+std::future<TriangleMesh> VoxelBlockGrid::ExtractTriangleMeshAsync(
+        float weight_threshold) const {
+    // The snapshot is taken on the calling thread, so that the mesh reflects
+    // the frames integrated before this call.
+    auto snapshot = std::make_shared<VoxelBlockGrid>(Snapshot());
+    return std::async(std::launch::async, [snapshot, weight_threshold]() {
+        return snapshot->ExtractTriangleMesh(weight_threshold);
+    });
+}
+
+int64_t VoxelBlockGrid::GetEpoch() const {
+    std::shared_lock<std::shared_timed_mutex> lock(block_access_->mutex_);
+    return block_access_->epoch_;
+}
+
+int64_t VoxelBlockGrid::EvictBlocks(const core::Tensor &extrinsic,
+                                    float radius) {
+    core::ScopedMemoryTag memory_tag("voxel_block_grid");
+    AssertInitialized();
+    CheckExtrinsicTensor(extrinsic);
+    if (radius < 0) {
+        utility::LogError("Eviction radius must be non-negative, but got {}.",
+                          radius);
+    }
+
+    std::unique_lock<std::shared_timed_mutex> lock(block_access_->mutex_);
+    core::Tensor active_buf_indices =
+            block_hashmap_->GetActiveIndices().To(core::Int64);
+    if (active_buf_indices.GetLength() == 0) {
+        return 0;
+    }
+
+    // Camera center in the world coordinate system.
+    core::Device device = block_hashmap_->GetDevice();
+    core::Tensor pose = InverseTransformation(
+            extrinsic.To(core::Device("CPU:0")).Contiguous());
+    core::Tensor camera_center =
+            pose.Slice(0, 0, 3).Slice(1, 3, 4).T().To(device, core::Float32);
+
+    core::Tensor active_keys =
+            block_hashmap_->GetKeyTensor().IndexGet({active_buf_indices});
+    const float block_size = voxel_size_ * block_resolution_;
+    core::Tensor block_centers =
+            (active_keys.To(core::Float32) + 0.5f) * block_size;
+    core::Tensor diff = block_centers - camera_center;
+    core::Tensor evict_masks = (diff * diff).Sum({1}).Gt(radius * radius);
+
+    core::Tensor evict_keys = active_keys.IndexGet({evict_masks});
+    if (evict_keys.GetLength() == 0) {
+        return 0;
+    }
+    ++block_access_->epoch_;
+    MoveBlocksToHost(evict_keys, active_buf_indices.IndexGet({evict_masks}));
+    MarkBlocksDirty(evict_keys);
+    return evict_keys.GetLength();
+}
+
+int64_t VoxelBlockGrid::RestoreBlocks(const core::Tensor &block_coords) {
+    core::ScopedMemoryTag memory_tag("voxel_block_grid");
+    AssertInitialized();
+    CheckBlockCoorinates(block_coords);
+    std::unique_lock<std::shared_timed_mutex> lock(block_access_->mutex_);
+    return PageInBlocks(block_coords);
+}
+
+int64_t VoxelBlockGrid::PageInBlocks(const core::Tensor &block_coords) {
+    if (GetEvictedBlockCount() == 0 || block_coords.GetLength() == 0) {
+        return 0;
+    }
+
+    core::Tensor keys = block_coords.To(core::Device("CPU:0"));
+    core::Tensor buf_indices, masks;
+    evicted_hashmap_->Find(keys, buf_indices, masks);
+
+    core::Tensor restore_keys = keys.IndexGet({masks});
+    if (restore_keys.GetLength() == 0) {
+        return 0;
+    }
+    core::Tensor restore_buf_indices =
+            buf_indices.IndexGet({masks}).To(core::Int64);
+
+    core::Device device = block_hashmap_->GetDevice();
+    std::vector<core::Tensor> restore_values;
+    for (const core::Tensor &value : evicted_hashmap_->GetValueTensors()) {
+        restore_values.push_back(
+                value.IndexGet({restore_buf_indices}).To(device));
+    }
+    ++block_access_->epoch_;
+    block_hashmap_->Insert(restore_keys.To(device), restore_values);
+    evicted_hashmap_->Erase(restore_keys);
+    MarkBlocksDirty(restore_keys);
+    return restore_keys.GetLength();
+}
+
+int64_t VoxelBlockGrid::RestoreBlocks() {
+    core::ScopedMemoryTag memory_tag("voxel_block_grid");
+    AssertInitialized();
+    std::unique_lock<std::shared_timed_mutex> lock(block_access_->mutex_);
+    if (GetEvictedBlockCount() == 0) {
+        return 0;
+    }
+    core::Tensor active_buf_indices =
+            evicted_hashmap_->GetActiveIndices().To(core::Int64);
+    return PageInBlocks(
+            evicted_hashmap_->GetKeyTensor().IndexGet({active_buf_indices}));
+}
+
+int64_t VoxelBlockGrid::GetEvictedBlockCount() const {
+    return evicted_hashmap_ == nullptr ? 0 : evicted_hashmap_->Size();
+}
+
+void VoxelBlockGrid::SaveEvictedBlocks(const std::string &file_name) {
+    AssertInitialized();
+    InitEvictedHashMap();
+    t::io::WriteHashMap(file_name, *evicted_hashmap_);
+    evicted_hashmap_ = nullptr;
+}
+
+void VoxelBlockGrid::LoadEvictedBlocks(const std::string &file_name) {
+    AssertInitialized();
+    core::HashMap loaded = t::io::ReadHashMap(file_name);
+    std::vector<core::Tensor> values = loaded.GetValueTensors();
+    if (values.size() != block_hashmap_->GetValueTensors().size()) {
+        utility::LogError(
+                "Number of attributes ({}) in {} mismatch with the voxel "
+                "block grid ({}).",
+                values.size(), file_name,
+                block_hashmap_->GetValueTensors().size());
+    }
+
+    core::Tensor active_buf_indices =
+            loaded.GetActiveIndices().To(core::Int64);
+    core::Tensor keys = loaded.GetKeyTensor().IndexGet({active_buf_indices});
+    for (auto &value : values) {
+        value = value.IndexGet({active_buf_indices});
+    }
+
+    std::unique_lock<std::shared_timed_mutex> lock(block_access_->mutex_);
+    ++block_access_->epoch_;
+    InitEvictedHashMap();
+    evicted_hashmap_->Erase(keys);
+    evicted_hashmap_->Insert(keys, values);
+}
+
+void VoxelBlockGrid::InitEvictedHashMap() {
+    core::ScopedMemoryTag memory_tag("voxel_block_grid");
+    if (evicted_hashmap_ != nullptr) {
+        return;
+    }
+    std::vector<core::Dtype> dtypes;
+    std::vector<core::SizeVector> element_shapes;
+    for (const core::Tensor &value : block_hashmap_->GetValueTensors()) {
+        core::SizeVector shape = value.GetShape();
+        dtypes.push_back(value.GetDtype());
+        element_shapes.emplace_back(shape.begin() + 1, shape.end());
+    }
+    evicted_hashmap_ = std::make_shared<core::HashMap>(
+            block_hashmap_->GetCapacity(), core::Int32, core::SizeVector{3},
+            dtypes, element_shapes, core::Device("CPU:0"));
+}
+
+void VoxelBlockGrid::MoveBlocksToHost(const core::Tensor &keys,
+                                      const core::Tensor &buf_indices) {
+    InitEvictedHashMap();
+
+    core::Device host("CPU:0");
+    core::Tensor host_keys = keys.To(host);
+    std::vector<core::Tensor> host_values;
+    for (const core::Tensor &value : block_hashmap_->GetValueTensors()) {
+        host_values.push_back(value.IndexGet({buf_indices}).To(host));
+    }
+
+    // Replace stale copies, if any.
+    evicted_hashmap_->Erase(host_keys);
+    evicted_hashmap_->Insert(host_keys, host_values);
+    block_hashmap_->Erase(keys);
+}
+
+void VoxelBlockGrid::FindVoxels(const core::Tensor &points,
+                                core::Tensor &flattened_indices,
+                                core::Tensor &masks) {
+    core::AssertTensorShape(points, {utility::nullopt, 3});
+    core::AssertTensorDtype(points, core::Float32);
+
+    core::Device device = block_hashmap_->GetDevice();
+    const float resolution = static_cast<float>(block_resolution_);
+
+    // Voxel i is centered at i * voxel_size.
+    core::Tensor voxel_coords = (points.To(device) / voxel_size_).Round();
+    core::Tensor block_coords = (voxel_coords / resolution).Floor();
+    core::Tensor local_coords =
+            (voxel_coords - block_coords * resolution).To(core::Int64);
+
+    core::Tensor buf_indices;
+    block_hashmap_->Find(block_coords.To(core::Int32), buf_indices, masks);
+
+    // Values are stored in z-y-x order within a block.
+    const int64_t r = block_resolution_;
+    flattened_indices = ((buf_indices.To(core::Int64) * r +
+                          local_coords.Slice(1, 2, 3).Reshape({-1})) *
+                                 r +
+                         local_coords.Slice(1, 1, 2).Reshape({-1})) *
+                                r +
+                        local_coords.Slice(1, 0, 1).Reshape({-1});
+}
+
+void VoxelBlockGrid::MarkBlocksDirty(const core::Tensor &block_coords) {
+    if (block_coords.GetLength() == 0) {
+        return;
+    }
+    core::Tensor coords = block_coords.To(block_hashmap_->GetDevice());
+    if (dirty_block_coords_.GetLength() == 0) {
+        dirty_block_coords_ = coords.Clone();
+        return;
+    }
+    dirty_block_coords_ = dirty_block_coords_.Append(coords, 0);
+
+    // Bound the memory of the duplicates between extractions.
+    if (dirty_block_coords_.GetLength() >
+        2 * std::max<int64_t>(block_hashmap_->Size(), 1024)) {
+        dirty_block_coords_ = UniqueBlockCoordinates(dirty_block_coords_);
+    }
+}
+
 void VoxelBlockGrid::AssertInitialized() const {
     if (block_hashmap_ == nullptr) {
         utility::LogError("VoxelBlockGrid not initialized.");
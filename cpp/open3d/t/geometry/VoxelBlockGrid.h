@@ -26,6 +26,10 @@
 
 #pragma once
 
+#include <future>
+#include <shared_mutex>
+#include <unordered_map>
+
 #include "open3d/core/Tensor.h"
 #include "open3d/core/hashmap/HashMap.h"
 #include "open3d/t/geometry/Geometry.h"
@@ -139,16 +143,36 @@ public:
     core::Tensor GetUniqueBlockCoordinates(const PointCloud &pcd,
                                            float trunc_voxel_multiplier = 8.0);
 
+    /// Specific operation for occupancy maps.
+    /// Get a (M, 3) block coordinates traversed by the rays of a depth image
+    /// from the camera center to the truncation distance behind the observed
+    /// depth, with duplicates removed. Integrating in these blocks carves the
+    /// free space along the rays in addition to the surface band given by
+    /// GetUniqueBlockCoordinates. Every stride-th pixel casts a ray.
+    core::Tensor GetUniqueBlockCoordinatesAlongRays(
+            const Image &depth,
+            const core::Tensor &intrinsic,
+            const core::Tensor &extrinsic,
+            float depth_scale = 1000.0f,
+            float depth_max = 3.0f,
+            float trunc_voxel_multiplier = 8.0,
+            int stride = 4);
+
     /// Specific operation for TSDF volumes.
     /// Integrate an RGB-D frame in the selected block coordinates using pinhole
     /// camera model.
     /// For built-in kernels, we support efficient hash map types for SLAM:
-    /// tsdf: float, weight: uint16_t, color: uint16_t
+    /// tsdf: float, weight: uint16_t, color: uint16_t or uint8_t,
+    /// compact mode with fixed-point tsdf in [-1, 1] scaled by 32767:
+    /// tsdf: int16_t, weight: uint16_t, color: uint8_t
     /// and accurate mode for differentiable rendering:
     /// tsdf/weight/color: float
     /// We assume input data are either raw:
     /// depth: uint16_t, color: uint8_t
     /// or depth/color: float.
+    /// If a Float32 "log_odds" attribute is allocated, the occupancy is
+    /// updated in the same pass, see SetOccupancyParameters. A voxel block
+    /// grid with "log_odds" only is a pure occupancy map.
     /// To support other types and properties, users should combine
     /// GetUniqueBlockCoordinates, GetVoxelIndices, and GetVoxelCoordinates,
     /// with self-defined operations.
@@ -162,6 +186,25 @@ public:
                    float depth_max = 3.0f,
                    float trunc_voxel_multiplier = 8.0f);
 
+    /// Specific operation for semantic TSDF volumes.
+    /// Similar to RGB-D integration, but also fuses a label image aligned with
+    /// the color image into the voxels of the surface band, in the same pass.
+    /// The fusion depends on the allocated label attribute with K channels:
+    /// label_count: UInt16, a histogram of (H, W, 1) UInt16 or Int32 label
+    /// ids, whose maximum gives the label. Ids outside [0, K) are ignored.
+    /// label_probability: Float32, per-class probabilities fused from a
+    /// (H, W, K) Float32 probability image by Bayesian updates.
+    void Integrate(const core::Tensor &block_coords,
+                   const Image &depth,
+                   const Image &color,
+                   const Image &label,
+                   const core::Tensor &depth_intrinsic,
+                   const core::Tensor &color_intrinsic,
+                   const core::Tensor &extrinsic,
+                   float depth_scale = 1000.0f,
+                   float depth_max = 3.0f,
+                   float trunc_voxel_multiplier = 8.0f);
+
     /// Specific operation for TSDF volumes.
     /// Similar to RGB-D integration, but uses the same intrinsics for depth and
     /// color.
@@ -207,6 +250,42 @@ public:
                       float trunc_voxel_multiplier = 8.0f,
                       int range_map_down_factor = 8);
 
+    /// Specific operation for TSDF volumes.
+    /// Perform volumetric ray casting in the active blocks visible from the
+    /// camera, selected by GetFrustumBlockCoordinates. The visible set is
+    /// cached and reused while the camera moves within the tolerance set by
+    /// SetFrustumCacheTolerance and no block is added or removed other than
+    /// by Integrate, which keeps the cache up to date.
+    TensorMap RayCast(const core::Tensor &intrinsic,
+                      const core::Tensor &extrinsic,
+                      int width,
+                      int height,
+                      const std::vector<std::string> attrs = {"depth", "color"},
+                      float depth_scale = 1000.0f,
+                      float depth_min = 0.1f,
+                      float depth_max = 3.0f,
+                      float weight_threshold = 3.0f,
+                      float trunc_voxel_multiplier = 8.0f,
+                      int range_map_down_factor = 8);
+
+    /// Get a (M, 3) Int32 tensor of the active block coordinates whose
+    /// bounding spheres, enlarged by \p margin (in meters), intersect the view
+    /// frustum of a (width, height) pinhole camera between depth_min and
+    /// depth_max.
+    core::Tensor GetFrustumBlockCoordinates(const core::Tensor &intrinsic,
+                                            const core::Tensor &extrinsic,
+                                            int width,
+                                            int height,
+                                            float depth_min = 0.1f,
+                                            float depth_max = 3.0f,
+                                            float margin = 0.0f);
+
+    /// Set how far the camera may move, in meters and radians, before the
+    /// visible blocks cached by RayCast are recomputed. The cached frustum is
+    /// enlarged accordingly. Zero tolerances recompute the visible blocks for
+    /// every new pose.
+    void SetFrustumCacheTolerance(float translation, float rotation);
+
     /// Specific operation for TSDF volumes.
     /// Extract point cloud at isosurface points.
     /// Weight threshold is used to filter outliers. By default we use 3.0,
@@ -225,12 +304,117 @@ public:
     /// where we assume a reliable surface point comes from the fusion of at
     /// least 3 viewpoints. Use as low as 0.0 to accept all the possible
     /// observations.
-    /// Estimated point numbers optionally speeds up the process by a one-pass
-    /// extraction with pre-allocated buffers. Use -1 when no estimate is
-    /// available.
+    /// Vertices are shared by the adjacent triangles, and the exact numbers
+    /// of vertices and triangles are determined while the cubes are
+    /// classified. The vertex number estimate is ignored and only kept for
+    /// compatibility.
+    /// Progress is reported to and cancellation is checked against
+    /// utility::OperationContext::Current() between the extraction passes;
+    /// a cancelled extraction throws utility::CancelledError.
     TriangleMesh ExtractTriangleMesh(float weight_threshold = 3.0f,
                                      int estimated_vertex_numer = -1);
 
+    /// Specific operation for TSDF volumes.
+    /// Incremental Marching Cubes, e.g. for live previews. Re-extract the mesh
+    /// chunks of the blocks changed since the last call, i.e. the blocks
+    /// passed to Integrate, restored or evicted, together with their
+    /// neighbors whose cubes reach into them. Each chunk holds the triangles
+    /// of the cubes of one block, and duplicates the vertices on the
+    /// boundaries with the neighbor blocks, so that adjacent chunks stitch
+    /// without gaps.
+    /// Returns a (M, 3) Int32 tensor of block coordinates and their M chunks,
+    /// which replace the previous chunks of these blocks. Chunks of blocks
+    /// without surface, including evicted blocks, are empty.
+    std::pair<core::Tensor, std::vector<TriangleMesh>>
+    ExtractDirtyTriangleMeshChunks(float weight_threshold = 3.0f);
+
+    /// Get a (M, 3) Int32 tensor of the block coordinates changed since the
+    /// last call of ExtractDirtyTriangleMeshChunks.
+    core::Tensor GetDirtyBlockCoordinates();
+
+    /// Specific operation for occupancy maps.
+    /// Set the log-odds increments applied by Integrate to the "log_odds"
+    /// attribute: voxels within a voxel of the observed depth are hit, voxels
+    /// in front of it are missed. The log-odds are clamped to
+    /// [log_odds_min, log_odds_max] so that the map stays responsive to
+    /// changes. The defaults correspond to hit and miss probabilities of 0.7
+    /// and 0.4 and a clamping range of [0.12, 0.97].
+    void SetOccupancyParameters(float log_odds_hit = 0.85f,
+                                float log_odds_miss = -0.4f,
+                                float log_odds_min = -2.0f,
+                                float log_odds_max = 3.5f);
+
+    /// Specific operation for occupancy maps.
+    /// Get the (N,) Float32 occupancy log-odds of the voxels nearest to
+    /// (N, 3) Float32 \p points. Points in unallocated blocks are unknown,
+    /// with a log-odds of 0.
+    core::Tensor QueryOccupancy(const core::Tensor &points);
+
+    /// Specific operation for semantic TSDF volumes.
+    /// Get the (N,) Int32 labels of the voxels nearest to (N, 3) Float32
+    /// \p points, i.e. the most frequent or the most probable class from the
+    /// label_count or label_probability attribute. Points without label
+    /// observations get -1.
+    core::Tensor QueryLabels(const core::Tensor &points);
+
+    /// Specific operation for occupancy maps.
+    /// Extract the centers of the voxels whose log-odds exceed
+    /// \p log_odds_threshold as a point cloud, with their log-odds in the
+    /// "log_odds" point attribute.
+    PointCloud ExtractOccupiedVoxels(float log_odds_threshold = 0.0f);
+
+    /// Streaming: evict active blocks whose centers are farther than \p radius
+    /// (in meters) from the camera center given by \p extrinsic (world to
+    /// camera) from the device hash map to a host-side block store. This
+    /// bounds the device memory used by large-scale scenes.
+    /// Evicted blocks are paged back in automatically when they appear in the
+    /// block coordinates passed to Integrate or RayCast, or explicitly with
+    /// RestoreBlocks. They are not visible to ExtractPointCloud,
+    /// ExtractTriangleMesh and Save while evicted.
+    /// Returns the number of evicted blocks.
+    int64_t EvictBlocks(const core::Tensor &extrinsic, float radius);
+
+    /// Streaming: page evicted blocks listed in \p block_coords, a (N, 3)
+    /// Int32 tensor, back into the device hash map. Coordinates that were not
+    /// evicted are ignored. Returns the number of restored blocks.
+    int64_t RestoreBlocks(const core::Tensor &block_coords);
+
+    /// Streaming: page all evicted blocks back into the device hash map.
+    /// Returns the number of restored blocks.
+    int64_t RestoreBlocks();
+
+    /// Streaming: number of blocks currently held in the host-side store.
+    int64_t GetEvictedBlockCount() const;
+
+    /// Streaming: write the host-side block store to a .npz file (see
+    /// t::io::WriteHashMap) and release it from host memory.
+    void SaveEvictedBlocks(const std::string &file_name);
+
+    /// Streaming: read blocks saved with SaveEvictedBlocks back into the
+    /// host-side block store. They are paged in on revisit as usual.
+    void LoadEvictedBlocks(const std::string &file_name);
+
+    /// Concurrency: deep copy the active blocks into a new voxel block grid
+    /// on the same device, e.g. to extract a mesh in the background while
+    /// this grid keeps integrating. Integrate, EvictBlocks, RestoreBlocks and
+    /// LoadEvictedBlocks hold a write lock on the blocks, shared by the
+    /// copies of this grid, and the snapshot is taken under a read lock, so
+    /// it never observes a partially integrated frame. The writers only wait
+    /// for the copy, not for the extraction. The snapshot has no evicted
+    /// blocks, frustum cache or dirty blocks, and keeps the epoch of this
+    /// grid at the time it was taken.
+    VoxelBlockGrid Snapshot() const;
+
+    /// Concurrency: take a Snapshot and run ExtractTriangleMesh on it in a
+    /// background thread.
+    std::future<TriangleMesh> ExtractTriangleMeshAsync(
+            float weight_threshold = 3.0f) const;
+
+    /// Concurrency: number of modifications of the blocks by Integrate,
+    /// EvictBlocks, RestoreBlocks and LoadEvictedBlocks. A live preview can
+    /// skip the extraction while the epoch of its last snapshot is current.
+    int64_t GetEpoch() const;
+
     /// Save a voxel block grid to a .npz file.
     void Save(const std::string &file_name) const;
 
@@ -240,6 +424,28 @@ public:
 private:
     void AssertInitialized() const;
 
+    /// Creates evicted_hashmap_ on the host on first use.
+    void InitEvictedHashMap();
+
+    /// Pages the evicted blocks in \p block_coords back in. The caller holds
+    /// the write lock of block_access_.
+    int64_t PageInBlocks(const core::Tensor &block_coords);
+
+    /// Moves the blocks with \p keys stored at \p buf_indices (Int64) in the
+    /// device hash map to evicted_hashmap_.
+    void MoveBlocksToHost(const core::Tensor &keys,
+                          const core::Tensor &buf_indices);
+
+    /// Finds the voxels nearest to (N, 3) Float32 \p points. Sets
+    /// \p flattened_indices to their (N,) Int64 indices in the flattened
+    /// attribute buffers, valid where \p masks is true.
+    void FindVoxels(const core::Tensor &points,
+                    core::Tensor &flattened_indices,
+                    core::Tensor &masks);
+
+    /// Appends \p block_coords to dirty_block_coords_.
+    void MarkBlocksDirty(const core::Tensor &block_coords);
+
     float voxel_size_ = -1;
     int64_t block_resolution_ = -1;
 
@@ -249,6 +455,45 @@ private:
     // Local hash map: 3D coords -> indices in block_hashmap_.
     std::shared_ptr<core::HashMap> frustum_hashmap_;
 
+    // Host hash map: 3D coords -> voxel blocks evicted from block_hashmap_.
+    std::shared_ptr<core::HashMap> evicted_hashmap_;
+
+    // Cache of the visible blocks of the last frustum ray casting. It is
+    // valid while block_hashmap_ holds frustum_cache_block_count_ blocks.
+    core::Tensor frustum_cache_block_coords_;
+    core::Tensor frustum_cache_intrinsic_;
+    core::Tensor frustum_cache_extrinsic_;
+    int frustum_cache_width_ = -1;
+    int frustum_cache_height_ = -1;
+    float frustum_cache_depth_min_ = 0;
+    float frustum_cache_depth_max_ = 0;
+    int64_t frustum_cache_block_count_ = -1;
+    float frustum_cache_translation_ = 0.03f;
+    float frustum_cache_rotation_ = 0.03f;
+
+    // Rendering buffers of the last ray casting, reused by the next one once
+    // the caller has released them, e.g. after copying them into a frame.
+    std::unordered_map<std::string, core::Tensor> raycast_buffers_;
+
+    // Block coordinates changed since the last incremental mesh extraction,
+    // possibly with duplicates.
+    core::Tensor dirty_block_coords_;
+
+    // Log-odds increments and clamping range of the occupancy attribute.
+    float log_odds_hit_ = 0.85f;
+    float log_odds_miss_ = -0.4f;
+    float log_odds_min_ = -2.0f;
+    float log_odds_max_ = 3.5f;
+
+    // Reader-writer lock of the blocks and their number of modifications,
+    // shared with the copies of this grid since they share block_hashmap_.
+    struct BlockAccess {
+        std::shared_timed_mutex mutex_;
+        int64_t epoch_ = 0;
+    };
+    std::shared_ptr<BlockAccess> block_access_ =
+            std::make_shared<BlockAccess>();
+
     // Map: attribute name -> index to access the attribute in SoA.
     std::unordered_map<std::string, int> name_attr_map_;
 };
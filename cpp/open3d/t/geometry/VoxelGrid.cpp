@@ -0,0 +1,371 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/t/geometry/VoxelGrid.h"
+
+#include <cmath>
+#include <vector>
+
+#include "open3d/core/TensorCheck.h"
+#include "open3d/core/TensorFunction.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+
+namespace {
+
+/// Normalizes integer colors to [0, 1] and converts them to Float32.
+core::Tensor NormalizeColors(const core::Tensor &colors) {
+    if (colors.GetDtype() == core::UInt8) {
+        return colors.To(core::Float32) / 255.0;
+    } else if (colors.GetDtype() == core::UInt16) {
+        return colors.To(core::Float32) / 65535.0;
+    }
+    return colors.To(core::Float32);
+}
+
+}  // namespace
+
+VoxelGrid::VoxelGrid(double voxel_size,
+                     const core::Tensor &origin,
+                     const core::Device &device,
+                     int64_t init_capacity,
+                     const core::HashBackendType &backend)
+    : Geometry(Geometry::GeometryType::VoxelGrid, 3),
+      voxel_size_(voxel_size),
+      device_(device) {
+    if (voxel_size <= 0) {
+        utility::LogError("voxel_size must be positive.");
+    }
+    if (origin.NumElements() == 0) {
+        origin_ = core::Tensor::Zeros({3}, core::Float64);
+    } else {
+        core::AssertTensorShape(origin, {3});
+        origin_ = origin.To(core::Device("CPU:0"), core::Float64).Clone();
+    }
+    hashmap_ = std::make_shared<core::HashMap>(
+            std::max<int64_t>(init_capacity, 1), core::Int32,
+            core::SizeVector{3}, core::Float32, core::SizeVector{3}, device,
+            backend);
+}
+
+VoxelGrid VoxelGrid::To(const core::Device &device, bool copy) const {
+    if (!copy && device == device_) {
+        return *this;
+    }
+    VoxelGrid voxel_grid(voxel_size_, origin_, device);
+    voxel_grid.hashmap_ =
+            std::make_shared<core::HashMap>(hashmap_->To(device, copy));
+    voxel_grid.has_colors_ = has_colors_;
+    return voxel_grid;
+}
+
+VoxelGrid &VoxelGrid::Clear() {
+    hashmap_->Clear();
+    has_colors_ = false;
+    return *this;
+}
+
+std::string VoxelGrid::ToString() const {
+    return fmt::format("VoxelGrid on {} [{} voxels, voxel size {}].",
+                       device_.ToString(), GetNumVoxels(), voxel_size_);
+}
+
+core::Tensor VoxelGrid::GetVoxelIndices() const {
+    const core::Tensor active = hashmap_->GetActiveIndices().To(core::Int64);
+    return hashmap_->GetKeyTensor().IndexGet({active});
+}
+
+core::Tensor VoxelGrid::GetVoxelCenters() const {
+    return ((GetVoxelIndices().To(core::Float64) + 0.5) * voxel_size_ +
+            origin_.To(device_))
+            .To(core::Float32);
+}
+
+core::Tensor VoxelGrid::GetVoxelColors() const {
+    const core::Tensor active = hashmap_->GetActiveIndices().To(core::Int64);
+    return hashmap_->GetValueTensor().IndexGet({active});
+}
+
+core::Tensor VoxelGrid::GetVoxelIndices(const core::Tensor &points) const {
+    core::AssertTensorDevice(points, device_);
+    core::AssertTensorShape(points, {utility::nullopt, 3});
+    core::AssertTensorDtypes(points, {core::Float32, core::Float64});
+    return ((points.To(core::Float64) - origin_.To(device_)) / voxel_size_)
+            .Floor()
+            .To(core::Int32);
+}
+
+VoxelGrid &VoxelGrid::AddPoints(const core::Tensor &points,
+                                const core::Tensor &colors) {
+    const core::Tensor voxel_indices = GetVoxelIndices(points);
+    core::Tensor values;
+    if (colors.NumElements() > 0 || colors.NumDims() > 1) {
+        core::AssertTensorDevice(colors, device_);
+        core::AssertTensorShape(colors, {points.GetLength(), 3});
+        core::AssertTensorDtypes(colors, {core::Float32, core::Float64});
+        values = colors.To(core::Float32);
+        has_colors_ = true;
+    } else {
+        values = core::Tensor::Zeros({points.GetLength(), 3}, core::Float32,
+                                     device_);
+    }
+    // Keys that already exist or appear more than once are inserted once.
+    hashmap_->Insert(voxel_indices, values);
+    return *this;
+}
+
+core::Tensor VoxelGrid::CheckIfIncluded(const core::Tensor &points) const {
+    core::Tensor buf_indices, masks;
+    hashmap_->Find(GetVoxelIndices(points), buf_indices, masks);
+    return masks;
+}
+
+VoxelGrid &VoxelGrid::CarveDepthMap(const Image &depth,
+                                    const core::Tensor &intrinsics,
+                                    const core::Tensor &extrinsics,
+                                    float depth_scale,
+                                    bool keep_voxels_outside_image) {
+    core::AssertTensorShape(intrinsics, {3, 3});
+    core::AssertTensorShape(extrinsics, {4, 4});
+    if (depth.GetChannels() != 1) {
+        utility::LogError("The depth image must have one channel.");
+    }
+    if (IsEmpty()) return *this;
+
+    const int64_t rows = depth.GetRows();
+    const int64_t cols = depth.GetCols();
+    const core::Tensor depth_values =
+            depth.AsTensor().To(device_, core::Float64).Reshape({-1}) /
+            depth_scale;
+
+    // The 8 corners of all voxels.
+    const core::Tensor voxel_indices = GetVoxelIndices();
+    const int64_t num_voxels = voxel_indices.GetLength();
+    const int64_t num_corners = num_voxels * 8;
+    std::vector<double> offsets;
+    for (int i = 0; i < 8; ++i) {
+        offsets.push_back(i & 1);
+        offsets.push_back((i >> 1) & 1);
+        offsets.push_back((i >> 2) & 1);
+    }
+    const core::Tensor corners =
+            ((voxel_indices.To(core::Float64).Reshape({num_voxels, 1, 3}) +
+              core::Tensor(offsets, {1, 8, 3}, core::Float64, device_)) *
+                     voxel_size_ +
+             origin_.To(device_))
+                    .Reshape({num_corners, 3});
+
+    const core::Tensor K = intrinsics.To(device_, core::Float64);
+    const core::Tensor T = extrinsics.To(device_, core::Float64);
+    const core::Tensor R = T.Slice(0, 0, 3).Slice(1, 0, 3);
+    const core::Tensor t = T.Slice(0, 0, 3).Slice(1, 3, 4).Reshape({1, 3});
+    const core::Tensor uvz = (corners.Matmul(R.T()) + t).Matmul(K.T());
+    const core::Tensor z = uvz.Slice(1, 2, 3).Reshape({num_corners});
+    const core::Tensor u =
+            (uvz.Slice(1, 0, 1).Reshape({num_corners}) / z).Round();
+    const core::Tensor v =
+            (uvz.Slice(1, 1, 2).Reshape({num_corners}) / z).Round();
+    const core::Tensor within = z.Gt(0) && u.Ge(0) && u.Le(cols - 1) &&
+                                v.Ge(0) && v.Le(rows - 1);
+
+    // Observed depth at the projected pixels, 0 outside of the image.
+    const core::Tensor within_indices = within.NonZero().Reshape({-1});
+    core::Tensor observed =
+            core::Tensor::Zeros({num_corners}, core::Float64, device_);
+    const core::Tensor pixels =
+            (v.IndexGet({within_indices}) * double(cols) +
+             u.IndexGet({within_indices}))
+                    .To(core::Int64);
+    observed.IndexSet({within_indices}, depth_values.IndexGet({pixels}));
+
+    core::Tensor keep_corner = within && observed.Gt(0) && z.Ge(observed);
+    if (keep_voxels_outside_image) {
+        keep_corner = keep_corner || within.LogicalNot();
+    }
+    const core::Tensor carve = keep_corner.Reshape({num_voxels, 8})
+                                       .To(core::Int32)
+                                       .Sum({1})
+                                       .Eq(0);
+    hashmap_->Erase(voxel_indices.IndexGet({carve}));
+    return *this;
+}
+
+VoxelGrid VoxelGrid::CreateFromPointCloud(
+        const PointCloud &pcd,
+        double voxel_size,
+        const core::HashBackendType &backend) {
+    if (!pcd.HasPointPositions() || pcd.GetPointPositions().GetLength() == 0) {
+        return VoxelGrid(voxel_size, core::Tensor(), pcd.GetDevice());
+    }
+    const core::Tensor &points = pcd.GetPointPositions();
+    const core::Tensor origin =
+            points.Min({0}).To(core::Float64) - 0.5 * voxel_size;
+    VoxelGrid voxel_grid(voxel_size, origin, pcd.GetDevice(),
+                         points.GetLength(), backend);
+    voxel_grid.AddPoints(points, pcd.HasPointColors()
+                                         ? NormalizeColors(pcd.GetPointColors())
+                                         : core::Tensor());
+    return voxel_grid;
+}
+
+VoxelGrid VoxelGrid::CreateFromTriangleMesh(
+        const TriangleMesh &mesh,
+        double voxel_size,
+        const core::HashBackendType &backend) {
+    const core::Device device = mesh.GetDevice();
+    if (!mesh.HasVertexPositions() ||
+        mesh.GetVertexPositions().GetLength() == 0) {
+        return VoxelGrid(voxel_size, core::Tensor(), device);
+    }
+    const core::Tensor vertices = mesh.GetVertexPositions().To(core::Float64);
+    const core::Tensor origin = vertices.Min({0}) - 0.5 * voxel_size;
+    VoxelGrid voxel_grid(voxel_size, origin, device, vertices.GetLength(),
+                         backend);
+    const bool has_colors = mesh.HasVertexColors();
+    const core::Tensor colors =
+            has_colors ? NormalizeColors(mesh.GetVertexColors())
+                       : core::Tensor();
+    voxel_grid.AddPoints(vertices, colors);
+    if (!mesh.HasTriangleIndices() ||
+        mesh.GetTriangleIndices().GetLength() == 0) {
+        return voxel_grid;
+    }
+
+    const core::Tensor triangles =
+            mesh.GetTriangleIndices().To(core::Int64);
+    const int64_t num_triangles = triangles.GetLength();
+    const core::Tensor v0 = vertices.IndexGet({triangles.Slice(1, 0, 1)
+                                                       .Reshape({-1})});
+    const core::Tensor e1 =
+            vertices.IndexGet({triangles.Slice(1, 1, 2).Reshape({-1})}) - v0;
+    const core::Tensor e2 =
+            vertices.IndexGet({triangles.Slice(1, 2, 3).Reshape({-1})}) - v0;
+
+    // Sample all triangles on a barycentric grid with k subdivisions such
+    // that the longest edge is sampled with a spacing of half a voxel.
+    const double max_edge = std::sqrt(
+            core::Concatenate({(e1 * e1).Sum({1}), (e2 * e2).Sum({1}),
+                               ((e2 - e1) * (e2 - e1)).Sum({1})})
+                    .Max({0})
+                    .Item<double>());
+    const int64_t k = std::max<int64_t>(
+            1, int64_t(std::ceil(max_edge / (0.5 * voxel_size))));
+    std::vector<double> weights;
+    for (int64_t i = 0; i <= k; ++i) {
+        for (int64_t j = 0; i + j <= k; ++j) {
+            weights.push_back(double(i) / k);
+            weights.push_back(double(j) / k);
+        }
+    }
+    const int64_t num_samples = weights.size() / 2;
+    const core::Tensor w =
+            core::Tensor(weights, {num_samples, 2}, core::Float64, device);
+    const core::Tensor w1 = w.Slice(1, 0, 1).Reshape({1, num_samples, 1});
+    const core::Tensor w2 = w.Slice(1, 1, 2).Reshape({1, num_samples, 1});
+
+    core::Tensor c0, ce1, ce2;
+    if (has_colors) {
+        c0 = colors.IndexGet({triangles.Slice(1, 0, 1).Reshape({-1})});
+        ce1 = colors.IndexGet({triangles.Slice(1, 1, 2).Reshape({-1})}) - c0;
+        ce2 = colors.IndexGet({triangles.Slice(1, 2, 3).Reshape({-1})}) - c0;
+    }
+
+    // Bound the number of samples in flight.
+    const int64_t max_chunk_samples = int64_t(1) << 22;
+    const int64_t chunk_size =
+            std::max<int64_t>(1, max_chunk_samples / num_samples);
+    for (int64_t begin = 0; begin < num_triangles; begin += chunk_size) {
+        const int64_t end = std::min(num_triangles, begin + chunk_size);
+        const int64_t n = end - begin;
+        const auto Interpolate = [&](const core::Tensor &base,
+                                     const core::Tensor &d1,
+                                     const core::Tensor &d2) {
+            return (base.Slice(0, begin, end).Reshape({n, 1, 3}) +
+                    w1.To(base.GetDtype()) *
+                            d1.Slice(0, begin, end).Reshape({n, 1, 3}) +
+                    w2.To(base.GetDtype()) *
+                            d2.Slice(0, begin, end).Reshape({n, 1, 3}))
+                    .Reshape({n * num_samples, 3});
+        };
+        voxel_grid.AddPoints(Interpolate(v0, e1, e2),
+                             has_colors ? Interpolate(c0, ce1, ce2)
+                                        : core::Tensor());
+    }
+    return voxel_grid;
+}
+
+VoxelGrid VoxelGrid::FromLegacy(const open3d::geometry::VoxelGrid &voxel_grid,
+                                const core::Device &device) {
+    const std::vector<open3d::geometry::Voxel> voxels = voxel_grid.GetVoxels();
+    const int64_t num_voxels = voxels.size();
+    const core::Tensor origin(voxel_grid.origin_.data(), {3}, core::Float64);
+    VoxelGrid result(voxel_grid.voxel_size_, origin, device, num_voxels);
+    if (num_voxels == 0) return result;
+
+    core::Tensor indices({num_voxels, 3}, core::Int32);
+    core::Tensor colors({num_voxels, 3}, core::Float32);
+    int32_t *indices_ptr = indices.GetDataPtr<int32_t>();
+    float *colors_ptr = colors.GetDataPtr<float>();
+    for (int64_t i = 0; i < num_voxels; ++i) {
+        for (int d = 0; d < 3; ++d) {
+            indices_ptr[3 * i + d] = voxels[i].grid_index_(d);
+            colors_ptr[3 * i + d] = float(voxels[i].color_(d));
+        }
+    }
+    result.hashmap_->Insert(indices.To(device), colors.To(device));
+    result.has_colors_ = voxel_grid.HasColors();
+    return result;
+}
+
+open3d::geometry::VoxelGrid VoxelGrid::ToLegacy() const {
+    open3d::geometry::VoxelGrid voxel_grid;
+    voxel_grid.voxel_size_ = voxel_size_;
+    const double *origin_ptr = origin_.GetDataPtr<double>();
+    voxel_grid.origin_ =
+            Eigen::Vector3d(origin_ptr[0], origin_ptr[1], origin_ptr[2]);
+
+    const core::Device host("CPU:0");
+    const core::Tensor indices = GetVoxelIndices().To(host).Contiguous();
+    const core::Tensor colors = GetVoxelColors().To(host).Contiguous();
+    const int32_t *indices_ptr = indices.GetDataPtr<int32_t>();
+    const float *colors_ptr = colors.GetDataPtr<float>();
+    for (int64_t i = 0; i < indices.GetLength(); ++i) {
+        voxel_grid.AddVoxel(open3d::geometry::Voxel(
+                Eigen::Vector3i(indices_ptr[3 * i], indices_ptr[3 * i + 1],
+                                indices_ptr[3 * i + 2]),
+                Eigen::Vector3d(colors_ptr[3 * i], colors_ptr[3 * i + 1],
+                                colors_ptr[3 * i + 2])));
+    }
+    return voxel_grid;
+}
+
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,177 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/core/hashmap/HashMap.h"
+#include "open3d/geometry/VoxelGrid.h"
+#include "open3d/t/geometry/Geometry.h"
+#include "open3d/t/geometry/Image.h"
+#include "open3d/t/geometry/PointCloud.h"
+#include "open3d/t/geometry/TriangleMesh.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+
+/// \class VoxelGrid
+/// \brief A sparse voxel grid with optional voxel colors.
+///
+/// Voxels are stored in a core::HashMap keyed by their Int32 grid indices, so
+/// construction, inclusion queries and carving run in parallel on the device
+/// of the grid, CPU or CUDA. The voxel with grid index (i, j, k) covers the
+/// cube [origin + (i, j, k) * voxel_size, origin + (i + 1, j + 1, k + 1) *
+/// voxel_size).
+class VoxelGrid : public Geometry {
+public:
+    /// \brief Constructs an empty voxel grid.
+    /// \param voxel_size The edge length of the voxels.
+    /// \param origin The coordinate of the corner of voxel (0, 0, 0) with
+    /// shape {3}. Defaults to zeros.
+    /// \param device The device of the grid.
+    /// \param init_capacity The initial capacity of the hash map.
+    /// \param backend The hash map backend.
+    VoxelGrid(double voxel_size = 1.0,
+              const core::Tensor &origin = core::Tensor(),
+              const core::Device &device = core::Device("CPU:0"),
+              int64_t init_capacity = 1000,
+              const core::HashBackendType &backend =
+                      core::HashBackendType::Default);
+    ~VoxelGrid() override {}
+
+    /// Returns a copy of the grid on \p device. If \p copy is false and the
+    /// grid is already on \p device, the hash map is shared.
+    VoxelGrid To(const core::Device &device, bool copy = false) const;
+
+    /// Returns a copy of the grid.
+    VoxelGrid Clone() const { return To(GetDevice(), /*copy=*/true); }
+
+    VoxelGrid &Clear() override;
+    bool IsEmpty() const override { return GetNumVoxels() == 0; }
+
+    /// Text description.
+    std::string ToString() const;
+
+    double GetVoxelSize() const { return voxel_size_; }
+    /// The origin as a Float64 tensor of shape {3} on the CPU.
+    core::Tensor GetOrigin() const { return origin_; }
+    core::Device GetDevice() const { return device_; }
+    int64_t GetNumVoxels() const { return hashmap_->Size(); }
+    bool HasColors() const { return has_colors_; }
+
+    /// Returns the grid indices of the voxels as an Int32 tensor of shape
+    /// {N, 3}. GetVoxelCenters() and GetVoxelColors() use the same order.
+    core::Tensor GetVoxelIndices() const;
+
+    /// Returns the voxel centers as a Float32 tensor of shape {N, 3}.
+    core::Tensor GetVoxelCenters() const;
+
+    /// Returns the voxel colors as a Float32 tensor of shape {N, 3}. Voxels
+    /// without colors are black.
+    core::Tensor GetVoxelColors() const;
+
+    /// Converts points to the grid indices of the voxels containing them.
+    /// \param points A float tensor of shape {N, 3}.
+    /// \return An Int32 tensor of shape {N, 3}.
+    core::Tensor GetVoxelIndices(const core::Tensor &points) const;
+
+    /// \brief Adds the voxels containing \p points.
+    ///
+    /// Voxels that already exist keep their color. A new voxel takes the color
+    /// of one of the points inside it.
+    /// \param points A float tensor of shape {N, 3}.
+    /// \param colors An optional float tensor of shape {N, 3}.
+    VoxelGrid &AddPoints(const core::Tensor &points,
+                         const core::Tensor &colors = core::Tensor());
+
+    /// \brief Checks for each point if it lies inside a voxel of the grid.
+    /// \param points A float tensor of shape {N, 3}.
+    /// \return A Bool tensor of shape {N}.
+    core::Tensor CheckIfIncluded(const core::Tensor &points) const;
+
+    /// \brief Removes the voxels that lie in front of a depth map.
+    ///
+    /// A voxel is kept if one of its corners projects to a pixel with a valid
+    /// depth (> 0) that is not behind the corner, i.e., the corner is on or
+    /// behind the observed surface. Corners are projected to the nearest
+    /// pixel.
+    /// \param depth The depth image with shape {H, W, 1}.
+    /// \param intrinsics The camera intrinsic matrix with shape {3, 3}.
+    /// \param extrinsics The world to camera transformation with shape {4, 4}.
+    /// \param depth_scale The depth is scaled by 1 / \p depth_scale.
+    /// \param keep_voxels_outside_image Keep voxels with a corner that
+    /// projects outside of the image or lies behind the camera.
+    VoxelGrid &CarveDepthMap(const Image &depth,
+                             const core::Tensor &intrinsics,
+                             const core::Tensor &extrinsics,
+                             float depth_scale = 1000.0f,
+                             bool keep_voxels_outside_image = true);
+
+    /// \brief Creates a voxel grid with the voxels containing the points.
+    ///
+    /// The origin is half a voxel below the minimum bound of the points, as in
+    /// the legacy VoxelGrid. The voxel colors are taken from the point colors.
+    static VoxelGrid CreateFromPointCloud(
+            const PointCloud &pcd,
+            double voxel_size,
+            const core::HashBackendType &backend =
+                    core::HashBackendType::Default);
+
+    /// \brief Creates a voxel grid with the voxels touched by the triangles.
+    ///
+    /// The triangles are sampled with a spacing of at most half a voxel, so
+    /// very thin slivers of a triangle inside a voxel may be missed.
+    static VoxelGrid CreateFromTriangleMesh(
+            const TriangleMesh &mesh,
+            double voxel_size,
+            const core::HashBackendType &backend =
+                    core::HashBackendType::Default);
+
+    /// Creates a voxel grid from a legacy voxel grid.
+    static VoxelGrid FromLegacy(
+            const open3d::geometry::VoxelGrid &voxel_grid,
+            const core::Device &device = core::Device("CPU:0"));
+
+    /// Converts to a legacy voxel grid.
+    open3d::geometry::VoxelGrid ToLegacy() const;
+
+private:
+    double voxel_size_;
+    core::Tensor origin_;
+    core::Device device_;
+    /// Int32 {3} grid indices to Float32 {3} colors.
+    std::shared_ptr<core::HashMap> hashmap_;
+    bool has_colors_ = false;
+};
+
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
@@ -26,13 +26,25 @@
 
 #include "open3d/t/geometry/kernel/Image.h"
 
+#include <cmath>
+#include <vector>
+
 #include "open3d/core/CUDAUtils.h"
+#include "open3d/core/ShapeUtil.h"
+#include "open3d/core/TensorCheck.h"
 namespace open3d {
 namespace t {
 namespace geometry {
 namespace kernel {
 namespace image {
 
+/// Views a single (rows, cols, channels) image as a stack of one image.
+static core::Tensor AsStack(const core::Tensor &im) {
+    return im.NumDims() == 3
+                   ? im.Reshape(core::shape_util::Concat({1}, im.GetShape()))
+                   : im;
+}
+
 void To(const core::Tensor &src,
         core::Tensor &dst,
         double scale,
@@ -64,15 +76,31 @@ void ClipTransform(const core::Tensor &src,
     }
 }
 
+void PyrDown(const core::Tensor &src, core::Tensor &dst) {
+    core::Device device = src.GetDevice();
+    const core::Tensor src_stack = AsStack(src);
+    core::Tensor dst_stack = AsStack(dst);
+    if (device.GetType() == core::Device::DeviceType::CPU) {
+        PyrDownCPU(src_stack, dst_stack);
+    } else if (device.GetType() == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(PyrDownCUDA, src_stack, dst_stack);
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
 void PyrDownDepth(const core::Tensor &src,
                   core::Tensor &dst,
                   float diff_threshold,
                   float invalid_fill) {
     core::Device device = src.GetDevice();
+    const core::Tensor src_stack = AsStack(src);
+    core::Tensor dst_stack = AsStack(dst);
     if (device.GetType() == core::Device::DeviceType::CPU) {
-        PyrDownDepthCPU(src, dst, diff_threshold, invalid_fill);
+        PyrDownDepthCPU(src_stack, dst_stack, diff_threshold, invalid_fill);
     } else if (device.GetType() == core::Device::DeviceType::CUDA) {
-        CUDA_CALL(PyrDownDepthCUDA, src, dst, diff_threshold, invalid_fill);
+        CUDA_CALL(PyrDownDepthCUDA, src_stack, dst_stack, diff_threshold,
+                  invalid_fill);
     } else {
         utility::LogError("Unimplemented device");
     }
@@ -83,13 +111,26 @@ void CreateVertexMap(const core::Tensor &src,
                      const core::Tensor &intrinsics,
                      float invalid_fill) {
     core::Device device = src.GetDevice();
-    static const core::Device host("CPU:0");
+    const core::Tensor src_stack = AsStack(src);
+    core::Tensor dst_stack = AsStack(dst);
 
-    core::Tensor intrinsics_d = intrinsics.To(host, core::Float64).Contiguous();
+    // A single (3, 3) matrix is shared by all images of the stack.
+    const int64_t batch_size = src_stack.GetShape(0);
+    core::Tensor intrinsics_d = intrinsics.To(device, core::Float64);
+    if (intrinsics_d.NumDims() == 2) {
+        core::AssertTensorShape(intrinsics_d, {3, 3});
+        intrinsics_d = intrinsics_d.Reshape({1, 3, 3});
+    }
+    core::AssertTensorShape(intrinsics_d, {utility::nullopt, 3, 3});
+    if (intrinsics_d.GetLength() != batch_size) {
+        intrinsics_d = intrinsics_d.Expand({batch_size, 3, 3});
+    }
+    intrinsics_d = intrinsics_d.Contiguous();
     if (device.GetType() == core::Device::DeviceType::CPU) {
-        CreateVertexMapCPU(src, dst, intrinsics_d, invalid_fill);
+        CreateVertexMapCPU(src_stack, dst_stack, intrinsics_d, invalid_fill);
     } else if (device.GetType() == core::Device::DeviceType::CUDA) {
-        CUDA_CALL(CreateVertexMapCUDA, src, dst, intrinsics_d, invalid_fill);
+        CUDA_CALL(CreateVertexMapCUDA, src_stack, dst_stack, intrinsics_d,
+                  invalid_fill);
     } else {
         utility::LogError("Unimplemented device");
     }
@@ -99,10 +140,12 @@ void CreateNormalMap(const core::Tensor &src,
                      core::Tensor &dst,
                      float invalid_fill) {
     core::Device device = src.GetDevice();
+    const core::Tensor src_stack = AsStack(src);
+    core::Tensor dst_stack = AsStack(dst);
     if (device.GetType() == core::Device::DeviceType::CPU) {
-        CreateNormalMapCPU(src, dst, invalid_fill);
+        CreateNormalMapCPU(src_stack, dst_stack, invalid_fill);
     } else if (device.GetType() == core::Device::DeviceType::CUDA) {
-        CUDA_CALL(CreateNormalMapCUDA, src, dst, invalid_fill);
+        CUDA_CALL(CreateNormalMapCUDA, src_stack, dst_stack, invalid_fill);
     } else {
         utility::LogError("Unimplemented device");
     }
@@ -123,6 +166,143 @@ void ColorizeDepth(const core::Tensor &src,
     }
 }
 
+void Filter(const core::Tensor &src,
+            core::Tensor &dst,
+            const core::Tensor &kernel) {
+    core::AssertTensorShape(kernel, {utility::nullopt, utility::nullopt});
+    core::Device device = src.GetDevice();
+    static const core::Device host("CPU:0");
+
+    // Rank-1 kernels (box, Gaussian, Sobel, ...) are applied as two 1D passes,
+    // which costs kh + kw instead of kh * kw operations per pixel.
+    const core::Tensor kernel_host =
+            kernel.To(host, core::Float32).Contiguous();
+    const int64_t kh = kernel.GetShape(0);
+    const int64_t kw = kernel.GetShape(1);
+    const float *k = kernel_host.GetDataPtr<float>();
+    int64_t i0 = 0, j0 = 0;
+    float k_max = 0;
+    for (int64_t i = 0; i < kh; ++i) {
+        for (int64_t j = 0; j < kw; ++j) {
+            if (std::abs(k[i * kw + j]) > k_max) {
+                k_max = std::abs(k[i * kw + j]);
+                i0 = i;
+                j0 = j;
+            }
+        }
+    }
+    std::vector<float> kernel_y(kh), kernel_x(kw);
+    bool separable = k_max > 0;
+    if (separable) {
+        for (int64_t i = 0; i < kh; ++i) {
+            kernel_y[i] = k[i * kw + j0];
+        }
+        for (int64_t j = 0; j < kw; ++j) {
+            kernel_x[j] = k[i0 * kw + j] / k[i0 * kw + j0];
+        }
+        for (int64_t i = 0; i < kh && separable; ++i) {
+            for (int64_t j = 0; j < kw && separable; ++j) {
+                separable = std::abs(k[i * kw + j] -
+                                     kernel_y[i] * kernel_x[j]) <=
+                            1e-6f * k_max;
+            }
+        }
+    }
+    if (separable) {
+        FilterSeparable(src, dst, core::Tensor(kernel_x, {kw}, core::Float32),
+                        core::Tensor(kernel_y, {kh}, core::Float32));
+        return;
+    }
+
+    const core::Tensor kernel_d = kernel_host.To(device);
+    if (device.GetType() == core::Device::DeviceType::CPU) {
+        FilterCPU(src, dst, kernel_d);
+    } else if (device.GetType() == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(FilterCUDA, src, dst, kernel_d);
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void FilterSeparable(const core::Tensor &src,
+                     core::Tensor &dst,
+                     const core::Tensor &kernel_x,
+                     const core::Tensor &kernel_y) {
+    core::AssertTensorShape(kernel_x, {utility::nullopt});
+    core::AssertTensorShape(kernel_y, {utility::nullopt});
+    core::Device device = src.GetDevice();
+
+    const core::Tensor kernel_x_d =
+            kernel_x.To(device, core::Float32).Contiguous();
+    const core::Tensor kernel_y_d =
+            kernel_y.To(device, core::Float32).Contiguous();
+    if (device.GetType() == core::Device::DeviceType::CPU) {
+        FilterSeparableCPU(src, dst, kernel_x_d, kernel_y_d);
+    } else if (device.GetType() == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(FilterSeparableCUDA, src, dst, kernel_x_d, kernel_y_d);
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void Remap(const core::Tensor &src,
+           core::Tensor &dst,
+           const core::Tensor &map_x,
+           const core::Tensor &map_y,
+           Image::InterpType interp_type,
+           float fill) {
+    if (interp_type != Image::InterpType::Nearest &&
+        interp_type != Image::InterpType::Linear) {
+        utility::LogError(
+                "Remap only supports Nearest and Linear interpolation.");
+    }
+    core::Device device = src.GetDevice();
+    core::AssertTensorShape(map_x, {utility::nullopt, utility::nullopt});
+    core::AssertTensorShape(map_y, map_x.GetShape());
+    core::AssertTensorShape(dst, {map_x.GetShape(0), map_x.GetShape(1),
+                                  src.GetShape(2)});
+
+    const core::Tensor map_x_d = map_x.To(device, core::Float32).Contiguous();
+    const core::Tensor map_y_d = map_y.To(device, core::Float32).Contiguous();
+    if (device.GetType() == core::Device::DeviceType::CPU) {
+        RemapCPU(src, dst, map_x_d, map_y_d, interp_type, fill);
+    } else if (device.GetType() == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(RemapCUDA, src, dst, map_x_d, map_y_d, interp_type, fill);
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void CreateUndistortionMaps(const core::Tensor &intrinsics,
+                            const core::Tensor &distortion,
+                            core::Tensor &map_x,
+                            core::Tensor &map_y) {
+    core::AssertTensorShape(intrinsics, {3, 3});
+    core::AssertTensorShape(distortion, {utility::nullopt});
+    const int64_t num_coeffs = distortion.GetLength();
+    if (num_coeffs != 4 && num_coeffs != 5) {
+        utility::LogError(
+                "Expected 4 or 5 distortion coefficients (k1, k2, p1, p2[, "
+                "k3]), but got {}.",
+                num_coeffs);
+    }
+    core::Device device = map_x.GetDevice();
+    static const core::Device host("CPU:0");
+
+    const core::Tensor intrinsics_d =
+            intrinsics.To(host, core::Float64).Contiguous();
+    core::Tensor distortion_d = core::Tensor::Zeros({5}, core::Float64, host);
+    distortion_d.Slice(0, 0, num_coeffs) = distortion.To(host, core::Float64);
+    if (device.GetType() == core::Device::DeviceType::CPU) {
+        CreateUndistortionMapsCPU(intrinsics_d, distortion_d, map_x, map_y);
+    } else if (device.GetType() == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(CreateUndistortionMapsCUDA, intrinsics_d, distortion_d,
+                  map_x, map_y);
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
 }  // namespace image
 }  // namespace kernel
 }  // namespace geometry
@@ -27,6 +27,7 @@
 #pragma once
 
 #include "open3d/core/Tensor.h"
+#include "open3d/t/geometry/Image.h"
 
 namespace open3d {
 namespace t {
@@ -46,6 +47,11 @@ void ClipTransform(const core::Tensor &src,
                    float max_value,
                    float clip_fill = 0.0f);
 
+// PyrDown, PyrDownDepth, CreateVertexMap and CreateNormalMap accept either a
+// single (rows, cols, channels) image or a (batch, rows, cols, channels)
+// stack, which is processed in a single kernel launch.
+void PyrDown(const core::Tensor &src, core::Tensor &dst);
+
 void PyrDownDepth(const core::Tensor &src,
                   core::Tensor &dst,
                   float diff_threshold,
@@ -66,6 +72,27 @@ void ColorizeDepth(const core::Tensor &src,
                    float min_value,
                    float max_value);
 
+void Filter(const core::Tensor &src,
+            core::Tensor &dst,
+            const core::Tensor &kernel);
+
+void FilterSeparable(const core::Tensor &src,
+                     core::Tensor &dst,
+                     const core::Tensor &kernel_x,
+                     const core::Tensor &kernel_y);
+
+void Remap(const core::Tensor &src,
+           core::Tensor &dst,
+           const core::Tensor &map_x,
+           const core::Tensor &map_y,
+           Image::InterpType interp_type,
+           float fill);
+
+void CreateUndistortionMaps(const core::Tensor &intrinsics,
+                            const core::Tensor &distortion,
+                            core::Tensor &map_x,
+                            core::Tensor &map_y);
+
 void ToCPU(const core::Tensor &src,
            core::Tensor &dst,
            double scale,
@@ -78,6 +105,8 @@ void ClipTransformCPU(const core::Tensor &src,
                       float max_value,
                       float clip_fill = 0.0f);
 
+void PyrDownCPU(const core::Tensor &src, core::Tensor &dst);
+
 void PyrDownDepthCPU(const core::Tensor &src,
                      core::Tensor &dst,
                      float diff_threshold,
@@ -98,6 +127,27 @@ void ColorizeDepthCPU(const core::Tensor &src,
                       float min_value,
                       float max_value);
 
+void FilterCPU(const core::Tensor &src,
+               core::Tensor &dst,
+               const core::Tensor &kernel);
+
+void FilterSeparableCPU(const core::Tensor &src,
+                        core::Tensor &dst,
+                        const core::Tensor &kernel_x,
+                        const core::Tensor &kernel_y);
+
+void RemapCPU(const core::Tensor &src,
+              core::Tensor &dst,
+              const core::Tensor &map_x,
+              const core::Tensor &map_y,
+              Image::InterpType interp_type,
+              float fill);
+
+void CreateUndistortionMapsCPU(const core::Tensor &intrinsics,
+                               const core::Tensor &distortion,
+                               core::Tensor &map_x,
+                               core::Tensor &map_y);
+
 #ifdef BUILD_CUDA_MODULE
 void ToCUDA(const core::Tensor &src,
             core::Tensor &dst,
@@ -111,6 +161,8 @@ void ClipTransformCUDA(const core::Tensor &src,
                        float max_value,
                        float clip_fill = 0.0f);
 
+void PyrDownCUDA(const core::Tensor &src, core::Tensor &dst);
+
 void PyrDownDepthCUDA(const core::Tensor &src,
                       core::Tensor &dst,
                       float diff_threshold,
@@ -131,6 +183,27 @@ void ColorizeDepthCUDA(const core::Tensor &src,
                        float min_value,
                        float max_value);
 
+void FilterCUDA(const core::Tensor &src,
+                core::Tensor &dst,
+                const core::Tensor &kernel);
+
+void FilterSeparableCUDA(const core::Tensor &src,
+                         core::Tensor &dst,
+                         const core::Tensor &kernel_x,
+                         const core::Tensor &kernel_y);
+
+void RemapCUDA(const core::Tensor &src,
+               core::Tensor &dst,
+               const core::Tensor &map_x,
+               const core::Tensor &map_y,
+               Image::InterpType interp_type,
+               float fill);
+
+void CreateUndistortionMapsCUDA(const core::Tensor &intrinsics,
+                                const core::Tensor &distortion,
+                                core::Tensor &map_x,
+                                core::Tensor &map_y);
+
 #endif
 }  // namespace image
 }  // namespace kernel
@@ -25,6 +25,7 @@
 // ----------------------------------------------------------------------------
 
 #include <limits>
+#include <type_traits>
 
 #include "open3d/core/CUDAUtils.h"
 #include "open3d/core/Dispatch.h"
@@ -32,6 +33,7 @@
 #include "open3d/core/Tensor.h"
 #include "open3d/t/geometry/kernel/GeometryIndexer.h"
 #include "open3d/t/geometry/kernel/GeometryMacros.h"
+#include "open3d/t/geometry/kernel/Image.h"
 
 namespace open3d {
 namespace t {
@@ -44,6 +46,23 @@ using std::isinf;
 using std::isnan;
 #endif
 
+/// Converts a filter response to the image dtype. Integer dtypes are rounded
+/// and saturated to [lo, hi], as done by IPP and NPP.
+template <typename scalar_t>
+OPEN3D_HOST_DEVICE inline scalar_t SaturateCast(float v, float lo, float hi) {
+    if (std::is_integral<scalar_t>::value) {
+        v = floorf(v + 0.5f);
+        v = v < lo ? lo : (v > hi ? hi : v);
+    }
+    return static_cast<scalar_t>(v);
+}
+
+template <typename scalar_t>
+void GetSaturationRange(float& lo, float& hi) {
+    lo = static_cast<float>(std::numeric_limits<scalar_t>::lowest());
+    hi = static_cast<float>(std::numeric_limits<scalar_t>::max());
+}
+
 #ifdef __CUDACC__
 void ToCUDA
 #else
@@ -146,15 +165,15 @@ void PyrDownDepthCPU
          core::Tensor& dst,
          float depth_diff,
          float invalid_fill) {
-    NDArrayIndexer src_indexer(src, 2);
-    NDArrayIndexer dst_indexer(dst, 2);
+    NDArrayIndexer src_indexer(src, 3);
+    NDArrayIndexer dst_indexer(dst, 3);
 
-    int rows = src_indexer.GetShape(0);
-    int cols = src_indexer.GetShape(1);
+    int rows = src_indexer.GetShape(1);
+    int cols = src_indexer.GetShape(2);
 
-    int rows_down = dst_indexer.GetShape(0);
-    int cols_down = dst_indexer.GetShape(1);
-    int n = rows_down * cols_down;
+    int rows_down = dst_indexer.GetShape(1);
+    int cols_down = dst_indexer.GetShape(2);
+    int64_t n = dst_indexer.GetShape(0) * rows_down * cols_down;
 
     // Gaussian filter window size
     // Gaussian filter weights
@@ -170,15 +189,17 @@ void PyrDownDepthCPU
 
     core::ParallelFor(
             src.GetDevice(), n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
-                int y = workload_idx / cols_down;
+                int64_t b = workload_idx / (rows_down * cols_down);
+                int y = (workload_idx / cols_down) % rows_down;
                 int x = workload_idx % cols_down;
 
                 int y_src = 2 * y;
                 int x_src = 2 * x;
 
-                float v_center = *src_indexer.GetDataPtr<float>(x_src, y_src);
+                float v_center =
+                        *src_indexer.GetDataPtr<float>(x_src, y_src, b);
                 if (v_center == invalid_fill) {
-                    *dst_indexer.GetDataPtr<float>(x, y) = invalid_fill;
+                    *dst_indexer.GetDataPtr<float>(x, y, b) = invalid_fill;
                     return;
                 }
 
@@ -192,7 +213,7 @@ void PyrDownDepthCPU
                 float w_sum = 0;
                 for (int yk = y_min; yk <= y_max; ++yk) {
                     for (int xk = x_min; xk <= x_max; ++xk) {
-                        float v = *src_indexer.GetDataPtr<float>(xk, yk);
+                        float v = *src_indexer.GetDataPtr<float>(xk, yk, b);
                         int dy = abs(yk - y_src);
                         int dx = abs(xk - x_src);
 
@@ -205,11 +226,62 @@ void PyrDownDepthCPU
                     }
                 }
 
-                *dst_indexer.GetDataPtr<float>(x, y) =
+                *dst_indexer.GetDataPtr<float>(x, y, b) =
                         w_sum == 0 ? invalid_fill : v_sum / w_sum;
             });
 }
 
+#ifdef __CUDACC__
+void PyrDownCUDA
+#else
+void PyrDownCPU
+#endif
+        (const core::Tensor& src, core::Tensor& dst) {
+    NDArrayIndexer src_indexer(src, 3);
+    NDArrayIndexer dst_indexer(dst, 3);
+
+    const int64_t rows = src_indexer.GetShape(1);
+    const int64_t cols = src_indexer.GetShape(2);
+    const int64_t channels = src.GetShape(3);
+    const int64_t rows_down = dst_indexer.GetShape(1);
+    const int64_t cols_down = dst_indexer.GetShape(2);
+    const int64_t n = dst_indexer.GetShape(0) * rows_down * cols_down;
+
+    // Gaussian filter (kernel_size = 5, sigma = 1) with replicated borders,
+    // evaluated at the even pixels only.
+    const float gweights[5] = {0.05448869f, 0.24420134f, 0.40261995f,
+                               0.24420134f, 0.05448869f};
+
+    DISPATCH_DTYPE_TO_TEMPLATE(src.GetDtype(), [&]() {
+        float lo, hi;
+        GetSaturationRange<scalar_t>(lo, hi);
+        core::ParallelFor(
+                src.GetDevice(), n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                    const int64_t b = workload_idx / (rows_down * cols_down);
+                    const int64_t y = (workload_idx / cols_down) % rows_down;
+                    const int64_t x = workload_idx % cols_down;
+
+                    scalar_t* out = dst_indexer.GetDataPtr<scalar_t>(x, y, b);
+                    for (int64_t k = 0; k < channels; ++k) {
+                        float sum = 0;
+                        for (int64_t i = 0; i < 5; ++i) {
+                            int64_t yi = 2 * y + i - 2;
+                            yi = yi < 0 ? 0 : (yi >= rows ? rows - 1 : yi);
+                            for (int64_t j = 0; j < 5; ++j) {
+                                int64_t xj = 2 * x + j - 2;
+                                xj = xj < 0 ? 0 : (xj >= cols ? cols - 1 : xj);
+                                sum += gweights[i] * gweights[j] *
+                                       static_cast<float>(
+                                               src_indexer.GetDataPtr<scalar_t>(
+                                                       xj, yi, b)[k]);
+                            }
+                        }
+                        out[k] = SaturateCast<scalar_t>(sum, lo, hi);
+                    }
+                });
+    });
+}
+
 #ifdef __CUDACC__
 void CreateVertexMapCUDA
 #else
@@ -219,14 +291,14 @@ void CreateVertexMapCPU
          core::Tensor& dst,
          const core::Tensor& intrinsics,
          float invalid_fill) {
-    NDArrayIndexer src_indexer(src, 2);
-    NDArrayIndexer dst_indexer(dst, 2);
-    TransformIndexer ti(intrinsics, core::Tensor::Eye(4, core::Float64,
-                                                      core::Device("CPU:0")));
+    NDArrayIndexer src_indexer(src, 3);
+    NDArrayIndexer dst_indexer(dst, 3);
+    // One (3, 3) pinhole matrix per image of the stack.
+    const double* K = intrinsics.GetDataPtr<double>();
 
-    int64_t rows = src.GetShape(0);
-    int64_t cols = src.GetShape(1);
-    int64_t n = rows * cols;
+    int64_t rows = src.GetShape(1);
+    int64_t cols = src.GetShape(2);
+    int64_t n = src.GetShape(0) * rows * cols;
 
 #ifndef __CUDACC__
     using std::isinf;
@@ -241,15 +313,18 @@ void CreateVertexMapCPU
                     return v == invalid_fill;
                 };
 
-                int64_t y = workload_idx / cols;
+                int64_t b = workload_idx / (rows * cols);
+                int64_t y = (workload_idx / cols) % rows;
                 int64_t x = workload_idx % cols;
 
-                float d = *src_indexer.GetDataPtr<float>(x, y);
+                float d = *src_indexer.GetDataPtr<float>(x, y, b);
 
-                float* vertex = dst_indexer.GetDataPtr<float>(x, y);
+                float* vertex = dst_indexer.GetDataPtr<float>(x, y, b);
                 if (!is_invalid(d)) {
-                    ti.Unproject(static_cast<float>(x), static_cast<float>(y),
-                                 d, vertex + 0, vertex + 1, vertex + 2);
+                    const double* K_b = K + 9 * b;
+                    vertex[0] = static_cast<float>((x - K_b[2]) * d / K_b[0]);
+                    vertex[1] = static_cast<float>((y - K_b[5]) * d / K_b[4]);
+                    vertex[2] = d;
                 } else {
                     vertex[0] = invalid_fill;
                     vertex[1] = invalid_fill;
@@ -263,24 +338,25 @@ void CreateNormalMapCUDA
 void CreateNormalMapCPU
 #endif
         (const core::Tensor& src, core::Tensor& dst, float invalid_fill) {
-    NDArrayIndexer src_indexer(src, 2);
-    NDArrayIndexer dst_indexer(dst, 2);
+    NDArrayIndexer src_indexer(src, 3);
+    NDArrayIndexer dst_indexer(dst, 3);
 
-    int64_t rows = src_indexer.GetShape(0);
-    int64_t cols = src_indexer.GetShape(1);
-    int64_t n = rows * cols;
+    int64_t rows = src_indexer.GetShape(1);
+    int64_t cols = src_indexer.GetShape(2);
+    int64_t n = src_indexer.GetShape(0) * rows * cols;
 
     core::ParallelFor(
             src.GetDevice(), n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
-                int64_t y = workload_idx / cols;
+                int64_t b = workload_idx / (rows * cols);
+                int64_t y = (workload_idx / cols) % rows;
                 int64_t x = workload_idx % cols;
 
-                float* normal = dst_indexer.GetDataPtr<float>(x, y);
+                float* normal = dst_indexer.GetDataPtr<float>(x, y, b);
 
                 if (y < rows - 1 && x < cols - 1) {
-                    float* v00 = src_indexer.GetDataPtr<float>(x, y);
-                    float* v10 = src_indexer.GetDataPtr<float>(x + 1, y);
-                    float* v01 = src_indexer.GetDataPtr<float>(x, y + 1);
+                    float* v00 = src_indexer.GetDataPtr<float>(x, y, b);
+                    float* v10 = src_indexer.GetDataPtr<float>(x + 1, y, b);
+                    float* v01 = src_indexer.GetDataPtr<float>(x, y + 1, b);
 
                     if ((v00[0] == invalid_fill && v00[1] == invalid_fill &&
                          v00[2] == invalid_fill) ||
@@ -362,6 +438,231 @@ void ColorizeDepthCPU
     });
 }
 
+#ifdef __CUDACC__
+void FilterCUDA
+#else
+void FilterCPU
+#endif
+        (const core::Tensor& src,
+         core::Tensor& dst,
+         const core::Tensor& kernel) {
+    NDArrayIndexer src_indexer(src, 2);
+    NDArrayIndexer dst_indexer(dst, 2);
+
+    const int64_t rows = src.GetShape(0);
+    const int64_t cols = src.GetShape(1);
+    const int64_t channels = src.GetShape(2);
+    const int64_t kh = kernel.GetShape(0);
+    const int64_t kw = kernel.GetShape(1);
+    const float* kernel_ptr = kernel.GetDataPtr<float>();
+
+    // Correlation with replicated borders, anchored at the kernel center.
+    DISPATCH_DTYPE_TO_TEMPLATE(src.GetDtype(), [&]() {
+        float lo, hi;
+        GetSaturationRange<scalar_t>(lo, hi);
+        core::ParallelFor(
+                src.GetDevice(), rows * cols * channels,
+                [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                    const int64_t k = workload_idx % channels;
+                    const int64_t x = (workload_idx / channels) % cols;
+                    const int64_t y = workload_idx / (channels * cols);
+
+                    float sum = 0;
+                    for (int64_t i = 0; i < kh; ++i) {
+                        int64_t yi = y + i - kh / 2;
+                        yi = yi < 0 ? 0 : (yi >= rows ? rows - 1 : yi);
+                        for (int64_t j = 0; j < kw; ++j) {
+                            int64_t xj = x + j - kw / 2;
+                            xj = xj < 0 ? 0 : (xj >= cols ? cols - 1 : xj);
+                            sum += kernel_ptr[i * kw + j] *
+                                   static_cast<float>(
+                                           src_indexer.GetDataPtr<scalar_t>(
+                                                   xj, yi)[k]);
+                        }
+                    }
+                    dst_indexer.GetDataPtr<scalar_t>(x, y)[k] =
+                            SaturateCast<scalar_t>(sum, lo, hi);
+                });
+    });
+}
+
+#ifdef __CUDACC__
+void FilterSeparableCUDA
+#else
+void FilterSeparableCPU
+#endif
+        (const core::Tensor& src,
+         core::Tensor& dst,
+         const core::Tensor& kernel_x,
+         const core::Tensor& kernel_y) {
+    const int64_t rows = src.GetShape(0);
+    const int64_t cols = src.GetShape(1);
+    const int64_t channels = src.GetShape(2);
+    const int64_t n = rows * cols * channels;
+    const int64_t kw = kernel_x.GetLength();
+    const int64_t kh = kernel_y.GetLength();
+    const float* kx_ptr = kernel_x.GetDataPtr<float>();
+    const float* ky_ptr = kernel_y.GetDataPtr<float>();
+
+    // The horizontal pass keeps full precision in a Float32 buffer, so the
+    // result only differs from the 2D kernel by floating point rounding.
+    core::Tensor buffer = core::Tensor::Empty({rows, cols, channels},
+                                              core::Float32, src.GetDevice());
+    float* buffer_ptr = buffer.GetDataPtr<float>();
+
+    NDArrayIndexer src_indexer(src, 2);
+    DISPATCH_DTYPE_TO_TEMPLATE(src.GetDtype(), [&]() {
+        core::ParallelFor(
+                src.GetDevice(), n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                    const int64_t k = workload_idx % channels;
+                    const int64_t x = (workload_idx / channels) % cols;
+                    const int64_t y = workload_idx / (channels * cols);
+
+                    float sum = 0;
+                    for (int64_t j = 0; j < kw; ++j) {
+                        int64_t xj = x + j - kw / 2;
+                        xj = xj < 0 ? 0 : (xj >= cols ? cols - 1 : xj);
+                        sum += kx_ptr[j] *
+                               static_cast<float>(
+                                       src_indexer.GetDataPtr<scalar_t>(xj,
+                                                                        y)[k]);
+                    }
+                    buffer_ptr[workload_idx] = sum;
+                });
+    });
+
+    NDArrayIndexer dst_indexer(dst, 2);
+    DISPATCH_DTYPE_TO_TEMPLATE(dst.GetDtype(), [&]() {
+        float lo, hi;
+        GetSaturationRange<scalar_t>(lo, hi);
+        core::ParallelFor(
+                src.GetDevice(), n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                    const int64_t k = workload_idx % channels;
+                    const int64_t x = (workload_idx / channels) % cols;
+                    const int64_t y = workload_idx / (channels * cols);
+
+                    float sum = 0;
+                    for (int64_t i = 0; i < kh; ++i) {
+                        int64_t yi = y + i - kh / 2;
+                        yi = yi < 0 ? 0 : (yi >= rows ? rows - 1 : yi);
+                        sum += ky_ptr[i] *
+                               buffer_ptr[(yi * cols + x) * channels + k];
+                    }
+                    dst_indexer.GetDataPtr<scalar_t>(x, y)[k] =
+                            SaturateCast<scalar_t>(sum, lo, hi);
+                });
+    });
+}
+
+#ifdef __CUDACC__
+void RemapCUDA
+#else
+void RemapCPU
+#endif
+        (const core::Tensor& src,
+         core::Tensor& dst,
+         const core::Tensor& map_x,
+         const core::Tensor& map_y,
+         Image::InterpType interp_type,
+         float fill) {
+    NDArrayIndexer src_indexer(src, 2);
+    NDArrayIndexer dst_indexer(dst, 2);
+
+    const int64_t rows = src.GetShape(0);
+    const int64_t cols = src.GetShape(1);
+    const int64_t channels = src.GetShape(2);
+    const int64_t cols_dst = dst.GetShape(1);
+    const int64_t n = dst.GetShape(0) * cols_dst;
+    const float* map_x_ptr = map_x.GetDataPtr<float>();
+    const float* map_y_ptr = map_y.GetDataPtr<float>();
+    const bool nearest = interp_type == Image::InterpType::Nearest;
+
+    DISPATCH_DTYPE_TO_TEMPLATE(src.GetDtype(), [&]() {
+        float lo, hi;
+        GetSaturationRange<scalar_t>(lo, hi);
+        core::ParallelFor(
+                src.GetDevice(), n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                    const int64_t x = workload_idx % cols_dst;
+                    const int64_t y = workload_idx / cols_dst;
+                    const float u = map_x_ptr[workload_idx];
+                    const float v = map_y_ptr[workload_idx];
+                    scalar_t* out = dst_indexer.GetDataPtr<scalar_t>(x, y);
+
+                    // Pixels outside of the image read the constant fill.
+                    auto sample = [&](int64_t ui, int64_t vi, int64_t k) {
+                        if (ui < 0 || ui >= cols || vi < 0 || vi >= rows) {
+                            return fill;
+                        }
+                        return static_cast<float>(
+                                src_indexer.GetDataPtr<scalar_t>(ui, vi)[k]);
+                    };
+
+                    if (nearest) {
+                        const int64_t ui =
+                                static_cast<int64_t>(floorf(u + 0.5f));
+                        const int64_t vi =
+                                static_cast<int64_t>(floorf(v + 0.5f));
+                        for (int64_t k = 0; k < channels; ++k) {
+                            out[k] = SaturateCast<scalar_t>(sample(ui, vi, k),
+                                                            lo, hi);
+                        }
+                        return;
+                    }
+
+                    const float u0f = floorf(u);
+                    const float v0f = floorf(v);
+                    const float wu = u - u0f;
+                    const float wv = v - v0f;
+                    const int64_t u0 = static_cast<int64_t>(u0f);
+                    const int64_t v0 = static_cast<int64_t>(v0f);
+                    for (int64_t k = 0; k < channels; ++k) {
+                        const float val =
+                                (1 - wv) * ((1 - wu) * sample(u0, v0, k) +
+                                            wu * sample(u0 + 1, v0, k)) +
+                                wv * ((1 - wu) * sample(u0, v0 + 1, k) +
+                                      wu * sample(u0 + 1, v0 + 1, k));
+                        out[k] = SaturateCast<scalar_t>(val, lo, hi);
+                    }
+                });
+    });
+}
+
+#ifdef __CUDACC__
+void CreateUndistortionMapsCUDA
+#else
+void CreateUndistortionMapsCPU
+#endif
+        (const core::Tensor& intrinsics,
+         const core::Tensor& distortion,
+         core::Tensor& map_x,
+         core::Tensor& map_y) {
+    const double* K = intrinsics.GetDataPtr<double>();
+    const double fx = K[0], fy = K[4], cx = K[2], cy = K[5];
+    const double* D = distortion.GetDataPtr<double>();
+    const double k1 = D[0], k2 = D[1], p1 = D[2], p2 = D[3], k3 = D[4];
+
+    const int64_t cols = map_x.GetShape(1);
+    const int64_t n = map_x.GetShape(0) * cols;
+    float* map_x_ptr = map_x.GetDataPtr<float>();
+    float* map_y_ptr = map_y.GetDataPtr<float>();
+
+    // Brown-Conrady model: for each pixel of the undistorted image, find the
+    // pixel of the distorted input it is sampled from.
+    core::ParallelFor(
+            map_x.GetDevice(), n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                const double x = (workload_idx % cols - cx) / fx;
+                const double y = (workload_idx / cols - cy) / fy;
+                const double r2 = x * x + y * y;
+                const double radial = 1 + r2 * (k1 + r2 * (k2 + r2 * k3));
+                const double xd =
+                        x * radial + 2 * p1 * x * y + p2 * (r2 + 2 * x * x);
+                const double yd =
+                        y * radial + p1 * (r2 + 2 * y * y) + 2 * p2 * x * y;
+                map_x_ptr[workload_idx] = static_cast<float>(fx * xd + cx);
+                map_y_ptr[workload_idx] = static_cast<float>(fy * yd + cy);
+            });
+}
+
 }  // namespace image
 }  // namespace kernel
 }  // namespace geometry
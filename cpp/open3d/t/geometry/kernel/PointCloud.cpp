@@ -26,11 +26,13 @@
 
 #include "open3d/t/geometry/kernel/PointCloud.h"
 
+#include <limits>
 #include <vector>
 
 #include "open3d/core/CUDAUtils.h"
 #include "open3d/core/ShapeUtil.h"
 #include "open3d/core/Tensor.h"
+#include "open3d/core/TensorCheck.h"
 #include "open3d/utility/Logging.h"
 
 namespace open3d {
@@ -79,6 +81,55 @@ void Unproject(const core::Tensor& depth,
     }
 }
 
+void UnprojectFiltered(
+        const core::Tensor& depth,
+        utility::optional<std::reference_wrapper<const core::Tensor>>
+                image_colors,
+        core::Tensor& points,
+        utility::optional<std::reference_wrapper<core::Tensor>> colors,
+        const core::Tensor& intrinsics,
+        const core::Tensor& extrinsics,
+        float depth_scale,
+        float depth_min,
+        float depth_max,
+        int64_t stride,
+        float depth_diff_max,
+        int64_t min_neighbors) {
+    if (image_colors.has_value() != colors.has_value()) {
+        utility::LogError(
+                "Both or none of image_colors and colors must have values.");
+    }
+    if (stride < 1) {
+        utility::LogError("stride must be positive, but got {}.", stride);
+    }
+
+    core::AssertTensorShape(intrinsics, {3, 3});
+    core::AssertTensorShape(extrinsics, {4, 4});
+
+    static const core::Device host("CPU:0");
+    core::Tensor intrinsics_d = intrinsics.To(host, core::Float64).Contiguous();
+    core::Tensor extrinsics_d = extrinsics.To(host, core::Float64).Contiguous();
+
+    const core::Device device = depth.GetDevice();
+
+    if (image_colors.has_value()) {
+        core::AssertTensorDevice(image_colors.value(), device);
+    }
+
+    const core::Device::DeviceType device_type = device.GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        UnprojectFilteredCPU(depth, image_colors, points, colors, intrinsics_d,
+                             extrinsics_d, depth_scale, depth_min, depth_max,
+                             stride, depth_diff_max, min_neighbors);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(UnprojectFilteredCUDA, depth, image_colors, points, colors,
+                  intrinsics_d, extrinsics_d, depth_scale, depth_min,
+                  depth_max, stride, depth_diff_max, min_neighbors);
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
 void Project(
         core::Tensor& depth,
         utility::optional<std::reference_wrapper<core::Tensor>> image_colors,
@@ -118,6 +169,159 @@ void Project(
     }
 }
 
+void ProjectMultiView(
+        core::Tensor& depth,
+        utility::optional<std::reference_wrapper<core::Tensor>> image_colors,
+        const core::Tensor& points,
+        utility::optional<std::reference_wrapper<const core::Tensor>> colors,
+        const core::Tensor& intrinsics,
+        const core::Tensor& extrinsics,
+        float depth_scale,
+        float depth_max) {
+    if (image_colors.has_value() != colors.has_value()) {
+        utility::LogError(
+                "Both or none of image_colors and colors must have values.");
+    }
+    if (depth_scale <= 0) {
+        utility::LogError("depth_scale must be positive, but got {}.",
+                          depth_scale);
+    }
+    const int64_t num_views = depth.GetShape(0);
+    core::AssertTensorShape(extrinsics, {num_views, 4, 4});
+    if (intrinsics.NumDims() == 2) {
+        core::AssertTensorShape(intrinsics, {3, 3});
+    } else {
+        core::AssertTensorShape(intrinsics, {num_views, 3, 3});
+    }
+    if (points.GetLength() >= std::numeric_limits<uint32_t>::max()) {
+        utility::LogError("Too many points ({}) for multi-view projection.",
+                          points.GetLength());
+    }
+
+    // Rows of the 3x4 extrinsics followed by fx, fy, cx, cy, per view.
+    static const core::Device host("CPU:0");
+    const core::Tensor intrinsics_d =
+            intrinsics.To(host, core::Float64).Contiguous();
+    const core::Tensor extrinsics_d =
+            extrinsics.To(host, core::Float64).Contiguous();
+    const double* intrinsics_ptr = intrinsics_d.GetDataPtr<double>();
+    const double* extrinsics_ptr = extrinsics_d.GetDataPtr<double>();
+    const int64_t intrinsics_stride = intrinsics.NumDims() == 2 ? 0 : 9;
+    std::vector<float> cameras(16 * num_views);
+    for (int64_t view = 0; view < num_views; ++view) {
+        float* camera = cameras.data() + 16 * view;
+        for (int k = 0; k < 12; ++k) {
+            camera[k] = static_cast<float>(extrinsics_ptr[16 * view + k]);
+        }
+        const double* K = intrinsics_ptr + intrinsics_stride * view;
+        camera[12] = static_cast<float>(K[0]);
+        camera[13] = static_cast<float>(K[4]);
+        camera[14] = static_cast<float>(K[2]);
+        camera[15] = static_cast<float>(K[5]);
+    }
+
+    const core::Device device = depth.GetDevice();
+    const core::Tensor cameras_t =
+            core::Tensor(cameras, {num_views, 16}, core::Float32, device);
+    if (image_colors.has_value()) {
+        core::AssertTensorDevice(image_colors.value(), device);
+    }
+
+    core::Device::DeviceType device_type = device.GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        ProjectMultiViewCPU(depth, image_colors, points, colors, cameras_t,
+                            depth_scale, depth_max);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(ProjectMultiViewCUDA, depth, image_colors, points, colors,
+                  cameras_t, depth_scale, depth_max);
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+core::Tensor FarthestPointDownSample(const core::Tensor& points,
+                                     int64_t num_samples) {
+    core::AssertTensorShape(points, {utility::nullopt, 3});
+    core::AssertTensorDtypes(points, {core::Float32, core::Float64});
+    if (num_samples < 0 || num_samples > points.GetLength()) {
+        utility::LogError(
+                "Illegal number of samples: {}, must <= point size: {}",
+                num_samples, points.GetLength());
+    }
+
+    const core::Device device = points.GetDevice();
+    core::Tensor indices =
+            core::Tensor::Empty({num_samples}, core::Int64, device);
+    if (num_samples == 0) {
+        return indices;
+    }
+    const core::Tensor points_contiguous = points.Contiguous();
+
+    const core::Device::DeviceType device_type = device.GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        FarthestPointDownSampleCPU(points_contiguous, num_samples, indices);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(FarthestPointDownSampleCUDA, points_contiguous, num_samples,
+                  indices);
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+    return indices;
+}
+
+core::Tensor ComputeMortonCodes(const core::Tensor& points) {
+    core::AssertTensorShape(points, {utility::nullopt, 3});
+    core::AssertTensorDtypes(points, {core::Float32, core::Float64});
+
+    const core::Device device = points.GetDevice();
+    const int64_t n = points.GetLength();
+    core::Tensor codes = core::Tensor::Empty({n}, core::Int64, device);
+    if (n == 0) {
+        return codes;
+    }
+
+    static const core::Device host("CPU:0");
+    const core::Tensor min_bound =
+            points.Min({0}).To(host, core::Float64).Contiguous();
+    const double extent =
+            (points.Max({0}).To(host, core::Float64) - min_bound)
+                    .Max({0})
+                    .Item<double>();
+    constexpr double kNumCells = 1 << 21;
+    const double cell_size = extent > 0 ? extent / kNumCells : 1.0;
+
+    const core::Tensor points_contiguous = points.Contiguous();
+    const core::Device::DeviceType device_type = device.GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        ComputeMortonCodesCPU(points_contiguous, min_bound, cell_size, codes);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(ComputeMortonCodesCUDA, points_contiguous, min_bound,
+                  cell_size, codes);
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+    return codes;
+}
+
+core::Tensor ComputePrincipalAxes(const core::Tensor& covariances) {
+    core::AssertTensorShape(covariances, {utility::nullopt, 3, 3});
+    core::AssertTensorDtype(covariances, core::Float64);
+
+    const core::Device device = covariances.GetDevice();
+    core::Tensor rotations = core::Tensor::Empty(
+            {covariances.GetLength(), 3, 3}, core::Float64, device);
+    const core::Tensor covariances_contiguous = covariances.Contiguous();
+    const core::Device::DeviceType device_type = device.GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        ComputePrincipalAxesCPU(covariances_contiguous, rotations);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(ComputePrincipalAxesCUDA, covariances_contiguous, rotations);
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+    return rotations;
+}
+
 }  // namespace pointcloud
 }  // namespace kernel
 }  // namespace geometry
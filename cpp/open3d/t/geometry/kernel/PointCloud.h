@@ -47,6 +47,26 @@ void Unproject(const core::Tensor& depth,
                float depth_max,
                int64_t stride);
 
+/// Unprojects the pixels of \p depth (every \p stride pixels) with a depth in
+/// (\p depth_min, \p depth_max) after scaling by 1 / \p depth_scale, in a
+/// fused pass that only allocates the kept points. If \p min_neighbors > 0,
+/// a pixel is also kept only if at least that many of its 8 full resolution
+/// neighbors have a valid depth within \p depth_diff_max of its own.
+void UnprojectFiltered(
+        const core::Tensor& depth,
+        utility::optional<std::reference_wrapper<const core::Tensor>>
+                image_colors,
+        core::Tensor& points,
+        utility::optional<std::reference_wrapper<core::Tensor>> colors,
+        const core::Tensor& intrinsics,
+        const core::Tensor& extrinsics,
+        float depth_scale,
+        float depth_min,
+        float depth_max,
+        int64_t stride,
+        float depth_diff_max,
+        int64_t min_neighbors);
+
 void Project(
         core::Tensor& depth,
         utility::optional<std::reference_wrapper<core::Tensor>> image_colors,
@@ -57,6 +77,37 @@ void Project(
         float depth_scale,
         float depth_max);
 
+/// Projects the Float32 \p points into the {V, H, W, 1} Float32 \p depth
+/// and, if given, the {V, H, W, 3} \p image_colors of V cameras in one pass.
+/// \p intrinsics is {3, 3}, shared by all the views, or {V, 3, 3}, and
+/// \p extrinsics is {V, 4, 4}. Each pixel takes the nearest point, with the
+/// same pixel assignment and depth values as Project.
+void ProjectMultiView(
+        core::Tensor& depth,
+        utility::optional<std::reference_wrapper<core::Tensor>> image_colors,
+        const core::Tensor& points,
+        utility::optional<std::reference_wrapper<const core::Tensor>> colors,
+        const core::Tensor& intrinsics,
+        const core::Tensor& extrinsics,
+        float depth_scale,
+        float depth_max);
+
+/// Selects \p num_samples points by farthest point sampling, starting from
+/// point 0, and returns their Int64 indices in selection order.
+core::Tensor FarthestPointDownSample(const core::Tensor& points,
+                                     int64_t num_samples);
+
+/// Returns the Int64 Morton (Z-order) code of each of the {N, 3} \p points.
+/// The bounding box of the points is quantized to a grid of 2^21 cells along
+/// its longest side, and the cell coordinates are bit-interleaved to 63 bits.
+core::Tensor ComputeMortonCodes(const core::Tensor& points);
+
+/// Returns the {C, 3, 3} Float64 rotations whose columns are the unit
+/// eigenvectors of the symmetric {C, 3, 3} Float64 \p covariances, sorted by
+/// decreasing eigenvalue. The third column is the cross product of the first
+/// two, as in the legacy OrientedBoundingBox::CreateFromPoints.
+core::Tensor ComputePrincipalAxes(const core::Tensor& covariances);
+
 void UnprojectCPU(
         const core::Tensor& depth,
         utility::optional<std::reference_wrapper<const core::Tensor>>
@@ -69,6 +120,21 @@ void UnprojectCPU(
         float depth_max,
         int64_t stride);
 
+void UnprojectFilteredCPU(
+        const core::Tensor& depth,
+        utility::optional<std::reference_wrapper<const core::Tensor>>
+                image_colors,
+        core::Tensor& points,
+        utility::optional<std::reference_wrapper<core::Tensor>> colors,
+        const core::Tensor& intrinsics,
+        const core::Tensor& extrinsics,
+        float depth_scale,
+        float depth_min,
+        float depth_max,
+        int64_t stride,
+        float depth_diff_max,
+        int64_t min_neighbors);
+
 void ProjectCPU(
         core::Tensor& depth,
         utility::optional<std::reference_wrapper<core::Tensor>> image_colors,
@@ -79,6 +145,27 @@ void ProjectCPU(
         float depth_scale,
         float depth_max);
 
+void ProjectMultiViewCPU(
+        core::Tensor& depth,
+        utility::optional<std::reference_wrapper<core::Tensor>> image_colors,
+        const core::Tensor& points,
+        utility::optional<std::reference_wrapper<const core::Tensor>> colors,
+        const core::Tensor& cameras,
+        float depth_scale,
+        float depth_max);
+
+void FarthestPointDownSampleCPU(const core::Tensor& points,
+                                int64_t num_samples,
+                                core::Tensor& indices);
+
+void ComputeMortonCodesCPU(const core::Tensor& points,
+                           const core::Tensor& min_bound,
+                           double cell_size,
+                           core::Tensor& codes);
+
+void ComputePrincipalAxesCPU(const core::Tensor& covariances,
+                             core::Tensor& rotations);
+
 #ifdef BUILD_CUDA_MODULE
 void UnprojectCUDA(
         const core::Tensor& depth,
@@ -92,6 +179,21 @@ void UnprojectCUDA(
         float depth_max,
         int64_t stride);
 
+void UnprojectFilteredCUDA(
+        const core::Tensor& depth,
+        utility::optional<std::reference_wrapper<const core::Tensor>>
+                image_colors,
+        core::Tensor& points,
+        utility::optional<std::reference_wrapper<core::Tensor>> colors,
+        const core::Tensor& intrinsics,
+        const core::Tensor& extrinsics,
+        float depth_scale,
+        float depth_min,
+        float depth_max,
+        int64_t stride,
+        float depth_diff_max,
+        int64_t min_neighbors);
+
 void ProjectCUDA(
         core::Tensor& depth,
         utility::optional<std::reference_wrapper<core::Tensor>> image_colors,
@@ -101,6 +203,27 @@ void ProjectCUDA(
         const core::Tensor& extrinsics,
         float depth_scale,
         float depth_max);
+
+void ProjectMultiViewCUDA(
+        core::Tensor& depth,
+        utility::optional<std::reference_wrapper<core::Tensor>> image_colors,
+        const core::Tensor& points,
+        utility::optional<std::reference_wrapper<const core::Tensor>> colors,
+        const core::Tensor& cameras,
+        float depth_scale,
+        float depth_max);
+
+void FarthestPointDownSampleCUDA(const core::Tensor& points,
+                                 int64_t num_samples,
+                                 core::Tensor& indices);
+
+void ComputeMortonCodesCUDA(const core::Tensor& points,
+                            const core::Tensor& min_bound,
+                            double cell_size,
+                            core::Tensor& codes);
+
+void ComputePrincipalAxesCUDA(const core::Tensor& covariances,
+                              core::Tensor& rotations);
 #endif
 
 void EstimateCovariancesUsingHybridSearchCPU(const core::Tensor& points,
@@ -116,6 +239,34 @@ void EstimateNormalsFromCovariancesCPU(const core::Tensor& covariances,
                                        core::Tensor& normals,
                                        const bool has_normals);
 
+void EstimateNormalsFromNeighborsCPU(const core::Tensor& points,
+                                     const core::Tensor& neighbor_indices,
+                                     const core::Tensor& neighbor_counts,
+                                     core::Tensor& normals,
+                                     const bool has_normals);
+
+void EstimateNormalsUsingHybridSearchCPU(const core::Tensor& points,
+                                         core::Tensor& normals,
+                                         const double& radius,
+                                         const int64_t& max_nn,
+                                         const bool has_normals);
+
+void EstimateNormalsUsingKNNSearchCPU(const core::Tensor& points,
+                                      core::Tensor& normals,
+                                      const int64_t& max_nn,
+                                      const bool has_normals);
+
+/// Estimates the normals of a batch of point clouds stored one after the other
+/// in \p points, with the Int64 CPU \p points_row_splits of the clouds. The
+/// neighbors of a point are searched in its own cloud only.
+void EstimateNormalsUsingBatchedHybridSearchCPU(
+        const core::Tensor& points,
+        const core::Tensor& points_row_splits,
+        core::Tensor& normals,
+        const double& radius,
+        const int64_t& max_nn,
+        const bool has_normals);
+
 void EstimateColorGradientsUsingHybridSearchCPU(const core::Tensor& points,
                                                 const core::Tensor& normals,
                                                 const core::Tensor& colors,
@@ -129,6 +280,27 @@ void EstimateColorGradientsUsingKNNSearchCPU(const core::Tensor& points,
                                              core::Tensor& color_gradient,
                                              const int64_t& max_nn);
 
+/// Computes the ISS saliency of each point, i.e. the smallest eigenvalue of
+/// the scatter matrix of its (at most \p max_nn) neighbors within \p radius.
+/// The saliency is 0 for points with fewer than \p min_neighbors neighbors or
+/// whose eigenvalue ratios are not below \p gamma_21 and \p gamma_32.
+void ComputeISSSaliencyCPU(const core::Tensor& points,
+                           core::Tensor& saliency,
+                           const double& radius,
+                           const int64_t& max_nn,
+                           const double& gamma_21,
+                           const double& gamma_32,
+                           const int64_t& min_neighbors);
+
+/// Sets \p mask for the points with a positive saliency that is maximal
+/// among their (at most \p max_nn) neighbors within \p radius.
+void ISSNonMaxSuppressionCPU(const core::Tensor& points,
+                             const core::Tensor& saliency,
+                             core::Tensor& mask,
+                             const double& radius,
+                             const int64_t& max_nn,
+                             const int64_t& min_neighbors);
+
 #ifdef BUILD_CUDA_MODULE
 void EstimateCovariancesUsingHybridSearchCUDA(const core::Tensor& points,
                                               core::Tensor& covariances,
@@ -143,6 +315,31 @@ void EstimateNormalsFromCovariancesCUDA(const core::Tensor& covariances,
                                         core::Tensor& normals,
                                         const bool has_normals);
 
+void EstimateNormalsFromNeighborsCUDA(const core::Tensor& points,
+                                      const core::Tensor& neighbor_indices,
+                                      const core::Tensor& neighbor_counts,
+                                      core::Tensor& normals,
+                                      const bool has_normals);
+
+void EstimateNormalsUsingHybridSearchCUDA(const core::Tensor& points,
+                                          core::Tensor& normals,
+                                          const double& radius,
+                                          const int64_t& max_nn,
+                                          const bool has_normals);
+
+void EstimateNormalsUsingKNNSearchCUDA(const core::Tensor& points,
+                                       core::Tensor& normals,
+                                       const int64_t& max_nn,
+                                       const bool has_normals);
+
+void EstimateNormalsUsingBatchedHybridSearchCUDA(
+        const core::Tensor& points,
+        const core::Tensor& points_row_splits,
+        core::Tensor& normals,
+        const double& radius,
+        const int64_t& max_nn,
+        const bool has_normals);
+
 void EstimateColorGradientsUsingHybridSearchCUDA(const core::Tensor& points,
                                                  const core::Tensor& normals,
                                                  const core::Tensor& colors,
@@ -155,6 +352,21 @@ void EstimateColorGradientsUsingKNNSearchCUDA(const core::Tensor& points,
                                               const core::Tensor& colors,
                                               core::Tensor& color_gradient,
                                               const int64_t& max_nn);
+
+void ComputeISSSaliencyCUDA(const core::Tensor& points,
+                            core::Tensor& saliency,
+                            const double& radius,
+                            const int64_t& max_nn,
+                            const double& gamma_21,
+                            const double& gamma_32,
+                            const int64_t& min_neighbors);
+
+void ISSNonMaxSuppressionCUDA(const core::Tensor& points,
+                              const core::Tensor& saliency,
+                              core::Tensor& mask,
+                              const double& radius,
+                              const int64_t& max_nn,
+                              const int64_t& min_neighbors);
 #endif
 
 }  // namespace pointcloud
@@ -24,7 +24,10 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <limits>
+
 #include "open3d/t/geometry/kernel/PointCloudImpl.h"
+#include "open3d/utility/Parallel.h"
 
 namespace open3d {
 namespace t {
@@ -99,6 +102,69 @@ void ProjectCPU(
     });
 }
 
+template <typename scalar_t>
+static void FarthestPointDownSampleCPUImpl(const scalar_t* points_ptr,
+                                           int64_t n,
+                                           int64_t num_samples,
+                                           int64_t* indices_ptr) {
+    // Each iteration updates the distances to the selected set block by block
+    // in parallel, and the farthest point is reduced from the block maxima.
+    const int64_t num_blocks =
+            std::min<int64_t>(n, 4 * utility::EstimateMaxThreads());
+    const int64_t block_size = (n + num_blocks - 1) / num_blocks;
+    std::vector<scalar_t> distances(n,
+                                    std::numeric_limits<scalar_t>::infinity());
+    std::vector<scalar_t> block_max(num_blocks);
+    std::vector<int64_t> block_argmax(num_blocks);
+
+    int64_t farthest = 0;
+    for (int64_t i = 0; i < num_samples; ++i) {
+        indices_ptr[i] = farthest;
+        const scalar_t x = points_ptr[3 * farthest + 0];
+        const scalar_t y = points_ptr[3 * farthest + 1];
+        const scalar_t z = points_ptr[3 * farthest + 2];
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+        for (int64_t b = 0; b < num_blocks; ++b) {
+            const int64_t end = std::min(n, (b + 1) * block_size);
+            scalar_t max_dist = -1;
+            int64_t argmax = 0;
+            for (int64_t j = b * block_size; j < end; ++j) {
+                const scalar_t dx = points_ptr[3 * j + 0] - x;
+                const scalar_t dy = points_ptr[3 * j + 1] - y;
+                const scalar_t dz = points_ptr[3 * j + 2] - z;
+                const scalar_t dist =
+                        std::min(distances[j], dx * dx + dy * dy + dz * dz);
+                distances[j] = dist;
+                if (dist > max_dist) {
+                    max_dist = dist;
+                    argmax = j;
+                }
+            }
+            block_max[b] = max_dist;
+            block_argmax[b] = argmax;
+        }
+        // Blocks are in index order, so ties resolve to the smallest index.
+        scalar_t max_dist = -1;
+        for (int64_t b = 0; b < num_blocks; ++b) {
+            if (block_max[b] > max_dist) {
+                max_dist = block_max[b];
+                farthest = block_argmax[b];
+            }
+        }
+    }
+}
+
+void FarthestPointDownSampleCPU(const core::Tensor& points,
+                                int64_t num_samples,
+                                core::Tensor& indices) {
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(points.GetDtype(), [&]() {
+        FarthestPointDownSampleCPUImpl<scalar_t>(
+                points.GetDataPtr<scalar_t>(), points.GetLength(),
+                num_samples, indices.GetDataPtr<int64_t>());
+    });
+}
+
 }  // namespace pointcloud
 }  // namespace kernel
 }  // namespace geometry
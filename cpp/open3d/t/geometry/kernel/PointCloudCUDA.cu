@@ -24,6 +24,10 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <limits>
+
+#include "open3d/ml/contrib/PointSampling.cuh"
+#include "open3d/ml/contrib/cuda_utils.h"
 #include "open3d/t/geometry/kernel/PointCloudImpl.h"
 
 namespace open3d {
@@ -116,6 +120,51 @@ void ProjectCUDA(
             });
 }
 
+void FarthestPointDownSampleCUDA(const core::Tensor& points,
+                                 int64_t num_samples,
+                                 core::Tensor& indices) {
+    // The PointNet++ sampling kernel works on float points with int indices.
+    const core::Device device = points.GetDevice();
+    const core::Tensor points_f = points.To(core::Float32).Contiguous();
+    core::Tensor temp =
+            core::Tensor::Full({points.GetLength()},
+                               std::numeric_limits<float>::infinity(),
+                               core::Float32, device);
+    core::Tensor indices_i =
+            core::Tensor::Empty({num_samples}, core::Int32, device);
+
+    const int n = static_cast<int>(points.GetLength());
+    const int m = static_cast<int>(num_samples);
+    const float* dataset = points_f.GetDataPtr<float>();
+    float* temp_ptr = temp.GetDataPtr<float>();
+    int* idxs = indices_i.GetDataPtr<int>();
+    const cudaStream_t stream = core::cuda::GetStream();
+    switch (ml::contrib::OptNumThreads(n)) {
+#define FPS_KERNEL_CASE(BLOCK_SIZE)                                         \
+    case BLOCK_SIZE:                                                        \
+        ml::contrib::furthest_point_sampling_kernel<BLOCK_SIZE>             \
+                <<<1, BLOCK_SIZE, 0, stream>>>(1, n, m, dataset, temp_ptr, \
+                                               idxs);                       \
+        break;
+        FPS_KERNEL_CASE(1024)
+        FPS_KERNEL_CASE(512)
+        FPS_KERNEL_CASE(256)
+        FPS_KERNEL_CASE(128)
+        FPS_KERNEL_CASE(64)
+        FPS_KERNEL_CASE(32)
+        FPS_KERNEL_CASE(16)
+        FPS_KERNEL_CASE(8)
+        FPS_KERNEL_CASE(4)
+        FPS_KERNEL_CASE(2)
+        FPS_KERNEL_CASE(1)
+#undef FPS_KERNEL_CASE
+        default:
+            utility::LogError("Unsupported number of threads.");
+    }
+    OPEN3D_CUDA_CHECK(cudaGetLastError());
+    indices.AsRvalue() = indices_i.To(core::Int64);
+}
+
 }  // namespace pointcloud
 }  // namespace kernel
 }  // namespace geometry
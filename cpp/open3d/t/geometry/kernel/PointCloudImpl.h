@@ -24,7 +24,10 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <algorithm>
 #include <atomic>
+#include <cstring>
+#include <limits>
 #include <vector>
 
 #include "open3d/core/CUDAUtils.h"
@@ -52,6 +55,7 @@ namespace pointcloud {
 using std::abs;
 using std::max;
 using std::min;
+using std::round;
 using std::sqrt;
 #endif
 
@@ -106,7 +110,7 @@ void UnprojectCPU
     int64_t n = rows_strided * cols_strided;
 
     DISPATCH_DTYPE_TO_TEMPLATE(depth.GetDtype(), [&]() {
-        core::ParallelFor(
+        core::ParallelForMultiISA(
                 depth.GetDevice(), n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
                     int64_t y = (workload_idx / cols_strided) * stride;
                     int64_t x = (workload_idx % cols_strided) * stride;
@@ -144,7 +148,7 @@ void UnprojectCPU
 #endif
 
 #ifdef __CUDACC__
-    core::cuda::Synchronize();
+    core::cuda::SynchronizeStream();
 #endif
     points = points.Slice(0, 0, total_pts_count);
     if (have_colors) {
@@ -153,6 +157,294 @@ void UnprojectCPU
     }
 }
 
+/// Z-buffer entry of no point.
+constexpr uint64_t kEmptyKey = std::numeric_limits<uint64_t>::max();
+
+#if defined(__CUDACC__)
+OPEN3D_DEVICE inline void AtomicMinUInt64(uint64_t* address, uint64_t value) {
+    atomicMin(reinterpret_cast<unsigned long long*>(address),
+              static_cast<unsigned long long>(value));
+}
+
+OPEN3D_DEVICE inline uint32_t FloatAsUInt32(float value) {
+    return __float_as_uint(value);
+}
+
+OPEN3D_DEVICE inline float UInt32AsFloat(uint32_t value) {
+    return __uint_as_float(value);
+}
+#else
+inline void AtomicMinUInt64(uint64_t* address, uint64_t value) {
+    static_assert(sizeof(std::atomic<uint64_t>) == sizeof(uint64_t),
+                  "std::atomic<uint64_t> must have the size of uint64_t.");
+    std::atomic<uint64_t>* atomic =
+            reinterpret_cast<std::atomic<uint64_t>*>(address);
+    uint64_t old = atomic->load();
+    while (value < old && !atomic->compare_exchange_weak(old, value)) {
+    }
+}
+
+inline uint32_t FloatAsUInt32(float value) {
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+inline float UInt32AsFloat(uint32_t value) {
+    float f;
+    std::memcpy(&f, &value, sizeof(f));
+    return f;
+}
+#endif
+
+#if defined(__CUDACC__)
+void ProjectMultiViewCUDA
+#else
+void ProjectMultiViewCPU
+#endif
+        (core::Tensor& depth,
+         utility::optional<std::reference_wrapper<core::Tensor>> image_colors,
+         const core::Tensor& points,
+         utility::optional<std::reference_wrapper<const core::Tensor>> colors,
+         const core::Tensor& cameras,
+         float depth_scale,
+         float depth_max) {
+    const bool has_colors = image_colors.has_value();
+    const core::Device device = depth.GetDevice();
+    const int64_t num_views = depth.GetShape(0);
+    const int64_t height = depth.GetShape(1);
+    const int64_t width = depth.GetShape(2);
+    const int64_t num_pixels = height * width;
+    const int64_t n = points.GetLength();
+
+    const float* points_ptr = points.GetDataPtr<float>();
+    const float* point_colors_ptr =
+            has_colors ? colors.value().get().GetDataPtr<float>() : nullptr;
+    const float* cameras_ptr = cameras.GetDataPtr<float>();
+
+    // Each entry packs the depth bits above the point index, so that the
+    // nearest point, and the smallest index among equally near points, wins
+    // a single atomic min. Non-negative floats order like their bits.
+    core::Tensor zbuffer = core::Tensor::Full({num_views, height, width},
+                                              kEmptyKey, core::UInt64, device);
+    uint64_t* zbuffer_ptr = zbuffer.GetDataPtr<uint64_t>();
+
+    // The points of a view are consecutive workloads, so the z-buffer writes
+    // of neighboring threads hit the same image.
+    core::ParallelFor(
+            device, num_views * n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                const int64_t view = workload_idx / n;
+                const int64_t i = workload_idx % n;
+                const float* camera = cameras_ptr + 16 * view;
+                const float x = points_ptr[3 * i + 0];
+                const float y = points_ptr[3 * i + 1];
+                const float z = points_ptr[3 * i + 2];
+
+                // Same arithmetic as TransformIndexer, for the same pixels
+                // as one view Project.
+                const float xc = x * camera[0] + y * camera[1] +
+                                 z * camera[2] + camera[3];
+                const float yc = x * camera[4] + y * camera[5] +
+                                 z * camera[6] + camera[7];
+                const float zc = x * camera[8] + y * camera[9] +
+                                 z * camera[10] + camera[11];
+                // Written to also reject NaN coordinates.
+                if (!(zc > 0 && zc <= depth_max)) return;
+                const float inv_z = 1.0f / zc;
+                const float u = round(camera[12] * xc * inv_z + camera[14]);
+                const float v = round(camera[13] * yc * inv_z + camera[15]);
+                if (!(u >= 0 && v >= 0 && u <= width - 1 && v <= height - 1)) {
+                    return;
+                }
+
+                const uint64_t key =
+                        (static_cast<uint64_t>(FloatAsUInt32(zc * depth_scale))
+                         << 32) |
+                        static_cast<uint64_t>(i);
+                AtomicMinUInt64(zbuffer_ptr + view * num_pixels +
+                                        static_cast<int64_t>(v) * width +
+                                        static_cast<int64_t>(u),
+                                key);
+            });
+
+    float* depth_ptr = depth.GetDataPtr<float>();
+    float* image_colors_ptr =
+            has_colors ? image_colors.value().get().GetDataPtr<float>()
+                       : nullptr;
+    core::ParallelFor(
+            device, num_views * num_pixels,
+            [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                const uint64_t key = zbuffer_ptr[workload_idx];
+                if (key == kEmptyKey) return;
+                depth_ptr[workload_idx] =
+                        UInt32AsFloat(static_cast<uint32_t>(key >> 32));
+                if (has_colors) {
+                    const int64_t i = static_cast<int64_t>(key & 0xffffffff);
+                    image_colors_ptr[3 * workload_idx + 0] =
+                            point_colors_ptr[3 * i + 0];
+                    image_colors_ptr[3 * workload_idx + 1] =
+                            point_colors_ptr[3 * i + 1];
+                    image_colors_ptr[3 * workload_idx + 2] =
+                            point_colors_ptr[3 * i + 2];
+                }
+            });
+
+    core::cuda::SynchronizeStream(device);
+}
+
+#if defined(__CUDACC__)
+void UnprojectFilteredCUDA
+#else
+void UnprojectFilteredCPU
+#endif
+        (const core::Tensor& depth,
+         utility::optional<std::reference_wrapper<const core::Tensor>>
+                 image_colors,
+         core::Tensor& points,
+         utility::optional<std::reference_wrapper<core::Tensor>> colors,
+         const core::Tensor& intrinsics,
+         const core::Tensor& extrinsics,
+         float depth_scale,
+         float depth_min,
+         float depth_max,
+         int64_t stride,
+         float depth_diff_max,
+         int64_t min_neighbors) {
+    const bool have_colors = image_colors.has_value();
+    const core::Device device = depth.GetDevice();
+    NDArrayIndexer depth_indexer(depth, 2);
+    NDArrayIndexer image_colors_indexer;
+    if (have_colors) {
+        image_colors_indexer = NDArrayIndexer(image_colors.value().get(), 2);
+    }
+
+    core::Tensor pose = t::geometry::InverseTransformation(extrinsics);
+    TransformIndexer ti(intrinsics, pose, 1.0f);
+
+    const int64_t cols_strided = depth_indexer.GetShape(1) / stride;
+    const int64_t n = (depth_indexer.GetShape(0) / stride) * cols_strided;
+    core::Tensor valid = core::Tensor::Empty({n}, core::Bool, device);
+    bool* valid_ptr = valid.GetDataPtr<bool>();
+
+    DISPATCH_DTYPE_TO_TEMPLATE(depth.GetDtype(), [&]() {
+        // Pass 1: the depth range and the number of consistent neighbors at
+        // full resolution, which rejects flying pixels at depth edges.
+        core::ParallelFor(device, n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+            const int64_t y = (workload_idx / cols_strided) * stride;
+            const int64_t x = (workload_idx % cols_strided) * stride;
+            const float d =
+                    *depth_indexer.GetDataPtr<scalar_t>(x, y) / depth_scale;
+            bool is_valid = d > depth_min && d < depth_max;
+            if (is_valid && min_neighbors > 0) {
+                int64_t count = 0;
+                for (int64_t dy = -1; dy <= 1; ++dy) {
+                    for (int64_t dx = -1; dx <= 1; ++dx) {
+                        if ((dx == 0 && dy == 0) ||
+                            !depth_indexer.InBoundary(x + dx, y + dy)) {
+                            continue;
+                        }
+                        const float d_neighbor =
+                                *depth_indexer.GetDataPtr<scalar_t>(x + dx,
+                                                                    y + dy) /
+                                depth_scale;
+                        if (d_neighbor > depth_min && d_neighbor < depth_max &&
+                            abs(d_neighbor - d) < depth_diff_max) {
+                            ++count;
+                        }
+                    }
+                }
+                is_valid = count >= min_neighbors;
+            }
+            valid_ptr[workload_idx] = is_valid;
+        });
+
+        // Pass 2: only the kept pixels are unprojected, in pixel order.
+        const core::Tensor indices = valid.NonZero().Reshape({-1});
+        const int64_t num_points = indices.GetLength();
+        const int64_t* indices_ptr = indices.GetDataPtr<int64_t>();
+        points = core::Tensor({num_points, 3}, core::Float32, device);
+        float* points_ptr = points.GetDataPtr<float>();
+        float* colors_ptr = nullptr;
+        if (have_colors) {
+            colors.value().get() =
+                    core::Tensor({num_points, 3}, core::Float32, device);
+            colors_ptr = colors.value().get().GetDataPtr<float>();
+        }
+        core::ParallelFor(
+                device, num_points, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                    const int64_t pixel = indices_ptr[workload_idx];
+                    const int64_t y = (pixel / cols_strided) * stride;
+                    const int64_t x = (pixel % cols_strided) * stride;
+                    const float d =
+                            *depth_indexer.GetDataPtr<scalar_t>(x, y) /
+                            depth_scale;
+
+                    float x_c = 0, y_c = 0, z_c = 0;
+                    ti.Unproject(static_cast<float>(x), static_cast<float>(y),
+                                 d, &x_c, &y_c, &z_c);
+                    float* vertex = points_ptr + 3 * workload_idx;
+                    ti.RigidTransform(x_c, y_c, z_c, vertex + 0, vertex + 1,
+                                      vertex + 2);
+                    if (have_colors) {
+                        const float* image_pixel =
+                                image_colors_indexer.GetDataPtr<float>(x, y);
+                        float* color = colors_ptr + 3 * workload_idx;
+                        color[0] = image_pixel[0];
+                        color[1] = image_pixel[1];
+                        color[2] = image_pixel[2];
+                    }
+                });
+    });
+}
+
+/// Spread the lower 21 bits of \p v so that there are two zero bits between
+/// consecutive bits.
+OPEN3D_HOST_DEVICE inline uint64_t SpreadBits3(uint64_t v) {
+    v &= 0x1fffff;
+    v = (v | v << 32) & 0x1f00000000ffff;
+    v = (v | v << 16) & 0x1f0000ff0000ff;
+    v = (v | v << 8) & 0x100f00f00f00f00f;
+    v = (v | v << 4) & 0x10c30c30c30c30c3;
+    v = (v | v << 2) & 0x1249249249249249;
+    return v;
+}
+
+#if defined(__CUDACC__)
+void ComputeMortonCodesCUDA
+#else
+void ComputeMortonCodesCPU
+#endif
+        (const core::Tensor& points,
+         const core::Tensor& min_bound,
+         double cell_size,
+         core::Tensor& codes) {
+    const double* min_bound_ptr = min_bound.GetDataPtr<double>();
+    const double min_x = min_bound_ptr[0];
+    const double min_y = min_bound_ptr[1];
+    const double min_z = min_bound_ptr[2];
+    const double inv_cell_size = 1.0 / cell_size;
+    int64_t* codes_ptr = codes.GetDataPtr<int64_t>();
+
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(points.GetDtype(), [&]() {
+        const scalar_t* points_ptr = points.GetDataPtr<scalar_t>();
+        core::ParallelFor(
+                points.GetDevice(), points.GetLength(),
+                [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                    const scalar_t* point = points_ptr + 3 * workload_idx;
+                    const double min_xyz[3] = {min_x, min_y, min_z};
+                    uint64_t code = 0;
+                    for (int i = 0; i < 3; ++i) {
+                        double cell = (point[i] - min_xyz[i]) * inv_cell_size;
+                        // Also maps NaN to cell 0.
+                        cell = cell > 0 ? cell : 0;
+                        cell = cell < 0x1fffff ? cell : 0x1fffff;
+                        code |= SpreadBits3(static_cast<uint64_t>(cell)) << i;
+                    }
+                    codes_ptr[workload_idx] = static_cast<int64_t>(code);
+                });
+    });
+}
+
 // This is a `two-pass` estimate method for covariance which is numerically more
 // robust than the `textbook` method generally used for covariance computation.
 template <typename scalar_t>
@@ -248,36 +540,46 @@ void EstimateCovariancesUsingHybridSearchCPU
         utility::LogError("Building FixedRadiusIndex failed.");
     }
 
-    core::Tensor indices, distance, counts;
-    std::tie(indices, distance, counts) =
-            tree.HybridSearch(points, radius, max_nn);
-
-    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(dtype, [&]() {
-        const scalar_t* points_ptr = points.GetDataPtr<scalar_t>();
-        int32_t* neighbour_indices_ptr = indices.GetDataPtr<int32_t>();
-        int32_t* neighbour_counts_ptr = counts.GetDataPtr<int32_t>();
-        scalar_t* covariances_ptr = covariances.GetDataPtr<scalar_t>();
-
-        core::ParallelFor(
-                points.GetDevice(), n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
-                    // NNS [Hybrid Search].
-                    const int32_t neighbour_offset = max_nn * workload_idx;
-                    // Count of valid correspondences per point.
-                    const int32_t neighbour_count =
-                            neighbour_counts_ptr[workload_idx];
-                    // Covariance is of shape {3, 3}, so it has an
-                    // offset factor of 9 x workload_idx.
-                    const int32_t covariances_offset = 9 * workload_idx;
-
-                    EstimatePointWiseRobustNormalizedCovarianceKernel(
-                            points_ptr,
-                            neighbour_indices_ptr + neighbour_offset,
-                            neighbour_count,
-                            covariances_ptr + covariances_offset);
-                });
-    });
+    // Search and accumulate in tiles of queries so that the neighbors of all
+    // points are never held in memory at the same time.
+    constexpr int64_t kTileSize = 1 << 18;
+    for (int64_t begin = 0; begin < n; begin += kTileSize) {
+        const int64_t end = std::min(begin + kTileSize, n);
+        core::Tensor indices, distance, counts;
+        std::tie(indices, distance, counts) = tree.HybridSearch(
+                points.Slice(0, begin, end), radius, max_nn);
+
+        DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(dtype, [&]() {
+            const scalar_t* points_ptr = points.GetDataPtr<scalar_t>();
+            int32_t* neighbour_indices_ptr = indices.GetDataPtr<int32_t>();
+            int32_t* neighbour_counts_ptr = counts.GetDataPtr<int32_t>();
+            // Covariance is of shape {3, 3}, so the tile starts at an
+            // offset of 9 x begin.
+            scalar_t* covariances_ptr =
+                    covariances.GetDataPtr<scalar_t>() + 9 * begin;
+
+            core::ParallelForMultiISA(
+                    points.GetDevice(), end - begin,
+                    [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                        // NNS [Hybrid Search].
+                        const int64_t neighbour_offset = max_nn * workload_idx;
+                        // Count of valid correspondences per point.
+                        const int32_t neighbour_count =
+                                neighbour_counts_ptr[workload_idx];
+                        // Covariance is of shape {3, 3}, so it has an
+                        // offset factor of 9 x workload_idx.
+                        const int64_t covariances_offset = 9 * workload_idx;
+
+                        EstimatePointWiseRobustNormalizedCovarianceKernel(
+                                points_ptr,
+                                neighbour_indices_ptr + neighbour_offset,
+                                neighbour_count,
+                                covariances_ptr + covariances_offset);
+                    });
+        });
+    }
 
-    core::cuda::Synchronize(points.GetDevice());
+    core::cuda::SynchronizeStream(points.GetDevice());
 }
 
 #if defined(__CUDACC__)
@@ -314,7 +616,7 @@ void EstimateCovariancesUsingKNNSearchCPU
         auto neighbour_indices_ptr = indices.GetDataPtr<int32_t>();
         auto covariances_ptr = covariances.GetDataPtr<scalar_t>();
 
-        core::ParallelFor(
+        core::ParallelForMultiISA(
                 points.GetDevice(), n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
                     // NNS [KNN Search].
                     const int32_t neighbour_offset = nn_count * workload_idx;
@@ -329,7 +631,7 @@ void EstimateCovariancesUsingKNNSearchCPU
                 });
     });
 
-    core::cuda::Synchronize(points.GetDevice());
+    core::cuda::SynchronizeStream(points.GetDevice());
 }
 
 template <typename scalar_t>
@@ -597,6 +899,41 @@ OPEN3D_HOST_DEVICE void EstimatePointWiseNormalsWithFastEigen3x3(
     }
 }
 
+// Estimates the normal of a point from its covariance, falling back to the
+// z-axis for degenerate neighborhoods and orienting it towards the previous
+// normal if \p has_normals is true.
+template <typename scalar_t>
+OPEN3D_HOST_DEVICE void EstimatePointWiseOrientedNormalKernel(
+        const scalar_t* covariance_ptr,
+        scalar_t* normal_ptr,
+        const bool has_normals) {
+    scalar_t normals_output[3] = {0};
+    EstimatePointWiseNormalsWithFastEigen3x3<scalar_t>(covariance_ptr,
+                                                       normals_output);
+
+    if ((normals_output[0] * normals_output[0] +
+         normals_output[1] * normals_output[1] +
+         normals_output[2] * normals_output[2]) == 0.0 &&
+        !has_normals) {
+        normals_output[0] = 0.0;
+        normals_output[1] = 0.0;
+        normals_output[2] = 1.0;
+    }
+    if (has_normals) {
+        if ((normal_ptr[0] * normals_output[0] +
+             normal_ptr[1] * normals_output[1] +
+             normal_ptr[2] * normals_output[2]) < 0.0) {
+            normals_output[0] *= -1;
+            normals_output[1] *= -1;
+            normals_output[2] *= -1;
+        }
+    }
+
+    normal_ptr[0] = normals_output[0];
+    normal_ptr[1] = normals_output[1];
+    normal_ptr[2] = normals_output[2];
+}
+
 #if defined(__CUDACC__)
 void EstimateNormalsFromCovariancesCUDA
 #else
@@ -612,43 +949,210 @@ void EstimateNormalsFromCovariancesCPU
         const scalar_t* covariances_ptr = covariances.GetDataPtr<scalar_t>();
         scalar_t* normals_ptr = normals.GetDataPtr<scalar_t>();
 
-        core::ParallelFor(
+        core::ParallelForMultiISA(
                 covariances.GetDevice(), n,
                 [=] OPEN3D_DEVICE(int64_t workload_idx) {
-                    int32_t covariances_offset = 9 * workload_idx;
-                    int32_t normals_offset = 3 * workload_idx;
-                    scalar_t normals_output[3] = {0};
-                    EstimatePointWiseNormalsWithFastEigen3x3<scalar_t>(
-                            covariances_ptr + covariances_offset,
-                            normals_output);
-
-                    if ((normals_output[0] * normals_output[0] +
-                         normals_output[1] * normals_output[1] +
-                         normals_output[2] * normals_output[2]) == 0.0 &&
-                        !has_normals) {
-                        normals_output[0] = 0.0;
-                        normals_output[1] = 0.0;
-                        normals_output[2] = 1.0;
-                    }
-                    if (has_normals) {
-                        if ((normals_ptr[normals_offset] * normals_output[0] +
-                             normals_ptr[normals_offset + 1] *
-                                     normals_output[1] +
-                             normals_ptr[normals_offset + 2] *
-                                     normals_output[2]) < 0.0) {
-                            normals_output[0] *= -1;
-                            normals_output[1] *= -1;
-                            normals_output[2] *= -1;
-                        }
-                    }
+                    EstimatePointWiseOrientedNormalKernel<scalar_t>(
+                            covariances_ptr + 9 * workload_idx,
+                            normals_ptr + 3 * workload_idx, has_normals);
+                });
+    });
+
+    core::cuda::SynchronizeStream(covariances.GetDevice());
+}
 
-                    normals_ptr[normals_offset] = normals_output[0];
-                    normals_ptr[normals_offset + 1] = normals_output[1];
-                    normals_ptr[normals_offset + 2] = normals_output[2];
+/// Normals of the rows of \p normals from the {rows, max_nn} Int32
+/// \p neighbor_indices into \p points and the {rows} Int32 \p neighbor_counts.
+/// The covariance of each point is only kept in registers between the
+/// neighbor traversal and the eigen solve.
+static void EstimateNormalsFromNeighborLists(
+        const core::Tensor& points,
+        const core::Tensor& neighbor_indices,
+        const core::Tensor& neighbor_counts,
+        core::Tensor& normals,
+        const bool has_normals) {
+    const int64_t max_nn = neighbor_indices.GetShape(1);
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(points.GetDtype(), [&]() {
+        const scalar_t* points_ptr = points.GetDataPtr<scalar_t>();
+        const int32_t* neighbor_indices_ptr =
+                neighbor_indices.GetDataPtr<int32_t>();
+        const int32_t* neighbor_counts_ptr =
+                neighbor_counts.GetDataPtr<int32_t>();
+        scalar_t* normals_ptr = normals.GetDataPtr<scalar_t>();
+
+        core::ParallelForMultiISA(
+                points.GetDevice(), normals.GetLength(),
+                [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                    scalar_t covariance[9];
+                    EstimatePointWiseRobustNormalizedCovarianceKernel(
+                            points_ptr,
+                            neighbor_indices_ptr + max_nn * workload_idx,
+                            neighbor_counts_ptr[workload_idx], covariance);
+                    EstimatePointWiseOrientedNormalKernel<scalar_t>(
+                            covariance, normals_ptr + 3 * workload_idx,
+                            has_normals);
                 });
     });
+}
+
+#if defined(__CUDACC__)
+void EstimateNormalsFromNeighborsCUDA
+#else
+void EstimateNormalsFromNeighborsCPU
+#endif
+        (const core::Tensor& points,
+         const core::Tensor& neighbor_indices,
+         const core::Tensor& neighbor_counts,
+         core::Tensor& normals,
+         const bool has_normals) {
+    EstimateNormalsFromNeighborLists(points, neighbor_indices, neighbor_counts,
+                                     normals, has_normals);
+    core::cuda::SynchronizeStream(points.GetDevice());
+}
+
+#if defined(__CUDACC__)
+void EstimateNormalsUsingHybridSearchCUDA
+#else
+void EstimateNormalsUsingHybridSearchCPU
+#endif
+        (const core::Tensor& points,
+         core::Tensor& normals,
+         const double& radius,
+         const int64_t& max_nn,
+         const bool has_normals) {
+    int64_t n = points.GetLength();
+
+    core::nns::NearestNeighborSearch tree(points, core::Int32);
+    bool check = tree.HybridIndex(radius);
+    if (!check) {
+        utility::LogError("Building FixedRadiusIndex failed.");
+    }
+
+    // Queries are processed in tiles to bound the size of the neighbor
+    // tensors.
+    constexpr int64_t kTileSize = 1 << 18;
+    for (int64_t begin = 0; begin < n; begin += kTileSize) {
+        const int64_t end = std::min(begin + kTileSize, n);
+        core::Tensor indices, distance, counts;
+        std::tie(indices, distance, counts) = tree.HybridSearch(
+                points.Slice(0, begin, end), radius, max_nn);
+
+        core::Tensor normals_tile = normals.Slice(0, begin, end);
+        EstimateNormalsFromNeighborLists(points, indices, counts, normals_tile,
+                                         has_normals);
+    }
+
+    core::cuda::SynchronizeStream(points.GetDevice());
+}
+
+#if defined(__CUDACC__)
+void EstimateNormalsUsingKNNSearchCUDA
+#else
+void EstimateNormalsUsingKNNSearchCPU
+#endif
+        (const core::Tensor& points,
+         core::Tensor& normals,
+         const int64_t& max_nn,
+         const bool has_normals) {
+    core::Dtype dtype = points.GetDtype();
+    int64_t n = points.GetLength();
+
+    core::nns::NearestNeighborSearch tree(points, core::Int32);
+    bool check = tree.KnnIndex();
+    if (!check) {
+        utility::LogError("Building KNN-Index failed.");
+    }
+
+    // Same as the hybrid search variant, the covariances are never written
+    // to memory.
+    constexpr int64_t kTileSize = 1 << 18;
+    for (int64_t begin = 0; begin < n; begin += kTileSize) {
+        const int64_t end = std::min(begin + kTileSize, n);
+        core::Tensor indices, distance;
+        std::tie(indices, distance) =
+                tree.KnnSearch(points.Slice(0, begin, end), max_nn);
+
+        indices = indices.Contiguous();
+        int32_t nn_count = static_cast<int32_t>(indices.GetShape()[1]);
+
+        if (nn_count < 3) {
+            utility::LogError(
+                    "Not enough neighbors to compute Covariances / Normals. "
+                    "Try increasing the max_nn parameter.");
+        }
 
-    core::cuda::Synchronize(covariances.GetDevice());
+        DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(dtype, [&]() {
+            const scalar_t* points_ptr = points.GetDataPtr<scalar_t>();
+            int32_t* neighbour_indices_ptr = indices.GetDataPtr<int32_t>();
+            scalar_t* normals_ptr =
+                    normals.GetDataPtr<scalar_t>() + 3 * begin;
+
+            core::ParallelFor(
+                    points.GetDevice(), end - begin,
+                    [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                        scalar_t covariance[9];
+                        EstimatePointWiseRobustNormalizedCovarianceKernel(
+                                points_ptr,
+                                neighbour_indices_ptr +
+                                        static_cast<int64_t>(nn_count) *
+                                                workload_idx,
+                                nn_count, covariance);
+                        EstimatePointWiseOrientedNormalKernel<scalar_t>(
+                                covariance, normals_ptr + 3 * workload_idx,
+                                has_normals);
+                    });
+        });
+    }
+
+    core::cuda::SynchronizeStream(points.GetDevice());
+}
+
+#if defined(__CUDACC__)
+void EstimateNormalsUsingBatchedHybridSearchCUDA
+#else
+void EstimateNormalsUsingBatchedHybridSearchCPU
+#endif
+        (const core::Tensor& points,
+         const core::Tensor& points_row_splits,
+         core::Tensor& normals,
+         const double& radius,
+         const int64_t& max_nn,
+         const bool has_normals) {
+    core::Dtype dtype = points.GetDtype();
+    int64_t n = points.GetLength();
+    const int64_t num_batches = points_row_splits.GetLength() - 1;
+
+    // One hash grid over all clouds. The grid keeps the cells of each cloud
+    // apart, so neighbors never cross clouds and the indices are global.
+    core::nns::FixedRadiusIndex index;
+    if (!index.SetTensorData(points, points_row_splits, radius, core::Int32)) {
+        utility::LogError("Building FixedRadiusIndex failed.");
+    }
+
+    const int64_t* splits_ptr = points_row_splits.GetDataPtr<int64_t>();
+    constexpr int64_t kTileSize = 1 << 18;
+    for (int64_t begin = 0; begin < n; begin += kTileSize) {
+        const int64_t end = std::min(begin + kTileSize, n);
+
+        // Row splits of the queries of the tile, relative to its start.
+        core::Tensor queries_row_splits({num_batches + 1}, core::Int64);
+        int64_t* queries_splits_ptr = queries_row_splits.GetDataPtr<int64_t>();
+        for (int64_t i = 0; i <= num_batches; ++i) {
+            queries_splits_ptr[i] =
+                    std::min(std::max(splits_ptr[i], begin), end) - begin;
+        }
+
+        core::Tensor indices, distance, counts;
+        std::tie(indices, distance, counts) =
+                index.SearchHybrid(points.Slice(0, begin, end),
+                                   queries_row_splits, radius, max_nn);
+
+        core::Tensor normals_tile = normals.Slice(0, begin, end);
+        EstimateNormalsFromNeighborLists(points, indices, counts, normals_tile,
+                                         has_normals);
+    }
+
+    core::cuda::SynchronizeStream(points.GetDevice());
 }
 
 template <typename scalar_t>
@@ -785,7 +1289,7 @@ void EstimateColorGradientsUsingHybridSearchCPU
         auto neighbour_counts_ptr = counts.GetDataPtr<int32_t>();
         auto color_gradients_ptr = color_gradients.GetDataPtr<scalar_t>();
 
-        core::ParallelFor(
+        core::ParallelForMultiISA(
                 points.GetDevice(), n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
                     // NNS [Hybrid Search].
                     int32_t neighbour_offset = max_nn * workload_idx;
@@ -801,7 +1305,7 @@ void EstimateColorGradientsUsingHybridSearchCPU
                 });
     });
 
-    core::cuda::Synchronize(points.GetDevice());
+    core::cuda::SynchronizeStream(points.GetDevice());
 }
 
 #if defined(__CUDACC__)
@@ -843,7 +1347,7 @@ void EstimateColorGradientsUsingKNNSearchCPU
         auto neighbour_indices_ptr = indices.GetDataPtr<int32_t>();
         auto color_gradients_ptr = color_gradients.GetDataPtr<scalar_t>();
 
-        core::ParallelFor(
+        core::ParallelForMultiISA(
                 points.GetDevice(), n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
                     int32_t neighbour_offset = max_nn * workload_idx;
                     int32_t idx_offset = 3 * workload_idx;
@@ -855,7 +1359,261 @@ void EstimateColorGradientsUsingKNNSearchCPU
                 });
     });
 
-    core::cuda::Synchronize(points.GetDevice());
+    core::cuda::SynchronizeStream(points.GetDevice());
+}
+
+// Computes the eigenvalues of the symmetric 3x3 matrix A in ascending order,
+// with the closed form used in EstimatePointWiseNormalsWithFastEigen3x3.
+template <typename scalar_t>
+OPEN3D_HOST_DEVICE void ComputeEigenvalues3x3(const scalar_t* A_ptr,
+                                              double* eval) {
+    double max_coeff = 0;
+    for (int i = 0; i < 9; ++i) {
+        max_coeff = max(max_coeff, abs(static_cast<double>(A_ptr[i])));
+    }
+    if (max_coeff == 0) {
+        eval[0] = eval[1] = eval[2] = 0;
+        return;
+    }
+
+    double A[9];
+    for (int i = 0; i < 9; ++i) {
+        A[i] = A_ptr[i] / max_coeff;
+    }
+
+    const double norm = A[1] * A[1] + A[2] * A[2] + A[5] * A[5];
+    if (norm > 0) {
+        const double q = (A[0] + A[4] + A[8]) / 3.0;
+        const double b00 = A[0] - q;
+        const double b11 = A[4] - q;
+        const double b22 = A[8] - q;
+        const double p =
+                sqrt((b00 * b00 + b11 * b11 + b22 * b22 + norm * 2.0) / 6.0);
+        const double c00 = b11 * b22 - A[5] * A[5];
+        const double c01 = A[1] * b22 - A[5] * A[2];
+        const double c02 = A[1] * A[5] - b11 * A[2];
+        const double det = (b00 * c00 - A[1] * c01 + A[2] * c02) / (p * p * p);
+        const double half_det = min(max(det * 0.5, -1.0), 1.0);
+        const double angle = acos(half_det) / 3.0;
+        const double two_thirds_pi = 2.09439510239319549;
+        const double beta2 = cos(angle) * 2.0;
+        const double beta0 = cos(angle + two_thirds_pi) * 2.0;
+        const double beta1 = -(beta0 + beta2);
+        eval[0] = (q + p * beta0) * max_coeff;
+        eval[1] = (q + p * beta1) * max_coeff;
+        eval[2] = (q + p * beta2) * max_coeff;
+    } else {
+        // The matrix is diagonal.
+        eval[0] = A[0] * max_coeff;
+        eval[1] = A[4] * max_coeff;
+        eval[2] = A[8] * max_coeff;
+        for (int i = 0; i < 2; ++i) {
+            for (int j = 0; j < 2 - i; ++j) {
+                if (eval[j] > eval[j + 1]) {
+                    const double tmp = eval[j];
+                    eval[j] = eval[j + 1];
+                    eval[j + 1] = tmp;
+                }
+            }
+        }
+    }
+}
+
+#if defined(__CUDACC__)
+void ComputeISSSaliencyCUDA
+#else
+void ComputeISSSaliencyCPU
+#endif
+        (const core::Tensor& points,
+         core::Tensor& saliency,
+         const double& radius,
+         const int64_t& max_nn,
+         const double& gamma_21,
+         const double& gamma_32,
+         const int64_t& min_neighbors) {
+    core::Dtype dtype = points.GetDtype();
+
+    core::nns::NearestNeighborSearch tree(points, core::Int32);
+    bool check = tree.HybridIndex(radius);
+    if (!check) {
+        utility::LogError("Building HybridIndex failed.");
+    }
+
+    // The scatter matrix and its eigenvalues are computed per point inside the
+    // kernel, one tile of queries at a time.
+    const int64_t n = points.GetLength();
+    constexpr int64_t kTileSize = 1 << 18;
+    for (int64_t begin = 0; begin < n; begin += kTileSize) {
+        const int64_t end = std::min(begin + kTileSize, n);
+        core::Tensor indices, distance, counts;
+        std::tie(indices, distance, counts) = tree.HybridSearch(
+                points.Slice(0, begin, end), radius, max_nn);
+
+        DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(dtype, [&]() {
+            const scalar_t* points_ptr = points.GetDataPtr<scalar_t>();
+            const int32_t* neighbour_indices_ptr =
+                    indices.GetDataPtr<int32_t>();
+            const int32_t* neighbour_counts_ptr = counts.GetDataPtr<int32_t>();
+            scalar_t* saliency_ptr = saliency.GetDataPtr<scalar_t>() + begin;
+
+            core::ParallelFor(
+                    points.GetDevice(), end - begin,
+                    [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                        const int32_t neighbour_count =
+                                neighbour_counts_ptr[workload_idx];
+                        saliency_ptr[workload_idx] = 0;
+                        if (neighbour_count < min_neighbors) {
+                            return;
+                        }
+
+                        scalar_t covariance[9];
+                        EstimatePointWiseRobustNormalizedCovarianceKernel(
+                                points_ptr,
+                                neighbour_indices_ptr + max_nn * workload_idx,
+                                neighbour_count, covariance);
+                        double eval[3];
+                        ComputeEigenvalues3x3(covariance, eval);
+
+                        // eval[2] >= eval[1] >= eval[0]. The saliency is the
+                        // smallest eigenvalue of the scatter matrix divided by
+                        // n, as in the legacy ComputeISSKeypoints.
+                        if (eval[1] / eval[2] < gamma_21 &&
+                            eval[0] / eval[1] < gamma_32) {
+                            saliency_ptr[workload_idx] =
+                                    static_cast<scalar_t>(
+                                            eval[0] * (neighbour_count - 1) /
+                                            neighbour_count);
+                        }
+                    });
+        });
+    }
+
+    core::cuda::SynchronizeStream(points.GetDevice());
+}
+
+#if defined(__CUDACC__)
+void ComputePrincipalAxesCUDA
+#else
+void ComputePrincipalAxesCPU
+#endif
+        (const core::Tensor& covariances, core::Tensor& rotations) {
+    const double* covariances_ptr = covariances.GetDataPtr<double>();
+    double* rotations_ptr = rotations.GetDataPtr<double>();
+    core::ParallelFor(
+            covariances.GetDevice(), covariances.GetLength(),
+            [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                const double* covariance = covariances_ptr + 9 * workload_idx;
+                double* R = rotations_ptr + 9 * workload_idx;
+                double max_coeff = 0;
+                for (int i = 0; i < 9; ++i) {
+                    max_coeff = max(max_coeff, abs(covariance[i]));
+                }
+                double A[9];
+                for (int i = 0; i < 9; ++i) {
+                    A[i] = max_coeff > 0 ? covariance[i] / max_coeff : 0;
+                }
+
+                // Eigenvectors of decreasing eigenvalue.
+                double evec[3][3] = {{1, 0, 0}, {0, 1, 0}, {0, 0, 1}};
+                if (A[1] * A[1] + A[2] * A[2] + A[5] * A[5] > 0) {
+                    double eval[3];
+                    ComputeEigenvalues3x3(A, eval);
+                    // The eigenvector of the most separated eigenvalue is
+                    // computed first, the others are orthogonal to it.
+                    if (eval[2] - eval[1] >= eval[1] - eval[0]) {
+                        ComputeEigenvector0<double>(A, eval[2], evec[0]);
+                        ComputeEigenvector1<double>(A, evec[0], eval[1],
+                                                    evec[1]);
+                    } else {
+                        ComputeEigenvector0<double>(A, eval[0], evec[2]);
+                        ComputeEigenvector1<double>(A, evec[2], eval[1],
+                                                    evec[1]);
+                        core::linalg::kernel::cross_3x1(evec[1], evec[2],
+                                                        evec[0]);
+                    }
+                } else {
+                    // The matrix is diagonal, the eigenvectors are the axes
+                    // sorted by their diagonal element.
+                    int axes[3] = {0, 1, 2};
+                    for (int i = 0; i < 2; ++i) {
+                        for (int j = 0; j < 2 - i; ++j) {
+                            if (A[4 * axes[j]] < A[4 * axes[j + 1]]) {
+                                const int tmp = axes[j];
+                                axes[j] = axes[j + 1];
+                                axes[j + 1] = tmp;
+                            }
+                        }
+                    }
+                    for (int i = 0; i < 3; ++i) {
+                        for (int j = 0; j < 3; ++j) {
+                            evec[i][j] = axes[i] == j ? 1 : 0;
+                        }
+                    }
+                }
+                core::linalg::kernel::cross_3x1(evec[0], evec[1], evec[2]);
+                for (int i = 0; i < 3; ++i) {
+                    for (int j = 0; j < 3; ++j) {
+                        R[3 * i + j] = evec[j][i];
+                    }
+                }
+            });
+}
+
+#if defined(__CUDACC__)
+void ISSNonMaxSuppressionCUDA
+#else
+void ISSNonMaxSuppressionCPU
+#endif
+        (const core::Tensor& points,
+         const core::Tensor& saliency,
+         core::Tensor& mask,
+         const double& radius,
+         const int64_t& max_nn,
+         const int64_t& min_neighbors) {
+    core::Dtype dtype = points.GetDtype();
+
+    core::nns::NearestNeighborSearch tree(points, core::Int32);
+    bool check = tree.HybridIndex(radius);
+    if (!check) {
+        utility::LogError("Building HybridIndex failed.");
+    }
+
+    const int64_t n = points.GetLength();
+    constexpr int64_t kTileSize = 1 << 18;
+    for (int64_t begin = 0; begin < n; begin += kTileSize) {
+        const int64_t end = std::min(begin + kTileSize, n);
+        core::Tensor indices, distance, counts;
+        std::tie(indices, distance, counts) = tree.HybridSearch(
+                points.Slice(0, begin, end), radius, max_nn);
+
+        DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(dtype, [&]() {
+            const scalar_t* saliency_ptr = saliency.GetDataPtr<scalar_t>();
+            const int32_t* neighbour_indices_ptr =
+                    indices.GetDataPtr<int32_t>();
+            const int32_t* neighbour_counts_ptr = counts.GetDataPtr<int32_t>();
+            bool* mask_ptr = mask.GetDataPtr<bool>() + begin;
+
+            core::ParallelFor(
+                    points.GetDevice(), end - begin,
+                    [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                        const int32_t neighbour_count =
+                                neighbour_counts_ptr[workload_idx];
+                        const scalar_t value =
+                                saliency_ptr[begin + workload_idx];
+                        const int32_t* neighbours =
+                                neighbour_indices_ptr + max_nn * workload_idx;
+                        bool is_maximum =
+                                value > 0 && neighbour_count >= min_neighbors;
+                        for (int32_t i = 0; is_maximum && i < neighbour_count;
+                             ++i) {
+                            is_maximum = value >= saliency_ptr[neighbours[i]];
+                        }
+                        mask_ptr[workload_idx] = is_maximum;
+                    });
+        });
+    }
+
+    core::cuda::SynchronizeStream(points.GetDevice());
 }
 
 }  // namespace pointcloud
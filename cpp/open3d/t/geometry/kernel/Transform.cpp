@@ -127,6 +127,139 @@ void RotateNormals(const core::Tensor& R, core::Tensor& normals) {
     normals = normals_contiguous;
 }
 
+void TransformCovariances(const core::Tensor& transformation,
+                          core::Tensor& covariances) {
+    core::AssertTensorShape(covariances, {utility::nullopt, 3, 3});
+    core::AssertTensorShape(transformation, {4, 4});
+
+    core::Tensor covariances_contiguous = covariances.Contiguous();
+    core::Tensor transformation_contiguous =
+            transformation.To(covariances.GetDevice(), covariances.GetDtype())
+                    .Contiguous();
+
+    core::Device::DeviceType device_type = covariances.GetDevice().GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        TransformCovariancesCPU(transformation_contiguous,
+                                covariances_contiguous);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(TransformCovariancesCUDA, transformation_contiguous,
+                  covariances_contiguous);
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+
+    covariances = covariances_contiguous;
+}
+
+void RotateCovariances(const core::Tensor& R, core::Tensor& covariances) {
+    core::AssertTensorShape(covariances, {utility::nullopt, 3, 3});
+    core::AssertTensorShape(R, {3, 3});
+
+    core::Tensor covariances_contiguous = covariances.Contiguous();
+    core::Tensor R_contiguous =
+            R.To(covariances.GetDevice(), covariances.GetDtype()).Contiguous();
+
+    core::Device::DeviceType device_type = covariances.GetDevice().GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        RotateCovariancesCPU(R_contiguous, covariances_contiguous);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(RotateCovariancesCUDA, R_contiguous, covariances_contiguous);
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+
+    covariances = covariances_contiguous;
+}
+
+void TransformPointsBatched(const core::Tensor& transformations,
+                            const core::Tensor& batch_indices,
+                            core::Tensor& points) {
+    core::AssertTensorShape(points, {utility::nullopt, 3});
+    core::AssertTensorShape(transformations, {utility::nullopt, 4, 4});
+    core::AssertTensorShape(batch_indices, {points.GetLength()});
+    core::AssertTensorDtype(batch_indices, core::Int64);
+    core::AssertTensorDevice(batch_indices, points.GetDevice());
+
+    core::Tensor points_contiguous = points.Contiguous();
+    core::Tensor transformations_contiguous =
+            transformations.To(points.GetDevice(), points.GetDtype())
+                    .Contiguous();
+    core::Tensor batch_indices_contiguous = batch_indices.Contiguous();
+
+    core::Device::DeviceType device_type = points.GetDevice().GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        TransformPointsBatchedCPU(transformations_contiguous,
+                                  batch_indices_contiguous, points_contiguous);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(TransformPointsBatchedCUDA, transformations_contiguous,
+                  batch_indices_contiguous, points_contiguous);
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+
+    points = points_contiguous;
+}
+
+void TransformNormalsBatched(const core::Tensor& transformations,
+                             const core::Tensor& batch_indices,
+                             core::Tensor& normals) {
+    core::AssertTensorShape(normals, {utility::nullopt, 3});
+    core::AssertTensorShape(transformations, {utility::nullopt, 4, 4});
+    core::AssertTensorShape(batch_indices, {normals.GetLength()});
+    core::AssertTensorDtype(batch_indices, core::Int64);
+    core::AssertTensorDevice(batch_indices, normals.GetDevice());
+
+    core::Tensor normals_contiguous = normals.Contiguous();
+    core::Tensor transformations_contiguous =
+            transformations.To(normals.GetDevice(), normals.GetDtype())
+                    .Contiguous();
+    core::Tensor batch_indices_contiguous = batch_indices.Contiguous();
+
+    core::Device::DeviceType device_type = normals.GetDevice().GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        TransformNormalsBatchedCPU(transformations_contiguous,
+                                   batch_indices_contiguous,
+                                   normals_contiguous);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(TransformNormalsBatchedCUDA, transformations_contiguous,
+                  batch_indices_contiguous, normals_contiguous);
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+
+    normals = normals_contiguous;
+}
+
+void TransformCovariancesBatched(const core::Tensor& transformations,
+                                 const core::Tensor& batch_indices,
+                                 core::Tensor& covariances) {
+    core::AssertTensorShape(covariances, {utility::nullopt, 3, 3});
+    core::AssertTensorShape(transformations, {utility::nullopt, 4, 4});
+    core::AssertTensorShape(batch_indices, {covariances.GetLength()});
+    core::AssertTensorDtype(batch_indices, core::Int64);
+    core::AssertTensorDevice(batch_indices, covariances.GetDevice());
+
+    core::Tensor covariances_contiguous = covariances.Contiguous();
+    core::Tensor transformations_contiguous =
+            transformations.To(covariances.GetDevice(), covariances.GetDtype())
+                    .Contiguous();
+    core::Tensor batch_indices_contiguous = batch_indices.Contiguous();
+
+    core::Device::DeviceType device_type = covariances.GetDevice().GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        TransformCovariancesBatchedCPU(transformations_contiguous,
+                                       batch_indices_contiguous,
+                                       covariances_contiguous);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(TransformCovariancesBatchedCUDA, transformations_contiguous,
+                  batch_indices_contiguous, covariances_contiguous);
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+
+    covariances = covariances_contiguous;
+}
+
 }  // namespace transform
 }  // namespace kernel
 }  // namespace geometry
@@ -45,6 +45,29 @@ void RotatePoints(const core::Tensor& R,
 
 void RotateNormals(const core::Tensor& R, core::Tensor& normals);
 
+void TransformCovariances(const core::Tensor& transformation,
+                          core::Tensor& covariances);
+
+void RotateCovariances(const core::Tensor& R, core::Tensor& covariances);
+
+/// Transforms each of the {N, 3} \p points with the {4, 4} matrix of its
+/// batch item, i.e. transformations[batch_indices[i]] for point i.
+/// \p transformations is {B, 4, 4} and \p batch_indices is Int64 {N}.
+void TransformPointsBatched(const core::Tensor& transformations,
+                            const core::Tensor& batch_indices,
+                            core::Tensor& points);
+
+/// Same as TransformPointsBatched(), but only rotates the \p normals.
+void TransformNormalsBatched(const core::Tensor& transformations,
+                             const core::Tensor& batch_indices,
+                             core::Tensor& normals);
+
+/// Same as TransformPointsBatched(), but only rotates the {N, 3, 3}
+/// \p covariances.
+void TransformCovariancesBatched(const core::Tensor& transformations,
+                                 const core::Tensor& batch_indices,
+                                 core::Tensor& covariances);
+
 void TransformPointsCPU(const core::Tensor& transformation,
                         core::Tensor& points);
 
@@ -57,6 +80,23 @@ void RotatePointsCPU(const core::Tensor& R,
 
 void RotateNormalsCPU(const core::Tensor& R, core::Tensor& normals);
 
+void TransformCovariancesCPU(const core::Tensor& transformation,
+                             core::Tensor& covariances);
+
+void RotateCovariancesCPU(const core::Tensor& R, core::Tensor& covariances);
+
+void TransformPointsBatchedCPU(const core::Tensor& transformations,
+                               const core::Tensor& batch_indices,
+                               core::Tensor& points);
+
+void TransformNormalsBatchedCPU(const core::Tensor& transformations,
+                                const core::Tensor& batch_indices,
+                                core::Tensor& normals);
+
+void TransformCovariancesBatchedCPU(const core::Tensor& transformations,
+                                    const core::Tensor& batch_indices,
+                                    core::Tensor& covariances);
+
 #ifdef BUILD_CUDA_MODULE
 void TransformPointsCUDA(const core::Tensor& transformation,
                          core::Tensor& points);
@@ -69,6 +109,23 @@ void RotatePointsCUDA(const core::Tensor& R,
                       const core::Tensor& center);
 
 void RotateNormalsCUDA(const core::Tensor& R, core::Tensor& normals);
+
+void TransformCovariancesCUDA(const core::Tensor& transformation,
+                              core::Tensor& covariances);
+
+void RotateCovariancesCUDA(const core::Tensor& R, core::Tensor& covariances);
+
+void TransformPointsBatchedCUDA(const core::Tensor& transformations,
+                                const core::Tensor& batch_indices,
+                                core::Tensor& points);
+
+void TransformNormalsBatchedCUDA(const core::Tensor& transformations,
+                                 const core::Tensor& batch_indices,
+                                 core::Tensor& normals);
+
+void TransformCovariancesBatchedCUDA(const core::Tensor& transformations,
+                                     const core::Tensor& batch_indices,
+                                     core::Tensor& covariances);
 #endif
 
 }  // namespace transform
@@ -106,6 +106,31 @@ OPEN3D_HOST_DEVICE OPEN3D_FORCE_INLINE void RotateNormalsKernel(
     normals_ptr[2] = x[2];
 }
 
+/// Computes R * C * R^T in place for the 3x3 covariance C, where R is the
+/// upper-left 3x3 block of a row-major matrix with \p R_stride columns.
+template <typename scalar_t>
+OPEN3D_HOST_DEVICE OPEN3D_FORCE_INLINE void RotateCovarianceKernel(
+        const scalar_t* R_ptr, const int R_stride, scalar_t* covariance_ptr) {
+    // RC = R * C.
+    scalar_t RC[9];
+    for (int i = 0; i < 3; ++i) {
+        for (int j = 0; j < 3; ++j) {
+            RC[3 * i + j] = R_ptr[R_stride * i + 0] * covariance_ptr[j] +
+                            R_ptr[R_stride * i + 1] * covariance_ptr[3 + j] +
+                            R_ptr[R_stride * i + 2] * covariance_ptr[6 + j];
+        }
+    }
+    // C = RC * R^T.
+    for (int i = 0; i < 3; ++i) {
+        for (int j = 0; j < 3; ++j) {
+            covariance_ptr[3 * i + j] =
+                    RC[3 * i + 0] * R_ptr[R_stride * j + 0] +
+                    RC[3 * i + 1] * R_ptr[R_stride * j + 1] +
+                    RC[3 * i + 2] * R_ptr[R_stride * j + 2];
+        }
+    }
+}
+
 #ifdef __CUDACC__
 void TransformPointsCUDA
 #else
@@ -186,6 +211,120 @@ void RotateNormalsCPU
     });
 }
 
+#ifdef __CUDACC__
+void TransformCovariancesCUDA
+#else
+void TransformCovariancesCPU
+#endif
+        (const core::Tensor& transformation, core::Tensor& covariances) {
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(covariances.GetDtype(), [&]() {
+        scalar_t* covariances_ptr = covariances.GetDataPtr<scalar_t>();
+        const scalar_t* transformation_ptr =
+                transformation.GetDataPtr<scalar_t>();
+
+        core::ParallelFor(transformation.GetDevice(), covariances.GetLength(),
+                          [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                              RotateCovarianceKernel(
+                                      transformation_ptr, 4,
+                                      covariances_ptr + 9 * workload_idx);
+                          });
+    });
+}
+
+#ifdef __CUDACC__
+void RotateCovariancesCUDA
+#else
+void RotateCovariancesCPU
+#endif
+        (const core::Tensor& R, core::Tensor& covariances) {
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(covariances.GetDtype(), [&]() {
+        scalar_t* covariances_ptr = covariances.GetDataPtr<scalar_t>();
+        const scalar_t* R_ptr = R.GetDataPtr<scalar_t>();
+
+        core::ParallelFor(R.GetDevice(), covariances.GetLength(),
+                          [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                              RotateCovarianceKernel(
+                                      R_ptr, 3,
+                                      covariances_ptr + 9 * workload_idx);
+                          });
+    });
+}
+
+#ifdef __CUDACC__
+void TransformPointsBatchedCUDA
+#else
+void TransformPointsBatchedCPU
+#endif
+        (const core::Tensor& transformations,
+         const core::Tensor& batch_indices,
+         core::Tensor& points) {
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(points.GetDtype(), [&]() {
+        scalar_t* points_ptr = points.GetDataPtr<scalar_t>();
+        const scalar_t* transformations_ptr =
+                transformations.GetDataPtr<scalar_t>();
+        const int64_t* batch_indices_ptr = batch_indices.GetDataPtr<int64_t>();
+
+        core::ParallelFor(
+                points.GetDevice(), points.GetLength(),
+                [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                    TransformPointsKernel(
+                            transformations_ptr +
+                                    16 * batch_indices_ptr[workload_idx],
+                            points_ptr + 3 * workload_idx);
+                });
+    });
+}
+
+#ifdef __CUDACC__
+void TransformNormalsBatchedCUDA
+#else
+void TransformNormalsBatchedCPU
+#endif
+        (const core::Tensor& transformations,
+         const core::Tensor& batch_indices,
+         core::Tensor& normals) {
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(normals.GetDtype(), [&]() {
+        scalar_t* normals_ptr = normals.GetDataPtr<scalar_t>();
+        const scalar_t* transformations_ptr =
+                transformations.GetDataPtr<scalar_t>();
+        const int64_t* batch_indices_ptr = batch_indices.GetDataPtr<int64_t>();
+
+        core::ParallelFor(
+                normals.GetDevice(), normals.GetLength(),
+                [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                    TransformNormalsKernel(
+                            transformations_ptr +
+                                    16 * batch_indices_ptr[workload_idx],
+                            normals_ptr + 3 * workload_idx);
+                });
+    });
+}
+
+#ifdef __CUDACC__
+void TransformCovariancesBatchedCUDA
+#else
+void TransformCovariancesBatchedCPU
+#endif
+        (const core::Tensor& transformations,
+         const core::Tensor& batch_indices,
+         core::Tensor& covariances) {
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(covariances.GetDtype(), [&]() {
+        scalar_t* covariances_ptr = covariances.GetDataPtr<scalar_t>();
+        const scalar_t* transformations_ptr =
+                transformations.GetDataPtr<scalar_t>();
+        const int64_t* batch_indices_ptr = batch_indices.GetDataPtr<int64_t>();
+
+        core::ParallelFor(
+                covariances.GetDevice(), covariances.GetLength(),
+                [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                    RotateCovarianceKernel(
+                            transformations_ptr +
+                                    16 * batch_indices_ptr[workload_idx],
+                            4, covariances_ptr + 9 * workload_idx);
+                });
+    });
+}
+
 }  // namespace transform
 }  // namespace kernel
 }  // namespace geometry
@@ -0,0 +1,143 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/t/geometry/kernel/TriangleMesh.h"
+
+#include <limits>
+
+#include "open3d/core/CUDAUtils.h"
+#include "open3d/core/TensorCheck.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+namespace kernel {
+namespace trianglemesh {
+
+void RasterizeTextureUVs(const core::Tensor& texture_uvs,
+                         int64_t size,
+                         int64_t margin,
+                         core::Tensor& triangle_ids,
+                         core::Tensor& barycentrics) {
+    core::AssertTensorShape(texture_uvs, {utility::nullopt, 3, 2});
+    core::AssertTensorDtype(texture_uvs, core::Float32);
+    if (size <= 0) {
+        utility::LogError("Texture size must be positive, but got {}.", size);
+    }
+    if (texture_uvs.GetLength() >= std::numeric_limits<int32_t>::max()) {
+        utility::LogError("Too many triangles: {}.", texture_uvs.GetLength());
+    }
+
+    // Corners in texel coordinates, with texel centers at integers.
+    const core::Device device = texture_uvs.GetDevice();
+    core::Tensor corners = texture_uvs.Clone();
+    corners.Slice(2, 0, 1) = texture_uvs.Slice(2, 0, 1) * size - 0.5;
+    corners.Slice(2, 1, 2) = (1 - texture_uvs.Slice(2, 1, 2)) * size - 0.5;
+
+    triangle_ids = core::Tensor::Empty({size, size}, core::Int64, device);
+    barycentrics =
+            core::Tensor::Empty({size, size, 3}, core::Float32, device);
+
+    const core::Device::DeviceType device_type = device.GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        RasterizeTextureUVsCPU(corners, size, margin, triangle_ids,
+                               barycentrics);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(RasterizeTextureUVsCUDA, corners, size, margin,
+                  triangle_ids, barycentrics);
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void SampleTriangles(const core::Tensor& area_cdf,
+                     int64_t num_samples,
+                     uint32_t seed,
+                     core::Tensor& triangle_ids,
+                     core::Tensor& barycentrics) {
+    core::AssertTensorShape(area_cdf, {utility::nullopt});
+    core::AssertTensorDtype(area_cdf, core::Float64);
+    if (area_cdf.GetLength() == 0) {
+        utility::LogError("No triangles to sample from.");
+    }
+    if (num_samples < 0) {
+        utility::LogError("num_samples must be non-negative, but got {}.",
+                          num_samples);
+    }
+
+    const core::Device device = area_cdf.GetDevice();
+    triangle_ids = core::Tensor::Empty({num_samples}, core::Int64, device);
+    barycentrics =
+            core::Tensor::Empty({num_samples, 3}, core::Float64, device);
+
+    const core::Device::DeviceType device_type = device.GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        SampleTrianglesCPU(area_cdf.Contiguous(), num_samples, seed,
+                           triangle_ids, barycentrics);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(SampleTrianglesCUDA, area_cdf.Contiguous(), num_samples,
+                  seed, triangle_ids, barycentrics);
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void EliminateSamples(const core::Tensor& points,
+                      int64_t num_samples,
+                      double r_max,
+                      double r_min,
+                      double alpha,
+                      core::Tensor& mask) {
+    core::AssertTensorShape(points, {utility::nullopt, 3});
+    core::AssertTensorDtype(points, core::Float64);
+    if (num_samples < 0 || num_samples > points.GetLength()) {
+        utility::LogError("num_samples must be in [0, {}], but got {}.",
+                          points.GetLength(), num_samples);
+    }
+    if (!(r_max > 0)) {
+        utility::LogError("r_max must be positive, but got {}.", r_max);
+    }
+
+    const core::Device::DeviceType device_type =
+            points.GetDevice().GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        EliminateSamplesCPU(points.Contiguous(), num_samples, r_max, r_min,
+                            alpha, mask);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(EliminateSamplesCUDA, points.Contiguous(), num_samples,
+                  r_max, r_min, alpha, mask);
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+}  // namespace trianglemesh
+}  // namespace kernel
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,124 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#pragma once
+
+#include "open3d/core/Tensor.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+namespace kernel {
+namespace trianglemesh {
+
+/// Rasterizes the {M, 3, 2} Float32 \p texture_uvs into a {size, size}
+/// texture, with v = 0 at the bottom row. triangle_ids {size, size} Int64
+/// [output] is for each texel the smallest index of the triangles that contain
+/// the texel center, or -1. Empty texels within \p margin texels of a covered
+/// texel are dilated from their neighbors. barycentrics {size, size, 3}
+/// Float32 [output] are the barycentric coordinates of the texel centers,
+/// clamped to the triangle for the dilated texels.
+void RasterizeTextureUVs(const core::Tensor& texture_uvs,
+                         int64_t size,
+                         int64_t margin,
+                         core::Tensor& triangle_ids,
+                         core::Tensor& barycentrics);
+
+void RasterizeTextureUVsCPU(const core::Tensor& corners,
+                            int64_t size,
+                            int64_t margin,
+                            core::Tensor& triangle_ids,
+                            core::Tensor& barycentrics);
+
+#ifdef BUILD_CUDA_MODULE
+void RasterizeTextureUVsCUDA(const core::Tensor& corners,
+                             int64_t size,
+                             int64_t margin,
+                             core::Tensor& triangle_ids,
+                             core::Tensor& barycentrics);
+#endif
+
+/// Samples \p num_samples points on the triangles, stratified by area.
+/// area_cdf {M} Float64 is the inclusive prefix sum of the triangle areas
+/// normalized to 1. triangle_ids {num_samples} Int64 [output] are the sampled
+/// triangles in increasing order and barycentrics {num_samples, 3} Float64
+/// [output] are uniformly distributed within each triangle. The samples only
+/// depend on \p seed and not on the device.
+void SampleTriangles(const core::Tensor& area_cdf,
+                     int64_t num_samples,
+                     uint32_t seed,
+                     core::Tensor& triangle_ids,
+                     core::Tensor& barycentrics);
+
+void SampleTrianglesCPU(const core::Tensor& area_cdf,
+                        int64_t num_samples,
+                        uint32_t seed,
+                        core::Tensor& triangle_ids,
+                        core::Tensor& barycentrics);
+
+#ifdef BUILD_CUDA_MODULE
+void SampleTrianglesCUDA(const core::Tensor& area_cdf,
+                         int64_t num_samples,
+                         uint32_t seed,
+                         core::Tensor& triangle_ids,
+                         core::Tensor& barycentrics);
+#endif
+
+/// Weighted sample elimination of Yuksel, "Sample Elimination for Generating
+/// Poisson Disk Sample Sets", 2015, on the {K, 3} Float64 \p points. The
+/// neighbors within \p r_max are found with a hash grid. Each round removes,
+/// in parallel, the samples whose weight is the largest among their
+/// neighbors, so no two neighbors are removed in the same round. mask {K}
+/// Bool [output] marks the \p num_samples remaining samples.
+void EliminateSamples(const core::Tensor& points,
+                      int64_t num_samples,
+                      double r_max,
+                      double r_min,
+                      double alpha,
+                      core::Tensor& mask);
+
+void EliminateSamplesCPU(const core::Tensor& points,
+                         int64_t num_samples,
+                         double r_max,
+                         double r_min,
+                         double alpha,
+                         core::Tensor& mask);
+
+#ifdef BUILD_CUDA_MODULE
+void EliminateSamplesCUDA(const core::Tensor& points,
+                          int64_t num_samples,
+                          double r_max,
+                          double r_min,
+                          double alpha,
+                          core::Tensor& mask);
+#endif
+
+}  // namespace trianglemesh
+}  // namespace kernel
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,482 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include <atomic>
+#include <cmath>
+#include <limits>
+
+#include "open3d/core/CUDAUtils.h"
+#include "open3d/core/ParallelFor.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/t/geometry/kernel/TriangleMesh.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+namespace kernel {
+namespace trianglemesh {
+
+#ifndef __CUDACC__
+using std::ceil;
+using std::floor;
+using std::pow;
+using std::sqrt;
+#endif
+
+constexpr int32_t kEmptyTexel = std::numeric_limits<int32_t>::max();
+
+#if defined(__CUDACC__)
+OPEN3D_DEVICE inline void AtomicMinInt32(int32_t* address, int32_t value) {
+    atomicMin(address, value);
+}
+#else
+inline void AtomicMinInt32(int32_t* address, int32_t value) {
+    static_assert(sizeof(std::atomic<int32_t>) == sizeof(int32_t),
+                  "std::atomic<int32_t> must have the size of int32_t.");
+    std::atomic<int32_t>* atomic =
+            reinterpret_cast<std::atomic<int32_t>*>(address);
+    int32_t old = atomic->load();
+    while (value < old && !atomic->compare_exchange_weak(old, value)) {
+    }
+}
+#endif
+
+/// Barycentric coordinates of (x, y) in the triangle with the {3, 2} corners.
+/// Returns false for degenerate triangles.
+OPEN3D_HOST_DEVICE inline bool ComputeBarycentrics(const float* corners,
+                                                   float x,
+                                                   float y,
+                                                   float* b) {
+    const float x0 = corners[0], y0 = corners[1];
+    const float x1 = corners[2], y1 = corners[3];
+    const float x2 = corners[4], y2 = corners[5];
+    const float det = (y1 - y2) * (x0 - x2) + (x2 - x1) * (y0 - y2);
+    if (det == 0) {
+        return false;
+    }
+    b[0] = ((y1 - y2) * (x - x2) + (x2 - x1) * (y - y2)) / det;
+    b[1] = ((y2 - y0) * (x - x2) + (x0 - x2) * (y - y2)) / det;
+    b[2] = 1 - b[0] - b[1];
+    return true;
+}
+
+#if defined(__CUDACC__)
+void RasterizeTextureUVsCUDA
+#else
+void RasterizeTextureUVsCPU
+#endif
+        (const core::Tensor& corners,
+         int64_t size,
+         int64_t margin,
+         core::Tensor& triangle_ids,
+         core::Tensor& barycentrics) {
+    const core::Device device = corners.GetDevice();
+    const int64_t num_triangles = corners.GetLength();
+    const int64_t num_texels = size * size;
+
+    core::Tensor owners = core::Tensor::Full({size, size}, kEmptyTexel,
+                                             core::Int32, device);
+    const float* corners_ptr = corners.GetDataPtr<float>();
+    int32_t* owners_ptr = owners.GetDataPtr<int32_t>();
+
+    // Each texel is owned by the triangle with the smallest index that
+    // contains its center, so the result does not depend on the order in
+    // which the triangles are rasterized.
+    core::ParallelFor(device, num_triangles, [=] OPEN3D_DEVICE(
+                                                     int64_t workload_idx) {
+        const float* c = corners_ptr + 6 * workload_idx;
+        const float x_min = fminf(c[0], fminf(c[2], c[4]));
+        const float x_max = fmaxf(c[0], fmaxf(c[2], c[4]));
+        const float y_min = fminf(c[1], fminf(c[3], c[5]));
+        const float y_max = fmaxf(c[1], fmaxf(c[3], c[5]));
+        const int64_t x0 = x_min < 0 ? 0 : int64_t(ceil(x_min));
+        const int64_t y0 = y_min < 0 ? 0 : int64_t(ceil(y_min));
+        const int64_t x1 = x_max > size - 1 ? size - 1 : int64_t(floor(x_max));
+        const int64_t y1 = y_max > size - 1 ? size - 1 : int64_t(floor(y_max));
+        constexpr float kEps = 1e-6f;
+        float b[3];
+        if (!ComputeBarycentrics(c, c[0], c[1], b)) {
+            return;
+        }
+        for (int64_t y = y0; y <= y1; ++y) {
+            for (int64_t x = x0; x <= x1; ++x) {
+                ComputeBarycentrics(c, float(x), float(y), b);
+                if (b[0] >= -kEps && b[1] >= -kEps && b[2] >= -kEps) {
+                    AtomicMinInt32(owners_ptr + y * size + x,
+                                   int32_t(workload_idx));
+                }
+            }
+        }
+    });
+
+    // Dilate the owners into the empty texels, one texel per pass.
+    core::Tensor dilated = owners.Clone();
+    for (int64_t pass = 0; pass < margin; ++pass) {
+        const int32_t* src_ptr = owners.GetDataPtr<int32_t>();
+        int32_t* dst_ptr = dilated.GetDataPtr<int32_t>();
+        core::ParallelFor(
+                device, num_texels, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                    const int64_t x = workload_idx % size;
+                    const int64_t y = workload_idx / size;
+                    int32_t owner = src_ptr[workload_idx];
+                    if (owner == kEmptyTexel) {
+                        if (x > 0 && src_ptr[workload_idx - 1] < owner) {
+                            owner = src_ptr[workload_idx - 1];
+                        }
+                        if (x + 1 < size && src_ptr[workload_idx + 1] < owner) {
+                            owner = src_ptr[workload_idx + 1];
+                        }
+                        if (y > 0 && src_ptr[workload_idx - size] < owner) {
+                            owner = src_ptr[workload_idx - size];
+                        }
+                        if (y + 1 < size &&
+                            src_ptr[workload_idx + size] < owner) {
+                            owner = src_ptr[workload_idx + size];
+                        }
+                    }
+                    dst_ptr[workload_idx] = owner;
+                });
+        std::swap(owners, dilated);
+    }
+
+    const int32_t* final_ptr = owners.GetDataPtr<int32_t>();
+    int64_t* ids_ptr = triangle_ids.GetDataPtr<int64_t>();
+    float* barycentrics_ptr = barycentrics.GetDataPtr<float>();
+    core::ParallelFor(
+            device, num_texels, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                const int32_t owner = final_ptr[workload_idx];
+                float* b = barycentrics_ptr + 3 * workload_idx;
+                b[0] = b[1] = b[2] = 0;
+                if (owner == kEmptyTexel) {
+                    ids_ptr[workload_idx] = -1;
+                    return;
+                }
+                ComputeBarycentrics(corners_ptr + 6 * owner,
+                                    float(workload_idx % size),
+                                    float(workload_idx / size), b);
+                // Clamp to the triangle for texels of the dilated margin.
+                float sum = 0;
+                for (int i = 0; i < 3; ++i) {
+                    b[i] = b[i] < 0 ? 0 : b[i];
+                    sum += b[i];
+                }
+                for (int i = 0; i < 3; ++i) {
+                    b[i] = sum > 0 ? b[i] / sum : 1.f / 3;
+                }
+                ids_ptr[workload_idx] = owner;
+            });
+}
+
+/// Integer hash of C. Wellons, "Prospecting for Hash Functions", 2018.
+OPEN3D_HOST_DEVICE inline uint32_t HashUInt32(uint32_t x) {
+    x ^= x >> 16;
+    x *= 0x7feb352dU;
+    x ^= x >> 15;
+    x *= 0x846ca68bU;
+    x ^= x >> 16;
+    return x;
+}
+
+/// Uniform random number in [0, 1) at position \p idx of the stream \p seed.
+/// Counter based, so the samples can be drawn in any order.
+OPEN3D_HOST_DEVICE inline double UniformRandom(uint32_t seed, int64_t idx) {
+    const uint32_t h = HashUInt32(uint32_t(idx) ^
+                                  HashUInt32(uint32_t(idx >> 32) ^
+                                             HashUInt32(seed)));
+    return h * (1.0 / 4294967296.0);
+}
+
+#if defined(__CUDACC__)
+void SampleTrianglesCUDA
+#else
+void SampleTrianglesCPU
+#endif
+        (const core::Tensor& area_cdf,
+         int64_t num_samples,
+         uint32_t seed,
+         core::Tensor& triangle_ids,
+         core::Tensor& barycentrics) {
+    const core::Device device = area_cdf.GetDevice();
+    const int64_t num_triangles = area_cdf.GetLength();
+    const double* cdf_ptr = area_cdf.GetDataPtr<double>();
+    int64_t* ids_ptr = triangle_ids.GetDataPtr<int64_t>();
+    double* barycentrics_ptr = barycentrics.GetDataPtr<double>();
+
+    // Sample i falls into the stratum [i, i + 1) / num_samples of the area,
+    // so every triangle gets its share of the samples up to rounding.
+    core::ParallelFor(
+            device, num_samples, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                const double u =
+                        (workload_idx + UniformRandom(seed, 3 * workload_idx)) /
+                        num_samples;
+                int64_t lo = 0;
+                int64_t hi = num_triangles - 1;
+                while (lo < hi) {
+                    const int64_t mid = (lo + hi) / 2;
+                    if (cdf_ptr[mid] > u) {
+                        hi = mid;
+                    } else {
+                        lo = mid + 1;
+                    }
+                }
+                const double r1 =
+                        sqrt(UniformRandom(seed, 3 * workload_idx + 1));
+                const double r2 = UniformRandom(seed, 3 * workload_idx + 2);
+                double* b = barycentrics_ptr + 3 * workload_idx;
+                b[0] = 1 - r1;
+                b[1] = r1 * (1 - r2);
+                b[2] = r1 * r2;
+                ids_ptr[workload_idx] = lo;
+            });
+}
+
+/// Hash grid bucket of the cell \p cell for a power of two \p table_size.
+OPEN3D_HOST_DEVICE inline int64_t HashSampleCell(const int64_t* cell,
+                                                 int64_t table_size) {
+    const uint64_t h = (uint64_t(cell[0]) * 73856093) ^
+                       (uint64_t(cell[1]) * 19349663) ^
+                       (uint64_t(cell[2]) * 83492791);
+    return int64_t(h & uint64_t(table_size - 1));
+}
+
+/// Calls \p func(j, squared_distance) for every sample j != \p idx within
+/// \p radius of sample \p idx. The samples are sorted by hash grid bucket and
+/// \p offsets {table_size + 1} are the bucket offsets.
+template <typename Func>
+OPEN3D_HOST_DEVICE inline void ForEachSampleNeighbor(const double* points_ptr,
+                                                     const int64_t* offsets_ptr,
+                                                     int64_t table_size,
+                                                     double radius,
+                                                     int64_t idx,
+                                                     Func func) {
+    const double* p = points_ptr + 3 * idx;
+    int64_t cell[3];
+    for (int i = 0; i < 3; ++i) {
+        cell[i] = int64_t(floor(p[i] / radius));
+    }
+    // Colliding cells share a bucket, which must be visited only once. Other
+    // samples in the visited buckets are rejected by their distance.
+    int64_t buckets[27];
+    int num_buckets = 0;
+    int64_t neighbor_cell[3];
+    for (int64_t dx = -1; dx <= 1; ++dx) {
+        for (int64_t dy = -1; dy <= 1; ++dy) {
+            for (int64_t dz = -1; dz <= 1; ++dz) {
+                neighbor_cell[0] = cell[0] + dx;
+                neighbor_cell[1] = cell[1] + dy;
+                neighbor_cell[2] = cell[2] + dz;
+                const int64_t bucket =
+                        HashSampleCell(neighbor_cell, table_size);
+                bool is_new = true;
+                for (int i = 0; i < num_buckets; ++i) {
+                    is_new = is_new && buckets[i] != bucket;
+                }
+                if (is_new) {
+                    buckets[num_buckets++] = bucket;
+                }
+            }
+        }
+    }
+    const double radius2 = radius * radius;
+    for (int i = 0; i < num_buckets; ++i) {
+        for (int64_t j = offsets_ptr[buckets[i]];
+             j < offsets_ptr[buckets[i] + 1]; ++j) {
+            const double* q = points_ptr + 3 * j;
+            const double d2 = (p[0] - q[0]) * (p[0] - q[0]) +
+                              (p[1] - q[1]) * (p[1] - q[1]) +
+                              (p[2] - q[2]) * (p[2] - q[2]);
+            if (d2 <= radius2 && j != idx) {
+                func(j, d2);
+            }
+        }
+    }
+}
+
+#if defined(__CUDACC__)
+void EliminateSamplesCUDA
+#else
+void EliminateSamplesCPU
+#endif
+        (const core::Tensor& points,
+         int64_t num_samples,
+         double r_max,
+         double r_min,
+         double alpha,
+         core::Tensor& mask) {
+    const core::Device device = points.GetDevice();
+    const int64_t num_points = points.GetLength();
+
+    // Hash grid with cells of size r_max, stored as the samples sorted by
+    // bucket and the offsets of the buckets. All per-sample data below is in
+    // bucket order, so neighbors are close in memory.
+    int64_t table_size = 1;
+    while (table_size < 2 * num_points) {
+        table_size *= 2;
+    }
+    core::Tensor buckets =
+            core::Tensor::Empty({num_points}, core::Int64, device);
+    const double* unsorted_ptr = points.GetDataPtr<double>();
+    int64_t* buckets_ptr = buckets.GetDataPtr<int64_t>();
+    core::ParallelFor(
+            device, num_points, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                const double* p = unsorted_ptr + 3 * workload_idx;
+                int64_t cell[3];
+                for (int i = 0; i < 3; ++i) {
+                    cell[i] = int64_t(floor(p[i] / r_max));
+                }
+                buckets_ptr[workload_idx] = HashSampleCell(cell, table_size);
+            });
+    const core::Tensor order = buckets.ArgSort();
+    const core::Tensor sorted_buckets = buckets.IndexGet({order});
+    const core::Tensor sorted_points = points.IndexGet({order});
+    core::Tensor offsets =
+            core::Tensor::Empty({table_size + 1}, core::Int64, device);
+    const double* points_ptr = sorted_points.GetDataPtr<double>();
+    const int64_t* sorted_ptr = sorted_buckets.GetDataPtr<int64_t>();
+    int64_t* offsets_ptr = offsets.GetDataPtr<int64_t>();
+    core::ParallelFor(
+            device, table_size + 1, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                // First sorted sample in a bucket >= workload_idx.
+                int64_t lo = 0;
+                int64_t hi = num_points;
+                while (lo < hi) {
+                    const int64_t mid = (lo + hi) / 2;
+                    if (sorted_ptr[mid] < workload_idx) {
+                        lo = mid + 1;
+                    } else {
+                        hi = mid;
+                    }
+                }
+                offsets_ptr[workload_idx] = lo;
+            });
+
+    core::Tensor sorted_mask =
+            core::Tensor::Ones({num_points}, core::Bool, device);
+    core::Tensor removed =
+            core::Tensor::Zeros({num_points}, core::Bool, device);
+    core::Tensor weights =
+            core::Tensor::Empty({num_points}, core::Float64, device);
+    core::Tensor candidates =
+            core::Tensor::Empty({num_points}, core::Bool, device);
+    bool* mask_ptr = sorted_mask.GetDataPtr<bool>();
+    bool* removed_ptr = removed.GetDataPtr<bool>();
+    double* weights_ptr = weights.GetDataPtr<double>();
+    bool* candidates_ptr = candidates.GetDataPtr<bool>();
+
+    // The weights are computed once and then only lose the contributions of
+    // the samples eliminated in each round.
+    core::ParallelFor(
+            device, num_points, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                double weight = 0;
+                ForEachSampleNeighbor(points_ptr, offsets_ptr, table_size,
+                                      r_max, workload_idx,
+                                      [&](int64_t j, double d2) {
+                                          double d = sqrt(d2);
+                                          d = d < r_min ? r_min : d;
+                                          weight += pow(1 - d / r_max, alpha);
+                                      });
+                weights_ptr[workload_idx] = weight;
+            });
+
+    int64_t num_remaining = num_points;
+    while (num_remaining > num_samples) {
+        // A candidate has the largest weight among its remaining neighbors,
+        // so no two neighbors are eliminated in the same round. Ties are
+        // broken by the sample index.
+        core::ParallelFor(
+                device, num_points, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                    const double weight = weights_ptr[workload_idx];
+                    bool is_candidate = mask_ptr[workload_idx];
+                    bool has_neighbor = false;
+                    if (is_candidate) {
+                        ForEachSampleNeighbor(
+                                points_ptr, offsets_ptr, table_size, r_max,
+                                workload_idx, [&](int64_t j, double) {
+                                    if (!mask_ptr[j]) {
+                                        return;
+                                    }
+                                    has_neighbor = true;
+                                    if (weights_ptr[j] > weight ||
+                                        (weights_ptr[j] == weight &&
+                                         j > workload_idx)) {
+                                        is_candidate = false;
+                                    }
+                                });
+                    }
+                    candidates_ptr[workload_idx] = is_candidate && has_neighbor;
+                });
+
+        const int64_t num_excess = num_remaining - num_samples;
+        core::Tensor eliminated = candidates.NonZero().Flatten();
+        if (eliminated.GetLength() == 0) {
+            // The remaining samples are further than r_max apart.
+            eliminated =
+                    sorted_mask.NonZero().Flatten().Slice(0, num_samples,
+                                                          num_remaining);
+        } else if (eliminated.GetLength() > num_excess) {
+            eliminated = eliminated.IndexGet({std::get<1>(
+                    weights.IndexGet({eliminated}).TopK(num_excess))});
+        }
+        const core::Tensor zeros =
+                core::Tensor::Zeros({eliminated.GetLength()}, core::Bool,
+                                    device);
+        sorted_mask.IndexSet({eliminated}, zeros);
+        num_remaining -= eliminated.GetLength();
+        if (num_remaining <= num_samples) {
+            break;
+        }
+
+        removed.IndexSet({eliminated}, zeros.LogicalNot());
+        core::ParallelFor(
+                device, num_points, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                    if (!mask_ptr[workload_idx]) {
+                        return;
+                    }
+                    double weight = weights_ptr[workload_idx];
+                    ForEachSampleNeighbor(
+                            points_ptr, offsets_ptr, table_size, r_max,
+                            workload_idx, [&](int64_t j, double d2) {
+                                if (removed_ptr[j]) {
+                                    double d = sqrt(d2);
+                                    d = d < r_min ? r_min : d;
+                                    weight -= pow(1 - d / r_max, alpha);
+                                }
+                            });
+                    weights_ptr[workload_idx] = weight;
+                });
+        removed.IndexSet({eliminated}, zeros);
+    }
+
+    mask = core::Tensor::Empty({num_points}, core::Bool, device);
+    mask.IndexSet({order}, sorted_mask);
+}
+
+}  // namespace trianglemesh
+}  // namespace kernel
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
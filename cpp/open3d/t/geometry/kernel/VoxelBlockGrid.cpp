@@ -85,6 +85,32 @@ void DepthTouch(std::shared_ptr<core::HashMap>& hashmap,
     }
 }
 
+void DepthRayTouch(std::shared_ptr<core::HashMap>& hashmap,
+                   const core::Tensor& depth,
+                   const core::Tensor& intrinsic,
+                   const core::Tensor& extrinsic,
+                   core::Tensor& voxel_block_coords,
+                   index_t voxel_grid_resolution,
+                   float voxel_size,
+                   float sdf_trunc,
+                   float depth_scale,
+                   float depth_max,
+                   index_t stride) {
+    core::Device::DeviceType device_type = hashmap->GetDevice().GetType();
+
+    if (device_type == core::Device::DeviceType::CPU) {
+        DepthRayTouchCPU(hashmap, depth, intrinsic, extrinsic,
+                         voxel_block_coords, voxel_grid_resolution, voxel_size,
+                         sdf_trunc, depth_scale, depth_max, stride);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(DepthRayTouchCUDA, hashmap, depth, intrinsic, extrinsic,
+                  voxel_block_coords, voxel_grid_resolution, voxel_size,
+                  sdf_trunc, depth_scale, depth_max, stride);
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
 void GetVoxelCoordinatesAndFlattenedIndices(const core::Tensor& buf_indices,
                                             const core::Tensor& block_keys,
                                             core::Tensor& voxel_coords,
@@ -106,25 +132,46 @@ void GetVoxelCoordinatesAndFlattenedIndices(const core::Tensor& buf_indices,
     }
 }
 
-#define DISPATCH_VALUE_DTYPE_TO_TEMPLATE(WEIGHT_DTYPE, COLOR_DTYPE, ...)    \
-    [&] {                                                                   \
-        if (WEIGHT_DTYPE == open3d::core::Float32 &&                        \
-            COLOR_DTYPE == open3d::core::Float32) {                         \
-            using weight_t = float;                                         \
-            using color_t = float;                                          \
-            return __VA_ARGS__();                                           \
-        } else if (WEIGHT_DTYPE == open3d::core::UInt16 &&                  \
-                   COLOR_DTYPE == open3d::core::UInt16) {                   \
-            using weight_t = uint16_t;                                      \
-            using color_t = uint16_t;                                       \
-            return __VA_ARGS__();                                           \
-        } else {                                                            \
-            utility::LogError(                                              \
-                    "Unsupported value data type combination. Expected "    \
-                    "(float, float) or (uint16, uint16), but received ({} " \
-                    "{}).",                                                 \
-                    WEIGHT_DTYPE.ToString(), COLOR_DTYPE.ToString());       \
-        }                                                                   \
+#define DISPATCH_VALUE_DTYPE_TO_TEMPLATE(TSDF_DTYPE, WEIGHT_DTYPE,         \
+                                         COLOR_DTYPE, ...)                   \
+    [&] {                                                                    \
+        if (TSDF_DTYPE == open3d::core::Float32 &&                           \
+            WEIGHT_DTYPE == open3d::core::Float32 &&                         \
+            COLOR_DTYPE == open3d::core::Float32) {                          \
+            using tsdf_t = float;                                            \
+            using weight_t = float;                                          \
+            using color_t = float;                                           \
+            return __VA_ARGS__();                                            \
+        } else if (TSDF_DTYPE == open3d::core::Float32 &&                    \
+                   WEIGHT_DTYPE == open3d::core::UInt16 &&                   \
+                   COLOR_DTYPE == open3d::core::UInt16) {                    \
+            using tsdf_t = float;                                            \
+            using weight_t = uint16_t;                                       \
+            using color_t = uint16_t;                                        \
+            return __VA_ARGS__();                                            \
+        } else if (TSDF_DTYPE == open3d::core::Float32 &&                    \
+                   WEIGHT_DTYPE == open3d::core::UInt16 &&                   \
+                   COLOR_DTYPE == open3d::core::UInt8) {                     \
+            using tsdf_t = float;                                            \
+            using weight_t = uint16_t;                                       \
+            using color_t = uint8_t;                                         \
+            return __VA_ARGS__();                                            \
+        } else if (TSDF_DTYPE == open3d::core::Int16 &&                      \
+                   WEIGHT_DTYPE == open3d::core::UInt16 &&                   \
+                   COLOR_DTYPE == open3d::core::UInt8) {                     \
+            using tsdf_t = int16_t;                                          \
+            using weight_t = uint16_t;                                       \
+            using color_t = uint8_t;                                         \
+            return __VA_ARGS__();                                            \
+        } else {                                                             \
+            utility::LogError(                                               \
+                    "Unsupported value data type combination. Expected "     \
+                    "(float, float, float), (float, uint16, uint16), "       \
+                    "(float, uint16, uint8) or (int16, uint16, uint8), but " \
+                    "received ({} {} {}).",                                  \
+                    TSDF_DTYPE.ToString(), WEIGHT_DTYPE.ToString(),          \
+                    COLOR_DTYPE.ToString());                                 \
+        }                                                                    \
     }()
 
 #define DISPATCH_INPUT_DTYPE_TO_TEMPLATE(DEPTH_DTYPE, COLOR_DTYPE, ...)        \
@@ -149,6 +196,7 @@ void GetVoxelCoordinatesAndFlattenedIndices(const core::Tensor& buf_indices,
 
 void Integrate(const core::Tensor& depth,
                const core::Tensor& color,
+               const core::Tensor& label,
                const core::Tensor& block_indices,
                const core::Tensor& block_keys,
                TensorMap& block_value_map,
@@ -159,10 +207,17 @@ void Integrate(const core::Tensor& depth,
                float voxel_size,
                float sdf_trunc,
                float depth_scale,
-               float depth_max) {
-    using tsdf_t = float;
+               float depth_max,
+               float log_odds_hit,
+               float log_odds_miss,
+               float log_odds_min,
+               float log_odds_max) {
+    core::Dtype block_tsdf_dtype = core::Dtype::Float32;
     core::Dtype block_weight_dtype = core::Dtype::Float32;
     core::Dtype block_color_dtype = core::Dtype::Float32;
+    if (block_value_map.Contains("tsdf")) {
+        block_tsdf_dtype = block_value_map.at("tsdf").GetDtype();
+    }
     if (block_value_map.Contains("weight")) {
         block_weight_dtype = block_value_map.at("weight").GetDtype();
     }
@@ -183,14 +238,17 @@ void Integrate(const core::Tensor& depth,
         DISPATCH_INPUT_DTYPE_TO_TEMPLATE(
                 input_depth_dtype, input_color_dtype, [&] {
                     DISPATCH_VALUE_DTYPE_TO_TEMPLATE(
-                            block_weight_dtype, block_color_dtype, [&] {
+                            block_tsdf_dtype, block_weight_dtype,
+                            block_color_dtype, [&] {
                                 IntegrateCPU<input_depth_t, input_color_t,
                                              tsdf_t, weight_t, color_t>(
-                                        depth, color, block_indices, block_keys,
-                                        block_value_map, depth_intrinsic,
-                                        color_intrinsic, extrinsic, resolution,
-                                        voxel_size, sdf_trunc, depth_scale,
-                                        depth_max);
+                                        depth, color, label, block_indices,
+                                        block_keys, block_value_map,
+                                        depth_intrinsic, color_intrinsic,
+                                        extrinsic, resolution, voxel_size,
+                                        sdf_trunc, depth_scale, depth_max,
+                                        log_odds_hit, log_odds_miss,
+                                        log_odds_min, log_odds_max);
                             });
                 });
     } else if (device_type == core::Device::DeviceType::CUDA) {
@@ -198,14 +256,17 @@ void Integrate(const core::Tensor& depth,
         DISPATCH_INPUT_DTYPE_TO_TEMPLATE(
                 input_depth_dtype, input_color_dtype, [&] {
                     DISPATCH_VALUE_DTYPE_TO_TEMPLATE(
-                            block_weight_dtype, block_color_dtype, [&] {
+                            block_tsdf_dtype, block_weight_dtype,
+                            block_color_dtype, [&] {
                                 IntegrateCUDA<input_depth_t, input_color_t,
                                               tsdf_t, weight_t, color_t>(
-                                        depth, color, block_indices, block_keys,
-                                        block_value_map, depth_intrinsic,
-                                        color_intrinsic, extrinsic, resolution,
-                                        voxel_size, sdf_trunc, depth_scale,
-                                        depth_max);
+                                        depth, color, label, block_indices,
+                                        block_keys, block_value_map,
+                                        depth_intrinsic, color_intrinsic,
+                                        extrinsic, resolution, voxel_size,
+                                        sdf_trunc, depth_scale, depth_max,
+                                        log_odds_hit, log_odds_miss,
+                                        log_odds_min, log_odds_max);
                             });
                 });
 #else
@@ -266,9 +327,12 @@ void RayCast(std::shared_ptr<core::HashMap>& hashmap,
              float weight_threshold,
              float trunc_voxel_multiplier,
              int range_map_down_factor) {
-    using tsdf_t = float;
+    core::Dtype block_tsdf_dtype = core::Dtype::Float32;
     core::Dtype block_weight_dtype = core::Dtype::Float32;
     core::Dtype block_color_dtype = core::Dtype::Float32;
+    if (block_value_map.Contains("tsdf")) {
+        block_tsdf_dtype = block_value_map.at("tsdf").GetDtype();
+    }
     if (block_value_map.Contains("weight")) {
         block_weight_dtype = block_value_map.at("weight").GetDtype();
     }
@@ -279,7 +343,8 @@ void RayCast(std::shared_ptr<core::HashMap>& hashmap,
     core::Device::DeviceType device_type = hashmap->GetDevice().GetType();
     if (device_type == core::Device::DeviceType::CPU) {
         DISPATCH_VALUE_DTYPE_TO_TEMPLATE(
-                block_weight_dtype, block_color_dtype, [&] {
+                block_tsdf_dtype, block_weight_dtype,
+                block_color_dtype, [&] {
                     RayCastCPU<tsdf_t, weight_t, color_t>(
                             hashmap, block_value_map, range_map, renderings_map,
                             intrinsic, extrinsic, h, w, block_resolution,
@@ -291,7 +356,8 @@ void RayCast(std::shared_ptr<core::HashMap>& hashmap,
     } else if (device_type == core::Device::DeviceType::CUDA) {
 #ifdef BUILD_CUDA_MODULE
         DISPATCH_VALUE_DTYPE_TO_TEMPLATE(
-                block_weight_dtype, block_color_dtype, [&] {
+                block_tsdf_dtype, block_weight_dtype,
+                block_color_dtype, [&] {
                     RayCastCUDA<tsdf_t, weight_t, color_t>(
                             hashmap, block_value_map, range_map, renderings_map,
                             intrinsic, extrinsic, h, w, block_resolution,
@@ -319,9 +385,12 @@ void ExtractPointCloud(const core::Tensor& block_indices,
                        float voxel_size,
                        float weight_threshold,
                        int& valid_size) {
-    using tsdf_t = float;
+    core::Dtype block_tsdf_dtype = core::Dtype::Float32;
     core::Dtype block_weight_dtype = core::Dtype::Float32;
     core::Dtype block_color_dtype = core::Dtype::Float32;
+    if (block_value_map.Contains("tsdf")) {
+        block_tsdf_dtype = block_value_map.at("tsdf").GetDtype();
+    }
     if (block_value_map.Contains("weight")) {
         block_weight_dtype = block_value_map.at("weight").GetDtype();
     }
@@ -332,7 +401,8 @@ void ExtractPointCloud(const core::Tensor& block_indices,
     core::Device::DeviceType device_type = block_indices.GetDevice().GetType();
     if (device_type == core::Device::DeviceType::CPU) {
         DISPATCH_VALUE_DTYPE_TO_TEMPLATE(
-                block_weight_dtype, block_color_dtype, [&] {
+                block_tsdf_dtype, block_weight_dtype,
+                block_color_dtype, [&] {
                     ExtractPointCloudCPU<tsdf_t, weight_t, color_t>(
                             block_indices, nb_block_indices, nb_block_masks,
                             block_keys, block_value_map, points, normals,
@@ -343,7 +413,8 @@ void ExtractPointCloud(const core::Tensor& block_indices,
     } else if (device_type == core::Device::DeviceType::CUDA) {
 #ifdef BUILD_CUDA_MODULE
         DISPATCH_VALUE_DTYPE_TO_TEMPLATE(
-                block_weight_dtype, block_color_dtype, [&] {
+                block_tsdf_dtype, block_weight_dtype,
+                block_color_dtype, [&] {
                     ExtractPointCloudCUDA<tsdf_t, weight_t, color_t>(
                             block_indices, nb_block_indices, nb_block_masks,
                             block_keys, block_value_map, points, normals,
@@ -362,19 +433,24 @@ void ExtractTriangleMesh(const core::Tensor& block_indices,
                          const core::Tensor& inv_block_indices,
                          const core::Tensor& nb_block_indices,
                          const core::Tensor& nb_block_masks,
+                         const core::Tensor& owned_block_masks,
                          const core::Tensor& block_keys,
                          const TensorMap& block_value_map,
                          core::Tensor& vertices,
                          core::Tensor& triangles,
                          core::Tensor& vertex_normals,
                          core::Tensor& vertex_colors,
+                         core::Tensor& triangle_block_indices,
                          index_t block_resolution,
                          float voxel_size,
                          float weight_threshold,
                          int& vertex_count) {
-    using tsdf_t = float;
+    core::Dtype block_tsdf_dtype = core::Dtype::Float32;
     core::Dtype block_weight_dtype = core::Dtype::Float32;
     core::Dtype block_color_dtype = core::Dtype::Float32;
+    if (block_value_map.Contains("tsdf")) {
+        block_tsdf_dtype = block_value_map.at("tsdf").GetDtype();
+    }
     if (block_value_map.Contains("weight")) {
         block_weight_dtype = block_value_map.at("weight").GetDtype();
     }
@@ -385,24 +461,28 @@ void ExtractTriangleMesh(const core::Tensor& block_indices,
     core::Device::DeviceType device_type = block_indices.GetDevice().GetType();
     if (device_type == core::Device::DeviceType::CPU) {
         DISPATCH_VALUE_DTYPE_TO_TEMPLATE(
-                block_weight_dtype, block_color_dtype, [&] {
+                block_tsdf_dtype, block_weight_dtype,
+                block_color_dtype, [&] {
                     ExtractTriangleMeshCPU<tsdf_t, weight_t, color_t>(
                             block_indices, inv_block_indices, nb_block_indices,
-                            nb_block_masks, block_keys, block_value_map,
-                            vertices, triangles, vertex_normals, vertex_colors,
-                            block_resolution, voxel_size, weight_threshold,
-                            vertex_count);
+                            nb_block_masks, owned_block_masks, block_keys,
+                            block_value_map, vertices, triangles,
+                            vertex_normals, vertex_colors,
+                            triangle_block_indices, block_resolution,
+                            voxel_size, weight_threshold, vertex_count);
                 });
     } else if (device_type == core::Device::DeviceType::CUDA) {
 #ifdef BUILD_CUDA_MODULE
         DISPATCH_VALUE_DTYPE_TO_TEMPLATE(
-                block_weight_dtype, block_color_dtype, [&] {
+                block_tsdf_dtype, block_weight_dtype,
+                block_color_dtype, [&] {
                     ExtractTriangleMeshCUDA<tsdf_t, weight_t, color_t>(
                             block_indices, inv_block_indices, nb_block_indices,
-                            nb_block_masks, block_keys, block_value_map,
-                            vertices, triangles, vertex_normals, vertex_colors,
-                            block_resolution, voxel_size, weight_threshold,
-                            vertex_count);
+                            nb_block_masks, owned_block_masks, block_keys,
+                            block_value_map, vertices, triangles,
+                            vertex_normals, vertex_colors,
+                            triangle_block_indices, block_resolution,
+                            voxel_size, weight_threshold, vertex_count);
                 });
 #else
         utility::LogError("Not compiled with CUDA, but CUDA device is used.");
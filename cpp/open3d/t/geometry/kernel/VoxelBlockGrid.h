@@ -59,6 +59,20 @@ void DepthTouch(std::shared_ptr<core::HashMap>& hashmap,
                 float depth_max,
                 index_t stride);
 
+/// Collects the blocks traversed by the depth rays from the camera center to
+/// sdf_trunc behind the observed depth, for free space carving.
+void DepthRayTouch(std::shared_ptr<core::HashMap>& hashmap,
+                   const core::Tensor& depth,
+                   const core::Tensor& intrinsic,
+                   const core::Tensor& extrinsic,
+                   core::Tensor& voxel_block_coords,
+                   index_t voxel_grid_resolution,
+                   float voxel_size,
+                   float sdf_trunc,
+                   float depth_scale,
+                   float depth_max,
+                   index_t stride);
+
 void GetVoxelCoordinatesAndFlattenedIndices(const core::Tensor& buf_indices,
                                             const core::Tensor& block_keys,
                                             core::Tensor& voxel_coords,
@@ -66,8 +80,16 @@ void GetVoxelCoordinatesAndFlattenedIndices(const core::Tensor& buf_indices,
                                             index_t block_resolution,
                                             float voxel_size);
 
+/// Besides tsdf, weight and color, updates the Float32 log_odds attribute if
+/// allocated: voxels within a voxel of the observed depth are incremented by
+/// log_odds_hit, voxels in front of it by log_odds_miss, clamped to
+/// [log_odds_min, log_odds_max].
+/// A non-empty label image, sampled like color, is fused on the surface band
+/// into either a UInt16 label_count histogram from UInt16 or Int32 label ids,
+/// or a Float32 label_probability from per-class probabilities.
 void Integrate(const core::Tensor& depth,
                const core::Tensor& color,
+               const core::Tensor& label,
                const core::Tensor& block_indices,
                const core::Tensor& block_keys,
                TensorMap& block_value_map,
@@ -78,7 +100,11 @@ void Integrate(const core::Tensor& depth,
                float voxel_size,
                float sdf_trunc,
                float depth_scale,
-               float depth_max);
+               float depth_max,
+               float log_odds_hit,
+               float log_odds_miss,
+               float log_odds_min,
+               float log_odds_max);
 
 void EstimateRange(const core::Tensor& block_keys,
                    core::Tensor& range_minmax_map,
@@ -122,16 +148,21 @@ void ExtractPointCloud(const core::Tensor& block_indices,
                        float weight_threshold,
                        index_t& valid_size);
 
+/// When owned_block_masks is non-empty, only the cubes of the owned blocks are
+/// meshed, and triangle_block_indices is set to the index in block_indices of
+/// the block owning each triangle.
 void ExtractTriangleMesh(const core::Tensor& block_indices,
                          const core::Tensor& inv_block_indices,
                          const core::Tensor& nb_block_indices,
                          const core::Tensor& nb_block_masks,
+                         const core::Tensor& owned_block_masks,
                          const core::Tensor& block_keys,
                          const TensorMap& block_value_map,
                          core::Tensor& vertices,
                          core::Tensor& triangles,
                          core::Tensor& vertex_normals,
                          core::Tensor& vertex_colors,
+                         core::Tensor& triangle_block_indices,
                          index_t block_resolution,
                          float voxel_size,
                          float weight_threshold,
@@ -157,6 +188,18 @@ void DepthTouchCPU(std::shared_ptr<core::HashMap>& hashmap,
                    float depth_max,
                    index_t stride);
 
+void DepthRayTouchCPU(std::shared_ptr<core::HashMap>& hashmap,
+                      const core::Tensor& depth,
+                      const core::Tensor& intrinsic,
+                      const core::Tensor& extrinsic,
+                      core::Tensor& voxel_block_coords,
+                      index_t voxel_grid_resolution,
+                      float voxel_size,
+                      float sdf_trunc,
+                      float depth_scale,
+                      float depth_max,
+                      index_t stride);
+
 void GetVoxelCoordinatesAndFlattenedIndicesCPU(const core::Tensor& buf_indices,
                                                const core::Tensor& block_keys,
                                                core::Tensor& voxel_coords,
@@ -171,6 +214,7 @@ template <typename input_depth_t,
           typename color_t>
 void IntegrateCPU(const core::Tensor& depth,
                   const core::Tensor& color,
+                  const core::Tensor& label,
                   const core::Tensor& block_indices,
                   const core::Tensor& block_keys,
                   TensorMap& block_value_map,
@@ -181,7 +225,11 @@ void IntegrateCPU(const core::Tensor& depth,
                   float voxel_size,
                   float sdf_trunc,
                   float depth_scale,
-                  float depth_max);
+                  float depth_max,
+                  float log_odds_hit,
+                  float log_odds_miss,
+                  float log_odds_min,
+                  float log_odds_max);
 
 void EstimateRangeCPU(const core::Tensor& block_keys,
                       core::Tensor& range_minmax_map,
@@ -232,12 +280,14 @@ void ExtractTriangleMeshCPU(const core::Tensor& block_indices,
                             const core::Tensor& inv_block_indices,
                             const core::Tensor& nb_block_indices,
                             const core::Tensor& nb_block_masks,
+                            const core::Tensor& owned_block_masks,
                             const core::Tensor& block_keys,
                             const TensorMap& block_value_map,
                             core::Tensor& vertices,
                             core::Tensor& triangles,
                             core::Tensor& vertex_normals,
                             core::Tensor& vertex_colors,
+                            core::Tensor& triangle_block_indices,
                             index_t block_resolution,
                             float voxel_size,
                             float weight_threshold,
@@ -263,6 +313,18 @@ void DepthTouchCUDA(std::shared_ptr<core::HashMap>& hashmap,
                     float depth_max,
                     index_t stride);
 
+void DepthRayTouchCUDA(std::shared_ptr<core::HashMap>& hashmap,
+                       const core::Tensor& depth,
+                       const core::Tensor& intrinsic,
+                       const core::Tensor& extrinsic,
+                       core::Tensor& voxel_block_coords,
+                       index_t voxel_grid_resolution,
+                       float voxel_size,
+                       float sdf_trunc,
+                       float depth_scale,
+                       float depth_max,
+                       index_t stride);
+
 void GetVoxelCoordinatesAndFlattenedIndicesCUDA(const core::Tensor& buf_indices,
                                                 const core::Tensor& block_keys,
                                                 core::Tensor& voxel_coords,
@@ -277,6 +339,7 @@ template <typename input_depth_t,
           typename color_t>
 void IntegrateCUDA(const core::Tensor& depth,
                    const core::Tensor& color,
+                   const core::Tensor& label,
                    const core::Tensor& block_indices,
                    const core::Tensor& block_keys,
                    TensorMap& block_value_map,
@@ -287,7 +350,11 @@ void IntegrateCUDA(const core::Tensor& depth,
                    float voxel_size,
                    float sdf_trunc,
                    float depth_scale,
-                   float depth_max);
+                   float depth_max,
+                   float log_odds_hit,
+                   float log_odds_miss,
+                   float log_odds_min,
+                   float log_odds_max);
 
 void EstimateRangeCUDA(const core::Tensor& block_keys,
                        core::Tensor& range_minmax_map,
@@ -338,12 +405,14 @@ void ExtractTriangleMeshCUDA(const core::Tensor& block_indices,
                              const core::Tensor& inv_block_indices,
                              const core::Tensor& nb_block_indices,
                              const core::Tensor& nb_block_masks,
+                             const core::Tensor& owned_block_masks,
                              const core::Tensor& block_keys,
                              const TensorMap& block_value_map,
                              core::Tensor& vertices,
                              core::Tensor& triangles,
                              core::Tensor& vertex_normals,
                              core::Tensor& vertex_colors,
+                             core::Tensor& triangle_block_indices,
                              index_t block_resolution,
                              float voxel_size,
                              float weight_threshold,
@@ -219,14 +219,97 @@ void DepthTouchCPU(std::shared_ptr<core::HashMap> &hashmap,
     }
 }
 
+void DepthRayTouchCPU(std::shared_ptr<core::HashMap> &hashmap,
+                      const core::Tensor &depth,
+                      const core::Tensor &intrinsic,
+                      const core::Tensor &extrinsic,
+                      core::Tensor &voxel_block_coords,
+                      index_t voxel_grid_resolution,
+                      float voxel_size,
+                      float sdf_trunc,
+                      float depth_scale,
+                      float depth_max,
+                      index_t stride) {
+    core::Device device = depth.GetDevice();
+    NDArrayIndexer depth_indexer(depth, 2);
+    core::Tensor pose = t::geometry::InverseTransformation(extrinsic);
+    TransformIndexer ti(intrinsic, pose, 1.0f);
+
+    index_t rows_strided = depth_indexer.GetShape(0) / stride;
+    index_t cols_strided = depth_indexer.GetShape(1) / stride;
+    index_t n = rows_strided * cols_strided;
+
+    index_t resolution = voxel_grid_resolution;
+    float block_size = voxel_size * resolution;
+
+    tbb::concurrent_unordered_set<Coord3i, Coord3iHash> set;
+    DISPATCH_DTYPE_TO_TEMPLATE(depth.GetDtype(), [&]() {
+        core::ParallelFor(device, n, [&](index_t workload_idx) {
+            index_t y = (workload_idx / cols_strided) * stride;
+            index_t x = (workload_idx % cols_strided) * stride;
+
+            float d = *depth_indexer.GetDataPtr<scalar_t>(x, y) / depth_scale;
+            if (d <= 0 || d >= depth_max) {
+                return;
+            }
+
+            // Ray from the camera center to sdf_trunc behind the surface.
+            float t_max = std::min(d + sdf_trunc, depth_max);
+            float x_c = 0, y_c = 0, z_c = 0;
+            ti.Unproject(static_cast<float>(x), static_cast<float>(y), t_max,
+                         &x_c, &y_c, &z_c);
+            float x_e = 0, y_e = 0, z_e = 0;
+            ti.RigidTransform(x_c, y_c, z_c, &x_e, &y_e, &z_e);
+            float x_o = 0, y_o = 0, z_o = 0;
+            ti.GetCameraPosition(&x_o, &y_o, &z_o);
+
+            index_t max_steps =
+                    std::abs(static_cast<index_t>(
+                            std::floor(x_e / block_size) -
+                            std::floor(x_o / block_size))) +
+                    std::abs(static_cast<index_t>(
+                            std::floor(y_e / block_size) -
+                            std::floor(y_o / block_size))) +
+                    std::abs(static_cast<index_t>(
+                            std::floor(z_e / block_size) -
+                            std::floor(z_o / block_size))) +
+                    1;
+            TraverseBlocks(x_o, y_o, z_o, x_e, y_e, z_e, block_size, max_steps,
+                           [&](index_t xb, index_t yb, index_t zb) {
+                               set.emplace(xb, yb, zb);
+                           });
+        });
+    });
+
+    index_t block_count = set.size();
+    if (block_count == 0) {
+        utility::LogError(
+                "No block is touched in TSDF volume, abort integration. Please "
+                "check specified parameters, "
+                "especially depth_scale and voxel_size");
+    }
+
+    voxel_block_coords = core::Tensor({block_count, 3}, core::Int32, device);
+    index_t *block_coords_ptr = voxel_block_coords.GetDataPtr<index_t>();
+    index_t count = 0;
+    for (auto it = set.begin(); it != set.end(); ++it, ++count) {
+        index_t offset = count * 3;
+        block_coords_ptr[offset + 0] = static_cast<index_t>(it->x_);
+        block_coords_ptr[offset + 1] = static_cast<index_t>(it->y_);
+        block_coords_ptr[offset + 2] = static_cast<index_t>(it->z_);
+    }
+}
+
 #define FN_ARGUMENTS                                                          \
     const core::Tensor &depth, const core::Tensor &color,                     \
-            const core::Tensor &indices, const core::Tensor &block_keys,      \
+            const core::Tensor &label, const core::Tensor &indices,           \
+            const core::Tensor &block_keys,                                   \
             TensorMap &value_tensor_map, const core::Tensor &depth_intrinsic, \
             const core::Tensor &color_intrinsic,                              \
             const core::Tensor &extrinsic, index_t resolution,                \
             float voxel_size, float sdf_trunc, float depth_scale,             \
-            float depth_max
+            float depth_max, float log_odds_hit, float log_odds_miss,         \
+            float log_odds_min, float log_odds_max
 
 template void IntegrateCPU<uint16_t, uint8_t, float, uint16_t, uint16_t>(
         FN_ARGUMENTS);
@@ -235,6 +318,14 @@ template void IntegrateCPU<uint16_t, uint8_t, float, float, float>(
 template void IntegrateCPU<float, float, float, uint16_t, uint16_t>(
         FN_ARGUMENTS);
 template void IntegrateCPU<float, float, float, float, float>(FN_ARGUMENTS);
+template void IntegrateCPU<uint16_t, uint8_t, float, uint16_t, uint8_t>(
+        FN_ARGUMENTS);
+template void IntegrateCPU<uint16_t, uint8_t, int16_t, uint16_t, uint8_t>(
+        FN_ARGUMENTS);
+template void IntegrateCPU<float, float, float, uint16_t, uint8_t>(
+        FN_ARGUMENTS);
+template void IntegrateCPU<float, float, int16_t, uint16_t, uint8_t>(
+        FN_ARGUMENTS);
 
 #undef FN_ARGUMENTS
 
@@ -249,6 +340,8 @@ template void IntegrateCPU<float, float, float, float, float>(FN_ARGUMENTS);
 
 template void RayCastCPU<float, uint16_t, uint16_t>(FN_ARGUMENTS);
 template void RayCastCPU<float, float, float>(FN_ARGUMENTS);
+template void RayCastCPU<float, uint16_t, uint8_t>(FN_ARGUMENTS);
+template void RayCastCPU<int16_t, uint16_t, uint8_t>(FN_ARGUMENTS);
 
 #undef FN_ARGUMENTS
 
@@ -262,6 +355,8 @@ template void RayCastCPU<float, float, float>(FN_ARGUMENTS);
 
 template void ExtractPointCloudCPU<float, uint16_t, uint16_t>(FN_ARGUMENTS);
 template void ExtractPointCloudCPU<float, float, float>(FN_ARGUMENTS);
+template void ExtractPointCloudCPU<float, uint16_t, uint8_t>(FN_ARGUMENTS);
+template void ExtractPointCloudCPU<int16_t, uint16_t, uint8_t>(FN_ARGUMENTS);
 
 #undef FN_ARGUMENTS
 
@@ -269,14 +364,17 @@ template void ExtractPointCloudCPU<float, float, float>(FN_ARGUMENTS);
     const core::Tensor &block_indices, const core::Tensor &inv_block_indices, \
             const core::Tensor &nb_block_indices,                             \
             const core::Tensor &nb_block_masks,                               \
+            const core::Tensor &owned_block_masks,                            \
             const core::Tensor &block_keys, const TensorMap &block_value_map, \
             core::Tensor &vertices, core::Tensor &triangles,                  \
             core::Tensor &vertex_normals, core::Tensor &vertex_colors,        \
-            index_t block_resolution, float voxel_size,                       \
-            float weight_threshold, index_t &vertex_count
+            core::Tensor &triangle_block_indices, index_t block_resolution,   \
+            float voxel_size, float weight_threshold, index_t &vertex_count
 
 template void ExtractTriangleMeshCPU<float, uint16_t, uint16_t>(FN_ARGUMENTS);
 template void ExtractTriangleMeshCPU<float, float, float>(FN_ARGUMENTS);
+template void ExtractTriangleMeshCPU<float, uint16_t, uint8_t>(FN_ARGUMENTS);
+template void ExtractTriangleMeshCPU<int16_t, uint16_t, uint8_t>(FN_ARGUMENTS);
 
 #undef FN_ARGUMENTS
 
@@ -242,17 +242,140 @@ void DepthTouchCUDA(std::shared_ptr<core::HashMap> &hashmap,
                                       block_coordi_ptr[offset_rhs + 2];
                           }
                       });
-    OPEN3D_CUDA_CHECK(cudaDeviceSynchronize());
+    core::cuda::SynchronizeStream();
+}
+
+void DepthRayTouchCUDA(std::shared_ptr<core::HashMap> &hashmap,
+                       const core::Tensor &depth,
+                       const core::Tensor &intrinsic,
+                       const core::Tensor &extrinsic,
+                       core::Tensor &voxel_block_coords,
+                       index_t voxel_grid_resolution,
+                       float voxel_size,
+                       float sdf_trunc,
+                       float depth_scale,
+                       float depth_max,
+                       index_t stride) {
+    core::Device device = depth.GetDevice();
+    NDArrayIndexer depth_indexer(depth, 2);
+    core::Tensor pose = t::geometry::InverseTransformation(extrinsic);
+    TransformIndexer ti(intrinsic, pose, 1.0f);
+
+    index_t rows = depth_indexer.GetShape(0);
+    index_t cols = depth_indexer.GetShape(1);
+    index_t rows_strided = rows / stride;
+    index_t cols_strided = cols / stride;
+    index_t n = rows_strided * cols_strided;
+
+    index_t resolution = voxel_grid_resolution;
+    float block_size = voxel_size * resolution;
+
+    // Bound the blocks per ray by the L1 length of the longest ray, through
+    // an image corner, at depth_max.
+    const double fx = intrinsic[0][0].Item<double>();
+    const double fy = intrinsic[1][1].Item<double>();
+    const double cx = intrinsic[0][2].Item<double>();
+    const double cy = intrinsic[1][2].Item<double>();
+    const double xn = std::max(cx, cols - cx) / fx;
+    const double yn = std::max(cy, rows - cy) / fy;
+    const index_t max_steps = static_cast<index_t>(std::ceil(
+                                      std::sqrt(3.0 * (xn * xn + yn * yn + 1)) *
+                                      depth_max / block_size)) +
+                              4;
+
+    core::Tensor block_coordi({max_steps * n, 3}, core::Int32, device);
+    core::Tensor count(std::vector<index_t>{0}, {1}, core::Int32, device);
+    index_t *count_ptr = count.GetDataPtr<index_t>();
+    index_t *block_coordi_ptr = block_coordi.GetDataPtr<index_t>();
+
+    DISPATCH_DTYPE_TO_TEMPLATE(depth.GetDtype(), [&]() {
+        core::ParallelFor(device, n, [=] OPEN3D_DEVICE(index_t workload_idx) {
+            index_t y = (workload_idx / cols_strided) * stride;
+            index_t x = (workload_idx % cols_strided) * stride;
+
+            float d = *depth_indexer.GetDataPtr<scalar_t>(x, y) / depth_scale;
+            if (d <= 0 || d >= depth_max) {
+                return;
+            }
+
+            // Ray from the camera center to sdf_trunc behind the surface.
+            float t_max = min(d + sdf_trunc, depth_max);
+            float x_c = 0, y_c = 0, z_c = 0;
+            ti.Unproject(static_cast<float>(x), static_cast<float>(y), t_max,
+                         &x_c, &y_c, &z_c);
+            float x_e = 0, y_e = 0, z_e = 0;
+            ti.RigidTransform(x_c, y_c, z_c, &x_e, &y_e, &z_e);
+            float x_o = 0, y_o = 0, z_o = 0;
+            ti.GetCameraPosition(&x_o, &y_o, &z_o);
+
+            index_t steps = abs(static_cast<index_t>(
+                                    floorf(x_e / block_size) -
+                                    floorf(x_o / block_size))) +
+                            abs(static_cast<index_t>(
+                                    floorf(y_e / block_size) -
+                                    floorf(y_o / block_size))) +
+                            abs(static_cast<index_t>(
+                                    floorf(z_e / block_size) -
+                                    floorf(z_o / block_size))) +
+                            1;
+            steps = min(steps, max_steps);
+
+            index_t idx = OPEN3D_ATOMIC_ADD(count_ptr, steps);
+            index_t visited = 0;
+            TraverseBlocks(x_o, y_o, z_o, x_e, y_e, z_e, block_size, steps,
+                           [&](index_t xb, index_t yb, index_t zb) {
+                               index_t offset = (idx + visited) * 3;
+                               block_coordi_ptr[offset + 0] = xb;
+                               block_coordi_ptr[offset + 1] = yb;
+                               block_coordi_ptr[offset + 2] = zb;
+                               ++visited;
+                           });
+            // Pad the slots left by rounding with the last visited block.
+            for (index_t i = visited; i < steps; ++i) {
+                index_t offset = (idx + i) * 3;
+                index_t last = (idx + visited - 1) * 3;
+                block_coordi_ptr[offset + 0] = block_coordi_ptr[last + 0];
+                block_coordi_ptr[offset + 1] = block_coordi_ptr[last + 1];
+                block_coordi_ptr[offset + 2] = block_coordi_ptr[last + 2];
+            }
+        });
+    });
+
+    index_t total_block_count = count[0].Item<index_t>();
+    if (total_block_count == 0) {
+        utility::LogError(
+                "No block is touched in TSDF volume, abort integration. Please "
+                "check specified parameters, especially depth_scale and "
+                "voxel_size");
+    }
+
+    // Rays of adjacent pixels mostly traverse the same blocks. Activate in
+    // chunks that fit in the free capacity, so that the hash map only grows
+    // with the unique blocks.
+    core::Tensor block_addrs, block_masks;
+    for (index_t start = 0; start < total_block_count;) {
+        index_t free_capacity =
+                static_cast<index_t>(hashmap->GetCapacity() - hashmap->Size());
+        index_t end = std::min(total_block_count,
+                               start + std::max(free_capacity, index_t(1)));
+        hashmap->Activate(block_coordi.Slice(0, start, end), block_addrs,
+                          block_masks);
+        start = end;
+    }
+    voxel_block_coords = hashmap->GetKeyTensor().IndexGet(
+            {hashmap->GetActiveIndices().To(core::Int64)});
 }
 
 #define FN_ARGUMENTS                                                      \
     const core::Tensor &depth, const core::Tensor &color,                 \
-            const core::Tensor &indices, const core::Tensor &block_keys,  \
+            const core::Tensor &label, const core::Tensor &indices,       \
+            const core::Tensor &block_keys,                               \
             TensorMap &block_values, const core::Tensor &depth_intrinsic, \
             const core::Tensor &color_intrinsic,                          \
             const core::Tensor &extrinsic, index_t resolution,            \
             float voxel_size, float sdf_trunc, float depth_scale,         \
-            float depth_max
+            float depth_max, float log_odds_hit, float log_odds_miss,     \
+            float log_odds_min, float log_odds_max
 
 template void IntegrateCUDA<uint16_t, uint8_t, float, uint16_t, uint16_t>(
         FN_ARGUMENTS);
@@ -261,6 +384,14 @@ template void IntegrateCUDA<uint16_t, uint8_t, float, float, float>(
 template void IntegrateCUDA<float, float, float, uint16_t, uint16_t>(
         FN_ARGUMENTS);
 template void IntegrateCUDA<float, float, float, float, float>(FN_ARGUMENTS);
+template void IntegrateCUDA<uint16_t, uint8_t, float, uint16_t, uint8_t>(
+        FN_ARGUMENTS);
+template void IntegrateCUDA<uint16_t, uint8_t, int16_t, uint16_t, uint8_t>(
+        FN_ARGUMENTS);
+template void IntegrateCUDA<float, float, float, uint16_t, uint8_t>(
+        FN_ARGUMENTS);
+template void IntegrateCUDA<float, float, int16_t, uint16_t, uint8_t>(
+        FN_ARGUMENTS);
 
 #undef FN_ARGUMENTS
 
@@ -275,6 +406,8 @@ template void IntegrateCUDA<float, float, float, float, float>(FN_ARGUMENTS);
 
 template void RayCastCUDA<float, uint16_t, uint16_t>(FN_ARGUMENTS);
 template void RayCastCUDA<float, float, float>(FN_ARGUMENTS);
+template void RayCastCUDA<float, uint16_t, uint8_t>(FN_ARGUMENTS);
+template void RayCastCUDA<int16_t, uint16_t, uint8_t>(FN_ARGUMENTS);
 
 #undef FN_ARGUMENTS
 
@@ -288,6 +421,8 @@ template void RayCastCUDA<float, float, float>(FN_ARGUMENTS);
 
 template void ExtractPointCloudCUDA<float, uint16_t, uint16_t>(FN_ARGUMENTS);
 template void ExtractPointCloudCUDA<float, float, float>(FN_ARGUMENTS);
+template void ExtractPointCloudCUDA<float, uint16_t, uint8_t>(FN_ARGUMENTS);
+template void ExtractPointCloudCUDA<int16_t, uint16_t, uint8_t>(FN_ARGUMENTS);
 
 #undef FN_ARGUMENTS
 
@@ -310,14 +445,17 @@ void ExtractTriangleMeshCUDA(const core::Tensor &block_indices,
     const core::Tensor &block_indices, const core::Tensor &inv_block_indices, \
             const core::Tensor &nb_block_indices,                             \
             const core::Tensor &nb_block_masks,                               \
+            const core::Tensor &owned_block_masks,                            \
             const core::Tensor &block_keys, const TensorMap &block_value_map, \
             core::Tensor &vertices, core::Tensor &triangles,                  \
             core::Tensor &vertex_normals, core::Tensor &vertex_colors,        \
-            index_t block_resolution, float voxel_size,                       \
-            float weight_threshold, index_t &vertex_count
+            core::Tensor &triangle_block_indices, index_t block_resolution,   \
+            float voxel_size, float weight_threshold, index_t &vertex_count
 
 template void ExtractTriangleMeshCUDA<float, uint16_t, uint16_t>(FN_ARGUMENTS);
 template void ExtractTriangleMeshCUDA<float, float, float>(FN_ARGUMENTS);
+template void ExtractTriangleMeshCUDA<float, uint16_t, uint8_t>(FN_ARGUMENTS);
+template void ExtractTriangleMeshCUDA<int16_t, uint16_t, uint8_t>(FN_ARGUMENTS);
 
 #undef FN_ARGUMENTS
 
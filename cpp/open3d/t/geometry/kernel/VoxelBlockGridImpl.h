@@ -37,6 +37,7 @@
 #include "open3d/t/geometry/kernel/GeometryIndexer.h"
 #include "open3d/t/geometry/kernel/GeometryMacros.h"
 #include "open3d/t/geometry/kernel/VoxelBlockGrid.h"
+#include "open3d/utility/Cancellation.h"
 #include "open3d/utility/Logging.h"
 #include "open3d/utility/Timer.h"
 
@@ -127,6 +128,86 @@ DeviceGetLinearIdx(index_t xo,
            xn;
 }
 
+/// Decode a stored TSDF value to a float in [-1, 1]. Int16 TSDF values are
+/// stored in fixed point with a scale of 32767.
+template <typename tsdf_t>
+inline OPEN3D_HOST_DEVICE float DecodeTSDF(tsdf_t tsdf) {
+    return static_cast<float>(tsdf);
+}
+
+template <>
+inline OPEN3D_HOST_DEVICE float DecodeTSDF<int16_t>(int16_t tsdf) {
+    return static_cast<float>(tsdf) * (1.0f / 32767.0f);
+}
+
+/// Encode a float TSDF value in [-1, 1] to the stored type.
+template <typename tsdf_t>
+inline OPEN3D_HOST_DEVICE tsdf_t EncodeTSDF(float tsdf) {
+    return static_cast<tsdf_t>(tsdf);
+}
+
+template <>
+inline OPEN3D_HOST_DEVICE int16_t EncodeTSDF<int16_t>(float tsdf) {
+    tsdf = tsdf < -1.0f ? -1.0f : (tsdf > 1.0f ? 1.0f : tsdf);
+    return static_cast<int16_t>(roundf(tsdf * 32767.0f));
+}
+
+/// Encode a float color value in [0, 255] to the stored type. UInt8 colors are
+/// rounded to avoid the bias of truncation over repeated integrations.
+template <typename color_t>
+inline OPEN3D_HOST_DEVICE color_t EncodeColor(float color) {
+    return static_cast<color_t>(color);
+}
+
+template <>
+inline OPEN3D_HOST_DEVICE uint8_t EncodeColor<uint8_t>(float color) {
+    color = color < 0.0f ? 0.0f : (color > 255.0f ? 255.0f : color);
+    return static_cast<uint8_t>(color + 0.5f);
+}
+
+/// Visit the blocks of size block_size traversed by the segment from
+/// (x0, y0, z0) to (x1, y1, z1) in order, using the 3D DDA of Amanatides and
+/// Woo. At most max_steps blocks are visited.
+template <typename Func>
+inline OPEN3D_HOST_DEVICE void TraverseBlocks(float x0,
+                                              float y0,
+                                              float z0,
+                                              float x1,
+                                              float y1,
+                                              float z1,
+                                              float block_size,
+                                              index_t max_steps,
+                                              Func visit) {
+    const float kInf = 1e30f;
+    const float d[3] = {x1 - x0, y1 - y0, z1 - z0};
+    const float o[3] = {x0, y0, z0};
+
+    index_t b[3], step[3];
+    float t_max[3], t_delta[3];
+    for (int i = 0; i < 3; ++i) {
+        b[i] = static_cast<index_t>(floorf(o[i] / block_size));
+        step[i] = d[i] > 0 ? 1 : (d[i] < 0 ? -1 : 0);
+        if (step[i] == 0) {
+            t_max[i] = kInf;
+            t_delta[i] = kInf;
+        } else {
+            float boundary = (b[i] + (step[i] > 0 ? 1 : 0)) * block_size;
+            t_max[i] = (boundary - o[i]) / d[i];
+            t_delta[i] = block_size / fabsf(d[i]);
+        }
+    }
+
+    for (index_t s = 0; s < max_steps; ++s) {
+        visit(b[0], b[1], b[2]);
+
+        int axis = t_max[0] < t_max[1] ? (t_max[0] < t_max[2] ? 0 : 2)
+                                       : (t_max[1] < t_max[2] ? 1 : 2);
+        if (t_max[axis] > 1.0f) break;
+        b[axis] += step[axis];
+        t_max[axis] += t_delta[axis];
+    }
+}
+
 template <typename tsdf_t>
 inline OPEN3D_DEVICE void DeviceGetNormal(
         const tsdf_t* tsdf_base_ptr,
@@ -150,9 +231,18 @@ inline OPEN3D_DEVICE void DeviceGetNormal(
     index_t vyn = GetLinearIdx(xo, yo - 1, zo);
     index_t vzp = GetLinearIdx(xo, yo, zo + 1);
     index_t vzn = GetLinearIdx(xo, yo, zo - 1);
-    if (vxp >= 0 && vxn >= 0) n[0] = tsdf_base_ptr[vxp] - tsdf_base_ptr[vxn];
-    if (vyp >= 0 && vyn >= 0) n[1] = tsdf_base_ptr[vyp] - tsdf_base_ptr[vyn];
-    if (vzp >= 0 && vzn >= 0) n[2] = tsdf_base_ptr[vzp] - tsdf_base_ptr[vzn];
+    if (vxp >= 0 && vxn >= 0) {
+        n[0] = DecodeTSDF(tsdf_base_ptr[vxp]) -
+               DecodeTSDF(tsdf_base_ptr[vxn]);
+    }
+    if (vyp >= 0 && vyn >= 0) {
+        n[1] = DecodeTSDF(tsdf_base_ptr[vyp]) -
+               DecodeTSDF(tsdf_base_ptr[vyn]);
+    }
+    if (vzp >= 0 && vzn >= 0) {
+        n[2] = DecodeTSDF(tsdf_base_ptr[vzp]) -
+               DecodeTSDF(tsdf_base_ptr[vzn]);
+    }
 };
 
 template <typename input_depth_t,
@@ -167,6 +257,7 @@ void IntegrateCPU
 #endif
         (const core::Tensor& depth,
          const core::Tensor& color,
+         const core::Tensor& label,
          const core::Tensor& indices,
          const core::Tensor& block_keys,
          TensorMap& block_value_map,
@@ -177,7 +268,11 @@ void IntegrateCPU
          float voxel_size,
          float sdf_trunc,
          float depth_scale,
-         float depth_max) {
+         float depth_max,
+         float log_odds_hit,
+         float log_odds_miss,
+         float log_odds_min,
+         float log_odds_max) {
     // Parameters
     index_t resolution2 = resolution * resolution;
     index_t resolution3 = resolution2 * resolution;
@@ -195,18 +290,30 @@ void IntegrateCPU
 
     const index_t* indices_ptr = indices.GetDataPtr<index_t>();
 
-    if (!block_value_map.Contains("tsdf") ||
-        !block_value_map.Contains("weight")) {
+    bool integrate_tsdf = block_value_map.Contains("tsdf") &&
+                          block_value_map.Contains("weight");
+    bool integrate_occupancy = block_value_map.Contains("log_odds");
+    if (!integrate_tsdf && !integrate_occupancy) {
         utility::LogError(
-                "TSDF and/or weight not allocated in blocks, please implement "
-                "customized integration.");
+                "Neither TSDF and weight nor log_odds allocated in blocks, "
+                "please implement customized integration.");
+    }
+    tsdf_t* tsdf_base_ptr = nullptr;
+    weight_t* weight_base_ptr = nullptr;
+    if (integrate_tsdf) {
+        tsdf_base_ptr = block_value_map.at("tsdf").GetDataPtr<tsdf_t>();
+        weight_base_ptr = block_value_map.at("weight").GetDataPtr<weight_t>();
+    }
+    float* log_odds_base_ptr = nullptr;
+    if (integrate_occupancy) {
+        core::AssertTensorDtype(block_value_map.at("log_odds"),
+                                core::Float32);
+        log_odds_base_ptr = block_value_map.at("log_odds").GetDataPtr<float>();
     }
-    tsdf_t* tsdf_base_ptr = block_value_map.at("tsdf").GetDataPtr<tsdf_t>();
-    weight_t* weight_base_ptr =
-            block_value_map.at("weight").GetDataPtr<weight_t>();
 
-    bool integrate_color =
-            block_value_map.Contains("color") && color.NumElements() > 0;
+    bool integrate_color = integrate_tsdf &&
+                           block_value_map.Contains("color") &&
+                           color.NumElements() > 0;
     color_t* color_base_ptr = nullptr;
     ArrayIndexer color_indexer;
 
@@ -221,6 +328,34 @@ void IntegrateCPU
         }
     }
 
+    // Labels are sampled like colors. Either label ids are counted in a
+    // histogram, or per-class probabilities are fused by Bayesian updates.
+    bool integrate_label_count = integrate_tsdf &&
+                                 block_value_map.Contains("label_count") &&
+                                 label.NumElements() > 0;
+    bool integrate_label_probability =
+            integrate_tsdf && block_value_map.Contains("label_probability") &&
+            label.NumElements() > 0;
+    uint16_t* label_count_base_ptr = nullptr;
+    float* label_probability_base_ptr = nullptr;
+    ArrayIndexer label_indexer;
+    bool label_is_int32 = false;
+    index_t num_labels = 0;
+    if (integrate_label_count) {
+        core::Tensor label_count = block_value_map.at("label_count");
+        label_count_base_ptr = label_count.GetDataPtr<uint16_t>();
+        num_labels = static_cast<index_t>(label_count.GetShape().back());
+        label_is_int32 = label.GetDtype() == core::Int32;
+        label_indexer = ArrayIndexer(label, 2);
+    } else if (integrate_label_probability) {
+        core::Tensor label_probability =
+                block_value_map.at("label_probability");
+        label_probability_base_ptr = label_probability.GetDataPtr<float>();
+        num_labels = static_cast<index_t>(label_probability.GetShape().back());
+        label_indexer = ArrayIndexer(label, 2);
+    }
+    bool integrate_label = integrate_label_count || integrate_label_probability;
+
     index_t n = indices.GetLength() * resolution3;
     core::ParallelFor(device, n, [=] OPEN3D_DEVICE(index_t workload_idx) {
         // Natural index (0, N) -> (block_idx, voxel_idx)
@@ -268,21 +403,36 @@ void IntegrateCPU
         if (depth <= 0 || depth > depth_max || zc <= 0 || sdf < -sdf_trunc) {
             return;
         }
-        sdf = sdf < sdf_trunc ? sdf : sdf_trunc;
-        sdf /= sdf_trunc;
 
         index_t linear_idx = block_idx * resolution3 + voxel_idx;
 
+        // Occupancy: the voxels around the observed depth are hit, and the
+        // voxels in front of it are passed through by the ray.
+        if (integrate_occupancy && sdf >= -voxel_size) {
+            float* log_odds_ptr = log_odds_base_ptr + linear_idx;
+            float log_odds = *log_odds_ptr +
+                             (sdf > voxel_size ? log_odds_miss : log_odds_hit);
+            log_odds = log_odds < log_odds_min ? log_odds_min : log_odds;
+            *log_odds_ptr = log_odds > log_odds_max ? log_odds_max : log_odds;
+        }
+        if (!integrate_tsdf) {
+            return;
+        }
+
+        // Labels are only fused on the surface band, not in free space.
+        bool in_band = sdf < sdf_trunc;
+        sdf = in_band ? sdf : sdf_trunc;
+        sdf /= sdf_trunc;
+
         tsdf_t* tsdf_ptr = tsdf_base_ptr + linear_idx;
         weight_t* weight_ptr = weight_base_ptr + linear_idx;
 
         float inv_wsum = 1.0f / (*weight_ptr + 1);
         float weight = *weight_ptr;
-        *tsdf_ptr = (weight * (*tsdf_ptr) + sdf) * inv_wsum;
-
-        if (integrate_color) {
-            color_t* color_ptr = color_base_ptr + 3 * linear_idx;
+        *tsdf_ptr = EncodeTSDF<tsdf_t>(
+                (weight * DecodeTSDF(*tsdf_ptr) + sdf) * inv_wsum);
 
+        if (integrate_color || (integrate_label && in_band)) {
             // Unproject ui, vi with depth_intrinsic, then project back with
             // color_intrinsic
             float x, y, z;
@@ -290,17 +440,61 @@ void IntegrateCPU
 
             float uf, vf;
             colormap_indexer.Project(x, y, z, &uf, &vf);
-            if (color_indexer.InBoundary(uf, vf)) {
-                ui = round(uf);
-                vi = round(vf);
+            index_t uc = round(uf);
+            index_t vc = round(vf);
 
+            if (integrate_color && color_indexer.InBoundary(uf, vf)) {
+                color_t* color_ptr = color_base_ptr + 3 * linear_idx;
                 input_color_t* input_color_ptr =
-                        color_indexer.GetDataPtr<input_color_t>(ui, vi);
+                        color_indexer.GetDataPtr<input_color_t>(uc, vc);
 
                 for (index_t i = 0; i < 3; ++i) {
-                    color_ptr[i] = (weight * color_ptr[i] +
-                                    input_color_ptr[i] * color_multiplier) *
-                                   inv_wsum;
+                    color_ptr[i] = EncodeColor<color_t>(
+                            (weight * color_ptr[i] +
+                             input_color_ptr[i] * color_multiplier) *
+                            inv_wsum);
+                }
+            }
+
+            if (integrate_label_count && in_band &&
+                label_indexer.InBoundary(uf, vf)) {
+                index_t l = label_is_int32
+                                    ? *label_indexer.GetDataPtr<int>(uc, vc)
+                                    : *label_indexer.GetDataPtr<uint16_t>(uc,
+                                                                          vc);
+                if (l >= 0 && l < num_labels) {
+                    uint16_t* count_ptr =
+                            label_count_base_ptr + num_labels * linear_idx + l;
+                    if (*count_ptr < 65535) {
+                        *count_ptr += 1;
+                    }
+                }
+            } else if (integrate_label_probability && in_band &&
+                       label_indexer.InBoundary(uf, vf)) {
+                float* prob_ptr =
+                        label_probability_base_ptr + num_labels * linear_idx;
+                const float* input_prob_ptr =
+                        label_indexer.GetDataPtr<float>(uc, vc);
+
+                // Floor the likelihoods so that a single confident
+                // misprediction cannot zero out a class.
+                const float kMinProbability = 1e-4f;
+                float prior_sum = 0, posterior_sum = 0;
+                for (index_t i = 0; i < num_labels; ++i) {
+                    prior_sum += prob_ptr[i];
+                }
+                for (index_t i = 0; i < num_labels; ++i) {
+                    float likelihood = input_prob_ptr[i] > kMinProbability
+                                               ? input_prob_ptr[i]
+                                               : kMinProbability;
+                    // A voxel without prior takes the first observation.
+                    prob_ptr[i] = prior_sum > 0 ? prob_ptr[i] * likelihood
+                                                : likelihood;
+                    posterior_sum += prob_ptr[i];
+                }
+                float inv_posterior_sum = 1.0f / posterior_sum;
+                for (index_t i = 0; i < num_labels; ++i) {
+                    prob_ptr[i] *= inv_posterior_sum;
                 }
             }
         }
@@ -308,7 +502,7 @@ void IntegrateCPU
     });
 
 #if defined(__CUDACC__)
-    core::cuda::Synchronize();
+    core::cuda::SynchronizeStream();
 #endif
 }
 
@@ -498,7 +692,7 @@ void EstimateRangeCPU
 #endif
             });
 #if defined(__CUDACC__)
-    core::cuda::Synchronize();
+    core::cuda::SynchronizeStream();
 #endif
 }
 
@@ -671,7 +865,9 @@ void RayCastCPU
     using std::sqrt;
 #endif
 
-    core::ParallelFor(device, n, [=] OPEN3D_DEVICE(index_t workload_idx) {
+    // Rays differ a lot in length, so the CPU schedules the pixels
+    // dynamically in chunks of 64.
+    core::ParallelFor(device, n, 64, [=] OPEN3D_DEVICE(index_t workload_idx) {
         auto GetLinearIdxAtP = [&] OPEN3D_DEVICE(
                                        index_t x_b, index_t y_b, index_t z_b,
                                        index_t x_v, index_t y_v, index_t z_v,
@@ -866,17 +1062,32 @@ void RayCastCPU
 
         MiniVecCache cache{0, 0, 0, -1};
         bool surface_found = false;
+        bool prev_missing = false;
+        // Until this t, empty space is stepped over voxel by voxel.
+        float t_fine_max = -1.0f;
         while (t < t_max) {
             index_t linear_idx =
                     GetLinearIdxAtT(x_o, y_o, z_o, x_d, y_d, z_d, t, cache);
 
             if (linear_idx < 0) {
                 t_prev = t;
-                t += block_size;
+                t += t < t_fine_max ? voxel_size : block_size;
+                prev_missing = true;
             } else {
                 tsdf_prev = tsdf;
-                tsdf = tsdf_base_ptr[linear_idx];
+                tsdf = DecodeTSDF(tsdf_base_ptr[linear_idx]);
                 w = weight_base_ptr[linear_idx];
+                // A block step may have jumped over the zero crossing when
+                // the previous blocks are not allocated, e.g. at the boundary
+                // of a partition. March from the last empty sample again.
+                if (prev_missing && w >= weight_threshold && tsdf <= 0 &&
+                    t_fine_max < 0) {
+                    t_fine_max = t;
+                    t = t_prev + voxel_size;
+                    tsdf = 1.0f;
+                    continue;
+                }
+                prev_missing = false;
                 if (tsdf_prev > 0 && w >= weight_threshold && tsdf <= 0) {
                     surface_found = true;
                     break;
@@ -959,7 +1170,8 @@ void RayCastCPU
                         index_ptr[k] = linear_idx_k;
                     }
 
-                    float tsdf_k = tsdf_base_ptr[linear_idx_k];
+                    float tsdf_k =
+                            DecodeTSDF(tsdf_base_ptr[linear_idx_k]);
                     float interp_ratio_dx = ry * rz * (2 * dx_v - 1);
                     float interp_ratio_dy = rx * rz * (2 * dy_v - 1);
                     float interp_ratio_dz = rx * ry * (2 * dz_v - 1);
@@ -1018,7 +1230,7 @@ void RayCastCPU
     });
 
 #if defined(__CUDACC__)
-    core::cuda::Synchronize();
+    core::cuda::SynchronizeStream();
 #endif
 }
 
@@ -1111,7 +1323,7 @@ void ExtractPointCloudCPU
             voxel_indexer.WorkloadToCoord(voxel_idx, &xv, &yv, &zv);
 
             index_t linear_idx = block_idx * resolution3 + voxel_idx;
-            float tsdf_o = tsdf_base_ptr[linear_idx];
+            float tsdf_o = DecodeTSDF(tsdf_base_ptr[linear_idx]);
             float weight_o = weight_base_ptr[linear_idx];
             if (weight_o <= weight_threshold) return;
 
@@ -1122,7 +1334,7 @@ void ExtractPointCloudCPU
                                      zv + (i == 2), workload_block_idx);
                 if (linear_idx_i < 0) continue;
 
-                float tsdf_i = tsdf_base_ptr[linear_idx_i];
+                float tsdf_i = DecodeTSDF(tsdf_base_ptr[linear_idx_i]);
                 float weight_i = weight_base_ptr[linear_idx_i];
                 if (weight_i > weight_threshold && tsdf_i * tsdf_o < 0) {
                     OPEN3D_ATOMIC_ADD(count_ptr, 1);
@@ -1192,7 +1404,7 @@ void ExtractPointCloudCPU
         voxel_indexer.WorkloadToCoord(voxel_idx, &xv, &yv, &zv);
 
         index_t linear_idx = block_idx * resolution3 + voxel_idx;
-        float tsdf_o = tsdf_base_ptr[linear_idx];
+        float tsdf_o = DecodeTSDF(tsdf_base_ptr[linear_idx]);
         float weight_o = weight_base_ptr[linear_idx];
         if (weight_o <= weight_threshold) return;
 
@@ -1212,7 +1424,7 @@ void ExtractPointCloudCPU
                                  workload_block_idx);
             if (linear_idx_i < 0) continue;
 
-            float tsdf_i = tsdf_base_ptr[linear_idx_i];
+            float tsdf_i = DecodeTSDF(tsdf_base_ptr[linear_idx_i]);
             float weight_i = weight_base_ptr[linear_idx_i];
             if (weight_i > weight_threshold && tsdf_i * tsdf_o < 0) {
                 float ratio = (0 - tsdf_o) / (tsdf_i - tsdf_o);
@@ -1275,10 +1487,28 @@ void ExtractPointCloudCPU
     valid_size = total_count;
 
 #if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
-    core::cuda::Synchronize();
+    core::cuda::SynchronizeStream();
 #endif
 }
 
+/// Marks the edge entry of the mesh structure as holding a vertex. Returns
+/// true for exactly one of the cubes sharing the edge, so that the vertices
+/// are counted while the cubes are classified.
+#if defined(__CUDACC__)
+OPEN3D_DEVICE inline bool ClaimEdgeVertex(index_t* entry) {
+    return atomicCAS(entry, 0, -1) == 0;
+}
+#else
+inline bool ClaimEdgeVertex(index_t* entry) {
+    static_assert(sizeof(std::atomic<index_t>) == sizeof(index_t),
+                  "std::atomic<index_t> must have the size of index_t.");
+    std::atomic<index_t>* atomic =
+            reinterpret_cast<std::atomic<index_t>*>(entry);
+    index_t expected = 0;
+    return atomic->compare_exchange_strong(expected, -1);
+}
+#endif
+
 template <typename tsdf_t, typename weight_t, typename color_t>
 #if defined(__CUDACC__)
 void ExtractTriangleMeshCUDA
@@ -1289,12 +1519,14 @@ void ExtractTriangleMeshCPU
          const core::Tensor& inv_block_indices,
          const core::Tensor& nb_block_indices,
          const core::Tensor& nb_block_masks,
+         const core::Tensor& owned_block_masks,
          const core::Tensor& block_keys,
          const TensorMap& block_value_map,
          core::Tensor& vertices,
          core::Tensor& triangles,
          core::Tensor& vertex_normals,
          core::Tensor& vertex_colors,
+         core::Tensor& triangle_block_indices,
          index_t block_resolution,
          float voxel_size,
          float weight_threshold,
@@ -1333,6 +1565,11 @@ void ExtractTriangleMeshCPU
     // Plain arrays that does not require indexers
     const index_t* indices_ptr = block_indices.GetDataPtr<index_t>();
     const index_t* inv_indices_ptr = inv_block_indices.GetDataPtr<index_t>();
+    // Blocks that are not owned only provide the vertices on the boundaries
+    // of the owned blocks, and their own cubes are not meshed.
+    const bool* owned_masks_ptr = owned_block_masks.NumElements() > 0
+                                          ? owned_block_masks.GetDataPtr<bool>()
+                                          : nullptr;
 
     if (!block_value_map.Contains("tsdf") ||
         !block_value_map.Contains("weight")) {
@@ -1349,11 +1586,26 @@ void ExtractTriangleMeshCPU
         color_base_ptr = block_value_map.at("color").GetDataPtr<color_t>();
     }
 
+    // Vertex and triangle counters.
+#if defined(__CUDACC__)
+    core::Tensor count(std::vector<index_t>{0, 0}, {2}, core::Int32, device);
+    index_t* vertex_count_ptr = count.GetDataPtr<index_t>();
+    index_t* triangle_count_ptr = vertex_count_ptr + 1;
+#else
+    std::atomic<index_t> vertex_count_atomic(0);
+    std::atomic<index_t> triangle_count_atomic(0);
+    std::atomic<index_t>* vertex_count_ptr = &vertex_count_atomic;
+    std::atomic<index_t>* triangle_count_ptr = &triangle_count_atomic;
+#endif
+
     index_t n = n_blocks * resolution3;
     // Pass 0: analyze mesh structure, set up one-on-one correspondences
-    // from edges to vertices.
+    // from edges to vertices, and count the vertices and triangles, so that
+    // the outputs are allocated exactly without a counting pass. Most voxels
+    // are far from the surface, so the CPU schedules whole blocks
+    // dynamically.
 
-    core::ParallelFor(device, n, [=] OPEN3D_DEVICE(index_t widx) {
+    core::ParallelFor(device, n, resolution3, [=] OPEN3D_DEVICE(index_t widx) {
         auto GetLinearIdx = [&] OPEN3D_DEVICE(
                                     index_t xo, index_t yo, index_t zo,
                                     index_t curr_block_idx) -> index_t {
@@ -1366,6 +1618,7 @@ void ExtractTriangleMeshCPU
         // Natural index (0, N) -> (block_idx, voxel_idx)
         index_t workload_block_idx = widx / resolution3;
         index_t voxel_idx = widx % resolution3;
+        if (owned_masks_ptr && !owned_masks_ptr[workload_block_idx]) return;
 
         // voxel_idx -> (x_voxel, y_voxel, z_voxel)
         index_t xv, yv, zv;
@@ -1380,7 +1633,7 @@ void ExtractTriangleMeshCPU
                                  zv + vtx_shifts[i][2], workload_block_idx);
             if (linear_idx_i < 0) return;
 
-            float tsdf_i = tsdf_base_ptr[linear_idx_i];
+            float tsdf_i = DecodeTSDF(tsdf_base_ptr[linear_idx_i]);
             float weight_i = weight_base_ptr[linear_idx_i];
             if (weight_i <= weight_threshold) return;
 
@@ -1392,9 +1645,11 @@ void ExtractTriangleMeshCPU
         mesh_struct_ptr[3] = table_idx;
 
         if (table_idx == 0 || table_idx == 255) return;
+        OPEN3D_ATOMIC_ADD(triangle_count_ptr, tri_count[table_idx]);
 
         // Check per-edge sign determine the cube type
         index_t edges_with_vertices = edge_table[table_idx];
+        index_t claimed_vertices = 0;
         for (index_t i = 0; i < 12; ++i) {
             if (edges_with_vertices & (1 << i)) {
                 index_t xv_i = xv + edge_shifts[i][0];
@@ -1418,58 +1673,31 @@ void ExtractTriangleMeshCPU
                                 zv_i - dzb * resolution,
                                 inv_indices_ptr[block_idx_i]);
 
-                // Non-atomic write, but we are safe
-                mesh_ptr_i[edge_i] = -1;
+                // The cubes sharing the edge race for it, and the one that
+                // claims it counts the vertex.
+                if (ClaimEdgeVertex(mesh_ptr_i + edge_i)) {
+                    ++claimed_vertices;
+                }
             }
         }
+        if (claimed_vertices > 0) {
+            OPEN3D_ATOMIC_ADD(vertex_count_ptr, claimed_vertices);
+        }
     });
 
-    // Pass 1: determine valid number of vertices (if not preset)
 #if defined(__CUDACC__)
-    core::Tensor count(std::vector<index_t>{0}, {}, core::Int32, device);
-
-    index_t* count_ptr = count.GetDataPtr<index_t>();
+    core::Tensor counts = count.To(core::Device("CPU:0"));
+    vertex_count = counts[0].Item<index_t>();
+    index_t triangle_count = counts[1].Item<index_t>();
 #else
-    std::atomic<index_t> count_atomic(0);
-    std::atomic<index_t>* count_ptr = &count_atomic;
+    vertex_count = (*vertex_count_ptr).load();
+    index_t triangle_count = (*triangle_count_ptr).load();
 #endif
 
-    if (vertex_count < 0) {
-        core::ParallelFor(device, n, [=] OPEN3D_DEVICE(index_t widx) {
-            // Natural index (0, N) -> (block_idx, voxel_idx)
-            index_t workload_block_idx = widx / resolution3;
-            index_t voxel_idx = widx % resolution3;
-
-            // voxel_idx -> (x_voxel, y_voxel, z_voxel)
-            index_t xv, yv, zv;
-            voxel_indexer.WorkloadToCoord(voxel_idx, &xv, &yv, &zv);
-
-            // Obtain voxel's mesh struct ptr
-            index_t* mesh_struct_ptr =
-                    mesh_structure_indexer.GetDataPtr<index_t>(
-                            xv, yv, zv, workload_block_idx);
-
-            // Early quit -- no allocated vertex to compute
-            if (mesh_struct_ptr[0] != -1 && mesh_struct_ptr[1] != -1 &&
-                mesh_struct_ptr[2] != -1) {
-                return;
-            }
-
-            // Enumerate 3 edges in the voxel
-            for (index_t e = 0; e < 3; ++e) {
-                index_t vertex_idx = mesh_struct_ptr[e];
-                if (vertex_idx != -1) continue;
-
-                OPEN3D_ATOMIC_ADD(count_ptr, 1);
-            }
-        });
-
-#if defined(__CUDACC__)
-        vertex_count = count.Item<index_t>();
-#else
-        vertex_count = (*count_ptr).load();
-#endif
-    }
+    const utility::OperationContext context =
+            utility::OperationContext::Current();
+    context.ReportProgress(30);
+    context.ThrowIfCancelled("ExtractTriangleMesh");
 
     utility::LogDebug("Total vertex count = {}", vertex_count);
     vertices = core::Tensor({vertex_count, 3}, core::Float32, device);
@@ -1487,15 +1715,16 @@ void ExtractTriangleMeshCPU
     ArrayIndexer vertex_indexer(vertices, 1);
 
 #if defined(__CUDACC__)
-    count = core::Tensor(std::vector<index_t>{0}, {}, core::Int32, device);
-    count_ptr = count.GetDataPtr<index_t>();
+    count.Fill(0);
 #else
-    (*count_ptr) = 0;
+    (*vertex_count_ptr) = 0;
+    (*triangle_count_ptr) = 0;
 #endif
 
-    // Pass 2: extract vertices.
+    // Pass 2: extract vertices. Each voxel appends its vertices with a
+    // single atomic operation.
 
-    core::ParallelFor(device, n, [=] OPEN3D_DEVICE(index_t widx) {
+    core::ParallelForMultiISA(device, n, [=] OPEN3D_DEVICE(index_t widx) {
         auto GetLinearIdx = [&] OPEN3D_DEVICE(
                                     index_t xo, index_t yo, index_t zo,
                                     index_t curr_block_idx) -> index_t {
@@ -1544,13 +1773,19 @@ void ExtractTriangleMeshCPU
 
         // Obtain voxel ptr
         index_t linear_idx = resolution3 * block_idx + voxel_idx;
-        float tsdf_o = tsdf_base_ptr[linear_idx];
+        float tsdf_o = DecodeTSDF(tsdf_base_ptr[linear_idx]);
 
         float no[3] = {0}, ne[3] = {0};
 
         // Get normal at origin
         GetNormal(xv, yv, zv, workload_block_idx, no);
 
+        // Reserve the vertices of the voxel at once
+        index_t num_vertices = index_t(mesh_struct_ptr[0] == -1) +
+                               index_t(mesh_struct_ptr[1] == -1) +
+                               index_t(mesh_struct_ptr[2] == -1);
+        index_t idx = OPEN3D_ATOMIC_ADD(vertex_count_ptr, num_vertices);
+
         // Enumerate 3 edges in the voxel
         for (index_t e = 0; e < 3; ++e) {
             index_t vertex_idx = mesh_struct_ptr[e];
@@ -1561,10 +1796,9 @@ void ExtractTriangleMeshCPU
                                  workload_block_idx);
             OPEN3D_ASSERT(linear_idx_e > 0 &&
                           "Internal error: GetVoxelAt returns nullptr.");
-            float tsdf_e = tsdf_base_ptr[linear_idx_e];
+            float tsdf_e = DecodeTSDF(tsdf_base_ptr[linear_idx_e]);
             float ratio = (0 - tsdf_o) / (tsdf_e - tsdf_o);
 
-            index_t idx = OPEN3D_ATOMIC_ADD(count_ptr, 1);
             mesh_struct_ptr[e] = idx;
 
             float ratio_x = ratio * index_t(e == 0);
@@ -1603,21 +1837,26 @@ void ExtractTriangleMeshCPU
                 color_ptr[1] = ((1 - ratio) * g_o + ratio * g_e) / 255.0f;
                 color_ptr[2] = ((1 - ratio) * b_o + ratio * b_e) / 255.0f;
             }
+            ++idx;
         }
     });
 
-    // Pass 3: connect vertices and form triangles.
-    index_t triangle_count = vertex_count * 3;
+    context.ReportProgress(70);
+    context.ThrowIfCancelled("ExtractTriangleMesh");
+
+    // Pass 3: connect vertices and form triangles. Each cube appends its
+    // triangles with a single atomic operation.
+    utility::LogDebug("Total triangle count = {}", triangle_count);
     triangles = core::Tensor({triangle_count, 3}, core::Int32, device);
     ArrayIndexer triangle_indexer(triangles, 1);
+    index_t* triangle_block_ptr = nullptr;
+    if (owned_masks_ptr) {
+        triangle_block_indices =
+                core::Tensor({triangle_count}, core::Int32, device);
+        triangle_block_ptr = triangle_block_indices.GetDataPtr<index_t>();
+    }
 
-#if defined(__CUDACC__)
-    count = core::Tensor(std::vector<index_t>{0}, {}, core::Int32, device);
-    count_ptr = count.GetDataPtr<index_t>();
-#else
-    (*count_ptr) = 0;
-#endif
-    core::ParallelFor(device, n, [=] OPEN3D_DEVICE(index_t widx) {
+    core::ParallelForMultiISA(device, n, [=] OPEN3D_DEVICE(index_t widx) {
         // Natural index (0, N) -> (block_idx, voxel_idx)
         index_t workload_block_idx = widx / resolution3;
         index_t voxel_idx = widx % resolution3;
@@ -1631,12 +1870,16 @@ void ExtractTriangleMeshCPU
                 xv, yv, zv, workload_block_idx);
 
         index_t table_idx = mesh_struct_ptr[3];
-        if (tri_count[table_idx] == 0) return;
-
-        for (index_t tri = 0; tri < 16; tri += 3) {
-            if (tri_table[table_idx][tri] == -1) return;
-
-            index_t tri_idx = OPEN3D_ATOMIC_ADD(count_ptr, 1);
+        index_t num_triangles = tri_count[table_idx];
+        if (num_triangles == 0) return;
+
+        index_t tri_base = OPEN3D_ATOMIC_ADD(triangle_count_ptr, num_triangles);
+        for (index_t k = 0; k < num_triangles; ++k) {
+            index_t tri = 3 * k;
+            index_t tri_idx = tri_base + k;
+            if (triangle_block_ptr) {
+                triangle_block_ptr[tri_idx] = workload_block_idx;
+            }
 
             for (index_t vertex = 0; vertex < 3; ++vertex) {
                 index_t edge = tri_table[table_idx][tri + vertex];
@@ -1669,13 +1912,10 @@ void ExtractTriangleMeshCPU
         }
     });
 
-#if defined(__CUDACC__)
-    triangle_count = count.Item<index_t>();
-#else
-    triangle_count = (*count_ptr).load();
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+    core::cuda::SynchronizeStream();
 #endif
-    utility::LogDebug("Total triangle count = {}", triangle_count);
-    triangles = triangles.Slice(0, 0, triangle_count);
+    context.ReportProgress(100);
 }
 
 }  // namespace voxel_grid
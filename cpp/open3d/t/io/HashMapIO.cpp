@@ -26,8 +26,15 @@
 
 #include "open3d/t/io/HashMapIO.h"
 
+#include <cstring>
+#include <fstream>
+
+#include "open3d/core/ShapeUtil.h"
+#include "open3d/core/TensorCheck.h"
 #include "open3d/t/io/NumpyIO.h"
 #include "open3d/utility/FileSystem.h"
+#include "open3d/utility/Parallel.h"
+
 namespace open3d {
 namespace t {
 namespace io {
@@ -107,6 +114,373 @@ core::HashMap ReadHashMap(const std::string& file_name) {
 
     return hashmap;
 }
+
+namespace {
+
+// Snapshot layout, all sections aligned to kSnapshotAlignment:
+// SnapshotHeader | SnapshotArrayHeader x n_values | buckets | keys | values.
+constexpr char kSnapshotMagic[8] = {'O', '3', 'D', 'H', 'M', 'A', 'P', '\0'};
+constexpr uint32_t kSnapshotVersion = 1;
+constexpr int64_t kSnapshotMaxDims = 8;
+constexpr int64_t kSnapshotAlignment = 64;
+constexpr uint32_t kSnapshotEmptyBucket = 0xFFFFFFFF;
+
+struct SnapshotArrayHeader {
+    int32_t dtype_code;
+    int32_t ndim;
+    int64_t dtype_byte_size;
+    char dtype_name[16];
+    int64_t element_shape[kSnapshotMaxDims];
+    int64_t offset;
+};
+
+struct SnapshotHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t n_values;
+    int64_t count;
+    int64_t bucket_count;
+    int64_t buckets_offset;
+    SnapshotArrayHeader key;
+};
+
+int64_t AlignUp(int64_t offset) {
+    return (offset + kSnapshotAlignment - 1) / kSnapshotAlignment *
+           kSnapshotAlignment;
+}
+
+// FNV-1a over the raw key bytes, followed by a 64-bit finalizer to spread the
+// low bits used for probing.
+uint64_t HashBytes(const uint8_t* data, int64_t size) {
+    uint64_t hash = UINT64_C(14695981039346656037);
+    for (int64_t i = 0; i < size; ++i) {
+        hash ^= data[i];
+        hash *= UINT64_C(1099511628211);
+    }
+    hash ^= hash >> 33;
+    hash *= UINT64_C(0xff51afd7ed558ccd);
+    hash ^= hash >> 33;
+    return hash;
+}
+
+SnapshotArrayHeader MakeArrayHeader(const core::Tensor& tensor) {
+    SnapshotArrayHeader array;
+    std::memset(&array, 0, sizeof(SnapshotArrayHeader));
+
+    core::Dtype dtype = tensor.GetDtype();
+    array.dtype_code = static_cast<int32_t>(dtype.GetDtypeCode());
+    array.dtype_byte_size = dtype.ByteSize();
+    std::strncpy(array.dtype_name, dtype.ToString().c_str(),
+                 sizeof(array.dtype_name) - 1);
+
+    core::SizeVector shape = tensor.GetShape();
+    array.ndim = static_cast<int32_t>(shape.size()) - 1;
+    if (array.ndim > kSnapshotMaxDims) {
+        utility::LogError("Element dimension {} exceeds the maximum {}.",
+                          array.ndim, kSnapshotMaxDims);
+    }
+    for (int32_t i = 0; i < array.ndim; ++i) {
+        array.element_shape[i] = shape[i + 1];
+    }
+    return array;
+}
+
+core::Dtype GetArrayDtype(const SnapshotArrayHeader& array) {
+    return core::Dtype(static_cast<core::Dtype::DtypeCode>(array.dtype_code),
+                       array.dtype_byte_size, array.dtype_name);
+}
+
+core::SizeVector GetArrayElementShape(const SnapshotArrayHeader& array) {
+    return core::SizeVector(array.element_shape,
+                            array.element_shape + array.ndim);
+}
+
+int64_t GetArrayElementByteSize(const SnapshotArrayHeader& array) {
+    return GetArrayElementShape(array).NumElements() * array.dtype_byte_size;
+}
+
+}  // namespace
+
+void WriteHashMapSnapshot(const std::string& file_name,
+                          const core::HashMap& hashmap) {
+    core::Device host("CPU:0");
+
+    core::Tensor active_indices = hashmap.GetActiveIndices().To(core::Int64);
+    core::Tensor keys =
+            hashmap.GetKeyTensor().IndexGet({active_indices}).To(host);
+    std::vector<core::Tensor> values;
+    for (const auto& value_buffer : hashmap.GetValueTensors()) {
+        values.push_back(value_buffer.IndexGet({active_indices}).To(host));
+    }
+
+    const int64_t count = keys.GetLength();
+    if (count >= kSnapshotEmptyBucket) {
+        utility::LogError("Too many entries ({}) for a snapshot.", count);
+    }
+
+    SnapshotHeader header;
+    std::memset(&header, 0, sizeof(SnapshotHeader));
+    std::memcpy(header.magic, kSnapshotMagic, sizeof(kSnapshotMagic));
+    header.version = kSnapshotVersion;
+    header.n_values = static_cast<uint32_t>(values.size());
+    header.count = count;
+    header.key = MakeArrayHeader(keys);
+
+    std::vector<SnapshotArrayHeader> value_headers;
+    for (const auto& value : values) {
+        value_headers.push_back(MakeArrayHeader(value));
+    }
+
+    // Open addressing table over entry indices, with load factor <= 0.5.
+    header.bucket_count = 16;
+    while (header.bucket_count < 2 * count) {
+        header.bucket_count *= 2;
+    }
+    const uint64_t bucket_mask = header.bucket_count - 1;
+    std::vector<uint32_t> buckets(header.bucket_count, kSnapshotEmptyBucket);
+
+    const int64_t key_dsize = GetArrayElementByteSize(header.key);
+    const uint8_t* key_ptr = static_cast<const uint8_t*>(keys.GetDataPtr());
+    for (int64_t i = 0; i < count; ++i) {
+        // Keys are unique, so insertion only looks for an empty bucket.
+        uint64_t pos = HashBytes(key_ptr + i * key_dsize, key_dsize) &
+                       bucket_mask;
+        while (buckets[pos] != kSnapshotEmptyBucket) {
+            pos = (pos + 1) & bucket_mask;
+        }
+        buckets[pos] = static_cast<uint32_t>(i);
+    }
+
+    // Section offsets.
+    int64_t offset = sizeof(SnapshotHeader) +
+                     values.size() * sizeof(SnapshotArrayHeader);
+    header.buckets_offset = AlignUp(offset);
+    offset = header.buckets_offset + header.bucket_count * sizeof(uint32_t);
+    header.key.offset = AlignUp(offset);
+    offset = header.key.offset + count * key_dsize;
+    for (auto& value_header : value_headers) {
+        value_header.offset = AlignUp(offset);
+        offset = value_header.offset +
+                 count * GetArrayElementByteSize(value_header);
+    }
+
+    std::ofstream out(file_name, std::ios::binary);
+    if (!out) {
+        utility::LogError("Failed to open {} for writing.", file_name);
+    }
+    auto write_at = [&](int64_t section_offset, const void* data,
+                        int64_t size) {
+        int64_t pos = static_cast<int64_t>(out.tellp());
+        std::vector<char> padding(section_offset - pos, 0);
+        out.write(padding.data(), padding.size());
+        out.write(static_cast<const char*>(data), size);
+    };
+    write_at(0, &header, sizeof(SnapshotHeader));
+    write_at(sizeof(SnapshotHeader), value_headers.data(),
+             value_headers.size() * sizeof(SnapshotArrayHeader));
+    write_at(header.buckets_offset, buckets.data(),
+             buckets.size() * sizeof(uint32_t));
+    write_at(header.key.offset, keys.Contiguous().GetDataPtr(),
+             count * key_dsize);
+    for (size_t i = 0; i < values.size(); ++i) {
+        write_at(value_headers[i].offset, values[i].Contiguous().GetDataPtr(),
+                 count * GetArrayElementByteSize(value_headers[i]));
+    }
+    if (!out) {
+        utility::LogError("Failed to write {}.", file_name);
+    }
+}
+
+/// Read-only memory mapping of a snapshot file.
+class HashMapSnapshot::MappedSnapshot {
+public:
+    explicit MappedSnapshot(const std::string& file_name) {
+        if (!file_.Open(file_name)) {
+            utility::LogError("Failed to map {}.", file_name);
+        }
+        data_ = file_.GetData();
+        size_ = file_.GetSize();
+
+        // Validate the header and section bounds without touching the data.
+        if (size_ < static_cast<int64_t>(sizeof(SnapshotHeader))) {
+            utility::LogError("{} is not a hash map snapshot.", file_name);
+        }
+        header_ = reinterpret_cast<const SnapshotHeader*>(data_);
+        if (std::memcmp(header_->magic, kSnapshotMagic,
+                        sizeof(kSnapshotMagic)) != 0) {
+            utility::LogError("{} is not a hash map snapshot.", file_name);
+        }
+        if (header_->version != kSnapshotVersion) {
+            utility::LogError("Unsupported snapshot version {} in {}.",
+                              header_->version, file_name);
+        }
+        value_headers_ = reinterpret_cast<const SnapshotArrayHeader*>(
+                data_ + sizeof(SnapshotHeader));
+
+        bool valid = CheckSection(header_->buckets_offset,
+                                  header_->bucket_count * sizeof(uint32_t)) &&
+                     CheckArray(header_->key);
+        for (uint32_t i = 0; i < header_->n_values; ++i) {
+            valid = valid && CheckArray(value_headers_[i]);
+        }
+        if (!valid) {
+            utility::LogError("Corrupted hash map snapshot {}.", file_name);
+        }
+    }
+
+    bool CheckSection(int64_t offset, int64_t size) const {
+        return offset >= 0 && size >= 0 && offset + size <= size_;
+    }
+
+    bool CheckArray(const SnapshotArrayHeader& array) const {
+        return array.ndim >= 0 && array.ndim <= kSnapshotMaxDims &&
+               CheckSection(array.offset,
+                            header_->count * GetArrayElementByteSize(array));
+    }
+
+public:
+    const uint8_t* data_ = nullptr;
+    int64_t size_ = 0;
+    const SnapshotHeader* header_ = nullptr;
+    const SnapshotArrayHeader* value_headers_ = nullptr;
+
+private:
+    utility::filesystem::MappedFile file_;
+};
+
+HashMapSnapshot::HashMapSnapshot(const std::string& file_name)
+    : snapshot_(std::make_shared<MappedSnapshot>(file_name)) {}
+
+int64_t HashMapSnapshot::Size() const { return snapshot_->header_->count; }
+
+core::Dtype HashMapSnapshot::GetKeyDtype() const {
+    return GetArrayDtype(snapshot_->header_->key);
+}
+
+core::SizeVector HashMapSnapshot::GetKeyElementShape() const {
+    return GetArrayElementShape(snapshot_->header_->key);
+}
+
+std::vector<core::Dtype> HashMapSnapshot::GetValueDtypes() const {
+    std::vector<core::Dtype> dtypes;
+    for (uint32_t i = 0; i < snapshot_->header_->n_values; ++i) {
+        dtypes.push_back(GetArrayDtype(snapshot_->value_headers_[i]));
+    }
+    return dtypes;
+}
+
+std::vector<core::SizeVector> HashMapSnapshot::GetValueElementShapes() const {
+    std::vector<core::SizeVector> element_shapes;
+    for (uint32_t i = 0; i < snapshot_->header_->n_values; ++i) {
+        element_shapes.push_back(
+                GetArrayElementShape(snapshot_->value_headers_[i]));
+    }
+    return element_shapes;
+}
+
+// Wrap a mapped array as a tensor. The blob holds a reference to the mapping,
+// which stays alive as long as the tensor is referenced.
+static core::Tensor MappedArrayToTensor(const std::shared_ptr<void>& mapping,
+                                        const uint8_t* data,
+                                        int64_t count,
+                                        const SnapshotArrayHeader& array) {
+    core::SizeVector shape = GetArrayElementShape(array);
+    shape.insert(shape.begin(), count);
+
+    void* data_ptr = const_cast<uint8_t*>(data + array.offset);
+    auto blob = std::make_shared<core::Blob>(core::Device("CPU:0"), data_ptr,
+                                             [mapping](void*) {});
+    return core::Tensor(shape, core::shape_util::DefaultStrides(shape),
+                        data_ptr, GetArrayDtype(array), blob);
+}
+
+core::Tensor HashMapSnapshot::GetKeyTensor() const {
+    return MappedArrayToTensor(snapshot_, snapshot_->data_, Size(),
+                               snapshot_->header_->key);
+}
+
+std::vector<core::Tensor> HashMapSnapshot::GetValueTensors() const {
+    std::vector<core::Tensor> values;
+    for (uint32_t i = 0; i < snapshot_->header_->n_values; ++i) {
+        values.push_back(MappedArrayToTensor(snapshot_, snapshot_->data_,
+                                             Size(),
+                                             snapshot_->value_headers_[i]));
+    }
+    return values;
+}
+
+core::Tensor HashMapSnapshot::GetValueTensor(size_t i) const {
+    if (i >= snapshot_->header_->n_values) {
+        utility::LogError("Value index out-of-bound ({} >= {}).", i,
+                          snapshot_->header_->n_values);
+    }
+    return MappedArrayToTensor(snapshot_, snapshot_->data_, Size(),
+                               snapshot_->value_headers_[i]);
+}
+
+std::pair<core::Tensor, core::Tensor> HashMapSnapshot::Find(
+        const core::Tensor& input_keys) const {
+    core::Device host("CPU:0");
+    core::AssertTensorDevice(input_keys, host);
+    core::AssertTensorDtype(input_keys, GetKeyDtype());
+    core::SizeVector key_shape = GetKeyElementShape();
+    key_shape.insert(key_shape.begin(), input_keys.GetLength());
+    core::AssertTensorShape(input_keys, key_shape);
+
+    const core::Tensor keys = input_keys.Contiguous();
+    const int64_t count = keys.GetLength();
+    core::Tensor indices({count}, core::Int64, host);
+    core::Tensor masks({count}, core::Bool, host);
+
+    const SnapshotHeader* header = snapshot_->header_;
+    const uint64_t bucket_mask = header->bucket_count - 1;
+    const uint32_t* buckets = reinterpret_cast<const uint32_t*>(
+            snapshot_->data_ + header->buckets_offset);
+    const uint8_t* entry_keys = snapshot_->data_ + header->key.offset;
+    const int64_t key_dsize = GetArrayElementByteSize(header->key);
+
+    const uint8_t* query_keys = static_cast<const uint8_t*>(keys.GetDataPtr());
+    int64_t* indices_ptr = indices.GetDataPtr<int64_t>();
+    bool* masks_ptr = masks.GetDataPtr<bool>();
+
+#pragma omp parallel for num_threads(utility::EstimateMaxThreads())
+    for (int64_t i = 0; i < count; ++i) {
+        const uint8_t* key = query_keys + i * key_dsize;
+        indices_ptr[i] = 0;
+        masks_ptr[i] = false;
+        for (uint64_t pos = HashBytes(key, key_dsize) & bucket_mask;;
+             pos = (pos + 1) & bucket_mask) {
+            uint32_t entry = buckets[pos];
+            if (entry == kSnapshotEmptyBucket) {
+                break;
+            }
+            if (std::memcmp(entry_keys + entry * key_dsize, key, key_dsize) ==
+                0) {
+                indices_ptr[i] = entry;
+                masks_ptr[i] = true;
+                break;
+            }
+        }
+    }
+    return std::make_pair(indices, masks);
+}
+
+core::HashMap HashMapSnapshot::ToHashMap(
+        const core::Device& device,
+        const core::HashBackendType& backend) const {
+    core::HashMap hashmap(Size(), GetKeyDtype(), GetKeyElementShape(),
+                          GetValueDtypes(), GetValueElementShapes(), device,
+                          backend);
+
+    std::vector<core::Tensor> values;
+    for (const auto& value : GetValueTensors()) {
+        values.push_back(value.To(device));
+    }
+    core::Tensor buf_indices, masks;
+    hashmap.Insert(GetKeyTensor().To(device), values, buf_indices, masks);
+    return hashmap;
+}
+
 }  // namespace io
 }  // namespace t
 }  // namespace open3d
@@ -26,7 +26,10 @@
 
 #pragma once
 
+#include <memory>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "open3d/core/Tensor.h"
 #include "open3d/core/hashmap/HashMap.h"
@@ -47,6 +50,74 @@ core::HashMap ReadHashMap(const std::string& filename);
 /// \param hashmap HashMap to save.
 void WriteHashMap(const std::string& filename, const core::HashMap& hashmap);
 
+/// Save a hash map's active entries to a memory-mappable snapshot file.
+/// Besides keys and values, the file stores an open addressing table over the
+/// entries, so that it can be queried in place by HashMapSnapshot.
+///
+/// \param filename The snapshot file name to write to.
+/// \param hashmap HashMap to save.
+void WriteHashMapSnapshot(const std::string& filename,
+                          const core::HashMap& hashmap);
+
+/// \class HashMapSnapshot
+///
+/// \brief Read-only view of a hash map snapshot file.
+///
+/// Opening maps the file into memory and only parses the header, so it takes
+/// constant time regardless of the file size. Keys and values are exposed as
+/// CPU tensors sharing the mapped memory and are paged in by the OS on
+/// access. Entries can be queried in place, or copied to a HashMap on any
+/// device.
+class HashMapSnapshot {
+public:
+    /// Memory-map a snapshot file written by WriteHashMapSnapshot.
+    ///
+    /// \param filename The snapshot file name to read from.
+    explicit HashMapSnapshot(const std::string& filename);
+
+    /// Number of entries in the snapshot.
+    int64_t Size() const;
+
+    /// Dtype of the keys.
+    core::Dtype GetKeyDtype() const;
+
+    /// Element shape of the keys.
+    core::SizeVector GetKeyElementShape() const;
+
+    /// Dtypes of the values.
+    std::vector<core::Dtype> GetValueDtypes() const;
+
+    /// Element shapes of the values.
+    std::vector<core::SizeVector> GetValueElementShapes() const;
+
+    /// Key tensor of shape {Size(), key_element_shape} on CPU, sharing the
+    /// mapped memory. Must not be written to.
+    core::Tensor GetKeyTensor() const;
+
+    /// Value tensors of shapes {Size(), value_element_shape} on CPU, sharing
+    /// the mapped memory. Must not be written to.
+    std::vector<core::Tensor> GetValueTensors() const;
+
+    /// The i-th value tensor, see GetValueTensors().
+    core::Tensor GetValueTensor(size_t i = 0) const;
+
+    /// Parallel find an array of keys on CPU in the snapshot.
+    /// Return: indices (Int64) into the key and value tensors.
+    /// Return: masks (Bool) stores if the key is found.
+    std::pair<core::Tensor, core::Tensor> Find(
+            const core::Tensor& input_keys) const;
+
+    /// Create a hash map on \p device with all the entries, copied once from
+    /// the mapped memory.
+    core::HashMap ToHashMap(const core::Device& device = core::Device("CPU:0"),
+                            const core::HashBackendType& backend =
+                                    core::HashBackendType::Default) const;
+
+private:
+    class MappedSnapshot;
+    std::shared_ptr<MappedSnapshot> snapshot_;
+};
+
 }  // namespace io
 }  // namespace t
 }  // namespace open3d
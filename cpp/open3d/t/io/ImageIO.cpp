@@ -26,11 +26,13 @@
 
 #include "open3d/t/io/ImageIO.h"
 
+#include <algorithm>
 #include <unordered_map>
 
 #include "open3d/io/ImageIO.h"
 #include "open3d/utility/FileSystem.h"
 #include "open3d/utility/Logging.h"
+#include "open3d/utility/Parallel.h"
 
 namespace open3d {
 namespace t {
@@ -79,6 +81,60 @@ bool ReadImage(const std::string &filename, geometry::Image &image) {
     return map_itr->second(filename, image);
 }
 
+bool ReadImages(const std::vector<std::string> &filenames,
+                std::vector<geometry::Image> &images) {
+    const int64_t num_images = static_cast<int64_t>(filenames.size());
+    images.assign(num_images, geometry::Image());
+    std::vector<char> success(num_images, 0);
+    // libpng and libjpeg decoders are independent per image.
+#pragma omp parallel for schedule(dynamic) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t i = 0; i < num_images; ++i) {
+        success[i] = ReadImage(filenames[i], images[i]);
+    }
+    return std::find(success.begin(), success.end(), 0) == success.end();
+}
+
+bool ReadImages(const std::vector<std::string> &filenames,
+                core::Tensor &images) {
+    const int64_t num_images = static_cast<int64_t>(filenames.size());
+    if (num_images == 0) {
+        images = core::Tensor({0, 0, 0, 1}, core::UInt8);
+        return true;
+    }
+    // The first image determines the shape of the stack.
+    geometry::Image first;
+    if (!ReadImage(filenames[0], first)) {
+        return false;
+    }
+    const core::SizeVector shape = first.AsTensor().GetShape();
+    const core::Dtype dtype = first.GetDtype();
+    images = core::Tensor(core::shape_util::Concat({num_images}, shape),
+                          dtype);
+    images[0] = first.AsTensor();
+
+    std::vector<char> success(num_images, 1);
+#pragma omp parallel for schedule(dynamic) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t i = 1; i < num_images; ++i) {
+        geometry::Image image;
+        if (!ReadImage(filenames[i], image)) {
+            success[i] = 0;
+        } else if (image.AsTensor().GetShape() != shape ||
+                   image.GetDtype() != dtype) {
+            utility::LogWarning(
+                    "Read images failed: {} has shape {} and dtype {}, but "
+                    "the first image has shape {} and dtype {}.",
+                    filenames[i], image.AsTensor().GetShape(),
+                    image.GetDtype().ToString(), shape, dtype.ToString());
+            success[i] = 0;
+        } else {
+            images[i] = image.AsTensor();
+        }
+    }
+    return std::find(success.begin(), success.end(), 0) == success.end();
+}
+
 bool WriteImage(const std::string &filename,
                 const geometry::Image &image,
                 int quality /* = kOpen3DImageIODefaultQuality*/) {
@@ -27,6 +27,7 @@
 #pragma once
 
 #include <string>
+#include <vector>
 
 #include "open3d/io/ImageIO.h"
 #include "open3d/t/geometry/Image.h"
@@ -48,6 +49,24 @@ std::shared_ptr<geometry::Image> CreateImageFromFile(
 /// \return return true if the read function is successful, false otherwise.
 bool ReadImage(const std::string &filename, geometry::Image &image);
 
+/// Reads a batch of images in parallel.
+/// \param filenames Full paths to the images, see ReadImage().
+/// \param images Receives one image per file.
+/// \return return true if all images are read successfully, false otherwise.
+bool ReadImages(const std::vector<std::string> &filenames,
+                std::vector<geometry::Image> &images);
+
+/// Reads a batch of images with the same size, number of channels and dtype
+/// in parallel into one tensor.
+/// \param filenames Full paths to the images, see ReadImage().
+/// \param images Receives a CPU tensor of shape {N, rows, cols, channels}
+/// with N the number of files. The decoded images are copied into it as they
+/// finish, so only a few decoded images are kept besides the stack.
+/// \return return true if all images are read successfully and have the same
+/// shape and dtype, false otherwise.
+bool ReadImages(const std::vector<std::string> &filenames,
+                core::Tensor &images);
+
 constexpr int kOpen3DImageIODefaultQuality = -1;
 
 /// The general entrance for writing an Image to a file
@@ -159,6 +159,7 @@ static char DtypeToChar(const core::Dtype& dtype) {
     //      std::complex<long double>)
     // '?': object
     if (dtype == core::Float32) return 'f';
+    if (dtype == core::Float16) return 'f';
     if (dtype == core::Float64) return 'f';
     if (dtype == core::Int8) return 'i';
     if (dtype == core::Int16) return 'i';
@@ -532,6 +533,18 @@ public:
         blob_ = std::make_shared<core::Blob>(NumBytes(), core::Device("CPU:0"));
     }
 
+    /// Wraps existing array data, e.g. of a memory-mapped file.
+    NumpyArray(const core::SizeVector& shape,
+               char type,
+               int64_t word_size,
+               bool fortran_order,
+               const std::shared_ptr<core::Blob>& blob)
+        : blob_(blob),
+          shape_(shape),
+          type_(type),
+          word_size_(word_size),
+          fortran_order_(fortran_order) {}
+
     template <typename T>
     T* GetDataPtr() {
         return reinterpret_cast<T*>(blob_->GetDataPtr());
@@ -545,6 +558,7 @@ public:
     core::Dtype GetDtype() const {
         if (type_ == 'f' && word_size_ == 4) return core::Float32;
         if (type_ == 'f' && word_size_ == 8) return core::Float64;
+        if (type_ == 'f' && word_size_ == 2) return core::Float16;
         if (type_ == 'i' && word_size_ == 1) return core::Int8;
         if (type_ == 'i' && word_size_ == 2) return core::Int16;
         if (type_ == 'i' && word_size_ == 4) return core::Int32;
@@ -678,7 +692,47 @@ static NumpyArray CreateNumpyArrayFromCompressedFile(
     return array;
 }
 
-core::Tensor ReadNpy(const std::string& file_name) {
+// Maps the file copy-on-write, so the tensor can be modified without changing
+// the file. The blob keeps the mapping alive.
+static NumpyArray CreateNumpyArrayFromMappedFile(const std::string& file_name) {
+    auto file = std::make_shared<utility::filesystem::MappedFile>();
+    if (!file->Open(file_name, /*copy_on_write=*/true)) {
+        utility::LogError("Failed to map file {}.", file_name);
+    }
+    const size_t preamble_len = 10;  // Version 1.0 assumed.
+    const size_t file_size = static_cast<size_t>(file->GetSize());
+    char* data = reinterpret_cast<char*>(file->GetMutableData());
+    if (file_size < preamble_len ||
+        file_size < preamble_len + ParseNpyPreamble(data)) {
+        utility::LogError("Header preamble cannot be read.");
+    }
+    const size_t header_len = ParseNpyPreamble(data);
+    if (data[preamble_len + header_len - 1] != '\n') {
+        utility::LogError("Numpy header not terminated by null character.");
+    }
+
+    core::SizeVector shape;
+    char type;
+    int64_t word_size;
+    bool fortran_order;
+    std::tie(shape, type, word_size, fortran_order) =
+            ParseNpyHeaderFromBuffer(data);
+    const size_t offset = preamble_len + header_len;
+    const size_t num_bytes =
+            static_cast<size_t>(shape.NumElements() * word_size);
+    if (file_size - offset < num_bytes) {
+        utility::LogError("Failed to read array data.");
+    }
+    auto blob = std::make_shared<core::Blob>(
+            core::Device("CPU:0"), data + offset,
+            [file](void*) mutable { file.reset(); });
+    return NumpyArray(shape, type, word_size, fortran_order, blob);
+}
+
+core::Tensor ReadNpy(const std::string& file_name, bool memory_map) {
+    if (memory_map) {
+        return CreateNumpyArrayFromMappedFile(file_name).ToTensor();
+    }
     utility::filesystem::CFile cfile;
     if (!cfile.Open(file_name, "rb")) {
         utility::LogError("Failed to open file {}, error: {}.", file_name,
@@ -38,7 +38,11 @@ namespace io {
 /// Read Numpy .npy file to a tensor.
 ///
 /// \param file_name The file name to read from.
-core::Tensor ReadNpy(const std::string& file_name);
+/// \param memory_map If true, the returned CPU tensor is backed by a
+/// copy-on-write memory mapping of the file instead of being read into memory.
+/// The data is paged in on first access and writes to the tensor do not change
+/// the file. The mapping is released with the last tensor referring to it.
+core::Tensor ReadNpy(const std::string& file_name, bool memory_map = false);
 
 /// Save a tensor to a Numpy .npy file.
 ///
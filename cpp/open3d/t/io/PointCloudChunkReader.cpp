@@ -0,0 +1,269 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/t/io/PointCloudChunkReader.h"
+
+#include <algorithm>
+#include <cstdio>
+
+#include "open3d/io/ASCIIParser.h"
+#include "open3d/utility/FileSystem.h"
+#include "open3d/utility/Helper.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace t {
+namespace io {
+
+PointCloudChunkReader::PointCloudChunkReader(int64_t chunk_size)
+    : chunk_size_(chunk_size) {
+    if (chunk_size <= 0) {
+        utility::LogError("chunk_size must be positive, but got {}.",
+                          chunk_size);
+    }
+}
+
+std::unique_ptr<PointCloudChunkReader> PointCloudChunkReader::Create(
+        const std::string &filename,
+        int64_t chunk_size,
+        const std::string &format) {
+    std::string file_format = format;
+    if (file_format == "auto") {
+        file_format =
+                utility::filesystem::GetFileExtensionInLowerCase(filename);
+    }
+
+    std::unique_ptr<PointCloudChunkReader> reader;
+    if (file_format == "ply") {
+        reader = CreatePLYChunkReader(chunk_size);
+    } else if (file_format == "pcd") {
+        reader = CreatePCDChunkReader(chunk_size);
+    } else if (file_format == "las") {
+        reader = CreateLASChunkReader(chunk_size);
+    } else if (file_format == "xyz" || file_format == "xyzn" ||
+               file_format == "xyzrgb" || file_format == "xyzi" ||
+               file_format == "pts") {
+        reader = CreateASCIIChunkReader(file_format, chunk_size);
+    } else {
+        utility::LogError("Unsupported file format {} for chunked reading.",
+                          file_format);
+    }
+    if (!reader->Open(filename)) {
+        utility::LogError("Failed to open {} for chunked reading.", filename);
+    }
+    return reader;
+}
+
+namespace {
+
+/// Reads text formats with one point per line through a memory mapping of
+/// the file, parsing each chunk in parallel.
+class ASCIIChunkReader : public PointCloudChunkReader {
+public:
+    ASCIIChunkReader(const std::string &format, int64_t chunk_size)
+        : PointCloudChunkReader(chunk_size), format_(format) {}
+
+    bool Open(const std::string &filename) override {
+        Close();
+        if (!file_.Open(filename)) {
+            utility::LogWarning("Read {} failed: unable to open file: {}",
+                                utility::ToUpper(format_), filename);
+            return false;
+        }
+        begin_ = reinterpret_cast<const char *>(file_.GetData());
+        end_ = begin_ + file_.GetSize();
+        position_ = begin_;
+        if (format_ == "xyz") {
+            num_values_ = 3;
+        } else if (format_ == "xyzn" || format_ == "xyzrgb") {
+            num_values_ = 6;
+        } else if (format_ == "xyzi") {
+            num_values_ = 4;
+        } else if (!OpenPTS()) {
+            Close();
+            return false;
+        }
+        return true;
+    }
+
+    void Close() override {
+        file_.Close();
+        begin_ = end_ = position_ = nullptr;
+        num_points_ = -1;
+        num_points_read_ = 0;
+    }
+
+    bool IsOpened() const override { return file_.IsOpen(); }
+
+    bool IsEOF() const override {
+        return position_ == end_ ||
+               (num_points_ >= 0 && num_points_read_ == num_points_);
+    }
+
+    int64_t GetNumPoints() const override { return num_points_; }
+
+    geometry::PointCloud NextChunk() override {
+        if (!IsOpened()) {
+            utility::LogError("No file is opened.");
+        }
+        int64_t max_rows = chunk_size_;
+        if (num_points_ >= 0) {
+            max_rows = std::min(max_rows, num_points_ - num_points_read_);
+        }
+        // Like the PTS reader, stop at invalid lines in PTS files and skip
+        // them in the other formats.
+        const bool is_pts = format_ == "pts";
+        const open3d::io::ASCIIRows rows = open3d::io::ParseASCIIRows(
+                position_, end_, num_values_, max_rows, !is_pts);
+        if (rows.GetInvalidLine()) {
+            const char *line_end =
+                    std::find(rows.GetInvalidLine(), end_, '\n');
+            utility::LogError("Read PTS failed at line: {}",
+                              std::string(rows.GetInvalidLine(), line_end));
+        }
+        // Fewer rows than requested means that the end of the file was
+        // reached, possibly after trailing invalid lines.
+        position_ = rows.NumRows() < max_rows ? end_ : rows.GetEnd();
+        num_points_read_ += rows.NumRows();
+        return RowsToPointCloud(rows);
+    }
+
+private:
+    // Reads the number of points and detects the columns of a PTS file.
+    bool OpenPTS() {
+        const char *line_end = std::find(position_, end_, '\n');
+        long long num_points = 0;
+        if (position_ < end_) {
+            sscanf(std::string(position_, line_end).c_str(), "%lld",
+                   &num_points);
+        }
+        num_points_ = static_cast<int64_t>(num_points);
+        if (num_points_ < 0) {
+            utility::LogWarning(
+                    "Read PTS failed: number of points must be >= 0.");
+            return false;
+        }
+        position_ = line_end == end_ ? end_ : line_end + 1;
+        num_values_ = 3;
+        if (num_points_ > 0 && position_ < end_) {
+            const std::string line(position_,
+                                   std::find(position_, end_, '\n'));
+            num_values_ =
+                    static_cast<int>(utility::SplitString(line, " ").size());
+            if (num_values_ != 7 && num_values_ != 6 && num_values_ != 4 &&
+                num_values_ != 3) {
+                utility::LogWarning("Read PTS failed: unknown pts format: {}",
+                                    line);
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // Converts parsed rows to the attributes produced by ReadPointCloud().
+    geometry::PointCloud RowsToPointCloud(
+            const open3d::io::ASCIIRows &rows) const {
+        const int64_t num_rows = rows.NumRows();
+        const bool is_pts = format_ == "pts";
+        const bool has_normals = format_ == "xyzn";
+        const bool has_intensities =
+                format_ == "xyzi" ||
+                (is_pts && (num_values_ == 7 || num_values_ == 4));
+        const bool has_colors = format_ == "xyzrgb" ||
+                                (is_pts && num_values_ >= 6);
+        const int color_offset = has_intensities ? 4 : 3;
+
+        geometry::PointCloud pointcloud(
+                core::Tensor({num_rows, 3}, core::Float64));
+        double *points_ptr =
+                pointcloud.GetPointPositions().GetDataPtr<double>();
+        double *normals_ptr = nullptr;
+        double *intensities_ptr = nullptr;
+        double *colors_ptr = nullptr;
+        uint8_t *colors_uint8_ptr = nullptr;
+        if (has_normals) {
+            pointcloud.SetPointNormals(
+                    core::Tensor({num_rows, 3}, core::Float64));
+            normals_ptr = pointcloud.GetPointNormals().GetDataPtr<double>();
+        }
+        if (has_intensities) {
+            pointcloud.SetPointAttr("intensities",
+                                    core::Tensor({num_rows, 1}, core::Float64));
+            intensities_ptr =
+                    pointcloud.GetPointAttr("intensities").GetDataPtr<double>();
+        }
+        if (has_colors && is_pts) {
+            pointcloud.SetPointColors(core::Tensor({num_rows, 3}, core::UInt8));
+            colors_uint8_ptr =
+                    pointcloud.GetPointColors().GetDataPtr<uint8_t>();
+        } else if (has_colors) {
+            pointcloud.SetPointColors(
+                    core::Tensor({num_rows, 3}, core::Float64));
+            colors_ptr = pointcloud.GetPointColors().GetDataPtr<double>();
+        }
+
+        rows.ForEachRow([&](int64_t idx, const double *values) {
+            for (int i = 0; i < 3; ++i) {
+                points_ptr[3 * idx + i] = values[i];
+                if (normals_ptr) {
+                    normals_ptr[3 * idx + i] = values[3 + i];
+                }
+                if (colors_ptr) {
+                    colors_ptr[3 * idx + i] = values[color_offset + i];
+                }
+                if (colors_uint8_ptr) {
+                    colors_uint8_ptr[3 * idx + i] =
+                            static_cast<int>(values[color_offset + i]);
+                }
+            }
+            if (intensities_ptr) {
+                intensities_ptr[idx] = values[3];
+            }
+        });
+        return pointcloud;
+    }
+
+    std::string format_;
+    utility::filesystem::MappedFile file_;
+    const char *begin_ = nullptr;
+    const char *end_ = nullptr;
+    const char *position_ = nullptr;
+    int num_values_ = 3;
+    int64_t num_points_ = -1;
+    int64_t num_points_read_ = 0;
+};
+
+}  // namespace
+
+std::unique_ptr<PointCloudChunkReader> CreateASCIIChunkReader(
+        const std::string &format, int64_t chunk_size) {
+    return std::make_unique<ASCIIChunkReader>(format, chunk_size);
+}
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,117 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "open3d/t/geometry/PointCloud.h"
+
+namespace open3d {
+namespace t {
+namespace io {
+
+/// \class PointCloudChunkReader
+///
+/// \brief Reads a point cloud file in chunks of a fixed number of points.
+///
+/// Only the current chunk is kept in memory, so files larger than the
+/// available memory can be processed piece by piece, e.g. with
+/// geometry::PointCloud::VoxelDownSample() per chunk. The chunks have the same
+/// attributes and dtypes as the point cloud returned by ReadPointCloud(), and
+/// concatenated they are equal to it.
+///
+/// Binary PLY files in native byte order, PCD, uncompressed LAS, XYZ, XYZN,
+/// XYZRGB, XYZI and PTS files are supported. binary_compressed PCD files store
+/// the attributes in columns, so their data is decompressed into memory once
+/// on Open().
+class PointCloudChunkReader {
+public:
+    /// \param chunk_size Maximum number of points per chunk.
+    explicit PointCloudChunkReader(int64_t chunk_size);
+    virtual ~PointCloudChunkReader() {}
+
+    /// Open a point cloud file.
+    ///
+    /// \param filename Path to the point cloud file.
+    virtual bool Open(const std::string &filename) = 0;
+
+    /// Close the opened file.
+    virtual void Close() = 0;
+
+    /// Check if a file is opened.
+    virtual bool IsOpened() const = 0;
+
+    /// Check if all points of the file have been read.
+    virtual bool IsEOF() const = 0;
+
+    /// Get the number of points in the file, or -1 if it is only known after
+    /// reading the whole file, e.g. for XYZ files.
+    virtual int64_t GetNumPoints() const = 0;
+
+    /// Read the next chunk of at most GetChunkSize() points. Returns an empty
+    /// point cloud if all points have been read.
+    virtual geometry::PointCloud NextChunk() = 0;
+
+    /// Get the maximum number of points per chunk.
+    int64_t GetChunkSize() const { return chunk_size_; }
+
+    /// Factory function to create a reader based on the file format, and open
+    /// the file.
+    ///
+    /// \param filename Path to the point cloud file.
+    /// \param chunk_size Maximum number of points per chunk.
+    /// \param format File format, "auto" to use the file extension.
+    static std::unique_ptr<PointCloudChunkReader> Create(
+            const std::string &filename,
+            int64_t chunk_size = 1000000,
+            const std::string &format = "auto");
+
+protected:
+    int64_t chunk_size_;
+};
+
+/// Create a chunk reader for PLY files.
+std::unique_ptr<PointCloudChunkReader> CreatePLYChunkReader(
+        int64_t chunk_size);
+
+/// Create a chunk reader for PCD files.
+std::unique_ptr<PointCloudChunkReader> CreatePCDChunkReader(
+        int64_t chunk_size);
+
+/// Create a chunk reader for uncompressed LAS files.
+std::unique_ptr<PointCloudChunkReader> CreateLASChunkReader(
+        int64_t chunk_size);
+
+/// Create a chunk reader for the text formats XYZ, XYZN, XYZRGB, XYZI and PTS.
+std::unique_ptr<PointCloudChunkReader> CreateASCIIChunkReader(
+        const std::string &format, int64_t chunk_size);
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
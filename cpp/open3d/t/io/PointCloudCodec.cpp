@@ -0,0 +1,590 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/t/io/PointCloudCodec.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <utility>
+#include <vector>
+
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace t {
+namespace io {
+
+namespace {
+
+constexpr char kMagic[4] = {'O', '3', 'P', 'C'};
+constexpr uint8_t kVersion = 1;
+// Morton codes of 3 coordinates fit into 64 bits with 21 bits each.
+constexpr int kMaxDepth = 21;
+
+// Magic, version, flags, position dtype, color dtype, depth, color bits,
+// frame index, number of points, payload size, quantization and origin.
+constexpr size_t kHeaderSize = 4 + 6 + 8 + 8 + 8 + 8 + 3 * 8;
+
+enum DtypeCode : uint8_t { kFloat32 = 0, kFloat64 = 1, kUInt8 = 2 };
+
+uint8_t ToDtypeCode(const core::Dtype& dtype, bool allow_uint8) {
+    if (dtype == core::Float32) return kFloat32;
+    if (dtype == core::Float64) return kFloat64;
+    if (allow_uint8 && dtype == core::UInt8) return kUInt8;
+    utility::LogError("Unsupported dtype {} for point cloud encoding.",
+                      dtype.ToString());
+}
+
+core::Dtype FromDtypeCode(uint8_t code) {
+    switch (code) {
+        case kFloat32:
+            return core::Float32;
+        case kFloat64:
+            return core::Float64;
+        case kUInt8:
+            return core::UInt8;
+        default:
+            utility::LogError("Corrupted point cloud buffer: invalid dtype.");
+    }
+}
+
+template <typename T>
+void AppendValue(std::vector<uint8_t>& bytes, const T& value) {
+    const uint8_t* ptr = reinterpret_cast<const uint8_t*>(&value);
+    bytes.insert(bytes.end(), ptr, ptr + sizeof(T));
+}
+
+template <typename T>
+T ReadValue(const uint8_t*& ptr) {
+    T value;
+    std::memcpy(&value, ptr, sizeof(T));
+    ptr += sizeof(T);
+    return value;
+}
+
+/// Spreads the lower 21 bits of x to every third bit.
+uint64_t SpreadBits(uint64_t x) {
+    x &= 0x1fffff;
+    x = (x | x << 32) & 0x1f00000000ffff;
+    x = (x | x << 16) & 0x1f0000ff0000ff;
+    x = (x | x << 8) & 0x100f00f00f00f00f;
+    x = (x | x << 4) & 0x10c30c30c30c30c3;
+    x = (x | x << 2) & 0x1249249249249249;
+    return x;
+}
+
+uint64_t CompactBits(uint64_t x) {
+    x &= 0x1249249249249249;
+    x = (x | x >> 2) & 0x10c30c30c30c30c3;
+    x = (x | x >> 4) & 0x100f00f00f00f00f;
+    x = (x | x >> 8) & 0x1f0000ff0000ff;
+    x = (x | x >> 16) & 0x1f00000000ffff;
+    x = (x | x >> 32) & 0x1fffff;
+    return x;
+}
+
+// Adaptive binary range coder with 11-bit probabilities, as in LZMA.
+constexpr int kProbBits = 11;
+constexpr uint16_t kProbInit = 1 << (kProbBits - 1);
+constexpr int kAdaptShift = 5;
+constexpr uint32_t kTopValue = 1 << 24;
+
+class RangeEncoder {
+public:
+    explicit RangeEncoder(std::vector<uint8_t>& bytes) : bytes_(bytes) {}
+
+    void EncodeBit(uint16_t& prob, int bit) {
+        uint32_t bound = (range_ >> kProbBits) * prob;
+        if (bit == 0) {
+            range_ = bound;
+            prob += ((1 << kProbBits) - prob) >> kAdaptShift;
+        } else {
+            low_ += bound;
+            range_ -= bound;
+            prob -= prob >> kAdaptShift;
+        }
+        while (range_ < kTopValue) {
+            range_ <<= 8;
+            ShiftLow();
+        }
+    }
+
+    void Flush() {
+        for (int i = 0; i < 5; ++i) {
+            ShiftLow();
+        }
+    }
+
+private:
+    void ShiftLow() {
+        if (static_cast<uint32_t>(low_) < 0xff000000u || (low_ >> 32) != 0) {
+            uint8_t carry = static_cast<uint8_t>(low_ >> 32);
+            uint8_t temp = cache_;
+            do {
+                bytes_.push_back(static_cast<uint8_t>(temp + carry));
+                temp = 0xff;
+            } while (--cache_size_ != 0);
+            cache_ = static_cast<uint8_t>(low_ >> 24);
+        }
+        ++cache_size_;
+        low_ = (low_ & 0x00ffffff) << 8;
+    }
+
+    std::vector<uint8_t>& bytes_;
+    uint64_t low_ = 0;
+    uint32_t range_ = 0xffffffff;
+    uint8_t cache_ = 0;
+    uint64_t cache_size_ = 1;
+};
+
+class RangeDecoder {
+public:
+    RangeDecoder(const uint8_t* begin, const uint8_t* end)
+        : ptr_(begin), end_(end) {
+        for (int i = 0; i < 5; ++i) {
+            code_ = (code_ << 8) | NextByte();
+        }
+    }
+
+    int DecodeBit(uint16_t& prob) {
+        uint32_t bound = (range_ >> kProbBits) * prob;
+        int bit;
+        if (code_ < bound) {
+            range_ = bound;
+            prob += ((1 << kProbBits) - prob) >> kAdaptShift;
+            bit = 0;
+        } else {
+            code_ -= bound;
+            range_ -= bound;
+            prob -= prob >> kAdaptShift;
+            bit = 1;
+        }
+        while (range_ < kTopValue) {
+            range_ <<= 8;
+            code_ = (code_ << 8) | NextByte();
+        }
+        return bit;
+    }
+
+private:
+    // Reading past the end yields zeros; corrupted buffers are detected by
+    // the consistency checks of the decoded data.
+    uint32_t NextByte() { return ptr_ < end_ ? *ptr_++ : 0; }
+
+    const uint8_t* ptr_;
+    const uint8_t* end_;
+    uint32_t code_ = 0;
+    uint32_t range_ = 0xffffffff;
+};
+
+/// Adaptive model of a byte, coded bit by bit from the most significant one
+/// in a binary tree of contexts.
+struct ByteModel {
+    ByteModel() { std::fill(probs.begin(), probs.end(), kProbInit); }
+
+    void Encode(RangeEncoder& encoder, uint8_t symbol) {
+        uint32_t node = 1;
+        for (int i = 7; i >= 0; --i) {
+            int bit = (symbol >> i) & 1;
+            encoder.EncodeBit(probs[node], bit);
+            node = (node << 1) | bit;
+        }
+    }
+
+    uint8_t Decode(RangeDecoder& decoder) {
+        uint32_t node = 1;
+        for (int i = 0; i < 8; ++i) {
+            node = (node << 1) | decoder.DecodeBit(probs[node]);
+        }
+        return static_cast<uint8_t>(node - 256);
+    }
+
+    std::array<uint16_t, 256> probs;
+};
+
+uint8_t QuantizeColor(double value, int color_bits) {
+    double max_value = double((1 << color_bits) - 1);
+    double v = std::round(std::min(std::max(value, 0.0), 255.0) / 255.0 *
+                          max_value);
+    return static_cast<uint8_t>(v);
+}
+
+double DequantizeColor(uint8_t value, int color_bits) {
+    return std::round(double(value) * 255.0 / double((1 << color_bits) - 1));
+}
+
+}  // namespace
+
+core::Tensor EncodePointCloud(const geometry::PointCloud& pcd,
+                              const PointCloudCodecOption& option,
+                              int64_t frame_index) {
+    if (!(option.quantization > 0)) {
+        utility::LogError("quantization must be positive, but got {}.",
+                          option.quantization);
+    }
+    if (option.color_bits < 1 || option.color_bits > 8) {
+        utility::LogError("color_bits must be in [1, 8], but got {}.",
+                          option.color_bits);
+    }
+    const core::Device host("CPU:0");
+
+    core::Dtype position_dtype = core::Float32;
+    std::vector<double> positions;
+    if (pcd.HasPointPositions()) {
+        const core::Tensor& points = pcd.GetPointPositions();
+        position_dtype = points.GetDtype();
+        core::Tensor points_host =
+                points.To(host, core::Float64).Contiguous();
+        const double* ptr = points_host.GetDataPtr<double>();
+        positions.assign(ptr, ptr + points_host.NumElements());
+    }
+    const uint8_t position_code = ToDtypeCode(position_dtype, false);
+    const int64_t n = static_cast<int64_t>(positions.size() / 3);
+
+    const bool has_colors = option.encode_colors && pcd.HasPointColors() &&
+                            n > 0;
+    uint8_t color_code = kFloat32;
+    std::vector<double> colors;
+    if (has_colors) {
+        const core::Tensor& point_colors = pcd.GetPointColors();
+        color_code = ToDtypeCode(point_colors.GetDtype(), true);
+        // Colors are coded in [0, 255].
+        core::Tensor colors_host = point_colors.To(host, core::Float64);
+        if (color_code != kUInt8) {
+            colors_host = colors_host * 255.0;
+        }
+        colors_host = colors_host.Contiguous();
+        const double* ptr = colors_host.GetDataPtr<double>();
+        colors.assign(ptr, ptr + colors_host.NumElements());
+    }
+
+    // Quantize the positions relative to the minimum bound.
+    std::array<double, 3> origin{0, 0, 0};
+    if (n > 0) {
+        for (int64_t i = 0; i < 3 * n; ++i) {
+            if (!std::isfinite(positions[i])) {
+                utility::LogError(
+                        "Point cloud encoding requires finite positions.");
+            }
+        }
+        for (int d = 0; d < 3; ++d) {
+            origin[d] = positions[d];
+            for (int64_t i = 1; i < n; ++i) {
+                origin[d] = std::min(origin[d], positions[3 * i + d]);
+            }
+        }
+    }
+    std::vector<std::pair<uint64_t, int64_t>> codes(n);
+    uint64_t max_coord = 0;
+    for (int64_t i = 0; i < n; ++i) {
+        uint64_t code = 0;
+        for (int d = 0; d < 3; ++d) {
+            double k = std::floor(
+                    (positions[3 * i + d] - origin[d]) / option.quantization +
+                    0.5);
+            if (k >= double(1 << kMaxDepth)) {
+                utility::LogError(
+                        "The point cloud extent exceeds {} quantization "
+                        "steps, please use a larger quantization than {}.",
+                        1 << kMaxDepth, option.quantization);
+            }
+            uint64_t coord = static_cast<uint64_t>(k);
+            max_coord = std::max(max_coord, coord);
+            code |= SpreadBits(coord) << d;
+        }
+        codes[i] = std::make_pair(code, i);
+    }
+    std::sort(codes.begin(), codes.end());
+    int depth = 1;
+    while ((uint64_t(1) << depth) <= max_coord) {
+        ++depth;
+    }
+
+    // Merge the points of the same cell and average their colors.
+    std::vector<uint64_t> cell_codes;
+    std::vector<std::array<double, 3>> cell_colors;
+    cell_codes.reserve(n);
+    for (int64_t i = 0, j = 0; i < n; i = j) {
+        std::array<double, 3> color{0, 0, 0};
+        for (j = i; j < n && codes[j].first == codes[i].first; ++j) {
+            if (has_colors) {
+                for (int c = 0; c < 3; ++c) {
+                    color[c] += colors[3 * codes[j].second + c];
+                }
+            }
+        }
+        for (int c = 0; c < 3; ++c) {
+            color[c] /= double(j - i);
+        }
+        cell_codes.push_back(codes[i].first);
+        cell_colors.push_back(color);
+    }
+    const int64_t num_cells = static_cast<int64_t>(cell_codes.size());
+
+    std::vector<uint8_t> bytes;
+    bytes.insert(bytes.end(), kMagic, kMagic + 4);
+    AppendValue(bytes, kVersion);
+    AppendValue(bytes, static_cast<uint8_t>(has_colors ? 1 : 0));
+    AppendValue(bytes, position_code);
+    AppendValue(bytes, color_code);
+    AppendValue(bytes, static_cast<uint8_t>(depth));
+    AppendValue(bytes, static_cast<uint8_t>(option.color_bits));
+    AppendValue(bytes, frame_index);
+    AppendValue(bytes, num_cells);
+    const size_t payload_size_offset = bytes.size();
+    AppendValue(bytes, uint64_t(0));
+    AppendValue(bytes, option.quantization);
+    for (int d = 0; d < 3; ++d) {
+        AppendValue(bytes, origin[d]);
+    }
+
+    if (num_cells > 0) {
+        RangeEncoder encoder(bytes);
+
+        // Occupancy bytes of the octree nodes, breadth first. The sorted
+        // cell codes visit the nodes of each level in the order in which the
+        // decoder creates them.
+        std::vector<ByteModel> occupancy_models(depth);
+        for (int level = depth - 1; level >= 0; --level) {
+            const int shift = 3 * level;
+            uint64_t parent = cell_codes[0] >> (shift + 3);
+            uint8_t mask = 0;
+            for (uint64_t code : cell_codes) {
+                if ((code >> (shift + 3)) != parent) {
+                    occupancy_models[level].Encode(encoder, mask);
+                    parent = code >> (shift + 3);
+                    mask = 0;
+                }
+                mask |= static_cast<uint8_t>(1 << ((code >> shift) & 7));
+            }
+            occupancy_models[level].Encode(encoder, mask);
+        }
+
+        // Color residuals to the previous cell. The residuals of green and
+        // blue are coded relative to the residuals of red and green, which
+        // removes most of the correlation between the channels.
+        if (has_colors) {
+            const uint8_t mask = static_cast<uint8_t>(
+                    (1 << option.color_bits) - 1);
+            std::array<ByteModel, 3> color_models;
+            std::array<uint8_t, 3> prev{0, 0, 0};
+            for (int64_t i = 0; i < num_cells; ++i) {
+                std::array<uint8_t, 3> residual;
+                for (int c = 0; c < 3; ++c) {
+                    uint8_t value =
+                            QuantizeColor(cell_colors[i][c], option.color_bits);
+                    residual[c] = static_cast<uint8_t>(value - prev[c]) & mask;
+                    prev[c] = value;
+                }
+                color_models[0].Encode(encoder, residual[0]);
+                color_models[1].Encode(
+                        encoder,
+                        static_cast<uint8_t>(residual[1] - residual[0]) & mask);
+                color_models[2].Encode(
+                        encoder,
+                        static_cast<uint8_t>(residual[2] - residual[1]) & mask);
+            }
+        }
+        encoder.Flush();
+    }
+    const uint64_t payload_size = bytes.size() - kHeaderSize;
+    std::memcpy(bytes.data() + payload_size_offset, &payload_size,
+                sizeof(payload_size));
+
+    core::Tensor buffer({static_cast<int64_t>(bytes.size())}, core::UInt8);
+    std::memcpy(buffer.GetDataPtr<uint8_t>(), bytes.data(), bytes.size());
+    return buffer;
+}
+
+namespace {
+
+/// Checks the buffer and returns a pointer to its bytes on CPU.
+const uint8_t* GetBufferBytes(const core::Tensor& buffer,
+                              core::Tensor& buffer_host) {
+    if (buffer.GetDtype() != core::UInt8 || buffer.NumDims() != 1) {
+        utility::LogError(
+                "Encoded point cloud buffer must be a UInt8 tensor of shape "
+                "{{size}}, but got {} of shape {}.",
+                buffer.GetDtype().ToString(), buffer.GetShape().ToString());
+    }
+    buffer_host = buffer.To(core::Device("CPU:0")).Contiguous();
+    const uint8_t* ptr = buffer_host.GetDataPtr<uint8_t>();
+    if (static_cast<size_t>(buffer_host.GetLength()) < kHeaderSize ||
+        std::memcmp(ptr, kMagic, 4) != 0) {
+        utility::LogError("Invalid point cloud buffer.");
+    }
+    if (ptr[4] != kVersion) {
+        utility::LogError("Unsupported point cloud codec version {}.",
+                          int(ptr[4]));
+    }
+    return ptr;
+}
+
+}  // namespace
+
+geometry::PointCloud DecodePointCloud(const core::Tensor& buffer,
+                                      const core::Device& device) {
+    core::Tensor buffer_host;
+    const uint8_t* begin = GetBufferBytes(buffer, buffer_host);
+    const uint8_t* end = begin + buffer_host.GetLength();
+    const uint8_t* ptr = begin + 5;
+    const bool has_colors = (ReadValue<uint8_t>(ptr) & 1) != 0;
+    const core::Dtype position_dtype = FromDtypeCode(ReadValue<uint8_t>(ptr));
+    const core::Dtype color_dtype = FromDtypeCode(ReadValue<uint8_t>(ptr));
+    const int depth = ReadValue<uint8_t>(ptr);
+    const int color_bits = ReadValue<uint8_t>(ptr);
+    ReadValue<int64_t>(ptr);  // Frame index.
+    const int64_t num_cells = ReadValue<int64_t>(ptr);
+    const uint64_t payload_size = ReadValue<uint64_t>(ptr);
+    const double quantization = ReadValue<double>(ptr);
+    std::array<double, 3> origin;
+    for (int d = 0; d < 3; ++d) {
+        origin[d] = ReadValue<double>(ptr);
+    }
+    if (depth < 1 || depth > kMaxDepth || num_cells < 0 || color_bits < 1 ||
+        color_bits > 8) {
+        utility::LogError("Corrupted point cloud buffer: invalid header.");
+    }
+    if (payload_size != static_cast<uint64_t>(end - ptr)) {
+        utility::LogError(
+                "Truncated point cloud buffer: {} bytes of data, but {} "
+                "expected.",
+                end - ptr, payload_size);
+    }
+
+    std::vector<uint64_t> nodes;
+    std::vector<uint8_t> cell_colors;
+    if (num_cells > 0) {
+        RangeDecoder decoder(ptr, end);
+
+        nodes.push_back(0);
+        std::vector<uint64_t> children;
+        std::vector<ByteModel> occupancy_models(depth);
+        for (int level = depth - 1; level >= 0; --level) {
+            children.clear();
+            for (uint64_t node : nodes) {
+                uint8_t mask = occupancy_models[level].Decode(decoder);
+                if (mask == 0) {
+                    utility::LogError(
+                            "Corrupted point cloud buffer: empty octree "
+                            "node.");
+                }
+                for (int c = 0; c < 8; ++c) {
+                    if (mask & (1 << c)) {
+                        children.push_back((node << 3) | c);
+                    }
+                }
+                if (static_cast<int64_t>(children.size()) > num_cells) {
+                    utility::LogError(
+                            "Corrupted point cloud buffer: too many octree "
+                            "nodes.");
+                }
+            }
+            nodes.swap(children);
+        }
+        if (static_cast<int64_t>(nodes.size()) != num_cells) {
+            utility::LogError(
+                    "Corrupted point cloud buffer: {} points decoded, but {} "
+                    "expected.",
+                    nodes.size(), num_cells);
+        }
+
+        if (has_colors) {
+            const uint8_t mask = static_cast<uint8_t>((1 << color_bits) - 1);
+            std::array<ByteModel, 3> color_models;
+            std::array<uint8_t, 3> prev{0, 0, 0};
+            cell_colors.resize(3 * num_cells);
+            for (int64_t i = 0; i < num_cells; ++i) {
+                std::array<uint8_t, 3> residual;
+                residual[0] = color_models[0].Decode(decoder) & mask;
+                residual[1] = static_cast<uint8_t>(
+                                      color_models[1].Decode(decoder) +
+                                      residual[0]) &
+                              mask;
+                residual[2] = static_cast<uint8_t>(
+                                      color_models[2].Decode(decoder) +
+                                      residual[1]) &
+                              mask;
+                for (int c = 0; c < 3; ++c) {
+                    prev[c] = static_cast<uint8_t>(prev[c] + residual[c]) &
+                              mask;
+                    cell_colors[3 * i + c] = prev[c];
+                }
+            }
+        }
+    }
+
+    core::Tensor positions({num_cells, 3}, core::Float64);
+    double* positions_ptr = positions.GetDataPtr<double>();
+    for (int64_t i = 0; i < num_cells; ++i) {
+        for (int d = 0; d < 3; ++d) {
+            positions_ptr[3 * i + d] =
+                    origin[d] +
+                    quantization * double(CompactBits(nodes[i] >> d));
+        }
+    }
+    geometry::PointCloud pcd(positions.To(device, position_dtype));
+
+    if (has_colors) {
+        core::Tensor colors({num_cells, 3}, core::Float64);
+        double* colors_ptr = colors.GetDataPtr<double>();
+        const double scale = color_dtype == core::UInt8 ? 1.0 : 1.0 / 255.0;
+        for (int64_t i = 0; i < 3 * num_cells; ++i) {
+            colors_ptr[i] = DequantizeColor(cell_colors[i], color_bits) * scale;
+        }
+        pcd.SetPointColors(colors.To(device, color_dtype));
+    }
+    return pcd;
+}
+
+int64_t GetEncodedFrameIndex(const core::Tensor& buffer) {
+    core::Tensor buffer_host;
+    const uint8_t* ptr = GetBufferBytes(buffer, buffer_host) + 10;
+    return ReadValue<int64_t>(ptr);
+}
+
+core::Tensor PointCloudStreamEncoder::Encode(const geometry::PointCloud& pcd) {
+    return EncodePointCloud(pcd, option_, num_frames_++);
+}
+
+geometry::PointCloud PointCloudStreamDecoder::Decode(
+        const core::Tensor& buffer) {
+    int64_t frame_index = GetEncodedFrameIndex(buffer);
+    if (frame_index <= last_frame_index_) {
+        return geometry::PointCloud(device_);
+    }
+    geometry::PointCloud pcd = DecodePointCloud(buffer, device_);
+    num_dropped_frames_ += frame_index - last_frame_index_ - 1;
+    last_frame_index_ = frame_index;
+    return pcd;
+}
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
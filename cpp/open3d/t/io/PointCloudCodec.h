@@ -0,0 +1,140 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#pragma once
+
+#include <cstdint>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/t/geometry/PointCloud.h"
+
+namespace open3d {
+namespace t {
+namespace io {
+
+/// Options of the lossy point cloud codec.
+struct PointCloudCodecOption {
+    /// Grid step of the quantized positions. Decoded positions are within
+    /// half of the step of the original ones in each coordinate.
+    double quantization = 0.001;
+    /// Bits kept per color channel, in [1, 8].
+    int color_bits = 8;
+    /// Set to false to drop the colors.
+    bool encode_colors = true;
+};
+
+/// Encode the positions and colors of a point cloud into a compressed
+/// buffer.
+///
+/// The positions are quantized to a grid of the given step and coded as an
+/// octree, breadth first, one occupancy byte per node. Points falling into
+/// the same grid cell are merged and their colors averaged. Colors are
+/// quantized and coded as residuals to the previous point along the octree
+/// traversal, which is spatially close. All symbols are entropy coded with
+/// an adaptive binary range coder. Other attributes are not encoded.
+///
+/// Float32 and Float64 colors are expected in [0, 1]. UInt8 colors are
+/// encoded losslessly with the default of 8 color bits.
+///
+/// \param pcd The point cloud to encode, on any device.
+/// \param option Codec options.
+/// \param frame_index Index stored with the buffer, e.g. to detect dropped
+/// frames when streaming.
+/// \return A UInt8 tensor of shape {size} on CPU.
+core::Tensor EncodePointCloud(const geometry::PointCloud& pcd,
+                              const PointCloudCodecOption& option = {},
+                              int64_t frame_index = 0);
+
+/// Decode a point cloud encoded by EncodePointCloud. The positions and
+/// colors have the dtypes of the encoded point cloud, and the points are in
+/// octree order.
+///
+/// \param buffer UInt8 tensor of shape {size} returned by EncodePointCloud.
+/// \param device The device of the decoded point cloud.
+geometry::PointCloud DecodePointCloud(
+        const core::Tensor& buffer,
+        const core::Device& device = core::Device("CPU:0"));
+
+/// Read the frame index of an encoded point cloud without decoding it.
+int64_t GetEncodedFrameIndex(const core::Tensor& buffer);
+
+/// \class PointCloudStreamEncoder
+///
+/// \brief Encodes a stream of point cloud frames, e.g. live maps sent to a
+/// remote client with io/rpc.
+///
+/// Each frame is encoded into a self-contained buffer numbered by the
+/// encoder, so frames can be dropped on a congested link without breaking
+/// the decoding of the following ones.
+class PointCloudStreamEncoder {
+public:
+    explicit PointCloudStreamEncoder(const PointCloudCodecOption& option = {})
+        : option_(option) {}
+
+    /// Encode the next frame.
+    core::Tensor Encode(const geometry::PointCloud& pcd);
+
+    /// Number of frames encoded so far.
+    int64_t GetNumFrames() const { return num_frames_; }
+
+    /// The codec options used for all frames.
+    const PointCloudCodecOption& GetOption() const { return option_; }
+
+private:
+    PointCloudCodecOption option_;
+    int64_t num_frames_ = 0;
+};
+
+/// \class PointCloudStreamDecoder
+///
+/// \brief Decodes the frames of a PointCloudStreamEncoder and keeps track of
+/// the frames that were lost or arrived out of order.
+class PointCloudStreamDecoder {
+public:
+    explicit PointCloudStreamDecoder(
+            const core::Device& device = core::Device("CPU:0"))
+        : device_(device) {}
+
+    /// Decode a frame. Frames older than the last decoded one are stale,
+    /// and an empty point cloud is returned for them.
+    geometry::PointCloud Decode(const core::Tensor& buffer);
+
+    /// Index of the last decoded frame, or -1 before the first one.
+    int64_t GetLastFrameIndex() const { return last_frame_index_; }
+
+    /// Number of frames skipped between the decoded ones.
+    int64_t GetNumDroppedFrames() const { return num_dropped_frames_; }
+
+private:
+    core::Device device_;
+    int64_t last_frame_index_ = -1;
+    int64_t num_dropped_frames_ = 0;
+};
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
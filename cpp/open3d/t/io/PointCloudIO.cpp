@@ -26,8 +26,10 @@
 
 #include "open3d/t/io/PointCloudIO.h"
 
+#include <algorithm>
 #include <iostream>
 #include <unordered_map>
+#include <vector>
 
 #include "open3d/io/PointCloudIO.h"
 #include "open3d/t/io/NumpyIO.h"
@@ -35,6 +37,7 @@
 #include "open3d/utility/Helper.h"
 #include "open3d/utility/Logging.h"
 #include "open3d/utility/ProgressReporters.h"
+#include "open3d/utility/Tracing.h"
 
 namespace open3d {
 namespace t {
@@ -51,6 +54,8 @@ static const std::unordered_map<
                 {"pcd", ReadPointCloudFromPCD},
                 {"ply", ReadPointCloudFromPLY},
                 {"pts", ReadPointCloudFromPTS},
+                {"las", ReadPointCloudFromLAS},
+                {"o3dpc", ReadPointCloudFromO3DPC},
         };
 
 static const std::unordered_map<
@@ -61,7 +66,8 @@ static const std::unordered_map<
         file_extension_to_pointcloud_write_function{
                 {"npz", WritePointCloudToNPZ}, {"xyzi", WritePointCloudToXYZI},
                 {"pcd", WritePointCloudToPCD}, {"ply", WritePointCloudToPLY},
-                {"pts", WritePointCloudToPTS},
+                {"pts", WritePointCloudToPTS}, {"las", WritePointCloudToLAS},
+                {"o3dpc", WritePointCloudToO3DPC},
         };
 
 std::shared_ptr<geometry::PointCloud> CreatePointCloudFromFile(
@@ -77,6 +83,7 @@ std::shared_ptr<geometry::PointCloud> CreatePointCloudFromFile(
 bool ReadPointCloud(const std::string &filename,
                     geometry::PointCloud &pointcloud,
                     const open3d::io::ReadPointCloudOption &params) {
+    OPEN3D_TRACE_ZONE("t::io::ReadPointCloud");
     std::string format = params.format;
     if (format == "auto") {
         format = utility::filesystem::GetFileExtensionInLowerCase(filename);
@@ -138,6 +145,64 @@ bool ReadPointCloud(const std::string &filename,
     return ReadPointCloud(filename, pointcloud, p);
 }
 
+bool ReadPointCloudSubset(const std::string &filename,
+                          geometry::PointCloud &pointcloud,
+                          const ReadPointCloudSubsetOption &subset,
+                          const open3d::io::ReadPointCloudOption &params) {
+    const bool has_bound = subset.min_bound.NumElements() > 0 ||
+                           subset.max_bound.NumElements() > 0;
+    if (has_bound && (subset.min_bound.NumElements() != 3 ||
+                      subset.max_bound.NumElements() != 3)) {
+        utility::LogError("min_bound and max_bound must have 3 elements.");
+    }
+    std::string format = params.format;
+    if (format == "auto") {
+        format = utility::filesystem::GetFileExtensionInLowerCase(filename);
+    }
+
+    bool success = false;
+    if (format == "o3dpc") {
+        success = ReadPointCloudSubsetFromO3DPC(filename, pointcloud, subset,
+                                                params);
+    } else {
+        success = ReadPointCloud(filename, pointcloud, params);
+    }
+    if (!success) {
+        return false;
+    }
+
+    if (!subset.attributes.empty()) {
+        std::vector<std::string> unselected;
+        for (const auto &kv : pointcloud.GetPointAttr()) {
+            if (kv.first != "positions" &&
+                std::find(subset.attributes.begin(), subset.attributes.end(),
+                          kv.first) == subset.attributes.end()) {
+                unselected.push_back(kv.first);
+            }
+        }
+        for (const std::string &key : unselected) {
+            pointcloud.RemovePointAttr(key);
+        }
+    }
+    if (has_bound && pointcloud.HasPointPositions()) {
+        const core::Tensor &positions = pointcloud.GetPointPositions();
+        const core::Tensor min_bound =
+                subset.min_bound.To(positions.GetDevice(), positions.GetDtype())
+                        .Reshape({3});
+        const core::Tensor max_bound =
+                subset.max_bound.To(positions.GetDevice(), positions.GetDtype())
+                        .Reshape({3});
+        const core::Tensor inside =
+                positions.Ge(min_bound).LogicalAnd(positions.Le(max_bound));
+        const core::Tensor mask =
+                inside.IndexExtract(1, 0)
+                        .LogicalAnd(inside.IndexExtract(1, 1))
+                        .LogicalAnd(inside.IndexExtract(1, 2));
+        pointcloud = pointcloud.SelectPoints(mask);
+    }
+    return true;
+}
+
 bool WritePointCloud(const std::string &filename,
                      const geometry::PointCloud &pointcloud,
                      const open3d::io::WritePointCloudOption &params) {
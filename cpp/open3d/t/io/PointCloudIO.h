@@ -27,6 +27,7 @@
 #pragma once
 
 #include <string>
+#include <vector>
 
 #include "open3d/io/PointCloudIO.h"
 #include "open3d/t/geometry/PointCloud.h"
@@ -61,6 +62,29 @@ bool WritePointCloud(const std::string &filename,
                      const geometry::PointCloud &pointcloud,
                      const WritePointCloudOption &params = {});
 
+/// \struct ReadPointCloudSubsetOption
+///
+/// \brief Selects the points and attributes read by ReadPointCloudSubset().
+struct ReadPointCloudSubsetOption {
+    /// Only points with min_bound <= position <= max_bound are read. Leave
+    /// both empty to read all points, otherwise they must have 3 elements.
+    core::Tensor min_bound;
+    core::Tensor max_bound;
+    /// The attributes to read besides "positions". Leave empty to read all
+    /// attributes.
+    std::vector<std::string> attributes;
+};
+
+/// Reads the points inside a box and a subset of the attributes from a file.
+/// Open3D point cloud containers (.o3dpc) only load and decompress the tiles
+/// that intersect the box and the requested attributes, other formats are
+/// read completely and filtered afterwards.
+/// \return return true if the read function is successful, false otherwise.
+bool ReadPointCloudSubset(const std::string &filename,
+                          geometry::PointCloud &pointcloud,
+                          const ReadPointCloudSubsetOption &subset,
+                          const ReadPointCloudOption &params = {});
+
 bool ReadPointCloudFromNPZ(const std::string &filename,
                            geometry::PointCloud &pointcloud,
                            const ReadPointCloudOption &params);
@@ -101,6 +125,43 @@ bool WritePointCloudToPTS(const std::string &filename,
                           const geometry::PointCloud &pointcloud,
                           const WritePointCloudOption &params);
 
+/// Reads an Open3D point cloud container (.o3dpc). Only the tiles whose
+/// bounding boxes intersect the box of \p subset and the selected attributes
+/// are loaded, the points of these tiles are not filtered further.
+bool ReadPointCloudSubsetFromO3DPC(const std::string &filename,
+                                   geometry::PointCloud &pointcloud,
+                                   const ReadPointCloudSubsetOption &subset,
+                                   const ReadPointCloudOption &params);
+
+bool ReadPointCloudFromO3DPC(const std::string &filename,
+                             geometry::PointCloud &pointcloud,
+                             const ReadPointCloudOption &params);
+
+/// Writes an Open3D point cloud container (.o3dpc). The points are reordered
+/// along a Morton curve and split into spatially coherent tiles. Every
+/// attribute of a tile is stored in its own block, LZF compressed if
+/// params.compressed is set.
+bool WritePointCloudToO3DPC(const std::string &filename,
+                            const geometry::PointCloud &pointcloud,
+                            const WritePointCloudOption &params);
+
+/// Reads uncompressed LAS files. The point records are decoded into the
+/// attributes "positions" (Float64), "intensities" (UInt16), "classification",
+/// "return_number", "number_of_returns" (UInt8) and, if the point data record
+/// format has them, "gps_time" (Float64) and "colors" (UInt16). LAZ files are
+/// not supported.
+bool ReadPointCloudFromLAS(const std::string &filename,
+                           geometry::PointCloud &pointcloud,
+                           const ReadPointCloudOption &params);
+
+/// Writes a LAS 1.2 file with point data record format 0 to 3, depending on
+/// whether the point cloud has "gps_time" and "colors". The attributes of
+/// ReadPointCloudFromLAS() are stored if present. 8 bit colors and floating
+/// point colors in [0, 1] are scaled to 16 bit.
+bool WritePointCloudToLAS(const std::string &filename,
+                          const geometry::PointCloud &pointcloud,
+                          const WritePointCloudOption &params);
+
 }  // namespace io
 }  // namespace t
 }  // namespace open3d
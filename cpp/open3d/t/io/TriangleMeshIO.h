@@ -63,6 +63,20 @@ bool WriteTriangleMesh(const std::string &filename,
                        bool write_triangle_uvs = true,
                        bool print_progress = false);
 
+/// Write the mesh as binary glTF 2.0 directly from its tensors: positions,
+/// normals and colors as float32 and indices as uint16 / uint32. With
+/// \p compressed, colors are stored as normalized uint8 and normals as
+/// normalized int8 (KHR_mesh_quantization). \p write_ascii and
+/// \p write_triangle_uvs are ignored.
+bool WriteTriangleMeshToGLB(const std::string &filename,
+                            const geometry::TriangleMesh &mesh,
+                            const bool write_ascii,
+                            const bool compressed,
+                            const bool write_vertex_normals,
+                            const bool write_vertex_colors,
+                            const bool write_triangle_uvs,
+                            const bool print_progress);
+
 }  // namespace io
 }  // namespace t
 }  // namespace open3d
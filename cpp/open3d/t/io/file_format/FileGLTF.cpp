@@ -0,0 +1,274 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+// Binary glTF 2.0 (GLB) writer for tensor triangle meshes. The vertex and index
+// tensors are converted to the glTF component types in one pass each and
+// streamed to the binary chunk as-is, without an intermediate glTF model.
+
+#include <json/json.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "open3d/core/Dtype.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/t/io/TriangleMeshIO.h"
+#include "open3d/utility/FileSystem.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace t {
+namespace io {
+
+namespace {
+
+constexpr uint32_t kGLBMagic = 0x46546C67;      // "glTF"
+constexpr uint32_t kGLBChunkJSON = 0x4E4F534A;  // "JSON"
+constexpr uint32_t kGLBChunkBIN = 0x004E4942;   // "BIN\0"
+
+// glTF accessor component types and buffer view targets.
+constexpr int kGLTFByte = 5120;
+constexpr int kGLTFUnsignedByte = 5121;
+constexpr int kGLTFUnsignedShort = 5123;
+constexpr int kGLTFUnsignedInt = 5125;
+constexpr int kGLTFFloat = 5126;
+constexpr int kGLTFArrayBuffer = 34962;
+constexpr int kGLTFElementArrayBuffer = 34963;
+constexpr int kGLTFTriangles = 4;
+
+int64_t Pad4(int64_t size) { return (size + 3) & ~int64_t(3); }
+
+class GLBBuilder {
+public:
+    /// Append \p data as a new buffer view and an accessor over it. Vertex
+    /// attributes with less than 4 bytes per component use \p num_components
+    /// of the padded tensor columns so that every element is 4-byte aligned.
+    int AddAccessor(const core::Tensor &data,
+                    int component_type,
+                    const std::string &type,
+                    int64_t num_components,
+                    bool normalized,
+                    int target) {
+        const int64_t byte_length =
+                data.NumElements() * data.GetDtype().ByteSize();
+        Json::Value view;
+        view["buffer"] = 0;
+        view["byteOffset"] = Json::Int64(byte_length_);
+        view["byteLength"] = Json::Int64(byte_length);
+        view["target"] = target;
+        if (target == kGLTFArrayBuffer &&
+            data.GetShape(1) != num_components) {
+            view["byteStride"] =
+                    Json::Int64(data.GetShape(1) * data.GetDtype().ByteSize());
+        }
+        views_.push_back(data);
+        byte_length_ += Pad4(byte_length);
+        json_["bufferViews"].append(view);
+
+        Json::Value accessor;
+        accessor["bufferView"] = json_["bufferViews"].size() - 1;
+        accessor["componentType"] = component_type;
+        accessor["count"] = Json::Int64(data.GetShape(0));
+        accessor["type"] = type;
+        if (normalized) accessor["normalized"] = true;
+        json_["accessors"].append(accessor);
+        return json_["accessors"].size() - 1;
+    }
+
+    Json::Value &GetJson() { return json_; }
+
+    bool Write(const std::string &filename) {
+        json_["buffers"][0]["byteLength"] = Json::Int64(byte_length_);
+        Json::StreamWriterBuilder builder;
+        builder["indentation"] = "";
+        std::string json_str = Json::writeString(builder, json_);
+        json_str.resize(Pad4(json_str.size()), ' ');
+        const uint32_t total_length = static_cast<uint32_t>(
+                12 + 8 + json_str.size() + 8 + byte_length_);
+        if (12 + 8 + json_str.size() + 8 + byte_length_ > UINT32_MAX) {
+            utility::LogWarning(
+                    "Write GLB failed: the mesh exceeds the 4 GB GLB limit.");
+            return false;
+        }
+
+        FILE *file = utility::filesystem::FOpen(filename, "wb");
+        if (file == nullptr) {
+            utility::LogWarning("Write GLB failed: unable to open file: {}",
+                                filename);
+            return false;
+        }
+        const uint32_t header[3] = {kGLBMagic, 2, total_length};
+        const uint32_t json_chunk[2] = {static_cast<uint32_t>(json_str.size()),
+                                        kGLBChunkJSON};
+        const uint32_t bin_chunk[2] = {static_cast<uint32_t>(byte_length_),
+                                       kGLBChunkBIN};
+        const char padding[4] = {0, 0, 0, 0};
+        bool success = fwrite(header, sizeof(header), 1, file) == 1 &&
+                       fwrite(json_chunk, sizeof(json_chunk), 1, file) == 1 &&
+                       fwrite(json_str.data(), json_str.size(), 1, file) == 1 &&
+                       fwrite(bin_chunk, sizeof(bin_chunk), 1, file) == 1;
+        for (const core::Tensor &view : views_) {
+            if (!success) break;
+            const size_t size = view.NumElements() * view.GetDtype().ByteSize();
+            success = fwrite(view.GetDataPtr(), 1, size, file) == size &&
+                      fwrite(padding, 1, Pad4(size) - size, file) ==
+                              Pad4(size) - size;
+        }
+        fclose(file);
+        if (!success) {
+            utility::LogWarning("Write GLB failed: unable to write file: {}",
+                                filename);
+        }
+        return success;
+    }
+
+private:
+    Json::Value json_;
+    /// Contiguous CPU tensors backing the buffer views, in file order.
+    std::vector<core::Tensor> views_;
+    int64_t byte_length_ = 0;
+};
+
+/// Convert \p tensor to \p dtype on the CPU with contiguous storage. Tensors
+/// already matching are used without a copy.
+core::Tensor ToCPU(const core::Tensor &tensor, core::Dtype dtype) {
+    return tensor.To(dtype).To(core::Device("CPU:0")).Contiguous();
+}
+
+/// Quantize the {N, 3} \p values in [-1, 1] (signed) or [0, 1] to normalized
+/// integers of \p dtype, padded to 4 components with \p pad.
+core::Tensor Quantize(const core::Tensor &values,
+                      core::Dtype dtype,
+                      double scale,
+                      double pad) {
+    const core::Tensor cpu_values = ToCPU(values, core::Float32);
+    const double min_val = dtype == core::Int8 ? -1.0 : 0.0;
+    core::Tensor quantized =
+            core::Tensor::Full({cpu_values.GetLength(), 4}, pad, dtype);
+    quantized.Slice(1, 0, 3) =
+            (cpu_values.Clip(min_val, 1.0) * scale).Round().To(dtype);
+    return quantized;
+}
+
+}  // namespace
+
+bool WriteTriangleMeshToGLB(const std::string &filename,
+                            const geometry::TriangleMesh &mesh,
+                            const bool write_ascii,
+                            const bool compressed,
+                            const bool write_vertex_normals,
+                            const bool write_vertex_colors,
+                            const bool write_triangle_uvs,
+                            const bool print_progress) {
+    if (!mesh.HasVertexPositions()) {
+        utility::LogWarning("Write GLB failed: mesh has 0 vertices.");
+        return false;
+    }
+    const core::Tensor positions =
+            ToCPU(mesh.GetVertexPositions(), core::Float32);
+    const int64_t num_vertices = positions.GetLength();
+    if (positions.GetShape() != core::SizeVector{num_vertices, 3}) {
+        utility::LogWarning("Write GLB failed: invalid vertex positions.");
+        return false;
+    }
+
+    GLBBuilder builder;
+    Json::Value &json = builder.GetJson();
+    json["asset"]["version"] = "2.0";
+    json["asset"]["generator"] = "Open3D";
+    json["scene"] = 0;
+    json["scenes"][0]["nodes"][0] = 0;
+    json["nodes"][0]["mesh"] = 0;
+    Json::Value &primitive = json["meshes"][0]["primitives"][0];
+    primitive["mode"] = kGLTFTriangles;
+
+    Json::Value &attributes = primitive["attributes"];
+    attributes["POSITION"] = builder.AddAccessor(
+            positions, kGLTFFloat, "VEC3", 3, false, kGLTFArrayBuffer);
+    // glTF requires the bounds of the position accessor.
+    const core::Tensor min_bound = positions.Min({0});
+    const core::Tensor max_bound = positions.Max({0});
+    Json::Value &position_accessor =
+            json["accessors"][attributes["POSITION"].asInt()];
+    for (int i = 0; i < 3; ++i) {
+        position_accessor["min"].append(min_bound[i].Item<float>());
+        position_accessor["max"].append(max_bound[i].Item<float>());
+    }
+
+    if (write_vertex_normals && mesh.HasVertexNormals()) {
+        if (compressed) {
+            attributes["NORMAL"] = builder.AddAccessor(
+                    Quantize(mesh.GetVertexNormals(), core::Int8, 127.0, 0.0),
+                    kGLTFByte, "VEC3", 3, true, kGLTFArrayBuffer);
+            json["extensionsUsed"].append("KHR_mesh_quantization");
+            json["extensionsRequired"].append("KHR_mesh_quantization");
+        } else {
+            attributes["NORMAL"] = builder.AddAccessor(
+                    ToCPU(mesh.GetVertexNormals(), core::Float32), kGLTFFloat,
+                    "VEC3", 3, false, kGLTFArrayBuffer);
+        }
+    }
+
+    if (write_vertex_colors && mesh.HasVertexColors()) {
+        core::Tensor colors = mesh.GetVertexColors();
+        if (colors.GetDtype() == core::UInt8) {
+            colors = colors.To(core::Float32) / 255.0;
+        } else if (colors.GetDtype() == core::UInt16) {
+            colors = colors.To(core::Float32) / 65535.0;
+        }
+        if (compressed) {
+            attributes["COLOR_0"] = builder.AddAccessor(
+                    Quantize(colors, core::UInt8, 255.0, 255.0),
+                    kGLTFUnsignedByte, "VEC4", 4, true, kGLTFArrayBuffer);
+        } else {
+            attributes["COLOR_0"] = builder.AddAccessor(
+                    ToCPU(colors, core::Float32), kGLTFFloat, "VEC3", 3, false,
+                    kGLTFArrayBuffer);
+        }
+    }
+
+    if (mesh.HasTriangleIndices()) {
+        // 0xffff is reserved for primitive restart.
+        const bool short_indices = num_vertices < 0xffff;
+        const core::Tensor indices =
+                ToCPU(mesh.GetTriangleIndices(),
+                      short_indices ? core::UInt16 : core::UInt32);
+        primitive["indices"] = builder.AddAccessor(
+                indices.Reshape({-1, 1}),
+                short_indices ? kGLTFUnsignedShort : kGLTFUnsignedInt,
+                "SCALAR", 1, false, kGLTFElementArrayBuffer);
+    } else {
+        primitive["mode"] = 0;  // POINTS
+    }
+
+    return builder.Write(filename);
+}
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
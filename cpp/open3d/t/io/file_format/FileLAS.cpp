@@ -0,0 +1,614 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+// Reader and writer for uncompressed ASPRS LAS files, versions 1.0 to 1.4 and
+// point data record formats 0 to 10. Waveform packets and extra bytes are
+// skipped. LAS files are little endian like the supported host platforms.
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include "open3d/core/Dtype.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/io/FileFormatIO.h"
+#include "open3d/t/io/PointCloudChunkReader.h"
+#include "open3d/t/io/PointCloudIO.h"
+#include "open3d/utility/FileSystem.h"
+#include "open3d/utility/Logging.h"
+#include "open3d/utility/Parallel.h"
+#include "open3d/utility/ProgressReporters.h"
+
+namespace open3d {
+namespace t {
+namespace io {
+
+namespace {
+
+// Size of the LAS 1.2 public header block, which is what the writer creates.
+constexpr int64_t kLASHeaderSize = 227;
+
+// Number of points decoded or encoded per parallel block.
+constexpr int64_t kLASBlockSize = 65536;
+
+struct LASHeader {
+    uint8_t version_major_ = 1;
+    uint8_t version_minor_ = 2;
+    uint32_t point_data_offset_ = 0;
+    uint8_t point_format_ = 0;
+    uint16_t point_record_length_ = 0;
+    int64_t num_points_ = 0;
+    double scale_[3] = {1, 1, 1};
+    double offset_[3] = {0, 0, 0};
+};
+
+// Byte offsets of the optional fields of a point data record format, -1 if the
+// format does not have the field.
+struct LASPointLayout {
+    bool extended_ = false;
+    int gps_time_offset_ = -1;
+    int rgb_offset_ = -1;
+    int record_length_ = 20;
+};
+
+template <typename T>
+T ReadLE(const uint8_t *data) {
+    T value;
+    std::memcpy(&value, data, sizeof(T));
+    return value;
+}
+
+template <typename T>
+void WriteLE(uint8_t *data, T value) {
+    std::memcpy(data, &value, sizeof(T));
+}
+
+bool GetLASPointLayout(uint8_t point_format, LASPointLayout &layout) {
+    switch (point_format) {
+        case 0:
+            layout = {false, -1, -1, 20};
+            return true;
+        case 1:
+            layout = {false, 20, -1, 28};
+            return true;
+        case 2:
+            layout = {false, -1, 20, 26};
+            return true;
+        case 3:
+            layout = {false, 20, 28, 34};
+            return true;
+        case 4:
+            layout = {false, 20, -1, 57};
+            return true;
+        case 5:
+            layout = {false, 20, 28, 63};
+            return true;
+        case 6:
+            layout = {true, 22, -1, 30};
+            return true;
+        case 7:
+            layout = {true, 22, 30, 36};
+            return true;
+        case 8:
+            layout = {true, 22, 30, 38};
+            return true;
+        case 9:
+            layout = {true, 22, -1, 59};
+            return true;
+        case 10:
+            layout = {true, 22, 30, 67};
+            return true;
+        default:
+            return false;
+    }
+}
+
+bool ReadLASHeader(const utility::filesystem::MappedFile &file,
+                   LASHeader &header,
+                   LASPointLayout &layout) {
+    const uint8_t *data = file.GetData();
+    if (file.GetSize() < kLASHeaderSize ||
+        std::memcmp(data, "LASF", 4) != 0) {
+        utility::LogWarning("Read LAS failed: not a LAS file.");
+        return false;
+    }
+    header.version_major_ = data[24];
+    header.version_minor_ = data[25];
+    const uint16_t header_size = ReadLE<uint16_t>(data + 94);
+    header.point_data_offset_ = ReadLE<uint32_t>(data + 96);
+    header.point_format_ = data[104];
+    header.point_record_length_ = ReadLE<uint16_t>(data + 105);
+    header.num_points_ = ReadLE<uint32_t>(data + 107);
+    for (int i = 0; i < 3; ++i) {
+        header.scale_[i] = ReadLE<double>(data + 131 + 8 * i);
+        header.offset_[i] = ReadLE<double>(data + 155 + 8 * i);
+    }
+    // LAS 1.4 keeps the legacy point count at zero for more than 2^32 points
+    // and for point formats 6 and above.
+    if (header.version_major_ == 1 && header.version_minor_ >= 4 &&
+        header_size >= 375 && file.GetSize() >= 375) {
+        const uint64_t num_points = ReadLE<uint64_t>(data + 247);
+        if (num_points != 0) {
+            header.num_points_ = static_cast<int64_t>(num_points);
+        }
+    }
+
+    // LAZ files set the two high bits of the point format.
+    if (header.point_format_ & 0xc0) {
+        utility::LogWarning(
+                "Read LAS failed: compressed LAZ files are not supported, "
+                "decompress them to LAS first, e.g. with laszip.");
+        return false;
+    }
+    if (!GetLASPointLayout(header.point_format_, layout)) {
+        utility::LogWarning(
+                "Read LAS failed: unsupported point data record format {}.",
+                header.point_format_);
+        return false;
+    }
+    if (header.point_record_length_ < layout.record_length_) {
+        utility::LogWarning(
+                "Read LAS failed: point data record length {} is too short "
+                "for point data record format {}.",
+                header.point_record_length_, header.point_format_);
+        return false;
+    }
+    if (header.point_data_offset_ +
+                header.num_points_ * header.point_record_length_ >
+        file.GetSize()) {
+        utility::LogWarning("Read LAS failed: file is truncated.");
+        return false;
+    }
+    return true;
+}
+
+// Decodes num_points records starting at records into tensor attributes.
+geometry::PointCloud DecodeLASPoints(const LASHeader &header,
+                                     const LASPointLayout &layout,
+                                     const uint8_t *records,
+                                     int64_t num_points) {
+    core::Tensor positions({num_points, 3}, core::Float64);
+    core::Tensor intensities({num_points, 1}, core::UInt16);
+    core::Tensor classification({num_points, 1}, core::UInt8);
+    core::Tensor return_number({num_points, 1}, core::UInt8);
+    core::Tensor number_of_returns({num_points, 1}, core::UInt8);
+    core::Tensor gps_time, colors;
+    if (layout.gps_time_offset_ >= 0) {
+        gps_time = core::Tensor({num_points, 1}, core::Float64);
+    }
+    if (layout.rgb_offset_ >= 0) {
+        colors = core::Tensor({num_points, 3}, core::UInt16);
+    }
+
+    double *positions_ptr = positions.GetDataPtr<double>();
+    uint16_t *intensities_ptr = intensities.GetDataPtr<uint16_t>();
+    uint8_t *classification_ptr = classification.GetDataPtr<uint8_t>();
+    uint8_t *return_number_ptr = return_number.GetDataPtr<uint8_t>();
+    uint8_t *number_of_returns_ptr = number_of_returns.GetDataPtr<uint8_t>();
+    double *gps_time_ptr = layout.gps_time_offset_ >= 0
+                                   ? gps_time.GetDataPtr<double>()
+                                   : nullptr;
+    uint16_t *colors_ptr =
+            layout.rgb_offset_ >= 0 ? colors.GetDataPtr<uint16_t>() : nullptr;
+    const int64_t record_length = header.point_record_length_;
+
+    const int64_t num_blocks = (num_points + kLASBlockSize - 1) / kLASBlockSize;
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t block = 0; block < num_blocks; ++block) {
+        const int64_t end = std::min(num_points, (block + 1) * kLASBlockSize);
+        for (int64_t i = block * kLASBlockSize; i < end; ++i) {
+            const uint8_t *record = records + i * record_length;
+            for (int k = 0; k < 3; ++k) {
+                positions_ptr[3 * i + k] =
+                        ReadLE<int32_t>(record + 4 * k) * header.scale_[k] +
+                        header.offset_[k];
+            }
+            intensities_ptr[i] = ReadLE<uint16_t>(record + 12);
+            if (layout.extended_) {
+                return_number_ptr[i] = record[14] & 0x0f;
+                number_of_returns_ptr[i] = record[14] >> 4;
+                classification_ptr[i] = record[16];
+            } else {
+                return_number_ptr[i] = record[14] & 0x07;
+                number_of_returns_ptr[i] = (record[14] >> 3) & 0x07;
+                classification_ptr[i] = record[15] & 0x1f;
+            }
+            if (gps_time_ptr) {
+                gps_time_ptr[i] =
+                        ReadLE<double>(record + layout.gps_time_offset_);
+            }
+            if (colors_ptr) {
+                for (int k = 0; k < 3; ++k) {
+                    colors_ptr[3 * i + k] = ReadLE<uint16_t>(
+                            record + layout.rgb_offset_ + 2 * k);
+                }
+            }
+        }
+    }
+
+    geometry::PointCloud pointcloud;
+    pointcloud.SetPointPositions(positions);
+    pointcloud.SetPointAttr("intensities", intensities);
+    pointcloud.SetPointAttr("classification", classification);
+    pointcloud.SetPointAttr("return_number", return_number);
+    pointcloud.SetPointAttr("number_of_returns", number_of_returns);
+    if (layout.gps_time_offset_ >= 0) {
+        pointcloud.SetPointAttr("gps_time", gps_time);
+    }
+    if (layout.rgb_offset_ >= 0) {
+        pointcloud.SetPointColors(colors);
+    }
+    return pointcloud;
+}
+
+// Returns the attribute as a contiguous Nx1 or Nx3 Float64 tensor on the CPU,
+// or an empty tensor if the point cloud does not have a valid attribute.
+core::Tensor GetLASAttribute(const geometry::PointCloud &pointcloud,
+                             const std::string &name,
+                             int64_t num_points,
+                             int64_t num_columns) {
+    if (!pointcloud.HasPointAttr(name)) {
+        return core::Tensor();
+    }
+    const core::Tensor &attr = pointcloud.GetPointAttr(name);
+    if (attr.GetShape() != core::SizeVector{num_points, num_columns}) {
+        utility::LogWarning(
+                "Write LAS: skipping attribute {} with shape {}, it should be "
+                "{}x{}.",
+                name, attr.GetShape(), num_points, num_columns);
+        return core::Tensor();
+    }
+    return attr.To(core::Device("CPU:0"), core::Float64).Contiguous();
+}
+
+// Rounds and clamps value to the range of T.
+template <typename T>
+T ClampLAS(double value) {
+    value = std::round(value);
+    value = std::max<double>(value, std::numeric_limits<T>::min());
+    value = std::min<double>(value, std::numeric_limits<T>::max());
+    return static_cast<T>(value);
+}
+
+}  // namespace
+
+open3d::io::FileGeometry ReadFileGeometryTypeLAS(const std::string &path) {
+    return open3d::io::CONTAINS_POINTS;
+}
+
+bool ReadPointCloudFromLAS(const std::string &filename,
+                           geometry::PointCloud &pointcloud,
+                           const open3d::io::ReadPointCloudOption &params) {
+    try {
+        utility::filesystem::MappedFile file;
+        if (!file.Open(filename)) {
+            utility::LogWarning("Read LAS failed: unable to open file: {}",
+                                filename);
+            return false;
+        }
+        LASHeader header;
+        LASPointLayout layout;
+        if (!ReadLASHeader(file, header, layout)) {
+            return false;
+        }
+        utility::CountingProgressReporter reporter(params.update_progress);
+        reporter.SetTotal(header.num_points_);
+
+        pointcloud = DecodeLASPoints(
+                header, layout, file.GetData() + header.point_data_offset_,
+                header.num_points_);
+        reporter.Finish();
+        return true;
+    } catch (const std::exception &e) {
+        utility::LogWarning("Read LAS failed with exception: {}", e.what());
+        return false;
+    }
+}
+
+bool WritePointCloudToLAS(const std::string &filename,
+                          const geometry::PointCloud &pointcloud,
+                          const open3d::io::WritePointCloudOption &params) {
+    try {
+        const core::Tensor &points = pointcloud.GetPointPositions();
+        if (!points.GetShape().IsCompatible({utility::nullopt, 3})) {
+            utility::LogWarning(
+                    "Write LAS failed: Shape of points is {}, but it should "
+                    "be Nx3.",
+                    points.GetShape());
+            return false;
+        }
+        const int64_t num_points = points.GetLength();
+        if (num_points > std::numeric_limits<uint32_t>::max()) {
+            utility::LogWarning(
+                    "Write LAS failed: LAS 1.2 files can not store more than "
+                    "2^32 - 1 points.");
+            return false;
+        }
+        const core::Tensor positions = points.To(core::Device("CPU:0"),
+                                                 core::Float64)
+                                               .Contiguous();
+        const core::Tensor intensities =
+                GetLASAttribute(pointcloud, "intensities", num_points, 1);
+        const core::Tensor classification =
+                GetLASAttribute(pointcloud, "classification", num_points, 1);
+        const core::Tensor return_number =
+                GetLASAttribute(pointcloud, "return_number", num_points, 1);
+        const core::Tensor number_of_returns = GetLASAttribute(
+                pointcloud, "number_of_returns", num_points, 1);
+        const core::Tensor gps_time =
+                GetLASAttribute(pointcloud, "gps_time", num_points, 1);
+        core::Tensor colors =
+                GetLASAttribute(pointcloud, "colors", num_points, 3);
+        // Colors are stored as 16 bit values, rescale 8 bit and [0, 1]
+        // floating point colors to this range.
+        if (colors.NumElements()) {
+            const core::Dtype dtype = pointcloud.GetPointColors().GetDtype();
+            if (dtype == core::UInt8) {
+                colors = colors * 257.0;
+            } else if (dtype == core::Float32 || dtype == core::Float64) {
+                colors = colors * 65535.0;
+            }
+        }
+
+        uint8_t point_format = 0;
+        if (gps_time.NumElements() && colors.NumElements()) {
+            point_format = 3;
+        } else if (colors.NumElements()) {
+            point_format = 2;
+        } else if (gps_time.NumElements()) {
+            point_format = 1;
+        }
+        LASPointLayout layout;
+        GetLASPointLayout(point_format, layout);
+
+        // Use millimeter resolution relative to the minimum bound, coarser
+        // if the extent does not fit into 32 bit integers.
+        LASHeader header;
+        header.point_format_ = point_format;
+        header.point_record_length_ = layout.record_length_;
+        header.point_data_offset_ = kLASHeaderSize;
+        header.num_points_ = num_points;
+        double min_bound[3] = {0, 0, 0}, max_bound[3] = {0, 0, 0};
+        if (num_points > 0) {
+            const core::Tensor min_values = positions.Min({0});
+            const core::Tensor max_values = positions.Max({0});
+            for (int k = 0; k < 3; ++k) {
+                min_bound[k] = min_values[k].Item<double>();
+                max_bound[k] = max_values[k].Item<double>();
+                if (!std::isfinite(min_bound[k]) ||
+                    !std::isfinite(max_bound[k])) {
+                    utility::LogWarning(
+                            "Write LAS failed: positions must be finite.");
+                    return false;
+                }
+                header.offset_[k] = std::floor(min_bound[k]);
+                header.scale_[k] = 0.001;
+                while ((max_bound[k] - header.offset_[k]) / header.scale_[k] >
+                       std::numeric_limits<int32_t>::max()) {
+                    header.scale_[k] *= 10;
+                }
+            }
+        }
+
+        std::vector<uint8_t> buffer(kLASHeaderSize +
+                                            num_points * layout.record_length_,
+                                    0);
+        uint8_t *data = buffer.data();
+        std::memcpy(data, "LASF", 4);
+        data[24] = header.version_major_;
+        data[25] = header.version_minor_;
+        std::snprintf(reinterpret_cast<char *>(data + 26), 32, "OTHER");
+        std::snprintf(reinterpret_cast<char *>(data + 58), 32, "Open3D");
+        WriteLE<uint16_t>(data + 94, kLASHeaderSize);
+        WriteLE<uint32_t>(data + 96, header.point_data_offset_);
+        data[104] = header.point_format_;
+        WriteLE<uint16_t>(data + 105, header.point_record_length_);
+        WriteLE<uint32_t>(data + 107, static_cast<uint32_t>(num_points));
+        for (int k = 0; k < 3; ++k) {
+            WriteLE<double>(data + 131 + 8 * k, header.scale_[k]);
+            WriteLE<double>(data + 155 + 8 * k, header.offset_[k]);
+            WriteLE<double>(data + 179 + 16 * k, max_bound[k]);
+            WriteLE<double>(data + 187 + 16 * k, min_bound[k]);
+        }
+
+        const double *positions_ptr = positions.GetDataPtr<double>();
+        auto get_ptr = [](const core::Tensor &tensor) -> const double * {
+            return tensor.NumElements() ? tensor.GetDataPtr<double>()
+                                        : nullptr;
+        };
+        const double *intensities_ptr = get_ptr(intensities);
+        const double *classification_ptr = get_ptr(classification);
+        const double *return_number_ptr = get_ptr(return_number);
+        const double *number_of_returns_ptr = get_ptr(number_of_returns);
+        const double *gps_time_ptr = get_ptr(gps_time);
+        const double *colors_ptr = get_ptr(colors);
+        uint8_t *records = data + kLASHeaderSize;
+
+        const int64_t num_blocks =
+                (num_points + kLASBlockSize - 1) / kLASBlockSize;
+        std::vector<std::array<uint32_t, 5>> points_by_return(num_blocks);
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+        for (int64_t block = 0; block < num_blocks; ++block) {
+            std::array<uint32_t, 5> &counts = points_by_return[block];
+            counts.fill(0);
+            const int64_t end =
+                    std::min(num_points, (block + 1) * kLASBlockSize);
+            for (int64_t i = block * kLASBlockSize; i < end; ++i) {
+                uint8_t *record = records + i * layout.record_length_;
+                for (int k = 0; k < 3; ++k) {
+                    WriteLE<int32_t>(
+                            record + 4 * k,
+                            ClampLAS<int32_t>((positions_ptr[3 * i + k] -
+                                               header.offset_[k]) /
+                                              header.scale_[k]));
+                }
+                if (intensities_ptr) {
+                    WriteLE<uint16_t>(record + 12,
+                                      ClampLAS<uint16_t>(intensities_ptr[i]));
+                }
+                const uint8_t return_idx =
+                        return_number_ptr
+                                ? std::min<uint8_t>(
+                                          ClampLAS<uint8_t>(
+                                                  return_number_ptr[i]),
+                                          7)
+                                : 1;
+                const uint8_t num_returns =
+                        number_of_returns_ptr
+                                ? std::min<uint8_t>(
+                                          ClampLAS<uint8_t>(
+                                                  number_of_returns_ptr[i]),
+                                          7)
+                                : 1;
+                record[14] = return_idx | (num_returns << 3);
+                if (classification_ptr) {
+                    record[15] = std::min<uint8_t>(
+                            ClampLAS<uint8_t>(classification_ptr[i]), 31);
+                }
+                if (gps_time_ptr) {
+                    WriteLE<double>(record + layout.gps_time_offset_,
+                                    gps_time_ptr[i]);
+                }
+                if (colors_ptr) {
+                    for (int k = 0; k < 3; ++k) {
+                        WriteLE<uint16_t>(
+                                record + layout.rgb_offset_ + 2 * k,
+                                ClampLAS<uint16_t>(colors_ptr[3 * i + k]));
+                    }
+                }
+                if (return_idx >= 1 && return_idx <= 5) {
+                    ++counts[return_idx - 1];
+                }
+            }
+        }
+        for (int r = 0; r < 5; ++r) {
+            uint32_t count = 0;
+            for (const std::array<uint32_t, 5> &counts : points_by_return) {
+                count += counts[r];
+            }
+            WriteLE<uint32_t>(data + 111 + 4 * r, count);
+        }
+
+        utility::filesystem::CFile file;
+        if (!file.Open(filename, "wb")) {
+            utility::LogWarning("Write LAS failed: unable to open file: {}",
+                                filename);
+            return false;
+        }
+        utility::CountingProgressReporter reporter(params.update_progress);
+        reporter.SetTotal(num_points);
+        if (fwrite(buffer.data(), 1, buffer.size(), file.GetFILE()) !=
+            buffer.size()) {
+            utility::LogWarning("Write LAS failed: unable to write file: {}",
+                                filename);
+            return false;
+        }
+        reporter.Finish();
+        return true;
+    } catch (const std::exception &e) {
+        utility::LogWarning("Write LAS failed with exception: {}", e.what());
+        return false;
+    }
+}
+
+namespace {
+
+/// Reads the point records of uncompressed LAS files in chunks through a
+/// memory mapping of the file.
+class LASChunkReader : public PointCloudChunkReader {
+public:
+    explicit LASChunkReader(int64_t chunk_size)
+        : PointCloudChunkReader(chunk_size) {}
+
+    bool Open(const std::string &filename) override {
+        Close();
+        if (!file_.Open(filename)) {
+            utility::LogWarning("Read LAS failed: unable to open file: {}",
+                                filename);
+            return false;
+        }
+        if (!ReadLASHeader(file_, header_, layout_)) {
+            Close();
+            return false;
+        }
+        return true;
+    }
+
+    void Close() override {
+        file_.Close();
+        header_ = LASHeader();
+        num_points_read_ = 0;
+    }
+
+    bool IsOpened() const override { return file_.IsOpen(); }
+
+    bool IsEOF() const override {
+        return num_points_read_ == header_.num_points_;
+    }
+
+    int64_t GetNumPoints() const override { return header_.num_points_; }
+
+    geometry::PointCloud NextChunk() override {
+        if (!IsOpened()) {
+            utility::LogError("No file is opened.");
+        }
+        if (IsEOF()) {
+            return geometry::PointCloud();
+        }
+        const int64_t num_points =
+                std::min(chunk_size_, header_.num_points_ - num_points_read_);
+        const uint8_t *records =
+                file_.GetData() + header_.point_data_offset_ +
+                num_points_read_ * header_.point_record_length_;
+        num_points_read_ += num_points;
+        return DecodeLASPoints(header_, layout_, records, num_points);
+    }
+
+private:
+    utility::filesystem::MappedFile file_;
+    LASHeader header_;
+    LASPointLayout layout_;
+    int64_t num_points_read_ = 0;
+};
+
+}  // namespace
+
+std::unique_ptr<PointCloudChunkReader> CreateLASChunkReader(
+        int64_t chunk_size) {
+    return std::make_unique<LASChunkReader>(chunk_size);
+}
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
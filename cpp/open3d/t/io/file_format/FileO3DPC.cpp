@@ -0,0 +1,593 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+// Open3D point cloud container (.o3dpc).
+//
+// The points are sorted along a Morton curve and split into tiles of at most
+// kO3DPCTileSize points. Every attribute of a tile is stored as a separate
+// block, LZF compressed if that makes it smaller. The header at the start of
+// the file lists the attributes and, for every tile, its point count, its
+// bounding box and the location of its blocks, so that readers can select
+// tiles and attributes from the memory-mapped header before decompressing
+// anything. All numbers are stored in the host byte order.
+//
+// Layout:
+//   char[8]  magic "O3DPC\0\0\1"
+//   uint64   number of points
+//   uint64   number of tiles
+//   uint32   number of attributes
+//   uint32   maximum number of points per tile
+//   attributes: uint32 name length, name, uint32 dtype code,
+//               uint32 number of dimensions after the first, int64 dimensions
+//   tiles: uint64 number of points, float64[3] min bound, float64[3] max bound,
+//          per attribute: uint64 offset, uint64 size, uint32 compressed
+//   blocks
+
+#include <tbb/parallel_sort.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "open3d/core/Dtype.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/io/FileFormatIO.h"
+#include "open3d/io/LZFCompression.h"
+#include "open3d/t/io/PointCloudIO.h"
+#include "open3d/utility/FileSystem.h"
+#include "open3d/utility/Logging.h"
+#include "open3d/utility/Parallel.h"
+#include "open3d/utility/ProgressReporters.h"
+
+namespace open3d {
+namespace t {
+namespace io {
+
+namespace {
+
+constexpr char kO3DPCMagic[8] = {'O', '3', 'D', 'P', 'C', '\0', '\0', '\1'};
+
+constexpr int64_t kO3DPCTileSize = 65536;
+
+// The dtype codes stored in the file are indices into this list.
+const std::vector<core::Dtype> &GetO3DPCDtypes() {
+    static const std::vector<core::Dtype> dtypes = {
+            core::Bool,   core::UInt8,   core::Int8,   core::UInt16,
+            core::Int16,  core::UInt32,  core::Int32,  core::UInt64,
+            core::Int64,  core::Float32, core::Float64};
+    return dtypes;
+}
+
+struct O3DPCAttribute {
+    std::string name_;
+    core::Dtype dtype_;
+    // Shape of the attribute of a single point.
+    core::SizeVector element_shape_;
+    int64_t point_byte_size_ = 0;
+};
+
+struct O3DPCBlock {
+    uint64_t offset_ = 0;
+    uint64_t size_ = 0;
+    uint32_t compressed_ = 0;
+};
+
+struct O3DPCTile {
+    int64_t num_points_ = 0;
+    double min_bound_[3] = {0, 0, 0};
+    double max_bound_[3] = {0, 0, 0};
+    std::vector<O3DPCBlock> blocks_;
+};
+
+struct O3DPCHeader {
+    int64_t num_points_ = 0;
+    std::vector<O3DPCAttribute> attributes_;
+    std::vector<O3DPCTile> tiles_;
+};
+
+class ByteWriter {
+public:
+    template <typename T>
+    void Write(const T &value) {
+        const size_t size = buffer_.size();
+        buffer_.resize(size + sizeof(T));
+        std::memcpy(buffer_.data() + size, &value, sizeof(T));
+    }
+
+    void WriteBytes(const void *data, size_t size) {
+        const char *bytes = static_cast<const char *>(data);
+        buffer_.insert(buffer_.end(), bytes, bytes + size);
+    }
+
+    const std::vector<char> &GetBuffer() const { return buffer_; }
+
+private:
+    std::vector<char> buffer_;
+};
+
+// Reads values from a memory range, failing instead of reading past its end.
+class ByteReader {
+public:
+    ByteReader(const uint8_t *begin, const uint8_t *end)
+        : position_(begin), end_(end) {}
+
+    template <typename T>
+    bool Read(T &value) {
+        return ReadBytes(&value, sizeof(T));
+    }
+
+    bool ReadBytes(void *data, size_t size) {
+        if (static_cast<size_t>(end_ - position_) < size) {
+            return false;
+        }
+        std::memcpy(data, position_, size);
+        position_ += size;
+        return true;
+    }
+
+private:
+    const uint8_t *position_;
+    const uint8_t *end_;
+};
+
+bool ReadO3DPCHeader(const utility::filesystem::MappedFile &file,
+                     O3DPCHeader &header) {
+    const std::vector<core::Dtype> &dtypes = GetO3DPCDtypes();
+    const uint64_t file_size = static_cast<uint64_t>(file.GetSize());
+    ByteReader reader(file.GetData(), file.GetData() + file_size);
+    char magic[8];
+    uint64_t num_points = 0, num_tiles = 0;
+    uint32_t num_attributes = 0, tile_size = 0;
+    if (!reader.ReadBytes(magic, 8) ||
+        std::memcmp(magic, kO3DPCMagic, 8) != 0 || !reader.Read(num_points) ||
+        !reader.Read(num_tiles) || !reader.Read(num_attributes) ||
+        !reader.Read(tile_size)) {
+        utility::LogWarning("Read O3DPC failed: not an O3DPC file.");
+        return false;
+    }
+    header.num_points_ = static_cast<int64_t>(num_points);
+
+    header.attributes_.resize(num_attributes);
+    for (O3DPCAttribute &attribute : header.attributes_) {
+        uint32_t name_length = 0, dtype_code = 0, num_dims = 0;
+        if (!reader.Read(name_length) || name_length > file_size) {
+            utility::LogWarning("Read O3DPC failed: corrupt header.");
+            return false;
+        }
+        attribute.name_.resize(name_length);
+        if (!reader.ReadBytes(&attribute.name_[0], name_length) ||
+            !reader.Read(dtype_code) || dtype_code >= dtypes.size() ||
+            !reader.Read(num_dims) || num_dims > 8) {
+            utility::LogWarning("Read O3DPC failed: corrupt header.");
+            return false;
+        }
+        attribute.dtype_ = dtypes[dtype_code];
+        attribute.element_shape_.resize(num_dims);
+        for (int64_t &dim : attribute.element_shape_) {
+            if (!reader.Read(dim) || dim < 0) {
+                utility::LogWarning("Read O3DPC failed: corrupt header.");
+                return false;
+            }
+        }
+        attribute.point_byte_size_ = attribute.element_shape_.NumElements() *
+                                     attribute.dtype_.ByteSize();
+    }
+
+    if (num_tiles > file_size) {
+        utility::LogWarning("Read O3DPC failed: corrupt header.");
+        return false;
+    }
+    header.tiles_.resize(num_tiles);
+    int64_t total_points = 0;
+    for (O3DPCTile &tile : header.tiles_) {
+        uint64_t tile_points = 0;
+        if (!reader.Read(tile_points) || tile_points > tile_size ||
+            !reader.ReadBytes(tile.min_bound_, sizeof(tile.min_bound_)) ||
+            !reader.ReadBytes(tile.max_bound_, sizeof(tile.max_bound_))) {
+            utility::LogWarning("Read O3DPC failed: corrupt header.");
+            return false;
+        }
+        tile.num_points_ = static_cast<int64_t>(tile_points);
+        total_points += tile.num_points_;
+        tile.blocks_.resize(num_attributes);
+        for (O3DPCBlock &block : tile.blocks_) {
+            if (!reader.Read(block.offset_) || !reader.Read(block.size_) ||
+                !reader.Read(block.compressed_) ||
+                block.offset_ > file_size ||
+                block.size_ > file_size - block.offset_) {
+                utility::LogWarning("Read O3DPC failed: corrupt header.");
+                return false;
+            }
+        }
+    }
+    if (total_points != header.num_points_) {
+        utility::LogWarning("Read O3DPC failed: corrupt header.");
+        return false;
+    }
+    return true;
+}
+
+// Interleaves the lower 21 bits of x, y and z.
+uint64_t GetMortonCode(uint32_t x, uint32_t y, uint32_t z) {
+    auto spread = [](uint64_t v) {
+        v &= 0x1fffff;
+        v = (v | v << 32) & 0x1f00000000ffff;
+        v = (v | v << 16) & 0x1f0000ff0000ff;
+        v = (v | v << 8) & 0x100f00f00f00f00f;
+        v = (v | v << 4) & 0x10c30c30c30c30c3;
+        v = (v | v << 2) & 0x1249249249249249;
+        return v;
+    };
+    return spread(x) | spread(y) << 1 | spread(z) << 2;
+}
+
+// Returns the order of the points along a Morton curve through their
+// bounding box.
+core::Tensor GetMortonOrder(const core::Tensor &positions) {
+    const int64_t num_points = positions.GetLength();
+    std::vector<std::pair<uint64_t, int64_t>> codes(num_points);
+    if (num_points > 0) {
+        const double *positions_ptr = positions.GetDataPtr<double>();
+        const core::Tensor min_values = positions.Min({0});
+        const core::Tensor max_values = positions.Max({0});
+        double min_bound[3], scale[3];
+        for (int k = 0; k < 3; ++k) {
+            min_bound[k] = min_values[k].Item<double>();
+            const double extent = max_values[k].Item<double>() - min_bound[k];
+            scale[k] = extent > 0 ? 0x1fffff / extent : 0;
+        }
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+        for (int64_t i = 0; i < num_points; ++i) {
+            uint32_t cell[3];
+            for (int k = 0; k < 3; ++k) {
+                const double value =
+                        (positions_ptr[3 * i + k] - min_bound[k]) * scale[k];
+                // Also maps NaN to 0.
+                cell[k] = value > 0 ? static_cast<uint32_t>(
+                                              std::min(value, 2097151.0))
+                                    : 0;
+            }
+            codes[i] = {GetMortonCode(cell[0], cell[1], cell[2]), i};
+        }
+        tbb::parallel_sort(codes.begin(), codes.end());
+    }
+    core::Tensor order({num_points}, core::Int64);
+    int64_t *order_ptr = order.GetDataPtr<int64_t>();
+    for (int64_t i = 0; i < num_points; ++i) {
+        order_ptr[i] = codes[i].second;
+    }
+    return order;
+}
+
+}  // namespace
+
+open3d::io::FileGeometry ReadFileGeometryTypeO3DPC(const std::string &path) {
+    return open3d::io::CONTAINS_POINTS;
+}
+
+bool ReadPointCloudSubsetFromO3DPC(
+        const std::string &filename,
+        geometry::PointCloud &pointcloud,
+        const ReadPointCloudSubsetOption &subset,
+        const open3d::io::ReadPointCloudOption &params) {
+    try {
+        utility::filesystem::MappedFile file;
+        if (!file.Open(filename)) {
+            utility::LogWarning("Read O3DPC failed: unable to open file: {}",
+                                filename);
+            return false;
+        }
+        O3DPCHeader header;
+        if (!ReadO3DPCHeader(file, header)) {
+            return false;
+        }
+
+        // Select the attributes and the tiles that intersect the box.
+        std::vector<size_t> attribute_ids;
+        for (size_t a = 0; a < header.attributes_.size(); ++a) {
+            const std::string &name = header.attributes_[a].name_;
+            if (subset.attributes.empty() || name == "positions" ||
+                std::find(subset.attributes.begin(), subset.attributes.end(),
+                          name) != subset.attributes.end()) {
+                attribute_ids.push_back(a);
+            }
+        }
+        double min_bound[3], max_bound[3];
+        const bool has_bound = subset.min_bound.NumElements() > 0 ||
+                               subset.max_bound.NumElements() > 0;
+        if (has_bound) {
+            if (subset.min_bound.NumElements() != 3 ||
+                subset.max_bound.NumElements() != 3) {
+                utility::LogError(
+                        "min_bound and max_bound must have 3 elements.");
+            }
+            const core::Tensor min_values =
+                    subset.min_bound.To(core::Device("CPU:0"), core::Float64)
+                            .Contiguous();
+            const core::Tensor max_values =
+                    subset.max_bound.To(core::Device("CPU:0"), core::Float64)
+                            .Contiguous();
+            for (int k = 0; k < 3; ++k) {
+                min_bound[k] = min_values.GetDataPtr<double>()[k];
+                max_bound[k] = max_values.GetDataPtr<double>()[k];
+            }
+        }
+        std::vector<const O3DPCTile *> tiles;
+        std::vector<int64_t> tile_offsets = {0};
+        for (const O3DPCTile &tile : header.tiles_) {
+            bool intersects = true;
+            for (int k = 0; has_bound && k < 3; ++k) {
+                intersects = intersects && tile.max_bound_[k] >= min_bound[k] &&
+                             tile.min_bound_[k] <= max_bound[k];
+            }
+            if (intersects) {
+                tiles.push_back(&tile);
+                tile_offsets.push_back(tile_offsets.back() + tile.num_points_);
+            }
+        }
+        const int64_t num_points = tile_offsets.back();
+
+        utility::CountingProgressReporter reporter(params.update_progress);
+        reporter.SetTotal(num_points);
+
+        std::vector<core::Tensor> tensors;
+        std::vector<uint8_t *> data_ptrs;
+        for (size_t a : attribute_ids) {
+            const O3DPCAttribute &attribute = header.attributes_[a];
+            core::SizeVector shape = {num_points};
+            shape.insert(shape.end(), attribute.element_shape_.begin(),
+                         attribute.element_shape_.end());
+            tensors.emplace_back(shape, attribute.dtype_);
+            data_ptrs.push_back(
+                    static_cast<uint8_t *>(tensors.back().GetDataPtr()));
+        }
+
+        const int64_t num_tiles = static_cast<int64_t>(tiles.size());
+        std::vector<char> tile_read(num_tiles, 0);
+#pragma omp parallel for schedule(dynamic) \
+        num_threads(utility::EstimateMaxThreads())
+        for (int64_t t = 0; t < num_tiles; ++t) {
+            bool success = true;
+            for (size_t i = 0; i < attribute_ids.size() && success; ++i) {
+                const O3DPCAttribute &attribute =
+                        header.attributes_[attribute_ids[i]];
+                const O3DPCBlock &block = tiles[t]->blocks_[attribute_ids[i]];
+                const uint8_t *src = file.GetData() + block.offset_;
+                uint8_t *dst = data_ptrs[i] +
+                               tile_offsets[t] * attribute.point_byte_size_;
+                const int64_t size =
+                        tiles[t]->num_points_ * attribute.point_byte_size_;
+                if (block.compressed_) {
+                    success = size <= std::numeric_limits<uint32_t>::max() &&
+                              open3d::io::DecompressLZF(
+                                      src, static_cast<uint32_t>(block.size_),
+                                      dst, static_cast<uint32_t>(size));
+                } else if (static_cast<int64_t>(block.size_) == size) {
+                    std::memcpy(dst, src, size);
+                } else {
+                    success = false;
+                }
+            }
+            tile_read[t] = success;
+        }
+        if (std::find(tile_read.begin(), tile_read.end(), 0) !=
+            tile_read.end()) {
+            utility::LogWarning("Read O3DPC failed: corrupt data in {}.",
+                                filename);
+            return false;
+        }
+
+        pointcloud.Clear();
+        for (size_t i = 0; i < attribute_ids.size(); ++i) {
+            pointcloud.SetPointAttr(header.attributes_[attribute_ids[i]].name_,
+                                    tensors[i]);
+        }
+        reporter.Finish();
+        return true;
+    } catch (const std::exception &e) {
+        utility::LogWarning("Read O3DPC failed with exception: {}", e.what());
+        return false;
+    }
+}
+
+bool ReadPointCloudFromO3DPC(const std::string &filename,
+                             geometry::PointCloud &pointcloud,
+                             const open3d::io::ReadPointCloudOption &params) {
+    return ReadPointCloudSubsetFromO3DPC(filename, pointcloud, {}, params);
+}
+
+bool WritePointCloudToO3DPC(const std::string &filename,
+                            const geometry::PointCloud &pointcloud,
+                            const open3d::io::WritePointCloudOption &params) {
+    try {
+        const core::Tensor &points = pointcloud.GetPointPositions();
+        if (!points.GetShape().IsCompatible({utility::nullopt, 3})) {
+            utility::LogWarning(
+                    "Write O3DPC failed: Shape of points is {}, but it should "
+                    "be Nx3.",
+                    points.GetShape());
+            return false;
+        }
+        const int64_t num_points = points.GetLength();
+        const std::vector<core::Dtype> &dtypes = GetO3DPCDtypes();
+
+        // Reorder all attributes along the Morton curve.
+        const core::Tensor positions =
+                points.To(core::Device("CPU:0"), core::Float64).Contiguous();
+        const core::Tensor order = GetMortonOrder(positions);
+        const core::Tensor sorted_positions = positions.IndexGet({order});
+        std::vector<std::string> names;
+        std::vector<core::Tensor> attributes;
+        for (const auto &kv : pointcloud.GetPointAttr()) {
+            const core::Tensor &attr = kv.second;
+            if (attr.GetLength() != num_points ||
+                std::find(dtypes.begin(), dtypes.end(), attr.GetDtype()) ==
+                        dtypes.end()) {
+                utility::LogWarning(
+                        "Write O3DPC: skipping attribute {} with shape {} and "
+                        "dtype {}.",
+                        kv.first, attr.GetShape(), attr.GetDtype().ToString());
+                continue;
+            }
+            names.push_back(kv.first);
+            attributes.push_back(attr.To(core::Device("CPU:0"))
+                                         .IndexGet({order})
+                                         .Contiguous());
+        }
+
+        const int64_t num_tiles =
+                (num_points + kO3DPCTileSize - 1) / kO3DPCTileSize;
+        const int64_t num_attributes = static_cast<int64_t>(names.size());
+        std::vector<O3DPCTile> tiles(num_tiles);
+        // Compressed blocks, indexed by tile and attribute.
+        std::vector<std::vector<char>> blocks(num_tiles * num_attributes);
+        std::vector<int64_t> point_byte_sizes;
+        for (const core::Tensor &attr : attributes) {
+            const core::SizeVector &shape = attr.GetShape();
+            point_byte_sizes.push_back(
+                    core::SizeVector(shape.begin() + 1, shape.end())
+                            .NumElements() *
+                    attr.GetDtype().ByteSize());
+        }
+        const double *positions_ptr = sorted_positions.GetDataPtr<double>();
+#pragma omp parallel for schedule(dynamic) \
+        num_threads(utility::EstimateMaxThreads())
+        for (int64_t t = 0; t < num_tiles; ++t) {
+            O3DPCTile &tile = tiles[t];
+            const int64_t begin = t * kO3DPCTileSize;
+            const int64_t end = std::min(num_points, begin + kO3DPCTileSize);
+            tile.num_points_ = end - begin;
+            for (int k = 0; k < 3; ++k) {
+                tile.min_bound_[k] = std::numeric_limits<double>::infinity();
+                tile.max_bound_[k] = -std::numeric_limits<double>::infinity();
+            }
+            for (int64_t i = begin; i < end; ++i) {
+                for (int k = 0; k < 3; ++k) {
+                    const double value = positions_ptr[i * 3 + k];
+                    tile.min_bound_[k] = std::min(tile.min_bound_[k], value);
+                    tile.max_bound_[k] = std::max(tile.max_bound_[k], value);
+                }
+            }
+            tile.blocks_.resize(num_attributes);
+            for (int64_t a = 0; a < num_attributes; ++a) {
+                const char *src =
+                        static_cast<const char *>(attributes[a].GetDataPtr()) +
+                        begin * point_byte_sizes[a];
+                const int64_t size = tile.num_points_ * point_byte_sizes[a];
+                std::vector<char> &block = blocks[t * num_attributes + a];
+                if (bool(params.compressed) &&
+                    size <= std::numeric_limits<uint32_t>::max() &&
+                    open3d::io::CompressLZF(src, static_cast<uint32_t>(size),
+                                            block) &&
+                    static_cast<int64_t>(block.size()) < size) {
+                    tile.blocks_[a].compressed_ = 1;
+                } else {
+                    block.assign(src, src + size);
+                }
+                tile.blocks_[a].size_ = block.size();
+            }
+        }
+
+        // Build the header, which needs the sizes of all blocks.
+        ByteWriter writer;
+        writer.WriteBytes(kO3DPCMagic, 8);
+        writer.Write(static_cast<uint64_t>(num_points));
+        writer.Write(static_cast<uint64_t>(num_tiles));
+        writer.Write(static_cast<uint32_t>(num_attributes));
+        writer.Write(static_cast<uint32_t>(kO3DPCTileSize));
+        for (int64_t a = 0; a < num_attributes; ++a) {
+            writer.Write(static_cast<uint32_t>(names[a].size()));
+            writer.WriteBytes(names[a].data(), names[a].size());
+            writer.Write(static_cast<uint32_t>(
+                    std::find(dtypes.begin(), dtypes.end(),
+                              attributes[a].GetDtype()) -
+                    dtypes.begin()));
+            const core::SizeVector &shape = attributes[a].GetShape();
+            writer.Write(static_cast<uint32_t>(shape.size() - 1));
+            for (size_t d = 1; d < shape.size(); ++d) {
+                writer.Write(shape[d]);
+            }
+        }
+        const size_t tile_entry_size =
+                sizeof(uint64_t) + 6 * sizeof(double) +
+                num_attributes * (2 * sizeof(uint64_t) + sizeof(uint32_t));
+        uint64_t offset =
+                writer.GetBuffer().size() + num_tiles * tile_entry_size;
+        for (O3DPCTile &tile : tiles) {
+            writer.Write(static_cast<uint64_t>(tile.num_points_));
+            writer.WriteBytes(tile.min_bound_, sizeof(tile.min_bound_));
+            writer.WriteBytes(tile.max_bound_, sizeof(tile.max_bound_));
+            for (O3DPCBlock &block : tile.blocks_) {
+                block.offset_ = offset;
+                offset += block.size_;
+                writer.Write(block.offset_);
+                writer.Write(block.size_);
+                writer.Write(block.compressed_);
+            }
+        }
+
+        utility::filesystem::CFile file;
+        if (!file.Open(filename, "wb")) {
+            utility::LogWarning("Write O3DPC failed: unable to open file: {}",
+                                filename);
+            return false;
+        }
+        utility::CountingProgressReporter reporter(params.update_progress);
+        reporter.SetTotal(num_tiles);
+        const std::vector<char> &buffer = writer.GetBuffer();
+        bool success = fwrite(buffer.data(), 1, buffer.size(),
+                              file.GetFILE()) == buffer.size();
+        for (int64_t t = 0; t < num_tiles && success; ++t) {
+            for (int64_t a = 0; a < num_attributes && success; ++a) {
+                const std::vector<char> &block =
+                        blocks[t * num_attributes + a];
+                success = fwrite(block.data(), 1, block.size(),
+                                 file.GetFILE()) == block.size();
+            }
+            reporter.Update(t);
+        }
+        if (!success) {
+            utility::LogWarning("Write O3DPC failed: unable to write file: {}",
+                                filename);
+            return false;
+        }
+        reporter.Finish();
+        return true;
+    } catch (const std::exception &e) {
+        utility::LogWarning("Write O3DPC failed with exception: {}", e.what());
+        return false;
+    }
+}
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
@@ -24,8 +24,6 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
-#include <liblzf/lzf.h>
-
 #include <cinttypes>
 #include <cstdint>
 #include <cstdio>
@@ -35,6 +33,8 @@
 #include "open3d/core/ParallelFor.h"
 #include "open3d/core/Tensor.h"
 #include "open3d/io/FileFormatIO.h"
+#include "open3d/io/LZFCompression.h"
+#include "open3d/t/io/PointCloudChunkReader.h"
 #include "open3d/t/io/PointCloudIO.h"
 #include "open3d/utility/FileSystem.h"
 #include "open3d/utility/Helper.h"
@@ -468,23 +468,63 @@ static void ReadBinaryPCDElementsFromField(ReadAttributePtr &attr,
             });
 }
 
-static bool ReadPCDData(FILE *file,
-                        PCDHeader &header,
-                        t::geometry::PointCloud &pointcloud,
-                        const ReadPointCloudOption &params) {
-    // The header should have been checked
-    pointcloud.Clear();
+// Reads a field stored in column layout, i.e. with the values of all points
+// next to each other, as in BINARY_COMPRESSED data.
+static void ReadBinaryPCDColumnFromField(ReadAttributePtr &attr,
+                                         const PCLPointField &field,
+                                         const char *base_ptr,
+                                         const int num_points) {
+    const int stride = field.size * field.count;
+    if (field.name == "rgb" || field.name == "rgba") {
+        core::ParallelFor(core::Device("CPU:0"), num_points,
+                          [&](std::int64_t workload_idx) {
+                              ReadBinaryPCDColorsFromField(
+                                      attr, field,
+                                      base_ptr + workload_idx * stride,
+                                      static_cast<int>(workload_idx));
+                          });
+        return;
+    }
+    DISPATCH_DTYPE_TO_TEMPLATE(
+            GetDtypeFromPCDHeaderField(field.type, field.size), [&] {
+                scalar_t *attr_data_ptr =
+                        static_cast<scalar_t *>(attr.data_ptr_) +
+                        attr.row_idx_;
+                if (attr.row_length_ == 1 && stride == sizeof(scalar_t)) {
+                    std::memcpy(attr_data_ptr, base_ptr,
+                                num_points * sizeof(scalar_t));
+                    return;
+                }
+                core::ParallelFor(
+                        core::Device("CPU:0"), num_points,
+                        [&](std::int64_t workload_idx) {
+                            std::memcpy(attr_data_ptr +
+                                                workload_idx * attr.row_length_,
+                                        base_ptr + workload_idx * stride,
+                                        sizeof(scalar_t));
+                        });
+            });
+}
 
-    std::unordered_map<std::string, ReadAttributePtr> map_field_to_attr_ptr;
+// Allocates the attributes of num_points points in pointcloud and maps the
+// header fields to them.
+static bool InitializeAttributes(
+        PCDHeader &header,
+        const int num_points,
+        t::geometry::PointCloud &pointcloud,
+        std::unordered_map<std::string, ReadAttributePtr>
+                &map_field_to_attr_ptr) {
+    pointcloud.Clear();
+    map_field_to_attr_ptr.clear();
 
     if (header.has_attr["positions"]) {
         pointcloud.SetPointPositions(core::Tensor::Empty(
-                {header.points, 3}, header.attr_dtype["positions"]));
+                {num_points, 3}, header.attr_dtype["positions"]));
 
         void *data_ptr = pointcloud.GetPointPositions().GetDataPtr();
-        ReadAttributePtr position_x(data_ptr, 0, 3, header.points);
-        ReadAttributePtr position_y(data_ptr, 1, 3, header.points);
-        ReadAttributePtr position_z(data_ptr, 2, 3, header.points);
+        ReadAttributePtr position_x(data_ptr, 0, 3, num_points);
+        ReadAttributePtr position_y(data_ptr, 1, 3, num_points);
+        ReadAttributePtr position_z(data_ptr, 2, 3, num_points);
 
         map_field_to_attr_ptr.emplace(std::string("x"), position_x);
         map_field_to_attr_ptr.emplace(std::string("y"), position_y);
@@ -496,12 +536,12 @@ static bool ReadPCDData(FILE *file,
     }
     if (header.has_attr["normals"]) {
         pointcloud.SetPointNormals(core::Tensor::Empty(
-                {header.points, 3}, header.attr_dtype["normals"]));
+                {num_points, 3}, header.attr_dtype["normals"]));
 
         void *data_ptr = pointcloud.GetPointNormals().GetDataPtr();
-        ReadAttributePtr normal_x(data_ptr, 0, 3, header.points);
-        ReadAttributePtr normal_y(data_ptr, 1, 3, header.points);
-        ReadAttributePtr normal_z(data_ptr, 2, 3, header.points);
+        ReadAttributePtr normal_x(data_ptr, 0, 3, num_points);
+        ReadAttributePtr normal_y(data_ptr, 1, 3, num_points);
+        ReadAttributePtr normal_z(data_ptr, 2, 3, num_points);
 
         map_field_to_attr_ptr.emplace(std::string("normal_x"), normal_x);
         map_field_to_attr_ptr.emplace(std::string("normal_y"), normal_y);
@@ -511,10 +551,10 @@ static bool ReadPCDData(FILE *file,
         // Colors stored in a PCD file is ALWAYS in UInt8 format.
         // However it is stored as a single packed floating value.
         pointcloud.SetPointColors(
-                core::Tensor::Empty({header.points, 3}, core::UInt8));
+                core::Tensor::Empty({num_points, 3}, core::UInt8));
 
         void *data_ptr = pointcloud.GetPointColors().GetDataPtr();
-        ReadAttributePtr colors(data_ptr, 0, 3, header.points);
+        ReadAttributePtr colors(data_ptr, 0, 3, num_points);
 
         map_field_to_attr_ptr.emplace(std::string("colors"), colors);
     }
@@ -528,16 +568,70 @@ static bool ReadPCDData(FILE *file,
             field.name != "rgba") {
             pointcloud.SetPointAttr(
                     field.name,
-                    core::Tensor::Empty({header.points, 1},
+                    core::Tensor::Empty({num_points, 1},
                                         header.attr_dtype[field.name]));
 
             void *data_ptr = pointcloud.GetPointAttr(field.name).GetDataPtr();
-            ReadAttributePtr attr(data_ptr, 0, 1, header.points);
+            ReadAttributePtr attr(data_ptr, 0, 1, num_points);
 
             map_field_to_attr_ptr.emplace(field.name, attr);
         }
     }
 
+    return true;
+}
+
+static void ReadASCIIPCDPoint(
+        const PCDHeader &header,
+        const std::vector<std::string> &strs,
+        std::unordered_map<std::string, ReadAttributePtr>
+                &map_field_to_attr_ptr,
+        const int index) {
+    for (size_t i = 0; i < header.fields.size(); ++i) {
+        const auto &field = header.fields[i];
+        if (field.name == "rgb" || field.name == "rgba") {
+            ReadASCIIPCDColorsFromField(map_field_to_attr_ptr["colors"],
+                                        field,
+                                        strs[field.count_offset].c_str(),
+                                        index);
+        } else {
+            ReadASCIIPCDElementsFromField(map_field_to_attr_ptr[field.name],
+                                          field,
+                                          strs[field.count_offset].c_str(),
+                                          index);
+        }
+    }
+}
+
+static void ReadBinaryPCDPoint(
+        const PCDHeader &header,
+        const char *record,
+        std::unordered_map<std::string, ReadAttributePtr>
+                &map_field_to_attr_ptr,
+        const int index) {
+    for (const auto &field : header.fields) {
+        if (field.name == "rgb" || field.name == "rgba") {
+            ReadBinaryPCDColorsFromField(map_field_to_attr_ptr["colors"],
+                                         field, record + field.offset, index);
+        } else {
+            ReadBinaryPCDElementsFromField(map_field_to_attr_ptr[field.name],
+                                           field, record + field.offset,
+                                           index);
+        }
+    }
+}
+
+static bool ReadPCDData(FILE *file,
+                        PCDHeader &header,
+                        t::geometry::PointCloud &pointcloud,
+                        const ReadPointCloudOption &params) {
+    // The header should have been checked
+    std::unordered_map<std::string, ReadAttributePtr> map_field_to_attr_ptr;
+    if (!InitializeAttributes(header, header.points, pointcloud,
+                              map_field_to_attr_ptr)) {
+        return false;
+    }
+
     utility::CountingProgressReporter reporter(params.update_progress);
     reporter.SetTotal(header.points);
 
@@ -552,18 +646,7 @@ static bool ReadPCDData(FILE *file,
             if ((int)strs.size() < header.elementnum) {
                 continue;
             }
-            for (size_t i = 0; i < header.fields.size(); ++i) {
-                const auto &field = header.fields[i];
-                if (field.name == "rgb" || field.name == "rgba") {
-                    ReadASCIIPCDColorsFromField(
-                            map_field_to_attr_ptr["colors"], field,
-                            strs[field.count_offset].c_str(), idx);
-                } else {
-                    ReadASCIIPCDElementsFromField(
-                            map_field_to_attr_ptr[field.name], field,
-                            strs[field.count_offset].c_str(), idx);
-                }
-            }
+            ReadASCIIPCDPoint(header, strs, map_field_to_attr_ptr, idx);
             ++idx;
             if (idx % 1000 == 0) {
                 reporter.Update(idx);
@@ -578,17 +661,7 @@ static bool ReadPCDData(FILE *file,
                 pointcloud.Clear();
                 return false;
             }
-            for (const auto &field : header.fields) {
-                if (field.name == "rgb" || field.name == "rgba") {
-                    ReadBinaryPCDColorsFromField(
-                            map_field_to_attr_ptr["colors"], field,
-                            buffer.get() + field.offset, i);
-                } else {
-                    ReadBinaryPCDElementsFromField(
-                            map_field_to_attr_ptr[field.name], field,
-                            buffer.get() + field.offset, i);
-                }
-            }
+            ReadBinaryPCDPoint(header, buffer.get(), map_field_to_attr_ptr, i);
             if (i % 1000 == 0) {
                 reporter.Update(i);
             }
@@ -624,10 +697,9 @@ static bool ReadPCDData(FILE *file,
         }
         std::unique_ptr<char[]> buffer(new char[uncompressed_size]);
         reporter.Update(int(reporter_total * .2));
-        if (lzf_decompress(buffer_compressed.get(),
-                           (unsigned int)compressed_size, buffer.get(),
-                           (unsigned int)uncompressed_size) !=
-            uncompressed_size) {
+        if (!open3d::io::DecompressLZF(buffer_compressed.get(),
+                                       compressed_size, buffer.get(),
+                                       uncompressed_size)) {
             utility::LogWarning("[ReadPCDData] Uncompression failed.");
             pointcloud.Clear();
             return false;
@@ -638,17 +710,11 @@ static bool ReadPCDData(FILE *file,
                     double(base_ptr - buffer.get()) / uncompressed_size;
             reporter.Update(int(reporter_total * (progress + .2)));
             if (field.name == "rgb" || field.name == "rgba") {
-                for (int i = 0; i < header.points; ++i) {
-                    ReadBinaryPCDColorsFromField(
-                            map_field_to_attr_ptr["colors"], field,
-                            base_ptr + i * field.size * field.count, i);
-                }
+                ReadBinaryPCDColumnFromField(map_field_to_attr_ptr["colors"],
+                                             field, base_ptr, header.points);
             } else {
-                for (int i = 0; i < header.points; ++i) {
-                    ReadBinaryPCDElementsFromField(
-                            map_field_to_attr_ptr[field.name], field,
-                            base_ptr + i * field.size * field.count, i);
-                }
+                ReadBinaryPCDColumnFromField(map_field_to_attr_ptr[field.name],
+                                             field, base_ptr, header.points);
             }
         }
     }
@@ -1104,7 +1170,6 @@ static bool WritePCDData(FILE *file,
         const std::uint32_t buffer_size_in_bytes =
                 header.pointsize * header.points;
         std::vector<char> buffer(buffer_size_in_bytes);
-        std::vector<char> buffer_compressed(2 * buffer_size_in_bytes);
 
         std::uint32_t buffer_index = 0;
         std::int64_t count = 0;
@@ -1112,30 +1177,37 @@ static bool WritePCDData(FILE *file,
             DISPATCH_DTYPE_TO_TEMPLATE(it.dtype_, [&]() {
                 const scalar_t *data_ptr =
                         static_cast<const scalar_t *>(it.data_ptr_);
-
-                for (int idx_offset = 0; idx_offset < it.group_size_;
-                     ++idx_offset) {
-                    for (std::int64_t i = 0; i < num_points; ++i) {
-                        std::memcpy(buffer.data() + buffer_index,
-                                    reinterpret_cast<const char *>(
-                                            &data_ptr[i * it.group_size_ +
-                                                      idx_offset]),
-                                    sizeof(scalar_t));
-                        buffer_index += sizeof(scalar_t);
-                    }
-                }
+                char *column_ptr = buffer.data() + buffer_index;
+                const std::int64_t column_size = num_points * sizeof(scalar_t);
+
+                core::ParallelFor(
+                        core::Device("CPU:0"), num_points,
+                        [&](std::int64_t workload_idx) {
+                            const scalar_t *src =
+                                    data_ptr + workload_idx * it.group_size_;
+                            char *dst = column_ptr +
+                                        workload_idx * sizeof(scalar_t);
+                            for (int idx_offset = 0;
+                                 idx_offset < it.group_size_; ++idx_offset) {
+                                std::memcpy(dst + idx_offset * column_size,
+                                            src + idx_offset,
+                                            sizeof(scalar_t));
+                            }
+                        });
+                buffer_index += it.group_size_ * column_size;
             });
 
             reporter.Update(count++);
         }
 
-        std::uint32_t size_compressed = lzf_compress(
-                buffer.data(), buffer_size_in_bytes, buffer_compressed.data(),
-                buffer_size_in_bytes * 2);
-        if (size_compressed == 0) {
+        std::vector<char> buffer_compressed;
+        if (!open3d::io::CompressLZF(buffer.data(), buffer_size_in_bytes,
+                                     buffer_compressed)) {
             utility::LogWarning("[WritePCDData] Failed to compress data.");
             return false;
         }
+        const std::uint32_t size_compressed =
+                static_cast<std::uint32_t>(buffer_compressed.size());
 
         utility::LogDebug(
                 "[WritePCDData] {:d} bytes data compressed into {:d} bytes.",
@@ -1220,6 +1292,156 @@ bool WritePointCloudToPCD(const std::string &filename,
     return true;
 }
 
+namespace {
+
+/// Reads PCD files in chunks. ASCII and binary data is read from the file
+/// chunk by chunk, binary_compressed data is decompressed once on Open()
+/// because it stores the attributes in columns.
+class PCDChunkReader : public PointCloudChunkReader {
+public:
+    explicit PCDChunkReader(int64_t chunk_size)
+        : PointCloudChunkReader(chunk_size) {}
+    ~PCDChunkReader() override { Close(); }
+
+    bool Open(const std::string &filename) override {
+        Close();
+        file_ = utility::filesystem::FOpen(filename.c_str(), "rb");
+        if (file_ == NULL) {
+            utility::LogWarning("Read PCD failed: unable to open file: {}",
+                                filename);
+            return false;
+        }
+        if (!ReadPCDHeader(file_, header_)) {
+            utility::LogWarning("Read PCD failed: unable to parse header.");
+            Close();
+            return false;
+        }
+        if (header_.datatype == PCDDataType::BINARY_COMPRESSED &&
+            !ReadCompressedData()) {
+            utility::LogWarning("Read PCD failed: unable to read data.");
+            Close();
+            return false;
+        }
+        num_points_ = header_.points;
+        return true;
+    }
+
+    void Close() override {
+        if (file_) {
+            fclose(file_);
+            file_ = nullptr;
+        }
+        buffer_.clear();
+        buffer_.shrink_to_fit();
+        num_points_ = 0;
+        num_points_read_ = 0;
+    }
+
+    bool IsOpened() const override { return file_ != nullptr; }
+
+    bool IsEOF() const override { return num_points_read_ == num_points_; }
+
+    int64_t GetNumPoints() const override { return num_points_; }
+
+    geometry::PointCloud NextChunk() override {
+        if (!IsOpened()) {
+            utility::LogError("No file is opened.");
+        }
+        const int num_points = static_cast<int>(
+                std::min<int64_t>(chunk_size_, num_points_ - num_points_read_));
+        geometry::PointCloud pointcloud;
+        std::unordered_map<std::string, ReadAttributePtr> map_field_to_attr_ptr;
+        InitializeAttributes(header_, num_points, pointcloud,
+                             map_field_to_attr_ptr);
+
+        int num_read = 0;
+        if (header_.datatype == PCDDataType::ASCII) {
+            char line_buffer[DEFAULT_IO_BUFFER_SIZE];
+            while (num_read < num_points &&
+                   fgets(line_buffer, DEFAULT_IO_BUFFER_SIZE, file_)) {
+                std::vector<std::string> strs =
+                        utility::SplitString(line_buffer, "\t\r\n ");
+                if ((int)strs.size() < header_.elementnum) {
+                    continue;
+                }
+                ReadASCIIPCDPoint(header_, strs, map_field_to_attr_ptr,
+                                  num_read);
+                ++num_read;
+            }
+        } else if (header_.datatype == PCDDataType::BINARY) {
+            std::vector<char> buffer(int64_t(num_points) * header_.pointsize);
+            num_read = static_cast<int>(fread(buffer.data(), header_.pointsize,
+                                              num_points, file_));
+            for (int i = 0; i < num_read; ++i) {
+                const char *record =
+                        buffer.data() + int64_t(i) * header_.pointsize;
+                ReadBinaryPCDPoint(header_, record, map_field_to_attr_ptr, i);
+            }
+        } else {
+            for (const auto &field : header_.fields) {
+                const char *base_ptr =
+                        buffer_.data() + int64_t(field.offset) * num_points_ +
+                        num_points_read_ * field.size * field.count;
+                const bool is_color =
+                        field.name == "rgb" || field.name == "rgba";
+                ReadBinaryPCDColumnFromField(
+                        map_field_to_attr_ptr[is_color ? "colors" : field.name],
+                        field, base_ptr, num_points);
+            }
+            num_read = num_points;
+        }
+
+        num_points_read_ += num_read;
+        if (num_read < num_points) {
+            utility::LogWarning(
+                    "Read PCD: the file has {} points instead of {}.",
+                    num_points_read_, num_points_);
+            num_points_ = num_points_read_;
+            geometry::PointCloud truncated;
+            for (const auto &kv : pointcloud.GetPointAttr()) {
+                truncated.SetPointAttr(kv.first,
+                                       kv.second.Slice(0, 0, num_read));
+            }
+            return truncated;
+        }
+        return pointcloud;
+    }
+
+private:
+    bool ReadCompressedData() {
+        std::uint32_t compressed_size;
+        std::uint32_t uncompressed_size;
+        if (fread(&compressed_size, sizeof(compressed_size), 1, file_) != 1 ||
+            fread(&uncompressed_size, sizeof(uncompressed_size), 1, file_) !=
+                    1 ||
+            uncompressed_size < int64_t(header_.pointsize) * header_.points) {
+            return false;
+        }
+        std::vector<char> buffer_compressed(compressed_size);
+        if (fread(buffer_compressed.data(), 1, compressed_size, file_) !=
+            compressed_size) {
+            return false;
+        }
+        buffer_.resize(uncompressed_size);
+        return open3d::io::DecompressLZF(buffer_compressed.data(),
+                                         compressed_size, buffer_.data(),
+                                         uncompressed_size);
+    }
+
+    FILE *file_ = nullptr;
+    PCDHeader header_;
+    std::vector<char> buffer_;
+    int64_t num_points_ = 0;
+    int64_t num_points_read_ = 0;
+};
+
+}  // namespace
+
+std::unique_ptr<PointCloudChunkReader> CreatePCDChunkReader(
+        int64_t chunk_size) {
+    return std::make_unique<PCDChunkReader>(chunk_size);
+}
+
 }  // namespace io
 }  // namespace t
 }  // namespace open3d
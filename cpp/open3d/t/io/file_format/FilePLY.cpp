@@ -26,15 +26,20 @@
 
 #include <rply.h>
 
+#include <algorithm>
+#include <cstring>
+#include <sstream>
 #include <vector>
 
 #include "open3d/core/Dtype.h"
 #include "open3d/core/Tensor.h"
 #include "open3d/io/FileFormatIO.h"
 #include "open3d/t/geometry/TensorMap.h"
+#include "open3d/t/io/PointCloudChunkReader.h"
 #include "open3d/t/io/PointCloudIO.h"
 #include "open3d/utility/FileSystem.h"
 #include "open3d/utility/Logging.h"
+#include "open3d/utility/Parallel.h"
 #include "open3d/utility/ProgressReporters.h"
 
 namespace open3d {
@@ -44,11 +49,14 @@ namespace io {
 struct PLYReaderState {
     struct AttrState {
         std::string name_;
+        core::Dtype dtype_;
         void *data_ptr_;
         int stride_;
         int offset_;
         int64_t size_;
         int64_t current_size_;
+        // Offset of the property in a binary vertex record.
+        int64_t record_offset_;
     };
     // Allow fast access of attr_state by index.
     std::vector<std::shared_ptr<AttrState>> id_to_attr_state_;
@@ -142,6 +150,181 @@ static core::Dtype GetDtype(e_ply_type type) {
     }
 }
 
+// Returns the size in bytes of a scalar property in a binary PLY file, or -1
+// for list properties.
+static int64_t GetPlyTypeSize(e_ply_type type) {
+    if (type == PLY_INT8 || type == PLY_UINT8 || type == PLY_CHAR ||
+        type == PLY_UCHAR) {
+        return 1;
+    } else if (type == PLY_INT16 || type == PLY_UINT16 || type == PLY_SHORT ||
+               type == PLY_USHORT) {
+        return 2;
+    } else if (type == PLY_INT32 || type == PLY_UIN32 || type == PLY_INT ||
+               type == PLY_UINT || type == PLY_FLOAT32 || type == PLY_FLOAT) {
+        return 4;
+    } else if (type == PLY_FLOAT64 || type == PLY_DOUBLE) {
+        return 8;
+    } else {
+        return -1;
+    }
+}
+
+// Returns the size in bytes of one record of a binary PLY element, or -1 if
+// the element has list properties.
+static int64_t GetPlyElementRecordSize(p_ply_element element) {
+    int64_t record_size = 0;
+    p_ply_property property = ply_get_next_property(element, nullptr);
+    while (property) {
+        e_ply_type type;
+        ply_get_property_info(property, nullptr, &type, nullptr, nullptr);
+        const int64_t size = GetPlyTypeSize(type);
+        if (size < 0) {
+            return -1;
+        }
+        record_size += size;
+        property = ply_get_next_property(element, property);
+    }
+    return record_size;
+}
+
+// Locates the binary body of a PLY file the same way rply does: it starts
+// right after "end_header" and its line break, which is two bytes if the magic
+// number line ends with "\r\n". Returns -1 for ASCII files, files in foreign
+// byte order and malformed headers.
+static int64_t GetNativeBinaryDataOffset(
+        const utility::filesystem::MappedFile &file) {
+    const char *begin = reinterpret_cast<const char *>(file.GetData());
+    const char *end = begin + file.GetSize();
+    if (file.GetSize() < 5 || std::strncmp(begin, "ply", 3) != 0) {
+        return -1;
+    }
+    const bool rn = begin[3] == '\r' && begin[4] == '\n';
+
+    const uint16_t byte_order_mark = 1;
+    const std::string native_format =
+            *reinterpret_cast<const uint8_t *>(&byte_order_mark) == 1
+                    ? "binary_little_endian"
+                    : "binary_big_endian";
+    bool is_native = false;
+    const char *line = begin;
+    while (line < end) {
+        const char *line_end = std::find(line, end, '\n');
+        std::istringstream words(std::string(line, line_end));
+        std::string keyword;
+        words >> keyword;
+        if (keyword == "format") {
+            std::string format;
+            words >> format;
+            is_native = format == native_format;
+        } else if (keyword == "end_header") {
+            if (!is_native) {
+                return -1;
+            }
+            return (line - begin) + std::strlen("end_header") + 1 + rn;
+        }
+        line = line_end + 1;
+    }
+    return -1;
+}
+
+// Returns the offset of the vertex records of a binary PLY file in the native
+// byte order, or -1 if the file layout is not supported, e.g. for ASCII files
+// or if an element up to the vertices has list properties.
+static int64_t GetNativeBinaryVertexOffset(
+        const utility::filesystem::MappedFile &file,
+        p_ply ply_file,
+        p_ply_element vertex_element) {
+    int64_t offset = GetNativeBinaryDataOffset(file);
+    if (offset < 0) {
+        return -1;
+    }
+
+    // Skip the elements stored before the vertices.
+    p_ply_element element = ply_get_next_element(ply_file, nullptr);
+    while (element != vertex_element) {
+        long num_records = 0;
+        ply_get_element_info(element, nullptr, &num_records);
+        const int64_t record_size = GetPlyElementRecordSize(element);
+        if (record_size < 0) {
+            return -1;
+        }
+        offset += record_size * num_records;
+        element = ply_get_next_element(ply_file, element);
+    }
+    long num_vertices = 0;
+    ply_get_element_info(vertex_element, nullptr, &num_vertices);
+    const int64_t record_size = GetPlyElementRecordSize(vertex_element);
+    if (record_size < 0 ||
+        offset + record_size * num_vertices > file.GetSize()) {
+        return -1;
+    }
+    return offset;
+}
+
+// De-interleaves the binary vertex records [start, end) into the attribute
+// tensors of state in parallel.
+static void CopyPLYVertexRecords(const uint8_t *records,
+                                 int64_t record_size,
+                                 int64_t start,
+                                 int64_t end,
+                                 const PLYReaderState &state) {
+    const int64_t block_size = 1 << 16;
+    const int64_t num_blocks = (end - start + block_size - 1) / block_size;
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t block = 0; block < num_blocks; ++block) {
+        const int64_t block_start = start + block * block_size;
+        const int64_t block_end = std::min(block_start + block_size, end);
+        for (const auto &attr_state : state.id_to_attr_state_) {
+            DISPATCH_DTYPE_TO_TEMPLATE(attr_state->dtype_, [&]() {
+                scalar_t *data_ptr =
+                        static_cast<scalar_t *>(attr_state->data_ptr_);
+                const uint8_t *src = records + attr_state->record_offset_;
+                for (int64_t i = block_start; i < block_end; ++i) {
+                    std::memcpy(&data_ptr[attr_state->stride_ * i +
+                                          attr_state->offset_],
+                                src + i * record_size, sizeof(scalar_t));
+                }
+            });
+        }
+    }
+}
+
+// Reads the vertex element of a binary PLY file in the native byte order
+// directly from a memory mapping of the file. The fixed-size vertex records
+// are de-interleaved into the attribute tensors in parallel, which is much
+// faster than one rply callback per value. Returns false without reading if
+// the file layout is not supported, see GetNativeBinaryVertexOffset().
+static bool ReadPLYVerticesMapped(const std::string &filename,
+                                  p_ply ply_file,
+                                  p_ply_element vertex_element,
+                                  int64_t num_vertices,
+                                  const PLYReaderState &state,
+                                  utility::CountingProgressReporter &reporter) {
+    utility::filesystem::MappedFile file;
+    if (!file.Open(filename)) {
+        return false;
+    }
+    const int64_t offset =
+            GetNativeBinaryVertexOffset(file, ply_file, vertex_element);
+    if (offset < 0) {
+        return false;
+    }
+
+    const uint8_t *records = file.GetData() + offset;
+    const int64_t record_size = GetPlyElementRecordSize(vertex_element);
+    const int64_t chunk_size = 64 << 16;
+    for (int64_t chunk_start = 0; chunk_start < num_vertices;
+         chunk_start += chunk_size) {
+        const int64_t chunk_end =
+                std::min(chunk_start + chunk_size, num_vertices);
+        CopyPLYVertexRecords(records, record_size, chunk_start, chunk_end,
+                             state);
+        reporter.Update(chunk_end);
+    }
+    return true;
+}
+
 static std::tuple<std::string, int, int> GetNameStrideOffsetForAttribute(
         const std::string &name) {
     // Positions attribute.
@@ -203,11 +386,14 @@ bool ReadPointCloudFromPLY(const std::string &filename,
             {"positions", false}, {"normals", false}, {"colors", false}};
 
     p_ply_property attribute = ply_get_next_property(element, nullptr);
+    int64_t record_offset = 0;
 
     while (attribute) {
         e_ply_type type;
         const char *name;
         ply_get_property_info(attribute, &name, &type, nullptr, nullptr);
+        const int64_t property_offset = record_offset;
+        record_offset += std::max<int64_t>(GetPlyTypeSize(type), 0);
 
         if (GetDtype(type) == core::Undefined) {
             utility::LogWarning(
@@ -251,8 +437,10 @@ bool ReadPointCloudFromPLY(const std::string &filename,
                                             GetDtype(type)));
             }
 
+            attr_state->dtype_ = GetDtype(type);
             attr_state->data_ptr_ =
                     pointcloud.GetPointAttr(attr_state->name_).GetDataPtr();
+            attr_state->record_offset_ = property_offset;
 
             attr_state->size_ = element_size;
             attr_state->current_size_ = 0;
@@ -266,6 +454,13 @@ bool ReadPointCloudFromPLY(const std::string &filename,
     reporter.SetTotal(element_size);
     state.progress_bar_ = &reporter;
 
+    if (ReadPLYVerticesMapped(filename, ply_file, element, element_size, state,
+                              reporter)) {
+        ply_close(ply_file);
+        reporter.Finish();
+        return true;
+    }
+
     if (!ply_read(ply_file)) {
         utility::LogWarning("Read PLY failed: unable to read file: {}.",
                             filename);
@@ -279,6 +474,156 @@ bool ReadPointCloudFromPLY(const std::string &filename,
     return true;
 }
 
+namespace {
+
+/// Reads the vertices of binary PLY files in the native byte order in chunks
+/// through a memory mapping of the file.
+class PLYChunkReader : public PointCloudChunkReader {
+public:
+    explicit PLYChunkReader(int64_t chunk_size)
+        : PointCloudChunkReader(chunk_size) {}
+
+    bool Open(const std::string &filename) override {
+        Close();
+        p_ply ply_file = ply_open(filename.c_str(), nullptr, 0, nullptr);
+        if (!ply_file) {
+            utility::LogWarning("Read PLY failed: unable to open file: {}.",
+                                filename);
+            return false;
+        }
+        const bool success = ReadHeader(filename, ply_file);
+        ply_close(ply_file);
+        if (!success) {
+            Close();
+        }
+        return success;
+    }
+
+    void Close() override {
+        file_.Close();
+        attr_states_.clear();
+        records_ = nullptr;
+        record_size_ = 0;
+        num_points_ = 0;
+        num_points_read_ = 0;
+    }
+
+    bool IsOpened() const override { return file_.IsOpen(); }
+
+    bool IsEOF() const override { return num_points_read_ == num_points_; }
+
+    int64_t GetNumPoints() const override { return num_points_; }
+
+    geometry::PointCloud NextChunk() override {
+        if (!IsOpened()) {
+            utility::LogError("No file is opened.");
+        }
+        const int64_t num_points =
+                std::min(chunk_size_, num_points_ - num_points_read_);
+        geometry::PointCloud pointcloud;
+        PLYReaderState state;
+        for (const PLYReaderState::AttrState &attr_state : attr_states_) {
+            if (!pointcloud.HasPointAttr(attr_state.name_)) {
+                pointcloud.SetPointAttr(
+                        attr_state.name_,
+                        core::Tensor::Empty({num_points, attr_state.stride_},
+                                            attr_state.dtype_));
+            }
+            auto chunk_attr_state =
+                    std::make_shared<PLYReaderState::AttrState>(attr_state);
+            chunk_attr_state->data_ptr_ =
+                    pointcloud.GetPointAttr(attr_state.name_).GetDataPtr();
+            state.id_to_attr_state_.push_back(chunk_attr_state);
+        }
+        CopyPLYVertexRecords(records_ + num_points_read_ * record_size_,
+                             record_size_, 0, num_points, state);
+        num_points_read_ += num_points;
+        return pointcloud;
+    }
+
+private:
+    // Collects the vertex properties like ReadPointCloudFromPLY() and
+    // locates the vertex records in the mapped file.
+    bool ReadHeader(const std::string &filename, p_ply ply_file) {
+        if (!ply_read_header(ply_file)) {
+            utility::LogWarning("Read PLY failed: unable to parse header.");
+            return false;
+        }
+        const char *element_name = nullptr;
+        long element_size = 0;
+        p_ply_element element = ply_get_next_element(ply_file, nullptr);
+        while (element) {
+            ply_get_element_info(element, &element_name, &element_size);
+            if (std::string(element_name) == "vertex") {
+                break;
+            }
+            element = ply_get_next_element(ply_file, element);
+        }
+        if (!element) {
+            utility::LogWarning("Read PLY failed: no vertex attribute.");
+            return false;
+        }
+
+        p_ply_property attribute = ply_get_next_property(element, nullptr);
+        int64_t record_offset = 0;
+        while (attribute) {
+            e_ply_type type;
+            const char *name;
+            ply_get_property_info(attribute, &name, &type, nullptr, nullptr);
+            const int64_t property_offset = record_offset;
+            record_offset += std::max<int64_t>(GetPlyTypeSize(type), 0);
+            if (GetDtype(type) == core::Undefined) {
+                utility::LogWarning(
+                        "Read PLY warning: skipping property \"{}\", "
+                        "unsupported datatype \"{}\".",
+                        name, GetDtypeString(type));
+            } else {
+                PLYReaderState::AttrState attr_state;
+                std::tie(attr_state.name_, attr_state.stride_,
+                         attr_state.offset_) =
+                        GetNameStrideOffsetForAttribute(name);
+                attr_state.dtype_ = GetDtype(type);
+                attr_state.record_offset_ = property_offset;
+                attr_states_.push_back(attr_state);
+            }
+            attribute = ply_get_next_property(element, attribute);
+        }
+
+        if (!file_.Open(filename)) {
+            utility::LogWarning("Read PLY failed: unable to open file: {}.",
+                                filename);
+            return false;
+        }
+        const int64_t offset =
+                GetNativeBinaryVertexOffset(file_, ply_file, element);
+        if (offset < 0) {
+            utility::LogWarning(
+                    "Read PLY failed: only binary PLY files in the native "
+                    "byte order without list properties before the vertex "
+                    "properties can be read in chunks.");
+            return false;
+        }
+        records_ = file_.GetData() + offset;
+        record_size_ = GetPlyElementRecordSize(element);
+        num_points_ = element_size;
+        return true;
+    }
+
+    utility::filesystem::MappedFile file_;
+    std::vector<PLYReaderState::AttrState> attr_states_;
+    const uint8_t *records_ = nullptr;
+    int64_t record_size_ = 0;
+    int64_t num_points_ = 0;
+    int64_t num_points_read_ = 0;
+};
+
+}  // namespace
+
+std::unique_ptr<PointCloudChunkReader> CreatePLYChunkReader(
+        int64_t chunk_size) {
+    return std::make_unique<PLYChunkReader>(chunk_size);
+}
+
 static e_ply_type GetPlyType(const core::Dtype &dtype) {
     if (dtype == core::UInt8) {
         return PLY_UCHAR;
@@ -24,9 +24,11 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <algorithm>
 #include <cstdio>
 
 #include "open3d/core/TensorCheck.h"
+#include "open3d/io/ASCIIParser.h"
 #include "open3d/io/FileFormatIO.h"
 #include "open3d/t/io/PointCloudIO.h"
 #include "open3d/utility/FileSystem.h"
@@ -46,23 +48,29 @@ bool ReadPointCloudFromPTS(const std::string &filename,
         pointcloud.Clear();
 
         // Get num_points.
-        utility::filesystem::CFile file;
-        if (!file.Open(filename, "rb")) {
+        utility::filesystem::MappedFile file;
+        if (!file.Open(filename)) {
             utility::LogWarning("Read PTS failed: unable to open file: {}",
                                 filename);
             return false;
         }
+        const char *data = reinterpret_cast<const char *>(file.GetData());
+        const char *data_end = data + file.GetSize();
+        auto next_line = [&](const char *line) {
+            const char *line_end = std::find(line, data_end, '\n');
+            return line_end == data_end ? data_end : line_end + 1;
+        };
 
         int64_t num_points = 0;
-        const char *line_buffer;
-        if ((line_buffer = file.ReadLine())) {
+        const char *start_pos = next_line(data);
+        if (data < data_end) {
             const char *format;
             if (std::is_same<int64_t, long>::value) {
                 format = "%ld";
             } else {
                 format = "%lld";
             }
-            sscanf(line_buffer, format, &num_points);
+            sscanf(std::string(data, start_pos).c_str(), format, &num_points);
         }
         if (num_points < 0) {
             utility::LogWarning(
@@ -75,119 +83,71 @@ bool ReadPointCloudFromPTS(const std::string &filename,
         utility::CountingProgressReporter reporter(params.update_progress);
         reporter.SetTotal(num_points);
 
-        // Store data start position.
-        int64_t start_pos = ftell(file.GetFILE());
-
-        double *points_ptr = nullptr;
-        double *intensities_ptr = nullptr;
-        uint8_t *colors_ptr = nullptr;
         size_t num_fields = 0;
-
-        if ((line_buffer = file.ReadLine())) {
+        if (start_pos < data_end) {
+            const std::string line_buffer(start_pos, next_line(start_pos));
             num_fields = utility::SplitString(line_buffer, " ").size();
-
-            // X Y Z I R G B.
-            if (num_fields == 7) {
-                pointcloud.SetPointPositions(
-                        core::Tensor({num_points, 3}, core::Float64));
-                points_ptr =
-                        pointcloud.GetPointPositions().GetDataPtr<double>();
-                pointcloud.SetPointAttr(
-                        "intensities",
-                        core::Tensor({num_points, 1}, core::Float64));
-                intensities_ptr = pointcloud.GetPointAttr("intensities")
-                                          .GetDataPtr<double>();
-                pointcloud.SetPointColors(
-                        core::Tensor({num_points, 3}, core::UInt8));
-                colors_ptr = pointcloud.GetPointColors().GetDataPtr<uint8_t>();
-            }
-            // X Y Z R G B.
-            else if (num_fields == 6) {
-                pointcloud.SetPointPositions(
-                        core::Tensor({num_points, 3}, core::Float64));
-                points_ptr =
-                        pointcloud.GetPointPositions().GetDataPtr<double>();
-                pointcloud.SetPointColors(
-                        core::Tensor({num_points, 3}, core::UInt8));
-                colors_ptr = pointcloud.GetPointColors().GetDataPtr<uint8_t>();
-            }
-            // X Y Z I.
-            else if (num_fields == 4) {
-                pointcloud.SetPointPositions(
-                        core::Tensor({num_points, 3}, core::Float64));
-                points_ptr =
-                        pointcloud.GetPointPositions().GetDataPtr<double>();
-                pointcloud.SetPointAttr(
-                        "intensities",
-                        core::Tensor({num_points, 1}, core::Float64));
-                intensities_ptr = pointcloud.GetPointAttr("intensities")
-                                          .GetDataPtr<double>();
-            }
-            // X Y Z.
-            else if (num_fields == 3) {
-                pointcloud.SetPointPositions(
-                        core::Tensor({num_points, 3}, core::Float64));
-                points_ptr =
-                        pointcloud.GetPointPositions().GetDataPtr<double>();
-            } else {
+            if (num_fields != 7 && num_fields != 6 && num_fields != 4 &&
+                num_fields != 3) {
                 utility::LogWarning("Read PTS failed: unknown pts format: {}",
                                     line_buffer);
                 return false;
             }
         }
 
-        // Go to data start position.
-        fseek(file.GetFILE(), start_pos, 0);
-
-        int64_t idx = 0;
-        while (idx < num_points && (line_buffer = file.ReadLine())) {
-            double x, y, z, i;
-            int r, g, b;
-            // X Y Z I R G B.
-            if (num_fields == 7 &&
-                (sscanf(line_buffer, "%lf %lf %lf %lf %d %d %d", &x, &y, &z, &i,
-                        &r, &g, &b) == 7)) {
-                points_ptr[3 * idx + 0] = x;
-                points_ptr[3 * idx + 1] = y;
-                points_ptr[3 * idx + 2] = z;
-                intensities_ptr[idx] = i;
-                colors_ptr[3 * idx + 0] = r;
-                colors_ptr[3 * idx + 1] = g;
-                colors_ptr[3 * idx + 2] = b;
-            }
-            // X Y Z R G B.
-            else if (num_fields == 6 &&
-                     (sscanf(line_buffer, "%lf %lf %lf %d %d %d", &x, &y, &z,
-                             &r, &g, &b) == 6)) {
-                points_ptr[3 * idx + 0] = x;
-                points_ptr[3 * idx + 1] = y;
-                points_ptr[3 * idx + 2] = z;
-                colors_ptr[3 * idx + 0] = r;
-                colors_ptr[3 * idx + 1] = g;
-                colors_ptr[3 * idx + 2] = b;
-            }
-            // X Y Z I.
-            else if (num_fields == 4 && (sscanf(line_buffer, "%lf %lf %lf %lf",
-                                                &x, &y, &z, &i) == 4)) {
-                points_ptr[3 * idx + 0] = x;
-                points_ptr[3 * idx + 1] = y;
-                points_ptr[3 * idx + 2] = z;
-                intensities_ptr[idx] = i;
-            }
-            // X Y Z.
-            else if (num_fields == 3 &&
-                     sscanf(line_buffer, "%lf %lf %lf", &x, &y, &z) == 3) {
-                points_ptr[3 * idx + 0] = x;
-                points_ptr[3 * idx + 1] = y;
-                points_ptr[3 * idx + 2] = z;
-            } else {
-                utility::LogWarning("Read PTS failed at line: {}", line_buffer);
+        if (num_fields > 0) {
+            const open3d::io::ASCIIRows rows = open3d::io::ParseASCIIRows(
+                    start_pos, data_end, static_cast<int>(num_fields),
+                    num_points, false, [&](int64_t, int64_t num_rows) {
+                        reporter.Update(num_rows);
+                    });
+            if (rows.GetInvalidLine()) {
+                utility::LogWarning(
+                        "Read PTS failed at line: {}",
+                        std::string(rows.GetInvalidLine(),
+                                    next_line(rows.GetInvalidLine())));
                 return false;
             }
-            idx++;
-            if (idx % 1000 == 0) {
-                reporter.Update(idx);
+            const int64_t num_rows = rows.NumRows();
+
+            // X Y Z I R G B, X Y Z R G B, X Y Z I or X Y Z.
+            const bool has_intensities = num_fields == 7 || num_fields == 4;
+            const bool has_colors = num_fields == 7 || num_fields == 6;
+            const int color_offset = has_intensities ? 4 : 3;
+            pointcloud.SetPointPositions(
+                    core::Tensor({num_rows, 3}, core::Float64));
+            double *points_ptr =
+                    pointcloud.GetPointPositions().GetDataPtr<double>();
+            double *intensities_ptr = nullptr;
+            uint8_t *colors_ptr = nullptr;
+            if (has_intensities) {
+                pointcloud.SetPointAttr(
+                        "intensities",
+                        core::Tensor({num_rows, 1}, core::Float64));
+                intensities_ptr = pointcloud.GetPointAttr("intensities")
+                                          .GetDataPtr<double>();
+            }
+            if (has_colors) {
+                pointcloud.SetPointColors(
+                        core::Tensor({num_rows, 3}, core::UInt8));
+                colors_ptr = pointcloud.GetPointColors().GetDataPtr<uint8_t>();
             }
+            rows.ForEachRow([&](int64_t idx, const double *values) {
+                points_ptr[3 * idx + 0] = values[0];
+                points_ptr[3 * idx + 1] = values[1];
+                points_ptr[3 * idx + 2] = values[2];
+                if (has_intensities) {
+                    intensities_ptr[idx] = values[3];
+                }
+                if (has_colors) {
+                    colors_ptr[3 * idx + 0] =
+                            static_cast<int>(values[color_offset + 0]);
+                    colors_ptr[3 * idx + 1] =
+                            static_cast<int>(values[color_offset + 1]);
+                    colors_ptr[3 * idx + 2] =
+                            static_cast<int>(values[color_offset + 2]);
+                }
+            });
         }
 
         reporter.Finish();
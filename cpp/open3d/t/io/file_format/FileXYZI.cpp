@@ -28,6 +28,7 @@
 
 #include "open3d/core/Dtype.h"
 #include "open3d/core/Tensor.h"
+#include "open3d/io/ASCIIParser.h"
 #include "open3d/io/FileFormatIO.h"
 #include "open3d/t/io/PointCloudIO.h"
 #include "open3d/utility/FileSystem.h"
@@ -46,36 +47,34 @@ bool ReadPointCloudFromXYZI(const std::string &filename,
                             geometry::PointCloud &pointcloud,
                             const open3d::io::ReadPointCloudOption &params) {
     try {
-        utility::filesystem::CFile file;
-        if (!file.Open(filename, "r")) {
+        utility::filesystem::MappedFile file;
+        if (!file.Open(filename)) {
             utility::LogWarning("Read XYZI failed: unable to open file: {}",
                                 filename);
             return false;
         }
         utility::CountingProgressReporter reporter(params.update_progress);
-        reporter.SetTotal(file.GetFileSize());
-        int64_t num_points = file.GetNumLines();
+        reporter.SetTotal(file.GetSize());
+
+        const char *data = reinterpret_cast<const char *>(file.GetData());
+        const open3d::io::ASCIIRows rows = open3d::io::ParseASCIIRows(
+                data, data + file.GetSize(), 4, -1, true,
+                [&](int64_t num_bytes, int64_t) {
+                    reporter.Update(num_bytes);
+                });
+        const int64_t num_points = rows.NumRows();
 
         pointcloud.Clear();
         core::Tensor points({num_points, 3}, core::Float64);
         core::Tensor intensities({num_points, 1}, core::Float64);
         double *points_ptr = points.GetDataPtr<double>();
         double *intensities_ptr = intensities.GetDataPtr<double>();
-
-        int i = 0;
-        double x, y, z, I;
-        const char *line_buffer;
-        while ((line_buffer = file.ReadLine())) {
-            if (sscanf(line_buffer, "%lf %lf %lf %lf", &x, &y, &z, &I) == 4) {
-                points_ptr[3 * i + 0] = x;
-                points_ptr[3 * i + 1] = y;
-                points_ptr[3 * i + 2] = z;
-                intensities_ptr[i] = I;
-            }
-            if (++i % 1000 == 0) {
-                reporter.Update(file.CurPos());
-            }
-        }
+        rows.ForEachRow([&](int64_t idx, const double *values) {
+            points_ptr[3 * idx + 0] = values[0];
+            points_ptr[3 * idx + 1] = values[1];
+            points_ptr[3 * idx + 2] = values[2];
+            intensities_ptr[idx] = values[3];
+        });
         pointcloud.SetPointPositions(points);
         pointcloud.SetPointAttr("intensities", intensities);
         reporter.Finish();
@@ -0,0 +1,206 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/t/io/sensor/RGBDCaptureService.h"
+
+#include <algorithm>
+#include <chrono>
+
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace t {
+namespace io {
+
+/// Lock-free single producer, single consumer ring buffer of frames. The
+/// capture thread of the sensor is the producer, GetFrames() the consumer.
+struct RGBDCaptureService::Channel {
+    struct Slot {
+        geometry::RGBDImage rgbd;
+        uint64_t timestamp = 0;
+    };
+
+    explicit Channel(size_t buffer_size) : slots(buffer_size + 1) {}
+
+    /// Producer: returns false if the buffer is full.
+    bool Push(geometry::RGBDImage &&rgbd, uint64_t timestamp) {
+        const size_t h = head.load(std::memory_order_relaxed);
+        const size_t next = (h + 1) % slots.size();
+        if (next == tail.load(std::memory_order_acquire)) return false;
+        slots[h].rgbd = std::move(rgbd);
+        slots[h].timestamp = timestamp;
+        head.store(next, std::memory_order_release);
+        return true;
+    }
+
+    /// Consumer: returns the oldest frame or nullptr if the buffer is empty.
+    Slot *Front() {
+        const size_t t = tail.load(std::memory_order_relaxed);
+        if (t == head.load(std::memory_order_acquire)) return nullptr;
+        return &slots[t];
+    }
+
+    /// Consumer: removes the oldest frame.
+    void Pop() {
+        const size_t t = tail.load(std::memory_order_relaxed);
+        slots[t] = Slot();
+        tail.store((t + 1) % slots.size(), std::memory_order_release);
+    }
+
+    std::vector<Slot> slots;
+    std::atomic<size_t> head{0};
+    std::atomic<size_t> tail{0};
+    std::atomic<uint64_t> dropped{0};
+};
+
+RGBDCaptureService::RGBDCaptureService(
+        const std::vector<std::shared_ptr<RGBDSensor>> &sensors,
+        size_t buffer_size,
+        bool align_depth_to_color,
+        const core::Device &device)
+    : sensors_(sensors),
+      align_depth_to_color_(align_depth_to_color),
+      device_(device),
+      running_(false) {
+    if (sensors_.empty()) {
+        utility::LogError("RGBDCaptureService needs at least one sensor.");
+    }
+    if (buffer_size == 0) {
+        utility::LogError("buffer_size must be positive.");
+    }
+    for (const auto &sensor : sensors_) {
+        if (!sensor) utility::LogError("Sensor must not be null.");
+        channels_.emplace_back(new Channel(buffer_size));
+    }
+}
+
+RGBDCaptureService::~RGBDCaptureService() { Stop(); }
+
+bool RGBDCaptureService::Start() {
+    if (running_) return true;
+    for (size_t i = 0; i < sensors_.size(); ++i) {
+        if (!sensors_[i]->StartCapture()) {
+            utility::LogWarning("Failed to start capture on sensor {}.", i);
+            for (size_t j = 0; j < i; ++j) sensors_[j]->StopCapture();
+            return false;
+        }
+    }
+    running_ = true;
+    for (size_t i = 0; i < sensors_.size(); ++i) {
+        threads_.emplace_back(&RGBDCaptureService::CaptureLoop, this, i);
+    }
+    return true;
+}
+
+void RGBDCaptureService::Stop() {
+    if (!running_) return;
+    running_ = false;
+    for (auto &thread : threads_) thread.join();
+    threads_.clear();
+    for (auto &sensor : sensors_) sensor->StopCapture();
+}
+
+void RGBDCaptureService::CaptureLoop(size_t index) {
+    RGBDSensor &sensor = *sensors_[index];
+    Channel &channel = *channels_[index];
+    try {
+        while (running_) {
+            geometry::RGBDImage rgbd =
+                    sensor.CaptureFrame(true, align_depth_to_color_);
+            if (rgbd.IsEmpty()) continue;
+            const uint64_t timestamp = sensor.GetTimestamp();
+            if (rgbd.color_.GetDevice() != device_) {
+                rgbd = rgbd.To(device_);
+            }
+            if (!channel.Push(std::move(rgbd), timestamp)) {
+                ++channel.dropped;
+            }
+        }
+    } catch (const std::exception &e) {
+        utility::LogWarning("Capture on sensor {} stopped: {}", index,
+                            e.what());
+    }
+}
+
+bool RGBDCaptureService::GetFrames(std::vector<geometry::RGBDImage> &frames,
+                                   std::vector<uint64_t> &timestamps,
+                                   uint64_t max_skew_us,
+                                   int timeout_ms) {
+    const auto deadline = std::chrono::steady_clock::now() +
+                          std::chrono::milliseconds(timeout_ms);
+    std::vector<Channel::Slot *> heads(channels_.size());
+    while (true) {
+        bool complete = true;
+        for (size_t i = 0; i < channels_.size(); ++i) {
+            heads[i] = channels_[i]->Front();
+            complete &= heads[i] != nullptr;
+        }
+        if (!complete) {
+            if (timeout_ms >= 0 &&
+                std::chrono::steady_clock::now() > deadline) {
+                return false;
+            }
+            std::this_thread::sleep_for(std::chrono::microseconds(500));
+            continue;
+        }
+
+        // Discard frames that are too old to be matched with the newest head.
+        uint64_t newest = 0;
+        for (const Channel::Slot *head : heads) {
+            newest = std::max(newest, head->timestamp);
+        }
+        bool discarded = false;
+        for (size_t i = 0; i < channels_.size(); ++i) {
+            if (newest - heads[i]->timestamp > max_skew_us) {
+                channels_[i]->Pop();
+                ++channels_[i]->dropped;
+                discarded = true;
+            }
+        }
+        if (discarded) continue;
+
+        frames.resize(channels_.size());
+        timestamps.resize(channels_.size());
+        for (size_t i = 0; i < channels_.size(); ++i) {
+            frames[i] = std::move(heads[i]->rgbd);
+            timestamps[i] = heads[i]->timestamp;
+            channels_[i]->Pop();
+        }
+        return true;
+    }
+}
+
+uint64_t RGBDCaptureService::GetNumDroppedFrames(size_t index) const {
+    if (index >= channels_.size()) {
+        utility::LogError("Invalid sensor index {}.", index);
+    }
+    return channels_[index]->dropped;
+}
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
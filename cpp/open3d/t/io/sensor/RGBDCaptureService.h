@@ -0,0 +1,119 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "open3d/core/Device.h"
+#include "open3d/t/geometry/RGBDImage.h"
+#include "open3d/t/io/sensor/RGBDSensor.h"
+
+namespace open3d {
+namespace t {
+namespace io {
+
+/// \class RGBDCaptureService
+///
+/// Captures frames from several RGBD sensors concurrently.
+///
+/// Each sensor runs on its own thread, which captures and decodes frames and
+/// optionally uploads them to a device. Decoded frames are passed to the
+/// consumer through a lock-free single producer, single consumer ring buffer
+/// per sensor. If the consumer falls behind, new frames are dropped and
+/// counted in GetNumDroppedFrames().
+///
+/// GetFrames() returns one frame per sensor with timestamps within a
+/// tolerance of each other. This requires sensor timestamps in a common time
+/// domain, e.g., RealSense global timestamps or hardware synchronized
+/// cameras.
+class RGBDCaptureService {
+public:
+    /// \param sensors Initialized sensors. The service starts and stops the
+    /// capture of the sensors.
+    /// \param buffer_size The number of decoded frames buffered per sensor.
+    /// \param align_depth_to_color Align the depth images to the color images.
+    /// \param device Upload the frames to this device in the capture threads.
+    RGBDCaptureService(const std::vector<std::shared_ptr<RGBDSensor>> &sensors,
+                       size_t buffer_size = 8,
+                       bool align_depth_to_color = true,
+                       const core::Device &device = core::Device("CPU:0"));
+    ~RGBDCaptureService();
+
+    /// Start capturing on all sensors.
+    /// \return false if any sensor failed to start. Sensors that started are
+    /// stopped again in this case.
+    bool Start();
+
+    /// Stop capturing and join the capture threads.
+    void Stop();
+
+    /// Returns true while the capture threads are running.
+    bool IsRunning() const { return running_; }
+
+    /// Get synchronized frames from all sensors.
+    ///
+    /// Frames older than the newest frame at the head of any buffer by more
+    /// than \p max_skew_us are discarded until the heads of all buffers are
+    /// within \p max_skew_us of each other.
+    /// \param frames Receives one frame per sensor, in the order of the
+    /// sensors passed to the constructor.
+    /// \param timestamps Receives the timestamps (in us) of the frames.
+    /// \param max_skew_us The maximum difference between the timestamps.
+    /// \param timeout_ms Return false if no synchronized frames are available
+    /// within this time. A negative value waits indefinitely.
+    bool GetFrames(std::vector<geometry::RGBDImage> &frames,
+                   std::vector<uint64_t> &timestamps,
+                   uint64_t max_skew_us = 10000,
+                   int timeout_ms = 1000);
+
+    /// The number of sensors.
+    size_t GetNumSensors() const { return sensors_.size(); }
+
+    /// The number of frames of sensor \p index dropped because its buffer was
+    /// full or because they could not be synchronized.
+    uint64_t GetNumDroppedFrames(size_t index) const;
+
+private:
+    struct Channel;
+
+    void CaptureLoop(size_t index);
+
+    std::vector<std::shared_ptr<RGBDSensor>> sensors_;
+    std::vector<std::unique_ptr<Channel>> channels_;
+    std::vector<std::thread> threads_;
+    bool align_depth_to_color_;
+    core::Device device_;
+    std::atomic<bool> running_;
+};
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
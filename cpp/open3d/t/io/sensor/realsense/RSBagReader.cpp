@@ -29,6 +29,7 @@
 #include <json/json.h>
 
 #include <chrono>
+#include <cstring>
 #include <iomanip>
 #include <iostream>
 #include <mutex>
@@ -141,17 +142,24 @@ void RSBagReader::fill_frame_buffer() try {
 
                 frames = align_to_color.process(frames);
                 const auto &color_frame = frames.get_color_frame();
-                // Copy frame data to Tensors
-                current_frame.color_ = core::Tensor(
-                        static_cast<const uint8_t *>(color_frame.get_data()),
+                // Copy frame data to Tensors in pinned memory for fast
+                // transfers to CUDA devices.
+                current_frame.color_ = core::Tensor::EmptyPinned(
                         {color_frame.get_height(), color_frame.get_width(),
                          metadata_.color_channels_},
                         metadata_.color_dt_);
+                std::memcpy(current_frame.color_.GetDataPtr(),
+                            color_frame.get_data(),
+                            current_frame.color_.NumElements() *
+                                    metadata_.color_dt_.ByteSize());
                 const auto &depth_frame = frames.get_depth_frame();
-                current_frame.depth_ = core::Tensor(
-                        static_cast<const uint16_t *>(depth_frame.get_data()),
+                current_frame.depth_ = core::Tensor::EmptyPinned(
                         {depth_frame.get_height(), depth_frame.get_width()},
                         metadata_.depth_dt_);
+                std::memcpy(current_frame.depth_.GetDataPtr(),
+                            depth_frame.get_data(),
+                            current_frame.depth_.NumElements() *
+                                    metadata_.depth_dt_.ByteSize());
                 frame_position_us_[head_fid_ % frame_buffer_.size()] =
                         rs_device.get_position() /
                         1000;  // Convert nanoseconds -> microseconds
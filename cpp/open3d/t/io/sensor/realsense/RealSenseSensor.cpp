@@ -28,6 +28,7 @@
 
 #include <json/json.h>
 
+#include <cstring>
 #include <string>
 #include <thread>
 #include <vector>
@@ -284,18 +285,23 @@ geometry::RGBDImage RealSenseSensor::CaptureFrame(bool wait,
             return geometry::RGBDImage();
         if (align_depth_to_color) frames = align_to_color_->process(frames);
         timestamp_ = uint64_t(frames.get_timestamp() * MILLISEC_TO_MICROSEC);
-        // Copy frame data to Tensors
+        // Copy frame data to Tensors in pinned memory for fast transfers to
+        // CUDA devices.
         const auto& color_frame = frames.get_color_frame();
-        current_frame_.color_ = core::Tensor(
-                static_cast<const uint8_t*>(color_frame.get_data()),
+        current_frame_.color_ = core::Tensor::EmptyPinned(
                 {color_frame.get_height(), color_frame.get_width(),
                  metadata_.color_channels_},
                 metadata_.color_dt_);
+        std::memcpy(current_frame_.color_.GetDataPtr(), color_frame.get_data(),
+                    current_frame_.color_.NumElements() *
+                            metadata_.color_dt_.ByteSize());
         const auto& depth_frame = frames.get_depth_frame();
-        current_frame_.depth_ = core::Tensor(
-                static_cast<const uint16_t*>(depth_frame.get_data()),
+        current_frame_.depth_ = core::Tensor::EmptyPinned(
                 {depth_frame.get_height(), depth_frame.get_width()},
                 metadata_.depth_dt_);
+        std::memcpy(current_frame_.depth_.GetDataPtr(), depth_frame.get_data(),
+                    current_frame_.depth_.NumElements() *
+                            metadata_.depth_dt_.ByteSize());
         return current_frame_;
     } catch (const rs2::error& e) {
         utility::LogError("CaptureFrame() failed: {}: {}",
@@ -0,0 +1,334 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/t/pipelines/color_map/RigidOptimizer.h"
+
+#include <cstring>
+#include <memory>
+
+#include "open3d/core/EigenConverter.h"
+#include "open3d/core/TensorFunction.h"
+#include "open3d/pipelines/color_map/ColorMapUtils.h"
+#include "open3d/t/geometry/RaycastingScene.h"
+#include "open3d/t/geometry/TriangleMesh.h"
+#include "open3d/t/pipelines/kernel/ColorMap.h"
+#include "open3d/utility/Eigen.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace color_map {
+
+namespace {
+
+// Maximum number of (camera, vertex) pairs reduced by one task of the
+// normal equation kernel.
+constexpr int64_t kChunkSize = 1024;
+
+core::Tensor StackImages(const std::vector<open3d::geometry::Image> &images,
+                         core::Dtype dtype,
+                         const core::Device &device) {
+    const int64_t rows = images[0].height_;
+    const int64_t cols = images[0].width_;
+    core::Tensor stacked = core::Tensor::Empty(
+            {int64_t(images.size()), rows, cols}, dtype);
+    const int64_t image_bytes = rows * cols * dtype.ByteSize();
+    uint8_t *stacked_ptr = static_cast<uint8_t *>(stacked.GetDataPtr());
+    for (size_t c = 0; c < images.size(); ++c) {
+        const open3d::geometry::Image &image = images[c];
+        if (image.height_ != rows || image.width_ != cols ||
+            image.num_of_channels_ != 1 ||
+            image.bytes_per_channel_ != dtype.ByteSize()) {
+            utility::LogError(
+                    "All images must be one channel images of size {}x{}, but "
+                    "image {} is {}x{} with {} channels.",
+                    cols, rows, c, image.width_, image.height_,
+                    image.num_of_channels_);
+        }
+        std::memcpy(stacked_ptr + c * image_bytes, image.data_.data(),
+                    image_bytes);
+    }
+    return stacked.To(device);
+}
+
+core::Tensor StackIntrinsics(
+        const camera::PinholeCameraTrajectory &camera_trajectory,
+        const core::Device &device) {
+    const int64_t n = camera_trajectory.parameters_.size();
+    core::Tensor intrinsics = core::Tensor::Empty({n, 3, 3}, core::Float64);
+    double *ptr = intrinsics.GetDataPtr<double>();
+    for (int64_t c = 0; c < n; ++c) {
+        const Eigen::Matrix3d &K =
+                camera_trajectory.parameters_[c].intrinsic_.intrinsic_matrix_;
+        Eigen::Map<Eigen::Matrix<double, 3, 3, Eigen::RowMajor>>(ptr + 9 * c) =
+                K;
+    }
+    return intrinsics.To(device);
+}
+
+core::Tensor StackExtrinsics(
+        const camera::PinholeCameraTrajectory &camera_trajectory,
+        const core::Device &device) {
+    const int64_t n = camera_trajectory.parameters_.size();
+    core::Tensor extrinsics = core::Tensor::Empty({n, 4, 4}, core::Float64);
+    double *ptr = extrinsics.GetDataPtr<double>();
+    for (int64_t c = 0; c < n; ++c) {
+        Eigen::Map<Eigen::Matrix<double, 4, 4, Eigen::RowMajor>>(
+                ptr + 16 * c) = camera_trajectory.parameters_[c].extrinsic_;
+    }
+    return extrinsics.To(device);
+}
+
+// Removes the vertices of \p indices that are occluded by the scene when seen
+// from the camera. The rays start depth_threshold in front of the vertex, so
+// the triangles around the vertex do not occlude it.
+core::Tensor RemoveOccludedVertices(t::geometry::RaycastingScene &scene,
+                                    const core::Tensor &vertices,
+                                    const core::Tensor &indices,
+                                    const Eigen::Matrix4d &extrinsic,
+                                    double depth_threshold) {
+    const Eigen::Vector3d center_eigen = -extrinsic.block<3, 3>(0, 0)
+                                                  .transpose() *
+                                          extrinsic.block<3, 1>(0, 3);
+    const core::Tensor center =
+            core::eigen_converter::EigenMatrixToTensor(center_eigen)
+                    .Reshape({1, 3});
+
+    const core::Tensor x = vertices.IndexGet({indices});
+    core::Tensor dir = center - x;
+    const core::Tensor norm = (dir * dir).Sum({1}, true).Sqrt();
+    const core::Tensor origin = x + dir * (depth_threshold / norm);
+    dir = center - origin;
+    const core::Tensor rays =
+            core::Concatenate({origin, dir}, 1).To(core::Float32);
+    const core::Tensor occluded = scene.TestOcclusions(rays, 0.f, 1.f);
+    return indices.IndexGet({occluded.LogicalNot()});
+}
+
+}  // namespace
+
+std::pair<open3d::geometry::TriangleMesh, camera::PinholeCameraTrajectory>
+RunRigidOptimizer(const open3d::geometry::TriangleMesh &mesh,
+                  const std::vector<open3d::geometry::RGBDImage> &images_rgbd,
+                  const camera::PinholeCameraTrajectory &camera_trajectory,
+                  const RigidOptimizerOption &option,
+                  bool check_occlusion,
+                  const core::Device &device) {
+    namespace legacy = open3d::pipelines::color_map;
+
+    open3d::geometry::TriangleMesh opt_mesh = mesh;
+    camera::PinholeCameraTrajectory opt_camera_trajectory = camera_trajectory;
+    const int64_t n_camera = opt_camera_trajectory.parameters_.size();
+    const int64_t n_vertex = opt_mesh.vertices_.size();
+    if (int64_t(images_rgbd.size()) != n_camera) {
+        utility::LogError("Expected {} RGBD images, but got {}.", n_camera,
+                          images_rgbd.size());
+    }
+    if (n_camera == 0 || n_vertex == 0) {
+        utility::LogWarning("No cameras or vertices, nothing to optimize.");
+        return std::make_pair(opt_mesh, opt_camera_trajectory);
+    }
+    if (!option.debug_output_dir_.empty()) {
+        utility::LogWarning(
+                "debug_output_dir_ is not supported by the tensor color map "
+                "optimizer and will be ignored.");
+    }
+
+    utility::LogDebug("[ColorMapOptimization] CreateUtilImagesFromRGBD");
+    std::vector<open3d::geometry::Image> images_gray, images_dx, images_dy,
+            images_color, images_depth;
+    std::tie(images_gray, images_dx, images_dy, images_color, images_depth) =
+            legacy::CreateUtilImagesFromRGBD(images_rgbd);
+
+    utility::LogDebug("[ColorMapOptimization] CreateDepthBoundaryMasks");
+    const std::vector<open3d::geometry::Image> images_mask =
+            legacy::CreateDepthBoundaryMasks(
+                    images_depth,
+                    option.depth_threshold_for_discontinuity_check_,
+                    option.half_dilation_kernel_size_for_discontinuity_map_);
+
+    const core::Tensor gray = StackImages(images_gray, core::Float32, device);
+    const core::Tensor dx = StackImages(images_dx, core::Float32, device);
+    const core::Tensor dy = StackImages(images_dy, core::Float32, device);
+    const core::Tensor intrinsics =
+            StackIntrinsics(opt_camera_trajectory, device);
+    core::Tensor extrinsics = StackExtrinsics(opt_camera_trajectory, device);
+    const core::Tensor vertices = core::eigen_converter::
+            EigenVector3dVectorToTensor(opt_mesh.vertices_, core::Float64,
+                                        device);
+
+    utility::LogDebug("[ColorMapOptimization] CreateVertexAndImageVisibility");
+    std::vector<std::vector<int64_t>> visibility_image_to_vertex(n_camera);
+    {
+        const core::Tensor depth =
+                StackImages(images_depth, core::Float32, device);
+        const core::Tensor mask =
+                StackImages(images_mask, core::UInt8, device);
+
+        // The scene is CPU only, so occlusions are tested on the host.
+        std::unique_ptr<t::geometry::RaycastingScene> scene;
+        core::Tensor vertices_cpu;
+        if (check_occlusion) {
+            scene = std::make_unique<t::geometry::RaycastingScene>();
+            scene->AddTriangles(t::geometry::TriangleMesh::FromLegacy(mesh));
+            vertices_cpu = vertices.To(core::Device("CPU:0"));
+        }
+
+        for (int64_t c = 0; c < n_camera; ++c) {
+            core::Tensor visible;
+            kernel::color_map::ComputeVertexVisibility(
+                    vertices, depth[c], mask[c], intrinsics[c], extrinsics[c],
+                    visible, option.maximum_allowable_depth_,
+                    option.depth_threshold_for_visibility_check_);
+            core::Tensor indices =
+                    visible.NonZero()[0].To(core::Device("CPU:0"));
+            if (check_occlusion && indices.GetLength() > 0) {
+                indices = RemoveOccludedVertices(
+                        *scene, vertices_cpu, indices,
+                        opt_camera_trajectory.parameters_[c].extrinsic_,
+                        option.depth_threshold_for_visibility_check_);
+            }
+            visibility_image_to_vertex[c] = indices.ToFlatVector<int64_t>();
+            utility::LogDebug(
+                    "[cam {:d}]: {:d}/{:d} ({:.5f}%) vertices are visible", c,
+                    visibility_image_to_vertex[c].size(), n_vertex,
+                    double(visibility_image_to_vertex[c].size()) / n_vertex *
+                            100);
+        }
+    }
+
+    // Camera-major pairs, split into chunks of a single camera, for the
+    // normal equations.
+    std::vector<int64_t> camera_vertices;
+    std::vector<int64_t> chunk_offsets{0};
+    std::vector<int64_t> camera_chunk_offsets{0};
+    // Vertex-major pairs for the proxy intensities and the final colors.
+    std::vector<std::vector<int>> visibility_vertex_to_image(n_vertex);
+    for (int64_t c = 0; c < n_camera; ++c) {
+        for (const int64_t vid : visibility_image_to_vertex[c]) {
+            camera_vertices.push_back(vid);
+            visibility_vertex_to_image[vid].push_back(int(c));
+        }
+        for (int64_t begin = chunk_offsets.back();
+             begin < int64_t(camera_vertices.size()); begin += kChunkSize) {
+            chunk_offsets.push_back(std::min(begin + kChunkSize,
+                                             int64_t(camera_vertices.size())));
+        }
+        camera_chunk_offsets.push_back(int64_t(chunk_offsets.size()) - 1);
+    }
+    std::vector<int64_t> vertex_offsets{0};
+    std::vector<int32_t> vertex_cameras;
+    vertex_cameras.reserve(camera_vertices.size());
+    for (int64_t v = 0; v < n_vertex; ++v) {
+        for (const int c : visibility_vertex_to_image[v]) {
+            vertex_cameras.push_back(c);
+        }
+        vertex_offsets.push_back(vertex_cameras.size());
+    }
+    const int64_t n_pair = camera_vertices.size();
+    const core::Tensor camera_vertices_t(camera_vertices, {n_pair},
+                                         core::Int64, device);
+    const core::Tensor chunk_offsets_t(chunk_offsets,
+                                       {int64_t(chunk_offsets.size())},
+                                       core::Int64, device);
+    const core::Tensor camera_chunk_offsets_t(camera_chunk_offsets,
+                                              {n_camera + 1}, core::Int64,
+                                              device);
+    const core::Tensor vertex_offsets_t(vertex_offsets, {n_vertex + 1},
+                                        core::Int64, device);
+    const core::Tensor vertex_cameras_t(vertex_cameras, {n_pair}, core::Int32,
+                                        device);
+
+    utility::LogDebug("[ColorMapOptimization] Rigid Optimization");
+    core::Tensor proxy_intensity;
+    kernel::color_map::ComputeProxyIntensity(
+            vertices, gray, intrinsics, extrinsics, vertex_offsets_t,
+            vertex_cameras_t, proxy_intensity, option.image_boundary_margin_);
+    for (int itr = 0; itr < option.maximum_iteration_; itr++) {
+        utility::LogDebug("[Iteration {:04d}] ", itr + 1);
+        core::Tensor global_sums;
+        kernel::color_map::ComputeRigidJacobianSums(
+                vertices, proxy_intensity, gray, dx, dy, intrinsics,
+                extrinsics, camera_vertices_t, chunk_offsets_t,
+                camera_chunk_offsets_t, global_sums,
+                option.image_boundary_margin_);
+        const core::Tensor global_sums_cpu =
+                global_sums.To(core::Device("CPU:0"));
+        const double *sums_ptr = global_sums_cpu.GetDataPtr<double>();
+
+        double residual = 0.0;
+        for (int64_t c = 0; c < n_camera; ++c) {
+            const double *sums = sums_ptr + 28 * c;
+            Eigen::Matrix6d JTJ;
+            Eigen::Vector6d JTr;
+            int offset = 0;
+            for (int i = 0; i < 6; ++i) {
+                for (int j = 0; j <= i; ++j) {
+                    JTJ(i, j) = JTJ(j, i) = sums[offset++];
+                }
+            }
+            for (int i = 0; i < 6; ++i) {
+                JTr(i) = sums[21 + i];
+            }
+            residual += sums[27];
+
+            bool is_success;
+            Eigen::Matrix4d delta;
+            std::tie(is_success, delta) =
+                    utility::SolveJacobianSystemAndObtainExtrinsicMatrix(JTJ,
+                                                                         JTr);
+            opt_camera_trajectory.parameters_[c].extrinsic_ =
+                    delta * opt_camera_trajectory.parameters_[c].extrinsic_;
+        }
+        if (n_pair > 0) {
+            utility::LogDebug("Residual error : {:.6f} (avg : {:.6f})",
+                              residual, residual / n_pair);
+        } else {
+            utility::LogDebug("Residual error : {:.6f}", residual);
+        }
+
+        extrinsics = StackExtrinsics(opt_camera_trajectory, device);
+        kernel::color_map::ComputeProxyIntensity(
+                vertices, gray, intrinsics, extrinsics, vertex_offsets_t,
+                vertex_cameras_t, proxy_intensity,
+                option.image_boundary_margin_);
+    }
+
+    utility::LogDebug("[ColorMapOptimization] Set Mesh Color");
+    legacy::SetGeometryColorAverage(
+            opt_mesh, images_color, utility::nullopt, opt_camera_trajectory,
+            visibility_vertex_to_image, option.image_boundary_margin_,
+            option.invisible_vertex_color_knn_);
+
+    return std::make_pair(opt_mesh, opt_camera_trajectory);
+}
+
+}  // namespace color_map
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
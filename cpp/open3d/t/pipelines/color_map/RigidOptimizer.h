@@ -0,0 +1,73 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#pragma once
+
+#include <utility>
+#include <vector>
+
+#include "open3d/camera/PinholeCameraTrajectory.h"
+#include "open3d/core/Device.h"
+#include "open3d/geometry/RGBDImage.h"
+#include "open3d/geometry/TriangleMesh.h"
+#include "open3d/pipelines/color_map/RigidOptimizer.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace color_map {
+
+using RigidOptimizerOption = open3d::pipelines::color_map::RigidOptimizerOption;
+
+/// \brief Rigid color map optimization with tensor kernels.
+///
+/// Solves the same problem as open3d::pipelines::color_map::RunRigidOptimizer,
+/// but the visibility, the proxy intensities and the normal equations of all
+/// cameras are computed in batched kernels on \p device. Only the 6x6 systems
+/// of the cameras are solved on the host. All RGBD images must have the same
+/// size.
+///
+/// \param mesh The mesh to color.
+/// \param images_rgbd The RGBD images, one per camera of the trajectory.
+/// \param camera_trajectory The initial camera poses.
+/// \param option Optimization options. debug_output_dir_ is not supported.
+/// \param check_occlusion If true, vertices that pass the depth test but are
+/// occluded by the mesh itself are also removed with a RaycastingScene.
+/// \param device The device to run the kernels on.
+/// \return The colored mesh and the optimized camera trajectory.
+std::pair<open3d::geometry::TriangleMesh, camera::PinholeCameraTrajectory>
+RunRigidOptimizer(const open3d::geometry::TriangleMesh &mesh,
+                  const std::vector<open3d::geometry::RGBDImage> &images_rgbd,
+                  const camera::PinholeCameraTrajectory &camera_trajectory,
+                  const RigidOptimizerOption &option,
+                  bool check_occlusion = false,
+                  const core::Device &device = core::Device("CPU:0"));
+
+}  // namespace color_map
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,190 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/pipelines/kernel/ColorMap.h"
+
+#include "open3d/core/TensorCheck.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace kernel {
+namespace color_map {
+
+void ComputeVertexVisibility(const core::Tensor &vertices,
+                             const core::Tensor &depth,
+                             const core::Tensor &mask,
+                             const core::Tensor &intrinsic,
+                             const core::Tensor &extrinsic,
+                             core::Tensor &visible,
+                             double maximum_allowable_depth,
+                             double depth_threshold_for_visibility_check) {
+    const core::Device device = vertices.GetDevice();
+    core::AssertTensorShape(vertices, {utility::nullopt, 3});
+    core::AssertTensorDtype(vertices, core::Float64);
+    core::AssertTensorShape(depth, {utility::nullopt, utility::nullopt});
+    core::AssertTensorDtype(depth, core::Float32);
+    core::AssertTensorShape(mask, depth.GetShape());
+    core::AssertTensorDtype(mask, core::UInt8);
+    core::AssertTensorShape(intrinsic, {3, 3});
+    core::AssertTensorShape(extrinsic, {4, 4});
+    core::AssertTensorDevice(depth, device);
+    core::AssertTensorDevice(mask, device);
+
+    const core::Tensor intrinsic_d =
+            intrinsic.To(device, core::Float64).Contiguous();
+    const core::Tensor extrinsic_d =
+            extrinsic.To(device, core::Float64).Contiguous();
+
+    const core::Device::DeviceType device_type = device.GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        ComputeVertexVisibilityCPU(vertices.Contiguous(), depth.Contiguous(),
+                                   mask.Contiguous(), intrinsic_d, extrinsic_d,
+                                   visible, maximum_allowable_depth,
+                                   depth_threshold_for_visibility_check);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(ComputeVertexVisibilityCUDA, vertices.Contiguous(),
+                  depth.Contiguous(), mask.Contiguous(), intrinsic_d,
+                  extrinsic_d, visible, maximum_allowable_depth,
+                  depth_threshold_for_visibility_check);
+    } else {
+        utility::LogError("Unimplemented device.");
+    }
+}
+
+void ComputeProxyIntensity(const core::Tensor &vertices,
+                           const core::Tensor &images_gray,
+                           const core::Tensor &intrinsics,
+                           const core::Tensor &extrinsics,
+                           const core::Tensor &vertex_offsets,
+                           const core::Tensor &vertex_cameras,
+                           core::Tensor &proxy_intensity,
+                           int image_boundary_margin) {
+    const core::Device device = vertices.GetDevice();
+    const int64_t num_cameras = images_gray.GetLength();
+    core::AssertTensorShape(vertices, {utility::nullopt, 3});
+    core::AssertTensorDtype(vertices, core::Float64);
+    core::AssertTensorShape(images_gray, {num_cameras, utility::nullopt,
+                                          utility::nullopt});
+    core::AssertTensorDtype(images_gray, core::Float32);
+    core::AssertTensorShape(intrinsics, {num_cameras, 3, 3});
+    core::AssertTensorShape(extrinsics, {num_cameras, 4, 4});
+    core::AssertTensorDtype(intrinsics, core::Float64);
+    core::AssertTensorDtype(extrinsics, core::Float64);
+    core::AssertTensorShape(vertex_offsets, {vertices.GetLength() + 1});
+    core::AssertTensorDtype(vertex_offsets, core::Int64);
+    core::AssertTensorDtype(vertex_cameras, core::Int32);
+    core::AssertTensorDevice(images_gray, device);
+    core::AssertTensorDevice(intrinsics, device);
+    core::AssertTensorDevice(extrinsics, device);
+    core::AssertTensorDevice(vertex_offsets, device);
+    core::AssertTensorDevice(vertex_cameras, device);
+
+    const core::Device::DeviceType device_type = device.GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        ComputeProxyIntensityCPU(
+                vertices.Contiguous(), images_gray.Contiguous(),
+                intrinsics.Contiguous(), extrinsics.Contiguous(),
+                vertex_offsets.Contiguous(), vertex_cameras.Contiguous(),
+                proxy_intensity, image_boundary_margin);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(ComputeProxyIntensityCUDA, vertices.Contiguous(),
+                  images_gray.Contiguous(), intrinsics.Contiguous(),
+                  extrinsics.Contiguous(), vertex_offsets.Contiguous(),
+                  vertex_cameras.Contiguous(), proxy_intensity,
+                  image_boundary_margin);
+    } else {
+        utility::LogError("Unimplemented device.");
+    }
+}
+
+void ComputeRigidJacobianSums(const core::Tensor &vertices,
+                              const core::Tensor &proxy_intensity,
+                              const core::Tensor &images_gray,
+                              const core::Tensor &images_dx,
+                              const core::Tensor &images_dy,
+                              const core::Tensor &intrinsics,
+                              const core::Tensor &extrinsics,
+                              const core::Tensor &camera_vertices,
+                              const core::Tensor &chunk_offsets,
+                              const core::Tensor &camera_chunk_offsets,
+                              core::Tensor &global_sums,
+                              int image_boundary_margin) {
+    const core::Device device = vertices.GetDevice();
+    const int64_t num_cameras = images_gray.GetLength();
+    core::AssertTensorShape(vertices, {utility::nullopt, 3});
+    core::AssertTensorDtype(vertices, core::Float64);
+    core::AssertTensorShape(proxy_intensity, {vertices.GetLength()});
+    core::AssertTensorDtype(proxy_intensity, core::Float64);
+    core::AssertTensorShape(images_gray, {num_cameras, utility::nullopt,
+                                          utility::nullopt});
+    core::AssertTensorShape(images_dx, images_gray.GetShape());
+    core::AssertTensorShape(images_dy, images_gray.GetShape());
+    core::AssertTensorDtype(images_gray, core::Float32);
+    core::AssertTensorDtype(images_dx, core::Float32);
+    core::AssertTensorDtype(images_dy, core::Float32);
+    core::AssertTensorShape(intrinsics, {num_cameras, 3, 3});
+    core::AssertTensorShape(extrinsics, {num_cameras, 4, 4});
+    core::AssertTensorDtype(intrinsics, core::Float64);
+    core::AssertTensorDtype(extrinsics, core::Float64);
+    core::AssertTensorDtype(camera_vertices, core::Int64);
+    core::AssertTensorDtype(chunk_offsets, core::Int64);
+    core::AssertTensorShape(camera_chunk_offsets, {num_cameras + 1});
+    core::AssertTensorDtype(camera_chunk_offsets, core::Int64);
+    for (const core::Tensor *t :
+         {&proxy_intensity, &images_gray, &images_dx, &images_dy, &intrinsics,
+          &extrinsics, &camera_vertices, &chunk_offsets,
+          &camera_chunk_offsets}) {
+        core::AssertTensorDevice(*t, device);
+    }
+
+    const core::Device::DeviceType device_type = device.GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        ComputeRigidJacobianSumsCPU(
+                vertices.Contiguous(), proxy_intensity.Contiguous(),
+                images_gray.Contiguous(), images_dx.Contiguous(),
+                images_dy.Contiguous(), intrinsics.Contiguous(),
+                extrinsics.Contiguous(), camera_vertices.Contiguous(),
+                chunk_offsets.Contiguous(), camera_chunk_offsets.Contiguous(),
+                global_sums, image_boundary_margin);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(ComputeRigidJacobianSumsCUDA, vertices.Contiguous(),
+                  proxy_intensity.Contiguous(), images_gray.Contiguous(),
+                  images_dx.Contiguous(), images_dy.Contiguous(),
+                  intrinsics.Contiguous(), extrinsics.Contiguous(),
+                  camera_vertices.Contiguous(), chunk_offsets.Contiguous(),
+                  camera_chunk_offsets.Contiguous(), global_sums,
+                  image_boundary_margin);
+    } else {
+        utility::LogError("Unimplemented device.");
+    }
+}
+
+}  // namespace color_map
+}  // namespace kernel
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
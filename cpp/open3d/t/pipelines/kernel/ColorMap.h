@@ -0,0 +1,158 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+// Kernels of the tensor color map optimization. The Nc cameras share one
+// image size {H, W}. The visible (camera, vertex) pairs are stored twice:
+// - Camera-major: camera_vertices {P} Int64 vertex ids, split into chunks of
+//   at most a fixed number of pairs of a single camera. chunk_offsets {C + 1}
+//   Int64 are the chunk ranges in camera_vertices and camera_chunk_offsets
+//   {Nc + 1} Int64 the chunk ranges of the cameras.
+// - Vertex-major: vertex_cameras {P} Int32 camera ids in increasing order per
+//   vertex, with vertex_offsets {V + 1} Int64 the ranges of the vertices.
+
+#pragma once
+
+#include "open3d/core/CUDAUtils.h"
+#include "open3d/core/Tensor.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace kernel {
+namespace color_map {
+
+/// Marks the vertices {V, 3} Float64 that are visible to one camera. A vertex
+/// is visible if it projects into the depth image {H, W} Float32, the sensor
+/// depth is at most \p maximum_allowable_depth, the depth boundary mask {H, W}
+/// UInt8 is not set (255) and the sensor depth is within
+/// \p depth_threshold_for_visibility_check of the vertex depth. intrinsic is
+/// {3, 3} and extrinsic {4, 4} Float64. visible {V} Bool [output].
+void ComputeVertexVisibility(const core::Tensor &vertices,
+                             const core::Tensor &depth,
+                             const core::Tensor &mask,
+                             const core::Tensor &intrinsic,
+                             const core::Tensor &extrinsic,
+                             core::Tensor &visible,
+                             double maximum_allowable_depth,
+                             double depth_threshold_for_visibility_check);
+
+/// Averages the gray images {Nc, H, W} Float32 at the projections of each
+/// vertex into the cameras that see it. intrinsics {Nc, 3, 3} and extrinsics
+/// {Nc, 4, 4} are Float64. proxy_intensity {V} Float64 [output].
+void ComputeProxyIntensity(const core::Tensor &vertices,
+                           const core::Tensor &images_gray,
+                           const core::Tensor &intrinsics,
+                           const core::Tensor &extrinsics,
+                           const core::Tensor &vertex_offsets,
+                           const core::Tensor &vertex_cameras,
+                           core::Tensor &proxy_intensity,
+                           int image_boundary_margin);
+
+/// Sums the rigid photometric normal equations of each camera. global_sums
+/// {Nc, 28} Float64 [output] holds per camera the 21 upper triangle entries
+/// of J^T J, the 6 entries of J^T r and r^T r, as in the odometry reductions.
+void ComputeRigidJacobianSums(const core::Tensor &vertices,
+                              const core::Tensor &proxy_intensity,
+                              const core::Tensor &images_gray,
+                              const core::Tensor &images_dx,
+                              const core::Tensor &images_dy,
+                              const core::Tensor &intrinsics,
+                              const core::Tensor &extrinsics,
+                              const core::Tensor &camera_vertices,
+                              const core::Tensor &chunk_offsets,
+                              const core::Tensor &camera_chunk_offsets,
+                              core::Tensor &global_sums,
+                              int image_boundary_margin);
+
+void ComputeVertexVisibilityCPU(const core::Tensor &vertices,
+                                const core::Tensor &depth,
+                                const core::Tensor &mask,
+                                const core::Tensor &intrinsic,
+                                const core::Tensor &extrinsic,
+                                core::Tensor &visible,
+                                double maximum_allowable_depth,
+                                double depth_threshold_for_visibility_check);
+
+void ComputeProxyIntensityCPU(const core::Tensor &vertices,
+                              const core::Tensor &images_gray,
+                              const core::Tensor &intrinsics,
+                              const core::Tensor &extrinsics,
+                              const core::Tensor &vertex_offsets,
+                              const core::Tensor &vertex_cameras,
+                              core::Tensor &proxy_intensity,
+                              int image_boundary_margin);
+
+void ComputeRigidJacobianSumsCPU(const core::Tensor &vertices,
+                                 const core::Tensor &proxy_intensity,
+                                 const core::Tensor &images_gray,
+                                 const core::Tensor &images_dx,
+                                 const core::Tensor &images_dy,
+                                 const core::Tensor &intrinsics,
+                                 const core::Tensor &extrinsics,
+                                 const core::Tensor &camera_vertices,
+                                 const core::Tensor &chunk_offsets,
+                                 const core::Tensor &camera_chunk_offsets,
+                                 core::Tensor &global_sums,
+                                 int image_boundary_margin);
+
+#ifdef BUILD_CUDA_MODULE
+void ComputeVertexVisibilityCUDA(const core::Tensor &vertices,
+                                 const core::Tensor &depth,
+                                 const core::Tensor &mask,
+                                 const core::Tensor &intrinsic,
+                                 const core::Tensor &extrinsic,
+                                 core::Tensor &visible,
+                                 double maximum_allowable_depth,
+                                 double depth_threshold_for_visibility_check);
+
+void ComputeProxyIntensityCUDA(const core::Tensor &vertices,
+                               const core::Tensor &images_gray,
+                               const core::Tensor &intrinsics,
+                               const core::Tensor &extrinsics,
+                               const core::Tensor &vertex_offsets,
+                               const core::Tensor &vertex_cameras,
+                               core::Tensor &proxy_intensity,
+                               int image_boundary_margin);
+
+void ComputeRigidJacobianSumsCUDA(const core::Tensor &vertices,
+                                  const core::Tensor &proxy_intensity,
+                                  const core::Tensor &images_gray,
+                                  const core::Tensor &images_dx,
+                                  const core::Tensor &images_dy,
+                                  const core::Tensor &intrinsics,
+                                  const core::Tensor &extrinsics,
+                                  const core::Tensor &camera_vertices,
+                                  const core::Tensor &chunk_offsets,
+                                  const core::Tensor &camera_chunk_offsets,
+                                  core::Tensor &global_sums,
+                                  int image_boundary_margin);
+#endif
+
+}  // namespace color_map
+}  // namespace kernel
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,304 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <cmath>
+
+#include "open3d/core/CUDAUtils.h"
+#include "open3d/core/ParallelFor.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/t/pipelines/kernel/ColorMap.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace kernel {
+namespace color_map {
+
+/// Projects x with the {3, 3} K and {4, 4} T, rounding u, v and z to float as
+/// the legacy color map optimizer does.
+OPEN3D_HOST_DEVICE inline void ProjectVertex(const double *x,
+                                             const double *K,
+                                             const double *T,
+                                             float &u,
+                                             float &v,
+                                             float &z) {
+    const double g0 = T[0] * x[0] + T[1] * x[1] + T[2] * x[2] + T[3];
+    const double g1 = T[4] * x[0] + T[5] * x[1] + T[6] * x[2] + T[7];
+    const double g2 = T[8] * x[0] + T[9] * x[1] + T[10] * x[2] + T[11];
+    u = float((g0 * K[0]) / g2 + K[2]);
+    v = float((g1 * K[4]) / g2 + K[5]);
+    z = float(g2);
+}
+
+OPEN3D_HOST_DEVICE inline bool IsInImage(
+        double u, double v, int64_t rows, int64_t cols, double margin) {
+    return u >= margin && u < cols - margin && v >= margin &&
+           v < rows - margin;
+}
+
+/// Bilinear interpolation as geometry::Image::FloatValueAt, 0 outside.
+OPEN3D_HOST_DEVICE inline double InterpolateBilinear(
+        const float *image, int64_t rows, int64_t cols, double u, double v) {
+    if (u < 0.0 || u > double(cols - 1) || v < 0.0 || v > double(rows - 1)) {
+        return 0.0;
+    }
+    int64_t ui = static_cast<int64_t>(u);
+    int64_t vi = static_cast<int64_t>(v);
+    ui = ui > cols - 2 ? cols - 2 : ui;
+    vi = vi > rows - 2 ? rows - 2 : vi;
+    ui = ui < 0 ? 0 : ui;
+    vi = vi < 0 ? 0 : vi;
+    const double pu = u - ui;
+    const double pv = v - vi;
+    const float *p = image + vi * cols + ui;
+    return (p[0] * (1 - pv) + p[cols] * pv) * (1 - pu) +
+           (p[1] * (1 - pv) + p[cols + 1] * pv) * pu;
+}
+
+#if defined(__CUDACC__)
+void ComputeVertexVisibilityCUDA
+#else
+void ComputeVertexVisibilityCPU
+#endif
+        (const core::Tensor &vertices,
+         const core::Tensor &depth,
+         const core::Tensor &mask,
+         const core::Tensor &intrinsic,
+         const core::Tensor &extrinsic,
+         core::Tensor &visible,
+         double maximum_allowable_depth,
+         double depth_threshold_for_visibility_check) {
+    const int64_t n = vertices.GetLength();
+    const int64_t rows = depth.GetShape(0);
+    const int64_t cols = depth.GetShape(1);
+    visible = core::Tensor::Empty({n}, core::Bool, vertices.GetDevice());
+
+    const double *vertices_ptr = vertices.GetDataPtr<double>();
+    const float *depth_ptr = depth.GetDataPtr<float>();
+    const uint8_t *mask_ptr = mask.GetDataPtr<uint8_t>();
+    const double *K = intrinsic.GetDataPtr<double>();
+    const double *T = extrinsic.GetDataPtr<double>();
+    bool *visible_ptr = visible.GetDataPtr<bool>();
+
+    core::ParallelFor(
+            vertices.GetDevice(), n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                visible_ptr[workload_idx] = false;
+                float u, v, d;
+                ProjectVertex(vertices_ptr + 3 * workload_idx, K, T, u, v, d);
+                const int64_t u_d = static_cast<int64_t>(roundf(u));
+                const int64_t v_d = static_cast<int64_t>(roundf(v));
+                if (d < 0.0 || !IsInImage(u_d, v_d, rows, cols, 0)) {
+                    return;
+                }
+                const int64_t pixel = v_d * cols + u_d;
+                const float d_sensor = depth_ptr[pixel];
+                // Background, depth boundaries and occlusions.
+                if (d_sensor > maximum_allowable_depth ||
+                    mask_ptr[pixel] == 255 ||
+                    fabs(d - d_sensor) >=
+                            depth_threshold_for_visibility_check) {
+                    return;
+                }
+                visible_ptr[workload_idx] = true;
+            });
+}
+
+#if defined(__CUDACC__)
+void ComputeProxyIntensityCUDA
+#else
+void ComputeProxyIntensityCPU
+#endif
+        (const core::Tensor &vertices,
+         const core::Tensor &images_gray,
+         const core::Tensor &intrinsics,
+         const core::Tensor &extrinsics,
+         const core::Tensor &vertex_offsets,
+         const core::Tensor &vertex_cameras,
+         core::Tensor &proxy_intensity,
+         int image_boundary_margin) {
+    const int64_t n = vertices.GetLength();
+    const int64_t rows = images_gray.GetShape(1);
+    const int64_t cols = images_gray.GetShape(2);
+    proxy_intensity =
+            core::Tensor::Empty({n}, core::Float64, vertices.GetDevice());
+
+    const double *vertices_ptr = vertices.GetDataPtr<double>();
+    const float *gray_ptr = images_gray.GetDataPtr<float>();
+    const double *Ks = intrinsics.GetDataPtr<double>();
+    const double *Ts = extrinsics.GetDataPtr<double>();
+    const int64_t *offsets_ptr = vertex_offsets.GetDataPtr<int64_t>();
+    const int32_t *cameras_ptr = vertex_cameras.GetDataPtr<int32_t>();
+    double *proxy_ptr = proxy_intensity.GetDataPtr<double>();
+
+    core::ParallelFor(
+            vertices.GetDevice(), n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                double sum = 0.0;
+                int64_t count = 0;
+                for (int64_t k = offsets_ptr[workload_idx];
+                     k < offsets_ptr[workload_idx + 1]; ++k) {
+                    const int64_t c = cameras_ptr[k];
+                    float u, v, d;
+                    ProjectVertex(vertices_ptr + 3 * workload_idx, Ks + 9 * c,
+                                  Ts + 16 * c, u, v, d);
+                    if (!IsInImage(u, v, rows, cols, image_boundary_margin)) {
+                        continue;
+                    }
+                    const int64_t u_r = static_cast<int64_t>(round(double(u)));
+                    const int64_t v_r = static_cast<int64_t>(round(double(v)));
+                    sum += gray_ptr[(c * rows + v_r) * cols + u_r];
+                    ++count;
+                }
+                proxy_ptr[workload_idx] = count > 0 ? sum / count : 0.0;
+            });
+}
+
+#if defined(__CUDACC__)
+void ComputeRigidJacobianSumsCUDA
+#else
+void ComputeRigidJacobianSumsCPU
+#endif
+        (const core::Tensor &vertices,
+         const core::Tensor &proxy_intensity,
+         const core::Tensor &images_gray,
+         const core::Tensor &images_dx,
+         const core::Tensor &images_dy,
+         const core::Tensor &intrinsics,
+         const core::Tensor &extrinsics,
+         const core::Tensor &camera_vertices,
+         const core::Tensor &chunk_offsets,
+         const core::Tensor &camera_chunk_offsets,
+         core::Tensor &global_sums,
+         int image_boundary_margin) {
+    const core::Device device = vertices.GetDevice();
+    const int64_t num_cameras = camera_chunk_offsets.GetLength() - 1;
+    const int64_t num_chunks = chunk_offsets.GetLength() - 1;
+    const int64_t rows = images_gray.GetShape(1);
+    const int64_t cols = images_gray.GetShape(2);
+
+    // The chunks are reduced separately and then summed per camera, which
+    // avoids atomics and keeps the sums deterministic.
+    core::Tensor chunk_sums =
+            core::Tensor::Empty({num_chunks, 28}, core::Float64, device);
+    global_sums = core::Tensor::Empty({num_cameras, 28}, core::Float64, device);
+
+    const double *vertices_ptr = vertices.GetDataPtr<double>();
+    const double *proxy_ptr = proxy_intensity.GetDataPtr<double>();
+    const float *gray_ptr = images_gray.GetDataPtr<float>();
+    const float *dx_ptr = images_dx.GetDataPtr<float>();
+    const float *dy_ptr = images_dy.GetDataPtr<float>();
+    const double *Ks = intrinsics.GetDataPtr<double>();
+    const double *Ts = extrinsics.GetDataPtr<double>();
+    const int64_t *camera_vertices_ptr = camera_vertices.GetDataPtr<int64_t>();
+    const int64_t *chunk_offsets_ptr = chunk_offsets.GetDataPtr<int64_t>();
+    const int64_t *camera_chunk_offsets_ptr =
+            camera_chunk_offsets.GetDataPtr<int64_t>();
+    double *chunk_sums_ptr = chunk_sums.GetDataPtr<double>();
+    double *global_sums_ptr = global_sums.GetDataPtr<double>();
+
+    core::ParallelFor(device, num_chunks, [=] OPEN3D_DEVICE(
+                                                  int64_t workload_idx) {
+        // Camera of the chunk, by binary search.
+        int64_t lo = 0, hi = num_cameras;
+        while (hi - lo > 1) {
+            const int64_t mid = (lo + hi) / 2;
+            if (camera_chunk_offsets_ptr[mid] <= workload_idx) {
+                lo = mid;
+            } else {
+                hi = mid;
+            }
+        }
+        const int64_t c = lo;
+        const double *K = Ks + 9 * c;
+        const double *T = Ts + 16 * c;
+        const int64_t image_offset = c * rows * cols;
+
+        double sums[28] = {0};
+        for (int64_t k = chunk_offsets_ptr[workload_idx];
+             k < chunk_offsets_ptr[workload_idx + 1]; ++k) {
+            const int64_t vid = camera_vertices_ptr[k];
+            const double *x = vertices_ptr + 3 * vid;
+            const double g0 = T[0] * x[0] + T[1] * x[1] + T[2] * x[2] + T[3];
+            const double g1 = T[4] * x[0] + T[5] * x[1] + T[6] * x[2] + T[7];
+            const double g2 = T[8] * x[0] + T[9] * x[1] + T[10] * x[2] + T[11];
+            const double u = (K[0] * g0 + K[1] * g1 + K[2] * g2) / g2;
+            const double v = (K[3] * g0 + K[4] * g1 + K[5] * g2) / g2;
+            if (!IsInImage(u, v, rows, cols, image_boundary_margin)) {
+                continue;
+            }
+            const double gray = InterpolateBilinear(gray_ptr + image_offset,
+                                                    rows, cols, u, v);
+            const double dIdx = InterpolateBilinear(dx_ptr + image_offset,
+                                                    rows, cols, u, v);
+            const double dIdy = InterpolateBilinear(dy_ptr + image_offset,
+                                                    rows, cols, u, v);
+            if (gray == -1.0) {
+                continue;
+            }
+            const double invz = 1. / g2;
+            const double v0 = dIdx * K[0] * invz;
+            const double v1 = dIdy * K[4] * invz;
+            const double v2 = -(v0 * g0 + v1 * g1) * invz;
+            const double J[6] = {-g2 * v1 + g1 * v2, g2 * v0 - g0 * v2,
+                                 -g1 * v0 + g0 * v1, v0,
+                                 v1,                 v2};
+            const double r = gray - proxy_ptr[vid];
+
+            int offset = 0;
+            for (int i = 0; i < 6; ++i) {
+                for (int j = 0; j <= i; ++j) {
+                    sums[offset++] += J[i] * J[j];
+                }
+            }
+            for (int i = 0; i < 6; ++i) {
+                sums[21 + i] += J[i] * r;
+            }
+            sums[27] += r * r;
+        }
+        for (int i = 0; i < 28; ++i) {
+            chunk_sums_ptr[28 * workload_idx + i] = sums[i];
+        }
+    });
+
+    core::ParallelFor(
+            device, num_cameras, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                double sums[28] = {0};
+                for (int64_t k = camera_chunk_offsets_ptr[workload_idx];
+                     k < camera_chunk_offsets_ptr[workload_idx + 1]; ++k) {
+                    for (int i = 0; i < 28; ++i) {
+                        sums[i] += chunk_sums_ptr[28 * k + i];
+                    }
+                }
+                for (int i = 0; i < 28; ++i) {
+                    global_sums_ptr[28 * workload_idx + i] = sums[i];
+                }
+            });
+}
+
+}  // namespace color_map
+}  // namespace kernel
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
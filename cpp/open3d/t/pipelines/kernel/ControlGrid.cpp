@@ -0,0 +1,83 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/t/pipelines/kernel/ControlGrid.h"
+
+#include "open3d/core/TensorCheck.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace kernel {
+
+void DeformWithControlGrid(const core::Tensor &grid_positions,
+                           const core::Tensor &nb_indices,
+                           const core::Tensor &point_ratios,
+                           const core::Tensor &normal_ratios,
+                           core::Tensor &positions,
+                           core::Tensor &normals) {
+    const core::Device device = grid_positions.GetDevice();
+    const int64_t num_points = nb_indices.GetLength();
+
+    core::AssertTensorDtype(grid_positions, core::Float32);
+    core::AssertTensorShape(grid_positions, {utility::nullopt, 3});
+    core::AssertTensorDtype(nb_indices, core::Int32);
+    core::AssertTensorShape(nb_indices, {num_points, 8});
+    core::AssertTensorDtype(point_ratios, core::Float32);
+    core::AssertTensorShape(point_ratios, {num_points, 8});
+    core::AssertTensorDevice(nb_indices, device);
+    core::AssertTensorDevice(point_ratios, device);
+    const bool has_normals = normal_ratios.NumElements() > 0;
+    if (has_normals) {
+        core::AssertTensorDtype(normal_ratios, core::Float32);
+        core::AssertTensorShape(normal_ratios, {num_points, 8});
+        core::AssertTensorDevice(normal_ratios, device);
+    }
+
+    const core::Tensor grid_positions_c = grid_positions.Contiguous();
+    const core::Tensor nb_indices_c = nb_indices.Contiguous();
+    const core::Tensor point_ratios_c = point_ratios.Contiguous();
+    const core::Tensor normal_ratios_c =
+            has_normals ? normal_ratios.Contiguous() : core::Tensor();
+
+    core::Device::DeviceType device_type = device.GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        DeformWithControlGridCPU(grid_positions_c, nb_indices_c,
+                                 point_ratios_c, normal_ratios_c, positions,
+                                 normals);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(DeformWithControlGridCUDA, grid_positions_c, nb_indices_c,
+                  point_ratios_c, normal_ratios_c, positions, normals);
+    } else {
+        utility::LogError("Unimplemented device.");
+    }
+}
+
+}  // namespace kernel
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
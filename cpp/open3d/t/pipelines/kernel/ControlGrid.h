@@ -0,0 +1,77 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#pragma once
+
+#include "open3d/core/CUDAUtils.h"
+#include "open3d/core/Tensor.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace kernel {
+
+/// \brief Deforms points embedded in a control grid by interpolating the
+/// current positions of their 8 neighbor grid points.
+///
+/// \param grid_positions Current control grid positions of shape {M, 3},
+/// Float32.
+/// \param nb_indices Neighbor grid indices of shape {N, 8}, Int32.
+/// \param point_ratios Trilinear interpolation ratios of shape {N, 8},
+/// Float32.
+/// \param normal_ratios Normal interpolation ratios of shape {N, 8}, Float32.
+/// If empty, no normals are computed.
+/// \param positions Output deformed positions of shape {N, 3}, Float32.
+/// \param normals Output deformed unit normals of shape {N, 3}, Float32. Left
+/// empty if \p normal_ratios is empty.
+void DeformWithControlGrid(const core::Tensor &grid_positions,
+                           const core::Tensor &nb_indices,
+                           const core::Tensor &point_ratios,
+                           const core::Tensor &normal_ratios,
+                           core::Tensor &positions,
+                           core::Tensor &normals);
+
+void DeformWithControlGridCPU(const core::Tensor &grid_positions,
+                              const core::Tensor &nb_indices,
+                              const core::Tensor &point_ratios,
+                              const core::Tensor &normal_ratios,
+                              core::Tensor &positions,
+                              core::Tensor &normals);
+
+#ifdef BUILD_CUDA_MODULE
+void DeformWithControlGridCUDA(const core::Tensor &grid_positions,
+                               const core::Tensor &nb_indices,
+                               const core::Tensor &point_ratios,
+                               const core::Tensor &normal_ratios,
+                               core::Tensor &positions,
+                               core::Tensor &normals);
+#endif
+
+}  // namespace kernel
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,111 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include <cmath>
+
+#include "open3d/core/ParallelFor.h"
+#include "open3d/t/pipelines/kernel/ControlGrid.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace kernel {
+
+#ifndef __CUDACC__
+using std::sqrt;
+#endif
+
+#if defined(__CUDACC__)
+void DeformWithControlGridCUDA
+#else
+void DeformWithControlGridCPU
+#endif
+        (const core::Tensor &grid_positions,
+         const core::Tensor &nb_indices,
+         const core::Tensor &point_ratios,
+         const core::Tensor &normal_ratios,
+         core::Tensor &positions,
+         core::Tensor &normals) {
+    const core::Device device = grid_positions.GetDevice();
+    const int64_t num_points = nb_indices.GetLength();
+    const bool has_normals = normal_ratios.NumElements() > 0;
+
+    positions = core::Tensor::Empty({num_points, 3}, core::Float32, device);
+    normals = has_normals ? core::Tensor::Empty({num_points, 3}, core::Float32,
+                                                device)
+                          : core::Tensor();
+
+    const float *grid_positions_ptr = grid_positions.GetDataPtr<float>();
+    const int *nb_indices_ptr = nb_indices.GetDataPtr<int>();
+    const float *point_ratios_ptr = point_ratios.GetDataPtr<float>();
+    const float *normal_ratios_ptr =
+            has_normals ? normal_ratios.GetDataPtr<float>() : nullptr;
+    float *positions_ptr = positions.GetDataPtr<float>();
+    float *normals_ptr = has_normals ? normals.GetDataPtr<float>() : nullptr;
+
+    core::ParallelFor(
+            device, num_points, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                const int *nb_idx = nb_indices_ptr + 8 * workload_idx;
+                const float *point_ratio = point_ratios_ptr + 8 * workload_idx;
+
+                float position[3] = {0, 0, 0};
+                float normal[3] = {0, 0, 0};
+                for (int nb = 0; nb < 8; ++nb) {
+                    const float *grid_position =
+                            grid_positions_ptr + 3 * nb_idx[nb];
+                    for (int k = 0; k < 3; ++k) {
+                        position[k] += point_ratio[nb] * grid_position[k];
+                    }
+                    if (normal_ratios_ptr) {
+                        const float normal_ratio =
+                                normal_ratios_ptr[8 * workload_idx + nb];
+                        for (int k = 0; k < 3; ++k) {
+                            normal[k] += normal_ratio * grid_position[k];
+                        }
+                    }
+                }
+
+                float *position_out = positions_ptr + 3 * workload_idx;
+                for (int k = 0; k < 3; ++k) {
+                    position_out[k] = position[k];
+                }
+                if (normals_ptr) {
+                    const float len = sqrt(normal[0] * normal[0] +
+                                           normal[1] * normal[1] +
+                                           normal[2] * normal[2]);
+                    float *normal_out = normals_ptr + 3 * workload_idx;
+                    for (int k = 0; k < 3; ++k) {
+                        normal_out[k] = normal[k] / len;
+                    }
+                }
+            });
+}
+
+}  // namespace kernel
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
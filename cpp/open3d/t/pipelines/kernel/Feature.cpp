@@ -0,0 +1,89 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/pipelines/kernel/Feature.h"
+
+#include "open3d/core/TensorCheck.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace kernel {
+
+void ComputeFPFHFeature(const core::Tensor &points,
+                        const core::Tensor &normals,
+                        const core::Tensor &indices,
+                        const core::Tensor &distance2,
+                        const core::Tensor &row_splits,
+                        core::Tensor &fpfhs) {
+    const core::Device device = points.GetDevice();
+    const core::Dtype dtype = points.GetDtype();
+    const int64_t num_points = points.GetLength();
+
+    core::AssertTensorDtypes(points, {core::Float32, core::Float64});
+    core::AssertTensorShape(points, {num_points, 3});
+    core::AssertTensorShape(normals, {num_points, 3});
+    core::AssertTensorShape(row_splits, {num_points + 1});
+    core::AssertTensorShape(fpfhs, {num_points, 33});
+    core::AssertTensorDtype(normals, dtype);
+    core::AssertTensorDtype(distance2, dtype);
+    core::AssertTensorDtype(fpfhs, dtype);
+    core::AssertTensorDtype(indices, core::Int64);
+    core::AssertTensorDtype(row_splits, core::Int64);
+    core::AssertTensorDevice(normals, device);
+    core::AssertTensorDevice(indices, device);
+    core::AssertTensorDevice(distance2, device);
+    core::AssertTensorDevice(row_splits, device);
+    core::AssertTensorDevice(fpfhs, device);
+    if (indices.NumElements() != distance2.NumElements()) {
+        utility::LogError(
+                "Neighbor indices and distances must have the same number of "
+                "elements, but got {} and {}.",
+                indices.NumElements(), distance2.NumElements());
+    }
+
+    const core::Tensor points_c = points.Contiguous();
+    const core::Tensor normals_c = normals.Contiguous();
+    const core::Tensor indices_c = indices.Contiguous();
+    const core::Tensor distance2_c = distance2.Contiguous();
+    const core::Tensor row_splits_c = row_splits.Contiguous();
+
+    core::Device::DeviceType device_type = device.GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        ComputeFPFHFeatureCPU(points_c, normals_c, indices_c, distance2_c,
+                              row_splits_c, fpfhs);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(ComputeFPFHFeatureCUDA, points_c, normals_c, indices_c,
+                  distance2_c, row_splits_c, fpfhs);
+    } else {
+        utility::LogError("Unimplemented device.");
+    }
+}
+
+}  // namespace kernel
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,75 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include "open3d/core/CUDAUtils.h"
+#include "open3d/core/Tensor.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace kernel {
+
+/// \brief Computes the FPFH feature of each point from its neighbors.
+///
+/// \param points Tensor of shape {N, 3}, Float32 or Float64.
+/// \param normals Tensor of shape {N, 3}, same dtype and device as points.
+/// \param indices Flat Int64 tensor of neighbor indices. The neighbors of the
+/// i-th point are at [row_splits[i], row_splits[i + 1]), the point itself
+/// first, sorted by distance. Entries of -1 are padding and skipped.
+/// \param distance2 Flat tensor of squared distances to the neighbors, laid
+/// out as \p indices.
+/// \param row_splits Int64 tensor of shape {N + 1}.
+/// \param fpfhs Output tensor of shape {N, 33}, same dtype as points, must be
+/// zero initialized.
+void ComputeFPFHFeature(const core::Tensor &points,
+                        const core::Tensor &normals,
+                        const core::Tensor &indices,
+                        const core::Tensor &distance2,
+                        const core::Tensor &row_splits,
+                        core::Tensor &fpfhs);
+
+void ComputeFPFHFeatureCPU(const core::Tensor &points,
+                           const core::Tensor &normals,
+                           const core::Tensor &indices,
+                           const core::Tensor &distance2,
+                           const core::Tensor &row_splits,
+                           core::Tensor &fpfhs);
+
+#ifdef BUILD_CUDA_MODULE
+void ComputeFPFHFeatureCUDA(const core::Tensor &points,
+                            const core::Tensor &normals,
+                            const core::Tensor &indices,
+                            const core::Tensor &distance2,
+                            const core::Tensor &row_splits,
+                            core::Tensor &fpfhs);
+#endif
+
+}  // namespace kernel
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
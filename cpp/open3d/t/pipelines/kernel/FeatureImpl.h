@@ -0,0 +1,216 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <cmath>
+
+#include "open3d/core/Dispatch.h"
+#include "open3d/core/ParallelFor.h"
+#include "open3d/t/pipelines/kernel/Feature.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace kernel {
+
+#ifndef __CUDACC__
+using std::abs;
+using std::acos;
+using std::atan2;
+using std::floor;
+using std::sqrt;
+#endif
+
+template <typename scalar_t>
+OPEN3D_HOST_DEVICE inline void Cross3(const scalar_t *a,
+                                      const scalar_t *b,
+                                      scalar_t *c) {
+    c[0] = a[1] * b[2] - a[2] * b[1];
+    c[1] = a[2] * b[0] - a[0] * b[2];
+    c[2] = a[0] * b[1] - a[1] * b[0];
+}
+
+template <typename scalar_t>
+OPEN3D_HOST_DEVICE inline scalar_t Dot3(const scalar_t *a, const scalar_t *b) {
+    return a[0] * b[0] + a[1] * b[1] + a[2] * b[2];
+}
+
+/// Computes the Darboux frame features (theta, alpha, phi, distance) of a
+/// point pair, as in pipelines::registration::ComputeFPFHFeature.
+template <typename scalar_t>
+OPEN3D_HOST_DEVICE void ComputePairFeatures(const scalar_t *p1,
+                                            const scalar_t *n1,
+                                            const scalar_t *p2,
+                                            const scalar_t *n2,
+                                            scalar_t *feature) {
+    scalar_t dp2p1[3] = {p2[0] - p1[0], p2[1] - p1[1], p2[2] - p1[2]};
+    feature[3] = sqrt(Dot3(dp2p1, dp2p1));
+    if (feature[3] == 0) {
+        feature[0] = feature[1] = feature[2] = feature[3] = 0;
+        return;
+    }
+
+    const scalar_t *n1_copy = n1;
+    const scalar_t *n2_copy = n2;
+    const scalar_t angle1 = Dot3(n1_copy, dp2p1) / feature[3];
+    const scalar_t angle2 = Dot3(n2_copy, dp2p1) / feature[3];
+    if (acos(abs(angle1)) > acos(abs(angle2))) {
+        n1_copy = n2;
+        n2_copy = n1;
+        dp2p1[0] *= -1;
+        dp2p1[1] *= -1;
+        dp2p1[2] *= -1;
+        feature[2] = -angle2;
+    } else {
+        feature[2] = angle1;
+    }
+
+    scalar_t v[3];
+    Cross3(dp2p1, n1_copy, v);
+    const scalar_t v_norm = sqrt(Dot3(v, v));
+    if (v_norm == 0) {
+        feature[0] = feature[1] = feature[2] = feature[3] = 0;
+        return;
+    }
+    v[0] /= v_norm;
+    v[1] /= v_norm;
+    v[2] /= v_norm;
+    scalar_t w[3];
+    Cross3(n1_copy, v, w);
+    feature[1] = Dot3(v, n2_copy);
+    feature[0] = atan2(Dot3(w, n2_copy), Dot3(n1_copy, n2_copy));
+}
+
+/// Adds the pair features to the three 11-bin histograms of the SPFH.
+template <typename scalar_t>
+OPEN3D_HOST_DEVICE inline void UpdateSPFHFeature(const scalar_t *feature,
+                                                 scalar_t hist_incr,
+                                                 scalar_t *spfh) {
+    const scalar_t kPi = static_cast<scalar_t>(M_PI);
+    int h_index = static_cast<int>(
+            floor(11 * (feature[0] + kPi) / (static_cast<scalar_t>(2) * kPi)));
+    h_index = h_index < 0 ? 0 : (h_index >= 11 ? 10 : h_index);
+    spfh[h_index] += hist_incr;
+
+    h_index = static_cast<int>(floor(11 * (feature[1] + 1) * 0.5));
+    h_index = h_index < 0 ? 0 : (h_index >= 11 ? 10 : h_index);
+    spfh[h_index + 11] += hist_incr;
+
+    h_index = static_cast<int>(floor(11 * (feature[2] + 1) * 0.5));
+    h_index = h_index < 0 ? 0 : (h_index >= 11 ? 10 : h_index);
+    spfh[h_index + 22] += hist_incr;
+}
+
+#if defined(__CUDACC__)
+void ComputeFPFHFeatureCUDA
+#else
+void ComputeFPFHFeatureCPU
+#endif
+        (const core::Tensor &points,
+         const core::Tensor &normals,
+         const core::Tensor &indices,
+         const core::Tensor &distance2,
+         const core::Tensor &row_splits,
+         core::Tensor &fpfhs) {
+    const core::Device device = points.GetDevice();
+    const int64_t num_points = points.GetLength();
+
+    // Each point sees its neighbors twice, once for its own SPFH and once to
+    // weight the SPFHs of its neighbors, so the SPFHs are kept for all points.
+    core::Tensor spfhs = core::Tensor::Zeros({num_points, 33},
+                                             points.GetDtype(), device);
+
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(points.GetDtype(), [&]() {
+        const scalar_t *points_ptr = points.GetDataPtr<scalar_t>();
+        const scalar_t *normals_ptr = normals.GetDataPtr<scalar_t>();
+        const int64_t *indices_ptr = indices.GetDataPtr<int64_t>();
+        const scalar_t *distance2_ptr = distance2.GetDataPtr<scalar_t>();
+        const int64_t *row_splits_ptr = row_splits.GetDataPtr<int64_t>();
+        scalar_t *spfhs_ptr = spfhs.GetDataPtr<scalar_t>();
+        scalar_t *fpfhs_ptr = fpfhs.GetDataPtr<scalar_t>();
+
+        core::ParallelFor(device, num_points, [=] OPEN3D_DEVICE(
+                                                      int64_t workload_idx) {
+            // The first neighbor is the point itself.
+            const int64_t begin = row_splits_ptr[workload_idx] + 1;
+            const int64_t end = row_splits_ptr[workload_idx + 1];
+            int num_neighbors = 0;
+            for (int64_t k = begin; k < end; ++k) {
+                num_neighbors += indices_ptr[k] >= 0;
+            }
+            if (num_neighbors == 0) return;
+
+            const scalar_t hist_incr = 100.0 / num_neighbors;
+            const scalar_t *point = points_ptr + 3 * workload_idx;
+            const scalar_t *normal = normals_ptr + 3 * workload_idx;
+            scalar_t *spfh = spfhs_ptr + 33 * workload_idx;
+            scalar_t feature[4];
+            for (int64_t k = begin; k < end; ++k) {
+                const int64_t idx = indices_ptr[k];
+                if (idx < 0) continue;
+                ComputePairFeatures(point, normal, points_ptr + 3 * idx,
+                                    normals_ptr + 3 * idx, feature);
+                UpdateSPFHFeature(feature, hist_incr, spfh);
+            }
+        });
+
+        core::ParallelFor(device, num_points, [=] OPEN3D_DEVICE(
+                                                      int64_t workload_idx) {
+            const int64_t begin = row_splits_ptr[workload_idx] + 1;
+            const int64_t end = row_splits_ptr[workload_idx + 1];
+            int num_neighbors = 0;
+            for (int64_t k = begin; k < end; ++k) {
+                num_neighbors += indices_ptr[k] >= 0;
+            }
+            if (num_neighbors == 0) return;
+
+            scalar_t *fpfh = fpfhs_ptr + 33 * workload_idx;
+            scalar_t sum[3] = {0, 0, 0};
+            for (int64_t k = begin; k < end; ++k) {
+                const int64_t idx = indices_ptr[k];
+                const scalar_t dist = distance2_ptr[k];
+                if (idx < 0 || dist == 0) continue;
+                const scalar_t *spfh = spfhs_ptr + 33 * idx;
+                for (int j = 0; j < 33; ++j) {
+                    const scalar_t val = spfh[j] / dist;
+                    sum[j / 11] += val;
+                    fpfh[j] += val;
+                }
+            }
+            for (int j = 0; j < 3; ++j) {
+                if (sum[j] != 0) sum[j] = 100.0 / sum[j];
+            }
+            const scalar_t *spfh = spfhs_ptr + 33 * workload_idx;
+            for (int j = 0; j < 33; ++j) {
+                fpfh[j] = fpfh[j] * sum[j / 11] + spfh[j];
+            }
+        });
+    });
+}
+
+}  // namespace kernel
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
@@ -187,6 +187,204 @@ void FillInSLACRegularizerTerm(core::Tensor &AtA,
     }
 }
 
+void FillInSLACAlignmentTermSparse(core::Tensor &J_idx,
+                                   core::Tensor &J_val,
+                                   core::Tensor &r,
+                                   const core::Tensor &Ti_ps,
+                                   const core::Tensor &Tj_qs,
+                                   const core::Tensor &normal_ps,
+                                   const core::Tensor &Ri_normal_ps,
+                                   const core::Tensor &RjT_Ri_normal_ps,
+                                   const core::Tensor &cgrid_idx_ps,
+                                   const core::Tensor &cgrid_idx_qs,
+                                   const core::Tensor &cgrid_ratio_qs,
+                                   const core::Tensor &cgrid_ratio_ps,
+                                   int i,
+                                   int j,
+                                   int n,
+                                   float threshold) {
+    core::AssertTensorDtype(Ti_ps, core::Float32);
+    core::AssertTensorDtype(Tj_qs, core::Float32);
+    core::AssertTensorDtype(normal_ps, core::Float32);
+    core::AssertTensorDtype(Ri_normal_ps, core::Float32);
+    core::AssertTensorDtype(RjT_Ri_normal_ps, core::Float32);
+
+    core::Device device = Ti_ps.GetDevice();
+    if (Tj_qs.GetDevice() != device) {
+        utility::LogError("Points j should have the same device as points i.");
+    }
+    if (Ri_normal_ps.GetDevice() != device) {
+        utility::LogError("Normals i should have the same device as points i.");
+    }
+
+    core::Device::DeviceType device_type = device.GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        FillInSLACAlignmentTermSparseCPU(
+                J_idx, J_val, r, Ti_ps, Tj_qs, normal_ps, Ri_normal_ps,
+                RjT_Ri_normal_ps, cgrid_idx_ps, cgrid_idx_qs, cgrid_ratio_ps,
+                cgrid_ratio_qs, i, j, n, threshold);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        FillInSLACAlignmentTermSparseCUDA(
+                J_idx, J_val, r, Ti_ps, Tj_qs, normal_ps, Ri_normal_ps,
+                RjT_Ri_normal_ps, cgrid_idx_ps, cgrid_idx_qs, cgrid_ratio_ps,
+                cgrid_ratio_qs, i, j, n, threshold);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void FillInSLACRegularizerTermSparse(core::Tensor &J_idx,
+                                     core::Tensor &J_val,
+                                     core::Tensor &r,
+                                     const core::Tensor &grid_idx,
+                                     const core::Tensor &grid_nbs_idx,
+                                     const core::Tensor &grid_nbs_mask,
+                                     const core::Tensor &positions_init,
+                                     const core::Tensor &positions_curr,
+                                     float weight,
+                                     int n,
+                                     int anchor_idx) {
+    core::AssertTensorDtype(positions_init, core::Float32);
+    core::AssertTensorDtype(positions_curr, core::Float32);
+
+    core::Device device = grid_idx.GetDevice();
+    if (positions_curr.GetDevice() != device) {
+        utility::LogError(
+                "Control grid positions should have the same device as the "
+                "grid indices.");
+    }
+
+    core::Device::DeviceType device_type = device.GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        FillInSLACRegularizerTermSparseCPU(
+                J_idx, J_val, r, grid_idx, grid_nbs_idx, grid_nbs_mask,
+                positions_init, positions_curr, weight, n, anchor_idx);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        FillInSLACRegularizerTermSparseCUDA(
+                J_idx, J_val, r, grid_idx, grid_nbs_idx, grid_nbs_mask,
+                positions_init, positions_curr, weight, n, anchor_idx);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void ComputeJTJx(core::Tensor &JTJx,
+                 const core::Tensor &J_idx,
+                 const core::Tensor &J_val,
+                 const core::Tensor &x) {
+    core::AssertTensorDtype(JTJx, core::Float32);
+    core::AssertTensorDtype(J_idx, core::Int32);
+    core::AssertTensorShape(J_val, J_idx.GetShape());
+    core::AssertTensorShape(x, {JTJx.GetLength()});
+
+    core::Device device = JTJx.GetDevice();
+    core::AssertTensorDevice(J_idx, device);
+    core::AssertTensorDevice(J_val, device);
+    core::AssertTensorDevice(x, device);
+
+    core::Device::DeviceType device_type = device.GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        ComputeJTJxCPU(JTJx, J_idx, J_val, x);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        ComputeJTJxCUDA(JTJx, J_idx, J_val, x);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void ComputeJTr(core::Tensor &JTr,
+                const core::Tensor &J_idx,
+                const core::Tensor &J_val,
+                const core::Tensor &r) {
+    core::AssertTensorDtype(JTr, core::Float32);
+    core::AssertTensorDtype(J_idx, core::Int32);
+    core::AssertTensorShape(J_val, J_idx.GetShape());
+    core::AssertTensorShape(r, {J_idx.GetLength()});
+
+    core::Device device = JTr.GetDevice();
+    core::AssertTensorDevice(J_idx, device);
+    core::AssertTensorDevice(J_val, device);
+    core::AssertTensorDevice(r, device);
+
+    core::Device::DeviceType device_type = device.GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        ComputeJTrCPU(JTr, J_idx, J_val, r);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        ComputeJTrCUDA(JTr, J_idx, J_val, r);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void FillInBlockJacobi(core::Tensor &blocks,
+                       const core::Tensor &J_idx,
+                       const core::Tensor &J_val,
+                       int n) {
+    core::AssertTensorDtype(blocks, core::Float32);
+    core::AssertTensorDtype(J_idx, core::Int32);
+    core::AssertTensorShape(J_val, J_idx.GetShape());
+
+    core::Device device = blocks.GetDevice();
+    core::AssertTensorDevice(J_idx, device);
+    core::AssertTensorDevice(J_val, device);
+
+    core::Device::DeviceType device_type = device.GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        FillInBlockJacobiCPU(blocks, J_idx, J_val, n);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        FillInBlockJacobiCUDA(blocks, J_idx, J_val, n);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void ApplyBlockJacobi(core::Tensor &z,
+                      const core::Tensor &blocks_inv,
+                      const core::Tensor &x,
+                      int n) {
+    core::AssertTensorDtype(z, core::Float32);
+    core::AssertTensorDtype(blocks_inv, core::Float32);
+    core::AssertTensorDtype(x, core::Float32);
+    core::AssertTensorShape(z, x.GetShape());
+
+    core::Device device = x.GetDevice();
+    core::AssertTensorDevice(z, device);
+    core::AssertTensorDevice(blocks_inv, device);
+
+    core::Device::DeviceType device_type = device.GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        ApplyBlockJacobiCPU(z, blocks_inv, x, n);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        ApplyBlockJacobiCUDA(z, blocks_inv, x, n);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
 }  // namespace kernel
 }  // namespace pipelines
 }  // namespace t
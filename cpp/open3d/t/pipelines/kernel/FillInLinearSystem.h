@@ -70,6 +70,67 @@ void FillInSLACRegularizerTerm(core::Tensor &AtA,
                                int n,
                                int anchor_idx);
 
+/// Sparse counterpart of FillInSLACAlignmentTerm. Instead of accumulating
+/// AtA and Atb, outputs the Jacobian rows of the correspondences: J_idx
+/// {n, 60} Int32 variable indices, J_val {n, 60} Float32 values and r {n}
+/// Float32 residuals. Rejected correspondences are empty rows.
+void FillInSLACAlignmentTermSparse(core::Tensor &J_idx,
+                                   core::Tensor &J_val,
+                                   core::Tensor &r,
+                                   const core::Tensor &Ti_qs,
+                                   const core::Tensor &Tj_qs,
+                                   const core::Tensor &normal_ps,
+                                   const core::Tensor &Ri_normal_ps,
+                                   const core::Tensor &RjT_Ri_normal_ps,
+                                   const core::Tensor &cgrid_idx_ps,
+                                   const core::Tensor &cgrid_idx_qs,
+                                   const core::Tensor &cgrid_ratio_qs,
+                                   const core::Tensor &cgrid_ratio_ps,
+                                   int i,
+                                   int j,
+                                   int n,
+                                   float threshold);
+
+/// Sparse counterpart of FillInSLACRegularizerTerm. Outputs one Jacobian row
+/// of 2 entries per control point, neighbor and axis in J_idx, J_val and r.
+void FillInSLACRegularizerTermSparse(core::Tensor &J_idx,
+                                     core::Tensor &J_val,
+                                     core::Tensor &r,
+                                     const core::Tensor &grid_idx,
+                                     const core::Tensor &grid_nbs_idx,
+                                     const core::Tensor &grid_nbs_mask,
+                                     const core::Tensor &positions_init,
+                                     const core::Tensor &positions_curr,
+                                     float weight,
+                                     int n,
+                                     int anchor_idx);
+
+/// Accumulates J^T J x into JTJx for the Jacobian rows J_idx and J_val.
+void ComputeJTJx(core::Tensor &JTJx,
+                 const core::Tensor &J_idx,
+                 const core::Tensor &J_val,
+                 const core::Tensor &x);
+
+/// Accumulates J^T r into JTr for the Jacobian rows J_idx and J_val.
+void ComputeJTr(core::Tensor &JTr,
+                const core::Tensor &J_idx,
+                const core::Tensor &J_val,
+                const core::Tensor &r);
+
+/// Accumulates the 6 x 6 blocks of the n fragments followed by the 3 x 3
+/// blocks of the control points on the diagonal of J^T J into blocks.
+void FillInBlockJacobi(core::Tensor &blocks,
+                       const core::Tensor &J_idx,
+                       const core::Tensor &J_val,
+                       int n);
+
+/// z = blocks_inv x, where blocks_inv has the block layout of
+/// FillInBlockJacobi.
+void ApplyBlockJacobi(core::Tensor &z,
+                      const core::Tensor &blocks_inv,
+                      const core::Tensor &x,
+                      int n);
+
 void FillInRigidAlignmentTermCPU(core::Tensor &AtA,
                                  core::Tensor &Atb,
                                  core::Tensor &residual,
@@ -109,6 +170,55 @@ void FillInSLACRegularizerTermCPU(core::Tensor &AtA,
                                   int n,
                                   int anchor_idx);
 
+void FillInSLACAlignmentTermSparseCPU(core::Tensor &J_idx,
+                                      core::Tensor &J_val,
+                                      core::Tensor &r,
+                                      const core::Tensor &Ti_qs,
+                                      const core::Tensor &Tj_qs,
+                                      const core::Tensor &normal_ps,
+                                      const core::Tensor &Ri_normal_ps,
+                                      const core::Tensor &RjT_Ri_normal_ps,
+                                      const core::Tensor &cgrid_idx_ps,
+                                      const core::Tensor &cgrid_idx_qs,
+                                      const core::Tensor &cgrid_ratio_qs,
+                                      const core::Tensor &cgrid_ratio_ps,
+                                      int i,
+                                      int j,
+                                      int n,
+                                      float threshold);
+
+void FillInSLACRegularizerTermSparseCPU(core::Tensor &J_idx,
+                                        core::Tensor &J_val,
+                                        core::Tensor &r,
+                                        const core::Tensor &grid_idx,
+                                        const core::Tensor &grid_nbs_idx,
+                                        const core::Tensor &grid_nbs_mask,
+                                        const core::Tensor &positions_init,
+                                        const core::Tensor &positions_curr,
+                                        float weight,
+                                        int n,
+                                        int anchor_idx);
+
+void ComputeJTJxCPU(core::Tensor &JTJx,
+                    const core::Tensor &J_idx,
+                    const core::Tensor &J_val,
+                    const core::Tensor &x);
+
+void ComputeJTrCPU(core::Tensor &JTr,
+                   const core::Tensor &J_idx,
+                   const core::Tensor &J_val,
+                   const core::Tensor &r);
+
+void FillInBlockJacobiCPU(core::Tensor &blocks,
+                          const core::Tensor &J_idx,
+                          const core::Tensor &J_val,
+                          int n);
+
+void ApplyBlockJacobiCPU(core::Tensor &z,
+                         const core::Tensor &blocks_inv,
+                         const core::Tensor &x,
+                         int n);
+
 #ifdef BUILD_CUDA_MODULE
 void FillInRigidAlignmentTermCUDA(core::Tensor &AtA,
                                   core::Tensor &Atb,
@@ -149,6 +259,55 @@ void FillInSLACRegularizerTermCUDA(core::Tensor &AtA,
                                    int n,
                                    int anchor_idx);
 
+void FillInSLACAlignmentTermSparseCUDA(core::Tensor &J_idx,
+                                       core::Tensor &J_val,
+                                       core::Tensor &r,
+                                       const core::Tensor &Ti_qs,
+                                       const core::Tensor &Tj_qs,
+                                       const core::Tensor &normal_ps,
+                                       const core::Tensor &Ri_normal_ps,
+                                       const core::Tensor &RjT_Ri_normal_ps,
+                                       const core::Tensor &cgrid_idx_ps,
+                                       const core::Tensor &cgrid_idx_qs,
+                                       const core::Tensor &cgrid_ratio_qs,
+                                       const core::Tensor &cgrid_ratio_ps,
+                                       int i,
+                                       int j,
+                                       int n,
+                                       float threshold);
+
+void FillInSLACRegularizerTermSparseCUDA(core::Tensor &J_idx,
+                                         core::Tensor &J_val,
+                                         core::Tensor &r,
+                                         const core::Tensor &grid_idx,
+                                         const core::Tensor &grid_nbs_idx,
+                                         const core::Tensor &grid_nbs_mask,
+                                         const core::Tensor &positions_init,
+                                         const core::Tensor &positions_curr,
+                                         float weight,
+                                         int n,
+                                         int anchor_idx);
+
+void ComputeJTJxCUDA(core::Tensor &JTJx,
+                     const core::Tensor &J_idx,
+                     const core::Tensor &J_val,
+                     const core::Tensor &x);
+
+void ComputeJTrCUDA(core::Tensor &JTr,
+                    const core::Tensor &J_idx,
+                    const core::Tensor &J_val,
+                    const core::Tensor &r);
+
+void FillInBlockJacobiCUDA(core::Tensor &blocks,
+                           const core::Tensor &J_idx,
+                           const core::Tensor &J_val,
+                           int n);
+
+void ApplyBlockJacobiCUDA(core::Tensor &z,
+                          const core::Tensor &blocks_inv,
+                          const core::Tensor &x,
+                          int n);
+
 #endif
 
 }  // namespace kernel
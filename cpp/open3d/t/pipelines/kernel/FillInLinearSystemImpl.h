@@ -146,6 +146,62 @@ void FillInRigidAlignmentTermCPU
     Atb.IndexSet({indices}, Atb_sub + Atb_local.View({12, 1}));
 }
 
+/// Jacobian of the point-to-plane residual of a SLAC correspondence, and the
+/// indices of the variables it depends on: the poses of fragments i and j,
+/// followed by the 8 control points around p and the 8 around q.
+OPEN3D_DEVICE inline void GetSLACAlignmentJacobian(
+        const float *Tj_Cq,
+        const float *Cnormal_p,
+        const float *Ri_Cnormal_p,
+        const float *RjTRi_Cnormal_p,
+        const int *cgrid_idx_p,
+        const int *cgrid_idx_q,
+        const float *cgrid_ratio_p,
+        const float *cgrid_ratio_q,
+        int i,
+        int j,
+        int n_frags,
+        float *J,
+        int *idx) {
+    // Jacobian w.r.t. Ti: 0-6
+    J[0] = -Tj_Cq[2] * Ri_Cnormal_p[1] + Tj_Cq[1] * Ri_Cnormal_p[2];
+    J[1] = Tj_Cq[2] * Ri_Cnormal_p[0] - Tj_Cq[0] * Ri_Cnormal_p[2];
+    J[2] = -Tj_Cq[1] * Ri_Cnormal_p[0] + Tj_Cq[0] * Ri_Cnormal_p[1];
+    J[3] = Ri_Cnormal_p[0];
+    J[4] = Ri_Cnormal_p[1];
+    J[5] = Ri_Cnormal_p[2];
+
+    // Jacobian w.r.t. Tj: 6-12
+    for (int k = 0; k < 6; ++k) {
+        J[k + 6] = -J[k];
+
+        idx[k + 0] = 6 * i + k;
+        idx[k + 6] = 6 * j + k;
+    }
+
+    // Jacobian w.r.t. C over p: 12-36
+    for (int k = 0; k < 8; ++k) {
+        J[12 + k * 3 + 0] = cgrid_ratio_p[k] * Cnormal_p[0];
+        J[12 + k * 3 + 1] = cgrid_ratio_p[k] * Cnormal_p[1];
+        J[12 + k * 3 + 2] = cgrid_ratio_p[k] * Cnormal_p[2];
+
+        idx[12 + k * 3 + 0] = 6 * n_frags + cgrid_idx_p[k] * 3 + 0;
+        idx[12 + k * 3 + 1] = 6 * n_frags + cgrid_idx_p[k] * 3 + 1;
+        idx[12 + k * 3 + 2] = 6 * n_frags + cgrid_idx_p[k] * 3 + 2;
+    }
+
+    // Jacobian w.r.t. C over q: 36-60
+    for (int k = 0; k < 8; ++k) {
+        J[36 + k * 3 + 0] = -cgrid_ratio_q[k] * RjTRi_Cnormal_p[0];
+        J[36 + k * 3 + 1] = -cgrid_ratio_q[k] * RjTRi_Cnormal_p[1];
+        J[36 + k * 3 + 2] = -cgrid_ratio_q[k] * RjTRi_Cnormal_p[2];
+
+        idx[36 + k * 3 + 0] = 6 * n_frags + cgrid_idx_q[k] * 3 + 0;
+        idx[36 + k * 3 + 1] = 6 * n_frags + cgrid_idx_q[k] * 3 + 1;
+        idx[36 + k * 3 + 2] = 6 * n_frags + cgrid_idx_q[k] * 3 + 2;
+    }
+}
+
 #if defined(__CUDACC__)
 void FillInSLACAlignmentTermCUDA
 #else
@@ -226,44 +282,10 @@ void FillInSLACAlignmentTermCPU
                 // Now we fill in a 60 x 60 sub-matrix: 2 x (6 + 8 x 3)
                 float J[60];
                 int idx[60];
-
-                // Jacobian w.r.t. Ti: 0-6
-                J[0] = -Tj_Cq[2] * Ri_Cnormal_p[1] + Tj_Cq[1] * Ri_Cnormal_p[2];
-                J[1] = Tj_Cq[2] * Ri_Cnormal_p[0] - Tj_Cq[0] * Ri_Cnormal_p[2];
-                J[2] = -Tj_Cq[1] * Ri_Cnormal_p[0] + Tj_Cq[0] * Ri_Cnormal_p[1];
-                J[3] = Ri_Cnormal_p[0];
-                J[4] = Ri_Cnormal_p[1];
-                J[5] = Ri_Cnormal_p[2];
-
-                // Jacobian w.r.t. Tj: 6-12
-                for (int k = 0; k < 6; ++k) {
-                    J[k + 6] = -J[k];
-
-                    idx[k + 0] = 6 * i + k;
-                    idx[k + 6] = 6 * j + k;
-                }
-
-                // Jacobian w.r.t. C over p: 12-36
-                for (int k = 0; k < 8; ++k) {
-                    J[12 + k * 3 + 0] = cgrid_ratio_p[k] * Cnormal_p[0];
-                    J[12 + k * 3 + 1] = cgrid_ratio_p[k] * Cnormal_p[1];
-                    J[12 + k * 3 + 2] = cgrid_ratio_p[k] * Cnormal_p[2];
-
-                    idx[12 + k * 3 + 0] = 6 * n_frags + cgrid_idx_p[k] * 3 + 0;
-                    idx[12 + k * 3 + 1] = 6 * n_frags + cgrid_idx_p[k] * 3 + 1;
-                    idx[12 + k * 3 + 2] = 6 * n_frags + cgrid_idx_p[k] * 3 + 2;
-                }
-
-                // Jacobian w.r.t. C over q: 36-60
-                for (int k = 0; k < 8; ++k) {
-                    J[36 + k * 3 + 0] = -cgrid_ratio_q[k] * RjTRi_Cnormal_p[0];
-                    J[36 + k * 3 + 1] = -cgrid_ratio_q[k] * RjTRi_Cnormal_p[1];
-                    J[36 + k * 3 + 2] = -cgrid_ratio_q[k] * RjTRi_Cnormal_p[2];
-
-                    idx[36 + k * 3 + 0] = 6 * n_frags + cgrid_idx_q[k] * 3 + 0;
-                    idx[36 + k * 3 + 1] = 6 * n_frags + cgrid_idx_q[k] * 3 + 1;
-                    idx[36 + k * 3 + 2] = 6 * n_frags + cgrid_idx_q[k] * 3 + 2;
-                }
+                GetSLACAlignmentJacobian(Tj_Cq, Cnormal_p, Ri_Cnormal_p,
+                                         RjTRi_Cnormal_p, cgrid_idx_p,
+                                         cgrid_idx_q, cgrid_ratio_p,
+                                         cgrid_ratio_q, i, j, n_frags, J, idx);
 
         // Not optimized; Switch to reduction if necessary.
 #if defined(__CUDACC__)
@@ -293,6 +315,113 @@ void FillInSLACAlignmentTermCPU
             });
 }
 
+/// Local rotation of the control point idx_i that best aligns the initial
+/// offsets to its neighbors to the current ones. Returns false if fewer than 3
+/// neighbors are valid. The rotation of the anchor is fixed to identity.
+OPEN3D_DEVICE inline bool GetSLACRegularizerRotation(
+        int idx_i,
+        const int *idx_nbs,
+        const bool *mask_nbs,
+        const float *positions_init_ptr,
+        const float *positions_curr_ptr,
+        int anchor_idx,
+        float R[3][3]) {
+    // Build a 3x3 linear system to compute the local R
+    float cov[3][3] = {{0}};
+    float U[3][3], V[3][3], S[3];
+
+    int cnt = 0;
+    for (int k = 0; k < 6; ++k) {
+        bool mask_k = mask_nbs[k];
+        if (!mask_k) continue;
+
+        int idx_k = idx_nbs[k];
+
+        // Now build linear systems
+        float diff_ik_init[3] = {
+                positions_init_ptr[idx_i * 3 + 0] -
+                        positions_init_ptr[idx_k * 3 + 0],
+                positions_init_ptr[idx_i * 3 + 1] -
+                        positions_init_ptr[idx_k * 3 + 1],
+                positions_init_ptr[idx_i * 3 + 2] -
+                        positions_init_ptr[idx_k * 3 + 2]};
+        float diff_ik_curr[3] = {
+                positions_curr_ptr[idx_i * 3 + 0] -
+                        positions_curr_ptr[idx_k * 3 + 0],
+                positions_curr_ptr[idx_i * 3 + 1] -
+                        positions_curr_ptr[idx_k * 3 + 1],
+                positions_curr_ptr[idx_i * 3 + 2] -
+                        positions_curr_ptr[idx_k * 3 + 2]};
+
+        // Build linear system by computing XY^T when formulating Y = RX
+        // Y: curr X: init
+        for (int i = 0; i < 3; ++i) {
+            for (int j = 0; j < 3; ++j) {
+                cov[i][j] += diff_ik_init[i] * diff_ik_curr[j];
+            }
+        }
+        ++cnt;
+    }
+
+    if (cnt < 3) {
+        return false;
+    }
+
+    core::linalg::kernel::svd3x3(*cov, *U, S, *V);
+
+    core::linalg::kernel::transpose3x3_(*U);
+    core::linalg::kernel::matmul3x3_3x3(*V, *U, *R);
+
+    float d = core::linalg::kernel::det3x3(*R);
+
+    if (d < 0) {
+        U[2][0] = -U[2][0];
+        U[2][1] = -U[2][1];
+        U[2][2] = -U[2][2];
+        core::linalg::kernel::matmul3x3_3x3(*V, *U, *R);
+    }
+
+    // Now we have R, we build Hessian and residuals
+    // But first, we need to anchor a point
+    if (idx_i == anchor_idx) {
+        R[0][0] = R[1][1] = R[2][2] = 1;
+        R[0][1] = R[0][2] = R[1][0] = R[1][2] = R[2][0] = R[2][1] = 0;
+    }
+    return true;
+}
+
+/// Residual of the offset from control point idx_i to its neighbor idx_k
+/// under the local rotation R.
+OPEN3D_DEVICE inline void GetSLACRegularizerResidual(
+        int idx_i,
+        int idx_k,
+        const float R[3][3],
+        const float *positions_init_ptr,
+        const float *positions_curr_ptr,
+        float *local_r) {
+    float diff_ik_init[3] = {
+            positions_init_ptr[idx_i * 3 + 0] -
+                    positions_init_ptr[idx_k * 3 + 0],
+            positions_init_ptr[idx_i * 3 + 1] -
+                    positions_init_ptr[idx_k * 3 + 1],
+            positions_init_ptr[idx_i * 3 + 2] -
+                    positions_init_ptr[idx_k * 3 + 2]};
+    float diff_ik_curr[3] = {
+            positions_curr_ptr[idx_i * 3 + 0] -
+                    positions_curr_ptr[idx_k * 3 + 0],
+            positions_curr_ptr[idx_i * 3 + 1] -
+                    positions_curr_ptr[idx_k * 3 + 1],
+            positions_curr_ptr[idx_i * 3 + 2] -
+                    positions_curr_ptr[idx_k * 3 + 2]};
+    float R_diff_ik_curr[3];
+
+    core::linalg::kernel::matmul3x3_3x1(*R, diff_ik_init, R_diff_ik_curr);
+
+    local_r[0] = diff_ik_curr[0] - R_diff_ik_curr[0];
+    local_r[1] = diff_ik_curr[1] - R_diff_ik_curr[1];
+    local_r[2] = diff_ik_curr[2] - R_diff_ik_curr[2];
+}
+
 #if defined(__CUDACC__)
 void FillInSLACRegularizerTermCUDA
 #else
@@ -336,98 +465,24 @@ void FillInSLACRegularizerTermCPU
                 const int *idx_nbs = grid_nbs_idx_ptr + 6 * workload_idx;
                 const bool *mask_nbs = grid_nbs_mask_ptr + 6 * workload_idx;
 
-                // Build a 3x3 linear system to compute the local R
-                float cov[3][3] = {{0}};
-                float U[3][3], V[3][3], S[3];
-
-                int cnt = 0;
-                for (int k = 0; k < 6; ++k) {
-                    bool mask_k = mask_nbs[k];
-                    if (!mask_k) continue;
-
-                    int idx_k = idx_nbs[k];
-
-                    // Now build linear systems
-                    float diff_ik_init[3] = {
-                            positions_init_ptr[idx_i * 3 + 0] -
-                                    positions_init_ptr[idx_k * 3 + 0],
-                            positions_init_ptr[idx_i * 3 + 1] -
-                                    positions_init_ptr[idx_k * 3 + 1],
-                            positions_init_ptr[idx_i * 3 + 2] -
-                                    positions_init_ptr[idx_k * 3 + 2]};
-                    float diff_ik_curr[3] = {
-                            positions_curr_ptr[idx_i * 3 + 0] -
-                                    positions_curr_ptr[idx_k * 3 + 0],
-                            positions_curr_ptr[idx_i * 3 + 1] -
-                                    positions_curr_ptr[idx_k * 3 + 1],
-                            positions_curr_ptr[idx_i * 3 + 2] -
-                                    positions_curr_ptr[idx_k * 3 + 2]};
-
-                    // Build linear system by computing XY^T when formulating Y
-                    // = RX Y: curr X: init
-                    for (int i = 0; i < 3; ++i) {
-                        for (int j = 0; j < 3; ++j) {
-                            cov[i][j] += diff_ik_init[i] * diff_ik_curr[j];
-                        }
-                    }
-                    ++cnt;
-                }
-
-                if (cnt < 3) {
-                    return;
-                }
-
-                core::linalg::kernel::svd3x3(*cov, *U, S, *V);
-
                 float R[3][3];
-                core::linalg::kernel::transpose3x3_(*U);
-                core::linalg::kernel::matmul3x3_3x3(*V, *U, *R);
-
-                float d = core::linalg::kernel::det3x3(*R);
-
-                if (d < 0) {
-                    U[2][0] = -U[2][0];
-                    U[2][1] = -U[2][1];
-                    U[2][2] = -U[2][2];
-                    core::linalg::kernel::matmul3x3_3x3(*V, *U, *R);
+                if (!GetSLACRegularizerRotation(idx_i, idx_nbs, mask_nbs,
+                                                positions_init_ptr,
+                                                positions_curr_ptr, anchor_idx,
+                                                R)) {
+                    return;
                 }
 
-                // Now we have R, we build Hessian and residuals
-                // But first, we need to anchor a point
-                if (idx_i == anchor_idx) {
-                    R[0][0] = R[1][1] = R[2][2] = 1;
-                    R[0][1] = R[0][2] = R[1][0] = R[1][2] = R[2][0] = R[2][1] =
-                            0;
-                }
                 for (int k = 0; k < 6; ++k) {
                     bool mask_k = mask_nbs[k];
 
                     if (mask_k) {
                         int idx_k = idx_nbs[k];
 
-                        float diff_ik_init[3] = {
-                                positions_init_ptr[idx_i * 3 + 0] -
-                                        positions_init_ptr[idx_k * 3 + 0],
-                                positions_init_ptr[idx_i * 3 + 1] -
-                                        positions_init_ptr[idx_k * 3 + 1],
-                                positions_init_ptr[idx_i * 3 + 2] -
-                                        positions_init_ptr[idx_k * 3 + 2]};
-                        float diff_ik_curr[3] = {
-                                positions_curr_ptr[idx_i * 3 + 0] -
-                                        positions_curr_ptr[idx_k * 3 + 0],
-                                positions_curr_ptr[idx_i * 3 + 1] -
-                                        positions_curr_ptr[idx_k * 3 + 1],
-                                positions_curr_ptr[idx_i * 3 + 2] -
-                                        positions_curr_ptr[idx_k * 3 + 2]};
-                        float R_diff_ik_curr[3];
-
-                        core::linalg::kernel::matmul3x3_3x1(*R, diff_ik_init,
-                                                            R_diff_ik_curr);
-
                         float local_r[3];
-                        local_r[0] = diff_ik_curr[0] - R_diff_ik_curr[0];
-                        local_r[1] = diff_ik_curr[1] - R_diff_ik_curr[1];
-                        local_r[2] = diff_ik_curr[2] - R_diff_ik_curr[2];
+                        GetSLACRegularizerResidual(idx_i, idx_k, R,
+                                                   positions_init_ptr,
+                                                   positions_curr_ptr, local_r);
 
                         int offset_idx_i = 3 * idx_i + 6 * n_frags;
                         int offset_idx_k = 3 * idx_k + 6 * n_frags;
@@ -490,6 +545,344 @@ void FillInSLACRegularizerTermCPU
                 }
             });
 }
+
+#if defined(__CUDACC__)
+void FillInSLACAlignmentTermSparseCUDA
+#else
+void FillInSLACAlignmentTermSparseCPU
+#endif
+        (core::Tensor &J_idx,
+         core::Tensor &J_val,
+         core::Tensor &r,
+         const core::Tensor &Ti_Cps,
+         const core::Tensor &Tj_Cqs,
+         const core::Tensor &Cnormal_ps,
+         const core::Tensor &Ri_Cnormal_ps,
+         const core::Tensor &RjT_Ri_Cnormal_ps,
+         const core::Tensor &cgrid_idx_ps,
+         const core::Tensor &cgrid_idx_qs,
+         const core::Tensor &cgrid_ratio_qs,
+         const core::Tensor &cgrid_ratio_ps,
+         int i,
+         int j,
+         int n_frags,
+         float threshold) {
+    core::Device device = Ti_Cps.GetDevice();
+    int64_t n = Ti_Cps.GetLength();
+    if (Tj_Cqs.GetLength() != n || Cnormal_ps.GetLength() != n ||
+        Ri_Cnormal_ps.GetLength() != n || RjT_Ri_Cnormal_ps.GetLength() != n ||
+        cgrid_idx_ps.GetLength() != n || cgrid_ratio_ps.GetLength() != n ||
+        cgrid_idx_qs.GetLength() != n || cgrid_ratio_qs.GetLength() != n) {
+        utility::LogError(
+                "Unable to setup linear system: input length mismatch.");
+    }
+
+    J_idx = core::Tensor::Empty({n, 60}, core::Int32, device);
+    J_val = core::Tensor::Empty({n, 60}, core::Float32, device);
+    r = core::Tensor::Empty({n}, core::Float32, device);
+    int *J_idx_ptr = static_cast<int *>(J_idx.GetDataPtr());
+    float *J_val_ptr = static_cast<float *>(J_val.GetDataPtr());
+    float *r_ptr = static_cast<float *>(r.GetDataPtr());
+
+    // Geometric properties
+    const float *Ti_Cps_ptr = static_cast<const float *>(Ti_Cps.GetDataPtr());
+    const float *Tj_Cqs_ptr = static_cast<const float *>(Tj_Cqs.GetDataPtr());
+    const float *Cnormal_ps_ptr =
+            static_cast<const float *>(Cnormal_ps.GetDataPtr());
+    const float *Ri_Cnormal_ps_ptr =
+            static_cast<const float *>(Ri_Cnormal_ps.GetDataPtr());
+    const float *RjT_Ri_Cnormal_ps_ptr =
+            static_cast<const float *>(RjT_Ri_Cnormal_ps.GetDataPtr());
+
+    // Association properties
+    const int *cgrid_idx_ps_ptr =
+            static_cast<const int *>(cgrid_idx_ps.GetDataPtr());
+    const int *cgrid_idx_qs_ptr =
+            static_cast<const int *>(cgrid_idx_qs.GetDataPtr());
+    const float *cgrid_ratio_ps_ptr =
+            static_cast<const float *>(cgrid_ratio_ps.GetDataPtr());
+    const float *cgrid_ratio_qs_ptr =
+            static_cast<const float *>(cgrid_ratio_qs.GetDataPtr());
+
+    core::ParallelFor(device, n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+        const float *Ti_Cp = Ti_Cps_ptr + 3 * workload_idx;
+        const float *Tj_Cq = Tj_Cqs_ptr + 3 * workload_idx;
+        const float *Ri_Cnormal_p = Ri_Cnormal_ps_ptr + 3 * workload_idx;
+
+        int *idx = J_idx_ptr + 60 * workload_idx;
+        float *J = J_val_ptr + 60 * workload_idx;
+
+        float r_p = (Ti_Cp[0] - Tj_Cq[0]) * Ri_Cnormal_p[0] +
+                    (Ti_Cp[1] - Tj_Cq[1]) * Ri_Cnormal_p[1] +
+                    (Ti_Cp[2] - Tj_Cq[2]) * Ri_Cnormal_p[2];
+        // Rejected correspondences are kept as empty rows.
+        if (abs(r_p) > threshold) {
+            for (int k = 0; k < 60; ++k) {
+                idx[k] = 0;
+                J[k] = 0;
+            }
+            r_ptr[workload_idx] = 0;
+            return;
+        }
+
+        GetSLACAlignmentJacobian(Tj_Cq, Cnormal_ps_ptr + 3 * workload_idx,
+                                 Ri_Cnormal_p,
+                                 RjT_Ri_Cnormal_ps_ptr + 3 * workload_idx,
+                                 cgrid_idx_ps_ptr + 8 * workload_idx,
+                                 cgrid_idx_qs_ptr + 8 * workload_idx,
+                                 cgrid_ratio_ps_ptr + 8 * workload_idx,
+                                 cgrid_ratio_qs_ptr + 8 * workload_idx, i, j,
+                                 n_frags, J, idx);
+        r_ptr[workload_idx] = r_p;
+    });
+}
+
+#if defined(__CUDACC__)
+void FillInSLACRegularizerTermSparseCUDA
+#else
+void FillInSLACRegularizerTermSparseCPU
+#endif
+        (core::Tensor &J_idx,
+         core::Tensor &J_val,
+         core::Tensor &r,
+         const core::Tensor &grid_idx,
+         const core::Tensor &grid_nbs_idx,
+         const core::Tensor &grid_nbs_mask,
+         const core::Tensor &positions_init,
+         const core::Tensor &positions_curr,
+         float weight,
+         int n_frags,
+         int anchor_idx) {
+    core::Device device = grid_idx.GetDevice();
+    int64_t n = grid_idx.GetLength();
+
+    // One row per neighbor and axis: 6 x 3 rows with 2 entries each.
+    J_idx = core::Tensor::Empty({n * 18, 2}, core::Int32, device);
+    J_val = core::Tensor::Empty({n * 18, 2}, core::Float32, device);
+    r = core::Tensor::Empty({n * 18}, core::Float32, device);
+    int *J_idx_ptr = static_cast<int *>(J_idx.GetDataPtr());
+    float *J_val_ptr = static_cast<float *>(J_val.GetDataPtr());
+    float *r_ptr = static_cast<float *>(r.GetDataPtr());
+
+    const int *grid_idx_ptr = static_cast<const int *>(grid_idx.GetDataPtr());
+    const int *grid_nbs_idx_ptr =
+            static_cast<const int *>(grid_nbs_idx.GetDataPtr());
+    const bool *grid_nbs_mask_ptr =
+            static_cast<const bool *>(grid_nbs_mask.GetDataPtr());
+
+    const float *positions_init_ptr =
+            static_cast<const float *>(positions_init.GetDataPtr());
+    const float *positions_curr_ptr =
+            static_cast<const float *>(positions_curr.GetDataPtr());
+
+    // The squared residual of a row is weight * local_r^2.
+    float sqrt_weight = sqrt(weight);
+
+    core::ParallelFor(device, n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+        // Enumerate 6 neighbors
+        int idx_i = grid_idx_ptr[workload_idx];
+
+        const int *idx_nbs = grid_nbs_idx_ptr + 6 * workload_idx;
+        const bool *mask_nbs = grid_nbs_mask_ptr + 6 * workload_idx;
+
+        int *idx = J_idx_ptr + 36 * workload_idx;
+        float *J = J_val_ptr + 36 * workload_idx;
+        float *r_i = r_ptr + 18 * workload_idx;
+        for (int k = 0; k < 36; ++k) {
+            idx[k] = 0;
+            J[k] = 0;
+        }
+        for (int k = 0; k < 18; ++k) {
+            r_i[k] = 0;
+        }
+
+        float R[3][3];
+        if (!GetSLACRegularizerRotation(idx_i, idx_nbs, mask_nbs,
+                                        positions_init_ptr, positions_curr_ptr,
+                                        anchor_idx, R)) {
+            return;
+        }
+
+        for (int k = 0; k < 6; ++k) {
+            if (!mask_nbs[k]) continue;
+            int idx_k = idx_nbs[k];
+
+            float local_r[3];
+            GetSLACRegularizerResidual(idx_i, idx_k, R, positions_init_ptr,
+                                       positions_curr_ptr, local_r);
+
+            int offset_idx_i = 3 * idx_i + 6 * n_frags;
+            int offset_idx_k = 3 * idx_k + 6 * n_frags;
+            for (int axis = 0; axis < 3; ++axis) {
+                int row = k * 3 + axis;
+                idx[row * 2 + 0] = offset_idx_i + axis;
+                idx[row * 2 + 1] = offset_idx_k + axis;
+                J[row * 2 + 0] = sqrt_weight;
+                J[row * 2 + 1] = -sqrt_weight;
+                r_i[row] = sqrt_weight * local_r[axis];
+            }
+        }
+    });
+}
+
+#if defined(__CUDACC__)
+void ComputeJTJxCUDA
+#else
+void ComputeJTJxCPU
+#endif
+        (core::Tensor &JTJx,
+         const core::Tensor &J_idx,
+         const core::Tensor &J_val,
+         const core::Tensor &x) {
+    int64_t n = J_idx.GetLength();
+    int64_t width = J_idx.GetShape(1);
+
+    float *JTJx_ptr = static_cast<float *>(JTJx.GetDataPtr());
+    const int *J_idx_ptr = static_cast<const int *>(J_idx.GetDataPtr());
+    const float *J_val_ptr = static_cast<const float *>(J_val.GetDataPtr());
+    const float *x_ptr = static_cast<const float *>(x.GetDataPtr());
+
+    core::ParallelFor(
+            JTJx.GetDevice(), n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                const int *idx = J_idx_ptr + width * workload_idx;
+                const float *J = J_val_ptr + width * workload_idx;
+
+                float Jx = 0;
+                for (int64_t k = 0; k < width; ++k) {
+                    Jx += J[k] * x_ptr[idx[k]];
+                }
+                if (Jx == 0) return;
+                for (int64_t k = 0; k < width; ++k) {
+#if defined(__CUDACC__)
+                    atomicAdd(&JTJx_ptr[idx[k]], J[k] * Jx);
+#else
+#pragma omp atomic
+                    JTJx_ptr[idx[k]] += J[k] * Jx;
+#endif
+                }
+            });
+}
+
+#if defined(__CUDACC__)
+void ComputeJTrCUDA
+#else
+void ComputeJTrCPU
+#endif
+        (core::Tensor &JTr,
+         const core::Tensor &J_idx,
+         const core::Tensor &J_val,
+         const core::Tensor &r) {
+    int64_t n = J_idx.GetLength();
+    int64_t width = J_idx.GetShape(1);
+
+    float *JTr_ptr = static_cast<float *>(JTr.GetDataPtr());
+    const int *J_idx_ptr = static_cast<const int *>(J_idx.GetDataPtr());
+    const float *J_val_ptr = static_cast<const float *>(J_val.GetDataPtr());
+    const float *r_ptr = static_cast<const float *>(r.GetDataPtr());
+
+    core::ParallelFor(
+            JTr.GetDevice(), n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                float r_k = r_ptr[workload_idx];
+                if (r_k == 0) return;
+                const int *idx = J_idx_ptr + width * workload_idx;
+                const float *J = J_val_ptr + width * workload_idx;
+                for (int64_t k = 0; k < width; ++k) {
+#if defined(__CUDACC__)
+                    atomicAdd(&JTr_ptr[idx[k]], J[k] * r_k);
+#else
+#pragma omp atomic
+                    JTr_ptr[idx[k]] += J[k] * r_k;
+#endif
+                }
+            });
+}
+
+/// Offset of the entry (a, b) in the block diagonal of the SLAC system, which
+/// stores the 6 x 6 blocks of the fragments followed by the 3 x 3 blocks of
+/// the control points. Returns -1 if a and b are in different blocks.
+OPEN3D_HOST_DEVICE inline int64_t GetBlockJacobiOffset(int a,
+                                                       int b,
+                                                       int n_frags) {
+    int n_pose_vars = 6 * n_frags;
+    if (a < n_pose_vars) {
+        if (b >= n_pose_vars || a / 6 != b / 6) return -1;
+        return int64_t(a / 6) * 36 + (a % 6) * 6 + b % 6;
+    }
+    a -= n_pose_vars;
+    b -= n_pose_vars;
+    if (b < 0 || a / 3 != b / 3) return -1;
+    return int64_t(n_frags) * 36 + int64_t(a / 3) * 9 + (a % 3) * 3 + b % 3;
+}
+
+#if defined(__CUDACC__)
+void FillInBlockJacobiCUDA
+#else
+void FillInBlockJacobiCPU
+#endif
+        (core::Tensor &blocks,
+         const core::Tensor &J_idx,
+         const core::Tensor &J_val,
+         int n_frags) {
+    int64_t n = J_idx.GetLength();
+    int64_t width = J_idx.GetShape(1);
+
+    float *blocks_ptr = static_cast<float *>(blocks.GetDataPtr());
+    const int *J_idx_ptr = static_cast<const int *>(J_idx.GetDataPtr());
+    const float *J_val_ptr = static_cast<const float *>(J_val.GetDataPtr());
+
+    core::ParallelFor(
+            blocks.GetDevice(), n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                const int *idx = J_idx_ptr + width * workload_idx;
+                const float *J = J_val_ptr + width * workload_idx;
+                for (int64_t ka = 0; ka < width; ++ka) {
+                    if (J[ka] == 0) continue;
+                    for (int64_t kb = 0; kb < width; ++kb) {
+                        int64_t offset =
+                                GetBlockJacobiOffset(idx[ka], idx[kb], n_frags);
+                        if (offset < 0) continue;
+#if defined(__CUDACC__)
+                        atomicAdd(&blocks_ptr[offset], J[ka] * J[kb]);
+#else
+#pragma omp atomic
+                        blocks_ptr[offset] += J[ka] * J[kb];
+#endif
+                    }
+                }
+            });
+}
+
+#if defined(__CUDACC__)
+void ApplyBlockJacobiCUDA
+#else
+void ApplyBlockJacobiCPU
+#endif
+        (core::Tensor &z,
+         const core::Tensor &blocks_inv,
+         const core::Tensor &x,
+         int n_frags) {
+    int64_t n = x.GetLength();
+    int n_pose_vars = 6 * n_frags;
+
+    float *z_ptr = static_cast<float *>(z.GetDataPtr());
+    const float *blocks_inv_ptr =
+            static_cast<const float *>(blocks_inv.GetDataPtr());
+    const float *x_ptr = static_cast<const float *>(x.GetDataPtr());
+
+    core::ParallelFor(
+            x.GetDevice(), n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                int a = int(workload_idx);
+                int block_size = a < n_pose_vars ? 6 : 3;
+                int start = a < n_pose_vars ? a - a % 6
+                                            : a - (a - n_pose_vars) % 3;
+                float z_a = 0;
+                for (int k = 0; k < block_size; ++k) {
+                    z_a += blocks_inv_ptr[GetBlockJacobiOffset(a, start + k,
+                                                               n_frags)] *
+                           x_ptr[start + k];
+                }
+                z_ptr[workload_idx] = z_a;
+            });
+}
 }  // namespace kernel
 }  // namespace pipelines
 }  // namespace t
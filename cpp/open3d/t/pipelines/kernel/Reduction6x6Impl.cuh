@@ -187,6 +187,45 @@ __device__ inline void ReduceSum6x6LinearSystem(const int tid,
     }
 }
 
+template <typename scalar_t, size_t BLOCK_SIZE>
+__device__ inline void ReduceSumPointToPoint(const int tid,
+                                             bool valid,
+                                             const scalar_t* reduction,
+                                             volatile scalar_t* local_sum0,
+                                             volatile scalar_t* local_sum1,
+                                             volatile scalar_t* local_sum2,
+                                             scalar_t* global_sum) {
+    // Sum reduction: source sum(3), target sum(3) and t sᵀ(9)
+    for (size_t i = 0; i < 15; i += 3) {
+        local_sum0[tid] = valid ? reduction[i + 0] : 0;
+        local_sum1[tid] = valid ? reduction[i + 1] : 0;
+        local_sum2[tid] = valid ? reduction[i + 2] : 0;
+        __syncthreads();
+
+        BlockReduceSum<scalar_t, BLOCK_SIZE>(tid, local_sum0, local_sum1,
+                                             local_sum2);
+
+        if (tid == 0) {
+            atomicAdd(&global_sum[i + 0], local_sum0[0]);
+            atomicAdd(&global_sum[i + 1], local_sum1[0]);
+            atomicAdd(&global_sum[i + 2], local_sum2[0]);
+        }
+        __syncthreads();
+    }
+
+    // Sum reduction: inlier(1)
+    {
+        local_sum0[tid] = valid ? reduction[15] : 0;
+        __syncthreads();
+
+        BlockReduceSum<scalar_t, BLOCK_SIZE>(tid, local_sum0);
+        if (tid == 0) {
+            atomicAdd(&global_sum[15], local_sum0[0]);
+        }
+        __syncthreads();
+    }
+}
+
 template <typename scalar_t, size_t BLOCK_SIZE>
 __device__ inline void ReduceSum6x6InformationJacobian(
         const int tid,
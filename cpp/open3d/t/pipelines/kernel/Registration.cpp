@@ -28,6 +28,7 @@
 
 #include "open3d/core/TensorCheck.h"
 #include "open3d/t/pipelines/kernel/RegistrationImpl.h"
+#include "open3d/t/pipelines/kernel/TransformationConverter.h"
 
 namespace open3d {
 namespace t {
@@ -69,6 +70,121 @@ core::Tensor ComputePosePointToPlane(const core::Tensor &source_points,
     return pose;
 }
 
+std::tuple<core::Tensor, core::Tensor, core::Tensor>
+ComputePosePointToPlaneBatched(const core::Tensor &source_points,
+                               const core::Tensor &target_points,
+                               const core::Tensor &target_normals,
+                               const core::Tensor &correspondence_indices,
+                               const core::Tensor &source_row_splits,
+                               const registration::RobustKernel &kernel) {
+    const core::Device device = source_points.GetDevice();
+    const core::Device host("CPU:0");
+    core::AssertTensorDevice(source_row_splits, host);
+    core::AssertTensorDtype(source_row_splits, core::Int64);
+    core::AssertTensorShape(source_row_splits, {utility::nullopt});
+
+    const int64_t num_pairs = source_row_splits.GetLength() - 1;
+    if (num_pairs < 1 ||
+        source_row_splits[-1].Item<int64_t>() != source_points.GetLength()) {
+        utility::LogError(
+                "source_row_splits and source_points have incompatible "
+                "shapes.");
+    }
+
+    // Sums of the per pair A_1x29 linear systems, {num_pairs, 29} [output].
+    core::Tensor global_sums;
+
+    const core::Device::DeviceType device_type = device.GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        ComputePosePointToPlaneBatchedCPU(
+                source_points.Contiguous(), target_points.Contiguous(),
+                target_normals.Contiguous(),
+                correspondence_indices.Contiguous(),
+                source_row_splits.Contiguous(), global_sums,
+                source_points.GetDtype(), device, kernel);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(ComputePosePointToPlaneBatchedCUDA,
+                  source_points.Contiguous(), target_points.Contiguous(),
+                  target_normals.Contiguous(),
+                  correspondence_indices.Contiguous(),
+                  source_row_splits.Contiguous(), global_sums,
+                  source_points.GetDtype(), device, kernel);
+    } else {
+        utility::LogError("Unimplemented device.");
+    }
+
+    // Solve the 6x6 systems on CPU, skipping pairs without correspondences.
+    const core::Tensor global_sums_host = global_sums.To(host, core::Float64);
+    const double *global_sums_ptr = global_sums_host.GetDataPtr<double>();
+    core::Tensor poses =
+            core::Tensor::Zeros({num_pairs, 6}, core::Float64, host);
+    core::Tensor squared_errors =
+            core::Tensor::Empty({num_pairs}, core::Float64, host);
+    core::Tensor inlier_counts =
+            core::Tensor::Empty({num_pairs}, core::Int64, host);
+    double *squared_errors_ptr = squared_errors.GetDataPtr<double>();
+    int64_t *inlier_counts_ptr = inlier_counts.GetDataPtr<int64_t>();
+    for (int64_t i = 0; i < num_pairs; ++i) {
+        squared_errors_ptr[i] = global_sums_ptr[29 * i + 27];
+        inlier_counts_ptr[i] =
+                static_cast<int64_t>(global_sums_ptr[29 * i + 28]);
+        if (inlier_counts_ptr[i] == 0) {
+            continue;
+        }
+
+        core::Tensor pose;
+        float residual = 0;
+        int inlier_count = 0;
+        try {
+            DecodeAndSolve6x6(global_sums_host[i], pose, residual,
+                              inlier_count);
+            poses[i] = pose;
+        } catch (const std::runtime_error &) {
+            // The pose of a degenerate pair is left at zero.
+        }
+    }
+
+    return std::make_tuple(poses, squared_errors, inlier_counts);
+}
+
+core::Tensor ComputePoseFastGlobalRegistration(
+        const core::Tensor &source_points,
+        const core::Tensor &target_points,
+        const core::Tensor &correspondences,
+        const registration::RobustKernel &kernel) {
+    const core::Device device = source_points.GetDevice();
+    core::AssertTensorDevice(correspondences, device);
+    core::AssertTensorDtype(correspondences, core::Int64);
+    core::AssertTensorShape(correspondences, {utility::nullopt, 2});
+
+    // Pose {6,} tensor [output].
+    core::Tensor pose = core::Tensor::Empty({6}, core::Float64, device);
+
+    float residual = 0;
+    int inlier_count = 0;
+
+    const core::Device::DeviceType device_type = device.GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        ComputePoseFastGlobalRegistrationCPU(
+                source_points.Contiguous(), target_points.Contiguous(),
+                correspondences.Contiguous(), pose, residual, inlier_count,
+                source_points.GetDtype(), device, kernel);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(ComputePoseFastGlobalRegistrationCUDA,
+                  source_points.Contiguous(), target_points.Contiguous(),
+                  correspondences.Contiguous(), pose, residual, inlier_count,
+                  source_points.GetDtype(), device, kernel);
+    } else {
+        utility::LogError("Unimplemented device.");
+    }
+
+    utility::LogDebug(
+            "FastGlobalRegistration Transform: residual {}, inlier_count {}",
+            residual, inlier_count);
+
+    return pose;
+}
+
 core::Tensor ComputePoseColoredICP(const core::Tensor &source_points,
                                    const core::Tensor &source_colors,
                                    const core::Tensor &target_points,
@@ -113,78 +229,120 @@ core::Tensor ComputePoseColoredICP(const core::Tensor &source_points,
     return pose;
 }
 
+core::Tensor ComputePoseGeneralizedICP(
+        const core::Tensor &source_points,
+        const core::Tensor &source_covariances,
+        const core::Tensor &source_colors,
+        const core::Tensor &target_points,
+        const core::Tensor &target_covariances,
+        const core::Tensor &target_normals,
+        const core::Tensor &target_colors,
+        const core::Tensor &target_color_gradients,
+        const core::Tensor &correspondence_indices,
+        const registration::RobustKernel &kernel,
+        const double &lambda_geometric) {
+    const core::Device device = source_points.GetDevice();
+
+    // Pose {6,} tensor [output].
+    core::Tensor pose = core::Tensor::Empty({6}, core::Dtype::Float64, device);
+
+    float residual = 0;
+    int inlier_count = 0;
+
+    core::Device::DeviceType device_type = device.GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        ComputePoseGeneralizedICPCPU(
+                source_points.Contiguous(), source_covariances.Contiguous(),
+                source_colors.Contiguous(), target_points.Contiguous(),
+                target_covariances.Contiguous(), target_normals.Contiguous(),
+                target_colors.Contiguous(), target_color_gradients.Contiguous(),
+                correspondence_indices.Contiguous(), pose, residual,
+                inlier_count, source_points.GetDtype(), device, kernel,
+                lambda_geometric);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(ComputePoseGeneralizedICPCUDA, source_points.Contiguous(),
+                  source_covariances.Contiguous(), source_colors.Contiguous(),
+                  target_points.Contiguous(), target_covariances.Contiguous(),
+                  target_normals.Contiguous(), target_colors.Contiguous(),
+                  target_color_gradients.Contiguous(),
+                  correspondence_indices.Contiguous(), pose, residual,
+                  inlier_count, source_points.GetDtype(), device, kernel,
+                  lambda_geometric);
+    } else {
+        utility::LogError("Unimplemented device.");
+    }
+
+    utility::LogDebug(
+            "GeneralizedICP Transform: residual {}, inlier_count {}", residual,
+            inlier_count);
+
+    return pose;
+}
+
 std::tuple<core::Tensor, core::Tensor> ComputeRtPointToPoint(
         const core::Tensor &source_points,
         const core::Tensor &target_points,
         const core::Tensor &correspondence_indices) {
     const core::Device device = source_points.GetDevice();
+    const core::Dtype dtype = source_points.GetDtype();
 
     // [Output] Rotation and translation tensor of type Float64.
     core::Tensor R, t;
 
-    int inlier_count = 0;
+    // {16} sums of source, target, t sᵀ and inlier_count, relative to the
+    // first source point, reduced in a single pass over the correspondences.
+    core::Tensor global_sum;
 
     const core::Device::DeviceType device_type = device.GetType();
     if (device_type == core::Device::DeviceType::CPU) {
-        // Pointer to point cloud data - indexed according to correspondences.
         ComputeRtPointToPointCPU(
                 source_points.Contiguous(), target_points.Contiguous(),
-                correspondence_indices.Contiguous(), R, t, inlier_count,
-                source_points.GetDtype(), device);
+                correspondence_indices.Contiguous(), global_sum, dtype, device);
     } else if (device_type == core::Device::DeviceType::CUDA) {
-#ifdef BUILD_CUDA_MODULE
-        // TODO: Implement optimized CUDA reduction kernel.
-        core::Tensor valid = correspondence_indices.Ne(-1).Reshape({-1});
-        // correpondence_set : (i, corres[i]).
+        CUDA_CALL(ComputeRtPointToPointCUDA, source_points.Contiguous(),
+                  target_points.Contiguous(),
+                  correspondence_indices.Contiguous(), global_sum, dtype,
+                  device);
+    } else {
+        utility::LogError("Unimplemented device.");
+    }
 
-        if (valid.GetLength() == 0) {
-            utility::LogError("No valid correspondence present.");
-        }
+    const core::Device host("CPU:0");
+    const core::Tensor sums = global_sum.To(host, core::Float64);
+    const double *sums_ptr = sums.GetDataPtr<double>();
+    const double inlier_count = sums_ptr[15];
+    if (inlier_count == 0) {
+        utility::LogError("No valid correspondence present.");
+    }
 
-        // source[i] and target[corres[i]] is a correspondence.
-        core::Tensor source_indices =
-                core::Tensor::Arange(0, source_points.GetShape()[0], 1,
-                                     core::Int64, device)
-                        .IndexGet({valid});
-        // Only take valid indices.
-        core::Tensor target_indices =
-                correspondence_indices.IndexGet({valid}).Reshape({-1});
-
-        // Number of good correspondences (C).
-        inlier_count = source_indices.GetLength();
-
-        core::Tensor source_select = source_points.IndexGet({source_indices});
-        core::Tensor target_select = target_points.IndexGet({target_indices});
-
-        // https://ieeexplore.ieee.org/document/88573
-        core::Tensor mean_s = source_select.Mean({0}, true);
-        core::Tensor mean_t = target_select.Mean({0}, true);
-
-        // Compute linear system on CPU as Float64.
-        core::Device host("CPU:0");
-        core::Tensor Sxy = (target_select - mean_t)
-                                   .T()
-                                   .Matmul(source_select - mean_s)
-                                   .Div_(static_cast<float>(inlier_count))
-                                   .To(host, core::Float64);
-
-        mean_s = mean_s.To(host, core::Float64);
-        mean_t = mean_t.To(host, core::Float64);
-
-        core::Tensor U, D, VT;
-        std::tie(U, D, VT) = Sxy.SVD();
-        core::Tensor S = core::Tensor::Eye(3, core::Float64, host);
-        if (U.Det() * (VT.T()).Det() < 0) {
-            S[-1][-1] = -1;
+    // https://ieeexplore.ieee.org/document/88573
+    core::Tensor origin = source_points[0].To(host, core::Float64);
+    core::Tensor mean_s = core::Tensor::Empty({3}, core::Float64, host);
+    core::Tensor mean_t = core::Tensor::Empty({3}, core::Float64, host);
+    core::Tensor Sxy = core::Tensor::Empty({3, 3}, core::Float64, host);
+    double *mean_s_ptr = mean_s.GetDataPtr<double>();
+    double *mean_t_ptr = mean_t.GetDataPtr<double>();
+    double *sxy_ptr = Sxy.GetDataPtr<double>();
+    for (int j = 0; j < 3; ++j) {
+        mean_s_ptr[j] = sums_ptr[j] / inlier_count;
+        mean_t_ptr[j] = sums_ptr[3 + j] / inlier_count;
+    }
+    for (int j = 0; j < 3; ++j) {
+        for (int k = 0; k < 3; ++k) {
+            sxy_ptr[3 * j + k] = sums_ptr[6 + 3 * j + k] / inlier_count -
+                                 mean_t_ptr[j] * mean_s_ptr[k];
         }
-        R = U.Matmul(S.Matmul(VT));
-        t = mean_t.Reshape({-1}) - R.Matmul(mean_s.T()).Reshape({-1});
-#else
-        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
-#endif
-    } else {
-        utility::LogError("Unimplemented device.");
     }
+
+    core::Tensor U, D, VT;
+    std::tie(U, D, VT) = Sxy.SVD();
+    core::Tensor S = core::Tensor::Eye(3, core::Float64, host);
+    if (U.Det() * (VT.T()).Det() < 0) {
+        S[-1][-1] = -1;
+    }
+    R = U.Matmul(S.Matmul(VT));
+    t = (mean_t + origin) - R.Matmul((mean_s + origin).Reshape({3, 1}))
+                                    .Reshape({-1});
     return std::make_tuple(R, t);
 }
 
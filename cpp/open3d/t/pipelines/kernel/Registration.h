@@ -55,6 +55,54 @@ core::Tensor ComputePosePointToPlane(const core::Tensor &source_positions,
                                      const core::Tensor &correspondence_indices,
                                      const registration::RobustKernel &kernel);
 
+/// \brief Computes poses for point to plane registration of a batch of
+/// source / target pairs, reducing the linear systems of all pairs in one pass.
+///
+/// \param source_positions Concatenated source point positions of all pairs,
+/// of Float32 or Float64 dtype.
+/// \param target_positions Concatenated target point positions of all pairs,
+/// of same dtype as source point positions.
+/// \param target_normals Concatenated target point normals of all pairs, of
+/// same dtype as source point positions.
+/// \param correspondence_indices Tensor of type Int64 containing indices of
+/// corresponding target positions in the concatenated target positions, where
+/// the index of the value itself is the index in the concatenated source
+/// positions. It contains -1 as value at index with no correspondence.
+/// \param source_row_splits Int64 tensor of shape {N + 1} on CPU, defining
+/// the start and end of the source points of each of the N pairs.
+/// \param kernel statistical robust kernel for outlier rejection.
+/// \return Tuple of (poses, squared_errors, inlier_counts) on CPU. Poses is a
+/// {N, 6} Float64 tensor of [alpha beta gamma, tx, ty, tz] per pair, which is
+/// zero for pairs without correspondences or with a singular system.
+/// squared_errors is a {N} Float64 tensor of the sums of squared distances of
+/// the correspondences and inlier_counts is a {N} Int64 tensor of the number
+/// of correspondences.
+std::tuple<core::Tensor, core::Tensor, core::Tensor>
+ComputePosePointToPlaneBatched(const core::Tensor &source_positions,
+                               const core::Tensor &target_positions,
+                               const core::Tensor &target_normals,
+                               const core::Tensor &correspondence_indices,
+                               const core::Tensor &source_row_splits,
+                               const registration::RobustKernel &kernel);
+
+/// \brief Computes pose for the robust point to point objective of Fast Global
+/// Registration.
+///
+/// \param source_positions source point positions of Float32 or Float64 dtype.
+/// \param target_positions target point positions of same dtype as source point
+/// positions.
+/// \param correspondences Int64 tensor of shape {K, 2}, where each row holds
+/// the source and the target index of a correspondence.
+/// \param kernel statistical robust kernel, evaluated on the distance of each
+/// correspondence.
+/// \return Pose [alpha beta gamma, tx, ty, tz], a shape {6} tensor of dtype
+/// Float64, where alpha, beta, gamma are the Euler angles in the ZYX order.
+core::Tensor ComputePoseFastGlobalRegistration(
+        const core::Tensor &source_positions,
+        const core::Tensor &target_positions,
+        const core::Tensor &correspondences,
+        const registration::RobustKernel &kernel);
+
 /// \brief Computes pose for colored-icp registration method.
 ///
 /// \param source_positions source point positions of Float32 or Float64 dtype.
@@ -87,6 +135,46 @@ core::Tensor ComputePoseColoredICP(const core::Tensor &source_positions,
                                    const registration::RobustKernel &kernel,
                                    const double &lambda_geometric);
 
+/// \brief Computes pose for generalized-icp registration method, with an
+/// optional colored-icp photometric term on the same correspondences.
+///
+/// \param source_positions source point positions of Float32 or Float64 dtype.
+/// \param source_covariances source point covariances of shape {N, 3, 3} and
+/// same dtype as source point positions.
+/// \param source_colors source point colors of same dtype as source point
+/// positions. Only used if \p lambda_geometric < 1.
+/// \param target_positions target point positions of same dtype as source point
+/// positions.
+/// \param target_covariances target point covariances of shape {N, 3, 3} and
+/// same dtype as source point positions.
+/// \param target_normals target point normals of same dtype as source point
+/// positions. Only used if \p lambda_geometric < 1.
+/// \param target_colors target point colors of same dtype as source point
+/// positions. Only used if \p lambda_geometric < 1.
+/// \param target_color_gradients targets point color gradients of same dtype as
+/// source point positions. Only used if \p lambda_geometric < 1.
+/// \param correspondence_indices Tensor of type Int64 containing indices of
+/// corresponding target positions, where the value is the target index and the
+/// index of the value itself is the source index. It contains -1 as value at
+/// index with no correspondence.
+/// \param kernel statistical robust kernel for outlier rejection, evaluated on
+/// the Mahalanobis distance of each correspondence.
+/// \param lambda_geometric `λ ∈ [0,1]` in the overall energy `λEG + (1−λ)EC`.
+/// \return Pose [alpha beta gamma, tx, ty, tz], a shape {6} tensor of dtype
+/// Float64, where alpha, beta, gamma are the Euler angles in the ZYX order.
+core::Tensor ComputePoseGeneralizedICP(
+        const core::Tensor &source_positions,
+        const core::Tensor &source_covariances,
+        const core::Tensor &source_colors,
+        const core::Tensor &target_positions,
+        const core::Tensor &target_covariances,
+        const core::Tensor &target_normals,
+        const core::Tensor &target_colors,
+        const core::Tensor &target_color_gradients,
+        const core::Tensor &correspondence_indices,
+        const registration::RobustKernel &kernel,
+        const double &lambda_geometric);
+
 /// \brief Computes (R) Rotation {3,3} and (t) translation {3,}
 /// for point to point registration method.
 ///
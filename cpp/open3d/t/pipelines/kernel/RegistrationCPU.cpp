@@ -46,7 +46,7 @@ namespace pipelines {
 namespace kernel {
 
 template <typename scalar_t, typename func_t>
-static void ComputePosePointToPlaneKernelCPU(
+OPEN3D_TARGET_CLONES static void ComputePosePointToPlaneKernelCPU(
         const scalar_t *source_points_ptr,
         const scalar_t *target_points_ptr,
         const scalar_t *target_normals_ptr,
@@ -146,8 +146,198 @@ void ComputePosePointToPlaneCPU(const core::Tensor &source_points,
     DecodeAndSolve6x6(global_sum, pose, residual, inlier_count);
 }
 
+template <typename scalar_t, typename func_t>
+static void ComputePosePointToPlaneBatchedKernelCPU(
+        const scalar_t *source_points_ptr,
+        const scalar_t *target_points_ptr,
+        const scalar_t *target_normals_ptr,
+        const int64_t *correspondence_indices,
+        const int64_t *source_row_splits,
+        const int64_t num_pairs,
+        scalar_t *global_sums,
+        func_t GetWeightFromRobustKernel) {
+    // Pairs are independent, so each one is reduced serially into its own
+    // A_1x29 row. The row layout is the same as in
+    // ComputePosePointToPlaneKernelCPU, except that the 27th element holds the
+    // sum of squared correspondence distances.
+    tbb::parallel_for(
+            tbb::blocked_range<int64_t>(0, num_pairs),
+            [&](const tbb::blocked_range<int64_t> &range) {
+                for (int64_t pair_idx = range.begin(); pair_idx < range.end();
+                     ++pair_idx) {
+                    scalar_t *A_reduction = global_sums + 29 * pair_idx;
+                    for (int64_t workload_idx = source_row_splits[pair_idx];
+                         workload_idx < source_row_splits[pair_idx + 1];
+                         ++workload_idx) {
+                        scalar_t J_ij[6];
+                        scalar_t r = 0;
+
+                        bool valid = kernel::GetJacobianPointToPlane<scalar_t>(
+                                workload_idx, source_points_ptr,
+                                target_points_ptr, target_normals_ptr,
+                                correspondence_indices, J_ij, r);
+                        if (!valid) {
+                            continue;
+                        }
+
+                        scalar_t w = GetWeightFromRobustKernel(r);
+
+                        // Dump J, r into JtJ and Jtr
+                        int i = 0;
+                        for (int j = 0; j < 6; ++j) {
+                            for (int k = 0; k <= j; ++k) {
+                                A_reduction[i] += J_ij[j] * w * J_ij[k];
+                                ++i;
+                            }
+                            A_reduction[21 + j] += J_ij[j] * w * r;
+                        }
+                        A_reduction[27] +=
+                                GetSquaredDistanceOfCorrespondence<scalar_t>(
+                                        workload_idx, source_points_ptr,
+                                        target_points_ptr,
+                                        correspondence_indices);
+                        A_reduction[28] += 1;
+                    }
+                }
+            });
+}
+
+void ComputePosePointToPlaneBatchedCPU(
+        const core::Tensor &source_points,
+        const core::Tensor &target_points,
+        const core::Tensor &target_normals,
+        const core::Tensor &correspondence_indices,
+        const core::Tensor &source_row_splits,
+        core::Tensor &global_sums,
+        const core::Dtype &dtype,
+        const core::Device &device,
+        const registration::RobustKernel &kernel) {
+    const int64_t num_pairs = source_row_splits.GetLength() - 1;
+
+    global_sums = core::Tensor::Zeros({num_pairs, 29}, dtype, device);
+
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(dtype, [&]() {
+        scalar_t *global_sums_ptr = global_sums.GetDataPtr<scalar_t>();
+
+        DISPATCH_ROBUST_KERNEL_FUNCTION(
+                kernel.type_, scalar_t, kernel.scaling_parameter_,
+                kernel.shape_parameter_, [&]() {
+                    kernel::ComputePosePointToPlaneBatchedKernelCPU(
+                            source_points.GetDataPtr<scalar_t>(),
+                            target_points.GetDataPtr<scalar_t>(),
+                            target_normals.GetDataPtr<scalar_t>(),
+                            correspondence_indices.GetDataPtr<int64_t>(),
+                            source_row_splits.GetDataPtr<int64_t>(),
+                            num_pairs, global_sums_ptr,
+                            GetWeightFromRobustKernel);
+                });
+    });
+}
+
+template <typename scalar_t, typename func_t>
+OPEN3D_TARGET_CLONES static void ComputePoseFastGlobalRegistrationKernelCPU(
+        const scalar_t *source_points_ptr,
+        const scalar_t *target_points_ptr,
+        const int64_t *correspondences,
+        const int n,
+        scalar_t *global_sum,
+        func_t GetWeightFromRobustKernel) {
+    // The A_1x29 layout is the same as in ComputePosePointToPlaneKernelCPU,
+    // except that the 27th element holds the sum of squared correspondence
+    // distances.
+    std::vector<scalar_t> A_1x29(29, 0.0);
+
+#ifdef _WIN32
+    std::vector<scalar_t> zeros_29(29, 0.0);
+    A_1x29 = tbb::parallel_reduce(
+            tbb::blocked_range<int>(0, n), zeros_29,
+            [&](tbb::blocked_range<int> r, std::vector<scalar_t> A_reduction) {
+                for (int workload_idx = r.begin(); workload_idx < r.end();
+                     ++workload_idx) {
+#else
+    scalar_t *A_reduction = A_1x29.data();
+#pragma omp parallel for reduction(+ : A_reduction[:29]) schedule(static) num_threads(utility::EstimateMaxThreads())
+    for (int workload_idx = 0; workload_idx < n; workload_idx++) {
+#endif
+                    scalar_t J_x[6], J_y[6], J_z[6];
+                    scalar_t r[3];
+
+                    kernel::GetJacobianPointToPoint<scalar_t>(
+                            workload_idx, source_points_ptr, target_points_ptr,
+                            correspondences, J_x, J_y, J_z, r);
+
+                    const scalar_t r2 = r[0] * r[0] + r[1] * r[1] + r[2] * r[2];
+                    // The robust kernel weighs the whole correspondence by
+                    // its distance.
+                    scalar_t w = GetWeightFromRobustKernel(sqrt(r2));
+
+                    // Dump J, r into JtJ and Jtr
+                    int i = 0;
+                    for (int j = 0; j < 6; ++j) {
+                        for (int k = 0; k <= j; ++k) {
+                            A_reduction[i] += w * (J_x[j] * J_x[k] +
+                                                   J_y[j] * J_y[k] +
+                                                   J_z[j] * J_z[k]);
+                            ++i;
+                        }
+                        A_reduction[21 + j] +=
+                                w * (J_x[j] * r[0] + J_y[j] * r[1] +
+                                     J_z[j] * r[2]);
+                    }
+                    A_reduction[27] += r2;
+                    A_reduction[28] += 1;
+                }
+#ifdef _WIN32
+                return A_reduction;
+            },
+            // TBB: Defining reduction operation.
+            [&](std::vector<scalar_t> a, std::vector<scalar_t> b) {
+                std::vector<scalar_t> result(29);
+                for (int j = 0; j < 29; ++j) {
+                    result[j] = a[j] + b[j];
+                }
+                return result;
+            });
+#endif
+
+    for (int i = 0; i < 29; ++i) {
+        global_sum[i] = A_1x29[i];
+    }
+}
+
+void ComputePoseFastGlobalRegistrationCPU(
+        const core::Tensor &source_points,
+        const core::Tensor &target_points,
+        const core::Tensor &correspondences,
+        core::Tensor &pose,
+        float &residual,
+        int &inlier_count,
+        const core::Dtype &dtype,
+        const core::Device &device,
+        const registration::RobustKernel &kernel) {
+    int n = correspondences.GetLength();
+
+    core::Tensor global_sum = core::Tensor::Zeros({29}, dtype, device);
+
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(dtype, [&]() {
+        scalar_t *global_sum_ptr = global_sum.GetDataPtr<scalar_t>();
+
+        DISPATCH_ROBUST_KERNEL_FUNCTION(
+                kernel.type_, scalar_t, kernel.scaling_parameter_,
+                kernel.shape_parameter_, [&]() {
+                    kernel::ComputePoseFastGlobalRegistrationKernelCPU(
+                            source_points.GetDataPtr<scalar_t>(),
+                            target_points.GetDataPtr<scalar_t>(),
+                            correspondences.GetDataPtr<int64_t>(), n,
+                            global_sum_ptr, GetWeightFromRobustKernel);
+                });
+    });
+
+    DecodeAndSolve6x6(global_sum, pose, residual, inlier_count);
+}
+
 template <typename scalar_t, typename funct_t>
-static void ComputePoseColoredICPKernelCPU(
+OPEN3D_TARGET_CLONES static void ComputePoseColoredICPKernelCPU(
         const scalar_t *source_points_ptr,
         const scalar_t *source_colors_ptr,
         const scalar_t *target_points_ptr,
@@ -268,171 +458,234 @@ void ComputePoseColoredICPCPU(const core::Tensor &source_points,
     DecodeAndSolve6x6(global_sum, pose, residual, inlier_count);
 }
 
-template <typename scalar_t>
-static void Get3x3SxyLinearSystem(const scalar_t *source_points_ptr,
-                                  const scalar_t *target_points_ptr,
-                                  const int64_t *correspondence_indices,
-                                  const int &n,
-                                  const core::Dtype &dtype,
-                                  const core::Device &device,
-                                  core::Tensor &Sxy,
-                                  core::Tensor &target_mean,
-                                  core::Tensor &source_mean,
-                                  int &inlier_count) {
-    // Calculating source_mean and target_mean, which are mean(x, y, z) of
-    // source and target points respectively.
-    // mean_1x7[6] is the number of total valid correspondences.
-    std::vector<scalar_t> mean_1x7(7, 0.0);
-    // Identity element for running_total reduction variable: zeros_6.
-    std::vector<scalar_t> zeros_7(7, 0.0);
-
-    mean_1x7 = tbb::parallel_reduce(
-            tbb::blocked_range<int>(0, n), zeros_7,
-            [&](tbb::blocked_range<int> r,
-                std::vector<scalar_t> mean_reduction) {
+template <typename scalar_t, typename funct_t>
+OPEN3D_TARGET_CLONES static void ComputePoseGeneralizedICPKernelCPU(
+        const scalar_t *source_points_ptr,
+        const scalar_t *source_covariances_ptr,
+        const scalar_t *source_colors_ptr,
+        const scalar_t *target_points_ptr,
+        const scalar_t *target_covariances_ptr,
+        const scalar_t *target_normals_ptr,
+        const scalar_t *target_colors_ptr,
+        const scalar_t *target_color_gradients_ptr,
+        const int64_t *correspondence_indices,
+        const scalar_t &lambda_geometric,
+        const scalar_t &sqrt_lambda_photometric,
+        const int n,
+        scalar_t *global_sum,
+        funct_t GetWeightFromRobustKernel) {
+    // The A_1x29 layout is the same as in ComputePosePointToPlaneKernelCPU,
+    // except that the 27th element holds the sum of squared whitened
+    // residuals.
+    std::vector<scalar_t> A_1x29(29, 0.0);
+    // The photometric term is only evaluated if colors are given.
+    const bool has_photometric_term = source_colors_ptr != nullptr;
+
+#ifdef _WIN32
+    std::vector<scalar_t> zeros_29(29, 0.0);
+    A_1x29 = tbb::parallel_reduce(
+            tbb::blocked_range<int>(0, n), zeros_29,
+            [&](tbb::blocked_range<int> r, std::vector<scalar_t> A_reduction) {
                 for (int workload_idx = r.begin(); workload_idx < r.end();
                      ++workload_idx) {
-                    if (correspondence_indices[workload_idx] != -1) {
-                        int64_t target_idx =
-                                3 * correspondence_indices[workload_idx];
-                        mean_reduction[0] +=
-                                source_points_ptr[3 * workload_idx];
-                        mean_reduction[1] +=
-                                source_points_ptr[3 * workload_idx + 1];
-                        mean_reduction[2] +=
-                                source_points_ptr[3 * workload_idx + 2];
-
-                        mean_reduction[3] += target_points_ptr[target_idx];
-                        mean_reduction[4] += target_points_ptr[target_idx + 1];
-                        mean_reduction[5] += target_points_ptr[target_idx + 2];
-
-                        mean_reduction[6] += 1;
+#else
+    scalar_t *A_reduction = A_1x29.data();
+#pragma omp parallel for reduction(+ : A_reduction[:29]) schedule(static) num_threads(utility::EstimateMaxThreads())
+    for (int workload_idx = 0; workload_idx < n; ++workload_idx) {
+#endif
+                    scalar_t J_x[6], J_y[6], J_z[6];
+                    scalar_t r[3];
+
+                    bool valid = GetJacobianGeneralizedICP<scalar_t>(
+                            workload_idx, source_points_ptr,
+                            source_covariances_ptr, target_points_ptr,
+                            target_covariances_ptr, correspondence_indices, J_x,
+                            J_y, J_z, r);
+
+                    if (valid) {
+                        const scalar_t r2 =
+                                r[0] * r[0] + r[1] * r[1] + r[2] * r[2];
+                        // The robust kernel weighs the whole correspondence by
+                        // its Mahalanobis distance.
+                        scalar_t w = lambda_geometric *
+                                     GetWeightFromRobustKernel(sqrt(r2));
+
+                        // The photometric term of Colored-ICP on the same
+                        // correspondence.
+                        scalar_t J_G[6] = {0}, J_I[6] = {0};
+                        scalar_t r_G = 0, r_I = 0, w_I = 0;
+                        if (has_photometric_term) {
+                            GetJacobianColoredICP<scalar_t>(
+                                    workload_idx, source_points_ptr,
+                                    source_colors_ptr, target_points_ptr,
+                                    target_normals_ptr, target_colors_ptr,
+                                    target_color_gradients_ptr,
+                                    correspondence_indices, 0,
+                                    sqrt_lambda_photometric, J_G, J_I, r_G,
+                                    r_I);
+                            w_I = GetWeightFromRobustKernel(r_I);
+                        }
+
+                        // Dump J, r into JtJ and Jtr
+                        int i = 0;
+                        for (int j = 0; j < 6; ++j) {
+                            for (int k = 0; k <= j; ++k) {
+                                A_reduction[i] += w * (J_x[j] * J_x[k] +
+                                                       J_y[j] * J_y[k] +
+                                                       J_z[j] * J_z[k]) +
+                                                  J_I[j] * w_I * J_I[k];
+                                ++i;
+                            }
+                            A_reduction[21 + j] +=
+                                    w * (J_x[j] * r[0] + J_y[j] * r[1] +
+                                         J_z[j] * r[2]) +
+                                    J_I[j] * w_I * r_I;
+                        }
+                        A_reduction[27] += lambda_geometric * r2 + r_I * r_I;
+                        A_reduction[28] += 1;
                     }
                 }
-                return mean_reduction;
+#ifdef _WIN32
+                return A_reduction;
             },
             // TBB: Defining reduction operation.
             [&](std::vector<scalar_t> a, std::vector<scalar_t> b) {
-                std::vector<scalar_t> result(7);
-                for (int j = 0; j < 7; ++j) {
+                std::vector<scalar_t> result(29);
+                for (int j = 0; j < 29; ++j) {
                     result[j] = a[j] + b[j];
                 }
                 return result;
             });
+#endif
 
-    if (mean_1x7[6] == 0) {
-        utility::LogError("No valid correspondence present.");
+    for (int i = 0; i < 29; ++i) {
+        global_sum[i] = A_1x29[i];
     }
+}
 
-    for (int i = 0; i < 6; ++i) {
-        mean_1x7[i] = mean_1x7[i] / mean_1x7[6];
-    }
+void ComputePoseGeneralizedICPCPU(const core::Tensor &source_points,
+                                  const core::Tensor &source_covariances,
+                                  const core::Tensor &source_colors,
+                                  const core::Tensor &target_points,
+                                  const core::Tensor &target_covariances,
+                                  const core::Tensor &target_normals,
+                                  const core::Tensor &target_colors,
+                                  const core::Tensor &target_color_gradients,
+                                  const core::Tensor &correspondence_indices,
+                                  core::Tensor &pose,
+                                  float &residual,
+                                  int &inlier_count,
+                                  const core::Dtype &dtype,
+                                  const core::Device &device,
+                                  const registration::RobustKernel &kernel,
+                                  const double &lambda_geometric) {
+    int n = source_points.GetLength();
+
+    core::Tensor global_sum = core::Tensor::Zeros({29}, dtype, device);
+    const bool has_photometric_term = lambda_geometric < 1.0;
 
-    // Calculating the Sxy for SVD.
-    std::vector<scalar_t> sxy_1x9(9, 0.0);
-    // Identity element for running total reduction variable: zeros_9.
-    std::vector<scalar_t> zeros_9(9, 0.0);
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(dtype, [&]() {
+        scalar_t lambda_geometric_t = static_cast<scalar_t>(lambda_geometric);
+        scalar_t sqrt_lambda_photometric =
+                static_cast<scalar_t>(sqrt(1.0 - lambda_geometric));
+        auto get_ptr = [&](const core::Tensor &tensor) -> const scalar_t * {
+            return has_photometric_term ? tensor.GetDataPtr<scalar_t>()
+                                        : nullptr;
+        };
+        DISPATCH_ROBUST_KERNEL_FUNCTION(
+                kernel.type_, scalar_t, kernel.scaling_parameter_,
+                kernel.shape_parameter_, [&]() {
+                    kernel::ComputePoseGeneralizedICPKernelCPU(
+                            source_points.GetDataPtr<scalar_t>(),
+                            source_covariances.GetDataPtr<scalar_t>(),
+                            get_ptr(source_colors),
+                            target_points.GetDataPtr<scalar_t>(),
+                            target_covariances.GetDataPtr<scalar_t>(),
+                            get_ptr(target_normals), get_ptr(target_colors),
+                            get_ptr(target_color_gradients),
+                            correspondence_indices.GetDataPtr<int64_t>(),
+                            lambda_geometric_t, sqrt_lambda_photometric, n,
+                            global_sum.GetDataPtr<scalar_t>(),
+                            GetWeightFromRobustKernel);
+                });
+    });
 
-    sxy_1x9 = tbb::parallel_reduce(
-            tbb::blocked_range<int>(0, n), zeros_9,
-            [&](tbb::blocked_range<int> r,
-                std::vector<scalar_t> sxy_1x9_reduction) {
+    DecodeAndSolve6x6(global_sum, pose, residual, inlier_count);
+}
+
+template <typename scalar_t>
+OPEN3D_TARGET_CLONES static void ComputeRtPointToPointKernelCPU(
+        const scalar_t *source_points_ptr,
+        const scalar_t *target_points_ptr,
+        const int64_t *correspondence_indices,
+        const int n,
+        scalar_t *global_sum) {
+    // [0:3] source sum, [3:6] target sum, [6:15] t sᵀ and 15th the
+    // inlier_count, all relative to the first source point.
+    std::vector<scalar_t> A_1x16(16, 0.0);
+
+#ifdef _WIN32
+    std::vector<scalar_t> zeros_16(16, 0.0);
+    A_1x16 = tbb::parallel_reduce(
+            tbb::blocked_range<int>(0, n), zeros_16,
+            [&](tbb::blocked_range<int> r, std::vector<scalar_t> A_reduction) {
                 for (int workload_idx = r.begin(); workload_idx < r.end();
-                     workload_idx++) {
-                    if (correspondence_indices[workload_idx] != -1) {
-                        for (int i = 0; i < 9; ++i) {
-                            const int row = i % 3;
-                            const int col = i / 3;
-                            const int source_idx = 3 * workload_idx + row;
-                            const int target_idx =
-                                    3 * correspondence_indices[workload_idx] +
-                                    col;
-                            sxy_1x9_reduction[i] +=
-                                    (source_points_ptr[source_idx] -
-                                     mean_1x7[row]) *
-                                    (target_points_ptr[target_idx] -
-                                     mean_1x7[3 + col]);
-                        }
-                    }
+                     ++workload_idx) {
+                    GetPointToPointSums<scalar_t>(
+                            workload_idx, source_points_ptr, target_points_ptr,
+                            correspondence_indices, source_points_ptr,
+                            A_reduction.data());
                 }
-                return sxy_1x9_reduction;
+                return A_reduction;
             },
             // TBB: Defining reduction operation.
             [&](std::vector<scalar_t> a, std::vector<scalar_t> b) {
-                std::vector<scalar_t> result(9);
-                for (int j = 0; j < 9; ++j) {
+                std::vector<scalar_t> result(16);
+                for (int j = 0; j < 16; ++j) {
                     result[j] = a[j] + b[j];
                 }
                 return result;
             });
-
-    source_mean = core::Tensor::Empty({1, 3}, dtype, device);
-    scalar_t *source_mean_ptr = source_mean.GetDataPtr<scalar_t>();
-
-    target_mean = core::Tensor::Empty({1, 3}, dtype, device);
-    scalar_t *target_mean_ptr = target_mean.GetDataPtr<scalar_t>();
-
-    Sxy = core::Tensor::Empty({3, 3}, dtype, device);
-    scalar_t *sxy_ptr = Sxy.GetDataPtr<scalar_t>();
-
-    // Getting Tensor Sxy {3,3}, source_mean {3,1} and target_mean {3} from
-    // temporary reduction variables. The shapes of source_mean and target_mean
-    // are such, because it will be required in equation: t = source_mean -
-    // R.Matmul(target_mean.T()).Reshape({-1}).
-    int i = 0;
-    for (int j = 0; j < 3; ++j) {
-        for (int k = 0; k < 3; ++k) {
-            sxy_ptr[j * 3 + k] = sxy_1x9[i] / mean_1x7[6];
-            ++i;
-        }
-        source_mean_ptr[j] = mean_1x7[j];
-        target_mean_ptr[j] = mean_1x7[j + 3];
+#else
+    scalar_t *A_reduction = A_1x16.data();
+#pragma omp parallel for reduction(+ : A_reduction[:16]) schedule(static) num_threads(utility::EstimateMaxThreads())
+    for (int workload_idx = 0; workload_idx < n; workload_idx++) {
+        GetPointToPointSums<scalar_t>(workload_idx, source_points_ptr,
+                                      target_points_ptr, correspondence_indices,
+                                      source_points_ptr, A_reduction);
     }
+#endif
 
-    inlier_count = static_cast<int64_t>(mean_1x7[6]);
+    for (int i = 0; i < 16; ++i) {
+        global_sum[i] = A_1x16[i];
+    }
 }
 
 void ComputeRtPointToPointCPU(const core::Tensor &source_points,
                               const core::Tensor &target_points,
-                              const core::Tensor &corres,
-                              core::Tensor &R,
-                              core::Tensor &t,
-                              int &inlier_count,
+                              const core::Tensor &correspondence_indices,
+                              core::Tensor &global_sum,
                               const core::Dtype &dtype,
                               const core::Device &device) {
-    core::Tensor Sxy, target_mean, source_mean;
-
-    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(dtype, [&]() {
-        const scalar_t *source_points_ptr =
-                source_points.GetDataPtr<scalar_t>();
-        const scalar_t *target_points_ptr =
-                target_points.GetDataPtr<scalar_t>();
-        const int64_t *correspondence_indices = corres.GetDataPtr<int64_t>();
+    int n = source_points.GetLength();
 
-        int n = source_points.GetLength();
+    global_sum = core::Tensor::Zeros({16}, dtype, device);
 
-        Get3x3SxyLinearSystem(source_points_ptr, target_points_ptr,
-                              correspondence_indices, n, dtype, device, Sxy,
-                              target_mean, source_mean, inlier_count);
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(dtype, [&]() {
+        ComputeRtPointToPointKernelCPU<scalar_t>(
+                source_points.GetDataPtr<scalar_t>(),
+                target_points.GetDataPtr<scalar_t>(),
+                correspondence_indices.GetDataPtr<int64_t>(), n,
+                global_sum.GetDataPtr<scalar_t>());
     });
-
-    core::Tensor U, D, VT;
-    std::tie(U, D, VT) = Sxy.SVD();
-    core::Tensor S = core::Tensor::Eye(3, dtype, device);
-    if (U.Det() * (VT.T()).Det() < 0) {
-        S[-1][-1] = -1;
-    }
-
-    R = U.Matmul(S.Matmul(VT));
-    t = (target_mean.Reshape({-1}) - R.Matmul(source_mean.T()).Reshape({-1}))
-                .To(dtype);
 }
 
 template <typename scalar_t>
-void ComputeInformationMatrixKernelCPU(const scalar_t *target_points_ptr,
-                                       const int64_t *correspondence_indices,
-                                       const int n,
-                                       scalar_t *global_sum) {
+OPEN3D_TARGET_CLONES void ComputeInformationMatrixKernelCPU(
+        const scalar_t *target_points_ptr,
+        const int64_t *correspondence_indices,
+        const int n,
+        scalar_t *global_sum) {
     // As, AtA is a symmetric matrix, we only need 21 elements instead of 36.
     std::vector<scalar_t> AtA(21, 0.0);
 
@@ -26,6 +26,8 @@
 
 #include <cuda.h>
 
+#include <algorithm>
+
 #include "open3d/core/CUDAUtils.h"
 #include "open3d/core/ParallelFor.h"
 #include "open3d/core/Tensor.h"
@@ -125,7 +127,212 @@ void ComputePosePointToPlaneCUDA(const core::Tensor &source_points,
                 });
     });
 
-    core::cuda::Synchronize();
+    core::cuda::SynchronizeStream();
+
+    DecodeAndSolve6x6(global_sum, pose, residual, inlier_count);
+}
+
+template <typename scalar_t, typename func_t>
+__global__ void ComputePosePointToPlaneBatchedKernelCUDA(
+        const scalar_t *source_points_ptr,
+        const scalar_t *target_points_ptr,
+        const scalar_t *target_normals_ptr,
+        const int64_t *correspondence_indices,
+        const int64_t *source_row_splits,
+        const int64_t pair_offset,
+        scalar_t *global_sums,
+        func_t GetWeightFromRobustKernel) {
+    __shared__ scalar_t local_sum0[kThread1DUnit];
+    __shared__ scalar_t local_sum1[kThread1DUnit];
+    __shared__ scalar_t local_sum2[kThread1DUnit];
+
+    const int tid = threadIdx.x;
+
+    // Each row of blocks reduces one pair into its own A_1x29 row.
+    const int64_t pair_idx = pair_offset + blockIdx.y;
+    const int64_t block_begin = source_row_splits[pair_idx] +
+                                static_cast<int64_t>(blockIdx.x) * blockDim.x;
+    const int64_t end = source_row_splits[pair_idx + 1];
+
+    // The whole block is past the end of the pair.
+    if (block_begin >= end) return;
+
+    local_sum0[tid] = 0;
+    local_sum1[tid] = 0;
+    local_sum2[tid] = 0;
+
+    const int64_t workload_idx = block_begin + tid;
+
+    scalar_t J_ij[6] = {0}, reduction[29] = {0};
+    scalar_t r = 0;
+
+    bool valid = workload_idx < end &&
+                 GetJacobianPointToPlane<scalar_t>(
+                         workload_idx, source_points_ptr, target_points_ptr,
+                         target_normals_ptr, correspondence_indices, J_ij, r);
+
+    scalar_t w = GetWeightFromRobustKernel(r);
+
+    if (valid) {
+        // Dump J, r into JtJ and Jtr
+        int i = 0;
+        for (int j = 0; j < 6; ++j) {
+            for (int k = 0; k <= j; ++k) {
+                reduction[i] += J_ij[j] * w * J_ij[k];
+                ++i;
+            }
+            reduction[21 + j] += J_ij[j] * w * r;
+        }
+        reduction[27] += GetSquaredDistanceOfCorrespondence<scalar_t>(
+                workload_idx, source_points_ptr, target_points_ptr,
+                correspondence_indices);
+        reduction[28] += 1;
+    }
+
+    ReduceSum6x6LinearSystem<scalar_t, kThread1DUnit>(
+            tid, valid, reduction, local_sum0, local_sum1, local_sum2,
+            global_sums + 29 * pair_idx);
+}
+
+void ComputePosePointToPlaneBatchedCUDA(
+        const core::Tensor &source_points,
+        const core::Tensor &target_points,
+        const core::Tensor &target_normals,
+        const core::Tensor &correspondence_indices,
+        const core::Tensor &source_row_splits,
+        core::Tensor &global_sums,
+        const core::Dtype &dtype,
+        const core::Device &device,
+        const registration::RobustKernel &kernel) {
+    const int64_t num_pairs = source_row_splits.GetLength() - 1;
+
+    global_sums = core::Tensor::Zeros({num_pairs, 29}, dtype, device);
+
+    // The grid spans the largest pair along x and the pairs along y.
+    const int64_t *row_splits_ptr = source_row_splits.GetDataPtr<int64_t>();
+    int64_t max_pair_length = 1;
+    for (int64_t i = 0; i < num_pairs; ++i) {
+        max_pair_length = std::max(max_pair_length,
+                                   row_splits_ptr[i + 1] - row_splits_ptr[i]);
+    }
+    const core::Tensor source_row_splits_device = source_row_splits.To(device);
+    const unsigned int blocks_per_pair = static_cast<unsigned int>(
+            (max_pair_length + kThread1DUnit - 1) / kThread1DUnit);
+    const int64_t kMaxGridDimY = 65535;
+    const dim3 threads(kThread1DUnit);
+
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(dtype, [&]() {
+        scalar_t *global_sums_ptr = global_sums.GetDataPtr<scalar_t>();
+
+        DISPATCH_ROBUST_KERNEL_FUNCTION(
+                kernel.type_, scalar_t, kernel.scaling_parameter_,
+                kernel.shape_parameter_, [&]() {
+                    for (int64_t pair_offset = 0; pair_offset < num_pairs;
+                         pair_offset += kMaxGridDimY) {
+                        const int64_t num_pairs_launch =
+                                std::min(kMaxGridDimY, num_pairs - pair_offset);
+                        const dim3 blocks(
+                                blocks_per_pair,
+                                static_cast<unsigned int>(num_pairs_launch));
+                        ComputePosePointToPlaneBatchedKernelCUDA<<<
+                                blocks, threads, 0, core::cuda::GetStream()>>>(
+                                source_points.GetDataPtr<scalar_t>(),
+                                target_points.GetDataPtr<scalar_t>(),
+                                target_normals.GetDataPtr<scalar_t>(),
+                                correspondence_indices.GetDataPtr<int64_t>(),
+                                source_row_splits_device.GetDataPtr<int64_t>(),
+                                pair_offset, global_sums_ptr,
+                                GetWeightFromRobustKernel);
+                    }
+                });
+    });
+
+    core::cuda::SynchronizeStream();
+}
+
+template <typename scalar_t, typename func_t>
+__global__ void ComputePoseFastGlobalRegistrationKernelCUDA(
+        const scalar_t *source_points_ptr,
+        const scalar_t *target_points_ptr,
+        const int64_t *correspondences,
+        const int n,
+        scalar_t *global_sum,
+        func_t GetWeightFromRobustKernel) {
+    __shared__ scalar_t local_sum0[kThread1DUnit];
+    __shared__ scalar_t local_sum1[kThread1DUnit];
+    __shared__ scalar_t local_sum2[kThread1DUnit];
+
+    const int tid = threadIdx.x;
+
+    local_sum0[tid] = 0;
+    local_sum1[tid] = 0;
+    local_sum2[tid] = 0;
+
+    const int workload_idx = threadIdx.x + blockIdx.x * blockDim.x;
+
+    if (workload_idx >= n) return;
+
+    scalar_t J_x[6] = {0}, J_y[6] = {0}, J_z[6] = {0}, reduction[29] = {0};
+    scalar_t r[3] = {0};
+
+    GetJacobianPointToPoint<scalar_t>(workload_idx, source_points_ptr,
+                                      target_points_ptr, correspondences, J_x,
+                                      J_y, J_z, r);
+
+    const scalar_t r2 = r[0] * r[0] + r[1] * r[1] + r[2] * r[2];
+    scalar_t w = GetWeightFromRobustKernel(sqrt(r2));
+
+    // Dump J, r into JtJ and Jtr
+    int i = 0;
+    for (int j = 0; j < 6; ++j) {
+        for (int k = 0; k <= j; ++k) {
+            reduction[i] += w * (J_x[j] * J_x[k] + J_y[j] * J_y[k] +
+                                 J_z[j] * J_z[k]);
+            ++i;
+        }
+        reduction[21 + j] +=
+                w * (J_x[j] * r[0] + J_y[j] * r[1] + J_z[j] * r[2]);
+    }
+    reduction[27] += r2;
+    reduction[28] += 1;
+
+    ReduceSum6x6LinearSystem<scalar_t, kThread1DUnit>(tid, true, reduction,
+                                                      local_sum0, local_sum1,
+                                                      local_sum2, global_sum);
+}
+
+void ComputePoseFastGlobalRegistrationCUDA(
+        const core::Tensor &source_points,
+        const core::Tensor &target_points,
+        const core::Tensor &correspondences,
+        core::Tensor &pose,
+        float &residual,
+        int &inlier_count,
+        const core::Dtype &dtype,
+        const core::Device &device,
+        const registration::RobustKernel &kernel) {
+    int n = correspondences.GetLength();
+
+    core::Tensor global_sum = core::Tensor::Zeros({29}, dtype, device);
+    const dim3 blocks((n + kThread1DUnit - 1) / kThread1DUnit);
+    const dim3 threads(kThread1DUnit);
+
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(dtype, [&]() {
+        scalar_t *global_sum_ptr = global_sum.GetDataPtr<scalar_t>();
+
+        DISPATCH_ROBUST_KERNEL_FUNCTION(
+                kernel.type_, scalar_t, kernel.scaling_parameter_,
+                kernel.shape_parameter_, [&]() {
+                    ComputePoseFastGlobalRegistrationKernelCUDA<<<
+                            blocks, threads, 0, core::cuda::GetStream()>>>(
+                            source_points.GetDataPtr<scalar_t>(),
+                            target_points.GetDataPtr<scalar_t>(),
+                            correspondences.GetDataPtr<int64_t>(), n,
+                            global_sum_ptr, GetWeightFromRobustKernel);
+                });
+    });
+
+    core::cuda::SynchronizeStream();
 
     DecodeAndSolve6x6(global_sum, pose, residual, inlier_count);
 }
@@ -233,11 +440,199 @@ void ComputePoseColoredICPCUDA(const core::Tensor &source_points,
                 });
     });
 
-    core::cuda::Synchronize();
+    core::cuda::SynchronizeStream();
 
     DecodeAndSolve6x6(global_sum, pose, residual, inlier_count);
 }
 
+template <typename scalar_t, typename funct_t>
+__global__ void ComputePoseGeneralizedICPKernelCUDA(
+        const scalar_t *source_points_ptr,
+        const scalar_t *source_covariances_ptr,
+        const scalar_t *source_colors_ptr,
+        const scalar_t *target_points_ptr,
+        const scalar_t *target_covariances_ptr,
+        const scalar_t *target_normals_ptr,
+        const scalar_t *target_colors_ptr,
+        const scalar_t *target_color_gradients_ptr,
+        const int64_t *correspondence_indices,
+        const scalar_t lambda_geometric,
+        const scalar_t sqrt_lambda_photometric,
+        const int n,
+        scalar_t *global_sum,
+        funct_t GetWeightFromRobustKernel) {
+    __shared__ scalar_t local_sum0[kThread1DUnit];
+    __shared__ scalar_t local_sum1[kThread1DUnit];
+    __shared__ scalar_t local_sum2[kThread1DUnit];
+
+    const int tid = threadIdx.x;
+
+    local_sum0[tid] = 0;
+    local_sum1[tid] = 0;
+    local_sum2[tid] = 0;
+
+    const int workload_idx = threadIdx.x + blockIdx.x * blockDim.x;
+
+    if (workload_idx >= n) return;
+
+    scalar_t J_x[6] = {0}, J_y[6] = {0}, J_z[6] = {0}, reduction[29] = {0};
+    scalar_t r[3] = {0};
+
+    bool valid = GetJacobianGeneralizedICP<scalar_t>(
+            workload_idx, source_points_ptr, source_covariances_ptr,
+            target_points_ptr, target_covariances_ptr, correspondence_indices,
+            J_x, J_y, J_z, r);
+
+    if (valid) {
+        const scalar_t r2 = r[0] * r[0] + r[1] * r[1] + r[2] * r[2];
+        scalar_t w = lambda_geometric * GetWeightFromRobustKernel(sqrt(r2));
+
+        // The photometric term of Colored-ICP on the same correspondence.
+        scalar_t J_G[6] = {0}, J_I[6] = {0};
+        scalar_t r_G = 0, r_I = 0, w_I = 0;
+        if (source_colors_ptr != nullptr) {
+            GetJacobianColoredICP<scalar_t>(
+                    workload_idx, source_points_ptr, source_colors_ptr,
+                    target_points_ptr, target_normals_ptr, target_colors_ptr,
+                    target_color_gradients_ptr, correspondence_indices, 0,
+                    sqrt_lambda_photometric, J_G, J_I, r_G, r_I);
+            w_I = GetWeightFromRobustKernel(r_I);
+        }
+
+        // Dump J, r into JtJ and Jtr
+        int i = 0;
+        for (int j = 0; j < 6; ++j) {
+            for (int k = 0; k <= j; ++k) {
+                reduction[i] += w * (J_x[j] * J_x[k] + J_y[j] * J_y[k] +
+                                     J_z[j] * J_z[k]) +
+                                J_I[j] * w_I * J_I[k];
+                ++i;
+            }
+            reduction[21 + j] +=
+                    w * (J_x[j] * r[0] + J_y[j] * r[1] + J_z[j] * r[2]) +
+                    J_I[j] * w_I * r_I;
+        }
+        reduction[27] += lambda_geometric * r2 + r_I * r_I;
+        reduction[28] += 1;
+    }
+
+    ReduceSum6x6LinearSystem<scalar_t, kThread1DUnit>(tid, valid, reduction,
+                                                      local_sum0, local_sum1,
+                                                      local_sum2, global_sum);
+}
+
+void ComputePoseGeneralizedICPCUDA(const core::Tensor &source_points,
+                                   const core::Tensor &source_covariances,
+                                   const core::Tensor &source_colors,
+                                   const core::Tensor &target_points,
+                                   const core::Tensor &target_covariances,
+                                   const core::Tensor &target_normals,
+                                   const core::Tensor &target_colors,
+                                   const core::Tensor &target_color_gradients,
+                                   const core::Tensor &correspondence_indices,
+                                   core::Tensor &pose,
+                                   float &residual,
+                                   int &inlier_count,
+                                   const core::Dtype &dtype,
+                                   const core::Device &device,
+                                   const registration::RobustKernel &kernel,
+                                   const double &lambda_geometric) {
+    int n = source_points.GetLength();
+
+    core::Tensor global_sum = core::Tensor::Zeros({29}, dtype, device);
+    const dim3 blocks((n + kThread1DUnit - 1) / kThread1DUnit);
+    const dim3 threads(kThread1DUnit);
+    const bool has_photometric_term = lambda_geometric < 1.0;
+
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(dtype, [&]() {
+        scalar_t lambda_geometric_t = static_cast<scalar_t>(lambda_geometric);
+        scalar_t sqrt_lambda_photometric =
+                static_cast<scalar_t>(sqrt(1.0 - lambda_geometric));
+        auto get_ptr = [&](const core::Tensor &tensor) -> const scalar_t * {
+            return has_photometric_term ? tensor.GetDataPtr<scalar_t>()
+                                        : nullptr;
+        };
+
+        DISPATCH_ROBUST_KERNEL_FUNCTION(
+                kernel.type_, scalar_t, kernel.scaling_parameter_,
+                kernel.shape_parameter_, [&]() {
+                    ComputePoseGeneralizedICPKernelCUDA<<<
+                            blocks, threads, 0, core::cuda::GetStream()>>>(
+                            source_points.GetDataPtr<scalar_t>(),
+                            source_covariances.GetDataPtr<scalar_t>(),
+                            get_ptr(source_colors),
+                            target_points.GetDataPtr<scalar_t>(),
+                            target_covariances.GetDataPtr<scalar_t>(),
+                            get_ptr(target_normals), get_ptr(target_colors),
+                            get_ptr(target_color_gradients),
+                            correspondence_indices.GetDataPtr<int64_t>(),
+                            lambda_geometric_t, sqrt_lambda_photometric, n,
+                            global_sum.GetDataPtr<scalar_t>(),
+                            GetWeightFromRobustKernel);
+                });
+    });
+
+    core::cuda::SynchronizeStream();
+
+    DecodeAndSolve6x6(global_sum, pose, residual, inlier_count);
+}
+
+template <typename scalar_t>
+__global__ void ComputeRtPointToPointKernelCUDA(
+        const scalar_t *source_points_ptr,
+        const scalar_t *target_points_ptr,
+        const int64_t *correspondence_indices,
+        const int n,
+        scalar_t *global_sum) {
+    __shared__ scalar_t local_sum0[kThread1DUnit];
+    __shared__ scalar_t local_sum1[kThread1DUnit];
+    __shared__ scalar_t local_sum2[kThread1DUnit];
+
+    const int tid = threadIdx.x;
+
+    local_sum0[tid] = 0;
+    local_sum1[tid] = 0;
+    local_sum2[tid] = 0;
+
+    const int workload_idx = threadIdx.x + blockIdx.x * blockDim.x;
+
+    // Out-of-range threads take part in the block reduction with zeros.
+    scalar_t reduction[16] = {0};
+    const bool valid = workload_idx < n &&
+                       GetPointToPointSums<scalar_t>(
+                               workload_idx, source_points_ptr,
+                               target_points_ptr, correspondence_indices,
+                               source_points_ptr, reduction);
+
+    ReduceSumPointToPoint<scalar_t, kThread1DUnit>(tid, valid, reduction,
+                                                   local_sum0, local_sum1,
+                                                   local_sum2, global_sum);
+}
+
+void ComputeRtPointToPointCUDA(const core::Tensor &source_points,
+                               const core::Tensor &target_points,
+                               const core::Tensor &correspondence_indices,
+                               core::Tensor &global_sum,
+                               const core::Dtype &dtype,
+                               const core::Device &device) {
+    int n = source_points.GetLength();
+
+    global_sum = core::Tensor::Zeros({16}, dtype, device);
+    const dim3 blocks((n + kThread1DUnit - 1) / kThread1DUnit);
+    const dim3 threads(kThread1DUnit);
+
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(dtype, [&]() {
+        ComputeRtPointToPointKernelCUDA<<<blocks, threads, 0,
+                                          core::cuda::GetStream()>>>(
+                source_points.GetDataPtr<scalar_t>(),
+                target_points.GetDataPtr<scalar_t>(),
+                correspondence_indices.GetDataPtr<int64_t>(), n,
+                global_sum.GetDataPtr<scalar_t>());
+    });
+
+    core::cuda::SynchronizeStream();
+}
+
 template <typename scalar_t>
 __global__ void ComputeInformationMatrixKernelCUDA(
         const scalar_t *target_points_ptr,
@@ -300,7 +695,7 @@ void ComputeInformationMatrixCUDA(const core::Tensor &target_points,
                 correspondence_indices.GetDataPtr<int64_t>(), n,
                 global_sum_ptr);
 
-        core::cuda::Synchronize();
+        core::cuda::SynchronizeStream();
 
         core::Tensor global_sum_cpu =
                 global_sum.To(core::Device("CPU:0"), core::Float64);
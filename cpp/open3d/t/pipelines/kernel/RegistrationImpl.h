@@ -48,6 +48,17 @@ void ComputePosePointToPlaneCPU(const core::Tensor &source_points,
                                 const core::Device &device,
                                 const registration::RobustKernel &kernel);
 
+void ComputePosePointToPlaneBatchedCPU(
+        const core::Tensor &source_points,
+        const core::Tensor &target_points,
+        const core::Tensor &target_normals,
+        const core::Tensor &correspondence_indices,
+        const core::Tensor &source_row_splits,
+        core::Tensor &global_sums,
+        const core::Dtype &dtype,
+        const core::Device &device,
+        const registration::RobustKernel &kernel);
+
 void ComputePoseColoredICPCPU(const core::Tensor &source_points,
                               const core::Tensor &source_colors,
                               const core::Tensor &target_points,
@@ -63,6 +74,24 @@ void ComputePoseColoredICPCPU(const core::Tensor &source_points,
                               const registration::RobustKernel &kernel,
                               const double &lambda_geometric);
 
+void ComputePoseGeneralizedICPCPU(
+        const core::Tensor &source_points,
+        const core::Tensor &source_covariances,
+        const core::Tensor &source_colors,
+        const core::Tensor &target_points,
+        const core::Tensor &target_covariances,
+        const core::Tensor &target_normals,
+        const core::Tensor &target_colors,
+        const core::Tensor &target_color_gradients,
+        const core::Tensor &correspondence_indices,
+        core::Tensor &pose,
+        float &residual,
+        int &inlier_count,
+        const core::Dtype &dtype,
+        const core::Device &device,
+        const registration::RobustKernel &kernel,
+        const double &lambda_geometric);
+
 #ifdef BUILD_CUDA_MODULE
 void ComputePosePointToPlaneCUDA(const core::Tensor &source_points,
                                  const core::Tensor &target_points,
@@ -75,6 +104,17 @@ void ComputePosePointToPlaneCUDA(const core::Tensor &source_points,
                                  const core::Device &device,
                                  const registration::RobustKernel &kernel);
 
+void ComputePosePointToPlaneBatchedCUDA(
+        const core::Tensor &source_points,
+        const core::Tensor &target_points,
+        const core::Tensor &target_normals,
+        const core::Tensor &correspondence_indices,
+        const core::Tensor &source_row_splits,
+        core::Tensor &global_sums,
+        const core::Dtype &dtype,
+        const core::Device &device,
+        const registration::RobustKernel &kernel);
+
 void ComputePoseColoredICPCUDA(const core::Tensor &source_points,
                                const core::Tensor &source_colors,
                                const core::Tensor &target_points,
@@ -89,17 +129,68 @@ void ComputePoseColoredICPCUDA(const core::Tensor &source_points,
                                const core::Device &device,
                                const registration::RobustKernel &kernel,
                                const double &lambda_geometric);
+
+void ComputePoseGeneralizedICPCUDA(
+        const core::Tensor &source_points,
+        const core::Tensor &source_covariances,
+        const core::Tensor &source_colors,
+        const core::Tensor &target_points,
+        const core::Tensor &target_covariances,
+        const core::Tensor &target_normals,
+        const core::Tensor &target_colors,
+        const core::Tensor &target_color_gradients,
+        const core::Tensor &correspondence_indices,
+        core::Tensor &pose,
+        float &residual,
+        int &inlier_count,
+        const core::Dtype &dtype,
+        const core::Device &device,
+        const registration::RobustKernel &kernel,
+        const double &lambda_geometric);
 #endif
 
+void ComputePoseFastGlobalRegistrationCPU(
+        const core::Tensor &source_points,
+        const core::Tensor &target_points,
+        const core::Tensor &correspondences,
+        core::Tensor &pose,
+        float &residual,
+        int &inlier_count,
+        const core::Dtype &dtype,
+        const core::Device &device,
+        const registration::RobustKernel &kernel);
+
+#ifdef BUILD_CUDA_MODULE
+void ComputePoseFastGlobalRegistrationCUDA(
+        const core::Tensor &source_points,
+        const core::Tensor &target_points,
+        const core::Tensor &correspondences,
+        core::Tensor &pose,
+        float &residual,
+        int &inlier_count,
+        const core::Dtype &dtype,
+        const core::Device &device,
+        const registration::RobustKernel &kernel);
+#endif
+
+/// Reduces the {16} sums of GetPointToPointSums over all correspondences
+/// into \p global_sum, relative to the first source point.
 void ComputeRtPointToPointCPU(const core::Tensor &source_points,
                               const core::Tensor &target_points,
                               const core::Tensor &correspondence_indices,
-                              core::Tensor &R,
-                              core::Tensor &t,
-                              int &inlier_count,
+                              core::Tensor &global_sum,
                               const core::Dtype &dtype,
                               const core::Device &device);
 
+#ifdef BUILD_CUDA_MODULE
+void ComputeRtPointToPointCUDA(const core::Tensor &source_points,
+                               const core::Tensor &target_points,
+                               const core::Tensor &correspondence_indices,
+                               core::Tensor &global_sum,
+                               const core::Dtype &dtype,
+                               const core::Device &device);
+#endif
+
 void ComputeInformationMatrixCPU(const core::Tensor &target_points,
                                  const core::Tensor &correspondence_indices,
                                  core::Tensor &information_matrix,
@@ -114,6 +205,24 @@ void ComputeInformationMatrixCUDA(const core::Tensor &target_points,
                                   const core::Device &device);
 #endif
 
+template <typename scalar_t>
+OPEN3D_HOST_DEVICE inline scalar_t GetSquaredDistanceOfCorrespondence(
+        int64_t workload_idx,
+        const scalar_t *source_points_ptr,
+        const scalar_t *target_points_ptr,
+        const int64_t *correspondence_indices) {
+    const int64_t target_idx = 3 * correspondence_indices[workload_idx];
+    const int64_t source_idx = 3 * workload_idx;
+
+    const scalar_t dx = source_points_ptr[source_idx + 0] -
+                        target_points_ptr[target_idx + 0];
+    const scalar_t dy = source_points_ptr[source_idx + 1] -
+                        target_points_ptr[target_idx + 1];
+    const scalar_t dz = source_points_ptr[source_idx + 2] -
+                        target_points_ptr[target_idx + 2];
+    return dx * dx + dy * dy + dz * dz;
+}
+
 template <typename scalar_t>
 OPEN3D_HOST_DEVICE inline bool GetJacobianPointToPlane(
         int64_t workload_idx,
@@ -168,6 +277,119 @@ template bool GetJacobianPointToPlane(int64_t workload_idx,
                                       double *J_ij,
                                       double &r);
 
+template <typename scalar_t>
+OPEN3D_HOST_DEVICE inline void GetJacobianPointToPoint(
+        int64_t workload_idx,
+        const scalar_t *source_points_ptr,
+        const scalar_t *target_points_ptr,
+        const int64_t *correspondences,
+        scalar_t *J_x,
+        scalar_t *J_y,
+        scalar_t *J_z,
+        scalar_t *r) {
+    const int64_t source_idx = 3 * correspondences[2 * workload_idx];
+    const int64_t target_idx = 3 * correspondences[2 * workload_idx + 1];
+
+    const scalar_t &sx = source_points_ptr[source_idx + 0];
+    const scalar_t &sy = source_points_ptr[source_idx + 1];
+    const scalar_t &sz = source_points_ptr[source_idx + 2];
+
+    r[0] = sx - target_points_ptr[target_idx + 0];
+    r[1] = sy - target_points_ptr[target_idx + 1];
+    r[2] = sz - target_points_ptr[target_idx + 2];
+
+    J_x[0] = 0;
+    J_x[1] = sz;
+    J_x[2] = -sy;
+    J_x[3] = 1;
+    J_x[4] = 0;
+    J_x[5] = 0;
+
+    J_y[0] = -sz;
+    J_y[1] = 0;
+    J_y[2] = sx;
+    J_y[3] = 0;
+    J_y[4] = 1;
+    J_y[5] = 0;
+
+    J_z[0] = sy;
+    J_z[1] = -sx;
+    J_z[2] = 0;
+    J_z[3] = 0;
+    J_z[4] = 0;
+    J_z[5] = 1;
+}
+
+template void GetJacobianPointToPoint(int64_t workload_idx,
+                                      const float *source_points_ptr,
+                                      const float *target_points_ptr,
+                                      const int64_t *correspondences,
+                                      float *J_x,
+                                      float *J_y,
+                                      float *J_z,
+                                      float *r);
+
+template void GetJacobianPointToPoint(int64_t workload_idx,
+                                      const double *source_points_ptr,
+                                      const double *target_points_ptr,
+                                      const int64_t *correspondences,
+                                      double *J_x,
+                                      double *J_y,
+                                      double *J_z,
+                                      double *r);
+
+/// Accumulates the correspondence of source point \p workload_idx into the
+/// 16 sums of \p reduction: source position (3), target position (3), the
+/// row-major outer product t sᵀ (9) and the count (1). Positions are taken
+/// relative to \p origin to limit cancellation in the single pass for clouds
+/// far from the coordinate origin. Returns false if there is no
+/// correspondence.
+template <typename scalar_t>
+OPEN3D_HOST_DEVICE inline bool GetPointToPointSums(
+        int64_t workload_idx,
+        const scalar_t *source_points_ptr,
+        const scalar_t *target_points_ptr,
+        const int64_t *correspondence_indices,
+        const scalar_t *origin,
+        scalar_t *reduction) {
+    if (correspondence_indices[workload_idx] == -1) {
+        return false;
+    }
+
+    const int64_t target_idx = 3 * correspondence_indices[workload_idx];
+    const int64_t source_idx = 3 * workload_idx;
+
+    scalar_t s[3], t[3];
+    for (int j = 0; j < 3; ++j) {
+        s[j] = source_points_ptr[source_idx + j] - origin[j];
+        t[j] = target_points_ptr[target_idx + j] - origin[j];
+        reduction[j] += s[j];
+        reduction[3 + j] += t[j];
+    }
+    for (int j = 0; j < 3; ++j) {
+        for (int k = 0; k < 3; ++k) {
+            reduction[6 + 3 * j + k] += t[j] * s[k];
+        }
+    }
+    reduction[15] += 1;
+
+    return true;
+}
+
+template bool GetPointToPointSums(int64_t workload_idx,
+                                  const float *source_points_ptr,
+                                  const float *target_points_ptr,
+                                  const int64_t *correspondence_indices,
+                                  const float *origin,
+                                  float *reduction);
+
+template bool GetPointToPointSums(int64_t workload_idx,
+                                  const double *source_points_ptr,
+                                  const double *target_points_ptr,
+                                  const int64_t *correspondence_indices,
+                                  const double *origin,
+                                  double *reduction);
+
 template <typename scalar_t>
 OPEN3D_HOST_DEVICE inline bool GetJacobianColoredICP(
         const int64_t workload_idx,
@@ -280,6 +502,93 @@ template bool GetJacobianColoredICP(const int64_t workload_idx,
                                     double &r_G,
                                     double &r_I);
 
+/// Computes the rows of the point to point Jacobian and the residual of a
+/// correspondence, whitened by the Cholesky factor L of the combined covariance
+/// M = L * L^T of generalized-icp, so that the squared norm of the whitened
+/// residual is the squared Mahalanobis distance r^T * M^-1 * r. Returns false
+/// for correspondences without a target or with a degenerate covariance.
+template <typename scalar_t>
+OPEN3D_HOST_DEVICE inline bool GetJacobianGeneralizedICP(
+        const int64_t workload_idx,
+        const scalar_t *source_points_ptr,
+        const scalar_t *source_covariances_ptr,
+        const scalar_t *target_points_ptr,
+        const scalar_t *target_covariances_ptr,
+        const int64_t *correspondence_indices,
+        scalar_t *J_x,
+        scalar_t *J_y,
+        scalar_t *J_z,
+        scalar_t *r) {
+    if (correspondence_indices[workload_idx] == -1) {
+        return false;
+    }
+
+    const int64_t target_idx = correspondence_indices[workload_idx];
+    const scalar_t *vs = source_points_ptr + 3 * workload_idx;
+    const scalar_t *vt = target_points_ptr + 3 * target_idx;
+    const scalar_t *Cs = source_covariances_ptr + 9 * workload_idx;
+    const scalar_t *Ct = target_covariances_ptr + 9 * target_idx;
+
+    // Cholesky factorization of the symmetric M = Cs + Ct.
+    const scalar_t l00_sq = Cs[0] + Ct[0];
+    if (!(l00_sq > 0)) {
+        return false;
+    }
+    const scalar_t l00 = sqrt(l00_sq);
+    const scalar_t l10 = (Cs[3] + Ct[3]) / l00;
+    const scalar_t l20 = (Cs[6] + Ct[6]) / l00;
+    const scalar_t l11_sq = Cs[4] + Ct[4] - l10 * l10;
+    if (!(l11_sq > 0)) {
+        return false;
+    }
+    const scalar_t l11 = sqrt(l11_sq);
+    const scalar_t l21 = (Cs[7] + Ct[7] - l20 * l10) / l11;
+    const scalar_t l22_sq = Cs[8] + Ct[8] - l20 * l20 - l21 * l21;
+    if (!(l22_sq > 0)) {
+        return false;
+    }
+    const scalar_t l22 = sqrt(l22_sq);
+
+    // Rows of the Jacobian [-[vs]x, I] of the residual vs - vt.
+    const scalar_t J[3][6] = {{0, vs[2], -vs[1], 1, 0, 0},
+                              {-vs[2], 0, vs[0], 0, 1, 0},
+                              {vs[1], -vs[0], 0, 0, 0, 1}};
+
+    // Whitening by L^-1 with forward substitution.
+    r[0] = (vs[0] - vt[0]) / l00;
+    r[1] = (vs[1] - vt[1] - l10 * r[0]) / l11;
+    r[2] = (vs[2] - vt[2] - l20 * r[0] - l21 * r[1]) / l22;
+    for (int k = 0; k < 6; ++k) {
+        J_x[k] = J[0][k] / l00;
+        J_y[k] = (J[1][k] - l10 * J_x[k]) / l11;
+        J_z[k] = (J[2][k] - l20 * J_x[k] - l21 * J_y[k]) / l22;
+    }
+
+    return true;
+}
+
+template bool GetJacobianGeneralizedICP(const int64_t workload_idx,
+                                        const float *source_points_ptr,
+                                        const float *source_covariances_ptr,
+                                        const float *target_points_ptr,
+                                        const float *target_covariances_ptr,
+                                        const int64_t *correspondence_indices,
+                                        float *J_x,
+                                        float *J_y,
+                                        float *J_z,
+                                        float *r);
+
+template bool GetJacobianGeneralizedICP(const int64_t workload_idx,
+                                        const double *source_points_ptr,
+                                        const double *source_covariances_ptr,
+                                        const double *target_points_ptr,
+                                        const double *target_covariances_ptr,
+                                        const int64_t *correspondence_indices,
+                                        double *J_x,
+                                        double *J_y,
+                                        double *J_z,
+                                        double *r);
+
 template <typename scalar_t>
 OPEN3D_HOST_DEVICE inline bool GetInformationJacobians(
         int64_t workload_idx,
@@ -26,11 +26,14 @@
 
 #include "open3d/t/pipelines/odometry/RGBDOdometry.h"
 
+#include <algorithm>
+
 #include "open3d/t/geometry/PointCloud.h"
 #include "open3d/t/geometry/RGBDImage.h"
 #include "open3d/t/geometry/kernel/Image.h"
 #include "open3d/t/pipelines/kernel/RGBDOdometry.h"
 #include "open3d/t/pipelines/kernel/TransformationConverter.h"
+#include "open3d/utility/Tracing.h"
 #include "open3d/visualization/utility/DrawGeometry.h"
 
 namespace open3d {
@@ -43,35 +46,164 @@ using t::geometry::Image;
 using t::geometry::RGBDImage;
 
 OdometryResult RGBDOdometryMultiScalePointToPlane(
-        const RGBDImage& source,
-        const RGBDImage& target,
-        const Tensor& intrinsics,
+        const RGBDFramePyramid& source,
+        const RGBDFramePyramid& target,
         const Tensor& trans,
-        const float depth_scale,
-        const float depth_max,
         const std::vector<OdometryConvergenceCriteria>& criteria,
         const OdometryLossParams& params);
 
 OdometryResult RGBDOdometryMultiScaleIntensity(
-        const RGBDImage& source,
-        const RGBDImage& target,
-        const Tensor& intrinsic,
+        const RGBDFramePyramid& source,
+        const RGBDFramePyramid& target,
         const Tensor& trans,
-        const float depth_scale,
-        const float depth_max,
         const std::vector<OdometryConvergenceCriteria>& criteria,
         const OdometryLossParams& params);
 
 OdometryResult RGBDOdometryMultiScaleHybrid(
-        const RGBDImage& source,
-        const RGBDImage& target,
-        const Tensor& intrinsics,
+        const RGBDFramePyramid& source,
+        const RGBDFramePyramid& target,
         const Tensor& trans,
-        const float depth_scale,
-        const float depth_max,
         const std::vector<OdometryConvergenceCriteria>& criteria,
         const OdometryLossParams& params);
 
+OdometryWarmStart::OdometryWarmStart(double confident_fitness,
+                                     int64_t num_skipped_levels)
+    : confident_fitness_(confident_fitness),
+      num_skipped_levels_(num_skipped_levels) {
+    if (num_skipped_levels_ < 0) {
+        utility::LogError("Invalid num_skipped_levels {}, must be >= 0.",
+                          num_skipped_levels_);
+    }
+}
+
+Tensor OdometryWarmStart::Predict() const {
+    if (!has_result_) {
+        return Tensor::Eye(4, core::Float64, core::Device("CPU:0"));
+    }
+    // Constant velocity: the next pair moves as the last one did.
+    return last_result_.transformation_.Clone();
+}
+
+Tensor OdometryWarmStart::Predict(const Tensor& rotation_prior) const {
+    core::AssertTensorShape(rotation_prior, {3, 3});
+    Tensor prediction = Predict();
+    prediction.SetItem({core::TensorKey::Slice(0, 3, 1),
+                        core::TensorKey::Slice(0, 3, 1)},
+                       rotation_prior.To(core::Device("CPU:0"), core::Float64));
+    return prediction;
+}
+
+std::vector<OdometryConvergenceCriteria> OdometryWarmStart::GetCriteria(
+        const std::vector<OdometryConvergenceCriteria>& criteria_list) const {
+    std::vector<OdometryConvergenceCriteria> criteria = criteria_list;
+    if (IsConfident()) {
+        const int64_t n_skipped =
+                std::min(num_skipped_levels_, int64_t(criteria.size()) - 1);
+        for (int64_t i = 0; i < n_skipped; ++i) {
+            criteria[i].max_iteration_ = 0;
+        }
+    }
+    return criteria;
+}
+
+bool OdometryWarmStart::IsConfident() const {
+    return has_result_ && last_result_.fitness_ >= confident_fitness_;
+}
+
+void OdometryWarmStart::Update(const OdometryResult& result) {
+    core::AssertTensorShape(result.transformation_, {4, 4});
+    last_result_ = OdometryResult(
+            result.transformation_.To(core::Device("CPU:0"), core::Float64),
+            result.inlier_rmse_, result.fitness_);
+    has_result_ = true;
+}
+
+void OdometryWarmStart::Reset() {
+    last_result_ = OdometryResult();
+    has_result_ = false;
+}
+
+RGBDFramePyramid::RGBDFramePyramid(const RGBDImage& rgbd,
+                                   const Tensor& intrinsics,
+                                   const float depth_scale,
+                                   const float depth_max,
+                                   const int64_t n_levels,
+                                   const Method method,
+                                   const OdometryLossParams& params)
+    : method_(method) {
+    OPEN3D_TRACE_ZONE("RGBDFramePyramid");
+    core::AssertTensorShape(intrinsics, {3, 3});
+    if (n_levels <= 0) {
+        utility::LogError("Invalid n_levels {}, must be > 0.", n_levels);
+    }
+
+    // Intrinsics are always float64 and stay on CPU.
+    const core::Device host("CPU:0");
+    Tensor intrinsics_pyr = intrinsics.To(host, core::Float64).Clone();
+
+    Image depth_curr =
+            rgbd.depth_.ClipTransform(depth_scale, 0, depth_max, NAN);
+    const bool use_intensity = method != Method::PointToPlane;
+    Image intensity_curr;
+    if (use_intensity) {
+        intensity_curr = rgbd.color_.RGBToGray().To(core::Float32);
+    }
+
+    intrinsics_.resize(n_levels);
+    vertex_map_.resize(n_levels);
+    if (method == Method::PointToPlane) {
+        normal_map_.resize(n_levels);
+    } else {
+        depth_.resize(n_levels);
+        intensity_.resize(n_levels);
+        intensity_dx_.resize(n_levels);
+        intensity_dy_.resize(n_levels);
+    }
+    if (method == Method::Hybrid) {
+        depth_dx_.resize(n_levels);
+        depth_dy_.resize(n_levels);
+    }
+
+    // Create image pyramid, from fine to coarse.
+    for (int64_t i = 0; i < n_levels; ++i) {
+        const int64_t level = n_levels - 1 - i;
+        vertex_map_[level] =
+                depth_curr.CreateVertexMap(intrinsics_pyr, NAN).AsTensor();
+        intrinsics_[level] = intrinsics_pyr.Clone();
+
+        if (method == Method::PointToPlane) {
+            Image depth_curr_smooth = depth_curr.FilterBilateral(5, 5, 10);
+            Image vertex_map_smooth =
+                    depth_curr_smooth.CreateVertexMap(intrinsics_pyr, NAN);
+            normal_map_[level] =
+                    vertex_map_smooth.CreateNormalMap(NAN).AsTensor();
+        } else {
+            depth_[level] = depth_curr.AsTensor();
+            intensity_[level] = intensity_curr.AsTensor();
+
+            auto intensity_grad = intensity_curr.FilterSobel();
+            intensity_dx_[level] = intensity_grad.first.AsTensor();
+            intensity_dy_[level] = intensity_grad.second.AsTensor();
+        }
+        if (method == Method::Hybrid) {
+            auto depth_grad = depth_curr.FilterSobel();
+            depth_dx_[level] = depth_grad.first.AsTensor();
+            depth_dy_[level] = depth_grad.second.AsTensor();
+        }
+
+        if (i != n_levels - 1) {
+            depth_curr = depth_curr.PyrDownDepth(
+                    params.depth_outlier_trunc_ * 2, NAN);
+            if (use_intensity) {
+                intensity_curr = intensity_curr.PyrDown();
+            }
+
+            intrinsics_pyr /= 2;
+            intrinsics_pyr[-1][-1] = 1;
+        }
+    }
+}
+
 OdometryResult RGBDOdometryMultiScale(
         const RGBDImage& source,
         const RGBDImage& target,
@@ -86,38 +218,52 @@ OdometryResult RGBDOdometryMultiScale(
     const core::Device device = source.depth_.GetDevice();
     core::AssertTensorDevice(target.depth_.AsTensor(), device);
 
-    core::AssertTensorShape(intrinsics, {3, 3});
+    const int64_t n_levels = int64_t(criteria.size());
+    RGBDFramePyramid source_pyramid(source, intrinsics, depth_scale, depth_max,
+                                    n_levels, method, params);
+    RGBDFramePyramid target_pyramid(target, intrinsics, depth_scale, depth_max,
+                                    n_levels, method, params);
+    return RGBDOdometryMultiScale(source_pyramid, target_pyramid,
+                                  init_source_to_target, criteria, params);
+}
+
+OdometryResult RGBDOdometryMultiScale(
+        const RGBDFramePyramid& source,
+        const RGBDFramePyramid& target,
+        const Tensor& init_source_to_target,
+        const std::vector<OdometryConvergenceCriteria>& criteria,
+        const OdometryLossParams& params) {
+    OPEN3D_TRACE_ZONE("RGBDOdometryMultiScale");
     core::AssertTensorShape(init_source_to_target, {4, 4});
+    if (source.method_ != target.method_) {
+        utility::LogError(
+                "Source and target pyramids are built for different odometry "
+                "methods.");
+    }
+    if (source.GetNumLevels() != int64_t(criteria.size()) ||
+        target.GetNumLevels() != int64_t(criteria.size())) {
+        utility::LogError(
+                "Pyramid levels (source {}, target {}) mismatch with {} "
+                "criteria.",
+                source.GetNumLevels(), target.GetNumLevels(), criteria.size());
+    }
+    core::AssertTensorDevice(target.vertex_map_[0],
+                             source.vertex_map_[0].GetDevice());
 
     // 4x4 transformations are always float64 and stay on CPU.
     const core::Device host("CPU:0");
-    const Tensor intrinsics_d = intrinsics.To(host, core::Float64).Clone();
     const Tensor trans_d =
             init_source_to_target.To(host, core::Float64).Clone();
 
-    Image source_depth = source.depth_;
-    Image target_depth = target.depth_;
-
-    Image source_depth_processed =
-            source_depth.ClipTransform(depth_scale, 0, depth_max, NAN);
-    Image target_depth_processed =
-            target_depth.ClipTransform(depth_scale, 0, depth_max, NAN);
-
-    RGBDImage source_processed(source.color_, source_depth_processed);
-    RGBDImage target_processed(target.color_, target_depth_processed);
-
-    if (method == Method::PointToPlane) {
-        return RGBDOdometryMultiScalePointToPlane(
-                source_processed, target_processed, intrinsics_d, trans_d,
-                depth_scale, depth_max, criteria, params);
-    } else if (method == Method::Intensity) {
-        return RGBDOdometryMultiScaleIntensity(
-                source_processed, target_processed, intrinsics_d, trans_d,
-                depth_scale, depth_max, criteria, params);
-    } else if (method == Method::Hybrid) {
-        return RGBDOdometryMultiScaleHybrid(source_processed, target_processed,
-                                            intrinsics_d, trans_d, depth_scale,
-                                            depth_max, criteria, params);
+    if (source.method_ == Method::PointToPlane) {
+        return RGBDOdometryMultiScalePointToPlane(source, target, trans_d,
+                                                  criteria, params);
+    } else if (source.method_ == Method::Intensity) {
+        return RGBDOdometryMultiScaleIntensity(source, target, trans_d,
+                                               criteria, params);
+    } else if (source.method_ == Method::Hybrid) {
+        return RGBDOdometryMultiScaleHybrid(source, target, trans_d, criteria,
+                                            params);
     } else {
         utility::LogError("Odometry method not implemented.");
     }
@@ -126,61 +272,18 @@ OdometryResult RGBDOdometryMultiScale(
 }
 
 OdometryResult RGBDOdometryMultiScalePointToPlane(
-        const RGBDImage& source,
-        const RGBDImage& target,
-        const Tensor& intrinsics,
+        const RGBDFramePyramid& source,
+        const RGBDFramePyramid& target,
         const Tensor& trans,
-        const float depth_scale,
-        const float depth_max,
         const std::vector<OdometryConvergenceCriteria>& criteria,
         const OdometryLossParams& params) {
-    int64_t n_levels = int64_t(criteria.size());
-    std::vector<Tensor> source_vertex_maps(n_levels);
-    std::vector<Tensor> target_vertex_maps(n_levels);
-    std::vector<Tensor> target_normal_maps(n_levels);
-    std::vector<Tensor> intrinsic_matrices(n_levels);
-
-    Image source_depth_curr = source.depth_;
-    Image target_depth_curr = target.depth_;
-
-    Tensor intrinsics_pyr = intrinsics;
-
-    // Create image pyramid.
-    for (int64_t i = 0; i < n_levels; ++i) {
-        Image source_vertex_map =
-                source_depth_curr.CreateVertexMap(intrinsics_pyr, NAN);
-        Image target_vertex_map =
-                target_depth_curr.CreateVertexMap(intrinsics_pyr, NAN);
-
-        Image target_depth_curr_smooth =
-                target_depth_curr.FilterBilateral(5, 5, 10);
-        Image target_vertex_map_smooth =
-                target_depth_curr_smooth.CreateVertexMap(intrinsics_pyr, NAN);
-        Image target_normal_map = target_vertex_map_smooth.CreateNormalMap(NAN);
-
-        source_vertex_maps[n_levels - 1 - i] = source_vertex_map.AsTensor();
-        target_vertex_maps[n_levels - 1 - i] = target_vertex_map.AsTensor();
-        target_normal_maps[n_levels - 1 - i] = target_normal_map.AsTensor();
-
-        intrinsic_matrices[n_levels - 1 - i] = intrinsics_pyr.Clone();
-
-        if (i != n_levels - 1) {
-            source_depth_curr = source_depth_curr.PyrDownDepth(
-                    params.depth_outlier_trunc_ * 2, NAN);
-            target_depth_curr = target_depth_curr.PyrDownDepth(
-                    params.depth_outlier_trunc_ * 2, NAN);
-
-            intrinsics_pyr /= 2;
-            intrinsics_pyr[-1][-1] = 1;
-        }
-    }
-
+    const int64_t n_levels = int64_t(criteria.size());
     OdometryResult result(trans, /*prev rmse*/ 0.0, /*prev fitness*/ 1.0);
     for (int64_t i = 0; i < n_levels; ++i) {
         for (int iter = 0; iter < criteria[i].max_iteration_; ++iter) {
             auto delta_result = ComputeOdometryResultPointToPlane(
-                    source_vertex_maps[i], target_vertex_maps[i],
-                    target_normal_maps[i], intrinsic_matrices[i],
+                    source.vertex_map_[i], target.vertex_map_[i],
+                    target.normal_map_[i], source.intrinsics_[i],
                     result.transformation_, params.depth_outlier_trunc_,
                     params.depth_huber_delta_);
             result.transformation_ =
@@ -207,79 +310,20 @@ OdometryResult RGBDOdometryMultiScalePointToPlane(
 }
 
 OdometryResult RGBDOdometryMultiScaleIntensity(
-        const RGBDImage& source,
-        const RGBDImage& target,
-        const Tensor& intrinsics,
+        const RGBDFramePyramid& source,
+        const RGBDFramePyramid& target,
         const Tensor& trans,
-        const float depth_scale,
-        const float depth_max,
         const std::vector<OdometryConvergenceCriteria>& criteria,
         const OdometryLossParams& params) {
-    int64_t n_levels = int64_t(criteria.size());
-    std::vector<Tensor> source_intensity(n_levels);
-    std::vector<Tensor> target_intensity(n_levels);
-
-    std::vector<Tensor> source_depth(n_levels);
-    std::vector<Tensor> target_depth(n_levels);
-    std::vector<Tensor> target_intensity_dx(n_levels);
-    std::vector<Tensor> target_intensity_dy(n_levels);
-
-    std::vector<Tensor> source_vertex_maps(n_levels);
-
-    std::vector<Tensor> intrinsic_matrices(n_levels);
-
-    Image source_depth_curr = source.depth_;
-    Image target_depth_curr = target.depth_;
-
-    Image source_intensity_curr = source.color_.RGBToGray().To(core::Float32);
-    Image target_intensity_curr = target.color_.RGBToGray().To(core::Float32);
-
-    Tensor intrinsics_pyr = intrinsics;
-
-    // Create image pyramid
-    for (int64_t i = 0; i < n_levels; ++i) {
-        source_depth[n_levels - 1 - i] = source_depth_curr.AsTensor().Clone();
-        target_depth[n_levels - 1 - i] = target_depth_curr.AsTensor().Clone();
-
-        source_intensity[n_levels - 1 - i] =
-                source_intensity_curr.AsTensor().Clone();
-        target_intensity[n_levels - 1 - i] =
-                target_intensity_curr.AsTensor().Clone();
-
-        Image source_vertex_map =
-                source_depth_curr.CreateVertexMap(intrinsics_pyr, NAN);
-        source_vertex_maps[n_levels - 1 - i] = source_vertex_map.AsTensor();
-
-        auto target_intensity_grad = target_intensity_curr.FilterSobel();
-        target_intensity_dx[n_levels - 1 - i] =
-                target_intensity_grad.first.AsTensor();
-        target_intensity_dy[n_levels - 1 - i] =
-                target_intensity_grad.second.AsTensor();
-
-        intrinsic_matrices[n_levels - 1 - i] = intrinsics_pyr.Clone();
-
-        if (i != n_levels - 1) {
-            source_depth_curr = source_depth_curr.PyrDownDepth(
-                    params.depth_outlier_trunc_ * 2, NAN);
-            target_depth_curr = target_depth_curr.PyrDownDepth(
-                    params.depth_outlier_trunc_ * 2, NAN);
-            source_intensity_curr = source_intensity_curr.PyrDown();
-            target_intensity_curr = target_intensity_curr.PyrDown();
-
-            intrinsics_pyr /= 2;
-            intrinsics_pyr[-1][-1] = 1;
-        }
-    }
-
-    // Odometry
+    const int64_t n_levels = int64_t(criteria.size());
     OdometryResult result(trans, /*prev rmse*/ 0.0, /*prev fitness*/ 1.0);
     for (int64_t i = 0; i < n_levels; ++i) {
         for (int iter = 0; iter < criteria[i].max_iteration_; ++iter) {
             auto delta_result = ComputeOdometryResultIntensity(
-                    source_depth[i], target_depth[i], source_intensity[i],
-                    target_intensity[i], target_intensity_dx[i],
-                    target_intensity_dy[i], source_vertex_maps[i],
-                    intrinsic_matrices[i], result.transformation_,
+                    source.depth_[i], target.depth_[i], source.intensity_[i],
+                    target.intensity_[i], target.intensity_dx_[i],
+                    target.intensity_dy_[i], source.vertex_map_[i],
+                    source.intrinsics_[i], result.transformation_,
                     params.depth_outlier_trunc_, params.intensity_huber_delta_);
             result.transformation_ =
                     delta_result.transformation_.Matmul(result.transformation_);
@@ -305,86 +349,23 @@ OdometryResult RGBDOdometryMultiScaleIntensity(
 }
 
 OdometryResult RGBDOdometryMultiScaleHybrid(
-        const RGBDImage& source,
-        const RGBDImage& target,
-        const Tensor& intrinsics,
+        const RGBDFramePyramid& source,
+        const RGBDFramePyramid& target,
         const Tensor& trans,
-        const float depth_scale,
-        const float depth_max,
         const std::vector<OdometryConvergenceCriteria>& criteria,
         const OdometryLossParams& params) {
-    int64_t n_levels = int64_t(criteria.size());
-    std::vector<Tensor> source_intensity(n_levels);
-    std::vector<Tensor> target_intensity(n_levels);
-
-    std::vector<Tensor> source_depth(n_levels);
-    std::vector<Tensor> target_depth(n_levels);
-    std::vector<Tensor> target_intensity_dx(n_levels);
-    std::vector<Tensor> target_intensity_dy(n_levels);
-
-    std::vector<Tensor> target_depth_dx(n_levels);
-    std::vector<Tensor> target_depth_dy(n_levels);
-
-    std::vector<Tensor> source_vertex_maps(n_levels);
-
-    std::vector<Tensor> intrinsic_matrices(n_levels);
-
-    Image source_depth_curr(source.depth_);
-    Image target_depth_curr(target.depth_);
-
-    Image source_intensity_curr = source.color_.RGBToGray().To(core::Float32);
-    Image target_intensity_curr = target.color_.RGBToGray().To(core::Float32);
-
-    Tensor intrinsics_pyr = intrinsics;
-    // Create image pyramid
-    for (int64_t i = 0; i < n_levels; ++i) {
-        source_depth[n_levels - 1 - i] = source_depth_curr.AsTensor().Clone();
-        target_depth[n_levels - 1 - i] = target_depth_curr.AsTensor().Clone();
-
-        source_intensity[n_levels - 1 - i] =
-                source_intensity_curr.AsTensor().Clone();
-        target_intensity[n_levels - 1 - i] =
-                target_intensity_curr.AsTensor().Clone();
-
-        Image source_vertex_map =
-                source_depth_curr.CreateVertexMap(intrinsics_pyr, NAN);
-        source_vertex_maps[n_levels - 1 - i] = source_vertex_map.AsTensor();
-
-        auto target_intensity_grad = target_intensity_curr.FilterSobel();
-        target_intensity_dx[n_levels - 1 - i] =
-                target_intensity_grad.first.AsTensor();
-        target_intensity_dy[n_levels - 1 - i] =
-                target_intensity_grad.second.AsTensor();
-
-        auto target_depth_grad = target_depth_curr.FilterSobel();
-        target_depth_dx[n_levels - 1 - i] = target_depth_grad.first.AsTensor();
-        target_depth_dy[n_levels - 1 - i] = target_depth_grad.second.AsTensor();
-
-        intrinsic_matrices[n_levels - 1 - i] = intrinsics_pyr.Clone();
-        if (i != n_levels - 1) {
-            source_depth_curr = source_depth_curr.PyrDownDepth(
-                    params.depth_outlier_trunc_ * 2, NAN);
-            target_depth_curr = target_depth_curr.PyrDownDepth(
-                    params.depth_outlier_trunc_ * 2, NAN);
-            source_intensity_curr = source_intensity_curr.PyrDown();
-            target_intensity_curr = target_intensity_curr.PyrDown();
-
-            intrinsics_pyr /= 2;
-            intrinsics_pyr[-1][-1] = 1;
-        }
-    }
-
-    // Odometry
+    const int64_t n_levels = int64_t(criteria.size());
     OdometryResult result(trans, /*prev rmse*/ 0.0, /*prev fitness*/ 1.0);
     for (int64_t i = 0; i < n_levels; ++i) {
         for (int iter = 0; iter < criteria[i].max_iteration_; ++iter) {
             auto delta_result = ComputeOdometryResultHybrid(
-                    source_depth[i], target_depth[i], source_intensity[i],
-                    target_intensity[i], target_depth_dx[i], target_depth_dy[i],
-                    target_intensity_dx[i], target_intensity_dy[i],
-                    source_vertex_maps[i], intrinsic_matrices[i],
-                    result.transformation_, params.depth_outlier_trunc_,
-                    params.depth_huber_delta_, params.intensity_huber_delta_);
+                    source.depth_[i], target.depth_[i], source.intensity_[i],
+                    target.intensity_[i], target.depth_dx_[i],
+                    target.depth_dy_[i], target.intensity_dx_[i],
+                    target.intensity_dy_[i], source.vertex_map_[i],
+                    source.intrinsics_[i], result.transformation_,
+                    params.depth_outlier_trunc_, params.depth_huber_delta_,
+                    params.intensity_huber_delta_);
             result.transformation_ =
                     delta_result.transformation_.Matmul(result.transformation_);
             utility::LogDebug("level {}, iter {}: rmse = {}, fitness = {}", i,
@@ -137,11 +137,125 @@ public:
     float intensity_huber_delta_;
 };
 
+/// \class OdometryWarmStart
+///
+/// \brief Motion prior for frame-to-frame RGBD odometry, where the source of
+/// each call is the frame after the target.
+///
+/// The initial transformation of the next frame pair is predicted with a
+/// constant velocity model, i.e. it is the motion estimated for the last pair,
+/// optionally with its rotation replaced by an IMU (gyroscope) prior. When the
+/// last pair was tracked with a fitness of at least \p confident_fitness, the
+/// prediction is considered confident and the coarsest levels of the criteria
+/// list are skipped by setting their max_iteration to 0.
+class OdometryWarmStart {
+public:
+    /// \brief Constructor for the warm start.
+    ///
+    /// \param confident_fitness Fitness of the last result from which the
+    /// prediction is considered confident.
+    /// \param num_skipped_levels Number of coarsest levels skipped for a
+    /// confident prediction. The finest level is never skipped.
+    OdometryWarmStart(double confident_fitness = 0.9,
+                      int64_t num_skipped_levels = 1);
+
+    /// Returns the predicted (4, 4) Float64 source to target transformation on
+    /// CPU, or identity before the first update.
+    core::Tensor Predict() const;
+
+    /// Returns the prediction with its rotation replaced by \p rotation_prior,
+    /// a (3, 3) rotation from the source to the target camera, e.g. integrated
+    /// from a gyroscope and rotated into the camera frame.
+    core::Tensor Predict(const core::Tensor& rotation_prior) const;
+
+    /// Returns \p criteria_list, from coarse to fine, with the coarse levels
+    /// skipped if the prediction is confident.
+    std::vector<OdometryConvergenceCriteria> GetCriteria(
+            const std::vector<OdometryConvergenceCriteria>& criteria_list)
+            const;
+
+    /// Returns true if the last result is confident enough to skip levels.
+    bool IsConfident() const;
+
+    /// Records the result of the last tracked frame pair.
+    void Update(const OdometryResult& result);
+
+    /// Forgets the motion, e.g. after a tracking failure.
+    void Reset();
+
+public:
+    /// Fitness of the last result from which the prediction is confident.
+    double confident_fitness_;
+    /// Number of coarsest levels skipped for a confident prediction.
+    int64_t num_skipped_levels_;
+
+private:
+    OdometryResult last_result_;
+    bool has_result_ = false;
+};
+
+/// \class RGBDFramePyramid
+///
+/// \brief Multi-scale maps of one RGBD frame used by RGBDOdometryMultiScale.
+///
+/// The maps are computed once at construction. In frame-to-frame odometry the
+/// target of frame N is the source of frame N + 1, so the same pyramid can be
+/// passed to both calls instead of being rebuilt. Only the maps required by
+/// \p method for either role are computed; the others are left empty. Levels
+/// are ordered from coarse to fine, matching the convergence criteria list.
+class RGBDFramePyramid {
+public:
+    /// \brief Constructor that builds the pyramid of an RGBD image.
+    ///
+    /// \param rgbd RGBD image holding a depth image (UInt16 or Float32) with a
+    /// scale factor and a color image (UInt8 x 3).
+    /// \param intrinsics (3, 3) intrinsic matrix for projection.
+    /// \param depth_scale Converts depth pixel values to meters by dividing
+    /// the scale factor.
+    /// \param depth_max Max depth to truncate depth image with noisy
+    /// measurements.
+    /// \param n_levels Number of pyramid levels.
+    /// \param method Odometry method the pyramid will be used with.
+    /// \param params Loss parameters, whose depth outlier threshold is used to
+    /// downsample depth images.
+    RGBDFramePyramid(const t::geometry::RGBDImage& rgbd,
+                     const core::Tensor& intrinsics,
+                     const float depth_scale = 1000.0f,
+                     const float depth_max = 3.0f,
+                     const int64_t n_levels = 3,
+                     const Method method = Method::Hybrid,
+                     const OdometryLossParams& params = OdometryLossParams());
+
+    /// Number of pyramid levels.
+    int64_t GetNumLevels() const { return int64_t(intrinsics_.size()); }
+
+public:
+    /// Odometry method the pyramid is built for.
+    Method method_;
+    /// (3, 3) Float64 intrinsic matrices on CPU.
+    std::vector<core::Tensor> intrinsics_;
+    /// (rows, cols, 1) Float32 depth images in meters. Intensity and Hybrid.
+    std::vector<core::Tensor> depth_;
+    /// (rows, cols, 1) Float32 intensity images. Intensity and Hybrid.
+    std::vector<core::Tensor> intensity_;
+    /// (rows, cols, 3) Float32 vertex maps.
+    std::vector<core::Tensor> vertex_map_;
+    /// (rows, cols, 3) Float32 normal maps from smoothed depth. PointToPlane.
+    std::vector<core::Tensor> normal_map_;
+    /// (rows, cols, 1) Float32 depth gradients. Hybrid.
+    std::vector<core::Tensor> depth_dx_;
+    std::vector<core::Tensor> depth_dy_;
+    /// (rows, cols, 1) Float32 intensity gradients. Intensity and Hybrid.
+    std::vector<core::Tensor> intensity_dx_;
+    std::vector<core::Tensor> intensity_dy_;
+};
+
 /// \brief Create an RGBD image pyramid given the original source and target
 /// RGBD images, and perform hierarchical odometry using specified \p
 /// method.
 /// Can be used for offline odometry where we do not expect to push performance
-/// to the extreme and not reuse vertex/normal map computed before.
+/// to the extreme and not reuse vertex/normal map computed before. Use the
+/// RGBDFramePyramid overload to reuse the pyramid of a frame across calls.
 /// Input RGBD images hold a depth image (UInt16 or Float32) with a scale
 /// factor and a color image (UInt8 x 3).
 /// \param source Source RGBD image.
@@ -174,6 +288,28 @@ OdometryResult RGBDOdometryMultiScale(
         const Method method = Method::Hybrid,
         const OdometryLossParams& params = OdometryLossParams());
 
+/// \brief Perform hierarchical odometry between two prebuilt RGBD frame
+/// pyramids. The method and the number of levels are taken from the
+/// pyramids, which must agree with each other and with \p criteria_list.
+/// \param source Source RGBD frame pyramid.
+/// \param target Target RGBD frame pyramid.
+/// \param init_source_to_target (4, 4) initial transformation matrix from
+/// source to target of core::Float64 on CPU.
+/// \param criteria_list Criteria used to define and terminate iterations,
+/// from coarse to fine.
+/// \param params Parameters used in loss function, including outlier rejection
+/// threshold and Huber norm parameters.
+/// \return odometry result, with (4, 4) optimized transformation matrix from
+/// source to target, inlier ratio, and fitness.
+OdometryResult RGBDOdometryMultiScale(
+        const RGBDFramePyramid& source,
+        const RGBDFramePyramid& target,
+        const core::Tensor& init_source_to_target =
+                core::Tensor::Eye(4, core::Float64, core::Device("CPU:0")),
+        const std::vector<OdometryConvergenceCriteria>& criteria_list = {10, 5,
+                                                                         3},
+        const OdometryLossParams& params = OdometryLossParams());
+
 /// \brief Estimates the 4x4 rigid transformation T from source to target, with
 /// inlier rmse and fitness.
 /// Performs one iteration of RGBD odometry using loss function
@@ -0,0 +1,313 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/t/pipelines/registration/FastGlobalRegistration.h"
+
+#include <algorithm>
+#include <vector>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/core/TensorCheck.h"
+#include "open3d/core/TensorFunction.h"
+#include "open3d/core/nns/NearestNeighborSearch.h"
+#include "open3d/t/geometry/PointCloud.h"
+#include "open3d/t/pipelines/kernel/Registration.h"
+#include "open3d/t/pipelines/kernel/TransformationConverter.h"
+#include "open3d/t/pipelines/registration/Registration.h"
+#include "open3d/utility/Helper.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace registration {
+
+// Number of tuple test trials that are drawn and tested together.
+static constexpr int64_t kTupleTrialBatchSize = 1 << 16;
+
+static core::Tensor InitialMatching(const core::Tensor &source_features,
+                                    const core::Tensor &target_features) {
+    core::nns::NearestNeighborSearch source_nns(source_features, core::Int64);
+    core::nns::NearestNeighborSearch target_nns(target_features, core::Int64);
+    if (!source_nns.KnnIndex() || !target_nns.KnnIndex()) {
+        utility::LogError("Building KnnIndex failed.");
+    }
+
+    const core::Tensor source_to_target =
+            target_nns.KnnSearch(source_features, 1).first.View({-1});
+    const core::Tensor target_to_source =
+            source_nns.KnnSearch(target_features, 1).first.View({-1});
+
+    // Cross check: keep the mutual nearest neighbors in feature space.
+    const core::Tensor source_indices = core::Tensor::Arange(
+            0, source_features.GetLength(), 1, core::Int64,
+            source_features.GetDevice());
+    const core::Tensor mutual =
+            target_to_source.IndexGet({source_to_target}).Eq(source_indices);
+    const core::Tensor correspondences = core::Concatenate(
+            {source_indices.IndexGet({mutual}).Reshape({-1, 1}),
+             source_to_target.IndexGet({mutual}).Reshape({-1, 1})},
+            1);
+
+    utility::LogDebug("Initial matchings : {}", correspondences.GetLength());
+    return correspondences;
+}
+
+// Lengths of the three edges of each tuple, of shape {num_tuples, 3}.
+static core::Tensor GetTupleEdgeLengths(const core::Tensor &points,
+                                        const core::Tensor &tuple_indices) {
+    const core::Tensor tuple_points =
+            points.IndexGet({tuple_indices.Reshape({-1})}).View({-1, 3, 3});
+    const core::Tensor p0 = tuple_points.Slice(1, 0, 1);
+    const core::Tensor p1 = tuple_points.Slice(1, 1, 2);
+    const core::Tensor p2 = tuple_points.Slice(1, 2, 3);
+    const core::Tensor edges =
+            core::Concatenate({p0 - p1, p1 - p2, p2 - p0}, 1);
+    return (edges * edges).Sum({2}).Sqrt();
+}
+
+// Keeps the correspondence tuples whose edge lengths are similar in source and
+// target. The trials are the same as in the legacy implementation for a given
+// seed, but each batch of trials is tested in parallel on the device of the
+// correspondences.
+static core::Tensor AdvancedMatching(
+        const core::Tensor &source_points,
+        const core::Tensor &target_points,
+        const core::Tensor &correspondences,
+        const FastGlobalRegistrationOption &option) {
+    const int64_t num_corres = correspondences.GetLength();
+    const core::Device device = correspondences.GetDevice();
+    if (num_corres == 0) {
+        return correspondences;
+    }
+
+    const double scale = option.tuple_scale_;
+    const int64_t num_trials = num_corres * 100;
+    unsigned int seed_val = option.seed_.has_value() ? option.seed_.value()
+                                                     : std::random_device{}();
+    utility::UniformRandIntGenerator rand_generator(
+            0, static_cast<int>(num_corres - 1), seed_val);
+
+    std::vector<core::Tensor> tuples;
+    int64_t num_tuples = 0;
+    for (int64_t trial = 0;
+         trial < num_trials && num_tuples < option.maximum_tuple_count_;
+         trial += kTupleTrialBatchSize) {
+        const int64_t num_batch =
+                std::min(kTupleTrialBatchSize, num_trials - trial);
+        std::vector<int64_t> samples(num_batch * 3);
+        for (auto &sample : samples) {
+            sample = rand_generator();
+        }
+        const core::Tensor tuple_corres = correspondences.IndexGet(
+                {core::Tensor(samples, {num_batch * 3}, core::Int64, device)});
+
+        // Check tuple constraint.
+        const core::Tensor lengths_i =
+                GetTupleEdgeLengths(source_points, tuple_corres.Slice(1, 0, 1));
+        const core::Tensor lengths_j =
+                GetTupleEdgeLengths(target_points, tuple_corres.Slice(1, 1, 2));
+        const core::Tensor compatible =
+                (lengths_i * scale)
+                        .Lt(lengths_j)
+                        .LogicalAnd(lengths_j.Lt(lengths_i / scale));
+        const core::Tensor valid =
+                compatible.Slice(1, 0, 1)
+                        .LogicalAnd(compatible.Slice(1, 1, 2))
+                        .LogicalAnd(compatible.Slice(1, 2, 3))
+                        .Reshape({num_batch});
+
+        core::Tensor valid_tuples =
+                core::Tensor::Arange(0, num_batch, 1, core::Int64, device)
+                        .IndexGet({valid});
+        valid_tuples = valid_tuples.Slice(
+                0, 0,
+                std::min(valid_tuples.GetLength(),
+                         option.maximum_tuple_count_ - num_tuples));
+        num_tuples += valid_tuples.GetLength();
+        tuples.push_back(tuple_corres.View({num_batch, 3, 2})
+                                 .IndexGet({valid_tuples})
+                                 .View({-1, 2}));
+    }
+    utility::LogDebug("{:d} tuples ({:d} trial).", num_tuples, num_trials);
+
+    const core::Tensor corres_tuple =
+            tuples.size() == 1 ? tuples[0] : core::Concatenate(tuples, 0);
+    utility::LogDebug("\t[final] matches {:d}.", corres_tuple.GetLength());
+    return corres_tuple;
+}
+
+// Normalize scale of points. X' = (X-\mu)/scale
+static double NormalizePointClouds(core::Tensor &source_points,
+                                   core::Tensor &target_points,
+                                   core::Tensor &source_mean,
+                                   core::Tensor &target_mean,
+                                   const FastGlobalRegistrationOption &option) {
+    source_mean = source_points.Mean({0});
+    target_mean = target_points.Mean({0});
+    source_points = source_points - source_mean;
+    target_points = target_points - target_mean;
+
+    auto get_max_norm = [](const core::Tensor &points) {
+        return (points * points)
+                .Sum({1})
+                .Max({0})
+                .Sqrt()
+                .To(core::Float64)
+                .Item<double>();
+    };
+    const double scale =
+            std::max(get_max_norm(source_points), get_max_norm(target_points));
+
+    const double scale_global = option.use_absolute_scale_ ? 1.0 : scale;
+    utility::LogDebug("normalize points :: global scale : {:f}", scale_global);
+    if (scale_global <= 0) {
+        utility::LogError("Invalid scale_global: {}, it must be > 0.",
+                          scale_global);
+    }
+
+    source_points = source_points / scale_global;
+    target_points = target_points / scale_global;
+    return scale_global;
+}
+
+// Graduated non-convexity, where each iteration solves the robust point to
+// point objective on the device of the points.
+static core::Tensor OptimizePairwiseRegistration(
+        const core::Tensor &source_points,
+        const core::Tensor &target_points,
+        const core::Tensor &correspondences,
+        double mu,
+        const FastGlobalRegistrationOption &option) {
+    utility::LogDebug("Pairwise rigid pose optimization");
+    core::Tensor transformation =
+            core::Tensor::Eye(4, core::Float64, core::Device("CPU:0"));
+    if (correspondences.GetLength() < 10) return transformation;
+
+    geometry::PointCloud source_transformed(source_points.Clone());
+    RobustKernel kernel = option.kernel_;
+    for (int itr = 0; itr < option.iteration_number_; itr++) {
+        kernel.scaling_parameter_ = mu;
+        const core::Tensor pose = kernel::ComputePoseFastGlobalRegistration(
+                source_transformed.GetPointPositions(), target_points,
+                correspondences, kernel);
+        const core::Tensor update = kernel::PoseToTransformation(pose);
+        transformation = update.Matmul(transformation);
+        source_transformed.Transform(update);
+
+        // graduated non-convexity.
+        if (option.decrease_mu_) {
+            if (itr % 4 == 0 && mu > option.maximum_correspondence_distance_) {
+                mu /= option.division_factor_;
+            }
+        }
+    }
+    return transformation;
+}
+
+// Transformation between the original point clouds, given the transformation
+// between the normalized ones.
+static core::Tensor GetTransformationOriginalScale(
+        const core::Tensor &transformation,
+        const core::Tensor &source_mean,
+        const core::Tensor &target_mean,
+        const double scale_global) {
+    const core::Device host("CPU:0");
+    const core::Tensor R = transformation.Slice(0, 0, 3).Slice(1, 0, 3);
+    const core::Tensor t = transformation.Slice(0, 0, 3).Slice(1, 3, 4);
+    const core::Tensor translation =
+            t * scale_global +
+            target_mean.To(host, core::Float64).Reshape({3, 1}) -
+            R.Matmul(source_mean.To(host, core::Float64).Reshape({3, 1}));
+
+    core::Tensor transformation_original = transformation.Clone();
+    transformation_original.Slice(0, 0, 3).Slice(1, 3, 4) = translation;
+    return transformation_original;
+}
+
+RegistrationResult FastGlobalRegistrationBasedOnCorrespondence(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        const core::Tensor &correspondences,
+        const FastGlobalRegistrationOption &option) {
+    const core::Device device = source.GetDevice();
+    const core::Dtype dtype = source.GetPointPositions().GetDtype();
+    core::AssertTensorDtypes(source.GetPointPositions(),
+                             {core::Float64, core::Float32});
+    core::AssertTensorDevice(target.GetPointPositions(), device);
+    core::AssertTensorDtype(target.GetPointPositions(), dtype);
+    core::AssertTensorDevice(correspondences, device);
+    core::AssertTensorDtype(correspondences, core::Int64);
+    core::AssertTensorShape(correspondences, {utility::nullopt, 2});
+
+    core::Tensor corres = correspondences;
+    if (option.tuple_test_) {
+        corres = AdvancedMatching(source.GetPointPositions(),
+                                  target.GetPointPositions(), corres, option);
+    }
+
+    core::Tensor source_points = source.GetPointPositions();
+    core::Tensor target_points = target.GetPointPositions();
+    core::Tensor source_mean, target_mean;
+    const double scale_global = NormalizePointClouds(
+            source_points, target_points, source_mean, target_mean, option);
+
+    const core::Tensor transformation = OptimizePairwiseRegistration(
+            source_points, target_points, corres, scale_global, option);
+
+    return EvaluateRegistration(
+            source, target, option.maximum_correspondence_distance_,
+            GetTransformationOriginalScale(transformation, source_mean,
+                                           target_mean, scale_global));
+}
+
+RegistrationResult FastGlobalRegistrationBasedOnFeatureMatching(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        const core::Tensor &source_features,
+        const core::Tensor &target_features,
+        const FastGlobalRegistrationOption &option) {
+    core::AssertTensorDevice(source_features, source.GetDevice());
+    core::AssertTensorDevice(target_features, source.GetDevice());
+    core::AssertTensorDtype(target_features, source_features.GetDtype());
+    core::AssertTensorShape(
+            source_features,
+            {source.GetPointPositions().GetLength(), utility::nullopt});
+    core::AssertTensorShape(
+            target_features,
+            {target.GetPointPositions().GetLength(),
+             source_features.GetShape(1)});
+
+    return FastGlobalRegistrationBasedOnCorrespondence(
+            source, target, InitialMatching(source_features, target_features),
+            option);
+}
+
+}  // namespace registration
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
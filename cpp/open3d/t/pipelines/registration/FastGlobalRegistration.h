@@ -0,0 +1,161 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#pragma once
+
+#include "open3d/core/Tensor.h"
+#include "open3d/t/pipelines/registration/RobustKernel.h"
+#include "open3d/utility/Optional.h"
+
+namespace open3d {
+namespace t {
+
+namespace geometry {
+class PointCloud;
+}
+
+namespace pipelines {
+namespace registration {
+
+class RegistrationResult;
+
+/// \class FastGlobalRegistrationOption
+///
+/// \brief Options for FastGlobalRegistration.
+class FastGlobalRegistrationOption {
+public:
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param division_factor Division factor used for graduated non-convexity.
+    /// \param use_absolute_scale Measure distance in absolute scale (1) or in
+    /// scale relative to the diameter of the model (0).
+    /// \param decrease_mu Set to `true` to decrease scale mu by division_factor
+    /// for graduated non-convexity.
+    /// \param maximum_correspondence_distance Maximum correspondence distance
+    /// (also see comment of USE_ABSOLUTE_SCALE).
+    /// \param iteration_number Maximum number of iterations.
+    /// \param tuple_scale Similarity measure used for tuples of feature points.
+    /// \param maximum_tuple_count Maximum number of tuples.
+    /// \param tuple_test Set to `true` to perform geometric compatibility tests
+    /// on initial set of correspondences.
+    /// \param seed Random seed.
+    /// \param kernel Robust kernel of the point to point objective. Its scaling
+    /// parameter is set to the scale mu of the graduated non-convexity in every
+    /// iteration.
+    FastGlobalRegistrationOption(
+            double division_factor = 1.4,
+            bool use_absolute_scale = false,
+            bool decrease_mu = true,
+            double maximum_correspondence_distance = 0.025,
+            int iteration_number = 64,
+            double tuple_scale = 0.95,
+            int maximum_tuple_count = 1000,
+            bool tuple_test = true,
+            utility::optional<unsigned int> seed = utility::nullopt,
+            const RobustKernel &kernel =
+                    RobustKernel(RobustKernelMethod::GMLoss))
+        : division_factor_(division_factor),
+          use_absolute_scale_(use_absolute_scale),
+          decrease_mu_(decrease_mu),
+          maximum_correspondence_distance_(maximum_correspondence_distance),
+          iteration_number_(iteration_number),
+          tuple_scale_(tuple_scale),
+          maximum_tuple_count_(maximum_tuple_count),
+          tuple_test_(tuple_test),
+          seed_(seed),
+          kernel_(kernel) {}
+    ~FastGlobalRegistrationOption() {}
+
+public:
+    /// Division factor used for graduated non-convexity.
+    double division_factor_;
+    /// Measure distance in absolute scale (1) or in scale relative to the
+    /// diameter of the model (0).
+    bool use_absolute_scale_;
+    /// Set to `true` to decrease scale mu by division_factor for graduated
+    /// non-convexity.
+    bool decrease_mu_;
+    /// Maximum correspondence distance (also see comment of
+    /// USE_ABSOLUTE_SCALE).
+    double maximum_correspondence_distance_;
+    /// Maximum number of iterations.
+    int iteration_number_;
+    /// Similarity measure used for tuples of feature points.
+    double tuple_scale_;
+    /// Maximum number of tuples.
+    int maximum_tuple_count_;
+    /// Set to `true` to perform geometric compatibility tests on initial set of
+    /// correspondences.
+    bool tuple_test_;
+    /// Random seed.
+    utility::optional<unsigned int> seed_;
+    /// Robust kernel of the point to point objective. The Geman-McClure loss
+    /// of the original method is the default.
+    RobustKernel kernel_;
+};
+
+/// \brief Fast Global Registration based on a given set of correspondences.
+///
+/// \param source The source point cloud. (Float32 or Float64 type).
+/// \param target The target point cloud. (Float32 or Float64 type).
+/// \param correspondences Int64 tensor of shape {K, 2}, where each row holds
+/// the source and the target index of a putative correspondence.
+/// \param option FGR options.
+/// \return Registration result with the transformation from source to target
+/// of dtype Float64 on CPU device.
+RegistrationResult FastGlobalRegistrationBasedOnCorrespondence(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        const core::Tensor &correspondences,
+        const FastGlobalRegistrationOption &option =
+                FastGlobalRegistrationOption());
+
+/// \brief Fast Global Registration based on a given set of features, e.g.
+/// FPFH features from ComputeFPFHFeature. Putative correspondences are the
+/// mutual nearest neighbors in feature space.
+///
+/// \param source The source point cloud. (Float32 or Float64 type).
+/// \param target The target point cloud. (Float32 or Float64 type).
+/// \param source_features Features of the source point cloud, of shape {N, D}
+/// on the same device as the source point cloud.
+/// \param target_features Features of the target point cloud, of shape {M, D}
+/// and of the same dtype and device as the source features.
+/// \param option FGR options.
+/// \return Registration result with the transformation from source to target
+/// of dtype Float64 on CPU device.
+RegistrationResult FastGlobalRegistrationBasedOnFeatureMatching(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        const core::Tensor &source_features,
+        const core::Tensor &target_features,
+        const FastGlobalRegistrationOption &option =
+                FastGlobalRegistrationOption());
+
+}  // namespace registration
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,117 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/pipelines/registration/Feature.h"
+
+#include "open3d/core/TensorCheck.h"
+#include "open3d/core/nns/NearestNeighborSearch.h"
+#include "open3d/t/geometry/PointCloud.h"
+#include "open3d/t/pipelines/kernel/Feature.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace registration {
+
+core::Tensor ComputeFPFHFeature(const geometry::PointCloud &input,
+                                const utility::optional<int> max_nn,
+                                const utility::optional<double> radius) {
+    core::AssertTensorDtypes(input.GetPointPositions(),
+                             {core::Float64, core::Float32});
+    if (max_nn.has_value() && max_nn.value() <= 3) {
+        utility::LogError("max_nn must be greater than 3.");
+    }
+    if (radius.has_value() && radius.value() <= 0) {
+        utility::LogError("radius must be greater than 0.");
+    }
+    if (!max_nn.has_value() && !radius.has_value()) {
+        utility::LogError("At least one of max_nn and radius must be given.");
+    }
+    if (!input.HasPointNormals()) {
+        utility::LogError("The input point cloud has no normal.");
+    }
+
+    const core::Tensor &points = input.GetPointPositions();
+    const core::Dtype dtype = points.GetDtype();
+    const core::Device device = points.GetDevice();
+    const int64_t num_points = points.GetLength();
+
+    core::Tensor fpfhs = core::Tensor::Zeros({num_points, 33}, dtype, device);
+    if (num_points == 0) {
+        return fpfhs;
+    }
+
+    // The neighbors of each point, the point itself first, are passed to the
+    // kernel as flat arrays with row splits. Fixed size rows of the KNN and
+    // hybrid searches are padded with -1.
+    core::nns::NearestNeighborSearch tree(points, core::Int64);
+    core::Tensor indices, distance2, row_splits;
+    if (radius.has_value() && max_nn.has_value()) {
+        if (!tree.HybridIndex(radius.value())) {
+            utility::LogError("Building HybridIndex failed.");
+        }
+        core::Tensor counts;
+        std::tie(indices, distance2, counts) =
+                tree.HybridSearch(points, radius.value(), max_nn.value());
+        row_splits = core::Tensor::Arange(0, num_points * max_nn.value() + 1,
+                                          max_nn.value(), core::Int64, device);
+        utility::LogDebug(
+                "Use HybridSearch [max_nn: {} | radius {}] for computing FPFH "
+                "feature.",
+                max_nn.value(), radius.value());
+    } else if (!radius.has_value()) {
+        if (!tree.KnnIndex()) {
+            utility::LogError("Building KnnIndex failed.");
+        }
+        const int64_t knn = std::min<int64_t>(max_nn.value(), num_points);
+        std::tie(indices, distance2) = tree.KnnSearch(points, knn);
+        row_splits = core::Tensor::Arange(0, num_points * knn + 1, knn,
+                                          core::Int64, device);
+        utility::LogDebug(
+                "Use KNNSearch [max_nn: {}] for computing FPFH feature.",
+                max_nn.value());
+    } else {
+        if (!tree.FixedRadiusIndex(radius.value())) {
+            utility::LogError("Building RadiusIndex failed.");
+        }
+        std::tie(indices, distance2, row_splits) =
+                tree.FixedRadiusSearch(points, radius.value(), /*sort=*/true);
+        utility::LogDebug(
+                "Use RadiusSearch [radius: {}] for computing FPFH feature.",
+                radius.value());
+    }
+
+    kernel::ComputeFPFHFeature(points, input.GetPointNormals(),
+                               indices.To(core::Int64).Reshape({-1}),
+                               distance2.To(dtype).Reshape({-1}),
+                               row_splits.To(device, core::Int64), fpfhs);
+    return fpfhs;
+}
+
+}  // namespace registration
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
@@ -26,14 +26,19 @@
 
 #include "open3d/t/pipelines/registration/Registration.h"
 
+#include "open3d/core/CUDAUtils.h"
 #include "open3d/core/Tensor.h"
 #include "open3d/core/TensorCheck.h"
 #include "open3d/core/TensorFunction.h"
+#include "open3d/core/nns/FixedRadiusIndex.h"
 #include "open3d/core/nns/NearestNeighborSearch.h"
 #include "open3d/t/geometry/PointCloud.h"
 #include "open3d/t/pipelines/kernel/Registration.h"
+#include "open3d/t/pipelines/kernel/TransformationConverter.h"
 #include "open3d/utility/Helper.h"
 #include "open3d/utility/Logging.h"
+#include "open3d/utility/Timer.h"
+#include "open3d/utility/Tracing.h"
 
 namespace open3d {
 namespace t {
@@ -55,13 +60,17 @@ static RegistrationResult ComputeRegistrationResult(
             target_nns.HybridSearch(source.GetPointPositions(),
                                     max_correspondence_distance, 1);
     result.correspondences_ = result.correspondences_.To(core::Int64);
-    double num_correspondences =
-            counts.Sum({0}).To(core::Float64).Item<double>();
+
+    // Number of correspondences and sum of squared "distances" for error,
+    // read back with a single device to host copy.
+    const core::Tensor sums =
+            core::Concatenate({counts.Sum({0}, true).To(core::Float64),
+                               distances.Sum({0}).To(core::Float64)})
+                    .To(core::Device("CPU:0"));
+    const double num_correspondences = sums[0].Item<double>();
 
     if (num_correspondences != 0) {
-        // Reduction sum of "distances" for error.
-        const double squared_error =
-                distances.Sum({0}).To(core::Float64).Item<double>();
+        const double squared_error = sums[1].Item<double>();
 
         result.fitness_ =
                 num_correspondences /
@@ -124,6 +133,58 @@ ICP(const geometry::PointCloud &source,
                          estimation, callback_after_iteration);
 }
 
+// Returns true if the estimation uses the photometric term of ColoredICP and
+// hence needs colors and color gradients.
+static bool HasPhotometricTerm(const TransformationEstimation &estimation) {
+    switch (estimation.GetTransformationEstimationType()) {
+        case TransformationEstimationType::ColoredICP:
+            return true;
+        case TransformationEstimationType::GeneralizedICP:
+            return static_cast<
+                           const TransformationEstimationForGeneralizedICP &>(
+                           estimation)
+                    .HasPhotometricTerm();
+        default:
+            return false;
+    }
+}
+
+// Returns the epsilon of GeneralizedICP covariances, or 0 if the estimation
+// does not use covariances.
+static double GetCovarianceEpsilon(const TransformationEstimation &estimation) {
+    if (estimation.GetTransformationEstimationType() ==
+        TransformationEstimationType::GeneralizedICP) {
+        return static_cast<const TransformationEstimationForGeneralizedICP &>(
+                       estimation)
+                .epsilon_;
+    }
+    return 0.0;
+}
+
+// Computes the GeneralizedICP covariances from the point normals if the point
+// cloud does not have the "covariances" attribute, estimating the normals from
+// 20 nearest neighbors if needed, as in the original GICP.
+static void InitializePointCloudForGeneralizedICP(geometry::PointCloud &pcd,
+                                                  const double epsilon) {
+    if (pcd.HasPointAttr("covariances")) {
+        utility::LogDebug("GeneralizedICP: Using pre-computed covariances.");
+        return;
+    }
+    if (!pcd.HasPointNormals()) {
+        utility::LogDebug("GeneralizedICP: Computing covariances from points.");
+        pcd.EstimateNormals(20);
+    }
+    // R * diag(epsilon, 1, 1) * R^T, with R rotating e1 onto the unit normal n,
+    // is I - (1 - epsilon) * n * n^T.
+    const core::Tensor &normals = pcd.GetPointNormals();
+    const core::Tensor nnT =
+            normals.Reshape({-1, 3, 1}).Mul(normals.Reshape({-1, 1, 3}));
+    pcd.SetPointAttr("covariances",
+                     core::Tensor::Eye(3, normals.GetDtype(), pcd.GetDevice())
+                                     .Reshape({1, 3, 3}) -
+                             nnT * (1.0 - epsilon));
+}
+
 static void AssertInputMultiScaleICP(
         const geometry::PointCloud &source,
         const geometry::PointCloud &target,
@@ -162,9 +223,9 @@ static void AssertInputMultiScaleICP(
                 "normal vectors for target PointCloud.");
     }
 
-    // ColoredICP requires pre-computed color_gradients for target points.
-    if (estimation.GetTransformationEstimationType() ==
-        TransformationEstimationType::ColoredICP) {
+    // The photometric term requires pre-computed color_gradients for target
+    // points.
+    if (HasPhotometricTerm(estimation)) {
         if (!target.HasPointNormals()) {
             utility::LogError(
                     "ColoredICP requires target pointcloud to have normals.");
@@ -200,58 +261,178 @@ static void AssertInputMultiScaleICP(
     }
 }
 
-static std::tuple<std::vector<t::geometry::PointCloud>,
-                  std::vector<t::geometry::PointCloud>>
-InitializePointCloudPyramidForMultiScaleICP(
+// Downsamples the source to each scale. The covariances of GeneralizedICP are
+// computed once at the finest scale if `covariance_epsilon` > 0, and are
+// carried to the other scales and rotated with the source in the iterations.
+static std::vector<t::geometry::PointCloud>
+InitializeSourcePyramidForMultiScaleICP(
         const geometry::PointCloud &source,
-        const geometry::PointCloud &target,
         const std::vector<double> &voxel_sizes,
-        const double &max_correspondence_distance,
-        const TransformationEstimation &estimation,
-        const int64_t &num_iterations) {
+        const int64_t &num_iterations,
+        const double covariance_epsilon) {
     std::vector<t::geometry::PointCloud> source_down_pyramid(num_iterations);
-    std::vector<t::geometry::PointCloud> target_down_pyramid(num_iterations);
 
     if (voxel_sizes[num_iterations - 1] <= 0) {
         source_down_pyramid[num_iterations - 1] = source.Clone();
-        target_down_pyramid[num_iterations - 1] = target;
     } else {
         source_down_pyramid[num_iterations - 1] =
                 source.VoxelDownSample(voxel_sizes[num_iterations - 1]);
-        target_down_pyramid[num_iterations - 1] =
-                target.VoxelDownSample(voxel_sizes[num_iterations - 1]);
+    }
+
+    if (covariance_epsilon > 0) {
+        InitializePointCloudForGeneralizedICP(
+                source_down_pyramid[num_iterations - 1], covariance_epsilon);
+    }
+
+    for (int k = num_iterations - 2; k >= 0; k--) {
+        source_down_pyramid[k] =
+                source_down_pyramid[k + 1].VoxelDownSample(voxel_sizes[k]);
+    }
+
+    return source_down_pyramid;
+}
+
+// Downsamples the point cloud to the finest scale, estimates the color
+// gradients if `color_gradients_radius` > 0 and the GeneralizedICP covariances
+// if `covariance_epsilon` > 0, and coarsens it to the other scales.
+static std::vector<t::geometry::PointCloud> BuildPointCloudPyramid(
+        const geometry::PointCloud &pointcloud,
+        const std::vector<double> &voxel_sizes,
+        const double color_gradients_radius,
+        const double covariance_epsilon) {
+    const int64_t num_scales = static_cast<int64_t>(voxel_sizes.size());
+    std::vector<t::geometry::PointCloud> down_pyramid(num_scales);
+
+    if (voxel_sizes[num_scales - 1] <= 0) {
+        down_pyramid[num_scales - 1] = pointcloud;
+    } else {
+        down_pyramid[num_scales - 1] =
+                pointcloud.VoxelDownSample(voxel_sizes[num_scales - 1]);
+    }
+
+    if (color_gradients_radius > 0) {
+        down_pyramid[num_scales - 1].EstimateColorGradients(
+                30, color_gradients_radius);
+    }
+    if (covariance_epsilon > 0) {
+        InitializePointCloudForGeneralizedICP(down_pyramid[num_scales - 1],
+                                              covariance_epsilon);
+    }
+
+    for (int64_t k = num_scales - 2; k >= 0; k--) {
+        down_pyramid[k] = down_pyramid[k + 1].VoxelDownSample(voxel_sizes[k]);
+    }
+
+    return down_pyramid;
+}
+
+ICPTargetPyramid::ICPTargetPyramid(
+        const geometry::PointCloud &target,
+        const std::vector<double> &voxel_sizes,
+        const std::vector<double> &max_correspondence_distances,
+        const TransformationEstimation &estimation)
+    : voxel_sizes_(voxel_sizes),
+      max_correspondence_distances_(max_correspondence_distances),
+      color_gradients_radius_(0.0),
+      covariance_epsilon_(GetCovarianceEpsilon(estimation)) {
+    if (!target.HasPointPositions()) {
+        utility::LogError("Target pointcloud is empty.");
+    }
+    core::AssertTensorDtypes(target.GetPointPositions(),
+                             {core::Float64, core::Float32});
+    if (voxel_sizes_.empty() ||
+        voxel_sizes_.size() != max_correspondence_distances_.size()) {
+        utility::LogError(
+                "Size of voxel_size and max_correspondence_distances vectors "
+                "must be same and non-zero.");
+    }
+    const int64_t num_scales = GetNumScales();
+    for (int64_t i = 0; i < num_scales; ++i) {
+        if (i > 0 && voxel_sizes_[i] >= voxel_sizes_[i - 1]) {
+            utility::LogError(
+                    " [ICP] Voxel sizes must be in strictly decreasing order.");
+        }
+        if (max_correspondence_distances_[i] <= 0.0) {
+            utility::LogError(
+                    " Max correspondence distance must be greater than 0, but"
+                    " got {} in scale: {}.",
+                    max_correspondence_distances_[i], i);
+        }
     }
 
     // Computing Color Gradients.
-    if (estimation.GetTransformationEstimationType() ==
-                TransformationEstimationType::ColoredICP &&
+    if (HasPhotometricTerm(estimation) &&
         !target.HasPointAttr("color_gradients")) {
         // `max_correspondence_distance * 2.0` or
-        // `voxel_sizes[num_iterations - 1] * 4.0` is an approximation, for
+        // `voxel_sizes[num_scales - 1] * 4.0` is an approximation, for
         // `search_radius` in `EstimateColorGradients`. For more control /
         // performance tuning, one may compute and save the `color_gradient`
         // attribute in the target pointcloud manually by calling the function
         // `EstimateColorGradients`, before passing it to the `ICP` function.
-        if (voxel_sizes[num_iterations - 1] <= 0) {
+        if (voxel_sizes_[num_scales - 1] <= 0) {
             utility::LogWarning(
                     "Use voxel size parameter, for better performance in "
                     "ColoredICP.");
-            target_down_pyramid[num_iterations - 1].EstimateColorGradients(
-                    30, max_correspondence_distance * 2.0);
+            color_gradients_radius_ =
+                    max_correspondence_distances_[num_scales - 1] * 2.0;
         } else {
-            target_down_pyramid[num_iterations - 1].EstimateColorGradients(
-                    30, voxel_sizes[num_iterations - 1] * 4.0);
+            color_gradients_radius_ = voxel_sizes_[num_scales - 1] * 4.0;
         }
     }
 
-    for (int k = num_iterations - 2; k >= 0; k--) {
-        source_down_pyramid[k] =
-                source_down_pyramid[k + 1].VoxelDownSample(voxel_sizes[k]);
-        target_down_pyramid[k] =
-                target_down_pyramid[k + 1].VoxelDownSample(voxel_sizes[k]);
+    target_down_pyramid_ =
+            BuildPointCloudPyramid(target, voxel_sizes_,
+                                   color_gradients_radius_,
+                                   covariance_epsilon_);
+    BuildIndices();
+}
+
+ICPTargetPyramid::~ICPTargetPyramid() {}
+
+void ICPTargetPyramid::AddPoints(const geometry::PointCloud &points) {
+    if (!points.HasPointPositions() ||
+        points.GetPointPositions().GetLength() == 0) {
+        return;
+    }
+    const std::vector<t::geometry::PointCloud> points_down_pyramid =
+            BuildPointCloudPyramid(points, voxel_sizes_,
+                                   color_gradients_radius_,
+                                   covariance_epsilon_);
+    for (int64_t k = 0; k < GetNumScales(); ++k) {
+        target_down_pyramid_[k] =
+                target_down_pyramid_[k].Append(points_down_pyramid[k]);
     }
+    BuildIndices();
+}
 
-    return std::make_tuple(source_down_pyramid, target_down_pyramid);
+const geometry::PointCloud &ICPTargetPyramid::GetPointCloud(
+        int64_t scale_idx) const {
+    if (scale_idx < 0 || scale_idx >= GetNumScales()) {
+        utility::LogError("Scale index {} out of range [0, {}).", scale_idx,
+                          GetNumScales());
+    }
+    return target_down_pyramid_[scale_idx];
+}
+
+const core::nns::NearestNeighborSearch &
+ICPTargetPyramid::GetNearestNeighborSearch(int64_t scale_idx) const {
+    if (scale_idx < 0 || scale_idx >= GetNumScales()) {
+        utility::LogError("Scale index {} out of range [0, {}).", scale_idx,
+                          GetNumScales());
+    }
+    return *target_nns_[scale_idx];
+}
+
+void ICPTargetPyramid::BuildIndices() {
+    const int64_t num_scales = GetNumScales();
+    target_nns_.resize(num_scales);
+    for (int64_t k = 0; k < num_scales; ++k) {
+        target_nns_[k] = std::make_shared<core::nns::NearestNeighborSearch>(
+                target_down_pyramid_[k].GetPointPositions());
+        if (!target_nns_[k]->HybridIndex(max_correspondence_distances_[k])) {
+            utility::LogError("Index is not set.");
+        }
+    }
 }
 
 static std::tuple<RegistrationResult, int> DoSingleScaleICPIterations(
@@ -272,11 +453,33 @@ static std::tuple<RegistrationResult, int> DoSingleScaleICPIterations(
     double prev_fitness = current_result.fitness_;
     double prev_inlier_rmse = current_result.inlier_rmse_;
     int iteration_count = 0;
+
+    // Stage timings are only measured for the callback. The stream is then
+    // synchronized at the end of each stage, so that asynchronous CUDA work is
+    // accounted to the stage that launched it.
+    const bool timed = static_cast<bool>(callback_after_iteration);
+    double stage_start = 0.0;
+    auto stage_time = [&]() {
+        if (!timed) {
+            return 0.0;
+        }
+        core::cuda::SynchronizeStream(device);
+        const double now = utility::Timer::GetSystemTimeInMilliseconds();
+        const double elapsed = now - stage_start;
+        stage_start = now;
+        return elapsed;
+    };
+
     for (iteration_count = 0; iteration_count < criteria.max_iteration_;
          ++iteration_count) {
-        result = ComputeRegistrationResult(
-                source.GetPointPositions(), target_nns,
-                max_correspondence_distance, result.transformation_);
+        stage_time();
+        {
+            OPEN3D_TRACE_ZONE("ICP::CorrespondenceSearch");
+            result = ComputeRegistrationResult(
+                    source.GetPointPositions(), target_nns,
+                    max_correspondence_distance, result.transformation_);
+        }
+        const double correspondence_search_time = stage_time();
 
         if (result.fitness_ <= std::numeric_limits<double>::min()) {
             return std::make_tuple(result,
@@ -286,17 +489,25 @@ static std::tuple<RegistrationResult, int> DoSingleScaleICPIterations(
         // Computing Transform between source and target, given
         // correspondences. ComputeTransformation returns {4,4} shaped
         // Float64 transformation tensor on CPU device.
-        core::Tensor update =
-                estimation
-                        .ComputeTransformation(source, target,
-                                               result.correspondences_)
-                        .To(core::Float64);
+        core::Tensor update;
+        {
+            OPEN3D_TRACE_ZONE("ICP::Estimation");
+            update = estimation
+                             .ComputeTransformation(source, target,
+                                                    result.correspondences_)
+                             .To(core::Float64);
+        }
+        const double estimation_time = stage_time();
 
         // Multiply the transform to the cumulative transformation (update).
         result.transformation_ = update.Matmul(result.transformation_);
 
         // Apply the transform on source pointcloud.
-        source.Transform(update);
+        {
+            OPEN3D_TRACE_ZONE("ICP::Transform");
+            source.Transform(update);
+        }
+        const double transform_time = stage_time();
 
         utility::LogDebug(
                 "ICP Scale #{:d} Iteration #{:d}: Fitness {:.4f}, RMSE "
@@ -317,7 +528,13 @@ static std::tuple<RegistrationResult, int> DoSingleScaleICPIterations(
                     {"inlier_rmse",
                      core::Tensor::Init<double>(result.inlier_rmse_)},
                     {"fitness", core::Tensor::Init<double>(result.fitness_)},
-                    {"transformation", result.transformation_.To(host)}};
+                    {"transformation", result.transformation_.To(host)},
+                    {"correspondence_search_time",
+                     core::Tensor::Init<double>(correspondence_search_time)},
+                    {"estimation_time",
+                     core::Tensor::Init<double>(estimation_time)},
+                    {"transform_time",
+                     core::Tensor::Init<double>(transform_time)}};
             callback_after_iteration(loss_attribute_map);
         }
 
@@ -357,15 +574,47 @@ RegistrationResult MultiScaleICP(
                              init_source_to_target, estimation, num_scales,
                              device, dtype);
 
-    // Initializing point-cloud by down-sampling and computing required
-    // attributes.
-    std::vector<t::geometry::PointCloud> source_down_pyramid(num_scales);
-    std::vector<t::geometry::PointCloud> target_down_pyramid(num_scales);
-    std::tie(source_down_pyramid, target_down_pyramid) =
-            InitializePointCloudPyramidForMultiScaleICP(
-                    source, target, voxel_sizes,
-                    max_correspondence_distances[num_scales - 1], estimation,
-                    num_scales);
+    // Initializing target point-cloud pyramid by down-sampling and computing
+    // required attributes.
+    const ICPTargetPyramid target_pyramid(
+            target, voxel_sizes, max_correspondence_distances, estimation);
+
+    return MultiScaleICP(source, target_pyramid, criterias,
+                         init_source_to_target, estimation,
+                         callback_after_iteration);
+}
+
+RegistrationResult MultiScaleICP(
+        const geometry::PointCloud &source,
+        const ICPTargetPyramid &target_pyramid,
+        const std::vector<ICPConvergenceCriteria> &criterias,
+        const core::Tensor &init_source_to_target,
+        const TransformationEstimation &estimation,
+        const std::function<
+                void(const std::unordered_map<std::string, core::Tensor> &)>
+                &callback_after_iteration) {
+    OPEN3D_TRACE_ZONE("MultiScaleICP");
+    core::AssertTensorDtypes(source.GetPointPositions(),
+                             {core::Float64, core::Float32});
+
+    const core::Device device = source.GetDevice();
+    const core::Dtype dtype = source.GetPointPositions().GetDtype();
+    const int64_t num_scales = int64_t(criterias.size());
+    const std::vector<double> &voxel_sizes = target_pyramid.GetVoxelSizes();
+    const std::vector<double> &max_correspondence_distances =
+            target_pyramid.GetMaxCorrespondenceDistances();
+
+    // Asseting input parameters.
+    AssertInputMultiScaleICP(
+            source, target_pyramid.GetPointCloud(num_scales - 1), voxel_sizes,
+            criterias, max_correspondence_distances, init_source_to_target,
+            estimation, num_scales, device, dtype);
+
+    // Initializing source point-cloud by down-sampling.
+    std::vector<t::geometry::PointCloud> source_down_pyramid =
+            InitializeSourcePyramidForMultiScaleICP(
+                    source, voxel_sizes, num_scales,
+                    GetCovarianceEpsilon(estimation));
 
     // Transformation tensor is always of shape {4,4}, type Float64 on CPU:0.
     core::Tensor transformation =
@@ -376,21 +625,15 @@ RegistrationResult MultiScaleICP(
     // ---- Iterating over different resolution scale START -------------------
     for (int64_t scale_idx = 0; scale_idx < num_scales; ++scale_idx) {
         source_down_pyramid[scale_idx].Transform(result.transformation_);
-        // Initialize Neighbor Search.
-        core::nns::NearestNeighborSearch target_nns(
-                target_down_pyramid[scale_idx].GetPointPositions());
-        bool check =
-                target_nns.HybridIndex(max_correspondence_distances[scale_idx]);
-        if (!check) {
-            utility::LogError("Index is not set.");
-        }
+        const core::nns::NearestNeighborSearch &target_nns =
+                target_pyramid.GetNearestNeighborSearch(scale_idx);
 
         // ICP iterations result for single scale.
         std::tie(result, iteration_count) = DoSingleScaleICPIterations(
-                source_down_pyramid[scale_idx], target_down_pyramid[scale_idx],
-                target_nns, criterias[scale_idx],
-                max_correspondence_distances[scale_idx], estimation, scale_idx,
-                iteration_count, device, dtype, result,
+                source_down_pyramid[scale_idx],
+                target_pyramid.GetPointCloud(scale_idx), target_nns,
+                criterias[scale_idx], max_correspondence_distances[scale_idx],
+                estimation, scale_idx, iteration_count, device, dtype, result,
                 callback_after_iteration);
 
         // To calculate final `fitness` and `inlier_rmse` for the current
@@ -412,6 +655,253 @@ RegistrationResult MultiScaleICP(
     return result;
 }
 
+// Applies the i-th transformation of the {N, 4, 4} transformations to the
+// points with pair_ids i.
+static core::Tensor TransformPointsOfPairs(const core::Tensor &points,
+                                           const core::Tensor &transformations,
+                                           const core::Tensor &pair_ids) {
+    const core::Tensor transformations_per_point =
+            transformations.To(points.GetDevice(), points.GetDtype())
+                    .IndexGet({pair_ids});
+    const core::Tensor R =
+            transformations_per_point.Slice(1, 0, 3).Slice(2, 0, 3);
+    const core::Tensor t = transformations_per_point.Slice(1, 0, 3)
+                                   .Slice(2, 3, 4)
+                                   .Reshape({-1, 3});
+    return (R * points.Reshape({-1, 1, 3})).Sum({2}) + t;
+}
+
+std::vector<RegistrationResult> BatchICP(
+        const std::vector<geometry::PointCloud> &sources,
+        const std::vector<geometry::PointCloud> &targets,
+        const double max_correspondence_distance,
+        const std::vector<core::Tensor> &init_source_to_targets,
+        const TransformationEstimationPointToPlane &estimation,
+        const ICPConvergenceCriteria &criteria) {
+    const int64_t num_pairs = static_cast<int64_t>(sources.size());
+    if (num_pairs == 0 || targets.size() != sources.size()) {
+        utility::LogError(
+                "sources and targets must be non-empty and of the same size, "
+                "but got {} and {}.",
+                sources.size(), targets.size());
+    }
+    if (!init_source_to_targets.empty() &&
+        static_cast<int64_t>(init_source_to_targets.size()) != num_pairs) {
+        utility::LogError(
+                "init_source_to_targets must be empty or of the same size as "
+                "sources, but got {} and {}.",
+                init_source_to_targets.size(), num_pairs);
+    }
+    if (max_correspondence_distance <= 0.0) {
+        utility::LogError(
+                " Max correspondence distance must be greater than 0, but"
+                " got {}.",
+                max_correspondence_distance);
+    }
+    if (!sources[0].HasPointPositions()) {
+        utility::LogError("Source and/or Target pointcloud is empty.");
+    }
+    core::AssertTensorDtypes(sources[0].GetPointPositions(),
+                             {core::Float64, core::Float32});
+
+    const core::Device device = sources[0].GetDevice();
+    const core::Dtype dtype = sources[0].GetPointPositions().GetDtype();
+    const core::Device host("CPU:0");
+
+    // Concatenate all pairs, with the initial transformations applied to
+    // the sources.
+    std::vector<core::Tensor> source_positions(num_pairs);
+    std::vector<core::Tensor> target_positions(num_pairs);
+    std::vector<core::Tensor> target_normals(num_pairs);
+    std::vector<int64_t> source_splits(num_pairs + 1, 0);
+    std::vector<int64_t> target_splits(num_pairs + 1, 0);
+    std::vector<int64_t> pair_ids;
+    std::vector<RegistrationResult> results(num_pairs);
+    for (int64_t i = 0; i < num_pairs; ++i) {
+        const geometry::PointCloud &source = sources[i];
+        const geometry::PointCloud &target = targets[i];
+        if (!target.HasPointPositions() || !source.HasPointPositions()) {
+            utility::LogError("Source and/or Target pointcloud is empty.");
+        }
+        if (!target.HasPointNormals()) {
+            utility::LogError(
+                    "TransformationEstimationPointToPlane require "
+                    "pre-computed normal vectors for target PointCloud.");
+        }
+        core::AssertTensorDtype(source.GetPointPositions(), dtype);
+        core::AssertTensorDtype(target.GetPointPositions(), dtype);
+        core::AssertTensorDevice(source.GetPointPositions(), device);
+        core::AssertTensorDevice(target.GetPointPositions(), device);
+
+        if (!init_source_to_targets.empty()) {
+            core::AssertTensorShape(init_source_to_targets[i], {4, 4});
+            results[i].transformation_ =
+                    init_source_to_targets[i].To(host, core::Float64);
+        }
+
+        source_positions[i] =
+                geometry::PointCloud(source.GetPointPositions().Clone())
+                        .Transform(results[i].transformation_)
+                        .GetPointPositions();
+        target_positions[i] = target.GetPointPositions();
+        target_normals[i] = target.GetPointNormals();
+
+        const int64_t num_source_points =
+                source.GetPointPositions().GetLength();
+        source_splits[i + 1] = source_splits[i] + num_source_points;
+        target_splits[i + 1] =
+                target_splits[i] + target.GetPointPositions().GetLength();
+        pair_ids.insert(pair_ids.end(), num_source_points, i);
+    }
+
+    // Concatenate splits a single tensor along its length, so a single pair
+    // is used as is.
+    auto concatenate = [](const std::vector<core::Tensor> &tensors) {
+        return tensors.size() == 1 ? tensors[0].Contiguous()
+                                   : core::Concatenate(tensors);
+    };
+    core::Tensor source_points = concatenate(source_positions);
+    const core::Tensor target_points = concatenate(target_positions);
+    const core::Tensor target_points_normals = concatenate(target_normals);
+    const core::Tensor source_row_splits(source_splits, {num_pairs + 1},
+                                         core::Int64, host);
+    const core::Tensor target_row_splits(target_splits, {num_pairs + 1},
+                                         core::Int64, host);
+    const core::Tensor pair_ids_tensor =
+            core::Tensor(pair_ids, {source_points.GetLength()}, core::Int64,
+                         host)
+                    .To(device);
+
+    // Pairs are kept apart in the search index by the row splits.
+    core::nns::FixedRadiusIndex target_index;
+    if (!target_index.SetTensorData(target_points, target_row_splits,
+                                    max_correspondence_distance,
+                                    core::Int64)) {
+        utility::LogError("Index is not set.");
+    }
+
+    std::vector<double> prev_fitness(num_pairs, 0.0);
+    std::vector<double> prev_inlier_rmse(num_pairs, 0.0);
+    std::vector<bool> active(num_pairs, true);
+    int64_t num_active = num_pairs;
+    for (int iteration_count = 0;
+         iteration_count < criteria.max_iteration_ && num_active > 0;
+         ++iteration_count) {
+        core::Tensor correspondences, distances, counts;
+        std::tie(correspondences, distances, counts) =
+                target_index.SearchHybrid(source_points, source_row_splits,
+                                          max_correspondence_distance, 1);
+        correspondences = correspondences.Reshape({-1});
+
+        core::Tensor poses, squared_errors, inlier_counts;
+        std::tie(poses, squared_errors, inlier_counts) =
+                kernel::ComputePosePointToPlaneBatched(
+                        source_points, target_points, target_points_normals,
+                        correspondences, source_row_splits, estimation.kernel_);
+        const double *squared_errors_ptr = squared_errors.GetDataPtr<double>();
+        const int64_t *inlier_counts_ptr = inlier_counts.GetDataPtr<int64_t>();
+
+        // Updates of converged and inactive pairs stay identity.
+        core::Tensor updates = core::Tensor::Eye(4, core::Float64, host)
+                                       .Reshape({1, 4, 4})
+                                       .Expand({num_pairs, 4, 4})
+                                       .Contiguous();
+        for (int64_t i = 0; i < num_pairs; ++i) {
+            if (!active[i]) {
+                continue;
+            }
+            RegistrationResult &result = results[i];
+            const double num_correspondences =
+                    static_cast<double>(inlier_counts_ptr[i]);
+            if (num_correspondences == 0) {
+                active[i] = false;
+                --num_active;
+                continue;
+            }
+            result.fitness_ = num_correspondences /
+                              static_cast<double>(source_splits[i + 1] -
+                                                  source_splits[i]);
+            result.inlier_rmse_ =
+                    std::sqrt(squared_errors_ptr[i] / num_correspondences);
+
+            const core::Tensor update =
+                    kernel::PoseToTransformation(poses[i]);
+            result.transformation_ = update.Matmul(result.transformation_);
+            updates[i] = update;
+
+            // ICPConvergenceCriteria, to terminate iteration.
+            if (iteration_count != 0 &&
+                std::abs(prev_fitness[i] - result.fitness_) <
+                        criteria.relative_fitness_ &&
+                std::abs(prev_inlier_rmse[i] - result.inlier_rmse_) <
+                        criteria.relative_rmse_) {
+                active[i] = false;
+                --num_active;
+            }
+            prev_fitness[i] = result.fitness_;
+            prev_inlier_rmse[i] = result.inlier_rmse_;
+        }
+
+        utility::LogDebug("BatchICP Iteration #{:d}: {:d} of {:d} pairs active",
+                          iteration_count, num_active, num_pairs);
+
+        source_points =
+                TransformPointsOfPairs(source_points, updates, pair_ids_tensor);
+    }
+
+    // To calculate final `fitness`, `inlier_rmse` and `correspondences` for the
+    // current `transformation` of each pair.
+    core::Tensor correspondences, distances, counts;
+    std::tie(correspondences, distances, counts) =
+            target_index.SearchHybrid(source_points, source_row_splits,
+                                      max_correspondence_distance, 1);
+    correspondences = correspondences.Reshape({-1});
+    const core::Tensor distances_host =
+            distances.Reshape({-1}).To(host, core::Float64);
+    const core::Tensor counts_host = counts.To(host, core::Int64);
+    const double *distances_ptr = distances_host.GetDataPtr<double>();
+    const int64_t *counts_ptr = counts_host.GetDataPtr<int64_t>();
+    for (int64_t i = 0; i < num_pairs; ++i) {
+        RegistrationResult &result = results[i];
+        double num_correspondences = 0.0;
+        double squared_error = 0.0;
+        for (int64_t j = source_splits[i]; j < source_splits[i + 1]; ++j) {
+            num_correspondences += static_cast<double>(counts_ptr[j]);
+            squared_error += distances_ptr[j];
+        }
+
+        // Map the correspondences back to the indices of the target of the
+        // pair, keeping -1 for points without correspondence.
+        const core::Tensor pair_correspondences =
+                correspondences.Slice(0, source_splits[i],
+                                      source_splits[i + 1]);
+        result.correspondences_ =
+                (pair_correspondences -
+                 pair_correspondences.Ne(-1).To(core::Int64) * target_splits[i])
+                        .Reshape({-1, 1});
+
+        if (num_correspondences != 0) {
+            result.fitness_ = num_correspondences /
+                              static_cast<double>(source_splits[i + 1] -
+                                                  source_splits[i]);
+            result.inlier_rmse_ =
+                    std::sqrt(squared_error / num_correspondences);
+        } else {
+            // Case of no-correspondences.
+            utility::LogWarning(
+                    "0 correspondence present between the pointclouds of pair "
+                    "{}. Try increasing the max_correspondence_distance "
+                    "parameter.",
+                    i);
+            result.fitness_ = 0.0;
+            result.inlier_rmse_ = 0.0;
+            result.transformation_ = core::Tensor::Eye(4, core::Float64, host);
+        }
+    }
+
+    return results;
+}
+
 core::Tensor GetInformationMatrix(const geometry::PointCloud &source,
                                   const geometry::PointCloud &target,
                                   const double max_correspondence_distance,
@@ -26,6 +26,7 @@
 
 #pragma once
 
+#include <memory>
 #include <tuple>
 #include <vector>
 
@@ -34,6 +35,12 @@
 #include "open3d/t/pipelines/registration/TransformationEstimation.h"
 
 namespace open3d {
+namespace core {
+namespace nns {
+class NearestNeighborSearch;
+}
+}  // namespace core
+
 namespace t {
 
 namespace geometry {
@@ -144,7 +151,9 @@ RegistrationResult EvaluateRegistration(
 /// \param callback_after_iteration Optional lambda function, saves string to
 /// tensor map of attributes such as "iteration_index", "scale_index",
 /// "scale_iteration_index", "inlier_rmse", "fitness", "transformation", on CPU
-/// device, updated after each iteration.
+/// device, updated after each iteration. The wall time in milliseconds of the
+/// iteration's stages is reported as "correspondence_search_time",
+/// "estimation_time" (residuals, reduction and solve) and "transform_time".
 RegistrationResult
 ICP(const geometry::PointCloud &source,
     const geometry::PointCloud &target,
@@ -182,7 +191,9 @@ ICP(const geometry::PointCloud &source,
 /// \param callback_after_iteration Optional lambda function, saves string to
 /// tensor map of attributes such as "iteration_index", "scale_index",
 /// "scale_iteration_index", "inlier_rmse", "fitness", "transformation", on CPU
-/// device, updated after each iteration.
+/// device, updated after each iteration. The wall time in milliseconds of the
+/// iteration's stages is reported as "correspondence_search_time",
+/// "estimation_time" (residuals, reduction and solve) and "transform_time".
 RegistrationResult MultiScaleICP(
         const geometry::PointCloud &source,
         const geometry::PointCloud &target,
@@ -197,6 +208,129 @@ RegistrationResult MultiScaleICP(
                 void(const std::unordered_map<std::string, core::Tensor> &)>
                 &callback_after_iteration = nullptr);
 
+/// \class ICPTargetPyramid
+///
+/// \brief Class that holds the downsampled target point clouds and their
+/// nearest neighbor search indices for each scale of MultiScaleICP, so that
+/// they can be built once and reused across calls, e.g. for frame-to-map
+/// tracking where the target changes slowly.
+class ICPTargetPyramid {
+public:
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param target The target point cloud. (Float32 or Float64 type).
+    /// \param voxel_sizes VectorDouble of voxel scales in strictly decreasing
+    /// order. Only the last value can be {-1}, to use the original scale.
+    /// \param max_correspondence_distances VectorDouble of maximum
+    /// correspondence points-pair distances for each scale, used as the radius
+    /// of the search indices. Must be of same length as voxel_sizes.
+    /// \param estimation Estimation method the pyramid is used with. Color
+    /// gradients are computed for ColoredICP and covariances for
+    /// GeneralizedICP if the target does not have them.
+    ICPTargetPyramid(const geometry::PointCloud &target,
+                     const std::vector<double> &voxel_sizes,
+                     const std::vector<double> &max_correspondence_distances,
+                     const TransformationEstimation &estimation =
+                             TransformationEstimationPointToPoint());
+    ~ICPTargetPyramid();
+
+    /// \brief Appends points to the target, e.g. newly observed points of a
+    /// map. Only the new points are downsampled, and the search indices are
+    /// rebuilt. The points must have the same attributes as the target, except
+    /// for color gradients and covariances computed by the pyramid, which are
+    /// estimated from the added points.
+    void AddPoints(const geometry::PointCloud &points);
+
+    /// Returns the number of scales.
+    int64_t GetNumScales() const {
+        return static_cast<int64_t>(voxel_sizes_.size());
+    }
+    const std::vector<double> &GetVoxelSizes() const { return voxel_sizes_; }
+    const std::vector<double> &GetMaxCorrespondenceDistances() const {
+        return max_correspondence_distances_;
+    }
+    /// Returns the target point cloud of the scale, coarsest first.
+    const geometry::PointCloud &GetPointCloud(int64_t scale_idx) const;
+    /// Returns the search index over the target point cloud of the scale.
+    const core::nns::NearestNeighborSearch &GetNearestNeighborSearch(
+            int64_t scale_idx) const;
+
+private:
+    void BuildIndices();
+
+    std::vector<double> voxel_sizes_;
+    std::vector<double> max_correspondence_distances_;
+    /// Search radius for the color gradients of ColoredICP, or 0 if the
+    /// pyramid does not compute them.
+    double color_gradients_radius_;
+    /// Epsilon of the GeneralizedICP covariances, or 0 if the pyramid does not
+    /// compute them.
+    double covariance_epsilon_;
+    std::vector<geometry::PointCloud> target_down_pyramid_;
+    std::vector<std::shared_ptr<core::nns::NearestNeighborSearch>> target_nns_;
+};
+
+/// \brief Functions for Multi-Scale ICP registration against a prebuilt
+/// target pyramid. Same as MultiScaleICP, except that the voxel sizes and
+/// maximum correspondence distances are the ones of \p target_pyramid, and
+/// the target is neither downsampled nor indexed again.
+///
+/// \param source The source point cloud. (Float32 or Float64 type).
+/// \param target_pyramid The target pyramid, of same dtype and device as the
+/// source.
+/// \param criteria_list Vector of ICPConvergenceCriteria objects for each
+/// scale.
+/// \param init_source_to_target Initial transformation estimation of type
+/// Float64 on CPU.
+/// \param estimation Estimation method.
+/// \param callback_after_iteration Optional lambda function, saves string to
+/// tensor map of attributes such as "iteration_index", "scale_index",
+/// "scale_iteration_index", "inlier_rmse", "fitness", "transformation", on CPU
+/// device, updated after each iteration. The wall time in milliseconds of the
+/// iteration's stages is reported as "correspondence_search_time",
+/// "estimation_time" (residuals, reduction and solve) and "transform_time".
+RegistrationResult MultiScaleICP(
+        const geometry::PointCloud &source,
+        const ICPTargetPyramid &target_pyramid,
+        const std::vector<ICPConvergenceCriteria> &criteria_list,
+        const core::Tensor &init_source_to_target =
+                core::Tensor::Eye(4, core::Float64, core::Device("CPU:0")),
+        const TransformationEstimation &estimation =
+                TransformationEstimationPointToPoint(),
+        const std::function<
+                void(const std::unordered_map<std::string, core::Tensor> &)>
+                &callback_after_iteration = nullptr);
+
+/// \brief Functions for batched ICP registration of many source / target
+/// pairs with the point to plane method. Correspondence search, the linear
+/// system reductions and the convergence tests run for all pairs in lockstep,
+/// so the number of kernel launches per iteration does not depend on the
+/// number of pairs. A pair stops being updated once it converges, has no
+/// correspondences or yields a singular linear system, and the iterations
+/// stop once all pairs are done or after `criteria.max_iteration_`
+/// iterations.
+///
+/// \param sources The source point clouds. (Float32 or Float64 type, all of
+/// the same dtype and on the same device).
+/// \param targets The target point clouds with normals, of the same length,
+/// dtype and device as \p sources.
+/// \param max_correspondence_distance Maximum correspondence points-pair
+/// distance.
+/// \param init_source_to_targets Initial transformation estimations of type
+/// Float64 on CPU, one per pair. If empty, identity is used for all pairs.
+/// \param estimation Point to plane estimation method, providing the robust
+/// kernel.
+/// \param criteria Convergence criteria, applied to each pair.
+/// \return Registration results, one per pair.
+std::vector<RegistrationResult> BatchICP(
+        const std::vector<geometry::PointCloud> &sources,
+        const std::vector<geometry::PointCloud> &targets,
+        const double max_correspondence_distance,
+        const std::vector<core::Tensor> &init_source_to_targets = {},
+        const TransformationEstimationPointToPlane &estimation =
+                TransformationEstimationPointToPlane(),
+        const ICPConvergenceCriteria &criteria = ICPConvergenceCriteria());
+
 /// \brief Computes `Information Matrix`, from the transformation between source
 /// and target pointcloud. It returns the `Information Matrix` of shape {6, 6},
 /// of dtype `Float64` on device `CPU:0`.
@@ -317,6 +317,126 @@ core::Tensor TransformationEstimationForColoredICP::ComputeTransformation(
     return transform;
 }
 
+static void AssertInputGeneralizedICP(const geometry::PointCloud &source,
+                                      const geometry::PointCloud &target) {
+    if (!target.HasPointPositions() || !source.HasPointPositions()) {
+        utility::LogError("Source and/or Target pointcloud is empty.");
+    }
+    if (!target.HasPointAttr("covariances") ||
+        !source.HasPointAttr("covariances")) {
+        utility::LogError(
+                "Source and/or Target pointcloud missing covariances "
+                "attribute.");
+    }
+
+    core::AssertTensorDtypes(source.GetPointPositions(),
+                             {core::Float64, core::Float32});
+    const core::Dtype dtype = source.GetPointPositions().GetDtype();
+    core::AssertTensorDtype(target.GetPointPositions(), dtype);
+    core::AssertTensorDtype(source.GetPointAttr("covariances"), dtype);
+    core::AssertTensorDtype(target.GetPointAttr("covariances"), dtype);
+    core::AssertTensorShape(
+            source.GetPointAttr("covariances"),
+            {source.GetPointPositions().GetLength(), 3, 3});
+    core::AssertTensorShape(
+            target.GetPointAttr("covariances"),
+            {target.GetPointPositions().GetLength(), 3, 3});
+
+    core::AssertTensorDevice(target.GetPointPositions(), source.GetDevice());
+}
+
+double TransformationEstimationForGeneralizedICP::ComputeRMSE(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        const core::Tensor &correspondences) const {
+    AssertInputGeneralizedICP(source, target);
+    AssertValidCorrespondences(correspondences, source.GetPointPositions());
+
+    core::Tensor valid = correspondences.Ne(-1).Reshape({-1});
+    core::Tensor neighbour_indices =
+            correspondences.IndexGet({valid}).Reshape({-1});
+    if (neighbour_indices.GetLength() == 0) {
+        return 0.0;
+    }
+
+    const core::Tensor d =
+            source.GetPointPositions().IndexGet({valid}) -
+            target.GetPointPositions().IndexGet({neighbour_indices});
+    const core::Tensor M =
+            source.GetPointAttr("covariances").IndexGet({valid}) +
+            target.GetPointAttr("covariances").IndexGet({neighbour_indices});
+
+    // d^T M^-1 d = d^T adj(M) d / det(M), as M is symmetric.
+    auto m = [&M](int64_t i, int64_t j) {
+        return M.IndexExtract(2, j).IndexExtract(1, i);
+    };
+    const core::Tensor a00 = m(1, 1) * m(2, 2) - m(1, 2) * m(1, 2);
+    const core::Tensor a01 = m(0, 2) * m(1, 2) - m(0, 1) * m(2, 2);
+    const core::Tensor a02 = m(0, 1) * m(1, 2) - m(0, 2) * m(1, 1);
+    const core::Tensor a11 = m(0, 0) * m(2, 2) - m(0, 2) * m(0, 2);
+    const core::Tensor a12 = m(0, 1) * m(0, 2) - m(0, 0) * m(1, 2);
+    const core::Tensor a22 = m(0, 0) * m(1, 1) - m(0, 1) * m(0, 1);
+    const core::Tensor det = m(0, 0) * a00 + m(0, 1) * a01 + m(0, 2) * a02;
+
+    const core::Tensor x = d.IndexExtract(1, 0);
+    const core::Tensor y = d.IndexExtract(1, 1);
+    const core::Tensor z = d.IndexExtract(1, 2);
+    const core::Tensor error_t =
+            (x * x * a00 + y * y * a11 + z * z * a22 +
+             (x * y * a01 + x * z * a02 + y * z * a12) * 2.0) /
+            det;
+
+    double error = error_t.Sum({0}).To(core::Float64).Item<double>();
+    return std::sqrt(error /
+                     static_cast<double>(neighbour_indices.GetLength()));
+}
+
+core::Tensor TransformationEstimationForGeneralizedICP::ComputeTransformation(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        const core::Tensor &correspondences) const {
+    AssertInputGeneralizedICP(source, target);
+    AssertValidCorrespondences(correspondences, source.GetPointPositions());
+
+    const core::Dtype dtype = source.GetPointPositions().GetDtype();
+    core::Tensor source_colors, target_normals, target_colors,
+            target_color_gradients;
+    if (HasPhotometricTerm()) {
+        if (!target.HasPointColors() || !source.HasPointColors()) {
+            utility::LogError(
+                    "Source and/or Target pointcloud missing colors "
+                    "attribute.");
+        }
+        if (!target.HasPointNormals()) {
+            utility::LogError("Target pointcloud missing normals attribute.");
+        }
+        if (!target.HasPointAttr("color_gradients")) {
+            utility::LogError(
+                    "Target pointcloud missing color_gradients attribute.");
+        }
+        source_colors = source.GetPointColors();
+        target_normals = target.GetPointNormals();
+        target_colors = target.GetPointColors();
+        target_color_gradients = target.GetPointAttr("color_gradients");
+        core::AssertTensorDtype(source_colors, dtype);
+        core::AssertTensorDtype(target_normals, dtype);
+        core::AssertTensorDtype(target_colors, dtype);
+        core::AssertTensorDtype(target_color_gradients, dtype);
+    }
+
+    // Get pose {6} of type Float64. The geometric and the photometric terms
+    // share the correspondences and are reduced into one linear system.
+    core::Tensor pose = pipelines::kernel::ComputePoseGeneralizedICP(
+            source.GetPointPositions(), source.GetPointAttr("covariances"),
+            source_colors, target.GetPointPositions(),
+            target.GetPointAttr("covariances"), target_normals, target_colors,
+            target_color_gradients, correspondences, this->kernel_,
+            this->lambda_geometric_);
+
+    // Get transformation {4,4} of type Float64 from pose {6}.
+    return pipelines::kernel::PoseToTransformation(pose);
+}
+
 }  // namespace registration
 }  // namespace pipelines
 }  // namespace t
@@ -51,6 +51,7 @@ enum class TransformationEstimationType {
     PointToPoint = 1,
     PointToPlane = 2,
     ColoredICP = 3,
+    GeneralizedICP = 4,
 };
 
 /// \class TransformationEstimation
@@ -286,6 +287,108 @@ private:
             TransformationEstimationType::ColoredICP;
 };
 
+/// \class TransformationEstimationForGeneralizedICP
+///
+/// This is implementation of following paper
+/// A. Segal, D. Haehnel, S. Thrun,
+/// Generalized-ICP, RSS 2009.
+///
+/// Class to estimate a transformation matrix tensor of shape {4, 4}, dtype
+/// Float64, on CPU device for generalized-icp method. The per-point covariances
+/// are read from the {N, 3, 3} "covariances" attribute of the point clouds, so
+/// that they are computed once and reused across iterations. The ICP functions
+/// compute them from the point normals if the attribute is missing.
+///
+/// If `lambda_geometric` < 1, the photometric term of Colored-ICP is added to
+/// the energy `λEG + (1−λ)EC`, evaluated on the same correspondences and
+/// reduced in the same pass as the geometric term.
+class TransformationEstimationForGeneralizedICP
+    : public TransformationEstimation {
+public:
+    ~TransformationEstimationForGeneralizedICP() override{};
+
+    /// \brief Constructor.
+    ///
+    /// \param epsilon Small constant representing covariance along the normal.
+    /// \param kernel (optional) Any of the implemented statistical robust
+    /// kernel for outlier rejection. It is evaluated on the Mahalanobis
+    /// distance of each correspondence.
+    /// \param lambda_geometric `λ ∈ [0,1]` in the overall energy `λEG +
+    /// (1−λ)EC`. The default of 1 disables the photometric term.
+    explicit TransformationEstimationForGeneralizedICP(
+            double epsilon = 1e-3,
+            const RobustKernel &kernel =
+                    RobustKernel(RobustKernelMethod::L2Loss, 1.0, 1.0),
+            double lambda_geometric = 1.0)
+        : epsilon_(epsilon),
+          kernel_(kernel),
+          lambda_geometric_(lambda_geometric) {
+        if (lambda_geometric_ < 0 || lambda_geometric_ > 1.0) {
+            lambda_geometric_ = 1.0;
+        }
+    }
+
+    TransformationEstimationType GetTransformationEstimationType()
+            const override {
+        return type_;
+    };
+
+    /// Returns true if the photometric term is part of the energy.
+    bool HasPhotometricTerm() const { return lambda_geometric_ < 1.0; }
+
+public:
+    /// \brief Computes RMSE (double) for GeneralizedICP method, between two
+    /// pointclouds, given correspondences. The error of a correspondence is
+    /// its Mahalanobis distance under the sum of the source and target
+    /// covariances.
+    ///
+    /// \param source Source pointcloud. (Float32 or Float64 type). It must
+    /// contain covariances of shape {N, 3, 3} and the same dtype as the
+    /// positions.
+    /// \param target Target pointcloud. (Float32 or Float64 type). It must
+    /// contain covariances of shape {N, 3, 3} and the same dtype as the
+    /// positions.
+    /// \param correspondences Tensor of type Int64 containing indices of
+    /// corresponding target points, where the value is the target index and the
+    /// index of the value itself is the source index. It contains -1 as value
+    /// at index with no correspondence.
+    double ComputeRMSE(const geometry::PointCloud &source,
+                       const geometry::PointCloud &target,
+                       const core::Tensor &correspondences) const override;
+
+    /// \brief Estimates the transformation matrix for GeneralizedICP method,
+    /// a tensor of shape {4, 4}, and dtype Float64 on CPU device.
+    ///
+    /// \param source Source pointcloud. (Float32 or Float64 type). It must
+    /// contain covariances of shape {N, 3, 3} and the same dtype as the
+    /// positions, and colors if the photometric term is used.
+    /// \param target Target pointcloud. (Float32 or Float64 type). It must
+    /// contain covariances of shape {N, 3, 3} and the same dtype as the
+    /// positions, and normals, colors and color_gradients if the photometric
+    /// term is used.
+    /// \param correspondences Tensor of type Int64 containing indices of
+    /// corresponding target points, where the value is the target index and the
+    /// index of the value itself is the source index. It contains -1 as value
+    /// at index with no correspondence.
+    /// \return transformation between source to target, a tensor of shape {4,
+    /// 4}, type Float64 on CPU device.
+    core::Tensor ComputeTransformation(
+            const geometry::PointCloud &source,
+            const geometry::PointCloud &target,
+            const core::Tensor &correspondences) const override;
+
+public:
+    /// Small constant representing covariance along the normal.
+    double epsilon_ = 1e-3;
+    /// RobustKernel for outlier rejection.
+    RobustKernel kernel_ = RobustKernel(RobustKernelMethod::L2Loss, 1.0, 1.0);
+    double lambda_geometric_ = 1.0;
+
+private:
+    const TransformationEstimationType type_ =
+            TransformationEstimationType::GeneralizedICP;
+};
+
 }  // namespace registration
 }  // namespace pipelines
 }  // namespace t
@@ -0,0 +1,173 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/t/pipelines/scheduler/FragmentPipeline.h"
+
+#include <algorithm>
+
+#include "open3d/t/geometry/Image.h"
+#include "open3d/t/geometry/RGBDImage.h"
+#include "open3d/t/geometry/VoxelBlockGrid.h"
+#include "open3d/t/io/ImageIO.h"
+#include "open3d/t/pipelines/scheduler/TaskGraph.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace scheduler {
+
+static geometry::Image ReadImageToDevice(const std::string& filename,
+                                         const core::Device& device) {
+    geometry::Image image;
+    if (!io::ReadImage(filename, image)) {
+        utility::LogError("Unable to read image {}.", filename);
+    }
+    return image.To(device);
+}
+
+std::vector<FragmentResult> MakeFragments(
+        const std::vector<std::string>& color_filenames,
+        const std::vector<std::string>& depth_filenames,
+        const core::Tensor& intrinsic,
+        const std::vector<core::Device>& devices,
+        const FragmentPipelineOption& option,
+        int num_cpu_workers) {
+    if (color_filenames.size() != depth_filenames.size()) {
+        utility::LogError(
+                "Numbers of color ({}) and depth ({}) images mismatch.",
+                color_filenames.size(), depth_filenames.size());
+    }
+    if (option.frames_per_fragment_ <= 0) {
+        utility::LogError("frames_per_fragment must be positive, but got {}.",
+                          option.frames_per_fragment_);
+    }
+    core::AssertTensorShape(intrinsic, {3, 3});
+
+    const int n_frames = static_cast<int>(depth_filenames.size());
+    const int n_fragments = (n_frames + option.frames_per_fragment_ - 1) /
+                            option.frames_per_fragment_;
+    const core::Tensor intrinsic_host =
+            intrinsic.To(core::Device("CPU:0"), core::Float64);
+
+    core::Device::DeviceType device_type = core::Device::DeviceType::CPU;
+    for (const core::Device& device : devices) {
+        if (device.GetType() == core::Device::DeviceType::CUDA) {
+            device_type = core::Device::DeviceType::CUDA;
+        }
+    }
+
+    std::vector<FragmentResult> results(n_fragments);
+    // odometry[f][k] is the transformation from frame k to frame k + 1 of
+    // fragment f.
+    std::vector<std::vector<core::Tensor>> odometry(n_fragments);
+
+    TaskGraph graph;
+    for (int f = 0; f < n_fragments; ++f) {
+        const int start = f * option.frames_per_fragment_;
+        const int end = std::min(start + option.frames_per_fragment_, n_frames);
+        results[f].start_frame_ = start;
+        odometry[f].resize(end - start - 1);
+
+        std::vector<int> odometry_tasks;
+        for (int i = start; i + 1 < end; ++i) {
+            odometry_tasks.push_back(graph.AddTask(
+                    [&, f, start, i](const core::Device& device) {
+                        geometry::RGBDImage source(
+                                ReadImageToDevice(color_filenames[i], device),
+                                ReadImageToDevice(depth_filenames[i], device));
+                        geometry::RGBDImage target(
+                                ReadImageToDevice(color_filenames[i + 1],
+                                                  device),
+                                ReadImageToDevice(depth_filenames[i + 1],
+                                                  device));
+                        odometry[f][i - start] =
+                                odometry::RGBDOdometryMultiScale(
+                                        source, target, intrinsic_host,
+                                        core::Tensor::Eye(
+                                                4, core::Float64,
+                                                core::Device("CPU:0")),
+                                        option.depth_scale_, option.depth_max_,
+                                        option.criteria_list_, option.method_,
+                                        option.params_)
+                                        .transformation_;
+                    },
+                    {}, device_type));
+        }
+
+        graph.AddTask(
+                [&, f, start, end](const core::Device& device) {
+                    FragmentResult& result = results[f];
+                    result.poses_.push_back(core::Tensor::Eye(
+                            4, core::Float64, core::Device("CPU:0")));
+                    for (const core::Tensor& T_source_to_target :
+                         odometry[f]) {
+                        result.poses_.push_back(result.poses_.back().Matmul(
+                                T_source_to_target.Inverse()));
+                    }
+
+                    geometry::VoxelBlockGrid voxel_grid(
+                            {"tsdf", "weight", "color"},
+                            {core::Float32, core::UInt16, core::UInt16},
+                            {{1}, {1}, {3}}, option.voxel_size_,
+                            option.block_resolution_, option.block_count_,
+                            device);
+                    for (int i = start; i < end; ++i) {
+                        geometry::Image depth =
+                                ReadImageToDevice(depth_filenames[i], device);
+                        geometry::Image color =
+                                ReadImageToDevice(color_filenames[i], device);
+                        core::Tensor extrinsic =
+                                result.poses_[i - start].Inverse();
+                        core::Tensor block_coords =
+                                voxel_grid.GetUniqueBlockCoordinates(
+                                        depth, intrinsic_host, extrinsic,
+                                        option.depth_scale_, option.depth_max_,
+                                        option.trunc_voxel_multiplier_);
+                        voxel_grid.Integrate(
+                                block_coords, depth, color, intrinsic_host,
+                                extrinsic, option.depth_scale_,
+                                option.depth_max_,
+                                option.trunc_voxel_multiplier_);
+                    }
+                    result.pointcloud_ =
+                            voxel_grid
+                                    .ExtractPointCloud(option.weight_threshold_)
+                                    .To(core::Device("CPU:0"));
+                    utility::LogDebug("Fragment {} done on {}.", f,
+                                      device.ToString());
+                },
+                odometry_tasks, device_type);
+    }
+    graph.Run(devices, num_cpu_workers);
+    return results;
+}
+
+}  // namespace scheduler
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
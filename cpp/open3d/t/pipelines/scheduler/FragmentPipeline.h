@@ -0,0 +1,114 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/t/geometry/PointCloud.h"
+#include "open3d/t/pipelines/odometry/RGBDOdometry.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace scheduler {
+
+/// Options of the fragment pipeline of the reconstruction system.
+class FragmentPipelineOption {
+public:
+    FragmentPipelineOption() {}
+
+public:
+    /// Number of consecutive frames in a fragment.
+    int frames_per_fragment_ = 100;
+    /// Voxel size of the voxel block grid of a fragment.
+    float voxel_size_ = 3.0f / 512.0f;
+    int block_resolution_ = 16;
+    int block_count_ = 40000;
+    /// Converts depth pixel values to meters by dividing the scale factor.
+    float depth_scale_ = 1000.0f;
+    /// Max depth to truncate depth image with noisy measurements.
+    float depth_max_ = 3.0f;
+    float trunc_voxel_multiplier_ = 8.0f;
+    /// Weight threshold of the surface points extracted from a fragment.
+    float weight_threshold_ = 3.0f;
+    /// Criteria of the multi-scale odometry, from coarse to fine.
+    std::vector<odometry::OdometryConvergenceCriteria> criteria_list_ = {
+            10, 5, 3};
+    odometry::Method method_ = odometry::Method::Hybrid;
+    odometry::OdometryLossParams params_ = odometry::OdometryLossParams();
+};
+
+/// Output of the fragment pipeline for one fragment.
+class FragmentResult {
+public:
+    FragmentResult() {}
+
+public:
+    /// Index of the first frame of the fragment.
+    int start_frame_ = 0;
+    /// (4, 4) Float64 CPU poses from the frames to the first frame of the
+    /// fragment.
+    std::vector<core::Tensor> poses_;
+    /// Surface points of the fragment on CPU, in the coordinate frame of its
+    /// first frame.
+    geometry::PointCloud pointcloud_;
+};
+
+/// \brief Make fragments from an RGBD sequence, scheduling the work on all
+/// the given devices with a TaskGraph.
+///
+/// The sequence is split into fragments of consecutive frames. The odometry
+/// between each pair of consecutive frames is an independent task running
+/// RGBDOdometryMultiScale. Once all the odometry tasks of a fragment are done,
+/// a task chains the poses and integrates the frames of the fragment into a
+/// VoxelBlockGrid. The tasks of different fragments do not depend on each
+/// other, so fragments are processed concurrently. The tasks run on the CUDA
+/// devices if there are any, otherwise on the CPU worker pool.
+///
+/// \param color_filenames Paths of the color images of the sequence.
+/// \param depth_filenames Paths of the depth images of the sequence.
+/// \param intrinsic (3, 3) Float64 CPU intrinsic matrix.
+/// \param devices Devices to run the tasks on.
+/// \param option Fragment pipeline option.
+/// \param num_cpu_workers Number of worker threads for CPU tasks. Uses the
+/// number of hardware threads if <= 0.
+/// \return Fragment results in the order of the sequence.
+std::vector<FragmentResult> MakeFragments(
+        const std::vector<std::string>& color_filenames,
+        const std::vector<std::string>& depth_filenames,
+        const core::Tensor& intrinsic,
+        const std::vector<core::Device>& devices,
+        const FragmentPipelineOption& option = FragmentPipelineOption(),
+        int num_cpu_workers = 0);
+
+}  // namespace scheduler
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
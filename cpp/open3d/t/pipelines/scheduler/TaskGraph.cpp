@@ -0,0 +1,173 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/t/pipelines/scheduler/TaskGraph.h"
+
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <thread>
+
+#include "open3d/core/CUDAUtils.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace scheduler {
+
+int TaskGraph::AddTask(const TaskFunction& func,
+                       const std::vector<int>& dependencies,
+                       core::Device::DeviceType device_type) {
+    const int task_id = Size();
+    for (int dependency : dependencies) {
+        if (dependency < 0 || dependency >= task_id) {
+            utility::LogError(
+                    "Invalid dependency {} of task {}, dependencies must be "
+                    "added before the task.",
+                    dependency, task_id);
+        }
+    }
+    tasks_.push_back(Task{func, dependencies, device_type});
+    return task_id;
+}
+
+void TaskGraph::Run(const std::vector<core::Device>& devices,
+                    int num_cpu_workers) {
+    const int n_tasks = Size();
+    if (n_tasks == 0) {
+        return;
+    }
+
+    std::vector<core::Device> cuda_devices;
+    for (const core::Device& device : devices) {
+        if (device.GetType() == core::Device::DeviceType::CUDA &&
+            std::find(cuda_devices.begin(), cuda_devices.end(), device) ==
+                    cuda_devices.end()) {
+            cuda_devices.push_back(device);
+        }
+    }
+    if (num_cpu_workers <= 0) {
+        num_cpu_workers = std::max(
+                1, static_cast<int>(std::thread::hardware_concurrency()));
+    }
+
+    // Tasks ready to run, indexed by device type.
+    std::vector<std::deque<int>> ready(2);
+    std::vector<int> n_remaining_dependencies(n_tasks);
+    std::vector<std::vector<int>> dependents(n_tasks);
+    for (int i = 0; i < n_tasks; ++i) {
+        const Task& task = tasks_[i];
+        if (task.device_type_ == core::Device::DeviceType::CUDA &&
+            cuda_devices.empty()) {
+            utility::LogError("Task {} requires a CUDA device, but none is "
+                              "provided.",
+                              i);
+        }
+        n_remaining_dependencies[i] = int(task.dependencies_.size());
+        for (int dependency : task.dependencies_) {
+            dependents[dependency].push_back(i);
+        }
+        if (task.dependencies_.empty()) {
+            ready[int(task.device_type_)].push_back(i);
+        }
+    }
+
+    std::mutex mutex;
+    std::condition_variable cv;
+    int n_done = 0;
+    std::exception_ptr error;
+
+    auto worker = [&](const core::Device& device) {
+        std::deque<int>& queue = ready[int(device.GetType())];
+        std::unique_lock<std::mutex> lock(mutex);
+        while (true) {
+            cv.wait(lock, [&]() {
+                return error || n_done == n_tasks || !queue.empty();
+            });
+            if (error || n_done == n_tasks) {
+                return;
+            }
+            const int task_id = queue.front();
+            queue.pop_front();
+            lock.unlock();
+
+            try {
+#ifdef BUILD_CUDA_MODULE
+                if (device.GetType() == core::Device::DeviceType::CUDA) {
+                    core::CUDAScopedDevice scoped_device(device);
+                    tasks_[task_id].func_(device);
+                } else {
+                    tasks_[task_id].func_(device);
+                }
+#else
+                tasks_[task_id].func_(device);
+#endif
+            } catch (...) {
+                lock.lock();
+                if (!error) {
+                    error = std::current_exception();
+                }
+                cv.notify_all();
+                return;
+            }
+
+            lock.lock();
+            ++n_done;
+            for (int dependent : dependents[task_id]) {
+                if (--n_remaining_dependencies[dependent] == 0) {
+                    ready[int(tasks_[dependent].device_type_)].push_back(
+                            dependent);
+                }
+            }
+            cv.notify_all();
+        }
+    };
+
+    std::vector<std::thread> workers;
+    for (const core::Device& device : cuda_devices) {
+        workers.emplace_back(worker, device);
+    }
+    for (int i = 0; i < num_cpu_workers; ++i) {
+        workers.emplace_back(worker, core::Device("CPU:0"));
+    }
+    for (std::thread& thread : workers) {
+        thread.join();
+    }
+
+    Clear();
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
+
+}  // namespace scheduler
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,108 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#pragma once
+
+#include <functional>
+#include <vector>
+
+#include "open3d/core/Device.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace scheduler {
+
+/// \class TaskGraph
+///
+/// A directed acyclic graph of tasks executed by a pool of worker threads.
+/// Each CUDA device passed to Run is served by one worker thread, and the CPU
+/// device by a configurable number of worker threads. A task is dispatched to
+/// any idle worker of its device type once all of its dependencies are done,
+/// so that independent tasks, e.g. the fragments of a reconstruction, run
+/// concurrently on all the available hardware.
+///
+/// Example:
+/// ```cpp
+/// TaskGraph graph;
+/// int load = graph.AddTask([](const core::Device&) { ... });
+/// int odometry = graph.AddTask(
+///         [](const core::Device& device) { ... }, {load},
+///         core::Device::DeviceType::CUDA);
+/// graph.Run({core::Device("CUDA:0"), core::Device("CUDA:1")});
+/// ```
+class TaskGraph {
+public:
+    /// A task receives the device of the worker it runs on.
+    using TaskFunction = std::function<void(const core::Device& device)>;
+
+    TaskGraph() {}
+
+    /// \brief Add a task to the graph.
+    ///
+    /// \param func Function to execute.
+    /// \param dependencies Ids of the tasks that must be done before \p func
+    /// runs. They must have been added before, which keeps the graph acyclic.
+    /// \param device_type Type of the device the task runs on.
+    /// \return Id of the task.
+    int AddTask(const TaskFunction& func,
+                const std::vector<int>& dependencies = {},
+                core::Device::DeviceType device_type =
+                        core::Device::DeviceType::CPU);
+
+    /// \brief Execute all the tasks and block until they are done. The graph
+    /// is cleared afterwards.
+    ///
+    /// If a task throws, no further task is dispatched, and the first
+    /// exception is rethrown once the running tasks are done.
+    /// \param devices Devices to run the tasks on. CPU tasks run on CPU:0
+    /// even if it is not listed.
+    /// \param num_cpu_workers Number of worker threads for CPU tasks. Uses the
+    /// number of hardware threads if <= 0.
+    void Run(const std::vector<core::Device>& devices = {},
+             int num_cpu_workers = 0);
+
+    /// Number of tasks in the graph.
+    int Size() const { return static_cast<int>(tasks_.size()); }
+
+    /// Remove all the tasks.
+    void Clear() { tasks_.clear(); }
+
+private:
+    struct Task {
+        TaskFunction func_;
+        std::vector<int> dependencies_;
+        core::Device::DeviceType device_type_;
+    };
+
+    std::vector<Task> tasks_;
+};
+
+}  // namespace scheduler
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
@@ -27,7 +27,9 @@
 #include "open3d/t/pipelines/slac/ControlGrid.h"
 
 #include "open3d/core/EigenConverter.h"
+#include "open3d/core/TensorFunction.h"
 #include "open3d/core/hashmap/HashSet.h"
+#include "open3d/t/pipelines/kernel/ControlGrid.h"
 
 namespace open3d {
 namespace t {
@@ -96,10 +98,12 @@ void ControlGrid::Touch(const geometry::PointCloud& pcd) {
     core::Tensor buf_indices, masks;
     ctr_hashmap_->Insert(keys_nb.IndexGet({masks_unique}),
                          vals_nb.IndexGet({masks_unique}), buf_indices, masks);
+    nb_grid_map_valid_ = false;
 }
 
 void ControlGrid::Compactify() {
     ctr_hashmap_->Reserve(ctr_hashmap_->Size() * 2);
+    nb_grid_map_valid_ = false;
 
     core::Tensor active_buf_indices;
     ctr_hashmap_->GetActiveIndices(active_buf_indices);
@@ -132,6 +136,11 @@ void ControlGrid::Compactify() {
 
 std::tuple<core::Tensor, core::Tensor, core::Tensor>
 ControlGrid::GetNeighborGridMap() {
+    if (nb_grid_map_valid_) {
+        return std::make_tuple(nb_grid_active_indices_, nb_grid_indices_,
+                               nb_grid_masks_);
+    }
+
     core::Tensor active_buf_indices;
     ctr_hashmap_->GetActiveIndices(active_buf_indices);
 
@@ -161,9 +170,12 @@ ControlGrid::GetNeighborGridMap() {
     core::Tensor buf_indices_nb, masks_nb;
     ctr_hashmap_->Find(keys_nb, buf_indices_nb, masks_nb);
 
-    return std::make_tuple(active_buf_indices,
-                           buf_indices_nb.View({6, n}).T().Contiguous(),
-                           masks_nb.View({6, n}).T().Contiguous());
+    nb_grid_active_indices_ = active_buf_indices;
+    nb_grid_indices_ = buf_indices_nb.View({6, n}).T().Contiguous();
+    nb_grid_masks_ = masks_nb.View({6, n}).T().Contiguous();
+    nb_grid_map_valid_ = true;
+    return std::make_tuple(nb_grid_active_indices_, nb_grid_indices_,
+                           nb_grid_masks_);
 }
 
 geometry::PointCloud ControlGrid::Parameterize(
@@ -258,52 +270,68 @@ geometry::PointCloud ControlGrid::Parameterize(
 }
 
 geometry::PointCloud ControlGrid::Deform(const geometry::PointCloud& pcd) {
-    if (!pcd.HasPointAttr(kGrid8NbIndices) ||
-        !pcd.HasPointAttr(kGrid8NbVertexInterpRatios)) {
-        utility::LogError(
-                "Please use ControlGrid.Parameterize to obtain attributes "
-                "regarding neighbor grids before calling Deform");
-    }
-
-    // N x 3
-    core::Tensor grid_positions = ctr_hashmap_->GetValueTensor();
-
-    // N x 8, we have ensured that every neighbor is valid through
-    // grid.Parameterize
-    core::Tensor nb_grid_indices =
-            pcd.GetPointAttr(kGrid8NbIndices).To(core::Int64);
-    core::Tensor nb_grid_positions =
-            grid_positions.IndexGet({nb_grid_indices.View({-1})})
-                    .View({-1, 8, 3});
-
-    // (N, 8, 3) x (N, 8, 1) => Reduce on dim 1 => (N, 3) position
-    // interpolation.
-    core::Tensor nb_grid_point_interp =
-            pcd.GetPointAttr(kGrid8NbVertexInterpRatios);
-    core::Tensor interp_positions =
-            (nb_grid_positions * nb_grid_point_interp.View({-1, 8, 1}))
-                    .Sum({1});
-
-    geometry::PointCloud interp_pcd(interp_positions);
+    return Deform(std::vector<geometry::PointCloud>{pcd})[0];
+}
 
-    if (pcd.HasPointNormals()) {
-        // (N, 8, 3) x (N, 8, 1) => Reduce on dim 1 => (N, 3) normal
-        // interpolation.
-        core::Tensor nb_grid_normal_interp =
-                pcd.GetPointAttr(kGrid8NbNormalInterpRatios);
-        core::Tensor interp_normals =
-                (nb_grid_positions * nb_grid_normal_interp.View({-1, 8, 1}))
-                        .Sum({1});
-        core::Tensor interp_normals_len =
-                (interp_normals * interp_normals).Sum({1}).Sqrt();
-        interp_normals = interp_normals / interp_normals_len.View({-1, 1});
-        interp_pcd.SetPointNormals(interp_normals);
+std::vector<geometry::PointCloud> ControlGrid::Deform(
+        const std::vector<geometry::PointCloud>& pcds) {
+    bool has_normals = false;
+    for (const auto& pcd : pcds) {
+        if (!pcd.HasPointAttr(kGrid8NbIndices) ||
+            !pcd.HasPointAttr(kGrid8NbVertexInterpRatios)) {
+            utility::LogError(
+                    "Please use ControlGrid.Parameterize to obtain attributes "
+                    "regarding neighbor grids before calling Deform");
+        }
+        has_normals = has_normals || pcd.HasPointNormals();
+    }
+    if (pcds.empty()) return {};
+
+    std::vector<core::Tensor> nb_indices, point_ratios, normal_ratios;
+    std::vector<int64_t> offsets = {0};
+    for (const auto& pcd : pcds) {
+        nb_indices.push_back(pcd.GetPointAttr(kGrid8NbIndices).To(core::Int32));
+        point_ratios.push_back(pcd.GetPointAttr(kGrid8NbVertexInterpRatios));
+        if (has_normals) {
+            // Normals of the clouds without normals are discarded.
+            normal_ratios.push_back(
+                    pcd.HasPointNormals()
+                            ? pcd.GetPointAttr(kGrid8NbNormalInterpRatios)
+                            : core::Tensor::Ones(point_ratios.back().GetShape(),
+                                                 core::Float32, device_));
+        }
+        offsets.push_back(offsets.back() + nb_indices.back().GetLength());
     }
 
-    if (pcd.HasPointColors()) {
-        interp_pcd.SetPointColors(pcd.GetPointColors());
+    // Concatenate splits a single tensor along its first dimension.
+    auto concatenate = [](const std::vector<core::Tensor>& tensors) {
+        return tensors.size() == 1 ? tensors[0]
+                                   : core::Concatenate(tensors, 0);
+    };
+
+    // Every neighbor is valid through Parameterize, so all the clouds are
+    // interpolated in one pass over the concatenated weights.
+    core::Tensor positions, normals;
+    kernel::DeformWithControlGrid(
+            ctr_hashmap_->GetValueTensor(), concatenate(nb_indices),
+            concatenate(point_ratios),
+            has_normals ? concatenate(normal_ratios) : core::Tensor(),
+            positions, normals);
+
+    std::vector<geometry::PointCloud> interp_pcds;
+    for (size_t i = 0; i < pcds.size(); ++i) {
+        geometry::PointCloud interp_pcd(
+                positions.Slice(0, offsets[i], offsets[i + 1]));
+        if (pcds[i].HasPointNormals()) {
+            interp_pcd.SetPointNormals(
+                    normals.Slice(0, offsets[i], offsets[i + 1]));
+        }
+        if (pcds[i].HasPointColors()) {
+            interp_pcd.SetPointColors(pcds[i].GetPointColors());
+        }
+        interp_pcds.push_back(interp_pcd);
     }
-    return interp_pcd;
+    return interp_pcds;
 }
 
 geometry::Image ControlGrid::Deform(const geometry::Image& depth,
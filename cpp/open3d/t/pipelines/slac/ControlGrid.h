@@ -79,6 +79,8 @@ public:
     void Compactify();
 
     /// Get the neighbor indices per grid to construct the regularizer.
+    /// The map only depends on the allocated grid points, so it is computed
+    /// once and reused until the next Touch or Compactify.
     /// \return A 6-way neighbor grid map for all the active entries of shape
     /// (N, ).
     /// - buf_indices Active indices in the buffer of shape (N, )
@@ -99,6 +101,13 @@ public:
     /// Non-rigidly deform a point cloud using the control grid.
     geometry::PointCloud Deform(const geometry::PointCloud& pcd);
 
+    /// Non-rigidly deform a batch of parameterized point clouds, e.g. all the
+    /// fragments of a scene, in one kernel launch. The interpolation weights
+    /// from Parameterize are reused, so the clouds only need to be
+    /// parameterized once while the grid positions are optimized.
+    std::vector<geometry::PointCloud> Deform(
+            const std::vector<geometry::PointCloud>& pcds);
+
     /// Non-rigidly deform a depth image by
     /// - unprojecting the depth image to a point cloud;
     /// - deform the point cloud;
@@ -143,6 +152,13 @@ private:
 
     core::Device device_ = core::Device("CPU:0");
     std::shared_ptr<core::HashMap> ctr_hashmap_;
+
+    /// Cached result of GetNeighborGridMap, invalidated when the grid points
+    /// are reallocated.
+    bool nb_grid_map_valid_ = false;
+    core::Tensor nb_grid_active_indices_;
+    core::Tensor nb_grid_indices_;
+    core::Tensor nb_grid_masks_;
 };
 
 }  // namespace slac
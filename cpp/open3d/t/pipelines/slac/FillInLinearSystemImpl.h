@@ -29,6 +29,7 @@
 #include <fstream>
 
 #include "open3d/core/EigenConverter.h"
+#include "open3d/core/TensorFunction.h"
 #include "open3d/t/pipelines/kernel/FillInLinearSystem.h"
 #include "open3d/t/pipelines/slac/SLACOptimizer.h"
 #include "open3d/utility/FileSystem.h"
@@ -118,68 +119,41 @@ void FillInRigidAlignmentTerm(Tensor& AtA,
     }
 }
 
-static void FillInSLACAlignmentTerm(Tensor& AtA,
-                                    Tensor& Atb,
-                                    Tensor& residual,
-                                    ControlGrid& ctr_grid,
-                                    const PointCloud& tpcd_param_i,
-                                    const PointCloud& tpcd_param_j,
-                                    const Tensor& Ti,
-                                    const Tensor& Tj,
-                                    const int i,
-                                    const int j,
-                                    const int n_fragments,
-                                    const float threshold) {
-    // Parameterize: setup point cloud -> cgrid correspondences
-    Tensor cgrid_index_ps =
-            tpcd_param_i.GetPointAttr(ControlGrid::kGrid8NbIndices);
-    Tensor cgrid_ratio_ps =
-            tpcd_param_i.GetPointAttr(ControlGrid::kGrid8NbVertexInterpRatios);
-
-    Tensor cgrid_index_qs =
-            tpcd_param_j.GetPointAttr(ControlGrid::kGrid8NbIndices);
-    Tensor cgrid_ratio_qs =
-            tpcd_param_j.GetPointAttr(ControlGrid::kGrid8NbVertexInterpRatios);
-
-    // Deform with control grids
-    PointCloud tpcd_nonrigid_i = ctr_grid.Deform(tpcd_param_i);
-    PointCloud tpcd_nonrigid_j = ctr_grid.Deform(tpcd_param_j);
-
-    Tensor Cps = tpcd_nonrigid_i.GetPointPositions();
-    Tensor Cqs = tpcd_nonrigid_j.GetPointPositions();
-    Tensor Cnormal_ps = tpcd_nonrigid_i.GetPointNormals();
-
-    Tensor Ri = Ti.Slice(0, 0, 3).Slice(1, 0, 3);
-    Tensor ti = Ti.Slice(0, 0, 3).Slice(1, 3, 4);
-
-    Tensor Rj = Tj.Slice(0, 0, 3).Slice(1, 0, 3);
-    Tensor tj = Tj.Slice(0, 0, 3).Slice(1, 3, 4);
-
-    // Transform for required entries
-    Tensor Ti_Cps = (Ri.Matmul(Cps.T())).Add_(ti).T().Contiguous();
-    Tensor Tj_Cqs = (Rj.Matmul(Cqs.T())).Add_(tj).T().Contiguous();
-    Tensor Ri_Cnormal_ps = (Ri.Matmul(Cnormal_ps.T())).T().Contiguous();
-    Tensor RjT_Ri_Cnormal_ps =
-            (Rj.T().Matmul(Ri_Cnormal_ps.T())).T().Contiguous();
-
-    kernel::FillInSLACAlignmentTerm(
-            AtA, Atb, residual, Ti_Cps, Tj_Cqs, Cnormal_ps, Ri_Cnormal_ps,
-            RjT_Ri_Cnormal_ps, cgrid_index_ps, cgrid_index_qs, cgrid_ratio_ps,
-            cgrid_ratio_qs, i, j, n_fragments, threshold);
-}
-
-void FillInSLACAlignmentTerm(Tensor& AtA,
-                             Tensor& Atb,
-                             Tensor& residual,
-                             ControlGrid& ctr_grid,
-                             const std::vector<std::string>& fnames,
-                             const PoseGraph& pose_graph,
-                             const SLACOptimizerParams& params,
-                             const SLACDebugOption& debug_option) {
+/// Inputs of the SLAC alignment kernels for the correspondences between
+/// fragments i and j.
+struct SLACAlignmentInputs {
+    Tensor Ti_Cps;
+    Tensor Tj_Cqs;
+    Tensor Cnormal_ps;
+    Tensor Ri_Cnormal_ps;
+    Tensor RjT_Ri_Cnormal_ps;
+    Tensor cgrid_index_ps;
+    Tensor cgrid_index_qs;
+    Tensor cgrid_ratio_ps;
+    Tensor cgrid_ratio_qs;
+};
+
+/// Correspondences between fragments i and j parameterized in the control
+/// grid. The interpolation weights stay fixed while the grid is optimized, so
+/// they are computed once for all iterations.
+struct SLACAlignmentEdge {
+    int i;
+    int j;
+    PointCloud tpcd_param_i;
+    PointCloud tpcd_param_j;
+};
+
+/// Loads the saved correspondences of the pose graph edges and parameterizes
+/// them in the control grid.
+static std::vector<SLACAlignmentEdge> ParameterizeSLACAlignmentEdges(
+        ControlGrid& ctr_grid,
+        const std::vector<std::string>& fnames,
+        const PoseGraph& pose_graph,
+        const SLACOptimizerParams& params) {
     core::Device device(params.device_);
-    int n_frags = pose_graph.nodes_.size();
 
     // Enumerate pose graph edges.
+    std::vector<SLACAlignmentEdge> edges;
     for (auto& edge : pose_graph.edges_) {
         int i = edge.source_node_id_;
         int j = edge.target_node_id_;
@@ -206,31 +180,129 @@ void FillInSLACAlignmentTerm(Tensor& AtA,
                 tpcd_j.GetPointNormals().IndexGet({corres_ij.T()[1]}));
 
         // Parameterize points in the control grid.
-        PointCloud tpcd_param_i = ctr_grid.Parameterize(tpcd_i_indexed);
-        PointCloud tpcd_param_j = ctr_grid.Parameterize(tpcd_j_indexed);
+        edges.push_back({i, j, ctr_grid.Parameterize(tpcd_i_indexed),
+                         ctr_grid.Parameterize(tpcd_j_indexed)});
+    }
+    return edges;
+}
+
+static SLACAlignmentInputs GetSLACAlignmentInputs(
+        const PointCloud& tpcd_param_i,
+        const PointCloud& tpcd_param_j,
+        const PointCloud& tpcd_nonrigid_i,
+        const PointCloud& tpcd_nonrigid_j,
+        const Tensor& Ti,
+        const Tensor& Tj) {
+    SLACAlignmentInputs inputs;
+
+    // Parameterize: setup point cloud -> cgrid correspondences
+    inputs.cgrid_index_ps =
+            tpcd_param_i.GetPointAttr(ControlGrid::kGrid8NbIndices);
+    inputs.cgrid_ratio_ps =
+            tpcd_param_i.GetPointAttr(ControlGrid::kGrid8NbVertexInterpRatios);
+
+    inputs.cgrid_index_qs =
+            tpcd_param_j.GetPointAttr(ControlGrid::kGrid8NbIndices);
+    inputs.cgrid_ratio_qs =
+            tpcd_param_j.GetPointAttr(ControlGrid::kGrid8NbVertexInterpRatios);
+
+    Tensor Cps = tpcd_nonrigid_i.GetPointPositions();
+    Tensor Cqs = tpcd_nonrigid_j.GetPointPositions();
+    inputs.Cnormal_ps = tpcd_nonrigid_i.GetPointNormals();
+
+    Tensor Ri = Ti.Slice(0, 0, 3).Slice(1, 0, 3);
+    Tensor ti = Ti.Slice(0, 0, 3).Slice(1, 3, 4);
+
+    Tensor Rj = Tj.Slice(0, 0, 3).Slice(1, 0, 3);
+    Tensor tj = Tj.Slice(0, 0, 3).Slice(1, 3, 4);
+
+    // Transform for required entries
+    inputs.Ti_Cps = (Ri.Matmul(Cps.T())).Add_(ti).T().Contiguous();
+    inputs.Tj_Cqs = (Rj.Matmul(Cqs.T())).Add_(tj).T().Contiguous();
+    inputs.Ri_Cnormal_ps =
+            (Ri.Matmul(inputs.Cnormal_ps.T())).T().Contiguous();
+    inputs.RjT_Ri_Cnormal_ps =
+            (Rj.T().Matmul(inputs.Ri_Cnormal_ps.T())).T().Contiguous();
+    return inputs;
+}
+
+/// Deforms the parameterized correspondences of all the edges with the
+/// current control grid in one batch, and calls fill(inputs, i, j) with the
+/// SLACAlignmentInputs of each edge.
+template <typename func_t>
+static void ForEachSLACAlignmentEdge(
+        ControlGrid& ctr_grid,
+        const std::vector<SLACAlignmentEdge>& edges,
+        const std::vector<std::string>& fnames,
+        const PoseGraph& pose_graph,
+        const SLACOptimizerParams& params,
+        const SLACDebugOption& debug_option,
+        func_t fill) {
+    core::Device device(params.device_);
+
+    // Deform with control grids
+    std::vector<PointCloud> tpcds_param;
+    for (const auto& edge : edges) {
+        tpcds_param.push_back(edge.tpcd_param_i);
+        tpcds_param.push_back(edge.tpcd_param_j);
+    }
+    std::vector<PointCloud> tpcds_nonrigid = ctr_grid.Deform(tpcds_param);
+
+    for (size_t k = 0; k < edges.size(); ++k) {
+        const SLACAlignmentEdge& edge = edges[k];
+        int i = edge.i;
+        int j = edge.j;
 
         // Load poses.
         auto Ti = EigenMatrixToTensor(pose_graph.nodes_[i].pose_)
                           .To(device, core::Float32);
         auto Tj = EigenMatrixToTensor(pose_graph.nodes_[j].pose_)
                           .To(device, core::Float32);
-        auto Tij = EigenMatrixToTensor(edge.transformation_)
-                           .To(device, core::Float32);
 
         // Fill In.
-        FillInSLACAlignmentTerm(AtA, Atb, residual, ctr_grid, tpcd_param_i,
-                                tpcd_param_j, Ti, Tj, i, j, n_frags,
-                                params.distance_threshold_);
+        fill(GetSLACAlignmentInputs(edge.tpcd_param_i, edge.tpcd_param_j,
+                                    tpcds_nonrigid[2 * k],
+                                    tpcds_nonrigid[2 * k + 1], Ti, Tj),
+             i, j);
 
         if (debug_option.debug_ && i >= debug_option.debug_start_node_idx_) {
+            std::string corres_fname =
+                    fmt::format("{}/{:03d}_{:03d}.npy",
+                                params.GetSubfolderName(), i, j);
+            Tensor corres_ij = Tensor::Load(corres_fname).To(device);
+            PointCloud tpcd_i = CreateTPCDFromFile(fnames[i], device);
+            PointCloud tpcd_j = CreateTPCDFromFile(fnames[j], device);
             VisualizePointCloudCorrespondences(tpcd_i, tpcd_j, corres_ij,
                                                Tj.Inverse().Matmul(Ti));
+            PointCloud tpcd_param_i = edge.tpcd_param_i;
             VisualizePointCloudEmbedding(tpcd_param_i, ctr_grid);
             VisualizePointCloudDeformation(tpcd_param_i, ctr_grid);
         }
     }
 }
 
+void FillInSLACAlignmentTerm(Tensor& AtA,
+                             Tensor& Atb,
+                             Tensor& residual,
+                             ControlGrid& ctr_grid,
+                             const std::vector<SLACAlignmentEdge>& edges,
+                             const std::vector<std::string>& fnames,
+                             const PoseGraph& pose_graph,
+                             const SLACOptimizerParams& params,
+                             const SLACDebugOption& debug_option) {
+    int n_frags = pose_graph.nodes_.size();
+    ForEachSLACAlignmentEdge(
+            ctr_grid, edges, fnames, pose_graph, params, debug_option,
+            [&](const SLACAlignmentInputs& in, int i, int j) {
+                kernel::FillInSLACAlignmentTerm(
+                        AtA, Atb, residual, in.Ti_Cps, in.Tj_Cqs,
+                        in.Cnormal_ps, in.Ri_Cnormal_ps, in.RjT_Ri_Cnormal_ps,
+                        in.cgrid_index_ps, in.cgrid_index_qs,
+                        in.cgrid_ratio_ps, in.cgrid_ratio_qs, i, j, n_frags,
+                        params.distance_threshold_);
+            });
+}
+
 void FillInSLACRegularizerTerm(Tensor& AtA,
                                Tensor& Atb,
                                Tensor& residual,
@@ -254,6 +326,76 @@ void FillInSLACRegularizerTerm(Tensor& AtA,
     }
 }
 
+/// Jacobian rows of a term of the sparse SLAC linear system, see
+/// kernel::FillInSLACAlignmentTermSparse.
+struct SLACJacobianRows {
+    Tensor J_idx;
+    Tensor J_val;
+    Tensor r;
+};
+
+static Tensor ConcatenateRows(const std::vector<Tensor>& rows) {
+    // Concatenate splits a single tensor along its first dimension.
+    if (rows.size() == 1) return rows[0];
+    return core::Concatenate(rows, 0);
+}
+
+SLACJacobianRows FillInSLACAlignmentTermSparse(
+        ControlGrid& ctr_grid,
+        const std::vector<SLACAlignmentEdge>& edges,
+        const std::vector<std::string>& fnames,
+        const PoseGraph& pose_graph,
+        const SLACOptimizerParams& params,
+        const SLACDebugOption& debug_option) {
+    core::Device device(params.device_);
+    int n_frags = pose_graph.nodes_.size();
+
+    std::vector<Tensor> J_idx_edges, J_val_edges, r_edges;
+    ForEachSLACAlignmentEdge(
+            ctr_grid, edges, fnames, pose_graph, params, debug_option,
+            [&](const SLACAlignmentInputs& in, int i, int j) {
+                Tensor J_idx, J_val, r;
+                kernel::FillInSLACAlignmentTermSparse(
+                        J_idx, J_val, r, in.Ti_Cps, in.Tj_Cqs, in.Cnormal_ps,
+                        in.Ri_Cnormal_ps, in.RjT_Ri_Cnormal_ps,
+                        in.cgrid_index_ps, in.cgrid_index_qs,
+                        in.cgrid_ratio_ps, in.cgrid_ratio_qs, i, j, n_frags,
+                        params.distance_threshold_);
+                J_idx_edges.push_back(J_idx);
+                J_val_edges.push_back(J_val);
+                r_edges.push_back(r);
+            });
+
+    if (J_idx_edges.empty()) {
+        return {Tensor::Zeros({0, 60}, core::Int32, device),
+                Tensor::Zeros({0, 60}, core::Float32, device),
+                Tensor::Zeros({0}, core::Float32, device)};
+    }
+    return {ConcatenateRows(J_idx_edges), ConcatenateRows(J_val_edges),
+            ConcatenateRows(r_edges)};
+}
+
+SLACJacobianRows FillInSLACRegularizerTermSparse(
+        ControlGrid& ctr_grid,
+        int n_frags,
+        const SLACOptimizerParams& params,
+        const SLACDebugOption& debug_option) {
+    Tensor active_buf_indices, nb_buf_indices, nb_masks;
+    std::tie(active_buf_indices, nb_buf_indices, nb_masks) =
+            ctr_grid.GetNeighborGridMap();
+
+    SLACJacobianRows rows;
+    kernel::FillInSLACRegularizerTermSparse(
+            rows.J_idx, rows.J_val, rows.r, active_buf_indices, nb_buf_indices,
+            nb_masks, ctr_grid.GetInitPositions(), ctr_grid.GetCurrPositions(),
+            n_frags * params.regularizer_weight_, n_frags,
+            ctr_grid.GetAnchorIdx());
+    if (debug_option.debug_) {
+        VisualizeGridDeformation(ctr_grid);
+    }
+    return rows;
+}
+
 }  // namespace slac
 }  // namespace pipelines
 }  // namespace t
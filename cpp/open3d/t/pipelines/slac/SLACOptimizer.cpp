@@ -26,12 +26,16 @@
 
 #include "open3d/t/pipelines/slac/SLACOptimizer.h"
 
+#include <Eigen/Cholesky>
+#include <cmath>
+
 #include "open3d/core/EigenConverter.h"
 #include "open3d/core/TensorCheck.h"
 #include "open3d/core/nns/NearestNeighborSearch.h"
 #include "open3d/io/PointCloudIO.h"
 #include "open3d/t/pipelines/slac/FillInLinearSystemImpl.h"
 #include "open3d/utility/FileSystem.h"
+#include "open3d/utility/Parallel.h"
 
 namespace open3d {
 namespace t {
@@ -304,6 +308,110 @@ static void UpdatePoses(PoseGraph& fragment_pose_graph, core::Tensor& delta) {
     }
 }
 
+// Maximum number of iterations and relative residual tolerance of the sparse
+// conjugate gradient solver.
+static constexpr int kSparseSolverMaxIterations = 1000;
+static constexpr double kSparseSolverTolerance = 1e-6;
+
+// Inverts the N x N blocks of a block diagonal matrix in place after adding
+// damping to their diagonals. Singular blocks are replaced by identity.
+template <int N>
+static void InvertBlocks(float* blocks_ptr,
+                         const float* damping_ptr,
+                         int64_t n_blocks) {
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t k = 0; k < n_blocks; ++k) {
+        Eigen::Map<Eigen::Matrix<float, N, N, Eigen::RowMajor>> block(
+                blocks_ptr + N * N * k);
+        block.diagonal() += Eigen::Map<const Eigen::Matrix<float, N, 1>>(
+                damping_ptr + N * k);
+        Eigen::LLT<Eigen::Matrix<double, N, N>> llt(
+                block.template cast<double>());
+        if (llt.info() == Eigen::Success) {
+            block = llt.solve(Eigen::Matrix<double, N, N>::Identity())
+                            .template cast<float>();
+        } else {
+            block.setIdentity();
+        }
+    }
+}
+
+// Solves (J^T J + diag(damping)) delta = -J^T r over the Jacobian rows of all
+// terms with the block-Jacobi preconditioned conjugate gradient method. J^T J
+// is never formed.
+static core::Tensor SolveSLACSparse(const std::vector<SLACJacobianRows>& terms,
+                                    const core::Tensor& damping,
+                                    int n_frags) {
+    core::Device device = damping.GetDevice();
+    int64_t n_vars = damping.GetLength();
+    int64_t n_ctr = (n_vars - 6 * n_frags) / 3;
+
+    core::Tensor b = core::Tensor::Zeros({n_vars}, core::Float32, device);
+    for (const auto& term : terms) {
+        kernel::ComputeJTr(b, term.J_idx, term.J_val, term.r);
+    }
+    b = b.Neg();
+    auto apply_A = [&](const core::Tensor& x) {
+        core::Tensor Ax = damping * x;
+        for (const auto& term : terms) {
+            kernel::ComputeJTJx(Ax, term.J_idx, term.J_val, x);
+        }
+        return Ax;
+    };
+
+    // Block-Jacobi preconditioner with the 6 x 6 blocks of the fragments and
+    // the 3 x 3 blocks of the control points, inverted on the host.
+    core::Tensor blocks = core::Tensor::Zeros({36 * n_frags + 9 * n_ctr},
+                                              core::Float32, device);
+    for (const auto& term : terms) {
+        kernel::FillInBlockJacobi(blocks, term.J_idx, term.J_val, n_frags);
+    }
+    core::Device host("CPU:0");
+    core::Tensor blocks_inv = blocks.To(host).Contiguous();
+    core::Tensor damping_host = damping.To(host).Contiguous();
+    float* blocks_inv_ptr = blocks_inv.GetDataPtr<float>();
+    const float* damping_ptr = damping_host.GetDataPtr<float>();
+    InvertBlocks<6>(blocks_inv_ptr, damping_ptr, n_frags);
+    InvertBlocks<3>(blocks_inv_ptr + 36 * n_frags, damping_ptr + 6 * n_frags,
+                    n_ctr);
+    blocks_inv = blocks_inv.To(device);
+
+    core::Tensor x = core::Tensor::Zeros({n_vars}, core::Float32, device);
+    double b_norm = std::sqrt((b * b).Sum({0}).Item<float>());
+    if (b_norm == 0) return x.View({-1, 1});
+
+    core::Tensor r = b.Clone();
+    core::Tensor z = core::Tensor::Empty({n_vars}, core::Float32, device);
+    kernel::ApplyBlockJacobi(z, blocks_inv, r, n_frags);
+    core::Tensor p = z.Clone();
+    double rz = (r * z).Sum({0}).Item<float>();
+
+    int itr = 0;
+    double r_norm = b_norm;
+    for (; itr < kSparseSolverMaxIterations; ++itr) {
+        core::Tensor Ap = apply_A(p);
+        double pAp = (p * Ap).Sum({0}).Item<float>();
+        if (pAp <= 0) break;
+
+        double alpha = rz / pAp;
+        x.Add_(p * alpha);
+        r.Sub_(Ap * alpha);
+        r_norm = std::sqrt((r * r).Sum({0}).Item<float>());
+        if (r_norm < kSparseSolverTolerance * b_norm) break;
+
+        kernel::ApplyBlockJacobi(z, blocks_inv, r, n_frags);
+        double rz_new = (r * z).Sum({0}).Item<float>();
+        p = z + p * (rz_new / rz);
+        rz = rz_new;
+    }
+    utility::LogDebug(
+            "Sparse solver finished after {} iterations, relative residual = "
+            "{}",
+            itr, r_norm / b_norm);
+    return x.View({-1, 1});
+}
+
 static void UpdateControlGrid(ControlGrid& ctr_grid, core::Tensor& delta) {
     core::Tensor delta_cgrids = delta.View({-1, 3});
     if (delta_cgrids.GetLength() != int64_t(ctr_grid.Size())) {
@@ -342,11 +450,51 @@ std::pair<PoseGraph, ControlGrid> RunSLACOptimizerForFragments(
     // Fill-in
     // fragments x 6 (se3) + control_grids x 3 (R^3)
     int64_t num_params = fnames_down.size() * 6 + ctr_grid.Size() * 3;
-    utility::LogInfo("Initializing the {}^2 Hessian matrix", num_params);
+    if (params.use_sparse_solver_) {
+        utility::LogInfo("Initializing the sparse {} x {} linear system",
+                         num_params, num_params);
+    } else {
+        utility::LogInfo("Initializing the {}^2 Hessian matrix", num_params);
+    }
+
+    // The correspondences are embedded in the grid once, only the grid
+    // positions change between iterations.
+    std::vector<SLACAlignmentEdge> edges = ParameterizeSLACAlignmentEdges(
+            ctr_grid, fnames_down, pose_graph, params);
 
     PoseGraph pose_graph_update(pose_graph);
     for (int itr = 0; itr < params.max_iterations_; ++itr) {
         utility::LogInfo("Iteration {}", itr);
+        if (params.use_sparse_solver_) {
+            int n_frags = int(pose_graph_update.nodes_.size());
+            SLACJacobianRows rows_data = FillInSLACAlignmentTermSparse(
+                    ctr_grid, edges, fnames_down, pose_graph_update, params,
+                    debug_option);
+            utility::LogInfo(
+                    "Alignment loss = {}",
+                    (rows_data.r * rows_data.r).Sum({0}).Item<float>());
+
+            SLACJacobianRows rows_reg = FillInSLACRegularizerTermSparse(
+                    ctr_grid, n_frags, params, debug_option);
+            utility::LogInfo("Regularizer loss = {}",
+                             (rows_reg.r * rows_reg.r).Sum({0}).Item<float>());
+
+            // Fix pose 0 like the dense system.
+            core::Tensor damping =
+                    core::Tensor::Zeros({num_params}, core::Float32, device);
+            damping.Slice(0, 0, 6).Fill(1);
+            core::Tensor delta =
+                    SolveSLACSparse({rows_data, rows_reg}, damping, n_frags);
+
+            core::Tensor delta_poses = delta.Slice(0, 0, 6 * n_frags);
+            core::Tensor delta_cgrids =
+                    delta.Slice(0, 6 * n_frags, delta.GetLength());
+
+            UpdatePoses(pose_graph_update, delta_poses);
+            UpdateControlGrid(ctr_grid, delta_cgrids);
+            continue;
+        }
+
         core::Tensor AtA = core::Tensor::Zeros({num_params, num_params},
                                                core::Float32, device);
         core::Tensor Atb =
@@ -359,8 +507,9 @@ std::pair<PoseGraph, ControlGrid> RunSLACOptimizerForFragments(
 
         core::Tensor residual_data =
                 core::Tensor::Zeros({1}, core::Float32, device);
-        FillInSLACAlignmentTerm(AtA, Atb, residual_data, ctr_grid, fnames_down,
-                                pose_graph_update, params, debug_option);
+        FillInSLACAlignmentTerm(AtA, Atb, residual_data, ctr_grid, edges,
+                                fnames_down, pose_graph_update, params,
+                                debug_option);
 
         utility::LogInfo("Alignment loss = {}", residual_data[0].Item<float>());
 
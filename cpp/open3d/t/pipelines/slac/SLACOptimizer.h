@@ -62,6 +62,12 @@ struct SLACOptimizerParams {
 
     /// Relative directory to store SLAC results in the dataset folder.
     std::string slac_folder_ = "";
+
+    /// Solve the SLAC linear system with a sparse preconditioned conjugate
+    /// gradient solver instead of a dense factorization. Memory then grows
+    /// with the number of correspondences instead of the squared number of
+    /// parameters.
+    bool use_sparse_solver_ = false;
     std::string GetSubfolderName() const {
         if (voxel_size_ < 0) {
             return fmt::format("{}/original", slac_folder_);
@@ -82,13 +88,16 @@ struct SLACOptimizerParams {
     /// \param device Device to use. [Default: CPU:0].
     /// \param slac_folder Relative directory to store SLAC results in the
     /// dataset folder. [Default: ""].
+    /// \param use_sparse_solver Solve the SLAC linear system with a sparse
+    /// preconditioned conjugate gradient solver. [Default: False].
     SLACOptimizerParams(const int max_iterations = 5,
                         const float voxel_size = 0.05,
                         const float distance_threshold = 0.07,
                         const float fitness_threshold = 0.3,
                         const float regularizer_weight = 1,
                         const core::Device device = core::Device("CPU:0"),
-                        const std::string slac_folder = "") {
+                        const std::string slac_folder = "",
+                        const bool use_sparse_solver = false) {
         if (fitness_threshold < 0) {
             utility::LogError("fitness threshold must be positive.");
         }
@@ -103,6 +112,7 @@ struct SLACOptimizerParams {
         regularizer_weight_ = regularizer_weight;
         device_ = device;
         slac_folder_ = slac_folder;
+        use_sparse_solver_ = use_sparse_solver;
     }
 };
 
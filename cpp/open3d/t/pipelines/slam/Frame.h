@@ -26,6 +26,9 @@
 
 #pragma once
 
+#include <unordered_map>
+#include <unordered_set>
+
 #include "open3d/core/Tensor.h"
 #include "open3d/t/geometry/Image.h"
 #include "open3d/t/geometry/RGBDImage.h"
@@ -56,9 +59,35 @@ public:
     }
     core::Tensor GetIntrinsics() const { return intrinsics_; }
 
+    /// Set data for \p name. If a buffer is reserved for \p name and matches
+    /// \p data in shape and dtype, \p data is copied into the reserved
+    /// buffer, otherwise the frame refers to (a copy on the frame's device
+    /// of) \p data.
     void SetData(const std::string& name, const core::Tensor& data) {
+        auto it = data_.find(name);
+        if (it != data_.end() && reserved_names_.count(name) != 0 &&
+            it->second.GetShape() == data.GetShape() &&
+            it->second.GetDtype() == data.GetDtype()) {
+            if (it->second.GetDataPtr() != data.GetDataPtr()) {
+                it->second.AsRvalue() = data;
+            }
+            return;
+        }
         data_[name] = data.To(device_);
     }
+
+    /// Preallocate a (height, width, \p channels) buffer of \p dtype for
+    /// \p name on the frame's device. Subsequent SetData calls with matching
+    /// tensors copy into this buffer, so that a steady-state frame loop
+    /// neither allocates frame tensors nor changes their addresses. Tensors
+    /// previously returned by GetData(name) are overwritten by such calls.
+    void ReserveData(const std::string& name,
+                     int64_t channels,
+                     core::Dtype dtype) {
+        data_[name] =
+                core::Tensor({height_, width_, channels}, dtype, device_);
+        reserved_names_.insert(name);
+    }
     core::Tensor GetData(const std::string& name) const {
         if (data_.count(name) == 0) {
             utility::LogWarning(
@@ -92,6 +121,9 @@ private:
     // color_map: (H, W, 3), Float32
     // normal_map: (H, W, 3), Float32
     std::unordered_map<std::string, core::Tensor> data_;
+
+    // Names with buffers preallocated by ReserveData.
+    std::unordered_set<std::string> reserved_names_;
 };
 
 }  // namespace slam
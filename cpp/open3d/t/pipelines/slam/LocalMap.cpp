@@ -0,0 +1,208 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/t/pipelines/slam/LocalMap.h"
+
+#include "open3d/core/TensorCheck.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace slam {
+
+LocalMap::LocalMap(double voxel_size,
+                   int max_points_per_voxel,
+                   const core::Dtype& dtype,
+                   const core::Device& device,
+                   int64_t init_capacity)
+    : voxel_size_(voxel_size),
+      max_points_per_voxel_(max_points_per_voxel),
+      dtype_(dtype),
+      device_(device),
+      voxels_(init_capacity,
+              core::Int32,
+              {3},
+              std::vector<core::Dtype>({dtype, core::Int32}),
+              std::vector<core::SizeVector>({{max_points_per_voxel, 3}, {1}}),
+              device) {
+    if (voxel_size <= 0) {
+        utility::LogError("voxel_size must be positive, but got {}.",
+                          voxel_size);
+    }
+    if (max_points_per_voxel <= 0) {
+        utility::LogError("max_points_per_voxel must be positive, but got {}.",
+                          max_points_per_voxel);
+    }
+    if (dtype != core::Float32 && dtype != core::Float64) {
+        utility::LogError("dtype must be Float32 or Float64, but got {}.",
+                          dtype.ToString());
+    }
+}
+
+void LocalMap::Insert(const geometry::PointCloud& frame,
+                      const core::Tensor& frame_to_map) {
+    if (!frame.HasPointPositions() ||
+        frame.GetPointPositions().GetLength() == 0) {
+        return;
+    }
+    core::AssertTensorDtype(frame.GetPointPositions(), dtype_);
+    core::AssertTensorDevice(frame.GetPointPositions(), device_);
+    core::AssertTensorShape(frame_to_map, {4, 4});
+
+    geometry::PointCloud points(frame.GetPointPositions().Clone());
+    points.Transform(frame_to_map);
+    const core::Tensor positions = points.GetPointPositions();
+    const int64_t num_points = positions.GetLength();
+
+    const core::Tensor keys =
+            positions.Div(voxel_size_).Floor().To(core::Int32);
+    core::Tensor buf_indices, masks;
+    std::tie(buf_indices, masks) = voxels_.FindOrInsert(keys);
+    buf_indices = buf_indices.To(core::Int64);
+
+    // The value buffers are fetched after the insertion, which may grow them.
+    core::Tensor voxel_points = voxels_.GetValueTensor(0);
+    core::Tensor voxel_counts = voxels_.GetValueTensor(1);
+    const core::Tensor new_indices = buf_indices.IndexGet({masks});
+    voxel_counts.IndexSet({new_indices},
+                          core::Tensor::Zeros({new_indices.GetLength(), 1},
+                                              core::Int32, device_));
+
+    // Rank of each point among the points of the frame in the same voxel, in
+    // frame order, so that each point gets its own slot after the points
+    // already stored.
+    core::Tensor unique_indices, inverse, group_counts;
+    std::tie(unique_indices, inverse, group_counts) =
+            buf_indices.UniqueWithInverseAndCounts();
+    const core::Tensor order = inverse.ArgSort();
+    const core::Tensor group_starts = group_counts.ExclusivePrefixSum();
+    core::Tensor ranks = core::Tensor::Empty({num_points}, core::Int64,
+                                             device_);
+    ranks.IndexSet(
+            {order},
+            core::Tensor::Arange(0, num_points, 1, core::Int64, device_) -
+                    group_starts.IndexGet({inverse.IndexGet({order})}));
+
+    const core::Tensor slots =
+            voxel_counts.IndexGet({buf_indices}).Reshape({num_points}).To(
+                    core::Int64) +
+            ranks;
+    const core::Tensor keep = slots.Lt(max_points_per_voxel_);
+    const core::Tensor flat_slots =
+            buf_indices.IndexGet({keep}) * max_points_per_voxel_ +
+            slots.IndexGet({keep});
+    core::Tensor flat_points = voxel_points.View(
+            {voxel_points.GetLength() * max_points_per_voxel_, 3});
+    flat_points.IndexSet({flat_slots}, positions.IndexGet({keep}));
+
+    const core::Tensor updated_counts =
+            (voxel_counts.IndexGet({unique_indices}) +
+             group_counts.To(core::Int32).Reshape({-1, 1}))
+                    .Clip(0, max_points_per_voxel_);
+    voxel_counts.IndexSet({unique_indices}, updated_counts);
+
+    icp_target_.reset();
+}
+
+void LocalMap::RemoveFarVoxels(const core::Tensor& center, double radius) {
+    core::AssertTensorShape(center, {3});
+    const core::Tensor buf_indices =
+            voxels_.GetActiveIndices().To(core::Int64);
+    if (buf_indices.GetLength() == 0) return;
+
+    const core::Tensor keys = voxels_.GetKeyTensor().IndexGet({buf_indices});
+    const core::Tensor centers =
+            keys.To(core::Float64).Add(0.5).Mul(voxel_size_);
+    const core::Tensor offsets =
+            centers - center.To(device_, core::Float64).Reshape({1, 3});
+    const core::Tensor far =
+            (offsets * offsets).Sum({1}).Gt(radius * radius);
+    if (!far.Any()) return;
+
+    voxels_.Erase(keys.IndexGet({far}));
+    icp_target_.reset();
+}
+
+void LocalMap::Clear() {
+    voxels_.Clear();
+    icp_target_.reset();
+}
+
+int64_t LocalMap::GetNumPoints() const {
+    const core::Tensor buf_indices =
+            voxels_.GetActiveIndices().To(core::Int64);
+    if (buf_indices.GetLength() == 0) return 0;
+    return voxels_.GetValueTensor(1)
+            .IndexGet({buf_indices})
+            .To(core::Int64)
+            .Sum({0, 1})
+            .Item<int64_t>();
+}
+
+geometry::PointCloud LocalMap::GetPointCloud() const {
+    const core::Tensor buf_indices =
+            voxels_.GetActiveIndices().To(core::Int64);
+    const int64_t num_voxels = buf_indices.GetLength();
+    if (num_voxels == 0) {
+        return geometry::PointCloud(
+                core::Tensor::Empty({0, 3}, dtype_, device_));
+    }
+
+    const core::Tensor points = voxels_.GetValueTensor(0)
+                                        .IndexGet({buf_indices})
+                                        .Reshape({-1, 3});
+    const core::Tensor counts = voxels_.GetValueTensor(1).IndexGet(
+            {buf_indices});
+    const core::Tensor valid =
+            core::Tensor::Arange(0, max_points_per_voxel_, 1, core::Int32,
+                                 device_)
+                    .Reshape({1, max_points_per_voxel_})
+                    .Lt(counts)
+                    .Reshape({-1});
+    return geometry::PointCloud(points.IndexGet({valid}));
+}
+
+const registration::ICPTargetPyramid& LocalMap::GetICPTarget(
+        double max_correspondence_distance) {
+    if (Size() == 0) {
+        utility::LogError("The local map is empty.");
+    }
+    if (!icp_target_ ||
+        icp_target_distance_ != max_correspondence_distance) {
+        icp_target_ = std::make_shared<registration::ICPTargetPyramid>(
+                GetPointCloud(), std::vector<double>({-1.0}),
+                std::vector<double>({max_correspondence_distance}));
+        icp_target_distance_ = max_correspondence_distance;
+    }
+    return *icp_target_;
+}
+
+}  // namespace slam
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
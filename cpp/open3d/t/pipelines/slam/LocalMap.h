@@ -0,0 +1,122 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#pragma once
+
+#include <memory>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/core/hashmap/HashMap.h"
+#include "open3d/t/geometry/PointCloud.h"
+#include "open3d/t/pipelines/registration/Registration.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace slam {
+
+/// \class LocalMap
+///
+/// \brief Sliding-window point map for frame-to-map LiDAR odometry. Points are
+/// stored in a hash map of voxels, each holding at most
+/// \p max_points_per_voxel points, so the map density is bounded without
+/// downsampling the map again for each frame. Voxels far from the sensor are
+/// removed with RemoveFarVoxels. All the updates are tensor operations on the
+/// device of the map.
+///
+/// A typical loop registers each frame against GetICPTarget with
+/// point to point MultiScaleICP, then inserts the frame with the estimated
+/// pose and removes the voxels out of range.
+class LocalMap {
+public:
+    /// \param voxel_size Edge length of the voxels.
+    /// \param max_points_per_voxel Maximum number of points stored per voxel.
+    /// Points inserted into a full voxel are dropped.
+    /// \param dtype Float32 or Float64 dtype of the stored points.
+    /// \param device Device of the map.
+    /// \param init_capacity Initial number of voxels of the hash map, which
+    /// grows as needed.
+    LocalMap(double voxel_size,
+             int max_points_per_voxel = 20,
+             const core::Dtype& dtype = core::Float32,
+             const core::Device& device = core::Device("CPU:0"),
+             int64_t init_capacity = 10000);
+
+    /// Inserts the points of \p frame, transformed by the (4, 4) Float64
+    /// \p frame_to_map transformation. Points are kept in the order of the
+    /// frame until their voxel is full.
+    void Insert(const geometry::PointCloud& frame,
+                const core::Tensor& frame_to_map =
+                        core::Tensor::Eye(4, core::Float64,
+                                          core::Device("CPU:0")));
+
+    /// Removes the voxels whose center is farther than \p radius from the (3,)
+    /// \p center, usually the current sensor position.
+    void RemoveFarVoxels(const core::Tensor& center, double radius);
+
+    /// Removes all the points.
+    void Clear();
+
+    /// Returns the number of voxels.
+    int64_t Size() const { return voxels_.Size(); }
+
+    /// Returns the number of points.
+    int64_t GetNumPoints() const;
+
+    /// Returns the points of the map, grouped by voxel.
+    geometry::PointCloud GetPointCloud() const;
+
+    /// Returns the point cloud and search index of the map as a single scale
+    /// registration::ICPTargetPyramid, for point to point MultiScaleICP. The
+    /// pyramid is kept until the map or \p max_correspondence_distance
+    /// changes, so a frame can be registered several times without indexing
+    /// the map again.
+    const registration::ICPTargetPyramid& GetICPTarget(
+            double max_correspondence_distance);
+
+    double GetVoxelSize() const { return voxel_size_; }
+    int GetMaxPointsPerVoxel() const { return max_points_per_voxel_; }
+    core::Device GetDevice() const { return device_; }
+
+private:
+    double voxel_size_;
+    int max_points_per_voxel_;
+    core::Dtype dtype_;
+    core::Device device_;
+
+    /// Int32 voxel coordinates to the (max_points_per_voxel, 3) points and
+    /// the (1,) Int32 number of points of the voxel.
+    core::HashMap voxels_;
+
+    std::shared_ptr<registration::ICPTargetPyramid> icp_target_;
+    double icp_target_distance_ = 0.0;
+};
+
+}  // namespace slam
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,305 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/pipelines/slam/LoopClosureDetector.h"
+
+#include <algorithm>
+
+#include "open3d/core/EigenConverter.h"
+#include "open3d/core/TensorCheck.h"
+#include "open3d/core/TensorFunction.h"
+#include "open3d/t/geometry/Utility.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace slam {
+
+namespace {
+
+/// Sums a (H, W, 1) image over a (grid_height, grid_width) grid of cells,
+/// dropping the last rows and columns if the image size is not a multiple of
+/// the grid size.
+core::Tensor SumOverGrid(const core::Tensor& image,
+                         int grid_height,
+                         int grid_width) {
+    const int64_t cell_height = image.GetShape(0) / grid_height;
+    const int64_t cell_width = image.GetShape(1) / grid_width;
+    if (cell_height == 0 || cell_width == 0) {
+        utility::LogError(
+                "Image of size ({}, {}) is smaller than the descriptor grid "
+                "({}, {}).",
+                image.GetShape(0), image.GetShape(1), grid_height,
+                grid_width);
+    }
+    return image.Slice(0, 0, grid_height * cell_height)
+            .Slice(1, 0, grid_width * cell_width)
+            .Contiguous()
+            .Reshape({grid_height, cell_height, grid_width, cell_width})
+            .Sum({1, 3});
+}
+
+/// Flattens \p values and makes them zero-mean, so that descriptors do not
+/// depend on the average depth or brightness of the image.
+core::Tensor CenterValues(const core::Tensor& values) {
+    const core::Tensor flat = values.Reshape({-1});
+    return flat - flat.Mean({0});
+}
+
+Eigen::Matrix4d ToEigenTransformation(const core::Tensor& T) {
+    return core::eigen_converter::TensorToEigenMatrixXd(T);
+}
+
+}  // namespace
+
+LoopClosureDetector::LoopClosureDetector(const core::Tensor& intrinsics,
+                                         const LoopClosureParams& params,
+                                         const core::Device& device)
+    : intrinsics_(intrinsics.To(core::Device("CPU:0"), core::Float64)),
+      params_(params),
+      device_(device) {
+    core::AssertTensorShape(intrinsics, {3, 3});
+    descriptors_ = core::Tensor::Empty(
+            {0, 2 * params_.descriptor_width_ * params_.descriptor_height_},
+            core::Float32, device_);
+}
+
+core::Tensor LoopClosureDetector::ComputeDescriptor(
+        const geometry::RGBDImage& rgbd,
+        float depth_scale,
+        float depth_max) const {
+    const int grid_height = params_.descriptor_height_;
+    const int grid_width = params_.descriptor_width_;
+
+    const core::Tensor depth =
+            rgbd.depth_.AsTensor().To(device_, core::Float32).Div(depth_scale);
+    const core::Tensor valid =
+            depth.Gt(0).LogicalAnd(depth.Lt(depth_max)).To(core::Float32);
+    const core::Tensor valid_counts =
+            SumOverGrid(valid, grid_height, grid_width)
+                    .Clip(1, depth.GetShape(0) * depth.GetShape(1));
+    const core::Tensor depth_part = CenterValues(
+            SumOverGrid(depth * valid, grid_height, grid_width) /
+            valid_counts);
+
+    // Without a color image, the intensity part is zero and the descriptor
+    // only compares depth.
+    core::Tensor intensity_part = core::Tensor::Zeros(
+            {grid_height * grid_width}, core::Float32, device_);
+    if (!rgbd.color_.IsEmpty()) {
+        const core::Tensor color = rgbd.color_.AsTensor();
+        if (color.GetShape(0) != depth.GetShape(0) ||
+            color.GetShape(1) != depth.GetShape(1)) {
+            utility::LogError(
+                    "Color image of size ({}, {}) does not match the depth "
+                    "image of size ({}, {}).",
+                    color.GetShape(0), color.GetShape(1), depth.GetShape(0),
+                    depth.GetShape(1));
+        }
+        const core::Tensor intensity =
+                color.To(device_, core::Float32).Mean({2}, true);
+        intensity_part = CenterValues(
+                SumOverGrid(intensity, grid_height, grid_width));
+        // Scale the intensity part to the norm of the depth part, so that both
+        // weigh the same whatever their units.
+        const float depth_norm =
+                (depth_part * depth_part).Sum({0}).Sqrt().Item<float>();
+        const float intensity_norm =
+                (intensity_part * intensity_part).Sum({0}).Sqrt().Item<float>();
+        if (intensity_norm > 0) {
+            intensity_part = intensity_part.Mul(depth_norm / intensity_norm);
+        }
+    }
+
+    const core::Tensor descriptor =
+            core::Concatenate({depth_part, intensity_part}, 0);
+    const float norm = (descriptor * descriptor).Sum({0}).Sqrt().Item<float>();
+    return norm > 0 ? descriptor.Div(norm) : descriptor;
+}
+
+int LoopClosureDetector::AddKeyframe(const geometry::RGBDImage& rgbd,
+                                     const core::Tensor& T_frame_to_world,
+                                     float depth_scale,
+                                     float depth_max) {
+    core::AssertTensorShape(T_frame_to_world, {4, 4});
+    const int keyframe_id = GetNumKeyframes();
+
+    const core::Tensor descriptor =
+            ComputeDescriptor(rgbd, depth_scale, depth_max);
+    if (keyframe_id == descriptors_.GetLength()) {
+        core::Tensor descriptors = core::Tensor::Zeros(
+                {std::max<int64_t>(2 * descriptors_.GetLength(), 16),
+                 descriptors_.GetShape(1)},
+                core::Float32, device_);
+        if (keyframe_id > 0) {
+            descriptors.Slice(0, 0, keyframe_id).AsRvalue() = descriptors_;
+        }
+        descriptors_ = descriptors;
+    }
+    descriptors_[keyframe_id].AsRvalue() = descriptor;
+
+    geometry::PointCloud pcd =
+            geometry::PointCloud::CreateFromDepthImage(
+                    rgbd.depth_.To(device_), intrinsics_,
+                    core::Tensor::Eye(4, core::Float32,
+                                      core::Device("CPU:0")),
+                    depth_scale, depth_max)
+                    .VoxelDownSample(params_.voxel_size_);
+    pcd.EstimateNormals();
+    keyframe_point_clouds_.push_back(pcd);
+    keyframe_poses_.push_back(
+            T_frame_to_world.To(core::Device("CPU:0"), core::Float64)
+                    .Contiguous());
+
+    pose_graph_.nodes_.push_back(open3d::pipelines::registration::PoseGraphNode(
+            ToEigenTransformation(keyframe_poses_.back())));
+    if (keyframe_id > 0) {
+        const core::Tensor T_odometry =
+                GetRelativePose(keyframe_id - 1, keyframe_id);
+        const core::Tensor information = registration::GetInformationMatrix(
+                keyframe_point_clouds_[keyframe_id - 1], pcd,
+                params_.max_correspondence_distance_, T_odometry);
+        pose_graph_.edges_.push_back(
+                open3d::pipelines::registration::PoseGraphEdge(
+                        keyframe_id - 1, keyframe_id,
+                        ToEigenTransformation(T_odometry),
+                        core::eigen_converter::TensorToEigenMatrixXd(
+                                information),
+                        false));
+    }
+    return keyframe_id;
+}
+
+std::vector<std::pair<int, float>> LoopClosureDetector::GetCandidates(
+        int keyframe_id) const {
+    CheckKeyframeId(keyframe_id);
+    const int num_eligible = keyframe_id - params_.min_keyframe_gap_ + 1;
+    if (num_eligible <= 0) return {};
+
+    const core::Tensor similarities =
+            descriptors_.Slice(0, 0, num_eligible)
+                    .Matmul(descriptors_[keyframe_id].Reshape({-1, 1}))
+                    .Reshape({num_eligible});
+    const int64_t num_top =
+            std::min<int64_t>(params_.num_candidates_, num_eligible);
+    const core::Tensor top_ids =
+            similarities.ArgSort(true).Slice(0, 0, num_top);
+    const std::vector<int64_t> ids =
+            top_ids.To(core::Device("CPU:0")).ToFlatVector<int64_t>();
+    const std::vector<float> top_similarities =
+            similarities.IndexGet({top_ids})
+                    .To(core::Device("CPU:0"))
+                    .ToFlatVector<float>();
+
+    std::vector<std::pair<int, float>> candidates;
+    for (int64_t i = 0; i < num_top; ++i) {
+        if (top_similarities[i] < params_.min_similarity_) break;
+        candidates.emplace_back(static_cast<int>(ids[i]),
+                                top_similarities[i]);
+    }
+    return candidates;
+}
+
+std::vector<LoopClosure> LoopClosureDetector::DetectLoopClosures(
+        int keyframe_id) {
+    const std::vector<std::pair<int, float>> candidates =
+            GetCandidates(keyframe_id);
+    if (candidates.empty()) return {};
+
+    // All the candidates are registered to the query keyframe in one batch.
+    std::vector<geometry::PointCloud> sources, targets;
+    std::vector<core::Tensor> inits;
+    for (const auto& candidate : candidates) {
+        sources.push_back(keyframe_point_clouds_[candidate.first]);
+        targets.push_back(keyframe_point_clouds_[keyframe_id]);
+        inits.push_back(GetRelativePose(candidate.first, keyframe_id));
+    }
+    const std::vector<registration::RegistrationResult> results =
+            registration::BatchICP(sources, targets,
+                                   params_.max_correspondence_distance_,
+                                   inits);
+
+    std::vector<LoopClosure> loop_closures;
+    for (size_t i = 0; i < candidates.size(); ++i) {
+        if (results[i].fitness_ < params_.fitness_threshold_) continue;
+        loop_closures.push_back({candidates[i].first, keyframe_id,
+                                 candidates[i].second, results[i]});
+
+        const core::Tensor information = registration::GetInformationMatrix(
+                sources[i], targets[i], params_.max_correspondence_distance_,
+                results[i].transformation_);
+        pose_graph_.edges_.push_back(
+                open3d::pipelines::registration::PoseGraphEdge(
+                        candidates[i].first, keyframe_id,
+                        ToEigenTransformation(results[i].transformation_),
+                        core::eigen_converter::TensorToEigenMatrixXd(
+                                information),
+                        true));
+    }
+    return loop_closures;
+}
+
+void LoopClosureDetector::UpdateKeyframePoses(const PoseGraph& pose_graph) {
+    if (pose_graph.nodes_.size() != keyframe_poses_.size()) {
+        utility::LogError(
+                "Pose graph has {} nodes, but the detector has {} keyframes.",
+                pose_graph.nodes_.size(), keyframe_poses_.size());
+    }
+    for (size_t i = 0; i < keyframe_poses_.size(); ++i) {
+        pose_graph_.nodes_[i].pose_ = pose_graph.nodes_[i].pose_;
+        keyframe_poses_[i] = core::eigen_converter::EigenMatrixToTensor(
+                pose_graph.nodes_[i].pose_);
+    }
+}
+
+core::Tensor LoopClosureDetector::GetKeyframePose(int keyframe_id) const {
+    CheckKeyframeId(keyframe_id);
+    return keyframe_poses_[keyframe_id];
+}
+
+const geometry::PointCloud& LoopClosureDetector::GetKeyframePointCloud(
+        int keyframe_id) const {
+    CheckKeyframeId(keyframe_id);
+    return keyframe_point_clouds_[keyframe_id];
+}
+
+void LoopClosureDetector::CheckKeyframeId(int keyframe_id) const {
+    if (keyframe_id < 0 || keyframe_id >= GetNumKeyframes()) {
+        utility::LogError("Keyframe id {} out of range [0, {}).", keyframe_id,
+                          GetNumKeyframes());
+    }
+}
+
+core::Tensor LoopClosureDetector::GetRelativePose(int source_id,
+                                                  int target_id) const {
+    return geometry::InverseTransformation(keyframe_poses_[target_id])
+            .Matmul(keyframe_poses_[source_id]);
+}
+
+}  // namespace slam
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
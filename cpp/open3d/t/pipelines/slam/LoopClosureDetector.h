@@ -0,0 +1,229 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <vector>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/pipelines/registration/PoseGraph.h"
+#include "open3d/t/geometry/PointCloud.h"
+#include "open3d/t/geometry/RGBDImage.h"
+#include "open3d/t/pipelines/registration/Registration.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace slam {
+
+using PoseGraph = open3d::pipelines::registration::PoseGraph;
+
+struct LoopClosureParams {
+    /// Number of grid cells along the image width of the global descriptors.
+    int descriptor_width_;
+
+    /// Number of grid cells along the image height of the global descriptors.
+    int descriptor_height_;
+
+    /// Maximum number of candidates verified per query keyframe.
+    int num_candidates_;
+
+    /// Minimum cosine similarity of the descriptors of a candidate.
+    float min_similarity_;
+
+    /// Number of most recent keyframes excluded from the candidates, which
+    /// are already constrained by odometry.
+    int min_keyframe_gap_;
+
+    /// Voxel size to downsample the keyframe point clouds.
+    float voxel_size_;
+
+    /// Maximum correspondence distance of the ICP verification.
+    float max_correspondence_distance_;
+
+    /// Minimum ICP fitness of an accepted loop closure.
+    float fitness_threshold_;
+
+    /// Default constructor.
+    ///
+    /// \param descriptor_width Number of grid cells along the image width of
+    /// the global descriptors. [Default: 16].
+    /// \param descriptor_height Number of grid cells along the image height of
+    /// the global descriptors. [Default: 12].
+    /// \param num_candidates Maximum number of candidates verified per query
+    /// keyframe. [Default: 5].
+    /// \param min_similarity Minimum cosine similarity of the descriptors of a
+    /// candidate. [Default: 0.8].
+    /// \param min_keyframe_gap Number of most recent keyframes excluded from
+    /// the candidates. [Default: 10].
+    /// \param voxel_size Voxel size to downsample the keyframe point clouds.
+    /// [Default: 0.05].
+    /// \param max_correspondence_distance Maximum correspondence distance of
+    /// the ICP verification. [Default: 0.1].
+    /// \param fitness_threshold Minimum ICP fitness of an accepted loop
+    /// closure. [Default: 0.3].
+    LoopClosureParams(const int descriptor_width = 16,
+                      const int descriptor_height = 12,
+                      const int num_candidates = 5,
+                      const float min_similarity = 0.8,
+                      const int min_keyframe_gap = 10,
+                      const float voxel_size = 0.05,
+                      const float max_correspondence_distance = 0.1,
+                      const float fitness_threshold = 0.3) {
+        if (descriptor_width <= 0 || descriptor_height <= 0) {
+            utility::LogError("descriptor size must be positive.");
+        }
+        if (num_candidates <= 0) {
+            utility::LogError("number of candidates must be positive.");
+        }
+        if (min_keyframe_gap < 1) {
+            utility::LogError("keyframe gap must be at least 1.");
+        }
+        if (voxel_size <= 0 || max_correspondence_distance <= 0) {
+            utility::LogError(
+                    "voxel size and correspondence distance must be "
+                    "positive.");
+        }
+
+        descriptor_width_ = descriptor_width;
+        descriptor_height_ = descriptor_height;
+        num_candidates_ = num_candidates;
+        min_similarity_ = min_similarity;
+        min_keyframe_gap_ = min_keyframe_gap;
+        voxel_size_ = voxel_size;
+        max_correspondence_distance_ = max_correspondence_distance;
+        fitness_threshold_ = fitness_threshold;
+    }
+};
+
+/// A verified loop closure between two keyframes.
+struct LoopClosure {
+    /// Earlier keyframe, the source node of the pose graph edge.
+    int source_id_;
+    /// Query keyframe, the target node of the pose graph edge.
+    int target_id_;
+    /// Cosine similarity of the descriptors.
+    float similarity_;
+    /// ICP result, with the source to target transformation.
+    registration::RegistrationResult result_;
+};
+
+/// \class LoopClosureDetector
+///
+/// \brief Keyframe database proposing and verifying loop closures online.
+/// Each keyframe stores a global descriptor, a downsampled point cloud with
+/// normals and its pose. The descriptor concatenates the zero-mean, grid
+/// averaged depth and intensity of the image, so that candidates of a query
+/// are the keyframes with the largest descriptor dot products, computed with
+/// a single matrix product on the device. The candidates are verified
+/// together with point to plane BatchICP, initialized with the relative pose
+/// of the keyframes.
+///
+/// Keyframes are the nodes of a PoseGraph, with odometry edges between
+/// consecutive keyframes and uncertain edges for the loop closures. After
+/// optimizing the pose graph, UpdateKeyframePoses makes later
+/// verifications start from the corrected poses.
+class LoopClosureDetector {
+public:
+    /// \param intrinsics (3, 3) Float64 intrinsic matrix of the camera.
+    /// \param params Descriptor and verification parameters.
+    /// \param device Device of the descriptors and keyframe point clouds.
+    LoopClosureDetector(const core::Tensor& intrinsics,
+                        const LoopClosureParams& params = LoopClosureParams(),
+                        const core::Device& device = core::Device("CPU:0"));
+
+    /// Adds a keyframe with the (4, 4) Float64 \p T_frame_to_world pose and
+    /// an odometry edge from the previous keyframe.
+    /// \param rgbd RGBD image with a UInt16 or Float32 depth image and an
+    /// optional color image of the same size.
+    /// \param depth_scale Scale factor to convert raw data into meter metric.
+    /// \param depth_max Depth truncation to discard points far away from the
+    /// camera.
+    /// \return Id of the keyframe, which is its node id in the pose graph.
+    int AddKeyframe(const geometry::RGBDImage& rgbd,
+                    const core::Tensor& T_frame_to_world,
+                    float depth_scale = 1000.0f,
+                    float depth_max = 3.0f);
+
+    /// Returns the unit length, (D,) Float32 global descriptor of \p rgbd.
+    core::Tensor ComputeDescriptor(const geometry::RGBDImage& rgbd,
+                                   float depth_scale = 1000.0f,
+                                   float depth_max = 3.0f) const;
+
+    /// Returns the ids of the keyframes at least min_keyframe_gap_ before
+    /// \p keyframe_id whose descriptor similarity is at least
+    /// min_similarity_, most similar first, and at most num_candidates_.
+    std::vector<std::pair<int, float>> GetCandidates(int keyframe_id) const;
+
+    /// Verifies the candidates of \p keyframe_id with ICP, and adds the
+    /// accepted loop closures to the pose graph as uncertain edges.
+    std::vector<LoopClosure> DetectLoopClosures(int keyframe_id);
+
+    /// Sets the keyframe poses from the nodes of \p pose_graph, usually the
+    /// result of GlobalOptimization on GetPoseGraph.
+    void UpdateKeyframePoses(const PoseGraph& pose_graph);
+
+    /// Returns the pose graph of the keyframes.
+    const PoseGraph& GetPoseGraph() const { return pose_graph_; }
+
+    int GetNumKeyframes() const {
+        return static_cast<int>(keyframe_poses_.size());
+    }
+
+    /// Returns the (4, 4) Float64 pose of a keyframe.
+    core::Tensor GetKeyframePose(int keyframe_id) const;
+
+    /// Returns the downsampled point cloud of a keyframe, with normals.
+    const geometry::PointCloud& GetKeyframePointCloud(int keyframe_id) const;
+
+    const LoopClosureParams& GetParams() const { return params_; }
+    core::Device GetDevice() const { return device_; }
+
+private:
+    void CheckKeyframeId(int keyframe_id) const;
+
+    /// Source to target transformation of the keyframe poses.
+    core::Tensor GetRelativePose(int source_id, int target_id) const;
+
+    core::Tensor intrinsics_;
+    LoopClosureParams params_;
+    core::Device device_;
+
+    /// (capacity, D) Float32 descriptors, of which the first
+    /// GetNumKeyframes() rows are used. The capacity doubles when full.
+    core::Tensor descriptors_;
+    std::vector<geometry::PointCloud> keyframe_point_clouds_;
+    /// (4, 4) Float64 keyframe poses on CPU.
+    std::vector<core::Tensor> keyframe_poses_;
+
+    PoseGraph pose_graph_;
+};
+
+}  // namespace slam
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
@@ -26,6 +26,7 @@
 
 #include "open3d/t/pipelines/slam/Model.h"
 
+#include "open3d/core/MemoryManagerStatistic.h"
 #include "open3d/core/Tensor.h"
 #include "open3d/t/geometry/Image.h"
 #include "open3d/t/geometry/RGBDImage.h"
@@ -52,7 +53,8 @@ Model::Model(float voxel_size,
                   block_resolution,
                   est_block_count,
                   device),
-      T_frame_to_world_(T_init.To(core::Device("CPU:0"))) {}
+      T_frame_to_world_(T_init.To(core::Device("CPU:0"))),
+      device_(device) {}
 
 void Model::SynthesizeModelFrame(Frame& raycast_frame,
                                  float depth_scale,
@@ -60,8 +62,10 @@ void Model::SynthesizeModelFrame(Frame& raycast_frame,
                                  float depth_max,
                                  float trunc_voxel_multiplier,
                                  bool enable_color) {
+    // Ray cast all the visible blocks, including those observed before the
+    // last integrated frame.
     auto result = voxel_grid_.RayCast(
-            frustum_block_coords_, raycast_frame.GetIntrinsics(),
+            raycast_frame.GetIntrinsics(),
             t::geometry::InverseTransformation(GetCurrentFramePose()),
             raycast_frame.GetWidth(), raycast_frame.GetHeight(),
             {"depth", "color"}, depth_scale, depth_min, depth_max,
@@ -127,6 +131,58 @@ t::geometry::TriangleMesh Model::ExtractTriangleMesh(float weight_threshold,
 
 core::HashMap Model::GetHashMap() { return voxel_grid_.GetHashMap(); }
 
+void Model::SetFrameAllocationLimit(int64_t limit) {
+    frame_allocation_limit_ = limit;
+    // Start counting from now on, the current frame may be partially done.
+    auto& statistic = core::MemoryManagerStatistic::GetInstance();
+    frame_start_malloc_count_ = statistic.GetMallocCount(device_);
+    frame_start_tag_malloc_counts_.clear();
+    for (const auto& kv : statistic.GetTagStatistics(device_)) {
+        frame_start_tag_malloc_counts_[kv.first] = kv.second.count_malloc_;
+    }
+}
+
+void Model::CountFrameAllocations() {
+    auto& statistic = core::MemoryManagerStatistic::GetInstance();
+    const int64_t malloc_count = statistic.GetMallocCount(device_);
+    // The statistics may have been reset during the frame.
+    frame_allocation_count_ =
+            std::max<int64_t>(0, malloc_count - frame_start_malloc_count_);
+    frame_start_malloc_count_ = malloc_count;
+    if (frame_allocation_limit_ < 0) {
+        return;
+    }
+
+    std::map<std::string, int64_t> tag_malloc_counts;
+    for (const auto& kv : statistic.GetTagStatistics(device_)) {
+        tag_malloc_counts[kv.first] = kv.second.count_malloc_;
+    }
+    std::swap(tag_malloc_counts, frame_start_tag_malloc_counts_);
+    if (frame_allocation_count_ <= frame_allocation_limit_) {
+        return;
+    }
+
+    std::string tags;
+    int64_t untagged_count = frame_allocation_count_;
+    for (const auto& kv : frame_start_tag_malloc_counts_) {
+        auto it = tag_malloc_counts.find(kv.first);
+        const int64_t count =
+                kv.second - (it == tag_malloc_counts.end() ? 0 : it->second);
+        if (count > 0) {
+            tags += fmt::format("\n    {}: {}", kv.first, count);
+            untagged_count -= count;
+        }
+    }
+    if (untagged_count > 0) {
+        tags += fmt::format("\n    (untagged): {}", untagged_count);
+    }
+    utility::LogError(
+            "Frame {} made {} allocations on {}, exceeding the limit of {}. "
+            "Allocations by tag:{}",
+            frame_id_, frame_allocation_count_, device_.ToString(),
+            frame_allocation_limit_, tags);
+}
+
 }  // namespace slam
 }  // namespace pipelines
 }  // namespace t
@@ -26,6 +26,9 @@
 
 #pragma once
 
+#include <map>
+#include <string>
+
 #include "open3d/core/Tensor.h"
 #include "open3d/t/geometry/Image.h"
 #include "open3d/t/geometry/RGBDImage.h"
@@ -60,6 +63,7 @@ public:
         }
         frame_id_ = frame_id;
         T_frame_to_world_ = T_frame_to_world.Contiguous();
+        CountFrameAllocations();
     }
 
     /// Apply ray casting to obtain a synthesized model frame at the down
@@ -119,6 +123,19 @@ public:
     /// Get block hashmap int the VoxelBlockGrid.
     core::HashMap GetHashMap();
 
+    /// Enable a check that at most \p limit allocations are made on the
+    /// model's device per frame, i.e. between consecutive UpdateFramePose
+    /// calls, as counted by MemoryManagerStatistic. UpdateFramePose throws
+    /// listing the allocations by memory tag if the limit is exceeded. Enable
+    /// the check after a few warm-up frames, when the hash map and the frame
+    /// buffers (see Frame::ReserveData) have reached their steady-state
+    /// capacity. A negative \p limit disables the check.
+    void SetFrameAllocationLimit(int64_t limit);
+
+    /// Returns the number of allocations on the model's device between the
+    /// last two UpdateFramePose calls.
+    int64_t GetFrameAllocationCount() const { return frame_allocation_count_; }
+
 public:
     /// Maintained volumetric map.
     t::geometry::VoxelBlockGrid voxel_grid_;
@@ -129,6 +146,20 @@ public:
     core::Tensor T_frame_to_world_;
 
     int frame_id_ = -1;
+
+private:
+    /// Update the per-frame allocation count at a frame boundary and apply the
+    /// check of SetFrameAllocationLimit.
+    void CountFrameAllocations();
+
+    core::Device device_;
+
+    int64_t frame_allocation_limit_ = -1;
+    int64_t frame_allocation_count_ = 0;
+    /// Allocation counts of the device and its memory tags at the start of
+    /// the current frame.
+    int64_t frame_start_malloc_count_ = 0;
+    std::map<std::string, int64_t> frame_start_tag_malloc_counts_;
 };
 }  // namespace slam
 }  // namespace pipelines
@@ -0,0 +1,293 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/pipelines/slam/SubmapModel.h"
+
+#include "open3d/core/TensorCheck.h"
+#include "open3d/core/TensorFunction.h"
+#include "open3d/t/geometry/Utility.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace slam {
+
+namespace {
+
+/// Concatenates the attributes shared by all \p meshes, offsetting the
+/// triangle indices.
+t::geometry::TriangleMesh MergeMeshes(
+        const std::vector<t::geometry::TriangleMesh>& meshes,
+        const core::Device& device) {
+    if (meshes.empty()) {
+        return t::geometry::TriangleMesh(device);
+    }
+
+    t::geometry::TriangleMesh merged(device);
+    for (const auto& kv : meshes[0].GetVertexAttr()) {
+        std::vector<core::Tensor> values;
+        for (const auto& mesh : meshes) {
+            if (!mesh.HasVertexAttr(kv.first)) break;
+            values.push_back(mesh.GetVertexAttr(kv.first));
+        }
+        if (values.size() == meshes.size()) {
+            merged.SetVertexAttr(kv.first, core::Concatenate(values, 0));
+        }
+    }
+
+    int64_t vertex_offset = 0;
+    std::vector<core::Tensor> indices;
+    for (const auto& mesh : meshes) {
+        if (mesh.HasTriangleIndices()) {
+            indices.push_back(mesh.GetTriangleIndices().Add(vertex_offset));
+        }
+        vertex_offset += mesh.GetVertexPositions().GetLength();
+    }
+    if (!indices.empty()) {
+        merged.SetTriangleIndices(core::Concatenate(indices, 0));
+    }
+    return merged;
+}
+
+}  // namespace
+
+SubmapModel::SubmapModel(float voxel_size,
+                         int block_resolution,
+                         int block_count,
+                         const core::Tensor& T_init,
+                         const core::Device& device)
+    : voxel_size_(voxel_size),
+      block_resolution_(block_resolution),
+      block_count_(block_count),
+      device_(device) {
+    core::AssertTensorShape(T_init, {4, 4});
+    submaps_.push_back({Model(voxel_size, block_resolution, block_count,
+                              core::Tensor::Eye(4, core::Float64,
+                                                core::Device("CPU:0")),
+                              device),
+                        T_init.To(core::Device("CPU:0"), core::Float64)
+                                .Contiguous(),
+                        ""});
+}
+
+core::Tensor SubmapModel::GetCurrentFramePose() const {
+    const Submap& submap = submaps_.back();
+    return submap.T_submap_to_world.Matmul(submap.model.T_frame_to_world_);
+}
+
+void SubmapModel::UpdateFramePose(int frame_id,
+                                  const core::Tensor& T_frame_to_world) {
+    core::AssertTensorShape(T_frame_to_world, {4, 4});
+    Submap& submap = submaps_.back();
+    const core::Tensor T_frame_to_submap =
+            t::geometry::InverseTransformation(submap.T_submap_to_world)
+                    .Matmul(T_frame_to_world.To(core::Device("CPU:0"),
+                                                core::Float64));
+
+    // Frame ids of the submap model start at 0 with the submap, so that ray
+    // casting weights the first frames of a submap as those of a session.
+    submap.model.UpdateFramePose(
+            submap.model.frame_id_ + (frame_id - frame_id_),
+            T_frame_to_submap);
+    frame_id_ = frame_id;
+    frame_poses_[frame_id] = {GetActiveSubmapId(),
+                              submap.model.T_frame_to_world_};
+}
+
+core::Tensor SubmapModel::GetFramePose(int frame_id) const {
+    auto it = frame_poses_.find(frame_id);
+    if (it == frame_poses_.end()) {
+        utility::LogError("Frame {} has no pose.", frame_id);
+    }
+    return submaps_[it->second.first].T_submap_to_world.Matmul(
+            it->second.second);
+}
+
+int SubmapModel::GetFrameSubmapId(int frame_id) const {
+    auto it = frame_poses_.find(frame_id);
+    if (it == frame_poses_.end()) {
+        utility::LogError("Frame {} has no pose.", frame_id);
+    }
+    return it->second.first;
+}
+
+void SubmapModel::SynthesizeModelFrame(Frame& raycast_frame,
+                                       float depth_scale,
+                                       float depth_min,
+                                       float depth_max,
+                                       float trunc_voxel_multiplier,
+                                       bool enable_color) {
+    submaps_.back().model.SynthesizeModelFrame(raycast_frame, depth_scale,
+                                               depth_min, depth_max,
+                                               trunc_voxel_multiplier,
+                                               enable_color);
+}
+
+odometry::OdometryResult SubmapModel::TrackFrameToModel(
+        const Frame& input_frame,
+        const Frame& raycast_frame,
+        float depth_scale,
+        float depth_max,
+        float depth_diff) {
+    return submaps_.back().model.TrackFrameToModel(
+            input_frame, raycast_frame, depth_scale, depth_max, depth_diff);
+}
+
+void SubmapModel::Integrate(const Frame& input_frame,
+                            float depth_scale,
+                            float depth_max,
+                            float trunc_voxel_multiplier) {
+    submaps_.back().model.Integrate(input_frame, depth_scale, depth_max,
+                                    trunc_voxel_multiplier);
+}
+
+int SubmapModel::StartNewSubmap() {
+    const core::Tensor T_frame_to_world = GetCurrentFramePose();
+    const core::Tensor identity =
+            core::Tensor::Eye(4, core::Float64, core::Device("CPU:0"));
+    submaps_.push_back({Model(voxel_size_, block_resolution_, block_count_,
+                              identity, device_),
+                        T_frame_to_world.Contiguous(), ""});
+    if (frame_id_ >= 0) {
+        submaps_.back().model.UpdateFramePose(0, identity);
+        frame_poses_[frame_id_] = {GetActiveSubmapId(), identity};
+    }
+    return GetActiveSubmapId();
+}
+
+core::Tensor SubmapModel::GetSubmapPose(int submap_id) const {
+    CheckSubmapId(submap_id);
+    return submaps_[submap_id].T_submap_to_world;
+}
+
+void SubmapModel::SetSubmapPose(int submap_id,
+                                const core::Tensor& T_submap_to_world) {
+    CheckSubmapId(submap_id);
+    core::AssertTensorShape(T_submap_to_world, {4, 4});
+    submaps_[submap_id].T_submap_to_world =
+            T_submap_to_world.To(core::Device("CPU:0"), core::Float64)
+                    .Contiguous();
+}
+
+Model& SubmapModel::GetSubmap(int submap_id) {
+    CheckSubmapId(submap_id);
+    return submaps_[submap_id].model;
+}
+
+void SubmapModel::OffloadSubmap(int submap_id, const std::string& file_name) {
+    CheckSubmapId(submap_id);
+    if (submap_id == GetActiveSubmapId()) {
+        utility::LogError("The active submap {} cannot be offloaded.",
+                          submap_id);
+    }
+    Submap& submap = submaps_[submap_id];
+    if (!submap.file_name.empty()) {
+        utility::LogError("Submap {} is already offloaded to {}.", submap_id,
+                          submap.file_name);
+    }
+    submap.model.voxel_grid_.Save(file_name);
+    submap.model.voxel_grid_ = t::geometry::VoxelBlockGrid();
+    submap.model.frustum_block_coords_ = core::Tensor();
+    submap.file_name = file_name;
+}
+
+void SubmapModel::ReloadSubmap(int submap_id) {
+    CheckSubmapId(submap_id);
+    Submap& submap = submaps_[submap_id];
+    if (submap.file_name.empty()) {
+        utility::LogError("Submap {} is not offloaded.", submap_id);
+    }
+    submap.model.voxel_grid_ =
+            t::geometry::VoxelBlockGrid::Load(submap.file_name);
+    submap.file_name.clear();
+}
+
+bool SubmapModel::IsSubmapOffloaded(int submap_id) const {
+    CheckSubmapId(submap_id);
+    return !submaps_[submap_id].file_name.empty();
+}
+
+t::geometry::PointCloud SubmapModel::ExtractPointCloud(float weight_threshold,
+                                                       int estimated_number) {
+    std::vector<t::geometry::PointCloud> pcds;
+    for (int i = 0; i < GetNumSubmaps(); ++i) {
+        t::geometry::VoxelBlockGrid voxel_grid = GetVoxelGrid(i);
+        if (voxel_grid.GetHashMap().Size() == 0) continue;
+        t::geometry::PointCloud pcd = voxel_grid.ExtractPointCloud(
+                weight_threshold, estimated_number);
+        if (!pcd.HasPointPositions() ||
+            pcd.GetPointPositions().GetLength() == 0) {
+            continue;
+        }
+        pcds.push_back(pcd.Transform(submaps_[i].T_submap_to_world));
+    }
+    if (pcds.empty()) {
+        return t::geometry::PointCloud(device_);
+    }
+
+    t::geometry::PointCloud merged = pcds[0];
+    for (size_t i = 1; i < pcds.size(); ++i) {
+        merged = merged.Append(pcds[i]);
+    }
+    return merged;
+}
+
+t::geometry::TriangleMesh SubmapModel::ExtractTriangleMesh(
+        float weight_threshold, int estimated_number) {
+    std::vector<t::geometry::TriangleMesh> meshes;
+    for (int i = 0; i < GetNumSubmaps(); ++i) {
+        t::geometry::VoxelBlockGrid voxel_grid = GetVoxelGrid(i);
+        if (voxel_grid.GetHashMap().Size() == 0) continue;
+        t::geometry::TriangleMesh mesh = voxel_grid.ExtractTriangleMesh(
+                weight_threshold, estimated_number);
+        if (!mesh.HasVertexPositions() ||
+            mesh.GetVertexPositions().GetLength() == 0) {
+            continue;
+        }
+        meshes.push_back(mesh.Transform(submaps_[i].T_submap_to_world));
+    }
+    return MergeMeshes(meshes, device_);
+}
+
+void SubmapModel::CheckSubmapId(int submap_id) const {
+    if (submap_id < 0 || submap_id >= GetNumSubmaps()) {
+        utility::LogError("Submap id {} out of range [0, {}).", submap_id,
+                          GetNumSubmaps());
+    }
+}
+
+t::geometry::VoxelBlockGrid SubmapModel::GetVoxelGrid(int submap_id) const {
+    const Submap& submap = submaps_[submap_id];
+    if (submap.file_name.empty()) {
+        return submap.model.voxel_grid_;
+    }
+    return t::geometry::VoxelBlockGrid::Load(submap.file_name);
+}
+
+}  // namespace slam
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
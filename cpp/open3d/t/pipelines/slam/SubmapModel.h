@@ -0,0 +1,182 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/t/geometry/PointCloud.h"
+#include "open3d/t/geometry/TriangleMesh.h"
+#include "open3d/t/pipelines/odometry/RGBDOdometry.h"
+#include "open3d/t/pipelines/slam/Frame.h"
+#include "open3d/t/pipelines/slam/Model.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace slam {
+
+/// \class SubmapModel
+///
+/// \brief Submap mode of Model. The scene is split into submaps, each a Model
+/// with its own VoxelBlockGrid in the coordinates of its anchor, the pose of
+/// the frame that started it. Tracking, ray casting and integration only use
+/// the active submap, the most recent one.
+///
+/// Frame poses are kept relative to their submap, so correcting the drift
+/// after a loop closure only changes the submap anchors with SetSubmapPose,
+/// without integrating the frames again. Inactive submaps can be offloaded to
+/// disk to release their device memory.
+class SubmapModel {
+public:
+    /// \param voxel_size Voxel size of the submaps.
+    /// \param block_resolution Resolution of the voxel blocks.
+    /// \param block_count Initial number of blocks of each submap.
+    /// \param T_init (4, 4) Float64 pose of the first frame, which anchors
+    /// the first submap.
+    /// \param device Device of the submaps.
+    SubmapModel(float voxel_size,
+                int block_resolution,
+                int block_count,
+                const core::Tensor& T_init = core::Tensor::Eye(
+                        4, core::Float64, core::Device("CPU:0")),
+                const core::Device& device = core::Device("CUDA:0"));
+
+    /// Returns the frame to world pose of the current frame.
+    core::Tensor GetCurrentFramePose() const;
+
+    /// Sets the frame to world pose of the current frame, which is stored
+    /// relative to the active submap.
+    void UpdateFramePose(int frame_id, const core::Tensor& T_frame_to_world);
+
+    /// Returns the frame to world pose of \p frame_id, from its pose in its
+    /// submap and the current submap anchor.
+    core::Tensor GetFramePose(int frame_id) const;
+
+    /// Returns the id of the submap the pose of \p frame_id is relative to.
+    int GetFrameSubmapId(int frame_id) const;
+
+    /// Apply ray casting on the active submap, see Model.
+    void SynthesizeModelFrame(Frame& raycast_frame,
+                              float depth_scale,
+                              float depth_min,
+                              float depth_max,
+                              float trunc_voxel_multiplier = 8.0,
+                              bool enable_color = true);
+
+    /// Track the input frame against a frame ray casted from the active
+    /// submap, see Model.
+    odometry::OdometryResult TrackFrameToModel(const Frame& input_frame,
+                                               const Frame& raycast_frame,
+                                               float depth_scale,
+                                               float depth_max,
+                                               float depth_diff);
+
+    /// Integrate RGBD frame into the active submap, see Model.
+    void Integrate(const Frame& input_frame,
+                   float depth_scale,
+                   float depth_max,
+                   float trunc_voxel_multiplier = 8.0f);
+
+    /// Starts a new active submap anchored at the current frame pose, and
+    /// moves the current frame to it. Call it between UpdateFramePose and
+    /// Integrate, so that the anchor frame is integrated into the new submap.
+    /// \return Id of the new submap.
+    int StartNewSubmap();
+
+    int GetNumSubmaps() const { return static_cast<int>(submaps_.size()); }
+    int GetActiveSubmapId() const { return GetNumSubmaps() - 1; }
+
+    /// Returns the (4, 4) Float64 submap to world anchor of a submap.
+    core::Tensor GetSubmapPose(int submap_id) const;
+
+    /// Re-anchors a submap to the (4, 4) \p T_submap_to_world pose, e.g.
+    /// after a pose graph optimization over the submaps. The poses of its
+    /// frames move along.
+    void SetSubmapPose(int submap_id, const core::Tensor& T_submap_to_world);
+
+    /// Returns the Model of a submap, in the coordinates of its anchor. An
+    /// offloaded submap has an empty voxel grid.
+    Model& GetSubmap(int submap_id);
+
+    /// Saves the voxel grid of an inactive submap to the .npz \p file_name
+    /// and releases it.
+    void OffloadSubmap(int submap_id, const std::string& file_name);
+
+    /// Loads the voxel grid of an offloaded submap back onto the device.
+    void ReloadSubmap(int submap_id);
+
+    bool IsSubmapOffloaded(int submap_id) const;
+
+    /// Extract the surface point cloud of all the submaps in world
+    /// coordinates. Offloaded submaps are read from disk and released again.
+    /// \param weight_threshold Weight threshold of the TSDF voxels to prune
+    /// noise.
+    /// \param estimated_number Estimation of the point cloud size of each
+    /// submap.
+    t::geometry::PointCloud ExtractPointCloud(float weight_threshold = 3.0f,
+                                              int estimated_number = -1);
+
+    /// Extract the surface triangle mesh of all the submaps in world
+    /// coordinates, with the same handling of offloaded submaps as
+    /// ExtractPointCloud. Surfaces seen by several submaps are extracted
+    /// once per submap.
+    t::geometry::TriangleMesh ExtractTriangleMesh(float weight_threshold = 3.0f,
+                                                  int estimated_number = -1);
+
+private:
+    struct Submap {
+        Model model;
+        /// (4, 4) Float64 submap to world anchor on CPU.
+        core::Tensor T_submap_to_world;
+        /// File of the voxel grid while offloaded, empty otherwise.
+        std::string file_name;
+    };
+
+    void CheckSubmapId(int submap_id) const;
+
+    /// Voxel grid of a submap, read from disk if it is offloaded.
+    t::geometry::VoxelBlockGrid GetVoxelGrid(int submap_id) const;
+
+    float voxel_size_;
+    int block_resolution_;
+    int block_count_;
+    core::Device device_;
+
+    std::vector<Submap> submaps_;
+
+    /// Submap id and the (4, 4) Float64 frame to submap pose of each frame.
+    std::map<int, std::pair<int, core::Tensor>> frame_poses_;
+    int frame_id_ = -1;
+};
+
+}  // namespace slam
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,59 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/utility/Cancellation.h"
+
+namespace open3d {
+namespace utility {
+
+static thread_local OperationContext g_current_context;
+
+OperationContext OperationContext::Current() { return g_current_context; }
+
+void OperationContext::ReportProgress(double percent) const {
+    if (update_progress_ && !(*update_progress_)(percent) && cancelled_) {
+        cancelled_->store(true, std::memory_order_relaxed);
+    }
+}
+
+ScopedOperationContext::ScopedOperationContext(
+        const CancellationToken& token,
+        std::function<bool(double)> update_progress)
+    : previous_(g_current_context) {
+    g_current_context.cancelled_ = token.cancelled_;
+    g_current_context.update_progress_ =
+            update_progress ? std::make_shared<std::function<bool(double)>>(
+                                      std::move(update_progress))
+                            : nullptr;
+}
+
+ScopedOperationContext::~ScopedOperationContext() {
+    g_current_context = previous_;
+}
+
+}  // namespace utility
+}  // namespace open3d
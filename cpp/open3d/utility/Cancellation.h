@@ -0,0 +1,125 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#pragma once
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+namespace open3d {
+namespace utility {
+
+/// Thrown by an operation that stopped because it was cancelled.
+class CancelledError : public std::runtime_error {
+public:
+    explicit CancelledError(const std::string& operation)
+        : std::runtime_error(operation + " was cancelled.") {}
+};
+
+/// \class CancellationToken
+///
+/// \brief Shared flag to request the cancellation of running operations.
+///
+/// Copies of a token refer to the same flag, so a token can be handed to the
+/// thread running an operation with ScopedOperationContext and cancelled from
+/// any other thread.
+class CancellationToken {
+public:
+    CancellationToken() : cancelled_(std::make_shared<std::atomic<bool>>()) {}
+
+    /// Requests the cancellation. Operations stop at their next check.
+    void Cancel() { cancelled_->store(true, std::memory_order_relaxed); }
+
+    bool IsCancelled() const {
+        return cancelled_->load(std::memory_order_relaxed);
+    }
+
+private:
+    std::shared_ptr<std::atomic<bool>> cancelled_;
+    friend class ScopedOperationContext;
+};
+
+/// \class OperationContext
+///
+/// \brief Cancellation and progress of the operation running on a thread.
+///
+/// Long-running operations take the context of the calling thread with
+/// Current() before their parallel loops, skip the remaining work of the
+/// loops once IsCancelled() and call ThrowIfCancelled() after them. Checks
+/// are a relaxed atomic load, cheap enough for hot loops.
+class OperationContext {
+public:
+    /// Context installed on the calling thread by ScopedOperationContext, or
+    /// a context that is never cancelled.
+    static OperationContext Current();
+
+    bool IsCancelled() const {
+        return cancelled_ && cancelled_->load(std::memory_order_relaxed);
+    }
+
+    /// \throw CancelledError If the operation was cancelled.
+    void ThrowIfCancelled(const std::string& operation) const {
+        if (IsCancelled()) {
+            throw CancelledError(operation);
+        }
+    }
+
+    /// Reports the completion percentage (0-100) of the operation to the
+    /// callback of the context. The operation is cancelled if the callback
+    /// returns false. Must be called from the thread of the context.
+    void ReportProgress(double percent) const;
+
+private:
+    std::shared_ptr<std::atomic<bool>> cancelled_;
+    std::shared_ptr<std::function<bool(double)>> update_progress_;
+    friend class ScopedOperationContext;
+};
+
+/// \class ScopedOperationContext
+///
+/// \brief Makes operations called on this thread in its scope cancellable
+/// with \p token and report their progress to \p update_progress, as
+/// `update_progress(percent)` returning false to cancel, like
+/// `io::ReadPointCloudOption::update_progress`. Scopes can be nested.
+class ScopedOperationContext {
+public:
+    explicit ScopedOperationContext(
+            const CancellationToken& token,
+            std::function<bool(double)> update_progress = {});
+    ~ScopedOperationContext();
+    ScopedOperationContext(const ScopedOperationContext&) = delete;
+    ScopedOperationContext& operator=(const ScopedOperationContext&) = delete;
+
+private:
+    OperationContext previous_;
+};
+
+}  // namespace utility
+}  // namespace open3d
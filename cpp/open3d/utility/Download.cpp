@@ -45,11 +45,13 @@
 #include <curl/easy.h>
 // clang-format on
 
-#include <fstream>
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
 #include <iomanip>
-#include <iostream>
 #include <sstream>
 #include <string>
+#include <vector>
 
 #include "open3d/data/Dataset.h"
 #include "open3d/utility/FileSystem.h"
@@ -58,47 +60,317 @@
 namespace open3d {
 namespace utility {
 
+/// Hex string of an MD5 digest.
+static std::string MD5ToString(const unsigned char hash[MD5_DIGEST_LENGTH]) {
+    std::ostringstream os;
+    os << std::hex << std::setfill('0');
+    for (int i = 0; i < MD5_DIGEST_LENGTH; ++i) {
+        os << std::setw(2) << static_cast<unsigned int>(hash[i]);
+    }
+    return os.str();
+}
+
+/// Adds the content of \p fp from its current position to \p ctx. If \p out
+/// is not null, the content is also written to it.
+static bool UpdateMD5FromFile(FILE* fp, MD5_CTX* ctx, FILE* out = nullptr) {
+    constexpr const std::size_t buffer_size{1 << 16};  // 64 KiB
+    std::vector<char> buffer(buffer_size);
+    size_t count;
+    while ((count = fread(buffer.data(), 1, buffer_size, fp)) > 0) {
+        MD5_Update(ctx, buffer.data(), count);
+        if (out && fwrite(buffer.data(), 1, count, out) != count) {
+            return false;
+        }
+    }
+    return !ferror(fp);
+}
+
 std::string GetMD5(const std::string& file_path) {
     if (!utility::filesystem::FileExists(file_path)) {
         utility::LogError("{} does not exist.", file_path);
     }
 
-    std::ifstream fp(file_path.c_str(), std::ios::in | std::ios::binary);
-
-    if (!fp.good()) {
-        std::ostringstream os;
+    FILE* fp = fopen(file_path.c_str(), "rb");
+    if (!fp) {
         utility::LogError("Cannot open {}", file_path);
     }
 
-    constexpr const std::size_t buffer_size{1 << 12};  // 4 KiB
-    char buffer[buffer_size];
     unsigned char hash[MD5_DIGEST_LENGTH] = {0};
-
     MD5_CTX ctx;
     MD5_Init(&ctx);
+    UpdateMD5FromFile(fp, &ctx);
+    MD5_Final(hash, &ctx);
+    fclose(fp);
+
+    return MD5ToString(hash);
+}
 
-    while (fp.good()) {
-        fp.read(buffer, buffer_size);
-        MD5_Update(&ctx, buffer, fp.gcount());
+/// Downloaded data goes to a file and, if set, to a running MD5 so that the
+/// file does not need to be read again for verification.
+struct DownloadSink {
+    FILE* fp = nullptr;
+    MD5_CTX* md5_ctx = nullptr;
+};
+
+static size_t WriteDataCb(void* ptr, size_t size, size_t nmemb, void* data) {
+    DownloadSink* sink = static_cast<DownloadSink*>(data);
+    size_t written = fwrite(ptr, size, nmemb, sink->fp);
+    if (sink->md5_ctx) {
+        MD5_Update(sink->md5_ctx, ptr, written * size);
     }
+    return written;
+}
 
-    MD5_Final(hash, &ctx);
-    fp.close();
+static size_t AcceptRangesCb(char* buffer,
+                             size_t size,
+                             size_t nitems,
+                             void* data) {
+    std::string header(buffer, size * nitems);
+    std::transform(header.begin(), header.end(), header.begin(), ::tolower);
+    if (header.rfind("accept-ranges:", 0) == 0 &&
+        header.find("bytes") != std::string::npos) {
+        *static_cast<bool*>(data) = true;
+    }
+    return size * nitems;
+}
 
-    std::ostringstream os;
-    os << std::hex << std::setfill('0');
+static CURL* CreateCurlHandle(const std::string& url) {
+    CURL* curl = curl_easy_init();
+    if (!curl) {
+        utility::LogError("Failed to initialize CURL.");
+    }
+    curl_easy_setopt(curl, CURLOPT_URL, url.c_str());
+    curl_easy_setopt(curl, CURLOPT_FOLLOWLOCATION, 1L);  // -L redirection.
+    curl_easy_setopt(curl, CURLOPT_SSL_VERIFYPEER, false);
+    curl_easy_setopt(curl, CURLOPT_SSL_VERIFYHOST, false);
+    // HTTP errors must not end up in the downloaded file.
+    curl_easy_setopt(curl, CURLOPT_FAILONERROR, 1L);
+    return curl;
+}
 
-    for (int i = 0; i < MD5_DIGEST_LENGTH; ++i) {
-        os << std::setw(2) << static_cast<unsigned int>(hash[i]);
+/// Size of the remote file, or -1 if unknown. \p accept_ranges is set if the
+/// server supports byte range requests.
+static int64_t GetRemoteFileSize(const std::string& url, bool& accept_ranges) {
+    accept_ranges = false;
+    CURL* curl = CreateCurlHandle(url);
+    curl_easy_setopt(curl, CURLOPT_NOBODY, 1L);
+    curl_easy_setopt(curl, CURLOPT_HEADERFUNCTION, AcceptRangesCb);
+    curl_easy_setopt(curl, CURLOPT_HEADERDATA, &accept_ranges);
+    curl_off_t size = -1;
+    if (curl_easy_perform(curl) == CURLE_OK) {
+        curl_easy_getinfo(curl, CURLINFO_CONTENT_LENGTH_DOWNLOAD_T, &size);
     }
+    curl_easy_cleanup(curl);
+    return static_cast<int64_t>(size);
+}
 
-    return os.str();
+static int64_t GetLocalFileSize(const std::string& file_path) {
+    if (!utility::filesystem::FileExists(file_path)) {
+        return 0;
+    }
+    FILE* fp = fopen(file_path.c_str(), "rb");
+    if (!fp) {
+        return 0;
+    }
+    fseek(fp, 0, SEEK_END);
+    const int64_t size = ftell(fp);
+    fclose(fp);
+    return size;
 }
 
-static size_t WriteDataCb(void* ptr, size_t size, size_t nmemb, FILE* stream) {
-    size_t written;
-    written = fwrite(ptr, size, nmemb, stream);
-    return written;
+/// Number of connections for a download of \p size bytes. Files of at least
+/// 16 MiB are split in 8 MiB segments over up to OPEN3D_DOWNLOAD_CONNECTIONS
+/// (default: 4) connections.
+static int GetNumConnections(int64_t size) {
+    int max_connections = 4;
+    if (const char* env_p = std::getenv("OPEN3D_DOWNLOAD_CONNECTIONS")) {
+        max_connections = std::max(1, std::atoi(env_p));
+    }
+    constexpr int64_t min_segment_size = 8 << 20;
+    if (size < 2 * min_segment_size) {
+        return 1;
+    }
+    return static_cast<int>(std::min<int64_t>(max_connections,
+                                              size / min_segment_size));
+}
+
+/// Downloads \p url to \p part_path in a single stream, appending to the
+/// existing partial file with a range request. The MD5 of the complete file
+/// is returned, or an empty string if the server did not resume. Sets
+/// \p resumed if a partial file was resumed.
+static std::string DownloadSingleStream(const std::string& url,
+                                        const std::string& part_path,
+                                        bool& resumed) {
+    MD5_CTX ctx;
+    MD5_Init(&ctx);
+    const int64_t resume_from = GetLocalFileSize(part_path);
+    resumed = resume_from > 0;
+    FILE* fp = fopen(part_path.c_str(), resume_from > 0 ? "a+b" : "wb");
+    if (!fp) {
+        utility::LogError("Failed to open file {}.", part_path);
+    }
+    if (resume_from > 0) {
+        utility::LogInfo("Resuming download from byte {}.", resume_from);
+        fseek(fp, 0, SEEK_SET);
+        UpdateMD5FromFile(fp, &ctx);
+        fseek(fp, 0, SEEK_END);
+    }
+
+    DownloadSink sink;
+    sink.fp = fp;
+    sink.md5_ctx = &ctx;
+    CURL* curl = CreateCurlHandle(url);
+    curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, WriteDataCb);
+    curl_easy_setopt(curl, CURLOPT_WRITEDATA, &sink);
+    curl_easy_setopt(curl, CURLOPT_RESUME_FROM_LARGE,
+                     static_cast<curl_off_t>(resume_from));
+    const CURLcode res = curl_easy_perform(curl);
+    long response_code = 0;
+    curl_easy_getinfo(curl, CURLINFO_RESPONSE_CODE, &response_code);
+    curl_easy_cleanup(curl);
+    fclose(fp);
+
+    if (resume_from > 0 &&
+        (res == CURLE_RANGE_ERROR ||
+         (res == CURLE_HTTP_RETURNED_ERROR && response_code == 416))) {
+        // The server cannot resume, or the partial file is not a prefix of
+        // the remote file.
+        return "";
+    }
+    if (res != CURLE_OK) {
+        if (GetLocalFileSize(part_path) == 0) {
+            utility::filesystem::RemoveFile(part_path);
+        }
+        utility::LogError("Download failed with error code: {}.",
+                          curl_easy_strerror(res));
+    }
+    unsigned char hash[MD5_DIGEST_LENGTH] = {0};
+    MD5_Final(hash, &ctx);
+    return MD5ToString(hash);
+}
+
+/// A byte range of a parallel download, stored in its own partial file so
+/// that each segment can be resumed independently.
+struct DownloadSegment {
+    std::string path;
+    int64_t begin = 0;
+    int64_t end = 0;  // Exclusive.
+    DownloadSink sink;
+    CURL* curl = nullptr;
+};
+
+/// Downloads the \p size bytes of \p url with range requests over
+/// \p num_connections concurrent connections, then concatenates the segments
+/// to \p part_path. Returns the MD5 of the complete file.
+static std::string DownloadParallel(const std::string& url,
+                                    const std::string& part_path,
+                                    int64_t size,
+                                    int num_connections) {
+    std::vector<DownloadSegment> segments(num_connections);
+    CURLM* multi = curl_multi_init();
+    if (!multi) {
+        utility::LogError("Failed to initialize CURL.");
+    }
+    for (int i = 0; i < num_connections; ++i) {
+        DownloadSegment& segment = segments[i];
+        segment.path = part_path + "." + std::to_string(i);
+        segment.begin = size * i / num_connections;
+        segment.end = size * (i + 1) / num_connections;
+        int64_t done = GetLocalFileSize(segment.path);
+        if (done > segment.end - segment.begin) {
+            utility::filesystem::RemoveFile(segment.path);
+            done = 0;
+        }
+        if (done == segment.end - segment.begin) {
+            continue;
+        }
+        segment.sink.fp = fopen(segment.path.c_str(), done > 0 ? "ab" : "wb");
+        if (!segment.sink.fp) {
+            utility::LogError("Failed to open file {}.", segment.path);
+        }
+        const std::string range = std::to_string(segment.begin + done) + "-" +
+                                  std::to_string(segment.end - 1);
+        segment.curl = CreateCurlHandle(url);
+        curl_easy_setopt(segment.curl, CURLOPT_WRITEFUNCTION, WriteDataCb);
+        curl_easy_setopt(segment.curl, CURLOPT_WRITEDATA, &segment.sink);
+        curl_easy_setopt(segment.curl, CURLOPT_RANGE, range.c_str());
+        curl_multi_add_handle(multi, segment.curl);
+    }
+
+    int running = 0;
+    do {
+        CURLMcode mc = curl_multi_perform(multi, &running);
+        if (mc == CURLM_OK && running > 0) {
+            mc = curl_multi_wait(multi, nullptr, 0, 1000, nullptr);
+        }
+        if (mc != CURLM_OK) {
+            running = 0;
+        }
+    } while (running > 0);
+
+    std::string error;
+    int num_messages = 0;
+    while (CURLMsg* msg = curl_multi_info_read(multi, &num_messages)) {
+        if (msg->msg == CURLMSG_DONE && msg->data.result != CURLE_OK) {
+            error = curl_easy_strerror(msg->data.result);
+        }
+    }
+    for (DownloadSegment& segment : segments) {
+        if (segment.curl) {
+            long response_code = 0;
+            curl_easy_getinfo(segment.curl, CURLINFO_RESPONSE_CODE,
+                              &response_code);
+            if (error.empty() && response_code != 206) {
+                error = fmt::format("unexpected HTTP response {} to a range "
+                                    "request",
+                                    response_code);
+            }
+            curl_multi_remove_handle(multi, segment.curl);
+            curl_easy_cleanup(segment.curl);
+            fclose(segment.sink.fp);
+        }
+    }
+    curl_multi_cleanup(multi);
+    for (const DownloadSegment& segment : segments) {
+        if (error.empty() &&
+            GetLocalFileSize(segment.path) != segment.end - segment.begin) {
+            error = "incomplete segment " + segment.path;
+        }
+    }
+    if (!error.empty()) {
+        for (const DownloadSegment& segment : segments) {
+            if (GetLocalFileSize(segment.path) > segment.end - segment.begin) {
+                utility::filesystem::RemoveFile(segment.path);
+            }
+        }
+        utility::LogError("Download failed with error: {}.", error);
+    }
+
+    // Concatenate the segments, hashing them on the way.
+    FILE* out = fopen(part_path.c_str(), "wb");
+    if (!out) {
+        utility::LogError("Failed to open file {}.", part_path);
+    }
+    MD5_CTX ctx;
+    MD5_Init(&ctx);
+    bool success = true;
+    for (const DownloadSegment& segment : segments) {
+        FILE* fp = fopen(segment.path.c_str(), "rb");
+        success = fp && UpdateMD5FromFile(fp, &ctx, out) && success;
+        if (fp) {
+            fclose(fp);
+        }
+    }
+    fclose(out);
+    if (!success) {
+        utility::LogError("Failed to write {}.", part_path);
+    }
+    for (const DownloadSegment& segment : segments) {
+        utility::filesystem::RemoveFile(segment.path);
+    }
+    unsigned char hash[MD5_DIGEST_LENGTH] = {0};
+    MD5_Final(hash, &ctx);
+    return MD5ToString(hash);
 }
 
 std::string DownloadFromURL(const std::string& url,
@@ -137,42 +409,38 @@ std::string DownloadFromURL(const std::string& url,
         return file_path;
     }
 
-    // Download.
-    CURL* curl;
-    FILE* fp;
-    CURLcode res;
-    curl = curl_easy_init();
-    if (!curl) {
-        utility::LogError("Failed to initialize CURL.");
-    }
-    fp = fopen(file_path.c_str(), "wb");
-    if (!fp) {
-        utility::LogError("Failed to open file {}.", file_path);
-    }
-    curl_easy_setopt(curl, CURLOPT_URL, url.c_str());
-    curl_easy_setopt(curl, CURLOPT_FOLLOWLOCATION, 1L);  // -L redirection.
-    curl_easy_setopt(curl, CURLOPT_SSL_VERIFYPEER, false);
-    curl_easy_setopt(curl, CURLOPT_SSL_VERIFYHOST, false);
-    curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, WriteDataCb);
-    curl_easy_setopt(curl, CURLOPT_WRITEDATA, fp);
-    res = curl_easy_perform(curl);
-    curl_easy_cleanup(curl);
-    fclose(fp);
-
-    if (res == CURLE_OK) {
-        const std::string actual_md5 = GetMD5(file_path);
-        if (actual_md5 == md5) {
-            utility::LogInfo("Downloaded to {}", file_path);
-        } else {
-            utility::LogError(
-                    "MD5 mismatch for {}.\n- Expected: {}\n- Actual  : {}",
-                    file_path, md5, actual_md5);
-        }
+    // Download to a partial file, which is kept on failures so that the next
+    // call resumes it. Large files are fetched over several connections if
+    // the server supports range requests.
+    const std::string part_path = file_path + ".part";
+    bool accept_ranges = false;
+    const int64_t size = GetRemoteFileSize(url, accept_ranges);
+    const int num_connections = accept_ranges ? GetNumConnections(size) : 1;
+    std::string actual_md5;
+    if (num_connections > 1) {
+        actual_md5 = DownloadParallel(url, part_path, size, num_connections);
     } else {
-        utility::LogError("Download failed with error code: {}.",
-                          curl_easy_strerror(res));
+        bool resumed = false;
+        actual_md5 = DownloadSingleStream(url, part_path, resumed);
+        if (resumed && actual_md5 != md5) {
+            // The partial file could not be resumed or was stale, start over.
+            utility::filesystem::RemoveFile(part_path);
+            actual_md5 = DownloadSingleStream(url, part_path, resumed);
+        }
     }
 
+    if (actual_md5 != md5) {
+        // The data is wrong, the next call must not resume from it.
+        utility::filesystem::RemoveFile(part_path);
+        utility::LogError(
+                "MD5 mismatch for {}.\n- Expected: {}\n- Actual  : {}",
+                file_path, md5, actual_md5);
+    }
+    utility::filesystem::RemoveFile(file_path);
+    if (std::rename(part_path.c_str(), file_path.c_str()) != 0) {
+        utility::LogError("Failed to move {} to {}.", part_path, file_path);
+    }
+    utility::LogInfo("Downloaded to {}", file_path);
     return file_path;
 }
 
@@ -38,6 +38,12 @@ std::string GetMD5(const std::string& file_path);
 
 /// \brief Download a file from URL.
 ///
+/// The data is downloaded to `<file>.part` and moved to the file once its MD5
+/// matches. A failed download leaves the partial file in place and the next
+/// call resumes it with a range request. Files of at least 16 MiB are fetched
+/// over several concurrent range requests if the server supports them, see
+/// the OPEN3D_DOWNLOAD_CONNECTIONS environment variable (default: 4).
+///
 /// \param url File URL. The saved file name will be the last part of the URL.
 /// \param md5 MD5 checksum of the file. This is required as the same
 /// URL may point to different files over time.
@@ -43,6 +43,7 @@
 #else
 #include <dirent.h>
 #include <limits.h>
+#include <sys/mman.h>
 #include <sys/stat.h>
 #include <unistd.h>
 #endif
@@ -624,6 +625,94 @@ size_t CFile::ReadData(void *data, size_t elem_size, size_t num_elems) {
     return elems;
 }
 
+MappedFile::~MappedFile() { Close(); }
+
+bool MappedFile::Open(const std::string &filename, bool copy_on_write) {
+    Close();
+#ifdef WIN32
+    HANDLE file = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ,
+                              nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL,
+                              nullptr);
+    LARGE_INTEGER file_size;
+    if (file == INVALID_HANDLE_VALUE) {
+        return false;
+    }
+    file_ = file;
+    if (!GetFileSizeEx(file, &file_size)) {
+        Close();
+        return false;
+    }
+    size_ = file_size.QuadPart;
+    if (size_ > 0) {
+        HANDLE mapping = CreateFileMappingA(
+                file, nullptr, copy_on_write ? PAGE_WRITECOPY : PAGE_READONLY,
+                0, 0, nullptr);
+        mapping_ = mapping;
+        void *data = mapping ? MapViewOfFile(mapping,
+                                             copy_on_write ? FILE_MAP_COPY
+                                                           : FILE_MAP_READ,
+                                             0, 0, 0)
+                             : nullptr;
+        if (data == nullptr) {
+            Close();
+            return false;
+        }
+        data_ = static_cast<uint8_t *>(data);
+    }
+#else
+    fd_ = open(filename.c_str(), O_RDONLY);
+    struct stat file_stat;
+    if (fd_ < 0 || fstat(fd_, &file_stat) != 0) {
+        Close();
+        return false;
+    }
+    size_ = file_stat.st_size;
+    if (size_ > 0) {
+        void *data = copy_on_write ? mmap(nullptr, size_,
+                                          PROT_READ | PROT_WRITE, MAP_PRIVATE,
+                                          fd_, 0)
+                                   : mmap(nullptr, size_, PROT_READ,
+                                          MAP_SHARED, fd_, 0);
+        if (data == MAP_FAILED) {
+            Close();
+            return false;
+        }
+        data_ = static_cast<uint8_t *>(data);
+    }
+#endif
+    is_open_ = true;
+    copy_on_write_ = copy_on_write;
+    return true;
+}
+
+void MappedFile::Close() {
+#ifdef WIN32
+    if (data_) {
+        UnmapViewOfFile(data_);
+    }
+    if (mapping_) {
+        CloseHandle(mapping_);
+    }
+    if (file_) {
+        CloseHandle(file_);
+    }
+    file_ = nullptr;
+    mapping_ = nullptr;
+#else
+    if (data_) {
+        munmap(data_, size_);
+    }
+    if (fd_ >= 0) {
+        close(fd_);
+    }
+    fd_ = -1;
+#endif
+    is_open_ = false;
+    copy_on_write_ = false;
+    data_ = nullptr;
+    size_ = 0;
+}
+
 }  // namespace filesystem
 }  // namespace utility
 }  // namespace open3d
@@ -26,6 +26,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <functional>
 #include <string>
 #include <vector>
@@ -169,6 +170,54 @@ private:
     std::vector<char> line_buffer_;
 };
 
+/// RAII read-only memory mapping of a whole file. Unlike CFile, the data can be
+/// accessed concurrently from several threads without any copies.
+///
+/// A copy-on-write mapping can also be written to. The written pages become
+/// private copies, the file itself is never modified.
+class MappedFile {
+public:
+    MappedFile() = default;
+    /// The destructor unmaps the file automatically.
+    ~MappedFile();
+    MappedFile(const MappedFile &) = delete;
+    MappedFile &operator=(const MappedFile &) = delete;
+
+    /// Map a file. Returns false if the file can not be opened or mapped.
+    ///
+    /// \param filename Path to the file.
+    /// \param copy_on_write Map the file copy-on-write, see GetMutableData().
+    bool Open(const std::string &filename, bool copy_on_write = false);
+
+    /// Unmap the file.
+    void Close();
+
+    /// Returns true if a file is mapped.
+    bool IsOpen() const { return is_open_; }
+
+    /// Returns the mapped file content. May be nullptr for an empty file.
+    const uint8_t *GetData() const { return data_; }
+
+    /// Returns the writable mapped file content of a copy-on-write mapping, or
+    /// nullptr.
+    uint8_t *GetMutableData() { return copy_on_write_ ? data_ : nullptr; }
+
+    /// Returns the file size in bytes.
+    int64_t GetSize() const { return size_; }
+
+private:
+    bool is_open_ = false;
+    bool copy_on_write_ = false;
+    uint8_t *data_ = nullptr;
+    int64_t size_ = 0;
+#ifdef WIN32
+    void *file_ = nullptr;
+    void *mapping_ = nullptr;
+#else
+    int fd_ = -1;
+#endif
+};
+
 }  // namespace filesystem
 }  // namespace utility
 }  // namespace open3d
@@ -31,12 +31,14 @@
 #endif
 
 #include "open3d/utility/Logging.h"
+#include "open3d/utility/Preprocessor.h"
 
 namespace open3d {
 namespace utility {
 
 struct ISAInfo::Impl {
     ISATarget target_;
+    ISATarget cpu_target_;
 };
 
 static ISATarget GetSelectedISATarget() {
@@ -49,6 +51,25 @@ static ISATarget GetSelectedISATarget() {
 #endif
 }
 
+/// Mirrors the selection of the function variants of OPEN3D_TARGET_CLONES.
+static ISATarget GetSelectedCPUTarget() {
+#ifdef OPEN3D_TARGET_CLONES_ENABLED
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f") &&
+        __builtin_cpu_supports("avx512bw") &&
+        __builtin_cpu_supports("avx512dq") &&
+        __builtin_cpu_supports("avx512vl")) {
+        return ISATarget::AVX512SKX;
+    }
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) {
+        return ISATarget::AVX2;
+    }
+    return ISATarget::SSE2;
+#else
+    return ISATarget::DISABLED;
+#endif
+}
+
 static std::string ToString(ISATarget target) {
     switch (target) {
         /* x86 */
@@ -85,6 +106,7 @@ static std::string ToString(ISATarget target) {
 
 ISAInfo::ISAInfo() : impl_(new ISAInfo::Impl()) {
     impl_->target_ = GetSelectedISATarget();
+    impl_->cpu_target_ = GetSelectedCPUTarget();
 }
 
 ISAInfo& ISAInfo::GetInstance() {
@@ -94,9 +116,13 @@ ISAInfo& ISAInfo::GetInstance() {
 
 ISATarget ISAInfo::SelectedTarget() const { return impl_->target_; }
 
+ISATarget ISAInfo::SelectedCPUTarget() const { return impl_->cpu_target_; }
+
 void ISAInfo::Print() const {
     utility::LogInfo("ISAInfo: {} instruction set used in ISPC code.",
                      ToString(SelectedTarget()));
+    utility::LogInfo("ISAInfo: {} instruction set used in multi-ISA C++ code.",
+                     ToString(SelectedCPUTarget()));
 }
 
 }  // namespace utility
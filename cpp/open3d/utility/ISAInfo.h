@@ -51,7 +51,8 @@ enum class ISATarget {
 
 /// \brief ISA information.
 ///
-/// This provides information about kernel code written in ISPC.
+/// This provides information about kernel code written in ISPC and about C++
+/// kernels compiled for multiple ISAs with OPEN3D_TARGET_CLONES.
 class ISAInfo {
 public:
     static ISAInfo& GetInstance();
@@ -63,6 +64,11 @@ public:
     /// Returns the dispatched ISA target that will be used in kernel code.
     ISATarget SelectedTarget() const;
 
+    /// Returns the ISA target of the C++ kernels compiled with
+    /// OPEN3D_TARGET_CLONES selected for this CPU, i.e. AVX512SKX, AVX2 or
+    /// SSE2, or DISABLED if they are only compiled for the baseline ISA.
+    ISATarget SelectedCPUTarget() const;
+
     /// Prints ISAInfo in the console.
     void Print() const;
 
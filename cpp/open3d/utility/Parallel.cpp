@@ -30,7 +30,17 @@
 #include <omp.h>
 #endif
 
+#ifdef __linux__
+#include <sched.h>
+#endif
+
+#include <tbb/global_control.h>
+
+#include <algorithm>
+#include <atomic>
 #include <cstdlib>
+#include <memory>
+#include <mutex>
 #include <string>
 
 #include "open3d/utility/CPUInfo.h"
@@ -39,6 +49,14 @@
 namespace open3d {
 namespace utility {
 
+static std::atomic<int> g_max_threads(0);
+static thread_local int g_parallel_depth = 0;
+
+static std::mutex g_arena_mutex;
+static tbb::task_arena* g_external_arena = nullptr;
+static std::unique_ptr<tbb::task_arena> g_default_arena;
+static std::unique_ptr<tbb::global_control> g_global_control;
+
 static std::string GetEnvVar(const std::string& name) {
     if (const char* value = std::getenv(name.c_str())) {
         return std::string(value);
@@ -47,7 +65,32 @@ static std::string GetEnvVar(const std::string& name) {
     }
 }
 
-int EstimateMaxThreads() {
+/// Physical cores the process may run on, e.g. the cores of one NUMA node
+/// when started with `numactl --cpunodebind` or `taskset`, so that threads
+/// bound to the allowed CPUs are not oversubscribed.
+static int NumAvailableCores() {
+    const CPUInfo& cpu_info = CPUInfo::GetInstance();
+    const int num_cores = cpu_info.NumCores();
+#ifdef __linux__
+    cpu_set_t cpu_set;
+    CPU_ZERO(&cpu_set);
+    if (sched_getaffinity(0, sizeof(cpu_set), &cpu_set) == 0) {
+        const int num_allowed = CPU_COUNT(&cpu_set);
+        const int num_threads = cpu_info.NumThreads();
+        if (num_allowed > 0 && num_allowed < num_threads) {
+            return std::max(1, num_cores * num_allowed / num_threads);
+        }
+    }
+#endif
+    return num_cores;
+}
+
+/// Thread budget for a top-level parallel region.
+static int DefaultMaxThreads() {
+    const int max_threads = g_max_threads.load();
+    if (max_threads > 0) {
+        return max_threads;
+    }
 #ifdef _OPENMP
     if (!GetEnvVar("OMP_NUM_THREADS").empty() ||
         !GetEnvVar("OMP_DYNAMIC").empty()) {
@@ -55,17 +98,23 @@ int EstimateMaxThreads() {
         // https://www.openmp.org/spec-html/5.0/openmpch6.html
         return omp_get_max_threads();
     } else {
-        // Returns the number of physical cores.
-        return utility::CPUInfo::GetInstance().NumCores();
+        // Returns the number of physical cores available to the process.
+        static const int num_available_cores = NumAvailableCores();
+        return num_available_cores;
     }
 #else
     (void)&GetEnvVar;  // Avoids compiler warning.
+    (void)&NumAvailableCores;
     return 1;
 #endif
 }
 
+int EstimateMaxThreads() { return InParallel() ? 1 : DefaultMaxThreads(); }
+
 bool InParallel() {
-    // TODO: when we add TBB/Parallel STL support to ParallelFor, update this.
+    if (g_parallel_depth > 0) {
+        return true;
+    }
 #ifdef _OPENMP
     return omp_in_parallel();
 #else
@@ -73,5 +122,45 @@ bool InParallel() {
 #endif
 }
 
+void SetMaxThreads(int max_threads) {
+    std::lock_guard<std::mutex> lock(g_arena_mutex);
+    g_max_threads = std::max(max_threads, 0);
+    // Caps TBB calls that do not go through GetTaskArena() as well.
+    g_global_control.reset();
+    if (max_threads > 0) {
+        g_global_control.reset(new tbb::global_control(
+                tbb::global_control::max_allowed_parallelism, max_threads));
+    }
+    g_default_arena.reset();
+}
+
+ScopedParallelRegion::ScopedParallelRegion() { ++g_parallel_depth; }
+
+ScopedParallelRegion::~ScopedParallelRegion() { --g_parallel_depth; }
+
+void ExecuteInArena(const std::function<void()>& func) {
+    if (InParallel()) {
+        func();
+    } else {
+        GetTaskArena().execute(func);
+    }
+}
+
+void SetTaskArena(tbb::task_arena* arena) {
+    std::lock_guard<std::mutex> lock(g_arena_mutex);
+    g_external_arena = arena;
+}
+
+tbb::task_arena& GetTaskArena() {
+    std::lock_guard<std::mutex> lock(g_arena_mutex);
+    if (g_external_arena != nullptr) {
+        return *g_external_arena;
+    }
+    if (!g_default_arena) {
+        g_default_arena.reset(new tbb::task_arena(DefaultMaxThreads()));
+    }
+    return *g_default_arena;
+}
+
 }  // namespace utility
 }  // namespace open3d
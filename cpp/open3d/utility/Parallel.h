@@ -26,14 +26,60 @@
 
 #pragma once
 
+#include <functional>
+
+#ifndef __CUDACC__
+#include <tbb/task_arena.h>
+#endif
+
 namespace open3d {
 namespace utility {
 
 /// Estimate the maximum number of threads to be used in a parallel region.
+///
+/// Returns the limit set by SetMaxThreads() if any, otherwise the OpenMP
+/// setting or the number of physical cores in the CPU affinity mask of the
+/// process, e.g. one NUMA node under `numactl --cpunodebind`. Returns 1 when
+/// called from within a parallel region, so that nested regions run serially
+/// instead of oversubscribing the CPU.
 int EstimateMaxThreads();
 
-/// Returns true if in an parallel section.
+/// Returns true if in an parallel section, either an OpenMP parallel region
+/// or a TBB task wrapped in a ScopedParallelRegion.
 bool InParallel();
 
+/// Limit the number of threads used by all CPU parallel paths (OpenMP, TBB and
+/// ISPC launches through core::ParallelFor). This is a process-wide budget
+/// meant for embedding Open3D in applications that run their own thread pools.
+/// A value <= 0 restores the default. Must not be called while parallel work
+/// is running.
+void SetMaxThreads(int max_threads);
+
+/// Mark the calling thread as running inside a parallel region for the
+/// lifetime of the object. Use this in the body of TBB tasks so that nested
+/// parallel calls are serialized, like nested OpenMP regions.
+class ScopedParallelRegion {
+public:
+    ScopedParallelRegion();
+    ~ScopedParallelRegion();
+    ScopedParallelRegion(const ScopedParallelRegion&) = delete;
+    ScopedParallelRegion& operator=(const ScopedParallelRegion&) = delete;
+};
+
+/// Run \p func in the TBB task arena used by Open3D. If called from within a
+/// parallel region, \p func is run directly on the calling thread.
+void ExecuteInArena(const std::function<void()>& func);
+
+#ifndef __CUDACC__
+/// Use an external TBB task arena for all TBB parallel paths, e.g. to share
+/// an application's arena and its thread limit and affinity settings. The
+/// arena must outlive its use. Pass nullptr to restore the default arena with
+/// EstimateMaxThreads() threads.
+void SetTaskArena(tbb::task_arena* arena);
+
+/// Returns the TBB task arena used by Open3D.
+tbb::task_arena& GetTaskArena();
+#endif
+
 }  // namespace utility
 }  // namespace open3d
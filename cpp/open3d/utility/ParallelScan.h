@@ -29,6 +29,12 @@
 #include <tbb/parallel_for.h>
 #include <tbb/parallel_scan.h>
 
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#include "open3d/utility/Parallel.h"
+
 #if TBB_INTERFACE_VERSION >= 10000
 
 // Check if the C++ standard library implements parallel algorithms
@@ -93,5 +99,46 @@ void InclusivePrefixSum(const Tin* first, const Tin* last, Tout* out) {
 #endif
 }
 
+/// Returns the indices i in [0, n) for which \p pred(i) is true, in
+/// increasing order. The selected indices of contiguous chunks are counted in
+/// parallel, then written in parallel into the pre-sized output, so \p pred
+/// is evaluated twice per index and must be cheap and thread safe.
+template <class Index, class Predicate>
+std::vector<Index> ParallelSelectIndices(int64_t n, const Predicate& pred) {
+    const int num_threads = EstimateMaxThreads();
+    // A few chunks per thread balance the load, chunks of at least 4096
+    // indices keep the per-chunk overhead small.
+    const int64_t num_chunks = std::max<int64_t>(
+            1, std::min<int64_t>(4 * num_threads, n / 4096));
+    const int64_t chunk_size = (n + num_chunks - 1) / num_chunks;
+
+    std::vector<int64_t> offsets(num_chunks + 1, 0);
+#pragma omp parallel for schedule(static) num_threads(num_threads)
+    for (int64_t c = 0; c < num_chunks; ++c) {
+        const int64_t end = std::min(n, (c + 1) * chunk_size);
+        int64_t count = 0;
+        for (int64_t i = c * chunk_size; i < end; ++i) {
+            count += pred(i) ? 1 : 0;
+        }
+        offsets[c + 1] = count;
+    }
+    for (int64_t c = 0; c < num_chunks; ++c) {
+        offsets[c + 1] += offsets[c];
+    }
+
+    std::vector<Index> indices(offsets[num_chunks]);
+#pragma omp parallel for schedule(static) num_threads(num_threads)
+    for (int64_t c = 0; c < num_chunks; ++c) {
+        const int64_t end = std::min(n, (c + 1) * chunk_size);
+        int64_t offset = offsets[c];
+        for (int64_t i = c * chunk_size; i < end; ++i) {
+            if (pred(i)) {
+                indices[offset++] = static_cast<Index>(i);
+            }
+        }
+    }
+    return indices;
+}
+
 }  // namespace utility
 }  // namespace open3d
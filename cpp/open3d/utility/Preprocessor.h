@@ -82,3 +82,28 @@
 /// \endcode
 #define OPEN3D_OVERLOAD(func, ...) \
     OPEN3D_CONCAT(func, OPEN3D_NUM_ARGS(__VA_ARGS__))
+
+/// OPEN3D_TARGET_CLONES
+///
+/// Compiles the following function for AVX-512 (Skylake server), AVX2 with
+/// FMA (Haswell) and the baseline ISA. The variant for the running CPU is
+/// selected once when the library is loaded, so a single binary runs at full
+/// speed on heterogeneous machines. The function body, including OpenMP
+/// regions and inlined lambdas, is compiled for each ISA. Functions called,
+/// but not inlined, use the baseline ISA.
+///
+/// Expands to nothing where function multiversioning is not available, i.e.
+/// on non-x86-64 targets, outside of Linux, with compilers older than GCC 8
+/// or Clang 14, in CUDA code, or if OPEN3D_DISABLE_TARGET_CLONES is defined.
+/// OPEN3D_TARGET_CLONES_ENABLED is defined otherwise.
+#if !defined(OPEN3D_DISABLE_TARGET_CLONES) && !defined(__CUDACC__) &&  \
+        defined(__linux__) && defined(__x86_64__) &&                    \
+        ((defined(__clang__) && __clang_major__ >= 14) ||               \
+         (!defined(__clang__) && defined(__GNUC__) && __GNUC__ >= 8))
+#define OPEN3D_TARGET_CLONES_ENABLED
+#define OPEN3D_TARGET_CLONES                                            \
+    __attribute__((target_clones("arch=skylake-avx512", "arch=haswell", \
+                                 "default")))
+#else
+#define OPEN3D_TARGET_CLONES
+#endif
@@ -0,0 +1,208 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/utility/Tracing.h"
+
+#include <chrono>
+#include <fstream>
+#include <mutex>
+#include <vector>
+
+#ifdef BUILD_CUDA_MODULE
+#include <nvtx3/nvToolsExt.h>
+#endif
+
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace utility {
+namespace tracing {
+
+namespace detail {
+std::atomic<bool> g_enabled(false);
+}  // namespace detail
+
+namespace {
+
+struct TraceEvent {
+    const char* name_;
+    int64_t start_us_;
+    int64_t duration_us_;
+    int thread_id_;
+};
+
+struct TraceState {
+    std::mutex mutex_;
+    std::vector<TraceEvent> events_;
+    int64_t max_events_ = 0;
+    int64_t num_dropped_ = 0;
+};
+
+TraceState& GetState() {
+    static TraceState state;
+    return state;
+}
+
+std::atomic<bool> g_nvtx(false);
+
+int64_t GetTimeInMicroseconds() {
+    // Relative to the first call, so that traces start close to 0.
+    static const auto origin = std::chrono::steady_clock::now();
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+                   std::chrono::steady_clock::now() - origin)
+            .count();
+}
+
+// Small, stable thread ids in the order threads record their first zone.
+int GetThreadId() {
+    static std::atomic<int> num_threads(0);
+    thread_local int thread_id = num_threads++;
+    return thread_id;
+}
+
+void AppendJsonString(std::string& out, const char* str) {
+    out += '"';
+    for (const char* c = str; *c != '\0'; ++c) {
+        if (*c == '"' || *c == '\\') {
+            out += '\\';
+            out += *c;
+        } else if (static_cast<unsigned char>(*c) < 0x20) {
+            out += ' ';
+        } else {
+            out += *c;
+        }
+    }
+    out += '"';
+}
+
+}  // namespace
+
+void Enable(bool nvtx, int64_t max_events) {
+    if (max_events <= 0) {
+        utility::LogError("Invalid max_events {}, must be > 0.", max_events);
+    }
+    TraceState& state = GetState();
+    {
+        std::lock_guard<std::mutex> lock(state.mutex_);
+        state.max_events_ = max_events;
+    }
+#ifndef BUILD_CUDA_MODULE
+    if (nvtx) {
+        utility::LogWarning(
+                "NVTX ranges require Open3D to be built with CUDA, only "
+                "recording trace zones.");
+    }
+#endif
+    g_nvtx = nvtx;
+    GetTimeInMicroseconds();
+    detail::g_enabled = true;
+}
+
+void Disable() { detail::g_enabled = false; }
+
+void Clear() {
+    TraceState& state = GetState();
+    std::lock_guard<std::mutex> lock(state.mutex_);
+    state.events_.clear();
+    state.num_dropped_ = 0;
+}
+
+int64_t GetNumEvents() {
+    TraceState& state = GetState();
+    std::lock_guard<std::mutex> lock(state.mutex_);
+    return static_cast<int64_t>(state.events_.size());
+}
+
+int64_t GetNumDroppedEvents() {
+    TraceState& state = GetState();
+    std::lock_guard<std::mutex> lock(state.mutex_);
+    return state.num_dropped_;
+}
+
+std::string GetChromeTrace() {
+    TraceState& state = GetState();
+    std::lock_guard<std::mutex> lock(state.mutex_);
+
+    std::string out = "{\"traceEvents\":[";
+    for (size_t i = 0; i < state.events_.size(); ++i) {
+        const TraceEvent& event = state.events_[i];
+        out += i == 0 ? "\n{\"name\":" : ",\n{\"name\":";
+        AppendJsonString(out, event.name_);
+        out += ",\"cat\":\"open3d\",\"ph\":\"X\",\"ts\":";
+        out += std::to_string(event.start_us_);
+        out += ",\"dur\":";
+        out += std::to_string(event.duration_us_);
+        out += ",\"pid\":0,\"tid\":";
+        out += std::to_string(event.thread_id_);
+        out += '}';
+    }
+    out += "\n],\"displayTimeUnit\":\"ms\"}\n";
+    return out;
+}
+
+bool WriteChromeTrace(const std::string& filename) {
+    std::ofstream file(filename);
+    if (!file.is_open()) {
+        utility::LogWarning("Cannot open {} for writing the trace.", filename);
+        return false;
+    }
+    file << GetChromeTrace();
+    return static_cast<bool>(file);
+}
+
+void ScopedZone::Begin() {
+#ifdef BUILD_CUDA_MODULE
+    nvtx_ = g_nvtx;
+    if (nvtx_) {
+        nvtxRangePushA(name_);
+    }
+#endif
+    start_us_ = GetTimeInMicroseconds();
+}
+
+void ScopedZone::End() {
+    const int64_t end_us = GetTimeInMicroseconds();
+#ifdef BUILD_CUDA_MODULE
+    if (nvtx_) {
+        nvtxRangePop();
+    }
+#endif
+    const int thread_id = GetThreadId();
+
+    TraceState& state = GetState();
+    std::lock_guard<std::mutex> lock(state.mutex_);
+    if (static_cast<int64_t>(state.events_.size()) < state.max_events_) {
+        state.events_.push_back(
+                {name_, start_us_, end_us - start_us_, thread_id});
+    } else {
+        ++state.num_dropped_;
+    }
+}
+
+}  // namespace tracing
+}  // namespace utility
+}  // namespace open3d
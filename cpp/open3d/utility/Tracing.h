@@ -0,0 +1,117 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+#include "open3d/utility/Preprocessor.h"
+
+namespace open3d {
+namespace utility {
+namespace tracing {
+
+/// Start recording trace zones. Zones are recorded in memory until Clear() and
+/// can be exported with GetChromeTrace() or WriteChromeTrace(). If \p nvtx is
+/// true and Open3D is built with CUDA, zones are also emitted as NVTX ranges
+/// for Nsight Systems. At most \p max_events zones are kept, later ones are
+/// counted as dropped.
+void Enable(bool nvtx = false, int64_t max_events = 1000000);
+
+/// Stop recording trace zones. Recorded zones are kept.
+void Disable();
+
+namespace detail {
+extern std::atomic<bool> g_enabled;
+}  // namespace detail
+
+/// Returns true if trace zones are being recorded.
+inline bool IsEnabled() {
+    return detail::g_enabled.load(std::memory_order_relaxed);
+}
+
+/// Discard all recorded zones.
+void Clear();
+
+/// Returns the number of recorded zones.
+int64_t GetNumEvents();
+
+/// Returns the number of zones dropped since the last Clear() because
+/// max_events was reached.
+int64_t GetNumDroppedEvents();
+
+/// Returns the recorded zones as a Chrome trace event JSON string, which can be
+/// opened with chrome://tracing or https://ui.perfetto.dev.
+std::string GetChromeTrace();
+
+/// Writes the recorded zones as a Chrome trace event JSON file. Returns false
+/// if the file cannot be written.
+bool WriteChromeTrace(const std::string& filename);
+
+/// \class ScopedZone
+///
+/// \brief Records the host wall time of its scope as a trace zone named
+/// \p name, which must outlive the trace (e.g. a string literal). When tracing
+/// is disabled, construction and destruction only read an atomic flag.
+///
+/// Asynchronous CUDA work is accounted to the zone in which the host waits for
+/// it. Use the OPEN3D_TRACE_ZONE macro to instrument a scope.
+class ScopedZone {
+public:
+    explicit ScopedZone(const char* name)
+        : name_(name), start_us_(-1), nvtx_(false) {
+        if (IsEnabled()) {
+            Begin();
+        }
+    }
+    ~ScopedZone() {
+        if (start_us_ >= 0) {
+            End();
+        }
+    }
+    ScopedZone(const ScopedZone&) = delete;
+    ScopedZone& operator=(const ScopedZone&) = delete;
+
+private:
+    void Begin();
+    void End();
+
+    const char* name_;
+    int64_t start_us_;
+    bool nvtx_;
+};
+
+}  // namespace tracing
+}  // namespace utility
+}  // namespace open3d
+
+/// Records the rest of the enclosing scope as a trace zone named \p name.
+#define OPEN3D_TRACE_ZONE(name)                                      \
+    ::open3d::utility::tracing::ScopedZone OPEN3D_CONCAT(            \
+            open3d_trace_zone_, __LINE__)(name)
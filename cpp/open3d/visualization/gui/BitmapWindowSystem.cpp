@@ -26,6 +26,7 @@
 
 #include "open3d/visualization/gui/BitmapWindowSystem.h"
 
+#include <atomic>
 #include <chrono>
 #include <mutex>
 #include <queue>
@@ -49,6 +50,8 @@ struct BitmapWindow {
     Rect frame;
     Point mouse_pos;
     int mouse_buttons = 0;
+    // Read back the next frame even if nothing changed in it.
+    std::atomic<bool> force_capture{true};
 
     BitmapWindow(Window *o3dw, int width, int height)
         : o3d_window(o3dw), frame(0, 0, width, height) {}
@@ -224,6 +227,10 @@ void BitmapWindowSystem::PostRedrawEvent(OSWindow w) {
     impl_->event_queue_.push(std::make_shared<BitmapDrawEvent>(hw));
 }
 
+void BitmapWindowSystem::ForceCapture(OSWindow w) {
+    ((BitmapWindow *)w)->force_capture = true;
+}
+
 void BitmapWindowSystem::PostMouseEvent(OSWindow w, const MouseEvent &e) {
     auto hw = (BitmapWindow *)w;
     impl_->event_queue_.push(std::make_shared<BitmapMouseEvent>(hw, e));
@@ -307,6 +314,11 @@ rendering::FilamentRenderer *BitmapWindowSystem::CreateRenderer(OSWindow w) {
         if (!this->impl_->on_draw_) {
             return;
         }
+        // Skip the read back if the frame is identical to the last one.
+        auto *bw = (BitmapWindow *)w;
+        if (!bw->force_capture.exchange(false) && !renderer->IsFrameDamaged()) {
+            return;
+        }
 
         auto size = this->GetWindowSizePixels(w);
         Window *window = ((BitmapWindow *)w)->o3d_window;
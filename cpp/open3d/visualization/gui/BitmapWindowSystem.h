@@ -73,6 +73,10 @@ public:
     Size GetScreenSize(OSWindow w) override;
 
     void PostRedrawEvent(OSWindow w) override;
+    /// Makes the next drawn frame of \p w be passed to the on-draw callback
+    /// even if it is unchanged from the previous frame. Frames are otherwise
+    /// only read back when their content changed.
+    void ForceCapture(OSWindow w);
     void PostMouseEvent(OSWindow w, const MouseEvent& e);
     void PostKeyEvent(OSWindow w, const KeyEvent& e);
     void PostTextInputEvent(OSWindow w, const TextInputEvent& e);
@@ -65,6 +65,7 @@
 #include <imgui.h>
 
 #include <cerrno>
+#include <cstdint>
 #include <iostream>
 #include <map>
 #include <vector>
@@ -142,6 +143,41 @@ private:
     size_t next_index_ = 0;
 };
 
+// FNV-1a hash of \p size bytes at \p data, continuing from \p hash.
+static std::uint64_t HashBytes(const void* data,
+                               size_t size,
+                               std::uint64_t hash) {
+    auto bytes = static_cast<const unsigned char*>(data);
+    for (size_t i = 0; i < size; ++i) {
+        hash = (hash ^ bytes[i]) * 1099511628211ull;
+    }
+    return hash;
+}
+
+// Hashes everything in \p data that affects the rendered UI, so that an
+// unchanged UI can be detected without comparing the previous draw data.
+// Returns 0 if the draw data contains user callbacks, whose output cannot be
+// known in advance.
+static std::uint64_t HashDrawData(const ImDrawData* data) {
+    std::uint64_t hash = 14695981039346656037ull;
+    hash = HashBytes(&data->DisplaySize, sizeof(data->DisplaySize), hash);
+    hash = HashBytes(&data->CmdListsCount, sizeof(data->CmdListsCount), hash);
+    for (int idx = 0; idx < data->CmdListsCount; idx++) {
+        const ImDrawList* cmds = data->CmdLists[idx];
+        hash = HashBytes(cmds->VtxBuffer.Data,
+                         cmds->VtxBuffer.Size * sizeof(ImDrawVert), hash);
+        hash = HashBytes(cmds->IdxBuffer.Data,
+                         cmds->IdxBuffer.Size * sizeof(ImDrawIdx), hash);
+        for (const auto& pcmd : cmds->CmdBuffer) {
+            if (pcmd.UserCallback) return 0;
+            hash = HashBytes(&pcmd.ClipRect, sizeof(pcmd.ClipRect), hash);
+            hash = HashBytes(&pcmd.TextureId, sizeof(pcmd.TextureId), hash);
+            hash = HashBytes(&pcmd.ElemCount, sizeof(pcmd.ElemCount), hash);
+        }
+    }
+    return hash;
+}
+
 static const char* kUiBlitTexParamName = "albedo";
 static const char* kImageTexParamName = "image";
 
@@ -159,6 +195,8 @@ struct ImguiFilamentBridge::Impl {
     utils::Entity renderable_;
     filament::Texture* font_texture_ = nullptr;
     bool has_synced_ = false;
+    // Hash of the draw data of the last Update(), 0 if unknown.
+    std::uint64_t last_draw_data_hash_ = 0;
 
     visualization::rendering::FilamentRenderer* renderer_ =
             nullptr;  // we do not own this
@@ -287,7 +325,7 @@ public:
     uint16_t height_;
 };
 
-void ImguiFilamentBridge::Update(ImDrawData* imgui_data) {
+bool ImguiFilamentBridge::Update(ImDrawData* imgui_data) {
     impl_->has_synced_ = false;
 
     auto& engine = visualization::rendering::EngineInstance::GetInstance();
@@ -298,9 +336,13 @@ void ImguiFilamentBridge::Update(ImDrawData* imgui_data) {
     ImGuiIO& io = ImGui::GetIO();
     int fbwidth = (int)(io.DisplaySize.x * io.DisplayFramebufferScale.x);
     int fbheight = (int)(io.DisplaySize.y * io.DisplayFramebufferScale.y);
-    if (fbwidth == 0 || fbheight == 0) return;
+    if (fbwidth == 0 || fbheight == 0) return false;
     imgui_data->ScaleClipRects(io.DisplayFramebufferScale);
 
+    const std::uint64_t hash = HashDrawData(imgui_data);
+    const bool changed = (hash == 0 || hash != impl_->last_draw_data_hash_);
+    impl_->last_draw_data_hash_ = hash;
+
     // Ensure that we have enough vertex buffers and index buffers.
     CreateBuffers(imgui_data->CmdListsCount);
 
@@ -384,6 +426,7 @@ void ImguiFilamentBridge::Update(ImDrawData* imgui_data) {
     if (imgui_data->CmdListsCount > 0) {
         rbuilder.build(engine, impl_->renderable_);
     }
+    return changed;
 }
 
 void ImguiFilamentBridge::OnWindowResized(const Window& window) {
@@ -105,8 +105,9 @@ public:
 
     // This populates the Filament View. Clients are responsible for
     // rendering the View. This should be called on every frame, regardless of
-    // whether the Renderer wants to skip or not.
-    void Update(ImDrawData* imguiData);
+    // whether the Renderer wants to skip or not. Returns true if the draw data
+    // differs from the previous call, i.e. the UI needs to be redrawn.
+    bool Update(ImDrawData* imguiData);
 
     void OnWindowResized(const Window& window);
 
@@ -1133,6 +1133,13 @@ Widget::DrawResult SceneWidget::Draw(const DrawContext& context) {
         ForceRedraw();
     }
 
+    // Stream in the octree chunks of large point clouds for this camera. If
+    // chunks are still missing, keep redrawing until they are all uploaded.
+    bool lod_pending = impl_->scene_->UpdatePointCloudLOD();
+    if (lod_pending) {
+        ForceRedraw();
+    }
+
     // The scene will be rendered to texture, so all we need to do is
     // draw the image. This is just a pass-through, and the ImGuiFilamentBridge
     // will blit the texture.
@@ -1182,6 +1189,9 @@ Widget::DrawResult SceneWidget::Draw(const DrawContext& context) {
 
     ImGui::End();
 
+    if (lod_pending) {
+        return Widget::DrawResult::REDRAW;
+    }
     return Widget::DrawResult::NONE;
 }
 
@@ -921,7 +921,9 @@ Widget::DrawResult Window::DrawOnce(bool is_layout_pass) {
     ImGui::Render();  // creates the draw data (i.e. Render()s to data)
 
     // Draw the ImGui commands
-    impl_->imgui_.imgui_bridge->Update(ImGui::GetDrawData());
+    if (impl_->imgui_.imgui_bridge->Update(ImGui::GetDrawData())) {
+        impl_->renderer_->DamageFrame();
+    }
 
     // Draw. Since ImGUI is an immediate mode gui, it does layout during
     // draw, and if we are drawing for layout purposes, don't actually
@@ -27,12 +27,16 @@
 #include "open3d/visualization/rendering/Open3DScene.h"
 
 #include <algorithm>
+#include <set>
 
 #include "open3d/geometry/Geometry.h"
 #include "open3d/geometry/LineSet.h"
 #include "open3d/geometry/TriangleMesh.h"
+#include "open3d/t/geometry/PointCloud.h"
 #include "open3d/visualization/gui/Application.h"
+#include "open3d/visualization/rendering/Camera.h"
 #include "open3d/visualization/rendering/MaterialRecord.h"
+#include "open3d/visualization/rendering/PointCloudLOD.h"
 #include "open3d/visualization/rendering/Scene.h"
 #include "open3d/visualization/rendering/View.h"
 
@@ -43,6 +47,33 @@ namespace rendering {
 const std::string kAxisObjectName("__axis__");
 const std::string kFastModelObjectSuffix("__fast__");
 const std::string kLowQualityModelObjectSuffix("__low__");
+const std::string kPointCloudLODChunkSuffix("__lod__");
+
+// Uploading a chunk copies it to the GPU, so limit the uploads per frame to
+// keep the frame rate up while the camera moves.
+const int kMaxLODUploadsPerUpdate = 8;
+// Chunks that are not drawn stay resident until the resident points exceed
+// this multiple of the point budget.
+const int64_t kLODResidentBudgetFactor = 2;
+
+struct Open3DScene::PointCloudLODData {
+    std::shared_ptr<PointCloudLOD> octree;
+    MaterialRecord material;
+    Eigen::Matrix4d transform = Eigen::Matrix4d::Identity();
+    /// Uploaded chunks other than the root and the frame they were last
+    /// selected in.
+    std::map<int, int64_t> resident;
+    /// Chunks selected in the last update, including the root.
+    std::set<int> selected = {0};
+
+    std::string ChunkName(const std::string& name, int node_id) const {
+        if (node_id == 0) {
+            return name;
+        }
+        return name + "." + kPointCloudLODChunkSuffix + "." +
+               std::to_string(node_id);
+    }
+};
 
 namespace {
 std::shared_ptr<geometry::TriangleMesh> CreateAxisGeometry(double axis_length) {
@@ -244,6 +275,7 @@ void Open3DScene::ClearGeometry() {
         if (!g.second.low_name.empty()) {
             scene->RemoveGeometry(g.second.low_name);
         }
+        RemovePointCloudLODChunks(g.second);
     }
     geometries_.clear();
     bounds_ = geometry::AxisAlignedBoundingBox();
@@ -286,6 +318,16 @@ void Open3DScene::AddGeometry(
         const t::geometry::Geometry* geom,
         const MaterialRecord& mat,
         bool add_downsampled_copy_for_fast_rendering /*= true*/) {
+    if (geom->GetGeometryType() ==
+        t::geometry::Geometry::GeometryType::PointCloud) {
+        auto cloud = static_cast<const t::geometry::PointCloud*>(geom);
+        if (cloud->HasPointPositions() &&
+            size_t(cloud->GetPointPositions().GetLength()) > lod_threshold_) {
+            AddPointCloudLOD(name, *cloud, mat);
+            return;
+        }
+    }
+
     size_t downsample_threshold = SIZE_MAX;
     std::string fast_name;
     if (add_downsampled_copy_for_fast_rendering) {
@@ -322,6 +364,133 @@ void Open3DScene::AddGeometry(
     axis_dirty_ = true;
 }
 
+void Open3DScene::AddPointCloudLOD(const std::string& name,
+                                   const t::geometry::PointCloud& cloud,
+                                   const MaterialRecord& mat) {
+    auto lod = std::make_shared<PointCloudLODData>();
+    lod->octree = std::make_shared<PointCloudLOD>(cloud);
+    lod->material = mat;
+
+    // The root chunk stands in for the whole cloud under its own name, so
+    // picking, bounds and the per-name API keep working.
+    auto scene = renderer_.GetScene(scene_);
+    if (scene->AddGeometry(name, lod->octree->GetNodePointCloud(0), mat)) {
+        bounds_ += lod->octree->GetBounds();
+        GeometryData info(name, "");
+        info.lod = lod;
+        geometries_[name] = info;
+        SetGeometryToLOD(info, lod_);
+    }
+
+    axis_dirty_ = true;
+}
+
+void Open3DScene::RemovePointCloudLODChunks(const GeometryData& data) {
+    if (!data.lod) {
+        return;
+    }
+    auto scene = renderer_.GetScene(scene_);
+    for (auto& chunk : data.lod->resident) {
+        scene->RemoveGeometry(data.lod->ChunkName(data.name, chunk.first));
+    }
+    data.lod->resident.clear();
+    data.lod->selected = {0};
+}
+
+void Open3DScene::SetPointCloudLODQuality(double max_screen_space_error,
+                                          size_t point_budget) {
+    lod_max_screen_space_error_ = max_screen_space_error;
+    lod_point_budget_ = point_budget;
+}
+
+bool Open3DScene::UpdatePointCloudLOD() {
+    auto scene = renderer_.GetScene(scene_);
+    auto view = scene->GetView(view_);
+    auto camera = view->GetCamera();
+    const Eigen::Matrix4d view_matrix =
+            camera->GetViewMatrix().matrix().cast<double>();
+    const Eigen::Matrix4d projection =
+            camera->GetProjectionMatrix().matrix().cast<double>();
+    const int viewport_height = view->GetViewport()[3];
+    // Interactive frames trade detail for speed like the downsampled copies.
+    const double max_error = lod_ == LOD::FAST
+                                     ? 4.0 * lod_max_screen_space_error_
+                                     : lod_max_screen_space_error_;
+    const int64_t budget = int64_t(std::min(
+            lod_point_budget_, size_t(INT64_MAX / kLODResidentBudgetFactor)));
+
+    ++lod_frame_;
+    int n_uploads = 0;
+    bool pending = false;
+    for (auto& g : geometries_) {
+        auto& data = g.second;
+        if (!data.lod || !data.visible) {
+            continue;
+        }
+        auto& lod = *data.lod;
+        const auto& nodes = lod.octree->GetNodes();
+        const std::vector<int> selection = lod.octree->SelectNodes(
+                view_matrix * lod.transform, projection, viewport_height,
+                max_error, budget);
+
+        std::set<int> selected = {0};
+        for (int id : selection) {
+            if (id == 0) {
+                continue;
+            }
+            auto chunk = lod.resident.find(id);
+            if (chunk == lod.resident.end()) {
+                if (n_uploads >= kMaxLODUploadsPerUpdate) {
+                    pending = true;
+                    continue;
+                }
+                const std::string chunk_name = lod.ChunkName(data.name, id);
+                scene->AddGeometry(chunk_name,
+                                   lod.octree->GetNodePointCloud(id),
+                                   lod.material);
+                const Eigen::Transform<float, 3, Eigen::Affine> t(
+                        lod.transform.cast<float>());
+                scene->SetGeometryTransform(chunk_name, t);
+                chunk = lod.resident.emplace(id, lod_frame_).first;
+                ++n_uploads;
+            }
+            chunk->second = lod_frame_;
+            selected.insert(id);
+        }
+
+        for (auto& chunk : lod.resident) {
+            scene->ShowGeometry(lod.ChunkName(data.name, chunk.first),
+                                selected.count(chunk.first) > 0);
+        }
+        lod.selected = std::move(selected);
+
+        // Evict the least recently used chunks that are not drawn.
+        int64_t n_resident = 0;
+        for (auto& chunk : lod.resident) {
+            n_resident += nodes[chunk.first].num_points_;
+        }
+        const int64_t max_resident = budget * kLODResidentBudgetFactor;
+        if (n_resident > max_resident) {
+            std::vector<std::pair<int64_t, int>> unused;
+            for (auto& chunk : lod.resident) {
+                if (chunk.second != lod_frame_) {
+                    unused.emplace_back(chunk.second, chunk.first);
+                }
+            }
+            std::sort(unused.begin(), unused.end());
+            for (auto& chunk : unused) {
+                if (n_resident <= max_resident) {
+                    break;
+                }
+                scene->RemoveGeometry(lod.ChunkName(data.name, chunk.second));
+                lod.resident.erase(chunk.second);
+                n_resident -= nodes[chunk.second].num_points_;
+            }
+        }
+    }
+    return pending;
+}
+
 bool Open3DScene::HasGeometry(const std::string& name) const {
     auto scene = renderer_.GetScene(scene_);
     return scene->HasGeometry(name);
@@ -338,6 +507,7 @@ void Open3DScene::RemoveGeometry(const std::string& name) {
         if (!g->second.low_name.empty()) {
             scene->RemoveGeometry(g->second.low_name);
         }
+        RemovePointCloudLODChunks(g->second);
         geometries_.erase(name);
     }
 }
@@ -361,6 +531,14 @@ void Open3DScene::SetGeometryTransform(const std::string& name,
         if (!g->second.low_name.empty()) {
             scene->SetGeometryTransform(g->second.low_name, t);
         }
+        if (g->second.lod) {
+            auto& lod = *g->second.lod;
+            lod.transform = transform;
+            for (auto& chunk : lod.resident) {
+                scene->SetGeometryTransform(
+                        lod.ChunkName(name, chunk.first), t);
+            }
+        }
     }
 }
 
@@ -378,6 +556,13 @@ void Open3DScene::ModifyGeometryMaterial(const std::string& name,
         if (!it->second.fast_name.empty()) {
             scene->OverrideMaterial(it->second.fast_name, mat);
         }
+        if (it->second.lod) {
+            auto& lod = *it->second.lod;
+            lod.material = mat;
+            for (auto& chunk : lod.resident) {
+                scene->OverrideMaterial(lod.ChunkName(name, chunk.first), mat);
+            }
+        }
         // Don't want to override low_name, as that is a bounding box.
     }
 }
@@ -419,6 +604,14 @@ void Open3DScene::UpdateMaterial(const MaterialRecord& mat) {
         if (!g.second.fast_name.empty()) {
             scene->OverrideMaterial(g.second.fast_name, mat);
         }
+        if (g.second.lod) {
+            auto& lod = *g.second.lod;
+            lod.material = mat;
+            for (auto& chunk : lod.resident) {
+                scene->OverrideMaterial(
+                        lod.ChunkName(g.second.name, chunk.first), mat);
+            }
+        }
         // Low-quality model is a bounding box right now, and we want it to
         // be a solid color, so we do not want to override.
         // if (!g.second.low_name.empty()) {
@@ -462,6 +655,15 @@ void Open3DScene::SetGeometryToLOD(const GeometryData& data, LOD lod) {
     if (!data.low_name.empty()) {
         scene->ShowGeometry(data.low_name, false);
     }
+    if (data.lod) {
+        // The octree chunks replace the downsampled copies, the selection is
+        // refined for the new LOD by UpdatePointCloudLOD().
+        for (auto& chunk : data.lod->resident) {
+            scene->ShowGeometry(data.lod->ChunkName(data.name, chunk.first),
+                                data.visible &&
+                                        data.lod->selected.count(chunk.first));
+        }
+    }
 
     if (data.visible) {
         if (lod == LOD::HIGH_DETAIL) {
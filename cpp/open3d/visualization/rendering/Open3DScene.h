@@ -27,6 +27,7 @@
 #pragma once
 
 #include <map>
+#include <memory>
 #include <vector>
 
 #include "open3d/geometry/BoundingVolume.h"
@@ -44,7 +45,8 @@ class Image;
 namespace t {
 namespace geometry {
 class Geometry;
-}
+class PointCloud;
+}  // namespace geometry
 }  // namespace t
 
 namespace visualization {
@@ -91,6 +93,27 @@ public:
     }
     size_t GetDownsampleThreshold() const { return downsample_threshold_; }
 
+    /// Sets the number of points above which AddGeometry splits a tensor
+    /// point cloud into an octree of chunks (see PointCloudLOD) instead of
+    /// uploading it at once. Chunks are uploaded to the GPU on demand by
+    /// UpdatePointCloudLOD(). The default, SIZE_MAX, disables the octree.
+    void SetPointCloudLODThreshold(size_t n_points) {
+        lod_threshold_ = n_points;
+    }
+    size_t GetPointCloudLODThreshold() const { return lod_threshold_; }
+
+    /// Sets the screen-space error in pixels up to which octree chunks are
+    /// refined, and the maximum number of points drawn per point cloud.
+    void SetPointCloudLODQuality(double max_screen_space_error,
+                                 size_t point_budget);
+
+    /// Selects the octree chunks of each point cloud for the current camera,
+    /// uploads missing chunks and evicts chunks that have not been used for
+    /// a while. At most a few chunks are uploaded per call to keep frames
+    /// interactive. Returns true if chunks are still missing, in which case
+    /// the caller should redraw and call it again.
+    bool UpdatePointCloudLOD();
+
     void ClearGeometry();
     /// Adds a geometry with the specified name. Default visible is true.
     void AddGeometry(const std::string& name,
@@ -138,11 +161,16 @@ public:
     Renderer& GetRenderer() const;
 
 private:
+    struct PointCloudLODData;
+
     struct GeometryData {
         std::string name;
         std::string fast_name;
         std::string low_name;
         bool visible;
+        /// Octree of chunks, set only for point clouds above the LOD
+        /// threshold. The root chunk is the geometry \p name.
+        std::shared_ptr<PointCloudLODData> lod;
 
         GeometryData() : visible(false) {}  // for STL containers
         GeometryData(const std::string& n, const std::string& fast)
@@ -150,6 +178,10 @@ private:
     };
 
     void SetGeometryToLOD(const GeometryData&, LOD lod);
+    void AddPointCloudLOD(const std::string& name,
+                          const t::geometry::PointCloud& cloud,
+                          const MaterialRecord& mat);
+    void RemovePointCloudLODChunks(const GeometryData& data);
 
 private:
     Renderer& renderer_;
@@ -163,6 +195,10 @@ private:
     std::map<std::string, GeometryData> geometries_;  // name -> data
     geometry::AxisAlignedBoundingBox bounds_;
     size_t downsample_threshold_ = 6000000;
+    size_t lod_threshold_ = SIZE_MAX;
+    double lod_max_screen_space_error_ = 2.0;
+    size_t lod_point_budget_ = 10000000;
+    int64_t lod_frame_ = 0;
 };
 
 }  // namespace rendering
@@ -0,0 +1,271 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/visualization/rendering/PointCloudLOD.h"
+
+#include <Eigen/LU>
+#include <algorithm>
+#include <cmath>
+#include <deque>
+#include <limits>
+#include <queue>
+#include <utility>
+
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace visualization {
+namespace rendering {
+
+bool PointCloudLOD::Node::IsLeaf() const {
+    return std::all_of(children_.begin(), children_.end(),
+                       [](int child) { return child < 0; });
+}
+
+PointCloudLOD::PointCloudLOD(const t::geometry::PointCloud& cloud,
+                             const Options& options)
+    : cloud_(cloud) {
+    if (!cloud.HasPointPositions() ||
+        cloud.GetPointPositions().GetLength() == 0) {
+        utility::LogError("PointCloudLOD requires a non-empty point cloud.");
+    }
+    if (options.max_points_per_node_ < 1 || options.grid_resolution_ < 1) {
+        utility::LogError(
+                "max_points_per_node and grid_resolution must be positive.");
+    }
+    const core::Tensor positions = cloud.GetPointPositions()
+                                           .To(core::Device("CPU:0"))
+                                           .To(core::Float32)
+                                           .Contiguous();
+    const float* points = positions.GetDataPtr<float>();
+    const int64_t num_points = positions.GetLength();
+
+    // The root is the bounding cube of the cloud.
+    Eigen::Vector3d min_bound = Eigen::Vector3d::Constant(
+            std::numeric_limits<double>::max());
+    Eigen::Vector3d max_bound = -min_bound;
+    for (int64_t i = 0; i < num_points; ++i) {
+        const Eigen::Vector3d p = Eigen::Map<const Eigen::Vector3f>(
+                                          points + 3 * i)
+                                          .cast<double>();
+        min_bound = min_bound.cwiseMin(p);
+        max_bound = max_bound.cwiseMax(p);
+    }
+    const Eigen::Vector3d center = 0.5 * (min_bound + max_bound);
+    // Pad the cube so that points on the maximum faces fall inside.
+    const double half_size =
+            0.5 * std::max((max_bound - min_bound).maxCoeff(), 1e-6) * 1.001;
+
+    Node root;
+    root.bounds_ = geometry::AxisAlignedBoundingBox(
+            center - Eigen::Vector3d::Constant(half_size),
+            center + Eigen::Vector3d::Constant(half_size));
+    root.children_.fill(-1);
+    nodes_.push_back(root);
+
+    std::vector<int64_t> root_indices(num_points);
+    for (int64_t i = 0; i < num_points; ++i) root_indices[i] = i;
+
+    point_order_ = core::Tensor::Empty({num_points}, core::Int64);
+    int64_t* order = point_order_.GetDataPtr<int64_t>();
+    int64_t num_ordered = 0;
+
+    const int resolution = options.grid_resolution_;
+    std::vector<bool> occupied;
+
+    // Breadth-first, so that nodes and their point ranges are stored level by
+    // level.
+    std::deque<std::pair<int, std::vector<int64_t>>> pending;
+    pending.emplace_back(0, std::move(root_indices));
+    while (!pending.empty()) {
+        const int node_id = pending.front().first;
+        const std::vector<int64_t> indices = std::move(pending.front().second);
+        pending.pop_front();
+
+        Node& node = nodes_[node_id];
+        const Eigen::Vector3d node_min = node.bounds_.min_bound_;
+        const double node_size = node.bounds_.GetMaxExtent();
+        const double cell_size = node_size / resolution;
+        const int depth = node.depth_;
+        node.spacing_ = cell_size;
+        node.offset_ = num_ordered;
+
+        if (static_cast<int64_t>(indices.size()) <=
+                    options.max_points_per_node_ ||
+            depth >= options.max_depth_) {
+            std::copy(indices.begin(), indices.end(), order + num_ordered);
+            num_ordered += static_cast<int64_t>(indices.size());
+            node.num_points_ = static_cast<int64_t>(indices.size());
+            continue;
+        }
+
+        // Keep the first point of every grid cell, pass the others on to the
+        // octant that contains them.
+        occupied.assign(static_cast<size_t>(resolution) * resolution *
+                                resolution,
+                        false);
+        std::array<std::vector<int64_t>, 8> child_indices;
+        for (const int64_t index : indices) {
+            const float* p = points + 3 * index;
+            int cell[3];
+            int octant = 0;
+            for (int axis = 0; axis < 3; ++axis) {
+                const double offset = p[axis] - node_min(axis);
+                cell[axis] = std::min(
+                        std::max(static_cast<int>(offset / cell_size), 0),
+                        resolution - 1);
+                if (offset >= 0.5 * node_size) octant |= 1 << axis;
+            }
+            const size_t cell_id =
+                    (static_cast<size_t>(cell[0]) * resolution + cell[1]) *
+                            resolution +
+                    cell[2];
+            if (!occupied[cell_id]) {
+                occupied[cell_id] = true;
+                order[num_ordered++] = index;
+            } else {
+                child_indices[octant].push_back(index);
+            }
+        }
+        node.num_points_ = num_ordered - node.offset_;
+
+        for (int octant = 0; octant < 8; ++octant) {
+            if (child_indices[octant].empty()) continue;
+            Node child;
+            Eigen::Vector3d child_min = node_min;
+            for (int axis = 0; axis < 3; ++axis) {
+                if (octant & (1 << axis)) child_min(axis) += 0.5 * node_size;
+            }
+            child.bounds_ = geometry::AxisAlignedBoundingBox(
+                    child_min,
+                    child_min + Eigen::Vector3d::Constant(0.5 * node_size));
+            child.depth_ = depth + 1;
+            child.children_.fill(-1);
+            // nodes_ may reallocate, so node must not be used after this.
+            const int child_id = static_cast<int>(nodes_.size());
+            nodes_[node_id].children_[octant] = child_id;
+            nodes_.push_back(child);
+            pending.emplace_back(child_id, std::move(child_indices[octant]));
+        }
+    }
+    utility::LogDebug("PointCloudLOD: {} points in {} nodes.", num_points,
+                      nodes_.size());
+}
+
+t::geometry::PointCloud PointCloudLOD::GetNodePointCloud(int node_id) const {
+    const Node& node = nodes_.at(node_id);
+    const core::Tensor indices = point_order_.Slice(
+            0, node.offset_, node.offset_ + node.num_points_);
+    t::geometry::PointCloud chunk(cloud_.GetDevice());
+    for (const auto& kv : cloud_.GetPointAttr()) {
+        chunk.SetPointAttr(kv.first,
+                           kv.second.IndexGet({indices.To(
+                                   kv.second.GetDevice())}));
+    }
+    return chunk;
+}
+
+std::vector<int> PointCloudLOD::SelectNodes(
+        const Eigen::Matrix4d& model_view,
+        const Eigen::Matrix4d& projection,
+        int viewport_height,
+        double max_screen_space_error,
+        int64_t point_budget) const {
+    const Eigen::Matrix4d model_view_projection = projection * model_view;
+    // Perspective projections have -1 (OpenGL) in the last row, orthographic
+    // projections have a constant w.
+    const bool is_perspective = projection(3, 2) != 0.0;
+    const double pixels_per_unit = 0.5 * projection(1, 1) * viewport_height;
+    const double scale =
+            std::cbrt(std::abs(model_view.topLeftCorner<3, 3>().determinant()));
+
+    auto is_visible = [&](const Node& node) {
+        // Cull against each of the six clip planes, -w <= x, y, z <= w.
+        int outside[6] = {0, 0, 0, 0, 0, 0};
+        for (int corner = 0; corner < 8; ++corner) {
+            Eigen::Vector4d p(
+                    corner & 1 ? node.bounds_.max_bound_(0)
+                               : node.bounds_.min_bound_(0),
+                    corner & 2 ? node.bounds_.max_bound_(1)
+                               : node.bounds_.min_bound_(1),
+                    corner & 4 ? node.bounds_.max_bound_(2)
+                               : node.bounds_.min_bound_(2),
+                    1.0);
+            p = model_view_projection * p;
+            for (int axis = 0; axis < 3; ++axis) {
+                outside[2 * axis] += p(axis) < -p(3);
+                outside[2 * axis + 1] += p(axis) > p(3);
+            }
+        }
+        return std::none_of(outside, outside + 6,
+                            [](int count) { return count == 8; });
+    };
+    auto screen_space_error = [&](const Node& node) {
+        double distance = 1.0;
+        if (is_perspective) {
+            const Eigen::Vector3d center =
+                    (model_view * node.bounds_.GetCenter().homogeneous())
+                            .head<3>();
+            const double radius = 0.5 * scale * node.bounds_.GetExtent().norm();
+            distance = center.norm() - radius;
+            if (distance <= 0) {
+                // The camera is inside the node.
+                return std::numeric_limits<double>::infinity();
+            }
+        }
+        return scale * node.spacing_ * pixels_per_unit / distance;
+    };
+
+    using Candidate = std::pair<double, int>;
+    std::priority_queue<Candidate> candidates;
+    if (is_visible(nodes_[0])) {
+        candidates.emplace(screen_space_error(nodes_[0]), 0);
+    }
+    std::vector<int> selected;
+    int64_t num_selected_points = 0;
+    while (!candidates.empty()) {
+        const Candidate candidate = candidates.top();
+        candidates.pop();
+        const Node& node = nodes_[candidate.second];
+        if (!selected.empty() &&
+            num_selected_points + node.num_points_ > point_budget) {
+            break;
+        }
+        selected.push_back(candidate.second);
+        num_selected_points += node.num_points_;
+        if (candidate.first <= max_screen_space_error) continue;
+        for (const int child : node.children_) {
+            if (child >= 0 && is_visible(nodes_[child])) {
+                candidates.emplace(screen_space_error(nodes_[child]), child);
+            }
+        }
+    }
+    return selected;
+}
+
+}  // namespace rendering
+}  // namespace visualization
+}  // namespace open3d
@@ -0,0 +1,122 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <Eigen/Core>
+#include <array>
+#include <vector>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/geometry/BoundingVolume.h"
+#include "open3d/t/geometry/PointCloud.h"
+
+namespace open3d {
+namespace visualization {
+namespace rendering {
+
+/// \brief Octree of point chunks for level-of-detail rendering of large point
+/// clouds.
+///
+/// The hierarchy follows Potree: every node covers a cube and stores a grid
+/// subsample of the points in its cube that no ancestor stores. Drawing a node
+/// together with all its ancestors shows its region at the node's spacing, so
+/// a renderer only uploads and draws the nodes whose spacing is visible on
+/// screen. The points of each node are contiguous in a permutation of the
+/// source cloud, so chunks are gathered with a single IndexGet.
+class PointCloudLOD {
+public:
+    struct Options {
+        /// Nodes with at most this many points are not subdivided.
+        int64_t max_points_per_node_ = 65536;
+        /// Inner nodes keep one point per cell of a grid with this many cells
+        /// along each axis of the node.
+        int grid_resolution_ = 64;
+        /// Maximum depth of the octree, the root has depth 0.
+        int max_depth_ = 16;
+    };
+
+    struct Node {
+        /// Cube covered by the node.
+        geometry::AxisAlignedBoundingBox bounds_;
+        /// Grid cell size of the node, the approximate distance between its
+        /// points.
+        double spacing_ = 0;
+        int depth_ = 0;
+        /// Range of the node's points in GetPointOrder().
+        int64_t offset_ = 0;
+        int64_t num_points_ = 0;
+        /// Indices of the child nodes in GetNodes(), -1 for empty octants.
+        std::array<int, 8> children_;
+
+        bool IsLeaf() const;
+    };
+
+    /// Builds the octree on the CPU. The attribute tensors of \p cloud are
+    /// shared, not copied, and chunks are gathered from them on demand.
+    PointCloudLOD(const t::geometry::PointCloud& cloud,
+                  const Options& options);
+    explicit PointCloudLOD(const t::geometry::PointCloud& cloud)
+        : PointCloudLOD(cloud, Options()) {}
+
+    /// Nodes in breadth-first order, the root is node 0.
+    const std::vector<Node>& GetNodes() const { return nodes_; }
+    /// Permutation of the source points that groups the points of each node.
+    const core::Tensor& GetPointOrder() const { return point_order_; }
+    int64_t NumPoints() const { return point_order_.GetLength(); }
+    const geometry::AxisAlignedBoundingBox& GetBounds() const {
+        return nodes_[0].bounds_;
+    }
+
+    /// Returns the points of node \p node_id with all point attributes.
+    t::geometry::PointCloud GetNodePointCloud(int node_id) const;
+
+    /// \brief Selects the nodes to draw for a camera.
+    ///
+    /// Nodes are refined in order of decreasing screen-space error, the
+    /// projected spacing in pixels, until every visible node has an error
+    /// below \p max_screen_space_error or the selection reaches
+    /// \p point_budget points. Nodes outside the view frustum are skipped. The
+    /// root is always selected if visible.
+    ///
+    /// \param model_view Transform from the cloud to camera coordinates.
+    /// \param projection Camera projection matrix, OpenGL convention.
+    /// \param viewport_height Height of the viewport in pixels.
+    std::vector<int> SelectNodes(const Eigen::Matrix4d& model_view,
+                                 const Eigen::Matrix4d& projection,
+                                 int viewport_height,
+                                 double max_screen_space_error,
+                                 int64_t point_budget) const;
+
+private:
+    t::geometry::PointCloud cloud_;
+    std::vector<Node> nodes_;
+    core::Tensor point_order_;
+};
+
+}  // namespace rendering
+}  // namespace visualization
+}  // namespace open3d
@@ -26,6 +26,10 @@
 
 #pragma once
 
+#include <Eigen/Core>
+#include <vector>
+
+#include "open3d/utility/Eigen.h"
 #include "open3d/visualization/rendering/MaterialModifier.h"
 #include "open3d/visualization/rendering/RendererHandle.h"
 
@@ -127,6 +131,27 @@ public:
 
     virtual std::shared_ptr<RenderToBuffer> CreateBufferRenderer() = 0;
 
+    /// \brief Renders \p scene through \p view once per camera pose.
+    ///
+    /// The frames are rendered back to back into one offscreen target and
+    /// read back asynchronously straight into the output tensors, so the CPU
+    /// waits for the GPU only once per batch instead of once per image.
+    ///
+    /// \param poses Camera model matrices (camera to world), as in
+    /// Camera::SetModelMatrix(). The projection is taken from \p view.
+    /// \param color Output {N, H, W, 3} UInt8 images, with W and H from the
+    /// viewport of \p view.
+    /// \param depth If not nullptr, output {N, H, W} Float32 depth images, in
+    /// the same convention as RenderToDepthImage().
+    virtual void RenderBatchToTensors(
+            View* view,
+            Scene* scene,
+            const std::vector<Eigen::Matrix4d, utility::Matrix4d_allocator>&
+                    poses,
+            core::Tensor& color,
+            core::Tensor* depth = nullptr,
+            bool z_in_view_space = false) = 0;
+
     void RenderToImage(
             View* view,
             Scene* scene,
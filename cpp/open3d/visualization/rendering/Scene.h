@@ -95,17 +95,34 @@ public:
                              const MaterialRecord& material,
                              const std::string& downsampled_name = "",
                              size_t downsample_threshold = SIZE_MAX) = 0;
+    /// \p vertex_capacity reserves GPU buffers for that many points of a
+    /// point cloud, so that AppendGeometry() can add points without
+    /// reallocating them. Other geometry types ignore it.
     virtual bool AddGeometry(const std::string& object_name,
                              const t::geometry::Geometry& geometry,
                              const MaterialRecord& material,
                              const std::string& downsampled_name = "",
-                             size_t downsample_threshold = SIZE_MAX) = 0;
+                             size_t downsample_threshold = SIZE_MAX,
+                             size_t vertex_capacity = 0) = 0;
     virtual bool AddGeometry(const std::string& object_name,
                              const TriangleMeshModel& model) = 0;
     virtual bool HasGeometry(const std::string& object_name) const = 0;
     virtual void UpdateGeometry(const std::string& object_name,
                                 const t::geometry::PointCloud& point_cloud,
                                 uint32_t update_flags) = 0;
+    /// Overwrites the points [first_point, first_point + N) of a point cloud
+    /// with the N points of \p point_cloud, uploading only the attributes in
+    /// \p update_flags. The range must lie within the current point count.
+    virtual void UpdateGeometryRange(const std::string& object_name,
+                                     const t::geometry::PointCloud& point_cloud,
+                                     size_t first_point,
+                                     uint32_t update_flags) = 0;
+    /// Appends the points of \p point_cloud to a point cloud and uploads only
+    /// the new points. Returns false without changing the geometry if the
+    /// points exceed the vertex capacity reserved by AddGeometry(); remove and
+    /// add the geometry again with a larger capacity in that case.
+    virtual bool AppendGeometry(const std::string& object_name,
+                                const t::geometry::PointCloud& point_cloud) = 0;
     virtual void RemoveGeometry(const std::string& object_name) = 0;
     virtual void ShowGeometry(const std::string& object_name, bool show) = 0;
     virtual bool GeometryIsVisible(const std::string& object_name) = 0;
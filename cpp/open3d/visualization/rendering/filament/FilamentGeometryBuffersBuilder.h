@@ -61,6 +61,10 @@
 #include <memory>
 #include <tuple>
 
+namespace filament {
+class VertexBuffer;
+}  // namespace filament
+
 namespace open3d {
 
 namespace geometry {
@@ -109,6 +113,13 @@ public:
         adjust_colors_for_srgb_tonemapping_ = adjust;
     }
 
+    // Reserves room for at least this many vertices in the vertex and index
+    // buffers so that vertices can be appended later without reallocating.
+    // Only supported by tensor point clouds, other builders ignore it.
+    virtual void SetVertexCapacity(size_t n_vertices) {
+        vertex_capacity_ = n_vertices;
+    }
+
     virtual Buffers ConstructBuffers() = 0;
     virtual filament::Box ComputeAABB() = 0;
 
@@ -116,6 +127,7 @@ protected:
     size_t downsample_threshold_ = SIZE_MAX;
     bool wide_lines_ = false;
     bool adjust_colors_for_srgb_tonemapping_ = true;
+    size_t vertex_capacity_ = 0;
 
     static void DeallocateBuffer(void* buffer, size_t size, void* user_ptr);
 
@@ -191,6 +203,17 @@ public:
     Buffers ConstructBuffers() override;
     filament::Box ComputeAABB() override;
 
+    // Uploads the attributes selected by update_flags (Scene::kUpdate*Flag)
+    // to the vertices of vbuf starting at first_vertex. The data is copied,
+    // converting from other devices and dtypes if needed. If fill_missing is
+    // true, attributes that the point cloud lacks are set to defaults, else
+    // they are left unchanged.
+    static void UploadAttributes(filament::VertexBuffer& vbuf,
+                                 const t::geometry::PointCloud& geometry,
+                                 size_t first_vertex,
+                                 uint32_t update_flags,
+                                 bool fill_missing);
+
 private:
     t::geometry::PointCloud geometry_;
 };
@@ -28,6 +28,8 @@
 
 #include <utils/Entity.h>
 
+#include <limits>
+
 // 4068: Filament has some clang-specific vectorizing pragma's that MSVC flags
 // 4146: Filament's utils/algorithm.h utils::details::ctz() tries to negate
 //       an unsigned int.
@@ -168,9 +170,12 @@ void FilamentRenderer::BeginFrame() {
 void FilamentRenderer::Draw() {
     if (frame_started_) {
         // Draw 3D scenes into textures
+        bool scene_rendered = false;
         for (const auto& pair : scenes_) {
-            pair.second->Draw(*renderer_);
+            scene_rendered |= pair.second->Draw(*renderer_);
         }
+        frame_damaged_ = scene_rendered || ui_damaged_;
+        ui_damaged_ = false;
 
         // Draw the UI. This should come after the 3D scene(s), as SceneWidget
         // will draw the textures as an image, and this way we will have the
@@ -348,6 +353,110 @@ std::shared_ptr<RenderToBuffer> FilamentRenderer::CreateBufferRenderer() {
     return renderer;
 }
 
+void FilamentRenderer::RenderBatchToTensors(
+        View* view,
+        Scene* scene,
+        const std::vector<Eigen::Matrix4d, utility::Matrix4d_allocator>&
+                poses,
+        core::Tensor& color,
+        core::Tensor* depth /*= nullptr*/,
+        bool z_in_view_space /*= false*/) {
+    const auto vp = view->GetViewport();
+    const int64_t n_images = int64_t(poses.size());
+    const int64_t width = vp[2];
+    const int64_t height = vp[3];
+    color = core::Tensor({n_images, height, width, 3}, core::UInt8);
+    if (depth) {
+        *depth = core::Tensor({n_images, height, width}, core::Float32);
+    }
+    if (n_images == 0 || width <= 0 || height <= 0) {
+        return;
+    }
+
+    // One renderer and readable swap chain for the whole batch. The depth
+    // pass needs its own view because post-processing discards the depth
+    // buffer, see FilamentRenderToBuffer::CopySettings().
+    auto* filament_scene = static_cast<FilamentScene*>(scene);
+    filament::Renderer* renderer = engine_.createRenderer();
+    filament::SwapChain* swap_chain = engine_.createSwapChain(
+            uint32_t(width), uint32_t(height),
+            filament::SwapChain::CONFIG_READABLE);
+    FilamentView color_view(engine_, resource_mgr_);
+    color_view.CopySettingsFrom(*static_cast<const FilamentView*>(view));
+    color_view.SetScene(*filament_scene);
+    std::unique_ptr<FilamentView> depth_view;
+    if (depth) {
+        depth_view.reset(new FilamentView(engine_, resource_mgr_));
+        depth_view->CopySettingsFrom(*static_cast<const FilamentView*>(view));
+        depth_view->ConfigureForColorPicking();
+        depth_view->SetScene(*filament_scene);
+    }
+
+    using namespace filament;
+    using namespace backend;
+
+    // Submits one frame and its readback. The pixels land in the output
+    // tensor when the GPU gets to them; nothing waits here.
+    auto render_frame = [&](FilamentView& frame_view, void* pixels,
+                            size_t n_bytes, PixelDataFormat format,
+                            PixelDataType type) {
+        if (!renderer->beginFrame(swap_chain)) {
+            // Filament skips frames when the GPU falls behind. Drain the
+            // queue instead of dropping an image of the batch.
+            engine_.flushAndWait();
+            if (!renderer->beginFrame(swap_chain)) {
+                utility::LogWarning("Batch render: frame was skipped.");
+                return;
+            }
+        }
+        renderer->render(frame_view.GetNativeView());
+        PixelBufferDescriptor pd(pixels, n_bytes, format, type);
+        renderer->readPixels(0, 0, uint32_t(width), uint32_t(height),
+                             std::move(pd));
+        renderer->endFrame();
+    };
+
+    filament_scene->HideRefractedMaterials();
+    const size_t color_bytes = size_t(width * height * 3);
+    const size_t depth_bytes = size_t(width * height) * sizeof(float);
+    for (int64_t i = 0; i < n_images; ++i) {
+        const Camera::Transform model(poses[i].cast<float>());
+        color_view.GetCamera()->SetModelMatrix(model);
+        render_frame(color_view,
+                     static_cast<uint8_t*>(color.GetDataPtr()) +
+                             i * color_bytes,
+                     color_bytes, PixelDataFormat::RGB, PixelDataType::UBYTE);
+        if (depth) {
+            depth_view->GetCamera()->SetModelMatrix(model);
+            render_frame(*depth_view,
+                         static_cast<uint8_t*>(depth->GetDataPtr()) +
+                                 i * depth_bytes,
+                         depth_bytes, PixelDataFormat::DEPTH_COMPONENT,
+                         PixelDataType::FLOAT);
+        }
+    }
+    engine_.flushAndWait();
+    filament_scene->HideRefractedMaterials(false);
+
+    engine_.destroy(swap_chain);
+    engine_.destroy(renderer);
+
+    if (depth) {
+        // Filament's depth is reversed, see Renderer::RenderToDepthImage().
+        if (z_in_view_space) {
+            const float z_near = float(view->GetCamera()->GetNear());
+            core::Tensor background = depth->Eq(0.f);
+            core::Tensor z = z_near / depth->Clip(1e-30f, 1.f);
+            z.SetItem(core::TensorKey::IndexTensor(background),
+                      core::Tensor::Init<float>(
+                              std::numeric_limits<float>::infinity()));
+            *depth = z;
+        } else {
+            *depth = 1.f - *depth;
+        }
+    }
+}
+
 void FilamentRenderer::ConvertToGuiScene(const SceneHandle& id) {
     auto found = scenes_.find(id);
     // TODO: assert(found != scenes_.end())
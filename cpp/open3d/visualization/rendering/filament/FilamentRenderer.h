@@ -82,6 +82,13 @@ public:
 
     void SetOnAfterDraw(std::function<void()> callback) override;
 
+    /// Marks the next frame as changed even if no 3D scene is redrawn, e.g.
+    /// because the UI changed.
+    void DamageFrame() { ui_damaged_ = true; }
+    /// Returns true if the last drawn frame differs from the one before it.
+    /// Valid from within the on-after-draw callback.
+    bool IsFrameDamaged() const { return frame_damaged_; }
+
     MaterialHandle AddMaterial(const ResourceLoadRequest& request) override;
     MaterialInstanceHandle AddMaterialInstance(
             const MaterialHandle& material) override;
@@ -113,6 +120,15 @@ public:
     std::shared_ptr<visualization::rendering::RenderToBuffer>
     CreateBufferRenderer() override;
 
+    void RenderBatchToTensors(
+            View* view,
+            Scene* scene,
+            const std::vector<Eigen::Matrix4d, utility::Matrix4d_allocator>&
+                    poses,
+            core::Tensor& color,
+            core::Tensor* depth = nullptr,
+            bool z_in_view_space = false) override;
+
     // Removes scene from scenes list and draws it last
     // WARNING: will destroy previous gui scene if there was any
     void ConvertToGuiScene(const SceneHandle& id);
@@ -141,6 +157,8 @@ private:
     bool frame_started_ = false;
     std::function<void()> on_after_draw_;
     bool needs_wait_after_draw_ = false;
+    bool ui_damaged_ = false;
+    bool frame_damaged_ = true;
 };
 
 }  // namespace rendering
@@ -32,6 +32,7 @@
 //       32 so that x >> 32 gives a warning. (Or maybe the compiler can't
 //       determine the if statement does not run.)
 // 4305: LightManager.h needs to specify some constants as floats
+#include <algorithm>
 #include <unordered_set>
 
 #ifdef _MSC_VER
@@ -53,7 +54,6 @@
 #include <filament/TransformManager.h>
 #include <filament/VertexBuffer.h>
 #include <filament/View.h>
-#include <geometry/SurfaceOrientation.h>
 #include <utils/EntityManager.h>
 
 #ifdef _MSC_VER
@@ -89,10 +89,6 @@
 namespace {  // avoid polluting global namespace, since only used here
 /// @cond
 
-static void DeallocateBuffer(void* buffer, size_t size, void* user_ptr) {
-    free(buffer);
-}
-
 const std::string kBackgroundName = "__background";
 const std::string kGroundPlaneName = "__ground_plane";
 const Eigen::Vector4f kDefaultGroundPlaneColor(0.5f, 0.5f, 0.5f, 1.f);
@@ -387,7 +383,8 @@ bool FilamentScene::AddGeometry(const std::string& object_name,
                                 const t::geometry::Geometry& geometry,
                                 const MaterialRecord& material,
                                 const std::string& downsampled_name /*= ""*/,
-                                size_t downsample_threshold /*= SIZE_MAX*/) {
+                                size_t downsample_threshold /*= SIZE_MAX*/,
+                                size_t vertex_capacity /*= 0*/) {
     // Basic sanity checks
     if (geometry.IsEmpty()) {
         utility::LogWarning("Geometry for object {} is empty", object_name);
@@ -410,6 +407,7 @@ bool FilamentScene::AddGeometry(const std::string& object_name,
     if (material.shader == "unlitLine") {
         buffer_builder->SetWideLines();
     }
+    buffer_builder->SetVertexCapacity(vertex_capacity);
 
     auto buffers = buffer_builder->ConstructBuffers();
     auto vb = std::get<0>(buffers);
@@ -426,6 +424,15 @@ bool FilamentScene::AddGeometry(const std::string& object_name,
     }
     bool success = CreateAndAddFilamentEntity(object_name, *buffer_builder,
                                               aabb, vb, ib, internal_material);
+    if (success &&
+        geometry.GetGeometryType() ==
+                t::geometry::Geometry::GeometryType::PointCloud) {
+        // Only draw the points, not the reserved capacity.
+        const auto& pcloud =
+                static_cast<const t::geometry::PointCloud&>(geometry);
+        SetVertexCount(geometries_[object_name],
+                       pcloud.GetPointPositions().GetLength());
+    }
     if (success && ib_downsampled) {
         if (!CreateAndAddFilamentEntity(downsampled_name, *buffer_builder, aabb,
                                         vb, ib_downsampled, internal_material,
@@ -527,6 +534,8 @@ bool FilamentScene::CreateAndAddFilamentEntity(
                                    vb,
                                    ib}));
 
+        giter.first->second.vertex_count = vbuf->getVertexCount();
+
         SetGeometryTransform(object_name, Transform::Identity());
         UpdateMaterialProperties(giter.first->second);
     } else {
@@ -566,11 +575,9 @@ void FilamentScene::UpdateGeometry(const std::string& object_name,
         const auto& points = point_cloud.GetPointPositions();
         const size_t n_vertices = points.GetLength();
 
-        // NOTE: number of points in the updated point cloud must be the
-        // same as the number of points when the vertex buffer was first
-        // created. If the number of points has changed then it cannot be
-        // updated. In that case, you must remove the geometry then add it
-        // again.
+        // NOTE: number of points in the updated point cloud must not exceed
+        // the capacity of the vertex buffer when it was first created. If it
+        // does, you must remove the geometry then add it again.
         if (n_vertices > vbuf->getVertexCount()) {
             utility::LogWarning(
                     "Geometry for point cloud {} cannot be updated because the "
@@ -580,112 +587,109 @@ void FilamentScene::UpdateGeometry(const std::string& object_name,
             return;
         }
 
-        bool geometry_update_needed = n_vertices != vbuf->getVertexCount();
-        bool pcloud_is_gpu =
-                points.GetDevice().GetType() == core::Device::DeviceType::CUDA;
-        t::geometry::PointCloud cpu_pcloud;
-        if (pcloud_is_gpu) {
-            cpu_pcloud = point_cloud.To(core::Device("CPU:0"));
-        }
-
-        // Update the each of the attribute requested
-        if (update_flags & kUpdatePointsFlag) {
-            const size_t vertex_array_size = n_vertices * 3 * sizeof(float);
-            if (pcloud_is_gpu) {
-                auto vertex_data =
-                        static_cast<float*>(malloc(vertex_array_size));
-                memcpy(vertex_data, cpu_pcloud.GetPointPositions().GetDataPtr(),
-                       vertex_array_size);
-                filament::VertexBuffer::BufferDescriptor pts_descriptor(
-                        vertex_data, vertex_array_size, DeallocateBuffer);
-                vbuf->setBufferAt(engine_, 0, std::move(pts_descriptor));
-            } else {
-                filament::VertexBuffer::BufferDescriptor pts_descriptor(
-                        points.GetDataPtr(), vertex_array_size);
-                vbuf->setBufferAt(engine_, 0, std::move(pts_descriptor));
-            }
-        }
+        TPointCloudBuffersBuilder::UploadAttributes(*vbuf, point_cloud, 0,
+                                                    update_flags, false);
 
-        if (update_flags & kUpdateColorsFlag && point_cloud.HasPointColors()) {
-            const size_t color_array_size = n_vertices * 3 * sizeof(float);
-            if (pcloud_is_gpu) {
-                auto color_data = static_cast<float*>(malloc(color_array_size));
-                memcpy(color_data, cpu_pcloud.GetPointPositions().GetDataPtr(),
-                       color_array_size);
-                filament::VertexBuffer::BufferDescriptor color_descriptor(
-                        color_data, color_array_size, DeallocateBuffer);
-                vbuf->setBufferAt(engine_, 1, std::move(color_descriptor));
-            } else {
-                filament::VertexBuffer::BufferDescriptor color_descriptor(
-                        point_cloud.GetPointColors().GetDataPtr(),
-                        color_array_size);
-                vbuf->setBufferAt(engine_, 1, std::move(color_descriptor));
-            }
+        // Update the geometry to reflect new geometry count
+        if (n_vertices != g->vertex_count) {
+            SetVertexCount(*g, n_vertices);
         }
+    }
+}
 
-        if (update_flags & kUpdateNormalsFlag &&
-            point_cloud.HasPointNormals()) {
-            const size_t normal_array_size = n_vertices * 4 * sizeof(float);
-            const void* normal_data = nullptr;
-            if (pcloud_is_gpu) {
-                const auto& normals = point_cloud.GetPointNormals();
-                normal_data = normals.GetDataPtr();
-            } else {
-                normal_data = cpu_pcloud.GetPointNormals().GetDataPtr();
-            }
+void FilamentScene::UpdateGeometryRange(
+        const std::string& object_name,
+        const t::geometry::PointCloud& point_cloud,
+        size_t first_point,
+        uint32_t update_flags) {
+    auto geoms = GetGeometry(object_name, false);
+    if (geoms.empty()) {
+        return;
+    }
+    auto* g = geoms[0];
+    const size_t n_vertices = point_cloud.GetPointPositions().GetLength();
+    if (g->primitive_type !=
+                filament::RenderableManager::PrimitiveType::POINTS ||
+        first_point + n_vertices > g->vertex_count) {
+        utility::LogWarning(
+                "Points [{}, {}) of geometry {} cannot be updated because the "
+                "geometry is not a point cloud with at least {} points.",
+                first_point, first_point + n_vertices, object_name,
+                first_point + n_vertices);
+        return;
+    }
+    auto vbuf = resource_mgr_.GetVertexBuffer(g->vb).lock();
+    TPointCloudBuffersBuilder::UploadAttributes(*vbuf, point_cloud, first_point,
+                                                update_flags, false);
+    if (update_flags & kUpdatePointsFlag) {
+        ExpandBoundingBox(*g, point_cloud);
+    }
+}
 
-            // Converting normals to Filament type - quaternions
-            auto float4v_tangents = static_cast<filament::math::quatf*>(
-                    malloc(normal_array_size));
-            auto orientation = filament::geometry::SurfaceOrientation::Builder()
-                                       .vertexCount(n_vertices)
-                                       .normals(reinterpret_cast<
-                                                const filament::math::float3*>(
-                                               normal_data))
-                                       .build();
-            orientation->getQuats(float4v_tangents, n_vertices);
-            filament::VertexBuffer::BufferDescriptor normals_descriptor(
-                    float4v_tangents, normal_array_size, DeallocateBuffer);
-            vbuf->setBufferAt(engine_, 2, std::move(normals_descriptor));
-            delete orientation;
-        }
+bool FilamentScene::AppendGeometry(const std::string& object_name,
+                                   const t::geometry::PointCloud& point_cloud) {
+    auto geoms = GetGeometry(object_name, false);
+    if (geoms.empty() || geoms[0]->primitive_type !=
+                                 filament::RenderableManager::PrimitiveType::
+                                         POINTS) {
+        return false;
+    }
+    auto* g = geoms[0];
+    auto vbuf = resource_mgr_.GetVertexBuffer(g->vb).lock();
+    const size_t n_vertices = point_cloud.GetPointPositions().GetLength();
+    if (g->vertex_count + n_vertices > vbuf->getVertexCount()) {
+        return false;
+    }
+    if (n_vertices == 0) {
+        return true;
+    }
 
-        if (update_flags & kUpdateUv0Flag) {
-            const size_t uv_array_size = n_vertices * 2 * sizeof(float);
-            if (point_cloud.HasPointAttr("uv")) {
-                filament::VertexBuffer::BufferDescriptor uv_descriptor(
-                        point_cloud.GetPointAttr("uv").GetDataPtr(),
-                        uv_array_size);
-                vbuf->setBufferAt(engine_, 3, std::move(uv_descriptor));
-            } else if (point_cloud.HasPointAttr("__visualization_scalar")) {
-                // Update in PointCloudBuffers.cpp, too:
-                //     TPointCloudBuffersBuilder::ConstructBuffers
-                float* uv_array = static_cast<float*>(malloc(uv_array_size));
-                memset(uv_array, 0, uv_array_size);
-                auto vis_scalars =
-                        point_cloud.GetPointAttr("__visualization_scalar")
-                                .Contiguous();
-                const float* src =
-                        static_cast<const float*>(vis_scalars.GetDataPtr());
-                const size_t n = 2 * n_vertices;
-                for (size_t i = 0; i < n; i += 2) {
-                    uv_array[i] = *src++;
-                }
-                filament::VertexBuffer::BufferDescriptor uv_descriptor(
-                        uv_array, uv_array_size, DeallocateBuffer);
-                vbuf->setBufferAt(engine_, 3, std::move(uv_descriptor));
-            }
-        }
+    // Attributes the new points lack get the same defaults as in
+    // AddGeometry() so that the appended points are drawn consistently.
+    TPointCloudBuffersBuilder::UploadAttributes(
+            *vbuf, point_cloud, g->vertex_count,
+            kUpdatePointsFlag | kUpdateColorsFlag | kUpdateNormalsFlag |
+                    kUpdateUv0Flag,
+            true);
+    SetVertexCount(*g, g->vertex_count + n_vertices);
+    ExpandBoundingBox(*g, point_cloud);
+    return true;
+}
 
-        // Update the geometry to reflect new geometry count
-        if (geometry_update_needed) {
-            auto& renderable_mgr = engine_.getRenderableManager();
-            auto inst = renderable_mgr.getInstance(g->filament_entity);
-            renderable_mgr.setGeometryAt(
-                    inst, 0, filament::RenderableManager::PrimitiveType::POINTS,
-                    0, n_vertices);
-        }
-    }
+void FilamentScene::SetVertexCount(RenderableGeometry& geom,
+                                   size_t n_vertices) {
+    auto& renderable_mgr = engine_.getRenderableManager();
+    auto inst = renderable_mgr.getInstance(geom.filament_entity);
+    renderable_mgr.setGeometryAt(
+            inst, 0, filament::RenderableManager::PrimitiveType::POINTS, 0,
+            n_vertices);
+    geom.vertex_count = n_vertices;
+}
+
+void FilamentScene::ExpandBoundingBox(
+        RenderableGeometry& geom, const t::geometry::PointCloud& point_cloud) {
+    if (point_cloud.IsEmpty()) {
+        return;
+    }
+    auto& renderable_mgr = engine_.getRenderableManager();
+    auto inst = renderable_mgr.getInstance(geom.filament_entity);
+    auto box = renderable_mgr.getAxisAlignedBoundingBox(inst);
+    const core::Device cpu("CPU:0");
+    const core::Tensor min_bound =
+            point_cloud.GetMinBound().To(core::Float32).To(cpu);
+    const core::Tensor max_bound =
+            point_cloud.GetMaxBound().To(core::Float32).To(cpu);
+    const float* min_ptr = min_bound.GetDataPtr<float>();
+    const float* max_ptr = max_bound.GetDataPtr<float>();
+    filament::math::float3 min = box.center - box.halfExtent;
+    filament::math::float3 max = box.center + box.halfExtent;
+    for (int i = 0; i < 3; ++i) {
+        min[i] = std::min(min[i], min_ptr[i]);
+        max[i] = std::max(max[i], max_ptr[i]);
+    }
+    filament::Box aabb;
+    aabb.set(min, max);
+    renderable_mgr.setAxisAlignedBoundingBox(inst, aabb);
 }
 
 void FilamentScene::RemoveGeometry(const std::string& object_name) {
@@ -1913,7 +1917,8 @@ void FilamentScene::RenderableGeometry::ReleaseResources(
     filament_entity.clear();
 }
 
-void FilamentScene::Draw(filament::Renderer& renderer) {
+bool FilamentScene::Draw(filament::Renderer& renderer) {
+    bool rendered = false;
     for (auto& pair : views_) {
         auto& container = pair.second;
         // Skip inactive views
@@ -1926,7 +1931,9 @@ void FilamentScene::Draw(filament::Renderer& renderer) {
         container.view->PreRender();
         renderer.render(container.view->GetNativeView());
         container.view->PostRender();
+        rendered = true;
     }
+    return rendered;
 }
 
 void FilamentScene::HideRefractedMaterials(bool hide) {
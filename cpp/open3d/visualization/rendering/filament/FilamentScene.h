@@ -120,13 +120,20 @@ public:
                      const t::geometry::Geometry& geometry,
                      const MaterialRecord& material,
                      const std::string& downsampled_name = "",
-                     size_t downsample_threshold = SIZE_MAX) override;
+                     size_t downsample_threshold = SIZE_MAX,
+                     size_t vertex_capacity = 0) override;
     bool AddGeometry(const std::string& object_name,
                      const TriangleMeshModel& model) override;
     bool HasGeometry(const std::string& object_name) const override;
     void UpdateGeometry(const std::string& object_name,
                         const t::geometry::PointCloud& point_cloud,
                         uint32_t update_flags) override;
+    void UpdateGeometryRange(const std::string& object_name,
+                             const t::geometry::PointCloud& point_cloud,
+                             size_t first_point,
+                             uint32_t update_flags) override;
+    bool AppendGeometry(const std::string& object_name,
+                        const t::geometry::PointCloud& point_cloud) override;
     void RemoveGeometry(const std::string& object_name) override;
     void ShowGeometry(const std::string& object_name, bool show) override;
     bool GeometryIsVisible(const std::string& object_name) override;
@@ -227,7 +234,8 @@ public:
             std::function<void(std::shared_ptr<geometry::Image>)> callback)
             override;
 
-    void Draw(filament::Renderer& renderer);
+    /// Renders the active views. Returns true if any view was rendered.
+    bool Draw(filament::Renderer& renderer);
 
     // NOTE: This method is to work around Filament limitation when rendering to
     // depth buffer. Materials with SSR require multiple passes which causes a
@@ -297,6 +305,8 @@ private:
         filament::RenderableManager::PrimitiveType primitive_type;
         VertexBufferHandle vb;
         IndexBufferHandle ib;
+        // Number of vertices drawn, at most the vertex buffer's capacity.
+        size_t vertex_count = 0;
         void ReleaseResources(filament::Engine& engine,
                               FilamentResourceManager& manager);
     };
@@ -323,6 +333,9 @@ private:
                                   const MaterialRecord& material,
                                   bool shader_only = false);
     void UpdateMaterialProperties(RenderableGeometry& geom);
+    void SetVertexCount(RenderableGeometry& geom, size_t n_vertices);
+    void ExpandBoundingBox(RenderableGeometry& geom,
+                           const t::geometry::PointCloud& point_cloud);
     void UpdateDefaultLit(GeometryMaterialInstance& geom_mi);
     void UpdateDefaultLitSSR(GeometryMaterialInstance& geom_mi);
     void UpdateDefaultUnlit(GeometryMaterialInstance& geom_mi);
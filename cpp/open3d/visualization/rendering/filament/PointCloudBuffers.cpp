@@ -44,9 +44,14 @@
 #pragma warning(pop)
 #endif  // _MSC_VER
 
+#include <algorithm>
+#include <cstring>
+
+#include "open3d/core/MemoryManager.h"
 #include "open3d/geometry/BoundingVolume.h"
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/t/geometry/PointCloud.h"
+#include "open3d/visualization/rendering/Scene.h"
 #include "open3d/visualization/rendering/filament/FilamentEngine.h"
 #include "open3d/visualization/rendering/filament/FilamentGeometryBuffersBuilder.h"
 #include "open3d/visualization/rendering/filament/FilamentResourceManager.h"
@@ -308,14 +313,10 @@ filament::Box PointCloudBuffersBuilder::ComputeAABB() {
 TPointCloudBuffersBuilder::TPointCloudBuffersBuilder(
         const t::geometry::PointCloud& geometry)
     : geometry_(geometry) {
-    // Make sure geometry is on CPU
+    // GPU resident point clouds stay on the device. The dtype conversions
+    // below run there and UploadAttributes() copies each attribute straight
+    // into Filament's staging buffers.
     auto pts = geometry.GetPointPositions();
-    if (pts.GetDevice().GetType() == core::Device::DeviceType::CUDA) {
-        utility::LogWarning(
-                "GPU resident point clouds are not currently supported for "
-                "visualization. Copying data to CPU.");
-        geometry_ = geometry.To(core::Device("CPU:0"));
-    }
 
     // Now make sure data types are Float32
     if (pts.GetDtype() != core::Float32) {
@@ -359,6 +360,7 @@ GeometryBuffersBuilder::Buffers TPointCloudBuffersBuilder::ConstructBuffers() {
 
     const auto& points = geometry_.GetPointPositions();
     const size_t n_vertices = points.GetLength();
+    const size_t capacity = std::max(n_vertices, vertex_capacity_);
 
     // We use CUSTOM0 for tangents along with TANGENTS attribute
     // because Filament would optimize out anything about normals and lightning
@@ -366,7 +368,7 @@ GeometryBuffersBuilder::Buffers TPointCloudBuffersBuilder::ConstructBuffers() {
     // we need to use this workaround.
     VertexBuffer* vbuf = VertexBuffer::Builder()
                                  .bufferCount(4)
-                                 .vertexCount(uint32_t(n_vertices))
+                                 .vertexCount(uint32_t(capacity))
                                  .attribute(VertexAttribute::POSITION, 0,
                                             VertexBuffer::AttributeType::FLOAT3)
                                  .normalized(VertexAttribute::COLOR)
@@ -388,105 +390,136 @@ GeometryBuffersBuilder::Buffers TPointCloudBuffersBuilder::ConstructBuffers() {
         return {};
     }
 
-    const size_t vertex_array_size = n_vertices * 3 * sizeof(float);
-    float* vertex_array = static_cast<float*>(malloc(vertex_array_size));
-    memcpy(vertex_array, points.GetDataPtr(), vertex_array_size);
-    VertexBuffer::BufferDescriptor pts_descriptor(
-            vertex_array, vertex_array_size,
-            GeometryBuffersBuilder::DeallocateBuffer);
-    vbuf->setBufferAt(engine, 0, std::move(pts_descriptor));
-
-    const size_t color_array_size = n_vertices * 3 * sizeof(float);
-    if (geometry_.HasPointColors()) {
-        float* color_array = static_cast<float*>(malloc(color_array_size));
-        memcpy(color_array, geometry_.GetPointColors().GetDataPtr(),
-               color_array_size);
-        VertexBuffer::BufferDescriptor color_descriptor(
-                color_array, color_array_size,
-                GeometryBuffersBuilder::DeallocateBuffer);
-        vbuf->setBufferAt(engine, 1, std::move(color_descriptor));
-    } else {
-        float* color_array = static_cast<float*>(malloc(color_array_size));
-        for (size_t i = 0; i < n_vertices * 3; ++i) {
-            color_array[i] = 1.f;
-        }
-        VertexBuffer::BufferDescriptor color_descriptor(
-                color_array, color_array_size,
-                GeometryBuffersBuilder::DeallocateBuffer);
-        vbuf->setBufferAt(engine, 1, std::move(color_descriptor));
+    UploadAttributes(*vbuf, geometry_, 0,
+                     Scene::kUpdatePointsFlag | Scene::kUpdateColorsFlag |
+                             Scene::kUpdateNormalsFlag | Scene::kUpdateUv0Flag,
+                     true);
+
+    // The index buffer covers the whole capacity, the renderable draws only
+    // the first n_vertices of it.
+    auto ib_handle = CreateIndexBuffer(capacity);
+
+    IndexBufferHandle downsampled_handle;
+    if (n_vertices >= downsample_threshold_) {
+        downsampled_handle =
+                CreateIndexBuffer(n_vertices, downsample_threshold_);
     }
 
-    const size_t normal_array_size = n_vertices * 4 * sizeof(float);
-    if (geometry_.HasPointNormals()) {
-        const auto& normals = geometry_.GetPointNormals();
+    return std::make_tuple(vb_handle, ib_handle, downsampled_handle);
+}
 
-        // Converting normals to Filament type - quaternions
-        auto float4v_tangents =
-                static_cast<math::quatf*>(malloc(normal_array_size));
-        auto orientation =
-                filament::geometry::SurfaceOrientation::Builder()
-                        .vertexCount(n_vertices)
-                        .normals(reinterpret_cast<const math::float3*>(
-                                normals.GetDataPtr()))
-                        .build();
-        orientation->getQuats(float4v_tangents, n_vertices);
-        VertexBuffer::BufferDescriptor normals_descriptor(
-                float4v_tangents, normal_array_size,
+void TPointCloudBuffersBuilder::UploadAttributes(
+        VertexBuffer& vbuf,
+        const t::geometry::PointCloud& geometry,
+        size_t first_vertex,
+        uint32_t update_flags,
+        bool fill_missing) {
+    auto& engine = EngineInstance::GetInstance();
+    const size_t n_vertices = geometry.GetPointPositions().GetLength();
+    if (n_vertices == 0) {
+        return;
+    }
+
+    // Every upload gets its own staging copy that Filament frees once the
+    // renderer has consumed it, so the caller may modify or release the
+    // tensors as soon as this returns, even while a frame is in flight.
+    auto upload = [&](int buffer_index, float* data, size_t n_components) {
+        const size_t stride = n_components * sizeof(float);
+        VertexBuffer::BufferDescriptor descriptor(
+                data, n_vertices * stride,
                 GeometryBuffersBuilder::DeallocateBuffer);
-        vbuf->setBufferAt(engine, 2, std::move(normals_descriptor));
-        delete orientation;
-    } else {
-        float* normal_array = static_cast<float*>(malloc(normal_array_size));
-        float* normal_ptr = normal_array;
-        for (size_t i = 0; i < n_vertices; ++i) {
-            *normal_ptr++ = 0.f;
-            *normal_ptr++ = 0.f;
-            *normal_ptr++ = 0.f;
-            *normal_ptr++ = 1.f;
+        vbuf.setBufferAt(engine, uint8_t(buffer_index), std::move(descriptor),
+                         uint32_t(first_vertex * stride));
+    };
+    auto alloc = [n_vertices](size_t n_components) {
+        return static_cast<float*>(
+                malloc(n_vertices * n_components * sizeof(float)));
+    };
+    // Copies a {N, n_components} attribute to a staging buffer. Conversion
+    // to Float32 runs on the attribute's device, so CUDA tensors cross the
+    // bus once, directly into the staging buffer.
+    auto stage = [&](core::Tensor attr, size_t n_components) {
+        if (attr.GetDtype() == core::UInt8) {
+            attr = attr.To(core::Float32) / 255.0f;
+        } else if (attr.GetDtype() != core::Float32) {
+            attr = attr.To(core::Float32);
         }
-        VertexBuffer::BufferDescriptor normals_descriptor(
-                normal_array, normal_array_size,
-                GeometryBuffersBuilder::DeallocateBuffer);
-        vbuf->setBufferAt(engine, 2, std::move(normals_descriptor));
+        attr = attr.Contiguous();
+        float* data = alloc(n_components);
+        core::MemoryManager::MemcpyToHost(
+                data, attr.GetDataPtr(), attr.GetDevice(),
+                n_vertices * n_components * sizeof(float));
+        return data;
+    };
+
+    if (update_flags & Scene::kUpdatePointsFlag) {
+        upload(0, stage(geometry.GetPointPositions(), 3), 3);
     }
 
-    const size_t uv_array_size = n_vertices * 2 * sizeof(float);
-    float* uv_array = static_cast<float*>(malloc(uv_array_size));
-    if (geometry_.HasPointAttr("uv")) {
-        const float* uv_src = static_cast<const float*>(
-                geometry_.GetPointAttr("uv").GetDataPtr());
-        memcpy(uv_array, uv_src, uv_array_size);
-    } else if (geometry_.HasPointAttr("__visualization_scalar")) {
-        // Update in FilamentScene::UpdateGeometry(), too.
-        memset(uv_array, 0, uv_array_size);
-        auto vis_scalars =
-                geometry_.GetPointAttr("__visualization_scalar").Contiguous();
-        const float* src = static_cast<const float*>(vis_scalars.GetDataPtr());
-        const size_t n = 2 * n_vertices;
-        for (size_t i = 0; i < n; i += 2) {
-            uv_array[i] = *src++;
+    if (update_flags & Scene::kUpdateColorsFlag) {
+        if (geometry.HasPointColors()) {
+            upload(1, stage(geometry.GetPointColors(), 3), 3);
+        } else if (fill_missing) {
+            float* color_array = alloc(3);
+            std::fill(color_array, color_array + n_vertices * 3, 1.f);
+            upload(1, color_array, 3);
         }
-    } else {
-        memset(uv_array, 0, uv_array_size);
     }
-    VertexBuffer::BufferDescriptor uv_descriptor(
-            uv_array, uv_array_size, GeometryBuffersBuilder::DeallocateBuffer);
-    vbuf->setBufferAt(engine, 3, std::move(uv_descriptor));
-
-    auto ib_handle = CreateIndexBuffer(n_vertices);
 
-    IndexBufferHandle downsampled_handle;
-    if (n_vertices >= downsample_threshold_) {
-        downsampled_handle =
-                CreateIndexBuffer(n_vertices, downsample_threshold_);
+    if (update_flags & Scene::kUpdateNormalsFlag) {
+        if (geometry.HasPointNormals()) {
+            float* normals = stage(geometry.GetPointNormals(), 3);
+            // Converting normals to Filament type - quaternions
+            float* float4v_tangents = alloc(4);
+            auto orientation =
+                    filament::geometry::SurfaceOrientation::Builder()
+                            .vertexCount(n_vertices)
+                            .normals(reinterpret_cast<const math::float3*>(
+                                    normals))
+                            .build();
+            orientation->getQuats(
+                    reinterpret_cast<math::quatf*>(float4v_tangents),
+                    n_vertices);
+            delete orientation;
+            free(normals);
+            upload(2, float4v_tangents, 4);
+        } else if (fill_missing) {
+            float* normal_array = alloc(4);
+            float* normal_ptr = normal_array;
+            for (size_t i = 0; i < n_vertices; ++i) {
+                *normal_ptr++ = 0.f;
+                *normal_ptr++ = 0.f;
+                *normal_ptr++ = 0.f;
+                *normal_ptr++ = 1.f;
+            }
+            upload(2, normal_array, 4);
+        }
     }
 
-    return std::make_tuple(vb_handle, ib_handle, downsampled_handle);
+    if (update_flags & Scene::kUpdateUv0Flag) {
+        if (geometry.HasPointAttr("uv")) {
+            upload(3, stage(geometry.GetPointAttr("uv"), 2), 2);
+        } else if (geometry.HasPointAttr("__visualization_scalar")) {
+            // Pad the scalars to (u, 0) on the device, then copy once.
+            auto vis_scalars = geometry.GetPointAttr("__visualization_scalar")
+                                       .To(core::Float32)
+                                       .Reshape({-1, 1});
+            core::Tensor uv = core::Tensor::Zeros(
+                    {int64_t(n_vertices), 2}, core::Float32,
+                    vis_scalars.GetDevice());
+            uv.Slice(1, 0, 1) = vis_scalars;
+            upload(3, stage(uv, 2), 2);
+        } else if (fill_missing) {
+            float* uv_array = alloc(2);
+            memset(uv_array, 0, n_vertices * 2 * sizeof(float));
+            upload(3, uv_array, 2);
+        }
+    }
 }
 
 filament::Box TPointCloudBuffersBuilder::ComputeAABB() {
-    auto min_bounds = geometry_.GetMinBound();
-    auto max_bounds = geometry_.GetMaxBound();
+    auto min_bounds = geometry_.GetMinBound().To(core::Device("CPU:0"));
+    auto max_bounds = geometry_.GetMaxBound().To(core::Device("CPU:0"));
     auto* min_bounds_float = min_bounds.GetDataPtr<float>();
     auto* max_bounds_float = max_bounds.GetDataPtr<float>();
 
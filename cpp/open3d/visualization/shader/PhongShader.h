@@ -30,6 +30,7 @@
 #include <vector>
 
 #include "open3d/visualization/shader/ShaderWrapper.h"
+#include "open3d/visualization/shader/VertexBuffer.h"
 
 namespace open3d {
 namespace visualization {
@@ -70,11 +71,11 @@ protected:
 
 protected:
     GLuint vertex_position_;
-    GLuint vertex_position_buffer_;
+    VertexBuffer vertex_position_buffer_;
     GLuint vertex_color_;
-    GLuint vertex_color_buffer_;
+    VertexBuffer vertex_color_buffer_;
     GLuint vertex_normal_;
-    GLuint vertex_normal_buffer_;
+    VertexBuffer vertex_normal_buffer_;
     GLuint MVP_;
     GLuint V_;
     GLuint M_;
@@ -92,6 +93,11 @@ protected:
     gl_util::GLVector4f light_specular_power_data_;
     gl_util::GLVector4f light_specular_shininess_data_;
     gl_util::GLVector4f light_ambient_data_;
+
+    // Kept across updates to reuse their memory.
+    std::vector<Eigen::Vector3f> points_;
+    std::vector<Eigen::Vector3f> normals_;
+    std::vector<Eigen::Vector3f> colors_;
 };
 
 class PhongShaderForPointCloud : public PhongShader {
@@ -79,37 +79,26 @@ bool SimpleShader::Compile() {
 
 void SimpleShader::Release() {
     UnbindGeometry();
+    vertex_position_buffer_.Release();
+    vertex_color_buffer_.Release();
     ReleaseProgram();
 }
 
 bool SimpleShader::BindGeometry(const geometry::Geometry &geometry,
                                 const RenderOption &option,
                                 const ViewControl &view) {
-    // If there is already geometry, we first unbind it.
-    // We use GL_STATIC_DRAW. When geometry changes, we clear buffers and
-    // rebind the geometry. Note that this approach is slow. If the geometry is
-    // changing per frame, consider implementing a new ShaderWrapper using
-    // GL_STREAM_DRAW, and replace InvalidateGeometry() with Buffer Object
-    // Streaming mechanisms.
-    UnbindGeometry();
+    // The buffers persist across geometry updates, and only the parts of
+    // the data that changed are uploaded again.
+    bound_ = false;
 
     // Prepare data to be passed to GPU
-    std::vector<Eigen::Vector3f> points;
-    std::vector<Eigen::Vector3f> colors;
-    if (!PrepareBinding(geometry, option, view, points, colors)) {
+    if (!PrepareBinding(geometry, option, view, points_, colors_)) {
         PrintShaderWarning("Binding failed when preparing data.");
         return false;
     }
 
-    // Create buffers and bind the geometry
-    glGenBuffers(1, &vertex_position_buffer_);
-    glBindBuffer(GL_ARRAY_BUFFER, vertex_position_buffer_);
-    glBufferData(GL_ARRAY_BUFFER, points.size() * sizeof(Eigen::Vector3f),
-                 points.data(), GL_STATIC_DRAW);
-    glGenBuffers(1, &vertex_color_buffer_);
-    glBindBuffer(GL_ARRAY_BUFFER, vertex_color_buffer_);
-    glBufferData(GL_ARRAY_BUFFER, colors.size() * sizeof(Eigen::Vector3f),
-                 colors.data(), GL_STATIC_DRAW);
+    vertex_position_buffer_.Upload(points_);
+    vertex_color_buffer_.Upload(colors_);
     bound_ = true;
     return true;
 }
@@ -124,10 +113,10 @@ bool SimpleShader::RenderGeometry(const geometry::Geometry &geometry,
     glUseProgram(program_);
     glUniformMatrix4fv(MVP_, 1, GL_FALSE, view.GetMVPMatrix().data());
     glEnableVertexAttribArray(vertex_position_);
-    glBindBuffer(GL_ARRAY_BUFFER, vertex_position_buffer_);
+    glBindBuffer(GL_ARRAY_BUFFER, vertex_position_buffer_.GetBuffer());
     glVertexAttribPointer(vertex_position_, 3, GL_FLOAT, GL_FALSE, 0, NULL);
     glEnableVertexAttribArray(vertex_color_);
-    glBindBuffer(GL_ARRAY_BUFFER, vertex_color_buffer_);
+    glBindBuffer(GL_ARRAY_BUFFER, vertex_color_buffer_.GetBuffer());
     glVertexAttribPointer(vertex_color_, 3, GL_FLOAT, GL_FALSE, 0, NULL);
     glDrawArrays(draw_arrays_mode_, 0, draw_arrays_size_);
     glDisableVertexAttribArray(vertex_position_);
@@ -136,11 +125,8 @@ bool SimpleShader::RenderGeometry(const geometry::Geometry &geometry,
 }
 
 void SimpleShader::UnbindGeometry() {
-    if (bound_) {
-        glDeleteBuffers(1, &vertex_position_buffer_);
-        glDeleteBuffers(1, &vertex_color_buffer_);
-        bound_ = false;
-    }
+    // The buffers are kept for the next binding and deleted in Release().
+    bound_ = false;
 }
 
 bool SimpleShaderForPointCloud::PrepareRendering(
@@ -300,6 +286,8 @@ bool SimpleShaderForTetraMesh::PrepareBinding(
         return false;
     }
 
+    points.clear();
+    colors.clear();
     std::unordered_set<Index2, utility::hash_tuple<Index2>> inserted_edges;
     auto InsertEdge = [&](Index vidx0, Index vidx1) {
         Index2 edge(std::min(vidx0, vidx1), std::max(vidx0, vidx1));
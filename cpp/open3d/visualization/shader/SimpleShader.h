@@ -30,6 +30,7 @@
 #include <vector>
 
 #include "open3d/visualization/shader/ShaderWrapper.h"
+#include "open3d/visualization/shader/VertexBuffer.h"
 
 namespace open3d {
 namespace visualization {
@@ -66,10 +67,14 @@ protected:
 
 protected:
     GLuint vertex_position_;
-    GLuint vertex_position_buffer_;
+    VertexBuffer vertex_position_buffer_;
     GLuint vertex_color_;
-    GLuint vertex_color_buffer_;
+    VertexBuffer vertex_color_buffer_;
     GLuint MVP_;
+
+    // Kept across updates to reuse their memory.
+    std::vector<Eigen::Vector3f> points_;
+    std::vector<Eigen::Vector3f> colors_;
 };
 
 class SimpleShaderForPointCloud : public SimpleShader {
@@ -0,0 +1,130 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/visualization/shader/VertexBuffer.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace open3d {
+namespace visualization {
+
+namespace glsl {
+
+namespace {
+
+uint64_t HashChunk(const uint8_t *data, size_t size) {
+    uint64_t hash = 0x9e3779b97f4a7c15ULL ^ size;
+    size_t i = 0;
+    for (; i + 8 <= size; i += 8) {
+        uint64_t word;
+        std::memcpy(&word, data + i, 8);
+        hash = (hash ^ word) * 0xff51afd7ed558ccdULL;
+        hash ^= hash >> 32;
+    }
+    for (; i < size; ++i) {
+        hash = (hash ^ data[i]) * 0xc4ceb9fe1a85ec53ULL;
+    }
+    return hash ^ (hash >> 29);
+}
+
+}  // namespace
+
+constexpr size_t VertexBuffer::kChunkSize;
+
+void VertexBuffer::Upload(const void *data, size_t size) {
+    const uint8_t *bytes = static_cast<const uint8_t *>(data);
+    if (buffer_ == 0) {
+        glGenBuffers(1, &buffer_);
+    }
+    glBindBuffer(GL_ARRAY_BUFFER, buffer_);
+
+    const size_t num_chunks = (size + kChunkSize - 1) / kChunkSize;
+    bool reallocated = false;
+    if (size > capacity_) {
+        // Buffers updated once are likely to be updated again: reserve some
+        // room for growth and hint the driver about the usage.
+        size_t capacity = num_allocations_ == 0
+                                  ? size
+                                  : std::max(size, capacity_ + capacity_ / 2);
+        glBufferData(GL_ARRAY_BUFFER, capacity, NULL,
+                     num_allocations_ == 0 ? GL_STATIC_DRAW : GL_DYNAMIC_DRAW);
+        capacity_ = capacity;
+        ++num_allocations_;
+        reallocated = true;
+    }
+
+    // Upload the changed chunks, merging consecutive ones into one call.
+    chunk_hashes_.resize(num_chunks);
+    last_upload_size_ = 0;
+    size_t dirty_begin = 0, dirty_end = 0;
+    auto flush = [&]() {
+        if (dirty_end > dirty_begin) {
+            glBufferSubData(GL_ARRAY_BUFFER, dirty_begin,
+                            dirty_end - dirty_begin, bytes + dirty_begin);
+            last_upload_size_ += dirty_end - dirty_begin;
+        }
+        dirty_begin = dirty_end = 0;
+    };
+    for (size_t i = 0; i < num_chunks; ++i) {
+        const size_t begin = i * kChunkSize;
+        const size_t end = std::min(size, begin + kChunkSize);
+        const uint64_t hash = HashChunk(bytes + begin, end - begin);
+        // A chunk beyond the previous size, or that was the partial last
+        // chunk, is stale even if its hash matches.
+        const bool dirty = reallocated || end > size_ ||
+                           chunk_hashes_[i] != hash;
+        chunk_hashes_[i] = hash;
+        if (!dirty) {
+            flush();
+            continue;
+        }
+        if (dirty_end != begin) {
+            flush();
+            dirty_begin = begin;
+        }
+        dirty_end = end;
+    }
+    flush();
+    size_ = size;
+}
+
+void VertexBuffer::Release() {
+    if (buffer_ != 0) {
+        glDeleteBuffers(1, &buffer_);
+        buffer_ = 0;
+    }
+    capacity_ = 0;
+    size_ = 0;
+    num_allocations_ = 0;
+    chunk_hashes_.clear();
+}
+
+}  // namespace glsl
+
+}  // namespace visualization
+}  // namespace open3d
@@ -0,0 +1,92 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#pragma once
+
+#include <GL/glew.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace open3d {
+namespace visualization {
+
+namespace glsl {
+
+/// \class VertexBuffer
+///
+/// \brief Array buffer object that persists across geometry updates.
+///
+/// The buffer is only reallocated when the data outgrow it. Otherwise the
+/// data are uploaded with glBufferSubData, and chunks whose content did not
+/// change since the previous upload are skipped, which is detected with one
+/// hash per chunk instead of a copy of the data. Updating a large point
+/// cloud in which only a part of the points moved thus only uploads the
+/// changed part. Requires a current OpenGL context for Upload() and
+/// Release().
+class VertexBuffer {
+public:
+    VertexBuffer() = default;
+    VertexBuffer(const VertexBuffer &) = delete;
+    VertexBuffer &operator=(const VertexBuffer &) = delete;
+
+    /// Upload \p size bytes of \p data, replacing the previous content.
+    void Upload(const void *data, size_t size);
+
+    /// Upload the elements of a vector.
+    template <typename T, typename Alloc>
+    void Upload(const std::vector<T, Alloc> &data) {
+        Upload(data.data(), data.size() * sizeof(T));
+    }
+
+    /// Delete the buffer object.
+    void Release();
+
+    /// The buffer object, 0 before the first upload.
+    GLuint GetBuffer() const { return buffer_; }
+
+    /// Bytes uploaded by the last call to Upload(), for profiling.
+    size_t GetLastUploadSize() const { return last_upload_size_; }
+
+public:
+    /// Granularity of the change detection in bytes.
+    static constexpr size_t kChunkSize = size_t(1) << 20;
+
+private:
+    GLuint buffer_ = 0;
+    size_t capacity_ = 0;
+    size_t size_ = 0;
+    size_t num_allocations_ = 0;
+    size_t last_upload_size_ = 0;
+    std::vector<uint64_t> chunk_hashes_;
+};
+
+}  // namespace glsl
+
+}  // namespace visualization
+}  // namespace open3d
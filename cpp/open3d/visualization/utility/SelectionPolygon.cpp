@@ -26,10 +26,12 @@
 
 #include "open3d/visualization/utility/SelectionPolygon.h"
 
+#include "open3d/core/EigenConverter.h"
+#include "open3d/core/TensorCheck.h"
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/geometry/TriangleMesh.h"
 #include "open3d/utility/Logging.h"
-#include "open3d/utility/ProgressBar.h"
+#include "open3d/utility/Parallel.h"
 #include "open3d/visualization/utility/GLHelper.h"
 #include "open3d/visualization/utility/SelectionPolygonVolume.h"
 #include "open3d/visualization/visualizer/ViewControl.h"
@@ -230,68 +232,131 @@ SelectionPolygon::CropTriangleMeshInPolygon(const geometry::TriangleMesh &input,
 
 std::vector<size_t> SelectionPolygon::CropInRectangle(
         const std::vector<Eigen::Vector3d> &input, const ViewControl &view) {
-    std::vector<size_t> output_index;
     Eigen::Matrix4d mvp_matrix = view.GetMVPMatrix().cast<double>();
     double half_width = (double)view.GetWindowWidth() * 0.5;
     double half_height = (double)view.GetWindowHeight() * 0.5;
     auto min_bound = GetMinBound();
     auto max_bound = GetMaxBound();
-    utility::ProgressBar progress_bar((int64_t)input.size(),
-                                      "Cropping geometry: ");
-    for (size_t i = 0; i < input.size(); i++) {
-        ++progress_bar;
+    std::vector<uint8_t> mask(input.size(), 0);
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t i = 0; i < int64_t(input.size()); i++) {
         const auto &point = input[i];
         Eigen::Vector4d pos =
                 mvp_matrix * Eigen::Vector4d(point(0), point(1), point(2), 1.0);
-        if (pos(3) == 0.0) break;
+        if (pos(3) == 0.0) continue;
         pos /= pos(3);
         double x = (pos(0) + 1.0) * half_width;
         double y = (pos(1) + 1.0) * half_height;
-        if (x >= min_bound(0) && x <= max_bound(0) && y >= min_bound(1) &&
-            y <= max_bound(1)) {
-            output_index.push_back(i);
-        }
+        mask[i] = x >= min_bound(0) && x <= max_bound(0) &&
+                  y >= min_bound(1) && y <= max_bound(1);
     }
-    return output_index;
+    return MaskToIndices(mask);
 }
 
 std::vector<size_t> SelectionPolygon::CropInPolygon(
         const std::vector<Eigen::Vector3d> &input, const ViewControl &view) {
-    std::vector<size_t> output_index;
     Eigen::Matrix4d mvp_matrix = view.GetMVPMatrix().cast<double>();
     double half_width = (double)view.GetWindowWidth() * 0.5;
     double half_height = (double)view.GetWindowHeight() * 0.5;
-    std::vector<double> nodes;
-    utility::ProgressBar progress_bar((int64_t)input.size(),
-                                      "Cropping geometry: ");
-    for (size_t k = 0; k < input.size(); k++) {
-        ++progress_bar;
+    std::vector<uint8_t> mask(input.size(), 0);
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t k = 0; k < int64_t(input.size()); k++) {
         const auto &point = input[k];
         Eigen::Vector4d pos =
                 mvp_matrix * Eigen::Vector4d(point(0), point(1), point(2), 1.0);
-        if (pos(3) == 0.0) break;
+        if (pos(3) == 0.0) continue;
         pos /= pos(3);
         double x = (pos(0) + 1.0) * half_width;
         double y = (pos(1) + 1.0) * half_height;
-        nodes.clear();
+        // Count the crossings of the polygon edges left of the point.
+        int crossings = 0;
         for (size_t i = 0; i < polygon_.size(); i++) {
             size_t j = (i + 1) % polygon_.size();
             if ((polygon_[i](1) < y && polygon_[j](1) >= y) ||
                 (polygon_[j](1) < y && polygon_[i](1) >= y)) {
-                nodes.push_back(polygon_[i](0) +
-                                (y - polygon_[i](1)) /
-                                        (polygon_[j](1) - polygon_[i](1)) *
-                                        (polygon_[j](0) - polygon_[i](0)));
+                double node = polygon_[i](0) +
+                              (y - polygon_[i](1)) /
+                                      (polygon_[j](1) - polygon_[i](1)) *
+                                      (polygon_[j](0) - polygon_[i](0));
+                crossings += node < x;
             }
         }
-        std::sort(nodes.begin(), nodes.end());
-        auto loc = std::lower_bound(nodes.begin(), nodes.end(), x);
-        if (std::distance(nodes.begin(), loc) % 2 == 1) {
-            output_index.push_back(k);
+        mask[k] = crossings % 2 == 1;
+    }
+    return MaskToIndices(mask);
+}
+
+std::vector<size_t> SelectionPolygon::MaskToIndices(
+        const std::vector<uint8_t> &mask) {
+    std::vector<size_t> output_index;
+    for (size_t i = 0; i < mask.size(); i++) {
+        if (mask[i]) {
+            output_index.push_back(i);
         }
     }
     return output_index;
 }
 
+core::Tensor SelectionPolygon::SelectPointIndices(
+        const core::Tensor &points, const ViewControl &view) const {
+    core::AssertTensorShape(points, {utility::nullopt, 3});
+    core::AssertTensorDtypes(points, {core::Float32, core::Float64});
+    const core::Device device = points.GetDevice();
+    const core::Dtype dtype = points.GetDtype();
+    if (IsEmpty() || polygon_type_ == SectionPolygonType::Unfilled) {
+        return core::Tensor({0}, core::Int64, device);
+    }
+    const int width = view.GetWindowWidth();
+    const int height = view.GetWindowHeight();
+
+    // Project the points to window coordinates.
+    core::Tensor mvp = core::eigen_converter::EigenMatrixToTensor(
+                               view.GetMVPMatrix().cast<double>().eval())
+                               .To(device, dtype);
+    core::Tensor clip = points.Matmul(mvp.Slice(1, 0, 3).T()) +
+                        mvp.Slice(1, 3, 4).Reshape({4});
+    core::Tensor w = clip.Slice(1, 3, 4).Reshape({-1});
+    core::Tensor valid = w.Ne(0);
+    // Points at w = 0 are rejected below, avoid dividing by 0 for them.
+    w = w + valid.LogicalNot().To(dtype);
+    core::Tensor x = (clip.Slice(1, 0, 1).Reshape({-1}) / w + 1) *
+                     (width * 0.5);
+    core::Tensor y = (clip.Slice(1, 1, 2).Reshape({-1}) / w + 1) *
+                     (height * 0.5);
+
+    if (polygon_type_ == SectionPolygonType::Rectangle) {
+        Eigen::Vector2d min_bound = GetMinBound();
+        Eigen::Vector2d max_bound = GetMaxBound();
+        core::Tensor inside = valid && x.Ge(min_bound(0)) &&
+                              x.Le(max_bound(0)) && y.Ge(min_bound(1)) &&
+                              y.Le(max_bound(1));
+        return inside.NonZero().Reshape({-1});
+    }
+
+    if (polygon_interior_mask_.width_ != width ||
+        polygon_interior_mask_.height_ != height) {
+        utility::LogError(
+                "The polygon interior mask does not match the window size, "
+                "call FillPolygon() with the window size first.");
+    }
+    // Look up the interior mask at the pixels inside the window.
+    core::Tensor u = x.Floor();
+    core::Tensor v = y.Floor();
+    core::Tensor candidates = (valid && u.Ge(0) && u.Lt(width) && v.Ge(0) &&
+                               v.Lt(height))
+                                      .NonZero()
+                                      .Reshape({-1});
+    core::Tensor pixels = (v.IndexGet({candidates}) * width +
+                           u.IndexGet({candidates}))
+                                  .To(core::Int64);
+    core::Tensor interior_mask(polygon_interior_mask_.data_,
+                               {int64_t(polygon_interior_mask_.data_.size())},
+                               core::UInt8, device);
+    core::Tensor inside = interior_mask.IndexGet({pixels}).Ne(0);
+    return candidates.IndexGet({inside});
+}
+
 }  // namespace visualization
 }  // namespace open3d
@@ -30,6 +30,7 @@
 #include <memory>
 #include <vector>
 
+#include "open3d/core/Tensor.h"
 #include "open3d/geometry/Geometry2D.h"
 #include "open3d/geometry/Image.h"
 
@@ -73,6 +74,16 @@ public:
             const geometry::TriangleMesh &input, const ViewControl &view);
     std::shared_ptr<SelectionPolygonVolume> CreateSelectionPolygonVolume(
             const ViewControl &view);
+    /// Indices of the points inside the selection in the current view, as an
+    /// Int64 tensor of shape {k} on the device of \p points. The points are
+    /// projected and tested with tensor operations, so that large point
+    /// clouds can be selected on the GPU. Polygons are tested against the
+    /// interior mask of FillPolygon(), which must match the window size.
+    ///
+    /// \param points Float32 or Float64 tensor of shape {N, 3}.
+    /// \param view The view in which the selection was drawn.
+    core::Tensor SelectPointIndices(const core::Tensor &points,
+                                    const ViewControl &view) const;
 
 private:
     std::shared_ptr<geometry::PointCloud> CropPointCloudInRectangle(
@@ -87,6 +98,7 @@ private:
             const std::vector<Eigen::Vector3d> &input, const ViewControl &view);
     std::vector<size_t> CropInPolygon(const std::vector<Eigen::Vector3d> &input,
                                       const ViewControl &view);
+    static std::vector<size_t> MaskToIndices(const std::vector<uint8_t> &mask);
 
 public:
     std::vector<Eigen::Vector2d> polygon_;
@@ -44,8 +44,12 @@ namespace visualization {
 
 std::shared_ptr<zmq::message_t> MessageProcessor::ProcessMessage(
         const messages::Request& req,
-        const messages::SetMeshData& msg,
+        const messages::SetMeshData& msg_in,
         const msgpack::object_handle& obj) {
+    // Arrays mapped from CUDA shared memory are read on the CPU.
+    messages::SetMeshData msg = msg_in;
+    MoveArraysToCPU(msg.data);
+
     std::string errstr(":");
     if (!msg.data.CheckMessage(errstr)) {
         auto status_err = messages::Status::ErrorProcessingMessage();
@@ -26,6 +26,9 @@
 
 #include "open3d/visualization/visualizer/VisualizerWithEditing.h"
 
+#include <algorithm>
+#include <limits>
+
 #include <tinyfiledialogs/tinyfiledialogs.h>
 
 #include "open3d/geometry/Image.h"
@@ -193,12 +196,25 @@ void VisualizerWithEditing::BuildUtilities() {
     }
 }
 
-int VisualizerWithEditing::PickPoint(double x, double y) {
+int VisualizerWithEditing::PickPoint(double x, double y, int radius) {
+    if (!GLEW_ARB_framebuffer_object) {
+        // OpenGL 2.1 doesn't require this, 3.1+ does
+        utility::LogWarning(
+                "[PickPoint] Your GPU does not provide framebuffer objects. "
+                "Use a texture instead.");
+        return -1;
+    }
     auto renderer_ptr = std::make_shared<glsl::PointCloudPickingRenderer>();
     if (!renderer_ptr->AddGeometry(editing_geometry_ptr_)) {
         return -1;
     }
     const auto &view = GetViewControl();
+    radius = std::max(radius, 0);
+    const int size = 2 * radius + 1;
+    // Only the pixels around the cursor are rendered to the ID buffer, the
+    // viewport is shifted so that the cursor is at the center of the FBO.
+    const int px = (int)(x + 0.5);
+    const int py = (int)(view.GetWindowHeight() - y + 0.5);
     // Render to FBO and disable anti-aliasing
     glDisable(GL_MULTISAMPLE);
     GLuint frame_buffer_name = 0;
@@ -207,54 +223,61 @@ int VisualizerWithEditing::PickPoint(double x, double y) {
     GLuint fbo_texture;
     glGenTextures(1, &fbo_texture);
     glBindTexture(GL_TEXTURE_2D, fbo_texture);
-    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, view.GetWindowWidth(),
-                 view.GetWindowHeight(), 0, GL_RGBA, GL_UNSIGNED_BYTE, 0);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, size, size, 0, GL_RGBA,
+                 GL_UNSIGNED_BYTE, 0);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-    if (!GLEW_ARB_framebuffer_object) {
-        // OpenGL 2.1 doesn't require this, 3.1+ does
-        utility::LogWarning(
-                "[PickPoint] Your GPU does not provide framebuffer objects. "
-                "Use a texture instead.");
-        glBindFramebuffer(GL_FRAMEBUFFER, 0);
-        glEnable(GL_MULTISAMPLE);
-        return -1;
-    }
     GLuint depth_render_buffer;
     glGenRenderbuffers(1, &depth_render_buffer);
     glBindRenderbuffer(GL_RENDERBUFFER, depth_render_buffer);
-    glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT,
-                          view.GetWindowWidth(), view.GetWindowHeight());
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT, size, size);
     glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT,
                               GL_RENDERBUFFER, depth_render_buffer);
     glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D,
                            fbo_texture, 0);
     GLenum DrawBuffers[1] = {GL_COLOR_ATTACHMENT0};
     glDrawBuffers(1, DrawBuffers);  // "1" is the size of DrawBuffers
+    int index = -1;
     if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE) {
         utility::LogWarning("[PickPoint] Something is wrong with FBO.");
-        glBindFramebuffer(GL_FRAMEBUFFER, 0);
-        glEnable(GL_MULTISAMPLE);
-        return -1;
+    } else {
+        view_control_ptr_->SetViewMatrices();
+        glViewport(radius - px, radius - py, view.GetWindowWidth(),
+                   view.GetWindowHeight());
+        glDisable(GL_BLEND);
+        glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
+        glClearColor(1.0f, 1.0f, 1.0f, 0.0f);
+        glClearDepth(1.0f);
+        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+        renderer_ptr->Render(GetRenderOption(), GetViewControl());
+        glFinish();
+        std::vector<uint8_t> rgba(size * size * 4);
+        glReadPixels(0, 0, size, size, GL_RGBA, GL_UNSIGNED_BYTE, rgba.data());
+        // The point closest to the cursor wins.
+        int best_distance = std::numeric_limits<int>::max();
+        for (int v = 0; v < size; v++) {
+            for (int u = 0; u < size; u++) {
+                const uint8_t *pixel = &rgba[(v * size + u) * 4];
+                int pixel_index =
+                        gl_util::ColorCodeToPickIndex(Eigen::Vector4i(
+                                pixel[0], pixel[1], pixel[2], pixel[3]));
+                int distance = (u - radius) * (u - radius) +
+                               (v - radius) * (v - radius);
+                if (pixel_index >= 0 && distance < best_distance) {
+                    best_distance = distance;
+                    index = pixel_index;
+                }
+            }
+        }
     }
-    glBindFramebuffer(GL_FRAMEBUFFER, frame_buffer_name);
-    view_control_ptr_->SetViewMatrices();
-    glDisable(GL_BLEND);
-    glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
-    glClearColor(1.0f, 1.0f, 1.0f, 0.0f);
-    glClearDepth(1.0f);
-    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
-    renderer_ptr->Render(GetRenderOption(), GetViewControl());
-    glFinish();
-    uint8_t rgba[4];
-    glReadPixels((int)(x + 0.5), (int)(view.GetWindowHeight() - y + 0.5), 1, 1,
-                 GL_RGBA, GL_UNSIGNED_BYTE, rgba);
-    int index = gl_util::ColorCodeToPickIndex(
-            Eigen::Vector4i(rgba[0], rgba[1], rgba[2], rgba[3]));
     // Recover rendering state
     glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    glDeleteFramebuffers(1, &frame_buffer_name);
+    glDeleteTextures(1, &fbo_texture);
+    glDeleteRenderbuffers(1, &depth_render_buffer);
+    glViewport(0, 0, view.GetWindowWidth(), view.GetWindowHeight());
     glEnable(GL_MULTISAMPLE);
     return index;
 }
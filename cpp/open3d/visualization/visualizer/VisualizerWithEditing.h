@@ -65,7 +65,10 @@ public:
     void PrintVisualizerHelp() override;
     void UpdateWindowTitle() override;
     void BuildUtilities() override;
-    int PickPoint(double x, double y);
+    /// Index of the point under the window coordinates (\p x, \p y), or -1.
+    /// Only a (2 * \p radius + 1)^2 region of the ID buffer around the cursor
+    /// is rendered, the point closest to the cursor in it is returned.
+    int PickPoint(double x, double y, int radius = 0);
     std::vector<size_t> &GetPickedPoints();
 
 protected:
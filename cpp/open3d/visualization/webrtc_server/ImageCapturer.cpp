@@ -32,7 +32,11 @@
 #include <media/base/video_broadcaster.h>
 #include <media/base/video_common.h>
 
+#include <algorithm>
+#include <cmath>
+#include <cstring>
 #include <memory>
+#include <utility>
 
 #include "open3d/core/Tensor.h"
 #include "open3d/utility/Logging.h"
@@ -64,8 +68,70 @@ ImageCapturer::ImageCapturer(const std::map<std::string, std::string>& opts)
     }
 }
 
+constexpr int64_t ImageCapturer::kKeepAliveIntervalUs;
+
+bool ImageCapturer::IsRedundantFrame(const core::Tensor& frame) {
+    const int64_t now_us = rtc::TimeMicros();
+    std::lock_guard<std::mutex> lock(last_frame_mutex_);
+    const bool unchanged =
+            last_frame_ && last_frame_->GetShape() == frame.GetShape() &&
+            last_frame_->GetDtype() == frame.GetDtype() &&
+            std::memcmp(last_frame_->GetDataPtr(), frame.GetDataPtr(),
+                        frame.NumElements() * frame.GetDtype().ByteSize()) ==
+                    0;
+    if (unchanged && now_us - last_frame_time_us_ < kKeepAliveIntervalUs) {
+        return true;
+    }
+    // The renderer allocates a new tensor for every frame, so keeping a
+    // reference is enough.
+    last_frame_ = std::make_shared<core::Tensor>(frame);
+    last_frame_time_us_ = now_us;
+    return false;
+}
+
+void ImageCapturer::DeliverFrame(
+        const rtc::scoped_refptr<webrtc::I420BufferInterface>& buffer) {
+    const int64_t timestamp_us = rtc::TimeMicros();
+    const int width = buffer->width();
+    const int height = buffer->height();
+    // Viewers asking for the same resolution share the scaled buffer.
+    std::map<std::pair<int, int>, rtc::scoped_refptr<webrtc::VideoFrameBuffer>>
+            scaled_buffers;
+    scaled_buffers[{width, height}] = buffer;
+
+    std::lock_guard<std::mutex> lock(sinks_mutex_);
+    for (auto& sink : sinks_) {
+        int sink_width = width;
+        int sink_height = height;
+        const int max_pixel_count = sink.second.max_pixel_count;
+        if (max_pixel_count > 0 && width * height > max_pixel_count) {
+            // Keep the aspect ratio and even dimensions for I420.
+            const double scale =
+                    std::sqrt(double(max_pixel_count) / (width * height));
+            sink_width = std::max(2, int(width * scale) & ~1);
+            sink_height = std::max(2, int(height * scale) & ~1);
+        }
+        auto& sink_buffer = scaled_buffers[{sink_width, sink_height}];
+        if (!sink_buffer) {
+            rtc::scoped_refptr<webrtc::I420Buffer> scaled_buffer =
+                    webrtc::I420Buffer::Create(sink_width, sink_height);
+            scaled_buffer->ScaleFrom(*buffer);
+            sink_buffer = scaled_buffer;
+        }
+        sink.first->OnFrame(webrtc::VideoFrame(
+                sink_buffer, webrtc::kVideoRotation_0, timestamp_us));
+    }
+}
+
 void ImageCapturer::OnCaptureResult(
         const std::shared_ptr<core::Tensor>& frame) {
+    // The GUI redraws on every event, e.g. mouse moves that do not change
+    // the view. Skip unchanged frames: this lowers the frame rate of static
+    // scenes to the keep-alive rate and frees the encoders for other viewers.
+    if (IsRedundantFrame(*frame)) {
+        return;
+    }
+
     int height = (int)frame->GetShape(0);
     int width = (int)frame->GetShape(1);
 
@@ -81,30 +147,23 @@ void ImageCapturer::OnCaptureResult(
             i420_buffer->height(), libyuv::kRotate0, ::libyuv::FOURCC_RAW);
 
     if (conversion_result >= 0) {
-        webrtc::VideoFrame video_frame(i420_buffer,
-                                       webrtc::VideoRotation::kVideoRotation_0,
-                                       rtc::TimeMicros());
         if ((height_ == 0) && (width_ == 0)) {
-            broadcaster_.OnFrame(video_frame);
+            DeliverFrame(i420_buffer);
         } else {
             int height = height_;
             int width = width_;
             if (height == 0) {
-                height = (video_frame.height() * width) / video_frame.width();
+                height = (i420_buffer->height() * width) / i420_buffer->width();
             } else if (width == 0) {
-                width = (video_frame.width() * height) / video_frame.height();
+                width = (i420_buffer->width() * height) / i420_buffer->height();
             }
             int stride_y = width;
             int stride_uv = (width + 1) / 2;
             rtc::scoped_refptr<webrtc::I420Buffer> scaled_buffer =
                     webrtc::I420Buffer::Create(width, height, stride_y,
                                                stride_uv, stride_uv);
-            scaled_buffer->ScaleFrom(
-                    *video_frame.video_frame_buffer()->ToI420());
-            webrtc::VideoFrame frame = webrtc::VideoFrame(
-                    scaled_buffer, webrtc::kVideoRotation_0, rtc::TimeMicros());
-
-            broadcaster_.OnFrame(frame);
+            scaled_buffer->ScaleFrom(*i420_buffer);
+            DeliverFrame(scaled_buffer);
         }
     } else {
         utility::LogError("ImageCapturer:OnCaptureResult conversion error: {}",
@@ -116,12 +175,18 @@ void ImageCapturer::OnCaptureResult(
 void ImageCapturer::AddOrUpdateSink(
         rtc::VideoSinkInterface<webrtc::VideoFrame>* sink,
         const rtc::VideoSinkWants& wants) {
-    broadcaster_.AddOrUpdateSink(sink, wants);
+    {
+        std::lock_guard<std::mutex> lock(sinks_mutex_);
+        sinks_[sink] = wants;
+    }
+    std::lock_guard<std::mutex> lock(last_frame_mutex_);
+    last_frame_ = nullptr;
 }
 
 void ImageCapturer::RemoveSink(
         rtc::VideoSinkInterface<webrtc::VideoFrame>* sink) {
-    broadcaster_.RemoveSink(sink);
+    std::lock_guard<std::mutex> lock(sinks_mutex_);
+    sinks_.erase(sink);
 }
 
 }  // namespace webrtc_server
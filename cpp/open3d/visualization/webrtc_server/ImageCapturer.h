@@ -35,7 +35,9 @@
 #include <media/base/video_broadcaster.h>
 #include <media/base/video_common.h>
 
+#include <map>
 #include <memory>
+#include <mutex>
 
 #include "open3d/core/Tensor.h"
 #include "open3d/utility/Logging.h"
@@ -67,9 +69,35 @@ public:
     void OnCaptureResult(const std::shared_ptr<core::Tensor>& frame);
 
 protected:
+    /// Returns true if \p frame equals the last broadcast frame and that
+    /// frame was sent less than kKeepAliveIntervalUs ago. Sending unchanged
+    /// frames would only cost I420 conversion and encoding for every viewer.
+    bool IsRedundantFrame(const core::Tensor& frame);
+
+    /// Unchanged frames are still sent at this interval so that the encoder
+    /// can refresh the picture for viewers with packet loss.
+    static constexpr int64_t kKeepAliveIntervalUs = 1000000;
+
+    /// Sends \p buffer to every sink, downscaled to the sink's
+    /// VideoSinkWants::max_pixel_count. WebRTC lowers max_pixel_count for
+    /// viewers with little bandwidth or a busy encoder, so each viewer gets
+    /// the largest resolution it can take without slowing down the others.
+    void DeliverFrame(const rtc::scoped_refptr<webrtc::I420BufferInterface>&
+                              buffer);
+
     int width_;
     int height_;
-    rtc::VideoBroadcaster broadcaster_;
+
+    std::mutex sinks_mutex_;
+    std::map<rtc::VideoSinkInterface<webrtc::VideoFrame>*,
+             rtc::VideoSinkWants>
+            sinks_;
+
+    std::mutex last_frame_mutex_;
+    /// Last broadcast frame, reset when a sink is added so that new viewers
+    /// always receive the next frame.
+    std::shared_ptr<core::Tensor> last_frame_;
+    int64_t last_frame_time_us_ = 0;
 };
 
 class ImageTrackSource : public BitmapTrackSource {
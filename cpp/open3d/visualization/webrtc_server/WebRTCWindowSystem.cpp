@@ -428,6 +428,8 @@ void WebRTCWindowSystem::SendInitFrames(const std::string &window_uid) {
     const auto os_window = GetOSWindowByUID(window_uid);
     if (!os_window) return;
     for (int i = 0; os_window != nullptr && i < s_max_initial_frames; ++i) {
+        // The new viewer needs the frames even if the window is unchanged.
+        ForceCapture(os_window);
         PostRedrawEvent(os_window);
         std::this_thread::sleep_for(
                 std::chrono::milliseconds(s_sleep_between_frames_ms));
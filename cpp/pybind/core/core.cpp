@@ -40,6 +40,7 @@ void pybind_core(py::module& m) {
 
     // opn3d::core namespace.
     pybind_cuda_utils(m_core);
+    pybind_core_memory(m_core);
     pybind_core_blob(m_core);
     pybind_core_dtype(m_core);
     pybind_core_device(m_core);
@@ -51,6 +52,8 @@ void pybind_core(py::module& m) {
     pybind_core_hashmap(m_core);
     pybind_core_hashset(m_core);
     pybind_core_scalar(m_core);
+    pybind_core_sparse_tensor(m_core);
+    pybind_core_ragged_tensor(m_core);
 
     // opn3d::core::nns namespace.
     py::module m_nns = m_core.def_submodule("nns");
@@ -42,10 +42,13 @@ void pybind_core_tensor(py::module& m);
 void pybind_core_tensor_accessor(py::class_<Tensor>& t);
 void pybind_core_tensor_function(py::module& m);
 void pybind_core_linalg(py::module& m);
+void pybind_core_memory(py::module& m);
 void pybind_core_kernel(py::module& m);
 void pybind_core_hashmap(py::module& m);
 void pybind_core_hashset(py::module& m);
 void pybind_core_scalar(py::module& m);
+void pybind_core_sparse_tensor(py::module& m);
+void pybind_core_ragged_tensor(py::module& m);
 
 }  // namespace core
 }  // namespace open3d
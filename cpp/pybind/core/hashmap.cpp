@@ -131,6 +131,42 @@ void pybind_core_hashmap(py::module& m) {
             "Find an array of keys stored in Tensors.", "keys"_a);
     docstring::ClassMethodDocInject(m, "HashMap", "find", argument_docs);
 
+    hashmap.def(
+            "find_or_insert",
+            [](HashMap& h, const Tensor& keys) {
+                Tensor buf_indices, masks;
+                h.FindOrInsert(keys, buf_indices, masks);
+                return py::make_tuple(buf_indices, masks);
+            },
+            "Find an array of keys stored in Tensors, and activate the keys "
+            "that are not found. Return buffer indices of all the keys, and "
+            "masks indicating the newly activated ones.",
+            "keys"_a);
+    hashmap.def(
+            "find_or_insert",
+            [](HashMap& h, const Tensor& keys, const Tensor& values) {
+                Tensor buf_indices, masks;
+                h.FindOrInsert(keys, std::vector<Tensor>{values}, buf_indices,
+                               masks);
+                return py::make_tuple(buf_indices, masks);
+            },
+            "Find an array of keys stored in Tensors, and insert the keys "
+            "that are not found with the corresponding values.",
+            "keys"_a, "values"_a);
+    hashmap.def(
+            "find_or_insert",
+            [](HashMap& h, const Tensor& keys,
+               const std::vector<Tensor>& values) {
+                Tensor buf_indices, masks;
+                h.FindOrInsert(keys, values, buf_indices, masks);
+                return py::make_tuple(buf_indices, masks);
+            },
+            "Find an array of keys stored in Tensors, and insert the keys "
+            "that are not found with the corresponding list of value arrays.",
+            "keys"_a, "list_values"_a);
+    docstring::ClassMethodDocInject(m, "HashMap", "find_or_insert",
+                                    argument_docs);
+
     hashmap.def(
             "erase",
             [](HashMap& h, const Tensor& keys) {
@@ -163,6 +199,10 @@ void pybind_core_hashmap(py::module& m) {
                 "Reserve the hash map given the capacity.", "capacity"_a);
     docstring::ClassMethodDocInject(m, "HashMap", "reserve", argument_docs);
 
+    hashmap.def("compact", &HashMap::Compact,
+                "Move active entries to buffer indices [0, size). Return the "
+                "pair (old_buf_indices, new_buf_indices).");
+
     hashmap.def("key_tensor", &HashMap::GetKeyTensor,
                 "Get the key tensor stored in the buffer.");
     hashmap.def("value_tensors", &HashMap::GetValueTensors,
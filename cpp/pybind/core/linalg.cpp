@@ -25,6 +25,8 @@
 // ----------------------------------------------------------------------------
 
 #include "open3d/core/linalg/AddMM.h"
+#include "open3d/core/linalg/BatchedLinalg.h"
+#include "open3d/core/linalg/ConjugateGradient.h"
 #include "open3d/core/linalg/Det.h"
 #include "open3d/core/linalg/Inverse.h"
 #include "open3d/core/linalg/LU.h"
@@ -163,6 +165,100 @@ void pybind_core_linalg(py::module &m) {
             },
             "Function to get both upper and lower triangular matrix", "A"_a,
             "diagonal"_a = 0);
+
+    // "None" is a Python keyword, plain CG is exposed as Identity.
+    py::enum_<PreconditionerType>(m, "PreconditionerType",
+                                  "Preconditioner of pcg.")
+            .value("Identity", PreconditionerType::None)
+            .value("Jacobi", PreconditionerType::Jacobi)
+            .value("BlockJacobi", PreconditionerType::BlockJacobi);
+
+    py::class_<ConjugateGradientResult>(m, "ConjugateGradientResult",
+                                        "Convergence information of pcg.")
+            .def_readonly("iterations", &ConjugateGradientResult::iterations_)
+            .def_readonly("residual_norm",
+                          &ConjugateGradientResult::residual_norm_)
+            .def_readonly("converged", &ConjugateGradientResult::converged_);
+
+    auto pcg = [](const auto &A, const Tensor &b,
+                  PreconditionerType preconditioner, int64_t block_size,
+                  int max_iteration, double relative_tolerance,
+                  double absolute_tolerance) {
+        ConjugateGradientOption option;
+        option.max_iteration_ = max_iteration;
+        option.relative_tolerance_ = relative_tolerance;
+        option.absolute_tolerance_ = absolute_tolerance;
+        Tensor x;
+        ConjugateGradientResult result =
+                PCG(A, b, x, preconditioner, block_size, option);
+        return py::make_tuple(x, result);
+    };
+    const char *pcg_doc =
+            "Function to solve A x = b for a symmetric positive definite "
+            "dense or sparse A with the preconditioned conjugate gradient "
+            "method. Returns the tuple (x, result).";
+    m.def(
+            "pcg",
+            [pcg](const Tensor &A, const Tensor &b,
+                  PreconditionerType preconditioner, int64_t block_size,
+                  int max_iteration, double relative_tolerance,
+                  double absolute_tolerance) {
+                return pcg(A, b, preconditioner, block_size, max_iteration,
+                           relative_tolerance, absolute_tolerance);
+            },
+            pcg_doc, "A"_a, "b"_a,
+            "preconditioner"_a = PreconditionerType::Jacobi,
+            "block_size"_a = 1, "max_iteration"_a = 1000,
+            "relative_tolerance"_a = 1e-6, "absolute_tolerance"_a = 0.0);
+    m.def(
+            "pcg",
+            [pcg](const SparseTensor &A, const Tensor &b,
+                  PreconditionerType preconditioner, int64_t block_size,
+                  int max_iteration, double relative_tolerance,
+                  double absolute_tolerance) {
+                return pcg(A, b, preconditioner, block_size, max_iteration,
+                           relative_tolerance, absolute_tolerance);
+            },
+            pcg_doc, "A"_a, "b"_a,
+            "preconditioner"_a = PreconditionerType::Jacobi,
+            "block_size"_a = 1, "max_iteration"_a = 1000,
+            "relative_tolerance"_a = 1e-6, "absolute_tolerance"_a = 0.0);
+
+    m.def(
+            "batched_solve",
+            [](const Tensor &A, const Tensor &B) {
+                Tensor output;
+                BatchedSolve(A, B, output);
+                return output;
+            },
+            "Function to solve X[i] for the linear systems A[i] X[i] = B[i] "
+            "of a {batch, n, n} tensor A.",
+            "A"_a, "B"_a);
+
+    m.def(
+            "batched_inv",
+            [](const Tensor &A) {
+                Tensor output;
+                BatchedInverse(A, output);
+                return output;
+            },
+            "Function to inverse every matrix of a {batch, n, n} tensor.",
+            "A"_a);
+
+    m.def("batched_det", &BatchedDet,
+          "Function to compute the determinants of a {batch, n, n} tensor.",
+          "A"_a);
+
+    m.def(
+            "batched_svd",
+            [](const Tensor &A) {
+                Tensor U, S, VT;
+                BatchedSVD(A, U, S, VT);
+                return py::make_tuple(U, S, VT);
+            },
+            "Function to decompose A[i] = U[i] S[i] VT[i] for every matrix of "
+            "a {batch, m, n} tensor.",
+            "A"_a);
 }
 
 }  // namespace core
@@ -0,0 +1,120 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/core/MemoryManagerStatistic.h"
+#include "pybind/core/core.h"
+
+namespace open3d {
+namespace core {
+
+void pybind_core_memory(py::module& m) {
+    py::module m_memory = m.def_submodule(
+            "memory",
+            "Memory held by Open3D allocations per device and per tag.");
+
+    py::class_<MemoryTagStatistic>(
+            m_memory, "MemoryTagStatistic",
+            "Memory held by the allocations of one tag on one device.")
+            .def_readonly("live_bytes", &MemoryTagStatistic::live_bytes_,
+                          "Bytes currently allocated.")
+            .def_readonly("peak_bytes", &MemoryTagStatistic::peak_bytes_,
+                          "Maximum of live_bytes since the last reset.")
+            .def_readonly("bytes_at_device_peak",
+                          &MemoryTagStatistic::bytes_at_device_peak_,
+                          "live_bytes at the time the device reached its "
+                          "peak.")
+            .def_readonly("count_malloc", &MemoryTagStatistic::count_malloc_)
+            .def_readonly("count_free", &MemoryTagStatistic::count_free_)
+            .def("__repr__", [](const MemoryTagStatistic& s) {
+                return fmt::format(
+                        "MemoryTagStatistic(live_bytes={}, peak_bytes={}, "
+                        "bytes_at_device_peak={})",
+                        s.live_bytes_, s.peak_bytes_, s.bytes_at_device_peak_);
+            });
+
+    m_memory.def(
+            "get_live_bytes",
+            [](const Device& device) {
+                return MemoryManagerStatistic::GetInstance().GetLiveBytes(
+                        device);
+            },
+            "Returns the bytes currently allocated on the device.",
+            "device"_a);
+    m_memory.def(
+            "get_peak_bytes",
+            [](const Device& device) {
+                return MemoryManagerStatistic::GetInstance().GetPeakBytes(
+                        device);
+            },
+            "Returns the maximum of allocated bytes on the device since the "
+            "last reset.",
+            "device"_a);
+    m_memory.def(
+            "get_tag_statistics",
+            [](const Device& device) {
+                return MemoryManagerStatistic::GetInstance().GetTagStatistics(
+                        device);
+            },
+            "Returns a dict from tag path, e.g. "
+            "``voxel_block_grid/hashmap``, to MemoryTagStatistic for the "
+            "device.",
+            "device"_a);
+    m_memory.def(
+            "reset_peak_bytes",
+            []() { MemoryManagerStatistic::GetInstance().ResetPeakBytes(); },
+            "Restarts the peak tracking of all devices and tags at the "
+            "current live bytes.");
+
+    // Context manager, since the tag scope must span Python statements.
+    struct MemoryTag {
+        std::string tag_;
+    };
+    py::class_<MemoryTag>(m_memory, "MemoryTag",
+                          "A context manager that attributes the allocations "
+                          "within its scope to a tag. Nested tags form a "
+                          "path.")
+            .def(py::init([](const std::string& tag) {
+                     return MemoryTag{tag};
+                 }),
+                 "tag"_a)
+            .def(
+                    "__enter__",
+                    [](MemoryTag& self) {
+                        MemoryManagerStatistic::PushTag(self.tag_);
+                    },
+                    "Enter the tag.")
+            .def(
+                    "__exit__",
+                    [](MemoryTag& self, py::object exc_type,
+                       py::object exc_value, py::object traceback) {
+                        MemoryManagerStatistic::PopTag();
+                    },
+                    "Leave the tag.");
+}
+
+}  // namespace core
+}  // namespace open3d
@@ -27,6 +27,7 @@
 #include "pybind/core/nns/nearest_neighbor_search.h"
 
 #include "open3d/core/Tensor.h"
+#include "open3d/core/nns/IncrementalNeighborGraph.h"
 #include "open3d/core/nns/NearestNeighborSearch.h"
 #include "pybind/core/tensor_converter.h"
 #include "pybind/docstring.h"
@@ -47,7 +48,12 @@ void pybind_core_nns(py::module &m_nns) {
                     {"radius", "Radius value for radius search."},
                     {"max_knn",
                      "Maximum number of neighbors to search per query point."},
-                    {"knn", "Number of neighbors to search per query point."}};
+                    {"knn", "Number of neighbors to search per query point."},
+                    {"eps",
+                     "Approximation error for CPU knn search. For eps > 0, "
+                     "each returned squared distance is within a factor of "
+                     "(1 + eps) of the exact one. CUDA search is always "
+                     "exact."}};
 
     py::class_<NearestNeighborSearch, std::shared_ptr<NearestNeighborSearch>>
             nns(m_nns, "NearestNeighborSearch",
@@ -87,7 +93,7 @@ void pybind_core_nns(py::module &m_nns) {
 
     // Search functions.
     nns.def("knn_search", &NearestNeighborSearch::KnnSearch, "query_points"_a,
-            "knn"_a, "Perform knn search.");
+            "knn"_a, "eps"_a = 0.0, "Perform knn search.");
     nns.def(
             "fixed_radius_search",
             [](NearestNeighborSearch &self, Tensor query_points, double radius,
@@ -109,6 +115,33 @@ void pybind_core_nns(py::module &m_nns) {
             "query_points"_a, "radius"_a, "max_knn"_a,
             "Perform hybrid search.");
 
+    py::class_<IncrementalNeighborGraph,
+               std::shared_ptr<IncrementalNeighborGraph>>
+            graph(m_nns, "IncrementalNeighborGraph",
+                  "Hybrid search neighbor lists of a point set that changes "
+                  "in batches. Inserting or removing points only updates the "
+                  "neighbor lists near the changed points.");
+    graph.def(py::init<double, int, const Dtype &, const Device &>(),
+              "radius"_a, "max_knn"_a, "dtype"_a = core::Float32,
+              "device"_a = Device("CPU:0"));
+    graph.def("insert", &IncrementalNeighborGraph::Insert, "points"_a,
+              "Insert (n, 3) points and return their Int64 ids.");
+    graph.def("remove", &IncrementalNeighborGraph::Remove, "ids"_a,
+              "Remove the points with the given Int64 ids.");
+    graph.def("size", &IncrementalNeighborGraph::Size,
+              "Number of points in the graph.");
+    graph.def("get_ids", &IncrementalNeighborGraph::GetIds,
+              "Ids of the points in increasing order.");
+    graph.def("get_points", &IncrementalNeighborGraph::GetPoints,
+              "Points in the order of get_ids().");
+    graph.def("get_neighbors", &IncrementalNeighborGraph::GetNeighbors,
+              "Neighbor indices, squared distances and counts in the layout "
+              "of hybrid_search, with rows in the order of get_ids().");
+    graph.def("get_num_updated_lists",
+              &IncrementalNeighborGraph::GetNumUpdatedLists,
+              "Number of neighbor lists updated by the last insert or "
+              "remove.");
+
     // Docstrings.
     docstring::ClassMethodDocInject(m_nns, "NearestNeighborSearch",
                                     "knn_search",
@@ -0,0 +1,99 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/core/RaggedTensor.h"
+
+#include "open3d/core/Tensor.h"
+#include "pybind/core/core.h"
+#include "pybind/docstring.h"
+#include "pybind/open3d_pybind.h"
+
+namespace open3d {
+namespace core {
+
+void pybind_core_ragged_tensor(py::module& m) {
+    py::class_<RaggedTensor> ragged_tensor(
+            m, "RaggedTensor",
+            "A batch of variable-length rows stored as one values tensor and "
+            "Int64 row splits. Row r is values[row_splits[r]:row_splits[r + "
+            "1]].");
+
+    ragged_tensor.def(py::init<>());
+    ragged_tensor.def(py::init<const Tensor&, const Tensor&>(),
+                      "Construct from the values and row splits.", "values"_a,
+                      "row_splits"_a);
+
+    ragged_tensor.def_static("from_row_lengths", &RaggedTensor::FromRowLengths,
+                             "Construct from the values and the length of "
+                             "each row.",
+                             "values"_a, "row_lengths"_a);
+    ragged_tensor.def_static("from_tensors", &RaggedTensor::FromTensors,
+                             "Construct with one row per tensor. Values are "
+                             "copied.",
+                             "rows"_a);
+    ragged_tensor.def_static("concatenate", &RaggedTensor::Concatenate,
+                             "Returns the rows of all ragged tensors in "
+                             "order.",
+                             "tensors"_a);
+
+    ragged_tensor.def("get_row", &RaggedTensor::GetRow,
+                      "Returns a row as a view of the values.", "row"_a);
+    ragged_tensor.def("gather_rows", &RaggedTensor::GatherRows,
+                      "Returns the given rows as a new ragged tensor.",
+                      "indices"_a);
+    ragged_tensor.def("sum", &RaggedTensor::Sum,
+                      "Returns the sum of each row. Empty rows are 0.");
+    ragged_tensor.def("mean", &RaggedTensor::Mean,
+                      "Returns the mean of each row. Empty rows are 0.");
+    ragged_tensor.def("max", &RaggedTensor::Max,
+                      "Returns the max of each row. Empty rows are 0.");
+    ragged_tensor.def("argmax", &RaggedTensor::ArgMax,
+                      "Returns the index into the values of the max of each "
+                      "row. Empty rows are -1.");
+    ragged_tensor.def("to_dense", &RaggedTensor::ToDense,
+                      "Returns the rows padded with pad_value or truncated "
+                      "to max_length as a dense tensor. A negative "
+                      "max_length uses the length of the longest row.",
+                      "max_length"_a = -1, "pad_value"_a = 0);
+    ragged_tensor.def("to", &RaggedTensor::To,
+                      "Returns the ragged tensor on the given device.",
+                      "device"_a, "copy"_a = false);
+    ragged_tensor.def("get_row_lengths", &RaggedTensor::GetRowLengths,
+                      "Returns the length of each row.");
+
+    ragged_tensor.def_property_readonly("num_rows", &RaggedTensor::NumRows);
+    ragged_tensor.def_property_readonly("device", &RaggedTensor::GetDevice);
+    ragged_tensor.def_property_readonly("dtype", &RaggedTensor::GetDtype);
+    ragged_tensor.def_property_readonly("values", &RaggedTensor::GetValues);
+    ragged_tensor.def_property_readonly("row_splits",
+                                        &RaggedTensor::GetRowSplits);
+    ragged_tensor.def("__len__", &RaggedTensor::NumRows);
+    ragged_tensor.def("__repr__", &RaggedTensor::ToString);
+}
+
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,93 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/core/SparseTensor.h"
+
+#include "open3d/core/Tensor.h"
+#include "pybind/core/core.h"
+#include "pybind/docstring.h"
+#include "pybind/open3d_pybind.h"
+
+namespace open3d {
+namespace core {
+
+void pybind_core_sparse_tensor(py::module& m) {
+    py::class_<SparseTensor> sparse_tensor(
+            m, "SparseTensor",
+            "A 2D sparse matrix in compressed sparse row (CSR) format.");
+
+    sparse_tensor.def(py::init<>());
+    sparse_tensor.def(py::init<const Tensor&, const Tensor&, const Tensor&,
+                               const SizeVector&>(),
+                      "Construct from CSR buffers.", "row_splits"_a,
+                      "col_indices"_a, "values"_a, "shape"_a);
+
+    sparse_tensor.def_static(
+            "from_coo", &SparseTensor::FromCOO,
+            "Construct from coordinate (COO) triplets in any order. Entries "
+            "with the same row and column are summed.",
+            "row_indices"_a, "col_indices"_a, "values"_a, "shape"_a);
+    sparse_tensor.def_static("from_dense", &SparseTensor::FromDense,
+                             "Construct from the non-zero entries of a 2D "
+                             "tensor.",
+                             "dense"_a);
+
+    sparse_tensor.def(
+            "to_coo",
+            [](const SparseTensor& A) {
+                Tensor rows, cols, values;
+                std::tie(rows, cols, values) = A.ToCOO();
+                return py::make_tuple(rows, cols, values);
+            },
+            "Returns the (row_indices, col_indices, values) triplets in "
+            "row-major order.");
+    sparse_tensor.def("to_dense", &SparseTensor::ToDense,
+                      "Returns the matrix as a dense 2D tensor.");
+    sparse_tensor.def("to", &SparseTensor::To,
+                      "Returns the matrix on the given device.", "device"_a,
+                      "copy"_a = false);
+    sparse_tensor.def("T", &SparseTensor::T,
+                      "Returns the transposed matrix.");
+    sparse_tensor.def("spmv", &SparseTensor::SpMV,
+                      "Sparse matrix-vector product A @ x.", "x"_a);
+    sparse_tensor.def("spmm", &SparseTensor::SpMM,
+                      "Sparse-dense matrix product A @ B.", "B"_a);
+
+    sparse_tensor.def_property_readonly("shape", &SparseTensor::GetShape);
+    sparse_tensor.def_property_readonly("nnz", &SparseTensor::NumNonZeros);
+    sparse_tensor.def_property_readonly("device", &SparseTensor::GetDevice);
+    sparse_tensor.def_property_readonly("dtype", &SparseTensor::GetDtype);
+    sparse_tensor.def_property_readonly("row_splits",
+                                        &SparseTensor::GetRowSplits);
+    sparse_tensor.def_property_readonly("col_indices",
+                                        &SparseTensor::GetColIndices);
+    sparse_tensor.def_property_readonly("values", &SparseTensor::GetValues);
+    sparse_tensor.def("__repr__", &SparseTensor::ToString);
+}
+
+}  // namespace core
+}  // namespace open3d
@@ -267,6 +267,48 @@ static void BindTensorFullCreation(py::module& m, py::class_<Tensor>& tensor) {
             "device"_a = py::none());
 }
 
+static py::capsule TensorToDLPackCapsule(const Tensor& tensor) {
+    DLManagedTensor* dl_managed_tensor = tensor.ToDLPack();
+    // See PyTorch's torch/csrc/Module.cpp
+    auto capsule_destructor = [](PyObject* data) {
+        DLManagedTensor* dl_managed_tensor =
+                (DLManagedTensor*)PyCapsule_GetPointer(data, "dltensor");
+        if (dl_managed_tensor) {
+            // the dl_managed_tensor has not been consumed,
+            // call deleter ourselves
+            dl_managed_tensor->deleter(
+                    const_cast<DLManagedTensor*>(dl_managed_tensor));
+        } else {
+            // The dl_managed_tensor has been consumed
+            // PyCapsule_GetPointer has set an error indicator
+            PyErr_Clear();
+        }
+    };
+    return py::capsule(dl_managed_tensor, "dltensor", capsule_destructor);
+}
+
+#ifdef BUILD_CUDA_MODULE
+// Stream values of the DLPack Python protocol: 1 and 2 are the legacy and the
+// per-thread default streams, other values are cudaStream_t handles.
+static cudaStream_t DLPackToCUDAStream(int64_t stream) {
+    if (stream == 1) {
+        return cudaStreamLegacy;
+    } else if (stream == 2) {
+        return cudaStreamPerThread;
+    }
+    return reinterpret_cast<cudaStream_t>(stream);
+}
+
+static int64_t CUDAStreamToDLPack(cudaStream_t stream) {
+    if (stream == nullptr || stream == cudaStreamLegacy) {
+        return 1;
+    } else if (stream == cudaStreamPerThread) {
+        return 2;
+    }
+    return reinterpret_cast<int64_t>(stream);
+}
+#endif
+
 void pybind_core_tensor(py::module& m) {
     py::class_<Tensor> tensor(
             m, "Tensor",
@@ -484,42 +526,100 @@ Example:
         return core::PyArrayToTensor(np_array, /*inplace=*/true);
     });
 
-    tensor.def("to_dlpack", [](const Tensor& tensor) {
-        DLManagedTensor* dl_managed_tensor = tensor.ToDLPack();
-        // See PyTorch's torch/csrc/Module.cpp
-        auto capsule_destructor = [](PyObject* data) {
-            DLManagedTensor* dl_managed_tensor =
-                    (DLManagedTensor*)PyCapsule_GetPointer(data, "dltensor");
-            if (dl_managed_tensor) {
-                // the dl_managed_tensor has not been consumed,
-                // call deleter ourselves
-                dl_managed_tensor->deleter(
-                        const_cast<DLManagedTensor*>(dl_managed_tensor));
-            } else {
-                // The dl_managed_tensor has been consumed
-                // PyCapsule_GetPointer has set an error indicator
-                PyErr_Clear();
-            }
-        };
-        return py::capsule(dl_managed_tensor, "dltensor", capsule_destructor);
-    });
+    tensor.def("to_dlpack", &TensorToDLPackCapsule,
+               "Returns a DLPack capsule sharing the memory of the tensor. "
+               "Prefer ``__dlpack__()``, which also orders the exchange with "
+               "the stream of the consumer.");
 
-    tensor.def_static("from_dlpack", [](py::capsule data) {
-        DLManagedTensor* dl_managed_tensor =
-                static_cast<DLManagedTensor*>(data);
-        if (!dl_managed_tensor) {
-            utility::LogError(
-                    "from_dlpack must receive "
-                    "DLManagedTensor PyCapsule.");
-        }
-        // Make sure that the PyCapsule is not used again.
-        // See:
-        // torch/csrc/Module.cpp, and
-        // https://github.com/cupy/cupy/pull/1445/files#diff-ddf01ff512087ef616db57ecab88c6ae
-        Tensor t = Tensor::FromDLPack(dl_managed_tensor);
-        PyCapsule_SetName(data.ptr(), "used_dltensor");
-        return t;
-    });
+    tensor.def(
+            "__dlpack__",
+            [](const Tensor& tensor, py::object stream) {
+                if (tensor.GetDevice().GetType() ==
+                    core::Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+                    // DLPack stream values: None and 1 denote the legacy
+                    // default stream, 2 the per-thread default stream and -1
+                    // disables synchronization. Other values are cudaStream_t
+                    // handles. 0 is ambiguous and not allowed.
+                    const int64_t consumer =
+                            stream.is_none() ? 1 : stream.cast<int64_t>();
+                    if (consumer == 0) {
+                        utility::LogError(
+                                "__dlpack__: stream 0 is not allowed for CUDA "
+                                "tensors.");
+                    }
+                    if (consumer != -1) {
+                        core::CUDAScopedDevice scoped_device(
+                                tensor.GetDevice());
+                        core::cuda::StreamWaitStream(
+                                DLPackToCUDAStream(consumer),
+                                core::cuda::GetStream());
+                    }
+#endif
+                }
+                return TensorToDLPackCapsule(tensor);
+            },
+            "Returns a DLPack capsule sharing the memory of the tensor. For "
+            "CUDA tensors, the consumer stream waits for the pending work on "
+            "Open3D's current stream without synchronizing the host.",
+            "stream"_a = py::none());
+
+    tensor.def(
+            "__dlpack_device__",
+            [](const Tensor& tensor) {
+                const core::Device& device = tensor.GetDevice();
+                const int device_type =
+                        device.GetType() == core::Device::DeviceType::CUDA
+                                ? kDLGPU
+                                : kDLCPU;
+                return py::make_tuple(device_type, device.GetID());
+            },
+            "Returns the DLPack (device_type, device_id) of the tensor.");
+
+    tensor.def_static(
+            "from_dlpack",
+            [](py::object data) {
+                if (py::hasattr(data, "__dlpack__")) {
+                    // Pass the current Open3D stream of the device, so that
+                    // the producer orders its pending work before ours.
+                    py::object stream = py::none();
+#ifdef BUILD_CUDA_MODULE
+                    py::tuple device = data.attr("__dlpack_device__")();
+                    if (device[0].cast<int>() == kDLGPU) {
+                        core::CUDAScopedDevice scoped_device(
+                                device[1].cast<int>());
+                        stream = py::int_(
+                                CUDAStreamToDLPack(core::cuda::GetStream()));
+                    }
+#endif
+                    data = data.attr("__dlpack__")("stream"_a = stream);
+                }
+                if (!py::isinstance<py::capsule>(data)) {
+                    utility::LogError(
+                            "from_dlpack must receive a DLManagedTensor "
+                            "PyCapsule or an object implementing "
+                            "__dlpack__.");
+                }
+                py::capsule capsule = data.cast<py::capsule>();
+                DLManagedTensor* dl_managed_tensor =
+                        static_cast<DLManagedTensor*>(capsule);
+                if (!dl_managed_tensor) {
+                    utility::LogError(
+                            "from_dlpack must receive "
+                            "DLManagedTensor PyCapsule.");
+                }
+                // Make sure that the PyCapsule is not used again.
+                // See:
+                // torch/csrc/Module.cpp, and
+                // https://github.com/cupy/cupy/pull/1445/files#diff-ddf01ff512087ef616db57ecab88c6ae
+                Tensor t = Tensor::FromDLPack(dl_managed_tensor);
+                PyCapsule_SetName(capsule.ptr(), "used_dltensor");
+                return t;
+            },
+            "Creates a tensor sharing the memory of a DLPack capsule or of an "
+            "object implementing ``__dlpack__()``, such as a PyTorch tensor "
+            "or a CuPy array.",
+            "data"_a);
 
     // Numpy IO.
     tensor.def("save", &Tensor::Save, "Save tensor to Numpy's npy format.",
@@ -686,6 +786,12 @@ Ref:
                "underlying memory will be used.");
     tensor.def("is_contiguous", &Tensor::IsContiguous,
                "Returns True if the underlying memory buffer is contiguous.");
+    tensor.def("pin_memory", &Tensor::PinMemory,
+               "Returns a copy of the CPU tensor in page-locked (pinned) host "
+               "memory for fast, asynchronous transfers to CUDA devices. If "
+               "the tensor is already pinned, it is returned as is.");
+    tensor.def("is_pinned", &Tensor::IsPinned,
+               "Returns True if the tensor resides in pinned host memory.");
     tensor.def(
             "flatten", &Tensor::Flatten,
             R"(Flattens input by reshaping it into a one-dimensional tensor. If
@@ -883,6 +989,69 @@ Ref:
     BIND_REDUCTION_OP_NO_KEEPDIM(argmin, ArgMin);
     BIND_REDUCTION_OP_NO_KEEPDIM(argmax, ArgMax);
 
+    // Segment reduction and scan ops.
+    tensor.def("segment_sum", &Tensor::SegmentSum,
+               "Sum over ragged segments of the first dimension. Segment s "
+               "covers rows [row_splits[s], row_splits[s + 1]). Empty "
+               "segments are 0.",
+               "row_splits"_a);
+    tensor.def("segment_mean", &Tensor::SegmentMean,
+               "Mean over ragged segments of the first dimension. Empty "
+               "segments are 0.",
+               "row_splits"_a);
+    tensor.def("segment_max", &Tensor::SegmentMax,
+               "Max over ragged segments of the first dimension. Empty "
+               "segments are 0.",
+               "row_splits"_a);
+    tensor.def("segment_argmax", &Tensor::SegmentArgMax,
+               "Row index of the max over ragged segments of the first "
+               "dimension. Empty segments are -1.",
+               "row_splits"_a);
+    tensor.def("inclusive_prefix_sum", &Tensor::InclusivePrefixSum,
+               "Inclusive prefix sum along the first dimension.");
+    tensor.def("exclusive_prefix_sum", &Tensor::ExclusivePrefixSum,
+               "Exclusive prefix sum along the first dimension, starting "
+               "with 0.");
+
+    // Sorting ops.
+    tensor.def("sort", &Tensor::Sort, "Sort the 1-D tensor with a radix sort.",
+               "descending"_a = false);
+    tensor.def("argsort", &Tensor::ArgSort,
+               "Int64 indices that stably sort the 1-D tensor.",
+               "descending"_a = false);
+    tensor.def("segment_sort", &Tensor::SegmentSort,
+               "Sort each segment [row_splits[s], row_splits[s + 1]) of the "
+               "1-D tensor independently.",
+               "row_splits"_a, "descending"_a = false);
+    tensor.def("segment_argsort", &Tensor::SegmentArgSort,
+               "Int64 indices that stably sort each segment [row_splits[s], "
+               "row_splits[s + 1]) of the 1-D tensor.",
+               "row_splits"_a, "descending"_a = false);
+    tensor.def(
+            "unique",
+            [](const Tensor& tensor, bool return_inverse,
+               bool return_counts) -> py::object {
+                if (!return_inverse && !return_counts) {
+                    return py::cast(tensor.Unique());
+                }
+                Tensor unique, inverse, counts;
+                std::tie(unique, inverse, counts) =
+                        tensor.UniqueWithInverseAndCounts();
+                py::list result;
+                result.append(unique);
+                if (return_inverse) result.append(inverse);
+                if (return_counts) result.append(counts);
+                return py::tuple(result);
+            },
+            "Sorted unique elements of the 1-D tensor. Optionally also "
+            "returns the index of each element into the unique elements and "
+            "the number of occurrences of each unique element.",
+            "return_inverse"_a = false, "return_counts"_a = false);
+    tensor.def("topk", &Tensor::TopK,
+               "The k largest (or smallest) elements of the 1-D tensor in "
+               "sorted order and their indices.",
+               "k"_a, "largest"_a = true);
+
     // Comparison.
     tensor.def(
             "allclose", &Tensor::AllClose, "other"_a, "rtol"_a = 1e-5,
@@ -947,6 +1116,10 @@ Returns:
                     return py::float_(tensor.Item<float>());
                 if (dtype == core::Float64)
                     return py::float_(tensor.Item<double>());
+                if (dtype == core::Float16)
+                    return py::float_(tensor.Item<float16_t>());
+                if (dtype == core::BFloat16)
+                    return py::float_(tensor.Item<bfloat16_t>());
                 if (dtype == core::Int8) return py::int_(tensor.Item<int8_t>());
                 if (dtype == core::Int16)
                     return py::int_(tensor.Item<int16_t>());
@@ -75,6 +75,18 @@ void pybind_meshbase(py::module &m) {
                    "adds a rotation smoothing term to the rotations.")
             .export_values();
 
+    py::enum_<MeshBase::DeformAsRigidAsPossibleSolver>(
+            m, "DeformAsRigidAsPossibleSolver")
+            .value("SparseLDLT",
+                   MeshBase::DeformAsRigidAsPossibleSolver::SparseLDLT,
+                   "factorizes the system matrix on the CPU with a sparse "
+                   "Cholesky (LDLT) decomposition.")
+            .value("ConjugateGradient",
+                   MeshBase::DeformAsRigidAsPossibleSolver::ConjugateGradient,
+                   "solves the system with Jacobi preconditioned conjugate "
+                   "gradient on the given device.")
+            .export_values();
+
     meshbase.def("__repr__",
                  [](const MeshBase &mesh) {
                      return std::string("MeshBase with ") +
@@ -29,6 +29,7 @@
 #include <sstream>
 #include <unordered_map>
 
+#include "open3d/geometry/LinearOctree.h"
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/geometry/VoxelGrid.h"
 #include "pybind/docstring.h"
@@ -361,6 +362,95 @@ void pybind_octree(py::module &m) {
     docstring::ClassMethodDocInject(
             m, "Octree", "create_from_voxel_grid",
             {{"voxel_grid", "geometry.VoxelGrid: The source voxel grid."}});
+
+    // LinearOctreeNode
+    py::class_<LinearOctreeNode> linear_octree_node(
+            m, "LinearOctreeNode",
+            "Handle of a node in a LinearOctree, given by its depth and its "
+            "index among the nodes of the same depth.");
+    linear_octree_node.def(py::init<>())
+            .def(py::init<size_t, int64_t>(), "depth"_a, "index"_a)
+            .def("__repr__",
+                 [](const LinearOctreeNode &node) {
+                     std::ostringstream repr;
+                     repr << "LinearOctreeNode with depth " << node.depth_
+                          << " and index " << node.index_;
+                     return repr.str();
+                 })
+            .def("is_valid", &LinearOctreeNode::IsValid,
+                 "Returns False if the handle does not refer to a node.")
+            .def_readwrite("depth", &LinearOctreeNode::depth_,
+                           "Depth of the node, the root has depth 0.")
+            .def_readwrite("index", &LinearOctreeNode::index_,
+                           "Index of the node among the nodes with the same "
+                           "depth.");
+
+    // LinearOctree
+    py::class_<LinearOctree> linear_octree(
+            m, "LinearOctree",
+            "Pointerless octree of a point cloud. The nodes are stored level "
+            "by level in flat arrays sorted by Morton code, and the tree is "
+            "built bottom-up in parallel. The tree has the same structure as "
+            "an Octree built with convert_from_point_cloud.");
+    py::detail::bind_copy_functions<LinearOctree>(linear_octree);
+    linear_octree
+            .def(py::init<size_t>(), "max_depth"_a = 0)
+            .def(py::init<size_t, const Eigen::Vector3d &, double>(),
+                 "max_depth"_a, "origin"_a, "size"_a)
+            .def("__repr__",
+                 [](const LinearOctree &octree) {
+                     std::ostringstream repr;
+                     repr << "LinearOctree with ";
+                     repr << "origin: [" << octree.origin_(0) << ", "
+                          << octree.origin_(1) << ", " << octree.origin_(2)
+                          << "]";
+                     repr << ", size: " << octree.size_;
+                     repr << ", max_depth: " << octree.max_depth_;
+                     repr << ", " << octree.GetNumNodes() << " nodes";
+                     return repr.str();
+                 })
+            .def("clear", &LinearOctree::Clear, "Removes all nodes.")
+            .def("is_empty", &LinearOctree::IsEmpty,
+                 "Returns True if the octree has no nodes.")
+            .def("get_num_nodes",
+                 py::overload_cast<>(&LinearOctree::GetNumNodes, py::const_),
+                 "Returns the number of nodes of all depths.")
+            .def("get_num_nodes",
+                 py::overload_cast<size_t>(&LinearOctree::GetNumNodes,
+                                           py::const_),
+                 "depth"_a, "Returns the number of nodes at the given depth.")
+            .def("convert_from_point_cloud",
+                 &LinearOctree::ConvertFromPointCloud,
+                 py::call_guard<py::gil_scoped_release>(), "point_cloud"_a,
+                 "size_expand"_a = 0.01, "Build the octree from point cloud.")
+            .def("traverse", &LinearOctree::Traverse, "f"_a,
+                 "DFS traversal of the octree from the root, with a "
+                 "callback function f(node, node_info) being called for each "
+                 "node.")
+            .def("locate_leaf_node", &LinearOctree::LocateLeafNode, "point"_a,
+                 "Returns the leaf LinearOctreeNode and OctreeNodeInfo where "
+                 "the query point should reside.")
+            .def("is_leaf_node", &LinearOctree::IsLeafNode, "node"_a,
+                 "Returns True if the node is a leaf node.")
+            .def("get_point_indices", &LinearOctree::GetPointIndices, "node"_a,
+                 "Returns the indices of the points in the subtree of the "
+                 "node.")
+            .def("get_color", &LinearOctree::GetColor, "node"_a,
+                 "Returns the color of a leaf node.")
+            .def("to_octree", &LinearOctree::ToOctree, "Convert to Octree.")
+            .def_readwrite("origin", &LinearOctree::origin_,
+                           "Global min bound (include). A point is within "
+                           "bound iff origin <= point < origin + size.")
+            .def_readwrite("size", &LinearOctree::size_,
+                           "Outer bounding box edge size for the whole "
+                           "octree.")
+            .def_readwrite("max_depth", &LinearOctree::max_depth_,
+                           "Maximum depth of the octree.");
+    docstring::ClassMethodDocInject(m, "LinearOctree",
+                                    "convert_from_point_cloud",
+                                    map_octree_argument_docstrings);
+    docstring::ClassMethodDocInject(m, "LinearOctree", "locate_leaf_node",
+                                    map_octree_argument_docstrings);
 }
 
 void pybind_octree_methods(py::module &m) {}
@@ -117,6 +117,7 @@ void pybind_trianglemesh(py::module &m) {
                  "close triangle soups.",
                  "eps"_a)
             .def("filter_sharpen", &TriangleMesh::FilterSharpen,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Function to sharpen triangle mesh. The output value "
                  "(:math:`v_o`) is the input value (:math:`v_i`) plus strength "
                  "times the input value minus he sum of he adjacent values. "
@@ -125,6 +126,7 @@ void pybind_trianglemesh(py::module &m) {
                  "number_of_iterations"_a = 1, "strength"_a = 1,
                  "filter_scope"_a = MeshBase::FilterScope::All)
             .def("filter_smooth_simple", &TriangleMesh::FilterSmoothSimple,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Function to smooth triangle mesh with simple neighbour "
                  "average. :math:`v_o = \\frac{v_i + \\sum_{n \\in N} "
                  "v_n)}{|N| + 1}`, with :math:`v_i` being the input value, "
@@ -134,6 +136,7 @@ void pybind_trianglemesh(py::module &m) {
                  "filter_scope"_a = MeshBase::FilterScope::All)
             .def("filter_smooth_laplacian",
                  &TriangleMesh::FilterSmoothLaplacian,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Function to smooth triangle mesh using Laplacian. :math:`v_o "
                  "= v_i \\cdot \\lambda (sum_{n \\in N} w_n v_n - v_i)`, with "
                  ":math:`v_i` being the input value, :math:`v_o` the output "
@@ -144,6 +147,7 @@ void pybind_trianglemesh(py::module &m) {
                  "number_of_iterations"_a = 1, "lambda_filter"_a = 0.5,
                  "filter_scope"_a = MeshBase::FilterScope::All)
             .def("filter_smooth_taubin", &TriangleMesh::FilterSmoothTaubin,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Function to smooth triangle mesh using method of Taubin, "
                  "\"Curve and Surface Smoothing Without Shrinkage\", 1995. "
                  "Applies in each iteration two times filter_smooth_laplacian, "
@@ -239,11 +243,13 @@ void pybind_trianglemesh(py::module &m) {
                  "condition that it is watertight and orientable.")
             .def("sample_points_uniformly",
                  &TriangleMesh::SamplePointsUniformly,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Function to uniformly sample points from the mesh.",
                  "number_of_points"_a = 100, "use_triangle_normal"_a = false,
                  "seed"_a = -1)
             .def("sample_points_poisson_disk",
                  &TriangleMesh::SamplePointsPoissonDisk,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Function to sample points from the mesh, where each point "
                  "has "
                  "approximately the same distance to the neighbouring points "
@@ -253,20 +259,24 @@ void pybind_trianglemesh(py::module &m) {
                  "number_of_points"_a, "init_factor"_a = 5, "pcl"_a = nullptr,
                  "use_triangle_normal"_a = false, "seed"_a = -1)
             .def("subdivide_midpoint", &TriangleMesh::SubdivideMidpoint,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Function subdivide mesh using midpoint algorithm.",
                  "number_of_iterations"_a = 1)
             .def("subdivide_loop", &TriangleMesh::SubdivideLoop,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Function subdivide mesh using Loop's algorithm. Loop, "
                  "\"Smooth "
                  "subdivision surfaces based on triangles\", 1987.",
                  "number_of_iterations"_a = 1)
             .def("simplify_vertex_clustering",
                  &TriangleMesh::SimplifyVertexClustering,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Function to simplify mesh using vertex clustering.",
                  "voxel_size"_a,
                  "contraction"_a = MeshBase::SimplificationContraction::Average)
             .def("simplify_quadric_decimation",
                  &TriangleMesh::SimplifyQuadricDecimation,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Function to simplify mesh using Quadric Error Metric "
                  "Decimation by "
                  "Garland and Heckbert",
@@ -274,9 +284,11 @@ void pybind_trianglemesh(py::module &m) {
                  "maximum_error"_a = std::numeric_limits<double>::infinity(),
                  "boundary_weight"_a = 1.0)
             .def("compute_convex_hull", &TriangleMesh::ComputeConvexHull,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Computes the convex hull of the triangle mesh.")
             .def("cluster_connected_triangles",
                  &TriangleMesh::ClusterConnectedTriangles,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Function that clusters connected triangles, i.e., triangles "
                  "that are connected via edges are assigned the same cluster "
                  "index.  This function returns an array that contains the "
@@ -308,19 +320,24 @@ void pybind_trianglemesh(py::module &m) {
                  "vertex_mask"_a)
             .def("deform_as_rigid_as_possible",
                  &TriangleMesh::DeformAsRigidAsPossible,
+                 py::call_guard<py::gil_scoped_release>(),
                  "This function deforms the mesh using the method by Sorkine "
                  "and Alexa, "
                  "'As-Rigid-As-Possible Surface Modeling', 2007",
                  "constraint_vertex_indices"_a, "constraint_vertex_positions"_a,
                  "max_iter"_a,
                  "energy"_a = MeshBase::DeformAsRigidAsPossibleEnergy::Spokes,
-                 "smoothed_alpha"_a = 0.01)
+                 "smoothed_alpha"_a = 0.01,
+                 "solver"_a =
+                         MeshBase::DeformAsRigidAsPossibleSolver::SparseLDLT,
+                 "device"_a = core::Device("CPU:0"))
             .def_static(
                     "create_from_point_cloud_alpha_shape",
                     [](const PointCloud &pcd, double alpha) {
                         return TriangleMesh::CreateFromPointCloudAlphaShape(
                                 pcd, alpha);
                     },
+                    py::call_guard<py::gil_scoped_release>(),
                     "Alpha shapes are a generalization of the convex hull. "
                     "With decreasing alpha value the shape schrinks and "
                     "creates cavities. See Edelsbrunner and Muecke, "
@@ -328,14 +345,28 @@ void pybind_trianglemesh(py::module &m) {
                     "pcd"_a, "alpha"_a)
             .def_static("create_from_point_cloud_alpha_shape",
                         &TriangleMesh::CreateFromPointCloudAlphaShape,
+                        py::call_guard<py::gil_scoped_release>(),
                         "Alpha shapes are a generalization of the convex hull. "
                         "With decreasing alpha value the shape shrinks and "
                         "creates cavities. See Edelsbrunner and Muecke, "
                         "\"Three-Dimensional Alpha Shapes\", 1994.",
                         "pcd"_a, "alpha"_a, "tetra_mesh"_a, "pt_map"_a)
+            .def_static(
+                    "create_from_point_cloud_alpha_shapes",
+                    [](const PointCloud &pcd,
+                       const std::vector<double> &alphas) {
+                        return TriangleMesh::CreateFromPointCloudAlphaShapes(
+                                pcd, alphas);
+                    },
+                    py::call_guard<py::gil_scoped_release>(),
+                    "Computes the alpha shapes for several alpha values. The "
+                    "Delaunay tetrahedralization is computed once and shared "
+                    "by all alpha values.",
+                    "pcd"_a, "alphas"_a)
             .def_static(
                     "create_from_point_cloud_ball_pivoting",
                     &TriangleMesh::CreateFromPointCloudBallPivoting,
+                    py::call_guard<py::gil_scoped_release>(),
                     "Function that computes a triangle mesh from a oriented "
                     "PointCloud. This implements the Ball Pivoting algorithm "
                     "proposed in F. Bernardini et al., \"The ball-pivoting "
@@ -349,6 +380,7 @@ void pybind_trianglemesh(py::module &m) {
                     "pcd"_a, "radii"_a)
             .def_static("create_from_point_cloud_poisson",
                         &TriangleMesh::CreateFromPointCloudPoisson,
+                        py::call_guard<py::gil_scoped_release>(),
                         "Function that computes a triangle mesh from a "
                         "oriented PointCloud pcd. This implements the Screened "
                         "Poisson Reconstruction proposed in Kazhdan and Hoppe, "
@@ -356,7 +388,10 @@ void pybind_trianglemesh(py::module &m) {
                         "This function uses the original implementation by "
                         "Kazhdan. See https://github.com/mkazhdan/PoissonRecon",
                         "pcd"_a, "depth"_a = 8, "width"_a = 0, "scale"_a = 1.1,
-                        "linear_fit"_a = false, "n_threads"_a = -1)
+                        "linear_fit"_a = false, "n_threads"_a = -1,
+                        "full_depth"_a = 5, "iterations"_a = 8,
+                        "samples_per_node"_a = 1.5f, "point_weight"_a = 2.0f,
+                        "cg_accuracy"_a = 1e-3f, "memory_budget_mb"_a = 0.0)
             .def_static("create_box", &TriangleMesh::CreateBox,
                         "Factory function to create a box. The left bottom "
                         "corner on the "
@@ -655,7 +690,12 @@ void pybind_trianglemesh(py::module &m) {
               "Energy model that is minimized in the deformation process"},
              {"smoothed_alpha",
               "trade-off parameter for the smoothed energy functional for the "
-              "regularization term."}});
+              "regularization term."},
+             {"solver",
+              "Solver of the linear system. The system is cached and reused "
+              "by calls with the same mesh, constraint vertices and solver."},
+             {"device",
+              "Device of the ConjugateGradient solver."}});
     docstring::ClassMethodDocInject(
             m, "TriangleMesh", "create_from_point_cloud_alpha_shape",
             {{"pcd",
@@ -700,7 +740,26 @@ void pybind_trianglemesh(py::module &m) {
               "estimate the positions of iso-vertices."},
              {"n_threads",
               "Number of threads used for reconstruction. Set to -1 to "
-              "automatically determine it."}});
+              "automatically determine it."},
+             {"full_depth",
+              "Depth up to which the octree is complete. Coarser levels are "
+              "solved on a dense grid."},
+             {"iterations",
+              "Number of Gauss-Seidel relaxations per level of the cascadic "
+              "multigrid solver."},
+             {"samples_per_node",
+              "Minimum number of points that fall into an octree node. Use "
+              "larger values for noisy data."},
+             {"point_weight",
+              "Importance of interpolating the points relative to the "
+              "gradient fit (screening weight)."},
+             {"cg_accuracy",
+              "Accuracy of the conjugate gradient solver on the coarsest "
+              "level."},
+             {"memory_budget_mb",
+              "If positive, the approximate peak memory in MB the "
+              "reconstruction may use. If solving at depth would exceed it, "
+              "the depth is reduced until it fits, with a warning."}});
     docstring::ClassMethodDocInject(
             m, "TriangleMesh", "create_box",
             {{"width", "x-directional length."},
@@ -24,11 +24,15 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <future>
+
+#include "open3d/io/rpc/AsyncConnection.h"
 #include "open3d/io/rpc/BufferConnection.h"
 #include "open3d/io/rpc/Connection.h"
 #include "open3d/io/rpc/DummyReceiver.h"
 #include "open3d/io/rpc/MessageUtils.h"
 #include "open3d/io/rpc/RemoteFunctions.h"
+#include "open3d/io/rpc/SharedMemory.h"
 #include "open3d/io/rpc/ZMQContext.h"
 #include "pybind/core/tensor_type_caster.h"
 #include "pybind/docstring.h"
@@ -60,7 +64,54 @@ The default connection class which uses a ZeroMQ socket.
                  }),
                  "Creates a connection object",
                  "address"_a = "tcp://127.0.0.1:51454",
-                 "connect_timeout"_a = 5000, "timeout"_a = 10000);
+                 "connect_timeout"_a = 5000, "timeout"_a = 10000)
+            .def("set_multipart_arrays", &rpc::Connection::SetMultipartArrays,
+                 "Sends arrays of mesh data with at least threshold bytes as "
+                 "separate frames of a multipart message without copying "
+                 "them. Set threshold to 0 to disable (default). The frames "
+                 "are compressed with LZF if compress is True.",
+                 "threshold"_a, "compress"_a = false);
+
+    py::class_<rpc::AsyncConnection, std::shared_ptr<rpc::AsyncConnection>,
+               rpc::ConnectionBase>(m, "AsyncConnection", R"doc(
+A connection which sends messages from a background thread. Up to
+max_in_flight messages are sent before waiting for replies and queued updates
+of the same path are replaced by newer updates. Use with the ``*_async``
+functions.
+)doc")
+            .def(py::init([](std::string address, int connect_timeout,
+                             int timeout, int max_in_flight) {
+                     return std::shared_ptr<rpc::AsyncConnection>(
+                             new rpc::AsyncConnection(address, connect_timeout,
+                                                      timeout, max_in_flight));
+                 }),
+                 "Creates a connection object",
+                 "address"_a = "tcp://127.0.0.1:51454",
+                 "connect_timeout"_a = 5000, "timeout"_a = 10000,
+                 "max_in_flight"_a = 4)
+            .def("flush", &rpc::AsyncConnection::Flush,
+                 py::call_guard<py::gil_scoped_release>(),
+                 "Blocks until all queued messages have been replied to.")
+            .def("set_multipart_arrays",
+                 &rpc::AsyncConnection::SetMultipartArrays,
+                 "See Connection.set_multipart_arrays.", "threshold"_a,
+                 "compress"_a = false);
+
+    py::class_<std::future<bool>>(m, "_Future",
+                                  "Result of an asynchronous function.")
+            .def(
+                    "result",
+                    [](std::future<bool>& self) { return self.get(); },
+                    py::call_guard<py::gil_scoped_release>(),
+                    "Waits for and returns the result. Can only be called "
+                    "once.")
+            .def(
+                    "done",
+                    [](const std::future<bool>& self) {
+                        return self.wait_for(std::chrono::seconds(0)) ==
+                               std::future_status::ready;
+                    },
+                    "Returns True if the result is available.");
 
     py::class_<rpc::BufferConnection, std::shared_ptr<rpc::BufferConnection>,
                rpc::ConnectionBase>(m, "BufferConnection", R"doc(
@@ -178,6 +229,31 @@ A connection writing to a memory buffer.
                      "the connection."},
             });
 
+    m.def("set_point_cloud_async", &rpc::SetPointCloudAsync, "pcd"_a,
+          "path"_a = "", "time"_a = 0, "layer"_a = "",
+          "connection"_a = std::shared_ptr<rpc::AsyncConnection>(),
+          "Queues a point cloud message for a viewer and returns a future "
+          "with the result.");
+
+    m.def("set_mesh_data_async", &rpc::SetMeshDataAsync, "path"_a = "",
+          "time"_a = 0, "layer"_a = "",
+          "vertices"_a = core::Tensor({0}, core::Float32),
+          "vertex_attributes"_a = std::map<std::string, core::Tensor>(),
+          "faces"_a = core::Tensor({0}, core::Int32),
+          "face_attributes"_a = std::map<std::string, core::Tensor>(),
+          "lines"_a = core::Tensor({0}, core::Int32),
+          "line_attributes"_a = std::map<std::string, core::Tensor>(),
+          "material"_a = "",
+          "material_scalar_attributes"_a = std::map<std::string, float>(),
+          "material_vector_attributes"_a =
+                  std::map<std::string, Eigen::Vector4f>(),
+          "texture_maps"_a = std::map<std::string, t::geometry::Image>(),
+          "o3d_type"_a = "",
+          "connection"_a = std::shared_ptr<rpc::AsyncConnection>(),
+          "Queues a set_mesh_data message and returns a future with the "
+          "result. Queued updates of the same path and layer are replaced. "
+          "See set_mesh_data for the arguments.");
+
     m.def("set_legacy_camera", &rpc::SetLegacyCamera, "camera"_a, "path"_a = "",
           "time"_a = 0, "layer"_a = "",
           "connection"_a = std::shared_ptr<rpc::ConnectionBase>(),
@@ -217,6 +293,26 @@ A connection writing to a memory buffer.
                      "the connection."},
             });
 
+    m.def(
+            "create_shared_tensor",
+            [](const core::SizeVector& shape, const core::Dtype& dtype,
+               const core::Device& device) {
+                return rpc::CreateSharedTensor(shape, dtype, device);
+            },
+            "shape"_a, "dtype"_a, "device"_a = core::Device("CPU:0"),
+            "Creates a tensor in shared memory. Geometry data in this tensor "
+            "is sent by reference with set_mesh_data() and the receiving "
+            "process maps it without copies. CPU tensors use POSIX shared "
+            "memory and CUDA tensors use CUDA IPC. Keep the tensor alive "
+            "until the receivers have mapped it.");
+    docstring::FunctionDocInject(
+            m, "create_shared_tensor",
+            {
+                    {"shape", "The shape of the tensor."},
+                    {"dtype", "The data type of the tensor."},
+                    {"device", "The device of the tensor."},
+            });
+
     m.def("data_buffer_to_meta_geometry", &rpc::DataBufferToMetaGeometry,
           "data"_a, R"doc(
 This function returns the geometry, the path and the time stored in a
@@ -102,10 +102,11 @@ void pybind_sensor(py::module &m) {
 
     azure_kinect_recorder.def(
             py::init([](const AzureKinectSensorConfig &sensor_config,
-                        size_t sensor_index) {
-                return new AzureKinectRecorder(sensor_config, sensor_index);
+                        size_t sensor_index, size_t write_queue_size) {
+                return new AzureKinectRecorder(sensor_config, sensor_index,
+                                               write_queue_size);
             }),
-            "sensor_config"_a, "sensor_index"_a);
+            "sensor_config"_a, "sensor_index"_a, "write_queue_size"_a = 30);
     azure_kinect_recorder
             .def("init_sensor", &AzureKinectRecorder::InitSensor,
                  "Initialize sensor.")
@@ -118,7 +119,11 @@ void pybind_sensor(py::module &m) {
             .def("record_frame", &AzureKinectRecorder::RecordFrame,
                  "enable_record"_a, "enable_align_depth_to_color"_a,
                  "Record a frame to mkv if flag is on and return an RGBD "
-                 "object.");
+                 "object.")
+            .def("get_num_dropped_frames",
+                 &AzureKinectRecorder::GetNumDroppedFrames,
+                 "The number of frames not recorded because the write queue "
+                 "was full.");
     docstring::ClassMethodDocInject(m, "AzureKinectRecorder", "init_sensor",
                                     map_shared_argument_docstrings);
     docstring::ClassMethodDocInject(m, "AzureKinectRecorder",
@@ -134,7 +139,10 @@ void pybind_sensor(py::module &m) {
     // Class mkv reader
     py::class_<MKVReader> azure_kinect_mkv_reader(
             m, "AzureKinectMKVReader", "AzureKinect mkv file reader.");
-    azure_kinect_mkv_reader.def(py::init([]() { return MKVReader(); }));
+    azure_kinect_mkv_reader.def(py::init<>())
+            .def(py::init<size_t>(), "prefetch_size"_a,
+                 "Read and decode up to prefetch_size frames ahead in a "
+                 "background thread.");
     azure_kinect_mkv_reader
             .def("is_opened", &MKVReader::IsOpened,
                  "Check if the mkv file  is opened.")
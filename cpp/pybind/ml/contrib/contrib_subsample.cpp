@@ -362,6 +362,37 @@ const py::object Subsample(py::array points,
     }
 }
 
+#ifdef BUILD_CUDA_MODULE
+const py::tuple SubsampleBatchCUDA(const core::Tensor& points,
+                                   const core::Tensor& row_splits,
+                                   utility::optional<core::Tensor> features,
+                                   utility::optional<core::Tensor> classes,
+                                   float sampleDl,
+                                   int max_p) {
+    core::Tensor subsampled_points, subsampled_row_splits,
+            subsampled_features, subsampled_classes;
+    BatchGridSubsamplingCUDA(
+            points, row_splits,
+            features.has_value() ? features.value() : core::Tensor(),
+            classes.has_value() ? classes.value() : core::Tensor(), sampleDl,
+            max_p, subsampled_points, subsampled_row_splits,
+            subsampled_features, subsampled_classes);
+
+    if (features.has_value() && classes.has_value()) {
+        return py::make_tuple(subsampled_points, subsampled_row_splits,
+                              subsampled_features, subsampled_classes);
+    } else if (features.has_value()) {
+        return py::make_tuple(subsampled_points, subsampled_row_splits,
+                              subsampled_features);
+    } else if (classes.has_value()) {
+        return py::make_tuple(subsampled_points, subsampled_row_splits,
+                              subsampled_classes);
+    } else {
+        return py::make_tuple(subsampled_points, subsampled_row_splits);
+    }
+}
+#endif
+
 void pybind_contrib_subsample(py::module& m_contrib) {
     m_contrib.def("subsample", &Subsample, "points"_a,
                   "features"_a = py::none(), "classes"_a = py::none(),
@@ -371,6 +402,15 @@ void pybind_contrib_subsample(py::module& m_contrib) {
                   "features"_a = py::none(), "classes"_a = py::none(),
                   "sampleDl"_a = 0.1, "method"_a = "barycenters", "max_p"_a = 0,
                   "verbose"_a = 0);
+
+#ifdef BUILD_CUDA_MODULE
+    // Unlike subsample_batch, this takes and returns Tensors on the CUDA
+    // device and uses row splits instead of batch lengths.
+    m_contrib.def("subsample_batch_cuda", &SubsampleBatchCUDA, "points"_a,
+                  "row_splits"_a, "features"_a = py::none(),
+                  "classes"_a = py::none(), "sampleDl"_a = 0.1,
+                  "max_p"_a = 0);
+#endif
 }
 
 }  // namespace contrib
@@ -30,6 +30,7 @@
 #include "open3d/pipelines/integration/ScalableTSDFVolume.h"
 #include "open3d/pipelines/integration/TSDFVolume.h"
 #include "open3d/pipelines/integration/UniformTSDFVolume.h"
+#include "open3d/pipelines/integration/VoxelBlockGridTSDFVolume.h"
 #include "pybind/docstring.h"
 
 namespace open3d {
@@ -88,11 +89,14 @@ In SIGGRAPH, 1996)");
             .def("reset", &TSDFVolume::Reset,
                  "Function to reset the TSDFVolume")
             .def("integrate", &TSDFVolume::Integrate,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Function to integrate an RGB-D image into the volume",
                  "image"_a, "intrinsic"_a, "extrinsic"_a)
             .def("extract_point_cloud", &TSDFVolume::ExtractPointCloud,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Function to extract a point cloud with normals")
             .def("extract_triangle_mesh", &TSDFVolume::ExtractTriangleMesh,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Function to extract a triangle mesh")
             .def_readwrite("voxel_length", &TSDFVolume::voxel_length_,
                            "float: Length of the voxel in meters.")
@@ -214,6 +218,36 @@ In SIGGRAPH, 2013)");
                  "cloud.");
     docstring::ClassMethodDocInject(m, "ScalableTSDFVolume",
                                     "extract_voxel_point_cloud");
+
+    // open3d.integration.VoxelBlockGridTSDFVolume:
+    // open3d.integration.TSDFVolume
+    py::class_<VoxelBlockGridTSDFVolume,
+               PyTSDFVolume<VoxelBlockGridTSDFVolume>, TSDFVolume>
+            voxel_block_grid_tsdfvolume(m, "VoxelBlockGridTSDFVolume", R"(The
+VoxelBlockGridTSDFVolume is a drop-in replacement for ScalableTSDFVolume backed
+by open3d.t.geometry.VoxelBlockGrid. The voxel blocks are stored on the given
+device, so that integration and extraction run on the GPU with a CUDA device,
+while the legacy RGB-D images and geometries are kept in the interface.)");
+    voxel_block_grid_tsdfvolume
+            .def(py::init<double, double, TSDFVolumeColorType,
+                          const core::Device &, int, int, double>(),
+                 "voxel_length"_a, "sdf_trunc"_a, "color_type"_a,
+                 "device"_a = VoxelBlockGridTSDFVolume::GetDefaultDevice(),
+                 "block_resolution"_a = 16, "block_count"_a = 10000,
+                 "depth_max"_a = 1000.0)
+            .def("__repr__",
+                 [](const VoxelBlockGridTSDFVolume &vol) {
+                     return fmt::format(
+                             "VoxelBlockGridTSDFVolume on {} {}",
+                             vol.device_.ToString(),
+                             vol.color_type_ == TSDFVolumeColorType::NoColor
+                                     ? "without color."
+                                     : "with color.");
+                 })
+            .def_readwrite("weight_threshold",
+                           &VoxelBlockGridTSDFVolume::weight_threshold_,
+                           "Voxels with a weight at or below this threshold "
+                           "are not extracted.");
 }
 
 void pybind_integration_methods(py::module &m) {
@@ -201,6 +201,34 @@ void pybind_odometry_methods(py::module &m) {
                      ").``"},
                     {"option", "Odometry hyper parameters."},
             });
+    m.def("compute_rgbd_odometry_for_pairs", &ComputeRGBDOdometryForPairs,
+          py::call_guard<py::gil_scoped_release>(),
+          "Function to estimate 6D rigid motions for many pairs of RGBD "
+          "frames, sharing the image pyramids of each frame between pairs. "
+          "Output: (list of is_success, 4x4 motion matrices, 6x6 "
+          "information matrices).",
+          "images"_a, "pairs"_a,
+          "odo_inits"_a = temp_eigen_matrix4d(),
+          "pinhole_camera_intrinsic"_a = camera::PinholeCameraIntrinsic(),
+          "jacobian"_a = RGBDOdometryJacobianFromHybridTerm(),
+          "option"_a = OdometryOption());
+    docstring::FunctionDocInject(
+            m, "compute_rgbd_odometry_for_pairs",
+            {
+                    {"images", "RGBD images of the frames."},
+                    {"pairs", "(source, target) indices into ``images``."},
+                    {"odo_inits",
+                     "Initial 4x4 motion matrix estimation for each pair. "
+                     "Identity is used if empty."},
+                    {"pinhole_camera_intrinsic", "Camera intrinsic parameters"},
+                    {"jacobian",
+                     "The odometry Jacobian method to use. Can be "
+                     "``"
+                     "RGBDOdometryJacobianFromHybridTerm()`` or "
+                     "``RGBDOdometryJacobianFromColorTerm("
+                     ").``"},
+                    {"option", "Odometry hyper parameters."},
+            });
 }
 
 void pybind_odometry(py::module &m) {
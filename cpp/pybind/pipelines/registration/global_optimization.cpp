@@ -343,6 +343,25 @@ void pybind_global_optimization_methods(py::module &m) {
               ")``."},
              {"criteria", "Global optimization convergence criteria."},
              {"option", "Global optimization option."}});
+
+    m.def("incremental_global_optimization", &IncrementalGlobalOptimization,
+          "Function to optimize PoseGraph incrementally after new edges are "
+          "appended. Only the nodes within window_size hops of the new edges "
+          "are re-optimized.",
+          "pose_graph"_a, "first_new_edge"_a, "window_size"_a = 10,
+          "criteria"_a = GlobalOptimizationConvergenceCriteria(),
+          "option"_a = GlobalOptimizationOption());
+    docstring::FunctionDocInject(
+            m, "incremental_global_optimization",
+            {{"pose_graph", "The pose_graph to be optimized (in-place)."},
+             {"first_new_edge",
+              "Index of the first edge appended since the last "
+              "optimization."},
+             {"window_size",
+              "Number of hops from the new edges within which the nodes are "
+              "re-optimized."},
+             {"criteria", "Global optimization convergence criteria."},
+             {"option", "Global optimization option."}});
 }
 
 }  // namespace registration
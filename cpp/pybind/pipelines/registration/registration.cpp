@@ -137,11 +137,13 @@ void pybind_registration_classes(py::module &m) {
             "to avoid early termination.");
     py::detail::bind_copy_functions<RANSACConvergenceCriteria>(ransac_criteria);
     ransac_criteria
-            .def(py::init([](int max_iteration, double confidence) {
-                     return new RANSACConvergenceCriteria(max_iteration,
-                                                          confidence);
+            .def(py::init([](int max_iteration, double confidence,
+                             int batch_size) {
+                     return new RANSACConvergenceCriteria(
+                             max_iteration, confidence, batch_size);
                  }),
-                 "max_iteration"_a = 100000, "confidence"_a = 0.999)
+                 "max_iteration"_a = 100000, "confidence"_a = 0.999,
+                 "batch_size"_a = 0)
             .def_readwrite("max_iteration",
                            &RANSACConvergenceCriteria::max_iteration_,
                            "Maximum iteration before iteration stops.")
@@ -149,12 +151,17 @@ void pybind_registration_classes(py::module &m) {
                     "confidence", &RANSACConvergenceCriteria::confidence_,
                     "Desired probability of success. Used for estimating early "
                     "termination. Use 1.0 to avoid early termination.")
+            .def_readwrite("batch_size",
+                           &RANSACConvergenceCriteria::batch_size_,
+                           "Number of hypotheses generated and scored "
+                           "together. Use 0 to disable batching.")
             .def("__repr__", [](const RANSACConvergenceCriteria &c) {
                 return fmt::format(
                         "RANSACConvergenceCriteria "
                         "class with max_iteration={:d}, "
-                        "and confidence={:e}",
-                        c.max_iteration_, c.confidence_);
+                        "confidence={:e}, "
+                        "and batch_size={:d}",
+                        c.max_iteration_, c.confidence_, c.batch_size_);
             });
 
     // open3d.registration.TransformationEstimation
@@ -593,6 +600,10 @@ static const std::unordered_map<std::string, std::string>
                  "``TransformationEstimationPointToPlane``, "
                  "``TransformationEstimationForGeneralizedICP``, "
                  "``TransformationEstimationForColoredICP``)"},
+                {"feature_search_eps",
+                 "Approximation error of the nearest neighbor search in "
+                 "feature space. 0 is exact; larger values trade "
+                 "correspondence recall for speed."},
                 {"init", "Initial transformation estimation"},
                 {"lambda_geometric", "lambda_geometric value"},
                 {"epsilon", "epsilon value"},
@@ -643,6 +654,7 @@ void pybind_registration_methods(py::module &m) {
                                  map_shared_argument_docstrings);
 
     m.def("registration_generalized_icp", &RegistrationGeneralizedICP,
+          py::call_guard<py::gil_scoped_release>(),
           "Function for Generalized ICP registration", "source"_a, "target"_a,
           "max_correspondence_distance"_a,
           "init"_a = Eigen::Matrix4d::Identity(),
@@ -679,7 +691,7 @@ void pybind_registration_methods(py::module &m) {
           "checkers"_a = std::vector<
                   std::reference_wrapper<const CorrespondenceChecker>>(),
           "criteria"_a = RANSACConvergenceCriteria(100000, 0.999),
-          "seed"_a = py::none());
+          "seed"_a = py::none(), "feature_search_eps"_a = 0.0);
     docstring::FunctionDocInject(
             m, "registration_ransac_based_on_feature_matching",
             map_shared_argument_docstrings);
@@ -71,6 +71,8 @@ core::Dtype ArrayFormatToDtype(const std::string& format, size_t byte_size) {
         return core::UInt64;
     if (format == py::format_descriptor<bool>::format() && byte_size == 1)
         return core::Bool;
+    // numpy.float16 uses the half precision format character "e".
+    if (format == "e" && byte_size == 2) return core::Float16;
     utility::LogError(
             "ArrayFormatToDtype: unsupported python array format {} with "
             "byte_size {}.",
@@ -90,6 +92,7 @@ std::string DtypeToArrayFormat(const core::Dtype& dtype) {
     if (dtype == core::UInt32) return py::format_descriptor<uint32_t>::format();
     if (dtype == core::UInt64) return py::format_descriptor<uint64_t>::format();
     if (dtype == core::Bool) return py::format_descriptor<bool>::format();
+    if (dtype == core::Float16) return "e";
     utility::LogError("Unsupported data type.");
     return std::string();
 }
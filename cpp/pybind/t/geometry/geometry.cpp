@@ -54,10 +54,13 @@ void pybind_geometry(py::module& m) {
     pybind_drawable_geometry_class(m_submodule);
     pybind_tensormap(m_submodule);
     pybind_pointcloud(m_submodule);
+    pybind_pointcloud_batch(m_submodule);
     pybind_lineset(m_submodule);
     pybind_trianglemesh(m_submodule);
     pybind_image(m_submodule);
     pybind_voxel_block_grid(m_submodule);
+    pybind_voxel_grid(m_submodule);
+    pybind_keypoint(m_submodule);
     pybind_raycasting_scene(m_submodule);
 }
 
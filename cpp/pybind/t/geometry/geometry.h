@@ -54,10 +54,13 @@ void pybind_drawable_geometry_class(py::module& m);
 void pybind_tensormap(py::module& m);
 void pybind_image(py::module& m);
 void pybind_pointcloud(py::module& m);
+void pybind_pointcloud_batch(py::module& m);
 void pybind_lineset(py::module& m);
 void pybind_trianglemesh(py::module& m);
 void pybind_image(py::module& m);
 void pybind_voxel_block_grid(py::module& m);
+void pybind_voxel_grid(py::module& m);
+void pybind_keypoint(py::module& m);
 void pybind_raycasting_scene(py::module& m);
 
 }  // namespace geometry
@@ -137,23 +137,28 @@ void pybind_image(py::module &m) {
             .def("get_max_bound", &Image::GetMaxBound,
                  "Compute max 2D coordinates for the data ({rows, cols}).")
             .def("linear_transform", &Image::LinearTransform,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Function to linearly transform pixel intensities in place: "
                  "image = scale * image + offset.",
                  "scale"_a = 1.0, "offset"_a = 0.0)
             .def("dilate", &Image::Dilate,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Return a new image after performing morphological dilation. "
                  "Supported datatypes are UInt8, UInt16 and Float32 with "
                  "{1, 3, 4} channels. An 8-connected neighborhood is used to "
                  "create the dilation mask.",
                  "kernel_size"_a = 3)
             .def("filter", &Image::Filter,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Return a new image after filtering with the given kernel.",
                  "kernel"_a)
             .def("filter_gaussian", &Image::FilterGaussian,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Return a new image after Gaussian filtering. "
                  "Possible kernel_size: odd numbers >= 3 are supported.",
                  "kernel_size"_a = 3, "sigma"_a = 1.0)
             .def("filter_bilateral", &Image::FilterBilateral,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Return a new image after bilateral filtering."
                  "Note: CPU (IPP) and CUDA (NPP) versions are inconsistent: "
                  "CPU uses a round kernel (radius = floor(kernel_size / 2)), "
@@ -162,10 +167,26 @@ void pybind_image(py::module &m) {
                  "kernel_size"_a = 3, "value_sigma"_a = 20.0,
                  "dist_sigma"_a = 10.0)
             .def("filter_sobel", &Image::FilterSobel,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Return a pair of new gradient images (dx, dy) after Sobel "
                  "filtering. Possible kernel_size: 3 and 5.",
                  "kernel_size"_a = 3)
+            .def("remap", &Image::Remap,
+                 py::call_guard<py::gil_scoped_release>(),
+                 "Return a new image sampled from this image at (map_x, "
+                 "map_y) column and row coordinates. Samples outside of the "
+                 "image read fill.",
+                 "map_x"_a, "map_y"_a,
+                 "interp_type"_a = Image::InterpType::Linear, "fill"_a = 0.0f)
+            .def("undistort", &Image::Undistort,
+                 py::call_guard<py::gil_scoped_release>(),
+                 "Return a new image with lens distortion removed, using "
+                 "distortion coefficients (k1, k2, p1, p2[, k3]). Lookup "
+                 "tables are cached per camera.",
+                 "intrinsics"_a, "distortion"_a,
+                 "interp_type"_a = Image::InterpType::Linear)
             .def("resize", &Image::Resize,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Return a new image after resizing with specified "
                  "interpolation type. Downsample if sampling rate is < 1. "
                  "Upsample if sampling rate > 1. Aspect ratio is always "
@@ -173,10 +194,12 @@ void pybind_image(py::module &m) {
                  "sampling_rate"_a = 0.5,
                  "interp_type"_a = Image::InterpType::Nearest)
             .def("pyrdown", &Image::PyrDown,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Return a new downsampled image with pyramid downsampling "
                  "formed by a chained Gaussian filter (kernel_size = 5, sigma"
                  " = 1.0) and a resize (ratio = 0.5) operation.")
             .def("rgb_to_gray", &Image::RGBToGray,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Converts a 3-channel RGB image to a new 1-channel Grayscale "
                  "image by I = 0.299 * R + 0.587 * G + 0.114 * B.")
             .def("__repr__", &Image::ToString);
@@ -185,6 +208,7 @@ void pybind_image(py::module &m) {
 
     // Depth utilities.
     image.def("clip_transform", &Image::ClipTransform,
+              py::call_guard<py::gil_scoped_release>(),
               "Preprocess a image of shape (rows, cols, channels=1), typically"
               " used for a depth image. UInt16 and Float32 Dtypes supported. "
               "Each pixel will be transformed by\n"
@@ -194,12 +218,14 @@ void pybind_image(py::module &m) {
               "Use INF, NAN or 0.0 (default) for clip_fill",
               "scale"_a, "min_value"_a, "max_value"_a, "clip_fill"_a = 0.0f);
     image.def("create_vertex_map", &Image::CreateVertexMap,
+              py::call_guard<py::gil_scoped_release>(),
               "Create a vertex map of shape (rows, cols, channels=3) in Float32"
               " from an image of shape (rows, cols, channels=1) in Float32 "
               "using unprojection. The input depth is expected to be the output"
               " of clip_transform.",
               "intrinsics"_a, "invalid_fill"_a = 0.0f);
     image.def("create_normal_map", &Image::CreateNormalMap,
+              py::call_guard<py::gil_scoped_release>(),
               "Create a normal map of shape (rows, cols, channels=3) in Float32"
               " from a vertex map of shape (rows, cols, channels=1) in Float32 "
               "using cross product of V(r, c+1)-V(r, c) and V(r+1, c)-V(r, c)"
@@ -209,25 +235,51 @@ void pybind_image(py::module &m) {
               "invalid_fill"_a = 0.0f);
     image.def(
             "colorize_depth", &Image::ColorizeDepth,
+            py::call_guard<py::gil_scoped_release>(),
             "Colorize an input depth image (with Dtype UInt16 or Float32). The"
             " image values are divided by scale, then clamped within "
             "(min_value, max_value) and finally converted to a 3 channel UInt8"
             " RGB image using the Turbo colormap as a lookup table.",
             "scale"_a, "min_value"_a, "max_value"_a);
 
+    // Batched versions on (batch, rows, cols, channels) tensor stacks.
+    image.def_static("pyrdown_batch", &Image::PyrDownBatch,
+                     py::call_guard<py::gil_scoped_release>(),
+                     "Batched pyrdown on a (batch, rows, cols, channels) "
+                     "tensor stack, in a single kernel launch.",
+                     "images"_a);
+    image.def_static("pyrdown_depth_batch", &Image::PyrDownDepthBatch,
+                     py::call_guard<py::gil_scoped_release>(),
+                     "Batched pyrdown_depth on a (batch, rows, cols, 1) "
+                     "Float32 tensor stack, in a single kernel launch.",
+                     "depths"_a, "diff_threshold"_a, "invalid_fill"_a = 0.0f);
+    image.def_static("create_vertex_map_batch", &Image::CreateVertexMapBatch,
+                     py::call_guard<py::gil_scoped_release>(),
+                     "Batched create_vertex_map on a (batch, rows, cols, 1) "
+                     "Float32 tensor stack. intrinsics is (3, 3), shared by "
+                     "all images, or (batch, 3, 3).",
+                     "depths"_a, "intrinsics"_a, "invalid_fill"_a = 0.0f);
+    image.def_static("create_normal_map_batch", &Image::CreateNormalMapBatch,
+                     py::call_guard<py::gil_scoped_release>(),
+                     "Batched create_normal_map on a (batch, rows, cols, 3) "
+                     "Float32 tensor stack of vertex maps.",
+                     "vertex_maps"_a, "invalid_fill"_a = 0.0f);
+
     // Device transfers.
     image.def("to",
               py::overload_cast<const core::Device &, bool>(&Image::To,
                                                             py::const_),
+              py::call_guard<py::gil_scoped_release>(),
               "Transfer the Image to a specified device.  A new image is "
               "always created if copy is true, else it is avoided when the "
               "original image is already on the target device.",
               "device"_a, "copy"_a = false);
-    image.def("clone", &Image::Clone,
+    image.def("clone", &Image::Clone, py::call_guard<py::gil_scoped_release>(),
               "Returns a copy of the Image on the same device.");
     image.def(
             "cpu",
             [](const Image &image) { return image.To(core::Device("CPU:0")); },
+            py::call_guard<py::gil_scoped_release>(),
             "Transfer the image to CPU. If the image "
             "is already on CPU, no copy will be performed.");
     image.def(
@@ -235,6 +287,7 @@ void pybind_image(py::module &m) {
             [](const Image &image, int device_id) {
                 return image.To(core::Device("CUDA", device_id));
             },
+            py::call_guard<py::gil_scoped_release>(),
             "Transfer the image to a CUDA device. If the image is already "
             "on the specified CUDA device, no copy will be performed.",
             "device_id"_a = 0);
@@ -243,6 +296,7 @@ void pybind_image(py::module &m) {
     image.def("to",
               py::overload_cast<core::Dtype, bool, utility::optional<double>,
                                 double>(&Image::To, py::const_),
+              py::call_guard<py::gil_scoped_release>(),
               "Returns an Image with the specified Dtype.", "dtype"_a,
               "scale"_a = py::none(), "offset"_a = 0.0, "copy"_a = false);
     docstring::ClassMethodDocInject(
@@ -256,8 +310,11 @@ void pybind_image(py::module &m) {
               "If true, a new tensor is always created; if false, the copy is "
               "avoided when the original tensor already has the targeted "
               "dtype."}});
-    image.def("to_legacy", &Image::ToLegacy, "Convert to legacy Image type.");
-    image.def_static("from_legacy", &Image::FromLegacy, "image_legacy"_a,
+    image.def("to_legacy", &Image::ToLegacy,
+              py::call_guard<py::gil_scoped_release>(),
+              "Convert to legacy Image type.");
+    image.def_static("from_legacy", &Image::FromLegacy,
+                     py::call_guard<py::gil_scoped_release>(), "image_legacy"_a,
                      "device"_a = core::Device("CPU:0"),
                      "Create a Image from a legacy Open3D Image.");
     image.def("as_tensor", &Image::AsTensor);
@@ -302,15 +359,18 @@ void pybind_image(py::module &m) {
             .def("to",
                  py::overload_cast<const core::Device &, bool>(&RGBDImage::To,
                                                                py::const_),
+                 py::call_guard<py::gil_scoped_release>(),
                  "Transfer the RGBDImage to a specified device.", "device"_a,
                  "copy"_a = false)
             .def("clone", &RGBDImage::Clone,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Returns a copy of the RGBDImage on the same device.")
             .def(
                     "cpu",
                     [](const RGBDImage &rgbd_image) {
                         return rgbd_image.To(core::Device("CPU:0"));
                     },
+                    py::call_guard<py::gil_scoped_release>(),
                     "Transfer the RGBD image to CPU. If the RGBD image "
                     "is already on CPU, no copy will be performed.")
             .def(
@@ -318,6 +378,7 @@ void pybind_image(py::module &m) {
                     [](const RGBDImage &rgbd_image, int device_id) {
                         return rgbd_image.To(core::Device("CUDA", device_id));
                     },
+                    py::call_guard<py::gil_scoped_release>(),
                     "Transfer the RGBD image to a CUDA device. If the RGBD "
                     "image is already "
                     "on the specified CUDA device, no copy will be performed.",
@@ -325,6 +386,7 @@ void pybind_image(py::module &m) {
 
             // Conversion.
             .def("to_legacy", &RGBDImage::ToLegacy,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Convert to legacy RGBDImage type.")
             // Description.
             .def("__repr__", &RGBDImage::ToString);
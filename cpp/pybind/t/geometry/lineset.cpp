@@ -29,6 +29,7 @@
 #include <string>
 #include <unordered_map>
 
+#include "open3d/t/geometry/PointCloud.h"
 #include "pybind/docstring.h"
 #include "pybind/t/geometry/geometry.h"
 
@@ -215,6 +216,48 @@ transformation as :math:`P = R(P) + t`)");
             });
     line_set.def("to_legacy", &LineSet::ToLegacy,
                  "Convert to a legacy Open3D LineSet.");
+
+    line_set.def_static(
+            "create_from_point_cloud_correspondences",
+            &LineSet::CreateFromPointCloudCorrespondences, "source"_a,
+            "target"_a, "correspondences"_a,
+            "Create a LineSet joining corresponding points of two point "
+            "clouds. Only the referenced points are copied: line i joins "
+            "point i from the source to point i + N from the target.");
+    docstring::ClassMethodDocInject(
+            m, "LineSet", "create_from_point_cloud_correspondences",
+            {{"source", "The source point cloud."},
+             {"target", "The target point cloud."},
+             {"correspondences",
+              "Int64 tensor of shape (N, 2) with (source, target) index "
+              "pairs, or of shape (S,) or (S, 1) with the target index of "
+              "each source point and -1 for none, as in "
+              "RegistrationResult.correspondences_."}});
+    line_set.def_static(
+            "create_from_oriented_bounding_boxes",
+            &LineSet::CreateFromOrientedBoundingBoxes, "centers"_a,
+            "extents"_a, "rotations"_a, "colors"_a = core::Tensor(),
+            "Create a LineSet with the 12 edges of each of N oriented boxes.");
+    docstring::ClassMethodDocInject(
+            m, "LineSet", "create_from_oriented_bounding_boxes",
+            {{"centers", "Box centers of shape (N, 3), Float32 or Float64."},
+             {"extents", "Box side lengths of shape (N, 3)."},
+             {"rotations",
+              "Rotations of shape (N, 3, 3), whose columns are the box "
+              "axes."},
+             {"colors", "Optional box colors of shape (N, 3)."}});
+    line_set.def_static(
+            "create_from_axis_aligned_bounding_boxes",
+            &LineSet::CreateFromAxisAlignedBoundingBoxes, "min_bounds"_a,
+            "max_bounds"_a, "colors"_a = core::Tensor(),
+            "Create a LineSet with the 12 edges of each of N axis-aligned "
+            "boxes.");
+    docstring::ClassMethodDocInject(
+            m, "LineSet", "create_from_axis_aligned_bounding_boxes",
+            {{"min_bounds",
+              "Minimum bounds of shape (N, 3), Float32 or Float64."},
+             {"max_bounds", "Maximum bounds of shape (N, 3)."},
+             {"colors", "Optional box colors of shape (N, 3)."}});
 }
 
 }  // namespace geometry
@@ -31,6 +31,7 @@
 
 #include "open3d/core/CUDAUtils.h"
 #include "open3d/core/hashmap/HashMap.h"
+#include "open3d/t/geometry/TriangleMesh.h"
 #include "pybind/docstring.h"
 #include "pybind/t/geometry/geometry.h"
 
@@ -134,9 +135,11 @@ The attributes of the point cloud have different levels::
 
     // Device transfers.
     pointcloud.def("to", &PointCloud::To,
+                   py::call_guard<py::gil_scoped_release>(),
                    "Transfer the point cloud to a specified device.",
                    "device"_a, "copy"_a = false);
     pointcloud.def("clone", &PointCloud::Clone,
+                   py::call_guard<py::gil_scoped_release>(),
                    "Returns a copy of the point cloud on the same device.");
 
     pointcloud.def(
@@ -144,6 +147,7 @@ The attributes of the point cloud have different levels::
             [](const PointCloud& pointcloud) {
                 return pointcloud.To(core::Device("CPU:0"));
             },
+            py::call_guard<py::gil_scoped_release>(),
             "Transfer the point cloud to CPU. If the point cloud is "
             "already on CPU, no copy will be performed.");
     pointcloud.def(
@@ -151,6 +155,7 @@ The attributes of the point cloud have different levels::
             [](const PointCloud& pointcloud, int device_id) {
                 return pointcloud.To(core::Device("CUDA", device_id));
             },
+            py::call_guard<py::gil_scoped_release>(),
             "Transfer the point cloud to a CUDA device. If the point cloud is "
             "already on the specified CUDA device, no copy will be performed.",
             "device_id"_a = 0);
@@ -162,41 +167,160 @@ The attributes of the point cloud have different levels::
                    "Returns the max bound for point coordinates.");
     pointcloud.def("get_center", &PointCloud::GetCenter,
                    "Returns the center for point coordinates.");
+    pointcloud.def("get_cluster_axis_aligned_bounding_boxes",
+                   &PointCloud::GetClusterAxisAlignedBoundingBoxes,
+                   py::call_guard<py::gil_scoped_release>(), "labels"_a,
+                   R"(
+Computes the axis aligned bounding box of every cluster in one pass on the
+device of the point cloud.
+
+Args:
+    labels (open3d.core.Tensor): Int32 or Int64 cluster label of each point,
+        e.g. from cluster_dbscan. Points with negative labels are ignored.
+
+Returns:
+    Tuple of the min bounds and max bounds of shape (C, 3), where C is the
+    largest label + 1. Clusters without points have zero bounds.
+)");
+    pointcloud.def("get_cluster_oriented_bounding_boxes",
+                   &PointCloud::GetClusterOrientedBoundingBoxes,
+                   py::call_guard<py::gil_scoped_release>(), "labels"_a,
+                   R"(
+Computes the oriented bounding box of every cluster in one pass on the device
+of the point cloud. The axes of a box are the principal axes of the points of
+its cluster.
+
+Args:
+    labels (open3d.core.Tensor): Int32 or Int64 cluster label of each point,
+        e.g. from cluster_dbscan. Points with negative labels are ignored.
 
-    pointcloud.def("append",
-                   [](const PointCloud& self, const PointCloud& other) {
-                       return self.Append(other);
-                   });
-    pointcloud.def("__add__",
-                   [](const PointCloud& self, const PointCloud& other) {
-                       return self.Append(other);
-                   });
+Returns:
+    Tuple of the centers (C, 3), rotations (C, 3, 3) and extents (C, 3) of the
+    boxes, where C is the largest label + 1. Clusters without points have a
+    zero center and extent and an identity rotation.
+)");
 
-    pointcloud.def("transform", &PointCloud::Transform, "transformation"_a,
+    pointcloud.def(
+            "append",
+            [](const PointCloud& self, const PointCloud& other) {
+                return self.Append(other);
+            },
+            py::call_guard<py::gil_scoped_release>());
+    pointcloud.def(
+            "__add__",
+            [](const PointCloud& self, const PointCloud& other) {
+                return self.Append(other);
+            },
+            py::call_guard<py::gil_scoped_release>());
+
+    pointcloud.def("transform", &PointCloud::Transform,
+                   py::call_guard<py::gil_scoped_release>(), "transformation"_a,
                    "Transforms the points and normals (if exist).");
-    pointcloud.def("translate", &PointCloud::Translate, "translation"_a,
+    pointcloud.def("translate", &PointCloud::Translate,
+                   py::call_guard<py::gil_scoped_release>(), "translation"_a,
                    "relative"_a = true, "Translates points.");
-    pointcloud.def("scale", &PointCloud::Scale, "scale"_a, "center"_a,
-                   "Scale points.");
-    pointcloud.def("rotate", &PointCloud::Rotate, "R"_a, "center"_a,
+    pointcloud.def("scale", &PointCloud::Scale,
+                   py::call_guard<py::gil_scoped_release>(), "scale"_a,
+                   "center"_a, "Scale points.");
+    pointcloud.def("rotate", &PointCloud::Rotate,
+                   py::call_guard<py::gil_scoped_release>(), "R"_a, "center"_a,
                    "Rotate points and normals (if exist).");
 
-    pointcloud.def("select_points", &PointCloud::SelectPoints, "boolean_mask"_a,
+    pointcloud.def("select_points", &PointCloud::SelectPoints,
+                   py::call_guard<py::gil_scoped_release>(), "boolean_mask"_a,
                    "invert"_a = false,
                    "Select points from input pointcloud, based on boolean mask "
                    "indices into output point cloud.");
     pointcloud.def(
             "voxel_down_sample",
-            [](const PointCloud& pointcloud, const double voxel_size) {
+            [](const PointCloud& pointcloud, const double voxel_size,
+               bool sort_by_morton_code) {
                 return pointcloud.VoxelDownSample(
-                        voxel_size, core::HashBackendType::Default);
+                        voxel_size, core::HashBackendType::Default,
+                        sort_by_morton_code);
             },
+            py::call_guard<py::gil_scoped_release>(),
             "Downsamples a point cloud with a specified voxel size.",
-            "voxel_size"_a);
+            "voxel_size"_a, "sort_by_morton_code"_a = false);
+    pointcloud.def("sort_by_morton_code", &PointCloud::SortByMortonCode,
+                   py::call_guard<py::gil_scoped_release>(),
+                   "Returns the point cloud with all point attributes "
+                   "reordered along a Morton (Z-order) curve, so that points "
+                   "close in space are mostly close in memory.");
+    pointcloud.def("farthest_point_down_sample",
+                   &PointCloud::FarthestPointDownSample,
+                   py::call_guard<py::gil_scoped_release>(), "num_samples"_a,
+                   "Downsamples a point cloud by farthest point sampling, "
+                   "starting from the first point.");
+    pointcloud.def("compute_convex_hull", &PointCloud::ComputeConvexHull,
+                   py::call_guard<py::gil_scoped_release>(),
+                   "joggle_inputs"_a = false,
+                   "Computes the convex hull of the point cloud. The vertex "
+                   "attribute 'point_indices' of the returned mesh holds the "
+                   "index of each vertex in the point cloud.");
+    pointcloud.def("hidden_point_removal", &PointCloud::HiddenPointRemoval,
+                   py::call_guard<py::gil_scoped_release>(),
+                   "camera_location"_a, "radius"_a,
+                   "Removes hidden points from a point cloud and returns a "
+                   "mesh of the remaining points and their indices. Based on "
+                   "Katz et al. 'Direct Visibility of Point Sets', 2007.");
     pointcloud.def("remove_radius_outliers", &PointCloud::RemoveRadiusOutliers,
-                   "nb_points"_a, "search_radius"_a,
+                   py::call_guard<py::gil_scoped_release>(), "nb_points"_a,
+                   "search_radius"_a,
                    "Remove points that have less than nb_points neighbors in a "
                    "sphere of a given search radius.");
+    pointcloud.def("compute_distance", &PointCloud::ComputeDistance,
+                   py::call_guard<py::gil_scoped_release>(), "target"_a,
+                   "Computes the distance from each point to its nearest "
+                   "neighbor in the target point cloud.");
+    pointcloud.def("compute_chamfer_distance",
+                   &PointCloud::ComputeChamferDistance,
+                   py::call_guard<py::gil_scoped_release>(), "target"_a,
+                   "symmetric"_a = true,
+                   "Computes the mean nearest neighbor distance to the target "
+                   "point cloud, plus the reverse one if symmetric.");
+    pointcloud.def("compute_hausdorff_distance",
+                   &PointCloud::ComputeHausdorffDistance,
+                   py::call_guard<py::gil_scoped_release>(), "target"_a,
+                   "symmetric"_a = true,
+                   "Computes the maximum nearest neighbor distance to the "
+                   "target point cloud, also over the reverse distances if "
+                   "symmetric.");
+    pointcloud.def("cluster_dbscan", &PointCloud::ClusterDBSCAN,
+                   py::call_guard<py::gil_scoped_release>(), "eps"_a,
+                   "min_points"_a, "print_progress"_a = false,
+                   "Cluster PointCloud using the DBSCAN algorithm  Ester et "
+                   "al., 'A Density-Based Algorithm for Discovering Clusters "
+                   "in Large Spatial Databases with Noise', 1996. Returns an "
+                   "Int32 tensor of point labels, -1 indicates noise "
+                   "according to the algorithm.");
+    pointcloud.def("cluster_connected_components",
+                   &PointCloud::ClusterConnectedComponents,
+                   py::call_guard<py::gil_scoped_release>(), "radius"_a,
+                   "Clusters the connected components of the graph connecting "
+                   "the points within radius of each other with a parallel "
+                   "union-find on the device of the point cloud. Returns an "
+                   "Int64 tensor of point labels, numbered in the order of "
+                   "their first point.");
+    pointcloud.def("segment_plane", &PointCloud::SegmentPlane,
+                   py::call_guard<py::gil_scoped_release>(),
+                   "distance_threshold"_a = 0.01, "ransac_n"_a = 3,
+                   "num_iterations"_a = 100, "probability"_a = 0.99999999,
+                   "seed"_a = py::none(),
+                   "Segments a plane in the point cloud using the RANSAC "
+                   "algorithm. Plane hypotheses are scored in batches on the "
+                   "device of the point cloud. Returns the plane model and "
+                   "the indices of the plane inliers.");
+    pointcloud.def("segment_planes", &PointCloud::SegmentPlanes,
+                   py::call_guard<py::gil_scoped_release>(),
+                   "distance_threshold"_a, "max_planes"_a,
+                   "min_num_inliers"_a, "ransac_n"_a = 3,
+                   "num_iterations"_a = 100, "probability"_a = 0.99999999,
+                   "seed"_a = py::none(),
+                   "Segments multiple planes, largest first, by repeating "
+                   "segment_plane on the remaining points. Returns the plane "
+                   "models and the plane label of each point, -1 for points "
+                   "on no plane.");
 
     pointcloud.def("estimate_normals", &PointCloud::EstimateNormals,
                    py::call_guard<py::gil_scoped_release>(),
@@ -206,6 +330,28 @@ The attributes of the point cloud have different levels::
                    "with respect to the same. It uses KNN search if only "
                    "max_nn parameter is provided, and HybridSearch if radius "
                    "parameter is also provided.");
+    pointcloud.def("estimate_normals_from_neighbors",
+                   &PointCloud::EstimateNormalsFromNeighbors,
+                   py::call_guard<py::gil_scoped_release>(),
+                   "neighbor_indices"_a, "neighbor_counts"_a,
+                   "Function to estimate point normals from precomputed "
+                   "(N, max_nn) Int32 neighbor indices and (N,) Int32 "
+                   "neighbor counts, as returned by hybrid search.");
+    pointcloud.def("orient_normals_consistent_tangent_plane",
+                   &PointCloud::OrientNormalsConsistentTangentPlane,
+                   py::call_guard<py::gil_scoped_release>(), "k"_a,
+                   "Function to orient the normals with respect to consistent "
+                   "tangent planes. k is the number of nearest neighbors used "
+                   "in constructing the Riemannian graph used to propagate "
+                   "normal orientation.");
+    pointcloud.def("estimate_covariances", &PointCloud::EstimateCovariances,
+                   py::call_guard<py::gil_scoped_release>(),
+                   py::arg("max_nn") = 20, py::arg("radius") = py::none(),
+                   "Function to estimate the covariance matrix of the "
+                   "neighborhood of each point, stored as the (N, 3, 3) "
+                   "'covariances' attribute. It uses KNN search if only "
+                   "max_nn parameter is provided, and HybridSearch if radius "
+                   "parameter is also provided.");
     pointcloud.def("estimate_color_gradients",
                    &PointCloud::EstimateColorGradients,
                    py::call_guard<py::gil_scoped_release>(),
@@ -240,22 +386,61 @@ The attributes of the point cloud have different levels::
             "fx\n\n y "
             "= (v - cy) * z / fy");
     pointcloud.def_static(
-            "from_legacy", &PointCloud::FromLegacy, "pcd_legacy"_a,
+            "create_from_rgbd_image_filtered",
+            &PointCloud::CreateFromRGBDImageFiltered,
+            py::call_guard<py::gil_scoped_release>(), "rgbd_image"_a,
+            "intrinsics"_a,
+            "extrinsics"_a =
+                    core::Tensor::Eye(4, core::Float32, core::Device("CPU:0")),
+            "depth_scale"_a = 1000.0f, "depth_min"_a = 0.0f,
+            "depth_max"_a = 3.0f, "stride"_a = 1, "depth_diff_max"_a = 0.05f,
+            "min_neighbors"_a = 0, "voxel_size"_a = 0.0,
+            "Factory function to create a pointcloud from an RGBD image, "
+            "filtering the depth range and flying pixels and optionally "
+            "keeping one point per voxel, in a single pass over the image. "
+            "A pixel is kept if at least min_neighbors of its 8 neighbors "
+            "have a depth within depth_diff_max of its own.");
+    pointcloud.def_static(
+            "from_legacy",
+            py::overload_cast<const open3d::geometry::PointCloud &,
+                              core::Dtype, const core::Device &>(
+                    &PointCloud::FromLegacy),
+            py::call_guard<py::gil_scoped_release>(), "pcd_legacy"_a,
             "dtype"_a = core::Float32, "device"_a = core::Device("CPU:0"),
             "Create a PointCloud from a legacy Open3D PointCloud.");
     pointcloud.def("project_to_depth_image", &PointCloud::ProjectToDepthImage,
-                   "width"_a, "height"_a, "intrinsics"_a,
+                   py::call_guard<py::gil_scoped_release>(), "width"_a,
+                   "height"_a, "intrinsics"_a,
                    "extrinsics"_a = core::Tensor::Eye(4, core::Float32,
                                                       core::Device("CPU:0")),
                    "depth_scale"_a = 1000.0, "depth_max"_a = 3.0,
                    "Project a point cloud to a depth image.");
     pointcloud.def("project_to_rgbd_image", &PointCloud::ProjectToRGBDImage,
-                   "width"_a, "height"_a, "intrinsics"_a,
+                   py::call_guard<py::gil_scoped_release>(), "width"_a,
+                   "height"_a, "intrinsics"_a,
                    "extrinsics"_a = core::Tensor::Eye(4, core::Float32,
                                                       core::Device("CPU:0")),
                    "depth_scale"_a = 1000.0, "depth_max"_a = 3.0,
                    "Project a colored point cloud to a RGBD image.");
+    pointcloud.def("project_to_depth_images",
+                   &PointCloud::ProjectToDepthImages,
+                   py::call_guard<py::gil_scoped_release>(), "width"_a,
+                   "height"_a, "intrinsics"_a, "extrinsics"_a,
+                   "depth_scale"_a = 1000.0, "depth_max"_a = 3.0,
+                   "Project a point cloud to the depth images of many "
+                   "cameras in one pass. intrinsics is (3, 3) or (V, 3, 3) "
+                   "and extrinsics (V, 4, 4). Returns a (V, height, width, 1) "
+                   "depth tensor.");
+    pointcloud.def("project_to_rgbd_images",
+                   &PointCloud::ProjectToRGBDImages,
+                   py::call_guard<py::gil_scoped_release>(), "width"_a,
+                   "height"_a, "intrinsics"_a, "extrinsics"_a,
+                   "depth_scale"_a = 1000.0, "depth_max"_a = 3.0,
+                   "Project a colored point cloud to the RGBD images of many "
+                   "cameras in one pass. Returns the (V, height, width, 3) "
+                   "color and (V, height, width, 1) depth tensors.");
     pointcloud.def("to_legacy", &PointCloud::ToLegacy,
+                   py::call_guard<py::gil_scoped_release>(),
                    "Convert to a legacy Open3D PointCloud.");
 
     docstring::ClassMethodDocInject(m, "PointCloud", "estimate_normals",
@@ -266,6 +451,72 @@ The attributes of the point cloud have different levels::
                                     map_shared_argument_docstrings);
     docstring::ClassMethodDocInject(m, "PointCloud", "select_points");
     docstring::ClassMethodDocInject(m, "PointCloud", "remove_radius_outliers");
+    docstring::ClassMethodDocInject(
+            m, "PointCloud", "compute_convex_hull",
+            {{"joggle_inputs",
+              "If True allows the algorithm to add random noise to the "
+              "points to work around degenerate inputs. This adds the 'QJ' "
+              "option to the qhull command."}});
+    docstring::ClassMethodDocInject(
+            m, "PointCloud", "hidden_point_removal",
+            {{"camera_location",
+              "Tensor of shape (3,) with the location of the camera. All "
+              "points are visible from this location."},
+             {"radius", "The radius of the spherical projection."}});
+    docstring::ClassMethodDocInject(
+            m, "PointCloud", "farthest_point_down_sample",
+            {{"num_samples", "Number of points to be sampled."}});
+    docstring::ClassMethodDocInject(
+            m, "PointCloud", "compute_distance",
+            {{"target", "The point cloud to compute the distances to."}});
+    docstring::ClassMethodDocInject(
+            m, "PointCloud", "compute_chamfer_distance",
+            {{"target", "The point cloud to compare to."},
+             {"symmetric",
+              "If True, the mean distance from target is added."}});
+    docstring::ClassMethodDocInject(
+            m, "PointCloud", "cluster_dbscan",
+            {{"eps",
+              "Density parameter that is used to find neighbouring points."},
+             {"min_points", "Minimum number of points to form a cluster."},
+             {"print_progress",
+              "If true the progress is visualized in the console."}});
+    docstring::ClassMethodDocInject(
+            m, "PointCloud", "segment_plane",
+            {{"distance_threshold",
+              "Max distance a point can be from the plane model, and still be "
+              "considered an inlier."},
+             {"ransac_n",
+              "Number of initial points to be considered inliers in each "
+              "iteration."},
+             {"num_iterations", "Number of iterations."},
+             {"probability",
+              "Expected probability of finding the optimal plane."},
+             {"seed",
+              "Seed value used in the random generator, set to None to use a "
+              "random seed value with each function call."}});
+    docstring::ClassMethodDocInject(
+            m, "PointCloud", "segment_planes",
+            {{"distance_threshold",
+              "Max distance a point can be from the plane model, and still be "
+              "considered an inlier."},
+             {"max_planes", "Maximum number of planes to extract."},
+             {"min_num_inliers",
+              "Extraction stops at the first plane with fewer inliers."},
+             {"ransac_n",
+              "Number of initial points to be considered inliers in each "
+              "iteration."},
+             {"num_iterations", "Number of iterations per plane."},
+             {"probability",
+              "Expected probability of finding the optimal plane."},
+             {"seed",
+              "Seed value used in the random generator, set to None to use a "
+              "random seed value with each function call."}});
+    docstring::ClassMethodDocInject(
+            m, "PointCloud", "compute_hausdorff_distance",
+            {{"target", "The point cloud to compare to."},
+             {"symmetric",
+              "If True, the distances from target are included."}});
 }
 
 }  // namespace geometry
@@ -0,0 +1,97 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/t/geometry/PointCloudBatch.h"
+
+#include "pybind/docstring.h"
+#include "pybind/t/geometry/geometry.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+
+void pybind_pointcloud_batch(py::module& m) {
+    py::class_<PointCloudBatch> batch(
+            m, "PointCloudBatch",
+            "A batch of point clouds stored as one concatenated PointCloud "
+            "and the Int64 row splits of the clouds. The operations process "
+            "all clouds with one kernel launch instead of one per cloud.");
+
+    batch.def(py::init<const core::Device&>(),
+              "Construct an empty batch on the device.",
+              "device"_a = core::Device("CPU:0"));
+    batch.def(py::init<const PointCloud&, const core::Tensor&>(),
+              "Construct from the concatenated point cloud and the row "
+              "splits of its clouds.",
+              "point_cloud"_a, "row_splits"_a);
+    batch.def_static("from_point_clouds", &PointCloudBatch::FromPointClouds,
+                     "Concatenate point clouds with the same attributes into "
+                     "a batch.",
+                     "point_clouds"_a);
+    batch.def("to_point_clouds", &PointCloudBatch::ToPointClouds,
+              "Returns the clouds of the batch as views.");
+    batch.def("get_point_cloud", &PointCloudBatch::GetPointCloud,
+              "Returns a cloud of the batch as a view.", "index"_a);
+    batch.def("get_batch_indices", &PointCloudBatch::GetBatchIndices,
+              "Returns the index of the cloud of each point.");
+    batch.def("to", &PointCloudBatch::To,
+              "Returns the batch on the given device.", "device"_a,
+              "copy"_a = false);
+    batch.def("__repr__", &PointCloudBatch::ToString);
+    batch.def("__len__", &PointCloudBatch::GetBatchSize);
+
+    batch.def_property_readonly("points", &PointCloudBatch::GetPoints);
+    batch.def_property_readonly("row_splits", &PointCloudBatch::GetRowSplits);
+    batch.def_property_readonly("device", &PointCloudBatch::GetDevice);
+
+    batch.def("transform", &PointCloudBatch::Transform,
+              py::call_guard<py::gil_scoped_release>(), "transformations"_a,
+              "Transforms every cloud with its own (B, 4, 4) transformation.");
+    batch.def(
+            "voxel_down_sample",
+            [](const PointCloudBatch& batch, double voxel_size) {
+                return batch.VoxelDownSample(voxel_size);
+            },
+            py::call_guard<py::gil_scoped_release>(), "voxel_size"_a,
+            "Downsamples every cloud with the voxel size.");
+    batch.def("estimate_normals", &PointCloudBatch::EstimateNormals,
+              py::call_guard<py::gil_scoped_release>(),
+              py::arg("max_nn") = 30, py::arg("radius") = py::none(),
+              "Estimates the normals of every cloud. With a radius, the "
+              "neighbors of all clouds are found in one batched hybrid "
+              "search.");
+    batch.def("remove_radius_outliers", &PointCloudBatch::RemoveRadiusOutliers,
+              py::call_guard<py::gil_scoped_release>(), "nb_points"_a,
+              "search_radius"_a,
+              "Removes the points of every cloud that have less than "
+              "nb_points neighbors in the same cloud within search_radius. "
+              "Returns the filtered batch and the mask of the kept points.");
+}
+
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
@@ -105,9 +105,39 @@ Returns:
     The geometry ID of the added mesh.
 )doc");
 
-    raycasting_scene.def("cast_rays", &RaycastingScene::CastRays, "rays"_a,
-                         "nthreads"_a = 0,
-                         R"doc(
+    raycasting_scene.def("update_triangles", &RaycastingScene::UpdateTriangles,
+                         "geom_id"_a, "vertex_positions"_a, R"doc(
+Replaces the vertex positions of a mesh in the scene.
+
+The triangles are kept and the acceleration structure of the mesh is refitted
+on the next query instead of being rebuilt.
+
+Args:
+    geom_id (int): The geometry ID returned by add_triangles.
+    vertex_positions (open3d.core.Tensor): Vertices as Tensor of dim {N,3} and
+        dtype Float32. N must match the number of vertices of the mesh. If a
+        transform was set with set_geometry_transform, the positions are in the
+        local frame of the mesh.
+)doc");
+
+    raycasting_scene.def("set_geometry_transform",
+                         &RaycastingScene::SetGeometryTransform, "geom_id"_a,
+                         "transformation"_a, R"doc(
+Sets a rigid transformation for a mesh in the scene.
+
+The transformation is applied to the vertex positions as they were when it was
+first set. The acceleration structure of the mesh is refitted instead of
+rebuilding the scene.
+
+Args:
+    geom_id (int): The geometry ID returned by add_triangles.
+    transformation (open3d.core.Tensor): A Tensor of dim {4,4} with the
+        transformation from the local frame of the mesh to the scene frame.
+)doc");
+
+    raycasting_scene.def("cast_rays", &RaycastingScene::CastRays,
+                         py::call_guard<py::gil_scoped_release>(), "rays"_a,
+                         "nthreads"_a = 0, "coherent"_a = false, R"doc(
 Computes the first intersection of the rays with the scene.
 
 Args:
@@ -122,6 +152,11 @@ Args:
 
     nthreads (int): The number of threads to use. Set to 0 for automatic.
 
+    coherent (bool): If True, the rays are traced in SIMD packets. Rays with
+        shape {.., height, width, 6} are grouped in small screen space tiles.
+        This is faster for coherent rays, e.g., camera rays generated with
+        create_rays_pinhole, and slower for random rays.
+
 Returns:
     A dictionary which contains the following keys
 
@@ -147,10 +182,10 @@ Returns:
 )doc");
 
     raycasting_scene.def("test_occlusions", &RaycastingScene::TestOcclusions,
-                         "rays"_a, "tnear"_a = 0.f,
+                         py::call_guard<py::gil_scoped_release>(), "rays"_a,
+                         "tnear"_a = 0.f,
                          "tfar"_a = std::numeric_limits<float>::infinity(),
-                         "nthreads"_a = 0,
-                         R"doc(
+                         "nthreads"_a = 0, "coherent"_a = false, R"doc(
 Checks if the rays have any intersection with the scene.
 
 Args:
@@ -168,13 +203,17 @@ Args:
 
     nthreads (int): The number of threads to use. Set to 0 for automatic.
 
+    coherent (bool): If True, the rays are traced in SIMD packets as in
+        cast_rays.
+
 Returns:
     A boolean tensor which indicates if the ray is occluded by the scene (true)
     or not (false).
 )doc");
 
     raycasting_scene.def("count_intersections",
-                         &RaycastingScene::CountIntersections, "rays"_a,
+                         &RaycastingScene::CountIntersections,
+                         py::call_guard<py::gil_scoped_release>(), "rays"_a,
                          "nthreads"_a = 0, R"doc(
 Computes the number of intersection of the rays with the scene.
 
@@ -195,6 +234,7 @@ Returns:
 
     raycasting_scene.def("compute_closest_points",
                          &RaycastingScene::ComputeClosestPoints,
+                         py::call_guard<py::gil_scoped_release>(),
                          "query_points"_a, "nthreads"_a = 0, R"doc(
 Computes the closest points on the surfaces of the scene.
 
@@ -223,6 +263,7 @@ Returns:
 )doc");
 
     raycasting_scene.def("compute_distance", &RaycastingScene::ComputeDistance,
+                         py::call_guard<py::gil_scoped_release>(),
                          "query_points"_a, "nthreads"_a = 0, R"doc(
 Computes the distance to the surface of the scene.
 
@@ -242,7 +283,9 @@ Returns:
 
     raycasting_scene.def("compute_signed_distance",
                          &RaycastingScene::ComputeSignedDistance,
-                         "query_points"_a, "nthreads"_a = 0, R"doc(
+                         py::call_guard<py::gil_scoped_release>(),
+                         "query_points"_a, "nthreads"_a = 0,
+                         "use_cache"_a = false, R"doc(
 Computes the signed distance to the surface of the scene.
 
 This function computes the signed distance to the meshes in the scene.
@@ -261,15 +304,45 @@ Args:
 
     nthreads (int): The number of threads to use. Set to 0 for automatic.
 
+    use_cache (bool): If True, the distances of query points inside the cache
+        created with create_signed_distance_cache are interpolated from the
+        cache. All other points are computed exactly.
+
 Returns:
     A tensor with the signed distances to the surface. The shape is {..}.
     Negative distances mean a point is inside a closed surface.
 )doc");
 
-    raycasting_scene.def("compute_occupancy",
-                         &RaycastingScene::ComputeOccupancy, "query_points"_a,
-                         "nthreads"_a = 0,
+    raycasting_scene.def("create_signed_distance_cache",
+                         &RaycastingScene::CreateSignedDistanceCache,
+                         py::call_guard<py::gil_scoped_release>(),
+                         "voxel_size"_a, "truncation"_a, "nthreads"_a = 0,
                          R"doc(
+Precomputes signed distances near the surface for fast queries.
+
+The signed distance is sampled on a sparse grid of bricks with 8x8x8 voxels.
+Only bricks within truncation of the surface are stored.
+compute_signed_distance with use_cache=True then interpolates the distances of
+points inside these bricks trilinearly, which is much faster than the exact
+computation for large numbers of queries. The cache is discarded when the
+geometry of the scene changes.
+
+Args:
+    voxel_size (float): The distance between the samples of the cache.
+
+    truncation (float): The distance to the surface up to which the cache
+        covers the query points.
+
+    nthreads (int): The number of threads to use. Set to 0 for automatic.
+
+Returns:
+    The number of bricks in the cache.
+)doc");
+
+    raycasting_scene.def("compute_occupancy",
+                         &RaycastingScene::ComputeOccupancy,
+                         py::call_guard<py::gil_scoped_release>(),
+                         "query_points"_a, "nthreads"_a = 0, R"doc(
 Computes the occupancy at the query point positions.
 
 This function computes whether the query points are inside or outside.
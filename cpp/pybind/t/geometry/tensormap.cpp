@@ -152,6 +152,12 @@ void pybind_tensormap(py::module &m) {
     tm.def("get_primary_key", &TensorMap::GetPrimaryKey);
     tm.def("is_size_synchronized", &TensorMap::IsSizeSynchronized);
     tm.def("assert_size_synchronized", &TensorMap::AssertSizeSynchronized);
+    tm.def("slice", &TensorMap::Slice, "start"_a, "stop"_a, "step"_a = 1,
+           "Views of the rows [start, stop) of all the tensors, without "
+           "copying memory.");
+    tm.def("index_get", &TensorMap::IndexGet, "indices"_a,
+           "Select the rows of all the tensors with Int64 row indices or a "
+           "Bool mask.");
 }
 
 }  // namespace geometry
@@ -26,8 +26,10 @@
 
 #include "open3d/t/geometry/TriangleMesh.h"
 
+#include <limits>
 #include <string>
 #include <unordered_map>
+#include <unordered_set>
 
 #include "open3d/core/CUDAUtils.h"
 #include "pybind/t/geometry/geometry.h"
@@ -118,9 +120,11 @@ The attributes of the triangle mesh have different levels::
 
     // Device transfers.
     triangle_mesh.def("to", &TriangleMesh::To,
+                      py::call_guard<py::gil_scoped_release>(),
                       "Transfer the triangle mesh to a specified device.",
                       "device"_a, "copy"_a = false);
     triangle_mesh.def("clone", &TriangleMesh::Clone,
+                      py::call_guard<py::gil_scoped_release>(),
                       "Returns copy of the triangle mesh on the same device.");
 
     triangle_mesh.def(
@@ -128,6 +132,7 @@ The attributes of the triangle mesh have different levels::
             [](const TriangleMesh& triangle_mesh) {
                 return triangle_mesh.To(core::Device("CPU:0"));
             },
+            py::call_guard<py::gil_scoped_release>(),
             "Transfer the triangle mesh to CPU. If the triangle mesh "
             "is already on CPU, no copy will be performed.");
     triangle_mesh.def(
@@ -135,6 +140,7 @@ The attributes of the triangle mesh have different levels::
             [](const TriangleMesh& triangle_mesh, int device_id) {
                 return triangle_mesh.To(core::Device("CUDA", device_id));
             },
+            py::call_guard<py::gil_scoped_release>(),
             "Transfer the triangle mesh to a CUDA device. If the triangle mesh "
             "is already on the specified CUDA device, no copy will be "
             "performed.",
@@ -147,24 +153,35 @@ The attributes of the triangle mesh have different levels::
                       "Returns the max bound for point coordinates.");
     triangle_mesh.def("get_center", &TriangleMesh::GetCenter,
                       "Returns the center for point coordinates.");
-    triangle_mesh.def("transform", &TriangleMesh::Transform, "transformation"_a,
+    triangle_mesh.def("transform", &TriangleMesh::Transform,
+                      py::call_guard<py::gil_scoped_release>(),
+                      "transformation"_a,
                       "Transforms the points and normals (if exist).");
-    triangle_mesh.def("translate", &TriangleMesh::Translate, "translation"_a,
+    triangle_mesh.def("translate", &TriangleMesh::Translate,
+                      py::call_guard<py::gil_scoped_release>(), "translation"_a,
                       "relative"_a = true, "Translates points.");
-    triangle_mesh.def("scale", &TriangleMesh::Scale, "scale"_a, "center"_a,
-                      "Scale points.");
-    triangle_mesh.def("rotate", &TriangleMesh::Rotate, "R"_a, "center"_a,
-                      "Rotate points and normals (if exist).");
+    triangle_mesh.def("scale", &TriangleMesh::Scale,
+                      py::call_guard<py::gil_scoped_release>(), "scale"_a,
+                      "center"_a, "Scale points.");
+    triangle_mesh.def("rotate", &TriangleMesh::Rotate,
+                      py::call_guard<py::gil_scoped_release>(), "R"_a,
+                      "center"_a, "Rotate points and normals (if exist).");
 
     triangle_mesh.def_static(
-            "from_legacy", &TriangleMesh::FromLegacy, "mesh_legacy"_a,
+            "from_legacy",
+            py::overload_cast<const open3d::geometry::TriangleMesh &,
+                              core::Dtype, core::Dtype, const core::Device &>(
+                    &TriangleMesh::FromLegacy),
+            py::call_guard<py::gil_scoped_release>(), "mesh_legacy"_a,
             "vertex_dtype"_a = core::Float32, "triangle_dtype"_a = core::Int64,
             "device"_a = core::Device("CPU:0"),
             "Create a TriangleMesh from a legacy Open3D TriangleMesh.");
     triangle_mesh.def("to_legacy", &TriangleMesh::ToLegacy,
+                      py::call_guard<py::gil_scoped_release>(),
                       "Convert to a legacy Open3D TriangleMesh.");
 
-    triangle_mesh.def("clip_plane", &TriangleMesh::ClipPlane, "point"_a,
+    triangle_mesh.def("clip_plane", &TriangleMesh::ClipPlane,
+                      py::call_guard<py::gil_scoped_release>(), "point"_a,
                       "normal"_a,
                       R"(
 Returns a new triangle mesh clipped with the plane.
@@ -192,6 +209,275 @@ This example shows how to create a hemisphere from a sphere::
 
     o3d.visualization.draw(hemisphere)
 )");
+
+    triangle_mesh.def(
+            "simplify_quadric_decimation",
+            &TriangleMesh::SimplifyQuadricDecimation,
+            py::call_guard<py::gil_scoped_release>(),
+            "target_number_of_triangles"_a,
+            "maximum_error"_a = std::numeric_limits<double>::infinity(),
+            "boundary_weight"_a = 1.0,
+            R"(
+Returns a simplified triangle mesh using quadric error metric decimation.
+
+Independent edges are collapsed in parallel rounds until the number of
+triangles is at most the target. Float vertex attributes are averaged, triangle
+attributes are kept for the surviving triangles and triangle normals are
+recomputed.
+
+Args:
+    target_number_of_triangles (int): The number of triangles the simplified
+        mesh should have at most.
+
+    maximum_error (float): Collapses with a higher quadric error are not
+        performed, so the target may not be reached.
+
+    boundary_weight (float): Weight of the quadrics that keep boundary edges
+        in place.
+
+Returns:
+    New simplified triangle mesh.
+
+
+This example shows how to simplify a sphere::
+
+    import open3d as o3d
+
+    sphere = o3d.t.geometry.TriangleMesh.from_legacy(
+        o3d.geometry.TriangleMesh.create_sphere(resolution=40))
+    simplified = sphere.simplify_quadric_decimation(
+        target_number_of_triangles=500)
+)");
+
+    triangle_mesh.def("filter_smooth_laplacian",
+                      &TriangleMesh::FilterSmoothLaplacian,
+                      py::call_guard<py::gil_scoped_release>(),
+                      "number_of_iterations"_a = 1, "lambda_filter"_a = 0.5,
+                      R"(
+Returns a triangle mesh smoothed with a Laplacian filter.
+
+Every float vertex attribute is moved towards the inverse distance weighted
+mean of its neighbours, v_o = v_i + lambda * (sum_n w_n v_n - v_i). Triangle
+normals are recomputed.
+
+Args:
+    number_of_iterations (int): Number of times the filter is applied.
+
+    lambda_filter (float): The smoothing parameter.
+
+Returns:
+    New smoothed triangle mesh.
+)");
+    triangle_mesh.def("filter_smooth_taubin",
+                      &TriangleMesh::FilterSmoothTaubin,
+                      py::call_guard<py::gil_scoped_release>(),
+                      "number_of_iterations"_a = 1, "lambda_filter"_a = 0.5,
+                      "mu"_a = -0.53,
+                      R"(
+Returns a triangle mesh smoothed with the method of Taubin, "Curve and Surface
+Smoothing Without Shrinkage", 1995.
+
+Each iteration applies the Laplacian filter twice, first with lambda_filter and
+then with mu, which avoids the shrinkage of the mesh.
+
+Args:
+    number_of_iterations (int): Number of times the filter pair is applied.
+
+    lambda_filter (float): The first filter parameter.
+
+    mu (float): The second filter parameter.
+
+Returns:
+    New smoothed triangle mesh.
+)");
+    triangle_mesh.def("subdivide_midpoint", &TriangleMesh::SubdivideMidpoint,
+                      py::call_guard<py::gil_scoped_release>(),
+                      "number_of_iterations"_a = 1,
+                      R"(
+Returns a triangle mesh subdivided with the midpoint algorithm.
+
+Each iteration splits every triangle into four, the new vertices lie on the
+midpoints of the edges. Float vertex attributes are interpolated and the new
+triangles take the attributes of the triangle they are split from.
+
+Args:
+    number_of_iterations (int): Number of times the triangles are split.
+
+Returns:
+    New subdivided triangle mesh.
+)");
+    triangle_mesh.def("subdivide_loop", &TriangleMesh::SubdivideLoop,
+                      py::call_guard<py::gil_scoped_release>(),
+                      "number_of_iterations"_a = 1,
+                      R"(
+Returns a triangle mesh subdivided with Loop's scheme, "Smooth subdivision
+surfaces based on triangles", 1987.
+
+Each iteration splits every triangle into four. Float vertex attributes are
+interpolated and the new triangles take the attributes of the triangle they are
+split from.
+
+Args:
+    number_of_iterations (int): Number of times the triangles are split.
+
+Returns:
+    New subdivided triangle mesh.
+)");
+
+    triangle_mesh.def("compute_half_edge_twins",
+                      &TriangleMesh::ComputeHalfEdgeTwins,
+                      py::call_guard<py::gil_scoped_release>(),
+                      R"(
+Returns the twin of every half-edge as a (3 * num_triangles,) Int64 tensor.
+Half-edge 3 * t + k goes from vertex k to vertex (k + 1) % 3 of triangle t. The
+twin is -1 for boundary half-edges, for half-edges of non-manifold or
+degenerate edges, and for inconsistently oriented triangles.)");
+    triangle_mesh.def("get_boundary_edges", &TriangleMesh::GetBoundaryEdges,
+                      py::call_guard<py::gil_scoped_release>(),
+                      "Returns the (E, 2) Int64 edges bounding a single "
+                      "triangle, oriented as in their triangle.");
+    triangle_mesh.def("get_non_manifold_edges",
+                      &TriangleMesh::GetNonManifoldEdges,
+                      py::call_guard<py::gil_scoped_release>(),
+                      "allow_boundary_edges"_a = true,
+                      "Returns the (E, 2) Int64 edges bounding more than two "
+                      "triangles. If allow_boundary_edges is False, then also "
+                      "boundary edges are returned.");
+    triangle_mesh.def("is_edge_manifold", &TriangleMesh::IsEdgeManifold,
+                      py::call_guard<py::gil_scoped_release>(),
+                      "allow_boundary_edges"_a = true,
+                      "Tests if each edge is bounding either one or two "
+                      "triangles. If allow_boundary_edges is False, then "
+                      "boundary edges are not allowed.");
+
+    triangle_mesh.def("cluster_connected_triangles",
+                      &TriangleMesh::ClusterConnectedTriangles,
+                      py::call_guard<py::gil_scoped_release>(),
+                      R"(
+Clusters the triangles connected by edges with a parallel union-find on the
+device of the mesh.
+
+Returns:
+    Tuple of the (num_triangles,) Int64 cluster index of each triangle,
+    numbered in the order of their first triangle, the (num_clusters,) Int64
+    number of triangles and the (num_clusters,) Float64 surface area of each
+    cluster.
+)");
+
+    triangle_mesh.def("remove_duplicated_vertices",
+                      &TriangleMesh::RemoveDuplicatedVertices,
+                      py::call_guard<py::gil_scoped_release>(),
+                      "Merges vertices with identical positions into their "
+                      "first occurrence.");
+    triangle_mesh.def("remove_degenerate_triangles",
+                      &TriangleMesh::RemoveDegenerateTriangles,
+                      py::call_guard<py::gil_scoped_release>(),
+                      "Removes the triangles that reference a vertex more "
+                      "than once.");
+    triangle_mesh.def("remove_duplicated_triangles",
+                      &TriangleMesh::RemoveDuplicatedTriangles,
+                      py::call_guard<py::gil_scoped_release>(),
+                      "Removes all but the first of the triangles that "
+                      "reference the same three vertices.");
+    triangle_mesh.def("remove_unreferenced_vertices",
+                      &TriangleMesh::RemoveUnreferencedVertices,
+                      py::call_guard<py::gil_scoped_release>(),
+                      "Removes the vertices that are not referenced by any "
+                      "triangle.");
+    triangle_mesh.def("clean_mesh", &TriangleMesh::CleanMesh,
+                      py::call_guard<py::gil_scoped_release>(),
+                      "remove_duplicated_vertices"_a = true,
+                      "remove_degenerate_triangles"_a = true,
+                      "remove_duplicated_triangles"_a = true,
+                      "remove_unreferenced_vertices"_a = true,
+                      R"(
+Runs the selected cleaning steps in a single pass on the device of the mesh,
+e.g. on the raw output of marching cubes. Duplicated vertices are merged first,
+so that the triangles collapsed by the merge are removed too. The kept vertices
+and triangles stay in their input order.
+)");
+
+    triangle_mesh.def("sample_points_uniformly",
+                      &TriangleMesh::SamplePointsUniformly,
+                      py::call_guard<py::gil_scoped_release>(),
+                      "number_of_points"_a, "use_triangle_normal"_a = false,
+                      "seed"_a = -1,
+                      R"(
+Samples points uniformly from the surface of the mesh, on the device of the
+mesh. Float vertex attributes are interpolated to the points.
+
+Args:
+    number_of_points (int): Number of points that should be sampled.
+    use_triangle_normal (bool): If true, the normals of the triangles are
+        assigned to the points instead of the interpolated vertex normals.
+    seed (int): Seed of the random number generator, -1 to use a random seed.
+
+Returns:
+    Sampled point cloud.
+)");
+    triangle_mesh.def("sample_points_poisson_disk",
+                      &TriangleMesh::SamplePointsPoissonDisk,
+                      py::call_guard<py::gil_scoped_release>(),
+                      "number_of_points"_a, "init_factor"_a = 5,
+                      "use_triangle_normal"_a = false, "seed"_a = -1,
+                      R"(
+Samples points from the mesh such that each point has approximately the same
+distance to its neighbors, based on Yuksel, "Sample Elimination for Generating
+Poisson Disk Sample Sets", EUROGRAPHICS, 2015.
+
+Args:
+    number_of_points (int): Number of points that should be sampled.
+    init_factor (float): Factor for the number of uniformly sampled points
+        the elimination starts from.
+    use_triangle_normal (bool): If true, the normals of the triangles are
+        assigned to the points instead of the interpolated vertex normals.
+    seed (int): Seed of the random number generator, -1 to use a random seed.
+
+Returns:
+    Sampled point cloud.
+)");
+
+    triangle_mesh.def("compute_uv_atlas", &TriangleMesh::ComputeUVAtlas,
+                      py::call_guard<py::gil_scoped_release>(), "size"_a = 512,
+                      "gutter"_a = 2,
+                      R"(
+Computes a UV atlas and stores it in the texture_uvs triangle attribute.
+
+The triangles are segmented into charts of edge-connected triangles whose
+normals share the same dominant axis direction. The charts are projected along
+that axis and packed into a size x size texture with gutter empty texels around
+every chart.
+
+Args:
+    size (int): The texture size in texels the atlas is packed for.
+    gutter (int): The number of empty texels around each chart.
+
+Returns:
+    The number of charts.
+)");
+
+    triangle_mesh.def("bake_vertex_attr_textures",
+                      &TriangleMesh::BakeVertexAttrTextures,
+                      py::call_guard<py::gil_scoped_release>(), "size"_a,
+                      "vertex_attr"_a = std::unordered_set<std::string>(),
+                      "margin"_a = 2, "fill"_a = 0.0,
+                      R"(
+Bakes vertex attributes into textures with the texture_uvs triangle attribute.
+
+Every texel takes the attributes interpolated at its center from the covering
+triangle. The charts are dilated by margin texels and the remaining texels are
+set to fill.
+
+Args:
+    size (int): The size of the square textures in texels.
+    vertex_attr (set of str): The float vertex attributes to bake. If empty,
+        all of them except positions are baked.
+    margin (int): The number of texels the charts are dilated by.
+    fill (float): The value of the texels outside of all charts.
+
+Returns:
+    A dictionary with a (size, size, channels) Float32 texture per attribute.
+)");
 }
 
 }  // namespace geometry
@@ -129,6 +129,7 @@ void pybind_voxel_block_grid(py::module& m) {
             py::overload_cast<const Image&, const core::Tensor&,
                               const core::Tensor&, float, float, float>(
                     &VoxelBlockGrid::GetUniqueBlockCoordinates),
+            py::call_guard<py::gil_scoped_release>(),
             "Get a (3, M) active block coordinates from a depth image, with "
             "potential duplicates removed."
             "Note: these coordinates are not activated in the internal sparse "
@@ -139,14 +140,27 @@ void pybind_voxel_block_grid(py::module& m) {
     vbg.def("compute_unique_block_coordinates",
             py::overload_cast<const PointCloud&, float>(
                     &VoxelBlockGrid::GetUniqueBlockCoordinates),
+            py::call_guard<py::gil_scoped_release>(),
             "Obtain active block coordinates from a point cloud.", "pcd"_a,
             "trunc_voxel_multiplier"_a = 8.0);
 
+    vbg.def("compute_unique_block_coordinates_along_rays",
+            &VoxelBlockGrid::GetUniqueBlockCoordinatesAlongRays,
+            py::call_guard<py::gil_scoped_release>(),
+            "Specific operation for occupancy maps."
+            "Get the block coordinates traversed by the depth rays from the "
+            "camera center to the truncation distance behind the observed "
+            "depth, with duplicates removed, to carve free space.",
+            "depth"_a, "intrinsic"_a, "extrinsic"_a, "depth_scale"_a = 1000.0f,
+            "depth_max"_a = 3.0f, "trunc_voxel_multiplier"_a = 8.0,
+            "stride"_a = 4);
+
     vbg.def("integrate",
             py::overload_cast<const core::Tensor&, const Image&, const Image&,
                               const core::Tensor&, const core::Tensor&,
                               const core::Tensor&, float, float, float>(
                     &VoxelBlockGrid::Integrate),
+            py::call_guard<py::gil_scoped_release>(),
             "Specific operation for TSDF volumes."
             "Integrate an RGB-D frame in the selected block coordinates using "
             "pinhole camera model.",
@@ -156,10 +170,28 @@ void pybind_voxel_block_grid(py::module& m) {
             "depth_max"_a.noconvert() = 3.0f,
             "trunc_voxel_multiplier"_a.noconvert() = 8.0f);
 
+    vbg.def("integrate",
+            py::overload_cast<const core::Tensor&, const Image&, const Image&,
+                              const Image&, const core::Tensor&,
+                              const core::Tensor&, const core::Tensor&, float,
+                              float, float>(&VoxelBlockGrid::Integrate),
+            py::call_guard<py::gil_scoped_release>(),
+            "Specific operation for semantic TSDF volumes."
+            "Integrate an RGB-D frame and a label image aligned with the color "
+            "image. Label ids are counted in a label_count attribute, or "
+            "per-class probabilities are fused in a label_probability "
+            "attribute.",
+            "block_coords"_a, "depth"_a, "color"_a, "label"_a,
+            "depth_intrinsic"_a, "color_intrinsic"_a, "extrinsic"_a,
+            "depth_scale"_a.noconvert() = 1000.0f,
+            "depth_max"_a.noconvert() = 3.0f,
+            "trunc_voxel_multiplier"_a.noconvert() = 8.0f);
+
     vbg.def("integrate",
             py::overload_cast<const core::Tensor&, const Image&, const Image&,
                               const core::Tensor&, const core::Tensor&, float,
                               float, float>(&VoxelBlockGrid::Integrate),
+            py::call_guard<py::gil_scoped_release>(),
             "Specific operation for TSDF volumes."
             "Integrate an RGB-D frame in the selected block coordinates using "
             "pinhole camera model.",
@@ -172,6 +204,7 @@ void pybind_voxel_block_grid(py::module& m) {
             py::overload_cast<const core::Tensor&, const Image&,
                               const core::Tensor&, const core::Tensor&, float,
                               float, float>(&VoxelBlockGrid::Integrate),
+            py::call_guard<py::gil_scoped_release>(),
             "Specific operation for TSDF volumes."
             "Similar to RGB-D integration, but only applied to depth images.",
             "block_coords"_a, "depth"_a, "intrinsic"_a, "extrinsic"_a,
@@ -179,7 +212,13 @@ void pybind_voxel_block_grid(py::module& m) {
             "depth_max"_a.noconvert() = 3.0f,
             "trunc_voxel_multiplier"_a.noconvert() = 8.0f);
 
-    vbg.def("ray_cast", &VoxelBlockGrid::RayCast,
+    vbg.def("ray_cast",
+            py::overload_cast<const core::Tensor&, const core::Tensor&,
+                              const core::Tensor&, int, int,
+                              const std::vector<std::string>, float, float,
+                              float, float, float, int>(
+                    &VoxelBlockGrid::RayCast),
+            py::call_guard<py::gil_scoped_release>(),
             "Specific operation for TSDF volumes."
             "Perform volumetric ray casting in the selected block coordinates."
             "The block coordinates in the frustum can be taken from"
@@ -192,21 +231,133 @@ void pybind_voxel_block_grid(py::module& m) {
             "depth_scale"_a = 1000.0f, "depth_min"_a = 0.1f,
             "depth_max"_a = 3.0f, "weight_threshold"_a = 3.0f,
             "trunc_voxel_multiplier"_a = 8.0f, "range_map_down_factor"_a = 8);
+    vbg.def("ray_cast",
+            py::overload_cast<const core::Tensor&, const core::Tensor&, int,
+                              int, const std::vector<std::string>, float, float,
+                              float, float, float, int>(
+                    &VoxelBlockGrid::RayCast),
+            py::call_guard<py::gil_scoped_release>(),
+            "Specific operation for TSDF volumes."
+            "Perform volumetric ray casting in the active blocks visible from "
+            "the camera. The visible blocks are cached and reused while the "
+            "camera moves within the tolerance of "
+            "set_frustum_cache_tolerance.",
+            "intrinsic"_a, "extrinsic"_a, "width"_a, "height"_a,
+            "render_attributes"_a = std::vector<std::string>{"depth", "color"},
+            "depth_scale"_a = 1000.0f, "depth_min"_a = 0.1f,
+            "depth_max"_a = 3.0f, "weight_threshold"_a = 3.0f,
+            "trunc_voxel_multiplier"_a = 8.0f, "range_map_down_factor"_a = 8);
+    vbg.def("get_frustum_block_coordinates",
+            &VoxelBlockGrid::GetFrustumBlockCoordinates,
+            py::call_guard<py::gil_scoped_release>(),
+            "Get the active block coordinates whose bounding spheres, enlarged "
+            "by margin, intersect the view frustum of the camera.",
+            "intrinsic"_a, "extrinsic"_a, "width"_a, "height"_a,
+            "depth_min"_a = 0.1f, "depth_max"_a = 3.0f, "margin"_a = 0.0f);
+    vbg.def("set_frustum_cache_tolerance",
+            &VoxelBlockGrid::SetFrustumCacheTolerance,
+            "Set how far the camera may move, in meters and radians, before "
+            "the visible blocks cached by ray_cast are recomputed.",
+            "translation"_a, "rotation"_a);
 
     vbg.def("extract_point_cloud", &VoxelBlockGrid::ExtractPointCloud,
+            py::call_guard<py::gil_scoped_release>(),
             "Specific operation for TSDF volumes."
             "Extract point cloud at isosurface points.",
             "weight_threshold"_a = 3.0f, "estimated_point_number"_a = -1);
 
     vbg.def("extract_triangle_mesh", &VoxelBlockGrid::ExtractTriangleMesh,
+            py::call_guard<py::gil_scoped_release>(),
             "Specific operation for TSDF volumes."
             "Extract triangle mesh at isosurface points.",
             "weight_threshold"_a = 3.0f, "estimated_vertex_number"_a = -1);
 
+    vbg.def("extract_dirty_triangle_mesh_chunks",
+            &VoxelBlockGrid::ExtractDirtyTriangleMeshChunks,
+            py::call_guard<py::gil_scoped_release>(),
+            "Specific operation for TSDF volumes."
+            "Re-extract the triangle mesh chunks of the blocks changed since "
+            "the last call. Returns the block coordinates and their chunks, "
+            "which replace the previous chunks of these blocks.",
+            "weight_threshold"_a = 3.0f);
+    vbg.def("get_dirty_block_coordinates",
+            &VoxelBlockGrid::GetDirtyBlockCoordinates,
+            "Get the block coordinates changed since the last call of "
+            "extract_dirty_triangle_mesh_chunks.");
+
+    vbg.def("set_occupancy_parameters",
+            &VoxelBlockGrid::SetOccupancyParameters,
+            "Specific operation for occupancy maps."
+            "Set the log-odds increments of hits and misses applied by "
+            "integrate to the log_odds attribute, and their clamping range.",
+            "log_odds_hit"_a = 0.85f, "log_odds_miss"_a = -0.4f,
+            "log_odds_min"_a = -2.0f, "log_odds_max"_a = 3.5f);
+    vbg.def("query_occupancy", &VoxelBlockGrid::QueryOccupancy,
+            py::call_guard<py::gil_scoped_release>(),
+            "Specific operation for occupancy maps."
+            "Get the occupancy log-odds of the voxels nearest to the points. "
+            "Unknown voxels have a log-odds of 0.",
+            "points"_a);
+    vbg.def("query_labels", &VoxelBlockGrid::QueryLabels,
+            py::call_guard<py::gil_scoped_release>(),
+            "Specific operation for semantic TSDF volumes."
+            "Get the labels of the voxels nearest to the points, or -1 "
+            "without label observations.",
+            "points"_a);
+    vbg.def("extract_occupied_voxels", &VoxelBlockGrid::ExtractOccupiedVoxels,
+            py::call_guard<py::gil_scoped_release>(),
+            "Specific operation for occupancy maps."
+            "Extract the centers of the voxels whose log-odds exceed the "
+            "threshold as a point cloud with a log_odds attribute.",
+            "log_odds_threshold"_a = 0.0f);
+
+    vbg.def("evict_blocks", &VoxelBlockGrid::EvictBlocks,
+            py::call_guard<py::gil_scoped_release>(),
+            "Evict blocks farther than radius from the camera center given "
+            "by the extrinsic to a host-side store. Evicted blocks are paged "
+            "back in on revisit by integrate and ray_cast. Returns the number "
+            "of evicted blocks.",
+            "extrinsic"_a, "radius"_a);
+    vbg.def("restore_blocks",
+            py::overload_cast<const core::Tensor&>(
+                    &VoxelBlockGrid::RestoreBlocks),
+            py::call_guard<py::gil_scoped_release>(),
+            "Page the evicted blocks in block_coords back into the device "
+            "hash map. Returns the number of restored blocks.",
+            "block_coords"_a);
+    vbg.def("restore_blocks",
+            py::overload_cast<>(&VoxelBlockGrid::RestoreBlocks),
+            py::call_guard<py::gil_scoped_release>(),
+            "Page all evicted blocks back into the device hash map. Returns "
+            "the number of restored blocks.");
+    vbg.def("get_evicted_block_count", &VoxelBlockGrid::GetEvictedBlockCount,
+            "Number of blocks currently held in the host-side store.");
+    vbg.def("save_evicted_blocks", &VoxelBlockGrid::SaveEvictedBlocks,
+            py::call_guard<py::gil_scoped_release>(),
+            "Write the host-side block store to a npz file and release it "
+            "from host memory.",
+            "file_name"_a);
+    vbg.def("load_evicted_blocks", &VoxelBlockGrid::LoadEvictedBlocks,
+            py::call_guard<py::gil_scoped_release>(),
+            "Read blocks written by save_evicted_blocks into the host-side "
+            "block store.",
+            "file_name"_a);
+
+    vbg.def("snapshot", &VoxelBlockGrid::Snapshot,
+            py::call_guard<py::gil_scoped_release>(),
+            "Deep copy the active blocks into a new voxel block grid under a "
+            "read lock, e.g. to extract a mesh in a background thread while "
+            "this grid keeps integrating.");
+    vbg.def("get_epoch", &VoxelBlockGrid::GetEpoch,
+            "Number of modifications of the blocks by integrate, "
+            "evict_blocks, restore_blocks and load_evicted_blocks.");
+
     vbg.def("save", &VoxelBlockGrid::Save,
+            py::call_guard<py::gil_scoped_release>(),
             "Save the voxel block grid to a npz file."
             "file_name"_a);
     vbg.def_static("load", &VoxelBlockGrid::Load,
+                   py::call_guard<py::gil_scoped_release>(),
                    "Load a voxel block grid from a npz file.", "file_name"_a);
 }
 }  // namespace geometry
@@ -0,0 +1,153 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/t/geometry/VoxelGrid.h"
+
+#include <string>
+
+#include "pybind/docstring.h"
+#include "pybind/t/geometry/geometry.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+
+void pybind_voxel_grid(py::module& m) {
+    py::class_<VoxelGrid, PyGeometry<VoxelGrid>, std::shared_ptr<VoxelGrid>,
+               Geometry>
+            voxel_grid(m, "VoxelGrid", R"(
+A VoxelGrid is a sparse set of occupied voxels of the same size. The voxels are
+stored in a hash map from Int32 grid indices to Float32 colors that resides on
+the device of the grid, so that construction and queries run on CPU and CUDA.
+
+The center of the voxel with grid index ``(i, j, k)`` is
+``origin + ((i, j, k) + 0.5) * voxel_size``::
+
+    import open3d as o3d
+
+    pcd = o3d.t.io.read_point_cloud("pointcloud.ply").cuda()
+    voxel_grid = o3d.t.geometry.VoxelGrid.create_from_point_cloud(pcd, 0.05)
+    mask = voxel_grid.check_if_included(pcd.point.positions)
+)");
+
+    voxel_grid.def(py::init<double, const core::Tensor&, const core::Device&,
+                            int64_t>(),
+                   "voxel_size"_a = 1.0, "origin"_a = core::Tensor(),
+                   "device"_a = core::Device("CPU:0"),
+                   "init_capacity"_a = 1000);
+    docstring::ClassMethodDocInject(
+            m, "VoxelGrid", "__init__",
+            {{"voxel_size", "The edge length of the voxels."},
+             {"origin",
+              "The (3,) coordinate of the corner of voxel (0, 0, 0). Zero if "
+              "not specified."},
+             {"device", "The device of the voxel grid."},
+             {"init_capacity", "The initial capacity of the hash map."}});
+
+    voxel_grid.def("__repr__", &VoxelGrid::ToString);
+
+    // Device transfers.
+    voxel_grid.def("to", &VoxelGrid::To,
+                   "Transfer the voxel grid to a specified device.", "device"_a,
+                   "copy"_a = false);
+    voxel_grid.def("clone", &VoxelGrid::Clone,
+                   "Returns copy of the voxel grid on the same device.");
+
+    voxel_grid.def_property_readonly("voxel_size", &VoxelGrid::GetVoxelSize);
+    voxel_grid.def_property_readonly("origin", &VoxelGrid::GetOrigin);
+    voxel_grid.def_property_readonly("device", &VoxelGrid::GetDevice);
+    voxel_grid.def("num_voxels", &VoxelGrid::GetNumVoxels,
+                   "Returns the number of voxels.");
+    voxel_grid.def("has_colors", &VoxelGrid::HasColors,
+                   "Returns true if the voxels have colors.");
+
+    voxel_grid.def("get_voxel_indices",
+                   py::overload_cast<>(&VoxelGrid::GetVoxelIndices, py::const_),
+                   "Returns the (N, 3) Int32 grid indices of all voxels.");
+    voxel_grid.def("get_voxel_indices",
+                   py::overload_cast<const core::Tensor&>(
+                           &VoxelGrid::GetVoxelIndices, py::const_),
+                   "Returns the (N, 3) Int32 grid indices of the voxels "
+                   "containing the points.",
+                   "points"_a);
+    voxel_grid.def("get_voxel_centers", &VoxelGrid::GetVoxelCenters,
+                   "Returns the (N, 3) Float32 centers of all voxels, in the "
+                   "order of get_voxel_indices().");
+    voxel_grid.def("get_voxel_colors", &VoxelGrid::GetVoxelColors,
+                   "Returns the (N, 3) Float32 colors of all voxels, in the "
+                   "order of get_voxel_indices().");
+
+    voxel_grid.def("add_points", &VoxelGrid::AddPoints,
+                   "Adds the voxels containing the points. Existing voxels "
+                   "keep their color.",
+                   "points"_a, "colors"_a = core::Tensor());
+    voxel_grid.def("check_if_included", &VoxelGrid::CheckIfIncluded,
+                   "Returns a (N,) Bool tensor that is true for the points "
+                   "inside a voxel of the grid.",
+                   "points"_a);
+    voxel_grid.def("carve_depth_map", &VoxelGrid::CarveDepthMap,
+                   "Removes the voxels that lie in front of the depth map.",
+                   "depth"_a, "intrinsics"_a, "extrinsics"_a,
+                   "depth_scale"_a = 1000.0f,
+                   "keep_voxels_outside_image"_a = true);
+    docstring::ClassMethodDocInject(
+            m, "VoxelGrid", "carve_depth_map",
+            {{"depth", "The (H, W, 1) depth image."},
+             {"intrinsics", "The (3, 3) camera intrinsic matrix."},
+             {"extrinsics", "The (4, 4) world to camera transformation."},
+             {"depth_scale", "The depth is scaled by 1 / depth_scale."},
+             {"keep_voxels_outside_image",
+              "Keep voxels with a corner that projects outside of the image "
+              "or lies behind the camera."}});
+
+    voxel_grid.def_static(
+            "create_from_point_cloud",
+            [](const PointCloud& pcd, double voxel_size) {
+                return VoxelGrid::CreateFromPointCloud(pcd, voxel_size);
+            },
+            "Creates a voxel grid with the voxels containing the points of "
+            "the point cloud.",
+            "pcd"_a, "voxel_size"_a);
+    voxel_grid.def_static(
+            "create_from_triangle_mesh",
+            [](const TriangleMesh& mesh, double voxel_size) {
+                return VoxelGrid::CreateFromTriangleMesh(mesh, voxel_size);
+            },
+            "Creates a voxel grid with the voxels touched by the triangles "
+            "of the mesh.",
+            "mesh"_a, "voxel_size"_a);
+    voxel_grid.def_static("from_legacy", &VoxelGrid::FromLegacy,
+                          "voxel_grid_legacy"_a,
+                          "device"_a = core::Device("CPU:0"),
+                          "Create a VoxelGrid from a legacy Open3D VoxelGrid.");
+    voxel_grid.def("to_legacy", &VoxelGrid::ToLegacy,
+                   "Convert to a legacy Open3D VoxelGrid.");
+}
+
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
@@ -26,9 +26,11 @@
 
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 #include "open3d/t/geometry/PointCloud.h"
 #include "open3d/t/io/ImageIO.h"
+#include "open3d/t/io/PointCloudCodec.h"
 #include "open3d/t/io/PointCloudIO.h"
 #include "pybind/docstring.h"
 #include "pybind/t/io/io.h"
@@ -120,6 +122,74 @@ void pybind_class_io(py::module &m_io) {
     docstring::FunctionDocInject(m_io, "write_point_cloud",
                                  map_shared_argument_docstrings);
 
+    m_io.def(
+            "encode_point_cloud",
+            [](const t::geometry::PointCloud &pointcloud, double quantization,
+               int color_bits, bool encode_colors, int64_t frame_index) {
+                py::gil_scoped_release release;
+                return EncodePointCloud(
+                        pointcloud, {quantization, color_bits, encode_colors},
+                        frame_index);
+            },
+            "Encode the positions and colors of a PointCloud into a lossy "
+            "compressed UInt8 tensor. Positions are quantized and coded as an "
+            "octree, colors as residuals to the previous point, and both are "
+            "entropy coded.",
+            "pointcloud"_a, "quantization"_a = 0.001, "color_bits"_a = 8,
+            "encode_colors"_a = true, "frame_index"_a = 0);
+    docstring::FunctionDocInject(
+            m_io, "encode_point_cloud",
+            {{"pointcloud", "The ``PointCloud`` object to encode."},
+             {"quantization",
+              "Grid step of the quantized positions. Points of the same grid "
+              "cell are merged."},
+             {"color_bits", "Bits kept per color channel, in [1, 8]."},
+             {"encode_colors", "Set to ``False`` to drop the colors."},
+             {"frame_index", "Index stored with the buffer."}});
+
+    m_io.def(
+            "decode_point_cloud",
+            [](const core::Tensor &buffer, const core::Device &device) {
+                py::gil_scoped_release release;
+                return DecodePointCloud(buffer, device);
+            },
+            "Decode a PointCloud encoded by ``encode_point_cloud``.",
+            "buffer"_a, "device"_a = core::Device("CPU:0"));
+
+    py::class_<PointCloudStreamEncoder> stream_encoder(
+            m_io, "PointCloudStreamEncoder",
+            "Encodes a stream of PointCloud frames into self-contained "
+            "numbered buffers.");
+    stream_encoder
+            .def(py::init([](double quantization, int color_bits,
+                             bool encode_colors) {
+                     return PointCloudStreamEncoder(
+                             {quantization, color_bits, encode_colors});
+                 }),
+                 "quantization"_a = 0.001, "color_bits"_a = 8,
+                 "encode_colors"_a = true)
+            .def("encode", &PointCloudStreamEncoder::Encode,
+                 py::call_guard<py::gil_scoped_release>(),
+                 "Encode the next frame.", "pointcloud"_a)
+            .def_property_readonly("num_frames",
+                                   &PointCloudStreamEncoder::GetNumFrames);
+
+    py::class_<PointCloudStreamDecoder> stream_decoder(
+            m_io, "PointCloudStreamDecoder",
+            "Decodes the frames of a ``PointCloudStreamEncoder``. Stale frames "
+            "decode to an empty PointCloud.");
+    stream_decoder
+            .def(py::init<const core::Device &>(),
+                 "device"_a = core::Device("CPU:0"))
+            .def("decode", &PointCloudStreamDecoder::Decode,
+                 py::call_guard<py::gil_scoped_release>(), "Decode a frame.",
+                 "buffer"_a)
+            .def_property_readonly("last_frame_index",
+                                   &PointCloudStreamDecoder::GetLastFrameIndex)
+            .def_property_readonly(
+                    "num_dropped_frames",
+                    &PointCloudStreamDecoder::GetNumDroppedFrames);
+
     m_io.def(
             "read_image",
             [](const std::string &filename) {
@@ -132,6 +202,21 @@ void pybind_class_io(py::module &m_io) {
     docstring::FunctionDocInject(m_io, "read_image",
                                  map_shared_argument_docstrings);
 
+    m_io.def(
+            "read_images",
+            [](const std::vector<std::string> &filenames) {
+                py::gil_scoped_release release;
+                core::Tensor images;
+                if (!ReadImages(filenames, images)) {
+                    utility::LogError("Failed to read images.");
+                }
+                return images;
+            },
+            "Function to decode a list of image files in parallel and stack "
+            "them into a {N, rows, cols, channels} Tensor. All images must "
+            "share the same shape and dtype.",
+            "filenames"_a);
+
     m_io.def(
             "write_image",
             [](const std::string &filename, const geometry::Image &image,
@@ -27,6 +27,7 @@
 #include <memory>
 
 #include "open3d/geometry/RGBDImage.h"
+#include "open3d/t/io/sensor/RGBDCaptureService.h"
 #include "open3d/t/io/sensor/RGBDSensor.h"
 #include "open3d/t/io/sensor/RGBDVideoReader.h"
 #ifdef BUILD_LIBREALSENSE
@@ -162,10 +163,58 @@ void pybind_sensor(py::module &m) {
                                     map_shared_argument_docstrings);
 
     // Class RGBD sensor
-    py::class_<RGBDSensor> rgbd_sensor(
+    py::class_<RGBDSensor, std::shared_ptr<RGBDSensor>> rgbd_sensor(
             m, "RGBDSensor", "Interface class for control of RGBD cameras.");
     rgbd_sensor.def("__repr__", &RGBDSensor::ToString);
 
+    // Class RGBD capture service
+    py::class_<RGBDCaptureService> rgbd_capture_service(
+            m, "RGBDCaptureService",
+            "Captures frames from several RGBD sensors concurrently. Each "
+            "sensor runs on its own thread, which captures, decodes and "
+            "optionally uploads frames to a device. get_frames() returns one "
+            "frame per sensor with timestamps within a tolerance of each "
+            "other. This requires sensor timestamps in a common time domain.");
+    rgbd_capture_service
+            .def(py::init<const std::vector<std::shared_ptr<RGBDSensor>> &,
+                          size_t, bool, const core::Device &>(),
+                 "sensors"_a, "buffer_size"_a = 8,
+                 "align_depth_to_color"_a = true,
+                 "device"_a = core::Device("CPU:0"),
+                 "Create a capture service for initialized sensors.")
+            .def("start", &RGBDCaptureService::Start,
+                 py::call_guard<py::gil_scoped_release>(),
+                 "Start capturing on all sensors.")
+            .def("stop", &RGBDCaptureService::Stop,
+                 py::call_guard<py::gil_scoped_release>(),
+                 "Stop capturing and join the capture threads.")
+            .def("is_running", &RGBDCaptureService::IsRunning,
+                 "Returns true while the capture threads are running.")
+            .def(
+                    "get_frames",
+                    [](RGBDCaptureService &service, uint64_t max_skew_us,
+                       int timeout_ms) {
+                        std::vector<t::geometry::RGBDImage> frames;
+                        std::vector<uint64_t> timestamps;
+                        {
+                            py::gil_scoped_release release;
+                            service.GetFrames(frames, timestamps, max_skew_us,
+                                              timeout_ms);
+                        }
+                        return py::make_tuple(frames, timestamps);
+                    },
+                    "max_skew_us"_a = 10000, "timeout_ms"_a = 1000,
+                    "Get synchronized frames from all sensors as a tuple of "
+                    "lists of frames and timestamps (in us). The lists are "
+                    "empty if no synchronized frames are available within "
+                    "timeout_ms.")
+            .def("get_num_dropped_frames",
+                 &RGBDCaptureService::GetNumDroppedFrames, "index"_a,
+                 "The number of frames of a sensor dropped because its buffer "
+                 "was full or because they could not be synchronized.")
+            .def_property_readonly("num_sensors",
+                                   &RGBDCaptureService::GetNumSensors);
+
 #ifdef BUILD_LIBREALSENSE
     // Class RS bag reader
     py::class_<RSBagReader, std::unique_ptr<RSBagReader>, RGBDVideoReader>
@@ -256,10 +305,10 @@ void pybind_sensor(py::module &m) {
                            "list of valid values.");
 
     // Class RealSenseSensor
-    py::class_<RealSenseSensor, RGBDSensor> realsense_sensor(
-            m, "RealSenseSensor",
-            "RealSense camera discovery, configuration, streaming and "
-            "recording");
+    py::class_<RealSenseSensor, std::shared_ptr<RealSenseSensor>, RGBDSensor>
+            realsense_sensor(m, "RealSenseSensor",
+                             "RealSense camera discovery, configuration, "
+                             "streaming and recording");
     realsense_sensor.def(py::init<>(), "Initialize with default settings.")
             .def_static("list_devices", &RealSenseSensor::ListDevices,
                         py::call_guard<py::gil_scoped_release>(),
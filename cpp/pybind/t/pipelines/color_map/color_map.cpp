@@ -0,0 +1,65 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "pybind/t/pipelines/color_map/color_map.h"
+
+#include "open3d/t/pipelines/color_map/RigidOptimizer.h"
+#include "pybind/docstring.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace color_map {
+
+void pybind_color_map(py::module &m) {
+    py::module m_color_map = m.def_submodule(
+            "color_map", "Tensor-based color map optimization pipeline.");
+
+    m_color_map.def("run_rigid_optimizer", &RunRigidOptimizer,
+                    "Run rigid color map optimization with batched tensor "
+                    "kernels. All RGBD images must have the same size.",
+                    "mesh"_a, "images_rgbd"_a, "camera_trajectory"_a,
+                    "option"_a, "check_occlusion"_a = false,
+                    "device"_a = core::Device("CPU:0"));
+    docstring::FunctionDocInject(
+            m_color_map, "run_rigid_optimizer",
+            {{"mesh", "The legacy triangle mesh to color."},
+             {"images_rgbd", "The RGBD images, one per camera."},
+             {"camera_trajectory", "The initial camera trajectory."},
+             {"option",
+              "open3d.pipelines.color_map.RigidOptimizerOption. "
+              "debug_output_dir is not supported."},
+             {"check_occlusion",
+              "If True, also remove self-occluded vertices with a "
+              "RaycastingScene."},
+             {"device", "The device to run the kernels on."}});
+}
+
+}  // namespace color_map
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
@@ -126,6 +126,78 @@ void pybind_odometry_classes(py::module &m) {
                         olp.depth_outlier_trunc_, olp.depth_huber_delta_,
                         olp.intensity_huber_delta_);
             });
+
+    // open3d.t.pipelines.odometry.RGBDFramePyramid
+    py::class_<RGBDFramePyramid> rgbd_frame_pyramid(
+            m, "RGBDFramePyramid",
+            "Multi-scale maps of one RGBD frame, computed once and reusable "
+            "as the source or target of ``rgbd_odometry_multi_scale``.");
+    py::detail::bind_copy_functions<RGBDFramePyramid>(rgbd_frame_pyramid);
+    rgbd_frame_pyramid
+            .def(py::init<const t::geometry::RGBDImage &, const core::Tensor &,
+                          float, float, int64_t, Method,
+                          const OdometryLossParams &>(),
+                 py::call_guard<py::gil_scoped_release>(), "rgbd"_a,
+                 "intrinsics"_a, "depth_scale"_a = 1000.0f,
+                 "depth_max"_a = 3.0f, "n_levels"_a = 3,
+                 "method"_a = Method::Hybrid, "params"_a = OdometryLossParams())
+            .def_property_readonly("num_levels",
+                                   &RGBDFramePyramid::GetNumLevels,
+                                   "int: Number of pyramid levels.")
+            .def_readonly("method", &RGBDFramePyramid::method_,
+                          "Odometry method the pyramid is built for.")
+            .def("__repr__", [](const RGBDFramePyramid &pyramid) {
+                return fmt::format("RGBDFramePyramid[num_levels={:d}].",
+                                   pyramid.GetNumLevels());
+            });
+
+    // open3d.t.pipelines.odometry.OdometryWarmStart
+    py::class_<OdometryWarmStart> odometry_warm_start(
+            m, "OdometryWarmStart",
+            "Constant velocity motion prior for frame-to-frame odometry, "
+            "optionally with an IMU rotation prior, that skips the coarsest "
+            "levels when the last frame pair was tracked confidently.");
+    py::detail::bind_copy_functions<OdometryWarmStart>(odometry_warm_start);
+    odometry_warm_start
+            .def(py::init<double, int64_t>(), "confident_fitness"_a = 0.9,
+                 "num_skipped_levels"_a = 1)
+            .def("predict", py::overload_cast<>(&OdometryWarmStart::Predict,
+                                                py::const_),
+                 "Returns the predicted (4, 4) Float64 source to target "
+                 "transformation, or identity before the first update.")
+            .def("predict",
+                 py::overload_cast<const core::Tensor &>(
+                         &OdometryWarmStart::Predict, py::const_),
+                 "Returns the prediction with its rotation replaced by the "
+                 "(3, 3) source to target rotation prior, e.g. from a "
+                 "gyroscope.",
+                 "rotation_prior"_a)
+            .def("get_criteria", &OdometryWarmStart::GetCriteria,
+                 "Returns the criteria list with the coarse levels skipped if "
+                 "the prediction is confident.",
+                 "criteria_list"_a)
+            .def("is_confident", &OdometryWarmStart::IsConfident,
+                 "Returns true if the last result is confident enough to skip "
+                 "levels.")
+            .def("update", &OdometryWarmStart::Update,
+                 "Records the result of the last tracked frame pair.",
+                 "result"_a)
+            .def("reset", &OdometryWarmStart::Reset, "Forgets the motion.")
+            .def_readwrite("confident_fitness",
+                           &OdometryWarmStart::confident_fitness_,
+                           "float: Fitness of the last result from which the "
+                           "prediction is confident.")
+            .def_readwrite("num_skipped_levels",
+                           &OdometryWarmStart::num_skipped_levels_,
+                           "int: Number of coarsest levels skipped for a "
+                           "confident prediction.")
+            .def("__repr__", [](const OdometryWarmStart &ws) {
+                return fmt::format(
+                        "OdometryWarmStart[confident_fitness={:e}, "
+                        "num_skipped_levels={:d}, is_confident={}].",
+                        ws.confident_fitness_, ws.num_skipped_levels_,
+                        ws.IsConfident());
+            });
 }
 
 // Odometry functions have similar arguments, sharing arg docstrings.
@@ -191,7 +263,14 @@ static const std::unordered_map<std::string, std::string>
                  "by CreateVertexMap before calling this function."}};
 
 void pybind_odometry_methods(py::module &m) {
-    m.def("rgbd_odometry_multi_scale", &RGBDOdometryMultiScale,
+    m.def("rgbd_odometry_multi_scale",
+          py::overload_cast<const t::geometry::RGBDImage &,
+                            const t::geometry::RGBDImage &,
+                            const core::Tensor &, const core::Tensor &, float,
+                            float,
+                            const std::vector<OdometryConvergenceCriteria> &,
+                            Method, const OdometryLossParams &>(
+                  &RGBDOdometryMultiScale),
           py::call_guard<py::gil_scoped_release>(),
           "Function for Multi Scale RGBD odometry.", "source"_a, "target"_a,
           "intrinsics"_a,
@@ -201,6 +280,21 @@ void pybind_odometry_methods(py::module &m) {
           "criteria_list"_a =
                   std::vector<OdometryConvergenceCriteria>({10, 5, 3}),
           "method"_a = Method::Hybrid, "params"_a = OdometryLossParams());
+    m.def("rgbd_odometry_multi_scale",
+          py::overload_cast<const RGBDFramePyramid &, const RGBDFramePyramid &,
+                            const core::Tensor &,
+                            const std::vector<OdometryConvergenceCriteria> &,
+                            const OdometryLossParams &>(
+                  &RGBDOdometryMultiScale),
+          py::call_guard<py::gil_scoped_release>(),
+          "Function for Multi Scale RGBD odometry between prebuilt frame "
+          "pyramids.",
+          "source"_a, "target"_a,
+          "init_source_to_target"_a =
+                  core::Tensor::Eye(4, core::Float64, core::Device("CPU:0")),
+          "criteria_list"_a =
+                  std::vector<OdometryConvergenceCriteria>({10, 5, 3}),
+          "params"_a = OdometryLossParams());
     docstring::FunctionDocInject(m, "rgbd_odometry_multi_scale",
                                  map_shared_argument_docstrings);
 
@@ -27,6 +27,7 @@
 #include "pybind/t/pipelines/pipelines.h"
 
 #include "pybind/open3d_pybind.h"
+#include "pybind/t/pipelines/color_map/color_map.h"
 #include "pybind/t/pipelines/odometry/odometry.h"
 #include "pybind/t/pipelines/registration/registration.h"
 #include "pybind/t/pipelines/slac/slac.h"
@@ -39,6 +40,7 @@ namespace pipelines {
 void pybind_pipelines(py::module& m) {
     py::module m_pipelines = m.def_submodule(
             "pipelines", "Tensor-based geometry processing pipelines.");
+    color_map::pybind_color_map(m_pipelines);
     odometry::pybind_odometry(m_pipelines);
     registration::pybind_registration(m_pipelines);
     slac::pybind_slac(m_pipelines);
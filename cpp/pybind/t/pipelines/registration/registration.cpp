@@ -30,6 +30,8 @@
 #include <utility>
 
 #include "open3d/t/geometry/PointCloud.h"
+#include "open3d/t/pipelines/registration/FastGlobalRegistration.h"
+#include "open3d/t/pipelines/registration/Feature.h"
 #include "open3d/t/pipelines/registration/TransformationEstimation.h"
 #include "open3d/utility/Logging.h"
 #include "pybind/docstring.h"
@@ -130,6 +132,123 @@ void pybind_registration_classes(py::module &m) {
                         rr.fitness_ * rr.correspondences_.GetLength());
             });
 
+    // open3d.t.pipelines.registration.ICPTargetPyramid
+    py::class_<ICPTargetPyramid> target_pyramid(
+            m, "ICPTargetPyramid",
+            "Downsampled target point clouds and their search indices for "
+            "each scale of multi-scale ICP, to be built once and reused "
+            "across calls.");
+    py::detail::bind_copy_functions<ICPTargetPyramid>(target_pyramid);
+    target_pyramid
+            .def(py::init<const t::geometry::PointCloud &,
+                          const std::vector<double> &,
+                          const std::vector<double> &,
+                          const TransformationEstimation &>(),
+                 "target"_a, "voxel_sizes"_a,
+                 "max_correspondence_distances"_a,
+                 "estimation_method"_a = TransformationEstimationPointToPoint())
+            .def("add_points", &ICPTargetPyramid::AddPoints,
+                 py::call_guard<py::gil_scoped_release>(),
+                 "Appends points to the target. Only the new points are "
+                 "downsampled, and the search indices are rebuilt.",
+                 "points"_a)
+            .def("get_num_scales", &ICPTargetPyramid::GetNumScales,
+                 "Returns the number of scales.")
+            .def("get_point_cloud", &ICPTargetPyramid::GetPointCloud,
+                 "Returns the target point cloud of the scale, coarsest "
+                 "first.",
+                 "scale_index"_a)
+            .def_property_readonly("voxel_sizes",
+                                   &ICPTargetPyramid::GetVoxelSizes)
+            .def_property_readonly(
+                    "max_correspondence_distances",
+                    &ICPTargetPyramid::GetMaxCorrespondenceDistances)
+            .def("__repr__", [](const ICPTargetPyramid &tp) {
+                return fmt::format("ICPTargetPyramid with {:d} scales.",
+                                   tp.GetNumScales());
+            });
+
+    // open3d.t.pipelines.registration.FastGlobalRegistrationOption
+    py::class_<FastGlobalRegistrationOption> fgr_option(
+            m, "FastGlobalRegistrationOption",
+            "Options for FastGlobalRegistration.");
+    py::detail::bind_copy_functions<FastGlobalRegistrationOption>(fgr_option);
+    fgr_option
+            .def(py::init([](double division_factor, bool use_absolute_scale,
+                             bool decrease_mu,
+                             double maximum_correspondence_distance,
+                             int iteration_number, double tuple_scale,
+                             int maximum_tuple_count, bool tuple_test,
+                             utility::optional<unsigned int> seed) {
+                     return new FastGlobalRegistrationOption(
+                             division_factor, use_absolute_scale, decrease_mu,
+                             maximum_correspondence_distance, iteration_number,
+                             tuple_scale, maximum_tuple_count, tuple_test,
+                             seed);
+                 }),
+                 "division_factor"_a = 1.4, "use_absolute_scale"_a = false,
+                 "decrease_mu"_a = true,
+                 "maximum_correspondence_distance"_a = 0.025,
+                 "iteration_number"_a = 64, "tuple_scale"_a = 0.95,
+                 "maximum_tuple_count"_a = 1000, "tuple_test"_a = true,
+                 "seed"_a = py::none())
+            .def_readwrite(
+                    "division_factor",
+                    &FastGlobalRegistrationOption::division_factor_,
+                    "float: Division factor used for graduated non-convexity.")
+            .def_readwrite(
+                    "use_absolute_scale",
+                    &FastGlobalRegistrationOption::use_absolute_scale_,
+                    "bool: Measure distance in absolute scale (1) or in scale "
+                    "relative to the diameter of the model (0).")
+            .def_readwrite("decrease_mu",
+                           &FastGlobalRegistrationOption::decrease_mu_,
+                           "bool: Set to ``True`` to decrease scale mu by "
+                           "``division_factor`` for graduated non-convexity.")
+            .def_readwrite("maximum_correspondence_distance",
+                           &FastGlobalRegistrationOption::
+                                   maximum_correspondence_distance_,
+                           "float: Maximum correspondence distance.")
+            .def_readwrite("iteration_number",
+                           &FastGlobalRegistrationOption::iteration_number_,
+                           "int: Maximum number of iterations.")
+            .def_readwrite(
+                    "tuple_scale", &FastGlobalRegistrationOption::tuple_scale_,
+                    "float: Similarity measure used for tuples of feature "
+                    "points.")
+            .def_readwrite("maximum_tuple_count",
+                           &FastGlobalRegistrationOption::maximum_tuple_count_,
+                           "int: Maximum number of tuples.")
+            .def_readwrite(
+                    "tuple_test", &FastGlobalRegistrationOption::tuple_test_,
+                    "bool: Set to ``True`` to perform geometric compatibility "
+                    "tests on initial set of correspondences.")
+            .def_readwrite("seed", &FastGlobalRegistrationOption::seed_,
+                           "unsigned int: Random seed.")
+            .def_readwrite("kernel", &FastGlobalRegistrationOption::kernel_,
+                           "Robust kernel of the point to point objective. Its "
+                           "scaling parameter is set by the graduated "
+                           "non-convexity.")
+            .def("__repr__", [](const FastGlobalRegistrationOption &c) {
+                return fmt::format(
+                        "FastGlobalRegistrationOption class "
+                        "with \ndivision_factor={}"
+                        "\nuse_absolute_scale={}"
+                        "\ndecrease_mu={}"
+                        "\nmaximum_correspondence_distance={}"
+                        "\niteration_number={}"
+                        "\ntuple_scale={}"
+                        "\nmaximum_tuple_count={}"
+                        "\ntuple_test={}"
+                        "\nseed={}",
+                        c.division_factor_, c.use_absolute_scale_,
+                        c.decrease_mu_, c.maximum_correspondence_distance_,
+                        c.iteration_number_, c.tuple_scale_,
+                        c.maximum_tuple_count_, c.tuple_test_,
+                        c.seed_.has_value() ? std::to_string(c.seed_.value())
+                                            : "None");
+            });
+
     // open3d.t.pipelines.registration.TransformationEstimation
     py::class_<TransformationEstimation,
                PyTransformationEstimation<TransformationEstimation>>
@@ -251,6 +370,51 @@ void pybind_registration_classes(py::module &m) {
             .def_readwrite("kernel",
                            &TransformationEstimationForColoredICP::kernel_,
                            "Robust Kernel used in the Optimization");
+
+    // open3d.t.pipelines.registration.TransformationEstimationForGeneralizedICP
+    // TransformationEstimation
+    py::class_<TransformationEstimationForGeneralizedICP,
+               PyTransformationEstimation<
+                       TransformationEstimationForGeneralizedICP>,
+               TransformationEstimation>
+            te_gicp(m, "TransformationEstimationForGeneralizedICP",
+                    "Class to estimate a transformation for Generalized ICP, "
+                    "optionally combined with the photometric term of "
+                    "Colored ICP on the same correspondences.");
+    py::detail::bind_default_constructor<
+            TransformationEstimationForGeneralizedICP>(te_gicp);
+    py::detail::bind_copy_functions<TransformationEstimationForGeneralizedICP>(
+            te_gicp);
+    te_gicp.def(py::init([](double epsilon, const RobustKernel &kernel,
+                            double lambda_geometric) {
+                    return new TransformationEstimationForGeneralizedICP(
+                            epsilon, kernel, lambda_geometric);
+                }),
+                "epsilon"_a = 1e-3,
+                "kernel"_a = RobustKernel(RobustKernelMethod::L2Loss, 1.0, 1.0),
+                "lambda_geometric"_a = 1.0)
+            .def("__repr__",
+                 [](const TransformationEstimationForGeneralizedICP &te) {
+                     return std::string(
+                                    "TransformationEstimationForGeneralizedICP "
+                                    "with epsilon: ") +
+                            std::to_string(te.epsilon_) +
+                            std::string(", lambda_geometric: ") +
+                            std::to_string(te.lambda_geometric_);
+                 })
+            .def_readwrite("epsilon",
+                           &TransformationEstimationForGeneralizedICP::epsilon_,
+                           "Small constant representing covariance along the "
+                           "normal.")
+            .def_readwrite("lambda_geometric",
+                           &TransformationEstimationForGeneralizedICP::
+                                   lambda_geometric_,
+                           "Weight of the geometric term. The photometric "
+                           "term is used if it is smaller than 1.")
+            .def_readwrite(
+                    "kernel",
+                    &TransformationEstimationForGeneralizedICP::kernel_,
+                    "Robust Kernel used in the Optimization");
 }
 
 // Registration functions have similar arguments, sharing arg docstrings.
@@ -261,6 +425,9 @@ static const std::unordered_map<std::string, std::string>
                  "target points, where the value is the target index and the "
                  "index of the value itself is the source index. It contains "
                  "-1 as value at index with no correspondence."},
+                {"corres",
+                 "Int64 tensor of shape {K, 2}, where each row holds the "
+                 "source and the target index of a correspondence."},
                 {"criteria", "Convergence criteria"},
                 {"criteria_list",
                  "List of Convergence criteria for each scale of multi-scale "
@@ -272,14 +439,35 @@ static const std::unordered_map<std::string, std::string>
                  "``TransformationEstimationForColoredICP``, "
                  "``TransformationEstimationForGeneralizedICP``)"},
                 {"init_source_to_target", "Initial transformation estimation"},
+                {"init_source_to_targets",
+                 "List of initial transformation estimations, one per pair. "
+                 "Identity is used for all pairs if empty."},
+                {"input", "The input point cloud with normals."},
                 {"max_correspondence_distance",
                  "Maximum correspondence points-pair distance."},
                 {"max_correspondence_distances",
                  "o3d.utility.DoubleVector of maximum correspondence "
                  "points-pair distances for multi-scale icp."},
+                {"max_nn",
+                 "Neighbor search max neighbors parameter. Set to None to "
+                 "use radius search only."},
                 {"option", "Registration option"},
+                {"radius",
+                 "Neighbor search radius parameter. Set to None to use KNN "
+                 "search only."},
                 {"source", "The source point cloud."},
+                {"source_features",
+                 "Source point cloud features of shape {N, D}, e.g. FPFH "
+                 "features."},
+                {"sources", "List of source point clouds."},
                 {"target", "The target point cloud."},
+                {"target_features",
+                 "Target point cloud features of shape {M, D}, e.g. FPFH "
+                 "features."},
+                {"target_pyramid",
+                 "The target pyramid built with ICPTargetPyramid."},
+                {"targets",
+                 "List of target point clouds with normals, one per source."},
                 {"transformation",
                  "The 4x4 transformation matrix of type Float64 "
                  "to transform ``source`` to ``target``"},
@@ -296,7 +484,10 @@ static const std::unordered_map<std::string, std::string>
                  "Optional lambda function, saves string to tensor map of "
                  "attributes such as iteration_index, scale_index, "
                  "scale_iteration_index, inlier_rmse, fitness, transformation, "
-                 "on CPU device, updated after each iteration."}};
+                 "on CPU device, updated after each iteration. The wall time "
+                 "in milliseconds of the iteration's stages is reported as "
+                 "correspondence_search_time, estimation_time and "
+                 "transform_time."}};
 
 void pybind_registration_methods(py::module &m) {
     m.def("evaluate_registration", &EvaluateRegistration,
@@ -317,7 +508,17 @@ void pybind_registration_methods(py::module &m) {
           "callback_after_iteration"_a = py::none());
     docstring::FunctionDocInject(m, "icp", map_shared_argument_docstrings);
 
-    m.def("multi_scale_icp", &MultiScaleICP,
+    m.def("multi_scale_icp",
+          py::overload_cast<const t::geometry::PointCloud &,
+                            const t::geometry::PointCloud &,
+                            const std::vector<double> &,
+                            const std::vector<ICPConvergenceCriteria> &,
+                            const std::vector<double> &, const core::Tensor &,
+                            const TransformationEstimation &,
+                            const std::function<void(
+                                    const std::unordered_map<std::string,
+                                                             core::Tensor> &)>
+                                    &>(&MultiScaleICP),
           py::call_guard<py::gil_scoped_release>(),
           "Function for Multi-Scale ICP registration", "source"_a, "target"_a,
           "voxel_sizes"_a, "criteria_list"_a, "max_correspondence_distances"_a,
@@ -325,9 +526,66 @@ void pybind_registration_methods(py::module &m) {
                   core::Tensor::Eye(4, core::Float64, core::Device("CPU:0")),
           "estimation_method"_a = TransformationEstimationPointToPoint(),
           "callback_after_iteration"_a = py::none());
+    m.def("multi_scale_icp",
+          py::overload_cast<const t::geometry::PointCloud &,
+                            const ICPTargetPyramid &,
+                            const std::vector<ICPConvergenceCriteria> &,
+                            const core::Tensor &,
+                            const TransformationEstimation &,
+                            const std::function<void(
+                                    const std::unordered_map<std::string,
+                                                             core::Tensor> &)>
+                                    &>(&MultiScaleICP),
+          py::call_guard<py::gil_scoped_release>(),
+          "Function for Multi-Scale ICP registration against a prebuilt "
+          "target pyramid",
+          "source"_a, "target_pyramid"_a, "criteria_list"_a,
+          "init_source_to_target"_a =
+                  core::Tensor::Eye(4, core::Float64, core::Device("CPU:0")),
+          "estimation_method"_a = TransformationEstimationPointToPoint(),
+          "callback_after_iteration"_a = py::none());
     docstring::FunctionDocInject(m, "multi_scale_icp",
                                  map_shared_argument_docstrings);
 
+    m.def("batch_icp", &BatchICP, py::call_guard<py::gil_scoped_release>(),
+          "Function for point to plane ICP registration of many independent "
+          "source and target pairs in lockstep",
+          "sources"_a, "targets"_a, "max_correspondence_distance"_a,
+          "init_source_to_targets"_a = std::vector<core::Tensor>(),
+          "estimation_method"_a = TransformationEstimationPointToPlane(),
+          "criteria"_a = ICPConvergenceCriteria());
+    docstring::FunctionDocInject(m, "batch_icp",
+                                 map_shared_argument_docstrings);
+
+    m.def("compute_fpfh_feature", &ComputeFPFHFeature,
+          py::call_guard<py::gil_scoped_release>(),
+          "Function to compute FPFH feature for a point cloud. It uses KNN "
+          "search if only max_nn is given, radius search if only radius is "
+          "given, and hybrid search (recommended) if both are given.",
+          "input"_a, "max_nn"_a = 100, "radius"_a = py::none());
+    docstring::FunctionDocInject(m, "compute_fpfh_feature",
+                                 map_shared_argument_docstrings);
+
+    m.def("registration_fgr_based_on_correspondence",
+          &FastGlobalRegistrationBasedOnCorrespondence,
+          py::call_guard<py::gil_scoped_release>(),
+          "Function for fast global registration based on a set of "
+          "correspondences",
+          "source"_a, "target"_a, "corres"_a,
+          "option"_a = FastGlobalRegistrationOption());
+    docstring::FunctionDocInject(m, "registration_fgr_based_on_correspondence",
+                                 map_shared_argument_docstrings);
+
+    m.def("registration_fgr_based_on_feature_matching",
+          &FastGlobalRegistrationBasedOnFeatureMatching,
+          py::call_guard<py::gil_scoped_release>(),
+          "Function for fast global registration based on feature matching",
+          "source"_a, "target"_a, "source_features"_a, "target_features"_a,
+          "option"_a = FastGlobalRegistrationOption());
+    docstring::FunctionDocInject(m,
+                                 "registration_fgr_based_on_feature_matching",
+                                 map_shared_argument_docstrings);
+
     m.def("get_information_matrix", &GetInformationMatrix,
           py::call_guard<py::gil_scoped_release>(),
           "Function for computing information matrix from transformation "
@@ -44,11 +44,12 @@ void pybind_slac_classes(py::module &m) {
     py::detail::bind_copy_functions<SLACOptimizerParams>(slac_optimizer_params);
     slac_optimizer_params
             .def(py::init<const int, const float, const float, const float,
-                          const float, const core::Device, const std::string>(),
+                          const float, const core::Device, const std::string,
+                          const bool>(),
                  "max_iterations"_a = 5, "voxel_size"_a = 0.05,
                  "distance_threshold"_a = 0.07, "fitness_threshold"_a = 0.3,
                  "regularizer_weight"_a = 1, "device"_a = core::Device("CPU:0"),
-                 "slac_folder"_a = "")
+                 "slac_folder"_a = "", "use_sparse_solver"_a = false)
             .def_readwrite("max_iterations",
                            &SLACOptimizerParams::max_iterations_,
                            "Number of iterations.")
@@ -69,6 +70,10 @@ void pybind_slac_classes(py::module &m) {
             .def_readwrite("slac_folder", &SLACOptimizerParams::slac_folder_,
                            "Relative directory to store SLAC results in the "
                            "dataset folder.")
+            .def_readwrite("use_sparse_solver",
+                           &SLACOptimizerParams::use_sparse_solver_,
+                           "Solve the SLAC linear system with a sparse "
+                           "preconditioned conjugate gradient solver.")
             .def(
                     "get_subfolder_name",
                     [](const SLACOptimizerParams &slac_optimizer_params) {
@@ -81,11 +86,11 @@ void pybind_slac_classes(py::module &m) {
                         "SLACOptimizerParams[max_iterations={:d}, "
                         "voxel_size={:e}, distance_threshold={:e}, "
                         "fitness_threshold={:e}, regularizer_weight={:e}, "
-                        "device={}, slac_folder={}].",
+                        "device={}, slac_folder={}, use_sparse_solver={}].",
                         params.max_iterations_, params.voxel_size_,
                         params.distance_threshold_, params.fitness_threshold_,
                         params.regularizer_weight_, params.device_.ToString(),
-                        params.slac_folder_);
+                        params.slac_folder_, params.use_sparse_solver_);
             });
 
     py::class_<SLACDebugOption> slac_debug_option(m, "slac_debug_option",
@@ -147,7 +152,8 @@ void pybind_slac_classes(py::module &m) {
                  "non-allocated "
                  "entries) for the active entries of shape (N, 6). "
                  "\n - masks_nb Corresponding neighbor masks of shape (N, "
-                 "6). ")
+                 "6). "
+                 "\nThe map is cached until the next touch or compactify.")
             .def(
                     "parameterize",
                     [](ControlGrid &control_grid,
@@ -171,6 +177,16 @@ void pybind_slac_classes(py::module &m) {
                     },
                     "Non-rigidly deform a point cloud using the control grid.",
                     "pointcloud"_a)
+            .def(
+                    "deform",
+                    [](ControlGrid &control_grid,
+                       const std::vector<geometry::PointCloud> &pcds) {
+                        return control_grid.Deform(pcds);
+                    },
+                    py::call_guard<py::gil_scoped_release>(),
+                    "Non-rigidly deform a list of parameterized point clouds "
+                    "in one batch using the control grid.",
+                    "pointclouds"_a)
             .def(
                     "deform",
                     [](ControlGrid &control_grid, const geometry::Image &depth,
@@ -253,6 +269,7 @@ void pybind_slac_methods(py::module &m) {
                                  map_shared_argument_docstrings);
 
     m.def("run_slac_optimizer_for_fragments", &RunSLACOptimizerForFragments,
+          py::call_guard<py::gil_scoped_release>(),
           "Simultaneous Localization and Calibration: Self-Calibration of "
           "Consumer Depth Cameras, CVPR 2014 Qian-Yi Zhou and Vladlen Koltun "
           "Estimate a shared control grid for all fragments for scene "
@@ -265,6 +282,7 @@ void pybind_slac_methods(py::module &m) {
                                  map_shared_argument_docstrings);
 
     m.def("run_rigid_optimizer_for_fragments", &RunRigidOptimizerForFragments,
+          py::call_guard<py::gil_scoped_release>(),
           "Extended ICP to simultaneously align multiple point clouds with "
           "dense pairwise point-to-plane distances.",
           "fragment_filenames"_a, "fragment_pose_graph"_a,
@@ -25,7 +25,10 @@
 // ----------------------------------------------------------------------------
 
 #include "open3d/t/pipelines/slam/Frame.h"
+#include "open3d/t/pipelines/slam/LocalMap.h"
+#include "open3d/t/pipelines/slam/LoopClosureDetector.h"
 #include "open3d/t/pipelines/slam/Model.h"
+#include "open3d/t/pipelines/slam/SubmapModel.h"
 #include "pybind/docstring.h"
 
 namespace open3d {
@@ -128,6 +131,14 @@ void pybind_slam_model(py::module &m) {
     model.def(
             "get_hashmap", &Model::GetHashMap,
             "Get the underlying hash map from 3D coordinates to voxel blocks.");
+    model.def("set_frame_allocation_limit", &Model::SetFrameAllocationLimit,
+              "Raise an error in update_frame_pose if a frame makes more than "
+              "limit allocations on the model's device. A negative limit "
+              "disables the check.",
+              "limit"_a);
+    model.def("get_frame_allocation_count", &Model::GetFrameAllocationCount,
+              "Get the number of allocations on the model's device between "
+              "the last two update_frame_pose calls.");
     model.def_readwrite("voxel_grid", &Model::voxel_grid_,
                         "Get the maintained VoxelBlockGrid.");
     model.def_readwrite("transformation_frame_to_world",
@@ -138,6 +149,92 @@ void pybind_slam_model(py::module &m) {
                         "Get the current frame index in a sequence.");
 }
 
+void pybind_slam_submap_model(py::module &m) {
+    py::class_<SubmapModel> submap_model(
+            m, "SubmapModel",
+            "Volumetric model for Dense SLAM split into submaps, each with "
+            "its own VoxelBlockGrid and anchor pose.");
+
+    submap_model.def(py::init<float, int, int, core::Tensor, core::Device>(),
+                     "voxel_size"_a, "block_resolution"_a = 16,
+                     "block_count"_a = 10000,
+                     "transformation"_a = core::Tensor::Eye(
+                             4, core::Float64, core::Device("CPU:0")),
+                     "device"_a = core::Device("CUDA:0"));
+    docstring::ClassMethodDocInject(m, "SubmapModel", "__init__",
+                                    map_shared_argument_docstrings);
+
+    submap_model.def("get_current_frame_pose",
+                     &SubmapModel::GetCurrentFramePose);
+    submap_model.def("update_frame_pose", &SubmapModel::UpdateFramePose,
+                     "frame_id"_a, "transformation"_a);
+    submap_model.def("get_frame_pose", &SubmapModel::GetFramePose,
+                     "Frame to world pose of a frame, following the anchor of "
+                     "its submap.",
+                     "frame_id"_a);
+    submap_model.def("get_frame_submap_id", &SubmapModel::GetFrameSubmapId,
+                     "frame_id"_a);
+
+    submap_model.def("synthesize_model_frame",
+                     &SubmapModel::SynthesizeModelFrame,
+                     py::call_guard<py::gil_scoped_release>(),
+                     "Synthesize frame from the active submap using ray "
+                     "casting.",
+                     "model_frame"_a, "depth_scale"_a = 1000.0,
+                     "depth_min"_a = 0.1, "depth_max"_a = 3.0,
+                     "trunc_voxel_multiplier"_a = 8.0,
+                     "enable_color"_a = false);
+    submap_model.def("track_frame_to_model", &SubmapModel::TrackFrameToModel,
+                     py::call_guard<py::gil_scoped_release>(),
+                     "Track input frame against raycasted frame from the "
+                     "active submap.",
+                     "input_frame"_a, "model_frame"_a,
+                     "depth_scale"_a = 1000.0, "depth_max"_a = 3.0,
+                     "depth_diff"_a = 0.07);
+    submap_model.def("integrate", &SubmapModel::Integrate,
+                     py::call_guard<py::gil_scoped_release>(),
+                     "Integrate an input frame to the active submap.",
+                     "input_frame"_a, "depth_scale"_a = 1000.0,
+                     "depth_max"_a = 3.0, "trunc_voxel_multiplier"_a = 8.0);
+
+    submap_model.def("start_new_submap", &SubmapModel::StartNewSubmap,
+                     "Start a new active submap anchored at the current frame "
+                     "pose. Returns its id.");
+    submap_model.def("get_submap_pose", &SubmapModel::GetSubmapPose,
+                     "submap_id"_a);
+    submap_model.def("set_submap_pose", &SubmapModel::SetSubmapPose,
+                     "Re-anchor a submap, moving its surface and frames.",
+                     "submap_id"_a, "transformation"_a);
+    submap_model.def("get_submap", &SubmapModel::GetSubmap,
+                     py::return_value_policy::reference_internal,
+                     "Model of a submap, in the coordinates of its anchor.",
+                     "submap_id"_a);
+    submap_model.def("offload_submap", &SubmapModel::OffloadSubmap,
+                     "Save the voxel grid of an inactive submap to a .npz "
+                     "file and release it.",
+                     "submap_id"_a, "file_name"_a);
+    submap_model.def("reload_submap", &SubmapModel::ReloadSubmap,
+                     "Load the voxel grid of an offloaded submap.",
+                     "submap_id"_a);
+    submap_model.def("is_submap_offloaded", &SubmapModel::IsSubmapOffloaded,
+                     "submap_id"_a);
+    submap_model.def_property_readonly("num_submaps",
+                                       &SubmapModel::GetNumSubmaps);
+    submap_model.def_property_readonly("active_submap_id",
+                                       &SubmapModel::GetActiveSubmapId);
+
+    submap_model.def("extract_pointcloud", &SubmapModel::ExtractPointCloud,
+                     py::call_guard<py::gil_scoped_release>(),
+                     "Extract point cloud from all the submaps in world "
+                     "coordinates.",
+                     "weight_threshold"_a = 3.0, "estimated_number"_a = -1);
+    submap_model.def("extract_trianglemesh", &SubmapModel::ExtractTriangleMesh,
+                     py::call_guard<py::gil_scoped_release>(),
+                     "Extract triangle mesh from all the submaps in world "
+                     "coordinates.",
+                     "weight_threshold"_a = 3.0, "estimated_number"_a = -1);
+}
+
 void pybind_slam_frame(py::module &m) {
     py::class_<Frame> frame(m, "Frame",
                             "A frame container that stores a map from keys "
@@ -154,6 +251,11 @@ void pybind_slam_frame(py::module &m) {
 
     frame.def("set_data", &Frame::SetData,
               "Set a 2D tensor to a image to the given key in the map.");
+    frame.def("reserve_data", &Frame::ReserveData,
+              "Preallocate a (height, width, channels) buffer for the given "
+              "key, which subsequent set_data calls with matching tensors "
+              "copy into.",
+              "name"_a, "channels"_a, "dtype"_a);
     frame.def("get_data", &Frame::GetData,
               "Get a 2D tensor from a image from the given key in the map.");
     frame.def("set_data_from_image", &Frame::SetDataFromImage,
@@ -162,11 +264,172 @@ void pybind_slam_frame(py::module &m) {
               "Get a 2D image from from the given key in the map.");
 }
 
+void pybind_slam_local_map(py::module &m) {
+    py::class_<LocalMap> local_map(
+            m, "LocalMap",
+            "Sliding-window point map for frame-to-map LiDAR odometry, "
+            "storing at most max_points_per_voxel points per voxel in a hash "
+            "map.");
+
+    local_map.def(py::init<double, int, const core::Dtype &,
+                           const core::Device &, int64_t>(),
+                  "voxel_size"_a, "max_points_per_voxel"_a = 20,
+                  "dtype"_a = core::Float32,
+                  "device"_a = core::Device("CPU:0"),
+                  "init_capacity"_a = 10000);
+    local_map.def("insert", &LocalMap::Insert,
+                  py::call_guard<py::gil_scoped_release>(),
+                  "Insert the points of a frame, transformed by the 4x4 "
+                  "frame to map transformation. Points of full voxels are "
+                  "dropped.",
+                  "frame"_a,
+                  "transformation"_a = core::Tensor::Eye(
+                          4, core::Float64, core::Device("CPU:0")));
+    local_map.def("remove_far_voxels", &LocalMap::RemoveFarVoxels,
+                  py::call_guard<py::gil_scoped_release>(),
+                  "Remove the voxels whose center is farther than radius "
+                  "from center, usually the sensor position.",
+                  "center"_a, "radius"_a);
+    local_map.def("clear", &LocalMap::Clear, "Remove all the points.");
+    local_map.def("size", &LocalMap::Size, "Number of voxels.");
+    local_map.def("get_num_points", &LocalMap::GetNumPoints,
+                  "Number of points.");
+    local_map.def("get_point_cloud", &LocalMap::GetPointCloud,
+                  "Points of the map as a point cloud.");
+    local_map.def("get_icp_target", &LocalMap::GetICPTarget,
+                  py::return_value_policy::reference_internal,
+                  "Single scale ICPTargetPyramid of the map for point to "
+                  "point multi_scale_icp, kept until the map changes.",
+                  "max_correspondence_distance"_a);
+    local_map.def_property_readonly("voxel_size", &LocalMap::GetVoxelSize);
+    local_map.def_property_readonly("max_points_per_voxel",
+                                    &LocalMap::GetMaxPointsPerVoxel);
+    local_map.def_property_readonly("device", &LocalMap::GetDevice);
+}
+
+void pybind_slam_loop_closure(py::module &m) {
+    py::class_<LoopClosureParams> loop_closure_params(
+            m, "LoopClosureParams",
+            "Descriptor and verification parameters of LoopClosureDetector.");
+    py::detail::bind_copy_functions<LoopClosureParams>(loop_closure_params);
+    loop_closure_params
+            .def(py::init<const int, const int, const int, const float,
+                          const int, const float, const float, const float>(),
+                 "descriptor_width"_a = 16, "descriptor_height"_a = 12,
+                 "num_candidates"_a = 5, "min_similarity"_a = 0.8,
+                 "min_keyframe_gap"_a = 10, "voxel_size"_a = 0.05,
+                 "max_correspondence_distance"_a = 0.1,
+                 "fitness_threshold"_a = 0.3)
+            .def_readwrite("descriptor_width",
+                           &LoopClosureParams::descriptor_width_,
+                           "Number of grid cells along the image width of "
+                           "the global descriptors.")
+            .def_readwrite("descriptor_height",
+                           &LoopClosureParams::descriptor_height_,
+                           "Number of grid cells along the image height of "
+                           "the global descriptors.")
+            .def_readwrite("num_candidates",
+                           &LoopClosureParams::num_candidates_,
+                           "Maximum number of candidates verified per query "
+                           "keyframe.")
+            .def_readwrite("min_similarity",
+                           &LoopClosureParams::min_similarity_,
+                           "Minimum cosine similarity of the descriptors of a "
+                           "candidate.")
+            .def_readwrite("min_keyframe_gap",
+                           &LoopClosureParams::min_keyframe_gap_,
+                           "Number of most recent keyframes excluded from the "
+                           "candidates.")
+            .def_readwrite("voxel_size", &LoopClosureParams::voxel_size_,
+                           "Voxel size to downsample the keyframe point "
+                           "clouds.")
+            .def_readwrite("max_correspondence_distance",
+                           &LoopClosureParams::max_correspondence_distance_,
+                           "Maximum correspondence distance of the ICP "
+                           "verification.")
+            .def_readwrite("fitness_threshold",
+                           &LoopClosureParams::fitness_threshold_,
+                           "Minimum ICP fitness of an accepted loop closure.");
+
+    py::class_<LoopClosure> loop_closure(
+            m, "LoopClosure", "A verified loop closure between two keyframes.");
+    loop_closure
+            .def_readonly("source_id", &LoopClosure::source_id_,
+                          "Earlier keyframe, the source node of the pose "
+                          "graph edge.")
+            .def_readonly("target_id", &LoopClosure::target_id_,
+                          "Query keyframe, the target node of the pose graph "
+                          "edge.")
+            .def_readonly("similarity", &LoopClosure::similarity_,
+                          "Cosine similarity of the descriptors.")
+            .def_readonly("result", &LoopClosure::result_,
+                          "ICP result, with the source to target "
+                          "transformation.")
+            .def("__repr__", [](const LoopClosure &loop_closure) {
+                return fmt::format(
+                        "LoopClosure[source_id={}, target_id={}, "
+                        "similarity={:e}, fitness={:e}, inlier_rmse={:e}].",
+                        loop_closure.source_id_, loop_closure.target_id_,
+                        loop_closure.similarity_,
+                        loop_closure.result_.fitness_,
+                        loop_closure.result_.inlier_rmse_);
+            });
+
+    py::class_<LoopClosureDetector> detector(
+            m, "LoopClosureDetector",
+            "Keyframe database proposing loop closures by global descriptor "
+            "similarity and verifying them with batched point to plane ICP.");
+    detector.def(py::init<const core::Tensor &, const LoopClosureParams &,
+                          const core::Device &>(),
+                 "intrinsics"_a, "params"_a = LoopClosureParams(),
+                 "device"_a = core::Device("CPU:0"));
+    detector.def("add_keyframe", &LoopClosureDetector::AddKeyframe,
+                 py::call_guard<py::gil_scoped_release>(),
+                 "Add a keyframe with its 4x4 frame to world pose and an "
+                 "odometry edge from the previous keyframe. Returns the "
+                 "keyframe id.",
+                 "rgbd"_a, "transformation"_a, "depth_scale"_a = 1000.0f,
+                 "depth_max"_a = 3.0f);
+    detector.def("compute_descriptor", &LoopClosureDetector::ComputeDescriptor,
+                 "Unit length global descriptor of an RGBD image.", "rgbd"_a,
+                 "depth_scale"_a = 1000.0f, "depth_max"_a = 3.0f);
+    detector.def("get_candidates", &LoopClosureDetector::GetCandidates,
+                 "Candidate keyframe ids and descriptor similarities of a "
+                 "keyframe, most similar first.",
+                 "keyframe_id"_a);
+    detector.def("detect_loop_closures",
+                 &LoopClosureDetector::DetectLoopClosures,
+                 py::call_guard<py::gil_scoped_release>(),
+                 "Verify the candidates of a keyframe with ICP and add the "
+                 "accepted loop closures to the pose graph.",
+                 "keyframe_id"_a);
+    detector.def("update_keyframe_poses",
+                 &LoopClosureDetector::UpdateKeyframePoses,
+                 "Set the keyframe poses from the nodes of an optimized pose "
+                 "graph.",
+                 "pose_graph"_a);
+    detector.def("get_pose_graph", &LoopClosureDetector::GetPoseGraph,
+                 "Pose graph of the keyframes.");
+    detector.def("get_keyframe_pose", &LoopClosureDetector::GetKeyframePose,
+                 "keyframe_id"_a);
+    detector.def("get_keyframe_point_cloud",
+                 &LoopClosureDetector::GetKeyframePointCloud,
+                 "Downsampled point cloud of a keyframe, with normals.",
+                 "keyframe_id"_a);
+    detector.def_property_readonly("num_keyframes",
+                                   &LoopClosureDetector::GetNumKeyframes);
+    detector.def_property_readonly("params", &LoopClosureDetector::GetParams);
+    detector.def_property_readonly("device", &LoopClosureDetector::GetDevice);
+}
+
 void pybind_slam(py::module &m) {
     py::module m_submodule =
             m.def_submodule("slam", "Tensor DenseSLAM pipeline.");
     pybind_slam_model(m_submodule);
+    pybind_slam_submap_model(m_submodule);
     pybind_slam_frame(m_submodule);
+    pybind_slam_local_map(m_submodule);
+    pybind_slam_loop_closure(m_submodule);
 }
 
 }  // namespace slam
@@ -0,0 +1,68 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/utility/Tracing.h"
+
+#include "pybind/docstring.h"
+#include "pybind/open3d_pybind.h"
+
+namespace open3d {
+namespace utility {
+
+void pybind_tracing(py::module& m) {
+    py::module m_tracing = m.def_submodule(
+            "tracing",
+            "Record the host wall time of instrumented Open3D operations and "
+            "export it as a Chrome trace.");
+
+    m_tracing.def("enable", &tracing::Enable,
+                  "Start recording trace zones. If ``nvtx`` is True and Open3D "
+                  "is built with CUDA, zones are also emitted as NVTX ranges. "
+                  "At most ``max_events`` zones are kept.",
+                  "nvtx"_a = false, "max_events"_a = 1000000);
+    m_tracing.def("disable", &tracing::Disable,
+                  "Stop recording trace zones. Recorded zones are kept.");
+    m_tracing.def("is_enabled", &tracing::IsEnabled,
+                  "Returns True if trace zones are being recorded.");
+    m_tracing.def("clear", &tracing::Clear, "Discard all recorded zones.");
+    m_tracing.def("get_num_events", &tracing::GetNumEvents,
+                  "Returns the number of recorded zones.");
+    m_tracing.def("get_num_dropped_events", &tracing::GetNumDroppedEvents,
+                  "Returns the number of zones dropped because max_events was "
+                  "reached.");
+    m_tracing.def("get_chrome_trace", &tracing::GetChromeTrace,
+                  "Returns the recorded zones as a Chrome trace event JSON "
+                  "string.");
+    m_tracing.def("write_chrome_trace", &tracing::WriteChromeTrace,
+                  "Writes the recorded zones as a Chrome trace event JSON "
+                  "file, which can be opened with chrome://tracing or "
+                  "https://ui.perfetto.dev.",
+                  "filename"_a);
+}
+
+}  // namespace utility
+}  // namespace open3d
@@ -26,6 +26,7 @@
 
 #include "pybind/utility/utility.h"
 
+#include "open3d/utility/Parallel.h"
 #include "pybind/docstring.h"
 #include "pybind/open3d_pybind.h"
 
@@ -36,6 +37,16 @@ void pybind_utility(py::module &m) {
     py::module m_submodule = m.def_submodule("utility");
     pybind_logging(m_submodule);
     pybind_eigen(m_submodule);
+    pybind_tracing(m_submodule);
+
+    m_submodule.def("set_max_threads", &SetMaxThreads,
+                    "Limit the number of threads used by Open3D CPU "
+                    "operations. Use this when Open3D runs next to other "
+                    "thread pools. A value <= 0 restores the default.",
+                    "max_threads"_a);
+    m_submodule.def("get_max_threads", &EstimateMaxThreads,
+                    "Get the number of threads used by Open3D CPU "
+                    "operations.");
 }
 
 }  // namespace utility
@@ -25,6 +25,7 @@
 // ----------------------------------------------------------------------------
 
 #include "open3d/camera/PinholeCameraIntrinsic.h"
+#include "open3d/core/Tensor.h"
 #include "open3d/t/geometry/Geometry.h"
 #include "open3d/t/geometry/PointCloud.h"
 #include "open3d/visualization/rendering/ColorGrading.h"
@@ -81,6 +82,22 @@ public:
                                                     z_in_view_space);
     }
 
+    std::pair<core::Tensor, core::Tensor> RenderBatch(
+            const std::vector<Eigen::Matrix4d, utility::Matrix4d_allocator>
+                    &poses,
+            bool render_depth,
+            bool z_in_view_space) {
+        // As in RenderToImage(), the viewport controls the image size.
+        scene_->GetView()->SetViewport(0, 0, width_, height_);
+        core::Tensor color, depth;
+        py::gil_scoped_release release;
+        renderer_->RenderBatchToTensors(scene_->GetView(), scene_->GetScene(),
+                                        poses, color,
+                                        render_depth ? &depth : nullptr,
+                                        z_in_view_space);
+        return {color, depth};
+    }
+
     void SetupCamera(const camera::PinholeCameraIntrinsic &intrinsic,
                      const Eigen::Matrix4d &extrinsic) {
         SetupCamera(intrinsic.intrinsic_matrix_, extrinsic, intrinsic.width_,
@@ -213,7 +230,18 @@ void pybind_rendering_classes(py::module &m) {
                  "the image is returned. Pixels range from 0 (near plane) to "
                  "1 (far plane). If z_in_view_space is set to True then pixels "
                  "are pre-transformed into view space (i.e., distance from "
-                 "camera).");
+                 "camera).")
+            .def("render_batch", &PyOffscreenRenderer::RenderBatch,
+                 "poses"_a, "render_depth"_a = false,
+                 "z_in_view_space"_a = false,
+                 "Renders the scene once per camera pose (a "
+                 "utility.Matrix4dVector of camera-to-world matrices) and "
+                 "returns a tuple (color, "
+                 "depth) of Tensors with shapes {N, H, W, 3} UInt8 and {N, H, "
+                 "W} Float32. The frames are pipelined with asynchronous "
+                 "readback, which is much faster than calling "
+                 "render_to_image() per pose. depth is empty unless "
+                 "render_depth is True.");
 
     // ---- Camera ----
     py::class_<Camera, std::shared_ptr<Camera>> cam(m, "Camera",
@@ -522,13 +550,17 @@ void pybind_rendering_classes(py::module &m) {
                  "downsampled_name"_a = "", "downsample_threshold"_a = SIZE_MAX,
                  "Adds a Geometry with a material to the scene")
             .def("add_geometry",
-                 (bool (Scene::*)(
-                         const std::string &, const t::geometry::Geometry &,
-                         const MaterialRecord &, const std::string &, size_t)) &
+                 (bool (Scene::*)(const std::string &,
+                                  const t::geometry::Geometry &,
+                                  const MaterialRecord &, const std::string &,
+                                  size_t, size_t)) &
                          Scene::AddGeometry,
                  "name"_a, "geometry"_a, "material"_a,
                  "downsampled_name"_a = "", "downsample_threshold"_a = SIZE_MAX,
-                 "Adds a Geometry with a material to the scene")
+                 "vertex_capacity"_a = 0,
+                 "Adds a Geometry with a material to the scene. For point "
+                 "clouds, vertex_capacity reserves room for that many points "
+                 "so that append_geometry() does not reallocate the buffers.")
             .def("has_geometry", &Scene::HasGeometry,
                  "Returns True if a geometry with the provided name exists in "
                  "the scene.")
@@ -537,6 +569,17 @@ void pybind_rendering_classes(py::module &m) {
                  "The flags should be ORed from Scene.UPDATE_POINTS_FLAG, "
                  "Scene.UPDATE_NORMALS_FLAG, Scene.UPDATE_COLORS_FLAG, and "
                  "Scene.UPDATE_UV0_FLAG")
+            .def("update_geometry_range", &Scene::UpdateGeometryRange,
+                 "Overwrites the points starting at first_point with the "
+                 "points of the tgeometry.PointCloud, uploading only the "
+                 "flagged arrays. The range must lie within the current point "
+                 "count.",
+                 "name"_a, "point_cloud"_a, "first_point"_a, "update_flags"_a)
+            .def("append_geometry", &Scene::AppendGeometry,
+                 "Appends the points of the tgeometry.PointCloud and uploads "
+                 "only the new points. Returns False if the point cloud was "
+                 "added without enough vertex_capacity.",
+                 "name"_a, "point_cloud"_a)
             .def("enable_indirect_light", &Scene::EnableIndirectLight,
                  "Enables or disables indirect lighting")
             .def("set_indirect_light", &Scene::SetIndirectLight,
@@ -696,7 +739,23 @@ void pybind_rendering_classes(py::module &m) {
                           &Open3DScene::SetDownsampleThreshold,
                           "Minimum number of points before downsampled point "
                           "clouds are created and used when rendering speed "
-                          "is important");
+                          "is important")
+            .def_property("point_cloud_lod_threshold",
+                          &Open3DScene::GetPointCloudLODThreshold,
+                          &Open3DScene::SetPointCloudLODThreshold,
+                          "Minimum number of points before tensor point "
+                          "clouds are split into an octree of chunks that are "
+                          "streamed to the GPU as the camera moves")
+            .def("set_point_cloud_lod_quality",
+                 &Open3DScene::SetPointCloudLODQuality,
+                 "Sets the screen-space error in pixels up to which octree "
+                 "chunks are refined and the maximum number of points drawn "
+                 "per point cloud",
+                 "max_screen_space_error"_a, "point_budget"_a)
+            .def("update_point_cloud_lod", &Open3DScene::UpdatePointCloudLOD,
+                 "Uploads the octree chunks needed for the current camera. "
+                 "Returns True if chunks are still missing. SceneWidget calls "
+                 "this every frame; call it before rendering offscreen.");
 }
 
 void pybind_rendering(py::module &m) {
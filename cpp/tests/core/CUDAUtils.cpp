@@ -31,6 +31,8 @@
 #include <thread>
 #include <vector>
 
+#include "open3d/core/Tensor.h"
+#include "open3d/core/hashmap/HashMap.h"
 #include "tests/Tests.h"
 
 namespace open3d {
@@ -48,6 +50,27 @@ TEST(CUDAUtils, InitState) {
     }
 }
 
+TEST(CUDAUtils, CachedDeviceQueries) {
+    EXPECT_EQ(core::cuda::DeviceCount(), core::cuda::DeviceCount());
+
+    const int current_device = core::cuda::GetDevice();
+    for (int i = 0; i < core::cuda::DeviceCount(); ++i) {
+        core::CUDAScopedDevice scoped_device(i);
+        EXPECT_EQ(core::cuda::GetDevice(), i);
+
+        int warp_size;
+        int texture_alignment;
+        OPEN3D_CUDA_CHECK(
+                cudaDeviceGetAttribute(&warp_size, cudaDevAttrWarpSize, i));
+        OPEN3D_CUDA_CHECK(cudaDeviceGetAttribute(
+                &texture_alignment, cudaDevAttrTextureAlignment, i));
+        EXPECT_EQ(core::GetCUDACurrentWarpSize(), warp_size);
+        EXPECT_EQ(core::GetCUDACurrentDeviceTextureAlignment(),
+                  texture_alignment);
+    }
+    EXPECT_EQ(core::cuda::GetDevice(), current_device);
+}
+
 void CheckScopedStreamManually() {
     int current_device = core::cuda::GetDevice();
 
@@ -125,6 +148,60 @@ TEST(CUDAUtils, ScopedStreamAutomaticallyMultiThreaded) {
     CheckScopedStreamMultiThreaded(&CheckScopedStreamAutomatically);
 }
 
+TEST(CUDAUtils, CUDAStream) {
+    core::Device device("CUDA:0");
+    EXPECT_ANY_THROW(core::CUDAStream(core::Device("CPU:0")));
+
+    core::CUDAStream stream(device);
+    EXPECT_EQ(stream.GetDevice(), device);
+    EXPECT_NE(stream.Get(), core::cuda::GetDefaultStream());
+
+    core::Tensor keys = core::Tensor::Arange(0, 1000, 1, core::Int32, device)
+                                .Reshape({1000, 1});
+    core::Tensor values = core::Tensor::Ones({1000, 1}, core::Float32, device);
+    core::Tensor sum;
+    core::Tensor masks;
+    {
+        core::CUDAScopedStream scoped_stream(stream);
+        ASSERT_EQ(core::cuda::GetStream(), stream.Get());
+
+        core::HashMap hashmap(1000, core::Int32, {1}, core::Float32, {1},
+                              device);
+        core::Tensor buf_indices;
+        hashmap.Insert(keys, values, buf_indices, masks);
+        sum = (keys.To(core::Float32) + values).Sum({0});
+        core::cuda::SynchronizeStream(device);
+    }
+    stream.Synchronize();
+    ASSERT_EQ(core::cuda::GetStream(), core::cuda::GetDefaultStream());
+
+    EXPECT_EQ(masks.To(core::Int64).Sum({0}).Item<int64_t>(), 1000);
+    EXPECT_EQ(sum.To(core::Device("CPU:0")).Item<float>(), 500500.0f);
+}
+
+TEST(CUDAUtils, StreamWaitStream) {
+    const core::Device device("CUDA:0");
+    core::CUDAStream producer(device);
+    core::CUDAStream consumer(device);
+
+    core::Tensor values = core::Tensor::Ones({1000}, core::Float32, device);
+    core::Tensor sum;
+    {
+        core::CUDAScopedStream scoped_stream(producer);
+        values = values * 2;
+    }
+    core::cuda::StreamWaitStream(consumer.Get(), producer.Get());
+    {
+        core::CUDAScopedStream scoped_stream(consumer);
+        sum = values.Sum({0});
+        core::cuda::SynchronizeStream(device);
+    }
+    EXPECT_EQ(sum.To(core::Device("CPU:0")).Item<float>(), 2000.0f);
+
+    // Waiting on the same stream must be a no-op.
+    core::cuda::StreamWaitStream(consumer.Get(), consumer.Get());
+}
+
 }  // namespace tests
 }  // namespace open3d
 
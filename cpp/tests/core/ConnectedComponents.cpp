@@ -0,0 +1,84 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/core/kernel/ConnectedComponents.h"
+
+#include <vector>
+
+#include "tests/Tests.h"
+#include "tests/core/CoreTest.h"
+
+namespace open3d {
+namespace tests {
+
+class ConnectedComponentsPermuteDevices : public PermuteDevices {};
+INSTANTIATE_TEST_SUITE_P(ConnectedComponents,
+                         ConnectedComponentsPermuteDevices,
+                         testing::ValuesIn(PermuteDevices::TestCases()));
+
+TEST_P(ConnectedComponentsPermuteDevices, Labels) {
+    core::Device device = GetParam();
+
+    // Components {0, 2, 5}, {1, 4}, {3} and {6}, with a self loop and a
+    // duplicate edge.
+    const core::Tensor edges = core::Tensor::Init<int64_t>(
+            {{5, 2}, {4, 1}, {2, 0}, {3, 3}, {0, 5}, {1, 4}}, device);
+    core::Tensor labels;
+    core::kernel::ConnectedComponents(edges, 7, labels);
+    EXPECT_EQ(labels.GetDevice(), device);
+    EXPECT_EQ(labels.ToFlatVector<int64_t>(),
+              std::vector<int64_t>({0, 1, 0, 3, 1, 0, 6}));
+
+    core::kernel::ConnectedComponents(
+            core::Tensor::Empty({0, 2}, core::Int64, device), 3, labels);
+    EXPECT_EQ(labels.ToFlatVector<int64_t>(), std::vector<int64_t>({0, 1, 2}));
+
+    EXPECT_ANY_THROW(core::kernel::ConnectedComponents(edges, 5, labels));
+    EXPECT_ANY_THROW(core::kernel::ConnectedComponents(
+            edges.To(core::Int32), 7, labels));
+}
+
+TEST_P(ConnectedComponentsPermuteDevices, Chain) {
+    core::Device device = GetParam();
+
+    // A long chain with its edges in reverse order merges many roots
+    // concurrently.
+    const int64_t n = 100000;
+    std::vector<int64_t> edges_data(2 * (n - 1));
+    for (int64_t i = 0; i < n - 1; ++i) {
+        edges_data[2 * i] = n - 1 - i;
+        edges_data[2 * i + 1] = n - 2 - i;
+    }
+    core::Tensor labels;
+    core::kernel::ConnectedComponents(
+            core::Tensor(edges_data, {n - 1, 2}, core::Int64, device), n,
+            labels);
+    EXPECT_TRUE(labels.AllEqual(core::Tensor::Zeros({n}, core::Int64, device)));
+}
+
+}  // namespace tests
+}  // namespace open3d
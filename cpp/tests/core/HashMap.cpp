@@ -26,6 +26,8 @@
 
 #include "open3d/core/hashmap/HashMap.h"
 
+#include <algorithm>
+#include <numeric>
 #include <random>
 #include <unordered_map>
 
@@ -33,7 +35,9 @@
 #include "open3d/core/Indexer.h"
 #include "open3d/core/MemoryManager.h"
 #include "open3d/core/SizeVector.h"
+#include "open3d/core/hashmap/Dispatch.h"
 #include "open3d/core/hashmap/HashSet.h"
+#include "open3d/t/io/HashMapIO.h"
 #include "open3d/utility/FileSystem.h"
 #include "open3d/utility/Optional.h"
 #include "tests/Tests.h"
@@ -82,6 +86,7 @@ TEST_P(HashMapPermuteDevices, SimpleInit) {
         backends.push_back(core::HashBackendType::StdGPU);
     } else {
         backends.push_back(core::HashBackendType::TBB);
+        backends.push_back(core::HashBackendType::Flat);
     }
 
     for (auto backend : backends) {
@@ -112,6 +117,7 @@ TEST_P(HashMapPermuteDevices, Find) {
         backends.push_back(core::HashBackendType::StdGPU);
     } else {
         backends.push_back(core::HashBackendType::TBB);
+        backends.push_back(core::HashBackendType::Flat);
     }
 
     const int n = 1000000;
@@ -156,6 +162,7 @@ TEST_P(HashMapPermuteDevices, Insert) {
         backends.push_back(core::HashBackendType::StdGPU);
     } else {
         backends.push_back(core::HashBackendType::TBB);
+        backends.push_back(core::HashBackendType::Flat);
     }
 
     const int n = 1000000;
@@ -201,6 +208,65 @@ TEST_P(HashMapPermuteDevices, Insert) {
     }
 }
 
+TEST_P(HashMapPermuteDevices, FindOrInsert) {
+    core::Device device = GetParam();
+    std::vector<core::HashBackendType> backends;
+    if (device.GetType() == core::Device::DeviceType::CUDA) {
+        backends.push_back(core::HashBackendType::Slab);
+        backends.push_back(core::HashBackendType::StdGPU);
+    } else {
+        backends.push_back(core::HashBackendType::TBB);
+        backends.push_back(core::HashBackendType::Flat);
+    }
+
+    const int n = 1000000;
+    const int slots = 1023;
+    int init_capacity = slots * 2;
+    HashData<int, int> data(n, slots);
+
+    core::Tensor keys(data.keys_, {n}, core::Int32, device);
+    core::Tensor values(data.vals_, {n}, core::Int32, device);
+
+    for (auto backend : backends) {
+        core::HashMap hashmap(init_capacity, core::Int32, {1}, core::Int32, {1},
+                              device, backend);
+
+        // Pre-insert the first half of the slots.
+        core::Tensor half_keys = keys.Slice(0, 0, n / 2);
+        core::Tensor half_values = values.Slice(0, 0, n / 2);
+        core::Tensor half_masks;
+        std::tie(std::ignore, half_masks) =
+                hashmap.Insert(half_keys, half_values);
+        int64_t half_count =
+                half_masks.To(core::Int64).Sum({0}).Item<int64_t>();
+
+        core::Tensor buf_indices, masks;
+        hashmap.FindOrInsert(keys, {values}, buf_indices, masks);
+        EXPECT_EQ(masks.To(core::Int64).Sum({0}).Item<int64_t>(),
+                  slots - half_count);
+        EXPECT_EQ(hashmap.Size(), slots);
+
+        // All indices are valid and point to the matching entries.
+        core::Tensor indices = buf_indices.To(core::Int64);
+        core::Tensor found_keys = hashmap.GetKeyTensor().IndexGet({indices});
+        core::Tensor found_values =
+                hashmap.GetValueTensor().IndexGet({indices});
+        EXPECT_TRUE(found_keys.AllEqual(keys.View({n, 1})));
+        EXPECT_TRUE(found_values.AllEqual(values.View({n, 1})));
+
+        // Consistent with Find.
+        core::Tensor find_buf_indices, find_masks;
+        hashmap.Find(keys, find_buf_indices, find_masks);
+        EXPECT_TRUE(find_masks.All());
+        EXPECT_TRUE(find_buf_indices.AllEqual(buf_indices));
+
+        // Keys only: nothing new to activate.
+        std::tie(buf_indices, masks) = hashmap.FindOrInsert(keys);
+        EXPECT_FALSE(masks.Any());
+        EXPECT_TRUE(find_buf_indices.AllEqual(buf_indices));
+    }
+}
+
 TEST_P(HashMapPermuteDevices, Erase) {
     core::Device device = GetParam();
     std::vector<core::HashBackendType> backends;
@@ -209,6 +275,7 @@ TEST_P(HashMapPermuteDevices, Erase) {
         backends.push_back(core::HashBackendType::StdGPU);
     } else {
         backends.push_back(core::HashBackendType::TBB);
+        backends.push_back(core::HashBackendType::Flat);
     }
 
     const int n = 1000000;
@@ -272,6 +339,7 @@ TEST_P(HashMapPermuteDevices, Reserve) {
         backends.push_back(core::HashBackendType::StdGPU);
     } else {
         backends.push_back(core::HashBackendType::TBB);
+        backends.push_back(core::HashBackendType::Flat);
     }
 
     const int n = 1000000;
@@ -318,6 +386,213 @@ TEST_P(HashMapPermuteDevices, Reserve) {
     }
 }
 
+TEST_P(HashMapPermuteDevices, GrowInPlace) {
+    core::Device device = GetParam();
+    // Backends that grow without rebuilding and keep the buffer indices.
+    std::vector<core::HashBackendType> backends;
+    if (device.GetType() == core::Device::DeviceType::CUDA) {
+        backends.push_back(core::HashBackendType::Slab);
+    } else {
+        backends.push_back(core::HashBackendType::TBB);
+        backends.push_back(core::HashBackendType::Flat);
+    }
+
+    const int n = 1000;
+    std::vector<int> keys_val(n), values_val(n);
+    std::iota(keys_val.begin(), keys_val.end(), 0);
+    std::iota(values_val.begin(), values_val.end(), n);
+    core::Tensor keys(keys_val, {n}, core::Int32, device);
+    core::Tensor values(values_val, {n}, core::Int32, device);
+
+    for (auto backend : backends) {
+        int init_capacity = 600;
+        core::HashMap hashmap(init_capacity, core::Int32, {1}, core::Int32, {1},
+                              device, backend);
+
+        // The first half fits, the second half triggers growth.
+        core::Tensor buf_indices0, masks0;
+        hashmap.Insert(keys.Slice(0, 0, n / 2), values.Slice(0, 0, n / 2),
+                       buf_indices0, masks0);
+        core::Tensor buf_indices1, masks1;
+        hashmap.Insert(keys.Slice(0, n / 2, n), values.Slice(0, n / 2, n),
+                       buf_indices1, masks1);
+        EXPECT_TRUE(masks0.All());
+        EXPECT_TRUE(masks1.All());
+        EXPECT_EQ(hashmap.Size(), n);
+        EXPECT_GE(hashmap.GetCapacity(), n);
+
+        // Entries inserted before the growth keep their buffer indices.
+        core::Tensor buf_indices, masks;
+        hashmap.Find(keys.Slice(0, 0, n / 2), buf_indices, masks);
+        EXPECT_TRUE(masks.All());
+        EXPECT_TRUE(buf_indices.AllEqual(buf_indices0));
+
+        // New indices are unique.
+        hashmap.Find(keys, buf_indices, masks);
+        EXPECT_TRUE(masks.All());
+        std::vector<int> buf_indices_vec = buf_indices.ToFlatVector<int>();
+        std::sort(buf_indices_vec.begin(), buf_indices_vec.end());
+        EXPECT_EQ(std::unique(buf_indices_vec.begin(), buf_indices_vec.end()),
+                  buf_indices_vec.end());
+
+        core::Tensor found_values = hashmap.GetValueTensor().IndexGet(
+                {buf_indices.To(core::Int64)});
+        EXPECT_TRUE(found_values.AllEqual(values.View({n, 1})));
+    }
+}
+
+TEST_P(HashMapPermuteDevices, Compact) {
+    core::Device device = GetParam();
+    std::vector<core::HashBackendType> backends;
+    if (device.GetType() == core::Device::DeviceType::CUDA) {
+        backends.push_back(core::HashBackendType::Slab);
+        backends.push_back(core::HashBackendType::StdGPU);
+    } else {
+        backends.push_back(core::HashBackendType::TBB);
+        backends.push_back(core::HashBackendType::Flat);
+    }
+
+    const int n = 1000;
+    std::vector<int> keys_val(n), values_val(n);
+    std::iota(keys_val.begin(), keys_val.end(), 0);
+    std::iota(values_val.begin(), values_val.end(), n);
+    core::Tensor keys(keys_val, {n}, core::Int32, device);
+    core::Tensor values(values_val, {n}, core::Int32, device);
+
+    // Erase the even keys to fragment the buffer.
+    std::vector<int> erase_keys_val;
+    std::vector<int> remain_keys_val, remain_values_val;
+    for (int i = 0; i < n; ++i) {
+        if (i % 2 == 0) {
+            erase_keys_val.push_back(keys_val[i]);
+        } else {
+            remain_keys_val.push_back(keys_val[i]);
+            remain_values_val.push_back(values_val[i]);
+        }
+    }
+    int m = static_cast<int>(remain_keys_val.size());
+    core::Tensor erase_keys(erase_keys_val, {n - m}, core::Int32, device);
+    core::Tensor remain_keys(remain_keys_val, {m}, core::Int32, device);
+    core::Tensor remain_values(remain_values_val, {m, 1}, core::Int32,
+                               device);
+
+    for (auto backend : backends) {
+        core::HashMap hashmap(n, core::Int32, {1}, core::Int32, {1}, device,
+                              backend);
+        hashmap.Insert(keys, values);
+        hashmap.Erase(erase_keys);
+        EXPECT_EQ(hashmap.Size(), m);
+
+        core::Tensor old_buf_indices, new_buf_indices;
+        std::tie(old_buf_indices, new_buf_indices) = hashmap.Compact();
+        EXPECT_EQ(old_buf_indices.GetLength(), m);
+        EXPECT_EQ(new_buf_indices.GetLength(), m);
+        EXPECT_EQ(hashmap.Size(), m);
+        EXPECT_EQ(hashmap.GetCapacity(), n);
+
+        core::Tensor buf_indices, masks;
+        hashmap.Find(remain_keys, buf_indices, masks);
+        EXPECT_TRUE(masks.All());
+        EXPECT_LT(buf_indices.Max({0}).Item<int>(), m);
+
+        core::Tensor found_values = hashmap.GetValueTensor().IndexGet(
+                {buf_indices.To(core::Int64)});
+        EXPECT_TRUE(found_values.AllEqual(remain_values));
+
+        hashmap.Find(erase_keys, buf_indices, masks);
+        EXPECT_FALSE(masks.Any());
+    }
+}
+
+TEST(HashMap, PackedKeyHash) {
+    // Dense voxel block coordinates around the origin must spread evenly over
+    // a power-of-two bucket count, which a per-coordinate FNV round does not.
+    const int64_t bucket_count = 1024;
+    std::vector<int> bucket_loads(bucket_count, 0);
+    utility::MiniVecHash<int, 3> hash3;
+    utility::MiniVecEq<int, 3> eq3;
+    for (int x = -8; x < 8; ++x) {
+        for (int y = -8; y < 8; ++y) {
+            for (int z = -8; z < 8; ++z) {
+                utility::MiniVec<int, 3> key;
+                key[0] = x;
+                key[1] = y;
+                key[2] = z;
+                bucket_loads[hash3(key) % bucket_count]++;
+                EXPECT_TRUE(eq3(key, key));
+            }
+        }
+    }
+    EXPECT_LE(*std::max_element(bucket_loads.begin(), bucket_loads.end()), 16);
+
+    utility::MiniVec<int, 3> a, b;
+    a[0] = 1, a[1] = 2, a[2] = 3;
+    b[0] = 3, b[1] = 2, b[2] = 1;
+    EXPECT_FALSE(eq3(a, b));
+    EXPECT_NE(hash3(a), hash3(b));
+
+    // Consecutive Morton codes only differ in their low bits.
+    std::fill(bucket_loads.begin(), bucket_loads.end(), 0);
+    utility::MiniVecHash<int64_t, 1> hash1;
+    for (int64_t code = 0; code < 4096; ++code) {
+        utility::MiniVec<int64_t, 1> key;
+        key[0] = code << 12;
+        bucket_loads[hash1(key) % bucket_count]++;
+    }
+    EXPECT_LE(*std::max_element(bucket_loads.begin(), bucket_loads.end()), 16);
+}
+
+TEST_P(HashMapPermuteDevices, EraseChurn) {
+    core::Device device = GetParam();
+    std::vector<core::HashBackendType> backends;
+    if (device.GetType() == core::Device::DeviceType::CUDA) {
+        backends.push_back(core::HashBackendType::Slab);
+        backends.push_back(core::HashBackendType::StdGPU);
+    } else {
+        backends.push_back(core::HashBackendType::TBB);
+        backends.push_back(core::HashBackendType::Flat);
+    }
+
+    // Each round replaces all entries, so that the erased entries of the
+    // previous round have to be reclaimed for the map to keep working.
+    const int n = 1000;
+    const int num_rounds = 6;
+    for (auto backend : backends) {
+        core::HashMap hashmap(n, core::Int32, {1}, core::Int32, {1}, device,
+                              backend);
+        core::Tensor prev_keys;
+        for (int round = 0; round < num_rounds; ++round) {
+            std::vector<int> keys_val(n), values_val(n);
+            std::iota(keys_val.begin(), keys_val.end(), round * n);
+            std::iota(values_val.begin(), values_val.end(), -round * n);
+            core::Tensor keys(keys_val, {n}, core::Int32, device);
+            core::Tensor values(values_val, {n, 1}, core::Int32, device);
+
+            core::Tensor buf_indices, masks;
+            if (round > 0) {
+                hashmap.Erase(prev_keys, masks);
+                EXPECT_TRUE(masks.All());
+                EXPECT_EQ(hashmap.Size(), 0);
+            }
+            hashmap.Insert(keys, values, buf_indices, masks);
+            EXPECT_TRUE(masks.All());
+            EXPECT_EQ(hashmap.Size(), n);
+            EXPECT_EQ(hashmap.GetActiveIndices().GetLength(), n);
+
+            hashmap.Find(keys, buf_indices, masks);
+            EXPECT_TRUE(masks.All());
+            core::Tensor found_values = hashmap.GetValueTensor().IndexGet(
+                    {buf_indices.To(core::Int64)});
+            EXPECT_TRUE(found_values.AllEqual(values));
+            if (round > 0) {
+                hashmap.Find(prev_keys, buf_indices, masks);
+                EXPECT_FALSE(masks.Any());
+            }
+            prev_keys = keys;
+        }
+    }
+}
+
 TEST_P(HashMapPermuteDevices, Clear) {
     core::Device device = GetParam();
     std::vector<core::HashBackendType> backends;
@@ -326,6 +601,7 @@ TEST_P(HashMapPermuteDevices, Clear) {
         backends.push_back(core::HashBackendType::StdGPU);
     } else {
         backends.push_back(core::HashBackendType::TBB);
+        backends.push_back(core::HashBackendType::Flat);
     }
 
     const int n = 1000000;
@@ -404,6 +680,7 @@ TEST_P(HashMapPermuteDevices, InsertComplexKeys) {
         backends.push_back(core::HashBackendType::StdGPU);
     } else {
         backends.push_back(core::HashBackendType::TBB);
+        backends.push_back(core::HashBackendType::Flat);
     }
 
     const int n = 1000000;
@@ -463,6 +740,7 @@ TEST_P(HashMapPermuteDevices, MultivalueInsertion) {
         backends.push_back(core::HashBackendType::StdGPU);
     } else {
         backends.push_back(core::HashBackendType::TBB);
+        backends.push_back(core::HashBackendType::Flat);
     }
 
     const int n = 1000000;
@@ -536,6 +814,7 @@ TEST_P(HashMapPermuteDevices, HashSet) {
         backends.push_back(core::HashBackendType::StdGPU);
     } else {
         backends.push_back(core::HashBackendType::TBB);
+        backends.push_back(core::HashBackendType::Flat);
     }
 
     const int n = 1000000;
@@ -602,5 +881,68 @@ TEST_P(HashMapPermuteDevices, HashMapIO) {
     utility::filesystem::RemoveFile(file_name_ext);
 }
 
+TEST_P(HashMapPermuteDevices, HashMapSnapshot) {
+    const core::Device &device = GetParam();
+    const std::string file_name = "hashmap.o3dmap";
+
+    const int n = 10000;
+    const int slots = 1023;
+    int init_capacity = n * 2;
+    HashData<int3, int> data(n, slots);
+
+    std::vector<int> keys_int3;
+    keys_int3.assign(reinterpret_cast<int *>(data.keys_.data()),
+                     reinterpret_cast<int *>(data.keys_.data()) + 3 * n);
+    core::Tensor keys(keys_int3, {n, 3}, core::Int32, device);
+    core::Tensor values(data.vals_, {n}, core::Int32, device);
+
+    core::HashMap hashmap(init_capacity, core::Int32, {3}, core::Int32, {1},
+                          device);
+    hashmap.Insert(keys, values);
+    t::io::WriteHashMapSnapshot(file_name, hashmap);
+
+    t::io::HashMapSnapshot snapshot(file_name);
+    EXPECT_EQ(snapshot.Size(), slots);
+    EXPECT_EQ(snapshot.GetKeyDtype(), core::Int32);
+    EXPECT_EQ(snapshot.GetKeyElementShape(), core::SizeVector({3}));
+    EXPECT_EQ(snapshot.GetValueDtypes().size(), 1);
+    EXPECT_EQ(snapshot.GetValueElementShapes()[0], core::SizeVector({1}));
+
+    // Query in place.
+    core::Tensor indices, masks;
+    std::tie(indices, masks) = snapshot.Find(keys.To(core::Device("CPU:0")));
+    EXPECT_TRUE(masks.All());
+    core::Tensor found_keys = snapshot.GetKeyTensor().IndexGet({indices});
+    core::Tensor found_values = snapshot.GetValueTensor().IndexGet({indices});
+    EXPECT_TRUE(found_keys.AllEqual(keys.To(core::Device("CPU:0"))));
+    EXPECT_TRUE(
+            found_keys.T()[0].AllEqual(found_values.T()[0] * data.k_factor_));
+
+    core::Tensor missing_keys =
+            core::Tensor::Full({2, 3}, -1, core::Int32, core::Device("CPU:0"));
+    std::tie(indices, masks) = snapshot.Find(missing_keys);
+    EXPECT_FALSE(masks.Any());
+
+    // Views keep the mapping alive beyond the snapshot.
+    core::Tensor key_view;
+    {
+        t::io::HashMapSnapshot scoped_snapshot(file_name);
+        key_view = scoped_snapshot.GetKeyTensor();
+    }
+    EXPECT_EQ(key_view.GetLength(), slots);
+    EXPECT_TRUE(key_view.AllEqual(snapshot.GetKeyTensor()));
+
+    core::HashMap hashmap_loaded = snapshot.ToHashMap(device);
+    EXPECT_EQ(hashmap_loaded.Size(), slots);
+    core::Tensor buf_indices;
+    hashmap_loaded.Find(keys, buf_indices, masks);
+    EXPECT_TRUE(masks.All());
+    core::Tensor loaded_values = hashmap_loaded.GetValueTensor().IndexGet(
+            {buf_indices.To(core::Int64)});
+    EXPECT_TRUE(loaded_values.AllEqual(values.View({n, 1})));
+
+    utility::filesystem::RemoveFile(file_name);
+}
+
 }  // namespace tests
 }  // namespace open3d
@@ -0,0 +1,138 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/core/nns/IncrementalNeighborGraph.h"
+
+#include <numeric>
+#include <random>
+
+#include "open3d/core/nns/NearestNeighborSearch.h"
+#include "tests/Tests.h"
+#include "tests/core/CoreTest.h"
+
+namespace open3d {
+namespace tests {
+
+class IncrementalNeighborGraphPermuteDevices : public PermuteDevices {};
+INSTANTIATE_TEST_SUITE_P(IncrementalNeighborGraph,
+                         IncrementalNeighborGraphPermuteDevices,
+                         testing::ValuesIn(PermuteDevices::TestCases()));
+
+static core::Tensor RandomPoints(int64_t n,
+                                 std::mt19937 &rng,
+                                 const core::Device &device) {
+    std::uniform_real_distribution<float> dist(0.f, 1.f);
+    std::vector<float> values(3 * n);
+    for (float &v : values) v = dist(rng);
+    return core::Tensor(values, {n, 3}, core::Float32, device);
+}
+
+static void ExpectSameAsHybridSearch(
+        const core::nns::IncrementalNeighborGraph &graph,
+        double radius,
+        int max_knn) {
+    core::Tensor indices, distances, counts;
+    std::tie(indices, distances, counts) = graph.GetNeighbors();
+
+    const core::Tensor points = graph.GetPoints();
+    core::nns::NearestNeighborSearch nns(points, core::Int32);
+    nns.HybridIndex(radius);
+    core::Tensor gt_indices, gt_distances, gt_counts;
+    std::tie(gt_indices, gt_distances, gt_counts) =
+            nns.HybridSearch(points, radius, max_knn);
+
+    EXPECT_TRUE(counts.AllEqual(gt_counts));
+    EXPECT_TRUE(indices.AllEqual(gt_indices));
+    EXPECT_TRUE(distances.AllClose(gt_distances, 1e-5, 1e-6));
+}
+
+TEST_P(IncrementalNeighborGraphPermuteDevices, InsertRemove) {
+    const core::Device device = GetParam();
+    const double radius = 0.15;
+    const int max_knn = 8;
+    std::mt19937 rng(0);
+
+    core::nns::IncrementalNeighborGraph graph(radius, max_knn, core::Float32,
+                                              device);
+    for (int batch = 0; batch < 3; ++batch) {
+        core::Tensor ids = graph.Insert(RandomPoints(200, rng, device));
+        EXPECT_EQ(ids.GetDtype(), core::Int64);
+        EXPECT_EQ(ids.GetDevice(), device);
+    }
+    EXPECT_EQ(graph.Size(), 600);
+    EXPECT_TRUE(graph.GetIds().AllEqual(core::Tensor::Arange(
+            0, 600, 1, core::Int64, device)));
+    ExpectSameAsHybridSearch(graph, radius, max_knn);
+
+    // Slide a window: drop the oldest batch and insert a new one, whose ids
+    // reuse the removed ones.
+    graph.Remove(core::Tensor::Arange(0, 200, 1, core::Int64, device));
+    EXPECT_EQ(graph.Size(), 400);
+    ExpectSameAsHybridSearch(graph, radius, max_knn);
+    core::Tensor ids = graph.Insert(RandomPoints(200, rng, device));
+    EXPECT_TRUE(ids.AllEqual(
+            core::Tensor::Arange(0, 200, 1, core::Int64, device)));
+    ExpectSameAsHybridSearch(graph, radius, max_knn);
+
+    // A small local batch only updates the lists around it.
+    std::vector<float> local{0.5f, 0.5f, 0.5f, 0.51f, 0.5f, 0.5f};
+    ids = graph.Insert(core::Tensor(local, {2, 3}, core::Float32, device));
+    EXPECT_LT(graph.GetNumUpdatedLists(), graph.Size() / 4);
+    ExpectSameAsHybridSearch(graph, radius, max_knn);
+    graph.Remove(ids);
+    EXPECT_LT(graph.GetNumUpdatedLists(), graph.Size() / 4);
+    ExpectSameAsHybridSearch(graph, radius, max_knn);
+
+    // Scattered removals.
+    std::vector<int64_t> scattered(100);
+    std::iota(scattered.begin(), scattered.end(), 0);
+    for (int64_t &id : scattered) id = id * 6 + 1;
+    graph.Remove(core::Tensor(scattered, {100}, core::Int64, device));
+    EXPECT_EQ(graph.Size(), 500);
+    ExpectSameAsHybridSearch(graph, radius, max_knn);
+}
+
+TEST_P(IncrementalNeighborGraphPermuteDevices, InvalidRemove) {
+    const core::Device device = GetParam();
+    std::mt19937 rng(1);
+    core::nns::IncrementalNeighborGraph graph(0.2, 4, core::Float32, device);
+    graph.Insert(RandomPoints(10, rng, device));
+
+    EXPECT_ANY_THROW(
+            graph.Remove(core::Tensor::Init<int64_t>({3, 10}, device)));
+    EXPECT_ANY_THROW(graph.Remove(core::Tensor::Init<int64_t>({3, 3}, device)));
+    // A failed removal leaves the graph unchanged.
+    EXPECT_EQ(graph.Size(), 10);
+    graph.Remove(core::Tensor::Init<int64_t>({3}, device));
+    EXPECT_ANY_THROW(graph.Remove(core::Tensor::Init<int64_t>({3}, device)));
+    EXPECT_EQ(graph.Size(), 9);
+    EXPECT_ANY_THROW(graph.Insert(core::Tensor::Zeros({2, 3}, core::Float64,
+                                                      device)));
+}
+
+}  // namespace tests
+}  // namespace open3d
@@ -274,5 +274,40 @@ TEST_P(IndexerPermuteDevices, IsContiguous) {
     EXPECT_TRUE(output.IsContiguous());
 }
 
+TEST_P(IndexerPermuteDevices, GetLayout) {
+    core::Device device = GetParam();
+
+    core::Tensor contiguous({4, 3}, core::Float32, device);
+    core::Tensor scalar({}, core::Float32, device);
+    core::Tensor inner({3}, core::Float32, device);
+    core::Tensor outer({4, 1}, core::Float32, device);
+    core::Tensor sliced_full({4, 6}, core::Float32, device);
+    core::Tensor sliced = sliced_full.Slice(1, 0, 6, 2);  // Shape {4, 3}.
+    core::Tensor output({4, 3}, core::Float32, device);
+    core::Indexer indexer({contiguous, scalar, inner, outer, sliced}, output);
+
+    EXPECT_EQ(indexer.GetInputLayout(0), core::IndexerLayout::Contiguous);
+    EXPECT_EQ(indexer.GetInputLayout(1), core::IndexerLayout::Scalar);
+    EXPECT_EQ(indexer.GetInputLayout(2), core::IndexerLayout::InnerBroadcast);
+    EXPECT_EQ(indexer.GetInputLayout(3), core::IndexerLayout::Strided);
+    EXPECT_EQ(indexer.GetInputLayout(4), core::IndexerLayout::Strided);
+    EXPECT_EQ(indexer.GetOutputLayout(), core::IndexerLayout::Contiguous);
+
+    // The specialized pointers agree with the generic ones.
+    using Layout = core::IndexerLayout;
+    for (int64_t i = 0; i < indexer.NumWorkloads(); ++i) {
+        EXPECT_EQ((indexer.GetInputPtr<float, Layout::Contiguous>(0, i)),
+                  indexer.GetInputPtr<float>(0, i));
+        EXPECT_EQ((indexer.GetInputPtr<float, Layout::Scalar>(1, i)),
+                  indexer.GetInputPtr<float>(1, i));
+        EXPECT_EQ((indexer.GetInputPtr<float, Layout::InnerBroadcast>(2, i)),
+                  indexer.GetInputPtr<float>(2, i));
+        EXPECT_EQ((indexer.GetInputPtr<float, Layout::Strided>(4, i)),
+                  indexer.GetInputPtr<float>(4, i));
+        EXPECT_EQ((indexer.GetOutputPtr<float, Layout::Contiguous>(i)),
+                  indexer.GetOutputPtr<float>(i));
+    }
+}
+
 }  // namespace tests
 }  // namespace open3d
@@ -27,12 +27,15 @@
 
 #include <cmath>
 #include <limits>
+#include <random>
 
 #include "core/CoreTest.h"
 #include "open3d/core/Device.h"
 #include "open3d/core/Dtype.h"
 #include "open3d/core/SizeVector.h"
 #include "open3d/core/Tensor.h"
+#include "open3d/core/nns/KnnIndex.h"
+#include "open3d/core/nns/NanoFlannIndex.h"
 #include "open3d/utility/Helper.h"
 #include "tests/Tests.h"
 #include "tests/core/CoreTest.h"
@@ -350,5 +353,41 @@ TEST(KnnIndex, KnnSearchBatch) {
     EXPECT_TRUE(distances.AllClose(gt_distances, 1e-5, 1e-3));
 }
 
+
+TEST(KnnIndex, KnnSearchGrid) {
+    // Random 3D points are searched through the uniform grid built in
+    // SetTensorData. k is larger than the brute-force kernel supports.
+    core::Device device = core::Device("CUDA:0");
+    const int64_t num_points = 20000;
+    const int64_t num_queries = 500;
+    std::mt19937 rng(0);
+    std::uniform_real_distribution<float> dist(-1.0, 1.0);
+    std::vector<float> points_data(num_points * 3);
+    std::vector<float> queries_data(num_queries * 3);
+    for (float& v : points_data) v = dist(rng);
+    // Queries partly lie outside of the bounding box of the points.
+    for (float& v : queries_data) v = 1.5f * dist(rng);
+    core::Tensor dataset_points(points_data, {num_points, 3}, core::Float32);
+    core::Tensor query_points(queries_data, {num_queries, 3}, core::Float32);
+
+    core::nns::NanoFlannIndex nanoflann_index(dataset_points);
+    core::nns::KnnIndex knn_index(dataset_points.To(device), core::Int64);
+
+    for (int knn : {1, 8, 100}) {
+        core::Tensor gt_indices, gt_distances;
+        std::tie(gt_indices, gt_distances) =
+                nanoflann_index.SearchKnn(query_points, knn);
+
+        core::Tensor indices, distances;
+        std::tie(indices, distances) =
+                knn_index.SearchKnn(query_points.To(device), knn);
+        EXPECT_EQ(indices.GetShape(), core::SizeVector({num_queries, knn}));
+        EXPECT_EQ(distances.GetShape(), core::SizeVector({num_queries, knn}));
+        EXPECT_TRUE(indices.To(core::Device("CPU:0")).AllClose(gt_indices));
+        EXPECT_TRUE(distances.To(core::Device("CPU:0"))
+                            .AllClose(gt_distances, 1e-5, 1e-5));
+    }
+}
+
 }  // namespace tests
 }  // namespace open3d
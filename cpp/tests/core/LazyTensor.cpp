@@ -0,0 +1,141 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/core/LazyTensor.h"
+
+#include "open3d/core/Tensor.h"
+#include "tests/Tests.h"
+#include "tests/core/CoreTest.h"
+
+namespace open3d {
+namespace tests {
+
+class LazyTensorPermuteDevices : public PermuteDevices {};
+INSTANTIATE_TEST_SUITE_P(LazyTensor,
+                         LazyTensorPermuteDevices,
+                         testing::ValuesIn(PermuteDevices::TestCases()));
+
+TEST_P(LazyTensorPermuteDevices, Arithmetic) {
+    core::Device device = GetParam();
+
+    core::Tensor a = core::Tensor::Init<float>({{1, 2, 3}, {4, 5, 6}}, device);
+    core::Tensor b = core::Tensor::Init<float>({1, 1, 1}, device);
+    core::Tensor c = core::Tensor::Init<float>({{2}, {3}}, device);
+    core::Tensor d = core::Tensor::Init<float>(0.5, device);
+
+    core::LazyTensor expr = (a.Lazy() - b) * c + d;
+    EXPECT_EQ(expr.GetShape(), core::SizeVector({2, 3}));
+    EXPECT_EQ(expr.GetDtype(), core::Float32);
+    EXPECT_EQ(expr.GetDevice(), device);
+    EXPECT_FALSE(expr.IsLeaf());
+    EXPECT_TRUE(expr.Materialize().AllClose((a - b) * c + d));
+
+    expr = (a.Lazy() * 2 - 1) / 4 + a;
+    EXPECT_TRUE(expr.Materialize().AllClose((a * 2 - 1) / 4 + a));
+}
+
+TEST_P(LazyTensorPermuteDevices, Unary) {
+    core::Device device = GetParam();
+
+    core::Tensor a = core::Tensor::Init<double>({-4, 1, 9, -16}, device);
+    core::Tensor expr = a.Lazy().Abs().Sqrt().Materialize();
+    EXPECT_TRUE(
+            expr.AllClose(core::Tensor::Init<double>({2, 1, 3, 4}, device)));
+
+    expr = (-a.Lazy()).Neg().Mul(0.1).Exp().Materialize();
+    EXPECT_TRUE(expr.AllClose((a * 0.1).Exp()));
+}
+
+TEST_P(LazyTensorPermuteDevices, RepeatedInputs) {
+    core::Device device = GetParam();
+
+    core::Tensor a = core::Tensor::Init<float>({1, 2, 3}, device);
+    core::Tensor expr = (a.Lazy() * a + a * a).Materialize();
+    EXPECT_TRUE(expr.AllClose(core::Tensor::Init<float>({2, 8, 18}, device)));
+}
+
+TEST_P(LazyTensorPermuteDevices, NonContiguous) {
+    core::Device device = GetParam();
+
+    core::Tensor a = core::Tensor::Init<float>({{1, 2}, {3, 4}}, device);
+    core::Tensor a_t = a.T();
+    core::Tensor expr = (a.Lazy() + a_t).Materialize();
+    EXPECT_TRUE(expr.AllClose(
+            core::Tensor::Init<float>({{2, 5}, {5, 8}}, device)));
+}
+
+TEST_P(LazyTensorPermuteDevices, LongExpression) {
+    core::Device device = GetParam();
+
+    // More distinct inputs and instructions than a single fused kernel
+    // supports. The expression is split into several kernels.
+    std::vector<core::Tensor> tensors;
+    for (int i = 0; i < 40; ++i) {
+        tensors.push_back(core::Tensor::Full({4}, i, core::Float32, device));
+    }
+    core::LazyTensor lazy = tensors[0];
+    core::Tensor eager = tensors[0];
+    for (int i = 1; i < 40; ++i) {
+        lazy = lazy + tensors[i];
+        eager = eager + tensors[i];
+    }
+    EXPECT_TRUE(lazy.Materialize().AllClose(eager));
+
+    // Deeply right-nested expressions require a deep evaluation stack.
+    core::LazyTensor nested = tensors[0];
+    for (int i = 1; i < 40; ++i) {
+        nested = core::LazyTensor(tensors[i]) - nested;
+    }
+    eager = tensors[0];
+    for (int i = 1; i < 40; ++i) {
+        eager = tensors[i] - eager;
+    }
+    EXPECT_TRUE(nested.Materialize().AllClose(eager));
+}
+
+TEST_P(LazyTensorPermuteDevices, NonFloatFallback) {
+    core::Device device = GetParam();
+
+    core::Tensor a = core::Tensor::Init<int32_t>({1, 2, 3}, device);
+    core::Tensor b = core::Tensor::Init<int32_t>({4, 5, 6}, device);
+    core::Tensor expr = ((a.Lazy() + b) * 2 - 1).Materialize();
+    EXPECT_TRUE(expr.AllEqual(
+            core::Tensor::Init<int32_t>({9, 13, 17}, device)));
+}
+
+TEST_P(LazyTensorPermuteDevices, Errors) {
+    core::Device device = GetParam();
+
+    core::Tensor a = core::Tensor::Ones({3}, core::Float32, device);
+    core::Tensor b = core::Tensor::Ones({3}, core::Float64, device);
+    core::Tensor c = core::Tensor::Ones({4}, core::Float32, device);
+    EXPECT_ANY_THROW(a.Lazy() + b);
+    EXPECT_ANY_THROW(a.Lazy() + c);
+}
+
+}  // namespace tests
+}  // namespace open3d
@@ -34,6 +34,8 @@
 #include "open3d/core/Tensor.h"
 #include "open3d/core/kernel/Kernel.h"
 #include "open3d/core/linalg/AddMM.h"
+#include "open3d/core/linalg/BatchedLinalg.h"
+#include "open3d/core/linalg/ConjugateGradient.h"
 #include "open3d/core/linalg/kernel/SVD3x3.h"
 #include "open3d/utility/Helper.h"
 #include "tests/Tests.h"
@@ -580,5 +582,173 @@ TEST_P(LinalgPermuteDevices, KernelOps) {
     EXPECT_TRUE(output3x1.AllClose(Solve_Expected));
 }
 
+TEST_P(LinalgPermuteDevices, Batched) {
+    const double EPSILON = 1e-8;
+
+    core::Device device = GetParam();
+    const int64_t batch = 16;
+    for (int64_t n : {3, 6, 10}) {
+        // Diagonally dominant matrices are well conditioned.
+        std::vector<double> A_data(batch * n * n), B_data(batch * n * 2);
+        for (size_t i = 0; i < A_data.size(); ++i) {
+            A_data[i] = std::sin(0.7 * i + 0.3);
+        }
+        for (int64_t b = 0; b < batch; ++b) {
+            for (int64_t r = 0; r < n; ++r) {
+                A_data[(b * n + r) * n + r] += 2.0 * n;
+            }
+        }
+        for (size_t i = 0; i < B_data.size(); ++i) {
+            B_data[i] = std::cos(1.3 * i);
+        }
+        core::Tensor A(A_data, {batch, n, n}, core::Float64, device);
+        core::Tensor B(B_data, {batch, n, 2}, core::Float64, device);
+
+        // A X = B for X from BatchedSolve and A A^-1 = I.
+        core::Tensor X, A_inv;
+        core::BatchedSolve(A, B, X);
+        core::BatchedInverse(A, A_inv);
+        EXPECT_EQ(X.GetShape(), B.GetShape());
+        EXPECT_EQ(A_inv.GetShape(), A.GetShape());
+        const std::vector<double> X_data = X.ToFlatVector<double>();
+        const std::vector<double> A_inv_data = A_inv.ToFlatVector<double>();
+        for (int64_t b = 0; b < batch; ++b) {
+            const double* A_b = A_data.data() + b * n * n;
+            for (int64_t r = 0; r < n; ++r) {
+                for (int64_t c = 0; c < 2; ++c) {
+                    double sum = 0;
+                    for (int64_t j = 0; j < n; ++j) {
+                        sum += A_b[r * n + j] * X_data[(b * n + j) * 2 + c];
+                    }
+                    EXPECT_NEAR(sum, B_data[(b * n + r) * 2 + c], EPSILON);
+                }
+                for (int64_t c = 0; c < n; ++c) {
+                    double sum = 0;
+                    for (int64_t j = 0; j < n; ++j) {
+                        sum += A_b[r * n + j] *
+                               A_inv_data[(b * n + j) * n + c];
+                    }
+                    EXPECT_NEAR(sum, r == c ? 1.0 : 0.0, EPSILON);
+                }
+            }
+        }
+
+        // Vector right-hand sides keep their shape.
+        core::BatchedSolve(A, B.Slice(2, 0, 1).Reshape({batch, n}), X);
+        EXPECT_EQ(X.GetShape(), core::SizeVector({batch, n}));
+    }
+
+    // Determinants of permuted diagonal matrices and a generic 3x3.
+    core::Tensor D =
+            core::Tensor::Init<float>({{{0, 2, 0}, {3, 0, 0}, {0, 0, 4}},
+                                       {{1, 0, 0}, {0, 2, 0}, {0, 0, 3}},
+                                       {{1, 2, 3}, {4, 5, 6}, {7, 8, 10}}},
+                                      device);
+    EXPECT_TRUE(core::BatchedDet(D).AllClose(
+            core::Tensor::Init<float>({-24, 6, -3}, device)));
+    EXPECT_EQ(core::BatchedDet(core::Tensor::Zeros({2, 4, 4}, core::Float32,
+                                                   device))
+                      .ToFlatVector<float>(),
+              std::vector<float>({0, 0}));
+
+    // Closed-form 3x3 SVD reconstructs A = U S VT.
+    core::Tensor U, S, VT;
+    core::BatchedSVD(D, U, S, VT);
+    EXPECT_EQ(U.GetShape(), core::SizeVector({3, 3, 3}));
+    EXPECT_EQ(S.GetShape(), core::SizeVector({3, 3}));
+    const std::vector<float> D_data = D.ToFlatVector<float>();
+    const std::vector<float> U_data = U.ToFlatVector<float>();
+    const std::vector<float> S_data = S.ToFlatVector<float>();
+    const std::vector<float> VT_data = VT.ToFlatVector<float>();
+    for (int64_t b = 0; b < 3; ++b) {
+        EXPECT_GE(S_data[b * 3], S_data[b * 3 + 1]);
+        EXPECT_GE(S_data[b * 3 + 1], S_data[b * 3 + 2]);
+        EXPECT_GE(S_data[b * 3 + 2], 0);
+        for (int64_t r = 0; r < 3; ++r) {
+            for (int64_t c = 0; c < 3; ++c) {
+                float sum = 0;
+                for (int64_t j = 0; j < 3; ++j) {
+                    sum += U_data[b * 9 + r * 3 + j] * S_data[b * 3 + j] *
+                           VT_data[b * 9 + j * 3 + c];
+                }
+                EXPECT_NEAR(sum, D_data[b * 9 + r * 3 + c], 1e-4);
+            }
+        }
+    }
+
+    // Singular and shape tests.
+    core::Tensor B;
+    EXPECT_ANY_THROW(core::BatchedSolve(
+            core::Tensor::Zeros({2, 3, 3}, core::Float32, device),
+            core::Tensor::Ones({2, 3}, core::Float32, device), B));
+    EXPECT_ANY_THROW(core::BatchedInverse(
+            core::Tensor::Zeros({2, 3, 3}, core::Float32, device), B));
+    EXPECT_ANY_THROW(core::BatchedInverse(
+            core::Tensor::Ones({2, 3, 4}, core::Float32, device), B));
+    EXPECT_ANY_THROW(core::BatchedDet(
+            core::Tensor::Ones({3, 3}, core::Float32, device)));
+    EXPECT_ANY_THROW(core::BatchedSolve(
+            core::Tensor::Ones({2, 3, 3}, core::Float32, device),
+            core::Tensor::Ones({3, 3}, core::Float32, device), B));
+}
+
+TEST_P(LinalgPermuteDevices, ConjugateGradient) {
+    core::Device device = GetParam();
+    const int64_t n = 12;
+
+    // SPD tridiagonal matrix with 3x3 blocks of different scales, so that
+    // the preconditioners have something to fix.
+    std::vector<double> A_data(n * n, 0), b_data(n);
+    for (int64_t i = 0; i < n; ++i) {
+        const double scale = 1.0 + 10.0 * (i / 3);
+        A_data[i * n + i] = 4 * scale;
+        if (i + 1 < n) {
+            A_data[i * n + i + 1] = A_data[(i + 1) * n + i] = -1;
+        }
+        b_data[i] = std::cos(0.5 * i);
+    }
+    core::Tensor A(A_data, {n, n}, core::Float64, device);
+    core::Tensor b(b_data, {n}, core::Float64, device);
+    core::SparseTensor A_sparse = core::SparseTensor::FromDense(A);
+
+    core::ConjugateGradientOption option;
+    option.relative_tolerance_ = 1e-10;
+    for (core::PreconditionerType type :
+         {core::PreconditionerType::None, core::PreconditionerType::Jacobi,
+          core::PreconditionerType::BlockJacobi}) {
+        for (bool sparse : {false, true}) {
+            core::Tensor x;
+            core::ConjugateGradientResult result =
+                    sparse ? core::PCG(A_sparse, b, x, type, 3, option)
+                           : core::PCG(A, b, x, type, 3, option);
+            EXPECT_TRUE(result.converged_);
+            EXPECT_LE(result.iterations_, n);
+            EXPECT_TRUE(A_sparse.SpMV(x).AllClose(b, 1e-6, 1e-8));
+        }
+    }
+
+    // Matrix-free operator and initial guess.
+    core::Tensor x = b.Clone();
+    core::ConjugateGradientResult result = core::ConjugateGradient(
+            [&](const core::Tensor& v) { return A_sparse.SpMV(v); }, b, x,
+            core::LinearOperator(), option);
+    EXPECT_TRUE(result.converged_);
+    EXPECT_TRUE(A_sparse.SpMV(x).AllClose(b, 1e-6, 1e-8));
+
+    // The iteration limit is reported.
+    option.max_iteration_ = 1;
+    x = core::Tensor();
+    result = core::PCG(A, b, x, core::PreconditionerType::None, 1, option);
+    EXPECT_FALSE(result.converged_);
+    EXPECT_EQ(result.iterations_, 1);
+
+    EXPECT_ANY_THROW(core::PCG(A, b, x, core::PreconditionerType::BlockJacobi,
+                               5, option));
+    EXPECT_ANY_THROW(core::PCG(core::Tensor::Zeros({n, n}, core::Float64,
+                                                   device),
+                               b, x, core::PreconditionerType::Jacobi, 1,
+                               option));
+}
+
 }  // namespace tests
 }  // namespace open3d
@@ -27,8 +27,14 @@
 #include "open3d/core/MemoryManager.h"
 
 #include <map>
+#include <thread>
+#include <vector>
 
+#include "open3d/core/CUDAUtils.h"
 #include "open3d/core/Device.h"
+#include "open3d/core/MemoryManagerStatistic.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/core/hashmap/HashMap.h"
 #include "tests/Tests.h"
 #include "tests/core/CoreTest.h"
 
@@ -138,6 +144,76 @@ TEST_P(MemoryManagerPermuteDevices, MallocFree) {
     core::MemoryManager::Free(ptr, device);
 }
 
+TEST_P(MemoryManagerPermuteDevices, ContiguousCopyStatistic) {
+    core::Device device = GetParam();
+    core::MemoryManagerStatistic& statistic =
+            core::MemoryManagerStatistic::GetInstance();
+    core::Tensor t = core::Tensor::Ones({4, 6}, core::Float32, device);
+
+    const int64_t count = statistic.GetContiguousCopyCount(device);
+    const size_t bytes = statistic.GetContiguousCopyBytes(device);
+    t.Contiguous();
+    t.Slice(0, 1, 3).Contiguous();
+    EXPECT_EQ(statistic.GetContiguousCopyCount(device), count);
+    EXPECT_EQ(statistic.GetContiguousCopyBytes(device), bytes);
+
+    t.Slice(1, 0, 3).Contiguous();
+    t.T().Contiguous();
+    EXPECT_EQ(statistic.GetContiguousCopyCount(device), count + 2);
+    EXPECT_EQ(statistic.GetContiguousCopyBytes(device),
+              bytes + (12 + 24) * sizeof(float));
+}
+
+TEST_P(MemoryManagerPermuteDevices, MemoryTagStatistic) {
+    core::Device device = GetParam();
+    core::MemoryManagerStatistic& statistic =
+            core::MemoryManagerStatistic::GetInstance();
+
+    const size_t live_bytes = statistic.GetLiveBytes(device);
+    const int64_t malloc_count = statistic.GetMallocCount(device);
+    void* outer_ptr = nullptr;
+    void* inner_ptr = nullptr;
+    {
+        core::ScopedMemoryTag outer_tag("test_outer");
+        outer_ptr = core::MemoryManager::Malloc(64, device);
+        {
+            core::ScopedMemoryTag inner_tag("test_inner");
+            core::ScopedMemoryTag same_tag("test_inner");
+            EXPECT_EQ(core::MemoryManagerStatistic::GetCurrentTag(),
+                      "test_outer/test_inner");
+            inner_ptr = core::MemoryManager::Malloc(32, device);
+        }
+    }
+    EXPECT_EQ(core::MemoryManagerStatistic::GetCurrentTag(), "");
+    EXPECT_EQ(statistic.GetLiveBytes(device), live_bytes + 96);
+    EXPECT_GE(statistic.GetPeakBytes(device), live_bytes + 96);
+    EXPECT_EQ(statistic.GetMallocCount(device), malloc_count + 2);
+
+    std::map<std::string, core::MemoryTagStatistic> tags =
+            statistic.GetTagStatistics(device);
+    EXPECT_EQ(tags.at("test_outer").live_bytes_, 64);
+    EXPECT_EQ(tags.at("test_outer/test_inner").live_bytes_, 32);
+
+    core::MemoryManager::Free(outer_ptr, device);
+    core::MemoryManager::Free(inner_ptr, device);
+    EXPECT_EQ(statistic.GetLiveBytes(device), live_bytes);
+
+    tags = statistic.GetTagStatistics(device);
+    EXPECT_EQ(tags.at("test_outer").live_bytes_, 0);
+    EXPECT_EQ(tags.at("test_outer").peak_bytes_, 64);
+    EXPECT_EQ(tags.at("test_outer").count_malloc_,
+              tags.at("test_outer").count_free_);
+
+    statistic.ResetPeakBytes();
+    EXPECT_EQ(statistic.GetPeakBytes(device), live_bytes);
+    tags = statistic.GetTagStatistics(device);
+    EXPECT_EQ(tags.at("test_outer").peak_bytes_, 0);
+
+    core::HashMap hashmap(10, core::Int32, {1}, core::Int32, {1}, device);
+    tags = statistic.GetTagStatistics(device);
+    EXPECT_GT(tags.at("hashmap").live_bytes_, 0);
+}
+
 TEST_P(MemoryManagerPermuteDevicePairs, Memcpy) {
     core::Device dst_device;
     core::Device src_device;
@@ -540,6 +616,157 @@ TEST(MemoryManagerPermuteDevices, CachedTooLargeAutoReleaseAll) {
     ExpectStatistic(dummy_mm, 3, 3, 0);
 }
 
+TEST(MemoryManagerPermuteDevices, PinnedReuse) {
+    core::Device host("CPU:0");
+    auto pinned_mm = std::make_shared<core::PinnedMemoryManager>();
+    core::PinnedMemoryManager::ReleaseCache();
+
+    EXPECT_EQ(pinned_mm->Malloc(0, host), nullptr);
+
+    void* ptr = pinned_mm->Malloc(1000, host);
+    EXPECT_NE(ptr, nullptr);
+    EXPECT_EQ(core::PinnedMemoryManager::IsPinned(ptr),
+              core::cuda::IsAvailable());
+    pinned_mm->Free(ptr, host);
+
+    // Same page-aligned size hits the pool.
+    void* ptr2 = pinned_mm->Malloc(2000, host);
+    EXPECT_EQ(ptr2, ptr);
+
+    char src_vals[6] = "hello";
+    pinned_mm->Memcpy(ptr2, host, src_vals, host, sizeof(src_vals));
+    EXPECT_STREQ(static_cast<char*>(ptr2), src_vals);
+    pinned_mm->Free(ptr2, host);
+
+    EXPECT_THROW(pinned_mm->Free(src_vals, host), std::runtime_error);
+    EXPECT_THROW(pinned_mm->Malloc(8, core::Device("CUDA:0")),
+                 std::runtime_error);
+
+    core::PinnedMemoryManager::ReleaseCache();
+}
+
+TEST(MemoryManagerPermuteDevices, CachedCPU) {
+    core::Device host("CPU:0");
+    auto cached_mm = std::make_shared<core::CachedCPUMemoryManager>();
+    core::CachedCPUMemoryManager::ReleaseCache();
+    EXPECT_EQ(core::CachedCPUMemoryManager::GetCacheSize(), 0);
+
+    EXPECT_EQ(cached_mm->Malloc(0, host), nullptr);
+
+    // Sizes of the same class reuse the block of this thread.
+    void* ptr = cached_mm->Malloc(1000, host);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(ptr) % 16, 0);
+    char src_vals[6] = "hello";
+    cached_mm->Memcpy(ptr, host, src_vals, host, sizeof(src_vals));
+    EXPECT_STREQ(static_cast<char*>(ptr), src_vals);
+    cached_mm->Free(ptr, host);
+    EXPECT_EQ(core::CachedCPUMemoryManager::GetCacheSize(), 1024);
+    void* ptr2 = cached_mm->Malloc(1024, host);
+    EXPECT_EQ(ptr2, ptr);
+    EXPECT_EQ(core::CachedCPUMemoryManager::GetCacheSize(), 0);
+
+    // Blocks freed by exiting threads and large blocks go to the process-wide
+    // cache.
+    void* large_ptr = nullptr;
+    std::thread([&]() {
+        large_ptr = cached_mm->Malloc(3 << 20, host);
+        cached_mm->Free(ptr2, host);
+    }).join();
+    EXPECT_EQ(core::CachedCPUMemoryManager::GetCacheSize(), 1024);
+    cached_mm->Free(large_ptr, host);
+    EXPECT_EQ(core::CachedCPUMemoryManager::GetCacheSize(), 1024 + (3 << 20));
+    EXPECT_EQ(cached_mm->Malloc(1024, host), ptr);
+    EXPECT_EQ(cached_mm->Malloc(3 << 20, host), large_ptr);
+    cached_mm->Free(large_ptr, host);
+    cached_mm->Free(ptr, host);
+
+    core::CachedCPUMemoryManager::ReleaseCache();
+    EXPECT_EQ(core::CachedCPUMemoryManager::GetCacheSize(), 0);
+
+    // Blocks beyond the limit are freed directly.
+    core::CachedCPUMemoryManager::SetMaxCacheSize(0);
+    ptr = cached_mm->Malloc(2 << 20, host);
+    cached_mm->Free(ptr, host);
+    EXPECT_EQ(core::CachedCPUMemoryManager::GetCacheSize(), 0);
+    core::CachedCPUMemoryManager::SetMaxCacheSize(size_t(1) << 30);
+}
+
+TEST(MemoryManagerPermuteDevices, CPUPolicies) {
+    using Policy = core::CPUMemoryManager::Policy;
+    core::Device host("CPU:0");
+    auto cpu_mm = std::make_shared<core::CPUMemoryManager>();
+    const Policy default_policy = core::CPUMemoryManager::GetPolicy();
+
+    // Large allocations with the placement policies and parallel copies
+    // between them, together with small allocations.
+    const size_t large_size = (size_t(5) << 20) + 3;
+    std::vector<char> host_vals(large_size);
+    for (size_t i = 0; i < large_size; ++i) {
+        host_vals[i] = static_cast<char>(i * 7);
+    }
+    for (Policy policy :
+         {Policy::Default, Policy::FirstTouch, Policy::Interleave}) {
+        core::CPUMemoryManager::SetPolicy(policy);
+        EXPECT_EQ(core::CPUMemoryManager::GetPolicy(), policy);
+        void* small_ptr = cpu_mm->Malloc(10, host);
+        void* src_ptr = cpu_mm->Malloc(large_size, host);
+        void* dst_ptr = cpu_mm->Malloc(large_size, host);
+        cpu_mm->Memcpy(src_ptr, host, host_vals.data(), host, large_size);
+        cpu_mm->Memcpy(dst_ptr, host, src_ptr, host, large_size);
+        EXPECT_EQ(std::memcmp(dst_ptr, host_vals.data(), large_size), 0);
+        cpu_mm->Free(small_ptr, host);
+        cpu_mm->Free(dst_ptr, host);
+        // Frees after a policy change still match their allocation.
+        core::CPUMemoryManager::SetPolicy(Policy::Default);
+        cpu_mm->Free(src_ptr, host);
+    }
+
+    core::CPUMemoryManager::SetPolicy(Policy::FirstTouch);
+    core::Tensor t = core::Tensor::Ones({2 << 20}, core::Float32, host);
+    EXPECT_EQ((t + t).Sum({0}).Item<float>(), 4 << 20);
+    core::CPUMemoryManager::SetPolicy(default_policy);
+}
+
+#ifdef BUILD_CUDA_MODULE
+TEST(MemoryManagerPermuteDevices, AsyncMallocFreeOnStreams) {
+    if (!core::cuda::IsAvailable()) {
+        GTEST_SKIP() << "No CUDA device available.";
+    }
+    core::Device device("CUDA:0");
+    auto async_mm = std::make_shared<core::CUDAAsyncMemoryManager>();
+
+    char src_vals[6] = "hello";
+    char dst_vals[6] = "xxxxx";
+    size_t num_bytes = strlen(src_vals) + 1;
+
+    // Allocations, copies and frees ordered on a non-default stream.
+    {
+        core::CUDAScopedStream scoped_stream(
+                core::CUDAScopedStream::CreateNewStream);
+        void* ptr = async_mm->Malloc(num_bytes, device);
+        async_mm->Memcpy(ptr, device, src_vals, core::Device("CPU:0"),
+                         num_bytes);
+        async_mm->Memcpy(dst_vals, core::Device("CPU:0"), ptr, device,
+                         num_bytes);
+        async_mm->Free(ptr, device);
+        OPEN3D_CUDA_CHECK(cudaStreamSynchronize(core::cuda::GetStream()));
+    }
+    EXPECT_STREQ(dst_vals, src_vals);
+
+    // Memory freed on one stream can be reused on another one.
+    void* ptr = async_mm->Malloc(1024, device);
+    async_mm->Free(ptr, device);
+    {
+        core::CUDAScopedStream scoped_stream(
+                core::CUDAScopedStream::CreateNewStream);
+        ptr = async_mm->Malloc(1024, device);
+        async_mm->Free(ptr, device);
+    }
+    core::CUDAAsyncMemoryManager::ReleaseCache(device);
+    core::cuda::Synchronize(device);
+}
+#endif
+
 // This must be the last test for core::CachedMemoryManager.
 TEST(MemoryManagerPermuteDevices, CachedFreeOnProgramEnd) {
     core::Device device = MakeDummyDevice();
@@ -26,8 +26,11 @@
 
 #include "open3d/core/nns/NanoFlannIndex.h"
 
+#include <algorithm>
 #include <cmath>
 #include <limits>
+#include <numeric>
+#include <random>
 
 #include "core/CoreTest.h"
 #include "open3d/core/Device.h"
@@ -205,5 +208,117 @@ TEST(NanoFlannIndex, SearchRadius) {
     EXPECT_TRUE(neighbors_row_splits.AllClose(gt_neighbors_row_splits));
 }
 
+
+TEST(NanoFlannIndex, AddPoints) {
+    // Enough points for the build to be split into parallel sub-trees.
+    const int64_t num_points = 150000;
+    const int64_t num_queries = 50;
+    const int knn = 5;
+    const double radius = 0.02;
+    std::mt19937 rng(0);
+    std::uniform_real_distribution<double> dist(0.0, 1.0);
+    std::vector<double> points_data(num_points * 3);
+    std::vector<double> queries_data(num_queries * 3);
+    for (double& v : points_data) v = dist(rng);
+    for (double& v : queries_data) v = dist(rng);
+    core::Tensor dataset_points(points_data, {num_points, 3}, core::Float64);
+    core::Tensor query_points(queries_data, {num_queries, 3}, core::Float64);
+
+    // Brute-force ground truth.
+    std::vector<int64_t> gt_indices;
+    std::vector<int64_t> gt_counts;
+    for (int64_t i = 0; i < num_queries; ++i) {
+        std::vector<std::pair<double, int64_t>> dists(num_points);
+        int64_t count = 0;
+        for (int64_t j = 0; j < num_points; ++j) {
+            double d = 0;
+            for (int k = 0; k < 3; ++k) {
+                double diff = queries_data[i * 3 + k] - points_data[j * 3 + k];
+                d += diff * diff;
+            }
+            dists[j] = {d, j};
+            count += d < radius * radius;
+        }
+        std::partial_sort(dists.begin(), dists.begin() + knn, dists.end());
+        for (int k = 0; k < knn; ++k) {
+            gt_indices.push_back(dists[k].second);
+        }
+        gt_counts.push_back(count);
+    }
+
+    auto check = [&](const core::nns::NanoFlannIndex& index) {
+        core::Tensor indices, distances, splits;
+        std::tie(indices, distances) = index.SearchKnn(query_points, knn);
+        EXPECT_EQ(indices.ToFlatVector<int64_t>(), gt_indices);
+
+        std::tie(indices, distances, splits) =
+                index.SearchRadius(query_points, radius);
+        std::vector<int64_t> counts(num_queries);
+        std::vector<int64_t> splits_vec = splits.ToFlatVector<int64_t>();
+        for (int64_t i = 0; i < num_queries; ++i) {
+            counts[i] = splits_vec[i + 1] - splits_vec[i];
+        }
+        EXPECT_EQ(counts, gt_counts);
+    };
+
+    core::nns::NanoFlannIndex full_index(dataset_points);
+    check(full_index);
+
+    // Build from a few points and add the rest in batches of varying size.
+    std::vector<int64_t> batch_ends = {100, 1000, 1500, 40000, num_points};
+    core::nns::NanoFlannIndex index(dataset_points.Slice(0, 0, 10));
+    int64_t begin = 10;
+    for (int64_t end : batch_ends) {
+        EXPECT_TRUE(index.AddPoints(dataset_points.Slice(0, begin, end)));
+        begin = end;
+    }
+    EXPECT_EQ(index.GetDatasetSize(), num_points);
+    check(index);
+
+    // Points must match the index dtype and dimension.
+    EXPECT_THROW(index.AddPoints(core::Tensor::Zeros({2, 3}, core::Float32)),
+                 std::runtime_error);
+    EXPECT_THROW(index.AddPoints(core::Tensor::Zeros({2, 2}, core::Float64)),
+                 std::runtime_error);
+}
+
+
+TEST(NanoFlannIndex, SearchKnnApproximate) {
+    // High dimensional data, e.g. FPFH features.
+    const int64_t num_points = 2000;
+    const int64_t num_queries = 100;
+    const int64_t dimension = 33;
+    const int knn = 4;
+    std::mt19937 rng(0);
+    std::uniform_real_distribution<double> dist(0.0, 1.0);
+    std::vector<double> points_data(num_points * dimension);
+    std::vector<double> queries_data(num_queries * dimension);
+    for (double& v : points_data) v = dist(rng);
+    for (double& v : queries_data) v = dist(rng);
+    core::Tensor dataset_points(points_data, {num_points, dimension},
+                                core::Float64);
+    core::Tensor query_points(queries_data, {num_queries, dimension},
+                              core::Float64);
+    core::nns::NanoFlannIndex index(dataset_points);
+
+    core::Tensor gt_indices, gt_distances;
+    std::tie(gt_indices, gt_distances) = index.SearchKnn(query_points, knn);
+
+    // eps = 0 is the exact search.
+    core::Tensor indices, distances;
+    std::tie(indices, distances) = index.SearchKnn(query_points, knn, 0.0);
+    EXPECT_TRUE(indices.AllClose(gt_indices));
+    EXPECT_TRUE(distances.AllClose(gt_distances));
+
+    // Approximate distances are bounded by (1 + eps) times the exact ones.
+    const double eps = 0.5;
+    std::tie(indices, distances) = index.SearchKnn(query_points, knn, eps);
+    EXPECT_EQ(indices.GetShape(), gt_indices.GetShape());
+    EXPECT_TRUE(distances.Ge(gt_distances).All());
+    EXPECT_TRUE(distances.Le(gt_distances.Mul(1 + eps)).All());
+
+    EXPECT_THROW(index.SearchKnn(query_points, knn, -1.0), std::runtime_error);
+}
+
 }  // namespace tests
 }  // namespace open3d
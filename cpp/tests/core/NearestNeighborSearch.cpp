@@ -395,5 +395,85 @@ TEST_P(NNSPermuteDevices, HybridSearch) {
     EXPECT_TRUE(counts.AllClose(gt_counts));
 }
 
+TEST_P(NNSPermuteDevices, SearchTiled) {
+    core::Device device = GetParam();
+    core::Tensor dataset_points =
+            core::Tensor::Init<float>({{0.0, 0.0, 0.0},
+                                       {0.0, 0.0, 0.1},
+                                       {0.0, 0.0, 0.2},
+                                       {0.0, 0.1, 0.0},
+                                       {0.0, 0.1, 0.1},
+                                       {0.0, 0.1, 0.2},
+                                       {0.0, 0.2, 0.0},
+                                       {0.0, 0.2, 0.1},
+                                       {0.0, 0.2, 0.2},
+                                       {0.1, 0.0, 0.0}},
+                                      device);
+    const double radius = 0.15;
+    const int max_knn = 4;
+    const int64_t tile_size = 3;
+    const int64_t n = dataset_points.GetLength();
+
+    core::nns::NearestNeighborSearch nns(dataset_points, core::Int64);
+    nns.FixedRadiusIndex(radius);
+    nns.HybridIndex(radius);
+
+    EXPECT_THROW(nns.FixedRadiusSearchTiled(
+                         dataset_points, radius, 0,
+                         [](int64_t, const core::Tensor&, const core::Tensor&,
+                            const core::Tensor&) {}),
+                 std::runtime_error);
+
+    // Fixed radius search.
+    core::Tensor gt_indices, gt_distances, gt_splits;
+    std::tie(gt_indices, gt_distances, gt_splits) =
+            nns.FixedRadiusSearch(dataset_points, radius);
+    gt_splits = gt_splits.To(core::Device("CPU:0"));
+    int64_t num_queries = 0;
+    nns.FixedRadiusSearchTiled(
+            dataset_points, radius, tile_size,
+            [&](int64_t offset, const core::Tensor& indices,
+                const core::Tensor& distances, const core::Tensor& splits) {
+                const int64_t length = splits.GetLength() - 1;
+                EXPECT_EQ(offset, num_queries);
+                EXPECT_LE(length, tile_size);
+                const int64_t start = gt_splits[offset].Item<int64_t>();
+                const int64_t stop =
+                        gt_splits[offset + length].Item<int64_t>();
+                EXPECT_TRUE(splits.To(core::Device("CPU:0"))
+                                    .AllClose(gt_splits.Slice(
+                                                      0, offset,
+                                                      offset + length + 1) -
+                                              start));
+                EXPECT_TRUE(indices.AllClose(
+                        gt_indices.Slice(0, start, stop)));
+                EXPECT_TRUE(distances.AllClose(
+                        gt_distances.Slice(0, start, stop)));
+                num_queries += length;
+            });
+    EXPECT_EQ(num_queries, n);
+
+    // Hybrid search.
+    core::Tensor gt_counts;
+    std::tie(gt_indices, gt_distances, gt_counts) =
+            nns.HybridSearch(dataset_points, radius, max_knn);
+    num_queries = 0;
+    nns.HybridSearchTiled(
+            dataset_points, radius, max_knn, tile_size,
+            [&](int64_t offset, const core::Tensor& indices,
+                const core::Tensor& distances, const core::Tensor& counts) {
+                const int64_t length = counts.GetLength();
+                EXPECT_EQ(offset, num_queries);
+                EXPECT_TRUE(indices.AllClose(
+                        gt_indices.Slice(0, offset, offset + length)));
+                EXPECT_TRUE(distances.AllClose(
+                        gt_distances.Slice(0, offset, offset + length)));
+                EXPECT_TRUE(counts.AllClose(
+                        gt_counts.Slice(0, offset, offset + length)));
+                num_queries += length;
+            });
+    EXPECT_EQ(num_queries, n);
+}
+
 }  // namespace tests
 }  // namespace open3d
@@ -56,6 +56,45 @@ TEST(ParallelFor, LambdaCPU) {
     }
 }
 
+TEST(ParallelFor, MultiISACPU) {
+    const core::Device device("CPU:0");
+    const int64_t N = 100000;
+    std::vector<float> a(N), b(N);
+
+    // A vectorizable loop, compiled for each ISA.
+    const float scale = 3.0f;
+    core::ParallelForMultiISA(device, N, [&](int64_t idx) {
+        a[idx] = static_cast<float>(idx);
+        b[idx] = a[idx] * scale + 1.0f;
+    });
+
+    for (int64_t i = 0; i < N; ++i) {
+        ASSERT_EQ(b[i], static_cast<float>(i) * scale + 1.0f);
+    }
+}
+
+TEST(ParallelFor, GrainSizeCPU) {
+    const core::Device device("CPU:0");
+    const int64_t N = 100000;
+    std::vector<int64_t> v(N, -1);
+
+    // Work items with very different costs.
+    for (int64_t grain_size : std::vector<int64_t>{1, 16, 1000, 2 * N}) {
+        core::ParallelFor(device, N, grain_size, [&](int64_t idx) {
+            int64_t sum = 0;
+            for (int64_t i = 0; i < idx % 1000; ++i) {
+                sum += i;
+            }
+            v[idx] = sum;
+        });
+
+        for (int64_t i = 0; i < N; ++i) {
+            const int64_t m = i % 1000;
+            ASSERT_EQ(v[i], m * (m - 1) / 2);
+        }
+    }
+}
+
 TEST(ParallelFor, VectorizedLambda1) {
     const size_t N = 10000000;
     std::vector<int64_t> v(N);
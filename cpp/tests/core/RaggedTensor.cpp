@@ -0,0 +1,165 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/core/RaggedTensor.h"
+
+#include <vector>
+
+#include "tests/Tests.h"
+#include "tests/core/CoreTest.h"
+
+namespace open3d {
+namespace tests {
+
+class RaggedTensorPermuteDevices : public PermuteDevices {};
+INSTANTIATE_TEST_SUITE_P(RaggedTensor,
+                         RaggedTensorPermuteDevices,
+                         testing::ValuesIn(PermuteDevices::TestCases()));
+
+TEST_P(RaggedTensorPermuteDevices, FromRowLengths) {
+    core::Device device = GetParam();
+
+    core::Tensor values = core::Tensor::Init<float>({1, 2, 3, 4, 5}, device);
+    core::Tensor lengths = core::Tensor::Init<int64_t>({2, 0, 3}, device);
+    core::RaggedTensor r = core::RaggedTensor::FromRowLengths(values, lengths);
+    EXPECT_EQ(r.NumRows(), 3);
+    EXPECT_EQ(r.NumValues(), 5);
+    EXPECT_EQ(r.GetRowSplits().ToFlatVector<int64_t>(),
+              std::vector<int64_t>({0, 2, 2, 5}));
+    EXPECT_EQ(r.GetRowLengths().ToFlatVector<int64_t>(),
+              std::vector<int64_t>({2, 0, 3}));
+    EXPECT_EQ(r.GetRow(2).ToFlatVector<float>(), std::vector<float>({3, 4, 5}));
+    EXPECT_EQ(r.GetRow(1).GetLength(), 0);
+
+    // Lengths must add up to the number of values.
+    EXPECT_ANY_THROW(core::RaggedTensor::FromRowLengths(
+            values, core::Tensor::Init<int64_t>({2, 2}, device)));
+    // Row splits must be non-decreasing.
+    EXPECT_ANY_THROW(core::RaggedTensor(
+            values, core::Tensor::Init<int64_t>({0, 3, 2, 5}, device)));
+}
+
+TEST_P(RaggedTensorPermuteDevices, FromTensors) {
+    core::Device device = GetParam();
+
+    core::RaggedTensor r = core::RaggedTensor::FromTensors(
+            {core::Tensor::Init<int32_t>({{1, 2}, {3, 4}}, device),
+             core::Tensor::Empty({0, 2}, core::Int32, device),
+             core::Tensor::Init<int32_t>({{5, 6}}, device)});
+    EXPECT_EQ(r.NumRows(), 3);
+    EXPECT_EQ(r.GetElementShape(), core::SizeVector({2}));
+    EXPECT_EQ(r.GetRowSplits().ToFlatVector<int64_t>(),
+              std::vector<int64_t>({0, 2, 2, 3}));
+    EXPECT_EQ(r.GetValues().ToFlatVector<int32_t>(),
+              std::vector<int32_t>({1, 2, 3, 4, 5, 6}));
+
+    // Element shapes must match.
+    EXPECT_ANY_THROW(core::RaggedTensor::FromTensors(
+            {core::Tensor::Init<int32_t>({{1, 2}}, device),
+             core::Tensor::Init<int32_t>({{1, 2, 3}}, device)}));
+}
+
+TEST_P(RaggedTensorPermuteDevices, GatherRows) {
+    core::Device device = GetParam();
+
+    core::RaggedTensor r = core::RaggedTensor::FromRowLengths(
+            core::Tensor::Init<double>({1, 2, 3, 4, 5, 6}, device),
+            core::Tensor::Init<int64_t>({1, 0, 3, 2}, device));
+    core::RaggedTensor g =
+            r.GatherRows(core::Tensor::Init<int64_t>({2, 1, 0, 2}, device));
+    EXPECT_EQ(g.GetRowSplits().ToFlatVector<int64_t>(),
+              std::vector<int64_t>({0, 3, 3, 4, 7}));
+    EXPECT_EQ(g.GetValues().ToFlatVector<double>(),
+              std::vector<double>({2, 3, 4, 1, 2, 3, 4}));
+
+    core::RaggedTensor empty =
+            r.GatherRows(core::Tensor::Empty({0}, core::Int64, device));
+    EXPECT_EQ(empty.NumRows(), 0);
+    EXPECT_EQ(empty.NumValues(), 0);
+}
+
+TEST_P(RaggedTensorPermuteDevices, Reduce) {
+    core::Device device = GetParam();
+
+    core::RaggedTensor r = core::RaggedTensor::FromRowLengths(
+            core::Tensor::Init<float>({1, 5, 3, 4, -2}, device),
+            core::Tensor::Init<int64_t>({3, 0, 2}, device));
+    EXPECT_EQ(r.Sum().ToFlatVector<float>(), std::vector<float>({9, 0, 2}));
+    EXPECT_EQ(r.Mean().ToFlatVector<float>(), std::vector<float>({3, 0, 1}));
+    EXPECT_EQ(r.Max().ToFlatVector<float>(), std::vector<float>({5, 0, 4}));
+    EXPECT_EQ(r.ArgMax().ToFlatVector<int64_t>(),
+              std::vector<int64_t>({1, -1, 3}));
+}
+
+TEST_P(RaggedTensorPermuteDevices, ToDense) {
+    core::Device device = GetParam();
+
+    core::RaggedTensor r = core::RaggedTensor::FromRowLengths(
+            core::Tensor::Init<int32_t>({1, 2, 3, 4, 5}, device),
+            core::Tensor::Init<int64_t>({2, 0, 3}, device));
+    core::Tensor dense = r.ToDense(-1, -1);
+    EXPECT_EQ(dense.GetShape(), core::SizeVector({3, 3}));
+    EXPECT_EQ(dense.ToFlatVector<int32_t>(),
+              std::vector<int32_t>({1, 2, -1, -1, -1, -1, 3, 4, 5}));
+
+    core::Tensor truncated = r.ToDense(2);
+    EXPECT_EQ(truncated.GetShape(), core::SizeVector({3, 2}));
+    EXPECT_EQ(truncated.ToFlatVector<int32_t>(),
+              std::vector<int32_t>({1, 2, 0, 0, 3, 4}));
+
+    core::RaggedTensor v = core::RaggedTensor::FromTensors(
+            {core::Tensor::Init<float>({{1, 2}}, device),
+             core::Tensor::Init<float>({{3, 4}, {5, 6}}, device)});
+    core::Tensor dense_v = v.ToDense();
+    EXPECT_EQ(dense_v.GetShape(), core::SizeVector({2, 2, 2}));
+    EXPECT_EQ(dense_v.ToFlatVector<float>(),
+              std::vector<float>({1, 2, 0, 0, 3, 4, 5, 6}));
+}
+
+TEST_P(RaggedTensorPermuteDevices, Concatenate) {
+    core::Device device = GetParam();
+
+    core::RaggedTensor a = core::RaggedTensor::FromRowLengths(
+            core::Tensor::Init<float>({1, 2, 3}, device),
+            core::Tensor::Init<int64_t>({1, 2}, device));
+    core::RaggedTensor b = core::RaggedTensor::FromRowLengths(
+            core::Tensor::Init<float>({4, 5}, device),
+            core::Tensor::Init<int64_t>({0, 2}, device));
+    core::RaggedTensor c = core::RaggedTensor::Concatenate({a, b});
+    EXPECT_EQ(c.NumRows(), 4);
+    EXPECT_EQ(c.GetRowSplits().ToFlatVector<int64_t>(),
+              std::vector<int64_t>({0, 1, 3, 3, 5}));
+    EXPECT_EQ(c.GetValues().ToFlatVector<float>(),
+              std::vector<float>({1, 2, 3, 4, 5}));
+
+    core::RaggedTensor moved = c.To(core::Device("CPU:0"));
+    EXPECT_EQ(moved.GetDevice(), core::Device("CPU:0"));
+    EXPECT_EQ(moved.GetRowSplits().GetDevice(), core::Device("CPU:0"));
+}
+
+}  // namespace tests
+}  // namespace open3d
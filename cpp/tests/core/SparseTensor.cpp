@@ -0,0 +1,119 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/core/SparseTensor.h"
+
+#include <vector>
+
+#include "tests/Tests.h"
+#include "tests/core/CoreTest.h"
+
+namespace open3d {
+namespace tests {
+
+class SparseTensorPermuteDevices : public PermuteDevices {};
+INSTANTIATE_TEST_SUITE_P(SparseTensor,
+                         SparseTensorPermuteDevices,
+                         testing::ValuesIn(PermuteDevices::TestCases()));
+
+TEST_P(SparseTensorPermuteDevices, FromCOO) {
+    core::Device device = GetParam();
+
+    // Unsorted triplets with a duplicate at (1, 2) and an empty row 2.
+    core::Tensor rows = core::Tensor::Init<int64_t>({3, 1, 0, 1, 1}, device);
+    core::Tensor cols = core::Tensor::Init<int32_t>({0, 2, 1, 0, 2}, device);
+    core::Tensor values = core::Tensor::Init<float>({5, 2, 1, 3, 4}, device);
+    core::SparseTensor A =
+            core::SparseTensor::FromCOO(rows, cols, values, {4, 3});
+    EXPECT_EQ(A.GetShape(), core::SizeVector({4, 3}));
+    EXPECT_EQ(A.NumNonZeros(), 4);
+    EXPECT_EQ(A.GetRowSplits().ToFlatVector<int64_t>(),
+              std::vector<int64_t>({0, 1, 3, 3, 4}));
+    EXPECT_EQ(A.GetColIndices().ToFlatVector<int64_t>(),
+              std::vector<int64_t>({1, 0, 2, 0}));
+    EXPECT_EQ(A.GetValues().ToFlatVector<float>(),
+              std::vector<float>({1, 3, 6, 5}));
+
+    core::Tensor dense = core::Tensor::Init<float>(
+            {{0, 1, 0}, {3, 0, 6}, {0, 0, 0}, {5, 0, 0}}, device);
+    EXPECT_TRUE(A.ToDense().AllClose(dense));
+    EXPECT_TRUE(core::SparseTensor::FromDense(dense).ToDense().AllClose(dense));
+    EXPECT_TRUE(A.T().ToDense().AllClose(dense.T()));
+
+    core::Tensor coo_rows, coo_cols, coo_values;
+    std::tie(coo_rows, coo_cols, coo_values) = A.ToCOO();
+    EXPECT_EQ(coo_rows.ToFlatVector<int64_t>(),
+              std::vector<int64_t>({0, 1, 1, 3}));
+
+    // Out of range and mismatched inputs.
+    EXPECT_ANY_THROW(core::SparseTensor::FromCOO(rows, cols, values, {3, 3}));
+    EXPECT_ANY_THROW(core::SparseTensor::FromCOO(rows.Slice(0, 0, 4), cols,
+                                                 values, {4, 3}));
+    EXPECT_ANY_THROW(core::SparseTensor::FromCOO(rows, cols, values, {4}));
+
+    // Empty matrices.
+    core::SparseTensor empty = core::SparseTensor::FromCOO(
+            core::Tensor::Empty({0}, core::Int64, device),
+            core::Tensor::Empty({0}, core::Int64, device),
+            core::Tensor::Empty({0}, core::Float32, device), {2, 2});
+    EXPECT_EQ(empty.NumNonZeros(), 0);
+    EXPECT_TRUE(empty.ToDense().AllClose(
+            core::Tensor::Zeros({2, 2}, core::Float32, device)));
+}
+
+TEST_P(SparseTensorPermuteDevices, SpMVSpMM) {
+    core::Device device = GetParam();
+
+    for (core::Dtype dtype : {core::Float32, core::Float64, core::Int32}) {
+        core::Tensor dense = core::Tensor::Init<float>(
+                {{0, 1, 0, 2}, {3, 0, 0, 0}, {0, 0, 0, 0}}, device)
+                                     .To(dtype);
+        core::SparseTensor A = core::SparseTensor::FromDense(dense);
+        core::Tensor x =
+                core::Tensor::Init<float>({1, 2, 3, 4}, device).To(dtype);
+        EXPECT_TRUE(A.SpMV(x).AllClose(
+                core::Tensor::Init<float>({10, 3, 0}, device).To(dtype)));
+
+        core::Tensor B = core::Tensor::Init<float>(
+                                 {{1, 0}, {0, 1}, {1, 1}, {2, 3}}, device)
+                                 .To(dtype);
+        EXPECT_TRUE(A.SpMM(B).AllClose(
+                core::Tensor::Init<float>({{4, 7}, {3, 0}, {0, 0}}, device)
+                        .To(dtype)));
+        EXPECT_TRUE(A.T().SpMV(core::Tensor::Init<float>({1, 2, 3}, device)
+                                       .To(dtype))
+                            .AllClose(core::Tensor::Init<float>({6, 1, 0, 2},
+                                                                device)
+                                              .To(dtype)));
+
+        EXPECT_ANY_THROW(A.SpMV(B));
+        EXPECT_ANY_THROW(A.SpMM(x));
+    }
+}
+
+}  // namespace tests
+}  // namespace open3d
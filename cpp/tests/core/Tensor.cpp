@@ -26,11 +26,17 @@
 
 #include "open3d/core/Tensor.h"
 
+#include <algorithm>
 #include <cmath>
 #include <limits>
+#include <numeric>
+#include <tuple>
 
 #include "open3d/core/AdvancedIndexing.h"
+#include "open3d/core/CUDAUtils.h"
+#include "open3d/core/Dispatch.h"
 #include "open3d/core/Dtype.h"
+#include "open3d/core/Future.h"
 #include "open3d/core/MemoryManager.h"
 #include "open3d/core/SizeVector.h"
 #include "open3d/core/kernel/Kernel.h"
@@ -384,6 +390,64 @@ TEST_P(TensorPermuteDevicePairs, ToDevice) {
     EXPECT_ANY_THROW(src_t.To(core::Device("CUDA:100000")));
 }
 
+TEST_P(TensorPermuteDevicePairs, ToAsync) {
+    core::Device dst_device;
+    core::Device src_device;
+    std::tie(dst_device, src_device) = GetParam();
+
+    core::Tensor src_t = core::Tensor::Init<float>({{0, 1, 2}, {3, 4, 5}},
+                                                   src_device);
+    core::TensorFuture dst_f = src_t.ToAsync(dst_device);
+    const core::Tensor dst_t = dst_f.Wait();
+    EXPECT_TRUE(dst_f.IsReady());
+    EXPECT_EQ(dst_t.GetDevice(), dst_device);
+    EXPECT_TRUE(dst_t.To(src_device).AllClose(src_t));
+    if (dst_device == src_device) {
+        EXPECT_EQ(dst_t.GetDataPtr(), src_t.GetDataPtr());
+    } else if (dst_device.GetType() == core::Device::DeviceType::CPU) {
+        // Downloads are written into pinned memory to run asynchronously.
+        EXPECT_EQ(dst_t.IsPinned(), core::cuda::IsAvailable());
+    }
+
+    // Copy and chain on the same stream.
+    core::TensorFuture sum_f =
+            src_t.ToAsync(dst_device, /*copy=*/true)
+                    .Then([](const core::Tensor& t) { return t.Sum({0}); });
+    EXPECT_EQ(sum_f.Wait().ToFlatVector<float>(),
+              std::vector<float>({3, 5, 7}));
+
+    // Non-contiguous sources are made contiguous first.
+    core::Tensor src_tt = src_t.T();
+    core::TensorFuture contiguous_f = src_tt.ContiguousAsync();
+    EXPECT_TRUE(contiguous_f.Wait().IsContiguous());
+    EXPECT_TRUE(contiguous_f.Wait().AllClose(src_tt));
+    EXPECT_TRUE(src_tt.ToAsync(dst_device).Wait().To(src_device).AllClose(
+            src_tt));
+}
+
+TEST_P(TensorPermuteDevices, PinMemory) {
+    core::Device device = GetParam();
+
+    core::Tensor src_t = core::Tensor::Init<float>({0, 1, 2, 3});
+    core::Tensor pinned_t = src_t.PinMemory();
+    EXPECT_EQ(pinned_t.GetDevice(), core::Device("CPU:0"));
+    EXPECT_EQ(pinned_t.IsPinned(), core::cuda::IsAvailable());
+    EXPECT_FALSE(src_t.IsPinned());
+    EXPECT_TRUE(pinned_t.AllClose(src_t));
+    if (pinned_t.IsPinned()) {
+        EXPECT_EQ(pinned_t.PinMemory().GetDataPtr(), pinned_t.GetDataPtr());
+    }
+
+    // Round trip through the device.
+    core::Tensor dst_t = core::Tensor::EmptyPinned({4}, core::Float32);
+    dst_t.CopyFrom(pinned_t.To(device));
+    EXPECT_TRUE(dst_t.AllClose(src_t));
+
+    if (device.GetType() == core::Device::DeviceType::CUDA) {
+        EXPECT_ANY_THROW(pinned_t.To(device).PinMemory());
+    }
+}
+
 TEST_P(TensorPermuteDevicePairs, CopyBroadcast) {
     core::Device dst_device;
     core::Device src_device;
@@ -1186,6 +1250,39 @@ TEST_P(TensorPermuteDevicePairs, IndexGetNegative) {
     EXPECT_EQ(t_1.ToFlatVector<float>(), std::vector<float>({5, 10, 17, 22}));
 }
 
+TEST_P(TensorPermuteDevicePairs, IndexGetSetRows) {
+    core::Device idx_device;
+    core::Device src_device;
+    std::tie(idx_device, src_device) = GetParam();
+
+    core::Tensor t = core::Tensor::Init<double>(
+            {{0, 1, 2}, {3, 4, 5}, {6, 7, 8}, {9, 10, 11}}, src_device);
+    core::Tensor rows =
+            core::Tensor::Init<int64_t>({3, 0, -1, 1, 3}, idx_device);
+
+    // t[[3, 0, -1, 1, 3]]
+    core::Tensor t_1 = t.IndexGet({rows});
+    EXPECT_EQ(t_1.GetShape(), core::SizeVector({5, 3}));
+    EXPECT_EQ(t_1.ToFlatVector<double>(),
+              std::vector<double>(
+                      {9, 10, 11, 0, 1, 2, 9, 10, 11, 3, 4, 5, 9, 10, 11}));
+
+    // t[[2, -4]] = [[20, 21, 22], [30, 31, 32]]
+    t.IndexSet({core::Tensor::Init<int64_t>({2, -4}, idx_device)},
+               core::Tensor::Init<double>({{20, 21, 22}, {30, 31, 32}},
+                                          src_device));
+    EXPECT_EQ(t.ToFlatVector<double>(),
+              std::vector<double>(
+                      {30, 31, 32, 3, 4, 5, 20, 21, 22, 9, 10, 11}));
+
+    // Bool rows of a 1-D tensor.
+    core::Tensor b = core::Tensor::Init<bool>({true, false, true}, src_device);
+    core::Tensor b_1 =
+            b.IndexGet({core::Tensor::Init<int64_t>({1, 2, 1}, idx_device)});
+    EXPECT_EQ(b_1.ToFlatVector<bool>(),
+              std::vector<bool>({false, true, false}));
+}
+
 TEST_P(TensorPermuteDevicePairs, IndexGet2DBroadcastedIndex) {
     core::Device idx_device;
     core::Device src_device;
@@ -1586,6 +1683,36 @@ TEST_P(TensorPermuteDevices, Add_) {
               std::vector<float>({10, 12, 14, 16, 18, 20}));
 }
 
+TEST_P(TensorPermuteDevices, AddBroadcastLayouts) {
+    core::Device device = GetParam();
+    core::Tensor a = core::Tensor::Init<float>({{0, 1, 2}, {3, 4, 5}}, device);
+
+    // Scalar RHS.
+    core::Tensor s = core::Tensor::Init<float>(10, device);
+    EXPECT_EQ((a + s).ToFlatVector<float>(),
+              std::vector<float>({10, 11, 12, 13, 14, 15}));
+
+    // Inner-dimension broadcast RHS.
+    core::Tensor v = core::Tensor::Init<float>({10, 20, 30}, device);
+    EXPECT_EQ((a + v).ToFlatVector<float>(),
+              std::vector<float>({10, 21, 32, 13, 24, 35}));
+    EXPECT_EQ((a > v - 19).ToFlatVector<bool>(),
+              std::vector<bool>({true, false, false, true, true, false}));
+
+    // Outer-dimension broadcast and strided RHS take the generic path.
+    core::Tensor w = core::Tensor::Init<float>({{10}, {20}}, device);
+    EXPECT_EQ((a + w).ToFlatVector<float>(),
+              std::vector<float>({10, 11, 12, 23, 24, 25}));
+    core::Tensor t = core::Tensor::Init<float>(
+            {{10, 0, 20, 0, 30, 0}, {40, 0, 50, 0, 60, 0}}, device);
+    EXPECT_EQ((a + t.Slice(1, 0, 6, 2)).ToFlatVector<float>(),
+              std::vector<float>({10, 21, 32, 43, 54, 65}));
+
+    // Broadcast copies with dtype conversion.
+    EXPECT_EQ(v.Expand({2, 3}).To(core::Int32).ToFlatVector<int>(),
+              std::vector<int>({10, 20, 30, 10, 20, 30}));
+}
+
 TEST_P(TensorPermuteDevices, Add_BroadcastException) {
     // A.shape = (   3, 4)
     // B.shape = (2, 3, 4)
@@ -2257,6 +2384,206 @@ TEST_P(TensorPermuteDevices, ReduceArgMax) {
               std::vector<int64_t>({1, 2, 2, 1, 3, 2}));
 }
 
+TEST_P(TensorPermuteDevices, ReduceArgMinMaxTies) {
+    core::Device device = GetParam();
+    // Ties return the first occurrence, also across vectorized lanes and
+    // parallel chunks.
+    std::vector<int32_t> vals(10000, 3);
+    vals[17] = vals[9000] = 1;
+    vals[4242] = vals[8888] = 7;
+    core::Tensor src(vals, {10000}, core::Int32, device);
+    EXPECT_EQ(src.ArgMin({0}).Item<int64_t>(), 17);
+    EXPECT_EQ(src.ArgMax({0}).Item<int64_t>(), 4242);
+
+    src = src.Reshape({2, 5000});
+    EXPECT_EQ(src.ArgMin({1}).ToFlatVector<int64_t>(),
+              std::vector<int64_t>({17, 4000}));
+    EXPECT_EQ(src.ArgMax({1}).ToFlatVector<int64_t>(),
+              std::vector<int64_t>({4242, 3888}));
+
+    // All elements equal to the identity.
+    src = core::Tensor::Full({2, 3}, std::numeric_limits<float>::max(),
+                             core::Float32, device);
+    EXPECT_EQ(src.ArgMin({1}).ToFlatVector<int64_t>(),
+              std::vector<int64_t>({0, 0}));
+}
+
+TEST_P(TensorPermuteDevices, SegmentReduction) {
+    core::Device device = GetParam();
+    core::Tensor src = core::Tensor::Init<float>(
+            {{1, 8}, {4, 2}, {3, 5}, {7, 0}, {6, 9}}, device);
+    // Segments {0, 1, 2}, {}, {3, 4}.
+    core::Tensor row_splits =
+            core::Tensor::Init<int64_t>({0, 3, 3, 5}, device);
+
+    core::Tensor dst = src.SegmentSum(row_splits);
+    EXPECT_EQ(dst.GetShape(), core::SizeVector({3, 2}));
+    EXPECT_EQ(dst.ToFlatVector<float>(),
+              std::vector<float>({8, 15, 0, 0, 13, 9}));
+
+    dst = src.SegmentMean(row_splits);
+    EXPECT_EQ(dst.ToFlatVector<float>(),
+              std::vector<float>({8.f / 3, 5, 0, 0, 6.5, 4.5}));
+
+    dst = src.SegmentMax(row_splits);
+    EXPECT_EQ(dst.ToFlatVector<float>(),
+              std::vector<float>({4, 8, 0, 0, 7, 9}));
+
+    dst = src.SegmentArgMax(row_splits);
+    EXPECT_EQ(dst.GetDtype(), core::Int64);
+    EXPECT_EQ(dst.ToFlatVector<int64_t>(),
+              std::vector<int64_t>({1, 0, -1, -1, 3, 4}));
+
+    // Integer sum.
+    dst = src.To(core::Int32).SegmentSum(row_splits);
+    EXPECT_EQ(dst.ToFlatVector<int>(), std::vector<int>({8, 15, 0, 0, 13, 9}));
+
+    // No segments.
+    dst = src.Slice(0, 0, 0).SegmentSum(
+            core::Tensor::Init<int64_t>({0}, device));
+    EXPECT_EQ(dst.GetShape(), core::SizeVector({0, 2}));
+
+    // Invalid row splits.
+    EXPECT_ANY_THROW(
+            src.SegmentSum(core::Tensor::Init<int64_t>({0, 3}, device)));
+    EXPECT_ANY_THROW(
+            src.SegmentSum(core::Tensor::Init<int64_t>({0, 4, 2, 5}, device)));
+    EXPECT_ANY_THROW(
+            src.SegmentSum(core::Tensor::Init<int32_t>({0, 3, 5}, device)));
+    EXPECT_ANY_THROW(src.To(core::Int32).SegmentMean(row_splits));
+}
+
+TEST_P(TensorPermuteDevices, PrefixSum) {
+    core::Device device = GetParam();
+    core::Tensor src = core::Tensor::Init<int64_t>({3, 1, 4, 1, 5}, device);
+    EXPECT_EQ(src.InclusivePrefixSum().ToFlatVector<int64_t>(),
+              std::vector<int64_t>({3, 4, 8, 9, 14}));
+    EXPECT_EQ(src.ExclusivePrefixSum().ToFlatVector<int64_t>(),
+              std::vector<int64_t>({0, 3, 4, 8, 9}));
+
+    // Each column is scanned independently.
+    src = core::Tensor::Init<float>({{1, 2}, {3, 4}, {5, 6}}, device);
+    EXPECT_EQ(src.InclusivePrefixSum().ToFlatVector<float>(),
+              std::vector<float>({1, 2, 4, 6, 9, 12}));
+    EXPECT_EQ(src.ExclusivePrefixSum().ToFlatVector<float>(),
+              std::vector<float>({0, 0, 1, 2, 4, 6}));
+
+    // Non-contiguous input.
+    EXPECT_EQ(src.T().InclusivePrefixSum().ToFlatVector<float>(),
+              std::vector<float>({1, 3, 5, 3, 7, 11}));
+
+    // Large input against a sequential scan.
+    src = core::Tensor::Arange(0, 100000, 1, core::Int64, device);
+    std::vector<int64_t> expected(100000);
+    for (int64_t i = 1; i < 100000; ++i) expected[i] = expected[i - 1] + i;
+    EXPECT_EQ(src.InclusivePrefixSum().ToFlatVector<int64_t>(), expected);
+
+    EXPECT_EQ(core::Tensor({0}, core::Float32, device)
+                      .ExclusivePrefixSum()
+                      .GetShape(),
+              core::SizeVector({0}));
+}
+
+TEST_P(TensorPermuteDevices, Sort) {
+    core::Device device = GetParam();
+    core::Tensor src =
+            core::Tensor::Init<float>({3, -1, 2, -1, 0, 5, 2}, device);
+    EXPECT_EQ(src.Sort().ToFlatVector<float>(),
+              std::vector<float>({-1, -1, 0, 2, 2, 3, 5}));
+    EXPECT_EQ(src.Sort(true).ToFlatVector<float>(),
+              std::vector<float>({5, 3, 2, 2, 0, -1, -1}));
+    // Stable for equal elements in both orders.
+    EXPECT_EQ(src.ArgSort().ToFlatVector<int64_t>(),
+              std::vector<int64_t>({1, 3, 4, 2, 6, 0, 5}));
+    EXPECT_EQ(src.ArgSort(true).ToFlatVector<int64_t>(),
+              std::vector<int64_t>({5, 0, 2, 6, 4, 1, 3}));
+
+    // All dtypes against std::stable_sort, with enough elements for
+    // multiple radix sort chunks.
+    const int64_t n = 300000;
+    std::vector<int64_t> values_vec(n);
+    for (int64_t i = 0; i < n; ++i) {
+        values_vec[i] = (i * 7919) % 100003 - 50000;
+    }
+    const core::Tensor values(values_vec, {n}, core::Int64, device);
+    for (const core::Dtype& dtype :
+         {core::Float32, core::Float64, core::Int8, core::Int16, core::Int32,
+          core::Int64, core::UInt8, core::UInt16, core::UInt32,
+          core::UInt64}) {
+        const core::Tensor keys = values.To(dtype);
+        std::vector<int64_t> expected(n);
+        std::iota(expected.begin(), expected.end(), 0);
+        DISPATCH_DTYPE_TO_TEMPLATE(dtype, [&]() {
+            const std::vector<scalar_t> keys_vec =
+                    keys.ToFlatVector<scalar_t>();
+            std::stable_sort(expected.begin(), expected.end(),
+                             [&](int64_t a, int64_t b) {
+                                 return keys_vec[a] < keys_vec[b];
+                             });
+        });
+        EXPECT_EQ(keys.ArgSort().ToFlatVector<int64_t>(), expected)
+                << dtype.ToString();
+    }
+
+    EXPECT_EQ(core::Tensor({0}, core::Int32, device).Sort().GetShape(),
+              core::SizeVector({0}));
+    EXPECT_ANY_THROW(core::Tensor({2, 2}, core::Int32, device).Sort());
+    EXPECT_ANY_THROW(core::Tensor({2}, core::Bool, device).Sort());
+}
+
+TEST_P(TensorPermuteDevices, SegmentSort) {
+    core::Device device = GetParam();
+    core::Tensor src =
+            core::Tensor::Init<int32_t>({3, 1, 2, 5, 4, 4, 0}, device);
+    core::Tensor row_splits =
+            core::Tensor::Init<int64_t>({0, 3, 3, 6, 7}, device);
+    EXPECT_EQ(src.SegmentSort(row_splits).ToFlatVector<int32_t>(),
+              std::vector<int32_t>({1, 2, 3, 4, 4, 5, 0}));
+    EXPECT_EQ(src.SegmentArgSort(row_splits).ToFlatVector<int64_t>(),
+              std::vector<int64_t>({1, 2, 0, 4, 5, 3, 6}));
+    EXPECT_EQ(src.SegmentArgSort(row_splits, true).ToFlatVector<int64_t>(),
+              std::vector<int64_t>({0, 2, 1, 3, 4, 5, 6}));
+    EXPECT_ANY_THROW(
+            src.SegmentSort(core::Tensor::Init<int64_t>({0, 3}, device)));
+}
+
+TEST_P(TensorPermuteDevices, Unique) {
+    core::Device device = GetParam();
+    core::Tensor src =
+            core::Tensor::Init<int64_t>({4, 2, 4, 7, 2, 2, -1}, device);
+    EXPECT_EQ(src.Unique().ToFlatVector<int64_t>(),
+              std::vector<int64_t>({-1, 2, 4, 7}));
+
+    core::Tensor unique, inverse, counts;
+    std::tie(unique, inverse, counts) = src.UniqueWithInverseAndCounts();
+    EXPECT_EQ(unique.ToFlatVector<int64_t>(),
+              std::vector<int64_t>({-1, 2, 4, 7}));
+    EXPECT_EQ(inverse.ToFlatVector<int64_t>(),
+              std::vector<int64_t>({2, 1, 2, 3, 1, 1, 0}));
+    EXPECT_EQ(counts.ToFlatVector<int64_t>(),
+              std::vector<int64_t>({1, 3, 2, 1}));
+    EXPECT_TRUE(unique.IndexGet({inverse}).AllEqual(src));
+
+    EXPECT_EQ(core::Tensor({0}, core::Float32, device).Unique().GetShape(),
+              core::SizeVector({0}));
+}
+
+TEST_P(TensorPermuteDevices, TopK) {
+    core::Device device = GetParam();
+    core::Tensor src = core::Tensor::Init<float>({0.5, 3, -2, 3, 1}, device);
+    core::Tensor values, indices;
+    std::tie(values, indices) = src.TopK(3);
+    EXPECT_EQ(values.ToFlatVector<float>(), std::vector<float>({3, 3, 1}));
+    EXPECT_EQ(indices.ToFlatVector<int64_t>(),
+              std::vector<int64_t>({1, 3, 4}));
+
+    std::tie(values, indices) = src.TopK(2, false);
+    EXPECT_EQ(values.ToFlatVector<float>(), std::vector<float>({-2, 0.5}));
+    EXPECT_EQ(indices.ToFlatVector<int64_t>(), std::vector<int64_t>({2, 0}));
+
+    EXPECT_ANY_THROW(src.TopK(6));
+}
+
 TEST_P(TensorPermuteDevices, Sqrt) {
     core::Device device = GetParam();
     core::Tensor src =
@@ -2747,6 +3074,51 @@ TEST_P(TensorPermuteDevices, BooleanIndex) {
     EXPECT_EQ(y.GetDtype(), core::Float32);
 }
 
+TEST_P(TensorPermuteDevices, BooleanIndexGet) {
+    core::Device device = GetParam();
+
+    // A mask over the two leading dimensions selects rows of the last one.
+    core::Tensor a = core::Tensor::Arange(0, 12, 1, core::Int32, device)
+                             .Reshape({2, 2, 3});
+    core::Tensor mask =
+            core::Tensor::Init<bool>({{true, false}, {false, true}}, device);
+    core::Tensor b = a.IndexGet({mask});
+    EXPECT_EQ(b.GetShape(), core::SizeVector({2, 3}));
+    EXPECT_EQ(b.ToFlatVector<int32_t>(),
+              std::vector<int32_t>({0, 1, 2, 9, 10, 11}));
+
+    // Non-contiguous tensors and empty selections.
+    core::Tensor a_t = a.Reshape({4, 3}).T();
+    b = a_t.IndexGet({core::Tensor::Init<bool>({false, true, false}, device)});
+    EXPECT_EQ(b.GetShape(), core::SizeVector({1, 4}));
+    EXPECT_EQ(b.ToFlatVector<int32_t>(), std::vector<int32_t>({1, 4, 7, 10}));
+    b = a.IndexGet({core::Tensor::Zeros({2}, core::Bool, device)});
+    EXPECT_EQ(b.GetShape(), core::SizeVector({0, 2, 3}));
+
+    // Rows of different byte sizes compacted with one mask, compared with a
+    // gather through the indices of the mask.
+    const int64_t n = 10007;
+    core::Tensor values = core::Tensor::Arange(0, n * 3, 1, core::Float64,
+                                               device)
+                                  .Reshape({n, 3});
+    std::vector<uint8_t> host_mask(n);
+    for (int64_t i = 0; i < n; ++i) {
+        host_mask[i] = (i * 7919) % 5 < 2;
+    }
+    core::Tensor large_mask =
+            core::Tensor(host_mask, {n}, core::UInt8, device).To(core::Bool);
+    core::Tensor indices = large_mask.NonZero().Reshape({-1});
+    core::Tensor colors = values.To(core::UInt8);
+    std::vector<core::Tensor> selected =
+            core::kernel::MaskedIndexGet({values, colors}, large_mask);
+    EXPECT_TRUE(selected[0].AllEqual(values.IndexGet({indices})));
+    EXPECT_TRUE(selected[1].AllEqual(colors.IndexGet({indices})));
+    EXPECT_TRUE(values.IndexGet({large_mask}).AllEqual(selected[0]));
+
+    EXPECT_ANY_THROW(core::kernel::MaskedIndexGet(
+            {values.Slice(0, 0, 10)}, large_mask));
+}
+
 TEST_P(TensorPermuteDevices, NonZeroNumpy) {
     core::Device device = GetParam();
 
@@ -3048,6 +3420,106 @@ TEST_P(TensorPermuteDevices, ToDLPackFromDLPack) {
               std::vector<float>({12, 14, 20, 22}));
 }
 
+TEST_P(TensorPermuteDevices, HalfConversion) {
+    core::Device device = GetParam();
+
+    // Exactly representable values, the largest finite half, a subnormal
+    // half and values rounded to nearest even.
+    core::Tensor src = core::Tensor::Init<float>(
+            {0.f, -2.5f, 65504.f, 5.9604645e-8f, 1.f + 1.f / 4096.f, 70000.f},
+            device);
+    core::Tensor half = src.To(core::Float16);
+    EXPECT_EQ(half.GetDtype(), core::Float16);
+    EXPECT_EQ(half.GetDtype().ByteSize(), 2);
+    EXPECT_EQ(half.To(core::Float32).ToFlatVector<float>(),
+              std::vector<float>({0.f, -2.5f, 65504.f, 5.9604645e-8f, 1.f,
+                                  std::numeric_limits<float>::infinity()}));
+    EXPECT_EQ(half[1].Item<core::float16_t>().GetBits(), 0xc100);
+
+    // BFloat16 keeps the range of Float32 with an 8-bit mantissa.
+    core::Tensor bfloat16 =
+            core::Tensor::Init<float>({70000.f, 1.f + 1.f / 256.f, -3.f},
+                                      device)
+                    .To(core::BFloat16);
+    EXPECT_EQ(bfloat16.To(core::Float32).ToFlatVector<float>(),
+              std::vector<float>({70144.f, 1.f, -3.f}));
+
+    // Integer and half conversions.
+    EXPECT_EQ(half.Slice(0, 0, 3).To(core::Int32).ToFlatVector<int32_t>(),
+              std::vector<int32_t>({0, -2, 65504}));
+    EXPECT_EQ(core::Tensor::Init<int64_t>({-3, 7}, device)
+                      .To(core::Float16)
+                      .To(core::Int64)
+                      .ToFlatVector<int64_t>(),
+              std::vector<int64_t>({-3, 7}));
+
+    // Fill and print.
+    core::Tensor filled = core::Tensor::Full({2}, 0.5, core::Float16, device);
+    EXPECT_EQ(filled.To(core::Float32).ToFlatVector<float>(),
+              std::vector<float>({0.5f, 0.5f}));
+    EXPECT_EQ(filled[0].ToString(false, ""), "0.5");
+}
+
+TEST_P(TensorPermuteDevices, HalfArithmetic) {
+    core::Device device = GetParam();
+
+    for (core::Dtype dtype : {core::Float16, core::BFloat16}) {
+        core::Tensor a = core::Tensor::Init<float>({1, 2, 4, 9}, device)
+                                 .To(dtype);
+        core::Tensor b = core::Tensor::Init<float>({0.5, 1, -2, 3}, device)
+                                 .To(dtype);
+
+        // Binary and unary element-wise ops keep the half dtype.
+        core::Tensor sum = a + b;
+        EXPECT_EQ(sum.GetDtype(), dtype);
+        EXPECT_EQ(sum.To(core::Float32).ToFlatVector<float>(),
+                  std::vector<float>({1.5, 3, 2, 12}));
+        EXPECT_EQ((a * 2.0).To(core::Float32).ToFlatVector<float>(),
+                  std::vector<float>({2, 4, 8, 18}));
+        core::Tensor c = a.Clone();
+        c.Div_(b);
+        EXPECT_EQ(c.To(core::Float32).ToFlatVector<float>(),
+                  std::vector<float>({2, 2, -2, 3}));
+        EXPECT_EQ(a.Sqrt().To(core::Float32).ToFlatVector<float>(),
+                  a.To(core::Float32)
+                          .Sqrt()
+                          .To(dtype)
+                          .To(core::Float32)
+                          .ToFlatVector<float>());
+        EXPECT_EQ(a.Gt(b).ToFlatVector<bool>(),
+                  std::vector<bool>({true, true, true, true}));
+        EXPECT_EQ(a.Lt(3.0).ToFlatVector<bool>(),
+                  std::vector<bool>({true, true, false, false}));
+        EXPECT_EQ(b.Abs().To(core::Float32).ToFlatVector<float>(),
+                  std::vector<float>({0.5, 1, 2, 3}));
+        EXPECT_EQ(a.IsFinite().ToFlatVector<bool>(),
+                  std::vector<bool>({true, true, true, true}));
+
+        // Reductions accumulate in Float32. A Float16 running sum would stop
+        // at 2048, where the spacing of representable values exceeds 1.
+        core::Tensor ones = core::Tensor::Ones({4096}, dtype, device);
+        core::Tensor ones_sum = ones.Sum({0});
+        EXPECT_EQ(ones_sum.GetDtype(), dtype);
+        EXPECT_EQ(ones_sum.To(core::Float32).Item<float>(), 4096.f);
+        EXPECT_EQ(a.Max({0}).To(core::Float32).Item<float>(), 9.f);
+        EXPECT_EQ(b.ArgMin({0}).Item<int64_t>(), 2);
+
+        // Advanced indexing.
+        core::Tensor index = core::Tensor::Init<int64_t>({3, 0}, device);
+        EXPECT_EQ(a.IndexGet({index}).To(core::Float32).ToFlatVector<float>(),
+                  std::vector<float>({9, 1}));
+        core::Tensor d = a.Clone();
+        d.IndexSet({index}, b.IndexGet({index}));
+        EXPECT_EQ(d.To(core::Float32).ToFlatVector<float>(),
+                  std::vector<float>({0.5, 2, 4, 3}));
+
+        // DLPack exchange keeps the dtype.
+        core::Tensor e = core::Tensor::FromDLPack(a.ToDLPack());
+        EXPECT_EQ(e.GetDtype(), dtype);
+        EXPECT_TRUE(e.To(core::Float32).AllEqual(a.To(core::Float32)));
+    }
+}
+
 TEST_P(TensorPermuteDevices, IsSame) {
     core::Device device = GetParam();
 
@@ -368,6 +368,82 @@ TEST_P(TensorListPermuteDevices, Extend) {
     EXPECT_TRUE(tl1[7].AllClose(core::Tensor::Zeros({2, 3}, dtype, device)));
 }
 
+TEST_P(TensorListPermuteDevices, ExtendTensor) {
+    core::Device device = GetParam();
+    core::Dtype dtype = core::Float32;
+
+    core::TensorList tl({2, 3}, dtype, device);
+    core::Tensor t0 = core::Tensor::Ones({3, 2, 3}, dtype, device);
+    tl.Extend(t0);
+    EXPECT_EQ(tl.GetSize(), 3);
+    EXPECT_EQ(tl.GetReservedSize(), 8);
+    EXPECT_TRUE(tl.AsTensor().AllClose(t0));
+    EXPECT_FALSE(tl.AsTensor().IsSame(t0));  // Values should be copied
+
+    // Extend with its own elements.
+    tl.Extend(tl.AsTensor() * 2);
+    tl.Extend(tl.AsTensor().Slice(0, 0, 2));
+    EXPECT_EQ(tl.GetSize(), 8);
+    EXPECT_EQ(tl.GetReservedSize(), 16);
+    EXPECT_TRUE(tl.AsTensor().Slice(0, 0, 3).AllClose(t0));
+    EXPECT_TRUE(tl.AsTensor().Slice(0, 3, 6).AllClose(t0 * 2));
+    EXPECT_TRUE(tl.AsTensor().Slice(0, 6, 8).AllClose(t0.Slice(0, 0, 2)));
+
+    // An empty tensor does not change the tensorlist.
+    tl.Extend(core::Tensor::Empty({0, 2, 3}, dtype, device));
+    EXPECT_EQ(tl.GetSize(), 8);
+
+    EXPECT_ANY_THROW(tl.Extend(core::Tensor::Ones({2, 3}, dtype, device)));
+    EXPECT_ANY_THROW(
+            tl.Extend(core::Tensor::Ones({3, 2, 3}, core::Float64, device)));
+    core::TensorList tl_inplace = core::TensorList::FromTensor(t0, true);
+    EXPECT_ANY_THROW(tl_inplace.Extend(t0));
+}
+
+TEST_P(TensorListPermuteDevices, ReserveBack) {
+    core::Device device = GetParam();
+    core::Dtype dtype = core::Int32;
+
+    core::TensorList tl({3}, dtype, device);
+    tl.Reserve(10);
+    EXPECT_EQ(tl.GetSize(), 0);
+    EXPECT_EQ(tl.GetReservedSize(), 10);
+    tl.Reserve(5);
+    EXPECT_EQ(tl.GetReservedSize(), 10);
+
+    tl.PushBack(core::Tensor::Init<int>({1, 2, 3}, device));
+    const core::Tensor internal = tl.GetInternalTensor();
+
+    // Fill the back buffer in place, as a kernel would.
+    core::Tensor back = tl.ReserveBack(6);
+    EXPECT_EQ(back.GetShape(), core::SizeVector({6, 3}));
+    back.Slice(0, 0, 4).Fill(7);
+    tl.CommitBack(4);
+    EXPECT_EQ(tl.GetSize(), 5);
+    EXPECT_TRUE(tl.GetInternalTensor().IsSame(internal));  // No reallocation
+    EXPECT_TRUE(tl[0].AllEqual(core::Tensor::Init<int>({1, 2, 3}, device)));
+    EXPECT_TRUE(tl.AsTensor().Slice(0, 1, 5).AllEqual(
+            core::Tensor::Full({4, 3}, 7, dtype, device)));
+
+    // Growing the back buffer keeps the elements.
+    back = tl.ReserveBack(20);
+    EXPECT_EQ(tl.GetSize(), 5);
+    EXPECT_GE(tl.GetReservedSize(), 25);
+    back.Fill(8);
+    tl.CommitBack(20);
+    EXPECT_EQ(tl.GetSize(), 25);
+    EXPECT_TRUE(tl[0].AllEqual(core::Tensor::Init<int>({1, 2, 3}, device)));
+    EXPECT_TRUE(tl.AsTensor().Slice(0, 5, 25).AllEqual(
+            core::Tensor::Full({20, 3}, 8, dtype, device)));
+
+    EXPECT_ANY_THROW(tl.CommitBack(tl.GetReservedSize()));
+    EXPECT_ANY_THROW(tl.CommitBack(-1));
+    core::TensorList tl_inplace = core::TensorList::FromTensor(
+            core::Tensor::Ones({3, 3}, dtype, device), true);
+    EXPECT_ANY_THROW(tl_inplace.ReserveBack(1));
+    EXPECT_ANY_THROW(tl_inplace.Reserve(10));
+}
+
 TEST_P(TensorListPermuteDevices, Concatenate) {
     core::Device device = GetParam();
     core::Dtype dtype = core::Float32;
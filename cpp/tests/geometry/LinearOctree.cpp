@@ -0,0 +1,180 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/geometry/LinearOctree.h"
+
+#include <memory>
+#include <vector>
+
+#include "open3d/geometry/PointCloud.h"
+#include "tests/Tests.h"
+
+namespace open3d {
+namespace tests {
+
+namespace {
+
+geometry::PointCloud CreateRandomPointCloud(size_t num_points) {
+    geometry::PointCloud pcd;
+    pcd.points_.resize(num_points);
+    pcd.colors_.resize(num_points);
+    Rand(pcd.points_, Eigen::Vector3d(-1, -2, 0), Eigen::Vector3d(3, 1, 2), 0);
+    Rand(pcd.colors_, Eigen::Vector3d::Zero(), Eigen::Vector3d::Ones(), 1);
+    // Duplicate points end up in the same leaf.
+    pcd.points_.push_back(pcd.points_[0]);
+    pcd.colors_.push_back(Eigen::Vector3d(0.5, 0.5, 0.5));
+    return pcd;
+}
+
+}  // namespace
+
+TEST(LinearOctree, Constructor) {
+    geometry::LinearOctree octree(4, Eigen::Vector3d(-1, -1, -1), 2);
+    ExpectEQ(octree.origin_, Eigen::Vector3d(-1, -1, -1));
+    EXPECT_EQ(octree.size_, 2);
+    EXPECT_EQ(octree.max_depth_, 4);
+    EXPECT_TRUE(octree.IsEmpty());
+    EXPECT_ANY_THROW(geometry::LinearOctree(22));
+}
+
+TEST(LinearOctree, ZeroDepth) {
+    geometry::LinearOctree octree(0, Eigen::Vector3d(-1, -1, -1), 2);
+    octree.Build({Eigen::Vector3d(0, 0, 0), Eigen::Vector3d(5, 0, 0)},
+                 {Eigen::Vector3d(0, 0.1, 0.2), Eigen::Vector3d(1, 1, 1)});
+    EXPECT_EQ(octree.GetNumNodes(), 1);
+
+    geometry::LinearOctreeNode node;
+    geometry::OctreeNodeInfo node_info;
+    std::tie(node, node_info) = octree.LocateLeafNode(Eigen::Vector3d(0, 0, 0));
+    ASSERT_TRUE(node.IsValid());
+    EXPECT_TRUE(octree.IsLeafNode(node));
+    ExpectEQ(octree.GetColor(node), Eigen::Vector3d(0, 0.1, 0.2));
+    EXPECT_EQ(octree.GetPointIndices(node), std::vector<size_t>({0}));
+    ExpectEQ(node_info.origin_, Eigen::Vector3d(-1, -1, -1));
+    EXPECT_EQ(node_info.size_, 2);
+
+    // Out of bound.
+    std::tie(node, node_info) = octree.LocateLeafNode(Eigen::Vector3d(5, 0, 0));
+    EXPECT_FALSE(node.IsValid());
+}
+
+TEST(LinearOctree, EqualsOctree) {
+    const geometry::PointCloud pcd = CreateRandomPointCloud(1000);
+    for (size_t max_depth : {0, 1, 4, 7}) {
+        geometry::Octree octree(max_depth);
+        octree.ConvertFromPointCloud(pcd, 0.01);
+        geometry::LinearOctree linear_octree(max_depth);
+        linear_octree.ConvertFromPointCloud(pcd, 0.01);
+
+        ExpectEQ(linear_octree.origin_, octree.origin_);
+        EXPECT_EQ(linear_octree.size_, octree.size_);
+        EXPECT_TRUE(*linear_octree.ToOctree() == octree);
+    }
+}
+
+TEST(LinearOctree, Traverse) {
+    const geometry::PointCloud pcd = CreateRandomPointCloud(500);
+    const size_t max_depth = 5;
+    geometry::Octree octree(max_depth);
+    octree.ConvertFromPointCloud(pcd, 0.01);
+    geometry::LinearOctree linear_octree(max_depth);
+    linear_octree.ConvertFromPointCloud(pcd, 0.01);
+
+    // Both traversals visit the same nodes in the same order, and skip the
+    // same subtrees.
+    std::vector<geometry::OctreeNodeInfo> infos;
+    std::vector<size_t> num_points;
+    octree.Traverse([&](const std::shared_ptr<geometry::OctreeNode>& node,
+                        const std::shared_ptr<geometry::OctreeNodeInfo>& info) {
+        infos.push_back(*info);
+        if (auto internal_node = std::dynamic_pointer_cast<
+                    geometry::OctreeInternalPointNode>(node)) {
+            num_points.push_back(internal_node->indices_.size());
+        } else if (auto leaf_node = std::dynamic_pointer_cast<
+                           geometry::OctreePointColorLeafNode>(node)) {
+            num_points.push_back(leaf_node->indices_.size());
+        }
+        return info->depth_ == 3 && info->child_index_ == 0;
+    });
+
+    size_t count = 0;
+    linear_octree.Traverse([&](const geometry::LinearOctreeNode& node,
+                               const geometry::OctreeNodeInfo& info) {
+        EXPECT_LT(count, infos.size());
+        if (count < infos.size()) {
+            ExpectEQ(info.origin_, infos[count].origin_);
+            EXPECT_EQ(info.size_, infos[count].size_);
+            EXPECT_EQ(info.depth_, infos[count].depth_);
+            EXPECT_EQ(info.child_index_, infos[count].child_index_);
+            EXPECT_EQ(linear_octree.GetPointIndices(node).size(),
+                      num_points[count]);
+        }
+        ++count;
+        return info.depth_ == 3 && info.child_index_ == 0;
+    });
+    EXPECT_EQ(count, infos.size());
+}
+
+TEST(LinearOctree, LocateLeafNode) {
+    const geometry::PointCloud pcd = CreateRandomPointCloud(500);
+    const size_t max_depth = 6;
+    geometry::Octree octree(max_depth);
+    octree.ConvertFromPointCloud(pcd, 0.01);
+    geometry::LinearOctree linear_octree(max_depth);
+    linear_octree.ConvertFromPointCloud(pcd, 0.01);
+
+    for (size_t idx = 0; idx < pcd.points_.size(); idx += 10) {
+        const Eigen::Vector3d& point = pcd.points_[idx];
+        std::shared_ptr<geometry::OctreeLeafNode> leaf_node;
+        std::shared_ptr<geometry::OctreeNodeInfo> leaf_info;
+        std::tie(leaf_node, leaf_info) = octree.LocateLeafNode(point);
+        geometry::LinearOctreeNode node;
+        geometry::OctreeNodeInfo node_info;
+        std::tie(node, node_info) = linear_octree.LocateLeafNode(point);
+
+        ASSERT_TRUE(node.IsValid());
+        ExpectEQ(node_info.origin_, leaf_info->origin_);
+        EXPECT_EQ(node_info.size_, leaf_info->size_);
+        EXPECT_EQ(node_info.depth_, max_depth);
+        EXPECT_EQ(node_info.child_index_, leaf_info->child_index_);
+        auto point_leaf_node =
+                std::dynamic_pointer_cast<geometry::OctreePointColorLeafNode>(
+                        leaf_node);
+        EXPECT_EQ(linear_octree.GetPointIndices(node),
+                  point_leaf_node->indices_);
+        ExpectEQ(linear_octree.GetColor(node), point_leaf_node->color_);
+    }
+
+    // A point within the bounds, but in an empty region.
+    geometry::LinearOctree sparse_octree(2, Eigen::Vector3d(0, 0, 0), 4);
+    sparse_octree.Build({Eigen::Vector3d(0.5, 0.5, 0.5)});
+    EXPECT_FALSE(sparse_octree.LocateLeafNode(Eigen::Vector3d(3, 3, 3))
+                         .first.IsValid());
+}
+
+}  // namespace tests
+}  // namespace open3d
@@ -923,6 +923,50 @@ TEST(PointCloud, Crop_OrientedBoundingBox) {
                                     }));
 }
 
+TEST(PointCloud, Crop_LargePointCloud) {
+    // Enough points for several parallel chunks of the selection.
+    std::vector<Eigen::Vector3d> points(100000);
+    Rand(points, Eigen::Vector3d(-1, -1, -1), Eigen::Vector3d(1, 1, 1), 0);
+    geometry::PointCloud pcd(points);
+    pcd.colors_ = points;
+
+    geometry::AxisAlignedBoundingBox aabb(Eigen::Vector3d(-0.5, -0.2, 0),
+                                          Eigen::Vector3d(0.3, 0.4, 0.8));
+    geometry::OrientedBoundingBox obb(
+            Eigen::Vector3d(0.1, 0, -0.1),
+            geometry::Geometry3D::GetRotationMatrixFromXYZ({0.3, 0.2, 0.1}),
+            Eigen::Vector3d(0.8, 0.5, 1.2));
+    std::vector<Eigen::Vector3d> in_aabb, in_obb;
+    for (const Eigen::Vector3d &point : points) {
+        if ((point.array() >= aabb.min_bound_.array()).all() &&
+            (point.array() <= aabb.max_bound_.array()).all()) {
+            in_aabb.push_back(point);
+        }
+        const Eigen::Vector3d local =
+                obb.R_.transpose() * (point - obb.center_);
+        if ((local.array().abs() <= obb.extent_.array() / 2).all()) {
+            in_obb.push_back(point);
+        }
+    }
+    EXPECT_GT(in_aabb.size(), 0u);
+    EXPECT_GT(in_obb.size(), 0u);
+
+    std::shared_ptr<geometry::PointCloud> aabb_crop = pcd.Crop(aabb);
+    ExpectEQ(aabb_crop->points_, in_aabb);
+    ExpectEQ(aabb_crop->colors_, in_aabb);
+    std::shared_ptr<geometry::PointCloud> obb_crop = pcd.Crop(obb);
+    ExpectEQ(obb_crop->points_, in_obb);
+
+    // Duplicate and unsorted indices select each point once, in order.
+    std::shared_ptr<geometry::PointCloud> selected =
+            pcd.SelectByIndex({99999, 5, 5, 42});
+    ExpectEQ(selected->points_,
+             std::vector<Eigen::Vector3d>(
+                     {points[5], points[42], points[99999]}));
+    EXPECT_EQ(pcd.SelectByIndex({99999, 5, 5, 42}, true)->points_.size(),
+              points.size() - 3);
+}
+
 TEST(PointCloud, EstimateNormals) {
     geometry::PointCloud pcd({
             {0, 0, 0},
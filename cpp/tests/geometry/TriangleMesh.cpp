@@ -27,7 +27,9 @@
 #include "open3d/geometry/TriangleMesh.h"
 
 #include "open3d/geometry/BoundingVolume.h"
+#include "open3d/geometry/IntersectionTest.h"
 #include "open3d/geometry/PointCloud.h"
+#include "open3d/geometry/TetraMesh.h"
 #include "tests/Tests.h"
 
 namespace open3d {
@@ -492,6 +494,54 @@ TEST(TriangleMesh, ComputeAdjacencyList) {
     EXPECT_TRUE(tm.adjacency_list_[4] == std::unordered_set<int>({0, 1, 2, 3}));
 }
 
+TEST(TriangleMesh, GetEdgeIndex) {
+    geometry::TriangleMesh tm;
+    tm.vertices_ = {{0, 0, 1}, {1, 1, 0}, {-1, 1, 0}, {-1, -1, 0}, {1, -1, 0}};
+    tm.triangles_ = {Eigen::Vector3i(0, 1, 2), Eigen::Vector3i(0, 2, 3),
+                     Eigen::Vector3i(0, 3, 4), Eigen::Vector3i(0, 4, 1)};
+
+    auto edge_index = tm.GetEdgeIndex();
+    EXPECT_EQ(edge_index->NumEdges(), 8u);
+    EXPECT_EQ(edge_index->edges_,
+              std::vector<Eigen::Vector2i>({{0, 1},
+                                            {0, 2},
+                                            {0, 3},
+                                            {0, 4},
+                                            {1, 2},
+                                            {1, 4},
+                                            {2, 3},
+                                            {3, 4}}));
+    EXPECT_EQ(edge_index->edge_offsets_,
+              std::vector<int>({0, 2, 4, 6, 8, 9, 10, 11, 12}));
+    EXPECT_EQ(edge_index->edge_triangles_,
+              std::vector<int>({0, 3, 0, 1, 1, 2, 2, 3, 0, 3, 1, 2}));
+    EXPECT_EQ(edge_index->edge_opposite_vertices_,
+              std::vector<int>({2, 4, 1, 3, 2, 4, 3, 1, 0, 0, 0, 0}));
+    EXPECT_EQ(edge_index->triangle_edges_[1], Eigen::Vector3i(1, 6, 2));
+    EXPECT_EQ(edge_index->FindEdge(2, 0), 1);
+    EXPECT_EQ(edge_index->FindEdge(4, 1), 5);
+    EXPECT_EQ(edge_index->FindEdge(1, 3), -1);
+    EXPECT_EQ(std::vector<int>(edge_index->vertex_neighbors_.begin() +
+                                       edge_index->vertex_offsets_[2],
+                               edge_index->vertex_neighbors_.begin() +
+                                       edge_index->vertex_offsets_[3]),
+              std::vector<int>({0, 1, 3}));
+
+    // The index is shared until the triangles change.
+    EXPECT_EQ(tm.GetEdgeIndex(), edge_index);
+    tm.triangles_.push_back(Eigen::Vector3i(1, 2, 4));
+    EXPECT_NE(tm.GetEdgeIndex(), edge_index);
+    EXPECT_EQ(tm.GetEdgeIndex()->NumEdges(), 9u);
+    tm.triangles_[4] = Eigen::Vector3i(1, 2, 3);
+    EXPECT_EQ(tm.GetEdgeIndex()->FindEdge(2, 4), -1);
+    EXPECT_EQ(tm.GetEdgeIndex()->FindEdge(1, 3), 5);
+
+    // Copies build their own index.
+    geometry::TriangleMesh tm_copy = tm;
+    EXPECT_NE(tm_copy.GetEdgeIndex(), tm.GetEdgeIndex());
+    EXPECT_EQ(tm_copy.GetEdgeIndex()->edges_, tm.GetEdgeIndex()->edges_);
+}
+
 TEST(TriangleMesh, Purge) {
     std::vector<Eigen::Vector3d> ref_vertices = {
             {839.215686, 392.156863, 780.392157},
@@ -1071,6 +1121,50 @@ TEST(TriangleMesh, IsSelfIntersecting) {
     EXPECT_TRUE(mesh1.IsSelfIntersecting());
 }
 
+TEST(TriangleMesh, GetSelfIntersectingTriangles) {
+    EXPECT_TRUE(
+            geometry::TriangleMesh().GetSelfIntersectingTriangles().empty());
+
+    // Random triangle soup, compared to testing all pairs.
+    geometry::TriangleMesh mesh;
+    std::vector<Eigen::Vector3d> centers(300);
+    std::vector<Eigen::Vector3d> offsets(900);
+    Rand(centers, Eigen::Vector3d::Zero(), Eigen::Vector3d::Ones(), 0);
+    Rand(offsets, Eigen::Vector3d::Zero(), Eigen::Vector3d::Constant(0.1), 1);
+    for (int tidx = 0; tidx < 300; ++tidx) {
+        for (int i = 0; i < 3; ++i) {
+            mesh.vertices_.push_back(centers[tidx] + offsets[3 * tidx + i]);
+        }
+        mesh.triangles_.push_back({3 * tidx, 3 * tidx + 1, 3 * tidx + 2});
+    }
+    std::vector<Eigen::Vector2i> pairs_gt;
+    for (int tidx0 = 0; tidx0 < 300; ++tidx0) {
+        for (int tidx1 = tidx0 + 1; tidx1 < 300; ++tidx1) {
+            const Eigen::Vector3i &p = mesh.triangles_[tidx0];
+            const Eigen::Vector3i &q = mesh.triangles_[tidx1];
+            if (geometry::IntersectionTest::TriangleTriangle3d(
+                        mesh.vertices_[p(0)], mesh.vertices_[p(1)],
+                        mesh.vertices_[p(2)], mesh.vertices_[q(0)],
+                        mesh.vertices_[q(1)], mesh.vertices_[q(2)])) {
+                pairs_gt.push_back({tidx0, tidx1});
+            }
+        }
+    }
+    EXPECT_FALSE(pairs_gt.empty());
+    ExpectEQ(mesh.GetSelfIntersectingTriangles(), pairs_gt);
+    EXPECT_TRUE(mesh.IsSelfIntersecting());
+
+    // Both halves of the soup intersect each other unless they are apart.
+    geometry::TriangleMesh mesh0 = mesh;
+    mesh0.triangles_.resize(150);
+    geometry::TriangleMesh mesh1 = mesh;
+    mesh1.triangles_.erase(mesh1.triangles_.begin(),
+                           mesh1.triangles_.begin() + 150);
+    EXPECT_TRUE(mesh0.IsIntersecting(mesh1));
+    mesh1.Translate(Eigen::Vector3d(0, 0, 1.2));
+    EXPECT_FALSE(mesh0.IsIntersecting(mesh1));
+}
+
 TEST(TriangleMesh, GetVolume) {
     EXPECT_NEAR(geometry::TriangleMesh::CreateBox()->GetVolume(), 1.0, 0.01);
     EXPECT_NEAR(geometry::TriangleMesh::CreateSphere()->GetVolume(),
@@ -1449,6 +1543,18 @@ TEST(TriangleMesh, DeformAsRigidAsPossible) {
     auto mesh_deform =
             mesh_in.DeformAsRigidAsPossible(constraint_ids, constraint_pos, 50);
     ExpectMeshEQ(*mesh_deform, mesh_gt, 1e-5);
+
+    // The second call reuses the cached factorization.
+    mesh_deform =
+            mesh_in.DeformAsRigidAsPossible(constraint_ids, constraint_pos, 50);
+    ExpectMeshEQ(*mesh_deform, mesh_gt, 1e-5);
+
+    mesh_deform = mesh_in.DeformAsRigidAsPossible(
+            constraint_ids, constraint_pos, 50,
+            geometry::MeshBase::DeformAsRigidAsPossibleEnergy::Spokes, 0.01,
+            geometry::MeshBase::DeformAsRigidAsPossibleSolver::
+                    ConjugateGradient);
+    ExpectMeshEQ(*mesh_deform, mesh_gt, 1e-5);
 }
 
 TEST(TriangleMesh, SelectByIndex) {
@@ -1912,6 +2018,11 @@ TEST(TriangleMesh, CreateFromPointCloudPoisson) {
 
     ExpectMeshEQ(*mesh_es, mesh_gt, 1e-4);
     ExpectEQ(densities_es, densities_gt, 1e-4);
+
+    // No depth fits into a budget of 1 KB.
+    EXPECT_ANY_THROW(geometry::TriangleMesh::CreateFromPointCloudPoisson(
+            pcd, 2, 0, 1.1f, false, /*n_threads=*/1, 5, 8, 1.5f, 2.0f, 1e-3f,
+            /*memory_budget_mb=*/1e-3));
 }
 
 TEST(TriangleMesh, CreateFromPointCloudAlphaShape) {
@@ -1939,6 +2050,32 @@ TEST(TriangleMesh, CreateFromPointCloudAlphaShape) {
     ExpectMeshEQ(*mesh_es, mesh_gt);
 }
 
+TEST(TriangleMesh, CreateFromPointCloudAlphaShapes) {
+    geometry::PointCloud pcd;
+    pcd.points_ = {
+            {0.765822, 1.000000, 0.486627}, {0.034963, 1.000000, 0.632086},
+            {0.000000, 0.093962, 0.028012}, {0.000000, 0.910057, 0.049732},
+            {0.017178, 0.000000, 0.946382}, {0.972485, 0.000000, 0.431460},
+            {0.794109, 0.033417, 1.000000}, {0.700868, 0.648112, 1.000000},
+            {0.164379, 0.516339, 1.000000}, {0.521248, 0.377170, 0.000000}};
+    const std::vector<double> alphas = {0.05, 0.5, 1, 100};
+
+    std::shared_ptr<geometry::TetraMesh> tetra_mesh;
+    std::vector<size_t> pt_map;
+    std::tie(tetra_mesh, pt_map) =
+            geometry::TetraMesh::CreateFromPointCloud(pcd);
+    auto meshes_es = geometry::TriangleMesh::CreateFromPointCloudAlphaShapes(
+            pcd, alphas, tetra_mesh, &pt_map);
+    EXPECT_EQ(meshes_es.size(), alphas.size());
+    for (size_t idx = 0; idx < alphas.size(); ++idx) {
+        auto mesh_gt = geometry::TriangleMesh::CreateFromPointCloudAlphaShape(
+                pcd, alphas[idx]);
+        ExpectMeshEQ(*meshes_es[idx], *mesh_gt);
+    }
+    EXPECT_TRUE(meshes_es[0]->triangles_.empty());
+    EXPECT_TRUE(meshes_es[3]->IsWatertight());
+}
+
 TEST(TriangleMesh, CreateMeshSphere) {
     std::vector<Eigen::Vector3d> ref_vertices = {
             {0.000000, 0.000000, 1.000000},
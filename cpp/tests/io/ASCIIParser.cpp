@@ -0,0 +1,152 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/io/ASCIIParser.h"
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+#include "tests/Tests.h"
+
+namespace open3d {
+namespace tests {
+
+TEST(ASCIIParser, ParseDouble) {
+    const std::vector<std::string> numbers = {
+            "0",       "-0",        "1",         "+1.5",     "-2.25",
+            "0.1",     "3.1415926535", "12345678901234567890", ".5",
+            "5.",      "1e10",      "-1.25E-3",  "1e-300",   "1e308",
+            "4.9e-324", "123456.7890123456789", "0.000000000000000000000001",
+            "inf",     "-nan",      "0x1p3",     "7e",       "1.5e+7"};
+    for (const std::string &number : numbers) {
+        double value = 0;
+        const char *begin = number.data();
+        const char *end = io::ParseDouble(begin, begin + number.size(), value);
+        char *expected_end = nullptr;
+        const double expected = std::strtod(number.c_str(), &expected_end);
+        EXPECT_EQ(end - begin, expected_end - number.c_str()) << number;
+        if (std::isnan(expected)) {
+            EXPECT_TRUE(std::isnan(value)) << number;
+        } else {
+            EXPECT_EQ(value, expected) << number;
+            EXPECT_EQ(std::signbit(value), std::signbit(expected)) << number;
+        }
+    }
+
+    // Correct rounding for the fast path.
+    for (int i = 0; i < 10000; ++i) {
+        char buffer[64];
+        snprintf(buffer, sizeof(buffer), "%.10f",
+                 (i * 7919 % 10007) / 97.0 - 50.0);
+        double value = 0;
+        io::ParseDouble(buffer, buffer + std::strlen(buffer), value);
+        EXPECT_EQ(value, std::strtod(buffer, nullptr)) << buffer;
+    }
+
+    double value = 0;
+    const std::string not_a_number = "x1";
+    EXPECT_EQ(io::ParseDouble(not_a_number.data(),
+                              not_a_number.data() + not_a_number.size(), value),
+              not_a_number.data());
+}
+
+TEST(ASCIIParser, ParseASCIIRows) {
+    // Lines with too few numbers are skipped, extra numbers are ignored, the
+    // last line has no line break.
+    const std::string text =
+            "1 2 3\r\n"
+            "4\t5 6 7\n"
+            "\n"
+            "8 9\n"
+            "a b c\n"
+            "-1e1 .5 +2";
+    io::ASCIIRows rows =
+            io::ParseASCIIRows(text.data(), text.data() + text.size(), 3);
+    EXPECT_EQ(rows.NumRows(), 3);
+    EXPECT_EQ(rows.GetInvalidLine(), nullptr);
+    std::vector<double> values(rows.NumRows() * 3);
+    rows.ForEachRow([&](int64_t idx, const double *row) {
+        std::copy(row, row + 3, values.begin() + 3 * idx);
+    });
+    ExpectEQ(values, std::vector<double>({1, 2, 3, 4, 5, 6, -10, 0.5, 2}));
+    EXPECT_EQ(rows.GetEnd(), text.data() + text.size());
+
+    // Continue after the first two rows.
+    rows = io::ParseASCIIRows(text.data(), text.data() + text.size(), 3, 2);
+    EXPECT_EQ(rows.NumRows(), 2);
+    EXPECT_EQ(rows.GetEnd(), text.data() + text.find("\n\n") + 1);
+    rows = io::ParseASCIIRows(rows.GetEnd(), text.data() + text.size(), 3);
+    EXPECT_EQ(rows.NumRows(), 1);
+
+    // Stop at the first invalid line, unless max_rows is reached before.
+    rows = io::ParseASCIIRows(text.data(), text.data() + text.size(), 3, -1,
+                              false);
+    EXPECT_EQ(rows.NumRows(), 2);
+    EXPECT_EQ(rows.GetInvalidLine(), text.data() + text.find("\n\n") + 1);
+    EXPECT_EQ(rows.GetEnd(), rows.GetInvalidLine());
+    rows = io::ParseASCIIRows(text.data(), text.data() + text.size(), 3, 2,
+                              false);
+    EXPECT_EQ(rows.NumRows(), 2);
+    EXPECT_EQ(rows.GetInvalidLine(), nullptr);
+
+    rows = io::ParseASCIIRows(text.data(), text.data(), 3);
+    EXPECT_EQ(rows.NumRows(), 0);
+}
+
+TEST(ASCIIParser, ParseASCIIRowsChunks) {
+    // Large enough to be split into several chunks.
+    const int64_t num_rows = 300000;
+    std::string text;
+    for (int64_t i = 0; i < num_rows; ++i) {
+        text += std::to_string(i) + " " + std::to_string(i * 0.25) + "\n";
+    }
+    int64_t num_updates = 0;
+    int64_t last_num_bytes = 0;
+    const io::ASCIIRows rows = io::ParseASCIIRows(
+            text.data(), text.data() + text.size(), 2, num_rows - 1, true,
+            [&](int64_t num_bytes, int64_t) {
+                EXPECT_GT(num_bytes, last_num_bytes);
+                last_num_bytes = num_bytes;
+                ++num_updates;
+            });
+    EXPECT_GE(num_updates, 1);
+    EXPECT_EQ(last_num_bytes, static_cast<int64_t>(text.size()));
+    EXPECT_EQ(rows.NumRows(), num_rows - 1);
+    EXPECT_EQ(rows.GetEnd(),
+              text.data() + text.rfind('\n', text.size() - 2) + 1);
+    std::vector<int> found(num_rows, 0);
+    rows.ForEachRow([&](int64_t idx, const double *row) {
+        found[idx] = row[0] == idx && row[1] == idx * 0.25;
+    });
+    EXPECT_EQ(std::count(found.begin(), found.end(), 1), num_rows - 1);
+}
+
+}  // namespace tests
+}  // namespace open3d
@@ -0,0 +1,94 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/io/LZFCompression.h"
+
+#include <cstring>
+#include <vector>
+
+#include "tests/Tests.h"
+
+namespace open3d {
+namespace tests {
+
+TEST(LZFCompression, CompressDecompress) {
+    // Several compression chunks of partly compressible data.
+    std::vector<float> data(1000000);
+    for (size_t i = 0; i < data.size(); ++i) {
+        data[i] = i % 3 == 0 ? float(i % 1000) : float(i) * 0.1f;
+    }
+    const uint32_t size = uint32_t(data.size() * sizeof(float));
+    std::vector<char> compressed;
+    EXPECT_TRUE(io::CompressLZF(data.data(), size, compressed));
+    EXPECT_LT(compressed.size(), size);
+
+    std::vector<float> decompressed(data.size());
+    EXPECT_TRUE(io::DecompressLZF(compressed.data(),
+                                  uint32_t(compressed.size()),
+                                  decompressed.data(), size));
+    ExpectEQ(decompressed, data);
+
+    // Wrong sizes and corrupt data are rejected.
+    EXPECT_FALSE(io::DecompressLZF(compressed.data(),
+                                   uint32_t(compressed.size()),
+                                   decompressed.data(), size - 4));
+    EXPECT_FALSE(io::DecompressLZF(compressed.data(),
+                                   uint32_t(compressed.size() / 2),
+                                   decompressed.data(), size));
+}
+
+TEST(LZFCompression, DecompressSingleStream) {
+    // A stream of 32-byte literal runs up to 1 MiB, followed by a back
+    // reference across that position, as written by other LZF encoders.
+    const uint32_t num_runs = (1 << 20) / 32;
+    std::vector<char> compressed;
+    std::vector<char> expected;
+    for (uint32_t run = 0; run < num_runs; ++run) {
+        compressed.push_back(31);
+        for (int i = 0; i < 32; ++i) {
+            const char value = char(run * 7 + i);
+            compressed.push_back(value);
+            expected.push_back(value);
+        }
+    }
+    // Copy 8 bytes starting 16 bytes back.
+    compressed.push_back(char(6 << 5));
+    compressed.push_back(15);
+    for (int i = 0; i < 8; ++i) {
+        expected.push_back(expected[expected.size() - 16]);
+    }
+
+    std::vector<char> decompressed(expected.size());
+    EXPECT_TRUE(io::DecompressLZF(compressed.data(),
+                                  uint32_t(compressed.size()),
+                                  decompressed.data(),
+                                  uint32_t(decompressed.size())));
+    EXPECT_EQ(decompressed, expected);
+}
+
+}  // namespace tests
+}  // namespace open3d
@@ -24,6 +24,9 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include "open3d/io/PinholeCameraTrajectoryIO.h"
+
+#include "open3d/utility/FileSystem.h"
 #include "tests/Tests.h"
 
 namespace open3d {
@@ -50,5 +53,36 @@ TEST(PinholeCameraTrajectoryIO, DISABLED_WritePinholeCameraTrajectoryToLOG) {
     NotImplemented();
 }
 
+TEST(PinholeCameraTrajectoryIO, WriteReadPinholeCameraTrajectoryBIN) {
+    camera::PinholeCameraTrajectory trajectory;
+    for (int i = 0; i < 5; i++) {
+        camera::PinholeCameraParameters parameters;
+        parameters.intrinsic_ = camera::PinholeCameraIntrinsic(
+                640 + i, 480 + i, 525.0, 525.0 + i, 319.5, 239.5 / 3.0);
+        parameters.extrinsic_ = Eigen::Matrix4d::Identity();
+        parameters.extrinsic_.block<3, 1>(0, 3) =
+                Eigen::Vector3d(0.1 * i, 0.2, -0.3 * i);
+        trajectory.parameters_.push_back(parameters);
+    }
+
+    const std::string file_name = utility::filesystem::GetTempDirectoryPath() +
+                                  "/temp_trajectory.bin";
+    EXPECT_TRUE(io::WritePinholeCameraTrajectory(file_name, trajectory));
+    camera::PinholeCameraTrajectory trajectory_read;
+    EXPECT_TRUE(io::ReadPinholeCameraTrajectory(file_name, trajectory_read));
+
+    ASSERT_EQ(trajectory_read.parameters_.size(),
+              trajectory.parameters_.size());
+    for (size_t i = 0; i < trajectory.parameters_.size(); i++) {
+        const auto &src = trajectory.parameters_[i];
+        const auto &dst = trajectory_read.parameters_[i];
+        EXPECT_EQ(dst.intrinsic_.width_, src.intrinsic_.width_);
+        EXPECT_EQ(dst.intrinsic_.height_, src.intrinsic_.height_);
+        EXPECT_TRUE(dst.intrinsic_.intrinsic_matrix_ ==
+                    src.intrinsic_.intrinsic_matrix_);
+        EXPECT_TRUE(dst.extrinsic_ == src.extrinsic_);
+    }
+}
+
 }  // namespace tests
 }  // namespace open3d
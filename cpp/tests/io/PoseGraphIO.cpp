@@ -24,6 +24,9 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include "open3d/io/PoseGraphIO.h"
+
+#include "open3d/utility/FileSystem.h"
 #include "tests/Tests.h"
 
 namespace open3d {
@@ -35,5 +38,70 @@ TEST(PoseGraphIO, DISABLED_ReadPoseGraph) { NotImplemented(); }
 
 TEST(PoseGraphIO, DISABLED_WritePoseGraph) { NotImplemented(); }
 
+class PoseGraphIOPermuteExtension
+    : public testing::TestWithParam<std::string> {};
+INSTANTIATE_TEST_SUITE_P(PoseGraphIO,
+                         PoseGraphIOPermuteExtension,
+                         testing::Values("json", "bin"));
+
+TEST_P(PoseGraphIOPermuteExtension, WriteReadPoseGraph) {
+    pipelines::registration::PoseGraph pose_graph;
+    for (int i = 0; i < 10; i++) {
+        Eigen::Matrix4d pose = Eigen::Matrix4d::Identity();
+        pose.block<3, 1>(0, 3) = Eigen::Vector3d(0.1 * i, 1.0 / 3.0, -i);
+        pose_graph.nodes_.emplace_back(pose);
+    }
+    for (int i = 0; i + 1 < 10; i++) {
+        const Eigen::Matrix4d transformation =
+                pose_graph.nodes_[i].pose_ *
+                pose_graph.nodes_[i + 1].pose_.transpose();
+        const Eigen::Matrix6d information = Eigen::Matrix6d::Random();
+        pose_graph.edges_.emplace_back(i, i + 1, transformation, information,
+                                       i % 2 == 0, 0.25 * i);
+    }
+
+    const std::string file_name = utility::filesystem::GetTempDirectoryPath() +
+                                  "/temp_pose_graph." + GetParam();
+    EXPECT_TRUE(io::WritePoseGraph(file_name, pose_graph));
+    pipelines::registration::PoseGraph pose_graph_read;
+    EXPECT_TRUE(io::ReadPoseGraph(file_name, pose_graph_read));
+
+    ASSERT_EQ(pose_graph_read.nodes_.size(), pose_graph.nodes_.size());
+    ASSERT_EQ(pose_graph_read.edges_.size(), pose_graph.edges_.size());
+    for (size_t i = 0; i < pose_graph.nodes_.size(); i++) {
+        EXPECT_TRUE(pose_graph_read.nodes_[i].pose_ ==
+                    pose_graph.nodes_[i].pose_);
+    }
+    for (size_t i = 0; i < pose_graph.edges_.size(); i++) {
+        const auto &src = pose_graph.edges_[i];
+        const auto &dst = pose_graph_read.edges_[i];
+        EXPECT_EQ(dst.source_node_id_, src.source_node_id_);
+        EXPECT_EQ(dst.target_node_id_, src.target_node_id_);
+        EXPECT_EQ(dst.uncertain_, src.uncertain_);
+        EXPECT_EQ(dst.confidence_, src.confidence_);
+        EXPECT_TRUE(dst.transformation_ == src.transformation_);
+        EXPECT_TRUE(dst.information_ == src.information_);
+    }
+}
+
+TEST(PoseGraphIO, ReadPoseGraphFromBINRejectsTruncatedFile) {
+    pipelines::registration::PoseGraph pose_graph;
+    pose_graph.nodes_.emplace_back(Eigen::Matrix4d::Identity());
+    const std::string file_name = utility::filesystem::GetTempDirectoryPath() +
+                                  "/temp_pose_graph_truncated.bin";
+    EXPECT_TRUE(io::WritePoseGraphToBIN(file_name, pose_graph));
+
+    std::vector<char> bytes;
+    EXPECT_TRUE(utility::filesystem::FReadToBuffer(file_name, bytes, nullptr));
+    bytes.resize(bytes.size() - sizeof(double));
+    FILE *file = utility::filesystem::FOpen(file_name, "wb");
+    ASSERT_NE(file, nullptr);
+    fwrite(bytes.data(), 1, bytes.size(), file);
+    fclose(file);
+
+    pipelines::registration::PoseGraph pose_graph_read;
+    EXPECT_FALSE(io::ReadPoseGraphFromBIN(file_name, pose_graph_read));
+}
+
 }  // namespace tests
 }  // namespace open3d
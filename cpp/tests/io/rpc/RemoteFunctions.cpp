@@ -26,10 +26,13 @@
 
 #include "open3d/io/rpc/RemoteFunctions.h"
 
+#include <future>
 #include <random>
+#include <vector>
 
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/geometry/TriangleMesh.h"
+#include "open3d/io/rpc/AsyncConnection.h"
 #include "open3d/io/rpc/BufferConnection.h"
 #include "open3d/io/rpc/Connection.h"
 #include "open3d/io/rpc/DummyReceiver.h"
@@ -153,6 +156,59 @@ TEST_F(RemoteFunctions, SendReceiveUnpackMessages) {
     }
 }
 
+TEST_F(RemoteFunctions, SendMultipartArrays) {
+    DummyReceiver receiver(connection_address, 500);
+    receiver.Start();
+
+    const core::Tensor vertices =
+            core::Tensor::Arange(0, 3000, 1, core::Float32).Reshape({1000, 3});
+    const core::Tensor colors = core::Tensor::Zeros({1000, 3}, core::Float32);
+    const core::Tensor faces =
+            core::Tensor::Arange(0, 999, 1, core::Int32).Reshape({333, 3});
+    for (bool compress : {false, true}) {
+        auto connection =
+                std::make_shared<Connection>(connection_address, 500, 500);
+        // Small enough to send the faces in the msgpack message and the
+        // vertex data in separate frames.
+        connection->SetMultipartArrays(4096, compress);
+        ASSERT_TRUE(SetMeshData("mesh", 0, "", vertices, {{"colors", colors}},
+                                faces, {}, core::Tensor({0}, core::Int32), {},
+                                "", {}, {}, {}, "", connection));
+    }
+    receiver.Stop();
+}
+
+TEST_F(RemoteFunctions, SendAsync) {
+    DummyReceiver receiver(connection_address, 500);
+    receiver.Start();
+    {
+        auto connection = std::make_shared<AsyncConnection>(connection_address,
+                                                            500, 500, 2);
+        const core::Tensor vertices =
+                core::Tensor::Ones({10, 3}, core::Float32);
+        std::vector<std::future<bool>> results;
+        for (int i = 0; i < 20; ++i) {
+            // Updates of the same path may be coalesced, but every future
+            // must receive a result.
+            const std::string path = "points" + std::to_string(i % 3);
+            results.push_back(SetMeshDataAsync(
+                    path, i, "", vertices, {}, core::Tensor({0}, core::Int32),
+                    {}, core::Tensor({0}, core::Int32), {}, "", {}, {}, {}, "",
+                    connection));
+        }
+        for (auto& result : results) {
+            EXPECT_TRUE(result.get());
+        }
+
+        // The blocking functions work with the asynchronous connection too.
+        geometry::PointCloud pcd;
+        pcd.points_.push_back(Eigen::Vector3d(1, 2, 3));
+        EXPECT_TRUE(SetPointCloud(pcd, "", 0, "", connection));
+        connection->Flush();
+    }
+    receiver.Stop();
+}
+
 TEST_F(RemoteFunctions, SendGarbage) {
     std::mt19937 rng;
     rng.seed(123);
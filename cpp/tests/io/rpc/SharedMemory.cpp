@@ -0,0 +1,155 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/io/rpc/SharedMemory.h"
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+#include <algorithm>
+
+#include "open3d/io/rpc/BufferConnection.h"
+#include "open3d/io/rpc/MessageUtils.h"
+#include "open3d/io/rpc/Messages.h"
+#include "open3d/io/rpc/RemoteFunctions.h"
+#include "open3d/t/geometry/PointCloud.h"
+#include "tests/Tests.h"
+
+using namespace open3d::io::rpc;
+
+namespace open3d {
+namespace tests {
+
+#ifndef _WIN32
+
+TEST(SharedMemory, CreateAndMap) {
+    core::Tensor tensor = CreateSharedTensor({4, 3}, core::Float32);
+    tensor.Fill(1);
+
+    messages::SharedMemoryRef ref;
+    EXPECT_TRUE(GetSharedMemoryRef(tensor, ref));
+    EXPECT_FALSE(ref.name.empty());
+    EXPECT_EQ(ref.device, "CPU:0");
+    EXPECT_EQ(ref.offset, 0);
+    EXPECT_EQ(ref.byte_size, 4 * 3 * 4);
+
+    // Contiguous slices refer to the same memory, other tensors do not.
+    messages::SharedMemoryRef slice_ref;
+    EXPECT_TRUE(GetSharedMemoryRef(tensor.Slice(0, 2, 4), slice_ref));
+    EXPECT_EQ(slice_ref.name, ref.name);
+    EXPECT_EQ(slice_ref.offset, 2 * 3 * 4);
+    EXPECT_FALSE(GetSharedMemoryRef(tensor.T(), slice_ref));
+    EXPECT_FALSE(GetSharedMemoryRef(tensor.Clone(), slice_ref));
+
+    // Mapping in the same process returns a view.
+    core::Tensor mapped = MapSharedTensor(slice_ref, {2, 3}, core::Float32);
+    mapped.Fill(2);
+    EXPECT_TRUE(tensor.Slice(0, 0, 2).AllClose(
+            core::Tensor::Ones({2, 3}, core::Float32)));
+    EXPECT_TRUE(tensor.Slice(0, 2, 4).AllClose(
+            core::Tensor::Full({2, 3}, 2, core::Float32)));
+
+    // Out of bounds references are rejected.
+    EXPECT_ANY_THROW(MapSharedTensor(ref, {5, 3}, core::Float32));
+}
+
+TEST(SharedMemory, MapExternalMemory) {
+    // Shared memory created by another process.
+    const std::string name = "/open3d_test_" + std::to_string(getpid());
+    const int64_t byte_size = 100 * sizeof(int32_t);
+    int fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+    ASSERT_GE(fd, 0);
+    ASSERT_EQ(ftruncate(fd, byte_size), 0);
+    void* ptr = mmap(nullptr, byte_size, PROT_READ | PROT_WRITE, MAP_SHARED,
+                     fd, 0);
+    close(fd);
+    ASSERT_NE(ptr, MAP_FAILED);
+    std::fill_n(static_cast<int32_t*>(ptr), 100, 5);
+
+    messages::SharedMemoryRef ref;
+    ref.name = name;
+    ref.device = "CPU:0";
+    ref.offset = 10 * sizeof(int32_t);
+    ref.byte_size = byte_size;
+    {
+        core::Tensor mapped = MapSharedTensor(ref, {90}, core::Int32);
+        EXPECT_NE(mapped.GetDataPtr(), static_cast<int32_t*>(ptr) + 10);
+        EXPECT_TRUE(
+                mapped.AllEqual(core::Tensor::Full({90}, 5, core::Int32)));
+        mapped.Fill(7);
+    }
+    EXPECT_EQ(static_cast<int32_t*>(ptr)[9], 5);
+    EXPECT_EQ(static_cast<int32_t*>(ptr)[10], 7);
+    EXPECT_EQ(static_cast<int32_t*>(ptr)[99], 7);
+
+    munmap(ptr, byte_size);
+    shm_unlink(name.c_str());
+}
+
+TEST(SharedMemory, ReleasedMemoryCannotBeMapped) {
+    messages::SharedMemoryRef ref;
+    {
+        core::Tensor tensor = CreateSharedTensor({10}, core::Float64);
+        ASSERT_TRUE(GetSharedMemoryRef(tensor, ref));
+    }
+    EXPECT_ANY_THROW(MapSharedTensor(ref, {10}, core::Float64));
+}
+
+TEST(SharedMemory, SendByReference) {
+    core::Tensor positions = CreateSharedTensor({1000, 3}, core::Float32);
+    positions.Fill(3);
+
+    messages::Array array = messages::Array::FromTensor(positions);
+    EXPECT_FALSE(array.shared_memory.name.empty());
+    EXPECT_EQ(array.data.size, 0u);
+
+    auto connection = std::make_shared<BufferConnection>();
+    ASSERT_TRUE(SetMeshData("points", 0, "", positions, {},
+                            core::Tensor({0}, core::Int32), {},
+                            core::Tensor({0}, core::Int32), {}, "", {}, {}, {},
+                            "", connection));
+    // The message only stores the reference, not the 12 kB of positions.
+    std::string buffer = connection->buffer().str();
+    EXPECT_LT(buffer.size(), size_t(1000));
+
+    std::string path;
+    double time;
+    std::shared_ptr<t::geometry::Geometry> geometry;
+    std::tie(path, time, geometry) = DataBufferToMetaGeometry(buffer);
+    ASSERT_TRUE(geometry);
+    auto pcd = std::dynamic_pointer_cast<t::geometry::PointCloud>(geometry);
+    ASSERT_TRUE(pcd);
+    EXPECT_EQ(pcd->GetPointPositions().GetDataPtr(), positions.GetDataPtr());
+}
+
+#endif
+
+}  // namespace tests
+}  // namespace open3d
@@ -24,11 +24,66 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include "open3d/pipelines/integration/ScalableTSDFVolume.h"
+
+#include "open3d/camera/PinholeCameraIntrinsic.h"
+#include "open3d/geometry/RGBDImage.h"
 #include "tests/Tests.h"
 
 namespace open3d {
 namespace tests {
 
+TEST(ScalableTSDFVolume, IntegrateSyntheticPlane) {
+    // A fronto-parallel plane at 1m, spanning many volume units.
+    const int width = 160, height = 120;
+    const double depth = 1.0;
+    geometry::Image im_depth, im_color;
+    im_depth.Prepare(width, height, 1, 4);
+    im_color.Prepare(width, height, 3, 1);
+    for (int v = 0; v < height; ++v) {
+        for (int u = 0; u < width; ++u) {
+            *im_depth.PointerAt<float>(u, v) = float(depth);
+            for (int c = 0; c < 3; ++c) {
+                *im_color.PointerAt<uint8_t>(u, v, c) = 128;
+            }
+        }
+    }
+    geometry::RGBDImage im_rgbd(im_color, im_depth);
+    camera::PinholeCameraIntrinsic intrinsic(width, height, 100.0, 100.0,
+                                             80.0, 60.0);
+
+    pipelines::integration::ScalableTSDFVolume tsdf_volume(
+            0.01, 0.04, pipelines::integration::TSDFVolumeColorType::RGB8,
+            /*volume_unit_resolution=*/8);
+    tsdf_volume.Integrate(im_rgbd, intrinsic, Eigen::Matrix4d::Identity());
+    EXPECT_GT(tsdf_volume.volume_units_.size(), 1u);
+
+    // Vertices shared by neighboring volume units are only emitted once.
+    std::shared_ptr<geometry::TriangleMesh> mesh =
+            tsdf_volume.ExtractTriangleMesh();
+    ASSERT_GT(mesh->triangles_.size(), 0u);
+    ASSERT_EQ(mesh->vertex_colors_.size(), mesh->vertices_.size());
+    for (const Eigen::Vector3d &vertex : mesh->vertices_) {
+        EXPECT_NEAR(vertex(2), depth, 0.01);
+    }
+    for (const Eigen::Vector3i &triangle : mesh->triangles_) {
+        EXPECT_TRUE((triangle.array() >= 0).all());
+        EXPECT_TRUE((triangle.array() < int(mesh->vertices_.size())).all());
+    }
+    const size_t num_vertices = mesh->vertices_.size();
+    mesh->RemoveDuplicatedVertices();
+    EXPECT_EQ(mesh->vertices_.size(), num_vertices);
+
+    std::shared_ptr<geometry::PointCloud> pcd =
+            tsdf_volume.ExtractPointCloud();
+    ASSERT_GT(pcd->points_.size(), 0u);
+    EXPECT_EQ(pcd->normals_.size(), pcd->points_.size());
+    EXPECT_EQ(pcd->colors_.size(), pcd->points_.size());
+    for (const Eigen::Vector3d &point : pcd->points_) {
+        EXPECT_NEAR(point(2), depth, 0.01);
+    }
+}
+
 TEST(ScalableTSDFVolume, DISABLED_VolumeUnit) { NotImplemented(); }
 
 TEST(ScalableTSDFVolume, DISABLED_Constructor) { NotImplemented(); }
@@ -96,7 +96,78 @@ TEST(UniformTSDFVolume, Constructor) {
     EXPECT_EQ(tsdf_volume.length_, length);
     EXPECT_EQ(tsdf_volume.resolution_, resolution);
     EXPECT_EQ(tsdf_volume.voxel_num_, resolution * resolution * resolution);
-    EXPECT_EQ(int(tsdf_volume.voxels_.size()), tsdf_volume.voxel_num_);
+    EXPECT_EQ(int(tsdf_volume.tsdf_.size()), tsdf_volume.voxel_num_);
+    EXPECT_EQ(int(tsdf_volume.weight_.size()), tsdf_volume.voxel_num_);
+    EXPECT_EQ(int(tsdf_volume.color_rgb_.size()), 3 * tsdf_volume.voxel_num_);
+    EXPECT_TRUE(tsdf_volume.color_gray_.empty());
+}
+
+TEST(UniformTSDFVolume, CompactColorStorage) {
+    using pipelines::integration::TSDFVolumeColorType;
+    pipelines::integration::UniformTSDFVolume no_color(
+            1.0, 8, 0.04, TSDFVolumeColorType::NoColor);
+    EXPECT_TRUE(no_color.color_rgb_.empty());
+    EXPECT_TRUE(no_color.color_gray_.empty());
+    ExpectEQ(no_color.GetVoxelColor(0), Eigen::Vector3d(0, 0, 0));
+
+    pipelines::integration::UniformTSDFVolume gray(1.0, 8, 0.04,
+                                                   TSDFVolumeColorType::Gray32);
+    EXPECT_TRUE(gray.color_rgb_.empty());
+    EXPECT_EQ(int(gray.color_gray_.size()), gray.voxel_num_);
+    gray.SetVoxelColor(5, Eigen::Vector3d(0.25, 0.25, 0.25));
+    ExpectEQ(gray.GetVoxelColor(5), Eigen::Vector3d(0.25, 0.25, 0.25));
+
+    pipelines::integration::UniformTSDFVolume rgb(1.0, 8, 0.04,
+                                                  TSDFVolumeColorType::RGB8);
+    std::vector<Eigen::Vector3d> colors(rgb.voxel_num_,
+                                        Eigen::Vector3d(0, 127.5, 255));
+    colors[3] = Eigen::Vector3d(-1, 300, 12.34);
+    rgb.InjectVolumeColor(colors);
+    const std::vector<Eigen::Vector3d> colors_out = rgb.ExtractVolumeColor();
+    ExpectEQ(colors_out[0], Eigen::Vector3d(0, 127.5, 255));
+    ExpectEQ(colors_out[3], Eigen::Vector3d(0, 255, 12.34),
+             /*threshold*/ 0.5 / 256);
+
+    rgb.Reset();
+    EXPECT_EQ(int(rgb.tsdf_.size()), rgb.voxel_num_);
+    ExpectEQ(rgb.GetVoxelColor(0), Eigen::Vector3d(0, 0, 0));
+}
+
+TEST(UniformTSDFVolume, IntegrateSyntheticPlane) {
+    // A fronto-parallel plane at 0.5m with a constant color.
+    const int width = 64, height = 48;
+    const double depth = 0.5;
+    geometry::Image im_depth, im_color;
+    im_depth.Prepare(width, height, 1, 4);
+    im_color.Prepare(width, height, 3, 1);
+    for (int v = 0; v < height; ++v) {
+        for (int u = 0; u < width; ++u) {
+            *im_depth.PointerAt<float>(u, v) = float(depth);
+            *im_color.PointerAt<uint8_t>(u, v, 0) = 200;
+            *im_color.PointerAt<uint8_t>(u, v, 1) = 100;
+            *im_color.PointerAt<uint8_t>(u, v, 2) = 7;
+        }
+    }
+    geometry::RGBDImage im_rgbd(im_color, im_depth);
+    camera::PinholeCameraIntrinsic intrinsic(width, height, 50.0, 50.0, 32.0,
+                                             24.0);
+
+    pipelines::integration::UniformTSDFVolume tsdf_volume(
+            1.0, 64, 0.04, pipelines::integration::TSDFVolumeColorType::RGB8,
+            Eigen::Vector3d(-0.5, -0.5, 0.0));
+    for (int i = 0; i < 3; ++i) {
+        tsdf_volume.Integrate(im_rgbd, intrinsic, Eigen::Matrix4d::Identity());
+    }
+
+    std::shared_ptr<geometry::TriangleMesh> mesh =
+            tsdf_volume.ExtractTriangleMesh();
+    ASSERT_GT(mesh->vertices_.size(), 0u);
+    ASSERT_EQ(mesh->vertex_colors_.size(), mesh->vertices_.size());
+    const Eigen::Vector3d color = Eigen::Vector3d(200, 100, 7) / 255.0;
+    for (size_t i = 0; i < mesh->vertices_.size(); ++i) {
+        EXPECT_NEAR(mesh->vertices_[i](2), depth, 0.02);
+        ExpectEQ(mesh->vertex_colors_[i], color, /*threshold*/ 1e-3);
+    }
 }
 
 TEST(UniformTSDFVolume, RealData) {
@@ -0,0 +1,140 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/pipelines/integration/VoxelBlockGridTSDFVolume.h"
+
+#include "core/CoreTest.h"
+#include "open3d/camera/PinholeCameraIntrinsic.h"
+#include "open3d/geometry/RGBDImage.h"
+#include "tests/Tests.h"
+
+namespace open3d {
+namespace tests {
+
+using pipelines::integration::TSDFVolumeColorType;
+using pipelines::integration::VoxelBlockGridTSDFVolume;
+
+class VoxelBlockGridTSDFVolumePermuteDevices : public PermuteDevices {};
+INSTANTIATE_TEST_SUITE_P(VoxelBlockGridTSDFVolume,
+                         VoxelBlockGridTSDFVolumePermuteDevices,
+                         testing::ValuesIn(PermuteDevices::TestCases()));
+
+// A fronto-parallel plane between two voxel layers near 1m, with a uniform
+// color.
+static geometry::RGBDImage CreatePlaneRGBDImage(int width,
+                                                int height,
+                                                bool gray) {
+    geometry::Image im_depth, im_color;
+    im_depth.Prepare(width, height, 1, 4);
+    im_color.Prepare(width, height, gray ? 1 : 3, gray ? 4 : 1);
+    for (int v = 0; v < height; ++v) {
+        for (int u = 0; u < width; ++u) {
+            *im_depth.PointerAt<float>(u, v) = 1.005f;
+            if (gray) {
+                *im_color.PointerAt<float>(u, v) = 0.25f;
+            } else {
+                for (int c = 0; c < 3; ++c) {
+                    *im_color.PointerAt<uint8_t>(u, v, c) = 64 * (c + 1);
+                }
+            }
+        }
+    }
+    return geometry::RGBDImage(im_color, im_depth);
+}
+
+TEST_P(VoxelBlockGridTSDFVolumePermuteDevices, IntegrateSyntheticPlane) {
+    core::Device device = GetParam();
+    const int width = 160, height = 120;
+    geometry::RGBDImage im_rgbd = CreatePlaneRGBDImage(width, height, false);
+    camera::PinholeCameraIntrinsic intrinsic(width, height, 100.0, 100.0,
+                                             80.0, 60.0);
+
+    VoxelBlockGridTSDFVolume tsdf_volume(0.01, 0.04, TSDFVolumeColorType::RGB8,
+                                         device, /*block_resolution=*/8,
+                                         /*block_count=*/1000);
+    tsdf_volume.Integrate(im_rgbd, intrinsic, Eigen::Matrix4d::Identity());
+    EXPECT_GT(tsdf_volume.GetVoxelBlockGrid().GetHashMap().Size(), 1);
+
+    std::shared_ptr<geometry::TriangleMesh> mesh =
+            tsdf_volume.ExtractTriangleMesh();
+    ASSERT_GT(mesh->triangles_.size(), 0u);
+    ASSERT_EQ(mesh->vertex_colors_.size(), mesh->vertices_.size());
+    for (const Eigen::Vector3d &vertex : mesh->vertices_) {
+        EXPECT_NEAR(vertex(2), 1.005, 0.01);
+    }
+    // Colors are stored in [0, 255] and extracted in [0, 1].
+    EXPECT_TRUE(mesh->vertex_colors_[0].isApprox(
+            Eigen::Vector3d(64, 128, 192) / 255.0, 1e-3));
+
+    std::shared_ptr<geometry::PointCloud> pcd =
+            tsdf_volume.ExtractPointCloud();
+    ASSERT_GT(pcd->points_.size(), 0u);
+    EXPECT_EQ(pcd->normals_.size(), pcd->points_.size());
+    EXPECT_EQ(pcd->colors_.size(), pcd->points_.size());
+    for (const Eigen::Vector3d &point : pcd->points_) {
+        EXPECT_NEAR(point(2), 1.005, 0.01);
+    }
+
+    // A single observation is filtered out by a positive weight threshold.
+    tsdf_volume.weight_threshold_ = 1.0f;
+    EXPECT_EQ(tsdf_volume.ExtractPointCloud()->points_.size(), 0u);
+
+    tsdf_volume.Reset();
+    EXPECT_EQ(tsdf_volume.GetVoxelBlockGrid().GetHashMap().Size(), 0);
+}
+
+TEST_P(VoxelBlockGridTSDFVolumePermuteDevices, IntegrateGray32AndNoColor) {
+    core::Device device = GetParam();
+    const int width = 80, height = 60;
+    camera::PinholeCameraIntrinsic intrinsic(width, height, 50.0, 50.0, 40.0,
+                                             30.0);
+
+    VoxelBlockGridTSDFVolume gray_volume(0.01, 0.04,
+                                         TSDFVolumeColorType::Gray32, device);
+    gray_volume.Integrate(CreatePlaneRGBDImage(width, height, true), intrinsic,
+                          Eigen::Matrix4d::Identity());
+    std::shared_ptr<geometry::TriangleMesh> mesh =
+            gray_volume.ExtractTriangleMesh();
+    ASSERT_GT(mesh->vertex_colors_.size(), 0u);
+    EXPECT_TRUE(mesh->vertex_colors_[0].isApprox(
+            Eigen::Vector3d::Constant(0.25), 1e-3));
+
+    VoxelBlockGridTSDFVolume depth_volume(0.01, 0.04,
+                                          TSDFVolumeColorType::NoColor, device);
+    depth_volume.Integrate(CreatePlaneRGBDImage(width, height, false),
+                           intrinsic, Eigen::Matrix4d::Identity());
+    mesh = depth_volume.ExtractTriangleMesh();
+    EXPECT_GT(mesh->triangles_.size(), 0u);
+    EXPECT_FALSE(mesh->HasVertexColors());
+
+    // The color image does not match the color type.
+    EXPECT_ANY_THROW(gray_volume.Integrate(
+            CreatePlaneRGBDImage(width, height, false), intrinsic,
+            Eigen::Matrix4d::Identity()));
+}
+
+}  // namespace tests
+}  // namespace open3d
@@ -24,13 +24,82 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include "open3d/pipelines/odometry/Odometry.h"
+
+#include <cmath>
+
+#include "open3d/camera/PinholeCameraIntrinsic.h"
+#include "open3d/geometry/Image.h"
+#include "open3d/geometry/RGBDImage.h"
 #include "tests/Tests.h"
 
 namespace open3d {
 namespace tests {
 
+// Smooth textured surface seen from a camera shifted by \p offset pixels.
+static geometry::RGBDImage CreateSyntheticRGBDImage(int width,
+                                                    int height,
+                                                    double offset) {
+    geometry::RGBDImage image;
+    image.color_.Prepare(width, height, 1, 4);
+    image.depth_.Prepare(width, height, 1, 4);
+    for (int v = 0; v < height; v++) {
+        for (int u = 0; u < width; u++) {
+            const double x = u + offset;
+            *image.color_.PointerAt<float>(u, v) =
+                    float(0.5 + 0.25 * std::sin(x / 5.0) +
+                          0.2 * std::cos(v / 7.0));
+            *image.depth_.PointerAt<float>(u, v) =
+                    float(1.5 + 0.1 * std::sin(x / 17.0) *
+                                        std::cos(v / 13.0));
+        }
+    }
+    return image;
+}
+
 TEST(Odometry, DISABLED_ComputeRGBDOdometry) { NotImplemented(); }
 
+TEST(Odometry, ComputeRGBDOdometryForPairs) {
+    const int width = 160, height = 120;
+    const camera::PinholeCameraIntrinsic intrinsic(width, height, 130.0,
+                                                   130.0, 80.0, 60.0);
+    std::vector<geometry::RGBDImage> images;
+    for (int i = 0; i < 3; i++) {
+        images.push_back(CreateSyntheticRGBDImage(width, height, 0.7 * i));
+    }
+    const std::vector<std::pair<int, int>> pairs = {
+            {0, 1}, {1, 2}, {0, 2}, {2, 0}};
+    pipelines::odometry::OdometryOption option;
+    const pipelines::odometry::RGBDOdometryJacobianFromHybridTerm jacobian;
+
+    std::vector<bool> success;
+    std::vector<Eigen::Matrix4d, utility::Matrix4d_allocator> transformations;
+    std::vector<Eigen::Matrix6d, utility::Matrix6d_allocator> informations;
+    std::tie(success, transformations, informations) =
+            pipelines::odometry::ComputeRGBDOdometryForPairs(
+                    images, pairs, {}, intrinsic, jacobian, option);
+    ASSERT_EQ(success.size(), pairs.size());
+    ASSERT_EQ(transformations.size(), pairs.size());
+    ASSERT_EQ(informations.size(), pairs.size());
+
+    for (size_t i = 0; i < pairs.size(); i++) {
+        bool ref_success;
+        Eigen::Matrix4d ref_transformation;
+        Eigen::Matrix6d ref_information;
+        std::tie(ref_success, ref_transformation, ref_information) =
+                pipelines::odometry::ComputeRGBDOdometry(
+                        images[pairs[i].first], images[pairs[i].second],
+                        intrinsic, Eigen::Matrix4d::Identity(), jacobian,
+                        option);
+        EXPECT_EQ(success[i], ref_success);
+        ExpectEQ(transformations[i], ref_transformation, 1e-4);
+        ExpectEQ(informations[i], ref_information, 1e-4);
+    }
+
+    EXPECT_ANY_THROW(pipelines::odometry::ComputeRGBDOdometryForPairs(
+            images, {{0, 3}}, {}, intrinsic, jacobian, option));
+}
+
 TEST(Odometry, DISABLED_PinholeCameraIntrinsic) { NotImplemented(); }
 
 TEST(Odometry, DISABLED_RGBDOdometryJacobianFromHybridTerm) {
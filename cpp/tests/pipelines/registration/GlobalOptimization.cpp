@@ -24,11 +24,135 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include "open3d/pipelines/registration/GlobalOptimization.h"
+
+#include <Eigen/Dense>
+#include <cmath>
+
+#include "open3d/pipelines/registration/PoseGraph.h"
+#include "open3d/utility/Eigen.h"
 #include "tests/Tests.h"
 
 namespace open3d {
 namespace tests {
 
+// Poses of the nodes of a ring, and the pose graph with consistent odometry
+// and loop closure edges whose nodes have perturbed initial poses.
+static pipelines::registration::PoseGraph GetRingPoseGraph(
+        int num_nodes,
+        std::vector<Eigen::Matrix4d, utility::Matrix4d_allocator> &poses) {
+    pipelines::registration::PoseGraph pose_graph;
+    poses.clear();
+    for (int i = 0; i < num_nodes; ++i) {
+        const double angle = 2.0 * M_PI * i / num_nodes;
+        Eigen::Vector6d pose_vector;
+        pose_vector << 0.0, 0.0, angle, 5.0 * std::cos(angle),
+                5.0 * std::sin(angle), 0.1 * std::sin(3.0 * angle);
+        poses.push_back(utility::TransformVector6dToMatrix4d(pose_vector));
+
+        Eigen::Vector6d noise;
+        noise << 0.01 * std::sin(i), 0.01 * std::cos(i), 0.0,
+                0.05 * std::sin(2.0 * i), 0.05 * std::cos(3.0 * i), 0.0;
+        pose_graph.nodes_.push_back(pipelines::registration::PoseGraphNode(
+                i == 0 ? poses[i]
+                       : utility::TransformVector6dToMatrix4d(noise) *
+                                 poses[i]));
+    }
+    auto add_edge = [&](int source, int target, bool uncertain) {
+        pose_graph.edges_.push_back(pipelines::registration::PoseGraphEdge(
+                source, target, poses[target].inverse() * poses[source],
+                Eigen::Matrix6d::Identity() * 100.0, uncertain));
+    };
+    for (int i = 0; i + 1 < num_nodes; ++i) {
+        add_edge(i, i + 1, false);
+    }
+    for (int i = 0; i + 5 < num_nodes; i += 5) {
+        add_edge(i, i + 5, true);
+    }
+    add_edge(num_nodes - 1, 0, true);
+    return pose_graph;
+}
+
+TEST(GlobalOptimization, GlobalOptimizationSparse) {
+    std::vector<Eigen::Matrix4d, utility::Matrix4d_allocator> poses;
+    for (bool use_lm : {false, true}) {
+        pipelines::registration::PoseGraph pose_graph =
+                GetRingPoseGraph(200, poses);
+        pipelines::registration::GlobalOptimizationOption option(
+                /*max_correspondence_distance=*/0.1,
+                /*edge_prune_threshold=*/0.25,
+                /*preference_loop_closure=*/1.0, /*reference_node=*/0);
+        if (use_lm) {
+            pipelines::registration::GlobalOptimization(
+                    pose_graph,
+                    pipelines::registration::
+                            GlobalOptimizationLevenbergMarquardt(),
+                    pipelines::registration::
+                            GlobalOptimizationConvergenceCriteria(),
+                    option);
+        } else {
+            pipelines::registration::GlobalOptimization(
+                    pose_graph,
+                    pipelines::registration::GlobalOptimizationGaussNewton(),
+                    pipelines::registration::
+                            GlobalOptimizationConvergenceCriteria(),
+                    option);
+        }
+
+        // All loop closures are consistent, so none of them is pruned.
+        EXPECT_EQ(pose_graph.edges_.size(), 199u + 39u + 1u);
+        for (size_t i = 0; i < poses.size(); ++i) {
+            Eigen::Matrix4d pose = pose_graph.nodes_[i].pose_;
+            ExpectEQ(pose, poses[i], 1e-4);
+        }
+    }
+}
+
+TEST(GlobalOptimization, IncrementalGlobalOptimization) {
+    std::vector<Eigen::Matrix4d, utility::Matrix4d_allocator> poses;
+    pipelines::registration::PoseGraph pose_graph =
+            GetRingPoseGraph(100, poses);
+    // Only the poses of the last nodes have drifted before the loop closure.
+    for (int i = 0; i < 90; ++i) {
+        pose_graph.nodes_[i].pose_ = poses[i];
+    }
+    pipelines::registration::GlobalOptimizationOption option(
+            /*max_correspondence_distance=*/0.1,
+            /*edge_prune_threshold=*/0.25,
+            /*preference_loop_closure=*/1.0, /*reference_node=*/0);
+    const size_t n_edges = pose_graph.edges_.size();
+
+    // The closing edge is the new loop closure.
+    pipelines::registration::IncrementalGlobalOptimization(
+            pose_graph, int(n_edges) - 1, /*window_size=*/15,
+            pipelines::registration::GlobalOptimizationConvergenceCriteria(),
+            option);
+    EXPECT_EQ(pose_graph.edges_.size(), n_edges);
+    for (size_t i = 0; i < poses.size(); ++i) {
+        Eigen::Matrix4d pose = pose_graph.nodes_[i].pose_;
+        ExpectEQ(pose, poses[i], 1e-4);
+    }
+
+    // An inconsistent loop closure is pruned, and nodes outside of the window
+    // keep their poses.
+    Eigen::Matrix4d outlier = poses[52].inverse() * poses[50];
+    outlier(0, 3) += 1.0;
+    pose_graph.edges_.push_back(pipelines::registration::PoseGraphEdge(
+            50, 52, outlier, Eigen::Matrix6d::Identity() * 100.0, true));
+    Eigen::Matrix4d pose_outside_window = pose_graph.nodes_[20].pose_;
+    pipelines::registration::IncrementalGlobalOptimization(
+            pose_graph, int(n_edges), /*window_size=*/5,
+            pipelines::registration::GlobalOptimizationConvergenceCriteria(),
+            option);
+    EXPECT_EQ(pose_graph.edges_.size(), n_edges);
+    for (size_t i = 0; i < poses.size(); ++i) {
+        Eigen::Matrix4d pose = pose_graph.nodes_[i].pose_;
+        ExpectEQ(pose, poses[i], 1e-4);
+    }
+    Eigen::Matrix4d pose = pose_graph.nodes_[20].pose_;
+    ExpectEQ(pose, pose_outside_window, 0.0);
+}
+
 TEST(GlobalOptimization, DISABLED_Constructor) { NotImplemented(); }
 
 TEST(GlobalOptimization, DISABLED_MemberData) { NotImplemented(); }
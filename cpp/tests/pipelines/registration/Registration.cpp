@@ -24,6 +24,10 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include "open3d/pipelines/registration/Registration.h"
+
+#include "open3d/geometry/PointCloud.h"
+#include "open3d/utility/Helper.h"
 #include "tests/Tests.h"
 
 namespace open3d {
@@ -53,6 +57,49 @@ TEST(Registration, DISABLED_RegistrationRANSACBasedOnCorrespondence) {
     NotImplemented();
 }
 
+TEST(Registration, RegistrationRANSACBasedOnCorrespondenceBatched) {
+    geometry::PointCloud source;
+    for (int i = 0; i < 500; ++i) {
+        source.points_.push_back(Eigen::Vector3d(
+                std::sin(i * 0.37), std::cos(i * 0.91), std::sin(i * 1.73)));
+    }
+    Eigen::Matrix4d ref_transformation = Eigen::Matrix4d::Identity();
+    ref_transformation.block<3, 3>(0, 0) =
+            geometry::PointCloud::GetRotationMatrixFromXYZ({0.3, -0.2, 0.5});
+    ref_transformation.block<3, 1>(0, 3) = Eigen::Vector3d(0.5, -0.1, 0.2);
+    geometry::PointCloud target = source;
+    target.Transform(ref_transformation);
+
+    // Half of the correspondences are outliers.
+    utility::UniformRandIntGenerator rand_gen(0, 499, 0);
+    pipelines::registration::CorrespondenceSet corres;
+    for (int i = 0; i < 500; ++i) {
+        corres.push_back(Eigen::Vector2i(i, i % 2 == 0 ? i : rand_gen()));
+    }
+
+    pipelines::registration::RANSACConvergenceCriteria criteria(1000, 0.999,
+                                                                128);
+    auto result =
+            pipelines::registration::RegistrationRANSACBasedOnCorrespondence(
+                    source, target, corres, 0.01,
+                    pipelines::registration::
+                            TransformationEstimationPointToPoint(false),
+                    3, {}, criteria, 42);
+    Eigen::Matrix4d transformation = result.transformation_;
+    EXPECT_DOUBLE_EQ(result.fitness_, 1.0);
+    ExpectEQ(ref_transformation, transformation, 1e-6);
+
+    // The result only depends on the seed.
+    auto result_again =
+            pipelines::registration::RegistrationRANSACBasedOnCorrespondence(
+                    source, target, corres, 0.01,
+                    pipelines::registration::
+                            TransformationEstimationPointToPoint(false),
+                    3, {}, criteria, 42);
+    Eigen::Matrix4d transformation_again = result_again.transformation_;
+    ExpectEQ(transformation, transformation_again);
+}
+
 TEST(Registration, DISABLED_RegistrationRANSACBasedOnFeatureMatching) {
     NotImplemented();
 }
@@ -0,0 +1,138 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/t/geometry/DistributedVoxelBlockGrid.h"
+
+#include "core/CoreTest.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/t/geometry/VoxelBlockGrid.h"
+
+namespace open3d {
+namespace tests {
+
+using namespace t::geometry;
+
+class DistributedVoxelBlockGridPermuteDevices : public PermuteDevices {};
+INSTANTIATE_TEST_SUITE_P(DistributedVoxelBlockGrid,
+                         DistributedVoxelBlockGridPermuteDevices,
+                         testing::ValuesIn(PermuteDevices::TestCases()));
+
+TEST_P(DistributedVoxelBlockGridPermuteDevices, IntegrateRayCast) {
+    core::Device device = GetParam();
+
+    const int rows = 120, cols = 160;
+    const float depth_scale = 1000.0, depth_max = 3.0;
+    core::Tensor intrinsic = core::Tensor::Init<double>(
+            {{100, 0, cols / 2.0}, {0, 100, rows / 2.0}, {0, 0, 1}});
+    core::Tensor extrinsic =
+            core::Tensor::Eye(4, core::Float64, core::Device("CPU:0"));
+
+    // A slanted plane in front of the camera.
+    core::Tensor depth_tensor =
+            core::Tensor::Empty({rows, cols, 1}, core::UInt16);
+    uint16_t *depth_ptr = depth_tensor.GetDataPtr<uint16_t>();
+    for (int v = 0; v < rows; ++v) {
+        for (int u = 0; u < cols; ++u) {
+            depth_ptr[v * cols + u] = uint16_t(1000 + u / 2);
+        }
+    }
+    Image depth = Image(depth_tensor).To(device);
+    Image color = Image(core::Tensor::Full({rows, cols, 3}, 128, core::UInt8))
+                          .To(device);
+
+    auto vbg = VoxelBlockGrid({"tsdf", "weight", "color"},
+                              {core::Float32, core::Float32, core::Float32},
+                              {{1}, {1}, {3}}, 0.01, 4, 1000, device);
+    core::Tensor block_coords = vbg.GetUniqueBlockCoordinates(
+            depth, intrinsic, extrinsic, depth_scale, depth_max);
+    vbg.Integrate(block_coords, depth, color, intrinsic, extrinsic,
+                  depth_scale, depth_max);
+
+    auto dvbg = DistributedVoxelBlockGrid(
+            {"tsdf", "weight", "color"},
+            {core::Float32, core::Float32, core::Float32}, {{1}, {1}, {3}},
+            {device, device}, 0.01, 4, 1000, /*partition_resolution=*/2);
+    dvbg.Integrate(depth, color, intrinsic, extrinsic, depth_scale,
+                   depth_max);
+
+    // Every block is owned by exactly one partition.
+    int64_t n_blocks = vbg.GetHashMap().Size();
+    EXPECT_EQ(dvbg.GetBlockCount(), n_blocks);
+    for (int64_t i = 0; i < dvbg.GetPartitionCount(); ++i) {
+        core::HashMap hashmap = dvbg.GetPartition(i).GetHashMap();
+        EXPECT_GT(hashmap.Size(), 0);
+        core::Tensor keys = hashmap.GetKeyTensor().IndexGet(
+                {hashmap.GetActiveIndices().To(core::Int64)});
+        EXPECT_TRUE(dvbg.GetPartitionIndices(keys).AllEqual(
+                core::Tensor::Full({keys.GetLength()}, i, core::Int64,
+                                   device)));
+    }
+    EXPECT_EQ(dvbg.GetPartitionIndices(block_coords).GetLength(),
+              block_coords.GetLength());
+
+    // Seams at the chunk boundaries only drop a few surface points.
+    int64_t n_points =
+            vbg.ExtractPointCloud(0.5f).GetPointPositions().GetLength();
+    int64_t n_points_distributed =
+            dvbg.ExtractPointCloud(0.5f).GetPointPositions().GetLength();
+    EXPECT_LE(n_points_distributed, n_points);
+    EXPECT_GT(n_points_distributed, 0.8 * n_points);
+
+    TensorMap rendering = vbg.RayCast(block_coords, intrinsic, extrinsic, cols,
+                                      rows, {"depth", "color"}, depth_scale,
+                                      0.1, depth_max, 0.5f);
+    TensorMap rendering_distributed = dvbg.RayCast(
+            block_coords, intrinsic, extrinsic, cols, rows, {"depth", "color"},
+            depth_scale, 0.1, depth_max, 0.5f);
+    EXPECT_EQ(rendering_distributed["depth"].GetShape(),
+              core::SizeVector({rows, cols, 1}));
+    EXPECT_EQ(rendering_distributed["color"].GetShape(),
+              core::SizeVector({rows, cols, 3}));
+
+    // Most pixels hit in both renderings agree up to two voxels.
+    core::Tensor depth_rendered = rendering["depth"];
+    core::Tensor depth_distributed = rendering_distributed["depth"];
+    core::Tensor hit = depth_rendered.Gt(0).LogicalAnd(depth_distributed.Gt(0));
+    int64_t n_hits =
+            depth_rendered.Gt(0).To(core::Int64).Sum({0, 1, 2}).Item<int64_t>();
+    int64_t n_common = hit.To(core::Int64).Sum({0, 1, 2}).Item<int64_t>();
+    EXPECT_GT(n_common, 0.9 * n_hits);
+    core::Tensor depth_diff = (depth_rendered.IndexGet({hit}) -
+                               depth_distributed.IndexGet({hit}))
+                                      .Abs();
+    int64_t n_agree =
+            depth_diff.Le(2 * 0.01 * depth_scale).To(core::Int64).Sum({0})
+                    .Item<int64_t>();
+    EXPECT_GT(n_agree, 0.9 * n_common);
+
+    // Voxel-wise attributes are local to a partition.
+    EXPECT_ANY_THROW(dvbg.RayCast(block_coords, intrinsic, extrinsic, cols,
+                                  rows, {"index"}));
+}
+
+}  // namespace tests
+}  // namespace open3d
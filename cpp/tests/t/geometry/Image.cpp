@@ -29,6 +29,7 @@
 #include <gmock/gmock.h>
 
 #include "core/CoreTest.h"
+#include "open3d/core/TensorFunction.h"
 #include "open3d/data/Dataset.h"
 #include "open3d/io/ImageIO.h"
 #include "open3d/io/PinholeCameraTrajectoryIO.h"
@@ -366,15 +367,9 @@ TEST_P(ImagePermuteDevices, FilterGaussian) {
         core::Tensor data =
                 core::Tensor(input_data, {5, 5, 1}, core::Float32, device);
         t::geometry::Image im(data);
-        if (!t::geometry::Image::HAVE_IPPICV &&
-            device.GetType() ==
-                    core::Device::DeviceType::CPU) {  // Not Implemented
-            ASSERT_THROW(im.FilterGaussian(3), std::runtime_error);
-        } else {
-            im = im.FilterGaussian(3);
-            EXPECT_TRUE(im.AsTensor().AllClose(core::Tensor(
-                    output_ref, {5, 5, 1}, core::Float32, device)));
-        }
+        im = im.FilterGaussian(3);
+        EXPECT_TRUE(im.AsTensor().AllClose(core::Tensor(
+                output_ref, {5, 5, 1}, core::Float32, device)));
     }
 
     {  // UInt8
@@ -402,19 +397,13 @@ TEST_P(ImagePermuteDevices, FilterGaussian) {
         core::Tensor data =
                 core::Tensor(input_data, {5, 5, 1}, core::UInt8, device);
         t::geometry::Image im(data);
-        if (!t::geometry::Image::HAVE_IPPICV &&
-            device.GetType() ==
-                    core::Device::DeviceType::CPU) {  // Not Implemented
-            ASSERT_THROW(im.FilterGaussian(3), std::runtime_error);
+        im = im.FilterGaussian(3);
+        if (device.GetType() == core::Device::DeviceType::CPU) {
+            EXPECT_TRUE(im.AsTensor().AllClose(core::Tensor(
+                    output_ref_ipp, {5, 5, 1}, core::UInt8, device)));
         } else {
-            im = im.FilterGaussian(3);
-            if (device.GetType() == core::Device::DeviceType::CPU) {
-                EXPECT_TRUE(im.AsTensor().AllClose(core::Tensor(
-                        output_ref_ipp, {5, 5, 1}, core::UInt8, device)));
-            } else {
-                EXPECT_TRUE(im.AsTensor().AllClose(core::Tensor(
-                        output_ref_npp, {5, 5, 1}, core::UInt8, device)));
-            }
+            EXPECT_TRUE(im.AsTensor().AllClose(core::Tensor(
+                    output_ref_npp, {5, 5, 1}, core::UInt8, device)));
         }
     }
 }
@@ -444,15 +433,8 @@ TEST_P(ImagePermuteDevices, Filter) {
         core::Tensor kernel =
                 core::Tensor(kernel_data, {5, 5}, core::Float32, device);
         t::geometry::Image im(data);
-        if (!t::geometry::Image::HAVE_IPPICV &&
-            device.GetType() ==
-                    core::Device::DeviceType::CPU) {  // Not Implemented
-            ASSERT_THROW(im.Filter(kernel), std::runtime_error);
-        } else {
-            t::geometry::Image im_new = im.Filter(kernel);
-            EXPECT_TRUE(
-                    im_new.AsTensor().Reverse().View({5, 5}).AllClose(kernel));
-        }
+        t::geometry::Image im_new = im.Filter(kernel);
+        EXPECT_TRUE(im_new.AsTensor().Reverse().View({5, 5}).AllClose(kernel));
     }
 
     {  // UInt8
@@ -492,19 +474,13 @@ TEST_P(ImagePermuteDevices, Filter) {
         core::Tensor kernel =
                 core::Tensor(kernel_data, {5, 5}, core::Float32, device);
         t::geometry::Image im(data);
-        if (!t::geometry::Image::HAVE_IPPICV &&
-            device.GetType() ==
-                    core::Device::DeviceType::CPU) {  // Not Implemented
-            ASSERT_THROW(im.Filter(kernel), std::runtime_error);
+        im = im.Filter(kernel);
+        if (device.GetType() == core::Device::DeviceType::CPU) {
+            EXPECT_TRUE(im.AsTensor().AllClose(core::Tensor(
+                    output_ref_ipp, {5, 5, 1}, core::UInt8, device)));
         } else {
-            im = im.Filter(kernel);
-            if (device.GetType() == core::Device::DeviceType::CPU) {
-                EXPECT_TRUE(im.AsTensor().AllClose(core::Tensor(
-                        output_ref_ipp, {5, 5, 1}, core::UInt8, device)));
-            } else {
-                EXPECT_TRUE(im.AsTensor().AllClose(core::Tensor(
-                        output_ref_npp, {5, 5, 1}, core::UInt8, device)));
-            }
+            EXPECT_TRUE(im.AsTensor().AllClose(core::Tensor(
+                    output_ref_npp, {5, 5, 1}, core::UInt8, device)));
         }
     }
 }
@@ -538,18 +514,12 @@ TEST_P(ImagePermuteDevices, FilterSobel) {
                 core::Tensor(input_data, {5, 5, 1}, core::Float32, device);
         t::geometry::Image im(data);
         t::geometry::Image dx, dy;
-        if (!t::geometry::Image::HAVE_IPPICV &&
-            device.GetType() ==
-                    core::Device::DeviceType::CPU) {  // Not Implemented
-            ASSERT_THROW(im.FilterSobel(3), std::runtime_error);
-        } else {
-            std::tie(dx, dy) = im.FilterSobel(3);
+        std::tie(dx, dy) = im.FilterSobel(3);
 
-            EXPECT_TRUE(dx.AsTensor().AllClose(core::Tensor(
-                    output_dx_ref, {5, 5, 1}, core::Float32, device)));
-            EXPECT_TRUE(dy.AsTensor().AllClose(core::Tensor(
-                    output_dy_ref, {5, 5, 1}, core::Float32, device)));
-        }
+        EXPECT_TRUE(dx.AsTensor().AllClose(core::Tensor(
+                output_dx_ref, {5, 5, 1}, core::Float32, device)));
+        EXPECT_TRUE(dy.AsTensor().AllClose(core::Tensor(
+                output_dy_ref, {5, 5, 1}, core::Float32, device)));
     }
 
     {  // UInt8 -> Int16
@@ -558,25 +528,152 @@ TEST_P(ImagePermuteDevices, FilterSobel) {
                         .To(core::UInt8);
         t::geometry::Image im(data);
         t::geometry::Image dx, dy;
-        if (!t::geometry::Image::HAVE_IPPICV &&
-            device.GetType() ==
-                    core::Device::DeviceType::CPU) {  // Not Implemented
-            ASSERT_THROW(im.FilterSobel(3), std::runtime_error);
-        } else {
-            std::tie(dx, dy) = im.FilterSobel(3);
+        std::tie(dx, dy) = im.FilterSobel(3);
+
+        EXPECT_TRUE(dx.AsTensor().AllClose(
+                core::Tensor(output_dx_ref, {5, 5, 1}, core::Float32, device)
+                        .To(core::Int16)));
+        EXPECT_TRUE(dy.AsTensor().AllClose(
+                core::Tensor(output_dy_ref, {5, 5, 1}, core::Float32, device)
+                        .To(core::Int16)));
+    }
+}
 
-            EXPECT_TRUE(dx.AsTensor().AllClose(
-                    core::Tensor(output_dx_ref, {5, 5, 1}, core::Float32,
-                                 device)
-                            .To(core::Int16)));
-            EXPECT_TRUE(dy.AsTensor().AllClose(
-                    core::Tensor(output_dy_ref, {5, 5, 1}, core::Float32,
-                                 device)
-                            .To(core::Int16)));
+TEST_P(ImagePermuteDevices, FilterSeparable) {
+    core::Device device = GetParam();
+
+    // A rank-1 kernel is applied as two 1D passes and must match the Gaussian
+    // filter with the same weights, for any number of channels.
+    const core::Tensor data =
+            core::Tensor::Arange(0, 7 * 6 * 3, 1, core::Float32, device)
+                    .Reshape({7, 6, 3})
+                    .Mul(0.37)
+                    .Sin();
+    const t::geometry::Image im(data);
+    const core::Tensor weights =
+            core::Tensor::Init<float>({0.27406862, 0.45186276, 0.27406862});
+    const core::Tensor kernel =
+            weights.View({3, 1}).Matmul(weights.View({1, 3})).To(device);
+    EXPECT_TRUE(im.Filter(kernel).AsTensor().AllClose(
+            im.FilterGaussian(3, 1.0f).AsTensor(), 1e-5, 1e-5));
+
+    // Compare with a direct evaluation of the correlation with replicated
+    // borders.
+    const core::Tensor im_host = data.To(core::Device("CPU:0"));
+    const core::Tensor out = im.Filter(kernel).AsTensor().To(
+            core::Device("CPU:0"));
+    const core::Tensor kernel_host = kernel.To(core::Device("CPU:0"));
+    for (int64_t y = 0; y < 7; ++y) {
+        for (int64_t x = 0; x < 6; ++x) {
+            float sum = 0;
+            for (int64_t i = 0; i < 3; ++i) {
+                for (int64_t j = 0; j < 3; ++j) {
+                    const int64_t yi = std::min<int64_t>(
+                            std::max<int64_t>(y + i - 1, 0), 6);
+                    const int64_t xj = std::min<int64_t>(
+                            std::max<int64_t>(x + j - 1, 0), 5);
+                    sum += kernel_host[i][j].Item<float>() *
+                           im_host[yi][xj][1].Item<float>();
+                }
+            }
+            EXPECT_NEAR(out[y][x][1].Item<float>(), sum, 1e-5);
         }
     }
 }
 
+TEST_P(ImagePermuteDevices, Remap) {
+    core::Device device = GetParam();
+
+    // clang-format off
+    const std::vector<float> input_data =
+      {0, 1, 2,
+       3, 4, 5};
+    const std::vector<float> map_x_data =
+      {0.5, 2, -1,
+       1, 1.25, 0};
+    const std::vector<float> map_y_data =
+      {0, 1, 0,
+       0.5, 0.2, 2};
+    const std::vector<float> output_linear_ref =
+      {0.5, 5, -1,
+       2.5, 1.85, -1};
+    // clang-format on
+
+    const t::geometry::Image im(
+            core::Tensor(input_data, {2, 3, 1}, core::Float32, device));
+    const core::Tensor map_x(map_x_data, {2, 3}, core::Float32, device);
+    const core::Tensor map_y(map_y_data, {2, 3}, core::Float32, device);
+
+    t::geometry::Image im_linear = im.Remap(
+            map_x, map_y, t::geometry::Image::InterpType::Linear, -1.0f);
+    EXPECT_TRUE(im_linear.AsTensor().AllClose(core::Tensor(
+            output_linear_ref, {2, 3, 1}, core::Float32, device)));
+
+    // Sampling at integer coordinates is exact for any dtype.
+    const core::Tensor im_uint16 =
+            core::Tensor(input_data, {2, 3, 1}, core::Float32, device)
+                    .To(core::UInt16);
+    const core::Tensor grid_x =
+            core::Tensor::Init<float>({{2, 1, 0}, {2, 1, 0}}, device);
+    const core::Tensor grid_y =
+            core::Tensor::Init<float>({{1, 1, 1}, {0, 0, 0}}, device);
+    for (auto interp_type : {t::geometry::Image::InterpType::Nearest,
+                             t::geometry::Image::InterpType::Linear}) {
+        t::geometry::Image flipped = t::geometry::Image(im_uint16).Remap(
+                grid_x, grid_y, interp_type);
+        EXPECT_EQ(flipped.GetDtype(), core::UInt16);
+        EXPECT_TRUE(flipped.AsTensor().AllEqual(
+                im_uint16.Reverse().Contiguous()));
+    }
+
+    EXPECT_ANY_THROW(im.Remap(map_x, map_y,
+                              t::geometry::Image::InterpType::Cubic));
+    EXPECT_ANY_THROW(im.Remap(map_x, map_y.Reshape({3, 2})));
+}
+
+TEST_P(ImagePermuteDevices, Undistort) {
+    core::Device device = GetParam();
+
+    // Each pixel stores its column, so bilinear sampling recovers the
+    // distorted column coordinate exactly.
+    const int64_t rows = 8, cols = 10;
+    const core::Tensor columns =
+            core::Tensor::Arange(0, cols, 1, core::Float32, device)
+                    .Reshape({1, cols, 1})
+                    .Expand({rows, cols, 1})
+                    .Contiguous();
+    const t::geometry::Image im(columns);
+    const core::Tensor intrinsics =
+            core::Tensor::Init<double>({{8, 0, 4.5}, {0, 8, 3.5}, {0, 0, 1}});
+
+    // Without distortion the image is unchanged.
+    const core::Tensor no_distortion = core::Tensor::Zeros({5}, core::Float64);
+    EXPECT_TRUE(im.Undistort(intrinsics, no_distortion)
+                        .AsTensor()
+                        .AllClose(columns, 1e-5, 1e-5));
+
+    const core::Tensor distortion =
+            core::Tensor::Init<double>({0.05, -0.01, 0.001, 0.002});
+    const core::Tensor out =
+            im.Undistort(intrinsics, distortion).AsTensor().To(
+                    core::Device("CPU:0"));
+    const int64_t v = 2, u = 6;
+    const double x = (u - 4.5) / 8, y = (v - 3.5) / 8;
+    const double r2 = x * x + y * y;
+    const double xd = x * (1 + 0.05 * r2 - 0.01 * r2 * r2) +
+                      2 * 0.001 * x * y + 0.002 * (r2 + 2 * x * x);
+    EXPECT_NEAR(out[v][u][0].Item<float>(), 8 * xd + 4.5, 1e-4);
+
+    // The cached lookup tables give the same result.
+    EXPECT_TRUE(im.Undistort(intrinsics, distortion)
+                        .AsTensor()
+                        .To(core::Device("CPU:0"))
+                        .AllClose(out));
+
+    EXPECT_ANY_THROW(im.Undistort(intrinsics, core::Tensor::Zeros(
+                                                      {3}, core::Float64)));
+}
+
 TEST_P(ImagePermuteDevices, Resize) {
     core::Device device = GetParam();
 
@@ -691,15 +788,9 @@ TEST_P(ImagePermuteDevices, PyrDown) {
                 core::Tensor(input_data, {6, 6, 1}, core::Float32, device);
         t::geometry::Image im(data);
 
-        if (!t::geometry::Image::HAVE_IPPICV &&
-            device.GetType() ==
-                    core::Device::DeviceType::CPU) {  // Not Implemented
-            ASSERT_THROW(im.PyrDown(), std::runtime_error);
-        } else {
-            im = im.PyrDown();
-            EXPECT_TRUE(im.AsTensor().AllClose(core::Tensor(
-                    output_ref, {3, 3, 1}, core::Float32, device)));
-        }
+        im = im.PyrDown();
+        EXPECT_TRUE(im.AsTensor().AllClose(core::Tensor(
+                output_ref, {3, 3, 1}, core::Float32, device)));
     }
 
     {  // UInt8
@@ -725,23 +816,53 @@ TEST_P(ImagePermuteDevices, PyrDown) {
                 core::Tensor(input_data, {6, 6, 1}, core::UInt8, device);
         t::geometry::Image im(data);
 
-        if (!t::geometry::Image::HAVE_IPPICV &&
-            device.GetType() ==
-                    core::Device::DeviceType::CPU) {  // Not Implemented
-            ASSERT_THROW(im.PyrDown(), std::runtime_error);
+        im = im.PyrDown();
+        if (device.GetType() == core::Device::DeviceType::CPU) {
+            EXPECT_TRUE(im.AsTensor().AllClose(core::Tensor(
+                    output_ref_ipp, {3, 3, 1}, core::UInt8, device)));
         } else {
-            im = im.PyrDown();
-            if (device.GetType() == core::Device::DeviceType::CPU) {
-                EXPECT_TRUE(im.AsTensor().AllClose(core::Tensor(
-                        output_ref_ipp, {3, 3, 1}, core::UInt8, device)));
-            } else {
-                EXPECT_TRUE(im.AsTensor().AllClose(core::Tensor(
-                        output_ref_npp, {3, 3, 1}, core::UInt8, device)));
-            }
+            EXPECT_TRUE(im.AsTensor().AllClose(core::Tensor(
+                    output_ref_npp, {3, 3, 1}, core::UInt8, device)));
         }
     }
 }
 
+TEST_P(ImagePermuteDevices, PyrDownBatch) {
+    core::Device device = GetParam();
+
+    // clang-format off
+    const std::vector<float> input_data =
+      {0, 0, 0, 1, 0, 1,
+       0, 1, 0, 0, 0, 1,
+       0, 0, 0, 1, 0, 1,
+       1, 0, 0, 0, 0, 1,
+       1, 0, 0, 0, 0, 1,
+       1, 1, 1, 1, 1, 1};
+    const std::vector<float> output_ref =
+      {0.0596343, 0.244201, 0.483257,
+       0.269109, 0.187536, 0.410317,
+       0.752312, 0.347241, 0.521471};
+    // clang-format on
+
+    const core::Tensor im(input_data, {1, 6, 6, 1}, core::Float32, device);
+    const core::Tensor stack = core::Concatenate({im, im.Mul(2), im.Mul(4)});
+    const core::Tensor ref(output_ref, {1, 3, 3, 1}, core::Float32, device);
+
+    const core::Tensor down = t::geometry::Image::PyrDownBatch(stack);
+    EXPECT_EQ(down.GetShape(), core::SizeVector({3, 3, 3, 1}));
+    EXPECT_TRUE(down.AllClose(core::Concatenate({ref, ref.Mul(2), ref.Mul(4)}),
+                              1e-5, 1e-5));
+
+    // Multi-channel integer stacks keep their dtype.
+    const core::Tensor stack_uint16 =
+            stack.Mul(1000).Expand({3, 6, 6, 3}).Contiguous().To(core::UInt16);
+    const core::Tensor down_uint16 =
+            t::geometry::Image::PyrDownBatch(stack_uint16);
+    EXPECT_EQ(down_uint16.GetDtype(), core::UInt16);
+    EXPECT_TRUE(down_uint16.To(core::Float32)
+                        .AllClose(down.Mul(1000).Expand({3, 3, 3, 3}), 0, 1));
+}
+
 TEST_P(ImagePermuteDevices, Dilate) {
     using ::testing::ElementsAreArray;
 
@@ -898,6 +1019,63 @@ TEST_P(ImagePermuteDevices, DepthToVertexNormalMaps) {
     EXPECT_TRUE(normal_map.AsTensor().AllClose(t_normal_ref));
 }
 
+TEST_P(ImagePermuteDevices, DepthToVertexNormalMapsBatch) {
+    core::Device device = GetParam();
+
+    // A stack of three depth images with invalid pixels, one camera each.
+    const int64_t batch_size = 3, rows = 8, cols = 10;
+    core::Tensor depths =
+            core::Tensor::Arange(0, batch_size * rows * cols, 1, core::Float32,
+                                 device)
+                    .Reshape({batch_size, rows, cols, 1})
+                    .Mul(0.1)
+                    .Sin()
+                    .Add(1.5);
+    depths.Slice(2, 0, cols, 7).Fill(0);
+    const core::Tensor intrinsics =
+            core::Tensor::Init<double>({{{5, 0, 4.5}, {0, 5, 3.5}, {0, 0, 1}},
+                                        {{6, 0, 5}, {0, 6, 4}, {0, 0, 1}},
+                                        {{7, 0, 4}, {0, 8, 3}, {0, 0, 1}}});
+    const float invalid_fill = 0.0f;
+
+    const core::Tensor vertex_maps = t::geometry::Image::CreateVertexMapBatch(
+            depths, intrinsics, invalid_fill);
+    const core::Tensor normal_maps =
+            t::geometry::Image::CreateNormalMapBatch(vertex_maps, invalid_fill);
+    const core::Tensor depths_down =
+            t::geometry::Image::PyrDownDepthBatch(depths, 0.2f, invalid_fill);
+    EXPECT_EQ(vertex_maps.GetShape(),
+              core::SizeVector({batch_size, rows, cols, 3}));
+    EXPECT_EQ(normal_maps.GetShape(),
+              core::SizeVector({batch_size, rows, cols, 3}));
+    EXPECT_EQ(depths_down.GetShape(),
+              core::SizeVector({batch_size, rows / 2, cols / 2, 1}));
+
+    // Each slice matches the single image version.
+    for (int64_t b = 0; b < batch_size; ++b) {
+        t::geometry::Image depth(depths[b].Contiguous());
+        t::geometry::Image vertex_map =
+                depth.CreateVertexMap(intrinsics[b], invalid_fill);
+        EXPECT_TRUE(vertex_maps[b].AllClose(vertex_map.AsTensor()));
+        EXPECT_TRUE(normal_maps[b].AllClose(
+                vertex_map.CreateNormalMap(invalid_fill).AsTensor()));
+        EXPECT_TRUE(depths_down[b].AllClose(
+                depth.PyrDownDepth(0.2f, invalid_fill).AsTensor()));
+    }
+
+    // A single camera is shared by all images.
+    const core::Tensor vertex_maps_shared =
+            t::geometry::Image::CreateVertexMapBatch(depths, intrinsics[0],
+                                                     invalid_fill);
+    EXPECT_TRUE(vertex_maps_shared[2].AllClose(
+            t::geometry::Image(depths[2].Contiguous())
+                    .CreateVertexMap(intrinsics[0], invalid_fill)
+                    .AsTensor()));
+
+    EXPECT_ANY_THROW(t::geometry::Image::CreateVertexMapBatch(
+            depths, intrinsics.Slice(0, 0, 2), invalid_fill));
+}
+
 TEST_P(ImagePermuteDevices, DISABLED_CreateVertexMap_Visual) {
     core::Device device = GetParam();
 
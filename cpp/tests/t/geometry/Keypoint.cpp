@@ -0,0 +1,161 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/t/geometry/Keypoint.h"
+
+#include <Eigen/Eigenvalues>
+#include <vector>
+
+#include "core/CoreTest.h"
+#include "open3d/core/TensorCheck.h"
+#include "tests/Tests.h"
+
+namespace open3d {
+namespace tests {
+
+class KeypointPermuteDevices : public PermuteDevices {};
+INSTANTIATE_TEST_SUITE_P(Keypoint,
+                         KeypointPermuteDevices,
+                         testing::ValuesIn(PermuteDevices::TestCases()));
+
+namespace {
+
+// Samples the surface of the unit cube on a grid with the given resolution.
+// The samples are jittered so that the saliency of neighbors is not tied.
+core::Tensor CreateCubeSurface(int resolution) {
+    std::vector<float> points;
+    std::vector<Eigen::Vector3d> jitter;
+    for (int i = 0; i <= resolution; ++i) {
+        for (int j = 0; j <= resolution; ++j) {
+            for (int k = 0; k <= resolution; ++k) {
+                if (i == 0 || i == resolution || j == 0 || j == resolution ||
+                    k == 0 || k == resolution) {
+                    points.push_back(float(i) / resolution);
+                    points.push_back(float(j) / resolution);
+                    points.push_back(float(k) / resolution);
+                }
+            }
+        }
+    }
+    const int64_t num_points = points.size() / 3;
+    jitter.resize(num_points);
+    Rand(jitter, Eigen::Vector3d::Constant(-0.01),
+         Eigen::Vector3d::Constant(0.01), 0);
+    for (int64_t i = 0; i < num_points; ++i) {
+        for (int d = 0; d < 3; ++d) {
+            points[3 * i + d] += float(jitter[i](d));
+        }
+    }
+    return core::Tensor(points, {num_points, 3}, core::Float32);
+}
+
+}  // namespace
+
+TEST_P(KeypointPermuteDevices, ComputeISSKeypoints) {
+    core::Device device = GetParam();
+    const core::Tensor points = CreateCubeSurface(10).To(core::Float64);
+    const double salient_radius = 0.25;
+    const double non_max_radius = 0.2;
+    const int min_neighbors = 5;
+
+    // Brute force reference with all neighbors within the radii.
+    const int64_t num_points = points.GetLength();
+    std::vector<Eigen::Vector3d> p(num_points);
+    for (int64_t i = 0; i < num_points; ++i) {
+        for (int d = 0; d < 3; ++d) {
+            p[i](d) = points[i][d].Item<double>();
+        }
+    }
+    std::vector<double> saliency(num_points, 0);
+    for (int64_t i = 0; i < num_points; ++i) {
+        std::vector<Eigen::Vector3d> neighbors;
+        for (int64_t j = 0; j < num_points; ++j) {
+            if ((p[j] - p[i]).norm() <= salient_radius) {
+                neighbors.push_back(p[j]);
+            }
+        }
+        if (int(neighbors.size()) < min_neighbors) continue;
+        Eigen::Vector3d mean = Eigen::Vector3d::Zero();
+        for (const auto &q : neighbors) mean += q;
+        mean /= double(neighbors.size());
+        Eigen::Matrix3d cov = Eigen::Matrix3d::Zero();
+        for (const auto &q : neighbors) {
+            cov += (q - mean) * (q - mean).transpose();
+        }
+        cov /= double(neighbors.size());
+        Eigen::SelfAdjointEigenSolver<Eigen::Matrix3d> solver(cov);
+        const Eigen::Vector3d &e = solver.eigenvalues();
+        if (e(1) / e(2) < 0.975 && e(0) / e(1) < 0.975) {
+            saliency[i] = e(0);
+        }
+    }
+    std::vector<bool> expected_mask(num_points, false);
+    for (int64_t i = 0; i < num_points; ++i) {
+        if (saliency[i] <= 0) continue;
+        int count = 0;
+        bool is_maximum = true;
+        for (int64_t j = 0; j < num_points; ++j) {
+            if ((p[j] - p[i]).norm() <= non_max_radius) {
+                ++count;
+                is_maximum = is_maximum && saliency[i] >= saliency[j];
+            }
+        }
+        expected_mask[i] = is_maximum && count >= min_neighbors;
+    }
+    const core::Tensor expected_keypoints = points.IndexGet(
+            {core::Tensor(expected_mask, {num_points}, core::Bool)});
+    EXPECT_GT(expected_keypoints.GetLength(), 0);
+
+    for (const core::Dtype &dtype : {core::Float32, core::Float64}) {
+        t::geometry::PointCloud pcd(points.To(device, dtype));
+        pcd.SetPointColors(pcd.GetPointPositions().Clone());
+        t::geometry::PointCloud keypoints =
+                t::geometry::keypoint::ComputeISSKeypoints(
+                        pcd, salient_radius, non_max_radius, 0.975, 0.975,
+                        min_neighbors, /*max_nn=*/1000);
+        EXPECT_TRUE(keypoints.GetPointPositions().AllClose(
+                expected_keypoints.To(device, dtype)));
+        EXPECT_TRUE(keypoints.GetPointColors().AllClose(
+                keypoints.GetPointPositions()));
+    }
+
+    // The radii are computed from the model resolution if not given.
+    t::geometry::PointCloud pcd(points.To(device));
+    EXPECT_NO_THROW(t::geometry::keypoint::ComputeISSKeypoints(pcd));
+}
+
+TEST_P(KeypointPermuteDevices, ComputeISSKeypointsEmpty) {
+    core::Device device = GetParam();
+    t::geometry::PointCloud pcd(device);
+    t::geometry::PointCloud keypoints =
+            t::geometry::keypoint::ComputeISSKeypoints(pcd);
+    EXPECT_TRUE(keypoints.IsEmpty());
+    EXPECT_EQ(keypoints.GetDevice(), device);
+}
+
+}  // namespace tests
+}  // namespace open3d
@@ -29,7 +29,11 @@
 #include <gmock/gmock.h>
 
 #include "core/CoreTest.h"
+#include "open3d/core/EigenConverter.h"
 #include "open3d/core/TensorCheck.h"
+#include "open3d/core/TensorFunction.h"
+#include "open3d/geometry/BoundingVolume.h"
+#include "open3d/t/geometry/PointCloud.h"
 #include "tests/Tests.h"
 
 namespace open3d {
@@ -424,5 +428,114 @@ TEST_P(LineSetPermuteDevices, ToLegacy) {
                       {Eigen::Vector3d(1, 1, 1), Eigen::Vector3d(1, 1, 1)}));
 }
 
+TEST_P(LineSetPermuteDevices, CreateFromPointCloudCorrespondences) {
+    core::Device device = GetParam();
+
+    t::geometry::PointCloud source(core::Tensor::Init<float>(
+            {{0, 0, 0}, {1, 0, 0}, {2, 0, 0}, {3, 0, 0}}, device));
+    t::geometry::PointCloud target(core::Tensor::Init<float>(
+            {{0, 1, 0}, {1, 1, 0}, {2, 1, 0}}, device));
+
+    // Index pairs.
+    t::geometry::LineSet lineset =
+            t::geometry::LineSet::CreateFromPointCloudCorrespondences(
+                    source, target,
+                    core::Tensor::Init<int64_t>({{3, 0}, {1, 2}}, device));
+    EXPECT_EQ(lineset.GetDevice(), device);
+    EXPECT_TRUE(lineset.GetPointPositions().AllClose(core::Tensor::Init<float>(
+            {{3, 0, 0}, {1, 0, 0}, {0, 1, 0}, {2, 1, 0}}, device)));
+    EXPECT_TRUE(lineset.GetLineIndices().AllEqual(
+            core::Tensor::Init<int64_t>({{0, 2}, {1, 3}}, device)));
+
+    // Target index per source point, as in RegistrationResult.
+    lineset = t::geometry::LineSet::CreateFromPointCloudCorrespondences(
+            source, target,
+            core::Tensor::Init<int64_t>({-1, 2, -1, 0}, device));
+    EXPECT_TRUE(lineset.GetPointPositions().AllClose(core::Tensor::Init<float>(
+            {{1, 0, 0}, {3, 0, 0}, {2, 1, 0}, {0, 1, 0}}, device)));
+    EXPECT_TRUE(lineset.GetLineIndices().AllEqual(
+            core::Tensor::Init<int64_t>({{0, 2}, {1, 3}}, device)));
+
+    // No correspondence gives an empty line set.
+    lineset = t::geometry::LineSet::CreateFromPointCloudCorrespondences(
+            source, target, core::Tensor::Full({4}, -1, core::Int64, device));
+    EXPECT_EQ(lineset.GetLineIndices().GetShape(), core::SizeVector({0, 2}));
+
+    EXPECT_ANY_THROW(t::geometry::LineSet::CreateFromPointCloudCorrespondences(
+            source, target, core::Tensor::Init<int64_t>({{0, 3}}, device)));
+    EXPECT_ANY_THROW(t::geometry::LineSet::CreateFromPointCloudCorrespondences(
+            source, target, core::Tensor::Init<int64_t>({{0, 1, 2}}, device)));
+}
+
+TEST_P(LineSetPermuteDevices, CreateFromBoundingBoxes) {
+    core::Device device = GetParam();
+
+    geometry::OrientedBoundingBox obb0(
+            Eigen::Vector3d(1, 2, 3),
+            Eigen::AngleAxisd(0.3, Eigen::Vector3d(1, 2, 3).normalized())
+                    .toRotationMatrix(),
+            Eigen::Vector3d(1, 2, 0.5));
+    geometry::OrientedBoundingBox obb1(Eigen::Vector3d(-1, 0, 0),
+                                       Eigen::Matrix3d::Identity(),
+                                       Eigen::Vector3d(3, 1, 1));
+    const core::Tensor centers = core::Tensor::Init<double>(
+            {{1, 2, 3}, {-1, 0, 0}}, device);
+    const core::Tensor extents = core::Tensor::Init<double>(
+            {{1, 2, 0.5}, {3, 1, 1}}, device);
+    const core::Tensor rotations =
+            core::Concatenate(
+                    {core::eigen_converter::EigenMatrixToTensor(obb0.R_)
+                             .Reshape({1, 3, 3}),
+                     core::eigen_converter::EigenMatrixToTensor(obb1.R_)
+                             .Reshape({1, 3, 3})},
+                    0)
+                    .To(device);
+    const core::Tensor colors =
+            core::Tensor::Init<double>({{1, 0, 0}, {0, 0, 1}}, device);
+
+    // Each box matches the legacy factory, with offset point indices.
+    t::geometry::LineSet lineset =
+            t::geometry::LineSet::CreateFromOrientedBoundingBoxes(
+                    centers, extents, rotations, colors);
+    ASSERT_EQ(lineset.GetPointPositions().GetLength(), 16);
+    ASSERT_EQ(lineset.GetLineIndices().GetLength(), 24);
+    const geometry::OrientedBoundingBox obbs[2] = {obb0, obb1};
+    for (int i = 0; i < 2; ++i) {
+        std::shared_ptr<geometry::LineSet> legacy =
+                geometry::LineSet::CreateFromOrientedBoundingBox(obbs[i]);
+        core::Tensor points = lineset.GetPointPositions().Slice(0, 8 * i,
+                                                                8 * i + 8);
+        core::Tensor lines =
+                lineset.GetLineIndices().Slice(0, 12 * i, 12 * i + 12) - 8 * i;
+        core::Tensor line_colors =
+                lineset.GetLineColors().Slice(0, 12 * i, 12 * i + 12);
+        EXPECT_TRUE(points.AllClose(
+                core::eigen_converter::EigenVector3dVectorToTensor(
+                        legacy->points_, core::Float64, device)));
+        EXPECT_TRUE(lines.AllEqual(
+                core::eigen_converter::EigenVector2iVectorToTensor(
+                        legacy->lines_, core::Int64, device)));
+        EXPECT_TRUE(line_colors.AllEqual(
+                colors.Slice(0, i, i + 1).Expand({12, 3})));
+    }
+
+    // Axis-aligned boxes have the corners of the legacy boxes.
+    geometry::AxisAlignedBoundingBox aabb(Eigen::Vector3d(-1, -2, -3),
+                                          Eigen::Vector3d(1, 0, 1));
+    lineset = t::geometry::LineSet::CreateFromAxisAlignedBoundingBoxes(
+            core::Tensor::Init<float>({{-1, -2, -3}}, device),
+            core::Tensor::Init<float>({{1, 0, 1}}, device));
+    EXPECT_TRUE(lineset.GetPointPositions().AllEqual(
+            core::eigen_converter::EigenVector3dVectorToTensor(
+                    aabb.GetBoxPoints(), core::Float32, device)));
+    EXPECT_EQ(lineset.GetLineIndices().GetLength(), 12);
+    EXPECT_FALSE(lineset.HasLineColors());
+
+    EXPECT_ANY_THROW(t::geometry::LineSet::CreateFromOrientedBoundingBoxes(
+            centers, extents.Slice(0, 0, 1), rotations));
+    EXPECT_ANY_THROW(t::geometry::LineSet::CreateFromOrientedBoundingBoxes(
+            centers, extents, rotations.To(core::Float32)));
+}
+
 }  // namespace tests
 }  // namespace open3d
@@ -29,9 +29,13 @@
 #include <gmock/gmock.h>
 
 #include "core/CoreTest.h"
+#include "open3d/core/EigenConverter.h"
 #include "open3d/core/Tensor.h"
+#include "open3d/core/TensorFunction.h"
+#include "open3d/core/nns/IncrementalNeighborGraph.h"
 #include "open3d/data/Dataset.h"
 #include "open3d/geometry/PointCloud.h"
+#include "open3d/t/geometry/TriangleMesh.h"
 #include "open3d/t/io/PointCloudIO.h"
 #include "open3d/utility/FileSystem.h"
 #include "tests/Tests.h"
@@ -127,6 +131,73 @@ TEST_P(PointCloudPermuteDevices, GetMinBound_GetMaxBound_GetCenter) {
               std::vector<float>({2.5, 3.5, 4.5}));
 }
 
+TEST_P(PointCloudPermuteDevices, GetClusterAxisAlignedBoundingBoxes) {
+    core::Device device = GetParam();
+    t::geometry::PointCloud pcd(core::Tensor::Init<float>({{0, 0, 0},
+                                                           {1, 2, 3},
+                                                           {9, 9, 9},
+                                                           {-1, 5, 2},
+                                                           {4, 4, 4},
+                                                           {7, 8, 9}},
+                                                          device));
+    const core::Tensor labels =
+            core::Tensor::Init<int32_t>({0, 0, -1, 0, 2, 2}, device);
+
+    core::Tensor min_bounds, max_bounds;
+    std::tie(min_bounds, max_bounds) =
+            pcd.GetClusterAxisAlignedBoundingBoxes(labels);
+    EXPECT_EQ(min_bounds.GetDtype(), core::Float32);
+    EXPECT_TRUE(min_bounds.AllClose(core::Tensor::Init<float>(
+            {{-1, 0, 0}, {0, 0, 0}, {4, 4, 4}}, device)));
+    EXPECT_TRUE(max_bounds.AllClose(core::Tensor::Init<float>(
+            {{1, 5, 3}, {0, 0, 0}, {7, 8, 9}}, device)));
+
+    std::tie(min_bounds, max_bounds) = pcd.GetClusterAxisAlignedBoundingBoxes(
+            core::Tensor::Full({6}, -1, core::Int64, device));
+    EXPECT_EQ(min_bounds.GetShape(), core::SizeVector({0, 3}));
+    EXPECT_ANY_THROW(pcd.GetClusterAxisAlignedBoundingBoxes(
+            core::Tensor::Zeros({5}, core::Int64, device)));
+}
+
+TEST_P(PointCloudPermuteDevices, GetClusterOrientedBoundingBoxes) {
+    core::Device device = GetParam();
+
+    // Cluster 1 is the corners of a box with extents 4, 2, 1 around
+    // (1, 2, 3), rotated by R. Cluster 0 is a single point.
+    const Eigen::Matrix3d R =
+            (Eigen::AngleAxisd(0.3, Eigen::Vector3d::UnitZ()) *
+             Eigen::AngleAxisd(0.5, Eigen::Vector3d::UnitX()))
+                    .toRotationMatrix();
+    std::vector<double> points = {5, 5, 5};
+    for (int i = 0; i < 8; ++i) {
+        const Eigen::Vector3d corner =
+                R * Eigen::Vector3d(i & 1 ? 2 : -2, i & 2 ? 1 : -1,
+                                    i & 4 ? 0.5 : -0.5) +
+                Eigen::Vector3d(1, 2, 3);
+        points.insert(points.end(), corner.data(), corner.data() + 3);
+    }
+    t::geometry::PointCloud pcd(
+            core::Tensor(points, {9, 3}, core::Float64, device));
+    const core::Tensor labels = core::Tensor::Init<int64_t>(
+            {0, 1, 1, 1, 1, 1, 1, 1, 1}, device);
+
+    core::Tensor centers, rotations, extents;
+    std::tie(centers, rotations, extents) =
+            pcd.GetClusterOrientedBoundingBoxes(labels);
+    EXPECT_TRUE(centers.AllClose(
+            core::Tensor::Init<double>({{5, 5, 5}, {1, 2, 3}}, device)));
+    EXPECT_TRUE(extents.AllClose(
+            core::Tensor::Init<double>({{0, 0, 0}, {4, 2, 1}}, device)));
+    EXPECT_TRUE(rotations[0].AllClose(
+            core::Tensor::Eye(3, core::Float64, device)));
+
+    // The axes match R up to their signs, and form a rotation.
+    const Eigen::Matrix3d R_es =
+            core::eigen_converter::TensorToEigenMatrixXd(rotations[1]);
+    EXPECT_TRUE((R_es.transpose() * R).cwiseAbs().isIdentity(1e-6));
+    EXPECT_NEAR(R_es.determinant(), 1, 1e-6);
+}
+
 TEST_P(PointCloudPermuteDevicePairs, CopyDevice) {
     core::Device dst_device;
     core::Device src_device;
@@ -152,6 +223,28 @@ TEST_P(PointCloudPermuteDevicePairs, CopyDevice) {
               pcd.GetPointPositions().GetDtype());
 }
 
+TEST_P(PointCloudPermuteDevicePairs, ToAsync) {
+    core::Device dst_device;
+    core::Device src_device;
+    std::tie(dst_device, src_device) = GetParam();
+
+    t::geometry::PointCloud pcd(src_device);
+    pcd.SetPointPositions(
+            core::Tensor::Ones({2, 3}, core::Float32, src_device));
+    pcd.SetPointColors(
+            core::Tensor::Ones({2, 3}, core::Float32, src_device) * 2);
+
+    core::Future<t::geometry::PointCloud> pcd_f =
+            pcd.ToAsync(dst_device, /*copy=*/true);
+    const t::geometry::PointCloud pcd_copy = pcd_f.Wait();
+    EXPECT_TRUE(pcd_f.IsReady());
+    EXPECT_EQ(pcd_copy.GetDevice(), dst_device);
+    EXPECT_TRUE(pcd_copy.GetPointPositions().To(src_device).AllClose(
+            pcd.GetPointPositions()));
+    EXPECT_TRUE(pcd_copy.GetPointColors().To(src_device).AllClose(
+            pcd.GetPointColors()));
+}
+
 TEST_P(PointCloudPermuteDevices, Copy) {
     core::Device device = GetParam();
     core::Dtype dtype = core::Float32;
@@ -200,6 +293,14 @@ TEST_P(PointCloudPermuteDevices, Transform) {
               std::vector<float>({3, 3, 2}));
     EXPECT_EQ(pcd.GetPointNormals().ToFlatVector<float>(),
               std::vector<float>({2, 2, 1}));
+
+    // Covariances are rotated as R * C * R^T.
+    pcd.SetPointAttr("covariances",
+                     core::Tensor(std::vector<float>{1, 0, 0, 0, 2, 0, 0, 0, 3},
+                                  {1, 3, 3}, dtype, device));
+    pcd.Transform(transformation);
+    EXPECT_EQ(pcd.GetPointAttr("covariances").ToFlatVector<float>(),
+              std::vector<float>({3, 2, 2, 2, 5, 2, 2, 2, 2}));
 }
 
 TEST_P(PointCloudPermuteDevices, Translate) {
@@ -294,6 +395,113 @@ TEST_P(PointCloudPermuteDevices, EstimateNormals) {
     EXPECT_TRUE(pcd.GetPointNormals().AllClose(normals, 1e-4, 1e-4));
 }
 
+TEST_P(PointCloudPermuteDevices, EstimateNormalsFromNeighbors) {
+    core::Device device = GetParam();
+
+    core::Tensor points = core::Tensor::Init<double>({{0, 0, 0},
+                                                      {0, 0, 1},
+                                                      {0, 1, 0},
+                                                      {0, 1, 1},
+                                                      {1, 0, 0},
+                                                      {1, 0, 1},
+                                                      {1, 1, 0},
+                                                      {1, 1, 1}},
+                                                     device);
+    t::geometry::PointCloud pcd(points);
+    pcd.EstimateNormals(4, 2.0);
+    const core::Tensor normals = pcd.GetPointNormals();
+    pcd.RemovePointAttr("normals");
+
+    // Neighbor lists of an IncrementalNeighborGraph built in two batches.
+    core::nns::IncrementalNeighborGraph graph(2.0, 4, core::Float64, device);
+    graph.Insert(points.Slice(0, 0, 3));
+    graph.Insert(points.Slice(0, 3, 8));
+    core::Tensor indices, distances, counts;
+    std::tie(indices, distances, counts) = graph.GetNeighbors();
+    pcd.EstimateNormalsFromNeighbors(indices, counts);
+    EXPECT_TRUE(pcd.GetPointNormals().AllClose(normals, 1e-4, 1e-4));
+
+    EXPECT_ANY_THROW(pcd.EstimateNormalsFromNeighbors(
+            indices.Slice(0, 0, 4), counts.Slice(0, 0, 4)));
+    EXPECT_ANY_THROW(pcd.EstimateNormalsFromNeighbors(
+            indices.To(core::Int64), counts));
+}
+
+TEST_P(PointCloudPermuteDevices, OrientNormalsConsistentTangentPlane) {
+    core::Device device = GetParam();
+
+    core::Tensor points = core::Tensor::Init<double>({{0, 0, 0},
+                                                      {0, 0, 1},
+                                                      {0, 1, 0},
+                                                      {0, 1, 1},
+                                                      {1, 0, 0},
+                                                      {1, 0, 1},
+                                                      {1, 1, 0},
+                                                      {1, 1, 1},
+                                                      {0.5, 0.5, -0.25},
+                                                      {0.5, 0.5, 1.25},
+                                                      {0.5, -0.25, 0.5},
+                                                      {0.5, 1.25, 0.5},
+                                                      {-0.25, 0.5, 0.5},
+                                                      {1.25, 0.5, 0.5}},
+                                                     device);
+    t::geometry::PointCloud pcd(points);
+    pcd.EstimateNormals(4);
+    pcd.OrientNormalsConsistentTangentPlane(4);
+
+    // All normals point outwards.
+    const double a = 0.57735;
+    const double b = 0.0927618;
+    const double c = 0.991358;
+    core::Tensor normals = core::Tensor::Init<double>({{-a, -a, -a},
+                                                       {-a, -a, a},
+                                                       {-a, a, -a},
+                                                       {-a, a, a},
+                                                       {a, -a, -a},
+                                                       {a, -a, a},
+                                                       {a, a, -a},
+                                                       {a, a, a},
+                                                       {-b, -b, -c},
+                                                       {-b, -b, c},
+                                                       {-b, -c, -b},
+                                                       {-b, c, -b},
+                                                       {-c, -b, -b},
+                                                       {c, -b, -b}},
+                                                      device);
+    EXPECT_EQ(pcd.GetPointNormals().GetDevice(), device);
+    EXPECT_TRUE(pcd.GetPointNormals().AllClose(normals, 1e-4, 1e-4));
+}
+
+TEST_P(PointCloudPermuteDevices, EstimateCovariances) {
+    core::Device device = GetParam();
+
+    core::Tensor points = core::Tensor::Init<double>({{0, 0, 0},
+                                                      {0, 0, 1},
+                                                      {0, 1, 0},
+                                                      {0, 1, 1},
+                                                      {1, 0, 0},
+                                                      {1, 0, 1},
+                                                      {1, 1, 0},
+                                                      {1, 1, 1}},
+                                                     device);
+    t::geometry::PointCloud pcd(points);
+
+    // All points are neighbors, with a variance of 2 / 7 along each axis.
+    const core::Tensor covariances =
+            (core::Tensor::Eye(3, core::Float64, device) * (2.0 / 7.0))
+                    .Reshape({1, 3, 3})
+                    .Expand({8, 3, 3});
+
+    pcd.EstimateCovariances(8, 2.0);
+    EXPECT_TRUE(pcd.GetPointAttr("covariances")
+                        .AllClose(covariances, 1e-4, 1e-4));
+    pcd.RemovePointAttr("covariances");
+
+    pcd.EstimateCovariances(8);
+    EXPECT_TRUE(pcd.GetPointAttr("covariances")
+                        .AllClose(covariances, 1e-4, 1e-4));
+}
+
 TEST_P(PointCloudPermuteDevices, FromLegacy) {
     core::Device device = GetParam();
     geometry::PointCloud legacy_pcd;
@@ -326,6 +534,41 @@ TEST_P(PointCloudPermuteDevices, FromLegacy) {
             core::Tensor::Ones({2, 3}, dtype, device)));
 }
 
+TEST_P(PointCloudPermuteDevices, FromLegacyMove) {
+    core::Device device = GetParam();
+    geometry::PointCloud legacy_pcd;
+    legacy_pcd.points_ = std::vector<Eigen::Vector3d>{Eigen::Vector3d(0, 1, 2),
+                                                      Eigen::Vector3d(3, 4, 5)};
+    legacy_pcd.colors_ = std::vector<Eigen::Vector3d>{Eigen::Vector3d(1, 1, 1),
+                                                      Eigen::Vector3d(1, 1, 1)};
+    const core::Tensor expected_positions =
+            core::Tensor::Init<double>({{0, 1, 2}, {3, 4, 5}}, device);
+
+    // Float32 or non-CPU device: converted, the legacy data is left intact.
+    geometry::PointCloud legacy_copy = legacy_pcd;
+    t::geometry::PointCloud pcd = t::geometry::PointCloud::FromLegacy(
+            std::move(legacy_copy), core::Float32, device);
+    EXPECT_TRUE(pcd.GetPointPositions().AllClose(
+            expected_positions.To(core::Float32)));
+    EXPECT_TRUE(pcd.GetPointColors().AllClose(
+            core::Tensor::Ones({2, 3}, core::Float32, device)));
+
+    // Float64 on CPU:0: the storage is taken over without a copy.
+    const Eigen::Vector3d *points_ptr = legacy_pcd.points_.data();
+    pcd = t::geometry::PointCloud::FromLegacy(std::move(legacy_pcd),
+                                              core::Float64);
+    EXPECT_TRUE(legacy_pcd.points_.empty());
+    EXPECT_TRUE(legacy_pcd.colors_.empty());
+    EXPECT_EQ(pcd.GetPointPositions().GetDataPtr<double>(),
+              points_ptr->data());
+    EXPECT_TRUE(pcd.HasPointColors());
+    EXPECT_FALSE(pcd.HasPointNormals());
+    EXPECT_TRUE(pcd.GetPointPositions().AllClose(
+            expected_positions.To(core::Device("CPU:0"))));
+    EXPECT_TRUE(pcd.GetPointColors().AllClose(
+            core::Tensor::Ones({2, 3}, core::Float64)));
+}
+
 TEST_P(PointCloudPermuteDevices, ToLegacy) {
     core::Device device = GetParam();
     core::Dtype dtype = core::Float32;
@@ -549,6 +792,53 @@ TEST_P(PointCloudPermuteDevices, CreateFromRGBDImage) {
     EXPECT_FALSE(pcd_out.HasPointNormals());
 }
 
+TEST_P(PointCloudPermuteDevices, CreateFromRGBDImageFiltered) {
+    core::Device device = GetParam();
+    // The pixel at (2, 2) is a flying pixel behind an invalid one.
+    core::Tensor im_depth = core::Tensor::Init<uint16_t>(
+            {{1000, 1000, 1000}, {1000, 1000, 0}, {1000, 1000, 2500}}, device);
+    core::Tensor im_color =
+            core::Tensor::Ones({3, 3, 3}, core::Float32, device);
+    core::Tensor intrinsics = core::Tensor::Init<float>(
+            {{10, 0, 1}, {0, 10, 1}, {0, 0, 1}}, device);
+    core::Tensor extrinsics = core::Tensor::Eye(4, core::Float32, device);
+    const t::geometry::RGBDImage rgbd(im_color, im_depth);
+
+    // Without filters, all pixels with a valid depth are kept in pixel order.
+    t::geometry::PointCloud pcd =
+            t::geometry::PointCloud::CreateFromRGBDImageFiltered(
+                    rgbd, intrinsics, extrinsics, 1000.f, 0.f, 3.f, 1, 0.05f,
+                    0);
+    EXPECT_EQ(pcd.GetPointPositions().GetLength(), 8);
+    EXPECT_TRUE(pcd.GetPointPositions()[7].AllClose(
+            core::Tensor::Init<float>({0.25, 0.25, 2.5}, device)));
+    EXPECT_EQ(pcd.GetPointColors().GetLength(), 8);
+
+    // The flying pixel has no consistent neighbor.
+    pcd = t::geometry::PointCloud::CreateFromRGBDImageFiltered(
+            rgbd, intrinsics, extrinsics, 1000.f, 0.f, 3.f, 1, 0.05f, 2);
+    EXPECT_TRUE(pcd.GetPointPositions().AllClose(core::Tensor::Init<float>(
+            {{-0.1, -0.1, 1.0},
+             {0.0, -0.1, 1.0},
+             {0.1, -0.1, 1.0},
+             {-0.1, 0.0, 1.0},
+             {0.0, 0.0, 1.0},
+             {-0.1, 0.1, 1.0},
+             {0.0, 0.1, 1.0}},
+            device)));
+
+    // Depth range.
+    pcd = t::geometry::PointCloud::CreateFromRGBDImageFiltered(
+            rgbd, intrinsics, extrinsics, 1000.f, 1.5f, 3.f, 1, 0.05f, 0);
+    EXPECT_EQ(pcd.GetPointPositions().GetLength(), 1);
+
+    // One point per voxel.
+    pcd = t::geometry::PointCloud::CreateFromRGBDImageFiltered(
+            rgbd, intrinsics, extrinsics, 1000.f, 0.f, 3.f, 1, 0.05f, 2, 1.0);
+    EXPECT_EQ(pcd.GetPointPositions().GetLength(), 4);
+    EXPECT_EQ(pcd.GetPointColors().GetLength(), 4);
+}
+
 TEST_P(PointCloudPermuteDevices, CreateFromRGBDOrDepthImageWithNormals) {
     core::Device device = GetParam();
 
@@ -671,6 +961,74 @@ TEST_P(PointCloudPermuteDevices, CreateFromRGBDOrDepthImageWithNormals) {
     EXPECT_TRUE(pcd_out.GetPointNormals().AllClose(t_normal_ref));
 }
 
+TEST_P(PointCloudPermuteDevices, ProjectToImages) {
+    core::Device device = GetParam();
+
+    // Two layers of points in front of the cameras, the far one partly
+    // occluded by the near one.
+    std::vector<float> positions, colors;
+    for (int i = 0; i < 40; ++i) {
+        for (int j = 0; j < 30; ++j) {
+            for (int layer = 0; layer < 2; ++layer) {
+                positions.insert(positions.end(),
+                                 {0.05f * i - 1.0f + 0.013f * layer,
+                                  0.05f * j - 0.75f + 0.007f * layer,
+                                  1.5f + 0.001f * i + 0.5f * layer});
+                colors.insert(colors.end(),
+                              {0.02f * i, 0.03f * j, float(layer)});
+            }
+        }
+    }
+    const int64_t n = static_cast<int64_t>(positions.size()) / 3;
+    t::geometry::PointCloud pcd(
+            core::Tensor(positions, {n, 3}, core::Float32, device));
+    pcd.SetPointColors(core::Tensor(colors, {n, 3}, core::Float32, device));
+
+    const int width = 64, height = 48;
+    const core::Tensor intrinsics = core::Tensor::Init<double>(
+            {{40, 0, 32}, {0, 40, 24}, {0, 0, 1}});
+    std::vector<core::Tensor> views;
+    for (int v = 0; v < 3; ++v) {
+        core::Tensor extrinsic = core::Tensor::Eye(4, core::Float64,
+                                                   core::Device("CPU:0"));
+        extrinsic[0][3] = 0.2 * v;
+        extrinsic[1][3] = -0.1 * v;
+        views.push_back(extrinsic.Reshape({1, 4, 4}));
+    }
+    const core::Tensor extrinsics = core::Concatenate(views);
+
+    const core::Tensor depth = pcd.ProjectToDepthImages(
+            width, height, intrinsics, extrinsics, 1000.0f, 3.0f);
+    core::Tensor color, rgbd_depth;
+    std::tie(color, rgbd_depth) = pcd.ProjectToRGBDImages(
+            width, height, intrinsics, extrinsics, 1000.0f, 3.0f);
+    EXPECT_EQ(depth.GetShape(), core::SizeVector({3, height, width, 1}));
+    EXPECT_EQ(color.GetShape(), core::SizeVector({3, height, width, 3}));
+    EXPECT_TRUE(rgbd_depth.AllClose(depth));
+
+    for (int64_t v = 0; v < 3; ++v) {
+        const t::geometry::RGBDImage gt = pcd.ProjectToRGBDImage(
+                width, height, intrinsics, views[v][0], 1000.0f, 3.0f);
+        EXPECT_TRUE(depth[v].AllClose(gt.depth_.AsTensor()));
+        EXPECT_TRUE(color[v].AllClose(gt.color_.AsTensor()));
+    }
+    // Both layers are visible somewhere in the images.
+    EXPECT_TRUE(depth.Gt(0).LogicalAnd(depth.Lt(1600.0f)).Any());
+    EXPECT_TRUE(depth.Gt(1900.0f).Any());
+
+    // Shared and per view intrinsics give the same images.
+    const core::Tensor per_view_intrinsics = core::Concatenate(
+            {intrinsics.Reshape({1, 3, 3}), intrinsics.Reshape({1, 3, 3}),
+             intrinsics.Reshape({1, 3, 3})});
+    EXPECT_TRUE(pcd.ProjectToDepthImages(width, height, per_view_intrinsics,
+                                         extrinsics)
+                        .AllClose(pcd.ProjectToDepthImages(
+                                width, height, intrinsics, extrinsics)));
+    EXPECT_ANY_THROW(pcd.ProjectToDepthImages(width, height,
+                                              per_view_intrinsics,
+                                              extrinsics.Slice(0, 0, 2)));
+}
+
 TEST_P(PointCloudPermuteDevices, SelectPoints) {
     core::Device device = GetParam();
 
@@ -709,6 +1067,100 @@ TEST_P(PointCloudPermuteDevices, VoxelDownSample) {
             core::Tensor::Init<float>({{0, 0, 0}}, device)));
 }
 
+TEST_P(PointCloudPermuteDevices, SortByMortonCode) {
+    core::Device device = GetParam();
+
+    // Corners of the unit cube in scrambled order.
+    t::geometry::PointCloud pcd(core::Tensor::Init<float>({{1, 1, 1},
+                                                           {0, 1, 0},
+                                                           {1, 0, 1},
+                                                           {0, 0, 0},
+                                                           {1, 1, 0},
+                                                           {0, 0, 1},
+                                                           {1, 0, 0},
+                                                           {0, 1, 1}},
+                                                          device));
+    pcd.SetPointAttr("labels", core::Tensor::Arange(0, 8, 1, core::Int64,
+                                                    device));
+
+    t::geometry::PointCloud pcd_sorted = pcd.SortByMortonCode();
+    EXPECT_TRUE(pcd_sorted.GetPointPositions().AllClose(
+            core::Tensor::Init<float>({{0, 0, 0},
+                                       {1, 0, 0},
+                                       {0, 1, 0},
+                                       {1, 1, 0},
+                                       {0, 0, 1},
+                                       {1, 0, 1},
+                                       {0, 1, 1},
+                                       {1, 1, 1}},
+                                      device)));
+    EXPECT_EQ(pcd_sorted.GetPointAttr("labels").ToFlatVector<int64_t>(),
+              std::vector<int64_t>({3, 6, 1, 4, 5, 2, 7, 0}));
+
+    // Voxel down sampling with spatially ordered output.
+    t::geometry::PointCloud pcd_random(
+            core::Tensor::Init<float>({{0.1, 3.3, 0.9},
+                                       {2.9, 0.2, 1.4},
+                                       {1.3, 0.6, 2.8},
+                                       {0.2, 3.4, 0.2},
+                                       {3.5, 2.1, 0.7}},
+                                      device));
+    t::geometry::PointCloud pcd_down =
+            pcd_random.VoxelDownSample(1, core::HashBackendType::Default, true);
+    EXPECT_EQ(pcd_down.GetPointPositions().GetLength(), 4);
+    EXPECT_TRUE(pcd_down.GetPointPositions().AllClose(
+            pcd_down.SortByMortonCode().GetPointPositions()));
+
+    EXPECT_FALSE(t::geometry::PointCloud(device)
+                         .SortByMortonCode()
+                         .HasPointPositions());
+}
+
+TEST_P(PointCloudPermuteDevices, FarthestPointDownSample) {
+    core::Device device = GetParam();
+
+    t::geometry::PointCloud pcd_small(
+            core::Tensor::Init<float>({{0.0, 0.0, 0.0},
+                                       {1.0, 0.0, 0.0},
+                                       {0.0, 2.0, 0.0},
+                                       {0.0, 0.0, 3.0},
+                                       {1.0, 1.0, 1.0}},
+                                      device));
+    pcd_small.SetPointColors(
+            core::Tensor::Init<float>({{0.0}, {0.1}, {0.2}, {0.3}, {0.4}},
+                                      device)
+                    .Reshape({5, 1})
+                    .Expand({5, 3})
+                    .Contiguous());
+
+    auto pcd_down = pcd_small.FarthestPointDownSample(4);
+    EXPECT_TRUE(pcd_down.GetPointPositions().AllClose(
+            core::Tensor::Init<float>({{0.0, 0.0, 0.0},
+                                       {0.0, 0.0, 3.0},
+                                       {0.0, 2.0, 0.0},
+                                       {1.0, 1.0, 1.0}},
+                                      device)));
+    EXPECT_TRUE(pcd_down.GetPointColors().AllClose(
+            core::Tensor::Init<float>({{0.0, 0.0, 0.0},
+                                       {0.3, 0.3, 0.3},
+                                       {0.2, 0.2, 0.2},
+                                       {0.4, 0.4, 0.4}},
+                                      device)));
+
+    t::geometry::PointCloud pcd_double(
+            pcd_small.GetPointPositions().To(core::Float64));
+    EXPECT_TRUE(pcd_double.FarthestPointDownSample(2)
+                        .GetPointPositions()
+                        .AllClose(
+            core::Tensor::Init<double>({{0.0, 0.0, 0.0}, {0.0, 0.0, 3.0}},
+                                       device)));
+    EXPECT_EQ(pcd_small.FarthestPointDownSample(0)
+                      .GetPointPositions()
+                      .GetLength(),
+              0);
+    EXPECT_ANY_THROW(pcd_small.FarthestPointDownSample(6));
+}
+
 TEST_P(PointCloudPermuteDevices, RemoveRadiusOutliers) {
     core::Device device = GetParam();
 
@@ -734,5 +1186,190 @@ TEST_P(PointCloudPermuteDevices, RemoveRadiusOutliers) {
                                       device)));
 }
 
+TEST_P(PointCloudPermuteDevices, ComputeDistance) {
+    core::Device device = GetParam();
+
+    const t::geometry::PointCloud source(core::Tensor::Init<float>(
+            {{0.0, 0.0, 0.0}, {1.0, 0.0, 0.0}, {0.0, 3.0, 0.0}}, device));
+    const t::geometry::PointCloud target(core::Tensor::Init<float>(
+            {{0.0, 0.0, 0.0}, {1.0, 0.0, 0.0}, {5.0, 0.0, 0.0}}, device));
+
+    EXPECT_TRUE(source.ComputeDistance(target).AllClose(
+            core::Tensor::Init<float>({0.0, 0.0, 3.0}, device)));
+    EXPECT_TRUE(target.ComputeDistance(source).AllClose(
+            core::Tensor::Init<float>({0.0, 0.0, 4.0}, device)));
+
+    EXPECT_NEAR(source.ComputeChamferDistance(target, false), 1.0, 1e-6);
+    EXPECT_NEAR(source.ComputeChamferDistance(target), 1.0 + 4.0 / 3.0, 1e-6);
+    EXPECT_NEAR(source.ComputeHausdorffDistance(target, false), 3.0, 1e-6);
+    EXPECT_NEAR(source.ComputeHausdorffDistance(target), 4.0, 1e-6);
+
+    EXPECT_ANY_THROW(source.ComputeDistance(t::geometry::PointCloud(
+            core::Tensor::Empty({0, 3}, core::Float32, device))));
+}
+
+TEST_P(PointCloudPermuteDevices, ClusterDBSCAN) {
+    core::Device device = GetParam();
+
+    const t::geometry::PointCloud pcd(core::Tensor::Init<float>(
+            {{0.0, 0.0, 0.0},
+             {0.1, 0.0, 0.0},
+             {0.2, 0.0, 0.0},
+             {0.3, 0.0, 0.0},
+             {5.0, 0.0, 0.0},
+             {5.1, 0.0, 0.0},
+             {5.2, 0.0, 0.0},
+             {10.0, 0.0, 0.0}},
+            device));
+    const core::Tensor labels_gt =
+            core::Tensor::Init<int32_t>({0, 0, 0, 0, 1, 1, 1, -1}, device);
+
+    // All clustered points are core points.
+    core::Tensor labels = pcd.ClusterDBSCAN(0.15, 2);
+    EXPECT_EQ(labels.GetDtype(), core::Int32);
+    EXPECT_EQ(labels.GetDevice(), device);
+    EXPECT_TRUE(labels.AllEqual(labels_gt));
+
+    // The end points of both clusters are border points.
+    labels = pcd.ClusterDBSCAN(0.15, 3);
+    EXPECT_TRUE(labels.AllEqual(labels_gt));
+
+    EXPECT_TRUE(pcd.ClusterDBSCAN(0.15, 4).AllEqual(
+            core::Tensor::Full({8}, -1, core::Int32, device)));
+}
+
+TEST_P(PointCloudPermuteDevices, ClusterConnectedComponents) {
+    core::Device device = GetParam();
+
+    const t::geometry::PointCloud pcd(core::Tensor::Init<float>(
+            {{5.0, 0.0, 0.0},
+             {0.0, 0.0, 0.0},
+             {0.2, 0.0, 0.0},
+             {5.1, 0.0, 0.0},
+             {0.1, 0.0, 0.0},
+             {10.0, 0.0, 0.0}},
+            device));
+    const core::Tensor labels = pcd.ClusterConnectedComponents(0.15);
+    EXPECT_EQ(labels.GetDtype(), core::Int64);
+    EXPECT_EQ(labels.GetDevice(), device);
+    EXPECT_TRUE(labels.AllEqual(
+            core::Tensor::Init<int64_t>({0, 1, 1, 0, 1, 2}, device)));
+
+    EXPECT_TRUE(pcd.ClusterConnectedComponents(10).AllEqual(
+            core::Tensor::Zeros({6}, core::Int64, device)));
+    EXPECT_ANY_THROW(pcd.ClusterConnectedComponents(0));
+}
+
+TEST_P(PointCloudPermuteDevices, SegmentPlane) {
+    core::Device device = GetParam();
+
+    // A 10x10 grid on z = 0, an 8x8 grid on x = 20 and two outliers.
+    std::vector<float> points;
+    for (int i = 0; i < 10; ++i) {
+        for (int j = 0; j < 10; ++j) {
+            points.insert(points.end(), {float(i), float(j), 0.f});
+        }
+    }
+    for (int i = 0; i < 8; ++i) {
+        for (int j = 0; j < 8; ++j) {
+            points.insert(points.end(), {20.f, float(i), float(j + 1)});
+        }
+    }
+    points.insert(points.end(), {3.5f, 4.5f, 7.f, 10.f, 2.f, 3.f});
+    const t::geometry::PointCloud pcd(
+            core::Tensor(points, {166, 3}, core::Float32, device));
+
+    core::Tensor plane, inliers;
+    std::tie(plane, inliers) = pcd.SegmentPlane(0.01, 3, 1000, 0.99999999, 1);
+    EXPECT_EQ(plane.GetShape(), core::SizeVector({4}));
+    EXPECT_EQ(inliers.GetLength(), 100);
+    EXPECT_TRUE(inliers.AllEqual(
+            core::Tensor::Arange(0, 100, 1, core::Int64, device)));
+    EXPECT_NEAR(std::abs(plane[2].Item<double>()), 1.0, 1e-6);
+    EXPECT_NEAR(plane[3].Item<double>(), 0.0, 1e-6);
+
+    core::Tensor planes, labels;
+    std::tie(planes, labels) =
+            pcd.SegmentPlanes(0.01, 3, 10, 3, 1000, 0.99999999, 1);
+    EXPECT_EQ(planes.GetShape(), core::SizeVector({2, 4}));
+    EXPECT_EQ(labels.GetDtype(), core::Int32);
+    EXPECT_TRUE(labels.Slice(0, 0, 100).AllEqual(
+            core::Tensor::Full({100}, 0, core::Int32, device)));
+    EXPECT_TRUE(labels.Slice(0, 100, 164).AllEqual(
+            core::Tensor::Full({64}, 1, core::Int32, device)));
+    EXPECT_TRUE(labels.Slice(0, 164, 166).AllEqual(
+            core::Tensor::Full({2}, -1, core::Int32, device)));
+    EXPECT_NEAR(std::abs(planes[1][0].Item<double>()), 1.0, 1e-6);
+    EXPECT_NEAR(std::abs(planes[1][3].Item<double>()), 20.0, 1e-5);
+}
+
+TEST_P(PointCloudPermuteDevices, ComputeConvexHull) {
+    core::Device device = GetParam();
+
+    // Needs at least 4 points.
+    const t::geometry::PointCloud pcd_line(core::Tensor::Init<float>(
+            {{0, 0, 0}, {0, 0, 1}, {0, 1, 0}}, device));
+    EXPECT_ANY_THROW(pcd_line.ComputeConvexHull());
+
+    // Unit cube with a point at its center.
+    const t::geometry::PointCloud pcd(core::Tensor::Init<float>(
+            {{0.5, 0.5, 0.5},
+             {0, 0, 0},
+             {0, 0, 1},
+             {0, 1, 0},
+             {0, 1, 1},
+             {1, 0, 0},
+             {1, 0, 1},
+             {1, 1, 0},
+             {1, 1, 1}},
+            device));
+    const t::geometry::TriangleMesh mesh = pcd.ComputeConvexHull();
+    const core::Tensor point_indices = mesh.GetVertexAttr("point_indices");
+    EXPECT_TRUE(point_indices.AllEqual(core::Tensor::Init<int64_t>(
+            {7, 3, 1, 5, 6, 2, 8, 4}, device)));
+    EXPECT_TRUE(mesh.GetVertexPositions().AllClose(
+            pcd.GetPointPositions().IndexGet({point_indices})));
+    EXPECT_EQ(mesh.GetTriangleIndices().GetShape(), core::SizeVector({12, 3}));
+    EXPECT_EQ(mesh.GetDevice(), device);
+}
+
+TEST_P(PointCloudPermuteDevices, HiddenPointRemoval) {
+    core::Device device = GetParam();
+
+    // Points on the unit sphere, seen from a camera on the z axis.
+    std::vector<double> points;
+    for (int i = 1; i < 20; ++i) {
+        const double theta = M_PI * i / 20;
+        for (int j = 0; j < 40; ++j) {
+            const double phi = 2 * M_PI * j / 40;
+            points.insert(points.end(), {std::sin(theta) * std::cos(phi),
+                                         std::sin(theta) * std::sin(phi),
+                                         std::cos(theta)});
+        }
+    }
+    points.insert(points.end(), {0, 0, 1});
+    const int64_t num_points = static_cast<int64_t>(points.size()) / 3;
+    const t::geometry::PointCloud pcd(
+            core::Tensor(points, {num_points, 3}, core::Float64, device));
+
+    t::geometry::TriangleMesh mesh;
+    core::Tensor indices;
+    std::tie(mesh, indices) = pcd.HiddenPointRemoval(
+            core::Tensor::Init<double>({0, 0, 5}, device), 5 * 100);
+    EXPECT_EQ(indices.GetDtype(), core::Int64);
+    EXPECT_GT(indices.GetLength(), 0);
+    EXPECT_TRUE(mesh.GetVertexPositions().AllClose(
+            pcd.GetPointPositions().IndexGet({indices})));
+
+    // Only the half of the sphere facing the camera is visible.
+    const core::Tensor visible_z =
+            mesh.GetVertexPositions().Slice(1, 2, 3).Flatten();
+    EXPECT_TRUE(visible_z.Gt(0).All());
+    EXPECT_TRUE(indices.Eq(num_points - 1).Any());
+
+    EXPECT_ANY_THROW(pcd.HiddenPointRemoval(
+            core::Tensor::Init<double>({0, 0, 5}, device), 0));
+}
+
 }  // namespace tests
 }  // namespace open3d
@@ -0,0 +1,234 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/t/geometry/PointCloudBatch.h"
+
+#include <random>
+#include <vector>
+
+#include "core/CoreTest.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/core/TensorFunction.h"
+#include "open3d/t/geometry/PointCloud.h"
+#include "tests/Tests.h"
+
+namespace open3d {
+namespace tests {
+
+class PointCloudBatchPermuteDevices : public PermuteDevices {};
+INSTANTIATE_TEST_SUITE_P(PointCloudBatch,
+                         PointCloudBatchPermuteDevices,
+                         testing::ValuesIn(PermuteDevices::TestCases()));
+
+// Clouds of random points on planes with colors. The third cloud is empty.
+static std::vector<t::geometry::PointCloud> MakeClouds(
+        const core::Device& device) {
+    std::mt19937 rng(0);
+    std::uniform_real_distribution<float> dist(0.f, 1.f);
+    std::vector<t::geometry::PointCloud> clouds;
+    for (int64_t size : {300, 200, 0, 250}) {
+        std::vector<float> positions;
+        std::vector<float> colors;
+        for (int64_t i = 0; i < size; ++i) {
+            const float x = dist(rng);
+            const float y = dist(rng);
+            positions.insert(positions.end(),
+                             {x, y, 0.2f * x + 0.01f * dist(rng)});
+            colors.insert(colors.end(), {dist(rng), dist(rng), dist(rng)});
+        }
+        t::geometry::PointCloud pcd(device);
+        pcd.SetPointPositions(core::Tensor(positions, {size, 3},
+                                           core::Float32, device));
+        pcd.SetPointColors(
+                core::Tensor(colors, {size, 3}, core::Float32, device));
+        clouds.push_back(pcd);
+    }
+    return clouds;
+}
+
+TEST_P(PointCloudBatchPermuteDevices, FromPointClouds) {
+    core::Device device = GetParam();
+
+    std::vector<t::geometry::PointCloud> clouds = MakeClouds(device);
+    t::geometry::PointCloudBatch batch =
+            t::geometry::PointCloudBatch::FromPointClouds(clouds);
+    EXPECT_EQ(batch.GetBatchSize(), 4);
+    EXPECT_EQ(batch.GetNumPoints(), 750);
+    EXPECT_EQ(batch.GetRowSplits().ToFlatVector<int64_t>(),
+              std::vector<int64_t>({0, 300, 500, 500, 750}));
+
+    std::vector<int64_t> batch_indices =
+            batch.GetBatchIndices().ToFlatVector<int64_t>();
+    EXPECT_EQ(batch_indices[0], 0);
+    EXPECT_EQ(batch_indices[299], 0);
+    EXPECT_EQ(batch_indices[300], 1);
+    EXPECT_EQ(batch_indices[499], 1);
+    EXPECT_EQ(batch_indices[500], 3);
+    EXPECT_EQ(batch_indices[749], 3);
+
+    std::vector<t::geometry::PointCloud> unbatched = batch.ToPointClouds();
+    ASSERT_EQ(unbatched.size(), clouds.size());
+    for (size_t i = 0; i < clouds.size(); ++i) {
+        EXPECT_TRUE(unbatched[i].GetPointPositions().AllClose(
+                clouds[i].GetPointPositions()));
+        EXPECT_TRUE(unbatched[i].GetPointColors().AllClose(
+                clouds[i].GetPointColors()));
+    }
+
+    // The clouds must have the same attributes.
+    t::geometry::PointCloud no_colors(device);
+    no_colors.SetPointPositions(clouds[0].GetPointPositions());
+    EXPECT_ANY_THROW(t::geometry::PointCloudBatch::FromPointClouds(
+            {clouds[0], no_colors}));
+}
+
+TEST_P(PointCloudBatchPermuteDevices, Transform) {
+    core::Device device = GetParam();
+
+    std::vector<t::geometry::PointCloud> clouds = MakeClouds(device);
+    for (t::geometry::PointCloud& pcd : clouds) {
+        pcd.SetPointNormals(pcd.GetPointColors());
+    }
+    t::geometry::PointCloudBatch batch =
+            t::geometry::PointCloudBatch::FromPointClouds(clouds);
+
+    std::vector<core::Tensor> transformations;
+    for (size_t i = 0; i < clouds.size(); ++i) {
+        const double angle = 0.3 * static_cast<double>(i + 1);
+        transformations.push_back(core::Tensor::Init<float>(
+                {{std::cos(angle), -std::sin(angle), 0, 1.f * i},
+                 {std::sin(angle), std::cos(angle), 0, 0},
+                 {0, 0, 1, -2},
+                 {0, 0, 0, 1}},
+                device));
+    }
+    std::vector<core::Tensor> batch_transformations;
+    for (const core::Tensor& transformation : transformations) {
+        batch_transformations.push_back(transformation.Reshape({1, 4, 4}));
+    }
+    batch.Transform(core::Concatenate(batch_transformations, 0));
+
+    std::vector<t::geometry::PointCloud> transformed = batch.ToPointClouds();
+    for (size_t i = 0; i < clouds.size(); ++i) {
+        clouds[i].Transform(transformations[i]);
+        EXPECT_TRUE(transformed[i].GetPointPositions().AllClose(
+                clouds[i].GetPointPositions(), 1e-5, 1e-5));
+        EXPECT_TRUE(transformed[i].GetPointNormals().AllClose(
+                clouds[i].GetPointNormals(), 1e-5, 1e-5));
+    }
+
+    EXPECT_ANY_THROW(batch.Transform(transformations[0]));
+}
+
+TEST_P(PointCloudBatchPermuteDevices, VoxelDownSample) {
+    core::Device device = GetParam();
+
+    std::vector<t::geometry::PointCloud> clouds = MakeClouds(device);
+    // The second cloud overlaps the first, so voxels must not be merged
+    // across clouds.
+    clouds[1] = clouds[0].Clone();
+    t::geometry::PointCloudBatch batch =
+            t::geometry::PointCloudBatch::FromPointClouds(clouds);
+    t::geometry::PointCloudBatch batch_down = batch.VoxelDownSample(0.1);
+    ASSERT_EQ(batch_down.GetBatchSize(), 4);
+
+    for (size_t i = 0; i < clouds.size(); ++i) {
+        t::geometry::PointCloud pcd_down = batch_down.GetPointCloud(i);
+        if (clouds[i].GetPointPositions().GetLength() == 0) {
+            EXPECT_EQ(pcd_down.GetPointPositions().GetLength(), 0);
+            continue;
+        }
+        t::geometry::PointCloud expected =
+                clouds[i].VoxelDownSample(0.1).SortByMortonCode();
+        EXPECT_TRUE(pcd_down.HasPointColors());
+        EXPECT_TRUE(pcd_down.SortByMortonCode().GetPointPositions().AllClose(
+                expected.GetPointPositions()));
+    }
+}
+
+TEST_P(PointCloudBatchPermuteDevices, RemoveRadiusOutliers) {
+    core::Device device = GetParam();
+
+    std::vector<t::geometry::PointCloud> clouds = MakeClouds(device);
+    t::geometry::PointCloudBatch batch =
+            t::geometry::PointCloudBatch::FromPointClouds(clouds);
+    t::geometry::PointCloudBatch batch_inliers;
+    core::Tensor mask;
+    std::tie(batch_inliers, mask) = batch.RemoveRadiusOutliers(6, 0.06);
+
+    std::vector<core::Tensor> expected_masks;
+    for (size_t i = 0; i < clouds.size(); ++i) {
+        if (clouds[i].GetPointPositions().GetLength() == 0) {
+            EXPECT_EQ(batch_inliers.GetPointCloud(i)
+                              .GetPointPositions()
+                              .GetLength(),
+                      0);
+            continue;
+        }
+        t::geometry::PointCloud expected;
+        core::Tensor expected_mask;
+        std::tie(expected, expected_mask) =
+                clouds[i].RemoveRadiusOutliers(6, 0.06);
+        expected_masks.push_back(expected_mask);
+        EXPECT_TRUE(batch_inliers.GetPointCloud(i).GetPointPositions().AllClose(
+                expected.GetPointPositions()));
+    }
+    EXPECT_TRUE(mask.AllEqual(core::Concatenate(expected_masks, 0)));
+    EXPECT_LT(batch_inliers.GetNumPoints(), batch.GetNumPoints());
+}
+
+TEST_P(PointCloudBatchPermuteDevices, EstimateNormals) {
+    core::Device device = GetParam();
+
+    std::vector<t::geometry::PointCloud> clouds = MakeClouds(device);
+    clouds.erase(clouds.begin() + 2);
+    for (const utility::optional<double> radius :
+         {utility::optional<double>(0.2), utility::optional<double>()}) {
+        t::geometry::PointCloudBatch batch =
+                t::geometry::PointCloudBatch::FromPointClouds(clouds);
+        batch.EstimateNormals(20, radius);
+
+        std::vector<t::geometry::PointCloud> estimated = batch.ToPointClouds();
+        for (size_t i = 0; i < clouds.size(); ++i) {
+            t::geometry::PointCloud expected = clouds[i].Clone();
+            expected.EstimateNormals(20, radius);
+            // Normals are only defined up to their sign.
+            const core::Tensor cos =
+                    (estimated[i].GetPointNormals() *
+                     expected.GetPointNormals())
+                            .Sum({1})
+                            .Abs();
+            EXPECT_TRUE(cos.AllClose(core::Tensor::Ones(
+                                             cos.GetShape(), core::Float32,
+                                             device),
+                                     1e-3, 1e-3));
+        }
+    }
+}
+
+}  // namespace tests
+}  // namespace open3d
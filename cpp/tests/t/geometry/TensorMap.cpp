@@ -118,5 +118,49 @@ TEST_P(TensorMapPermuteDevices, Contains) {
     EXPECT_FALSE(tm.Contains("normals"));
 }
 
+TEST_P(TensorMapPermuteDevices, Slice) {
+    core::Device device = GetParam();
+
+    t::geometry::TensorMap tm(
+            "positions",
+            {{"positions", core::Tensor::Init<float>(
+                                   {{0, 0, 0}, {1, 1, 1}, {2, 2, 2}}, device)},
+             {"labels", core::Tensor::Init<int32_t>({0, 1, 2}, device)}});
+    t::geometry::TensorMap tm_slice = tm.Slice(1, 3);
+    EXPECT_EQ(tm_slice.GetPrimaryKey(), "positions");
+    EXPECT_TRUE(tm_slice["labels"].AllEqual(
+            core::Tensor::Init<int32_t>({1, 2}, device)));
+    // The slices are views of the same memory.
+    EXPECT_TRUE(tm_slice["positions"].IsSame(tm["positions"].Slice(0, 1, 3)));
+    tm_slice["labels"].Fill(5);
+    EXPECT_TRUE(tm["labels"].AllEqual(
+            core::Tensor::Init<int32_t>({0, 5, 5}, device)));
+}
+
+TEST_P(TensorMapPermuteDevices, IndexGet) {
+    core::Device device = GetParam();
+
+    t::geometry::TensorMap tm(
+            "positions",
+            {{"positions", core::Tensor::Init<float>(
+                                   {{0, 0, 0}, {1, 1, 1}, {2, 2, 2}}, device)},
+             {"labels", core::Tensor::Init<int32_t>({0, 1, 2}, device)}});
+    t::geometry::TensorMap tm_mask =
+            tm.IndexGet(core::Tensor::Init<bool>({true, false, true}, device));
+    EXPECT_EQ(tm_mask.GetPrimaryKey(), "positions");
+    EXPECT_TRUE(tm_mask["positions"].AllEqual(
+            core::Tensor::Init<float>({{0, 0, 0}, {2, 2, 2}}, device)));
+    EXPECT_TRUE(tm_mask["labels"].AllEqual(
+            core::Tensor::Init<int32_t>({0, 2}, device)));
+
+    t::geometry::TensorMap tm_indices =
+            tm.IndexGet(core::Tensor::Init<int64_t>({2, 2, 1}, device));
+    EXPECT_TRUE(tm_indices["labels"].AllEqual(
+            core::Tensor::Init<int32_t>({2, 2, 1}, device)));
+
+    EXPECT_ANY_THROW(tm.IndexGet(core::Tensor::Init<bool>({true}, device)));
+    EXPECT_ANY_THROW(tm.IndexGet(core::Tensor::Init<int32_t>({0}, device)));
+}
+
 }  // namespace tests
 }  // namespace open3d
@@ -30,6 +30,8 @@
 
 #include "core/CoreTest.h"
 #include "open3d/core/TensorCheck.h"
+#include "open3d/geometry/TriangleMesh.h"
+#include "open3d/t/geometry/PointCloud.h"
 #include "tests/Tests.h"
 
 namespace open3d {
@@ -407,6 +409,47 @@ TEST_P(TriangleMeshPermuteDevices, FromLegacy) {
                                           .Reshape({-1, 3, 2})));
 }
 
+TEST_P(TriangleMeshPermuteDevices, FromLegacyMove) {
+    core::Device device = GetParam();
+    geometry::TriangleMesh legacy_mesh;
+    legacy_mesh.vertices_ = std::vector<Eigen::Vector3d>{
+            Eigen::Vector3d(0, 0, 0), Eigen::Vector3d(1, 0, 0),
+            Eigen::Vector3d(0, 1, 0)};
+    legacy_mesh.vertex_colors_ = std::vector<Eigen::Vector3d>(
+            3, Eigen::Vector3d(1, 1, 1));
+    legacy_mesh.triangles_ =
+            std::vector<Eigen::Vector3i>{Eigen::Vector3i(0, 1, 2)};
+    legacy_mesh.triangle_uvs_ = std::vector<Eigen::Vector2d>{
+            Eigen::Vector2d(0.0, 0.1), Eigen::Vector2d(0.2, 0.3),
+            Eigen::Vector2d(0.4, 0.5)};
+
+    // Dtypes other than the legacy storage types: converted.
+    geometry::TriangleMesh legacy_copy = legacy_mesh;
+    t::geometry::TriangleMesh mesh = t::geometry::TriangleMesh::FromLegacy(
+            std::move(legacy_copy), core::Float32, core::Int64, device);
+    EXPECT_TRUE(mesh.GetVertexColors().AllClose(
+            core::Tensor::Ones({3, 3}, core::Float32, device)));
+    EXPECT_TRUE(mesh.GetTriangleIndices().AllClose(
+            core::Tensor::Init<int64_t>({{0, 1, 2}}, device)));
+    EXPECT_EQ(mesh.GetTriangleAttr("texture_uvs").GetShape(),
+              core::SizeVector({1, 3, 2}));
+
+    // Float64 and Int32 on CPU:0: the storage is taken over without a copy.
+    const int *triangles_ptr = legacy_mesh.triangles_.data()->data();
+    mesh = t::geometry::TriangleMesh::FromLegacy(
+            std::move(legacy_mesh), core::Float64, core::Int32);
+    EXPECT_TRUE(legacy_mesh.vertices_.empty());
+    EXPECT_TRUE(legacy_mesh.triangles_.empty());
+    EXPECT_EQ(mesh.GetTriangleIndices().GetDataPtr<int>(), triangles_ptr);
+    EXPECT_TRUE(mesh.HasVertexColors());
+    EXPECT_FALSE(mesh.HasVertexNormals());
+    EXPECT_TRUE(mesh.GetVertexPositions().AllClose(core::Tensor::Init<double>(
+            {{0, 0, 0}, {1, 0, 0}, {0, 1, 0}})));
+    EXPECT_TRUE(mesh.GetTriangleAttr("texture_uvs")
+                        .AllClose(core::Tensor::Init<double>(
+                                {{{0.0, 0.1}, {0.2, 0.3}, {0.4, 0.5}}})));
+}
+
 TEST_P(TriangleMeshPermuteDevices, ToLegacy) {
     using ::testing::ElementsAreArray;
     using ::testing::FloatEq;
@@ -453,5 +496,480 @@ TEST_P(TriangleMeshPermuteDevices, ToLegacy) {
                                   Pointwise(FloatEq(), {1.0, 1.1})}));
 }
 
+TEST_P(TriangleMeshPermuteDevices, SimplifyQuadricDecimation) {
+    core::Device device = GetParam();
+
+    // A planar grid keeps its vertices on the plane and its triangles facing
+    // the same side.
+    const int64_t n = 20;
+    std::vector<float> positions;
+    std::vector<int64_t> indices;
+    for (int64_t v = 0; v <= n; ++v) {
+        for (int64_t u = 0; u <= n; ++u) {
+            positions.insert(positions.end(), {float(u), float(v), 0.f});
+        }
+    }
+    for (int64_t v = 0; v < n; ++v) {
+        for (int64_t u = 0; u < n; ++u) {
+            const int64_t i = v * (n + 1) + u;
+            indices.insert(indices.end(),
+                           {i, i + 1, i + n + 2, i, i + n + 2, i + n + 1});
+        }
+    }
+    const int64_t n_vertices = (n + 1) * (n + 1);
+    t::geometry::TriangleMesh grid(
+            core::Tensor(positions, {n_vertices, 3}, core::Float32, device),
+            core::Tensor(indices, {2 * n * n, 3}, core::Int64, device));
+    grid.SetVertexColors(
+            core::Tensor::Ones({n_vertices, 3}, core::Float32, device) * 0.5);
+    grid.SetTriangleNormals(
+            core::Tensor::Zeros({2 * n * n, 3}, core::Float32, device));
+
+    t::geometry::TriangleMesh simplified = grid.SimplifyQuadricDecimation(100);
+    EXPECT_EQ(simplified.GetDevice(), device);
+    EXPECT_LE(simplified.GetTriangleIndices().GetLength(), 100);
+    EXPECT_GT(simplified.GetTriangleIndices().GetLength(), 0);
+    EXPECT_EQ(simplified.GetTriangleIndices().GetDtype(), core::Int64);
+    EXPECT_EQ(simplified.GetVertexPositions().GetDtype(), core::Float32);
+    EXPECT_TRUE(simplified.GetVertexPositions()
+                        .Slice(1, 2, 3)
+                        .AllClose(core::Tensor::Zeros(
+                                {simplified.GetVertexPositions().GetLength(),
+                                 1},
+                                core::Float32, device),
+                                  0, 1e-5));
+    EXPECT_TRUE(simplified.GetVertexColors().AllClose(
+            core::Tensor::Ones(simplified.GetVertexColors().GetShape(),
+                               core::Float32, device) *
+            0.5));
+    const core::Tensor normals = simplified.GetTriangleNormals();
+    EXPECT_TRUE(normals.Slice(1, 2, 3).AllClose(core::Tensor::Ones(
+            {normals.GetLength(), 1}, core::Float32, device)));
+
+    // Closed meshes stay closed and close to the original surface.
+    t::geometry::TriangleMesh sphere = t::geometry::TriangleMesh::FromLegacy(
+            *geometry::TriangleMesh::CreateSphere(1.0, 40), core::Float64,
+            core::Int32, device);
+    const int64_t n_triangles = sphere.GetTriangleIndices().GetLength();
+    simplified = sphere.SimplifyQuadricDecimation(n_triangles / 10);
+    EXPECT_LE(simplified.GetTriangleIndices().GetLength(), n_triangles / 10);
+    EXPECT_GT(simplified.GetTriangleIndices().GetLength(), n_triangles / 20);
+    EXPECT_EQ(simplified.GetTriangleIndices().GetDtype(), core::Int32);
+    geometry::TriangleMesh simplified_legacy = simplified.ToLegacy();
+    EXPECT_TRUE(simplified_legacy.GetNonManifoldEdges(false).empty());
+    for (const Eigen::Vector3d& vertex : simplified_legacy.vertices_) {
+        EXPECT_NEAR(vertex.norm(), 1.0, 0.05);
+    }
+
+    // Target above the number of triangles returns a copy.
+    EXPECT_EQ(grid.SimplifyQuadricDecimation(1000)
+                      .GetTriangleIndices()
+                      .GetLength(),
+              2 * n * n);
+}
+
+TEST_P(TriangleMeshPermuteDevices, FilterSmooth) {
+    core::Device device = GetParam();
+
+    std::shared_ptr<geometry::TriangleMesh> sphere_legacy =
+            geometry::TriangleMesh::CreateSphere(1.0, 20);
+    sphere_legacy->ComputeVertexNormals();
+    const t::geometry::TriangleMesh sphere =
+            t::geometry::TriangleMesh::FromLegacy(*sphere_legacy, core::Float64,
+                                                  core::Int64, device);
+
+    // Same result as the legacy implementation.
+    t::geometry::TriangleMesh smoothed = sphere.FilterSmoothLaplacian(3, 0.5);
+    EXPECT_EQ(smoothed.GetDevice(), device);
+    t::geometry::TriangleMesh expected = t::geometry::TriangleMesh::FromLegacy(
+            *sphere_legacy->FilterSmoothLaplacian(3, 0.5), core::Float64,
+            core::Int64, device);
+    EXPECT_TRUE(smoothed.GetVertexPositions().AllClose(
+            expected.GetVertexPositions()));
+    EXPECT_TRUE(smoothed.GetVertexNormals().AllClose(
+            expected.GetVertexNormals()));
+    EXPECT_TRUE(smoothed.GetTriangleIndices().AllEqual(
+            sphere.GetTriangleIndices()));
+
+    smoothed = sphere.FilterSmoothTaubin(10, 0.5, -0.53);
+    expected = t::geometry::TriangleMesh::FromLegacy(
+            *sphere_legacy->FilterSmoothTaubin(10, 0.5, -0.53), core::Float64,
+            core::Int64, device);
+    EXPECT_TRUE(smoothed.GetVertexPositions().AllClose(
+            expected.GetVertexPositions()));
+
+    // Zero iterations return a copy.
+    EXPECT_TRUE(sphere.FilterSmoothLaplacian(0).GetVertexPositions().AllClose(
+            sphere.GetVertexPositions()));
+    EXPECT_ANY_THROW(sphere.FilterSmoothLaplacian(-1));
+}
+
+TEST_P(TriangleMeshPermuteDevices, Subdivide) {
+    core::Device device = GetParam();
+
+    t::geometry::TriangleMesh triangle(
+            core::Tensor::Init<float>({{0, 0, 0}, {2, 0, 0}, {0, 2, 0}},
+                                      device),
+            core::Tensor::Init<int64_t>({{0, 1, 2}}, device));
+    triangle.SetTriangleColors(
+            core::Tensor::Init<float>({{0.1, 0.2, 0.3}}, device));
+    t::geometry::TriangleMesh subdivided = triangle.SubdivideMidpoint(1);
+    EXPECT_EQ(subdivided.GetDevice(), device);
+    EXPECT_TRUE(subdivided.GetVertexPositions().AllClose(
+            core::Tensor::Init<float>({{0, 0, 0},
+                                       {2, 0, 0},
+                                       {0, 2, 0},
+                                       {1, 0, 0},
+                                       {0, 1, 0},
+                                       {1, 1, 0}},
+                                      device)));
+    EXPECT_TRUE(subdivided.GetTriangleIndices().AllEqual(
+            core::Tensor::Init<int64_t>(
+                    {{0, 3, 4}, {3, 1, 5}, {5, 2, 4}, {3, 5, 4}}, device)));
+    EXPECT_TRUE(subdivided.GetTriangleColors().AllClose(
+            core::Tensor::Init<float>({{0.1, 0.2, 0.3}}, device)
+                    .Expand({4, 3})));
+
+    // The vertex order differs from the legacy implementation, but the
+    // vertices are the same.
+    std::shared_ptr<geometry::TriangleMesh> box_legacy =
+            geometry::TriangleMesh::CreateBox();
+    const t::geometry::TriangleMesh box =
+            t::geometry::TriangleMesh::FromLegacy(*box_legacy, core::Float64,
+                                                  core::Int32, device);
+    auto ExpectSameVertices = [&](const t::geometry::TriangleMesh& mesh,
+                                  const geometry::TriangleMesh& mesh_legacy) {
+        const t::geometry::TriangleMesh expected =
+                t::geometry::TriangleMesh::FromLegacy(
+                        mesh_legacy, mesh.GetVertexPositions().GetDtype(),
+                        mesh.GetTriangleIndices().GetDtype(), device);
+        EXPECT_EQ(mesh.GetTriangleIndices().GetShape(),
+                  expected.GetTriangleIndices().GetShape());
+        EXPECT_TRUE(mesh.GetVertexPositions().Sum({0}).AllClose(
+                expected.GetVertexPositions().Sum({0})));
+        EXPECT_TRUE((mesh.GetVertexPositions() * mesh.GetVertexPositions())
+                            .Sum({0})
+                            .AllClose((expected.GetVertexPositions() *
+                                       expected.GetVertexPositions())
+                                              .Sum({0})));
+    };
+    EXPECT_EQ(box.SubdivideMidpoint(1).GetTriangleIndices().GetDtype(),
+              core::Int32);
+    ExpectSameVertices(box.SubdivideMidpoint(2),
+                       *box_legacy->SubdivideMidpoint(2));
+    ExpectSameVertices(box.SubdivideLoop(2), *box_legacy->SubdivideLoop(2));
+    ExpectSameVertices(triangle.SubdivideLoop(1),
+                       *triangle.ToLegacy().SubdivideLoop(1));
+}
+
+TEST_P(TriangleMeshPermuteDevices, EdgeConnectivity) {
+    core::Device device = GetParam();
+
+    // Square of two triangles sharing the edge (1, 2).
+    t::geometry::TriangleMesh square(
+            core::Tensor::Init<float>(
+                    {{0, 0, 0}, {1, 0, 0}, {0, 1, 0}, {1, 1, 0}}, device),
+            core::Tensor::Init<int32_t>({{0, 1, 2}, {2, 1, 3}}, device));
+    EXPECT_TRUE(square.ComputeHalfEdgeTwins().AllEqual(
+            core::Tensor::Init<int64_t>({-1, 3, -1, 1, -1, -1}, device)));
+    EXPECT_TRUE(square.GetBoundaryEdges().AllEqual(core::Tensor::Init<int64_t>(
+            {{0, 1}, {2, 0}, {1, 3}, {3, 2}}, device)));
+    EXPECT_EQ(square.GetNonManifoldEdges().GetShape(),
+              core::SizeVector({0, 2}));
+    EXPECT_EQ(square.GetNonManifoldEdges(false).GetLength(), 4);
+    EXPECT_TRUE(square.IsEdgeManifold());
+    EXPECT_FALSE(square.IsEdgeManifold(false));
+
+    // A third triangle on the edge (1, 2) makes it non-manifold.
+    t::geometry::TriangleMesh fan(
+            core::Tensor::Init<float>({{0, 0, 0},
+                                       {1, 0, 0},
+                                       {0, 1, 0},
+                                       {1, 1, 0},
+                                       {1, 1, 1}},
+                                      device),
+            core::Tensor::Init<int64_t>({{0, 1, 2}, {2, 1, 3}, {1, 2, 4}},
+                                        device));
+    EXPECT_TRUE(fan.GetNonManifoldEdges().AllEqual(
+            core::Tensor::Init<int64_t>({{1, 2}}, device)));
+    EXPECT_FALSE(fan.IsEdgeManifold());
+    EXPECT_EQ(fan.ComputeHalfEdgeTwins().Ne(-1).Any(), false);
+
+    // Inconsistently oriented triangles have no twins.
+    t::geometry::TriangleMesh flipped(
+            square.GetVertexPositions(),
+            core::Tensor::Init<int64_t>({{0, 1, 2}, {1, 2, 3}}, device));
+    EXPECT_EQ(flipped.ComputeHalfEdgeTwins().Ne(-1).Any(), false);
+    EXPECT_TRUE(flipped.IsEdgeManifold());
+
+    // Closed meshes have a twin for every half-edge and no boundary.
+    const t::geometry::TriangleMesh box =
+            t::geometry::TriangleMesh::FromLegacy(
+                    *geometry::TriangleMesh::CreateBox(), core::Float32,
+                    core::Int64, device);
+    const core::Tensor twins = box.ComputeHalfEdgeTwins();
+    EXPECT_TRUE(twins.Ne(-1).All());
+    EXPECT_TRUE(twins.IndexGet({twins}).AllEqual(
+            core::Tensor::Arange(0, twins.GetLength(), 1, core::Int64,
+                                 device)));
+    EXPECT_EQ(box.GetBoundaryEdges().GetLength(), 0);
+    EXPECT_TRUE(box.IsEdgeManifold(false));
+
+    t::geometry::TriangleMesh empty(device);
+    EXPECT_EQ(empty.ComputeHalfEdgeTwins().GetLength(), 0);
+    EXPECT_TRUE(empty.IsEdgeManifold());
+}
+
+TEST_P(TriangleMeshPermuteDevices, ClusterConnectedTriangles) {
+    core::Device device = GetParam();
+
+    // A unit square, a floating triangle and a fan of three triangles around
+    // a non-manifold edge, in interleaved order.
+    t::geometry::TriangleMesh mesh(
+            core::Tensor::Init<double>({{0, 0, 0},
+                                        {1, 0, 0},
+                                        {0, 1, 0},
+                                        {1, 1, 0},
+                                        {5, 0, 0},
+                                        {6, 0, 0},
+                                        {5, 2, 0},
+                                        {9, 0, 0},
+                                        {9, 1, 0},
+                                        {8, 0, 0},
+                                        {10, 0, 0},
+                                        {9, 0, 1}},
+                                       device),
+            core::Tensor::Init<int64_t>({{7, 8, 9},
+                                         {0, 1, 2},
+                                         {4, 5, 6},
+                                         {8, 7, 10},
+                                         {2, 1, 3},
+                                         {7, 8, 11}},
+                                        device));
+    core::Tensor cluster_ids, cluster_counts, cluster_areas;
+    std::tie(cluster_ids, cluster_counts, cluster_areas) =
+            mesh.ClusterConnectedTriangles();
+    EXPECT_EQ(cluster_ids.GetDevice(), device);
+    EXPECT_TRUE(cluster_ids.AllEqual(
+            core::Tensor::Init<int64_t>({0, 1, 2, 0, 1, 0}, device)));
+    EXPECT_TRUE(cluster_counts.AllEqual(
+            core::Tensor::Init<int64_t>({3, 2, 1}, device)));
+    EXPECT_TRUE(cluster_areas.AllClose(
+            core::Tensor::Init<double>({1.5, 1.0, 1.0}, device)));
+
+    // Same clusters as the legacy implementation.
+    std::vector<int> cluster_ids_legacy;
+    std::vector<size_t> cluster_counts_legacy;
+    std::vector<double> cluster_areas_legacy;
+    std::tie(cluster_ids_legacy, cluster_counts_legacy, cluster_areas_legacy) =
+            mesh.ToLegacy().ClusterConnectedTriangles();
+    EXPECT_EQ(cluster_ids.ToFlatVector<int64_t>(),
+              std::vector<int64_t>(cluster_ids_legacy.begin(),
+                                   cluster_ids_legacy.end()));
+
+    std::tie(cluster_ids, cluster_counts, std::ignore) =
+            t::geometry::TriangleMesh(device).ClusterConnectedTriangles();
+    EXPECT_EQ(cluster_ids.GetLength(), 0);
+    EXPECT_EQ(cluster_counts.GetLength(), 0);
+}
+
+TEST_P(TriangleMeshPermuteDevices, CleanMesh) {
+    core::Device device = GetParam();
+
+    // Two copies of vertex 0 and 1, an unreferenced vertex 5, a triangle made
+    // degenerate by the merge and a flipped duplicate of the first triangle.
+    const core::Tensor positions = core::Tensor::Init<double>({{0, 0, 0},
+                                                               {1, 0, 0},
+                                                               {0, 1, 0},
+                                                               {0, 0, 0},
+                                                               {1, 0, 0},
+                                                               {7, 7, 7},
+                                                               {1, 1, 0}},
+                                                              device);
+    const core::Tensor triangles =
+            core::Tensor::Init<int32_t>({{0, 1, 2},
+                                         {3, 0, 2},
+                                         {1, 6, 2},
+                                         {2, 4, 3},
+                                         {0, 0, 1}},
+                                        device);
+    t::geometry::TriangleMesh mesh(positions, triangles);
+    mesh.SetVertexColors(core::Tensor::Arange(0, 21, 1, core::Float32, device)
+                                 .Reshape({7, 3}));
+    mesh.SetTriangleNormals(
+            core::Tensor::Arange(0, 15, 1, core::Float32, device)
+                    .Reshape({5, 3}));
+
+    t::geometry::TriangleMesh cleaned = mesh.Clone();
+    cleaned.CleanMesh();
+    EXPECT_TRUE(cleaned.GetVertexPositions().AllEqual(
+            core::Tensor::Init<double>(
+                    {{0, 0, 0}, {1, 0, 0}, {0, 1, 0}, {1, 1, 0}}, device)));
+    EXPECT_TRUE(cleaned.GetVertexColors().AllEqual(
+            core::Tensor::Init<float>(
+                    {{0, 1, 2}, {3, 4, 5}, {6, 7, 8}, {18, 19, 20}},
+                    device)));
+    EXPECT_EQ(cleaned.GetTriangleIndices().GetDtype(), core::Int32);
+    EXPECT_TRUE(cleaned.GetTriangleIndices().AllEqual(
+            core::Tensor::Init<int32_t>({{0, 1, 2}, {1, 3, 2}}, device)));
+    EXPECT_TRUE(cleaned.GetTriangleNormals().AllEqual(
+            core::Tensor::Init<float>({{0, 1, 2}, {6, 7, 8}}, device)));
+
+    // The single steps.
+    t::geometry::TriangleMesh step = mesh.Clone();
+    step.RemoveDegenerateTriangles();
+    EXPECT_EQ(step.GetTriangleIndices().GetLength(), 4);
+    EXPECT_EQ(step.GetVertexPositions().GetLength(), 7);
+    step.RemoveDuplicatedTriangles();
+    EXPECT_EQ(step.GetTriangleIndices().GetLength(), 4);
+    step.RemoveUnreferencedVertices();
+    EXPECT_EQ(step.GetVertexPositions().GetLength(), 6);
+    step.RemoveDuplicatedVertices();
+    EXPECT_EQ(step.GetVertexPositions().GetLength(), 4);
+    EXPECT_TRUE(step.GetTriangleIndices().AllEqual(
+            core::Tensor::Init<int32_t>(
+                    {{0, 1, 2}, {0, 0, 2}, {1, 3, 2}, {2, 1, 0}}, device)));
+    step.RemoveDuplicatedTriangles();
+    EXPECT_TRUE(step.GetTriangleIndices().AllEqual(
+            core::Tensor::Init<int32_t>(
+                    {{0, 1, 2}, {0, 0, 2}, {1, 3, 2}}, device)));
+
+    // Same result as the legacy implementation.
+    open3d::geometry::TriangleMesh legacy = mesh.ToLegacy();
+    legacy.RemoveDuplicatedVertices();
+    legacy.RemoveDegenerateTriangles();
+    legacy.RemoveDuplicatedTriangles();
+    legacy.RemoveUnreferencedVertices();
+    EXPECT_EQ(legacy.vertices_.size(), 4u);
+    EXPECT_EQ(legacy.triangles_.size(), 2u);
+
+    t::geometry::TriangleMesh empty(device);
+    empty.CleanMesh();
+    EXPECT_TRUE(empty.IsEmpty());
+}
+
+TEST_P(TriangleMeshPermuteDevices, ComputeUVAtlas) {
+    core::Device device = GetParam();
+    t::geometry::TriangleMesh mesh = t::geometry::TriangleMesh::FromLegacy(
+            *geometry::TriangleMesh::CreateBox(), core::Float32, core::Int64,
+            device);
+
+    // One chart per face of the box.
+    EXPECT_EQ(mesh.ComputeUVAtlas(64, 2), 6);
+    const core::Tensor uvs = mesh.GetTriangleAttr("texture_uvs");
+    EXPECT_EQ(uvs.GetShape(), core::SizeVector({12, 3, 2}));
+    EXPECT_EQ(uvs.GetDevice(), device);
+    EXPECT_GT(uvs.Min({0, 1, 2}).Item<float>(), 0);
+    EXPECT_LT(uvs.Max({0, 1, 2}).Item<float>(), 1);
+}
+
+TEST_P(TriangleMeshPermuteDevices, BakeVertexAttrTextures) {
+    core::Device device = GetParam();
+    t::geometry::TriangleMesh mesh = t::geometry::TriangleMesh::FromLegacy(
+            *geometry::TriangleMesh::CreateBox(), core::Float32, core::Int64,
+            device);
+    EXPECT_ANY_THROW(mesh.BakeVertexAttrTextures(64));
+
+    const int64_t size = 64;
+    mesh.ComputeUVAtlas(size, 2);
+    mesh.SetVertexColors(mesh.GetVertexPositions().Clone());
+    std::unordered_map<std::string, core::Tensor> textures =
+            mesh.BakeVertexAttrTextures(size, {"colors"}, 0, -1);
+    ASSERT_EQ(textures.count("colors"), 1);
+    const core::Tensor texture = textures["colors"].To(core::Device("CPU:0"));
+    EXPECT_EQ(texture.GetShape(), core::SizeVector({size, size, 3}));
+
+    // The corner texel is in the gutter.
+    EXPECT_TRUE(texture[0][0].AllClose(core::Tensor::Full({3}, -1,
+                                                          core::Float32)));
+    // The texel at the centroid of each triangle has the colors of the
+    // centroid, up to the texel size.
+    const core::Tensor uvs =
+            mesh.GetTriangleAttr("texture_uvs").To(core::Device("CPU:0"));
+    const core::Tensor positions =
+            mesh.GetVertexPositions().To(core::Device("CPU:0"));
+    const core::Tensor triangles =
+            mesh.GetTriangleIndices().To(core::Device("CPU:0"));
+    for (int64_t t = 0; t < triangles.GetLength(); ++t) {
+        const core::Tensor uv = uvs[t].Mean({0});
+        const int64_t x =
+                int64_t(std::round(uv[0].Item<float>() * size - 0.5));
+        const int64_t y =
+                int64_t(std::round((1 - uv[1].Item<float>()) * size - 0.5));
+        const core::Tensor centroid =
+                positions.IndexGet({triangles[t]}).Mean({0});
+        EXPECT_TRUE(texture[y][x].AllClose(centroid, 0, 0.1));
+    }
+}
+
+TEST_P(TriangleMeshPermuteDevices, SamplePointsUniformly) {
+    core::Device device = GetParam();
+    t::geometry::TriangleMesh mesh(
+            core::Tensor::Init<float>(
+                    {{0, 0, 0}, {1, 0, 0}, {1, 1, 0}, {0, 1, 0}}, device),
+            core::Tensor::Init<int64_t>({{0, 1, 2}, {0, 2, 3}}, device));
+    mesh.SetVertexColors(mesh.GetVertexPositions().Clone());
+    EXPECT_ANY_THROW(mesh.SamplePointsUniformly(0));
+
+    t::geometry::PointCloud pcd =
+            mesh.SamplePointsUniformly(100, /*use_triangle_normal=*/true, 0);
+    EXPECT_EQ(pcd.GetDevice(), device);
+    const core::Tensor points = pcd.GetPointPositions();
+    EXPECT_EQ(points.GetShape(), core::SizeVector({100, 3}));
+    EXPECT_EQ(points.GetDtype(), core::Float32);
+    EXPECT_TRUE(pcd.GetPointColors().AllClose(points));
+    EXPECT_TRUE(pcd.GetPointNormals().AllClose(
+            core::Tensor::Init<float>({0, 0, 1}, device)
+                    .Reshape({1, 3})
+                    .Expand({100, 3})));
+    EXPECT_TRUE(points.Ge(0).All());
+    EXPECT_TRUE(points.Le(1).All());
+
+    // The triangles have the same area and get half of the samples each.
+    const core::Tensor x = points.Slice(1, 0, 1);
+    const core::Tensor y = points.Slice(1, 1, 2);
+    EXPECT_EQ(x.Ge(y).To(core::Int64).Sum({0, 1}).Item<int64_t>(), 50);
+
+    // The samples only depend on the seed.
+    EXPECT_TRUE(mesh.SamplePointsUniformly(100, false, 0)
+                        .GetPointPositions()
+                        .AllClose(points));
+    EXPECT_FALSE(mesh.SamplePointsUniformly(100, false, 1)
+                         .GetPointPositions()
+                         .AllClose(points));
+}
+
+TEST_P(TriangleMeshPermuteDevices, SamplePointsPoissonDisk) {
+    core::Device device = GetParam();
+    t::geometry::TriangleMesh mesh(
+            core::Tensor::Init<double>(
+                    {{0, 0, 0}, {1, 0, 0}, {1, 1, 0}, {0, 1, 0}}, device),
+            core::Tensor::Init<int64_t>({{0, 1, 2}, {0, 2, 3}}, device));
+    EXPECT_ANY_THROW(mesh.SamplePointsPoissonDisk(100, 0.5));
+
+    auto MinDistance = [](const core::Tensor &points) {
+        const core::Tensor p = points.To(core::Device("CPU:0"));
+        const int64_t n = p.GetLength();
+        const core::Tensor diff = p.Reshape({n, 1, 3}) - p.Reshape({1, n, 3});
+        const core::Tensor d2 =
+                (diff * diff).Sum({2}) +
+                core::Tensor::Eye(n, core::Float64, p.GetDevice());
+        return std::sqrt(d2.Min({0, 1}).Item<double>());
+    };
+    t::geometry::PointCloud pcd =
+            mesh.SamplePointsPoissonDisk(100, 5, false, 0);
+    EXPECT_EQ(pcd.GetDevice(), device);
+    const core::Tensor points = pcd.GetPointPositions();
+    EXPECT_EQ(points.GetShape(), core::SizeVector({100, 3}));
+    EXPECT_TRUE(points.Ge(0).All());
+    EXPECT_TRUE(points.Le(1).All());
+
+    // Sample elimination spreads the points further apart than uniform
+    // sampling.
+    EXPECT_GT(MinDistance(points),
+              2 * MinDistance(mesh.SamplePointsUniformly(100, false, 0)
+                                      .GetPointPositions()));
+}
+
 }  // namespace tests
 }  // namespace open3d
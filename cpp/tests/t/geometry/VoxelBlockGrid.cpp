@@ -26,6 +26,10 @@
 
 #include "open3d/t/geometry/VoxelBlockGrid.h"
 
+#include <future>
+#include <map>
+#include <tuple>
+
 #include "core/CoreTest.h"
 #include "open3d/core/EigenConverter.h"
 #include "open3d/core/Tensor.h"
@@ -303,6 +307,94 @@ TEST_P(VoxelBlockGridPermuteDevices, IO) {
     }
 }
 
+TEST_P(VoxelBlockGridPermuteDevices, EvictRestore) {
+    core::Device device = GetParam();
+    std::vector<core::HashBackendType> backends = EnumerateBackends(device);
+    std::vector<core::Tensor> extrinsics = GetExtrinsicTensors();
+
+    std::string file_name = "tmp_evicted.npz";
+    for (auto backend : backends) {
+        auto vbg = Integrate(backend, core::Float32, device, 8);
+        int64_t num_blocks = vbg.GetHashMap().Size();
+        int64_t num_points =
+                vbg.ExtractPointCloud().GetPointPositions().GetLength();
+        EXPECT_EQ(vbg.GetEvictedBlockCount(), 0);
+
+        // A huge radius keeps everything resident.
+        EXPECT_EQ(vbg.EvictBlocks(extrinsics[0], 1000.0f), 0);
+
+        // A zero radius evicts every block.
+        EXPECT_EQ(vbg.EvictBlocks(extrinsics[0], 0.0f), num_blocks);
+        EXPECT_EQ(vbg.GetHashMap().Size(), 0);
+        EXPECT_EQ(vbg.GetEvictedBlockCount(), num_blocks);
+
+        // Round trip the host store through the disk.
+        vbg.SaveEvictedBlocks(file_name);
+        EXPECT_EQ(vbg.GetEvictedBlockCount(), 0);
+        vbg.LoadEvictedBlocks(file_name);
+        EXPECT_EQ(vbg.GetEvictedBlockCount(), num_blocks);
+        utility::filesystem::RemoveFile(file_name);
+
+        EXPECT_EQ(vbg.RestoreBlocks(), num_blocks);
+        EXPECT_EQ(vbg.GetHashMap().Size(), num_blocks);
+        EXPECT_EQ(vbg.GetEvictedBlockCount(), 0);
+        EXPECT_EQ(vbg.ExtractPointCloud().GetPointPositions().GetLength(),
+                  num_points);
+    }
+}
+
+TEST_P(VoxelBlockGridPermuteDevices, SnapshotConcurrentExtraction) {
+    core::Device device = GetParam();
+    core::Tensor intrinsic = GetIntrinsicTensor();
+    std::vector<core::Tensor> extrinsics = GetExtrinsicTensors();
+    data::SampleRedwoodRGBDImages redwood_data;
+
+    for (auto backend : EnumerateBackends(device, /*include_slab=*/false)) {
+        auto vbg = VoxelBlockGrid({"tsdf", "weight", "color"},
+                                  {core::Float32, core::Float32, core::Float32},
+                                  {{1}, {1}, {3}}, 3.0 / 512, 8, 10000, device,
+                                  backend);
+        auto integrate = [&](size_t i) {
+            Image depth =
+                    t::io::CreateImageFromFile(redwood_data.GetDepthPaths()[i])
+                            ->To(device);
+            Image color =
+                    t::io::CreateImageFromFile(redwood_data.GetColorPaths()[i])
+                            ->To(device);
+            core::Tensor block_coords = vbg.GetUniqueBlockCoordinates(
+                    depth, intrinsic, extrinsics[i], 1000.0, 3.0, 4.0);
+            vbg.Integrate(block_coords, depth, color, intrinsic,
+                          extrinsics[i], 1000.0, 3.0, 4.0);
+        };
+        EXPECT_EQ(vbg.GetEpoch(), 0);
+        integrate(0);
+        integrate(1);
+        EXPECT_EQ(vbg.GetEpoch(), 2);
+
+        VoxelBlockGrid snapshot = vbg.Snapshot();
+        EXPECT_EQ(snapshot.GetEpoch(), 2);
+        EXPECT_EQ(snapshot.GetHashMap().Size(), vbg.GetHashMap().Size());
+        const int64_t num_vertices =
+                vbg.ExtractTriangleMesh().GetVertexPositions().GetLength();
+
+        // The background extraction sees the frames integrated before the
+        // call, but not the ones integrated while it runs.
+        std::future<TriangleMesh> mesh_future = vbg.ExtractTriangleMeshAsync();
+        for (size_t i = 2; i < extrinsics.size(); ++i) {
+            integrate(i);
+        }
+        EXPECT_EQ(mesh_future.get().GetVertexPositions().GetLength(),
+                  num_vertices);
+        EXPECT_EQ(snapshot.ExtractTriangleMesh()
+                          .GetVertexPositions()
+                          .GetLength(),
+                  num_vertices);
+        EXPECT_EQ(snapshot.GetEpoch(), 2);
+        EXPECT_EQ(vbg.GetEpoch(), int64_t(extrinsics.size()));
+        EXPECT_GE(vbg.GetHashMap().Size(), snapshot.GetHashMap().Size());
+    }
+}
+
 TEST_P(VoxelBlockGridPermuteDevices, RayCasting) {
     core::Device device = GetParam();
     std::vector<core::HashBackendType> backends =
@@ -363,6 +455,474 @@ TEST_P(VoxelBlockGridPermuteDevices, RayCasting) {
     }
 }
 
+TEST_P(VoxelBlockGridPermuteDevices, FrustumRayCasting) {
+    core::Device device = GetParam();
+
+    const int rows = 120, cols = 160;
+    const float depth_scale = 1000.0, depth_max = 3.0;
+    core::Tensor intrinsic = core::Tensor::Init<double>(
+            {{100, 0, cols / 2.0}, {0, 100, rows / 2.0}, {0, 0, 1}});
+    core::Tensor extrinsic =
+            core::Tensor::Eye(4, core::Float64, core::Device("CPU:0"));
+
+    // A plane in front of the camera.
+    Image depth = Image(core::Tensor::Full({rows, cols, 1}, 1500, core::UInt16))
+                          .To(device);
+    Image color = Image(core::Tensor::Full({rows, cols, 3}, 128, core::UInt8))
+                          .To(device);
+
+    auto vbg = VoxelBlockGrid({"tsdf", "weight", "color"},
+                              {core::Float32, core::Float32, core::Float32},
+                              {{1}, {1}, {3}}, 0.01, 8, 1000, device);
+    core::Tensor block_coords = vbg.GetUniqueBlockCoordinates(
+            depth, intrinsic, extrinsic, depth_scale, depth_max);
+    vbg.Integrate(block_coords, depth, color, intrinsic, extrinsic,
+                  depth_scale, depth_max);
+    core::HashMap hashmap = vbg.GetHashMap();
+    core::Tensor active_keys = hashmap.GetKeyTensor().IndexGet(
+            {hashmap.GetActiveIndices().To(core::Int64)});
+
+    // All the blocks are in front of the camera, and none behind it.
+    EXPECT_EQ(vbg.GetFrustumBlockCoordinates(intrinsic, extrinsic, cols, rows,
+                                             0.1, depth_max)
+                      .GetLength(),
+              hashmap.Size());
+    core::Tensor extrinsic_back = core::Tensor::Init<double>(
+            {{-1, 0, 0, 0}, {0, 1, 0, 0}, {0, 0, -1, 0}, {0, 0, 0, 1}});
+    EXPECT_EQ(vbg.GetFrustumBlockCoordinates(intrinsic, extrinsic_back, cols,
+                                             rows, 0.1, depth_max)
+                      .GetLength(),
+              0);
+
+    // Ray casting the visible blocks matches ray casting all the blocks,
+    // also when the cached visible set is reused after a small motion.
+    vbg.SetFrustumCacheTolerance(0.1, 0.1);
+    core::Tensor extrinsic_moved = extrinsic.Clone();
+    extrinsic_moved[0][3] = 0.05;
+    for (const core::Tensor &T : {extrinsic, extrinsic_moved, extrinsic_back}) {
+        TensorMap rendering = vbg.RayCast(intrinsic, T, cols, rows,
+                                          {"depth", "color"}, depth_scale, 0.1,
+                                          depth_max, 0.5f);
+        TensorMap rendering_all = vbg.RayCast(
+                active_keys, intrinsic, T, cols, rows, {"depth", "color"},
+                depth_scale, 0.1, depth_max, 0.5f);
+        EXPECT_TRUE(rendering["depth"].AllClose(rendering_all["depth"]));
+        EXPECT_TRUE(rendering["color"].AllClose(rendering_all["color"]));
+        const bool visible = !T.AllClose(extrinsic_back);
+        EXPECT_EQ(rendering["depth"].Gt(0).Any(), visible);
+    }
+}
+
+TEST_P(VoxelBlockGridPermuteDevices, RayCastBufferReuse) {
+    core::Device device = GetParam();
+
+    const int rows = 60, cols = 80;
+    const float depth_scale = 1000.0, depth_max = 3.0;
+    core::Tensor intrinsic = core::Tensor::Init<double>(
+            {{50, 0, cols / 2.0}, {0, 50, rows / 2.0}, {0, 0, 1}});
+    core::Tensor extrinsic =
+            core::Tensor::Eye(4, core::Float64, core::Device("CPU:0"));
+    core::Tensor extrinsic_back = core::Tensor::Init<double>(
+            {{-1, 0, 0, 0}, {0, 1, 0, 0}, {0, 0, -1, 0}, {0, 0, 0, 1}});
+
+    Image depth = Image(core::Tensor::Full({rows, cols, 1}, 1500, core::UInt16))
+                          .To(device);
+    auto vbg = VoxelBlockGrid({"tsdf", "weight"},
+                              {core::Float32, core::Float32}, {{1}, {1}},
+                              0.01, 8, 1000, device);
+    core::Tensor block_coords = vbg.GetUniqueBlockCoordinates(
+            depth, intrinsic, extrinsic, depth_scale, depth_max);
+    vbg.Integrate(block_coords, depth, intrinsic, extrinsic, depth_scale,
+                  depth_max);
+
+    auto raycast = [&](const core::Tensor &T) {
+        return vbg.RayCast(block_coords, intrinsic, T, cols, rows, {"depth"},
+                           depth_scale, 0.1, depth_max, 0.5f)["depth"];
+    };
+
+    // A released rendering buffer is reused by the next ray casting.
+    void *released_ptr = raycast(extrinsic).GetDataPtr();
+    core::Tensor front = raycast(extrinsic);
+    EXPECT_EQ(front.GetDataPtr(), released_ptr);
+
+    // A held rendering is neither reused nor overwritten.
+    core::Tensor front_ref = front.Clone();
+    core::Tensor back = raycast(extrinsic_back);
+    EXPECT_NE(back.GetDataPtr(), front.GetDataPtr());
+    EXPECT_TRUE(front.AllClose(front_ref));
+    EXPECT_TRUE(front.Gt(0).Any());
+    EXPECT_FALSE(back.Gt(0).Any());
+}
+
+TEST_P(VoxelBlockGridPermuteDevices, QuantizedIntegrate) {
+    core::Device device = GetParam();
+
+    const int rows = 120, cols = 160;
+    const float depth_scale = 1.0, depth_max = 3.0;
+    core::Tensor intrinsic = core::Tensor::Init<double>(
+            {{100, 0, cols / 2.0}, {0, 100, rows / 2.0}, {0, 0, 1}});
+    core::Tensor extrinsic =
+            core::Tensor::Eye(4, core::Float64, core::Device("CPU:0"));
+
+    // A slanted plane with a color gradient in front of the camera. The slope
+    // avoids TSDF values that are exactly zero at the voxel centers.
+    core::Tensor depth_data =
+            core::Tensor::Empty({rows, cols, 1}, core::Float32);
+    core::Tensor color_data =
+            core::Tensor::Empty({rows, cols, 3}, core::Float32);
+    float *depth_ptr = depth_data.GetDataPtr<float>();
+    float *color_ptr = color_data.GetDataPtr<float>();
+    for (int v = 0; v < rows; ++v) {
+        for (int u = 0; u < cols; ++u) {
+            depth_ptr[v * cols + u] = 1.2f + 0.00313f * u + 0.00171f * v;
+            for (int c = 0; c < 3; ++c) {
+                color_ptr[(v * cols + u) * 3 + c] = (u + 40 * c) / 255.0f;
+            }
+        }
+    }
+    Image depth = Image(depth_data).To(device);
+    Image color = Image(color_data).To(device);
+
+    auto integrate = [&](const std::vector<core::Dtype> &dtypes) {
+        auto vbg = VoxelBlockGrid({"tsdf", "weight", "color"}, dtypes,
+                                  {{1}, {1}, {3}}, 0.01, 8, 1000, device);
+        core::Tensor block_coords = vbg.GetUniqueBlockCoordinates(
+                depth, intrinsic, extrinsic, depth_scale, depth_max);
+        for (int i = 0; i < 3; ++i) {
+            vbg.Integrate(block_coords, depth, color, intrinsic, extrinsic,
+                          depth_scale, depth_max);
+        }
+        return vbg;
+    };
+    VoxelBlockGrid vbg_ref =
+            integrate({core::Float32, core::Float32, core::Float32});
+
+    for (auto &dtypes : std::vector<std::vector<core::Dtype>>{
+                 {core::Float32, core::UInt16, core::UInt8},
+                 {core::Int16, core::UInt16, core::UInt8}}) {
+        VoxelBlockGrid vbg = integrate(dtypes);
+        EXPECT_EQ(vbg.GetHashMap().Size(), vbg_ref.GetHashMap().Size());
+
+        // The quantized TSDF is accurate well within a voxel, and the
+        // quantized color is accurate within a rounding step. Few rays may
+        // step differently around the zero crossings.
+        core::Tensor block_coords = vbg.GetUniqueBlockCoordinates(
+                depth, intrinsic, extrinsic, depth_scale, depth_max);
+        TensorMap rendering = vbg.RayCast(
+                block_coords, intrinsic, extrinsic, cols, rows,
+                {"depth", "color"}, depth_scale, 0.1, depth_max, 0.5f);
+        TensorMap rendering_ref = vbg_ref.RayCast(
+                block_coords, intrinsic, extrinsic, cols, rows,
+                {"depth", "color"}, depth_scale, 0.1, depth_max, 0.5f);
+        core::Tensor valid = rendering_ref["depth"].Gt(0);
+        EXPECT_TRUE(rendering["depth"].Gt(0).AllEqual(valid));
+
+        const int64_t num_valid =
+                valid.To(core::Int64).Sum({0, 1, 2}).Item<int64_t>();
+        const int64_t num_close =
+                (rendering["depth"] - rendering_ref["depth"])
+                        .Abs()
+                        .Lt(0.1 * 0.01 * depth_scale)
+                        .LogicalAnd(valid)
+                        .To(core::Int64)
+                        .Sum({0, 1, 2})
+                        .Item<int64_t>();
+        EXPECT_GT(num_valid, 0);
+        EXPECT_GT(num_close, 0.99 * num_valid);
+
+        core::Tensor valid_color = valid.Reshape({rows, cols});
+        const float color_error =
+                (rendering["color"] - rendering_ref["color"])
+                        .IndexGet({valid_color})
+                        .Abs()
+                        .Mean({0, 1})
+                        .Item<float>();
+        EXPECT_LT(color_error, 1.0 / 255.0);
+
+        PointCloud pcd = vbg.ExtractPointCloud(0.5f);
+        PointCloud pcd_ref = vbg_ref.ExtractPointCloud(0.5f);
+        EXPECT_NEAR(pcd.GetPointPositions().GetLength(),
+                    pcd_ref.GetPointPositions().GetLength(),
+                    0.01 * pcd_ref.GetPointPositions().GetLength());
+    }
+}
+
+TEST_P(VoxelBlockGridPermuteDevices, OccupancyIntegrate) {
+    core::Device device = GetParam();
+
+    const int rows = 120, cols = 160;
+    const float depth_scale = 1.0, depth_max = 3.0;
+    core::Tensor intrinsic = core::Tensor::Init<double>(
+            {{100, 0, cols / 2.0}, {0, 100, rows / 2.0}, {0, 0, 1}});
+    core::Tensor extrinsic =
+            core::Tensor::Eye(4, core::Float64, core::Device("CPU:0"));
+    Image depth = Image(core::Tensor::Full({rows, cols, 1}, 1.5f,
+                                           core::Float32, device));
+
+    auto vbg = VoxelBlockGrid({"tsdf", "weight", "log_odds"},
+                              {core::Float32, core::Float32, core::Float32},
+                              {{1}, {1}, {1}}, 0.05, 8, 1000, device);
+
+    // Rays reach the camera center, while the surface band does not.
+    core::Tensor surface_block_coords = vbg.GetUniqueBlockCoordinates(
+            depth, intrinsic, extrinsic, depth_scale, depth_max, 2.0);
+    core::Tensor ray_block_coords = vbg.GetUniqueBlockCoordinatesAlongRays(
+            depth, intrinsic, extrinsic, depth_scale, depth_max, 2.0);
+    EXPECT_GT(ray_block_coords.GetLength(), surface_block_coords.GetLength());
+
+    for (int i = 0; i < 3; ++i) {
+        vbg.Integrate(ray_block_coords, depth, intrinsic, extrinsic,
+                      depth_scale, depth_max, 2.0);
+    }
+
+    // On the optical axis: free in front of the plane, occupied on it, and
+    // unknown behind it.
+    core::Tensor points = core::Tensor::Init<float>(
+            {{0, 0, 0.5}, {0, 0, 1.0}, {0, 0, 1.5}, {0, 0, 2.5}}, device);
+    core::Tensor log_odds = vbg.QueryOccupancy(points).To(core::Device());
+    EXPECT_FLOAT_EQ(log_odds[0].Item<float>(), 3 * -0.4f);
+    EXPECT_FLOAT_EQ(log_odds[1].Item<float>(), 3 * -0.4f);
+    EXPECT_FLOAT_EQ(log_odds[2].Item<float>(), 3 * 0.85f);
+    EXPECT_FLOAT_EQ(log_odds[3].Item<float>(), 0.0f);
+
+    // The clamping range bounds repeated updates.
+    vbg.SetOccupancyParameters(0.85f, -0.4f, -1.0f, 3.0f);
+    vbg.Integrate(ray_block_coords, depth, intrinsic, extrinsic, depth_scale,
+                  depth_max, 2.0);
+    log_odds = vbg.QueryOccupancy(points).To(core::Device());
+    EXPECT_FLOAT_EQ(log_odds[0].Item<float>(), -1.0f);
+    EXPECT_FLOAT_EQ(log_odds[2].Item<float>(), 3.0f);
+
+    // Occupied voxels lie on the plane.
+    PointCloud occupied = vbg.ExtractOccupiedVoxels();
+    EXPECT_GT(occupied.GetPointPositions().GetLength(), 0);
+    core::Tensor z = occupied.GetPointPositions().Slice(1, 2, 3);
+    EXPECT_TRUE(z.Sub(1.5f).Abs().Le(0.05f + 1e-4f).All());
+    EXPECT_TRUE(occupied.GetPointAttr("log_odds").Gt(0).All());
+
+    // The TSDF is integrated in the same pass.
+    EXPECT_GT(vbg.ExtractPointCloud(0.0f).GetPointPositions().GetLength(), 0);
+
+    EXPECT_ANY_THROW(vbg.SetOccupancyParameters(-0.85f, -0.4f));
+}
+
+TEST_P(VoxelBlockGridPermuteDevices, LabelIntegrate) {
+    core::Device device = GetParam();
+
+    const int rows = 120, cols = 160;
+    const float depth_scale = 1.0, depth_max = 3.0;
+    core::Tensor intrinsic = core::Tensor::Init<double>(
+            {{100, 0, cols / 2.0}, {0, 100, rows / 2.0}, {0, 0, 1}});
+    core::Tensor extrinsic =
+            core::Tensor::Eye(4, core::Float64, core::Device("CPU:0"));
+    Image depth = Image(core::Tensor::Full({rows, cols, 1}, 1.5f,
+                                           core::Float32, device));
+
+    // Points on the left and right halves of the plane, and in free space.
+    core::Tensor points = core::Tensor::Init<float>(
+            {{-0.6, 0, 1.5}, {0.6, 0, 1.5}, {0, 0, 0.5}}, device);
+
+    // Label ids: 1 on the left half, 2 on the right half.
+    core::Tensor label_ids = core::Tensor::Ones({rows, cols, 1}, core::UInt16);
+    label_ids.Slice(1, cols / 2, cols).Fill(2);
+    Image label_image = Image(label_ids).To(device);
+
+    auto vbg_count = VoxelBlockGrid(
+            {"tsdf", "weight", "label_count"},
+            {core::Float32, core::Float32, core::UInt16}, {{1}, {1}, {4}},
+            0.05, 8, 1000, device);
+    core::Tensor block_coords = vbg_count.GetUniqueBlockCoordinates(
+            depth, intrinsic, extrinsic, depth_scale, depth_max, 2.0);
+    vbg_count.Integrate(block_coords, depth, Image(), label_image, intrinsic,
+                        intrinsic, extrinsic, depth_scale, depth_max, 2.0);
+    core::Tensor labels = vbg_count.QueryLabels(points).To(core::Device());
+    EXPECT_EQ(labels[0].Item<int>(), 1);
+    EXPECT_EQ(labels[1].Item<int>(), 2);
+    EXPECT_EQ(labels[2].Item<int>(), -1);
+
+    // Probabilities: two frames disagree on the left half, their product
+    // favors class 1.
+    auto vbg_prob = VoxelBlockGrid(
+            {"tsdf", "weight", "label_probability"},
+            {core::Float32, core::Float32, core::Float32}, {{1}, {1}, {3}},
+            0.05, 8, 1000, device);
+    block_coords = vbg_prob.GetUniqueBlockCoordinates(
+            depth, intrinsic, extrinsic, depth_scale, depth_max, 2.0);
+    for (auto probs : std::vector<std::vector<float>>{{0.2, 0.7, 0.1},
+                                                      {0.6, 0.3, 0.1}}) {
+        core::Tensor prob_image =
+                core::Tensor(probs, {1, 1, 3}, core::Float32)
+                        .Expand({rows, cols, 3})
+                        .Contiguous();
+        vbg_prob.Integrate(block_coords, depth, Image(),
+                           Image(prob_image).To(device), intrinsic, intrinsic,
+                           extrinsic, depth_scale, depth_max, 2.0);
+    }
+    labels = vbg_prob.QueryLabels(points).To(core::Device());
+    EXPECT_EQ(labels[0].Item<int>(), 1);
+    EXPECT_EQ(labels[1].Item<int>(), 1);
+    EXPECT_EQ(labels[2].Item<int>(), -1);
+
+    // Label images must match the label attribute.
+    EXPECT_ANY_THROW(vbg_prob.Integrate(block_coords, depth, Image(),
+                                        label_image, intrinsic, intrinsic,
+                                        extrinsic, depth_scale, depth_max));
+}
+
+TEST_P(VoxelBlockGridPermuteDevices, ExtractDirtyTriangleMeshChunks) {
+    core::Device device = GetParam();
+
+    const int rows = 120, cols = 160;
+    const float depth_scale = 1.0, depth_max = 3.0;
+    core::Tensor intrinsic = core::Tensor::Init<double>(
+            {{100, 0, cols / 2.0}, {0, 100, rows / 2.0}, {0, 0, 1}});
+    core::Tensor extrinsic =
+            core::Tensor::Eye(4, core::Float64, core::Device("CPU:0"));
+
+    // A slanted plane, and a patch of it moved closer to the camera.
+    core::Tensor depth_data =
+            core::Tensor::Zeros({rows, cols, 1}, core::Float32);
+    core::Tensor patch_data =
+            core::Tensor::Zeros({rows, cols, 1}, core::Float32);
+    float *depth_ptr = depth_data.GetDataPtr<float>();
+    float *patch_ptr = patch_data.GetDataPtr<float>();
+    for (int v = 0; v < rows; ++v) {
+        for (int u = 0; u < cols; ++u) {
+            const float d = 1.2f + 0.00313f * u + 0.00171f * v;
+            depth_ptr[v * cols + u] = d;
+            if (u >= 40 && u < 80 && v >= 30 && v < 60) {
+                patch_ptr[v * cols + u] = d - 0.0137f;
+            }
+        }
+    }
+    Image depth = Image(depth_data).To(device);
+    Image patch = Image(patch_data).To(device);
+
+    auto vbg = VoxelBlockGrid({"tsdf", "weight"},
+                              {core::Float32, core::Float32}, {{1}, {1}},
+                              0.01, 8, 1000, device);
+
+    // Chunks by block coordinates, replaced when re-extracted.
+    std::map<std::tuple<int, int, int>, TriangleMesh> chunks;
+    auto update_chunks = [&]() {
+        core::Tensor block_coords;
+        std::vector<TriangleMesh> block_chunks;
+        std::tie(block_coords, block_chunks) =
+                vbg.ExtractDirtyTriangleMeshChunks(0.5f);
+        EXPECT_EQ(block_coords.GetLength(), int64_t(block_chunks.size()));
+        EXPECT_EQ(vbg.GetDirtyBlockCoordinates().GetLength(), 0);
+        block_coords = block_coords.To(core::Device("CPU:0"));
+        for (int64_t i = 0; i < block_coords.GetLength(); ++i) {
+            const int *key = block_coords[i].GetDataPtr<int>();
+            chunks[std::make_tuple(key[0], key[1], key[2])] = block_chunks[i];
+        }
+        return block_coords.GetLength();
+    };
+    auto count_triangles = [&]() {
+        int64_t n = 0;
+        for (auto &it : chunks) {
+            if (it.second.HasTriangleIndices()) {
+                n += it.second.GetTriangleIndices().GetLength();
+            }
+        }
+        return n;
+    };
+
+    core::Tensor block_coords = vbg.GetUniqueBlockCoordinates(
+            depth, intrinsic, extrinsic, depth_scale, depth_max);
+    vbg.Integrate(block_coords, depth, intrinsic, extrinsic, depth_scale,
+                  depth_max);
+    EXPECT_EQ(vbg.GetDirtyBlockCoordinates().GetLength(),
+              block_coords.GetLength());
+    EXPECT_EQ(update_chunks(), vbg.GetHashMap().Size());
+    const int64_t n_triangles =
+            vbg.ExtractTriangleMesh(0.5f).GetTriangleIndices().GetLength();
+    EXPECT_GT(n_triangles, 0);
+    EXPECT_EQ(count_triangles(), n_triangles);
+
+    // Only the changed blocks and their neighbors are re-meshed, and the
+    // chunks still add up to the full mesh.
+    core::Tensor patch_block_coords = vbg.GetUniqueBlockCoordinates(
+            patch, intrinsic, extrinsic, depth_scale, depth_max);
+    for (int i = 0; i < 3; ++i) {
+        vbg.Integrate(patch_block_coords, patch, intrinsic, extrinsic,
+                      depth_scale, depth_max);
+    }
+    const int64_t n_updated = update_chunks();
+    EXPECT_GT(n_updated, 0);
+    EXPECT_LT(n_updated, vbg.GetHashMap().Size());
+    EXPECT_EQ(count_triangles(),
+              vbg.ExtractTriangleMesh(0.5f).GetTriangleIndices().GetLength());
+    EXPECT_EQ(update_chunks(), 0);
+}
+
+TEST_P(VoxelBlockGridPermuteDevices, ExtractTriangleMeshWelding) {
+    core::Device device = GetParam();
+
+    const int rows = 120, cols = 160;
+    const float depth_scale = 1.0, depth_max = 3.0;
+    core::Tensor intrinsic = core::Tensor::Init<double>(
+            {{100, 0, cols / 2.0}, {0, 100, rows / 2.0}, {0, 0, 1}});
+    core::Tensor extrinsic =
+            core::Tensor::Eye(4, core::Float64, core::Device("CPU:0"));
+
+    // A slanted plane crossing many blocks.
+    core::Tensor depth_data =
+            core::Tensor::Zeros({rows, cols, 1}, core::Float32);
+    float *depth_ptr = depth_data.GetDataPtr<float>();
+    for (int v = 0; v < rows; ++v) {
+        for (int u = 0; u < cols; ++u) {
+            depth_ptr[v * cols + u] = 1.2f + 0.00313f * u + 0.00171f * v;
+        }
+    }
+    Image depth = Image(depth_data).To(device);
+
+    auto vbg = VoxelBlockGrid({"tsdf", "weight"},
+                              {core::Float32, core::Float32}, {{1}, {1}},
+                              0.01, 8, 1000, device);
+    core::Tensor block_coords = vbg.GetUniqueBlockCoordinates(
+            depth, intrinsic, extrinsic, depth_scale, depth_max);
+    vbg.Integrate(block_coords, depth, intrinsic, extrinsic, depth_scale,
+                  depth_max);
+
+    // The vertex estimate is ignored, and too small a value is harmless.
+    TriangleMesh mesh = vbg.ExtractTriangleMesh(0.5f);
+    TriangleMesh mesh_small = vbg.ExtractTriangleMesh(0.5f, 10);
+    const int64_t n_vertices = mesh.GetVertexPositions().GetLength();
+    const int64_t n_triangles = mesh.GetTriangleIndices().GetLength();
+    EXPECT_GT(n_triangles, 0);
+    EXPECT_EQ(mesh_small.GetVertexPositions().GetLength(), n_vertices);
+    EXPECT_EQ(mesh_small.GetTriangleIndices().GetLength(), n_triangles);
+    EXPECT_EQ(mesh.GetVertexNormals().GetLength(), n_vertices);
+
+    // Every vertex is referenced, and the triangles around a vertex share
+    // it, so that an edge is shared by at most two triangles, and the edges
+    // inside the surface by exactly two.
+    core::Tensor triangles =
+            mesh.GetTriangleIndices().To(core::Device("CPU:0")).To(core::Int64);
+    EXPECT_EQ(triangles.Min({0, 1}).Item<int64_t>(), 0);
+    EXPECT_EQ(triangles.Max({0, 1}).Item<int64_t>(), n_vertices - 1);
+    core::Tensor referenced = core::Tensor::Zeros({n_vertices}, core::Bool);
+    referenced.IndexSet({triangles.Reshape({-1})},
+                        core::Tensor::Ones({n_triangles * 3}, core::Bool));
+    EXPECT_TRUE(referenced.All());
+
+    const int64_t *tri_ptr = triangles.GetDataPtr<int64_t>();
+    std::map<std::tuple<int64_t, int64_t>, int> edge_counts;
+    for (int64_t i = 0; i < n_triangles; ++i) {
+        for (int j = 0; j < 3; ++j) {
+            int64_t a = tri_ptr[3 * i + j], b = tri_ptr[3 * i + (j + 1) % 3];
+            edge_counts[std::make_tuple(std::min(a, b), std::max(a, b))]++;
+        }
+    }
+    int64_t n_shared = 0;
+    for (auto &it : edge_counts) {
+        EXPECT_LE(it.second, 2);
+        n_shared += it.second == 2;
+    }
+    EXPECT_GT(n_shared, int64_t(edge_counts.size()) / 2);
+}
+
 TEST_P(VoxelBlockGridPermuteDevices, DISABLED_RayCastingVisualize) {
     core::Device device = GetParam();
     std::vector<core::HashBackendType> backends =
@@ -0,0 +1,179 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/t/geometry/VoxelGrid.h"
+
+#include "core/CoreTest.h"
+#include "open3d/core/TensorCheck.h"
+#include "tests/Tests.h"
+
+namespace open3d {
+namespace tests {
+
+class VoxelGridPermuteDevices : public PermuteDevices {};
+INSTANTIATE_TEST_SUITE_P(VoxelGrid,
+                         VoxelGridPermuteDevices,
+                         testing::ValuesIn(PermuteDevices::TestCases()));
+
+TEST_P(VoxelGridPermuteDevices, DefaultConstructor) {
+    core::Device device = GetParam();
+    t::geometry::VoxelGrid voxel_grid(0.5, core::Tensor(), device);
+
+    EXPECT_EQ(voxel_grid.GetGeometryType(),
+              t::geometry::Geometry::GeometryType::VoxelGrid);
+    EXPECT_EQ(voxel_grid.Dimension(), 3);
+    EXPECT_TRUE(voxel_grid.IsEmpty());
+    EXPECT_FALSE(voxel_grid.HasColors());
+    EXPECT_EQ(voxel_grid.GetDevice(), device);
+    EXPECT_EQ(voxel_grid.GetVoxelSize(), 0.5);
+    EXPECT_TRUE(voxel_grid.GetOrigin().AllClose(
+            core::Tensor::Zeros({3}, core::Float64)));
+    EXPECT_EQ(voxel_grid.ToString(),
+              "VoxelGrid on " + device.ToString() +
+                      " [0 voxels, voxel size 0.5].");
+
+    EXPECT_ANY_THROW(t::geometry::VoxelGrid(0.0));
+}
+
+TEST_P(VoxelGridPermuteDevices, AddPoints) {
+    core::Device device = GetParam();
+    t::geometry::VoxelGrid voxel_grid(1.0, core::Tensor(), device);
+
+    // Two points share voxel (0, 0, 0).
+    core::Tensor points = core::Tensor::Init<float>(
+            {{0.1, 0.2, 0.3}, {0.9, 0.9, 0.9}, {1.5, -0.5, 2.5}}, device);
+    core::Tensor colors = core::Tensor::Init<float>(
+            {{1, 0, 0}, {1, 0, 0}, {0, 0, 1}}, device);
+    voxel_grid.AddPoints(points, colors);
+    EXPECT_EQ(voxel_grid.GetNumVoxels(), 2);
+    EXPECT_TRUE(voxel_grid.HasColors());
+
+    core::Tensor indices = voxel_grid.GetVoxelIndices();
+    core::AssertTensorShape(indices, {2, 3});
+    core::AssertTensorDtype(indices, core::Int32);
+    core::Tensor centers = voxel_grid.GetVoxelCenters();
+    core::Tensor expected_centers =
+            (indices.To(core::Float32) + 0.5f).To(core::Float32);
+    EXPECT_TRUE(centers.AllClose(expected_centers));
+
+    // Existing voxels are not duplicated.
+    voxel_grid.AddPoints(points);
+    EXPECT_EQ(voxel_grid.GetNumVoxels(), 2);
+
+    core::Tensor queries = core::Tensor::Init<float>(
+            {{0.5, 0.5, 0.5}, {1.1, -0.1, 2.9}, {3.0, 3.0, 3.0}}, device);
+    core::Tensor mask = voxel_grid.CheckIfIncluded(queries);
+    EXPECT_TRUE(mask.To(core::Device("CPU:0"))
+                        .AllEqual(core::Tensor::Init<bool>({true, true,
+                                                            false})));
+
+    voxel_grid.Clear();
+    EXPECT_TRUE(voxel_grid.IsEmpty());
+    EXPECT_FALSE(voxel_grid.HasColors());
+}
+
+TEST_P(VoxelGridPermuteDevices, CreateFromPointCloud) {
+    core::Device device = GetParam();
+    t::geometry::PointCloud pcd(core::Tensor::Init<float>(
+            {{0, 0, 0}, {0.2, 0.2, 0.2}, {1, 0, 0}, {0, 0, 2}}, device));
+    pcd.SetPointColors(core::Tensor::Init<uint8_t>(
+            {{255, 0, 0}, {255, 0, 0}, {0, 255, 0}, {0, 0, 255}}, device));
+
+    t::geometry::VoxelGrid voxel_grid =
+            t::geometry::VoxelGrid::CreateFromPointCloud(pcd, 0.5);
+    EXPECT_EQ(voxel_grid.GetDevice(), device);
+    EXPECT_EQ(voxel_grid.GetNumVoxels(), 3);
+    EXPECT_TRUE(voxel_grid.GetOrigin().AllClose(
+            core::Tensor::Init<double>({-0.25, -0.25, -0.25})));
+    EXPECT_TRUE(voxel_grid.CheckIfIncluded(pcd.GetPointPositions())
+                        .To(core::Device("CPU:0"))
+                        .All());
+    EXPECT_TRUE(voxel_grid.GetVoxelColors().Max({1}).AllClose(
+            core::Tensor::Ones({3}, core::Float32, device)));
+
+    // Round trip through the legacy voxel grid.
+    open3d::geometry::VoxelGrid legacy = voxel_grid.ToLegacy();
+    EXPECT_EQ(legacy.voxels_.size(), 3);
+    EXPECT_EQ(legacy.voxel_size_, 0.5);
+    t::geometry::VoxelGrid from_legacy =
+            t::geometry::VoxelGrid::FromLegacy(legacy, device);
+    EXPECT_EQ(from_legacy.GetNumVoxels(), 3);
+    EXPECT_TRUE(from_legacy.CheckIfIncluded(pcd.GetPointPositions())
+                        .To(core::Device("CPU:0"))
+                        .All());
+}
+
+TEST_P(VoxelGridPermuteDevices, CreateFromTriangleMesh) {
+    core::Device device = GetParam();
+    t::geometry::TriangleMesh mesh(device);
+    mesh.SetVertexPositions(core::Tensor::Init<float>(
+            {{0, 0, 0}, {2, 0, 0}, {0, 2, 0}}, device));
+    mesh.SetTriangleIndices(core::Tensor::Init<int64_t>({{0, 1, 2}}, device));
+
+    t::geometry::VoxelGrid voxel_grid =
+            t::geometry::VoxelGrid::CreateFromTriangleMesh(mesh, 0.5);
+    // Points on the triangle are inside the grid, points away from it are not.
+    core::Tensor queries = core::Tensor::Init<float>(
+            {{0.1, 0.1, 0}, {1.9, 0.05, 0}, {0.05, 1.9, 0}, {1, 1, 0},
+             {1.5, 1.5, 0}, {0, 0, 1}},
+            device);
+    EXPECT_TRUE(voxel_grid.CheckIfIncluded(queries)
+                        .To(core::Device("CPU:0"))
+                        .AllEqual(core::Tensor::Init<bool>(
+                                {true, true, true, true, false, false})));
+}
+
+TEST_P(VoxelGridPermuteDevices, CarveDepthMap) {
+    core::Device device = GetParam();
+    // A column of voxels along the optical axis at z in [0, 4).
+    t::geometry::VoxelGrid voxel_grid(
+            1.0, core::Tensor::Init<double>({-0.5, -0.5, 0}), device);
+    voxel_grid.AddPoints(core::Tensor::Init<float>(
+            {{0, 0, 0.5}, {0, 0, 1.5}, {0, 0, 2.5}, {0, 0, 3.5}}, device));
+
+    // The observed surface is at a depth of 2 everywhere.
+    t::geometry::Image depth(core::Tensor::Full({11, 11, 1}, 2000,
+                                                core::UInt16, device));
+    core::Tensor intrinsics = core::Tensor::Init<double>(
+            {{5, 0, 5}, {0, 5, 5}, {0, 0, 1}});
+    core::Tensor extrinsics = core::Tensor::Eye(4, core::Float64,
+                                                core::Device("CPU:0"));
+    voxel_grid.CarveDepthMap(depth, intrinsics, extrinsics, 1000.0f, false);
+
+    // Voxels entirely in front of the surface are carved.
+    EXPECT_EQ(voxel_grid.GetNumVoxels(), 3);
+    EXPECT_TRUE(voxel_grid
+                        .CheckIfIncluded(core::Tensor::Init<float>(
+                                {{0, 0, 0.5}, {0, 0, 1.5}, {0, 0, 3.5}},
+                                device))
+                        .To(core::Device("CPU:0"))
+                        .AllEqual(core::Tensor::Init<bool>(
+                                {false, true, true})));
+}
+
+}  // namespace tests
+}  // namespace open3d
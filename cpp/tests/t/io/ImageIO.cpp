@@ -28,6 +28,9 @@
 
 #include <gtest/gtest.h>
 
+#include <string>
+#include <vector>
+
 #include "open3d/core/Device.h"
 #include "open3d/core/Dtype.h"
 #include "open3d/core/SizeVector.h"
@@ -117,6 +120,45 @@ TEST(ImageIO, ReadImage) {
     EXPECT_TRUE(img.AsTensor().AllClose(test_img.AsTensor()));
 }
 
+TEST(ImageIO, ReadImages) {
+    const std::string tmp_path = utility::filesystem::GetTempDirectoryPath();
+    std::vector<std::string> filenames;
+    std::vector<core::Tensor> tensors;
+    for (int i = 0; i < 10; ++i) {
+        core::Tensor t = core::Tensor::Full({150, 100, 1}, i * 20,
+                                            core::UInt16);
+        filenames.push_back(tmp_path + "/test_imageio_batch_" +
+                            std::to_string(i) + ".png");
+        EXPECT_TRUE(t::io::WriteImage(filenames.back(), t::geometry::Image(t)));
+        tensors.push_back(t);
+    }
+
+    std::vector<t::geometry::Image> images;
+    EXPECT_TRUE(t::io::ReadImages(filenames, images));
+    EXPECT_EQ(images.size(), filenames.size());
+    for (size_t i = 0; i < images.size(); ++i) {
+        EXPECT_TRUE(images[i].AsTensor().AllEqual(tensors[i]));
+    }
+
+    core::Tensor stack;
+    EXPECT_TRUE(t::io::ReadImages(filenames, stack));
+    EXPECT_EQ(stack.GetShape(), core::SizeVector({10, 150, 100, 1}));
+    EXPECT_EQ(stack.GetDtype(), core::UInt16);
+    for (size_t i = 0; i < tensors.size(); ++i) {
+        EXPECT_TRUE(stack[i].AllEqual(tensors[i]));
+    }
+
+    // Images of different shapes can not be stacked.
+    WriteTestImage(tmp_path, CreateTestImage());
+    filenames.push_back(tmp_path + "/test_imageio.png");
+    EXPECT_TRUE(t::io::ReadImages(filenames, images));
+    EXPECT_FALSE(t::io::ReadImages(filenames, stack));
+
+    // Missing files.
+    filenames.push_back(tmp_path + "/test_imageio_missing.png");
+    EXPECT_FALSE(t::io::ReadImages(filenames, images));
+}
+
 TEST(ImageIO, ReadImageFromPNG) {
     const std::string tmp_path = utility::filesystem::GetTempDirectoryPath();
     WriteTestImage(tmp_path, CreateTestImage());
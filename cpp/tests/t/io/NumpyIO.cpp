@@ -99,6 +99,36 @@ TEST_P(NumpyIOPermuteDevices, NpyWriteRead) {
     utility::filesystem::RemoveFile(file_name);
 }
 
+TEST(NumpyIO, NpyMemoryMap) {
+    const std::string file_name = "tensor_mmap.npy";
+
+    core::Tensor t = core::Tensor::Arange(0, 1000, 1, core::Float64)
+                             .Reshape({10, 100});
+    t.Save(file_name);
+    core::Tensor t_map = t::io::ReadNpy(file_name, /*memory_map=*/true);
+    EXPECT_EQ(t_map.GetDevice(), core::Device("CPU:0"));
+    EXPECT_TRUE(t_map.IsContiguous());
+    EXPECT_TRUE(t_map.AllEqual(t));
+
+    // Writes to the mapped tensor do not change the file.
+    t_map[0][0] = 42.0;
+    EXPECT_EQ(t_map[0][0].Item<double>(), 42.0);
+    EXPECT_TRUE(t::io::ReadNpy(file_name).AllEqual(t));
+
+    // Views keep the mapping alive.
+    core::Tensor row = t::io::ReadNpy(file_name, true)[9];
+    EXPECT_TRUE(row.AllEqual(t[9]));
+
+    // {0} tensor.
+    t = core::Tensor::Ones({0}, core::Int32);
+    t.Save(file_name);
+    t_map = t::io::ReadNpy(file_name, true);
+    EXPECT_EQ(t_map.GetShape(), core::SizeVector({0}));
+    EXPECT_EQ(t_map.GetDtype(), core::Int32);
+
+    utility::filesystem::RemoveFile(file_name);
+}
+
 TEST_P(NumpyIOPermuteDevices, NpzWriteRead) {
     const core::Device device = GetParam();
     const std::string file_name = "tensors.npz";
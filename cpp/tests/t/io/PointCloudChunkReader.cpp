@@ -0,0 +1,137 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/t/io/PointCloudChunkReader.h"
+
+#include <string>
+#include <vector>
+
+#include "open3d/core/TensorFunction.h"
+#include "open3d/t/io/PointCloudIO.h"
+#include "open3d/utility/FileSystem.h"
+#include "tests/Tests.h"
+
+namespace open3d {
+namespace tests {
+
+namespace {
+
+struct ChunkReaderArgs {
+    std::string filename;
+    bool write_ascii;
+    bool compressed;
+};
+
+const std::vector<ChunkReaderArgs> chunk_reader_args({
+        {"chunks.ply", false, false},
+        {"chunks_ascii.pcd", true, false},
+        {"chunks_binary.pcd", false, false},
+        {"chunks_compressed.pcd", false, true},
+        {"chunks.las", false, false},
+        {"chunks.xyz", true, false},
+        {"chunks.xyzn", true, false},
+        {"chunks.xyzrgb", true, false},
+        {"chunks.xyzi", true, false},
+        {"chunks.pts", true, false},
+});
+
+}  // namespace
+
+class PointCloudChunkReaderFormats
+    : public testing::TestWithParam<ChunkReaderArgs> {};
+INSTANTIATE_TEST_SUITE_P(PointCloudChunkReader,
+                         PointCloudChunkReaderFormats,
+                         testing::ValuesIn(chunk_reader_args));
+
+TEST_P(PointCloudChunkReaderFormats, ReadChunks) {
+    const ChunkReaderArgs args = GetParam();
+    const int64_t num_points = 1000;
+    t::geometry::PointCloud pcd(
+            core::Tensor::Arange(0, 3 * num_points, 1, core::Float64)
+                    .Reshape({num_points, 3}) *
+            0.25);
+    pcd.SetPointNormals(core::Tensor::Ones({num_points, 3}, core::Float64));
+    pcd.SetPointColors(core::Tensor::Full({num_points, 3}, 128, core::UInt8));
+    pcd.SetPointAttr("intensities",
+                     core::Tensor::Arange(0, num_points, 1, core::Float64)
+                             .Reshape({num_points, 1}));
+
+    const std::string filename =
+            utility::filesystem::GetTempDirectoryPath() + "/" + args.filename;
+    EXPECT_TRUE(t::io::WritePointCloud(
+            filename, pcd, {args.write_ascii, args.compressed, false}));
+    t::geometry::PointCloud expected;
+    EXPECT_TRUE(t::io::ReadPointCloud(filename, expected));
+
+    const int64_t chunk_size = 128;
+    std::unique_ptr<t::io::PointCloudChunkReader> reader =
+            t::io::PointCloudChunkReader::Create(filename, chunk_size);
+    EXPECT_TRUE(reader->IsOpened());
+    EXPECT_EQ(reader->GetChunkSize(), chunk_size);
+    const int64_t num_points_in_file = reader->GetNumPoints();
+    EXPECT_TRUE(num_points_in_file == num_points || num_points_in_file == -1);
+
+    std::unordered_map<std::string, std::vector<core::Tensor>> chunks;
+    int64_t num_chunks = 0;
+    while (!reader->IsEOF()) {
+        const t::geometry::PointCloud chunk = reader->NextChunk();
+        const int64_t length = chunk.GetPointPositions().GetLength();
+        if (length == 0) {
+            break;
+        }
+        EXPECT_LE(length, chunk_size);
+        EXPECT_EQ(chunk.GetPointAttr().size(),
+                  expected.GetPointAttr().size());
+        for (const auto &kv : chunk.GetPointAttr()) {
+            chunks[kv.first].push_back(kv.second);
+        }
+        ++num_chunks;
+    }
+    EXPECT_EQ(num_chunks, (num_points + chunk_size - 1) / chunk_size);
+    EXPECT_TRUE(reader->NextChunk().IsEmpty());
+
+    for (const auto &kv : expected.GetPointAttr()) {
+        SCOPED_TRACE(kv.first);
+        ASSERT_EQ(chunks.count(kv.first), 1u);
+        const core::Tensor concatenated = core::Concatenate(chunks[kv.first]);
+        EXPECT_EQ(concatenated.GetDtype(), kv.second.GetDtype());
+        EXPECT_TRUE(concatenated.AllEqual(kv.second));
+    }
+
+    reader->Close();
+    EXPECT_FALSE(reader->IsOpened());
+}
+
+TEST(PointCloudChunkReader, Unsupported) {
+    EXPECT_ANY_THROW(t::io::PointCloudChunkReader::Create("file.npz"));
+    EXPECT_ANY_THROW(t::io::PointCloudChunkReader::Create(
+            utility::filesystem::GetTempDirectoryPath() + "/missing.ply"));
+    EXPECT_ANY_THROW(t::io::PointCloudChunkReader::Create("file.pcd", 0));
+}
+
+}  // namespace tests
+}  // namespace open3d
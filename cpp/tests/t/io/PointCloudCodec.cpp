@@ -0,0 +1,204 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/t/io/PointCloudCodec.h"
+
+#include <vector>
+
+#include "core/CoreTest.h"
+#include "open3d/core/Tensor.h"
+#include "tests/Tests.h"
+
+namespace open3d {
+namespace tests {
+
+using t::geometry::PointCloud;
+using t::io::PointCloudCodecOption;
+
+class PointCloudCodecPermuteDevices : public PermuteDevices {};
+INSTANTIATE_TEST_SUITE_P(PointCloudCodec,
+                         PointCloudCodecPermuteDevices,
+                         testing::ValuesIn(PermuteDevices::TestCases()));
+
+// Points on distinct cells of a 1 cm grid with an offset below half of the
+// cell, so that the decoded points are the grid points.
+static PointCloud CreateGridPointCloud(int64_t n,
+                                       const core::Device& device) {
+    std::vector<float> positions(n * 3);
+    std::vector<uint8_t> colors(n * 3);
+    const float offsets[3] = {0.003f, -0.002f, 0.001f};
+    uint64_t state = 1;
+    for (int64_t i = 0; i < n; ++i) {
+        const int64_t cell[3] = {i % 37, i / 37 % 29, i / (37 * 29)};
+        for (int d = 0; d < 3; ++d) {
+            positions[3 * i + d] = 0.01f * cell[d] + offsets[d] * 0.01f;
+        }
+        // Noisy colors from a linear congruential generator.
+        state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+        for (int c = 0; c < 3; ++c) {
+            colors[3 * i + c] = static_cast<uint8_t>(state >> (40 + 8 * c));
+        }
+    }
+    PointCloud pcd(core::Tensor(positions, {n, 3}, core::Float32, device));
+    pcd.SetPointColors(core::Tensor(colors, {n, 3}, core::UInt8, device));
+    return pcd;
+}
+
+TEST_P(PointCloudCodecPermuteDevices, RoundTrip) {
+    core::Device device = GetParam();
+    const int64_t n = 37 * 29 * 10;
+    PointCloud pcd = CreateGridPointCloud(n, device);
+
+    PointCloudCodecOption option;
+    option.quantization = 0.01;
+    core::Tensor buffer = t::io::EncodePointCloud(pcd, option, 7);
+    EXPECT_EQ(buffer.GetDtype(), core::UInt8);
+    EXPECT_EQ(t::io::GetEncodedFrameIndex(buffer), 7);
+    // Smaller than the 15 bytes per point of the raw attributes, with the
+    // 3 bytes of random colors taking most of it.
+    EXPECT_LT(buffer.GetLength(), n * 4);
+
+    PointCloud decoded = t::io::DecodePointCloud(buffer, device);
+    EXPECT_EQ(decoded.GetDevice(), device);
+    ASSERT_EQ(decoded.GetPointPositions().GetLength(), n);
+    EXPECT_EQ(decoded.GetPointPositions().GetDtype(), core::Float32);
+    EXPECT_EQ(decoded.GetPointColors().GetDtype(), core::UInt8);
+
+    // The points are in octree order. Matching them by their grid cells,
+    // positions are within half of the quantization step, and 8-bit colors
+    // are lossless.
+    auto cell_ids = [](const PointCloud& p) {
+        core::Tensor cells = (p.GetPointPositions().To(
+                                      core::Device("CPU:0"), core::Float64) /
+                              0.01)
+                                     .Round()
+                                     .To(core::Int64);
+        return cells.Slice(1, 0, 1) + cells.Slice(1, 1, 2) * 37 +
+               cells.Slice(1, 2, 3) * (37 * 29);
+    };
+    core::Tensor order = cell_ids(decoded).Reshape({n}).ArgSort();
+    core::Tensor expected_order = cell_ids(pcd).Reshape({n}).ArgSort();
+    core::Tensor decoded_positions =
+            decoded.GetPointPositions().To(core::Device("CPU:0")).IndexGet(
+                    {order});
+    core::Tensor positions = pcd.GetPointPositions()
+                                     .To(core::Device("CPU:0"))
+                                     .IndexGet({expected_order});
+    EXPECT_LE((decoded_positions - positions).Abs().Max({0, 1}).Item<float>(),
+              0.005 + 1e-6);
+    EXPECT_TRUE(decoded.GetPointColors()
+                        .To(core::Device("CPU:0"))
+                        .IndexGet({order})
+                        .AllEqual(pcd.GetPointColors()
+                                          .To(core::Device("CPU:0"))
+                                          .IndexGet({expected_order})));
+
+    // Fewer color bits and no colors give smaller buffers.
+    option.color_bits = 4;
+    core::Tensor buffer_4bits = t::io::EncodePointCloud(pcd, option);
+    EXPECT_LT(buffer_4bits.GetLength(), buffer.GetLength());
+    core::Tensor decoded_colors =
+            t::io::DecodePointCloud(buffer_4bits).GetPointColors().IndexGet(
+                    {order});
+    core::Tensor color_error =
+            decoded_colors.To(core::Int32) -
+            pcd.GetPointColors().To(core::Device("CPU:0"), core::Int32)
+                    .IndexGet({expected_order});
+    EXPECT_LE(color_error.Abs().Max({0, 1}).Item<int>(), 9);
+    option.encode_colors = false;
+    PointCloud geometry_only =
+            t::io::DecodePointCloud(t::io::EncodePointCloud(pcd, option));
+    EXPECT_FALSE(geometry_only.HasPointColors());
+    EXPECT_EQ(geometry_only.GetPointPositions().GetLength(), n);
+}
+
+TEST_P(PointCloudCodecPermuteDevices, MergeAndFloatColors) {
+    core::Device device = GetParam();
+    PointCloud pcd(core::Tensor::Init<double>(
+            {{0, 0, 0}, {0.0004, 0, 0}, {1, 2, 3}}, device));
+    pcd.SetPointColors(core::Tensor::Init<float>(
+            {{0, 0, 0}, {1, 1, 1}, {0.2, 0.4, 0.6}}, device));
+
+    // Points of the same cell are merged and their colors averaged.
+    PointCloud decoded =
+            t::io::DecodePointCloud(t::io::EncodePointCloud(pcd));
+    ASSERT_EQ(decoded.GetPointPositions().GetLength(), 2);
+    EXPECT_EQ(decoded.GetPointPositions().GetDtype(), core::Float64);
+    EXPECT_TRUE(decoded.GetPointPositions().AllClose(
+            core::Tensor::Init<double>({{0, 0, 0}, {1, 2, 3}}), 0, 1e-9));
+    EXPECT_TRUE(decoded.GetPointColors().AllClose(
+            core::Tensor::Init<float>({{0.5, 0.5, 0.5}, {0.2, 0.4, 0.6}}), 0,
+            0.5 / 255 + 1e-6));
+
+    // Empty point clouds.
+    PointCloud empty(core::Tensor::Empty({0, 3}, core::Float32, device));
+    PointCloud decoded_empty =
+            t::io::DecodePointCloud(t::io::EncodePointCloud(empty));
+    EXPECT_EQ(decoded_empty.GetPointPositions().GetShape(),
+              core::SizeVector({0, 3}));
+}
+
+TEST(PointCloudCodec, Stream) {
+    PointCloud pcd = CreateGridPointCloud(1000, core::Device("CPU:0"));
+    t::io::PointCloudStreamEncoder encoder;
+    t::io::PointCloudStreamDecoder decoder;
+    std::vector<core::Tensor> frames;
+    for (int i = 0; i < 5; ++i) {
+        frames.push_back(encoder.Encode(pcd));
+    }
+    EXPECT_EQ(encoder.GetNumFrames(), 5);
+
+    EXPECT_EQ(decoder.Decode(frames[0]).GetPointPositions().GetLength(),
+              1000);
+    // Frames 1 and 2 are lost, and frame 3 arrives after frame 4.
+    EXPECT_EQ(decoder.Decode(frames[4]).GetPointPositions().GetLength(),
+              1000);
+    EXPECT_FALSE(decoder.Decode(frames[3]).HasPointPositions());
+    EXPECT_EQ(decoder.GetLastFrameIndex(), 4);
+    EXPECT_EQ(decoder.GetNumDroppedFrames(), 3);
+}
+
+TEST(PointCloudCodec, InvalidArguments) {
+    PointCloud pcd = CreateGridPointCloud(100, core::Device("CPU:0"));
+    PointCloudCodecOption option;
+    option.quantization = 0;
+    EXPECT_ANY_THROW(t::io::EncodePointCloud(pcd, option));
+    option.quantization = 1e-9;
+    EXPECT_ANY_THROW(t::io::EncodePointCloud(pcd, option));
+    option.quantization = 0.01;
+    option.color_bits = 9;
+    EXPECT_ANY_THROW(t::io::EncodePointCloud(pcd, option));
+
+    core::Tensor buffer = t::io::EncodePointCloud(pcd);
+    EXPECT_ANY_THROW(t::io::DecodePointCloud(buffer.Slice(0, 0, 10)));
+    EXPECT_ANY_THROW(t::io::DecodePointCloud(buffer.To(core::Int32)));
+    core::Tensor truncated = buffer.Slice(0, 0, buffer.GetLength() / 2);
+    EXPECT_ANY_THROW(t::io::DecodePointCloud(truncated));
+}
+
+}  // namespace tests
+}  // namespace open3d
@@ -219,6 +219,58 @@ TEST(TPointCloudIO, ReadPointCloudFromPLY3) {
     EXPECT_FALSE(pcd.HasPointAttr("intensity"));
 }
 
+// Binary vertices stored after another element and interleaved with an
+// unsupported property.
+TEST(TPointCloudIO, ReadPointCloudFromPLY4) {
+    std::string filename_out = utility::filesystem::GetTempDirectoryPath() +
+                               "/test_sample_binary_layout.ply";
+    std::ofstream outfile(filename_out, std::ios::binary);
+    outfile << "ply\n"
+               "format binary_little_endian 1.0\n"
+               "element camera 1\n"
+               "property double focal\n"
+               "property uchar id\n"
+               "element vertex 3\n"
+               "property float x\n"
+               "property short junk\n"
+               "property float y\n"
+               "property float z\n"
+               "property uchar quality\n"
+               "element face 1\n"
+               "property list uchar int vertex_indices\n"
+               "end_header\n";
+    const double focal = 525.0;
+    const uint8_t id = 7;
+    outfile.write(reinterpret_cast<const char *>(&focal), sizeof(focal));
+    outfile.write(reinterpret_cast<const char *>(&id), sizeof(id));
+    for (int i = 0; i < 3; ++i) {
+        const float x = i, y = 10.f + i, z = 20.f + i;
+        const int16_t junk = -1;
+        const uint8_t quality = 100 + i;
+        outfile.write(reinterpret_cast<const char *>(&x), sizeof(x));
+        outfile.write(reinterpret_cast<const char *>(&junk), sizeof(junk));
+        outfile.write(reinterpret_cast<const char *>(&y), sizeof(y));
+        outfile.write(reinterpret_cast<const char *>(&z), sizeof(z));
+        outfile.write(reinterpret_cast<const char *>(&quality),
+                      sizeof(quality));
+    }
+    const uint8_t face_size = 3;
+    const int32_t face[3] = {0, 1, 2};
+    outfile.write(reinterpret_cast<const char *>(&face_size),
+                  sizeof(face_size));
+    outfile.write(reinterpret_cast<const char *>(face), sizeof(face));
+    outfile.close();
+
+    t::geometry::PointCloud pcd;
+    EXPECT_TRUE(t::io::ReadPointCloud(filename_out, pcd,
+                                      {"auto", false, false, true}));
+    EXPECT_FALSE(pcd.HasPointAttr("junk"));
+    EXPECT_TRUE(pcd.GetPointPositions().AllClose(core::Tensor::Init<float>(
+            {{0, 10, 20}, {1, 11, 21}, {2, 12, 22}})));
+    EXPECT_TRUE(pcd.GetPointAttr("quality").AllClose(
+            core::Tensor::Init<uint8_t>({{100}, {101}, {102}})));
+}
+
 // Read write empty point cloud.
 TEST(TPointCloudIO, ReadWriteEmptyPTS) {
     t::geometry::PointCloud pcd, pcd_read;
@@ -488,5 +540,153 @@ TEST(TPointCloudIO, ReadWritePointCloudAsPCD) {
     EXPECT_TRUE(ascii_f32_pcd.GetPointColors().AllClose(color_uint8));
 }
 
+// Read write las with all supported attributes.
+TEST(TPointCloudIO, ReadWriteLAS) {
+    const int64_t num_points = 100;
+    t::geometry::PointCloud pcd(
+            core::Tensor::Arange(0, 3 * num_points, 1, core::Float64)
+                            .Reshape({num_points, 3}) *
+                    0.125 +
+            1000.0);
+    pcd.SetPointAttr("intensities",
+                     core::Tensor::Arange(0, num_points, 1, core::UInt16)
+                             .Reshape({num_points, 1}));
+    pcd.SetPointAttr("classification",
+                     core::Tensor::Full({num_points, 1}, 2, core::UInt8));
+    pcd.SetPointAttr("return_number",
+                     core::Tensor::Full({num_points, 1}, 1, core::UInt8));
+    pcd.SetPointAttr("number_of_returns",
+                     core::Tensor::Full({num_points, 1}, 3, core::UInt8));
+    pcd.SetPointAttr("gps_time",
+                     core::Tensor::Arange(0, num_points, 1, core::Float64)
+                                     .Reshape({num_points, 1}) *
+                             0.5);
+    pcd.SetPointColors(
+            core::Tensor::Full({num_points, 3}, 1000, core::UInt16));
+
+    const std::string tmp_path = utility::filesystem::GetTempDirectoryPath();
+    std::string file_name = tmp_path + "/test.las";
+    EXPECT_TRUE(t::io::WritePointCloud(file_name, pcd));
+    t::geometry::PointCloud pcd_read;
+    EXPECT_TRUE(t::io::ReadPointCloud(file_name, pcd_read,
+                                      {"auto", false, false, true}));
+    EXPECT_EQ(pcd_read.GetPointAttr().size(), pcd.GetPointAttr().size());
+    for (const auto &kv : pcd.GetPointAttr()) {
+        SCOPED_TRACE(kv.first);
+        EXPECT_EQ(pcd_read.GetPointAttr(kv.first).GetDtype(),
+                  kv.second.GetDtype());
+        EXPECT_TRUE(pcd_read.GetPointAttr(kv.first).AllClose(kv.second));
+    }
+
+    // Write pointcloud with only Float32 positions and 8 bit colors.
+    t::geometry::PointCloud pcd_color(
+            pcd.GetPointPositions().To(core::Float32));
+    pcd_color.SetPointColors(
+            core::Tensor::Full({num_points, 3}, 255, core::UInt8));
+    file_name = tmp_path + "/test_color.las";
+    EXPECT_TRUE(t::io::WritePointCloud(file_name, pcd_color));
+    EXPECT_TRUE(t::io::ReadPointCloud(file_name, pcd_read,
+                                      {"auto", false, false, true}));
+    EXPECT_TRUE(pcd_read.GetPointPositions().AllClose(pcd.GetPointPositions()));
+    EXPECT_TRUE(pcd_read.GetPointColors().AllEqual(
+            core::Tensor::Full({num_points, 3}, 65535, core::UInt16)));
+    EXPECT_TRUE(pcd_read.GetPointAttr("return_number").AllEqual(
+            core::Tensor::Ones({num_points, 1}, core::UInt8)));
+    EXPECT_FALSE(pcd_read.HasPointAttr("gps_time"));
+
+    // Compressed LAZ point data is rejected.
+    std::fstream file(file_name,
+                      std::ios::in | std::ios::out | std::ios::binary);
+    file.seekp(104);
+    file.put(static_cast<char>(0x82));
+    file.close();
+    EXPECT_FALSE(t::io::ReadPointCloud(file_name, pcd_read));
+}
+
+// Read write o3dpc with custom attributes, compressed and uncompressed.
+TEST(TPointCloudIO, ReadWriteO3DPC) {
+    const int64_t num_points = 200000;
+    t::geometry::PointCloud pcd(
+            core::Tensor::Arange(0, 3 * num_points, 1, core::Float32)
+                    .Reshape({num_points, 3})
+                    .Neg());
+    pcd.SetPointColors(core::Tensor::Full({num_points, 3}, 7, core::UInt8));
+    pcd.SetPointAttr("index",
+                     core::Tensor::Arange(0, num_points, 1, core::Int64));
+    pcd.SetPointAttr("custom",
+                     core::Tensor::Ones({num_points, 2, 2}, core::Float64));
+
+    const std::string tmp_path = utility::filesystem::GetTempDirectoryPath();
+    for (bool compressed : {false, true}) {
+        SCOPED_TRACE(compressed);
+        const std::string file_name = tmp_path + "/test.o3dpc";
+        EXPECT_TRUE(t::io::WritePointCloud(file_name, pcd,
+                                           {false, compressed, false}));
+        t::geometry::PointCloud pcd_read;
+        EXPECT_TRUE(t::io::ReadPointCloud(file_name, pcd_read));
+
+        // The points are reordered, restore the original order.
+        EXPECT_EQ(pcd_read.GetPointAttr().size(), pcd.GetPointAttr().size());
+        const core::Tensor index = pcd_read.GetPointAttr("index");
+        EXPECT_EQ(index.GetShape(), core::SizeVector({num_points}));
+        core::Tensor inverse =
+                core::Tensor::Empty({num_points}, core::Int64);
+        inverse.IndexSet({index},
+                         core::Tensor::Arange(0, num_points, 1, core::Int64));
+        for (const auto &kv : pcd.GetPointAttr()) {
+            SCOPED_TRACE(kv.first);
+            const core::Tensor &attr = pcd_read.GetPointAttr(kv.first);
+            EXPECT_EQ(attr.GetDtype(), kv.second.GetDtype());
+            EXPECT_TRUE(attr.IndexGet({inverse}).AllEqual(kv.second));
+        }
+    }
+}
+
+// Read a box and a subset of the attributes.
+TEST(TPointCloudIO, ReadPointCloudSubset) {
+    const int64_t num_points = 200000;
+    t::geometry::PointCloud pcd(
+            core::Tensor::Arange(0, 3 * num_points, 1, core::Float64)
+                    .Reshape({num_points, 3}));
+    pcd.SetPointAttr("index",
+                     core::Tensor::Arange(0, num_points, 1, core::Int64)
+                             .Reshape({num_points, 1}));
+    pcd.SetPointAttr("intensities",
+                     core::Tensor::Ones({num_points, 1}, core::Float64));
+
+    t::io::ReadPointCloudSubsetOption subset;
+    subset.min_bound = core::Tensor::Init<double>({3000, 3001, 3002});
+    subset.max_bound = core::Tensor::Init<double>({5999, 6000, 6001});
+    subset.attributes = {"index"};
+
+    const std::string tmp_path = utility::filesystem::GetTempDirectoryPath();
+    for (const std::string &ext : {"o3dpc", "npz"}) {
+        SCOPED_TRACE(ext);
+        const std::string file_name = tmp_path + "/test_subset." + ext;
+        EXPECT_TRUE(t::io::WritePointCloud(file_name, pcd));
+        t::geometry::PointCloud pcd_read;
+        EXPECT_TRUE(t::io::ReadPointCloudSubset(file_name, pcd_read, subset));
+        EXPECT_EQ(pcd_read.GetPointAttr().size(), 2u);
+        EXPECT_FALSE(pcd_read.HasPointAttr("intensities"));
+        EXPECT_EQ(pcd_read.GetPointPositions().GetLength(), 1000);
+        const core::Tensor index = pcd_read.GetPointAttr("index");
+        EXPECT_EQ(index.Min({0}).Item<int64_t>(), 1000);
+        EXPECT_EQ(index.Max({0}).Item<int64_t>(), 1999);
+    }
+
+    // Only the tiles intersecting the box are loaded.
+    t::geometry::PointCloud pcd_tiles;
+    EXPECT_TRUE(t::io::ReadPointCloudSubsetFromO3DPC(
+            tmp_path + "/test_subset.o3dpc", pcd_tiles, subset, {}));
+    EXPECT_GE(pcd_tiles.GetPointPositions().GetLength(), 1000);
+    EXPECT_LT(pcd_tiles.GetPointPositions().GetLength(), num_points);
+
+    // The bounds must have 3 elements.
+    subset.max_bound = core::Tensor::Init<double>({1, 1});
+    t::geometry::PointCloud pcd_read;
+    EXPECT_ANY_THROW(t::io::ReadPointCloudSubset(tmp_path + "/test_subset.npz",
+                                                 pcd_read, subset));
+}
+
 }  // namespace tests
 }  // namespace open3d
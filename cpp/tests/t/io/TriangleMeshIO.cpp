@@ -26,6 +26,10 @@
 
 #include "open3d/t/io/TriangleMeshIO.h"
 
+#include <cstring>
+#include <string>
+#include <vector>
+
 #include "open3d/data/Dataset.h"
 #include "open3d/io/TriangleMeshIO.h"
 #include "open3d/t/geometry/TriangleMesh.h"
@@ -90,6 +94,54 @@ TEST(TriangleMeshIO, ReadWriteTriangleMeshOBJ) {
     EXPECT_TRUE(mesh.GetTriangleIndices().AllClose(triangles));
 }
 
+TEST(TriangleMeshIO, WriteTriangleMeshGLB) {
+    auto box = geometry::TriangleMesh::CreateBox();
+    box->ComputeVertexNormals();
+    auto mesh = t::geometry::TriangleMesh::FromLegacy(*box);
+    mesh.SetVertexColors(core::Tensor::Full({8, 3}, 0.5, core::Float32));
+    const std::string tmp_path = utility::filesystem::GetTempDirectoryPath();
+
+    for (bool compressed : {false, true}) {
+        const std::string filename =
+                tmp_path + (compressed ? "/cube_quantized.glb" : "/cube.glb");
+        EXPECT_TRUE(
+                t::io::WriteTriangleMesh(filename, mesh, false, compressed));
+
+        std::vector<char> bytes;
+        EXPECT_TRUE(utility::filesystem::FReadToBuffer(filename, bytes, nullptr));
+        ASSERT_GE(bytes.size(), 20);
+        uint32_t header[5];
+        std::memcpy(header, bytes.data(), sizeof(header));
+        EXPECT_EQ(header[0], 0x46546C67u);  // "glTF"
+        EXPECT_EQ(header[1], 2u);
+        EXPECT_EQ(header[2], bytes.size());
+        EXPECT_EQ(header[4], 0x4E4F534Au);  // "JSON"
+        const std::string json(bytes.data() + 20, header[3]);
+        EXPECT_NE(json.find("\"POSITION\""), std::string::npos);
+        EXPECT_NE(json.find("\"NORMAL\""), std::string::npos);
+        EXPECT_NE(json.find("\"COLOR_0\""), std::string::npos);
+        EXPECT_EQ(json.find("KHR_mesh_quantization") != std::string::npos,
+                  compressed);
+
+        // 8 float positions followed by the padded normals and colors, then
+        // 36 uint16 indices.
+        const size_t bin_length = 8 * 12 + (compressed ? 8 * 4 + 8 * 4
+                                                       : 8 * 12 + 8 * 12) +
+                                  36 * 2;
+        uint32_t bin_chunk[2];
+        std::memcpy(bin_chunk, bytes.data() + 20 + header[3],
+                    sizeof(bin_chunk));
+        EXPECT_EQ(bin_chunk[0], bin_length);
+        EXPECT_EQ(bin_chunk[1], 0x004E4942u);  // "BIN"
+        std::vector<float> positions(24);
+        std::memcpy(positions.data(), bytes.data() + 28 + header[3],
+                    positions.size() * sizeof(float));
+        EXPECT_TRUE(core::Tensor(positions, {8, 3}, core::Float32)
+                            .AllClose(mesh.GetVertexPositions().To(
+                                    core::Float32)));
+    }
+}
+
 // TODO: Add tests for triangle_uvs, materials, triangle_material_ids and
 // textures once these are supported.
 TEST(TriangleMeshIO, TriangleMeshLegecyCompatibility) {
@@ -0,0 +1,133 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/t/io/sensor/RGBDCaptureService.h"
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+#include "tests/Tests.h"
+
+namespace open3d {
+namespace tests {
+
+namespace {
+
+/// Sensor producing 1x1 frames with timestamps offset + n * period_us.
+class FakeSensor : public t::io::RGBDSensor {
+public:
+    FakeSensor(uint64_t offset_us, uint64_t period_us)
+        : offset_us_(offset_us), period_us_(period_us) {}
+
+    bool InitSensor(const RGBDSensorConfig &sensor_config,
+                    size_t sensor_index,
+                    const std::string &filename) override {
+        return true;
+    }
+    bool StartCapture(bool start_record) override {
+        capturing_ = true;
+        return true;
+    }
+    void PauseRecord() override {}
+    void ResumeRecord() override {}
+    t::geometry::RGBDImage CaptureFrame(bool wait,
+                                        bool align_depth_to_color) override {
+        std::this_thread::sleep_for(std::chrono::microseconds(200));
+        timestamp_ = offset_us_ + num_frames_++ * period_us_;
+        return t::geometry::RGBDImage(
+                t::geometry::Image(core::Tensor::Full(
+                        {1, 1, 1}, uint8_t(num_frames_), core::UInt8)),
+                t::geometry::Image(
+                        core::Tensor::Zeros({1, 1, 1}, core::UInt16)));
+    }
+    uint64_t GetTimestamp() const override { return timestamp_; }
+    void StopCapture() override { capturing_ = false; }
+    const t::io::RGBDVideoMetadata &GetMetadata() const override {
+        return metadata_;
+    }
+    std::string GetFilename() const override { return ""; }
+
+    std::atomic<bool> capturing_{false};
+
+private:
+    uint64_t offset_us_;
+    uint64_t period_us_;
+    std::atomic<uint64_t> timestamp_{0};
+    uint64_t num_frames_ = 0;
+    t::io::RGBDVideoMetadata metadata_;
+};
+
+}  // namespace
+
+TEST(RGBDCaptureService, SynchronizedFrames) {
+    auto sensor0 = std::make_shared<FakeSensor>(0, 1000);
+    auto sensor1 = std::make_shared<FakeSensor>(300, 1000);
+    auto sensor2 = std::make_shared<FakeSensor>(5150, 1000);
+    t::io::RGBDCaptureService service({sensor0, sensor1, sensor2}, 4);
+    EXPECT_EQ(service.GetNumSensors(), 3);
+    EXPECT_FALSE(service.IsRunning());
+
+    ASSERT_TRUE(service.Start());
+    EXPECT_TRUE(service.IsRunning());
+    EXPECT_TRUE(sensor0->capturing_);
+
+    std::vector<t::geometry::RGBDImage> frames;
+    std::vector<uint64_t> timestamps;
+    for (int i = 0; i < 10; ++i) {
+        ASSERT_TRUE(service.GetFrames(frames, timestamps, 500, 5000));
+        ASSERT_EQ(frames.size(), 3);
+        ASSERT_EQ(timestamps.size(), 3);
+        const auto minmax =
+                std::minmax_element(timestamps.begin(), timestamps.end());
+        EXPECT_LE(*minmax.second - *minmax.first, 500);
+        for (const auto &frame : frames) {
+            EXPECT_FALSE(frame.IsEmpty());
+        }
+    }
+    // The first frames of sensor0 and sensor1 cannot be matched with the
+    // frames of sensor2.
+    EXPECT_GE(service.GetNumDroppedFrames(0), 5);
+    EXPECT_GE(service.GetNumDroppedFrames(1), 5);
+
+    service.Stop();
+    EXPECT_FALSE(service.IsRunning());
+    EXPECT_FALSE(sensor0->capturing_);
+}
+
+TEST(RGBDCaptureService, Timeout) {
+    auto sensor0 = std::make_shared<FakeSensor>(0, 1000);
+    t::io::RGBDCaptureService service({sensor0});
+    std::vector<t::geometry::RGBDImage> frames;
+    std::vector<uint64_t> timestamps;
+    // Not started, no frames arrive.
+    EXPECT_FALSE(service.GetFrames(frames, timestamps, 0, 10));
+    EXPECT_THROW(service.GetNumDroppedFrames(1), std::runtime_error);
+}
+
+}  // namespace tests
+}  // namespace open3d
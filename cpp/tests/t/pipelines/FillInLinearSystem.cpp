@@ -0,0 +1,203 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/pipelines/kernel/FillInLinearSystem.h"
+
+#include <random>
+
+#include "core/CoreTest.h"
+#include "open3d/core/Tensor.h"
+#include "tests/Tests.h"
+
+namespace open3d {
+namespace tests {
+
+class FillInLinearSystemPermuteDevices : public PermuteDevices {};
+INSTANTIATE_TEST_SUITE_P(FillInLinearSystem,
+                         FillInLinearSystemPermuteDevices,
+                         testing::ValuesIn(PermuteDevices::TestCases()));
+
+static core::Tensor RandomFloat(const core::SizeVector& shape,
+                                float min_val,
+                                float max_val,
+                                std::mt19937& rng,
+                                const core::Device& device) {
+    std::uniform_real_distribution<float> dist(min_val, max_val);
+    std::vector<float> values(shape.NumElements());
+    for (float& value : values) {
+        value = dist(rng);
+    }
+    return core::Tensor(values, shape, core::Float32, device);
+}
+
+static core::Tensor RandomInt(const core::SizeVector& shape,
+                              int max_val,
+                              std::mt19937& rng,
+                              const core::Device& device) {
+    std::uniform_int_distribution<int> dist(0, max_val - 1);
+    std::vector<int> values(shape.NumElements());
+    for (int& value : values) {
+        value = dist(rng);
+    }
+    return core::Tensor(values, shape, core::Int32, device);
+}
+
+// Checks that the Jacobian rows give the same J^T J x, J^T r and block
+// diagonal as the dense linear system.
+static void ExpectSparseEqualsDense(const core::Tensor& AtA,
+                                    const core::Tensor& Atb,
+                                    const core::Tensor& J_idx,
+                                    const core::Tensor& J_val,
+                                    const core::Tensor& r,
+                                    int n_frags,
+                                    std::mt19937& rng) {
+    core::Device device = AtA.GetDevice();
+    int64_t n_vars = Atb.GetLength();
+    int64_t n_ctr = (n_vars - 6 * n_frags) / 3;
+
+    core::Tensor x = RandomFloat({n_vars}, -1, 1, rng, device);
+    core::Tensor JTJx = core::Tensor::Zeros({n_vars}, core::Float32, device);
+    t::pipelines::kernel::ComputeJTJx(JTJx, J_idx, J_val, x);
+    EXPECT_TRUE(JTJx.AllClose(AtA.Matmul(x.View({-1, 1})).View({-1}), 1e-4,
+                              1e-4));
+
+    core::Tensor JTr = core::Tensor::Zeros({n_vars}, core::Float32, device);
+    t::pipelines::kernel::ComputeJTr(JTr, J_idx, J_val, r);
+    EXPECT_TRUE(JTr.AllClose(Atb.View({-1}), 1e-4, 1e-4));
+
+    // Mask of the block diagonal of AtA.
+    core::Tensor block_ids =
+            core::Tensor::Arange(0, n_frags, 1, core::Int64, device)
+                    .View({-1, 1})
+                    .Expand({n_frags, 6})
+                    .Reshape({-1});
+    block_ids = block_ids.Append(
+            core::Tensor::Arange(n_frags, n_frags + n_ctr, 1, core::Int64,
+                                 device)
+                    .View({-1, 1})
+                    .Expand({n_ctr, 3})
+                    .Reshape({-1}));
+    core::Tensor mask = block_ids.View({-1, 1}).Eq(block_ids.View({1, -1}));
+    core::Tensor AtA_blocks = AtA * mask.To(core::Float32);
+
+    core::Tensor blocks = core::Tensor::Zeros({36 * n_frags + 9 * n_ctr},
+                                              core::Float32, device);
+    t::pipelines::kernel::FillInBlockJacobi(blocks, J_idx, J_val, n_frags);
+    core::Tensor z = core::Tensor::Empty({n_vars}, core::Float32, device);
+    t::pipelines::kernel::ApplyBlockJacobi(z, blocks, x, n_frags);
+    EXPECT_TRUE(z.AllClose(AtA_blocks.Matmul(x.View({-1, 1})).View({-1}),
+                           1e-4, 1e-4));
+}
+
+TEST_P(FillInLinearSystemPermuteDevices, FillInSLACAlignmentTermSparse) {
+    core::Device device = GetParam();
+    std::mt19937 rng(0);
+
+    const int n_frags = 3;
+    const int n_ctr = 20;
+    const int64_t n = 50;
+    const int64_t n_vars = 6 * n_frags + 3 * n_ctr;
+    const float threshold = 0.5;
+
+    core::Tensor Ti_Cps = RandomFloat({n, 3}, -1, 1, rng, device);
+    core::Tensor Tj_Cqs =
+            Ti_Cps + RandomFloat({n, 3}, -0.5, 0.5, rng, device);
+    core::Tensor Cnormal_ps = RandomFloat({n, 3}, -1, 1, rng, device);
+    core::Tensor Ri_Cnormal_ps = RandomFloat({n, 3}, -1, 1, rng, device);
+    core::Tensor RjT_Ri_Cnormal_ps = RandomFloat({n, 3}, -1, 1, rng, device);
+    core::Tensor cgrid_idx_ps = RandomInt({n, 8}, n_ctr, rng, device);
+    core::Tensor cgrid_idx_qs = RandomInt({n, 8}, n_ctr, rng, device);
+    core::Tensor cgrid_ratio_ps = RandomFloat({n, 8}, 0, 1, rng, device);
+    core::Tensor cgrid_ratio_qs = RandomFloat({n, 8}, 0, 1, rng, device);
+
+    core::Tensor AtA =
+            core::Tensor::Zeros({n_vars, n_vars}, core::Float32, device);
+    core::Tensor Atb = core::Tensor::Zeros({n_vars, 1}, core::Float32, device);
+    core::Tensor residual = core::Tensor::Zeros({1}, core::Float32, device);
+    t::pipelines::kernel::FillInSLACAlignmentTerm(
+            AtA, Atb, residual, Ti_Cps, Tj_Cqs, Cnormal_ps, Ri_Cnormal_ps,
+            RjT_Ri_Cnormal_ps, cgrid_idx_ps, cgrid_idx_qs, cgrid_ratio_ps,
+            cgrid_ratio_qs, 0, 2, n_frags, threshold);
+
+    core::Tensor J_idx, J_val, r;
+    t::pipelines::kernel::FillInSLACAlignmentTermSparse(
+            J_idx, J_val, r, Ti_Cps, Tj_Cqs, Cnormal_ps, Ri_Cnormal_ps,
+            RjT_Ri_Cnormal_ps, cgrid_idx_ps, cgrid_idx_qs, cgrid_ratio_ps,
+            cgrid_ratio_qs, 0, 2, n_frags, threshold);
+    EXPECT_EQ(J_idx.GetShape(), core::SizeVector({n, 60}));
+    EXPECT_EQ(J_val.GetShape(), core::SizeVector({n, 60}));
+    EXPECT_EQ(r.GetShape(), core::SizeVector({n}));
+    EXPECT_NEAR((r * r).Sum({0}).Item<float>(), residual[0].Item<float>(),
+                1e-4);
+
+    ExpectSparseEqualsDense(AtA, Atb, J_idx, J_val, r, n_frags, rng);
+}
+
+TEST_P(FillInLinearSystemPermuteDevices, FillInSLACRegularizerTermSparse) {
+    core::Device device = GetParam();
+    std::mt19937 rng(1);
+
+    const int n_frags = 2;
+    const int n_ctr = 30;
+    const int64_t n_vars = 6 * n_frags + 3 * n_ctr;
+    const float weight = 2.0;
+
+    core::Tensor grid_idx =
+            core::Tensor::Arange(0, n_ctr, 1, core::Int32, device);
+    // Neighbors are offset by 1 to 6 so that none of them is the grid itself.
+    core::Tensor grid_nbs_idx =
+            (grid_idx.View({-1, 1}) +
+             core::Tensor::Arange(1, 7, 1, core::Int32, device).View({1, -1}))
+                    .Contiguous();
+    grid_nbs_idx = grid_nbs_idx -
+                   grid_nbs_idx.Ge(n_ctr).To(core::Int32) * int(n_ctr);
+    core::Tensor grid_nbs_mask =
+            RandomFloat({n_ctr, 6}, 0, 1, rng, device).Lt(0.8);
+    core::Tensor positions_init = RandomFloat({n_ctr, 3}, -1, 1, rng, device);
+    core::Tensor positions_curr =
+            positions_init + RandomFloat({n_ctr, 3}, -0.1, 0.1, rng, device);
+
+    core::Tensor AtA =
+            core::Tensor::Zeros({n_vars, n_vars}, core::Float32, device);
+    core::Tensor Atb = core::Tensor::Zeros({n_vars, 1}, core::Float32, device);
+    core::Tensor residual = core::Tensor::Zeros({1}, core::Float32, device);
+    t::pipelines::kernel::FillInSLACRegularizerTerm(
+            AtA, Atb, residual, grid_idx, grid_nbs_idx, grid_nbs_mask,
+            positions_init, positions_curr, weight, n_frags, 0);
+
+    core::Tensor J_idx, J_val, r;
+    t::pipelines::kernel::FillInSLACRegularizerTermSparse(
+            J_idx, J_val, r, grid_idx, grid_nbs_idx, grid_nbs_mask,
+            positions_init, positions_curr, weight, n_frags, 0);
+    EXPECT_EQ(J_idx.GetShape(), core::SizeVector({n_ctr * 18, 2}));
+    EXPECT_NEAR((r * r).Sum({0}).Item<float>(), residual[0].Item<float>(),
+                1e-4);
+
+    ExpectSparseEqualsDense(AtA, Atb, J_idx, J_val, r, n_frags, rng);
+}
+
+}  // namespace tests
+}  // namespace open3d
@@ -0,0 +1,145 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/t/pipelines/color_map/RigidOptimizer.h"
+
+#include <cmath>
+
+#include "core/CoreTest.h"
+#include "open3d/pipelines/color_map/RigidOptimizer.h"
+#include "tests/Tests.h"
+
+namespace open3d {
+namespace tests {
+
+class ColorMapPermuteDevices : public PermuteDevices {};
+INSTANTIATE_TEST_SUITE_P(ColorMap,
+                         ColorMapPermuteDevices,
+                         testing::ValuesIn(PermuteDevices::TestCases()));
+
+// A textured plane at z = depth seen by cameras translated in x and y.
+static void CreatePlaneScene(std::shared_ptr<geometry::TriangleMesh> &mesh,
+                             std::vector<geometry::RGBDImage> &images_rgbd,
+                             camera::PinholeCameraTrajectory &trajectory) {
+    const int width = 80, height = 60, grid = 41;
+    const double depth = 1.5;
+    auto texture = [](double x, double y) {
+        return 0.5 + 0.25 * std::sin(6 * x) * std::cos(6 * y);
+    };
+
+    mesh = std::make_shared<geometry::TriangleMesh>();
+    for (int i = 0; i < grid; ++i) {
+        for (int j = 0; j < grid; ++j) {
+            mesh->vertices_.emplace_back(-0.6 + 1.2 * j / (grid - 1),
+                                         -0.45 + 0.9 * i / (grid - 1), depth);
+        }
+    }
+    for (int i = 0; i + 1 < grid; ++i) {
+        for (int j = 0; j + 1 < grid; ++j) {
+            const int v = i * grid + j;
+            mesh->triangles_.emplace_back(v, v + 1, v + grid);
+            mesh->triangles_.emplace_back(v + 1, v + grid + 1, v + grid);
+        }
+    }
+
+    const camera::PinholeCameraIntrinsic intrinsic(width, height, 60, 60, 40,
+                                                   30);
+    const std::vector<Eigen::Vector2d> offsets{
+            {0.0, 0.0}, {0.05, -0.03}, {-0.04, 0.02}};
+    for (const Eigen::Vector2d &offset : offsets) {
+        camera::PinholeCameraParameters parameters;
+        parameters.intrinsic_ = intrinsic;
+        parameters.extrinsic_ = Eigen::Matrix4d::Identity();
+        parameters.extrinsic_.block<2, 1>(0, 3) = offset;
+        trajectory.parameters_.push_back(parameters);
+
+        geometry::Image color, depth_image;
+        color.Prepare(width, height, 3, 1);
+        depth_image.Prepare(width, height, 1, 4);
+        for (int v = 0; v < height; ++v) {
+            for (int u = 0; u < width; ++u) {
+                const double x = (u - 40) * depth / 60 - offset(0);
+                const double y = (v - 30) * depth / 60 - offset(1);
+                const uint8_t value = uint8_t(255 * texture(x, y));
+                for (int c = 0; c < 3; ++c) {
+                    *color.PointerAt<uint8_t>(u, v, c) = value;
+                }
+                *depth_image.PointerAt<float>(u, v) = float(depth);
+            }
+        }
+        images_rgbd.emplace_back(color, depth_image);
+    }
+
+    // Perturb the poses slightly, so that there is something to optimize.
+    trajectory.parameters_[1].extrinsic_(0, 3) += 0.005;
+    trajectory.parameters_[2].extrinsic_(1, 3) -= 0.005;
+}
+
+TEST_P(ColorMapPermuteDevices, RunRigidOptimizer) {
+    core::Device device = GetParam();
+
+    std::shared_ptr<geometry::TriangleMesh> mesh;
+    std::vector<geometry::RGBDImage> images_rgbd;
+    camera::PinholeCameraTrajectory trajectory;
+    CreatePlaneScene(mesh, images_rgbd, trajectory);
+
+    pipelines::color_map::RigidOptimizerOption option;
+    option.maximum_iteration_ = 5;
+    option.image_boundary_margin_ = 5;
+
+    geometry::TriangleMesh ref_mesh;
+    camera::PinholeCameraTrajectory ref_trajectory;
+    std::tie(ref_mesh, ref_trajectory) =
+            pipelines::color_map::RunRigidOptimizer(*mesh, images_rgbd,
+                                                    trajectory, option);
+
+    for (bool check_occlusion : {false, true}) {
+        geometry::TriangleMesh opt_mesh;
+        camera::PinholeCameraTrajectory opt_trajectory;
+        std::tie(opt_mesh, opt_trajectory) =
+                t::pipelines::color_map::RunRigidOptimizer(
+                        *mesh, images_rgbd, trajectory, option,
+                        check_occlusion, device);
+
+        ASSERT_EQ(opt_trajectory.parameters_.size(),
+                  ref_trajectory.parameters_.size());
+        for (size_t c = 0; c < ref_trajectory.parameters_.size(); ++c) {
+            EXPECT_TRUE(opt_trajectory.parameters_[c].extrinsic_.isApprox(
+                    ref_trajectory.parameters_[c].extrinsic_, 1e-6));
+        }
+        ASSERT_EQ(opt_mesh.vertex_colors_.size(),
+                  ref_mesh.vertex_colors_.size());
+        for (size_t i = 0; i < ref_mesh.vertex_colors_.size(); ++i) {
+            EXPECT_LT((opt_mesh.vertex_colors_[i] - ref_mesh.vertex_colors_[i])
+                              .norm(),
+                      1e-6);
+        }
+    }
+}
+
+}  // namespace tests
+}  // namespace open3d
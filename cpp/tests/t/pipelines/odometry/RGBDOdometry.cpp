@@ -327,5 +327,127 @@ TEST_P(OdometryPermuteDevices, RGBDOdometryMultiScaleHybrid) {
     core::Tensor Ttrans = Tdiff.Slice(0, 0, 3).Slice(1, 3, 4);
     EXPECT_LE(Ttrans.T().Matmul(Ttrans).Item<double>(), 5e-5);
 }
+
+TEST_P(OdometryPermuteDevices, RGBDFramePyramid) {
+    core::Device device = GetParam();
+    if (!t::geometry::Image::HAVE_IPPICV &&
+        device.GetType() == core::Device::DeviceType::CPU) {
+        return;
+    }
+
+    const float depth_scale = 1000.0;
+    const float depth_max = 3.0;
+    const float depth_diff = 0.07;
+
+    data::SampleRedwoodRGBDImages redwood_data;
+    std::vector<t::geometry::RGBDImage> frames(3);
+    for (size_t i = 0; i < frames.size(); ++i) {
+        frames[i].color_ =
+                t::io::CreateImageFromFile(redwood_data.GetColorPaths()[i])
+                        ->To(device);
+        frames[i].depth_ =
+                t::io::CreateImageFromFile(redwood_data.GetDepthPaths()[i])
+                        ->To(device);
+    }
+
+    core::Tensor intrinsic_t = CreateIntrisicTensor();
+    const std::vector<t::pipelines::odometry::OdometryConvergenceCriteria>
+            criteria{10, 5, 3};
+    const t::pipelines::odometry::OdometryLossParams params(depth_diff);
+
+    for (auto method : {t::pipelines::odometry::Method::PointToPlane,
+                        t::pipelines::odometry::Method::Intensity,
+                        t::pipelines::odometry::Method::Hybrid}) {
+        std::vector<t::pipelines::odometry::RGBDFramePyramid> pyramids;
+        for (const auto& frame : frames) {
+            pyramids.emplace_back(frame, intrinsic_t, depth_scale, depth_max,
+                                  int64_t(criteria.size()), method, params);
+        }
+        EXPECT_EQ(pyramids[0].GetNumLevels(), 3);
+        EXPECT_EQ(pyramids[0].normal_map_.empty(),
+                  method != t::pipelines::odometry::Method::PointToPlane);
+        EXPECT_EQ(pyramids[0].depth_dx_.empty(),
+                  method != t::pipelines::odometry::Method::Hybrid);
+        // Coarser levels halve the resolution.
+        EXPECT_EQ(pyramids[0].vertex_map_[0].GetShape(0) * 4,
+                  pyramids[0].vertex_map_[2].GetShape(0));
+
+        // The pyramid of frame 1 is the target of the first call and the
+        // source of the second one, and matches per-call pyramids.
+        core::Tensor trans =
+                core::Tensor::Eye(4, core::Float64, core::Device("CPU:0"));
+        for (size_t i = 0; i + 1 < frames.size(); ++i) {
+            auto result = t::pipelines::odometry::RGBDOdometryMultiScale(
+                    pyramids[i], pyramids[i + 1], trans, criteria, params);
+            auto result_ref = t::pipelines::odometry::RGBDOdometryMultiScale(
+                    frames[i], frames[i + 1], intrinsic_t, trans, depth_scale,
+                    depth_max, criteria, method, params);
+            EXPECT_TRUE(result.transformation_.AllClose(
+                    result_ref.transformation_));
+            EXPECT_DOUBLE_EQ(result.fitness_, result_ref.fitness_);
+        }
+    }
+
+    // Pyramids built for different methods cannot be mixed.
+    t::pipelines::odometry::RGBDFramePyramid src_pyramid(
+            frames[0], intrinsic_t, depth_scale, depth_max, 3,
+            t::pipelines::odometry::Method::Intensity, params);
+    t::pipelines::odometry::RGBDFramePyramid dst_pyramid(
+            frames[1], intrinsic_t, depth_scale, depth_max, 3,
+            t::pipelines::odometry::Method::Hybrid, params);
+    EXPECT_ANY_THROW(t::pipelines::odometry::RGBDOdometryMultiScale(
+            src_pyramid, dst_pyramid,
+            core::Tensor::Eye(4, core::Float64, core::Device("CPU:0")),
+            criteria, params));
+}
+
+TEST_P(OdometryPermuteDevices, OdometryWarmStart) {
+    core::Device device = GetParam();
+    const core::Device host("CPU:0");
+
+    t::pipelines::odometry::OdometryWarmStart warm_start(0.9, 2);
+    const std::vector<t::pipelines::odometry::OdometryConvergenceCriteria>
+            criteria{10, 5, 3};
+
+    // Without a result the prediction is identity and no level is skipped.
+    EXPECT_TRUE(warm_start.Predict().AllClose(
+            core::Tensor::Eye(4, core::Float64, host)));
+    EXPECT_FALSE(warm_start.IsConfident());
+    EXPECT_EQ(warm_start.GetCriteria(criteria)[0].max_iteration_, 10);
+
+    // Constant velocity: the last motion is predicted.
+    core::Tensor motion = core::Tensor::Init<double>({{0, -1, 0, 0.1},
+                                                      {1, 0, 0, 0.2},
+                                                      {0, 0, 1, 0.3},
+                                                      {0, 0, 0, 1}},
+                                                     host);
+    warm_start.Update(
+            t::pipelines::odometry::OdometryResult(motion, 0.01, 0.5));
+    EXPECT_TRUE(warm_start.Predict().AllClose(motion));
+    EXPECT_FALSE(warm_start.IsConfident());
+
+    // The rotation prior replaces the rotation and keeps the translation.
+    core::Tensor prediction =
+            warm_start.Predict(core::Tensor::Eye(3, core::Float32, device));
+    EXPECT_TRUE(prediction.AllClose(core::Tensor::Init<double>(
+            {{1, 0, 0, 0.1}, {0, 1, 0, 0.2}, {0, 0, 1, 0.3}, {0, 0, 0, 1}},
+            host)));
+
+    // A confident result skips the coarse levels, but never the finest one.
+    warm_start.Update(
+            t::pipelines::odometry::OdometryResult(motion, 0.01, 0.95));
+    EXPECT_TRUE(warm_start.IsConfident());
+    std::vector<t::pipelines::odometry::OdometryConvergenceCriteria> skipped =
+            warm_start.GetCriteria(criteria);
+    EXPECT_EQ(skipped[0].max_iteration_, 0);
+    EXPECT_EQ(skipped[1].max_iteration_, 0);
+    EXPECT_EQ(skipped[2].max_iteration_, 3);
+    EXPECT_EQ(warm_start.GetCriteria({10, 5})[1].max_iteration_, 5);
+
+    warm_start.Reset();
+    EXPECT_FALSE(warm_start.IsConfident());
+    EXPECT_TRUE(warm_start.Predict().AllClose(
+            core::Tensor::Eye(4, core::Float64, host)));
+}
 }  // namespace tests
 }  // namespace open3d
@@ -0,0 +1,129 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/t/pipelines/registration/FastGlobalRegistration.h"
+
+#include <cmath>
+
+#include "core/CoreTest.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/core/TensorFunction.h"
+#include "open3d/t/geometry/PointCloud.h"
+#include "open3d/t/pipelines/registration/Registration.h"
+#include "tests/Tests.h"
+
+namespace t_reg = open3d::t::pipelines::registration;
+
+namespace open3d {
+namespace tests {
+
+class FastGlobalRegistrationPermuteDevices : public PermuteDevices {};
+INSTANTIATE_TEST_SUITE_P(FastGlobalRegistration,
+                         FastGlobalRegistrationPermuteDevices,
+                         testing::ValuesIn(PermuteDevices::TestCases()));
+
+static core::Tensor GetPoints(int num_points,
+                              const core::Dtype &dtype,
+                              const core::Device &device) {
+    std::vector<double> points;
+    for (int i = 0; i < num_points; ++i) {
+        points.push_back(std::sin(i * 0.37));
+        points.push_back(std::cos(i * 0.91));
+        points.push_back(std::sin(i * 1.73));
+    }
+    return core::Tensor(points, {num_points, 3}, core::Float64, device)
+            .To(dtype);
+}
+
+static core::Tensor GetTransformation() {
+    const double c = std::cos(0.8), s = std::sin(0.8);
+    return core::Tensor::Init<double>({{c, -s, 0, 0.5},
+                                       {s, c, 0, -0.2},
+                                       {0, 0, 1, 0.3},
+                                       {0, 0, 0, 1}});
+}
+
+TEST_P(FastGlobalRegistrationPermuteDevices, BasedOnCorrespondence) {
+    core::Device device = GetParam();
+
+    for (auto dtype : {core::Float32, core::Float64}) {
+        const int num_points = 200;
+        t::geometry::PointCloud source(GetPoints(num_points, dtype, device));
+        t::geometry::PointCloud target = source.Clone();
+        target.Transform(GetTransformation());
+
+        // Every other correspondence is an outlier.
+        std::vector<int64_t> corres;
+        for (int64_t i = 0; i < num_points; ++i) {
+            corres.push_back(i);
+            corres.push_back(i % 2 == 0 ? i : (7 * i + 3) % num_points);
+        }
+        core::Tensor correspondences(corres, {num_points, 2}, core::Int64,
+                                     device);
+
+        t_reg::FastGlobalRegistrationOption option;
+        option.seed_ = 42;
+        t_reg::RegistrationResult result =
+                t_reg::FastGlobalRegistrationBasedOnCorrespondence(
+                        source, target, correspondences, option);
+
+        // The remaining outlier tuples slightly bias the robust objective.
+        EXPECT_DOUBLE_EQ(result.fitness_, 1.0);
+        EXPECT_TRUE(result.transformation_.AllClose(GetTransformation(), 1e-3,
+                                                    1e-3));
+    }
+}
+
+TEST_P(FastGlobalRegistrationPermuteDevices, BasedOnFeatureMatching) {
+    core::Device device = GetParam();
+
+    for (auto dtype : {core::Float32, core::Float64}) {
+        const int num_points = 200;
+        t::geometry::PointCloud source(GetPoints(num_points, dtype, device));
+        t::geometry::PointCloud target = source.Clone();
+        target.Transform(GetTransformation());
+
+        // Distinct features that are the same for corresponding points.
+        const core::Tensor features =
+                core::Concatenate({GetPoints(num_points, dtype, device),
+                                   GetPoints(num_points, dtype, device) * 2.0},
+                                  1);
+
+        t_reg::FastGlobalRegistrationOption option;
+        option.seed_ = 42;
+        t_reg::RegistrationResult result =
+                t_reg::FastGlobalRegistrationBasedOnFeatureMatching(
+                        source, target, features, features, option);
+
+        EXPECT_DOUBLE_EQ(result.fitness_, 1.0);
+        EXPECT_TRUE(result.transformation_.AllClose(GetTransformation(), 1e-4,
+                                                    1e-4));
+    }
+}
+
+}  // namespace tests
+}  // namespace open3d
@@ -0,0 +1,113 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/pipelines/registration/Feature.h"
+
+#include <cmath>
+
+#include "core/CoreTest.h"
+#include "open3d/core/EigenConverter.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/geometry/PointCloud.h"
+#include "open3d/pipelines/registration/Feature.h"
+#include "open3d/t/geometry/PointCloud.h"
+#include "tests/Tests.h"
+
+namespace t_reg = open3d::t::pipelines::registration;
+namespace l_reg = open3d::pipelines::registration;
+
+namespace open3d {
+namespace tests {
+
+class FeaturePermuteDevices : public PermuteDevices {};
+INSTANTIATE_TEST_SUITE_P(Feature,
+                         FeaturePermuteDevices,
+                         testing::ValuesIn(PermuteDevices::TestCases()));
+
+// Points of a Fibonacci lattice on the unit sphere, with outward normals.
+static geometry::PointCloud GetSpherePointCloud(int num_points) {
+    geometry::PointCloud pcd;
+    const double golden_angle = M_PI * (3.0 - std::sqrt(5.0));
+    for (int i = 0; i < num_points; ++i) {
+        const double z = 1.0 - 2.0 * (i + 0.5) / num_points;
+        const double r = std::sqrt(1.0 - z * z);
+        const double theta = golden_angle * i;
+        const Eigen::Vector3d p(r * std::cos(theta), r * std::sin(theta), z);
+        pcd.points_.push_back(p);
+        pcd.normals_.push_back(p);
+    }
+    return pcd;
+}
+
+TEST_P(FeaturePermuteDevices, ComputeFPFHFeature) {
+    core::Device device = GetParam();
+
+    const geometry::PointCloud pcd_legacy = GetSpherePointCloud(1000);
+    const double radius = 0.25;
+    const int max_nn = 50;
+
+    for (auto dtype : {core::Float32, core::Float64}) {
+        const t::geometry::PointCloud pcd =
+                t::geometry::PointCloud::FromLegacy(pcd_legacy, dtype, device);
+        const double tolerance = dtype == core::Float32 ? 1e-2 : 1e-6;
+
+        // Hybrid search.
+        core::Tensor fpfh = t_reg::ComputeFPFHFeature(pcd, max_nn, radius);
+        auto fpfh_legacy = l_reg::ComputeFPFHFeature(
+                pcd_legacy, geometry::KDTreeSearchParamHybrid(radius, max_nn));
+        EXPECT_EQ(fpfh.GetShape(), core::SizeVector({1000, 33}));
+        EXPECT_EQ(fpfh.GetDtype(), dtype);
+        EXPECT_EQ(fpfh.GetDevice(), device);
+        EXPECT_TRUE(fpfh.To(core::Float64).AllClose(
+                core::eigen_converter::EigenMatrixToTensor(fpfh_legacy->data_)
+                        .T()
+                        .To(device),
+                tolerance, tolerance));
+
+        // KNN search.
+        fpfh = t_reg::ComputeFPFHFeature(pcd, max_nn, utility::nullopt);
+        fpfh_legacy = l_reg::ComputeFPFHFeature(
+                pcd_legacy, geometry::KDTreeSearchParamKNN(max_nn));
+        EXPECT_TRUE(fpfh.To(core::Float64).AllClose(
+                core::eigen_converter::EigenMatrixToTensor(fpfh_legacy->data_)
+                        .T()
+                        .To(device),
+                tolerance, tolerance));
+
+        // Radius search.
+        fpfh = t_reg::ComputeFPFHFeature(pcd, utility::nullopt, radius);
+        fpfh_legacy = l_reg::ComputeFPFHFeature(
+                pcd_legacy, geometry::KDTreeSearchParamRadius(radius));
+        EXPECT_TRUE(fpfh.To(core::Float64).AllClose(
+                core::eigen_converter::EigenMatrixToTensor(fpfh_legacy->data_)
+                        .T()
+                        .To(device),
+                tolerance, tolerance));
+    }
+}
+
+}  // namespace tests
+}  // namespace open3d
@@ -311,6 +311,140 @@ TEST_P(RegistrationPermuteDevices, ICPPointToPlane) {
     }
 }
 
+TEST_P(RegistrationPermuteDevices, ICPCallbackAfterIteration) {
+    core::Device device = GetParam();
+
+    t::geometry::PointCloud source_tpcd(device), target_tpcd(device);
+    std::tie(source_tpcd, target_tpcd) =
+            GetTestPointClouds(core::Float32, device);
+
+    core::Tensor initial_transform_t =
+            core::Tensor::Init<double>({{0.862, 0.011, -0.507, 0.5},
+                                        {-0.139, 0.967, -0.215, 0.7},
+                                        {0.487, 0.255, 0.835, -1.4},
+                                        {0.0, 0.0, 0.0, 1.0}},
+                                       core::Device("CPU:0"));
+
+    // Zero relative criteria never converge, so all iterations are run.
+    int max_iterations = 3;
+    int num_callbacks = 0;
+    t_reg::ICP(source_tpcd, target_tpcd, 1.5, initial_transform_t,
+               t_reg::TransformationEstimationPointToPlane(),
+               t_reg::ICPConvergenceCriteria(0.0, 0.0, max_iterations), -1.0,
+               [&](const std::unordered_map<std::string, core::Tensor>&
+                           attributes) {
+                   EXPECT_EQ(attributes.at("iteration_index").Item<int64_t>(),
+                             num_callbacks);
+                   for (const std::string& stage :
+                        {"correspondence_search_time", "estimation_time",
+                         "transform_time"}) {
+                       EXPECT_GE(attributes.at(stage).Item<double>(), 0.0);
+                   }
+                   ++num_callbacks;
+               });
+    EXPECT_EQ(num_callbacks, max_iterations);
+}
+
+TEST_P(RegistrationPermuteDevices, ICPTargetPyramid) {
+    core::Device device = GetParam();
+
+    for (auto dtype : {core::Float32, core::Float64}) {
+        t::geometry::PointCloud source_tpcd(device), target_tpcd(device);
+        std::tie(source_tpcd, target_tpcd) = GetTestPointClouds(dtype, device);
+
+        core::Tensor initial_transform_t =
+                core::Tensor::Init<double>({{0.862, 0.011, -0.507, 0.5},
+                                            {-0.139, 0.967, -0.215, 0.7},
+                                            {0.487, 0.255, 0.835, -1.4},
+                                            {0.0, 0.0, 0.0, 1.0}});
+
+        std::vector<double> voxel_sizes{0.5, -1.0};
+        std::vector<double> max_correspondence_distances{1.5, 1.0};
+        std::vector<t_reg::ICPConvergenceCriteria> criterias{
+                t_reg::ICPConvergenceCriteria(1e-6, 1e-6, 3),
+                t_reg::ICPConvergenceCriteria(1e-6, 1e-6, 3)};
+
+        t_reg::ICPTargetPyramid target_pyramid(
+                target_tpcd, voxel_sizes, max_correspondence_distances,
+                t_reg::TransformationEstimationPointToPlane());
+        EXPECT_EQ(target_pyramid.GetNumScales(), 2);
+        EXPECT_EQ(target_pyramid.GetPointCloud(1)
+                          .GetPointPositions()
+                          .GetLength(),
+                  target_tpcd.GetPointPositions().GetLength());
+
+        t_reg::RegistrationResult reg_pyramid = t_reg::MultiScaleICP(
+                source_tpcd, target_pyramid, criterias, initial_transform_t,
+                t_reg::TransformationEstimationPointToPlane());
+        t_reg::RegistrationResult reg_multi_scale = t_reg::MultiScaleICP(
+                source_tpcd, target_tpcd, voxel_sizes, criterias,
+                max_correspondence_distances, initial_transform_t,
+                t_reg::TransformationEstimationPointToPlane());
+
+        EXPECT_NEAR(reg_pyramid.fitness_, reg_multi_scale.fitness_, 1e-6);
+        EXPECT_NEAR(reg_pyramid.inlier_rmse_, reg_multi_scale.inlier_rmse_,
+                    1e-6);
+        EXPECT_TRUE(reg_pyramid.transformation_.AllClose(
+                reg_multi_scale.transformation_));
+
+        // Appending the target to itself doubles the finest scale, and only
+        // adds duplicate candidates to the correspondence search.
+        target_pyramid.AddPoints(target_tpcd);
+        EXPECT_EQ(target_pyramid.GetPointCloud(1)
+                          .GetPointPositions()
+                          .GetLength(),
+                  2 * target_tpcd.GetPointPositions().GetLength());
+        t_reg::RegistrationResult reg_updated = t_reg::MultiScaleICP(
+                source_tpcd, target_pyramid, criterias, initial_transform_t,
+                t_reg::TransformationEstimationPointToPlane());
+        EXPECT_NEAR(reg_updated.fitness_, reg_pyramid.fitness_, 1e-6);
+    }
+}
+
+TEST_P(RegistrationPermuteDevices, BatchICP) {
+    core::Device device = GetParam();
+
+    for (auto dtype : {core::Float32, core::Float64}) {
+        t::geometry::PointCloud source_tpcd(device), target_tpcd(device);
+        std::tie(source_tpcd, target_tpcd) = GetTestPointClouds(dtype, device);
+
+        // Two pairs sharing the clouds, with different initial guesses.
+        std::vector<t::geometry::PointCloud> sources{source_tpcd, source_tpcd};
+        std::vector<t::geometry::PointCloud> targets{target_tpcd, target_tpcd};
+        std::vector<core::Tensor> initial_transforms{
+                core::Tensor::Init<double>({{0.862, 0.011, -0.507, 0.5},
+                                            {-0.139, 0.967, -0.215, 0.7},
+                                            {0.487, 0.255, 0.835, -1.4},
+                                            {0.0, 0.0, 0.0, 1.0}}),
+                core::Tensor::Init<double>({{0.862, 0.011, -0.507, 0.4},
+                                            {-0.139, 0.967, -0.215, 0.6},
+                                            {0.487, 0.255, 0.835, -1.3},
+                                            {0.0, 0.0, 0.0, 1.0}})};
+
+        double max_correspondence_dist = 1.5;
+        t_reg::ICPConvergenceCriteria criteria(1e-6, 1e-6, 5);
+
+        std::vector<t_reg::RegistrationResult> batch_results = t_reg::BatchICP(
+                sources, targets, max_correspondence_dist, initial_transforms,
+                t_reg::TransformationEstimationPointToPlane(), criteria);
+        ASSERT_EQ(batch_results.size(), 2u);
+
+        for (size_t i = 0; i < sources.size(); ++i) {
+            t_reg::RegistrationResult reg_p2plane_t = t_reg::ICP(
+                    sources[i], targets[i], max_correspondence_dist,
+                    initial_transforms[i],
+                    t_reg::TransformationEstimationPointToPlane(), criteria);
+
+            EXPECT_NEAR(batch_results[i].fitness_, reg_p2plane_t.fitness_,
+                        0.0005);
+            EXPECT_NEAR(batch_results[i].inlier_rmse_,
+                        reg_p2plane_t.inlier_rmse_, 0.0005);
+            EXPECT_TRUE(batch_results[i].transformation_.AllClose(
+                    reg_p2plane_t.transformation_, 1e-3, 1e-3));
+        }
+    }
+}
+
 TEST_P(RegistrationPermuteDevices, ICPColored) {
     core::Device device = GetParam();
 
@@ -27,7 +27,9 @@
 #include "open3d/t/pipelines/registration/TransformationEstimation.h"
 
 #include "core/CoreTest.h"
+#include "open3d/core/EigenConverter.h"
 #include "open3d/core/Tensor.h"
+#include "open3d/pipelines/registration/GeneralizedICP.h"
 #include "open3d/t/pipelines/registration/Registration.h"
 #include "tests/Tests.h"
 
@@ -190,5 +192,143 @@ TEST_P(TransformationEstimationPermuteDevices,
     }
 }
 
+// Sets the covariances of generalized-icp from the normalized target normals
+// and isotropic source covariances, and returns them as Eigen matrices for the
+// legacy implementation.
+static std::tuple<std::vector<Eigen::Matrix3d>, std::vector<Eigen::Matrix3d>>
+SetGeneralizedICPCovariances(t::geometry::PointCloud& source,
+                             t::geometry::PointCloud& target,
+                             double epsilon) {
+    const core::Device device = source.GetDevice();
+    const core::Dtype dtype = source.GetPointPositions().GetDtype();
+    const core::Tensor normals =
+            target.GetPointNormals().To(core::Device("CPU:0"), core::Float64);
+
+    std::vector<Eigen::Matrix3d> source_covariances(
+            source.GetPointPositions().GetLength(),
+            Eigen::Matrix3d::Identity() * 0.01);
+    std::vector<Eigen::Matrix3d> target_covariances;
+    std::vector<double> source_values, target_values;
+    for (const Eigen::Matrix3d& C : source_covariances) {
+        source_values.insert(source_values.end(), C.data(), C.data() + 9);
+    }
+    for (int64_t i = 0; i < normals.GetLength(); ++i) {
+        Eigen::Vector3d n(normals[i][0].Item<double>(),
+                          normals[i][1].Item<double>(),
+                          normals[i][2].Item<double>());
+        n.normalize();
+        const Eigen::Matrix3d C = Eigen::Matrix3d::Identity() -
+                                  (1.0 - epsilon) * n * n.transpose();
+        target_covariances.push_back(C);
+        target_values.insert(target_values.end(), C.data(), C.data() + 9);
+    }
+    source.SetPointAttr(
+            "covariances",
+            core::Tensor(source_values,
+                         {int64_t(source_covariances.size()), 3, 3},
+                         core::Float64)
+                    .To(device, dtype));
+    target.SetPointAttr(
+            "covariances",
+            core::Tensor(target_values,
+                         {int64_t(target_covariances.size()), 3, 3},
+                         core::Float64)
+                    .To(device, dtype));
+    return std::make_tuple(source_covariances, target_covariances);
+}
+
+TEST_P(TransformationEstimationPermuteDevices, ComputeRMSEGeneralizedICP) {
+    core::Device device = GetParam();
+
+    for (auto dtype : {core::Float32, core::Float64}) {
+        t::geometry::PointCloud source_pcd(device), target_pcd(device);
+        core::Tensor corres;
+        std::tie(source_pcd, target_pcd, corres) =
+                GetTestPointCloudsAndCorrespondences(dtype, device);
+
+        // With M = Cs + Ct = I, the Mahalanobis distance is the Euclidean
+        // distance of PointToPoint.
+        source_pcd.SetPointAttr(
+                "covariances",
+                core::Tensor::Eye(3, dtype, device)
+                        .Reshape({1, 3, 3})
+                        .Expand({source_pcd.GetPointPositions().GetLength(),
+                                 3, 3}) *
+                        0.5);
+        target_pcd.SetPointAttr(
+                "covariances",
+                core::Tensor::Eye(3, dtype, device)
+                        .Reshape({1, 3, 3})
+                        .Expand({target_pcd.GetPointPositions().GetLength(),
+                                 3, 3}) *
+                        0.5);
+
+        t::pipelines::registration::TransformationEstimationForGeneralizedICP
+                estimation_gicp;
+        double gicp_rmse =
+                estimation_gicp.ComputeRMSE(source_pcd, target_pcd, corres);
+
+        EXPECT_NEAR(gicp_rmse, 0.706437, 0.0001);
+    }
+}
+
+TEST_P(TransformationEstimationPermuteDevices,
+       ComputeTransformationGeneralizedICP) {
+    core::Device device = GetParam();
+    const double epsilon = 1e-3;
+
+    for (auto dtype : {core::Float32, core::Float64}) {
+        t::geometry::PointCloud source_pcd(device), target_pcd(device);
+        core::Tensor corres;
+        std::tie(source_pcd, target_pcd, corres) =
+                GetTestPointCloudsAndCorrespondences(dtype, device);
+        std::vector<Eigen::Matrix3d> source_covariances, target_covariances;
+        std::tie(source_covariances, target_covariances) =
+                SetGeneralizedICPCovariances(source_pcd, target_pcd, epsilon);
+
+        t::pipelines::registration::TransformationEstimationForGeneralizedICP
+                estimation_gicp(epsilon);
+
+        // Get transform.
+        core::Tensor gicp_transform = estimation_gicp.ComputeTransformation(
+                source_pcd, target_pcd, corres);
+
+        // Legacy reference on the same correspondences and covariances.
+        geometry::PointCloud source_l = source_pcd.ToLegacy();
+        geometry::PointCloud target_l = target_pcd.ToLegacy();
+        source_l.covariances_ = source_covariances;
+        target_l.covariances_ = target_covariances;
+        const std::vector<int64_t> corres_vec =
+                corres.ToFlatVector<int64_t>();
+        pipelines::registration::CorrespondenceSet corres_l;
+        for (size_t i = 0; i < corres_vec.size(); ++i) {
+            corres_l.push_back(Eigen::Vector2i(i, corres_vec[i]));
+        }
+        pipelines::registration::TransformationEstimationForGeneralizedICP
+                estimation_gicp_l(epsilon);
+        const core::Tensor gicp_transform_l = core::eigen_converter::
+                EigenMatrixToTensor(estimation_gicp_l.ComputeTransformation(
+                        source_l, target_l, corres_l));
+        EXPECT_TRUE(gicp_transform.AllClose(gicp_transform_l, 1e-4, 1e-4));
+
+        // The covariances are rotated with the source, and the RMSE decreases.
+        const double gicp_rmse =
+                estimation_gicp.ComputeRMSE(source_pcd, target_pcd, corres);
+        t::geometry::PointCloud source_transformed_gicp = source_pcd.Clone();
+        source_transformed_gicp.Transform(gicp_transform);
+        double gicp_rmse_ = estimation_gicp.ComputeRMSE(source_transformed_gicp,
+                                                        target_pcd, corres);
+        EXPECT_LT(gicp_rmse_, gicp_rmse);
+
+        // The photometric term requires colors.
+        t::pipelines::registration::TransformationEstimationForGeneralizedICP
+                estimation_colored_gicp(
+                        epsilon, t::pipelines::registration::RobustKernel(),
+                        /*lambda_geometric=*/0.5);
+        EXPECT_ANY_THROW(estimation_colored_gicp.ComputeTransformation(
+                source_pcd, target_pcd, corres));
+    }
+}
+
 }  // namespace tests
 }  // namespace open3d
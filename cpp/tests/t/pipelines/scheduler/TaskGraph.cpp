@@ -0,0 +1,102 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/t/pipelines/scheduler/TaskGraph.h"
+
+#include <atomic>
+#include <mutex>
+#include <stdexcept>
+
+#include "tests/Tests.h"
+
+namespace open3d {
+namespace tests {
+
+TEST(TaskGraph, Dependencies) {
+    t::pipelines::scheduler::TaskGraph graph;
+    std::mutex mutex;
+    std::vector<int> order;
+    auto record = [&](int id) {
+        return [&, id](const core::Device& device) {
+            EXPECT_EQ(device, core::Device("CPU:0"));
+            std::lock_guard<std::mutex> lock(mutex);
+            order.push_back(id);
+        };
+    };
+
+    // Diamonds of tasks: a -> {b, c} -> d.
+    const int n_diamonds = 20;
+    std::vector<std::vector<int>> diamonds;
+    for (int i = 0; i < n_diamonds; ++i) {
+        int a = graph.AddTask(record(4 * i));
+        int b = graph.AddTask(record(4 * i + 1), {a});
+        int c = graph.AddTask(record(4 * i + 2), {a});
+        int d = graph.AddTask(record(4 * i + 3), {b, c});
+        diamonds.push_back({a, b, c, d});
+    }
+    EXPECT_EQ(graph.Size(), 4 * n_diamonds);
+
+    graph.Run({core::Device("CPU:0")}, 4);
+    EXPECT_EQ(graph.Size(), 0);
+    ASSERT_EQ(order.size(), size_t(4 * n_diamonds));
+
+    std::vector<int> position(order.size());
+    for (size_t i = 0; i < order.size(); ++i) {
+        position[order[i]] = int(i);
+    }
+    for (int i = 0; i < n_diamonds; ++i) {
+        EXPECT_LT(position[4 * i], position[4 * i + 1]);
+        EXPECT_LT(position[4 * i], position[4 * i + 2]);
+        EXPECT_LT(position[4 * i + 1], position[4 * i + 3]);
+        EXPECT_LT(position[4 * i + 2], position[4 * i + 3]);
+    }
+}
+
+TEST(TaskGraph, Exception) {
+    t::pipelines::scheduler::TaskGraph graph;
+    std::atomic<int> n_runs(0);
+    int a = graph.AddTask([&](const core::Device&) {
+        ++n_runs;
+        utility::LogError("Task failed.");
+    });
+    graph.AddTask([&](const core::Device&) { ++n_runs; }, {a});
+    EXPECT_ANY_THROW(graph.Run({}, 2));
+    EXPECT_EQ(n_runs.load(), 1);
+
+    // Dependencies must be added before their dependents.
+    EXPECT_ANY_THROW(graph.AddTask([](const core::Device&) {}, {0}));
+}
+
+TEST(TaskGraph, RequiresCUDADevice) {
+    t::pipelines::scheduler::TaskGraph graph;
+    graph.AddTask([](const core::Device&) {}, {},
+                  core::Device::DeviceType::CUDA);
+    EXPECT_ANY_THROW(graph.Run({core::Device("CPU:0")}));
+}
+
+}  // namespace tests
+}  // namespace open3d
@@ -80,6 +80,121 @@ TEST_P(ControlGridPermuteDevices, Deform) {
     curr[2][1] += 0.5;
 }
 
+TEST_P(ControlGridPermuteDevices, DeformBatch) {
+    core::Device device = GetParam();
+    t::pipelines::slac::ControlGrid cgrid(0.5, 1000, device);
+
+    std::vector<t::geometry::PointCloud> pcds;
+    for (int i = 0; i < 3; ++i) {
+        core::Tensor points =
+                core::Tensor::Init<float>({{0.1f, 0.2f, 0.3f},
+                                           {1.2f, 0.7f, -0.4f},
+                                           {-0.6f, 1.1f, 0.9f},
+                                           {0.8f, -0.3f, 1.4f}},
+                                          device) +
+                0.05f * i;
+        t::geometry::PointCloud pcd(points);
+        if (i != 1) {
+            core::Tensor normals =
+                    core::Tensor::Init<float>({{0, 0, 1},
+                                               {0, 1, 0},
+                                               {1, 0, 0},
+                                               {0.6f, 0.8f, 0}},
+                                              device);
+            pcd.SetPointNormals(normals);
+        }
+        cgrid.Touch(pcd);
+        pcds.push_back(pcd);
+    }
+    cgrid.Compactify();
+
+    std::vector<t::geometry::PointCloud> pcds_param;
+    for (const auto& pcd : pcds) {
+        pcds_param.push_back(cgrid.Parameterize(pcd));
+    }
+
+    // Without deformation the points are interpolated to their positions.
+    std::vector<t::geometry::PointCloud> pcds_deformed =
+            cgrid.Deform(pcds_param);
+    ASSERT_EQ(pcds_deformed.size(), pcds.size());
+    for (size_t i = 0; i < pcds.size(); ++i) {
+        EXPECT_TRUE(pcds_deformed[i].GetPointPositions().AllClose(
+                pcds_param[i].GetPointPositions(), 1e-5, 1e-5));
+        EXPECT_EQ(pcds_deformed[i].HasPointNormals(),
+                  pcds[i].HasPointNormals());
+    }
+
+    core::Tensor curr = cgrid.GetCurrPositions();
+    curr[0][0] += 0.2;
+    curr[1][2] -= 0.2;
+    curr[2][1] += 0.2;
+
+    pcds_deformed = cgrid.Deform(pcds_param);
+    for (size_t i = 0; i < pcds.size(); ++i) {
+        t::geometry::PointCloud pcd_deformed = cgrid.Deform(pcds_param[i]);
+        EXPECT_TRUE(pcds_deformed[i].GetPointPositions().AllClose(
+                pcd_deformed.GetPointPositions()));
+
+        // Trilinear interpolation of the 8 neighbor grid positions.
+        using t::pipelines::slac::ControlGrid;
+        core::Tensor nb_indices =
+                pcds_param[i].GetPointAttr(ControlGrid::kGrid8NbIndices);
+        core::Tensor nb_positions =
+                curr.IndexGet({nb_indices.To(core::Int64).View({-1})})
+                        .View({-1, 8, 3});
+        core::Tensor ratios = pcds_param[i].GetPointAttr(
+                ControlGrid::kGrid8NbVertexInterpRatios);
+        core::Tensor positions =
+                (nb_positions * ratios.View({-1, 8, 1})).Sum({1});
+        EXPECT_TRUE(pcds_deformed[i].GetPointPositions().AllClose(
+                positions, 1e-5, 1e-5));
+
+        if (pcds[i].HasPointNormals()) {
+            core::Tensor normals = pcds_deformed[i].GetPointNormals();
+            EXPECT_TRUE(normals.AllClose(pcd_deformed.GetPointNormals()));
+            EXPECT_TRUE((normals * normals)
+                                .Sum({1})
+                                .AllClose(core::Tensor::Ones(
+                                        {normals.GetLength()}, core::Float32,
+                                        device)));
+        }
+    }
+}
+
+TEST_P(ControlGridPermuteDevices, GetNeighborGridMap) {
+    core::Device device = GetParam();
+    t::pipelines::slac::ControlGrid cgrid(0.5, 1000, device);
+
+    t::geometry::PointCloud pcd(
+            core::Tensor::Init<float>({{0.1f, 0.2f, 0.3f}}, device));
+    cgrid.Touch(pcd);
+    cgrid.Compactify();
+
+    core::Tensor indices, nb_indices, nb_masks;
+    std::tie(indices, nb_indices, nb_masks) = cgrid.GetNeighborGridMap();
+    EXPECT_EQ(indices.GetLength(), 8);
+    EXPECT_EQ(nb_indices.GetShape(), core::SizeVector({8, 6}));
+    // Each corner of a single cell has 3 allocated neighbors.
+    EXPECT_TRUE(nb_masks.To(core::Int64).Sum({1}).AllEqual(
+            core::Tensor::Full({8}, 3, core::Int64, device)));
+
+    core::Tensor indices_cached, nb_indices_cached, nb_masks_cached;
+    std::tie(indices_cached, nb_indices_cached, nb_masks_cached) =
+            cgrid.GetNeighborGridMap();
+    EXPECT_TRUE(indices_cached.AllEqual(indices));
+    EXPECT_TRUE(nb_indices_cached.AllEqual(nb_indices));
+    EXPECT_TRUE(nb_masks_cached.AllEqual(nb_masks));
+
+    // Touching new grid points invalidates the map.
+    cgrid.Touch(t::geometry::PointCloud(
+            core::Tensor::Init<float>({{0.6f, 0.2f, 0.3f}}, device)));
+    cgrid.Compactify();
+    std::tie(indices, nb_indices, nb_masks) = cgrid.GetNeighborGridMap();
+    EXPECT_EQ(indices.GetLength(), 12);
+    EXPECT_EQ(nb_masks.To(core::Int64).Sum({0, 1}).Item<int64_t>(),
+              8 * 3 + 4 * 4);
+}
+
 TEST_P(ControlGridPermuteDevices, Regularizer) {
     core::Device device = GetParam();
     t::pipelines::slac::ControlGrid cgrid(0.5, 1000, device);
@@ -0,0 +1,126 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/t/pipelines/slam/LocalMap.h"
+
+#include "core/CoreTest.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/t/geometry/Utility.h"
+#include "open3d/t/pipelines/registration/Registration.h"
+#include "tests/Tests.h"
+
+namespace t_reg = open3d::t::pipelines::registration;
+
+namespace open3d {
+namespace tests {
+
+class LocalMapPermuteDevices : public PermuteDevices {};
+INSTANTIATE_TEST_SUITE_P(LocalMap,
+                         LocalMapPermuteDevices,
+                         testing::ValuesIn(PermuteDevices::TestCases()));
+
+TEST_P(LocalMapPermuteDevices, InsertAndRemove) {
+    core::Device device = GetParam();
+    t::pipelines::slam::LocalMap local_map(1.0, 2, core::Float32, device);
+
+    // Three points in voxel (0, 0, 0), one in voxel (1, 0, 0).
+    local_map.Insert(t::geometry::PointCloud(
+            core::Tensor::Init<float>({{0.1, 0.1, 0.1},
+                                       {0.2, 0.2, 0.2},
+                                       {0.3, 0.3, 0.3},
+                                       {1.5, 0.5, 0.5}},
+                                      device)));
+    EXPECT_EQ(local_map.Size(), 2);
+    EXPECT_EQ(local_map.GetNumPoints(), 3);
+
+    // The full voxel drops the new point, the other one takes it.
+    local_map.Insert(t::geometry::PointCloud(core::Tensor::Init<float>(
+            {{0.4, 0.4, 0.4}, {1.6, 0.5, 0.5}}, device)));
+    EXPECT_EQ(local_map.GetNumPoints(), 4);
+    core::Tensor points = local_map.GetPointCloud().GetPointPositions();
+    core::Tensor sums = points.Sum({1});
+    EXPECT_EQ(sums.Lt(0.65).To(core::Int64).Sum({0}).Item<int64_t>(), 2);
+    EXPECT_FALSE(points.Gt(0.35).LogicalAnd(points.Lt(0.45)).Any());
+
+    // Frames are inserted in map coordinates.
+    core::Tensor frame_to_map = core::Tensor::Eye(4, core::Float64,
+                                                  core::Device("CPU:0"));
+    frame_to_map[0][3] = 5.0;
+    local_map.Insert(t::geometry::PointCloud(core::Tensor::Init<float>(
+                             {{0.5, 0.5, 0.5}}, device)),
+                     frame_to_map);
+    EXPECT_EQ(local_map.Size(), 3);
+    EXPECT_EQ(local_map.GetNumPoints(), 5);
+
+    local_map.RemoveFarVoxels(core::Tensor::Init<double>({0, 0, 0}), 3.0);
+    EXPECT_EQ(local_map.Size(), 2);
+    EXPECT_EQ(local_map.GetNumPoints(), 4);
+    EXPECT_TRUE(local_map.GetPointCloud().GetPointPositions().Lt(2.0).All());
+
+    local_map.Clear();
+    EXPECT_EQ(local_map.Size(), 0);
+    EXPECT_EQ(local_map.GetPointCloud().GetPointPositions().GetLength(), 0);
+}
+
+TEST_P(LocalMapPermuteDevices, ICPTarget) {
+    core::Device device = GetParam();
+
+    // Grid points on three orthogonal planes, which constrain all the degrees
+    // of freedom of point to point ICP.
+    std::vector<float> values;
+    for (int i = 0; i < 20; ++i) {
+        for (int j = 0; j < 20; ++j) {
+            const float u = 0.1f * i, v = 0.1f * j;
+            values.insert(values.end(), {u, v, 0.f, u, 0.f, v, 0.f, u, v});
+        }
+    }
+    const int64_t num_points = static_cast<int64_t>(values.size()) / 3;
+    t::geometry::PointCloud frame(
+            core::Tensor(values, {num_points, 3}, core::Float32, device));
+
+    t::pipelines::slam::LocalMap local_map(0.25, 30, core::Float32, device);
+    local_map.Insert(frame);
+    EXPECT_EQ(local_map.GetNumPoints(), num_points);
+
+    const t_reg::ICPTargetPyramid &target = local_map.GetICPTarget(0.1);
+    EXPECT_EQ(&target, &local_map.GetICPTarget(0.1));
+    EXPECT_EQ(target.GetPointCloud(0).GetPointPositions().GetLength(),
+              local_map.GetNumPoints());
+
+    core::Tensor frame_to_map = core::Tensor::Eye(4, core::Float64,
+                                                  core::Device("CPU:0"));
+    frame_to_map[0][3] = 0.03;
+    frame_to_map[1][3] = -0.02;
+    t::geometry::PointCloud source = frame.Clone();
+    source.Transform(t::geometry::InverseTransformation(frame_to_map));
+    t_reg::RegistrationResult result = t_reg::MultiScaleICP(
+            source, target, {t_reg::ICPConvergenceCriteria(1e-9, 1e-9, 50)});
+    EXPECT_TRUE(result.transformation_.AllClose(frame_to_map, 1e-4, 1e-4));
+}
+
+}  // namespace tests
+}  // namespace open3d
@@ -0,0 +1,132 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/pipelines/slam/LoopClosureDetector.h"
+
+#include <cmath>
+
+#include "core/CoreTest.h"
+#include "open3d/core/Tensor.h"
+#include "tests/Tests.h"
+
+namespace open3d {
+namespace tests {
+
+class LoopClosureDetectorPermuteDevices : public PermuteDevices {};
+INSTANTIATE_TEST_SUITE_P(LoopClosureDetector,
+                         LoopClosureDetectorPermuteDevices,
+                         testing::ValuesIn(PermuteDevices::TestCases()));
+
+static const int kHeight = 120;
+static const int kWidth = 160;
+
+// UInt16 depth image in millimeters of a pyramid pointing towards the camera
+// (scene 0), of a pyramid pointing away (scene 1) or of a tilted plane (scene
+// 2). The pyramid faces constrain all the degrees of freedom of point to
+// plane ICP.
+static t::geometry::RGBDImage CreateScene(int scene,
+                                          const core::Device& device) {
+    std::vector<uint16_t> depth(kHeight * kWidth);
+    for (int v = 0; v < kHeight; ++v) {
+        for (int u = 0; u < kWidth; ++u) {
+            const float x = (u - kWidth / 2) / 100.0f;
+            const float y = (v - kHeight / 2) / 100.0f;
+            float z;
+            if (scene == 0) {
+                z = 1.0f + 0.5f * (std::abs(x) + std::abs(y));
+            } else if (scene == 1) {
+                z = 1.7f - 0.5f * (std::abs(x) + std::abs(y));
+            } else {
+                z = 1.2f + 0.5f * x;
+            }
+            depth[v * kWidth + u] = static_cast<uint16_t>(z * 1000.0f);
+        }
+    }
+    t::geometry::RGBDImage rgbd;
+    rgbd.depth_ = t::geometry::Image(
+            core::Tensor(depth, {kHeight, kWidth, 1}, core::UInt16, device));
+    return rgbd;
+}
+
+TEST_P(LoopClosureDetectorPermuteDevices, DetectLoopClosures) {
+    core::Device device = GetParam();
+    const core::Tensor intrinsics = core::Tensor::Init<double>(
+            {{100, 0, kWidth / 2}, {0, 100, kHeight / 2}, {0, 0, 1}});
+    const core::Tensor pose =
+            core::Tensor::Eye(4, core::Float64, core::Device("CPU:0"));
+
+    t::pipelines::slam::LoopClosureParams params(16, 12, 5, 0.8, 2, 0.02,
+                                                 0.05, 0.5);
+    t::pipelines::slam::LoopClosureDetector detector(intrinsics, params,
+                                                     device);
+
+    // Identical scenes have identical unit length descriptors.
+    const core::Tensor descriptor =
+            detector.ComputeDescriptor(CreateScene(0, device));
+    EXPECT_EQ(descriptor.GetShape(), core::SizeVector({2 * 16 * 12}));
+    EXPECT_NEAR((descriptor * descriptor).Sum({0}).Item<float>(), 1.0, 1e-4);
+
+    for (int scene : {0, 1, 2, 1, 0}) {
+        detector.AddKeyframe(CreateScene(scene, device), pose);
+    }
+    EXPECT_EQ(detector.GetNumKeyframes(), 5);
+    EXPECT_TRUE(detector.GetKeyframePointCloud(0).HasPointNormals());
+
+    // The two most recent keyframes are excluded, and the inverted pyramid is
+    // dissimilar.
+    const std::vector<std::pair<int, float>> candidates =
+            detector.GetCandidates(4);
+    ASSERT_EQ(candidates.size(), 1u);
+    EXPECT_EQ(candidates[0].first, 0);
+    EXPECT_NEAR(candidates[0].second, 1.0, 1e-4);
+    EXPECT_TRUE(detector.GetCandidates(1).empty());
+
+    const std::vector<t::pipelines::slam::LoopClosure> loop_closures =
+            detector.DetectLoopClosures(4);
+    ASSERT_EQ(loop_closures.size(), 1u);
+    EXPECT_EQ(loop_closures[0].source_id_, 0);
+    EXPECT_EQ(loop_closures[0].target_id_, 4);
+    EXPECT_GT(loop_closures[0].result_.fitness_, 0.9);
+    EXPECT_TRUE(loop_closures[0].result_.transformation_.AllClose(pose, 1e-3,
+                                                                  1e-3));
+
+    // Odometry edges between consecutive keyframes, then the loop closure.
+    const t::pipelines::slam::PoseGraph& pose_graph = detector.GetPoseGraph();
+    EXPECT_EQ(pose_graph.nodes_.size(), 5u);
+    ASSERT_EQ(pose_graph.edges_.size(), 5u);
+    EXPECT_FALSE(pose_graph.edges_[3].uncertain_);
+    EXPECT_EQ(pose_graph.edges_[4].source_node_id_, 0);
+    EXPECT_EQ(pose_graph.edges_[4].target_node_id_, 4);
+    EXPECT_TRUE(pose_graph.edges_[4].uncertain_);
+
+    t::pipelines::slam::PoseGraph optimized = pose_graph;
+    optimized.nodes_[2].pose_(0, 3) = 0.5;
+    detector.UpdateKeyframePoses(optimized);
+    EXPECT_DOUBLE_EQ(detector.GetKeyframePose(2)[0][3].Item<double>(), 0.5);
+}
+
+}  // namespace tests
+}  // namespace open3d
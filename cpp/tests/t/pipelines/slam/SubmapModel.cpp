@@ -0,0 +1,128 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/pipelines/slam/SubmapModel.h"
+
+#include "core/CoreTest.h"
+#include "open3d/camera/PinholeCameraIntrinsic.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/data/Dataset.h"
+#include "open3d/t/io/ImageIO.h"
+#include "open3d/utility/FileSystem.h"
+#include "tests/Tests.h"
+
+namespace open3d {
+namespace tests {
+
+class SubmapModelPermuteDevices : public PermuteDevices {};
+INSTANTIATE_TEST_SUITE_P(SubmapModel,
+                         SubmapModelPermuteDevices,
+                         testing::ValuesIn(PermuteDevices::TestCases()));
+
+static float GetMaxX(const t::geometry::PointCloud& pcd) {
+    return pcd.GetPointPositions()
+            .Slice(1, 0, 1)
+            .Max({0, 1})
+            .To(core::Float32)
+            .Item<float>();
+}
+
+TEST_P(SubmapModelPermuteDevices, ReanchorAndOffload) {
+    core::Device device = GetParam();
+
+    camera::PinholeCameraIntrinsic intrinsic = camera::PinholeCameraIntrinsic(
+            camera::PinholeCameraIntrinsicParameters::PrimeSenseDefault);
+    auto focal_length = intrinsic.GetFocalLength();
+    auto principal_point = intrinsic.GetPrincipalPoint();
+    core::Tensor intrinsic_t = core::Tensor::Init<double>(
+            {{focal_length.first, 0, principal_point.first},
+             {0, focal_length.second, principal_point.second},
+             {0, 0, 1}});
+
+    data::SampleRedwoodRGBDImages redwood_data;
+    t::geometry::Image depth =
+            *t::io::CreateImageFromFile(redwood_data.GetDepthPaths()[0]);
+    t::geometry::Image color =
+            *t::io::CreateImageFromFile(redwood_data.GetColorPaths()[0]);
+    t::pipelines::slam::Frame frame(depth.GetRows(), depth.GetCols(),
+                                    intrinsic_t, device);
+    frame.SetDataFromImage("depth", depth);
+    frame.SetDataFromImage("color", color);
+
+    const core::Tensor identity =
+            core::Tensor::Eye(4, core::Float64, core::Device("CPU:0"));
+    t::pipelines::slam::SubmapModel model(3.0 / 512, 16, 10000, identity,
+                                          device);
+
+    // The same frame is integrated into two submaps.
+    model.UpdateFramePose(0, identity);
+    model.Integrate(frame, 1000.0, 3.0);
+    model.UpdateFramePose(1, identity);
+    EXPECT_EQ(model.StartNewSubmap(), 1);
+    model.Integrate(frame, 1000.0, 3.0);
+    EXPECT_EQ(model.GetNumSubmaps(), 2);
+    EXPECT_EQ(model.GetFrameSubmapId(0), 0);
+    EXPECT_EQ(model.GetFrameSubmapId(1), 1);
+
+    const t::geometry::PointCloud submap_pcd =
+            model.GetSubmap(0).ExtractPointCloud(0.0f);
+    const int64_t num_submap_points =
+            submap_pcd.GetPointPositions().GetLength();
+    EXPECT_GT(num_submap_points, 0);
+    EXPECT_EQ(model.ExtractPointCloud(0.0f).GetPointPositions().GetLength(),
+              2 * num_submap_points);
+
+    // Re-anchoring moves the surface and the frames of the submap.
+    core::Tensor T_submap_to_world = identity.Clone();
+    T_submap_to_world[0][3] = 1.0;
+    model.SetSubmapPose(1, T_submap_to_world);
+    EXPECT_DOUBLE_EQ(model.GetFramePose(1)[0][3].Item<double>(), 1.0);
+    EXPECT_DOUBLE_EQ(model.GetFramePose(0)[0][3].Item<double>(), 0.0);
+    EXPECT_DOUBLE_EQ(model.GetCurrentFramePose()[0][3].Item<double>(), 1.0);
+    EXPECT_NEAR(GetMaxX(model.ExtractPointCloud(0.0f)),
+                GetMaxX(submap_pcd) + 1.0, 1e-4);
+
+    // An offloaded submap is still extracted.
+    const std::string file_name = "tmp_submap.npz";
+    EXPECT_ANY_THROW(model.OffloadSubmap(1, file_name));
+    model.OffloadSubmap(0, file_name);
+    EXPECT_TRUE(model.IsSubmapOffloaded(0));
+    EXPECT_EQ(model.ExtractPointCloud(0.0f).GetPointPositions().GetLength(),
+              2 * num_submap_points);
+    EXPECT_GT(model.ExtractTriangleMesh(0.0f).GetTriangleIndices().GetLength(),
+              0);
+
+    model.ReloadSubmap(0);
+    EXPECT_FALSE(model.IsSubmapOffloaded(0));
+    EXPECT_EQ(model.GetSubmap(0).ExtractPointCloud(0.0f)
+                      .GetPointPositions()
+                      .GetLength(),
+              num_submap_points);
+    utility::filesystem::RemoveFile(file_name);
+}
+
+}  // namespace tests
+}  // namespace open3d
@@ -0,0 +1,108 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/utility/Cancellation.h"
+
+#include <thread>
+#include <vector>
+
+#include "tests/Tests.h"
+
+namespace open3d {
+namespace tests {
+
+using utility::CancellationToken;
+using utility::CancelledError;
+using utility::OperationContext;
+using utility::ScopedOperationContext;
+
+TEST(Cancellation, TokenCopiesShareFlag) {
+    CancellationToken token;
+    CancellationToken copy = token;
+    EXPECT_FALSE(copy.IsCancelled());
+    std::thread([token]() mutable { token.Cancel(); }).join();
+    EXPECT_TRUE(token.IsCancelled());
+    EXPECT_TRUE(copy.IsCancelled());
+}
+
+TEST(Cancellation, DefaultContext) {
+    OperationContext context = OperationContext::Current();
+    EXPECT_FALSE(context.IsCancelled());
+    EXPECT_NO_THROW(context.ThrowIfCancelled("Default"));
+    EXPECT_NO_THROW(context.ReportProgress(50));
+}
+
+TEST(Cancellation, ScopedContext) {
+    CancellationToken outer_token;
+    CancellationToken inner_token;
+    {
+        ScopedOperationContext outer(outer_token);
+        {
+            ScopedOperationContext inner(inner_token);
+            inner_token.Cancel();
+            EXPECT_TRUE(OperationContext::Current().IsCancelled());
+            EXPECT_THROW(OperationContext::Current().ThrowIfCancelled("Op"),
+                         CancelledError);
+        }
+        // The outer context is restored.
+        EXPECT_FALSE(OperationContext::Current().IsCancelled());
+        // Other threads are not affected.
+        outer_token.Cancel();
+        bool cancelled_on_thread = true;
+        std::thread([&cancelled_on_thread]() {
+            cancelled_on_thread = OperationContext::Current().IsCancelled();
+        }).join();
+        EXPECT_FALSE(cancelled_on_thread);
+        EXPECT_TRUE(OperationContext::Current().IsCancelled());
+    }
+    EXPECT_FALSE(OperationContext::Current().IsCancelled());
+}
+
+TEST(Cancellation, ProgressCallback) {
+    CancellationToken token;
+    std::vector<double> reported;
+    ScopedOperationContext scope(token, [&reported](double percent) {
+        reported.push_back(percent);
+        return percent < 50;
+    });
+    OperationContext context = OperationContext::Current();
+    context.ReportProgress(10);
+    EXPECT_FALSE(token.IsCancelled());
+    context.ReportProgress(50);
+    EXPECT_TRUE(token.IsCancelled());
+    EXPECT_EQ(reported, std::vector<double>({10, 50}));
+
+    try {
+        context.ThrowIfCancelled("ProgressCallback");
+        FAIL() << "CancelledError expected.";
+    } catch (const CancelledError& e) {
+        EXPECT_STREQ(e.what(), "ProgressCallback was cancelled.");
+    }
+}
+
+}  // namespace tests
+}  // namespace open3d
@@ -27,6 +27,7 @@
 #include "open3d/utility/ISAInfo.h"
 
 #include "open3d/utility/Logging.h"
+#include "open3d/utility/Preprocessor.h"
 #include "tests/Tests.h"
 
 namespace open3d {
@@ -37,5 +38,17 @@ TEST(ISAInfo, GetSelectedISATarget) {
               utility::ISATarget::UNKNOWN);
 }
 
+TEST(ISAInfo, GetSelectedCPUTarget) {
+    const utility::ISATarget target =
+            utility::ISAInfo::GetInstance().SelectedCPUTarget();
+#ifdef OPEN3D_TARGET_CLONES_ENABLED
+    EXPECT_TRUE(target == utility::ISATarget::SSE2 ||
+                target == utility::ISATarget::AVX2 ||
+                target == utility::ISATarget::AVX512SKX);
+#else
+    EXPECT_EQ(target, utility::ISATarget::DISABLED);
+#endif
+}
+
 }  // namespace tests
 }  // namespace open3d
@@ -0,0 +1,88 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/utility/Parallel.h"
+
+#include <tbb/parallel_for.h>
+
+#include <atomic>
+
+#include "tests/Tests.h"
+
+namespace open3d {
+namespace tests {
+
+TEST(Parallel, SetMaxThreads) {
+    utility::SetMaxThreads(3);
+    EXPECT_EQ(utility::EstimateMaxThreads(), 3);
+    EXPECT_EQ(utility::GetTaskArena().max_concurrency(), 3);
+
+    utility::SetMaxThreads(0);
+    EXPECT_GE(utility::EstimateMaxThreads(), 1);
+}
+
+TEST(Parallel, ScopedParallelRegion) {
+    EXPECT_FALSE(utility::InParallel());
+    {
+        utility::ScopedParallelRegion region;
+        EXPECT_TRUE(utility::InParallel());
+        EXPECT_EQ(utility::EstimateMaxThreads(), 1);
+    }
+    EXPECT_FALSE(utility::InParallel());
+}
+
+TEST(Parallel, ExecuteInArena) {
+    std::atomic<int> count(0);
+    utility::ExecuteInArena([&]() {
+        tbb::parallel_for(0, 1000, [&](int) { ++count; });
+    });
+    EXPECT_EQ(count.load(), 1000);
+
+    // Nested calls run on the calling thread.
+    utility::ScopedParallelRegion region;
+    bool called = false;
+    utility::ExecuteInArena([&]() { called = true; });
+    EXPECT_TRUE(called);
+}
+
+TEST(Parallel, SetTaskArena) {
+    tbb::task_arena arena(2);
+    utility::SetTaskArena(&arena);
+    EXPECT_EQ(&utility::GetTaskArena(), &arena);
+
+    std::atomic<int> count(0);
+    utility::ExecuteInArena([&]() {
+        EXPECT_EQ(tbb::this_task_arena::max_concurrency(), 2);
+        tbb::parallel_for(0, 1000, [&](int) { ++count; });
+    });
+    EXPECT_EQ(count.load(), 1000);
+
+    utility::SetTaskArena(nullptr);
+    EXPECT_NE(&utility::GetTaskArena(), &arena);
+}
+
+}  // namespace tests
+}  // namespace open3d
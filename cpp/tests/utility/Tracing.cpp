@@ -0,0 +1,84 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/utility/Tracing.h"
+
+#include <string>
+
+#include "tests/Tests.h"
+
+namespace open3d {
+namespace tests {
+
+TEST(Tracing, RecordZones) {
+    utility::tracing::Clear();
+    {
+        OPEN3D_TRACE_ZONE("Tracing::Disabled");
+    }
+    EXPECT_EQ(utility::tracing::GetNumEvents(), 0);
+
+    utility::tracing::Enable();
+    EXPECT_TRUE(utility::tracing::IsEnabled());
+    {
+        OPEN3D_TRACE_ZONE("Tracing::Outer");
+        OPEN3D_TRACE_ZONE("Tracing::Inner");
+    }
+    utility::tracing::Disable();
+    EXPECT_FALSE(utility::tracing::IsEnabled());
+    {
+        OPEN3D_TRACE_ZONE("Tracing::Disabled");
+    }
+    EXPECT_EQ(utility::tracing::GetNumEvents(), 2);
+    EXPECT_EQ(utility::tracing::GetNumDroppedEvents(), 0);
+
+    const std::string trace = utility::tracing::GetChromeTrace();
+    EXPECT_NE(trace.find("\"traceEvents\""), std::string::npos);
+    EXPECT_NE(trace.find("\"Tracing::Outer\""), std::string::npos);
+    EXPECT_NE(trace.find("\"Tracing::Inner\""), std::string::npos);
+    EXPECT_EQ(trace.find("\"Tracing::Disabled\""), std::string::npos);
+
+    utility::tracing::Clear();
+    EXPECT_EQ(utility::tracing::GetNumEvents(), 0);
+}
+
+TEST(Tracing, MaxEvents) {
+    utility::tracing::Clear();
+    utility::tracing::Enable(false, 2);
+    for (int i = 0; i < 5; ++i) {
+        OPEN3D_TRACE_ZONE("Tracing::Loop");
+    }
+    utility::tracing::Disable();
+    EXPECT_EQ(utility::tracing::GetNumEvents(), 2);
+    EXPECT_EQ(utility::tracing::GetNumDroppedEvents(), 3);
+
+    utility::tracing::Clear();
+    EXPECT_EQ(utility::tracing::GetNumDroppedEvents(), 0);
+    EXPECT_ANY_THROW(utility::tracing::Enable(false, 0));
+}
+
+}  // namespace tests
+}  // namespace open3d
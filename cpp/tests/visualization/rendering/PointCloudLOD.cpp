@@ -0,0 +1,177 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/visualization/rendering/PointCloudLOD.h"
+
+#include <Eigen/Geometry>
+#include <numeric>
+
+#include "tests/Tests.h"
+
+namespace open3d {
+namespace tests {
+
+namespace {
+
+t::geometry::PointCloud CreateGridCloud(int n) {
+    std::vector<float> positions;
+    std::vector<float> colors;
+    for (int x = 0; x < n; ++x) {
+        for (int y = 0; y < n; ++y) {
+            for (int z = 0; z < n; ++z) {
+                positions.insert(positions.end(),
+                                 {float(x), float(y), float(z)});
+                colors.insert(colors.end(), {float(x) / n, 0.f, 0.f});
+            }
+        }
+    }
+    const int64_t num_points = static_cast<int64_t>(n) * n * n;
+    t::geometry::PointCloud cloud(
+            core::Tensor(positions, {num_points, 3}, core::Float32));
+    cloud.SetPointColors(core::Tensor(colors, {num_points, 3}, core::Float32));
+    return cloud;
+}
+
+Eigen::Matrix4d Perspective(double fov_y, double aspect) {
+    const double f = 1.0 / std::tan(0.5 * fov_y);
+    const double near = 0.1, far = 1e7;
+    Eigen::Matrix4d projection = Eigen::Matrix4d::Zero();
+    projection(0, 0) = f / aspect;
+    projection(1, 1) = f;
+    projection(2, 2) = (far + near) / (near - far);
+    projection(2, 3) = 2 * far * near / (near - far);
+    projection(3, 2) = -1;
+    return projection;
+}
+
+}  // namespace
+
+TEST(PointCloudLOD, Build) {
+    const t::geometry::PointCloud cloud = CreateGridCloud(32);
+    visualization::rendering::PointCloudLOD::Options options;
+    options.max_points_per_node_ = 1000;
+    options.grid_resolution_ = 8;
+    visualization::rendering::PointCloudLOD lod(cloud, options);
+    const auto& nodes = lod.GetNodes();
+    EXPECT_GT(nodes.size(), 1);
+    EXPECT_EQ(lod.NumPoints(), 32 * 32 * 32);
+
+    // The point order is a permutation and the nodes partition it.
+    std::vector<int64_t> order = lod.GetPointOrder().ToFlatVector<int64_t>();
+    std::sort(order.begin(), order.end());
+    std::vector<int64_t> expected(order.size());
+    std::iota(expected.begin(), expected.end(), 0);
+    EXPECT_EQ(order, expected);
+    int64_t offset = 0;
+    for (const auto& node : nodes) {
+        EXPECT_EQ(node.offset_, offset);
+        offset += node.num_points_;
+        // Inner nodes keep at most one point per grid cell.
+        if (!node.IsLeaf()) {
+            EXPECT_LE(node.num_points_, 8 * 8 * 8);
+        } else {
+            EXPECT_LE(node.num_points_, options.max_points_per_node_);
+        }
+        for (int child : node.children_) {
+            if (child >= 0) {
+                EXPECT_EQ(nodes[child].depth_, node.depth_ + 1);
+                EXPECT_DOUBLE_EQ(nodes[child].spacing_, 0.5 * node.spacing_);
+            }
+        }
+    }
+    EXPECT_EQ(offset, lod.NumPoints());
+
+    // Chunks carry all point attributes and lie inside their nodes.
+    const t::geometry::PointCloud chunk = lod.GetNodePointCloud(1);
+    EXPECT_EQ(chunk.GetPointPositions().GetLength(), nodes[1].num_points_);
+    EXPECT_TRUE(chunk.HasPointColors());
+    const core::Tensor min_bound = chunk.GetPointPositions().Min({0});
+    const core::Tensor max_bound = chunk.GetPointPositions().Max({0});
+    for (int axis = 0; axis < 3; ++axis) {
+        EXPECT_GE(min_bound[axis].Item<float>(),
+                  nodes[1].bounds_.min_bound_(axis));
+        EXPECT_LE(max_bound[axis].Item<float>(),
+                  nodes[1].bounds_.max_bound_(axis));
+    }
+}
+
+TEST(PointCloudLOD, SelectNodes) {
+    const t::geometry::PointCloud cloud = CreateGridCloud(32);
+    visualization::rendering::PointCloudLOD::Options options;
+    options.max_points_per_node_ = 1000;
+    options.grid_resolution_ = 8;
+    visualization::rendering::PointCloudLOD lod(cloud, options);
+    const Eigen::Matrix4d projection = Perspective(M_PI / 3, 1.0);
+
+    auto look_from = [](const Eigen::Vector3d& eye) {
+        const Eigen::Vector3d center(15.5, 15.5, 15.5);
+        const Eigen::Vector3d forward = (center - eye).normalized();
+        const Eigen::Vector3d right =
+                forward.cross(Eigen::Vector3d::UnitY()).normalized();
+        const Eigen::Vector3d up = right.cross(forward);
+        Eigen::Matrix4d view = Eigen::Matrix4d::Identity();
+        view.block<1, 3>(0, 0) = right.transpose();
+        view.block<1, 3>(1, 0) = up.transpose();
+        view.block<1, 3>(2, 0) = -forward.transpose();
+        view.block<3, 1>(0, 3) = -view.topLeftCorner<3, 3>() * eye;
+        return view;
+    };
+    auto num_points = [&](const std::vector<int>& selected) {
+        int64_t n = 0;
+        for (int id : selected) n += lod.GetNodes()[id].num_points_;
+        return n;
+    };
+
+    // Far away, the root alone is accurate enough.
+    const Eigen::Matrix4d far_view = look_from({15.5, 15.5, 100000.0});
+    std::vector<int> selected =
+            lod.SelectNodes(far_view, projection, 1000, 1.0, 1 << 30);
+    EXPECT_EQ(selected, std::vector<int>({0}));
+
+    // Close up, the visible part is refined to the leaves.
+    const Eigen::Matrix4d near_view = look_from({15.5, 15.5, 40.0});
+    selected = lod.SelectNodes(near_view, projection, 1000, 1.0, 1 << 30);
+    EXPECT_GT(selected.size(), 1);
+    EXPECT_EQ(selected[0], 0);
+    const int64_t all_selected = num_points(selected);
+
+    // The point budget limits the refinement.
+    selected = lod.SelectNodes(near_view, projection, 1000, 1.0,
+                               all_selected / 2);
+    EXPECT_LE(num_points(selected), all_selected / 2);
+    EXPECT_GE(selected.size(), 1);
+
+    // Looking away from the cloud selects nothing.
+    const Eigen::Matrix4d away_view =
+            Eigen::Affine3d(Eigen::AngleAxisd(M_PI, Eigen::Vector3d::UnitY()))
+                    .matrix() *
+            near_view;
+    EXPECT_TRUE(lod.SelectNodes(away_view, projection, 1000, 1.0, 1 << 30)
+                        .empty());
+}
+
+}  // namespace tests
+}  // namespace open3d
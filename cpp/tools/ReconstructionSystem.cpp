@@ -0,0 +1,616 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <algorithm>
+#include <cstdio>
+#include <vector>
+
+#ifndef _WIN32
+#include <sys/resource.h>
+#endif
+
+#include "open3d/Open3D.h"
+#include "open3d/pipelines/registration/GlobalOptimization.h"
+
+using namespace open3d;
+using pipelines::registration::PoseGraph;
+using pipelines::registration::PoseGraphEdge;
+using pipelines::registration::PoseGraphNode;
+
+void PrintHelp() {
+    PrintOpen3DVersion();
+    // clang-format off
+    utility::LogInfo("Usage:");
+    utility::LogInfo("    > ReconstructionSystem dataset_folder [options]");
+    utility::LogInfo("      Reconstruct a scene from the color images in <dataset_folder>/image, rgb or");
+    utility::LogInfo("      color and the depth images in <dataset_folder>/depth. Fragments are made,");
+    utility::LogInfo("      registered, refined and the whole sequence is integrated as in");
+    utility::LogInfo("      examples/python/reconstruction_system, without intermediate files.");
+    utility::LogInfo("");
+    utility::LogInfo("Options:");
+    utility::LogInfo("    --help, -h                : Print help information.");
+    utility::LogInfo("    --verbose n               : Set verbose level (0-4).");
+    utility::LogInfo("    --output_folder           : [default: <dataset_folder>/scene]");
+    utility::LogInfo("    --intrinsic_path          : [default: PrimeSense intrinsic]");
+    utility::LogInfo("    --n_frames_per_fragment   : [=100]");
+    utility::LogInfo("    --n_keyframes_per_n_frame : [=5]");
+    utility::LogInfo("    --depth_scale             : [=1000.0]");
+    utility::LogInfo("    --max_depth               : [=3.0 (m)]");
+    utility::LogInfo("    --max_depth_diff          : [=0.07 (m)]");
+    utility::LogInfo("    --voxel_size              : [=0.05 (m)]");
+    utility::LogInfo("    --tsdf_cubic_size         : [=3.0 (m)]");
+    utility::LogInfo("    --sdf_trunc               : [=0.04 (m)]");
+    utility::LogInfo("    --preference_loop_closure_odometry     : [=0.1]");
+    utility::LogInfo("    --preference_loop_closure_registration : [=5.0]");
+    utility::LogInfo("    --write_fragments         : Also write the fragment point clouds and pose");
+    utility::LogInfo("                                graphs, e.g. for SLAC.");
+    // clang-format on
+}
+
+struct Config {
+    std::string output_folder;
+    camera::PinholeCameraIntrinsic intrinsic;
+    int n_frames_per_fragment = 100;
+    int n_keyframes_per_n_frame = 5;
+    double depth_scale = 1000.0;
+    double max_depth = 3.0;
+    double max_depth_diff = 0.07;
+    double voxel_size = 0.05;
+    double tsdf_cubic_size = 3.0;
+    double sdf_trunc = 0.04;
+    double preference_loop_closure_odometry = 0.1;
+    double preference_loop_closure_registration = 5.0;
+};
+
+struct Fragment {
+    /// Optimized poses of the frames relative to the first frame.
+    PoseGraph pose_graph_;
+    std::shared_ptr<geometry::PointCloud> pcd_;
+    std::shared_ptr<geometry::PointCloud> pcd_down_;
+    std::shared_ptr<pipelines::registration::Feature> fpfh_;
+};
+
+struct PairResult {
+    int s_ = 0;
+    int t_ = 0;
+    bool success_ = false;
+    Eigen::Matrix4d transformation_ = Eigen::Matrix4d::Identity();
+    Eigen::Matrix6d information_ = Eigen::Matrix6d::Identity();
+};
+
+/// Wall time, number of processed items and process peak resident memory
+/// after a stage.
+struct StageReport {
+    std::string name_;
+    double seconds_ = 0;
+    int64_t items_ = 0;
+    std::string item_name_;
+    double peak_memory_mb_ = 0;
+};
+
+/// Peak resident set size of the process in MB, or 0 where unsupported.
+double GetPeakMemoryMB() {
+#ifdef _WIN32
+    return 0;
+#else
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0) {
+        return 0;
+    }
+#ifdef __APPLE__
+    return usage.ru_maxrss / (1024.0 * 1024.0);
+#else
+    return usage.ru_maxrss / 1024.0;
+#endif
+#endif
+}
+
+template <typename Func>
+StageReport RunStage(const std::string &name,
+                     int64_t items,
+                     const std::string &item_name,
+                     Func func) {
+    utility::LogInfo("[ReconstructionSystem] {} ...", name);
+    utility::Timer timer;
+    timer.Start();
+    func();
+    timer.Stop();
+    StageReport report;
+    report.name_ = name;
+    report.seconds_ = timer.GetDuration() / 1000.0;
+    report.items_ = items;
+    report.item_name_ = item_name;
+    report.peak_memory_mb_ = GetPeakMemoryMB();
+    utility::LogInfo("[ReconstructionSystem] {} took {:.2f} s.", name,
+                     report.seconds_);
+    return report;
+}
+
+std::vector<std::string> ListSortedFiles(const std::string &folder,
+                                         const std::string &extension) {
+    std::vector<std::string> filenames;
+    utility::filesystem::ListFilesInDirectoryWithExtension(folder, extension,
+                                                           filenames);
+    std::sort(filenames.begin(), filenames.end());
+    return filenames;
+}
+
+std::shared_ptr<geometry::RGBDImage> CreateRGBDImage(
+        const geometry::Image &color,
+        const geometry::Image &depth,
+        bool convert_rgb_to_intensity,
+        const Config &config) {
+    return geometry::RGBDImage::CreateFromColorAndDepth(
+            color, depth, config.depth_scale, config.max_depth,
+            convert_rgb_to_intensity);
+}
+
+/// Fragment pose graph from RGBD odometry between consecutive frames and
+/// between keyframes, then optimized, and the point cloud of the fragment
+/// integrated with the optimized poses. The frames are read once and kept in
+/// memory while the fragment is processed.
+Fragment MakeFragment(const std::vector<std::string> &color_files,
+                      const std::vector<std::string> &depth_files,
+                      int sid,
+                      int eid,
+                      const Config &config) {
+    std::vector<geometry::Image> colors(eid - sid), depths(eid - sid);
+    for (int i = sid; i < eid; ++i) {
+        io::ReadImage(color_files[i], colors[i - sid]);
+        io::ReadImage(depth_files[i], depths[i - sid]);
+    }
+
+    pipelines::odometry::OdometryOption option;
+    option.max_depth_diff_ = config.max_depth_diff;
+    const pipelines::odometry::RGBDOdometryJacobianFromHybridTerm jacobian;
+
+    Fragment fragment;
+    PoseGraph &pose_graph = fragment.pose_graph_;
+    Eigen::Matrix4d trans_odometry = Eigen::Matrix4d::Identity();
+    pose_graph.nodes_.push_back(PoseGraphNode(trans_odometry));
+    std::vector<std::shared_ptr<geometry::RGBDImage>> keyframes(eid - sid);
+    auto source = CreateRGBDImage(colors[0], depths[0], true, config);
+    for (int s = sid; s < eid; ++s) {
+        if (s % config.n_keyframes_per_n_frame == 0) {
+            keyframes[s - sid] = source;
+        }
+        if (s + 1 == eid) {
+            break;
+        }
+        auto target = CreateRGBDImage(colors[s + 1 - sid], depths[s + 1 - sid],
+                                      true, config);
+        bool success;
+        Eigen::Matrix4d trans;
+        Eigen::Matrix6d info;
+        std::tie(success, trans, info) =
+                pipelines::odometry::ComputeRGBDOdometry(
+                        *source, *target, config.intrinsic,
+                        Eigen::Matrix4d::Identity(), jacobian, option);
+        trans_odometry = trans * trans_odometry;
+        pose_graph.nodes_.push_back(PoseGraphNode(trans_odometry.inverse()));
+        pose_graph.edges_.push_back(PoseGraphEdge(s - sid, s + 1 - sid, trans,
+                                                  info, /*uncertain=*/false));
+        source = target;
+    }
+
+    // Keyframe loop closures. The chained odometry initializes the matching,
+    // instead of the five-point estimate of the python scripts, which need
+    // OpenCV.
+    for (int s = sid; s < eid; ++s) {
+        for (int t = s + 1; t < eid; ++t) {
+            if (!keyframes[s - sid] || !keyframes[t - sid]) {
+                continue;
+            }
+            const Eigen::Matrix4d init =
+                    pose_graph.nodes_[t - sid].pose_.inverse() *
+                    pose_graph.nodes_[s - sid].pose_;
+            bool success;
+            Eigen::Matrix4d trans;
+            Eigen::Matrix6d info;
+            std::tie(success, trans, info) =
+                    pipelines::odometry::ComputeRGBDOdometry(
+                            *keyframes[s - sid], *keyframes[t - sid],
+                            config.intrinsic, init, jacobian, option);
+            if (success) {
+                pose_graph.edges_.push_back(PoseGraphEdge(
+                        s - sid, t - sid, trans, info, /*uncertain=*/true));
+            }
+        }
+    }
+    keyframes.clear();
+
+    pipelines::registration::GlobalOptimization(
+            pose_graph,
+            pipelines::registration::GlobalOptimizationLevenbergMarquardt(),
+            pipelines::registration::GlobalOptimizationConvergenceCriteria(),
+            pipelines::registration::GlobalOptimizationOption(
+                    config.max_depth_diff, 0.25,
+                    config.preference_loop_closure_odometry, 0));
+
+    pipelines::integration::ScalableTSDFVolume volume(
+            config.tsdf_cubic_size / 512.0, config.sdf_trunc,
+            pipelines::integration::TSDFVolumeColorType::RGB8);
+    for (int i = sid; i < eid; ++i) {
+        volume.Integrate(
+                *CreateRGBDImage(colors[i - sid], depths[i - sid], false,
+                                 config),
+                config.intrinsic, pose_graph.nodes_[i - sid].pose_.inverse());
+    }
+    auto mesh = volume.ExtractTriangleMesh();
+    fragment.pcd_ = std::make_shared<geometry::PointCloud>();
+    fragment.pcd_->points_ = std::move(mesh->vertices_);
+    fragment.pcd_->colors_ = std::move(mesh->vertex_colors_);
+    return fragment;
+}
+
+void PreprocessFragment(Fragment &fragment, const Config &config) {
+    const double voxel_size = config.voxel_size;
+    fragment.pcd_down_ = fragment.pcd_->VoxelDownSample(voxel_size);
+    fragment.pcd_down_->EstimateNormals(
+            geometry::KDTreeSearchParamHybrid(voxel_size * 2.0, 30));
+    fragment.fpfh_ = pipelines::registration::ComputeFPFHFeature(
+            *fragment.pcd_down_,
+            geometry::KDTreeSearchParamHybrid(voxel_size * 5.0, 100));
+}
+
+/// Colored ICP from coarse to fine voxel sizes. Returns the transformation
+/// and the information matrix at the finest scale.
+std::pair<Eigen::Matrix4d, Eigen::Matrix6d> MultiscaleICP(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        const std::vector<double> &voxel_sizes,
+        const std::vector<int> &max_iterations,
+        const Eigen::Matrix4d &init) {
+    Eigen::Matrix4d transformation = init;
+    Eigen::Matrix6d information = Eigen::Matrix6d::Identity();
+    for (size_t scale = 0; scale < voxel_sizes.size(); ++scale) {
+        const double voxel_size = voxel_sizes[scale];
+        auto source_down = source.VoxelDownSample(voxel_size);
+        auto target_down = target.VoxelDownSample(voxel_size);
+        const geometry::KDTreeSearchParamHybrid param(voxel_size * 2.0, 30);
+        source_down->EstimateNormals(param);
+        target_down->EstimateNormals(param);
+        const auto result = pipelines::registration::RegistrationColoredICP(
+                *source_down, *target_down, voxel_size, transformation,
+                pipelines::registration::
+                        TransformationEstimationForColoredICP(),
+                pipelines::registration::ICPConvergenceCriteria(
+                        1e-6, 1e-6, max_iterations[scale]));
+        transformation = result.transformation_;
+        if (scale + 1 == voxel_sizes.size()) {
+            information = pipelines::registration::
+                    GetInformationMatrixFromPointClouds(
+                            *source_down, *target_down, voxel_size * 1.4,
+                            transformation);
+        }
+    }
+    return std::make_pair(transformation, information);
+}
+
+/// Initial registration of fragment s to t: ICP initialized by the fragment
+/// odometry for consecutive fragments, global RANSAC on FPFH features for the
+/// others.
+PairResult RegisterFragmentPair(const std::vector<Fragment> &fragments,
+                                int s,
+                                int t,
+                                const Config &config) {
+    PairResult result;
+    result.s_ = s;
+    result.t_ = t;
+    const Fragment &source = fragments[s];
+    const Fragment &target = fragments[t];
+    if (t == s + 1) {
+        const Eigen::Matrix4d init =
+                source.pose_graph_.nodes_.back().pose_.inverse();
+        std::tie(result.transformation_, result.information_) =
+                MultiscaleICP(*source.pcd_down_, *target.pcd_down_,
+                              {config.voxel_size}, {50}, init);
+        result.success_ = true;
+        return result;
+    }
+
+    const double distance_threshold = config.voxel_size * 1.4;
+    const pipelines::registration::CorrespondenceCheckerBasedOnEdgeLength
+            edge_length_checker(0.9);
+    const pipelines::registration::CorrespondenceCheckerBasedOnDistance
+            distance_checker(distance_threshold);
+    const auto ransac = pipelines::registration::
+            RegistrationRANSACBasedOnFeatureMatching(
+                    *source.pcd_down_, *target.pcd_down_, *source.fpfh_,
+                    *target.fpfh_, false, distance_threshold,
+                    pipelines::registration::
+                            TransformationEstimationPointToPoint(false),
+                    4, {edge_length_checker, distance_checker},
+                    pipelines::registration::RANSACConvergenceCriteria(
+                            1000000, 0.999));
+    if (ransac.transformation_.trace() == 4.0) {
+        return result;
+    }
+    const Eigen::Matrix6d information =
+            pipelines::registration::GetInformationMatrixFromPointClouds(
+                    *source.pcd_down_, *target.pcd_down_, distance_threshold,
+                    ransac.transformation_);
+    const double num_points =
+            double(std::min(source.pcd_down_->points_.size(),
+                            target.pcd_down_->points_.size()));
+    if (information(5, 5) / num_points < 0.3) {
+        return result;
+    }
+    result.success_ = true;
+    result.transformation_ = ransac.transformation_;
+    result.information_ = information;
+    return result;
+}
+
+/// Scene pose graph from the successful pair registrations, in the order of
+/// (s, t). Consecutive fragments chain the odometry of the nodes.
+PoseGraph MakeSceneGraph(const std::vector<PairResult> &results) {
+    PoseGraph pose_graph;
+    Eigen::Matrix4d odometry = Eigen::Matrix4d::Identity();
+    pose_graph.nodes_.push_back(PoseGraphNode(odometry));
+    for (const PairResult &result : results) {
+        if (!result.success_) {
+            continue;
+        }
+        const bool uncertain = result.t_ != result.s_ + 1;
+        if (!uncertain) {
+            odometry = result.transformation_ * odometry;
+            pose_graph.nodes_.push_back(PoseGraphNode(odometry.inverse()));
+        }
+        pose_graph.edges_.push_back(
+                PoseGraphEdge(result.s_, result.t_, result.transformation_,
+                              result.information_, uncertain));
+    }
+    return pose_graph;
+}
+
+void OptimizeSceneGraph(PoseGraph &pose_graph, const Config &config) {
+    pipelines::registration::GlobalOptimization(
+            pose_graph,
+            pipelines::registration::GlobalOptimizationLevenbergMarquardt(),
+            pipelines::registration::GlobalOptimizationConvergenceCriteria(),
+            pipelines::registration::GlobalOptimizationOption(
+                    config.voxel_size * 1.4, 0.25,
+                    config.preference_loop_closure_registration, 0));
+}
+
+int main(int argc, char **argv) {
+    utility::SetVerbosityLevel(utility::VerbosityLevel::Debug);
+    if (argc < 2 ||
+        utility::ProgramOptionExistsAny(argc, argv, {"-h", "--help"})) {
+        PrintHelp();
+        return 1;
+    }
+    int verbose = utility::GetProgramOptionAsInt(argc, argv, "--verbose", 2);
+    utility::SetVerbosityLevel((utility::VerbosityLevel)verbose);
+
+    const std::string dataset_folder(argv[1]);
+    Config config;
+    config.output_folder = utility::GetProgramOptionAsString(
+            argc, argv, "--output_folder", dataset_folder + "/scene");
+    config.n_frames_per_fragment = utility::GetProgramOptionAsInt(
+            argc, argv, "--n_frames_per_fragment", 100);
+    config.n_keyframes_per_n_frame = utility::GetProgramOptionAsInt(
+            argc, argv, "--n_keyframes_per_n_frame", 5);
+    config.depth_scale = utility::GetProgramOptionAsDouble(
+            argc, argv, "--depth_scale", 1000.0);
+    config.max_depth =
+            utility::GetProgramOptionAsDouble(argc, argv, "--max_depth", 3.0);
+    config.max_depth_diff = utility::GetProgramOptionAsDouble(
+            argc, argv, "--max_depth_diff", 0.07);
+    config.voxel_size =
+            utility::GetProgramOptionAsDouble(argc, argv, "--voxel_size", 0.05);
+    config.tsdf_cubic_size = utility::GetProgramOptionAsDouble(
+            argc, argv, "--tsdf_cubic_size", 3.0);
+    config.sdf_trunc =
+            utility::GetProgramOptionAsDouble(argc, argv, "--sdf_trunc", 0.04);
+    config.preference_loop_closure_odometry = utility::GetProgramOptionAsDouble(
+            argc, argv, "--preference_loop_closure_odometry", 0.1);
+    config.preference_loop_closure_registration =
+            utility::GetProgramOptionAsDouble(
+                    argc, argv, "--preference_loop_closure_registration", 5.0);
+    const bool write_fragments =
+            utility::ProgramOptionExists(argc, argv, "--write_fragments");
+    if (config.n_frames_per_fragment <= 0 ||
+        config.n_keyframes_per_n_frame <= 0) {
+        utility::LogWarning("Frame counts per fragment must be positive.");
+        return 1;
+    }
+
+    const std::string intrinsic_path =
+            utility::GetProgramOptionAsString(argc, argv, "--intrinsic_path");
+    if (intrinsic_path.empty()) {
+        config.intrinsic = camera::PinholeCameraIntrinsic(
+                camera::PinholeCameraIntrinsicParameters::PrimeSenseDefault);
+    } else if (!io::ReadIJsonConvertible(intrinsic_path, config.intrinsic)) {
+        utility::LogWarning("Failed to read intrinsic {}.", intrinsic_path);
+        return 1;
+    }
+
+    std::string color_folder;
+    for (const std::string subfolder : {"image", "rgb", "color"}) {
+        if (utility::filesystem::DirectoryExists(dataset_folder + "/" +
+                                                 subfolder)) {
+            color_folder = dataset_folder + "/" + subfolder;
+            break;
+        }
+    }
+    std::vector<std::string> color_files = ListSortedFiles(color_folder, "jpg");
+    const std::vector<std::string> color_png_files =
+            ListSortedFiles(color_folder, "png");
+    color_files.insert(color_files.end(), color_png_files.begin(),
+                       color_png_files.end());
+    const std::vector<std::string> depth_files =
+            ListSortedFiles(dataset_folder + "/depth", "png");
+    if (color_files.empty() || color_files.size() != depth_files.size()) {
+        utility::LogWarning(
+                "Expected the same positive number of color and depth images, "
+                "but got {} and {}.",
+                color_files.size(), depth_files.size());
+        return 1;
+    }
+    const int n_files = int(color_files.size());
+    const int n_fragments =
+            (n_files + config.n_frames_per_fragment - 1) /
+            config.n_frames_per_fragment;
+    utility::filesystem::MakeDirectoryHierarchy(config.output_folder);
+
+    // Independent fragments, pairs and edges run in parallel. Open3D kernels
+    // called inside run on a single thread, as nested parallelism is off.
+    std::vector<StageReport> reports;
+    std::vector<Fragment> fragments(n_fragments);
+    reports.push_back(RunStage("Make fragments", n_files, "frames", [&]() {
+#pragma omp parallel for schedule(dynamic) \
+        num_threads(utility::EstimateMaxThreads())
+        for (int i = 0; i < n_fragments; ++i) {
+            const int sid = i * config.n_frames_per_fragment;
+            const int eid =
+                    std::min(sid + config.n_frames_per_fragment, n_files);
+            fragments[i] =
+                    MakeFragment(color_files, depth_files, sid, eid, config);
+            utility::LogInfo("Fragment {:03d} / {:03d} done.", i,
+                             n_fragments - 1);
+        }
+    }));
+
+    std::vector<PairResult> pair_results;
+    for (int s = 0; s < n_fragments; ++s) {
+        for (int t = s + 1; t < n_fragments; ++t) {
+            pair_results.emplace_back();
+            pair_results.back().s_ = s;
+            pair_results.back().t_ = t;
+        }
+    }
+    const int n_pairs = int(pair_results.size());
+    PoseGraph scene_graph;
+    reports.push_back(
+            RunStage("Register fragments", n_pairs, "pairs", [&]() {
+#pragma omp parallel for schedule(dynamic) \
+        num_threads(utility::EstimateMaxThreads())
+                for (int i = 0; i < n_fragments; ++i) {
+                    PreprocessFragment(fragments[i], config);
+                }
+#pragma omp parallel for schedule(dynamic) \
+        num_threads(utility::EstimateMaxThreads())
+                for (int i = 0; i < n_pairs; ++i) {
+                    pair_results[i] = RegisterFragmentPair(
+                            fragments, pair_results[i].s_, pair_results[i].t_,
+                            config);
+                }
+                scene_graph = MakeSceneGraph(pair_results);
+                OptimizeSceneGraph(scene_graph, config);
+            }));
+
+    std::vector<PairResult> refined_results(scene_graph.edges_.size());
+    const int n_edges = int(refined_results.size());
+    reports.push_back(RunStage("Refine registration", n_edges, "edges", [&]() {
+        const double voxel_size = config.voxel_size;
+#pragma omp parallel for schedule(dynamic) \
+        num_threads(utility::EstimateMaxThreads())
+        for (int i = 0; i < n_edges; ++i) {
+            const PoseGraphEdge &edge = scene_graph.edges_[i];
+            PairResult &result = refined_results[i];
+            result.s_ = edge.source_node_id_;
+            result.t_ = edge.target_node_id_;
+            result.success_ = true;
+            std::tie(result.transformation_, result.information_) =
+                    MultiscaleICP(*fragments[result.s_].pcd_,
+                                  *fragments[result.t_].pcd_,
+                                  {voxel_size, voxel_size / 2.0,
+                                   voxel_size / 4.0},
+                                  {50, 30, 14}, edge.transformation_);
+        }
+        scene_graph = MakeSceneGraph(refined_results);
+        OptimizeSceneGraph(scene_graph, config);
+    }));
+
+    std::shared_ptr<geometry::TriangleMesh> mesh;
+    camera::PinholeCameraTrajectory trajectory;
+    reports.push_back(RunStage("Integrate scene", n_files, "frames", [&]() {
+        pipelines::integration::ScalableTSDFVolume volume(
+                config.tsdf_cubic_size / 512.0, config.sdf_trunc,
+                pipelines::integration::TSDFVolumeColorType::RGB8);
+        for (int i = 0; i < int(scene_graph.nodes_.size()); ++i) {
+            const PoseGraph &fragment_graph = fragments[i].pose_graph_;
+            for (int j = 0; j < int(fragment_graph.nodes_.size()); ++j) {
+                const int frame_id = i * config.n_frames_per_fragment + j;
+                geometry::Image color, depth;
+                io::ReadImage(color_files[frame_id], color);
+                io::ReadImage(depth_files[frame_id], depth);
+                const Eigen::Matrix4d pose = scene_graph.nodes_[i].pose_ *
+                                             fragment_graph.nodes_[j].pose_;
+                volume.Integrate(*CreateRGBDImage(color, depth, false, config),
+                                 config.intrinsic, pose.inverse());
+                camera::PinholeCameraParameters parameters;
+                parameters.intrinsic_ = config.intrinsic;
+                parameters.extrinsic_ = pose.inverse();
+                trajectory.parameters_.push_back(parameters);
+            }
+        }
+        mesh = volume.ExtractTriangleMesh();
+        mesh->ComputeVertexNormals();
+    }));
+
+    io::WriteTriangleMesh(config.output_folder + "/integrated.ply", *mesh,
+                          false, true);
+    io::WritePinholeCameraTrajectory(config.output_folder + "/trajectory.log",
+                                     trajectory);
+    io::WritePoseGraph(
+            config.output_folder + "/refined_registration_optimized.json",
+            scene_graph);
+    if (write_fragments) {
+        const std::string fragment_folder = dataset_folder + "/fragments";
+        utility::filesystem::MakeDirectoryHierarchy(fragment_folder);
+        for (int i = 0; i < n_fragments; ++i) {
+            io::WritePointCloud(
+                    fmt::format("{}/fragment_{:03d}.ply", fragment_folder, i),
+                    *fragments[i].pcd_);
+            io::WritePoseGraph(fmt::format("{}/fragment_optimized_{:03d}.json",
+                                           fragment_folder, i),
+                               fragments[i].pose_graph_);
+        }
+    }
+
+    // Throughput report. The peak memory is the process peak resident set
+    // size at the end of each stage.
+    double total_seconds = 0;
+    utility::LogInfo("{:<20} {:>9} {:>12} {:>10} {:>14}", "Stage", "Time (s)",
+                     "Items", "Items / s", "Peak RSS (MB)");
+    for (const StageReport &report : reports) {
+        total_seconds += report.seconds_;
+        utility::LogInfo(
+                "{:<20} {:>9.2f} {:>12} {:>10.2f} {:>14.1f}", report.name_,
+                report.seconds_,
+                fmt::format("{} {}", report.items_, report.item_name_),
+                report.seconds_ > 0 ? report.items_ / report.seconds_ : 0.0,
+                report.peak_memory_mb_);
+    }
+    utility::LogInfo("{:<20} {:>9.2f} {:>12} {:>10.2f} {:>14.1f}", "Total",
+                     total_seconds, fmt::format("{} frames", n_files),
+                     total_seconds > 0 ? n_files / total_seconds : 0.0,
+                     GetPeakMemoryMB());
+    return 0;
+}
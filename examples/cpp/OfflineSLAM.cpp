@@ -155,6 +155,14 @@ int main(int argc, char* argv[]) {
     t::pipelines::slam::Frame raycast_frame(
             ref_depth.GetRows(), ref_depth.GetCols(), intrinsic_t, device);
 
+    // Keep the per-frame tensors in static device buffers.
+    Image ref_color = *t::io::CreateImageFromFile(color_filenames[0]);
+    input_frame.ReserveData("depth", ref_depth.GetChannels(),
+                            ref_depth.GetDtype());
+    input_frame.ReserveData("color", ref_color.GetChannels(),
+                            ref_color.GetDtype());
+    raycast_frame.ReserveData("depth", 1, core::Float32);
+
     // Iterate over frames
     for (size_t i = 0; i < iterations; ++i) {
         utility::LogInfo("Processing {}/{}...", i, iterations);
@@ -0,0 +1,53 @@
+# ----------------------------------------------------------------------------
+# -                        Open3D: www.open3d.org                            -
+# ----------------------------------------------------------------------------
+# The MIT License (MIT)
+#
+# Copyright (c) 2018-2021 www.open3d.org
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+# FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+# IN THE SOFTWARE.
+# ----------------------------------------------------------------------------
+
+import subprocess
+import sys
+
+import open3d.core as o3c
+import pytest
+
+# Startup is measured in fresh interpreters, since the import cost is only paid
+# once per process. Run with e.g.
+#   pytest python/benchmarks/test_startup.py --benchmark-columns=mean,stddev
+# and compare builds with and without -DBUILD_DISABLED_DTYPES, or with
+# CUDA_MODULE_LOADING=EAGER to measure lazy CUDA module loading.
+
+
+def run_python(code):
+    subprocess.run([sys.executable, "-c", code], check=True)
+
+
+def test_import(benchmark):
+    benchmark.pedantic(run_python, args=("import open3d",), rounds=5)
+
+
+@pytest.mark.skipif(not o3c.cuda.is_available(),
+                    reason="CUDA is not available.")
+def test_import_first_cuda_op(benchmark):
+    code = ("import open3d.core as o3c; "
+            "o3c.Tensor.ones((1,), device=o3c.Device('CUDA:0')).cpu()")
+    benchmark.pedantic(run_python, args=(code,), rounds=5)
@@ -50,7 +50,15 @@ if _build_config["BUILD_GUI"] and not (_find_library('c++abi') or
         pass
 
 __DEVICE_API__ = 'cpu'
-if _build_config["BUILD_CUDA_MODULE"]:
+# Hiding all GPUs with CUDA_VISIBLE_DEVICES selects the CPU bindings directly,
+# without loading the CUDA runtime or querying the driver.
+if _build_config["BUILD_CUDA_MODULE"] and os.environ.get(
+        'CUDA_VISIBLE_DEVICES') not in ('', '-1'):
+    # Load CUDA kernels on first use instead of when the CUDA context is
+    # created (CUDA >= 11.7). Open3D ships kernels for every dtype, so eager
+    # loading dominates the first CUDA call. Users can still opt out by setting
+    # CUDA_MODULE_LOADING=EAGER before importing open3d.
+    os.environ.setdefault('CUDA_MODULE_LOADING', 'LAZY')
     # Load CPU pybind dll gracefully without introducing new python variable.
     # Do this before loading the CUDA pybind dll to correctly resolve symbols
     try:  # StopIteration if cpu version not available
@@ -31,7 +31,69 @@ import torch
 from torch.nn.parameter import Parameter
 import numpy as np
 
-__all__ = ['ContinuousConv', 'SparseConv', 'SparseConvTranspose']
+__all__ = [
+    'ContinuousConv', 'SparseConv', 'SparseConvTranspose', 'KernelMapCache'
+]
+
+
+class KernelMapCache:
+    """Cache for the neighbor lists (kernel maps) of sparse convolutions.
+
+    SparseConv and SparseConvTranspose layers compute a fixed radius search
+    between the input and output positions in every forward pass. Networks
+    with several layers operating on the same point sets can pass a shared
+    cache to reuse these searches::
+
+        cache = ml3d.layers.KernelMapCache()
+        feats = conv1(feats, pos, pos, voxel_size, kernel_map_cache=cache)
+        feats = conv2(feats, pos, pos, voxel_size, kernel_map_cache=cache)
+
+    Entries are keyed by the identity of the position tensors, the kernel
+    size, the voxel size and the filter offset. An entry is invalidated when
+    one of its position tensors is modified in-place. The cache keeps the
+    position tensors alive; call clear() or create a new cache when the point
+    sets change, e.g. for every new input sample.
+    """
+
+    def __init__(self):
+        self._entries = {}
+
+    def clear(self):
+        """Removes all entries."""
+        self._entries.clear()
+
+    def __len__(self):
+        return len(self._entries)
+
+    @staticmethod
+    def _version(positions):
+        if isinstance(positions, classes.RaggedTensor):
+            positions = positions.values
+        return positions._version
+
+    def get(self, name, inp_positions, out_positions, params, compute_fn):
+        """Returns the cached value or computes and stores it.
+
+        Arguments:
+          name: Name of the kind of map, e.g. 'sparse_conv'.
+
+          inp_positions: The input positions the map was computed for.
+
+          out_positions: The output positions the map was computed for.
+
+          params: Hashable tuple with the remaining search parameters.
+
+          compute_fn: Function without arguments computing the value.
+        """
+        key = (name, id(inp_positions), id(out_positions), params)
+        versions = (self._version(inp_positions), self._version(out_positions))
+        entry = self._entries.get(key)
+        if (entry is not None and entry[0] is inp_positions and
+                entry[1] is out_positions and entry[2] == versions):
+            return entry[3]
+        value = compute_fn()
+        self._entries[key] = (inp_positions, out_positions, versions, value)
+        return value
 
 
 class ContinuousConv(torch.nn.Module):
@@ -453,7 +515,8 @@ class SparseConv(torch.nn.Module):
                 out_positions,
                 voxel_size,
                 inp_importance=None,
-                fixed_radius_search_hash_table=None):
+                fixed_radius_search_hash_table=None,
+                kernel_map_cache=None):
         """This function computes the output features.
 
         Arguments:
@@ -476,6 +539,10 @@ class SparseConv(torch.nn.Module):
             Note that the hash table must have been generated with the same 'points'
             array. Note that this parameter is only used if 'extents' is a scalar.
 
+          kernel_map_cache: Optional KernelMapCache shared between layers. If
+            given, the neighbor search is reused for calls with the same
+            position tensors, kernel size, voxel size and offset.
+
         Returns: A tensor of shape [num output points, filters] with the output
           features.
         """
@@ -498,12 +565,22 @@ class SparseConv(torch.nn.Module):
                                          device=self.kernel.device)
 
         hash_table_size_factor = 1 / 64
-        self.nns = self.fixed_radius_search(
-            inp_positions,
-            queries=out_positions - offset * voxel_size,
-            radius=self.kernel_size[0] * voxel_size * 0.51,
-            hash_table_size_factor=hash_table_size_factor,
-            hash_table=fixed_radius_search_hash_table)
+
+        def search():
+            return self.fixed_radius_search(
+                inp_positions,
+                queries=out_positions - offset * voxel_size,
+                radius=self.kernel_size[0] * voxel_size * 0.51,
+                hash_table_size_factor=hash_table_size_factor,
+                hash_table=fixed_radius_search_hash_table)
+
+        if kernel_map_cache is None:
+            self.nns = search()
+        else:
+            self.nns = kernel_map_cache.get(
+                'sparse_conv', inp_positions, out_positions,
+                (self.kernel_size[0], float(voxel_size),
+                 tuple(offset.tolist())), search)
 
         out_positions_split = None
         if isinstance(inp_positions, classes.RaggedTensor):
@@ -648,7 +725,8 @@ class SparseConvTranspose(torch.nn.Module):
                 out_positions,
                 voxel_size,
                 out_importance=None,
-                fixed_radius_search_hash_table=None):
+                fixed_radius_search_hash_table=None,
+                kernel_map_cache=None):
         """This function computes the output features.
 
         Arguments:
@@ -671,6 +749,10 @@ class SparseConvTranspose(torch.nn.Module):
             Note that the hash table must have been generated with the same 'points'
             array. Note that this parameter is only used if 'extents' is a scalar.
 
+          kernel_map_cache: Optional KernelMapCache shared between layers. If
+            given, the neighbor search is reused for calls with the same
+            position tensors, kernel size, voxel size and offset.
+
         Returns: A tensor of shape [num output points, filters] with the output
           features.
         """
@@ -697,12 +779,32 @@ class SparseConvTranspose(torch.nn.Module):
                                 device=self.kernel.device)
 
         hash_table_size_factor = 1 / 64
-        self.nns_inp = self.fixed_radius_search(
-            out_positions,
-            queries=inp_positions - offset * voxel_size,
-            radius=self.kernel_size[0] * voxel_size * 0.51,
-            hash_table_size_factor=hash_table_size_factor,
-            hash_table=fixed_radius_search_hash_table)
+
+        def search():
+            nns_inp = self.fixed_radius_search(
+                out_positions,
+                queries=inp_positions - offset * voxel_size,
+                radius=self.kernel_size[0] * voxel_size * 0.51,
+                hash_table_size_factor=hash_table_size_factor,
+                hash_table=fixed_radius_search_hash_table)
+            if isinstance(out_positions, classes.RaggedTensor):
+                num_out = out_positions.values.shape[0]
+            else:
+                num_out = out_positions.shape[0]
+            inverted = ops.invert_neighbors_list(num_out,
+                                                 nns_inp.neighbors_index,
+                                                 nns_inp.neighbors_row_splits,
+                                                 empty_vec)
+            return nns_inp, inverted[0], inverted[1]
+
+        if kernel_map_cache is None:
+            kernel_map = search()
+        else:
+            kernel_map = kernel_map_cache.get(
+                'sparse_conv_transpose', inp_positions, out_positions,
+                (self.kernel_size[0], float(voxel_size),
+                 tuple(offset.tolist())), search)
+        self.nns_inp, neighbors_index, neighbors_row_splits = kernel_map
 
         out_positions_split = None
         if isinstance(inp_positions, classes.RaggedTensor):
@@ -711,12 +813,6 @@ class SparseConvTranspose(torch.nn.Module):
             out_positions_split = out_positions.row_splits
             out_positions = out_positions.values
 
-        num_out = out_positions.shape[0]
-
-        neighbors_index, neighbors_row_splits, _ = ops.invert_neighbors_list(
-            num_out, self.nns_inp.neighbors_index,
-            self.nns_inp.neighbors_row_splits, empty_vec)
-
         # for stats and debugging
         num_pairs = neighbors_index.shape[0]
         self._avg_neighbors = num_pairs / out_positions.shape[0]
@@ -126,6 +126,28 @@ def test_dtype():
     assert "{}".format(dtype) == "Int32"
 
 
+@pytest.mark.parametrize("device", list_devices())
+def test_half_dtypes(device):
+    assert o3c.float16.byte_size() == 2
+    assert o3c.bfloat16.byte_size() == 2
+
+    np_t = np.array([0.5, -2.0, 1000.0, 3.25], dtype=np.float16)
+    o3_t = o3c.Tensor(np_t, device=device)
+    assert o3_t.dtype == o3c.float16
+    np.testing.assert_equal((o3_t + o3_t).cpu().numpy(), np_t + np_t)
+    np.testing.assert_equal(o3_t.abs().cpu().numpy(), np.abs(np_t))
+    assert o3_t.max().item() == 1000.0
+
+    # Sums accumulate in float32.
+    ones = o3c.Tensor.ones((4096,), o3c.float16, device=device)
+    assert ones.sum().item() == 4096.0
+
+    o3_bf = o3_t.to(o3c.bfloat16)
+    assert o3_bf.dtype == o3c.bfloat16
+    np.testing.assert_equal(
+        o3_bf.to(o3c.float32).cpu().numpy(), np_t.astype(np.float32))
+
+
 def test_device():
     device = o3c.Device()
     assert device.get_type() == o3c.Device.DeviceType.CPU
@@ -943,6 +965,74 @@ def test_reduction_argmin_argmax(dim, device):
     np.testing.assert_allclose(o3_dst.cpu().numpy(), np_dst)
 
 
+@pytest.mark.parametrize("device", list_devices())
+def test_segment_reduction_prefix_sum(device):
+    np_src = np.random.rand(20, 3).astype(np.float32)
+    np_row_splits = np.array([0, 4, 4, 11, 20], dtype=np.int64)
+    o3_src = o3c.Tensor(np_src, device=device)
+    o3_row_splits = o3c.Tensor(np_row_splits, device=device)
+
+    segments = [
+        np_src[begin:end]
+        for begin, end in zip(np_row_splits[:-1], np_row_splits[1:])
+    ]
+    np.testing.assert_allclose(
+        o3_src.segment_sum(o3_row_splits).cpu().numpy(),
+        [s.sum(axis=0) for s in segments],
+        rtol=1e-5)
+    np.testing.assert_allclose(
+        o3_src.segment_mean(o3_row_splits).cpu().numpy(),
+        [s.mean(axis=0) if len(s) else np.zeros(3) for s in segments],
+        rtol=1e-5)
+    np.testing.assert_allclose(
+        o3_src.segment_max(o3_row_splits).cpu().numpy(),
+        [s.max(axis=0) if len(s) else np.zeros(3) for s in segments])
+    np.testing.assert_equal(
+        o3_src.segment_argmax(o3_row_splits).cpu().numpy(), [
+            s.argmax(axis=0) + begin if len(s) else -np.ones(3)
+            for s, begin in zip(segments, np_row_splits[:-1])
+        ])
+
+    np.testing.assert_allclose(o3_src.inclusive_prefix_sum().cpu().numpy(),
+                               np.cumsum(np_src, axis=0),
+                               rtol=1e-5)
+    np.testing.assert_allclose(
+        o3_src.exclusive_prefix_sum().cpu().numpy(),
+        np.cumsum(np_src, axis=0) - np_src,
+        rtol=1e-5,
+        atol=1e-6)
+
+
+@pytest.mark.parametrize("device", list_devices())
+def test_sort_unique_topk(device):
+    np_src = np.random.randint(-50, 50, size=1000).astype(np.int32)
+    o3_src = o3c.Tensor(np_src, device=device)
+
+    np.testing.assert_equal(o3_src.sort().cpu().numpy(), np.sort(np_src))
+    np.testing.assert_equal(o3_src.argsort().cpu().numpy(),
+                            np.argsort(np_src, kind="stable"))
+
+    np_unique, np_inverse, np_counts = np.unique(np_src,
+                                                 return_inverse=True,
+                                                 return_counts=True)
+    o3_unique, o3_inverse, o3_counts = o3_src.unique(return_inverse=True,
+                                                     return_counts=True)
+    np.testing.assert_equal(o3_unique.cpu().numpy(), np_unique)
+    np.testing.assert_equal(o3_inverse.cpu().numpy(), np_inverse)
+    np.testing.assert_equal(o3_counts.cpu().numpy(), np_counts)
+
+    o3_values, o3_indices = o3_src.topk(10)
+    np.testing.assert_equal(o3_values.cpu().numpy(), np.sort(np_src)[::-1][:10])
+    np.testing.assert_equal(np_src[o3_indices.cpu().numpy()],
+                            o3_values.cpu().numpy())
+
+    row_splits = o3c.Tensor([0, 100, 100, 1000], device=device)
+    np.testing.assert_equal(
+        o3_src.segment_sort(row_splits).cpu().numpy(),
+        np.concatenate([np.sort(np_src[:100]),
+                        np.sort(np_src[100:])]))
+
+
 @pytest.mark.parametrize("device", list_devices())
 def test_advanced_index_get_mixed(device):
     np_src = np.array(range(24)).reshape((2, 3, 4))
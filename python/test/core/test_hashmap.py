@@ -97,6 +97,29 @@ def test_find(device):
                             np.array([1, 5]))
 
 
+@pytest.mark.parametrize("device", list_devices())
+def test_find_or_insert(device):
+    capacity = 10
+    hashmap = o3c.HashMap(capacity, o3c.int64, [1], o3c.int64, [1], device)
+    keys = o3c.Tensor([100, 300, 500], dtype=o3c.int64, device=device)
+    values = o3c.Tensor([1, 3, 5], dtype=o3c.int64, device=device)
+    hashmap.insert(keys, values)
+
+    keys = o3c.Tensor([100, 200, 500, 200], dtype=o3c.int64, device=device)
+    values = o3c.Tensor([0, 2, 0, 2], dtype=o3c.int64, device=device)
+    buf_indices, masks = hashmap.find_or_insert(keys, values)
+    assert masks.to(o3c.int64).sum() == 1
+    assert hashmap.size() == 4
+
+    buf_indices = buf_indices.to(o3c.int64)
+    np.testing.assert_equal(
+        hashmap.key_tensor()[buf_indices].cpu().numpy().flatten(),
+        np.array([100, 200, 500, 200]))
+    np.testing.assert_equal(
+        hashmap.value_tensor()[buf_indices].cpu().numpy().flatten(),
+        np.array([1, 2, 5, 2]))
+
+
 @pytest.mark.parametrize("device", list_devices())
 def test_erase(device):
     capacity = 10
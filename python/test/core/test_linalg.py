@@ -523,3 +523,92 @@ def test_thiul(device, dtype):
                                u1_.cpu().numpy(),
                                rtol=1e-5,
                                atol=1e-5)
+
+
+@pytest.mark.parametrize("device", list_devices())
+@pytest.mark.parametrize("dtype", [o3c.float32, o3c.float64])
+def test_batched(device, dtype):
+    for n in [3, 6, 10]:
+        a_numpy = np.random.rand(32, n, n) + 2 * n * np.eye(n)
+        b_numpy = np.random.rand(32, n, 2)
+        a = o3c.Tensor(a_numpy, dtype=dtype, device=device)
+        b = o3c.Tensor(b_numpy, dtype=dtype, device=device)
+
+        np.testing.assert_allclose(o3c.batched_solve(a, b).cpu().numpy(),
+                                   np.linalg.solve(a_numpy, b_numpy),
+                                   rtol=1e-4,
+                                   atol=1e-5)
+        np.testing.assert_allclose(o3c.batched_inv(a).cpu().numpy(),
+                                   np.linalg.inv(a_numpy),
+                                   rtol=1e-4,
+                                   atol=1e-5)
+        np.testing.assert_allclose(o3c.batched_det(a).cpu().numpy(),
+                                   np.linalg.det(a_numpy),
+                                   rtol=1e-4)
+
+        u, s, vt = o3c.batched_svd(a)
+        np.testing.assert_allclose(s.cpu().numpy(),
+                                   np.linalg.svd(a_numpy, compute_uv=False),
+                                   rtol=1e-4,
+                                   atol=1e-5)
+        np.testing.assert_allclose(
+            (u.cpu().numpy() * s.cpu().numpy()[:, None, :]) @ vt.cpu().numpy(),
+            a_numpy,
+            rtol=1e-4,
+            atol=1e-4)
+
+    with pytest.raises(RuntimeError) as excinfo:
+        a = o3c.Tensor.zeros((4, 3, 3), dtype=dtype, device=device)
+        b = o3c.Tensor.ones((4, 3), dtype=dtype, device=device)
+        o3c.batched_solve(a, b)
+        assert 'singular' in str(excinfo.value)
+
+
+@pytest.mark.parametrize("device", list_devices())
+@pytest.mark.parametrize("dtype", [o3c.float32, o3c.float64])
+def test_sparse_tensor(device, dtype):
+    rows = o3c.Tensor([3, 1, 0, 1, 1], dtype=o3c.int64, device=device)
+    cols = o3c.Tensor([0, 2, 1, 0, 2], dtype=o3c.int64, device=device)
+    values = o3c.Tensor([5, 2, 1, 3, 4], dtype=dtype, device=device)
+    a = o3c.SparseTensor.from_coo(rows, cols, values, (4, 3))
+    a_numpy = np.array([[0, 1, 0], [3, 0, 6], [0, 0, 0], [5, 0, 0]])
+    assert a.nnz == 4
+    np.testing.assert_allclose(a.to_dense().cpu().numpy(), a_numpy)
+    np.testing.assert_allclose(a.T().to_dense().cpu().numpy(), a_numpy.T)
+
+    x = o3c.Tensor([1, 2, 3], dtype=dtype, device=device)
+    np.testing.assert_allclose(a.spmv(x).cpu().numpy(),
+                               a_numpy @ x.cpu().numpy(),
+                               rtol=1e-5)
+    b = o3c.Tensor(np.arange(6).reshape(3, 2), dtype=dtype, device=device)
+    np.testing.assert_allclose(a.spmm(b).cpu().numpy(),
+                               a_numpy @ b.cpu().numpy(),
+                               rtol=1e-5)
+
+    dense = o3c.Tensor(a_numpy, dtype=dtype, device=device)
+    np.testing.assert_allclose(
+        o3c.SparseTensor.from_dense(dense).to_dense().cpu().numpy(), a_numpy)
+
+
+@pytest.mark.parametrize("device", list_devices())
+def test_pcg(device):
+    n = 12
+    a_numpy = 4 * np.diag(1 + 10 * (np.arange(n) // 3)) - np.eye(
+        n, k=1) - np.eye(n, k=-1)
+    b_numpy = np.cos(0.5 * np.arange(n))
+    a = o3c.Tensor(a_numpy, dtype=o3c.float64, device=device)
+    b = o3c.Tensor(b_numpy, dtype=o3c.float64, device=device)
+    for matrix in [a, o3c.SparseTensor.from_dense(a)]:
+        for preconditioner in [
+                o3c.PreconditionerType.Identity, o3c.PreconditionerType.Jacobi,
+                o3c.PreconditionerType.BlockJacobi
+        ]:
+            x, result = o3c.pcg(matrix,
+                                b,
+                                preconditioner,
+                                block_size=3,
+                                relative_tolerance=1e-10)
+            assert result.converged
+            np.testing.assert_allclose(x.cpu().numpy(),
+                                       np.linalg.solve(a_numpy, b_numpy),
+                                       rtol=1e-6)
@@ -100,6 +100,41 @@ def test_tensor_from_to_pytorch(device):
         np.testing.assert_equal(th_t_v2.cpu().numpy(), np_t)
 
 
+
+@pytest.mark.parametrize("device", list_devices_with_torch())
+def test_tensor_dlpack_protocol(device):
+    if not torch_available() or not hasattr(torch, "from_dlpack"):
+        return
+
+    device_id = device.get_id()
+    is_cuda = device.get_type() == o3c.Device.DeviceType.CUDA
+
+    a = o3c.Tensor.ones((2, 3), o3c.float32, device=device)
+    assert a.__dlpack_device__() == ((2 if is_cuda else 1), device_id)
+
+    # Open3D -> PyTorch and PyTorch -> Open3D without capsules, sharing
+    # memory.
+    b = torch.from_dlpack(a)
+    c = o3c.Tensor.from_dlpack(b)
+    b[0, 0] = 100
+    r = np.array([[100., 1., 1.], [1., 1., 1.]])
+    np.testing.assert_equal(r, a.cpu().numpy())
+    np.testing.assert_equal(r, c.cpu().numpy())
+    assert c.device == device
+
+    if is_cuda:
+        # The consumer stream waits for the producer, no host synchronization
+        # is needed to see the result.
+        stream = torch.cuda.Stream(device=device_id)
+        with torch.cuda.stream(stream):
+            d = torch.from_dlpack(a * 2)
+            e = d + 1
+        stream.synchronize()
+        np.testing.assert_equal(e.cpu().numpy(), r * 2 + 1)
+
+        with pytest.raises(RuntimeError):
+            a.__dlpack__(stream=0)
+
 def test_tensor_numpy_to_open3d_to_pytorch():
     if not torch_available():
         return
@@ -26,6 +26,7 @@
 
 import numpy as np
 import pytest
+import open3d as o3d
 from open3d.ml.contrib import subsample, subsample_batch
 
 
@@ -256,3 +257,46 @@ def test_subsample_batch():
         sub_points = subsample_batch(points,
                                      np.array([1], dtype=np.int32),
                                      sampleDl=1.1)
+
+
+@pytest.mark.skipif(not o3d.core.cuda.is_available(),
+                    reason="CUDA is not available.")
+def test_subsample_batch_cuda():
+    from open3d.ml.contrib import subsample_batch_cuda
+    o3c = o3d.core
+    device = o3c.Device("CUDA:0")
+    rng = np.random.default_rng(42)
+    points = rng.uniform(-2, 2, size=(500, 3)).astype(np.float32)
+    features = rng.uniform(size=(500, 4)).astype(np.float32)
+    labels = rng.integers(0, 3, size=(500,), dtype=np.int32)
+    batches = np.array([200, 100, 200], dtype=np.int32)
+    row_splits = np.concatenate([[0], np.cumsum(batches)]).astype(np.int64)
+
+    sub_points_ref, sub_batch_ref, sub_features_ref = subsample_batch(
+        points, batches, features=features, sampleDl=0.5)
+
+    sub_points, sub_row_splits, sub_features, sub_labels = subsample_batch_cuda(
+        o3c.Tensor(points, device=device),
+        o3c.Tensor(row_splits, device=device),
+        features=o3c.Tensor(features, device=device),
+        classes=o3c.Tensor(labels, device=device),
+        sampleDl=0.5)
+    assert sub_points.device == device
+    compare_batched_results_with_sorting(
+        actual_points=sub_points.cpu().numpy(),
+        expect_points=sub_points_ref,
+        actual_batches=np.diff(sub_row_splits.cpu().numpy()).astype(np.int32),
+        expect_batches=sub_batch_ref,
+        actual_features=sub_features.cpu().numpy(),
+        expect_features=sub_features_ref)
+    assert sub_labels.shape[0] == sub_points.shape[0]
+
+    # max_p limits the number of points per batch item.
+    sub_points, sub_row_splits = subsample_batch_cuda(
+        o3c.Tensor(points, device=device),
+        o3c.Tensor(row_splits, device=device),
+        sampleDl=0.5,
+        max_p=5)
+    np.testing.assert_equal(
+        np.diff(sub_row_splits.cpu().numpy()),
+        np.minimum(sub_batch_ref, 5))
@@ -26,6 +26,7 @@
 
 import open3d as o3d
 import numpy as np
+import pytest
 import mltest
 
 # Skip all tests if the ml ops were not built.
@@ -74,3 +75,77 @@ def test_nms_empty(ml):
 
     np.testing.assert_equal(keep_indices, keep_indices_ref)
     assert keep_indices.dtype == keep_indices_ref.dtype
+
+
+@mltest.parametrize.ml
+@pytest.mark.parametrize('pre_nms_top_k', [-1, 2])
+def test_batched_nms(ml, pre_nms_top_k):
+    boxes = np.array([[15.0811, -7.9803, 15.6721, -6.8714, 0.5152],
+                      [15.1166, -7.9261, 15.7060, -6.8137, 0.6501],
+                      [15.1304, -7.8129, 15.7069, -6.8903, 0.7296],
+                      [15.2050, -7.8447, 15.8311, -6.7437, 1.0506],
+                      [15.1343, -7.8136, 15.7121, -6.8479, 1.0352],
+                      [15.0931, -7.9552, 15.6675, -7.0056, 0.5979]],
+                     dtype=np.float32)
+    scores = np.array([3, 1.1, 5, 2, 1, 0], dtype=np.float32)
+    boxes = np.concatenate([boxes, boxes, boxes[:2]])
+    scores = np.concatenate([scores, scores, scores[:2]])
+    labels = np.array([0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 2, 2],
+                      dtype=np.int64)
+    row_splits = np.array([0, 6, 6, 12, 14], dtype=np.int64)
+    nms_overlap_thresh = 0.7
+
+    # Run the single set nms on every (batch item, label) group.
+    keep_indices_ref = []
+    for b in range(len(row_splits) - 1):
+        for label in np.unique(labels[row_splits[b]:row_splits[b + 1]]):
+            group = row_splits[b] + np.flatnonzero(
+                labels[row_splits[b]:row_splits[b + 1]] == label)
+            group = group[np.argsort(-scores[group], kind='stable')]
+            if pre_nms_top_k > 0:
+                group = group[:pre_nms_top_k]
+            keep = mltest.run_op(ml,
+                                 ml.device,
+                                 False,
+                                 ml.ops.nms,
+                                 boxes[group],
+                                 scores[group],
+                                 nms_overlap_thresh=nms_overlap_thresh)
+            keep_indices_ref.append(group[keep])
+    keep_indices_ref = np.concatenate(keep_indices_ref).astype(np.int64)
+
+    keep_indices = mltest.run_op(ml,
+                                 ml.device,
+                                 True,
+                                 ml.ops.batched_nms,
+                                 boxes,
+                                 scores,
+                                 labels,
+                                 row_splits,
+                                 nms_overlap_thresh=nms_overlap_thresh,
+                                 pre_nms_top_k=pre_nms_top_k)
+
+    np.testing.assert_equal(keep_indices, keep_indices_ref)
+    assert keep_indices.dtype == keep_indices_ref.dtype
+
+
+@mltest.parametrize.ml
+def test_batched_nms_empty(ml):
+    boxes = np.zeros((0, 5), dtype=np.float32)
+    scores = np.array([], dtype=np.float32)
+    labels = np.array([], dtype=np.int64)
+    row_splits = np.array([0, 0], dtype=np.int64)
+    keep_indices_ref = np.array([]).astype(np.int64)
+
+    keep_indices = mltest.run_op(ml,
+                                 ml.device,
+                                 True,
+                                 ml.ops.batched_nms,
+                                 boxes,
+                                 scores,
+                                 labels,
+                                 row_splits,
+                                 nms_overlap_thresh=0.7)
+
+    np.testing.assert_equal(keep_indices, keep_indices_ref)
+    assert keep_indices.dtype == keep_indices_ref.dtype
@@ -534,3 +534,53 @@ def test_compare_to_conv3dtranspose_batches(ml, dtype, kernel_size,
         y_conv3d += bias
 
         np.testing.assert_allclose(y_out, y_conv3d, rtol=1e-3, atol=1e-5)
+
+
+@mltest.parametrize.ml
+def test_kernel_map_cache(ml):
+    """Checks that layers sharing a KernelMapCache reuse the neighbor search"""
+    # the kernel map cache is only available for torch
+    if ml.module.__name__ != 'torch':
+        return
+    torch = ml.module
+
+    np.random.seed(0)
+    positions = np.unique(np.random.randint(0, 10, (256, 3)),
+                          axis=0).astype(np.float32) + 0.5
+    positions = torch.from_numpy(positions).to(ml.device)
+    features = torch.rand((positions.shape[0], 4), device=ml.device)
+
+    conv1 = ml.layers.SparseConv(in_channels=4, filters=4,
+                                 kernel_size=[3, 3, 3]).to(ml.device)
+    conv2 = ml.layers.SparseConv(in_channels=4, filters=4,
+                                 kernel_size=[3, 3, 3]).to(ml.device)
+    conv_transpose = ml.layers.SparseConvTranspose(
+        in_channels=4, filters=4, kernel_size=[3, 3, 3]).to(ml.device)
+
+    def run(cache):
+        y = conv1(features, positions, positions, 1.0, kernel_map_cache=cache)
+        y = conv2(y, positions, positions, 1.0, kernel_map_cache=cache)
+        return conv_transpose(y,
+                              positions,
+                              positions,
+                              1.0,
+                              kernel_map_cache=cache)
+
+    cache = ml.layers.KernelMapCache()
+    y_cached = run(cache)
+    # one entry is shared by conv1 and conv2, one is used by conv_transpose
+    assert len(cache) == 2
+    assert conv1.nns is conv2.nns
+
+    y = run(None)
+    np.testing.assert_allclose(mltest.to_numpy(y_cached),
+                               mltest.to_numpy(y),
+                               rtol=1e-5,
+                               atol=1e-6)
+
+    # modifying the positions in-place invalidates the entries
+    positions += 1.0
+    run(cache)
+    assert conv1.nns is conv2.nns
+    cache.clear()
+    assert len(cache) == 0
@@ -53,3 +53,36 @@ def test_three_interp(ml):
         'https://storage.googleapis.com/isl-datasets/open3d-dev/test/ml_ops/data/three_interp/out.npy'
     )
     np.testing.assert_equal(ans, expected)
+
+
+@mltest.parametrize.ml_torch_only
+@pytest.mark.parametrize('dtype', ['float16', 'bfloat16'])
+def test_three_interp_half(ml, dtype):
+    if not ml.device_is_gpu:
+        pytest.skip('three_interpolate is only implemented for GPUs')
+    import torch
+    rng = np.random.default_rng(42)
+    points = rng.standard_normal(size=(2, 8, 32)).astype(np.float32)
+    idx = rng.integers(0, 32, size=(2, 16, 3)).astype(np.int32)
+    weights = rng.uniform(size=(2, 16, 3)).astype(np.float32)
+
+    torch_dtype = getattr(torch, dtype)
+    points = torch.from_numpy(points).to(ml.device, torch_dtype)
+    idx = torch.from_numpy(idx).to(ml.device)
+    weights = torch.from_numpy(weights).to(ml.device)
+
+    ans = ml.ops.three_interpolate(points, idx, weights)
+    assert ans.dtype == torch_dtype
+    expected = ml.ops.three_interpolate(points.float(), idx, weights)
+    np.testing.assert_allclose(ans.float().cpu().numpy(),
+                               expected.cpu().numpy(),
+                               rtol=1e-2,
+                               atol=1e-2)
+
+    grad = ml.ops.three_interpolate_grad(ans, idx, weights, 32)
+    assert grad.dtype == torch_dtype
+    expected = ml.ops.three_interpolate_grad(ans.float(), idx, weights, 32)
+    np.testing.assert_allclose(grad.float().cpu().numpy(),
+                               expected.cpu().numpy(),
+                               rtol=1e-2,
+                               atol=1e-2)
@@ -0,0 +1,93 @@
+# ----------------------------------------------------------------------------
+# -                        Open3D: www.open3d.org                            -
+# ----------------------------------------------------------------------------
+# The MIT License (MIT)
+#
+# Copyright (c) 2018-2021 www.open3d.org
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+# FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+# IN THE SOFTWARE.
+# ----------------------------------------------------------------------------
+
+import open3d as o3d
+import numpy as np
+import pytest
+import mltest
+
+# Skip all tests if the ml ops were not built.
+pytestmark = mltest.default_marks
+
+
+def trilinear_devoxelize_reference(coords, features, r):
+    """Returns the interpolated features and the gradient matrix that maps
+    the flattened voxel grid of a batch item to its points."""
+    b, c = features.shape[:2]
+    n = coords.shape[2]
+    outs = np.zeros((b, c, n), dtype=np.float32)
+    mats = np.zeros((b, n, r**3), dtype=np.float64)
+    for bi in range(b):
+        for i in range(n):
+            p = coords[bi, :, i]
+            lo = np.floor(p).astype(np.int64)
+            d = p - lo
+            hi = lo + (d > 0)
+            for k in range(8):
+                corner = [hi[a] if k & (4 >> a) else lo[a] for a in range(3)]
+                w = np.prod(
+                    [d[a] if k & (4 >> a) else 1 - d[a] for a in range(3)])
+                mats[bi, i, corner[0] * r * r + corner[1] * r +
+                     corner[2]] += w
+        outs[bi] = features[bi].reshape(c, -1) @ mats[bi].T
+    return outs, mats
+
+
+@mltest.parametrize.ml_torch_only
+def test_trilinear_devoxelize(ml):
+    if not ml.device_is_gpu:
+        pytest.skip('trilinear_devoxelize is only implemented for GPUs')
+    import torch
+    rng = np.random.default_rng(42)
+    r = 4
+    coords = rng.uniform(0, r - 1, size=(2, 3, 50)).astype(np.float32)
+    # Points on the grid use the same voxel for the upper and lower corners.
+    coords[:, :, :5] = np.round(coords[:, :, :5])
+    features = rng.standard_normal(size=(2, 3, r, r, r)).astype(np.float32)
+    grad_y = rng.standard_normal(size=(2, 3, 50)).astype(np.float32)
+
+    outs_ref, mats = trilinear_devoxelize_reference(coords, features, r)
+    grad_x_ref = np.stack([g @ m for g, m in zip(grad_y, mats)])
+
+    outs, inds, wgts = ml.ops.trilinear_devoxelize_forward(
+        r, True,
+        torch.from_numpy(coords).to(ml.device),
+        torch.from_numpy(features).to(ml.device))
+    np.testing.assert_allclose(outs.cpu().numpy(),
+                               outs_ref,
+                               rtol=1e-5,
+                               atol=1e-5)
+
+    grad_y = torch.from_numpy(grad_y).to(ml.device)
+    grad_x = ml.ops.trilinear_devoxelize_backward(grad_y, inds, wgts, r)
+    np.testing.assert_allclose(grad_x.cpu().numpy(),
+                               grad_x_ref,
+                               rtol=1e-5,
+                               atol=1e-5)
+
+    # The backward does not use atomics and must be reproducible.
+    grad_x2 = ml.ops.trilinear_devoxelize_backward(grad_y, inds, wgts, r)
+    np.testing.assert_equal(grad_x.cpu().numpy(), grad_x2.cpu().numpy())
@@ -67,6 +67,68 @@ def test_cast_lots_of_rays():
     _ = scene.cast_rays(rays)
 
 
+# test refitting with updated vertices and transforms
+def test_update_triangles():
+    vertices = o3d.core.Tensor([[0, 0, 0], [1, 0, 0], [1, 1, 0]],
+                               dtype=o3d.core.float32)
+    triangles = o3d.core.Tensor([[0, 1, 2]], dtype=o3d.core.uint32)
+
+    scene = o3d.t.geometry.RaycastingScene()
+    geom_id = scene.add_triangles(vertices, triangles)
+
+    rays = o3d.core.Tensor([[0.2, 0.1, 1, 0, 0, -1]], dtype=o3d.core.float32)
+    assert np.isclose(scene.cast_rays(rays)['t_hit'][0].item(), 1.0)
+
+    # move the triangle closer to the ray origin
+    offset = o3d.core.Tensor([0, 0, 0.5], dtype=o3d.core.float32)
+    scene.update_triangles(geom_id, vertices + offset)
+    assert np.isclose(scene.cast_rays(rays)['t_hit'][0].item(), 0.5)
+
+    # the transform applies to the current vertices
+    transform = np.eye(4, dtype=np.float32)
+    transform[2, 3] = -0.5
+    scene.set_geometry_transform(geom_id, o3d.core.Tensor(transform))
+    assert np.isclose(scene.cast_rays(rays)['t_hit'][0].item(), 1.0)
+
+    # setting the transform again does not accumulate
+    scene.set_geometry_transform(geom_id, o3d.core.Tensor(transform))
+    assert np.isclose(scene.cast_rays(rays)['t_hit'][0].item(), 1.0)
+
+    # moving the triangle away makes the ray miss
+    transform[0, 3] = 5
+    scene.set_geometry_transform(geom_id, o3d.core.Tensor(transform))
+    assert np.isinf(scene.cast_rays(rays)['t_hit'][0].item())
+
+
+# packet tracing of camera rays must match single ray tracing
+@pytest.mark.parametrize("shape", ([4, 5, 6], [2, 7, 3, 6], [37, 6]))
+def test_coherent_rays(shape):
+    cube = o3d.t.geometry.TriangleMesh.from_legacy(
+        o3d.geometry.TriangleMesh.create_box())
+
+    scene = o3d.t.geometry.RaycastingScene()
+    scene.add_triangles(cube)
+
+    rays = o3d.t.geometry.RaycastingScene.create_rays_pinhole(
+        fov_deg=90,
+        center=o3d.core.Tensor([0.5, 0.5, 0.5]),
+        eye=o3d.core.Tensor([-1.0, -1.0, -1.0]),
+        up=o3d.core.Tensor([0.0, 0.0, 1.0]),
+        width_px=int(np.prod(shape[1:-1])) if len(shape) > 2 else shape[0],
+        height_px=shape[0] if len(shape) > 2 else 1).reshape(shape)
+
+    ans = scene.cast_rays(rays)
+    ans_coherent = scene.cast_rays(rays, coherent=True)
+    for k in ans:
+        np.testing.assert_allclose(ans[k].numpy(), ans_coherent[k].numpy(),
+                                   rtol=1e-5,
+                                   atol=1e-6)
+
+    np.testing.assert_equal(
+        scene.test_occlusions(rays).numpy(),
+        scene.test_occlusions(rays, coherent=True).numpy())
+
+
 # test occlusion with a single triangle
 def test_test_occlusions():
     vertices = o3d.core.Tensor([[0, 0, 0], [1, 0, 0], [1, 1, 0]],
@@ -220,6 +282,33 @@ def test_compute_signed_distance():
     np.testing.assert_allclose(ans.numpy(), [-0.5, np.sqrt(3 * 0.5**2), 0.0])
 
 
+def test_compute_signed_distance_cached():
+    cube = o3d.t.geometry.TriangleMesh.from_legacy(
+        o3d.geometry.TriangleMesh.create_box())
+
+    scene = o3d.t.geometry.RaycastingScene()
+    scene.add_triangles(cube)
+    voxel_size = 0.05
+    assert scene.create_signed_distance_cache(voxel_size, 0.2) > 0
+
+    rs = np.random.RandomState(123)
+    query_points = o3d.core.Tensor.from_numpy(
+        rs.uniform(-0.5, 1.5, size=(1000, 3)).astype(np.float32))
+    query_points[0] = o3d.core.Tensor([5, 5, 5], dtype=o3d.core.float32)
+    ans = scene.compute_signed_distance(query_points)
+    ans_cached = scene.compute_signed_distance(query_points, use_cache=True)
+    np.testing.assert_allclose(ans_cached.numpy(),
+                               ans.numpy(),
+                               atol=voxel_size)
+    # points outside of the cache are computed exactly
+    assert ans_cached[0].item() == ans[0].item()
+
+    # the cache is discarded when the scene changes
+    scene.add_triangles(cube)
+    with pytest.raises(RuntimeError):
+        scene.compute_signed_distance(query_points, use_cache=True)
+
+
 def test_compute_occupancy():
     cube = o3d.t.geometry.TriangleMesh.from_legacy(
         o3d.geometry.TriangleMesh.create_box())
@@ -159,3 +159,35 @@ def test_locate_leaf_node():
         assert node_info.depth == max_depth
         # Leaf node's size must match
         assert node_info.size == octree.size / np.power(2, max_depth)
+
+
+def test_linear_octree():
+    pcd = o3d.geometry.PointCloud()
+    pcd.points = o3d.utility.Vector3dVector(_eight_cubes_points)
+    pcd.colors = o3d.utility.Vector3dVector(_eight_cubes_colors)
+    octree = o3d.geometry.LinearOctree(1)
+    octree.convert_from_point_cloud(pcd, 0.01)
+    assert octree.get_num_nodes() == 9
+    assert octree.get_num_nodes(1) == 8
+
+    for point, color in zip(_eight_cubes_points, _eight_cubes_colors):
+        node, node_info = octree.locate_leaf_node(point)
+        assert node.is_valid()
+        assert octree.is_leaf_node(node)
+        assert node_info.depth == 1
+        np.testing.assert_equal(octree.get_color(node), color)
+
+    visited = []
+
+    def f_traverse(node, node_info):
+        visited.append(node_info.depth)
+        return False
+
+    octree.traverse(f_traverse)
+    assert visited == [0] + [1] * 8
+
+    legacy_octree = o3d.geometry.Octree(1)
+    legacy_octree.convert_from_point_cloud(pcd, 0.01)
+    np.testing.assert_equal(
+        octree.to_octree().root_node.children[7].indices,
+        legacy_octree.root_node.children[7].indices)